@@ -43,6 +43,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "functional.h"
 #include "utility.h"
+#include "private/algorithm_simd.h"
 
 #include <stdint.h>
 #include <string.h>
@@ -81,8 +82,39 @@ namespace etl
 
   template <typename TIterator, typename TCompare>
   ETL_CONSTEXPR14 void insertion_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last);
+
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare);
+
+  template <typename TIterator, typename TCompare>
+  void sort(TIterator first, TIterator last, TCompare compare);
+
+  // Declared here to allow stable_sort to accept a scratch buffer.
+  template <typename T, size_t Extent>
+  class span;
+
+  // Declared here to allow sort_network to accept an array.
+  template <typename T, size_t SIZE_>
+  class array;
 }
 
+//*****************************************************************************
+// The largest arithmetic range that etl::sort sorts with a sorting network.
+// Define as 0 to always use the general sort.
+//*****************************************************************************
+#if !defined(ETL_SORT_NETWORK_MAX_SIZE)
+  #define ETL_SORT_NETWORK_MAX_SIZE 8
+#endif
+
 //*****************************************************************************
 // Algorithms defined by the ETL
 //*****************************************************************************
@@ -291,7 +323,7 @@ namespace etl
   template <typename TIterator1, typename TIterator2>
   ETL_CONSTEXPR14 TIterator2 move(TIterator1 sb, TIterator1 se, TIterator2 db)
   {
-    return copy(sb, se, db);
+    return etl::copy(sb, se, db);
   }
 #endif
 
@@ -503,6 +535,7 @@ namespace etl
     return last;
   }
 
+#include "private/diagnostic_float_equal_push.h"
   //***************************************************************************
   // find
   //***************************************************************************
@@ -511,6 +544,13 @@ namespace etl
   ETL_CONSTEXPR14
   TIterator find(TIterator first, TIterator last, const T& value)
   {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_find_range<TIterator, T>::value)
+    {
+      return private_algorithm_simd::find(first, last, value);
+    }
+#endif
+
     while (first != last)
     {
       if (*first == value)
@@ -523,6 +563,7 @@ namespace etl
 
     return last;
   }
+#include "private/diagnostic_pop.h"
 
   //***************************************************************************
   // fill
@@ -566,6 +607,7 @@ namespace etl
   }
 #endif
 
+#include "private/diagnostic_float_equal_push.h"
   //***************************************************************************
   // count
   //***************************************************************************
@@ -574,6 +616,13 @@ namespace etl
   ETL_CONSTEXPR14
   typename etl::iterator_traits<TIterator>::difference_type count(TIterator first, TIterator last, const T& value)
   {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_find_range<TIterator, T>::value)
+    {
+      return static_cast<typename iterator_traits<TIterator>::difference_type>(private_algorithm_simd::count(first, last, value));
+    }
+#endif
+
     typename iterator_traits<TIterator>::difference_type n = 0;
 
     while (first != last)
@@ -588,6 +637,7 @@ namespace etl
 
     return n;
   }
+#include "private/diagnostic_pop.h"
 
   //***************************************************************************
   // count_if
@@ -613,6 +663,7 @@ namespace etl
     return n;
   }
 
+#include "private/diagnostic_float_equal_push.h"
   //***************************************************************************
   // equal
 #if ETL_USING_STL && ETL_USING_CPP20
@@ -659,6 +710,15 @@ namespace etl
   ETL_CONSTEXPR14
   bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2)
   {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_mismatch_range<TIterator1, TIterator2>::value)
+    {
+      const size_t n = static_cast<size_t>(etl::distance(first1, last1));
+
+      return private_algorithm_simd::mismatch(first1, first2, n).first == last1;
+    }
+#endif
+
     while (first1 != last1)
     {
       if (*first1 != *first2)
@@ -699,6 +759,15 @@ namespace etl
   ETL_CONSTEXPR14
   bool equal(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
   {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_mismatch_range<TIterator1, TIterator2>::value)
+    {
+      const size_t n = static_cast<size_t>(etl::distance(first1, last1));
+
+      return (n == static_cast<size_t>(etl::distance(first2, last2))) && (private_algorithm_simd::mismatch(first1, first2, n).first == last1);
+    }
+#endif
+
     while ((first1 != last1) && (first2 != last2))
     {
       if (*first1 != *first2)
@@ -734,6 +803,100 @@ namespace etl
   }
 #endif
 
+  //***************************************************************************
+  /// mismatch
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TPredicate predicate)
+  {
+    while ((first1 != last1) && predicate(*first1, *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  //***************************************************************************
+  /// mismatch
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2)
+  {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_mismatch_range<TIterator1, TIterator2>::value)
+    {
+      return private_algorithm_simd::mismatch(first1, first2, static_cast<size_t>(etl::distance(first1, last1)));
+    }
+#endif
+
+    while ((first1 != last1) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  //***************************************************************************
+  /// mismatch
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TPredicate>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TPredicate predicate)
+  {
+    while ((first1 != last1) && (first2 != last2) && predicate(*first1, *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+
+  //***************************************************************************
+  /// mismatch
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/mismatch"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  ETL_OR_STD::pair<TIterator1, TIterator2> mismatch(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2)
+  {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_mismatch_range<TIterator1, TIterator2>::value)
+    {
+      const size_t n1 = static_cast<size_t>(etl::distance(first1, last1));
+      const size_t n2 = static_cast<size_t>(etl::distance(first2, last2));
+
+      return private_algorithm_simd::mismatch(first1, first2, (n1 < n2) ? n1 : n2);
+    }
+#endif
+
+    while ((first1 != last1) && (first2 != last2) && (*first1 == *first2))
+    {
+      ++first1;
+      ++first2;
+    }
+
+    return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+  }
+#include "private/diagnostic_pop.h"
+
   //***************************************************************************
   // lexicographical_compare
   //***************************************************************************
@@ -914,12 +1077,12 @@ namespace etl
 
       while ((value_index > top_index) && compare(first[parent], value))
       {
-        first[value_index] = etl::move(first[parent]);
+        first[value_index] = ETL_MOVE(first[parent]);
         value_index = parent;
         parent = (value_index - 1) / 2;
       }
 
-      first[value_index] = etl::move(value);
+      first[value_index] = ETL_MOVE(value);
     }
 
     // Adjust Heap Helper
@@ -936,18 +1099,18 @@ namespace etl
           --child2nd;
         }
 
-        first[value_index] = etl::move(first[child2nd]);
+        first[value_index] = ETL_MOVE(first[child2nd]);
         value_index = child2nd;
         child2nd = 2 * (child2nd + 1);
       }
 
       if (child2nd == length)
       {
-        first[value_index] = etl::move(first[child2nd - 1]);
+        first[value_index] = ETL_MOVE(first[child2nd - 1]);
         value_index = child2nd - 1;
       }
 
-      push_heap(first, value_index, top_index, etl::move(value), compare);
+      push_heap(first, value_index, top_index, ETL_MOVE(value), compare);
     }
 
     // Is Heap Helper
@@ -980,10 +1143,10 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
     typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
 
-    value_t value = etl::move(last[-1]);
-    last[-1] = etl::move(first[0]);
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
 
-    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), etl::move(value), compare);
+    private_heap::adjust_heap(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
   }
 
   // Pop Heap
@@ -1002,7 +1165,7 @@ namespace etl
     typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
     typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
 
-    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(etl::move(*(last - 1))), compare);
+    private_heap::push_heap(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
   }
 
   // Push Heap
@@ -1030,7 +1193,7 @@ namespace etl
 
     while (true)
     {
-      private_heap::adjust_heap(first, parent, length, etl::move(*(first + parent)), compare);
+      private_heap::adjust_heap(first, parent, length, ETL_MOVE(*(first + parent)), compare);
 
       if (parent == 0)
       {
@@ -1090,6 +1253,209 @@ namespace etl
     }
   }
 
+  //***************************************************************************
+  // D-ary heap
+  // A heap where each node has 'Arity' children instead of two.
+  // A wider heap is shallower, so a push or a priority increase visits fewer
+  // levels, and the children of a node are adjacent in memory.
+  // A d-ary heap with an arity of 2 has the same layout as etl::make_heap.
+  //***************************************************************************
+  namespace private_heap
+  {
+    // Push D-ary Heap Helper
+    template <size_t Arity, typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void push_d_ary_heap(TIterator first, TDistance value_index, TDistance top_index, TValue value, TCompare compare)
+    {
+      const TDistance arity = static_cast<TDistance>(Arity);
+
+      TDistance parent = (value_index - 1) / arity;
+
+      while ((value_index > top_index) && compare(first[parent], value))
+      {
+        first[value_index] = ETL_MOVE(first[parent]);
+        value_index = parent;
+        parent = (value_index - 1) / arity;
+      }
+
+      first[value_index] = ETL_MOVE(value);
+    }
+
+    // Adjust D-ary Heap Helper
+    template <size_t Arity, typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void adjust_d_ary_heap(TIterator first, TDistance value_index, TDistance length, TValue value, TCompare compare)
+    {
+      const TDistance arity = static_cast<TDistance>(Arity);
+
+      TDistance child = (arity * value_index) + 1;
+
+      while (child < length)
+      {
+        // Find the highest priority child.
+        const TDistance last_child = ((length - child) > arity) ? child + arity : length;
+        TDistance best = child;
+
+        for (++child; child < last_child; ++child)
+        {
+          if (compare(first[best], first[child]))
+          {
+            best = child;
+          }
+        }
+
+        if (!compare(value, first[best]))
+        {
+          break;
+        }
+
+        first[value_index] = ETL_MOVE(first[best]);
+        value_index = best;
+        child = (arity * value_index) + 1;
+      }
+
+      first[value_index] = ETL_MOVE(value);
+    }
+
+    // Is D-ary Heap Helper
+    template <size_t Arity, typename TIterator, typename TDistance, typename TCompare>
+    bool is_d_ary_heap(const TIterator first, const TDistance n, TCompare compare)
+    {
+      const TDistance arity = static_cast<TDistance>(Arity);
+
+      for (TDistance child = 1; child < n; ++child)
+      {
+        if (compare(first[(child - 1) / arity], first[child]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+  }
+
+  // Pop D-ary Heap
+  template <size_t Arity, typename TIterator, typename TCompare>
+  void pop_d_ary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(Arity >= 2, "Arity must be at least 2");
+
+    typedef typename etl::iterator_traits<TIterator>::value_type value_t;
+    typedef typename etl::iterator_traits<TIterator>::difference_type distance_t;
+
+    value_t value = ETL_MOVE(last[-1]);
+    last[-1] = ETL_MOVE(first[0]);
+
+    private_heap::adjust_d_ary_heap<Arity>(first, distance_t(0), distance_t(last - first - 1), ETL_MOVE(value), compare);
+  }
+
+  // Pop D-ary Heap
+  template <size_t Arity, typename TIterator>
+  void pop_d_ary_heap(TIterator first, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::pop_d_ary_heap<Arity>(first, last, compare());
+  }
+
+  // Push D-ary Heap
+  template <size_t Arity, typename TIterator, typename TCompare>
+  void push_d_ary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(Arity >= 2, "Arity must be at least 2");
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+
+    private_heap::push_d_ary_heap<Arity>(first, difference_t(last - first - 1), difference_t(0), value_t(ETL_MOVE(*(last - 1))), compare);
+  }
+
+  // Push D-ary Heap
+  template <size_t Arity, typename TIterator>
+  void push_d_ary_heap(TIterator first, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::push_d_ary_heap<Arity>(first, last, compare());
+  }
+
+  // Make D-ary Heap
+  template <size_t Arity, typename TIterator, typename TCompare>
+  void make_d_ary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(Arity >= 2, "Arity must be at least 2");
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if ((last - first) < 2)
+    {
+      return;
+    }
+
+    difference_t length = last - first;
+    difference_t parent = (length - 2) / static_cast<difference_t>(Arity);
+
+    while (true)
+    {
+      private_heap::adjust_d_ary_heap<Arity>(first, parent, length, ETL_MOVE(*(first + parent)), compare);
+
+      if (parent == 0)
+      {
+        return;
+      }
+
+      --parent;
+    }
+  }
+
+  // Make D-ary Heap
+  template <size_t Arity, typename TIterator>
+  void make_d_ary_heap(TIterator first, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    etl::make_d_ary_heap<Arity>(first, last, compare());
+  }
+
+  // Is D-ary Heap
+  template <size_t Arity, typename TIterator>
+  ETL_NODISCARD
+  bool is_d_ary_heap(TIterator first, TIterator last)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator>::value_type> compare;
+
+    return private_heap::is_d_ary_heap<Arity>(first, last - first, compare());
+  }
+
+  // Is D-ary Heap
+  template <size_t Arity, typename TIterator, typename TCompare>
+  ETL_NODISCARD
+  bool is_d_ary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    return private_heap::is_d_ary_heap<Arity>(first, last - first, compare);
+  }
+
+  // Sort D-ary Heap
+  template <size_t Arity, typename TIterator>
+  void sort_d_ary_heap(TIterator first, TIterator last)
+  {
+    while (first != last)
+    {
+      etl::pop_d_ary_heap<Arity>(first, last);
+      --last;
+    }
+  }
+
+  // Sort D-ary Heap
+  template <size_t Arity, typename TIterator, typename TCompare>
+  void sort_d_ary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    while (first != last)
+    {
+      etl::pop_d_ary_heap<Arity>(first, last, compare);
+      --last;
+    }
+  }
+
   //***************************************************************************
   // Search
   //***************************************************************************
@@ -1149,28 +1515,57 @@ namespace etl
     ETL_CONSTEXPR14
     TIterator rotate_general(TIterator first, TIterator middle, TIterator last)
     {
+      using ETL_OR_STD::swap; // Allow ADL
+
       TIterator next = middle;
 
-      while (first != next)
+      // Swap until the end of the range is reached.
+      while (true)
       {
-        using ETL_OR_STD::swap; // Allow ADL
-
         swap(*first, *next);
-
         ++first;
-        ++next;
 
-        if (next == last)
+        if (++next == last)
         {
-          next = middle;
+          break;
         }
-        else if (first == middle)
+
+        if (first == middle)
         {
           middle = next;
         }
       }
 
-      return first;
+      // This is the new position of the original first item.
+      TIterator result = first;
+
+      // Rotate the remainder.
+      if (first != middle)
+      {
+        next = middle;
+
+        while (true)
+        {
+          swap(*first, *next);
+          ++first;
+
+          if (++next == last)
+          {
+            if (first == middle)
+            {
+              break;
+            }
+
+            next = middle;
+          }
+          else if (first == middle)
+          {
+            middle = next;
+          }
+        }
+      }
+
+      return result;
     }
 
     //*********************************
@@ -1181,13 +1576,13 @@ namespace etl
       typedef typename etl::iterator_traits<TIterator>::value_type value_type;
 
       // Save the first item.
-      value_type temp(etl::move(*first));
+      value_type temp(ETL_MOVE(*first));
 
       // Move the rest.
       TIterator result = etl::move(etl::next(first), last, first);
 
       // Restore the first item in its rotated position.
-      *result = etl::move(temp);
+      *result = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1202,13 +1597,13 @@ namespace etl
 
       // Save the last item.
       TIterator previous = etl::prev(last);
-      value_type temp(etl::move(*previous));
+      value_type temp(ETL_MOVE(*previous));
 
       // Move the rest.
       TIterator result = etl::move_backward(first, previous, last);
 
       // Restore the last item in its rotated position.
-      *first = etl::move(temp);
+      *first = ETL_MOVE(temp);
 
       // The new position of the first item.
       return result;
@@ -1220,6 +1615,16 @@ namespace etl
   ETL_CONSTEXPR14
   TIterator rotate(TIterator first, TIterator middle, TIterator last)
   {
+    if (first == middle)
+    {
+      return last;
+    }
+
+    if (middle == last)
+    {
+      return first;
+    }
+
     if (etl::next(first) == middle)
     {
       return private_algorithm::rotate_left_by_one(first, last);
@@ -1322,8 +1727,21 @@ namespace etl
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
-    return etl::min_element(begin, end, etl::less<value_t>());
-  }
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_minmax_range<TIterator>::value)
+    {
+      TIterator minimum = begin;
+      TIterator maximum = begin;
+
+      if (private_algorithm_simd::minmax_element(begin, end, minimum, maximum, false))
+      {
+        return minimum;
+      }
+    }
+#endif
+
+    return etl::min_element(begin, end, etl::less<value_t>());
+  }
 
   //***************************************************************************
   /// Finds the iterator to the largest element in the range (begin, end).<br>
@@ -1416,6 +1834,19 @@ namespace etl
   {
     typedef typename etl::iterator_traits<TIterator>::value_type value_t;
 
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_minmax_range<TIterator>::value)
+    {
+      TIterator minimum = begin;
+      TIterator maximum = begin;
+
+      if (private_algorithm_simd::minmax_element(begin, end, minimum, maximum, true))
+      {
+        return ETL_OR_STD::pair<TIterator, TIterator>(minimum, maximum);
+      }
+    }
+#endif
+
     return etl::minmax_element(begin, end, etl::less<value_t>());
   }
 
@@ -1860,7 +2291,443 @@ namespace etl
     return etl::find_if(begin, end, predicate) == end;
   }
 
+  //***************************************************************************
+  // Sorting networks
+  // Sorts a fixed number of elements with a fixed sequence of compare and
+  // exchange steps, so there are no data dependent branches.
+  // The networks are Batcher's merge exchange (Knuth, TAOCP 5.2.2 M), which
+  // is optimal up to eight elements and close to the best known networks up
+  // to 32. From C++14 the network is generated as a table at compile time.
+  //***************************************************************************
+  namespace private_sort_network
+  {
+    //*********************************
+    /// Calls 'function(i, j)' for each compare and exchange of a network of 'n' elements.
+    //*********************************
+    template <typename TFunction>
+    ETL_CONSTEXPR14 void merge_exchange(size_t n, TFunction& function)
+    {
+      if (n < 2U)
+      {
+        return;
+      }
+
+      size_t t = 0U;
+
+      while ((size_t(1U) << t) < n)
+      {
+        ++t;
+      }
+
+      for (size_t p = size_t(1U) << (t - 1U); p > 0U; p >>= 1U)
+      {
+        size_t q = size_t(1U) << (t - 1U);
+        size_t r = 0U;
+        size_t d = p;
+
+        while (d > 0U)
+        {
+          for (size_t i = 0U; i < (n - d); ++i)
+          {
+            if ((i & p) == r)
+            {
+              function(i, i + d);
+            }
+          }
+
+          d = q - p;
+          q >>= 1U;
+          r = p;
+        }
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*********************************
+    struct network_counter
+    {
+      ETL_CONSTEXPR14 void operator ()(size_t, size_t)
+      {
+        ++count;
+      }
+
+      size_t count;
+    };
+
+    //*********************************
+    template <size_t VSize>
+    struct network_table
+    {
+      ETL_CONSTEXPR14 void operator ()(size_t i, size_t j)
+      {
+        first[index]  = uint8_t(i);
+        second[index] = uint8_t(j);
+        ++index;
+      }
+
+      // One more than needed, so that an empty network is valid.
+      uint8_t first[VSize + 1U];
+      uint8_t second[VSize + 1U];
+      size_t  index;
+    };
+
+    //*********************************
+    template <size_t VN>
+    constexpr size_t network_size()
+    {
+      network_counter counter = { 0U };
+      merge_exchange(VN, counter);
+
+      return counter.count;
+    }
+
+    //*********************************
+    template <size_t VN, size_t VSize>
+    constexpr network_table<VSize> make_network_table()
+    {
+      network_table<VSize> table = { {}, {}, 0U };
+      merge_exchange(VN, table);
+
+      return table;
+    }
+#endif
+
+    //*********************************
+    /// The sorting network for VN elements.
+    //*********************************
+    template <size_t VN>
+    struct network
+    {
+      ETL_STATIC_ASSERT(VN <= 256U, "Sorting networks are limited to 256 elements");
+
+#if ETL_USING_CPP14
+      static constexpr size_t Size = network_size<VN>();
+
+      static constexpr network_table<Size> table = make_network_table<VN, Size>();
+
+      //*********************************
+      template <typename TFunction>
+      static void for_each(TFunction& function)
+      {
+        for (size_t k = 0U; k < Size; ++k)
+        {
+          function(size_t(table.first[k]), size_t(table.second[k]));
+        }
+      }
+#else
+      //*********************************
+      template <typename TFunction>
+      static void for_each(TFunction& function)
+      {
+        merge_exchange(VN, function);
+      }
+#endif
+    };
+
+#if ETL_USING_CPP14
+    template <size_t VN>
+    constexpr size_t network<VN>::Size;
+
+    template <size_t VN>
+    constexpr network_table<network<VN>::Size> network<VN>::table;
+#endif
+
+    //*********************************
+    /// Compares and exchanges elements.
+    /// Arithmetic values are selected rather than swapped, which compiles to
+    /// conditional moves or minimum and maximum instructions.
+    //*********************************
+    template <typename TIterator, typename TCompare, bool Is_Arithmetic = etl::is_arithmetic<typename etl::iterator_traits<TIterator>::value_type>::value>
+    struct compare_exchange
+    {
+      compare_exchange(TIterator first_, TCompare compare_)
+        : first(first_)
+        , compare(compare_)
+      {
+      }
+
+      void operator ()(size_t i, size_t j)
+      {
+        TIterator a = first + i;
+        TIterator b = first + j;
+
+        if (compare(*b, *a))
+        {
+          etl::iter_swap(a, b);
+        }
+      }
+
+      TIterator first;
+      TCompare  compare;
+    };
+
+    template <typename TIterator, typename TCompare>
+    struct compare_exchange<TIterator, TCompare, true>
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      compare_exchange(TIterator first_, TCompare compare_)
+        : first(first_)
+        , compare(compare_)
+      {
+      }
+
+      void operator ()(size_t i, size_t j)
+      {
+        const value_type a = first[i];
+        const value_type b = first[j];
+        const bool       exchange = compare(b, a);
+
+        first[i] = exchange ? b : a;
+        first[j] = exchange ? a : b;
+      }
+
+      TIterator first;
+      TCompare  compare;
+    };
+
+    //*********************************
+    /// Compares and exchanges the elements of a column of a table.
+    //*********************************
+    template <typename T, typename TCompare>
+    struct column_compare_exchange
+    {
+      column_compare_exchange(T* column_, size_t stride_, TCompare compare_)
+        : column(column_)
+        , stride(stride_)
+        , compare(compare_)
+      {
+      }
+
+      void operator ()(size_t i, size_t j)
+      {
+        compare_exchange<T*, TCompare> exchange(column, compare);
+
+        exchange(i * stride, j * stride);
+      }
+
+      T*       column;
+      size_t   stride;
+      TCompare compare;
+    };
+
+    //*********************************
+    /// Sorts ranges of up to VMax_Size elements with a sorting network.
+    /// Returns false if the range is larger.
+    //*********************************
+    template <size_t VMax_Size>
+    struct small_sort
+    {
+      template <typename TIterator, typename TCompare>
+      static bool sort(TIterator first, size_t n, TCompare compare)
+      {
+        if (n == VMax_Size)
+        {
+          compare_exchange<TIterator, TCompare> exchange(first, compare);
+          network<VMax_Size>::for_each(exchange);
+
+          return true;
+        }
+
+        return small_sort<VMax_Size - 1U>::sort(first, n, compare);
+      }
+    };
+
+    template <>
+    struct small_sort<1U>
+    {
+      template <typename TIterator, typename TCompare>
+      static bool sort(TIterator, size_t n, TCompare)
+      {
+        return n <= 1U;
+      }
+    };
+
+    template <>
+    struct small_sort<0U>
+    {
+      template <typename TIterator, typename TCompare>
+      static bool sort(TIterator, size_t, TCompare)
+      {
+        return false;
+      }
+    };
+
+    //*********************************
+    /// The sort used by etl::sort for tiny ranges of arithmetic values.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_arithmetic<typename etl::iterator_traits<TIterator>::value_type>::value, bool>::type
+      sort_tiny(TIterator first, TIterator last, TCompare compare)
+    {
+      return small_sort<ETL_SORT_NETWORK_MAX_SIZE>::sort(first, size_t(last - first), compare);
+    }
+
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_arithmetic<typename etl::iterator_traits<TIterator>::value_type>::value, bool>::type
+      sort_tiny(TIterator, TIterator, TCompare)
+    {
+      return false;
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts VN elements from 'first' with a sorting network.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t VN, typename TIterator, typename TCompare>
+  void sort_network(TIterator first, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "sort_network requires random access iterators");
+
+    private_sort_network::compare_exchange<TIterator, TCompare> exchange(first, compare);
+    private_sort_network::network<VN>::for_each(exchange);
+  }
+
+  //***************************************************************************
+  /// Sorts VN elements from 'first' with a sorting network.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t VN, typename TIterator>
+  void sort_network(TIterator first)
+  {
+    etl::sort_network<VN>(first, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts an etl::array with a sorting network.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T, size_t VN, typename TCompare>
+  void sort_network(etl::array<T, VN>& a, TCompare compare)
+  {
+    etl::sort_network<VN>(a.data(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts an etl::array with a sorting network.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename T, size_t VN>
+  void sort_network(etl::array<T, VN>& a)
+  {
+    etl::sort_network<VN>(a.data(), etl::less<T>());
+  }
+
+  //***************************************************************************
+  /// Sorts each column of a table of VN rows with a sorting network.
+  /// Element 'c' of row 'r' is at data[(r * columns) + c].
+  /// Sorting many small arrays as the columns of a table lets every compare
+  /// and exchange work on a vector of columns at once, for 8, 16 and 32 bit
+  /// integrals and floats when vector instructions are enabled.
+  /// Uses user defined comparison, which is never vectorised.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t VN, typename T, typename TCompare>
+  void sort_network_columns(T* data, size_t columns, TCompare compare)
+  {
+    for (size_t c = 0U; c < columns; ++c)
+    {
+      private_sort_network::column_compare_exchange<T, TCompare> exchange(data + c, columns, compare);
+      private_sort_network::network<VN>::for_each(exchange);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts each column of a table of VN rows with a sorting network.
+  /// Element 'c' of row 'r' is at data[(r * columns) + c].
+  /// Sorting many small arrays as the columns of a table lets every compare
+  /// and exchange work on a vector of columns at once, for 8, 16 and 32 bit
+  /// integrals and floats when vector instructions are enabled.
+  /// Floats must not be NaN.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t VN, typename T>
+  void sort_network_columns(T* data, size_t columns)
+  {
+    size_t done = 0U;
+
+#if ETL_USING_ALGORITHM_SIMD
+    done = private_algorithm_simd::sort_network_columns<VN, private_sort_network::network<VN> >(data, columns);
+#endif
+
+    for (size_t c = done; c < columns; ++c)
+    {
+      private_sort_network::column_compare_exchange<T, etl::less<T> > exchange(data + c, columns, etl::less<T>());
+      private_sort_network::network<VN>::for_each(exchange);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Ranges of up to 16 elements are sorted with a sorting network, larger
+  /// ranges with etl::sort.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void small_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "small_sort requires random access iterators");
+
+    if (!private_sort_network::small_sort<16U>::sort(first, size_t(last - first), compare))
+    {
+      etl::sort(first, last, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Ranges of up to 16 elements are sorted with a sorting network, larger
+  /// ranges with etl::sort.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void small_sort(TIterator first, TIterator last)
+  {
+    etl::small_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
 #if ETL_NOT_USING_STL
+  namespace private_algorithm
+  {
+    //*********************************
+    // Random access iterators use intro sort, unless ETL_SORT_USE_SHELL_SORT
+    // is defined to select the smaller shell sort.
+    // Arithmetic ranges of up to ETL_SORT_NETWORK_MAX_SIZE elements use a
+    // sorting network.
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      if (private_sort_network::sort_tiny(first, last, compare))
+      {
+        return;
+      }
+
+#if defined(ETL_SORT_USE_SHELL_SORT)
+      etl::shell_sort(first, last, compare);
+#else
+      etl::intro_sort(first, last, compare);
+#endif
+    }
+
+    //*********************************
+    // Other iterators use shell sort.
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::shell_sort(first, last, compare);
+    }
+  }
+
   //***************************************************************************
   /// Sorts the elements.
   /// Uses user defined comparison.
@@ -1869,7 +2736,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::shell_sort(first, last, compare);
+    private_algorithm::sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -1879,7 +2746,28 @@ namespace etl
   template <typename TIterator>
   void sort(TIterator first, TIterator last)
   {
-    etl::shell_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  namespace private_algorithm
+  {
+    //*********************************
+    // Random access iterators use in-place merge sort.
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::merge_sort(first, last, compare);
+    }
+
+    //*********************************
+    // Other iterators use insertion sort.
+    template <typename TIterator, typename TCompare>
+    typename etl::enable_if<!etl::is_random_access_iterator<TIterator>::value, void>::type
+      stable_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      etl::insertion_sort(first, last, compare);
+    }
   }
 
   //***************************************************************************
@@ -1891,7 +2779,7 @@ namespace etl
   template <typename TIterator, typename TCompare>
   void stable_sort(TIterator first, TIterator last, TCompare compare)
   {
-    etl::insertion_sort(first, last, compare);
+    private_algorithm::stable_sort(first, last, compare);
   }
 
   //***************************************************************************
@@ -1902,7 +2790,7 @@ namespace etl
   template <typename TIterator>
   void stable_sort(TIterator first, TIterator last)
   {
-    etl::insertion_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+    private_algorithm::stable_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
   }
 #else
   //***************************************************************************
@@ -1960,7 +2848,7 @@ namespace etl
   {
     while (first != last)
     {
-      sum = etl::move(sum) + *first;
+      sum = ETL_MOVE(sum) + *first;
       ++first;
     }
       
@@ -1977,7 +2865,7 @@ namespace etl
   {
     while (first != last)
     {
-      sum = operation(etl::move(sum), *first);
+      sum = operation(ETL_MOVE(sum), *first);
       ++first;
     }
 
@@ -2020,7 +2908,7 @@ namespace etl
       {
         if (!(*itr == value))
         {
-          *first = etl::move(*itr);
+          *first = ETL_MOVE(*itr);
           ++first;
         }
 
@@ -2049,7 +2937,7 @@ namespace etl
       {
         if (!predicate(*itr))
         {
-          *first = etl::move(*itr);
+          *first = ETL_MOVE(*itr);
           ++first;
         }
 
@@ -2283,7 +3171,7 @@ namespace etl
   {
     while ((i_begin != i_end) && (o_begin != o_end))
     {
-      *o_begin = etl::move(*i_begin);
+      *o_begin = ETL_MOVE(*i_begin);
       ++i_begin;
       ++o_begin;
     }
@@ -2910,6 +3798,1753 @@ namespace etl
     etl::sort_heap(first, last);
   }
 
+  //***************************************************************************
+  // Intro sort
+  // A pattern-defeating quicksort (pdqsort) that falls back to heap sort when
+  // the partitioning degrades and finishes small partitions with insertion sort.
+  // Does not allocate, and the recursion depth is bounded to O(log N).
+  //***************************************************************************
+  namespace private_intro_sort
+  {
+    // Partitions smaller than this are sorted with insertion sort.
+    static ETL_CONSTANT ptrdiff_t Insertion_Sort_Threshold = 24;
+
+    // Partitions larger than this use the pseudo median of nine as the pivot.
+    static ETL_CONSTANT ptrdiff_t Ninther_Threshold = 128;
+
+    // The maximum number of moves a partial insertion sort may make before giving up.
+    static ETL_CONSTANT ptrdiff_t Partial_Insertion_Sort_Limit = 8;
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void sort2(TIterator a, TIterator b, TCompare compare)
+    {
+      if (compare(*b, *a))
+      {
+        etl::iter_swap(a, b);
+      }
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void sort3(TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      private_intro_sort::sort2(a, b, compare);
+      private_intro_sort::sort2(b, c, compare);
+      private_intro_sort::sort2(a, b, compare);
+    }
+
+    //*********************************
+    /// Insertion sort that checks for the start of the range.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*********************************
+    /// Insertion sort that assumes that *(first - 1) is a sentinel that
+    /// is not greater than any element in the range.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    void unguarded_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while (compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+        }
+      }
+    }
+
+    //*********************************
+    /// Attempts an insertion sort, but gives up if too many moves are required.
+    /// Returns true if the range was successfully sorted.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    bool partial_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      if (first == last)
+      {
+        return true;
+      }
+
+      ptrdiff_t moves = 0;
+
+      for (TIterator current = first + 1; current != last; ++current)
+      {
+        TIterator sift   = current;
+        TIterator sift_1 = current - 1;
+
+        if (compare(*sift, *sift_1))
+        {
+          value_type temp(ETL_MOVE(*sift));
+
+          do
+          {
+            *sift-- = ETL_MOVE(*sift_1);
+          } while ((sift != first) && compare(temp, *--sift_1));
+
+          *sift = ETL_MOVE(temp);
+          moves += (current - sift);
+        }
+
+        if (moves > Partial_Insertion_Sort_Limit)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*********************************
+    /// Partitions around the pivot at *first.
+    /// Elements equal to the pivot are placed in the right hand partition.
+    /// Returns the position of the pivot and whether the range was already partitioned.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    ETL_OR_STD::pair<TIterator, bool> partition_right(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*first));
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      // Find the first element not less than the pivot.
+      while (compare(*++left, pivot))
+      {
+      }
+
+      // Find the last element less than the pivot.
+      if ((left - 1) == first)
+      {
+        while ((left < right) && !compare(*--right, pivot))
+        {
+        }
+      }
+      else
+      {
+        // Guarded by the element found by the previous search.
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      const bool already_partitioned = (left >= right);
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(*++left, pivot))
+        {
+        }
+
+        while (!compare(*--right, pivot))
+        {
+        }
+      }
+
+      TIterator pivot_position = left - 1;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return ETL_OR_STD::pair<TIterator, bool>(pivot_position, already_partitioned);
+    }
+
+    //*********************************
+    /// Partitions around the pivot at *first.
+    /// Elements equal to the pivot are placed in the left hand partition.
+    /// Used when the range contains many elements equal to the pivot.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_CONSTEXPR14
+    TIterator partition_left(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      value_type pivot(ETL_MOVE(*first));
+
+      TIterator left  = first;
+      TIterator right = last;
+
+      while (compare(pivot, *--right))
+      {
+      }
+
+      if ((right + 1) == last)
+      {
+        while ((left < right) && !compare(pivot, *++left))
+        {
+        }
+      }
+      else
+      {
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      while (left < right)
+      {
+        etl::iter_swap(left, right);
+
+        while (compare(pivot, *--right))
+        {
+        }
+
+        while (!compare(pivot, *++left))
+        {
+        }
+      }
+
+      TIterator pivot_position = right;
+      *first          = ETL_MOVE(*pivot_position);
+      *pivot_position = ETL_MOVE(pivot);
+
+      return pivot_position;
+    }
+
+    //*********************************
+    /// Swaps a few elements to break up patterns that cause unbalanced partitions.
+    //*********************************
+    template <typename TIterator>
+    ETL_CONSTEXPR14
+    void break_patterns(TIterator first, TIterator last)
+    {
+      const ptrdiff_t size = last - first;
+
+      if (size >= Insertion_Sort_Threshold)
+      {
+        const ptrdiff_t quarter = size / 4;
+
+        etl::iter_swap(first,    first + quarter);
+        etl::iter_swap(last - 1, last - quarter);
+
+        if (size > Ninther_Threshold)
+        {
+          etl::iter_swap(first + 1, first + (quarter + 1));
+          etl::iter_swap(first + 2, first + (quarter + 2));
+          etl::iter_swap(last - 2,  last - (quarter + 1));
+          etl::iter_swap(last - 3,  last - (quarter + 2));
+        }
+      }
+    }
+
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void intro_sort_loop(TIterator first, TIterator last, TCompare compare, int bad_allowed, bool leftmost)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while (true)
+      {
+        const difference_t size = last - first;
+
+        if (size < Insertion_Sort_Threshold)
+        {
+          if (leftmost)
+          {
+            private_intro_sort::insertion_sort(first, last, compare);
+          }
+          else
+          {
+            private_intro_sort::unguarded_insertion_sort(first, last, compare);
+          }
+
+          return;
+        }
+
+        // Choose the pivot and move it to the start of the range.
+        const difference_t half = size / 2;
+
+        if (size > Ninther_Threshold)
+        {
+          private_intro_sort::sort3(first,              first + half,       last - 1, compare);
+          private_intro_sort::sort3(first + 1,          first + (half - 1), last - 2, compare);
+          private_intro_sort::sort3(first + 2,          first + (half + 1), last - 3, compare);
+          private_intro_sort::sort3(first + (half - 1), first + half,       first + (half + 1), compare);
+          etl::iter_swap(first, first + half);
+        }
+        else
+        {
+          private_intro_sort::sort3(first + half, first, last - 1, compare);
+        }
+
+        // If the pivot is equal to the element before this partition then all elements
+        // equal to the pivot can be put on the left and need no further sorting.
+        if (!leftmost && !compare(*(first - 1), *first))
+        {
+          first = private_intro_sort::partition_left(first, last, compare) + 1;
+          continue;
+        }
+
+        ETL_OR_STD::pair<TIterator, bool> result = private_intro_sort::partition_right(first, last, compare);
+
+        TIterator  pivot_position      = result.first;
+        const bool already_partitioned = result.second;
+
+        const difference_t left_size  = pivot_position - first;
+        const difference_t right_size = last - (pivot_position + 1);
+        const bool highly_unbalanced  = (left_size < (size / 8)) || (right_size < (size / 8));
+
+        if (highly_unbalanced)
+        {
+          // Too many bad partitions; fall back to heap sort to guarantee O(N log N).
+          if (--bad_allowed == 0)
+          {
+            etl::make_heap(first, last, compare);
+            etl::sort_heap(first, last, compare);
+            return;
+          }
+
+          private_intro_sort::break_patterns(first, pivot_position);
+          private_intro_sort::break_patterns(pivot_position + 1, last);
+        }
+        else
+        {
+          // Try to finish quickly if the range looks to have been already sorted.
+          if (already_partitioned &&
+              private_intro_sort::partial_insertion_sort(first, pivot_position, compare) &&
+              private_intro_sort::partial_insertion_sort(pivot_position + 1, last, compare))
+          {
+            return;
+          }
+        }
+
+        // Recurse into the left partition and loop on the right.
+        private_intro_sort::intro_sort_loop(first, pivot_position, compare, bad_allowed, leftmost);
+        first    = pivot_position + 1;
+        leftmost = false;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using intro sort (pattern-defeating quicksort).
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void intro_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "intro_sort requires random access iterators");
+
+    if (first == last)
+    {
+      return;
+    }
+
+    // The number of bad partitions that are allowed before switching to heap sort.
+    int bad_allowed = 0;
+
+    for (typename etl::iterator_traits<TIterator>::difference_type n = (last - first); n > 1; n >>= 1)
+    {
+      ++bad_allowed;
+    }
+
+    private_intro_sort::intro_sort_loop(first, last, compare, bad_allowed, true);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using intro sort (pattern-defeating quicksort).
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void intro_sort(TIterator first, TIterator last)
+  {
+    etl::intro_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  // Selection
+  // nth_element uses introselect: quickselect with a median of three pivot,
+  // that switches to a median of medians pivot when the partitions keep
+  // shrinking too slowly, so the worst case stays O(N).
+  // partial_sort and partial_sort_copy keep the smallest elements in a heap,
+  // which takes O(N log K) time.
+  // None of them allocate.
+  //***************************************************************************
+  namespace private_selection
+  {
+    // Ranges smaller than this are finished with insertion sort.
+    static ETL_CONSTANT ptrdiff_t Insertion_Sort_Threshold = 16;
+
+    // The size of the groups used to pick the median of medians.
+    static ETL_CONSTANT ptrdiff_t Group_Size = 5;
+
+    //*********************************
+    /// Partitions the range into elements less than the pivot, equal to the
+    /// pivot and greater than the pivot.
+    /// Returns the range of the elements that are equal to the pivot.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    ETL_OR_STD::pair<TIterator, TIterator> partition3(TIterator first, TIterator last, TIterator pivot_position, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+      const value_type pivot(*pivot_position);
+
+      TIterator lower   = first;
+      TIterator current = first;
+      TIterator upper   = last;
+
+      while (current != upper)
+      {
+        if (compare(*current, pivot))
+        {
+          etl::iter_swap(lower, current);
+          ++lower;
+          ++current;
+        }
+        else if (compare(pivot, *current))
+        {
+          --upper;
+          etl::iter_swap(current, upper);
+        }
+        else
+        {
+          ++current;
+        }
+      }
+
+      return ETL_OR_STD::pair<TIterator, TIterator>(lower, upper);
+    }
+
+    template <typename TIterator, typename TCompare>
+    void select(TIterator first, TIterator nth, TIterator last, TCompare compare, int bad_allowed);
+
+    //*********************************
+    /// Moves the medians of groups of five to the start of the range and
+    /// returns the median of those medians.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    TIterator median_of_medians(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t groups = (last - first) / Group_Size;
+
+      for (difference_t i = 0; i < groups; ++i)
+      {
+        TIterator group = first + (i * Group_Size);
+
+        private_intro_sort::insertion_sort(group, group + Group_Size, compare);
+        etl::iter_swap(first + i, group + (Group_Size / 2));
+      }
+
+      TIterator median = first + (groups / 2);
+
+      // Selecting among the medians only uses median of medians pivots.
+      private_selection::select(first, median, first + groups, compare, 0);
+
+      return median;
+    }
+
+    //*********************************
+    /// Introselect.
+    /// 'bad_allowed' is the number of slowly shrinking partitions that are
+    /// allowed before switching to the median of medians pivot.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    void select(TIterator first, TIterator nth, TIterator last, TCompare compare, int bad_allowed)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      while ((last - first) >= Insertion_Sort_Threshold)
+      {
+        const difference_t size = last - first;
+
+        TIterator pivot_position;
+
+        if (bad_allowed > 0)
+        {
+          pivot_position = first + (size / 2);
+          private_intro_sort::sort3(first, pivot_position, last - 1, compare);
+        }
+        else
+        {
+          pivot_position = private_selection::median_of_medians(first, last, compare);
+        }
+
+        ETL_OR_STD::pair<TIterator, TIterator> equal = private_selection::partition3(first, last, pivot_position, compare);
+
+        if (nth < equal.first)
+        {
+          last = equal.first;
+        }
+        else if (nth >= equal.second)
+        {
+          first = equal.second;
+        }
+        else
+        {
+          return;
+        }
+
+        // Count the partitions that kept more than three quarters of the range.
+        if ((bad_allowed > 0) && ((last - first) > (size - (size / 4))))
+        {
+          --bad_allowed;
+        }
+      }
+
+      private_intro_sort::insertion_sort(first, last, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Rearranges the elements so that the nth element is the one that would be
+  /// there if the range was sorted, with no element before it greater than it
+  /// and no element after it less than it.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "nth_element requires random access iterators");
+
+    if ((first == last) || (nth == last))
+    {
+      return;
+    }
+
+    // The number of slowly shrinking partitions that are allowed before switching to median of medians.
+    int bad_allowed = 0;
+
+    for (typename etl::iterator_traits<TIterator>::difference_type n = (last - first); n > 1; n >>= 1)
+    {
+      ++bad_allowed;
+    }
+
+    private_selection::select(first, nth, last, compare, bad_allowed);
+  }
+
+  //***************************************************************************
+  /// Rearranges the elements so that the nth element is the one that would be
+  /// there if the range was sorted.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void nth_element(TIterator first, TIterator nth, TIterator last)
+  {
+    etl::nth_element(first, nth, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  /// The order of the rest of the elements is unspecified.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "partial_sort requires random access iterators");
+
+    typedef typename etl::iterator_traits<TIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if (first == middle)
+    {
+      return;
+    }
+
+    etl::make_heap(first, middle, compare);
+
+    const difference_t length = middle - first;
+
+    for (TIterator itr = middle; itr != last; ++itr)
+    {
+      // Replace the largest of the smallest so far.
+      if (compare(*itr, *first))
+      {
+        value_t value = ETL_MOVE(*itr);
+        *itr = ETL_MOVE(*first);
+        private_heap::adjust_heap(first, difference_t(0), length, ETL_MOVE(value), compare);
+      }
+    }
+
+    etl::sort_heap(first, middle, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  /// The order of the rest of the elements is unspecified.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  //***************************************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::partial_sort(first, middle, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Copies the smallest elements of [first, last) to [d_first, d_last) in
+  /// sorted order, as many as will fit.
+  /// The destination requires random access iterators.
+  /// Returns an iterator to the end of the copied elements.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator, typename TCompare>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last,
+                                          TRandomAccessIterator d_first, TRandomAccessIterator d_last,
+                                          TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TRandomAccessIterator>::value, "partial_sort_copy requires random access destination iterators");
+
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::value_type      value_t;
+    typedef typename etl::iterator_traits<TRandomAccessIterator>::difference_type difference_t;
+
+    TRandomAccessIterator d_middle = d_first;
+
+    while ((first != last) && (d_middle != d_last))
+    {
+      *d_middle = *first;
+      ++d_middle;
+      ++first;
+    }
+
+    if (d_middle == d_first)
+    {
+      return d_middle;
+    }
+
+    etl::make_heap(d_first, d_middle, compare);
+
+    const difference_t length = d_middle - d_first;
+
+    for (; first != last; ++first)
+    {
+      // Replace the largest of the smallest so far.
+      if (compare(*first, *d_first))
+      {
+        private_heap::adjust_heap(d_first, difference_t(0), length, value_t(*first), compare);
+      }
+    }
+
+    etl::sort_heap(d_first, d_middle, compare);
+
+    return d_middle;
+  }
+
+  //***************************************************************************
+  /// Copies the smallest elements of [first, last) to [d_first, d_last) in
+  /// sorted order, as many as will fit.
+  /// The destination requires random access iterators.
+  /// Returns an iterator to the end of the copied elements.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort_copy"></a>
+  //***************************************************************************
+  template <typename TInputIterator, typename TRandomAccessIterator>
+  TRandomAccessIterator partial_sort_copy(TInputIterator first, TInputIterator last,
+                                          TRandomAccessIterator d_first, TRandomAccessIterator d_last)
+  {
+    return etl::partial_sort_copy(first, last, d_first, d_last, etl::less<typename etl::iterator_traits<TRandomAccessIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  // Merge sort
+  // A stable sort that runs in O(N log N) when given a scratch buffer of at
+  // least N / 2 elements, and in O(N log^2 N) in place when a buffer is not
+  // available or is too small.
+  //***************************************************************************
+  namespace private_merge_sort
+  {
+    // Ranges smaller than this are sorted with insertion sort.
+    static ETL_CONSTANT ptrdiff_t Insertion_Sort_Threshold = 16;
+
+    //*********************************
+    /// Merges [first, middle) and [middle, last) using the buffer to hold the left range.
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_left_with_buffer(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      TBufferIterator buffer_end = etl::move(first, middle, buffer);
+
+      while ((buffer != buffer_end) && (middle != last))
+      {
+        if (compare(*middle, *buffer))
+        {
+          *first = ETL_MOVE(*middle);
+          ++middle;
+        }
+        else
+        {
+          *first = ETL_MOVE(*buffer);
+          ++buffer;
+        }
+
+        ++first;
+      }
+
+      etl::move(buffer, buffer_end, first);
+    }
+
+    //*********************************
+    /// Merges [first, middle) and [middle, last) using the buffer to hold the right range.
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TCompare>
+    void merge_right_with_buffer(TIterator first, TIterator middle, TIterator last, TBufferIterator buffer, TCompare compare)
+    {
+      TBufferIterator buffer_end = etl::move(middle, last, buffer);
+
+      while ((buffer != buffer_end) && (middle != first))
+      {
+        if (compare(*(buffer_end - 1), *(middle - 1)))
+        {
+          *--last = ETL_MOVE(*--middle);
+        }
+        else
+        {
+          *--last = ETL_MOVE(*--buffer_end);
+        }
+      }
+
+      etl::move_backward(buffer, buffer_end, last);
+    }
+
+    //*********************************
+    /// Merges [first, middle) and [middle, last).
+    /// Uses the buffer if one of the ranges will fit, otherwise splits the
+    /// ranges and merges them in place using rotations.
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_adaptive(TIterator first, TIterator middle, TIterator last,
+                        TDistance length1, TDistance length2,
+                        TBufferIterator buffer, TDistance buffer_size,
+                        TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if (length1 <= buffer_size)
+        {
+          merge_left_with_buffer(first, middle, last, buffer, compare);
+          return;
+        }
+
+        if (length2 <= buffer_size)
+        {
+          merge_right_with_buffer(first, middle, last, buffer, compare);
+          return;
+        }
+
+        if ((length1 + length2) == 2)
+        {
+          if (compare(*middle, *first))
+          {
+            etl::iter_swap(first, middle);
+          }
+
+          return;
+        }
+
+        TIterator first_cut;
+        TIterator second_cut;
+        TDistance length11;
+        TDistance length22;
+
+        if (length1 > length2)
+        {
+          length11   = length1 / 2;
+          first_cut  = first + length11;
+          second_cut = etl::lower_bound(middle, last, *first_cut, compare);
+          length22   = second_cut - middle;
+        }
+        else
+        {
+          length22   = length2 / 2;
+          second_cut = middle + length22;
+          first_cut  = etl::upper_bound(first, middle, *second_cut, compare);
+          length11   = first_cut - first;
+        }
+
+        TIterator new_middle = etl::rotate(first_cut, middle, second_cut);
+
+        // Recurse on the left and loop on the right.
+        merge_adaptive(first, first_cut, new_middle, length11, length22, buffer, buffer_size, compare);
+
+        first   = new_middle;
+        middle  = second_cut;
+        length1 = length1 - length11;
+        length2 = length2 - length22;
+      }
+    }
+
+    //*********************************
+    template <typename TIterator, typename TBufferIterator, typename TDistance, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TBufferIterator buffer, TDistance buffer_size, TCompare compare)
+    {
+      const TDistance length = last - first;
+
+      if (length < Insertion_Sort_Threshold)
+      {
+        private_intro_sort::insertion_sort(first, last, compare);
+        return;
+      }
+
+      TIterator middle = first + (length / 2);
+
+      private_merge_sort::merge_sort(first, middle, buffer, buffer_size, compare);
+      private_merge_sort::merge_sort(middle, last, buffer, buffer_size, compare);
+
+      // Nothing to do if the two halves are already in order.
+      if (compare(*middle, *(middle - 1)))
+      {
+        private_merge_sort::merge_adaptive(first, middle, last, TDistance(middle - first), TDistance(last - middle), buffer, buffer_size, compare);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Uses the supplied scratch buffer, which should contain at least N / 2 elements
+  /// for O(N log N) performance. Smaller buffers will use in-place merges for the
+  /// larger sub-ranges.
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "merge_sort requires random access iterators");
+
+    typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+    if (first == last)
+    {
+      return;
+    }
+
+    private_merge_sort::merge_sort(first, last, buffer_first, difference_t(etl::distance(buffer_first, buffer_last)), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using merge sort.
+  /// Stable.
+  /// Uses the supplied scratch buffer.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void merge_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    etl::merge_sort(first, last, buffer_first, buffer_last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using in-place merge sort.
+  /// Stable. O(N log^2 N).
+  /// Requires random access iterators.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void merge_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    // An empty buffer.
+    value_type* buffer = ETL_NULLPTR;
+
+    etl::merge_sort(first, last, buffer, buffer, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using in-place merge sort.
+  /// Stable. O(N log^2 N).
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void merge_sort(TIterator first, TIterator last)
+  {
+    etl::merge_sort(first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses the supplied scratch buffer, which should contain at least N / 2 elements.
+  /// Uses user defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer, TCompare compare)
+  {
+    etl::merge_sort(first, last, buffer.begin(), buffer.end(), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  /// Stable.
+  /// Uses the supplied scratch buffer, which should contain at least N / 2 elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void stable_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer)
+  {
+    etl::merge_sort(first, last, buffer.begin(), buffer.end(), etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  // Radix sort
+  // An LSD radix sort for integral and floating point keys.
+  // Requires a scratch buffer of at least N elements.
+  //***************************************************************************
+  namespace private_radix_sort
+  {
+    //*********************************
+    /// Converts a key to an unsigned value with the same ordering.
+    //*********************************
+    template <typename T, typename TEnable = void>
+    struct radix_key;
+
+    // Unsigned integral keys are used as is.
+    template <typename T>
+    struct radix_key<T, typename etl::enable_if<etl::is_integral<T>::value && !etl::is_signed<T>::value>::type>
+    {
+      typedef T type;
+
+      static type get(T value)
+      {
+        return value;
+      }
+    };
+
+    // Signed integral keys have the sign bit flipped.
+    template <typename T>
+    struct radix_key<T, typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value>::type>
+    {
+      typedef typename etl::make_unsigned<T>::type type;
+
+      static type get(T value)
+      {
+        const type sign_bit = static_cast<type>(~(static_cast<type>(~type(0)) >> 1U));
+
+        return static_cast<type>(static_cast<type>(value) ^ sign_bit);
+      }
+    };
+
+    // Floating point keys have the sign bit flipped if positive, or all bits flipped if negative.
+    template <typename T>
+    struct radix_key<T, typename etl::enable_if<etl::is_floating_point<T>::value>::type>
+    {
+#if ETL_USING_64BIT_TYPES
+      ETL_STATIC_ASSERT((sizeof(T) == sizeof(uint32_t)) || (sizeof(T) == sizeof(uint64_t)), "Unsupported floating point type");
+
+      typedef typename etl::conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+#else
+      ETL_STATIC_ASSERT(sizeof(T) == sizeof(uint32_t), "Unsupported floating point type");
+
+      typedef uint32_t type;
+#endif
+
+      static type get(T value)
+      {
+        const type sign_bit = static_cast<type>(~(static_cast<type>(~type(0)) >> 1U));
+
+        type bits;
+        memcpy(&bits, &value, sizeof(type));
+
+        return static_cast<type>(bits ^ (((bits & sign_bit) != 0) ? static_cast<type>(~type(0)) : sign_bit));
+      }
+    };
+
+    //*********************************
+    /// Returns the key of a value.
+    //*********************************
+    template <typename T>
+    struct identity_key
+    {
+      const T& operator()(const T& value) const
+      {
+        return value;
+      }
+    };
+
+    //*********************************
+    /// Compares values by their radix key.
+    /// Used when the scratch buffer is too small.
+    //*********************************
+    template <typename TKeyValue, typename TKey>
+    struct key_compare
+    {
+      explicit key_compare(TKey key_)
+        : key(key_)
+      {
+      }
+
+      template <typename T>
+      bool operator()(const T& lhs, const T& rhs) const
+      {
+        return radix_key<TKeyValue>::get(key(lhs)) < radix_key<TKeyValue>::get(key(rhs));
+      }
+
+      TKey key;
+    };
+
+    //*********************************
+    /// Distributes the source into the destination by one digit of the key.
+    /// Returns false if every element has the same digit, and nothing was moved.
+    //*********************************
+    template <typename TKeyValue, typename TSourceIterator, typename TDestinationIterator, typename TKey>
+    bool radix_pass(TSourceIterator source_first, TSourceIterator source_last, TDestinationIterator destination, TKey key, size_t shift)
+    {
+      typedef radix_key<TKeyValue> radix_key_t;
+
+      static ETL_CONSTANT size_t Buckets = 256U;
+
+      size_t counts[Buckets] = { 0 };
+      size_t n = 0U;
+
+      // Build the histogram.
+      for (TSourceIterator itr = source_first; itr != source_last; ++itr)
+      {
+        ++counts[static_cast<size_t>(radix_key_t::get(key(*itr)) >> shift) & (Buckets - 1U)];
+        ++n;
+      }
+
+      // Skip this digit if it is the same for all of the elements.
+      if (counts[static_cast<size_t>(radix_key_t::get(key(*source_first)) >> shift) & (Buckets - 1U)] == n)
+      {
+        return false;
+      }
+
+      // Convert the counts to offsets.
+      size_t offset = 0U;
+
+      for (size_t i = 0U; i < Buckets; ++i)
+      {
+        const size_t count = counts[i];
+        counts[i] = offset;
+        offset += count;
+      }
+
+      // Scatter.
+      for (TSourceIterator itr = source_first; itr != source_last; ++itr)
+      {
+        const size_t bucket = static_cast<size_t>(radix_key_t::get(key(*itr)) >> shift) & (Buckets - 1U);
+
+        destination[counts[bucket]++] = ETL_MOVE(*itr);
+      }
+
+      return true;
+    }
+
+    //*********************************
+    template <typename TKeyValue, typename TIterator, typename TBufferIterator, typename TKey>
+    void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TKey key)
+    {
+      ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "radix_sort requires random access iterators");
+
+      typedef typename radix_key<TKeyValue>::type key_type;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      const ptrdiff_t n = etl::distance(first, last);
+
+      if (etl::distance(buffer_first, buffer_last) < n)
+      {
+        // Not enough room to radix sort, so fall back to a stable in-place sort.
+        etl::merge_sort(first, last, key_compare<TKeyValue, TKey>(key));
+        return;
+      }
+
+      TBufferIterator buffer_end = buffer_first + n;
+      bool in_buffer = false;
+
+      for (size_t pass = 0U; pass < sizeof(key_type); ++pass)
+      {
+        const size_t shift = pass * 8U;
+
+        const bool moved = in_buffer ? radix_pass<TKeyValue>(buffer_first, buffer_end, first, key, shift)
+                                     : radix_pass<TKeyValue>(first, last, buffer_first, key, shift);
+
+        if (moved)
+        {
+          in_buffer = !in_buffer;
+        }
+      }
+
+      if (in_buffer)
+      {
+        etl::move(buffer_first, buffer_end, first);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using LSD radix sort.
+  /// Stable.
+  /// The value type must be an integral or floating point type.
+  /// Uses the supplied scratch buffer, which should contain at least N elements.
+  /// If the buffer is too small then an in-place merge sort is used.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last)
+  {
+    typedef typename etl::iterator_traits<TIterator>::value_type value_type;
+
+    private_radix_sort::radix_sort<value_type>(first, last, buffer_first, buffer_last, private_radix_sort::identity_key<value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using LSD radix sort.
+  /// Stable.
+  /// The value type must be an integral or floating point type.
+  /// Uses the supplied scratch buffer, which should contain at least N elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent>
+  void radix_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer)
+  {
+    etl::radix_sort(first, last, buffer.begin(), buffer.end());
+  }
+
+#if ETL_USING_CPP11
+  //***************************************************************************
+  /// Sorts the elements using LSD radix sort.
+  /// Stable.
+  /// The key projection must return an integral or floating point type.
+  /// Uses the supplied scratch buffer, which should contain at least N elements.
+  /// If the buffer is too small then an in-place merge sort is used.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TBufferIterator, typename TKey>
+  void radix_sort(TIterator first, TIterator last, TBufferIterator buffer_first, TBufferIterator buffer_last, TKey key)
+  {
+    typedef typename etl::decay<decltype(key(*first))>::type key_value_type;
+
+    private_radix_sort::radix_sort<key_value_type>(first, last, buffer_first, buffer_last, key);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements using LSD radix sort.
+  /// Stable.
+  /// The key projection must return an integral or floating point type.
+  /// Uses the supplied scratch buffer, which should contain at least N elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, size_t Extent, typename TKey>
+  void radix_sort(TIterator first, TIterator last, etl::span<T, Extent> buffer, TKey key)
+  {
+    etl::radix_sort(first, last, buffer.begin(), buffer.end(), key);
+  }
+#endif
+
+  //***************************************************************************
+  /// merge
+  /// Merges two sorted ranges. Stable.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/merge"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out,
+                        TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first2, *first1))
+      {
+        *out = *first2;
+        ++first2;
+      }
+      else
+      {
+        *out = *first1;
+        ++first1;
+      }
+
+      ++out;
+    }
+
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator merge(TIterator1 first1, TIterator1 last1,
+                        TIterator2 first2, TIterator2 last2,
+                        TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::merge(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// includes
+  /// Checks if the second sorted range is a subsequence of the first.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/includes"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TCompare>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool includes(TIterator1 first1, TIterator1 last1,
+                TIterator2 first2, TIterator2 last2,
+                TCompare compare)
+  {
+    while (first2 != last2)
+    {
+      if ((first1 == last1) || compare(*first2, *first1))
+      {
+        return false;
+      }
+
+      if (!compare(*first1, *first2))
+      {
+        ++first2;
+      }
+
+      ++first1;
+    }
+
+    return true;
+  }
+
+  template <typename TIterator1, typename TIterator2>
+  ETL_NODISCARD
+  ETL_CONSTEXPR14
+  bool includes(TIterator1 first1, TIterator1 last1,
+                TIterator2 first2, TIterator2 last2)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::includes(first1, last1, first2, last2, compare());
+  }
+
+  //***************************************************************************
+  /// set_intersection
+  /// Copies the elements of the first sorted range that are also in the second.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/set_intersection"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out,
+                                   TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
+      {
+        ++first1;
+      }
+      else
+      {
+        if (!compare(*first2, *first1))
+        {
+          *out = *first1;
+          ++out;
+          ++first1;
+        }
+
+        ++first2;
+      }
+    }
+
+    return out;
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_intersection(TIterator1 first1, TIterator1 last1,
+                                   TIterator2 first2, TIterator2 last2,
+                                   TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_intersection(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// set_union
+  /// Copies the elements that are in either sorted range.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/set_union"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out,
+                            TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first2, *first1))
+      {
+        *out = *first2;
+        ++first2;
+      }
+      else
+      {
+        if (!compare(*first1, *first2))
+        {
+          ++first2;
+        }
+
+        *out = *first1;
+        ++first1;
+      }
+
+      ++out;
+    }
+
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_union(TIterator1 first1, TIterator1 last1,
+                            TIterator2 first2, TIterator2 last2,
+                            TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_union(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// set_difference
+  /// Copies the elements of the first sorted range that are not in the second.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/set_difference"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_difference(TIterator1 first1, TIterator1 last1,
+                                 TIterator2 first2, TIterator2 last2,
+                                 TOutputIterator out,
+                                 TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
+      {
+        *out = *first1;
+        ++out;
+        ++first1;
+      }
+      else
+      {
+        if (!compare(*first2, *first1))
+        {
+          ++first1;
+        }
+
+        ++first2;
+      }
+    }
+
+    return etl::copy(first1, last1, out);
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_difference(TIterator1 first1, TIterator1 last1,
+                                 TIterator2 first2, TIterator2 last2,
+                                 TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_difference(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// set_symmetric_difference
+  /// Copies the elements that are in one sorted range but not in the other.
+  ///\ingroup algorithm
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/set_symmetric_difference"></a>
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_symmetric_difference(TIterator1 first1, TIterator1 last1,
+                                           TIterator2 first2, TIterator2 last2,
+                                           TOutputIterator out,
+                                           TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
+      {
+        *out = *first1;
+        ++out;
+        ++first1;
+      }
+      else if (compare(*first2, *first1))
+      {
+        *out = *first2;
+        ++out;
+        ++first2;
+      }
+      else
+      {
+        ++first1;
+        ++first2;
+      }
+    }
+
+    out = etl::copy(first1, last1, out);
+
+    return etl::copy(first2, last2, out);
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_symmetric_difference(TIterator1 first1, TIterator1 last1,
+                                           TIterator2 first2, TIterator2 last2,
+                                           TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_symmetric_difference(first1, last1, first2, last2, out, compare());
+  }
+
+  namespace private_algorithm
+  {
+    //*********************************
+    /// Finds the lower bound by testing the elements at 0, 1, 3, 7, 15...
+    /// and then searching the last interval, so the cost depends on the
+    /// distance to the result rather than the length of the range.
+    /// Requires random access iterators.
+    //*********************************
+    template <typename TIterator, typename TValue, typename TCompare>
+    ETL_CONSTEXPR14
+    TIterator gallop_lower_bound(TIterator first, TIterator last, const TValue& value, TCompare compare)
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      difference_t bound = 1;
+
+      while ((bound <= length) && compare(first[bound - 1], value))
+      {
+        bound *= 2;
+      }
+
+      return etl::lower_bound(first + (bound / 2), first + etl::min(bound, length), value, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// set_intersection_galloping
+  /// As set_intersection, but skips runs of unmatched elements with an
+  /// exponential search, so intersecting a short range with a long one
+  /// costs O(M log(N / M)) comparisons rather than O(M + N).
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_intersection_galloping(TIterator1 first1, TIterator1 last1,
+                                             TIterator2 first2, TIterator2 last2,
+                                             TOutputIterator out,
+                                             TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
+      {
+        first1 = private_algorithm::gallop_lower_bound(++first1, last1, *first2, compare);
+      }
+      else if (compare(*first2, *first1))
+      {
+        first2 = private_algorithm::gallop_lower_bound(++first2, last2, *first1, compare);
+      }
+      else
+      {
+        *out = *first1;
+        ++out;
+        ++first1;
+        ++first2;
+      }
+    }
+
+    return out;
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_intersection_galloping(TIterator1 first1, TIterator1 last1,
+                                             TIterator2 first2, TIterator2 last2,
+                                             TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_intersection_galloping(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// set_difference_galloping
+  /// As set_difference, but skips runs of elements with an exponential
+  /// search, so is faster when one range is much longer than the other.
+  /// Requires random access iterators.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator, typename TCompare>
+  ETL_CONSTEXPR14
+  TOutputIterator set_difference_galloping(TIterator1 first1, TIterator1 last1,
+                                           TIterator2 first2, TIterator2 last2,
+                                           TOutputIterator out,
+                                           TCompare compare)
+  {
+    while ((first1 != last1) && (first2 != last2))
+    {
+      if (compare(*first1, *first2))
+      {
+        TIterator1 run_end = first1;
+
+        run_end = private_algorithm::gallop_lower_bound(++run_end, last1, *first2, compare);
+        out     = etl::copy(first1, run_end, out);
+        first1  = run_end;
+      }
+      else if (compare(*first2, *first1))
+      {
+        first2 = private_algorithm::gallop_lower_bound(++first2, last2, *first1, compare);
+      }
+      else
+      {
+        ++first1;
+        ++first2;
+      }
+    }
+
+    return etl::copy(first1, last1, out);
+  }
+
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_difference_galloping(TIterator1 first1, TIterator1 last1,
+                                           TIterator2 first2, TIterator2 last2,
+                                           TOutputIterator out)
+  {
+    typedef etl::less<typename etl::iterator_traits<TIterator1>::value_type> compare;
+
+    return etl::set_difference_galloping(first1, last1, first2, last2, out, compare());
+  }
+
+  //***************************************************************************
+  /// set_intersection_unique
+  /// As set_intersection, but each range must be strictly increasing, as the
+  /// contents of an etl::flat_set are.
+  /// Contiguous ranges of int32_t or uint32_t are compared four elements at a
+  /// time with vector instructions, when they are enabled.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+  ETL_CONSTEXPR14
+  TOutputIterator set_intersection_unique(TIterator1 first1, TIterator1 last1,
+                                          TIterator2 first2, TIterator2 last2,
+                                          TOutputIterator out)
+  {
+#if ETL_USING_ALGORITHM_SIMD
+    if (ETL_SIMD_IS_RUNTIME && private_algorithm_simd::is_set_intersection_range<TIterator1, TIterator2>::value)
+    {
+      return private_algorithm_simd::set_intersection_unique(first1, last1, first2, last2, out);
+    }
+#endif
+
+    return etl::set_intersection(first1, last1, first2, last2, out);
+  }
+
+#if ETL_USING_CPP11
+  namespace private_algorithm
+  {
+    //*********************************
+    /// Plays a match of the tournament between two ranges.
+    /// An empty range always loses, and a tie goes to the earlier range.
+    //*********************************
+    template <typename TIterator, typename TCompare>
+    size_t merge_ranges_winner(const TIterator* current, const TIterator* ends, size_t a, size_t b, TCompare& compare)
+    {
+      if (current[a] == ends[a])
+      {
+        return b;
+      }
+
+      if (current[b] == ends[b])
+      {
+        return a;
+      }
+
+      if (compare(*current[b], *current[a]))
+      {
+        return b;
+      }
+
+      if (compare(*current[a], *current[b]))
+      {
+        return a;
+      }
+
+      return (a < b) ? a : b;
+    }
+  }
+
+  //***************************************************************************
+  /// merge_ranges
+  /// Merges many sorted ranges, using a tournament tree so that each element
+  /// costs log2(N) comparisons for N ranges. Stable.
+  /// 'first' to 'last' are the ranges, such as etl::vector or etl::span.
+  /// Only the first VMax_Ranges ranges are merged.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <size_t VMax_Ranges, typename TRangeIterator, typename TOutputIterator, typename TCompare>
+  TOutputIterator merge_ranges(TRangeIterator first, TRangeIterator last, TOutputIterator out, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(VMax_Ranges > 0U, "There must be at least one range");
+
+    typedef typename etl::iterator_traits<TRangeIterator>::reference range_reference;
+    typedef decltype(etl::declval<range_reference>().begin())        iterator_type;
+
+    iterator_type current[VMax_Ranges];
+    iterator_type ends[VMax_Ranges];
+
+    // The leaves of the tree, at n to 2n - 1, are the ranges.
+    // Each node above them holds the winner of its two children.
+    size_t tree[2U * VMax_Ranges];
+
+    size_t n = 0U;
+
+    while ((first != last) && (n < VMax_Ranges))
+    {
+      current[n] = (*first).begin();
+      ends[n]    = (*first).end();
+      ++first;
+      ++n;
+    }
+
+    if (n == 0U)
+    {
+      return out;
+    }
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      tree[n + i] = i;
+    }
+
+    for (size_t node = n - 1U; node > 0U; --node)
+    {
+      tree[node] = private_algorithm::merge_ranges_winner(current, ends, tree[2U * node], tree[(2U * node) + 1U], compare);
+    }
+
+    while (current[tree[1U]] != ends[tree[1U]])
+    {
+      const size_t winner = tree[1U];
+
+      *out = *current[winner];
+      ++out;
+      ++current[winner];
+
+      // Replay the matches on the path from the winner's leaf to the root.
+      for (size_t node = (n + winner) / 2U; node > 0U; node /= 2U)
+      {
+        tree[node] = private_algorithm::merge_ranges_winner(current, ends, tree[2U * node], tree[(2U * node) + 1U], compare);
+      }
+    }
+
+    return out;
+  }
+
+  template <size_t VMax_Ranges, typename TRangeIterator, typename TOutputIterator>
+  TOutputIterator merge_ranges(TRangeIterator first, TRangeIterator last, TOutputIterator out)
+  {
+    typedef typename etl::iterator_traits<TRangeIterator>::reference range_reference;
+    typedef decltype(etl::declval<range_reference>().begin())        iterator_type;
+    typedef typename etl::iterator_traits<iterator_type>::value_type value_type;
+
+    return etl::merge_ranges<VMax_Ranges>(first, last, out, etl::less<value_type>());
+  }
+#endif
+
   //***************************************************************************
   /// Returns the maximum value.
   //***************************************************************************
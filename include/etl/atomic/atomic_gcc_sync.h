@@ -33,7 +33,6 @@ SOFTWARE.
 #include "../type_traits.h"
 #include "../static_assert.h"
 #include "../nullptr.h"
-#include "../char_traits.h"
 #include "../mutex.h"
 
 #include <stdint.h>
@@ -93,6 +92,19 @@ namespace etl
     memory_order_seq_cst = __ATOMIC_SEQ_CST
   };
 
+  //***************************************************************************
+  /// Memory fences.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    __atomic_thread_fence(order);
+  }
+
+  inline void atomic_signal_fence(etl::memory_order order)
+  {
+    __atomic_signal_fence(order);
+  }
+
   //***************************************************************************
   /// For all types except bool, pointers and types that are always lock free.
   //***************************************************************************
@@ -1030,6 +1042,22 @@ namespace etl
     memory_order_seq_cst
   } memory_order;
 
+  //***************************************************************************
+  /// Memory fences.
+  /// The '__sync' builtins only provide a full barrier.
+  //***************************************************************************
+  inline void atomic_thread_fence(etl::memory_order order)
+  {
+    (void)order;
+    __sync_synchronize();
+  }
+
+  inline void atomic_signal_fence(etl::memory_order order)
+  {
+    (void)order;
+    __sync_synchronize();
+  }
+
   //***************************************************************************
   /// For all types except bool and pointers
   //***************************************************************************
@@ -31,7 +31,6 @@ SOFTWARE.
 
 #include "../platform.h"
 #include "../nullptr.h"
-#include "../char_traits.h"
 
 #include <atomic>
 #include <stdint.h>
@@ -55,6 +54,9 @@ namespace etl
   static ETL_CONSTANT etl::memory_order memory_order_acq_rel = std::memory_order_acq_rel;
   static ETL_CONSTANT etl::memory_order memory_order_seq_cst = std::memory_order_seq_cst;
 
+  using std::atomic_thread_fence;
+  using std::atomic_signal_fence;
+
   using atomic_bool           = std::atomic<bool>;
   using atomic_char           = std::atomic<char>;
   using atomic_schar          = std::atomic<signed char>;
@@ -0,0 +1,451 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_EXTENSIONS_INCLUDED
+#define ETL_ATOMIC_EXTENSIONS_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "mutex/mutex_spin.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+// Selects how etl::atomic_wait blocks. One of the following may be defined in
+// the user's profile to override the default.
+// ETL_ATOMIC_WAIT_USE_STD   std::atomic::wait (C++20 standard library).
+// ETL_ATOMIC_WAIT_USE_FUTEX Linux futex, for 32 bit values.
+// ETL_ATOMIC_WAIT_USE_WFE   ARM WFE/SEV.
+// ETL_ATOMIC_WAIT_USE_SPIN  Spin with exponential backoff.
+// Values that the chosen method cannot wait on directly fall back to spinning.
+//*****************************************************************************
+#if !defined(ETL_ATOMIC_WAIT_USE_STD) && !defined(ETL_ATOMIC_WAIT_USE_FUTEX) && !defined(ETL_ATOMIC_WAIT_USE_WFE) && !defined(ETL_ATOMIC_WAIT_USE_SPIN)
+  #if ETL_USING_CPP20 && (ETL_USING_STL || defined(ETL_IN_UNIT_TEST)) && defined(__cpp_lib_atomic_wait)
+    #define ETL_ATOMIC_WAIT_USE_STD
+  #elif defined(__linux__)
+    #define ETL_ATOMIC_WAIT_USE_FUTEX
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 6)))
+    #define ETL_ATOMIC_WAIT_USE_WFE
+  #else
+    #define ETL_ATOMIC_WAIT_USE_SPIN
+  #endif
+#endif
+
+#if defined(ETL_ATOMIC_WAIT_USE_FUTEX)
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+//*****************************************************************************
+// Double width compare and swap, for a pointer and a tag updated together.
+//*****************************************************************************
+#if !defined(ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (__SIZEOF_POINTER__ == 4) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_8)
+    #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 1
+    #define ETL_ATOMIC_DOUBLE_WIDTH_TYPE uint64_t
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (__SIZEOF_POINTER__ == 8) && defined(__SIZEOF_INT128__) && defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 1
+    #define ETL_ATOMIC_DOUBLE_WIDTH_TYPE unsigned __int128
+  #else
+    #define ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS 0
+  #endif
+#endif
+
+namespace etl
+{
+  namespace private_atomic_extensions
+  {
+    //*************************************************************************
+    /// Stops the value parameters taking part in template argument deduction,
+    /// so that atomic_fetch_max(a, 1) works for an etl::atomic<uint32_t>.
+    //*************************************************************************
+    template <typename T>
+    struct non_deduced
+    {
+      typedef T type;
+    };
+
+    //*************************************************************************
+    /// Spins until the value is no longer 'old'.
+    //*************************************************************************
+    template <typename T>
+    void spin_wait(const etl::atomic<T>& a, T old, etl::memory_order order)
+    {
+      etl::private_mutex_spin::backoff pause;
+
+      while (a.load(order) == old)
+      {
+        pause.wait();
+      }
+    }
+
+#if defined(ETL_ATOMIC_WAIT_USE_FUTEX)
+    //*************************************************************************
+    /// The futex can only wait on a 32 bit word that is the whole atomic.
+    //*************************************************************************
+    template <typename T>
+    struct is_futex_compatible : etl::integral_constant<bool, (sizeof(T) == 4U) && (sizeof(etl::atomic<T>) == 4U)>
+    {
+    };
+
+    template <typename T>
+    void wait(const etl::atomic<T>& a, T old, etl::memory_order order, etl::true_type /*futex*/)
+    {
+      uint32_t old_word;
+      memcpy(&old_word, &old, sizeof(old_word));
+
+      while (a.load(order) == old)
+      {
+        // Returns at once if the word no longer holds 'old_word'.
+        (void)syscall(SYS_futex, &a, FUTEX_WAIT_PRIVATE, old_word, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+    }
+
+    template <typename T>
+    void wait(const etl::atomic<T>& a, T old, etl::memory_order order, etl::false_type /*futex*/)
+    {
+      spin_wait(a, old, order);
+    }
+
+    template <typename T>
+    void wake(const etl::atomic<T>& a, int count, etl::true_type /*futex*/)
+    {
+      (void)syscall(SYS_futex, &a, FUTEX_WAKE_PRIVATE, count, ETL_NULLPTR, ETL_NULLPTR, 0);
+    }
+
+    template <typename T>
+    void wake(const etl::atomic<T>&, int, etl::false_type /*futex*/)
+    {
+    }
+#endif
+
+#if defined(ETL_ATOMIC_WAIT_USE_WFE)
+    //*************************************************************************
+    /// Makes preceding stores visible, then signals an event to all cores.
+    //*************************************************************************
+    inline void send_event()
+    {
+  #if defined(__aarch64__)
+      __asm__ __volatile__("dsb ish\n\tsev" ::: "memory");
+  #else
+      __asm__ __volatile__("dsb\n\tsev" ::: "memory");
+  #endif
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Atomically replaces the value with the maximum of the value and 'v'.
+  /// Useful for high water marks.
+  ///\return The previous value.
+  //***************************************************************************
+  template <typename T>
+  T atomic_fetch_max(etl::atomic<T>& a,
+                     typename etl::private_atomic_extensions::non_deduced<T>::type v,
+                     etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    T previous = a.load(etl::memory_order_relaxed);
+
+    while (previous < v)
+    {
+      T expected = previous;
+
+      if (a.compare_exchange_weak(expected, v, order, etl::memory_order_relaxed))
+      {
+        break;
+      }
+
+      // Reload, as not every backend updates 'expected' on failure.
+      previous = a.load(etl::memory_order_relaxed);
+    }
+
+    return previous;
+  }
+
+  //***************************************************************************
+  /// Atomically replaces the value with the minimum of the value and 'v'.
+  /// Useful for low water marks.
+  ///\return The previous value.
+  //***************************************************************************
+  template <typename T>
+  T atomic_fetch_min(etl::atomic<T>& a,
+                     typename etl::private_atomic_extensions::non_deduced<T>::type v,
+                     etl::memory_order order = etl::memory_order_seq_cst)
+  {
+    T previous = a.load(etl::memory_order_relaxed);
+
+    while (v < previous)
+    {
+      T expected = previous;
+
+      if (a.compare_exchange_weak(expected, v, order, etl::memory_order_relaxed))
+      {
+        break;
+      }
+
+      previous = a.load(etl::memory_order_relaxed);
+    }
+
+    return previous;
+  }
+
+  //***************************************************************************
+  /// Blocks until the value is no longer equal to 'old'.
+  /// May return spuriously in the same way as std::atomic::wait, so callers
+  /// should check the value again. Pair with etl::atomic_notify_one/all.
+  //***************************************************************************
+  template <typename T>
+  void atomic_wait(const etl::atomic<T>& a,
+                   typename etl::private_atomic_extensions::non_deduced<T>::type old,
+                   etl::memory_order order = etl::memory_order_seq_cst)
+  {
+#if defined(ETL_ATOMIC_WAIT_USE_STD)
+    a.wait(old, order);
+#elif defined(ETL_ATOMIC_WAIT_USE_FUTEX)
+    etl::private_atomic_extensions::wait(a, old, order, etl::private_atomic_extensions::is_futex_compatible<T>());
+#elif defined(ETL_ATOMIC_WAIT_USE_WFE)
+    // An event sent between the load and the WFE is latched, so is not lost.
+    while (a.load(order) == old)
+    {
+      __asm__ __volatile__("wfe" ::: "memory");
+    }
+#else
+    etl::private_atomic_extensions::spin_wait(a, old, order);
+#endif
+  }
+
+  //***************************************************************************
+  /// Wakes at least one thread blocked in etl::atomic_wait on 'a'.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_one(etl::atomic<T>& a)
+  {
+#if defined(ETL_ATOMIC_WAIT_USE_STD)
+    a.notify_one();
+#elif defined(ETL_ATOMIC_WAIT_USE_FUTEX)
+    etl::private_atomic_extensions::wake(a, 1, etl::private_atomic_extensions::is_futex_compatible<T>());
+#elif defined(ETL_ATOMIC_WAIT_USE_WFE)
+    (void)a;
+    etl::private_atomic_extensions::send_event();
+#else
+    (void)a;
+#endif
+  }
+
+  //***************************************************************************
+  /// Wakes all threads blocked in etl::atomic_wait on 'a'.
+  //***************************************************************************
+  template <typename T>
+  void atomic_notify_all(etl::atomic<T>& a)
+  {
+#if defined(ETL_ATOMIC_WAIT_USE_STD)
+    a.notify_all();
+#elif defined(ETL_ATOMIC_WAIT_USE_FUTEX)
+    etl::private_atomic_extensions::wake(a, 0x7FFFFFFF, etl::private_atomic_extensions::is_futex_compatible<T>());
+#elif defined(ETL_ATOMIC_WAIT_USE_WFE)
+    (void)a;
+    etl::private_atomic_extensions::send_event();
+#else
+    (void)a;
+#endif
+  }
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+  //***************************************************************************
+  /// A pointer and a tag that are read and written as one.
+  /// Incrementing the tag on each update defeats the ABA problem.
+  //***************************************************************************
+  template <typename T>
+  struct tagged_ptr
+  {
+    typedef T*        pointer;
+    typedef uintptr_t tag_type;
+
+    tagged_ptr()
+      : ptr(ETL_NULLPTR)
+      , tag(0U)
+    {
+    }
+
+    tagged_ptr(pointer ptr_, tag_type tag_)
+      : ptr(ptr_)
+      , tag(tag_)
+    {
+    }
+
+    friend bool operator ==(const tagged_ptr& lhs, const tagged_ptr& rhs)
+    {
+      return (lhs.ptr == rhs.ptr) && (lhs.tag == rhs.tag);
+    }
+
+    friend bool operator !=(const tagged_ptr& lhs, const tagged_ptr& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+    pointer  ptr;
+    tag_type tag;
+  };
+
+  //***************************************************************************
+  /// An etl::tagged_ptr updated with a double width compare and swap.
+  /// Every operation is sequentially consistent.
+  /// Only available where ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS is 1. On x86-64 this
+  /// requires cmpxchg16b, enabled for GCC and Clang with -mcx16.
+  //***************************************************************************
+  template <typename T>
+  class atomic_tagged_ptr
+  {
+  public:
+
+    typedef etl::tagged_ptr<T> value_type;
+
+    static ETL_CONSTANT bool is_always_lock_free = true;
+
+    atomic_tagged_ptr()
+      : value(to_wide(value_type()))
+    {
+    }
+
+    explicit atomic_tagged_ptr(value_type v)
+      : value(to_wide(v))
+    {
+    }
+
+    //*************************************************************************
+    /// Loads the pointer and tag.
+    //*************************************************************************
+    value_type load() const
+    {
+      // A compare and swap with identical values reads the whole width atomically.
+      return from_wide(__sync_val_compare_and_swap(&value, wide_type(0), wide_type(0)));
+    }
+
+    //*************************************************************************
+    /// Stores the pointer and tag.
+    //*************************************************************************
+    void store(value_type v)
+    {
+      (void)exchange(v);
+    }
+
+    //*************************************************************************
+    /// Stores the pointer and tag, returning the previous ones.
+    //*************************************************************************
+    value_type exchange(value_type v)
+    {
+      const wide_type desired = to_wide(v);
+      wide_type       current = wide_type(0);
+
+      while (true)
+      {
+        const wide_type previous = __sync_val_compare_and_swap(&value, current, desired);
+
+        if (previous == current)
+        {
+          return from_wide(previous);
+        }
+
+        current = previous;
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces 'expected' with 'desired' if they match.
+    /// On failure 'expected' is updated to the current value.
+    //*************************************************************************
+    bool compare_exchange_strong(value_type& expected, value_type desired)
+    {
+      const wide_type expected_wide = to_wide(expected);
+      const wide_type previous      = __sync_val_compare_and_swap(&value, expected_wide, to_wide(desired));
+
+      if (previous == expected_wide)
+      {
+        return true;
+      }
+
+      expected = from_wide(previous);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// As compare_exchange_strong, which never fails spuriously.
+    //*************************************************************************
+    bool compare_exchange_weak(value_type& expected, value_type desired)
+    {
+      return compare_exchange_strong(expected, desired);
+    }
+
+  private:
+
+    __extension__ typedef ETL_ATOMIC_DOUBLE_WIDTH_TYPE wide_type;
+
+    ETL_STATIC_ASSERT(sizeof(value_type) == sizeof(wide_type), "tagged_ptr is not double width");
+
+    static wide_type to_wide(value_type v)
+    {
+      wide_type w;
+      memcpy(&w, &v, sizeof(w));
+
+      return w;
+    }
+
+    static value_type from_wide(wide_type w)
+    {
+      value_type v;
+      memcpy(static_cast<void*>(&v), &w, sizeof(v));
+
+      return v;
+    }
+
+    // The double width operations require natural alignment.
+    mutable wide_type value __attribute__((aligned(sizeof(wide_type))));
+
+    // Disable copy construction and assignment.
+    atomic_tagged_ptr(const atomic_tagged_ptr&) ETL_DELETE;
+    atomic_tagged_ptr& operator =(const atomic_tagged_ptr&) ETL_DELETE;
+  };
+
+  template <typename T>
+  ETL_CONSTANT bool atomic_tagged_ptr<T>::is_always_lock_free;
+#endif
+}
+
+#endif
+
+#endif
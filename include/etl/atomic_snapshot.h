@@ -0,0 +1,192 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ATOMIC_SNAPSHOT_INCLUDED
+#define ETL_ATOMIC_SNAPSHOT_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A read mostly value published through a set of buffers, in the style of RCU.
+  /// The writer copies a new value in to a buffer that no reader holds, then
+  /// makes it current. A reader registers on the current buffer and reads it
+  /// in place, so readers never wait for the writer and never see a partial write.
+  /// A reader only retries if a new value is made current between it reading the
+  /// current index and registering on that buffer.
+  ///
+  /// There must only be one writer at a time.
+  /// store fails if every other buffer is still held by a reader, so use at least
+  /// two more buffers than the number of readers that may hold a buffer at once
+  /// for every store to succeed.
+  ///\tparam T           The type of the value.
+  ///\tparam BUFFERS_    The number of buffers. At least 2.
+  //***************************************************************************
+  template <typename T, const size_t BUFFERS_ = 3U>
+  class atomic_snapshot
+  {
+  public:
+
+    ETL_STATIC_ASSERT(BUFFERS_ >= 2U, "atomic_snapshot needs at least two buffers");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t BUFFERS = BUFFERS_;
+
+    //*************************************************************************
+    /// Constructor. The value is default constructed.
+    //*************************************************************************
+    atomic_snapshot()
+      : current(0U)
+    {
+      for (size_t i = 0U; i < BUFFERS; ++i)
+      {
+        readers[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructor, from an initial value.
+    //*************************************************************************
+    explicit atomic_snapshot(const T& value)
+      : current(0U)
+    {
+      for (size_t i = 0U; i < BUFFERS; ++i)
+      {
+        readers[i].store(0U, etl::memory_order_relaxed);
+      }
+
+      buffers[0] = value;
+    }
+
+    //*************************************************************************
+    /// Publishes a new value.
+    ///\return <b>true</b> if the value was published, <b>false</b> if every other buffer is held by a reader.
+    //*************************************************************************
+    bool store(const T& value)
+    {
+      const uint32_t current_index = current.load(etl::memory_order_relaxed);
+
+      for (uint32_t index = 0U; index < BUFFERS; ++index)
+      {
+        if ((index != current_index) && (readers[index].load(etl::memory_order_seq_cst) == 0U))
+        {
+          buffers[index] = value;
+          current.store(index, etl::memory_order_seq_cst);
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Gets a copy of the current value.
+    //*************************************************************************
+    T load() const
+    {
+      const uint32_t index = acquire();
+
+      T value(buffers[index]);
+
+      release(index);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Calls a function with a const reference to the current value, without copying it.
+    /// The buffer is held until the function returns.
+    //*************************************************************************
+    template <typename TFunction>
+    void read(TFunction function) const
+    {
+      const uint32_t index = acquire();
+
+      function(buffers[index]);
+
+      release(index);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Registers as a reader of the current buffer.
+    //*************************************************************************
+    uint32_t acquire() const
+    {
+      while (true)
+      {
+        const uint32_t index = current.load(etl::memory_order_seq_cst);
+
+        readers[index].fetch_add(1U, etl::memory_order_seq_cst);
+
+        // If the buffer is still current, the writer cannot be writing to it.
+        if (current.load(etl::memory_order_seq_cst) == index)
+        {
+          return index;
+        }
+
+        readers[index].fetch_sub(1U, etl::memory_order_seq_cst);
+      }
+    }
+
+    //*************************************************************************
+    /// Deregisters as a reader of a buffer.
+    //*************************************************************************
+    void release(uint32_t index) const
+    {
+      readers[index].fetch_sub(1U, etl::memory_order_seq_cst);
+    }
+
+    // Disable copy construction and assignment.
+    atomic_snapshot(const atomic_snapshot&) ETL_DELETE;
+    atomic_snapshot& operator =(const atomic_snapshot&) ETL_DELETE;
+
+    T                             buffers[BUFFERS_];
+    etl::atomic<uint32_t>         current;
+    mutable etl::atomic<uint32_t> readers[BUFFERS_];
+  };
+
+  template <typename T, const size_t BUFFERS_>
+  ETL_CONSTANT size_t atomic_snapshot<T, BUFFERS_>::BUFFERS;
+}
+
+#endif
+#endif
@@ -40,6 +40,8 @@ SOFTWARE.
 #include "etl/iterator.h"
 #include "etl/string.h"
 
+#include "private/base64_simd.h"
+
 #include <stdint.h>
 
 #if ETL_USING_STL
@@ -108,6 +110,17 @@ namespace etl
 
       int next_sextet = First_Sextet;
 
+#if ETL_USING_BASE64_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        // Encode the whole groups a vector at a time.
+        const size_t n = private_base64::simd_encode(input, input_length, output);
+
+        p_in  += n;
+        p_out += (n / 3U) * 4U;
+      }
+#endif
+
       // Step through the input buffer, creating the output sextets.
       while (p_in != p_in_end)
       {
@@ -308,6 +321,17 @@ namespace etl
       T c = 0;
       int next_sextet = First_Sextet;
 
+#if ETL_USING_BASE64_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        // Decode the whole groups a vector at a time, up to the padding.
+        const size_t n = private_base64::simd_decode(input, input_length, output, output_length);
+
+        p_in  += n;
+        p_out += (n / 4U) * 3U;
+      }
+#endif
+
       // Step through the input buffer, creating the output binary.
       while (p_in != p_in_end)
       {
@@ -518,6 +542,177 @@ namespace etl
       return '=';
     }
   };
+
+  //*************************************************************************
+  /// Streaming encoder for Base64.
+  /// Accepts the input in chunks of any size. Whole groups of three bytes are
+  /// encoded directly from each chunk. Only the one or two bytes left over at
+  /// the end of a chunk are held, until the next chunk or flush().
+  //*************************************************************************
+  class base64_encoder
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ETL_CONSTEXPR14 base64_encoder()
+      : pending()
+      , pending_length(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Encode a chunk from pointer/length to pointer/length.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      encode(const T* input, size_t input_length, char* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= encode_size(input_length), ETL_ERROR(base64_overflow), 0U);
+
+      char* p_out = output;
+
+      // Complete the group held over from the last chunk.
+      if (pending_length != 0U)
+      {
+        while ((pending_length < 3U) && (input_length != 0U))
+        {
+          pending[pending_length++] = static_cast<unsigned char>(*input++ & 0xFF);
+          --input_length;
+        }
+
+        if (pending_length < 3U)
+        {
+          return 0U;
+        }
+
+        p_out += etl::base64::encode(pending, 3U, p_out, 4U);
+        pending_length = 0U;
+      }
+
+      // Encode the whole groups in place.
+      const size_t whole_length = input_length - (input_length % 3U);
+
+      p_out += etl::base64::encode(input, whole_length, p_out, (whole_length / 3U) * 4U);
+
+      // Hold the remainder for the next chunk.
+      for (size_t i = whole_length; i < input_length; ++i)
+      {
+        pending[pending_length++] = static_cast<unsigned char>(input[i] & 0xFF);
+      }
+
+      return static_cast<size_t>(etl::distance(output, p_out));
+    }
+
+    //*************************************************************************
+    /// Encode a chunk from span to span.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    template <typename T, size_t Length1, size_t Length2>
+    ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      encode(const etl::span<const T, Length1>& input_span,
+             const etl::span<char, Length2>&    output_span)
+    {
+      return encode(input_span.begin(),  input_span.size(),
+                    output_span.begin(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Encode a chunk from pointer/length, appending to an etl::istring.
+    /// Returns the number of characters appended.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && (etl::integral_limits<T>::bits == 8U), size_t>::type
+      encode(const T* input, size_t input_length, etl::istring& output)
+    {
+      const size_t start = output.size();
+
+      ETL_ASSERT_OR_RETURN_VALUE((output.max_size() - start) >= encode_size(input_length), ETL_ERROR(base64_overflow), 0U);
+
+      output.uninitialized_resize(start + encode_size(input_length));
+
+      return encode(input, input_length, output.data() + start, output.size() - start);
+    }
+
+    //*************************************************************************
+    /// Writes the final, padded, group for any held bytes, and resets the encoder.
+    /// Returns the number of characters written.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t flush(char* output, size_t output_length)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(output_length >= flush_size(), ETL_ERROR(base64_overflow), 0U);
+
+      size_t length = 0U;
+
+      if (pending_length != 0U)
+      {
+        length = etl::base64::encode(pending, pending_length, output, 4U);
+        pending_length = 0U;
+      }
+
+      return length;
+    }
+
+    //*************************************************************************
+    /// Writes the final, padded, group to a span.
+    //*************************************************************************
+    template <size_t Length>
+    ETL_CONSTEXPR14 size_t flush(const etl::span<char, Length>& output_span)
+    {
+      return flush(output_span.begin(), output_span.size());
+    }
+
+    //*************************************************************************
+    /// Appends the final, padded, group to an etl::istring.
+    //*************************************************************************
+    size_t flush(etl::istring& output)
+    {
+      const size_t start = output.size();
+
+      ETL_ASSERT_OR_RETURN_VALUE((output.max_size() - start) >= flush_size(), ETL_ERROR(base64_overflow), 0U);
+
+      output.uninitialized_resize(start + flush_size());
+
+      return flush(output.data() + start, output.size() - start);
+    }
+
+    //*************************************************************************
+    /// The number of characters that encoding the next chunk may write.
+    //*************************************************************************
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    size_t encode_size(size_t input_length) const
+    {
+      return ((pending_length + input_length) / 3U) * 4U;
+    }
+
+    //*************************************************************************
+    /// The number of characters that flush() will write.
+    //*************************************************************************
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    size_t flush_size() const
+    {
+      return (pending_length != 0U) ? 4U : 0U;
+    }
+
+    //*************************************************************************
+    /// Discards any held bytes.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void reset()
+    {
+      pending_length = 0U;
+    }
+
+  private:
+
+    unsigned char pending[3];
+    size_t        pending_length;
+  };
 }
 
 #endif
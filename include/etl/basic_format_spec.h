@@ -214,6 +214,7 @@ namespace etl
       , left_justified_(false)
       , boolalpha_(false)
       , show_base_(false)
+      , shortest_(false)
       , fill_(typename TString::value_type(' '))
     {
     }
@@ -236,6 +237,7 @@ namespace etl
       , left_justified_(left_justified__)
       , boolalpha_(boolalpha__)
       , show_base_(show_base__)
+      , shortest_(false)
       , fill_(fill__)
     {
     }
@@ -252,6 +254,7 @@ namespace etl
       left_justified_ = false;
       boolalpha_      = false;
       show_base_      = false;
+      shortest_       = false;
       fill_           = typename TString::value_type(' ');
     }
 
@@ -331,6 +334,28 @@ namespace etl
       return show_base_;
     }
 
+    //***************************************************************************
+    /// Sets the shortest flag.
+    /// Floating point values are then formatted with the fewest digits that
+    /// convert back to exactly the same value, and the precision is ignored.
+    /// Fixed or scientific notation is chosen, whichever is shorter.
+    /// Ignored if ETL_DISABLE_SHORTEST_FLOATING_POINT is defined.
+    /// \return A reference to the basic_format_spec.
+    //***************************************************************************
+    ETL_CONSTEXPR14 basic_format_spec& shortest(bool b)
+    {
+      shortest_ = b;
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Gets the shortest flag.
+    //***************************************************************************
+    ETL_CONSTEXPR bool is_shortest() const
+    {
+      return shortest_;
+    }
+
     //***************************************************************************
     /// Sets the width.
     /// \return A reference to the basic_format_spec.
@@ -469,6 +494,7 @@ namespace etl
              (lhs.left_justified_ == rhs.left_justified_) &&
              (lhs.boolalpha_ == rhs.boolalpha_) &&
              (lhs.show_base_ == rhs.show_base_) &&
+             (lhs.shortest_ == rhs.shortest_) &&
              (lhs.fill_ == rhs.fill_);
     }
 
@@ -489,6 +515,7 @@ namespace etl
     bool left_justified_;
     bool boolalpha_;
     bool show_base_;
+    bool shortest_;
     typename TString::value_type fill_;
   };
 }
@@ -47,6 +47,7 @@ SOFTWARE.
 #include "exception.h"
 #include "binary.h"
 #include "flags.h"
+#include "private/string_search.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -1379,7 +1380,7 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + pos, end(), str.begin(), str.end());
+      const_iterator iposition = private_string_search::search(begin() + pos, end(), str.begin(), str.end());
 
       if (iposition == end())
       {
@@ -1405,7 +1406,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + etl::strlen(s));
+      const_iterator iposition = private_string_search::search(begin() + pos, end(), s, s + etl::strlen(s));
 
       if (iposition == end())
       {
@@ -1432,7 +1433,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = etl::search(begin() + pos, end(), s, s + n);
+      const_iterator iposition = private_string_search::search(begin() + pos, end(), s, s + n);
 
       if (iposition == end())
       {
@@ -1451,7 +1452,12 @@ namespace etl
     //*********************************************************************
     size_type find(T c, size_type position = 0) const
     {
-      const_iterator i = etl::find(begin() + position, end(), c);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const_iterator i = private_string_search::find_char(begin() + position, end(), c);
 
       if (i != end())
       {
@@ -2321,39 +2327,7 @@ namespace etl
     //*************************************************************************
     int compare(const_pointer first1, const_pointer last1, const_pointer first2, const_pointer last2) const
     {
-      while ((first1 != last1) && (first2 != last2))
-      {
-        if (*first1 < *first2)
-        {
-          // Compared character is lower.
-          return -1;
-        }
-        else if (*first1 > *first2)
-        {
-          // Compared character is higher.
-          return 1;
-        }
-
-        ++first1;
-        ++first2;
-      }
-
-      // We reached the end of one or both of the strings.
-      if ((first1 == last1) && (first2 == last2))
-      {
-        // Same length.
-        return 0;
-      }
-      else if (first1 == last1)
-      {
-        // Compared string is shorter.
-        return -1;
-      }
-      else
-      {
-        // Compared string is longer.
-        return 1;
-      }
+      return private_string_search::compare(first1, size_t(last1 - first1), first2, size_t(last2 - first2));
     }
 
     //*************************************************************************
@@ -2419,7 +2393,7 @@ namespace etl
   template <typename T>
   bool operator ==(const etl::ibasic_string<T>& lhs, const etl::ibasic_string<T>& rhs)
   {
-    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+    return (lhs.size() == rhs.size()) && private_string_search::equal(lhs.data(), rhs.data(), lhs.size());
   }
 
   //***************************************************************************
@@ -2432,7 +2406,7 @@ namespace etl
   template <typename T>
   bool operator ==(const etl::ibasic_string<T>& lhs, const T* rhs)
   {
-    return (lhs.size() == etl::strlen(rhs)) && etl::equal(lhs.begin(), lhs.end(), rhs);
+    return (lhs.size() == etl::strlen(rhs)) && private_string_search::equal(lhs.data(), rhs, lhs.size());
   }
 
   //***************************************************************************
@@ -2445,7 +2419,7 @@ namespace etl
   template <typename T>
   bool operator ==(const T* lhs, const etl::ibasic_string<T>& rhs)
   {
-    return (rhs.size() == etl::strlen(lhs)) && etl::equal(rhs.begin(), rhs.end(), lhs);
+    return (rhs.size() == etl::strlen(lhs)) && private_string_search::equal(rhs.data(), lhs, rhs.size());
   }
 
   //***************************************************************************
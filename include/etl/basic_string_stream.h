@@ -32,9 +32,16 @@ SOFTWARE.
 #define ETL_BASIC_STRING_STREAM_INCLUDED
 
 ///\ingroup string
+/// The stream writes directly into the buffer of the string that it is given.
+/// To format into a buffer owned by something else, such as a transmit
+/// buffer, give it an etl::string_ext that wraps that buffer.
+/// append and commit allow data to be written straight into the string's
+/// buffer, between formatted items, without an intermediate copy.
 
 #include "platform.h"
 #include "to_string.h"
+#include "span.h"
+#include "algorithm.h"
 
 namespace etl
 {
@@ -114,6 +121,35 @@ namespace etl
       text.assign(is);
     }
 
+    //*************************************************************************
+    /// Returns the free space at the end of the string, up to n characters,
+    /// so that it may be written to directly.
+    /// The span is shorter than n if the string does not have the space.
+    /// The characters are not part of the string until commit is called.
+    /// Any other write to the stream invalidates the span.
+    //*************************************************************************
+    etl::span<value_type> append(size_t n)
+    {
+      return etl::span<value_type>(text.data_end(), etl::min(n, text.available()));
+    }
+
+    //*************************************************************************
+    /// Adds n characters, written to the span returned by append, to the end of the string.
+    /// n is limited to the free space in the string.
+    //*************************************************************************
+    void commit(size_t n)
+    {
+      text.uninitialized_resize(text.size() + etl::min(n, text.available()));
+    }
+
+    //*************************************************************************
+    /// Returns the amount of free space in the string.
+    //*************************************************************************
+    size_t available() const
+    {
+      return text.available();
+    }
+
     //*************************************************************************
     /// Stream operators.
     //*************************************************************************
@@ -50,6 +50,28 @@ SOFTWARE.
   #include <bit>
 #endif
 
+#if ETL_USING_MSVC_BIT_INTRINSICS || ETL_USING_MSVC_POPCNT
+  #include <intrin.h>
+  #include <stdlib.h>
+#endif
+
+#if ETL_USING_BUILTIN_RBIT
+  #include <arm_acle.h>
+#endif
+
+#if ETL_USING_BUILTIN_BMI2
+  #include <immintrin.h>
+#endif
+
+// The intrinsics that are not constexpr may only be used at run time.
+#if ETL_USING_CPP14 && ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  #define ETL_BINARY_INTRINSIC_IS_RUNTIME (!__builtin_is_constant_evaluated())
+#elif ETL_USING_CPP14
+  #define ETL_BINARY_INTRINSIC_IS_RUNTIME false
+#else
+  #define ETL_BINARY_INTRINSIC_IS_RUNTIME true
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -343,45 +365,6 @@ namespace etl
     return TReturn((value ^ mask) - mask);
   }
 
-  //***************************************************************************
-  /// Find the position of the first set bit.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  ETL_CONSTEXPR14 uint_least8_t first_set_bit_position(T value)
-  {
-    return count_trailing_zeros(value);
-  }
-
-  //***************************************************************************
-  /// Find the position of the first clear bit.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  ETL_CONSTEXPR14 uint_least8_t first_clear_bit_position(T value)
-  {
-    value = ~value;
-    return count_trailing_zeros(value);
-  }
-
-  //***************************************************************************
-  /// Find the position of the first bit that is clear or set.
-  /// Starts from LSB.
-  ///\ingroup binary
-  //***************************************************************************
-  template <typename T>
-  ETL_CONSTEXPR14 uint_least8_t first_bit_position(bool state, T value)
-  {
-    if (!state)
-    {
-      value = ~value;
-    }
-
-    return count_trailing_zeros(value);
-  }
-
   //***************************************************************************
   /// Gets the value of the bit at POSITION
   /// Starts from LSB.
@@ -511,6 +494,36 @@ namespace etl
     return second ^ ((second ^ first) & MASK);
   }
 
+  //***************************************************************************
+  /// Zig-zag encodes a signed value, so that values of small magnitude,
+  /// positive or negative, become small unsigned values.
+  /// 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3, ...
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+    zigzag_encode(T value)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    return static_cast<unsigned_t>(static_cast<unsigned_t>(static_cast<unsigned_t>(value) << 1U) ^ ((value < 0) ? unsigned_t(~unsigned_t(0U)) : unsigned_t(0U)));
+  }
+
+  //***************************************************************************
+  /// Decodes a zig-zag encoded value.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, typename etl::make_signed<T>::type>::type
+    zigzag_decode(T value)
+  {
+    typedef typename etl::make_signed<T>::type signed_t;
+
+    return static_cast<signed_t>(static_cast<T>(value >> 1U) ^ static_cast<T>(T(0U) - static_cast<T>(value & 1U)));
+  }
+
   //***************************************************************************
   /// Reverse bits.
   ///\ingroup binary
@@ -528,11 +541,21 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 8U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return __builtin_bitreverse8(value);
+#else
+#if ETL_USING_BUILTIN_RBIT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<T>(__rbit(value) >> 24U);
+    }
+#endif
     value = ((value & 0xAAU) >> 1U) | ((value & 0x55U) << 1U);
     value = ((value & 0xCCU) >> 2U) | ((value & 0x33U) << 2U);
     value = (value >> 4U) | ((value & 0x0FU) << 4U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -579,12 +602,22 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 16U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return __builtin_bitreverse16(value);
+#else
+#if ETL_USING_BUILTIN_RBIT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<T>(__rbit(value) >> 16U);
+    }
+#endif
     value = ((value & 0xAAAAU) >> 1U) | ((value & 0x5555U) << 1U);
     value = ((value & 0xCCCCU) >> 2U) | ((value & 0x3333U) << 2U);
     value = ((value & 0xF0F0U) >> 4U) | ((value & 0x0F0FU) << 4U);
     value = (value >> 8U) | ((value & 0xFFU) << 8U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -632,6 +665,15 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return __builtin_bitreverse32(value);
+#else
+#if ETL_USING_BUILTIN_RBIT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return __rbit(value);
+    }
+#endif
     value = ((value & 0xAAAAAAAAUL) >>  1U) | ((value & 0x55555555UL) <<  1U);
     value = ((value & 0xCCCCCCCCUL) >>  2U) | ((value & 0x33333333UL) <<  2U);
     value = ((value & 0xF0F0F0F0UL) >>  4U) | ((value & 0x0F0F0F0FUL) <<  4U);
@@ -639,6 +681,7 @@ namespace etl
     value = (value >> 16U) | ((value & 0xFFFFU) << 16U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -689,6 +732,15 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 64U), T>::type
     reverse_bits(T value)
   {
+#if ETL_USING_BUILTIN_BITREVERSE
+    return __builtin_bitreverse64(value);
+#else
+#if ETL_USING_BUILTIN_RBIT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return __rbitll(value);
+    }
+#endif
     value = ((value & 0xAAAAAAAAAAAAAAAAULL) >>  1U) | ((value & 0x5555555555555555ULL) <<  1U);
     value = ((value & 0xCCCCCCCCCCCCCCCCULL) >>  2U) | ((value & 0x3333333333333333ULL) <<  2U);
     value = ((value & 0xF0F0F0F0F0F0F0F0ULL) >>  4U) | ((value & 0x0F0F0F0F0F0F0F0FULL) <<  4U);
@@ -697,6 +749,7 @@ namespace etl
     value = (value >> 32U) | ((value & 0xFFFFFFFFULL) << 32U);
 
     return value;
+#endif
   }
 
   //***********************************
@@ -779,7 +832,15 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap16(value);
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return _byteswap_ushort(value);
+    }
+#endif
     return (value >> 8U) | (value << 8U);
 #endif
   }
@@ -795,7 +856,15 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap32(value);
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return _byteswap_ulong(value);
+    }
+#endif
     value = ((value & 0xFF00FF00UL) >> 8U) | ((value & 0x00FF00FFUL) << 8U);
     value = (value >> 16U) | (value << 16U);
 
@@ -815,7 +884,15 @@ namespace etl
   {
 #if ETL_CPP23_SUPPORTED && ETL_USING_STL
     return std::byteswap(value);
+#elif ETL_USING_BUILTIN_BSWAP
+    return __builtin_bswap64(value);
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return _byteswap_uint64(value);
+    }
+#endif
     value = ((value & 0xFF00FF00FF00FF00ULL) >> 8U)  | ((value & 0x00FF00FF00FF00FFULL) << 8U);
     value = ((value & 0xFFFF0000FFFF0000ULL) >> 16U) | ((value & 0x0000FFFF0000FFFFULL) << 16U);
     value = (value >> 32U) | (value << 32U);
@@ -937,9 +1014,17 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 8U), uint_least8_t>::type
     count_bits(T value)
   {
-#if ETL_CPP23_SUPPORTED && ETL_USING_STL
+#if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcount(value));
 #else
+#if ETL_USING_MSVC_POPCNT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<uint_least8_t>(__popcnt16(value));
+    }
+#endif
     uint32_t count = 0U;
 
     count = value - ((value >> 1U) & 0x55U);
@@ -962,7 +1047,15 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcount(value));
 #else
+#if ETL_USING_MSVC_POPCNT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<uint_least8_t>(__popcnt16(value));
+    }
+#endif
     uint32_t count = 0U;
 
     count = value - ((value >> 1U) & 0x5555U);
@@ -985,7 +1078,15 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcountl(value));
 #else
+#if ETL_USING_MSVC_POPCNT
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<uint_least8_t>(__popcnt(value));
+    }
+#endif
     uint32_t count = 0U;
 
     count = value - ((value >> 1U) & 0x55555555UL);
@@ -1010,7 +1111,15 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::popcount(value);
+#elif ETL_USING_BUILTIN_POPCOUNT
+    return static_cast<uint_least8_t>(__builtin_popcountll(value));
 #else
+#if ETL_USING_MSVC_POPCNT && ETL_USING_MSVC_BIT_INTRINSICS_64
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      return static_cast<uint_least8_t>(__popcnt64(value));
+    }
+#endif
     uint64_t count = 0U;
 
     count = value - ((value >> 1U) & 0x5555555555555555ULL);
@@ -1132,7 +1241,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(8U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanForward(&index, value) ? static_cast<uint_least8_t>(index) : uint_least8_t(8U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x1U)
@@ -1181,7 +1300,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(16U) : static_cast<uint_least8_t>(__builtin_ctz(value));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanForward(&index, value) ? static_cast<uint_least8_t>(index) : uint_least8_t(16U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x1U)
@@ -1235,7 +1364,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_ctzl(value));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanForward(&index, value) ? static_cast<uint_least8_t>(index) : uint_least8_t(32U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x1UL)
@@ -1296,7 +1435,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countr_zero(value);
+#elif ETL_USING_BUILTIN_CTZ
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_ctzll(value));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS_64
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanForward64(&index, value) ? static_cast<uint_least8_t>(index) : uint_least8_t(64U);
+    }
+#endif
       uint_least8_t count = 0U;
 
       if (value & 0x1ULL)
@@ -1365,6 +1514,45 @@ namespace etl
     return static_cast<T>(count_trailing_zeros(static_cast<unsigned_t>(value)));
   }
 
+  //***************************************************************************
+  /// Find the position of the first set bit.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_set_bit_position(T value)
+  {
+    return count_trailing_zeros(value);
+  }
+
+  //***************************************************************************
+  /// Find the position of the first clear bit.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_clear_bit_position(T value)
+  {
+    value = ~value;
+    return count_trailing_zeros(value);
+  }
+
+  //***************************************************************************
+  /// Find the position of the first bit that is clear or set.
+  /// Starts from LSB.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14 uint_least8_t first_bit_position(bool state, T value)
+  {
+    if (!state)
+    {
+      value = ~value;
+    }
+
+    return count_trailing_zeros(value);
+  }
+
 #if ETL_USING_8BIT_TYPES
   //***************************************************************************
   /// Count trailing zeros. bit.
@@ -1618,7 +1806,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return (value == 0U) ? uint_least8_t(8U) : static_cast<uint_least8_t>(__builtin_clz(value) - (etl::integral_limits<unsigned int>::bits - 8U));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanReverse(&index, value) ? static_cast<uint_least8_t>(7U - index) : uint_least8_t(8U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x80U)
@@ -1667,7 +1865,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return (value == 0U) ? uint_least8_t(16U) : static_cast<uint_least8_t>(__builtin_clz(value) - (etl::integral_limits<unsigned int>::bits - 16U));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanReverse(&index, value) ? static_cast<uint_least8_t>(15U - index) : uint_least8_t(16U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x8000U)
@@ -1721,7 +1929,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return (value == 0U) ? uint_least8_t(32U) : static_cast<uint_least8_t>(__builtin_clzl(value) - (etl::integral_limits<unsigned long>::bits - 32U));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanReverse(&index, value) ? static_cast<uint_least8_t>(31U - index) : uint_least8_t(32U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x80000000UL)
@@ -1782,7 +2000,17 @@ namespace etl
   {
 #if ETL_USING_CPP20 && ETL_USING_STL
     return std::countl_zero(value);
+#elif ETL_USING_BUILTIN_CLZ
+    return (value == 0U) ? uint_least8_t(64U) : static_cast<uint_least8_t>(__builtin_clzll(value) - (etl::integral_limits<unsigned long long>::bits - 64U));
 #else
+#if ETL_USING_MSVC_BIT_INTRINSICS_64
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME)
+    {
+      unsigned long index = 0U;
+
+      return _BitScanReverse64(&index, value) ? static_cast<uint_least8_t>(63U - index) : uint_least8_t(64U);
+    }
+#endif
     uint_least8_t count = 0U;
 
     if (value & 0x8000000000000000ULL)
@@ -2188,6 +2416,442 @@ namespace etl
     return int64_t(binary_interleave(uint16_t(first), uint16_t(second)));
   }
 
+  //***************************************************************************
+  /// The BMI2 deposit and extract instructions.
+  //***************************************************************************
+  namespace private_binary
+  {
+    template <typename T>
+    struct has_bit_deposit
+    {
+      static ETL_CONSTANT bool value = (ETL_USING_BUILTIN_BMI2 == 1) && ((etl::integral_limits<T>::bits <= 32U) || (ETL_USING_BUILTIN_BMI2_64 == 1));
+    };
+
+#if ETL_USING_BUILTIN_BMI2
+    template <typename T>
+    typename etl::enable_if<(etl::integral_limits<T>::bits <= 32U), T>::type
+      deposit(T value, T mask)
+    {
+      return _pdep_u32(value, mask);
+    }
+
+    template <typename T>
+    typename etl::enable_if<(etl::integral_limits<T>::bits <= 32U), T>::type
+      extract(T value, T mask)
+    {
+      return _pext_u32(value, mask);
+    }
+
+  #if ETL_USING_BUILTIN_BMI2_64
+    template <typename T>
+    typename etl::enable_if<(etl::integral_limits<T>::bits == 64U), T>::type
+      deposit(T value, T mask)
+    {
+      return _pdep_u64(value, mask);
+    }
+
+    template <typename T>
+    typename etl::enable_if<(etl::integral_limits<T>::bits == 64U), T>::type
+      extract(T value, T mask)
+    {
+      return _pext_u64(value, mask);
+    }
+  #endif
+#endif
+
+    // Never called.
+    template <typename T>
+    typename etl::enable_if<!has_bit_deposit<T>::value, T>::type
+      deposit(T value, T)
+    {
+      return value;
+    }
+
+    // Never called.
+    template <typename T>
+    typename etl::enable_if<!has_bit_deposit<T>::value, T>::type
+      extract(T value, T)
+    {
+      return value;
+    }
+  }
+
+  //***************************************************************************
+  /// Bit deposit.
+  /// Copies the low bits of 'value' to the set bit positions of 'mask', in order from the LSB.
+  /// The other bits of the result are clear. Equivalent to the BMI2 PDEP instruction.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    bit_deposit(T value, T mask)
+  {
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<T>::value)
+    {
+      return private_binary::deposit(value, mask);
+    }
+
+    T result = 0U;
+
+    for (T bit = 1U; mask != 0U; bit <<= 1U)
+    {
+      T lowest = mask;
+      lowest &= ~(mask - 1U);
+
+      if ((value & bit) != 0U)
+      {
+        result |= lowest;
+      }
+
+      mask ^= lowest;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Bit extract.
+  /// Copies the bits of 'value' at the set bit positions of 'mask' to the low bits of the result, in order from the LSB.
+  /// The other bits of the result are clear. Equivalent to the BMI2 PEXT instruction.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, T>::type
+    bit_extract(T value, T mask)
+  {
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<T>::value)
+    {
+      return private_binary::extract(value, mask);
+    }
+
+    T result = 0U;
+
+    for (T bit = 1U; mask != 0U; bit <<= 1U)
+    {
+      T lowest = mask;
+      lowest &= ~(mask - 1U);
+
+      if ((value & lowest) != 0U)
+      {
+        result |= bit;
+      }
+
+      mask ^= lowest;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Find the position of the nth set bit, where n = 0 is the first.
+  /// Starts from LSB.
+  /// Returns the number of bits in T if there are not n + 1 set bits.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value, uint_least8_t>::type
+    nth_set_bit_position(T value, size_t n)
+  {
+    if (n >= etl::count_bits(value))
+    {
+      return uint_least8_t(etl::integral_limits<T>::bits);
+    }
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<T>::value)
+    {
+      // Deposit bit n at the position of the nth set bit.
+      T bit = 1U;
+      bit <<= n;
+
+      return etl::count_trailing_zeros(private_binary::deposit(bit, value));
+    }
+
+    while (n != 0U)
+    {
+      value &= (value - 1U);
+      --n;
+    }
+
+    return etl::count_trailing_zeros(value);
+  }
+
+  namespace private_binary
+  {
+    //*************************************************************************
+    /// Spreads the low bits of a value to every third bit.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t spread_by_3(uint32_t value)
+    {
+      value &= 0x000003FFUL;
+      value = (value | (value << 16U)) & 0x030000FFUL;
+      value = (value | (value << 8U))  & 0x0300F00FUL;
+      value = (value | (value << 4U))  & 0x030C30C3UL;
+      value = (value | (value << 2U))  & 0x09249249UL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Compacts every third bit of a value to the low bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t compact_by_3(uint32_t value)
+    {
+      value &= 0x09249249UL;
+      value = (value | (value >> 2U))  & 0x030C30C3UL;
+      value = (value | (value >> 4U))  & 0x0300F00FUL;
+      value = (value | (value >> 8U))  & 0x030000FFUL;
+      value = (value | (value >> 16U)) & 0x000003FFUL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Compacts every second bit of a value to the low bits.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint32_t compact_by_2(uint32_t value)
+    {
+      value &= 0x55555555UL;
+      value = (value | (value >> 1U)) & 0x33333333UL;
+      value = (value | (value >> 2U)) & 0x0F0F0F0FUL;
+      value = (value | (value >> 4U)) & 0x00FF00FFUL;
+      value = (value | (value >> 8U)) & 0x0000FFFFUL;
+
+      return value;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t spread_by_3(uint64_t value)
+    {
+      value &= 0x00000000001FFFFFULL;
+      value = (value | (value << 32U)) & 0x001F00000000FFFFULL;
+      value = (value | (value << 16U)) & 0x001F0000FF0000FFULL;
+      value = (value | (value << 8U))  & 0x100F00F00F00F00FULL;
+      value = (value | (value << 4U))  & 0x10C30C30C30C30C3ULL;
+      value = (value | (value << 2U))  & 0x1249249249249249ULL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t compact_by_3(uint64_t value)
+    {
+      value &= 0x1249249249249249ULL;
+      value = (value | (value >> 2U))  & 0x10C30C30C30C30C3ULL;
+      value = (value | (value >> 4U))  & 0x100F00F00F00F00FULL;
+      value = (value | (value >> 8U))  & 0x001F0000FF0000FFULL;
+      value = (value | (value >> 16U)) & 0x001F00000000FFFFULL;
+      value = (value | (value >> 32U)) & 0x00000000001FFFFFULL;
+
+      return value;
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t compact_by_2(uint64_t value)
+    {
+      value &= 0x5555555555555555ULL;
+      value = (value | (value >> 1U))  & 0x3333333333333333ULL;
+      value = (value | (value >> 2U))  & 0x0F0F0F0F0F0F0F0FULL;
+      value = (value | (value >> 4U))  & 0x00FF00FF00FF00FFULL;
+      value = (value | (value >> 8U))  & 0x0000FFFF0000FFFFULL;
+      value = (value | (value >> 16U)) & 0x00000000FFFFFFFFULL;
+
+      return value;
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// 2D Morton encode.
+  /// Interleaves the bits of x and y, with x in the even bits.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 16U), uint32_t>::type
+    morton_encode(T x, T y)
+  {
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint32_t>::value)
+    {
+      const uint32_t ux = x;
+      const uint32_t uy = y;
+
+      return private_binary::deposit(ux, uint32_t(0x55555555UL)) | private_binary::deposit(uy, uint32_t(0xAAAAAAAAUL));
+    }
+
+    return etl::binary_interleave(x, y);
+  }
+
+  //***************************************************************************
+  /// 2D Morton decode.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), void>::type
+    morton_decode(T code, uint16_t& x, uint16_t& y)
+  {
+    const uint32_t ucode = code;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint32_t>::value)
+    {
+      x = static_cast<uint16_t>(private_binary::extract(ucode, uint32_t(0x55555555UL)));
+      y = static_cast<uint16_t>(private_binary::extract(ucode, uint32_t(0xAAAAAAAAUL)));
+    }
+    else
+    {
+      x = static_cast<uint16_t>(private_binary::compact_by_2(ucode));
+      y = static_cast<uint16_t>(private_binary::compact_by_2(ucode >> 1U));
+    }
+  }
+
+  //***************************************************************************
+  /// 3D Morton encode.
+  /// Interleaves the low 10 bits of x, y and z, with x in bits 0, 3, 6 ...
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 16U), uint32_t>::type
+    morton_encode(T x, T y, T z)
+  {
+    const uint32_t ux = x;
+    const uint32_t uy = y;
+    const uint32_t uz = z;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint32_t>::value)
+    {
+      return private_binary::deposit(ux, uint32_t(0x09249249UL)) |
+             private_binary::deposit(uy, uint32_t(0x12492492UL)) |
+             private_binary::deposit(uz, uint32_t(0x24924924UL));
+    }
+
+    return private_binary::spread_by_3(ux) | (private_binary::spread_by_3(uy) << 1U) | (private_binary::spread_by_3(uz) << 2U);
+  }
+
+  //***************************************************************************
+  /// 3D Morton decode.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), void>::type
+    morton_decode(T code, uint16_t& x, uint16_t& y, uint16_t& z)
+  {
+    const uint32_t ucode = code;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint32_t>::value)
+    {
+      x = static_cast<uint16_t>(private_binary::extract(ucode, uint32_t(0x09249249UL)));
+      y = static_cast<uint16_t>(private_binary::extract(ucode, uint32_t(0x12492492UL)));
+      z = static_cast<uint16_t>(private_binary::extract(ucode, uint32_t(0x24924924UL)));
+    }
+    else
+    {
+      x = static_cast<uint16_t>(private_binary::compact_by_3(ucode));
+      y = static_cast<uint16_t>(private_binary::compact_by_3(ucode >> 1U));
+      z = static_cast<uint16_t>(private_binary::compact_by_3(ucode >> 2U));
+    }
+  }
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// 2D Morton encode.
+  /// Interleaves the bits of x and y, with x in the even bits.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), uint64_t>::type
+    morton_encode(T x, T y)
+  {
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint64_t>::value)
+    {
+      const uint64_t ux = x;
+      const uint64_t uy = y;
+
+      return private_binary::deposit(ux, uint64_t(0x5555555555555555ULL)) | private_binary::deposit(uy, uint64_t(0xAAAAAAAAAAAAAAAAULL));
+    }
+
+    return etl::binary_interleave(x, y);
+  }
+
+  //***************************************************************************
+  /// 2D Morton decode.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 64U), void>::type
+    morton_decode(T code, uint32_t& x, uint32_t& y)
+  {
+    const uint64_t ucode = code;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint64_t>::value)
+    {
+      x = static_cast<uint32_t>(private_binary::extract(ucode, uint64_t(0x5555555555555555ULL)));
+      y = static_cast<uint32_t>(private_binary::extract(ucode, uint64_t(0xAAAAAAAAAAAAAAAAULL)));
+    }
+    else
+    {
+      x = static_cast<uint32_t>(private_binary::compact_by_2(ucode));
+      y = static_cast<uint32_t>(private_binary::compact_by_2(ucode >> 1U));
+    }
+  }
+
+  //***************************************************************************
+  /// 3D Morton encode.
+  /// Interleaves the low 21 bits of x, y and z, with x in bits 0, 3, 6 ...
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 32U), uint64_t>::type
+    morton_encode(T x, T y, T z)
+  {
+    const uint64_t ux = x;
+    const uint64_t uy = y;
+    const uint64_t uz = z;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint64_t>::value)
+    {
+      return private_binary::deposit(ux, uint64_t(0x1249249249249249ULL)) |
+             private_binary::deposit(uy, uint64_t(0x2492492492492492ULL)) |
+             private_binary::deposit(uz, uint64_t(0x4924924924924924ULL));
+    }
+
+    return private_binary::spread_by_3(ux) | (private_binary::spread_by_3(uy) << 1U) | (private_binary::spread_by_3(uz) << 2U);
+  }
+
+  //***************************************************************************
+  /// 3D Morton decode.
+  ///\ingroup binary
+  //***************************************************************************
+  template <typename T>
+  ETL_CONSTEXPR14
+    typename etl::enable_if<etl::is_integral<T>::value && etl::is_unsigned<T>::value && (etl::integral_limits<T>::bits == 64U), void>::type
+    morton_decode(T code, uint32_t& x, uint32_t& y, uint32_t& z)
+  {
+    const uint64_t ucode = code;
+
+    if (ETL_BINARY_INTRINSIC_IS_RUNTIME && private_binary::has_bit_deposit<uint64_t>::value)
+    {
+      x = static_cast<uint32_t>(private_binary::extract(ucode, uint64_t(0x1249249249249249ULL)));
+      y = static_cast<uint32_t>(private_binary::extract(ucode, uint64_t(0x2492492492492492ULL)));
+      z = static_cast<uint32_t>(private_binary::extract(ucode, uint64_t(0x4924924924924924ULL)));
+    }
+    else
+    {
+      x = static_cast<uint32_t>(private_binary::compact_by_3(ucode));
+      y = static_cast<uint32_t>(private_binary::compact_by_3(ucode >> 1U));
+      z = static_cast<uint32_t>(private_binary::compact_by_3(ucode >> 2U));
+    }
+  }
+#endif
+
   //***************************************************************************
   /// Checks if odd.
   ///\ingroup binary
@@ -0,0 +1,606 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BINARY_LOG_INCLUDED
+#define ETL_BINARY_LOG_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "enum_type.h"
+#include "endianness.h"
+#include "byte_stream.h"
+#include "bip_buffer_spsc_atomic.h"
+#include "span.h"
+#include "string.h"
+#include "string_view.h"
+#include "to_string.h"
+#include "format_spec.h"
+
+#include <stdint.h>
+
+///\defgroup binary_log binary_log
+/// Deferred logging. The device writes a message id and the raw argument values;
+/// the text is formatted later, usually on the host, from a table of format strings.
+/// Each record is:
+///   uint16_t id
+///   uint8_t  number of arguments
+///   For each argument, a uint8_t etl::binary_log_type, followed by the value.
+///   Strings are a uint16_t length followed by the characters.
+///   Pointers are written as uint64_t.
+///\ingroup utilities
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// The type tags that precede each argument in a record.
+  ///\ingroup binary_log
+  //***************************************************************************
+  struct binary_log_type
+  {
+    enum enum_type
+    {
+      Bool,
+      Char,
+      Int8,
+      UInt8,
+      Int16,
+      UInt16,
+      Int32,
+      UInt32,
+      Int64,
+      UInt64,
+      Float,
+      Double,
+      String,
+      Pointer
+    };
+
+    ETL_DECLARE_ENUM_TYPE(binary_log_type, uint8_t)
+    ETL_ENUM_TYPE(Bool,    "Bool")
+    ETL_ENUM_TYPE(Char,    "Char")
+    ETL_ENUM_TYPE(Int8,    "Int8")
+    ETL_ENUM_TYPE(UInt8,   "UInt8")
+    ETL_ENUM_TYPE(Int16,   "Int16")
+    ETL_ENUM_TYPE(UInt16,  "UInt16")
+    ETL_ENUM_TYPE(Int32,   "Int32")
+    ETL_ENUM_TYPE(UInt32,  "UInt32")
+    ETL_ENUM_TYPE(Int64,   "Int64")
+    ETL_ENUM_TYPE(UInt64,  "UInt64")
+    ETL_ENUM_TYPE(Float,   "Float")
+    ETL_ENUM_TYPE(Double,  "Double")
+    ETL_ENUM_TYPE(String,  "String")
+    ETL_ENUM_TYPE(Pointer, "Pointer")
+    ETL_END_ENUM_TYPE
+  };
+
+  namespace private_binary_log
+  {
+    static ETL_CONSTANT size_t Header_Size     = sizeof(uint16_t) + sizeof(uint8_t);
+    static ETL_CONSTANT size_t Max_Text_Length = 65535U;
+
+    //*************************************************************************
+    /// The tag for an integral type.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR uint8_t integral_tag()
+    {
+      return (sizeof(T) == 1U) ? (etl::is_signed<T>::value ? uint8_t(binary_log_type::Int8)  : uint8_t(binary_log_type::UInt8))  :
+             (sizeof(T) == 2U) ? (etl::is_signed<T>::value ? uint8_t(binary_log_type::Int16) : uint8_t(binary_log_type::UInt16)) :
+             (sizeof(T) == 4U) ? (etl::is_signed<T>::value ? uint8_t(binary_log_type::Int32) : uint8_t(binary_log_type::UInt32)) :
+                                 (etl::is_signed<T>::value ? uint8_t(binary_log_type::Int64) : uint8_t(binary_log_type::UInt64));
+    }
+
+    //*************************************************************************
+    /// Text arguments are truncated to the maximum length.
+    //*************************************************************************
+    inline size_t text_length(size_t length)
+    {
+      return (length > Max_Text_Length) ? Max_Text_Length : length;
+    }
+
+    //*************************************************************************
+    // The encoded size of each argument type, including the tag.
+    //*************************************************************************
+    inline size_t encoded_size(bool)
+    {
+      return 2U;
+    }
+
+    inline size_t encoded_size(char)
+    {
+      return 2U;
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, size_t>::type
+      encoded_size(T)
+    {
+      return 1U + (etl::is_floating_point<T>::value ? ((sizeof(T) == sizeof(float)) ? sizeof(float) : sizeof(double))
+                                                    : sizeof(T));
+    }
+
+    inline size_t encoded_size(const char* text)
+    {
+      return 1U + sizeof(uint16_t) + text_length(etl::strlen(text));
+    }
+
+    inline size_t encoded_size(const etl::string_view& text)
+    {
+      return 1U + sizeof(uint16_t) + text_length(text.size());
+    }
+
+    inline size_t encoded_size(const etl::istring& text)
+    {
+      return 1U + sizeof(uint16_t) + text_length(text.size());
+    }
+
+    template <typename T>
+    size_t encoded_size(const T*)
+    {
+      return 1U + sizeof(uint64_t);
+    }
+
+    //*************************************************************************
+    /// The total size of the arguments.
+    //*************************************************************************
+    inline size_t arguments_size()
+    {
+      return 0U;
+    }
+
+    template <typename T, typename... TRest>
+    size_t arguments_size(const T& first, const TRest&... rest)
+    {
+      return encoded_size(first) + arguments_size(rest...);
+    }
+
+    //*************************************************************************
+    // Writes each argument type, including the tag.
+    // The space has already been checked.
+    //*************************************************************************
+    inline void encode(etl::byte_stream_writer& writer, bool value)
+    {
+      writer.write_unchecked(uint8_t(binary_log_type::Bool));
+      writer.write_unchecked(uint8_t(value ? 1U : 0U));
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, char value)
+    {
+      writer.write_unchecked(uint8_t(binary_log_type::Char));
+      writer.write_unchecked(value);
+    }
+
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, void>::type
+      encode(etl::byte_stream_writer& writer, T value)
+    {
+      writer.write_unchecked(integral_tag<T>());
+      writer.write_unchecked(value);
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, float value)
+    {
+      writer.write_unchecked(uint8_t(binary_log_type::Float));
+      writer.write_unchecked(value);
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, double value)
+    {
+      writer.write_unchecked(uint8_t(binary_log_type::Double));
+      writer.write_unchecked(value);
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, long double value)
+    {
+      encode(writer, static_cast<double>(value));
+    }
+
+    inline void encode_text(etl::byte_stream_writer& writer, const char* text, size_t length)
+    {
+      length = text_length(length);
+
+      writer.write_unchecked(uint8_t(binary_log_type::String));
+      writer.write_unchecked(static_cast<uint16_t>(length));
+      writer.write_unchecked(text, length);
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, const char* text)
+    {
+      encode_text(writer, text, etl::strlen(text));
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, const etl::string_view& text)
+    {
+      encode_text(writer, text.data(), text.size());
+    }
+
+    inline void encode(etl::byte_stream_writer& writer, const etl::istring& text)
+    {
+      encode_text(writer, text.data(), text.size());
+    }
+
+    template <typename T>
+    void encode(etl::byte_stream_writer& writer, const T* pointer)
+    {
+      writer.write_unchecked(uint8_t(binary_log_type::Pointer));
+      const uint64_t address = reinterpret_cast<uintptr_t>(pointer);
+
+      writer.write_unchecked(address);
+    }
+
+    //*************************************************************************
+    inline void encode_arguments(etl::byte_stream_writer&)
+    {
+    }
+
+    template <typename T, typename... TRest>
+    void encode_arguments(etl::byte_stream_writer& writer, const T& first, const TRest&... rest)
+    {
+      encode(writer, first);
+      encode_arguments(writer, rest...);
+    }
+  }
+
+  //***************************************************************************
+  /// The number of bytes a record will take.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <typename... TArgs>
+  size_t binary_log_size(const TArgs&... args)
+  {
+    return private_binary_log::Header_Size + private_binary_log::arguments_size(args...);
+  }
+
+  //***************************************************************************
+  /// Writes a record to a byte stream.
+  /// Returns <b>false</b>, and writes nothing, if there is not enough space.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <typename... TArgs>
+  bool binary_log_write(etl::byte_stream_writer& writer, uint16_t id, const TArgs&... args)
+  {
+    ETL_STATIC_ASSERT(sizeof...(TArgs) <= 255U, "Too many arguments");
+
+    const bool success = (writer.available_bytes() >= etl::binary_log_size(args...));
+
+    if (success)
+    {
+      writer.write_unchecked(id);
+      writer.write_unchecked(static_cast<uint8_t>(sizeof...(TArgs)));
+      private_binary_log::encode_arguments(writer, args...);
+    }
+
+    return success;
+  }
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Writes a record to a single producer, single consumer bip buffer.
+  /// Each record is contiguous, in little endian order.
+  /// Returns <b>false</b>, and writes nothing, if there is not enough space.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <typename T, size_t Memory_Model, typename... TArgs>
+  bool binary_log_write(etl::ibip_buffer_spsc_atomic<T, Memory_Model>& buffer, uint16_t id, const TArgs&... args)
+  {
+    ETL_STATIC_ASSERT(sizeof(T) == 1U, "The buffer must hold bytes");
+
+    typedef typename etl::ibip_buffer_spsc_atomic<T, Memory_Model>::size_type size_type;
+
+    const size_t size = etl::binary_log_size(args...);
+
+    etl::span<T> reserve = buffer.write_reserve_optimal(static_cast<size_type>(size));
+
+    const bool success = (reserve.size() >= size);
+
+    if (success)
+    {
+      etl::byte_stream_writer writer(reserve.data(), size, etl::endian::little);
+      etl::binary_log_write(writer, id, args...);
+      buffer.write_commit(reserve.first(size));
+    }
+
+    return success;
+  }
+#endif
+
+  //***************************************************************************
+  /// A decoded argument.
+  /// Text refers to the characters in the record's buffer.
+  ///\ingroup binary_log
+  //***************************************************************************
+  struct binary_log_argument
+  {
+    binary_log_argument()
+      : type(binary_log_type::Bool)
+      , signed_value(0)
+      , unsigned_value(0U)
+      , floating_value(0.0)
+      , text()
+    {
+    }
+
+    etl::binary_log_type type;
+    int64_t              signed_value;   ///< Bool, Char and signed integral values.
+    uint64_t             unsigned_value; ///< Unsigned integral values and pointers.
+    double               floating_value; ///< Float and Double values.
+    etl::string_view     text;           ///< String values.
+  };
+
+  //***************************************************************************
+  /// A decoded record with up to Max_Arguments arguments.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <size_t Max_Arguments>
+  struct binary_log_record
+  {
+    static ETL_CONSTANT size_t MAX_ARGUMENTS = Max_Arguments;
+
+    binary_log_record()
+      : id(0U)
+      , size(0U)
+    {
+    }
+
+    uint16_t                 id;
+    size_t                   size;
+    etl::binary_log_argument arguments[Max_Arguments];
+  };
+
+  template <size_t Max_Arguments>
+  ETL_CONSTANT size_t binary_log_record<Max_Arguments>::MAX_ARGUMENTS;
+
+  namespace private_binary_log
+  {
+    //*************************************************************************
+    /// Reads a value of type T.
+    //*************************************************************************
+    template <typename T>
+    bool read_value(etl::byte_stream_reader& reader, T& value)
+    {
+      etl::optional<T> result = reader.read<T>();
+
+      if (result.has_value())
+      {
+        value = result.value();
+      }
+
+      return result.has_value();
+    }
+
+    //*************************************************************************
+    /// Reads one argument.
+    //*************************************************************************
+    inline bool decode(etl::byte_stream_reader& reader, etl::binary_log_argument& argument)
+    {
+      uint8_t tag = 0U;
+
+      if (!read_value(reader, tag))
+      {
+        return false;
+      }
+
+      bool success = true;
+
+      argument.type = etl::binary_log_type(static_cast<etl::binary_log_type::enum_type>(tag));
+
+      switch (tag)
+      {
+        case binary_log_type::Bool:   { uint8_t  v = 0U; success = read_value(reader, v); argument.signed_value   = v; break; }
+        case binary_log_type::Char:   { char     v = 0;  success = read_value(reader, v); argument.signed_value   = v; break; }
+        case binary_log_type::Int8:   { int8_t   v = 0;  success = read_value(reader, v); argument.signed_value   = v; break; }
+        case binary_log_type::UInt8:  { uint8_t  v = 0U; success = read_value(reader, v); argument.unsigned_value = v; break; }
+        case binary_log_type::Int16:  { int16_t  v = 0;  success = read_value(reader, v); argument.signed_value   = v; break; }
+        case binary_log_type::UInt16: { uint16_t v = 0U; success = read_value(reader, v); argument.unsigned_value = v; break; }
+        case binary_log_type::Int32:  { int32_t  v = 0;  success = read_value(reader, v); argument.signed_value   = v; break; }
+        case binary_log_type::UInt32: { uint32_t v = 0U; success = read_value(reader, v); argument.unsigned_value = v; break; }
+        case binary_log_type::Int64:  { success = read_value(reader, argument.signed_value);   break; }
+        case binary_log_type::UInt64:
+        case binary_log_type::Pointer:{ success = read_value(reader, argument.unsigned_value); break; }
+        case binary_log_type::Float:  { float    v = 0;  success = read_value(reader, v); argument.floating_value = v; break; }
+        case binary_log_type::Double: { success = read_value(reader, argument.floating_value); break; }
+
+        case binary_log_type::String:
+        {
+          uint16_t length = 0U;
+          success = read_value(reader, length);
+
+          if (success)
+          {
+            etl::optional<etl::span<const char> > text = reader.read<char>(length);
+            success = text.has_value();
+
+            if (success)
+            {
+              argument.text = etl::string_view(text.value().data(), text.value().size());
+            }
+          }
+          break;
+        }
+
+        default:
+        {
+          success = false;
+          break;
+        }
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Formats one argument, with the default format.
+    //*************************************************************************
+    inline void format_argument(const etl::binary_log_argument& argument, etl::istring& str)
+    {
+      etl::format_spec format;
+
+      switch (argument.type)
+      {
+        case binary_log_type::Bool:
+        {
+          etl::to_string(argument.signed_value != 0, str, format.boolalpha(true), true);
+          break;
+        }
+
+        case binary_log_type::Char:
+        {
+          str.push_back(static_cast<char>(argument.signed_value));
+          break;
+        }
+
+        case binary_log_type::Int8:
+        case binary_log_type::Int16:
+        case binary_log_type::Int32:
+        case binary_log_type::Int64:
+        {
+          etl::to_string(argument.signed_value, str, format, true);
+          break;
+        }
+
+        case binary_log_type::UInt8:
+        case binary_log_type::UInt16:
+        case binary_log_type::UInt32:
+        case binary_log_type::UInt64:
+        {
+          etl::to_string(argument.unsigned_value, str, format, true);
+          break;
+        }
+
+        case binary_log_type::Pointer:
+        {
+          etl::to_string(argument.unsigned_value, str, format.hex().show_base(true), true);
+          break;
+        }
+
+        case binary_log_type::Float:
+        case binary_log_type::Double:
+        {
+#if ETL_HAS_SHORTEST_FLOATING_POINT
+          format.shortest(true);
+#else
+          format.precision(6U);
+#endif
+          etl::to_string(argument.floating_value, str, format, true);
+          break;
+        }
+
+        case binary_log_type::String:
+        {
+          str.append(argument.text.data(), argument.text.size());
+          break;
+        }
+
+        default:
+        {
+          break;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Reads the next record from a byte stream.
+  /// Returns <b>false</b> if there is no complete, valid record, or if it has
+  /// more than Max_Arguments arguments.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <size_t Max_Arguments>
+  bool binary_log_read(etl::byte_stream_reader& reader, etl::binary_log_record<Max_Arguments>& record)
+  {
+    uint8_t count = 0U;
+
+    bool success = private_binary_log::read_value(reader, record.id) &&
+                   private_binary_log::read_value(reader, count)     &&
+                   (count <= Max_Arguments);
+
+    record.size = 0U;
+
+    while (success && (record.size < count))
+    {
+      success = private_binary_log::decode(reader, record.arguments[record.size]);
+
+      if (success)
+      {
+        ++record.size;
+      }
+    }
+
+    return success;
+  }
+
+  //***************************************************************************
+  /// Formats a decoded record.
+  /// Each "{}" in the format string is replaced by the next argument.
+  /// "{{" and "}}" are literal braces. Missing arguments are left empty.
+  /// The text is appended to the string.
+  ///\ingroup binary_log
+  //***************************************************************************
+  template <size_t Max_Arguments>
+  etl::istring& binary_log_format(etl::string_view format, const etl::binary_log_record<Max_Arguments>& record, etl::istring& str)
+  {
+    size_t argument = 0U;
+    size_t i        = 0U;
+
+    while (i < format.size())
+    {
+      const char c    = format[i];
+      const char next = ((i + 1U) < format.size()) ? format[i + 1U] : '\0';
+
+      if (((c == '{') || (c == '}')) && (next == c))
+      {
+        str.push_back(c);
+        i += 2U;
+      }
+      else if ((c == '{') && (next == '}'))
+      {
+        if (argument < record.size)
+        {
+          private_binary_log::format_argument(record.arguments[argument], str);
+        }
+
+        ++argument;
+        i += 2U;
+      }
+      else
+      {
+        str.push_back(c);
+        ++i;
+      }
+    }
+
+    return str;
+  }
+}
+
+#endif
+#endif
@@ -676,6 +676,52 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Write a block of integral values, bit packed relative to the smallest
+    /// (frame of reference). The smallest value is written in full, followed by
+    /// the bit width of the largest offset from it, in 7 bits, followed by the
+    /// offset of each value in that width.
+    /// The number of values is not written.
+    /// Nothing is written if there is not enough space for the whole block.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      write_packed(const T* start, size_t length)
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      const T             minimum = packed_minimum(start, length);
+      const uint_least8_t width   = packed_width(start, length, minimum);
+
+      bool success = ((CHAR_BIT * sizeof(T)) + 7U + (length * width)) <= available_bits();
+
+      if (success)
+      {
+        write_unchecked(minimum);
+        write_unchecked(width, 7U);
+
+        if (width != 0U)
+        {
+          for (size_t i = 0U; i < length; ++i)
+          {
+            write_unchecked(static_cast<unsigned_t>(static_cast<unsigned_t>(start[i]) - static_cast<unsigned_t>(minimum)), width);
+          }
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// The number of bits needed to write a block with write_packed.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, size_t>::type
+      packed_size_bits(const T* start, size_t length)
+    {
+      return (CHAR_BIT * sizeof(T)) + 7U + (length * packed_width(start, length, packed_minimum(start, length)));
+    }
+
     //***************************************************************************
     /// Skip n bits, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -878,6 +924,34 @@ namespace etl
 
   private:
 
+    //***************************************************************************
+    /// The smallest value in a packed block.
+    //***************************************************************************
+    template <typename T>
+    static T packed_minimum(const T* start, size_t length)
+    {
+      return (length == 0U) ? T(0) : *etl::min_element(start, start + length);
+    }
+
+    //***************************************************************************
+    /// The bit width of the largest offset from the minimum in a packed block.
+    //***************************************************************************
+    template <typename T>
+    static uint_least8_t packed_width(const T* start, size_t length, T minimum)
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      unsigned_t offsets = 0U;
+
+      // The highest set bit of the OR of the offsets is that of the largest.
+      for (size_t i = 0U; i < length; ++i)
+      {
+        offsets |= static_cast<unsigned_t>(static_cast<unsigned_t>(start[i]) - static_cast<unsigned_t>(minimum));
+      }
+
+      return static_cast<uint_least8_t>(etl::integral_limits<unsigned_t>::bits - etl::count_leading_zeros(offsets));
+    }
+
     //***************************************************************************
     /// Write a value to the stream.
     /// It will be passed one of five unsigned types.
@@ -894,18 +968,28 @@ namespace etl
         value = value >> ((CHAR_BIT * sizeof(T)) - nbits);
       }
 
-      // Send the bits to the stream.
-      while (nbits != 0)
+#if ETL_USING_64BIT_TYPES && (CHAR_BIT == 8)
+      // Do the used bits of the current char and the new bits fit in one accumulator?
+      if ((nbits != 0U) && ((nbits + (CHAR_BIT - bits_available_in_char)) <= 64))
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
-        nbits -= mask_width;
-        T mask = ((T(1U) << mask_width) - 1U) << nbits;
+        write_accumulated(value, nbits);
+      }
+      else
+#endif
+      {
+        // Send the bits to the stream.
+        while (nbits != 0)
+        {
+          unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
+          nbits -= mask_width;
+          T mask = ((T(1U) << mask_width) - 1U) << nbits;
 
-        // Move chunk to lowest char bits.
-        // Chunks are never larger than one char.
-        T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
+          // Move chunk to lowest char bits.
+          // Chunks are never larger than one char.
+          T chunk = ((value & mask) >> nbits) << (bits_available_in_char - mask_width);
 
-        write_chunk(static_cast<char>(chunk), mask_width);
+          write_chunk(static_cast<char>(chunk), mask_width);
+        }
       }
 
       if (callback.is_valid())
@@ -914,6 +998,42 @@ namespace etl
       }
     }
 
+#if ETL_USING_64BIT_TYPES && (CHAR_BIT == 8)
+    //***************************************************************************
+    /// Write up to 64 bits, less the used bits of the current char, in one step.
+    /// The new bits are shifted into place in a 64 bit accumulator, following
+    /// the used bits of the current char, and then stored a char at a time.
+    /// Only the chars that the bits occupy are written.
+    //***************************************************************************
+    void write_accumulated(uint64_t value, uint_least8_t nbits)
+    {
+      const uint_least8_t used_bits  = static_cast<uint_least8_t>(CHAR_BIT - bits_available_in_char);
+      const uint_least8_t total_bits = static_cast<uint_least8_t>(used_bits + nbits);
+      const size_t        n_chars    = (total_bits + CHAR_BIT - 1U) / CHAR_BIT;
+
+      const uint64_t accumulator = (value << (64U - nbits)) >> used_bits;
+
+      char* p = pdata + char_index;
+
+      // Clear if new byte.
+      if (used_bits == 0U)
+      {
+        p[0] = 0;
+      }
+
+      p[0] = static_cast<char>(p[0] | static_cast<char>(accumulator >> 56U));
+
+      for (size_t i = 1U; i < n_chars; ++i)
+      {
+        p[i] = static_cast<char>(accumulator >> (56U - (CHAR_BIT * i)));
+      }
+
+      char_index             += total_bits / CHAR_BIT;
+      bits_available_in_char  = static_cast<unsigned char>(CHAR_BIT - (total_bits % CHAR_BIT));
+      bits_available         -= nbits;
+    }
+#endif
+
     //***************************************************************************
     /// Write a data chunk to the stream
     //***************************************************************************
@@ -1170,6 +1290,47 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// Read a block of 'length' integral values written by write_packed.
+    /// Returns <b>false</b>, and does not move, if the block is incomplete or invalid.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      read_packed(T* start, size_t length)
+    {
+      typedef typename etl::unsigned_type<T>::type unsigned_t;
+
+      if (bits_available < ((CHAR_BIT * sizeof(T)) + 7U))
+      {
+        return false;
+      }
+
+      const unsigned char saved_bits_available_in_char = bits_available_in_char;
+      const size_t        saved_char_index             = char_index;
+      const size_t        saved_bits_available         = bits_available;
+
+      const T             minimum = read_unchecked<T>();
+      const uint_least8_t width   = read_unchecked<uint_least8_t>(7U);
+
+      if ((width > (CHAR_BIT * sizeof(T))) || ((length * width) > bits_available))
+      {
+        bits_available_in_char = saved_bits_available_in_char;
+        char_index             = saved_char_index;
+        bits_available         = saved_bits_available;
+
+        return false;
+      }
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        const unsigned_t offset = (width != 0U) ? read_unchecked<unsigned_t>(width) : unsigned_t(0U);
+
+        start[i] = static_cast<T>(static_cast<unsigned_t>(static_cast<unsigned_t>(minimum) + offset));
+      }
+
+      return true;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes in the stream buffer.
     //***************************************************************************
@@ -1267,15 +1428,25 @@ namespace etl
       T value = 0;
       uint_least8_t bits = nbits;
 
-      // Get the bits from the stream.
-      while (nbits != 0)
+#if ETL_USING_64BIT_TYPES && (CHAR_BIT == 8)
+      // Do the used bits of the current char and the requested bits fit in one accumulator?
+      if ((nbits != 0U) && ((nbits + (CHAR_BIT - bits_available_in_char)) <= 64))
+      {
+        value = static_cast<T>(read_accumulated(nbits));
+      }
+      else
+#endif
       {
-        unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
+        // Get the bits from the stream.
+        while (nbits != 0)
+        {
+          unsigned char mask_width = static_cast<unsigned char>(etl::min(nbits, bits_available_in_char));
 
-        T chunk = get_chunk(mask_width);
+          T chunk = get_chunk(mask_width);
 
-        nbits -= mask_width;
-        value |= static_cast<T>(chunk << nbits);
+          nbits -= mask_width;
+          value |= static_cast<T>(chunk << nbits);
+        }
       }
 
       if (stream_endianness == etl::endian::little)
@@ -1292,6 +1463,39 @@ namespace etl
       return value;
     }
 
+#if ETL_USING_64BIT_TYPES && (CHAR_BIT == 8)
+    //***************************************************************************
+    /// Read up to 64 bits, less the used bits of the current char, in one step.
+    /// A whole 64 bit word is loaded from the current char, if the stream is
+    /// long enough, otherwise just the chars that the bits occupy. The bits are
+    /// then extracted with a single shift pair.
+    //***************************************************************************
+    uint64_t read_accumulated(uint_least8_t nbits)
+    {
+      const uint_least8_t used_bits  = static_cast<uint_least8_t>(CHAR_BIT - bits_available_in_char);
+      const uint_least8_t total_bits = static_cast<uint_least8_t>(used_bits + nbits);
+
+      const size_t n_chars = ((char_index + 8U) <= length_chars) ? 8U : (total_bits + CHAR_BIT - 1U) / CHAR_BIT;
+
+      const unsigned char* p = reinterpret_cast<const unsigned char*>(pdata + char_index);
+
+      uint64_t accumulator = 0U;
+
+      for (size_t i = 0U; i < n_chars; ++i)
+      {
+        accumulator = (accumulator << CHAR_BIT) | p[i];
+      }
+
+      accumulator <<= (CHAR_BIT * (8U - n_chars));
+
+      char_index             += total_bits / CHAR_BIT;
+      bits_available_in_char  = static_cast<unsigned char>(CHAR_BIT - (total_bits % CHAR_BIT));
+      bits_available         -= nbits;
+
+      return (accumulator << used_bits) >> (64U - nbits);
+    }
+#endif
+
     //***************************************************************************
     /// Get a data chunk from the stream
     //***************************************************************************
@@ -38,6 +38,9 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "algorithm.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -184,7 +187,668 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
-}
 
+  namespace private_bloom_filter
+  {
+    //*************************************************************************
+    /// Folds a hash result to 32 bits.
+    //*************************************************************************
+    inline uint32_t fold_hash(size_t hash)
+    {
+      // Two shifts so that the upper half is zero for 32 bit size_t.
+      return static_cast<uint32_t>(hash) ^ static_cast<uint32_t>((hash >> 16U) >> 16U);
+    }
+
+    //*************************************************************************
+    /// Mixes the bits of a 32 bit hash. The MurmurHash3 finaliser.
+    //*************************************************************************
+    inline uint32_t mix_hash(uint32_t h)
+    {
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return h;
+    }
+
+    //*************************************************************************
+    /// The smallest power of 2 that is not less than N.
+    //*************************************************************************
+    template <size_t N>
+    struct power_of_2_not_less_than
+    {
+      enum value_type
+      {
+        value = (N <= 1U) ? 1 : etl::power_of_2_round_up<N>::value
+      };
+    };
+  }
+
+  //***************************************************************************
+  /// A cache blocked Bloom filter.
+  /// All of the bits for a key are set in one 64 byte block, so each add or
+  /// exists touches a single cache line.
+  /// Uses one hash, from which Hash_Count bit positions are derived.
+  ///\tparam DESIRED_WIDTH The desired number of bits. Rounded up to a power of 2 number of blocks.
+  ///\tparam THash         The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam Hash_Count    The number of bits set per key. 1 to 16.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t DESIRED_WIDTH, typename THash, size_t Hash_Count = 3U>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((Hash_Count >= 1U) && (Hash_Count <= 16U), "Hash_Count must be 1 to 16");
+
+    enum
+    {
+      BLOCK_BITS  = 512,
+      BLOCK_COUNT = private_bloom_filter::power_of_2_not_less_than<(DESIRED_WIDTH + 511U) / 512U>::value,
+      WIDTH       = BLOCK_COUNT * BLOCK_BITS
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t block = 0U; block < BLOCK_COUNT; ++block)
+      {
+        etl::fill_n(blocks[block].word, size_t(Words_Per_Block), uint32_t(0U));
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      uint32_t* word;
+      uint32_t  position;
+      uint32_t  step;
+
+      locate(key, word, position, step);
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        word[position >> 5U] |= uint32_t(1U) << (position & 31U);
+        position = (position + step) & (BLOCK_BITS - 1U);
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      uint32_t* word;
+      uint32_t  position;
+      uint32_t  step;
+
+      locate(key, word, position, step);
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        if ((word[position >> 5U] & (uint32_t(1U) << (position & 31U))) == 0U)
+        {
+          return false;
+        }
+
+        position = (position + step) & (BLOCK_BITS - 1U);
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t block = 0U; block < BLOCK_COUNT; ++block)
+      {
+        for (size_t i = 0U; i < Words_Per_Block; ++i)
+        {
+          n += etl::count_bits(blocks[block].word[i]);
+        }
+      }
+
+      return n;
+    }
+
+  private:
+
+    enum
+    {
+      Words_Per_Block = BLOCK_BITS / 32,
+      Block_Shift     = 32 - etl::log2<BLOCK_COUNT>::value
+    };
+
+    //***************************************************************************
+    /// Finds the block, the first bit position and the position step for a key.
+    //***************************************************************************
+    void locate(parameter_t key, uint32_t*& word, uint32_t& position, uint32_t& step) const
+    {
+      const uint32_t h1 = private_bloom_filter::mix_hash(private_bloom_filter::fold_hash(THash()(key)));
+      const uint32_t h2 = private_bloom_filter::mix_hash(h1 + 0x9E3779B9UL);
+
+      // The block from the upper bits, the bit positions from the second hash.
+      const size_t block = (BLOCK_COUNT == 1) ? 0U : static_cast<size_t>(h1 >> Block_Shift);
+
+      word     = const_cast<uint32_t*>(blocks[block].word);
+      position = h2 & (BLOCK_BITS - 1U);
+      step     = (h2 >> 16U) | 1U; // Odd, so the positions are distinct.
+    }
+
+    /// One cache line of flags.
+    struct block_type
+    {
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+      alignas(64) uint32_t word[Words_Per_Block];
+#else
+      uint32_t word[Words_Per_Block];
 #endif
+    };
+
+    /// The Bloom filter blocks.
+    block_type blocks[BLOCK_COUNT];
+  };
+
+  //***************************************************************************
+  /// A counting Bloom filter.
+  /// Each position is a saturating counter, so keys may be removed.
+  /// A counter that has saturated is never decremented.
+  /// Uses one hash, from which Hash_Count positions are derived.
+  ///\tparam DESIRED_WIDTH The desired number of counters. Rounded up to a power of 2.
+  ///\tparam THash         The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam Hash_Count    The number of counters incremented per key.
+  ///\tparam TCounter      The unsigned counter type.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t DESIRED_WIDTH, typename THash, size_t Hash_Count = 3U, typename TCounter = uint8_t>
+  class counting_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    enum
+    {
+      WIDTH = private_bloom_filter::power_of_2_not_less_than<DESIRED_WIDTH>::value
+    };
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TCounter>::value, "TCounter must be unsigned");
+    ETL_STATIC_ASSERT((Hash_Count >= 1U) && (Hash_Count <= size_t(WIDTH)), "Hash_Count must be 1 to WIDTH");
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    counting_bloom_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      etl::fill_n(counters, size_t(WIDTH), TCounter(0U));
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      uint32_t position;
+      uint32_t step;
+
+      locate(key, position, step);
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        TCounter& counter = counters[position];
+
+        if (counter != etl::integral_limits<TCounter>::max)
+        {
+          ++counter;
+        }
+
+        position = (position + step) & (WIDTH - 1U);
+      }
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that have been added should be removed.
+    ///\param  key The key to remove.
+    ///\return <b>true</b> if the key existed in the filter.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      if (!exists(key))
+      {
+        return false;
+      }
+
+      uint32_t position;
+      uint32_t step;
+
+      locate(key, position, step);
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        TCounter& counter = counters[position];
 
+        if (counter != etl::integral_limits<TCounter>::max)
+        {
+          --counter;
+        }
+
+        position = (position + step) & (WIDTH - 1U);
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      uint32_t position;
+      uint32_t step;
+
+      locate(key, position, step);
+
+      for (size_t i = 0U; i < Hash_Count; ++i)
+      {
+        if (counters[position] == TCounter(0U))
+        {
+          return false;
+        }
+
+        position = (position + step) & (WIDTH - 1U);
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * count()) / WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of non-zero counters.
+    //***************************************************************************
+    size_t count() const
+    {
+      return WIDTH - static_cast<size_t>(etl::count(counters, counters + WIDTH, TCounter(0U)));
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Finds the first position and the position step for a key.
+    //***************************************************************************
+    void locate(parameter_t key, uint32_t& position, uint32_t& step) const
+    {
+      const uint32_t h1 = private_bloom_filter::mix_hash(private_bloom_filter::fold_hash(THash()(key)));
+      const uint32_t h2 = private_bloom_filter::mix_hash(h1 + 0x9E3779B9UL);
+
+      position = h1 & (WIDTH - 1U);
+      step     = h2 | 1U; // Odd, so the positions are distinct.
+    }
+
+    /// The Bloom filter counters.
+    TCounter counters[WIDTH];
+  };
+
+  //***************************************************************************
+  /// A fixed capacity cuckoo filter.
+  /// Stores a fingerprint of each key in one of two candidate buckets, which
+  /// allows removal and gives a lower false positive rate than a Bloom filter
+  /// of the same size. A single victim slot holds the last fingerprint that
+  /// could not be placed; while it is occupied, add fails.
+  ///\tparam Capacity    The number of keys to hold. The buckets are sized for a 95% load.
+  ///\tparam THash       The hash generator class. Must define <b>argument_type</b>.
+  ///\tparam TFingerprint The unsigned fingerprint type.
+  ///\tparam Bucket_Size The number of fingerprints per bucket.
+  ///\tparam Max_Kicks   The number of relocations tried before an add overflows to the victim slot.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <size_t Capacity, typename THash, typename TFingerprint = uint16_t, size_t Bucket_Size = 4U, size_t Max_Kicks = 500U>
+  class cuckoo_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TFingerprint>::value, "TFingerprint must be unsigned");
+    ETL_STATIC_ASSERT(Bucket_Size >= 1U, "Bucket_Size must be at least 1");
+
+    enum
+    {
+      BUCKET_COUNT = private_bloom_filter::power_of_2_not_less_than<((((Capacity * 100U) + 94U) / 95U) + Bucket_Size - 1U) / Bucket_Size>::value,
+      SLOT_COUNT   = BUCKET_COUNT * Bucket_Size
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    cuckoo_filter()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t bucket = 0U; bucket < BUCKET_COUNT; ++bucket)
+      {
+        etl::fill_n(buckets[bucket], Bucket_Size, TFingerprint(0U));
+      }
+
+      victim_index       = 0U;
+      victim_fingerprint = TFingerprint(0U);
+      item_count         = 0U;
+      random             = 0x2545F491UL;
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param  key The key to add.
+    ///\return <b>true</b> if the key was added, <b>false</b> if the filter is full.
+    //***************************************************************************
+    bool add(parameter_t key)
+    {
+      if (victim_fingerprint != TFingerprint(0U))
+      {
+        return false;
+      }
+
+      size_t       index1;
+      size_t       index2;
+      TFingerprint fingerprint;
+
+      locate(key, index1, index2, fingerprint);
+
+      ++item_count;
+
+      if (insert(index1, fingerprint) || insert(index2, fingerprint))
+      {
+        return true;
+      }
+
+      // Relocate existing fingerprints to their alternate buckets.
+      size_t index = ((next_random() & 1U) == 0U) ? index1 : index2;
+
+      for (size_t kick = 0U; kick < Max_Kicks; ++kick)
+      {
+        TFingerprint& slot = buckets[index][next_random() % Bucket_Size];
+
+        const TFingerprint evicted = slot;
+        slot        = fingerprint;
+        fingerprint = evicted;
+        index       = alternate_index(index, fingerprint);
+
+        if (insert(index, fingerprint))
+        {
+          return true;
+        }
+      }
+
+      victim_index       = index;
+      victim_fingerprint = fingerprint;
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Removes a key from the filter.
+    /// Only keys that have been added should be removed.
+    ///\param  key The key to remove.
+    ///\return <b>true</b> if the key existed in the filter.
+    //***************************************************************************
+    bool remove(parameter_t key)
+    {
+      size_t       index1;
+      size_t       index2;
+      TFingerprint fingerprint;
+
+      locate(key, index1, index2, fingerprint);
+
+      if (erase(index1, fingerprint) || erase(index2, fingerprint))
+      {
+        --item_count;
+
+        // There is now room for the victim.
+        if (victim_fingerprint != TFingerprint(0U))
+        {
+          const TFingerprint victim = victim_fingerprint;
+          victim_fingerprint = TFingerprint(0U);
+
+          if (!insert(victim_index, victim) && !insert(alternate_index(victim_index, victim), victim))
+          {
+            victim_fingerprint = victim;
+          }
+        }
+
+        return true;
+      }
+
+      if (is_victim(index1, index2, fingerprint))
+      {
+        --item_count;
+        victim_fingerprint = TFingerprint(0U);
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      size_t       index1;
+      size_t       index2;
+      TFingerprint fingerprint;
+
+      locate(key, index1, index2, fingerprint);
+
+      return contains(index1, fingerprint) || contains(index2, fingerprint) || is_victim(index1, index2, fingerprint);
+    }
+
+    //***************************************************************************
+    /// Returns the number of keys in the filter.
+    //***************************************************************************
+    size_t size() const
+    {
+      return item_count;
+    }
+
+    //***************************************************************************
+    /// Returns the number of fingerprint slots.
+    //***************************************************************************
+    size_t max_size() const
+    {
+      return SLOT_COUNT;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter is empty.
+    //***************************************************************************
+    bool empty() const
+    {
+      return item_count == 0U;
+    }
+
+    //***************************************************************************
+    /// Returns <b>true</b> if the filter can accept no more keys.
+    //***************************************************************************
+    bool full() const
+    {
+      return victim_fingerprint != TFingerprint(0U);
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return (100 * item_count) / SLOT_COUNT;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Finds the candidate buckets and the fingerprint for a key.
+    /// A fingerprint of zero marks an empty slot, so is never generated.
+    //***************************************************************************
+    void locate(parameter_t key, size_t& index1, size_t& index2, TFingerprint& fingerprint) const
+    {
+      const uint32_t h = private_bloom_filter::mix_hash(private_bloom_filter::fold_hash(THash()(key)));
+
+      fingerprint = static_cast<TFingerprint>(private_bloom_filter::mix_hash(h + 0x9E3779B9UL));
+
+      if (fingerprint == TFingerprint(0U))
+      {
+        fingerprint = TFingerprint(1U);
+      }
+
+      index1 = static_cast<size_t>(h & (BUCKET_COUNT - 1U));
+      index2 = alternate_index(index1, fingerprint);
+    }
+
+    //***************************************************************************
+    /// The other candidate bucket for a fingerprint.
+    //***************************************************************************
+    static size_t alternate_index(size_t index, TFingerprint fingerprint)
+    {
+      return (index ^ static_cast<size_t>(private_bloom_filter::mix_hash(uint32_t(fingerprint)))) & (BUCKET_COUNT - 1U);
+    }
+
+    //***************************************************************************
+    bool insert(size_t index, TFingerprint fingerprint)
+    {
+      TFingerprint* p_slot = etl::find(buckets[index], buckets[index] + Bucket_Size, TFingerprint(0U));
+
+      if (p_slot != (buckets[index] + Bucket_Size))
+      {
+        *p_slot = fingerprint;
+        return true;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    bool erase(size_t index, TFingerprint fingerprint)
+    {
+      TFingerprint* p_slot = etl::find(buckets[index], buckets[index] + Bucket_Size, fingerprint);
+
+      if (p_slot != (buckets[index] + Bucket_Size))
+      {
+        *p_slot = TFingerprint(0U);
+        return true;
+      }
+
+      return false;
+    }
+
+    //***************************************************************************
+    bool contains(size_t index, TFingerprint fingerprint) const
+    {
+      return etl::find(buckets[index], buckets[index] + Bucket_Size, fingerprint) != (buckets[index] + Bucket_Size);
+    }
+
+    //***************************************************************************
+    bool is_victim(size_t index1, size_t index2, TFingerprint fingerprint) const
+    {
+      return (victim_fingerprint == fingerprint) && ((victim_index == index1) || (victim_index == index2));
+    }
+
+    //***************************************************************************
+    /// xorshift32, for choosing the fingerprints to relocate.
+    //***************************************************************************
+    uint32_t next_random()
+    {
+      random ^= random << 13U;
+      random ^= random >> 17U;
+      random ^= random << 5U;
+
+      return random;
+    }
+
+    TFingerprint buckets[BUCKET_COUNT][Bucket_Size];
+    size_t       victim_index;
+    TFingerprint victim_fingerprint;
+    size_t       item_count;
+    uint32_t     random;
+  };
+}
+
+#endif
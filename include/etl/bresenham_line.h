@@ -63,6 +63,42 @@ namespace etl
     typedef value_type*           pointer;
     typedef const value_type*     const_pointer;
 
+    //***************************************************
+    /// A run of consecutive points along the major axis.
+    /// Horizontal when the line is x major, otherwise vertical.
+    /// 'first' and 'last' are in line order.
+    //***************************************************
+    struct run_type
+    {
+      value_type first;
+      value_type last;
+
+      //*********************************
+      /// The number of points in the run.
+      //*********************************
+      size_t length() const
+      {
+        return (first.y == last.y) ? distance(first.x, last.x) + 1U
+                                   : distance(first.y, last.y) + 1U;
+      }
+
+      //*********************************
+      /// Checks whether the run is horizontal.
+      /// A run of one point is reported as horizontal.
+      //*********************************
+      bool is_horizontal() const
+      {
+        return first.y == last.y;
+      }
+
+    private:
+
+      static size_t distance(T a, T b)
+      {
+        return (b < a) ? size_t(a - b) : size_t(b - a);
+      }
+    };
+
     //***************************************************
     /// Const Iterator
     //***************************************************
@@ -146,12 +182,12 @@ namespace etl
       //***************************************************
       /// Constructor for use by bresenham_line
       //***************************************************
-      const_iterator(bresenham_line<T>* pb)
+      const_iterator(bresenham_line* pb)
         : p_bresenham_line(pb)
       {
       }
 
-      bresenham_line<T>* p_bresenham_line;
+      bresenham_line* p_bresenham_line;
     };
 
     //***************************************************
@@ -204,7 +240,9 @@ namespace etl
     //***************************************************
     const_iterator begin()
     {
-      coordinate = first;
+      coordinate         = first;
+      balance            = initial_balance;
+      do_minor_increment = (dx == dy);
 
       return const_iterator(this);
     }
@@ -248,6 +286,180 @@ namespace etl
       }
     }
 
+    //***************************************************
+    /// Calls 'function' with each point on the line, in order.
+    /// Horizontal, vertical and 45 degree lines are handled without the
+    /// error term.
+    /// Does not change the iteration state.
+    //***************************************************
+    template <typename TFunction>
+    TFunction for_each(TFunction function) const
+    {
+      const size_t n = size();
+      value_type   c = first;
+
+      if (dy == 0)
+      {
+        // Horizontal.
+        for (size_t i = 0U; i < n; ++i, c.x = T(c.x + x_increment))
+        {
+          function(c);
+        }
+      }
+      else if (dx == 0)
+      {
+        // Vertical.
+        for (size_t i = 0U; i < n; ++i, c.y = T(c.y + y_increment))
+        {
+          function(c);
+        }
+      }
+      else if (dx == dy)
+      {
+        // 45 degrees.
+        for (size_t i = 0U; i < n; ++i, c.x = T(c.x + x_increment), c.y = T(c.y + y_increment))
+        {
+          function(c);
+        }
+      }
+      else if (y_is_major_axis())
+      {
+        for_each_point(function, &value_type::y, &value_type::x, y_increment, x_increment, dy, dx);
+      }
+      else
+      {
+        for_each_point(function, &value_type::x, &value_type::y, x_increment, y_increment, dx, dy);
+      }
+
+      return function;
+    }
+
+    //***************************************************
+    /// Calls 'function' with each run of consecutive points along the major
+    /// axis, as a const run_type&, in order.
+    /// Allows a display driver to draw a line with bulk horizontal or
+    /// vertical pixel writes.
+    /// Does not change the iteration state.
+    //***************************************************
+    template <typename TFunction>
+    TFunction for_each_run(TFunction function) const
+    {
+      if ((dy == 0) || (dx == 0))
+      {
+        // Horizontal or vertical, so just one run.
+        run_type run = { first, last };
+        function(static_cast<const run_type&>(run));
+      }
+      else if (dx == dy)
+      {
+        // 45 degrees, so every point is a run.
+        const size_t n = size();
+        value_type   c = first;
+
+        for (size_t i = 0U; i < n; ++i, c.x = T(c.x + x_increment), c.y = T(c.y + y_increment))
+        {
+          run_type run = { c, c };
+          function(static_cast<const run_type&>(run));
+        }
+      }
+      else if (y_is_major_axis())
+      {
+        for_each_run(function, &value_type::y, &value_type::x, y_increment, x_increment, dy, dx);
+      }
+      else
+      {
+        for_each_run(function, &value_type::x, &value_type::y, x_increment, y_increment, dx, dy);
+      }
+
+      return function;
+    }
+
+    //***************************************************
+    /// Clips the line to the rectangle 'minimum' to 'maximum' inclusive, using
+    /// the Cohen-Sutherland algorithm, and resets it to the clipped end points.
+    /// Returns false, and leaves the line unchanged, if no part of the line is
+    /// inside the rectangle.
+    /// The points of a clipped line may differ by one on the minor axis from
+    /// those of the unclipped line.
+    //***************************************************
+    bool clip(etl::coordinate_2d<T> minimum, etl::coordinate_2d<T> maximum)
+    {
+      return clip(minimum.x, minimum.y, maximum.x, maximum.y);
+    }
+
+    //***************************************************
+    /// Clips the line to the rectangle 'x_min,y_min' to 'x_max,y_max' inclusive.
+    /// Returns false, and leaves the line unchanged, if no part of the line is
+    /// inside the rectangle.
+    //***************************************************
+    bool clip(T x_min, T y_min, T x_max, T y_max)
+    {
+      clip_t x0 = clip_t(first.x);
+      clip_t y0 = clip_t(first.y);
+      clip_t x1 = clip_t(last.x);
+      clip_t y1 = clip_t(last.y);
+
+      const clip_t left   = clip_t(x_min);
+      const clip_t bottom = clip_t(y_min);
+      const clip_t right  = clip_t(x_max);
+      const clip_t top    = clip_t(y_max);
+
+      int code0 = outcode(x0, y0, left, bottom, right, top);
+      int code1 = outcode(x1, y1, left, bottom, right, top);
+
+      while ((code0 | code1) != Inside)
+      {
+        if ((code0 & code1) != Inside)
+        {
+          // Both end points are on the same outside side.
+          return false;
+        }
+
+        const int code = (code0 != Inside) ? code0 : code1;
+
+        clip_t x;
+        clip_t y;
+
+        if ((code & Above) != 0)
+        {
+          x = x0 + divide_rounded((x1 - x0) * (top - y0), y1 - y0);
+          y = top;
+        }
+        else if ((code & Below) != 0)
+        {
+          x = x0 + divide_rounded((x1 - x0) * (bottom - y0), y1 - y0);
+          y = bottom;
+        }
+        else if ((code & Right) != 0)
+        {
+          y = y0 + divide_rounded((y1 - y0) * (right - x0), x1 - x0);
+          x = right;
+        }
+        else
+        {
+          y = y0 + divide_rounded((y1 - y0) * (left - x0), x1 - x0);
+          x = left;
+        }
+
+        if (code == code0)
+        {
+          x0    = x;
+          y0    = y;
+          code0 = outcode(x0, y0, left, bottom, right, top);
+        }
+        else
+        {
+          x1    = x;
+          y1    = y;
+          code1 = outcode(x1, y1, left, bottom, right, top);
+        }
+      }
+
+      initialise(T(x0), T(y0), T(x1), T(y1));
+
+      return true;
+    }
+
     //***************************************************
     /// Equality operator
     //***************************************************
@@ -266,8 +478,10 @@ namespace etl
 
   private:
 
+    typedef TWork work_t;
+
     //***************************************************
-    /// Get the current number of generated points.
+    /// Initialises the line from the first and last coordinates.
     //***************************************************
     void initialise(T first_x, T first_y, T last_x, T last_y)
     {
@@ -278,7 +492,6 @@ namespace etl
       y_increment        = (last_y < first_y) ? -1 : 1;
       dx                 = (last_x < first_x) ? first_x - last_x : last_x - first_x;
       dy                 = (last_y < first_y) ? first_y - last_y : last_y - first_y;
-      do_minor_increment = false;
 
       if (y_is_major_axis())
       {
@@ -292,6 +505,10 @@ namespace etl
         balance = dy - dx;
         dx *= 2;
       }
+
+      // A 45 degree line steps on both axes every time.
+      do_minor_increment = (dx == dy);
+      initial_balance    = balance;
     }
 
     //***************************************************
@@ -343,7 +560,139 @@ namespace etl
       return coordinate;
     }
 
-    typedef TWork work_t;
+    //***************************************************
+    /// Calls 'function' for each point, stepping along the 'major' member.
+    //***************************************************
+    template <typename TFunction>
+    void for_each_point(TFunction& function, T value_type::* major, T value_type::* minor,
+                        work_t major_increment, work_t minor_increment, work_t d_major, work_t d_minor) const
+    {
+      const size_t n = size();
+      value_type   c = first;
+      work_t       error = initial_balance;
+      bool         step_minor = false;
+
+      function(c);
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        if (step_minor)
+        {
+          c.*minor = T(c.*minor + minor_increment);
+          error -= d_major;
+        }
+
+        c.*major = T(c.*major + major_increment);
+        error += d_minor;
+        step_minor = (error >= 0);
+
+        function(c);
+      }
+    }
+
+    //***************************************************
+    /// Calls 'function' for each run, stepping along the 'major' member.
+    /// A run ends just before each step on the minor axis.
+    //***************************************************
+    template <typename TFunction>
+    void for_each_run(TFunction& function, T value_type::* major, T value_type::* minor,
+                      work_t major_increment, work_t minor_increment, work_t d_major, work_t d_minor) const
+    {
+      const size_t n = size();
+      run_type     run = { first, first };
+      work_t       error = initial_balance;
+      bool         step_minor = false;
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        if (step_minor)
+        {
+          function(static_cast<const run_type&>(run));
+
+          run.last.*minor = T(run.last.*minor + minor_increment);
+          error -= d_major;
+        }
+
+        run.last.*major = T(run.last.*major + major_increment);
+        error += d_minor;
+
+        if (step_minor)
+        {
+          run.first = run.last;
+        }
+
+        step_minor = (error >= 0);
+      }
+
+      function(static_cast<const run_type&>(run));
+    }
+
+    //***************************************************
+    /// Cohen-Sutherland region codes.
+    //***************************************************
+    enum
+    {
+      Inside = 0,
+      Left   = 1,
+      Right  = 2,
+      Below  = 4,
+      Above  = 8
+    };
+
+#if ETL_USING_64BIT_TYPES
+    typedef int64_t clip_t;
+#else
+    typedef int32_t clip_t;
+#endif
+
+    //***************************************************
+    /// Gets the region code of a point.
+    //***************************************************
+    static int outcode(clip_t x, clip_t y, clip_t left, clip_t bottom, clip_t right, clip_t top)
+    {
+      int code = Inside;
+
+      if (x < left)
+      {
+        code |= Left;
+      }
+      else if (x > right)
+      {
+        code |= Right;
+      }
+
+      if (y < bottom)
+      {
+        code |= Below;
+      }
+      else if (y > top)
+      {
+        code |= Above;
+      }
+
+      return code;
+    }
+
+    //***************************************************
+    /// Divides, rounding to the nearest integer.
+    //***************************************************
+    static clip_t divide_rounded(clip_t numerator, clip_t denominator)
+    {
+      if (denominator < 0)
+      {
+        numerator   = -numerator;
+        denominator = -denominator;
+      }
+
+      if (numerator < 0)
+      {
+        return -((denominator / 2 - numerator) / denominator);
+      }
+      else
+      {
+        return (numerator + denominator / 2) / denominator;
+      }
+    }
 
     value_type first;
     value_type last;
@@ -353,6 +702,7 @@ namespace etl
     work_t     dx;
     work_t     dy;
     work_t     balance;
+    work_t     initial_balance;
     bool       do_minor_increment;
   };
 }
@@ -0,0 +1,902 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BTREE_SET_INCLUDED
+#define ETL_BTREE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "initializer_list.h"
+
+#include "private/btree.h"
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup btree_set btree_set
+/// A set with the capacity defined at compile time, stored as a B+tree.
+/// The values are held in sorted arrays of up to VNode_Size elements, so
+/// lookups and iteration touch far fewer cache lines than a node per value
+/// red/black tree such as etl::set.
+/// Insertion and erasure may move values, so they invalidate iterators,
+/// pointers and references to the elements.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_exception : public etl::exception
+  {
+  public:
+
+    btree_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the btree_set.
+  ///\ingroup btree_set
+  //***************************************************************************
+  class btree_set_full : public etl::btree_set_exception
+  {
+  public:
+
+    btree_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::btree_set_exception(ETL_ERROR_TEXT("btree_set:full", ETL_BTREE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A templated base for all etl::btree_set types.
+  ///\tparam VNode_Size The maximum number of values or keys in a node.
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey>, size_t VNode_Size = 16U>
+  class ibtree_set : public etl::private_btree::btree<TKey, TKey, etl::private_btree::set_key_of<TKey>, TKeyCompare, VNode_Size>
+  {
+  private:
+
+    typedef etl::private_btree::btree<TKey, TKey, etl::private_btree::set_key_of<TKey>, TKeyCompare, VNode_Size> base_t;
+
+  protected:
+
+    typedef typename base_t::path      path;
+    typedef typename base_t::leaf_node leaf_node;
+
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&   const_key_reference;
+
+    typedef typename base_t::iterator                     iterator;
+    typedef typename base_t::const_iterator               const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>        reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator>  const_reverse_iterator;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    iterator begin()
+    {
+      return this->begin_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return this->begin_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    iterator end()
+    {
+      return this->end_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return this->end_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return this->begin_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return this->end_iterator();
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the list.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the list.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*********************************************************************
+    /// Assigns values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      this->clear_all();
+    }
+
+    //*********************************************************************
+    /// Counts the number of elements that contain the key specified.
+    ///\param key The key to search for.
+    ///\return 1 if element was found, 0 otherwise.
+    //*********************************************************************
+    size_type count(const_key_reference key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type count(const K& key) const
+    {
+      return (find(key) == end()) ? 0U : 1U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns two iterators with bounding (lower bound, upper bound) the key
+    /// provided
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      return ETL_OR_STD::make_pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns two const iterators with bounding (lower bound, upper bound)
+    /// the key provided.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::make_pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the value at the specified position.
+    ///\return An iterator to the value that followed the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const key_type key(base_t::key_at(position));
+
+      erase(key);
+
+      return lower_bound(key);
+    }
+
+    //*************************************************************************
+    // Erase the key specified.
+    //*************************************************************************
+    size_type erase(const_key_reference key)
+    {
+      path       route;
+      leaf_node* p_leaf;
+      size_t     index;
+
+      if (this->locate(key, route, p_leaf, index))
+      {
+        this->erase_at(route, p_leaf, index);
+        return 1U;
+      }
+
+      return 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_type erase(K&& key)
+    {
+      const_iterator i_element = find(key);
+
+      if (i_element == end())
+      {
+        return 0U;
+      }
+
+      const key_type found(base_t::key_at(i_element));
+
+      return erase(found);
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      if (last == cend())
+      {
+        while (first != cend())
+        {
+          first = erase(first);
+        }
+
+        return end();
+      }
+
+      // Erasing may move the values, so stop at the key rather than the position.
+      const key_type last_key(base_t::key_at(last));
+
+      iterator i_element = lower_bound(base_t::key_at(first));
+
+      while ((i_element != end()) && this->compare(base_t::key_at(i_element), last_key))
+      {
+        i_element = erase(i_element);
+      }
+
+      return i_element;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return this->find_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& k)
+    {
+      return this->find_iterator(k);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return this->find_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& k) const
+    {
+      return this->find_iterator(k);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      path       route;
+      leaf_node* p_leaf;
+      size_t     index;
+
+      if (this->locate(value, route, p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_set_full), ETL_OR_STD::make_pair(end(), false));
+
+      this->open_slot(value, route, p_leaf, index);
+      ::new (&p_leaf->values[index]) value_type(value);
+
+      return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference value)
+    {
+      path       route;
+      leaf_node* p_leaf;
+      size_t     index;
+
+      if (this->locate(value, route, p_leaf, index))
+      {
+        return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!this->full(), ETL_ERROR(btree_set_full), ETL_OR_STD::make_pair(end(), false));
+
+      this->open_slot(value, route, p_leaf, index);
+      ::new (&p_leaf->values[index]) value_type(etl::move(value));
+
+      return ETL_OR_STD::make_pair(iterator(*this, p_leaf, index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// The position hint is ignored.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the set.
+    /// The position hint is ignored.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set is already full.
+    ///\param position The position that would precede the value to insert.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator /*position*/, rvalue_reference value)
+    {
+      return insert(etl::move(value)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the set.
+    /// If asserts or exceptions are enabled, emits btree_set_full if the set does not have enough free space.
+    ///\param position The position to insert at.
+    ///\param first    The first element to add.
+    ///\param last     The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go before the key provided or end()
+    /// if all keys are considered to go before the key provided.
+    ///\return An iterator pointing to the element not before key or end()
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return this->lower_bound_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return this->lower_bound_iterator(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go before the key provided
+    /// or end() if all keys are considered to go before the key provided.
+    ///\return An const_iterator pointing to the element not before key or end()
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return this->lower_bound_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return this->lower_bound_iterator(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns an iterator pointing to the first element in the container
+    /// whose key is not considered to go after the key provided or end()
+    /// if all keys are considered to go after the key provided.
+    ///\return An iterator pointing to the element after key or end()
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return this->upper_bound_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return this->upper_bound_iterator(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const_iterator pointing to the first element in the
+    /// container whose key is not considered to go after the key provided
+    /// or end() if all keys are considered to go after the key provided.
+    ///\return An const_iterator pointing to the element after key or end()
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return this->upper_bound_iterator(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return this->upper_bound_iterator(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (const ibtree_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ibtree_set& operator = (ibtree_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        this->clear();
+
+        iterator from = rhs.begin();
+
+        while (from != rhs.end())
+        {
+          this->insert(etl::move(*from));
+          ++from;
+        }
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Check if the set contains the key.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& k) const
+    {
+      return find(k) != end();
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibtree_set(etl::ipool& leaf_pool, etl::ipool& internal_pool, size_t max_size_)
+      : base_t(leaf_pool, internal_pool, max_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    ibtree_set(const ibtree_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_BTREE_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ibtree_set()
+    {
+    }
+#else
+  protected:
+    ~ibtree_set()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated btree_set implementation that uses a fixed size buffer.
+  ///\tparam TKey        The key type.
+  ///\tparam MAX_SIZE_   The maximum number of elements that can be stored.
+  ///\tparam TCompare    The key comparison functor.
+  ///\tparam VNode_Size  The maximum number of values or keys in a node.
+  ///\ingroup btree_set
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey>, size_t VNode_Size = 16U>
+  class btree_set : public etl::ibtree_set<TKey, TCompare, VNode_Size>
+  {
+  private:
+
+    typedef etl::ibtree_set<TKey, TCompare, VNode_Size> base_t;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    btree_set()
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    btree_set(const btree_set& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    btree_set(btree_set&& other)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      typename base_t::iterator from = other.begin();
+
+      while (from != other.end())
+      {
+        this->insert(etl::move(*from));
+        ++from;
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    btree_set(TIterator first, TIterator last)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    btree_set(std::initializer_list<typename base_t::value_type> init)
+      : base_t(leaf_pool, internal_pool, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~btree_set()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    btree_set& operator = (const btree_set& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    btree_set& operator = (btree_set&& rhs)
+    {
+      base_t::operator =(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    // Every leaf but the root is at least half full, as is every internal node.
+    static ETL_CONSTANT size_t Max_Leaves   = (MAX_SIZE_ / base_t::Min_Node_Size) + 1U;
+    static ETL_CONSTANT size_t Max_Internal = ((Max_Leaves + base_t::Min_Node_Size) / base_t::Min_Node_Size) + 1U;
+
+    /// The pools of nodes used for the set.
+    etl::pool<typename base_t::leaf_node,     Max_Leaves>   leaf_pool;
+    etl::pool<typename base_t::internal_node, Max_Internal> internal_pool;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare, size_t VNode_Size>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TCompare, VNode_Size>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare, size_t VNode_Size>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TCompare, VNode_Size>::Max_Leaves;
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare, size_t VNode_Size>
+  ETL_CONSTANT size_t btree_set<TKey, MAX_SIZE_, TCompare, VNode_Size>::Max_Internal;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator ==(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup btree_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator !=(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// Less than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically less than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator <(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //*************************************************************************
+  /// Greater than operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically greater than the
+  /// second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator >(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //*************************************************************************
+  /// Less than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically less than or equal
+  /// to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator <=(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //*************************************************************************
+  /// Greater than or equal operator.
+  ///\param lhs Reference to the first btree_set.
+  ///\param rhs Reference to the second btree_set.
+  ///\return <b>true</b> if the first set is lexicographically greater than or
+  /// equal to the second, otherwise <b>false</b>.
+  //*************************************************************************
+  template <typename TKey, typename TKeyCompare, size_t VNode_Size>
+  bool operator >=(const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& lhs, const etl::ibtree_set<TKey, TKeyCompare, VNode_Size>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
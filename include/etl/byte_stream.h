@@ -45,12 +45,105 @@ SOFTWARE.
 #include "delegate.h"
 #include "exception.h"
 #include "error_handler.h"
+#include "binary.h"
+
+#include "private/byte_stream_simd.h"
 
 #include <stdint.h>
 #include <limits.h>
 
 namespace etl
 {
+  namespace private_byte_stream
+  {
+    //***************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each value if
+    /// the stream and platform endianness differ.
+    //***************************************************************************
+    template <size_t Size>
+    void copy_values(const char* source, char* destination, size_t n, bool reverse)
+    {
+      size_t i = 0U;
+
+      if (reverse && (Size != 1U))
+      {
+#if ETL_USING_BYTE_STREAM_SIMD
+        i = simd_reverse_bytes_copy<Size>(source, destination, n);
+#endif
+
+        for (; i < n; ++i)
+        {
+          etl::reverse_copy(source + (i * Size), source + ((i + 1U) * Size), destination + (i * Size));
+        }
+      }
+      else
+      {
+        etl::copy(source, source + (n * Size), destination);
+      }
+    }
+
+    //***************************************************************************
+    /// Maps a value to the unsigned value sent as a varint.
+    /// Signed values are zig-zag encoded.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+      to_varint_value(T value)
+    {
+      return etl::zigzag_encode(value);
+    }
+
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+      to_varint_value(T value)
+    {
+      return value;
+    }
+
+    //***************************************************************************
+    /// Maps a received varint value back to T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, T>::type
+      from_varint_value(typename etl::make_unsigned<T>::type value)
+    {
+      return static_cast<T>(etl::zigzag_decode(value));
+    }
+
+    //*********************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+      from_varint_value(T value)
+    {
+      return value;
+    }
+
+    //***************************************************************************
+    /// The number of bytes needed to send a uint32_t in the Stream VByte format.
+    //***************************************************************************
+    inline size_t stream_vbyte_length(uint32_t value)
+    {
+      return (value < 0x100UL) ? 1U : (value < 0x10000UL) ? 2U : (value < 0x1000000UL) ? 3U : 4U;
+    }
+
+    //***************************************************************************
+    /// The number of data bytes described by the Stream VByte control bytes
+    /// for 'length' values.
+    //***************************************************************************
+    inline size_t stream_vbyte_data_size(const unsigned char* control, size_t length)
+    {
+      size_t size = length;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        size += (control[i / 4U] >> (2U * (i % 4U))) & 0x03U;
+      }
+
+      return size;
+    }
+  }
+
   //***************************************************************************
   /// Encodes a byte stream.
   //***************************************************************************
@@ -181,13 +274,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const etl::span<T>& range)
     {
-      typename etl::span<T>::iterator itr = range.begin();
-
-      while (itr != range.end())
-      {
-        to_bytes(*itr);
-        ++itr;
-      }
+      to_bytes(range.begin(), range.size());
     }
 
     //***************************************************************************
@@ -214,11 +301,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, void>::type
       write_unchecked(const T* start, size_t length)
     {
-      while (length-- != 0U)
-      {
-        to_bytes(*start);
-        ++start;
-      }
+      to_bytes(start, length);
     }
 
     //***************************************************************************
@@ -238,6 +321,169 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Write an integral value as a LEB128 variable length integer.
+    /// Seven bits are sent per byte, least significant first, with the top bit
+    /// set on all but the last byte. Signed values are zig-zag encoded first.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, void>::type
+      write_varint_unchecked(T value)
+    {
+      typename etl::make_unsigned<T>::type u = private_byte_stream::to_varint_value(value);
+
+      size_t n = 0U;
+
+      while (u >= 0x80U)
+      {
+        pcurrent[n++] = static_cast<char>((u & 0x7FU) | 0x80U);
+        u >>= 7U;
+      }
+
+      pcurrent[n++] = static_cast<char>(u);
+
+      step(n);
+    }
+
+    //***************************************************************************
+    /// Write an integral value as a LEB128 variable length integer.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      write_varint(T value)
+    {
+      bool success = (varint_size(value) <= available_bytes());
+
+      if (success)
+      {
+        write_varint_unchecked(value);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Write a range of integral values as LEB128 variable length integers.
+    /// Nothing is written if there is not enough space for all of them.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, bool>::type
+      write_varint(const T* start, size_t length)
+    {
+      bool success = (varint_size(start, length) <= available_bytes());
+
+      if (success)
+      {
+        for (size_t i = 0U; i < length; ++i)
+        {
+          write_varint_unchecked(start[i]);
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// The number of bytes needed to write a value as a varint.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, size_t>::type
+      varint_size(T value)
+    {
+      typename etl::make_unsigned<T>::type u = private_byte_stream::to_varint_value(value);
+
+      size_t n = 1U;
+
+      while (u >= 0x80U)
+      {
+        u >>= 7U;
+        ++n;
+      }
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// The number of bytes needed to write a range of values as varints.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, size_t>::type
+      varint_size(const T* start, size_t length)
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        n += varint_size(start[i]);
+      }
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// Write a block of uint32_t in the Stream VByte format.
+    /// A control byte for each group of four values holds the byte length of
+    /// each value, less one, in two bits. The control bytes are followed by the
+    /// significant bytes of each value, least significant first.
+    /// The number of values is not written.
+    //***************************************************************************
+    void write_stream_vbyte_unchecked(const uint32_t* start, size_t length)
+    {
+      const size_t control_size = (length + 3U) / 4U;
+
+      unsigned char* control = reinterpret_cast<unsigned char*>(pcurrent);
+      unsigned char* data    = control + control_size;
+
+      etl::fill(control, data, 0U);
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        uint32_t value     = start[i];
+        const size_t bytes = private_byte_stream::stream_vbyte_length(value);
+
+        control[i / 4U] |= static_cast<unsigned char>((bytes - 1U) << (2U * (i % 4U)));
+
+        for (size_t b = 0U; b < bytes; ++b)
+        {
+          *data++ = static_cast<unsigned char>(value);
+          value >>= 8U;
+        }
+      }
+
+      step(static_cast<size_t>(etl::distance(control, data)));
+    }
+
+    //***************************************************************************
+    /// Write a block of uint32_t in the Stream VByte format.
+    /// Nothing is written if there is not enough space for the whole block.
+    //***************************************************************************
+    bool write_stream_vbyte(const uint32_t* start, size_t length)
+    {
+      bool success = (stream_vbyte_size(start, length) <= available_bytes());
+
+      if (success)
+      {
+        write_stream_vbyte_unchecked(start, length);
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// The number of bytes needed to write a block in the Stream VByte format.
+    //***************************************************************************
+    static size_t stream_vbyte_size(const uint32_t* start, size_t length)
+    {
+      size_t n = (length + 3U) / 4U;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        n += private_byte_stream::stream_vbyte_length(start[i]);
+      }
+
+      return n;
+    }
+
     //***************************************************************************
     /// Skip n items of T, if the total space is available.
     /// Returns <b>true</b> if the skip was possible.
@@ -456,6 +702,28 @@ namespace etl
       step(sizeof(T));
     }
 
+    //*********************************
+    template <typename T>
+    void to_bytes(const T* values, size_t n)
+    {
+      const etl::endian platform_endianness = etl::endianness::value();
+
+      private_byte_stream::copy_values<sizeof(T)>(reinterpret_cast<const char*>(values), pcurrent, n, stream_endianness != platform_endianness);
+
+      if (callback.is_valid())
+      {
+        // Step a value at a time, as if each had been written individually.
+        for (size_t i = 0U; i < n; ++i)
+        {
+          step(sizeof(T));
+        }
+      }
+      else
+      {
+        pcurrent += (n * sizeof(T));
+      }
+    }
+
     //*********************************
     void step(size_t n)
     {
@@ -635,12 +903,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(etl::span<T> range)
     {
-      typename etl::span<T>::iterator destination = range.begin();
-
-      while (destination != range.end())
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(range.begin(), range.size());
 
       return etl::span<const T>(range.begin(), range.end());
     }
@@ -668,12 +931,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::span<const T> >::type
       read_unchecked(T* start,  size_t length)
     {
-      T* destination = start;
-
-      for (size_t i = 0; i < length; ++i)
-      {
-        *destination++ = from_bytes<T>();
-      }
+      from_bytes(start, length);
 
       return etl::span<const T>(start, length);
     }
@@ -694,6 +952,148 @@ namespace etl
       return etl::optional<etl::span<const T> >();
     }
 
+    //***************************************************************************
+    /// Read a LEB128 variable length integer.
+    /// Signed values are zig-zag decoded.
+    /// Returns an empty optional, and does not move, if the stream ends before
+    /// the last byte of the value, or if the value has too many bytes for T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, etl::optional<T> >::type
+      read_varint()
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      etl::optional<T> result;
+
+      const char* p    = pcurrent;
+      const char* pend = pdata + length;
+
+      unsigned_t value = 0U;
+      size_t     shift = 0U;
+
+      while ((p != pend) && (shift < etl::integral_limits<unsigned_t>::bits))
+      {
+        const unsigned char c = static_cast<unsigned char>(*p++);
+
+        value |= static_cast<unsigned_t>(static_cast<unsigned_t>(c & 0x7FU) << shift);
+
+        if ((c & 0x80U) == 0U)
+        {
+          result   = private_byte_stream::from_varint_value<T>(value);
+          pcurrent = p;
+          break;
+        }
+
+        shift += 7U;
+      }
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Read a range of LEB128 variable length integers.
+    /// Returns an empty optional, and does not move, if they could not all be read.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<bool, T>::value, etl::optional<etl::span<const T> > >::type
+      read_varint(T* start, size_t length)
+    {
+      const char* const pstart = pcurrent;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        etl::optional<T> value = read_varint<T>();
+
+        if (!value.has_value())
+        {
+          pcurrent = pstart;
+          return etl::optional<etl::span<const T> >();
+        }
+
+        start[i] = value.value();
+      }
+
+      return etl::optional<etl::span<const T> >(etl::span<const T>(start, length));
+    }
+
+    //***************************************************************************
+    /// Read a block of 'length' uint32_t in the Stream VByte format.
+    /// Whole groups of four values are decoded a vector at a time, where supported.
+    /// Returns an empty optional, and does not move, if the block is incomplete.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_same<T, uint32_t>::value, etl::optional<etl::span<const T> > >::type
+      read_stream_vbyte(T* start, size_t length)
+    {
+      const size_t control_size = (length + 3U) / 4U;
+
+      if (available_bytes() < control_size)
+      {
+        return etl::optional<etl::span<const T> >();
+      }
+
+      const unsigned char* control   = reinterpret_cast<const unsigned char*>(pcurrent);
+      const unsigned char* data      = control + control_size;
+      const size_t         data_size = private_byte_stream::stream_vbyte_data_size(control, length);
+
+      if (available_bytes() < (control_size + data_size))
+      {
+        return etl::optional<etl::span<const T> >();
+      }
+
+      size_t i         = 0U;
+      size_t data_used = 0U;
+
+#if ETL_USING_STREAM_VBYTE_SIMD
+      i = private_byte_stream::simd_stream_vbyte_decode(control, data, data_size, start, length, data_used);
+#endif
+
+      for (; i < length; ++i)
+      {
+        const size_t bytes = ((control[i / 4U] >> (2U * (i % 4U))) & 0x03U) + 1U;
+
+        uint32_t value = 0U;
+
+        for (size_t b = 0U; b < bytes; ++b)
+        {
+          value |= static_cast<uint32_t>(data[data_used++]) << (8U * b);
+        }
+
+        start[i] = value;
+      }
+
+      pcurrent += (control_size + data_size);
+
+      return etl::optional<etl::span<const T> >(etl::span<const T>(start, length));
+    }
+
+    //***************************************************************************
+    /// Read a view of 'n' T directly from the stream buffer, without copying.
+    /// Only possible if the stream endianness matches the platform, or T is a
+    /// single byte, and the current position is aligned for T.
+    /// Returns an empty optional, and does not move, if the view is not possible.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value || etl::is_floating_point<T>::value, etl::optional<etl::span<const T> > >::type
+      read_view(size_t n)
+    {
+      etl::optional<etl::span<const T> > result;
+
+      const etl::endian platform_endianness = etl::endianness::value();
+      const uintptr_t   address             = reinterpret_cast<uintptr_t>(pcurrent);
+
+      if ((available<T>() >= n) &&
+          ((sizeof(T) == 1U) || (stream_endianness == platform_endianness)) &&
+          ((address % etl::alignment_of<T>::value) == 0U))
+      {
+        result = etl::span<const T>(reinterpret_cast<const T*>(pcurrent), n);
+        pcurrent += (n * sizeof(T));
+      }
+
+      return result;
+    }
+
     //***************************************************************************
     /// Skip n items of T, up to the maximum space available.
     /// Returns <b>true</b> if the skip was possible.
@@ -838,6 +1238,16 @@ namespace etl
       return value;
     }
 
+    //*********************************
+    template <typename T>
+    void from_bytes(T* values, size_t n)
+    {
+      const etl::endian platform_endianness = etl::endianness::value();
+
+      private_byte_stream::copy_values<sizeof(T)>(pcurrent, reinterpret_cast<char*>(values), n, stream_endianness != platform_endianness);
+      pcurrent += (n * sizeof(T));
+    }
+
     //*********************************
     void copy_value(const char* source, char* destination, size_t length) const
     {
@@ -0,0 +1,440 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_STREAM_SCHEMA_INCLUDED
+#define ETL_BYTE_STREAM_SCHEMA_INCLUDED
+
+#include "platform.h"
+#include "byte_stream.h"
+#include "array.h"
+#include "endianness.h"
+#include "nth_type.h"
+#include "smallest.h"
+#include "span.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+#include <limits.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_byte_stream_schema
+  {
+    //*************************************************************************
+    /// How each kind of field is written, read and viewed.
+    //*************************************************************************
+    template <typename T, typename TEnable = void>
+    struct field_traits;
+
+    //*********************************
+    /// Integral and floating point fields.
+    template <typename T>
+    struct field_traits<T, typename etl::enable_if<etl::is_arithmetic<T>::value>::type>
+    {
+      typedef T view_type;
+
+      static ETL_CONSTANT size_t Size = sizeof(T);
+
+      static void write(etl::byte_stream_writer& writer, const T& value)
+      {
+        writer.write_unchecked(value);
+      }
+
+      static void read(etl::byte_stream_reader& reader, T& value)
+      {
+        value = reader.read_unchecked<T>();
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t field_traits<T, typename etl::enable_if<etl::is_arithmetic<T>::value>::type>::Size;
+
+    //*********************************
+    /// Enumeration fields.
+    /// Sent as the unsigned integral of the same size.
+    template <typename T>
+    struct field_traits<T, typename etl::enable_if<etl::is_enum<T>::value>::type>
+    {
+      typedef T view_type;
+      typedef typename etl::smallest_uint_for_bits<CHAR_BIT * sizeof(T)>::type wire_type;
+
+      static ETL_CONSTANT size_t Size = sizeof(wire_type);
+
+      static void write(etl::byte_stream_writer& writer, const T& value)
+      {
+        writer.write_unchecked(static_cast<wire_type>(value));
+      }
+
+      static void read(etl::byte_stream_reader& reader, T& value)
+      {
+        value = static_cast<T>(reader.read_unchecked<wire_type>());
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t field_traits<T, typename etl::enable_if<etl::is_enum<T>::value>::type>::Size;
+
+    //*********************************
+    /// Arrays of integral or floating point values.
+    /// Viewed as an etl::array.
+    template <typename T, size_t N>
+    struct field_traits<T[N], typename etl::enable_if<etl::is_arithmetic<T>::value>::type>
+    {
+      typedef etl::array<T, N> view_type;
+
+      static ETL_CONSTANT size_t Size = N * sizeof(T);
+
+      static void write(etl::byte_stream_writer& writer, const T(&value)[N])
+      {
+        writer.write_unchecked(value, N);
+      }
+
+      static void read(etl::byte_stream_reader& reader, T(&value)[N])
+      {
+        reader.read_unchecked<T>(value, N);
+      }
+
+      static void read(etl::byte_stream_reader& reader, view_type& value)
+      {
+        reader.read_unchecked<T>(value.data(), N);
+      }
+    };
+
+    template <typename T, size_t N>
+    ETL_CONSTANT size_t field_traits<T[N], typename etl::enable_if<etl::is_arithmetic<T>::value>::type>::Size;
+
+    //*************************************************************************
+    /// The total size of the fields.
+    //*************************************************************************
+    template <typename... TFields>
+    struct fields_size;
+
+    template <>
+    struct fields_size<>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename TField, typename... TRest>
+    struct fields_size<TField, TRest...>
+    {
+      static ETL_CONSTANT size_t value = TField::Size + fields_size<TRest...>::value;
+    };
+
+    //*************************************************************************
+    /// The offset of the field at 'Index'.
+    //*************************************************************************
+    template <size_t Index, typename... TFields>
+    struct field_offset;
+
+    template <typename TField, typename... TRest>
+    struct field_offset<0U, TField, TRest...>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <size_t Index, typename TField, typename... TRest>
+    struct field_offset<Index, TField, TRest...>
+    {
+      static ETL_CONSTANT size_t value = TField::Size + field_offset<Index - 1U, TRest...>::value;
+    };
+  }
+
+  //***************************************************************************
+  /// Describes one member of a structure in a byte_stream_schema.
+  /// Members may be integral, floating point, enumerations, or arrays of
+  /// integral or floating point values.
+  ///\code
+  /// ETL_BYTE_STREAM_FIELD(Position, x)
+  ///\endcode
+  //***************************************************************************
+  template <typename TObject, typename TValue, TValue TObject::* Member>
+  struct byte_stream_field
+  {
+    typedef TObject object_type;
+    typedef TValue  value_type;
+    typedef typename private_byte_stream_schema::field_traits<TValue>::view_type view_type;
+
+    static ETL_CONSTANT size_t Size = private_byte_stream_schema::field_traits<TValue>::Size;
+
+    //*************************************************************************
+    /// Writes the member of 'object' to the stream.
+    //*************************************************************************
+    static void write(etl::byte_stream_writer& writer, const TObject& object)
+    {
+      private_byte_stream_schema::field_traits<TValue>::write(writer, object.*Member);
+    }
+
+    //*************************************************************************
+    /// Reads the member of 'object' from the stream.
+    //*************************************************************************
+    static void read(etl::byte_stream_reader& reader, TObject& object)
+    {
+      private_byte_stream_schema::field_traits<TValue>::read(reader, object.*Member);
+    }
+
+    //*************************************************************************
+    /// Reads the field directly from encoded data.
+    //*************************************************************************
+    static view_type view(const char* data, etl::endian stream_endianness)
+    {
+      etl::byte_stream_reader reader(data, Size, stream_endianness);
+
+      view_type value;
+      private_byte_stream_schema::field_traits<TValue>::read(reader, value);
+
+      return value;
+    }
+  };
+
+  template <typename TObject, typename TValue, TValue TObject::* Member>
+  ETL_CONSTANT size_t byte_stream_field<TObject, TValue, Member>::Size;
+
+  //***************************************************************************
+  /// Declares the byte_stream_field for a member of a structure.
+  //***************************************************************************
+  #define ETL_BYTE_STREAM_FIELD(Type, member) etl::byte_stream_field<Type, decltype(Type::member), &Type::member>
+
+  //***************************************************************************
+  /// A compile time description of how a structure is written to and read
+  /// from a byte stream, as a list of its members.
+  /// The fields are packed, in the order listed, in the stream's endianness.
+  ///\code
+  /// struct Position
+  /// {
+  ///   int32_t  x;
+  ///   int32_t  y;
+  ///   uint8_t  flags;
+  /// };
+  ///
+  /// typedef etl::byte_stream_schema<Position,
+  ///                                 ETL_BYTE_STREAM_FIELD(Position, x),
+  ///                                 ETL_BYTE_STREAM_FIELD(Position, y),
+  ///                                 ETL_BYTE_STREAM_FIELD(Position, flags)> position_schema;
+  ///
+  /// char buffer[position_schema::Size];
+  ///\endcode
+  //***************************************************************************
+  template <typename TObject, typename... TFields>
+  class byte_stream_schema
+  {
+  public:
+
+    typedef TObject object_type;
+
+    /// The number of bytes in the encoded structure.
+    static ETL_CONSTANT size_t Size = private_byte_stream_schema::fields_size<TFields...>::value;
+
+    /// The number of fields.
+    static ETL_CONSTANT size_t Number_Of_Fields = sizeof...(TFields);
+
+    //*************************************************************************
+    /// The byte offset of the field at 'Index' in the encoded structure.
+    //*************************************************************************
+    template <size_t Index>
+    struct offset_of : etl::integral_constant<size_t, private_byte_stream_schema::field_offset<Index, TFields...>::value>
+    {
+      ETL_STATIC_ASSERT(Index < sizeof...(TFields), "Field index out of range");
+    };
+
+    //*************************************************************************
+    /// The field at 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    struct field_at
+    {
+      ETL_STATIC_ASSERT(Index < sizeof...(TFields), "Field index out of range");
+
+      typedef typename etl::nth_type<Index, TFields...>::type type;
+    };
+
+    //*************************************************************************
+    /// Writes the structure to the stream.
+    //*************************************************************************
+    static void write_unchecked(etl::byte_stream_writer& writer, const TObject& object)
+    {
+      write_fields<TFields...>(writer, object);
+    }
+
+    //*************************************************************************
+    /// Writes the structure to the stream.
+    /// Returns <b>false</b>, having written nothing, if there is not enough space.
+    //*************************************************************************
+    static bool write(etl::byte_stream_writer& writer, const TObject& object)
+    {
+      bool success = (writer.available_bytes() >= Size);
+
+      if (success)
+      {
+        write_unchecked(writer, object);
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// Reads the structure from the stream.
+    //*************************************************************************
+    static void read_unchecked(etl::byte_stream_reader& reader, TObject& object)
+    {
+      read_fields<TFields...>(reader, object);
+    }
+
+    //*************************************************************************
+    /// Reads the structure from the stream.
+    /// Returns <b>false</b>, having read nothing, if there is not enough data.
+    //*************************************************************************
+    static bool read(etl::byte_stream_reader& reader, TObject& object)
+    {
+      bool success = (reader.available_bytes() >= Size);
+
+      if (success)
+      {
+        read_unchecked(reader, object);
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    /// A view of an encoded structure.
+    /// Each field is read directly from the encoded data when it is accessed.
+    //*************************************************************************
+    class view
+    {
+    public:
+
+      //***********************************************************************
+      /// Construct from a pointer and length.
+      //***********************************************************************
+      view(const void* data, size_t length, etl::endian stream_endianness_)
+        : pdata(static_cast<const char*>(data))
+        , length_bytes(length)
+        , stream_endianness(stream_endianness_)
+      {
+      }
+
+      //***********************************************************************
+      /// Construct from a span.
+      //***********************************************************************
+      view(etl::span<const char> data, etl::endian stream_endianness_)
+        : pdata(data.data())
+        , length_bytes(data.size())
+        , stream_endianness(stream_endianness_)
+      {
+      }
+
+      //***********************************************************************
+      /// Returns <b>true</b> if the data is large enough for the structure.
+      //***********************************************************************
+      bool is_valid() const
+      {
+        return length_bytes >= Size;
+      }
+
+      //***********************************************************************
+      /// Gets the value of the field at 'Index'.
+      /// Arrays are returned as an etl::array.
+      //***********************************************************************
+      template <size_t Index>
+      typename field_at<Index>::type::view_type get() const
+      {
+        return field_at<Index>::type::view(pdata + offset_of<Index>::value, stream_endianness);
+      }
+
+      //***********************************************************************
+      /// Decodes the whole structure.
+      //***********************************************************************
+      void unpack(TObject& object) const
+      {
+        etl::byte_stream_reader reader(pdata, Size, stream_endianness);
+
+        read_unchecked(reader, object);
+      }
+
+      //***********************************************************************
+      /// Returns the underlying data.
+      //***********************************************************************
+      etl::span<const char> data() const
+      {
+        return etl::span<const char>(pdata, length_bytes);
+      }
+
+    private:
+
+      const char*       pdata;
+      size_t            length_bytes;
+      etl::endian       stream_endianness;
+    };
+
+  private:
+
+    //*************************************************************************
+    template <typename... TRest>
+    static typename etl::enable_if<sizeof...(TRest) == 0U, void>::type
+      write_fields(etl::byte_stream_writer&, const TObject&)
+    {
+    }
+
+    //*********************************
+    template <typename TField, typename... TRest>
+    static void write_fields(etl::byte_stream_writer& writer, const TObject& object)
+    {
+      TField::write(writer, object);
+      write_fields<TRest...>(writer, object);
+    }
+
+    //*************************************************************************
+    template <typename... TRest>
+    static typename etl::enable_if<sizeof...(TRest) == 0U, void>::type
+      read_fields(etl::byte_stream_reader&, TObject&)
+    {
+    }
+
+    //*********************************
+    template <typename TField, typename... TRest>
+    static void read_fields(etl::byte_stream_reader& reader, TObject& object)
+    {
+      TField::read(reader, object);
+      read_fields<TRest...>(reader, object);
+    }
+  };
+
+  template <typename TObject, typename... TFields>
+  ETL_CONSTANT size_t byte_stream_schema<TObject, TFields...>::Size;
+
+  template <typename TObject, typename... TFields>
+  ETL_CONSTANT size_t byte_stream_schema<TObject, TFields...>::Number_Of_Fields;
+}
+
+#endif
+#endif
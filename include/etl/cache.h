@@ -0,0 +1,784 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CACHE_INCLUDED
+#define ETL_CACHE_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "delegate.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "placement_new.h"
+#include "memory.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup cache cache
+/// Fixed capacity key/value caches, with optional delegates that read from,
+/// and write to, a backing store.
+/// etl::lru_cache   Evicts the least recently used entry.
+/// etl::sieve_cache Evicts by the SIEVE algorithm, a variant of CLOCK.
+///                  A hit only sets a flag, so is cheaper than for LRU, and
+///                  entries that are never read again are evicted sooner.
+/// Both have O(1) get and put, using an open addressing index.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_cache
+  {
+    //*************************************************************************
+    /// The number of index slots needed for a maximum load of 1/2.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct index_slot_count
+    {
+      static ETL_CONSTANT size_t value = size_t(etl::power_of_2_round_up<2U * Max_Size>::value);
+    };
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t index_slot_count<Max_Size>::value;
+
+    //*************************************************************************
+    /// The eviction policies.
+    //*************************************************************************
+    struct policy
+    {
+      enum enum_type
+      {
+        Lru,
+        Sieve
+      };
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized caches.
+  /// Can be used as a reference type for all caches containing a specific type.
+  ///
+  /// On a miss, get() calls the read function, if set, to load the value from
+  /// the store. put() calls the write function immediately if write through
+  /// is set, otherwise the entry is marked as changed and is written when it
+  /// is evicted, erased, or by flush(). Write through is set by default.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class icache
+  {
+  public:
+
+    typedef TKey                           key_type;
+    typedef TValue                         mapped_type;
+    typedef ETL_OR_STD::pair<TKey, TValue> value_type;
+    typedef THash                          hasher;
+    typedef TKeyEqual                      key_equal;
+    typedef size_t                         size_type;
+
+    /// Loads the value for value.first into value.second. Returns false if the store does not have the key.
+    typedef etl::delegate<bool(value_type&)>       read_function_type;
+
+    /// Writes value, a changed entry, to the store.
+    typedef etl::delegate<void(const value_type&)> write_function_type;
+
+    //*************************************************************************
+    /// Sets the function that reads from the store.
+    //*************************************************************************
+    void set_read_function(read_function_type reader)
+    {
+      read_store = reader;
+    }
+
+    //*************************************************************************
+    /// Sets the function that writes to the store.
+    //*************************************************************************
+    void set_write_function(write_function_type writer)
+    {
+      write_store = writer;
+    }
+
+    //*************************************************************************
+    /// Sets the 'write through' flag.
+    /// Clearing it makes the cache write back; changed entries are written
+    /// when evicted, erased, flushed, or when the cache is destroyed.
+    //*************************************************************************
+    void set_write_through(bool write_through_)
+    {
+      write_through = write_through_;
+    }
+
+    //*************************************************************************
+    /// Gets the 'write through' flag.
+    //*************************************************************************
+    bool is_write_through() const
+    {
+      return write_through;
+    }
+
+    //*************************************************************************
+    /// Gets the value for the key, loading it from the store on a miss.
+    /// Counts as a use of the entry.
+    ///\return A pointer to the value, or null if neither the cache nor the store has the key.
+    /// The pointer is valid until the next modifying call.
+    //*************************************************************************
+    const TValue* get(const TKey& key)
+    {
+      index_type entry = find_entry(key);
+
+      if (entry != Npos)
+      {
+        touch(entry);
+      }
+      else
+      {
+        if (!read_store.is_valid())
+        {
+          return ETL_NULLPTR;
+        }
+
+        value_type loaded(key, TValue());
+
+        if (!read_store(loaded))
+        {
+          return ETL_NULLPTR;
+        }
+
+        entry = insert_entry(loaded.first, loaded.second);
+      }
+
+      return &pentries[entry].second;
+    }
+
+    //*************************************************************************
+    /// Gets the value for the key, without loading it or counting as a use.
+    ///\return A pointer to the value, or null if the cache does not have the key.
+    //*************************************************************************
+    const TValue* peek(const TKey& key) const
+    {
+      const index_type entry = find_entry(key);
+
+      return (entry != Npos) ? &pentries[entry].second : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache has the key, without loading it or counting as a use.
+    //*************************************************************************
+    bool contains(const TKey& key) const
+    {
+      return find_entry(key) != Npos;
+    }
+
+    //*************************************************************************
+    /// Sets the value for the key, evicting an entry if the cache is full.
+    /// Counts as a use of the entry.
+    //*************************************************************************
+    void put(const TKey& key, const TValue& value)
+    {
+      index_type entry = find_entry(key);
+
+      if (entry != Npos)
+      {
+        pentries[entry].second = value;
+        touch(entry);
+      }
+      else
+      {
+        entry = insert_entry(key, value);
+      }
+
+      if (write_through && write_store.is_valid())
+      {
+        write_store(pentries[entry]);
+      }
+      else
+      {
+        plinks[entry].flags |= Dirty;
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the key from the cache, writing the value to the store if it
+    /// has changed.
+    ///\return true if the cache had the key.
+    //*************************************************************************
+    bool erase(const TKey& key)
+    {
+      const index_type entry = find_entry(key);
+
+      if (entry == Npos)
+      {
+        return false;
+      }
+
+      write_back(entry);
+      remove_entry(entry);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes all changed values to the store.
+    //*************************************************************************
+    void flush()
+    {
+      for (index_type entry = head; entry != Npos; entry = plinks[entry].next)
+      {
+        write_back(entry);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all entries, writing changed values to the store.
+    //*************************************************************************
+    void clear()
+    {
+      flush();
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Checks if the key's value has changed since it was written to the store.
+    //*************************************************************************
+    bool is_dirty(const TKey& key) const
+    {
+      const index_type entry = find_entry(key);
+
+      return (entry != Npos) && ((plinks[entry].flags & Dirty) != 0U);
+    }
+
+    //*************************************************************************
+    /// Gets the number of entries.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of entries.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of entries.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the cache is full.
+    /// A full cache evicts an entry to make room for a new key.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the number of free entries.
+    //*************************************************************************
+    size_type available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the hash function.
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the key equality function.
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+  protected:
+
+    typedef uint16_t index_type;
+
+    static ETL_CONSTANT index_type Npos = 0xFFFFU;
+
+    /// Per entry state, kept apart from the uninitialised entries.
+    struct link_type
+    {
+      index_type prev;
+      index_type next;
+      uint8_t    flags;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icache(link_type* plinks_, value_type* pentries_, index_type* pindex_, size_t number_of_slots_, size_t maximum_size_,
+           private_cache::policy::enum_type policy_, hasher key_hash_function_, key_equal key_equal_function_)
+      : plinks(plinks_)
+      , pentries(pentries_)
+      , pindex(pindex_)
+      , number_of_slots(number_of_slots_)
+      , maximum_size(maximum_size_)
+      , policy(policy_)
+      , current_size(0U)
+      , head(Npos)
+      , tail(Npos)
+      , hand(Npos)
+      , free_list(Npos)
+      , write_through(true)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~icache()
+    {
+    }
+
+    //*************************************************************************
+    /// Destroys all entries, without writing them to the store.
+    //*************************************************************************
+    void initialise()
+    {
+      for (index_type entry = head; entry != Npos; entry = plinks[entry].next)
+      {
+        pentries[entry].~value_type();
+      }
+
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        pindex[i] = Npos;
+      }
+
+      // Chain all of the entries into the free list.
+      for (size_t i = 0U; i < maximum_size; ++i)
+      {
+        plinks[i].prev  = Npos;
+        plinks[i].next  = ((i + 1U) < maximum_size) ? index_type(i + 1U) : Npos;
+        plinks[i].flags = 0U;
+      }
+
+      free_list    = 0U;
+      head         = Npos;
+      tail         = Npos;
+      hand         = Npos;
+      current_size = 0U;
+    }
+
+  private:
+
+    enum
+    {
+      Dirty   = 1U,
+      Visited = 2U
+    };
+
+    //*************************************************************************
+    /// The ideal index slot for the key.
+    /// The hash is mixed so that identity hashes are well distributed.
+    //*************************************************************************
+    size_t home_of(const TKey& key) const
+    {
+#if ETL_USING_64BIT_TYPES
+      const size_t multiplier = static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+#else
+      const size_t multiplier = static_cast<size_t>(0x9E3779B9UL);
+#endif
+
+      size_t hash = size_t(key_hash_function(key)) * multiplier;
+      hash ^= (hash >> (etl::integral_limits<size_t>::bits / 2U));
+
+      return hash & (number_of_slots - 1U);
+    }
+
+    //*************************************************************************
+    /// Finds the index slot for the key; either the one holding it, or the
+    /// empty slot that ends the probe sequence.
+    //*************************************************************************
+    size_t find_slot(const TKey& key) const
+    {
+      size_t slot = home_of(key);
+
+      while ((pindex[slot] != Npos) && !key_equal_function(pentries[pindex[slot]].first, key))
+      {
+        slot = (slot + 1U) & (number_of_slots - 1U);
+      }
+
+      return slot;
+    }
+
+    //*************************************************************************
+    /// Finds the entry for the key, or Npos.
+    //*************************************************************************
+    index_type find_entry(const TKey& key) const
+    {
+      return pindex[find_slot(key)];
+    }
+
+    //*************************************************************************
+    /// Records a use of the entry.
+    //*************************************************************************
+    void touch(index_type entry)
+    {
+      if (policy == private_cache::policy::Lru)
+      {
+        // Move to the front of the list.
+        if (entry != head)
+        {
+          unlink(entry);
+          link_at_head(entry);
+        }
+      }
+      else
+      {
+        plinks[entry].flags |= Visited;
+      }
+    }
+
+    //*************************************************************************
+    /// Chooses the entry to evict.
+    //*************************************************************************
+    index_type select_victim()
+    {
+      if (policy == private_cache::policy::Lru)
+      {
+        return tail;
+      }
+
+      // SIEVE: the hand moves from the oldest entry towards the newest,
+      // clearing visited flags, and stops at the first unvisited entry.
+      index_type entry = (hand != Npos) ? hand : tail;
+
+      while ((plinks[entry].flags & Visited) != 0U)
+      {
+        plinks[entry].flags &= uint8_t(~Visited);
+        entry = (plinks[entry].prev != Npos) ? plinks[entry].prev : tail;
+      }
+
+      // remove_entry moves the hand on to the next older entry.
+      hand = entry;
+
+      return entry;
+    }
+
+    //*************************************************************************
+    /// Adds a new entry as the most recent, evicting another if full.
+    //*************************************************************************
+    index_type insert_entry(const TKey& key, const TValue& value)
+    {
+      if (full())
+      {
+        const index_type victim = select_victim();
+
+        write_back(victim);
+        remove_entry(victim);
+      }
+
+      // Take an entry from the free list.
+      const index_type entry = free_list;
+      free_list = plinks[entry].next;
+
+      ::new (&pentries[entry]) value_type(key, value);
+      plinks[entry].flags = 0U;
+
+      pindex[find_slot(key)] = entry;
+      link_at_head(entry);
+      ++current_size;
+
+      return entry;
+    }
+
+    //*************************************************************************
+    /// Removes the entry from the index and the list, and destroys it.
+    /// Uses backward shift deletion, so that the index needs no tombstones.
+    //*************************************************************************
+    void remove_entry(index_type entry)
+    {
+      size_t empty = find_slot(pentries[entry].first);
+      size_t slot  = empty;
+
+      while (true)
+      {
+        slot = (slot + 1U) & (number_of_slots - 1U);
+
+        if (pindex[slot] == Npos)
+        {
+          break;
+        }
+
+        // Shift back the entries that may not be found past the gap.
+        const size_t home = home_of(pentries[pindex[slot]].first);
+        const size_t gap_distance  = (slot - empty) & (number_of_slots - 1U);
+        const size_t home_distance = (slot - home)  & (number_of_slots - 1U);
+
+        if (home_distance >= gap_distance)
+        {
+          pindex[empty] = pindex[slot];
+          empty = slot;
+        }
+      }
+
+      pindex[empty] = Npos;
+
+      if (hand == entry)
+      {
+        hand = plinks[entry].prev;
+      }
+
+      unlink(entry);
+      pentries[entry].~value_type();
+
+      plinks[entry].next = free_list;
+      free_list = entry;
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Writes the entry to the store, if it has changed.
+    //*************************************************************************
+    void write_back(index_type entry)
+    {
+      if ((plinks[entry].flags & Dirty) != 0U)
+      {
+        if (write_store.is_valid())
+        {
+          write_store(pentries[entry]);
+        }
+
+        plinks[entry].flags &= uint8_t(~Dirty);
+      }
+    }
+
+    //*************************************************************************
+    void link_at_head(index_type entry)
+    {
+      plinks[entry].prev = Npos;
+      plinks[entry].next = head;
+
+      if (head != Npos)
+      {
+        plinks[head].prev = entry;
+      }
+      else
+      {
+        tail = entry;
+      }
+
+      head = entry;
+    }
+
+    //*************************************************************************
+    void unlink(index_type entry)
+    {
+      const index_type prev = plinks[entry].prev;
+      const index_type next = plinks[entry].next;
+
+      if (prev != Npos)
+      {
+        plinks[prev].next = next;
+      }
+      else
+      {
+        head = next;
+      }
+
+      if (next != Npos)
+      {
+        plinks[next].prev = prev;
+      }
+      else
+      {
+        tail = prev;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    icache(const icache&) ETL_DELETE;
+    icache& operator =(const icache&) ETL_DELETE;
+
+    link_type*  plinks;
+    value_type* pentries;
+    index_type* pindex;
+
+    const size_t number_of_slots;
+    const size_t maximum_size;
+
+    const private_cache::policy::enum_type policy;
+
+    size_t     current_size;
+    index_type head;        ///< The most recently used or added entry.
+    index_type tail;        ///< The least recently used or added entry.
+    index_type hand;        ///< The SIEVE eviction hand.
+    index_type free_list;
+
+    bool write_through;   ///< If true, the cache writes changed values to the store immediately. If false then a flush() or destruct will be required.
+
+    read_function_type  read_store;   ///< A function that will read a value from the store into the cache.
+    write_function_type write_store;  ///< A function that will write a value from the cache into the store.
+
+    hasher    key_hash_function;
+    key_equal key_equal_function;
+  };
+
+  template <typename TKey, typename TValue, typename THash, typename TKeyEqual>
+  ETL_CONSTANT typename icache<TKey, TValue, THash, TKeyEqual>::index_type icache<TKey, TValue, THash, TKeyEqual>::Npos;
+
+  //***************************************************************************
+  /// A fixed capacity cache that evicts the least recently used entry.
+  /// A hit moves the entry to the front of the recency list.
+  ///\tparam MAX_SIZE_ The maximum number of entries. Less than 65535.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class lru_cache : public etl::icache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::icache<TKey, TValue, THash, TKeyEqual> base;
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U) && (MAX_SIZE_ < 0xFFFFU), "The maximum size must be between 1 and 65534");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = private_cache::index_slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lru_cache(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(links, entries.begin(), index, MAX_SLOTS, MAX_SIZE, private_cache::policy::Lru, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes changed values to the store.
+    //*************************************************************************
+    ~lru_cache()
+    {
+      base::flush();
+      base::initialise();
+    }
+
+  private:
+
+    typename base::link_type                                   links[MAX_SIZE];
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SIZE> entries;
+    typename base::index_type                                  index[MAX_SLOTS];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t lru_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //***************************************************************************
+  /// A fixed capacity cache that evicts by the SIEVE algorithm.
+  /// A hit sets the entry's visited flag. New entries are added at the head
+  /// of a queue; on eviction a hand moves from the tail towards the head,
+  /// clearing visited flags, and evicts the first unvisited entry.
+  ///\tparam MAX_SIZE_ The maximum number of entries. Less than 65535.
+  ///\ingroup cache
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class sieve_cache : public etl::icache<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::icache<TKey, TValue, THash, TKeyEqual> base;
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U) && (MAX_SIZE_ < 0xFFFFU), "The maximum size must be between 1 and 65534");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE  = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_SLOTS = private_cache::index_slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    sieve_cache(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(links, entries.begin(), index, MAX_SLOTS, MAX_SIZE, private_cache::policy::Sieve, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Writes changed values to the store.
+    //*************************************************************************
+    ~sieve_cache()
+    {
+      base::flush();
+      base::initialise();
+    }
+
+  private:
+
+    typename base::link_type                                   links[MAX_SIZE];
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SIZE> entries;
+    typename base::index_type                                  index[MAX_SLOTS];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t sieve_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t sieve_cache<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+}
+
+#endif
@@ -36,6 +36,8 @@ SOFTWARE.
 #include "static_assert.h"
 #include "function.h"
 #include "array.h"
+#include "type_traits.h"
+#include "utility.h"
 
 namespace etl
 {
@@ -154,6 +156,213 @@ namespace etl
     /// Lookup table of callbacks.
     etl::array<etl::ifunction<size_t>*, RANGE> lookup;
   };
+
+#if ETL_USING_CPP11
+  namespace private_callback_service
+  {
+    typedef void (*callback_type)(size_t);
+
+    //*************************************************************************
+    /// The default for unhandled ids.
+    //*************************************************************************
+    inline void ignore_unhandled(size_t)
+    {
+    }
+
+    //*************************************************************************
+    /// Finds the callback bound to ID, or Default.
+    //*************************************************************************
+    template <size_t ID, callback_type Default, typename... TBindings>
+    struct find_callback
+    {
+      static constexpr callback_type value = Default;
+    };
+
+    template <size_t ID, callback_type Default, typename TBinding, typename... TBindings>
+    struct find_callback<ID, Default, TBinding, TBindings...>
+    {
+      static constexpr callback_type value = (TBinding::Id == ID) ? TBinding::function
+                                                                   : find_callback<ID, Default, TBindings...>::value;
+    };
+
+    template <size_t ID, callback_type Default, typename... TBindings>
+    constexpr callback_type find_callback<ID, Default, TBindings...>::value;
+
+    template <size_t ID, callback_type Default, typename TBinding, typename... TBindings>
+    constexpr callback_type find_callback<ID, Default, TBinding, TBindings...>::value;
+
+    //*************************************************************************
+    /// Checks whether ID is already bound.
+    //*************************************************************************
+    template <size_t ID, typename... TBindings>
+    struct is_bound : etl::false_type
+    {
+    };
+
+    template <size_t ID, typename TBinding, typename... TBindings>
+    struct is_bound<ID, TBinding, TBindings...>
+      : etl::integral_constant<bool, (TBinding::Id == ID) || is_bound<ID, TBindings...>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// A callback bound to an id.
+    //*************************************************************************
+    template <size_t ID, callback_type Function>
+    struct callback_binding
+    {
+      static constexpr size_t        Id       = ID;
+      static constexpr callback_type function = Function;
+    };
+
+    template <size_t ID, callback_type Function>
+    constexpr size_t callback_binding<ID, Function>::Id;
+
+    template <size_t ID, callback_type Function>
+    constexpr callback_type callback_binding<ID, Function>::function;
+
+    //*************************************************************************
+    /// The constant table of callbacks, indexed by id - OFFSET.
+    //*************************************************************************
+    template <size_t RANGE, size_t OFFSET, callback_type Unhandled, typename TSequence, typename... TBindings>
+    struct callback_table;
+
+    template <size_t RANGE, size_t OFFSET, callback_type Unhandled, size_t... Indices, typename... TBindings>
+    struct callback_table<RANGE, OFFSET, Unhandled, etl::index_sequence<Indices...>, TBindings...>
+    {
+      static constexpr callback_type lookup[RANGE] = { find_callback<OFFSET + Indices, Unhandled, TBindings...>::value... };
+    };
+
+    template <size_t RANGE, size_t OFFSET, callback_type Unhandled, size_t... Indices, typename... TBindings>
+    constexpr callback_type callback_table<RANGE, OFFSET, Unhandled, etl::index_sequence<Indices...>, TBindings...>::lookup[RANGE];
+  }
+
+  //***************************************************************************
+  /// An indexed callback service with the callbacks bound at compile time.
+  /// Each callback is bound with register_callback, which gives the type of
+  /// the service with the callback added.
+  ///\code
+  /// typedef etl::callback_service_ct<4U, 10U>::register_callback<10U, on_timer>
+  ///                                          ::register_callback<12U, on_uart>
+  ///                                          ::register_unhandled_callback<on_unhandled> Interrupts;
+  ///
+  /// Interrupts::callback<10U>(); // A direct call to on_timer.
+  /// Interrupts::callback(id);    // An indexed call through a constant table.
+  ///\endcode
+  /// Callbacks are functions taking the id. Unbound and out of range ids call
+  /// the unhandled callback, which by default does nothing.
+  /// \tparam RANGE     The number of callbacks to handle.
+  /// \tparam OFFSET    The lowest callback id value.
+  /// \tparam Unhandled The callback for unhandled ids.
+  /// \tparam TBindings The bound callbacks.
+  //***************************************************************************
+  template <size_t RANGE,
+            size_t OFFSET = 0U,
+            void (*Unhandled)(size_t) = &private_callback_service::ignore_unhandled,
+            typename... TBindings>
+  class callback_service_ct
+  {
+  public:
+
+    typedef void (*callback_type)(size_t);
+
+  private:
+
+    template <size_t ID, callback_type Function>
+    struct add_callback;
+
+  public:
+
+    //*************************************************************************
+    /// The service with a callback bound to the specified id.
+    /// Compile time assert if the id is out of range or already bound.
+    /// \tparam ID       The id of the callback.
+    /// \tparam Function The callback.
+    //*************************************************************************
+    template <size_t ID, callback_type Function>
+    using register_callback = typename add_callback<ID, Function>::type;
+
+    //*************************************************************************
+    /// The service with an alternative callback for unhandled ids.
+    /// \tparam Function The 'unhandled' callback.
+    //*************************************************************************
+    template <callback_type Function>
+    using register_unhandled_callback = callback_service_ct<RANGE, OFFSET, Function, TBindings...>;
+
+    //*************************************************************************
+    /// Gets the callback for the id.
+    /// Compile time assert if the id is out of range.
+    /// \tparam ID The id of the callback.
+    //*************************************************************************
+    template <size_t ID>
+    static constexpr callback_type get_callback()
+    {
+      ETL_STATIC_ASSERT(ID < (OFFSET + RANGE), "Callback Id out of range");
+      ETL_STATIC_ASSERT(ID >= OFFSET,          "Callback Id out of range");
+
+      return private_callback_service::find_callback<ID, Unhandled, TBindings...>::value;
+    }
+
+    //*************************************************************************
+    /// Executes the callback function for the index.
+    /// A direct call to the bound function.
+    /// Compile time assert if the id is out of range.
+    /// \tparam ID The id of the callback.
+    //*************************************************************************
+    template <size_t ID>
+    static void callback()
+    {
+      ETL_STATIC_ASSERT(ID < (OFFSET + RANGE), "Callback Id out of range");
+      ETL_STATIC_ASSERT(ID >= OFFSET,          "Callback Id out of range");
+
+      private_callback_service::find_callback<ID, Unhandled, TBindings...>::value(ID);
+    }
+
+    //*************************************************************************
+    /// Executes the callback function for the index.
+    /// An indexed call through a constant table.
+    /// \param id Id of the callback.
+    //*************************************************************************
+    static void callback(size_t id)
+    {
+      if ((id >= OFFSET) && (id < (OFFSET + RANGE)))
+      {
+        table_type::lookup[id - OFFSET](id);
+      }
+      else
+      {
+        Unhandled(id);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of bound callbacks.
+    //*************************************************************************
+    static constexpr size_t size()
+    {
+      return sizeof...(TBindings);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a callback binding, checking the id.
+    //*************************************************************************
+    template <size_t ID, callback_type Function>
+    struct add_callback
+    {
+      ETL_STATIC_ASSERT(ID < (OFFSET + RANGE), "Callback Id out of range");
+      ETL_STATIC_ASSERT(ID >= OFFSET,          "Callback Id out of range");
+      ETL_STATIC_ASSERT((!private_callback_service::is_bound<ID, TBindings...>::value), "Callback Id already registered");
+
+      typedef callback_service_ct<RANGE, OFFSET, Unhandled, TBindings..., private_callback_service::callback_binding<ID, Function> > type;
+    };
+
+    ETL_STATIC_ASSERT(RANGE > 0U, "The range must not be zero");
+
+    typedef private_callback_service::callback_table<RANGE, OFFSET, Unhandled, etl::make_index_sequence<RANGE>, TBindings...> table_type;
+  };
+#endif
 }
 
 #endif
@@ -530,6 +530,25 @@ namespace etl
       return enabled;
     }
 
+    //*******************************************
+    /// Enable/disable catch-up mode.
+    /// When enabled, a repeating timer that expires more than once during a
+    /// single call to 'tick' is only fired once, and is then rescheduled in
+    /// phase with its period.
+    //*******************************************
+    void enable_catch_up(bool state_)
+    {
+      catch_up = state_;
+    }
+
+    //*******************************************
+    /// Get the catch-up mode.
+    //*******************************************
+    bool is_catch_up_enabled() const
+    {
+      return catch_up;
+    }
+
     //*******************************************
     /// Clears the timer of data.
     //*******************************************
@@ -575,7 +594,7 @@ namespace etl
               if (timer.repeating)
               {
                 // Reinsert the timer.
-                timer.delta = timer.period;
+                timer.delta = catch_up ? etl::private_timer::catch_up_delta(timer.period, count) : timer.period;
                 active_list.insert(timer.id);
               }
 
@@ -713,7 +732,7 @@ namespace etl
     //*******************************************
     uint32_t time_to_next() const
     {
-      uint32_t delta = active_list.front().delta;
+      uint32_t delta = active_list.empty() ? uint32_t(etl::timer::state::Inactive) : active_list.front().delta;
 
       return delta;
     }
@@ -727,6 +746,7 @@ namespace etl
       : timer_array(timer_array_),
         active_list(timer_array_),
         enabled(false),
+        catch_up(false),
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
         process_semaphore(0),
 #endif
@@ -744,6 +764,7 @@ namespace etl
     private_callback_timer::list active_list;
 
     volatile bool enabled;
+    bool catch_up;
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
 
 #if defined(ETL_TIMER_SEMAPHORE_TYPE)
@@ -132,6 +132,25 @@ namespace etl
       return enabled;
     }
 
+    //*******************************************
+    /// Enable/disable catch-up mode.
+    /// When enabled, a repeating timer that expires more than once during a
+    /// single call to 'tick' is only fired once, and is then rescheduled in
+    /// phase with its period.
+    //*******************************************
+    void enable_catch_up(bool state_)
+    {
+      catch_up = state_;
+    }
+
+    //*******************************************
+    /// Get the catch-up mode.
+    //*******************************************
+    bool is_catch_up_enabled() const
+    {
+      return catch_up;
+    }
+
     //*******************************************
     /// Clears the timer of data.
     //*******************************************
@@ -183,7 +202,7 @@ namespace etl
               if (timer.repeating)
               {
                 // Reinsert the timer.
-                timer.delta = timer.period;
+                timer.delta = catch_up ? etl::private_timer::catch_up_delta(timer.period, count) : timer.period;
                 active_list.insert(timer.id);
               }
 
@@ -303,7 +322,7 @@ namespace etl
     uint32_t time_to_next() const
     {
       ++process_semaphore;
-      uint32_t delta = active_list.front().delta;
+      uint32_t delta = active_list.empty() ? uint32_t(etl::timer::state::Inactive) : active_list.front().delta;
       --process_semaphore;
 
       return delta;
@@ -382,6 +401,7 @@ namespace etl
       : timer_array(timer_array_)
       , active_list(timer_array_)
       , enabled(false)
+      , catch_up(false)
       , process_semaphore(0U)
       , number_of_registered_timers(0U)
       , MAX_TIMERS(MAX_TIMERS_)
@@ -581,6 +601,7 @@ namespace etl
     timer_list active_list;
 
     bool enabled;
+    bool catch_up;
     mutable TSemaphore process_semaphore;
     uint_least8_t number_of_registered_timers;
 
@@ -0,0 +1,685 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CALLBACK_TIMER_DEFERRED_INCLUDED
+#define ETL_CALLBACK_TIMER_DEFERRED_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+#include "delegate.h"
+#include "static_assert.h"
+#include "timer.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup callback_timer_deferred callback_timer_deferred
+/// A callback timer that needs no interrupt guard or lock.
+/// start, stop, set_period, set_mode, register_timer and unregister_timer may be
+/// called from any context, including interrupts of any priority. They post a
+/// request that 'tick' carries out, so the active list is only ever changed by
+/// the context that calls 'tick'.
+/// Each timer holds a single pending request and the latest one wins, so requests
+/// are never lost to a full queue. A pending unregister is not replaced.
+/// Requests take effect at the start of the next call to 'tick', which processes
+/// them even when the timer is disabled.
+/// 'clear' must not be called while 'tick' may run.
+///\ingroup timer
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the deferred callback timer.
+  ///\ingroup callback_timer_deferred
+  //***************************************************************************
+  class icallback_timer_deferred
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+
+    //*******************************************
+    /// Register a timer.
+    /// Returns etl::timer::id::NO_TIMER if there is no free timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const callback_type& callback_,
+                                        uint32_t             period_,
+                                        bool                 repeating_)
+    {
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        timer_data& timer = timer_array[i];
+
+        bool expected = false;
+
+        if (timer.registered.compare_exchange_strong(expected, true, etl::memory_order_acquire))
+        {
+          timer.id       = i;
+          timer.callback = callback_;
+          timer.period.store(period_, etl::memory_order_relaxed);
+          timer.repeating.store(repeating_, etl::memory_order_relaxed);
+          ++number_of_registered_timers;
+
+          return timer.id;
+        }
+      }
+
+      return etl::timer::id::NO_TIMER;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    /// The timer is stopped and its id becomes free at the next call to 'tick'.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      return post(id_, Unregister_Timer);
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled.store(state_);
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled.load();
+    }
+
+    //*******************************************
+    /// Enable/disable catch-up mode.
+    /// When enabled, a repeating timer that expires more than once during a
+    /// single call to 'tick' is only fired once, and is then rescheduled in
+    /// phase with its period.
+    //*******************************************
+    void enable_catch_up(bool state_)
+    {
+      catch_up.store(state_);
+    }
+
+    //*******************************************
+    /// Get the catch-up mode.
+    //*******************************************
+    bool is_catch_up_enabled() const
+    {
+      return catch_up.load();
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    /// Must not be called while 'tick' may run.
+    //*******************************************
+    void clear()
+    {
+      active_list.clear();
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        timer_data& timer = timer_array[i];
+
+        timer.callback = callback_type();
+        timer.period.store(0U);
+        timer.repeating.store(true);
+        timer.request.store(No_Request);
+        timer.set_inactive();
+        timer.registered.store(false);
+      }
+
+      number_of_registered_timers = 0U;
+      has_requests.store(false);
+      next_delta.store(etl::timer::state::Inactive);
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Carries out any requests first, even if the timer is disabled.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      process_requests();
+
+      const bool is_enabled = enabled.load();
+
+      if (is_enabled)
+      {
+        const bool is_catch_up = catch_up.load(etl::memory_order_relaxed);
+
+        // We have something to do?
+        bool has_active = !active_list.empty();
+
+        if (has_active)
+        {
+          while (has_active && (count >= active_list.front().delta))
+          {
+            timer_data& timer = active_list.front();
+
+            count -= timer.delta;
+
+            active_list.remove(timer.id, true);
+
+            if (timer.callback.is_valid())
+            {
+              timer.callback();
+            }
+
+            if (timer.repeating.load(etl::memory_order_relaxed))
+            {
+              // Reinsert the timer.
+              const uint32_t period = timer.period.load(etl::memory_order_relaxed);
+
+              timer.delta = is_catch_up ? etl::private_timer::catch_up_delta(period, count) : period;
+              active_list.insert(timer.id);
+            }
+
+            has_active = !active_list.empty();
+          }
+
+          if (has_active)
+          {
+            // Subtract any remainder from the next due timeout.
+            active_list.front().delta -= count;
+          }
+        }
+      }
+
+      update_next_delta();
+
+      return is_enabled;
+    }
+
+    //*******************************************
+    /// Requests that a timer is started.
+    /// A running timer is restarted.
+    /// Returns false if the timer is not registered, has no period, or is
+    /// being unregistered.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      if (!is_registered(id_) || (timer_array[id_].period.load(etl::memory_order_relaxed) == etl::timer::state::Inactive))
+      {
+        return false;
+      }
+
+      return post(id_, immediate_ ? Start_Immediate : Start_Delayed);
+    }
+
+    //*******************************************
+    /// Requests that a timer is stopped.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      return post(id_, Stop_Timer);
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    /// The timer is stopped.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period.store(period_, etl::memory_order_relaxed);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    /// The timer is stopped.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating.store(repeating_, etl::memory_order_relaxed);
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event, as of the last call to 'tick'.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      return next_delta.load();
+    }
+
+    //*******************************************
+    /// Are there requests waiting for the next call to 'tick'?
+    //*******************************************
+    bool has_pending_requests() const
+    {
+      return has_requests.load();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : callback()
+        , period(0U)
+        , repeating(true)
+        , request(No_Request)
+        , registered(false)
+        , delta(etl::timer::state::Inactive)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return delta != etl::timer::state::Inactive;
+      }
+
+      //*******************************************
+      /// Sets the timer to the inactive state.
+      //*******************************************
+      void set_inactive()
+      {
+        delta = etl::timer::state::Inactive;
+      }
+
+      // Written by any context.
+      callback_type               callback;
+      etl::atomic<uint32_t>       period;
+      etl::atomic<bool>           repeating;
+      etl::atomic<uint_least8_t>  request;
+      etl::atomic<bool>           registered;
+
+      // Only used by 'tick'.
+      uint32_t                    delta;
+      etl::timer::id::type        id;
+      uint_least8_t               previous;
+      uint_least8_t               next;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    icallback_timer_deferred(timer_data* const timer_array_, const uint_least8_t MAX_TIMERS_)
+      : timer_array(timer_array_)
+      , active_list(timer_array_)
+      , enabled(false)
+      , catch_up(false)
+      , has_requests(false)
+      , next_delta(etl::timer::state::Inactive)
+      , number_of_registered_timers(0U)
+      , MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// The requests that may be made of a timer.
+    //*******************************************
+    enum
+    {
+      No_Request,
+      Start_Delayed,
+      Start_Immediate,
+      Stop_Timer,
+      Unregister_Timer
+    };
+
+    //*******************************************
+    bool is_registered(etl::timer::id::type id_) const
+    {
+      return (id_ < MAX_TIMERS) && timer_array[id_].registered.load(etl::memory_order_acquire);
+    }
+
+    //*******************************************
+    /// Posts a request, replacing any that is pending, unless that is an unregister.
+    //*******************************************
+    bool post(etl::timer::id::type id_, uint_least8_t new_request)
+    {
+      if (!is_registered(id_))
+      {
+        return false;
+      }
+
+      etl::atomic<uint_least8_t>& request = timer_array[id_].request;
+
+      uint_least8_t current = request.load(etl::memory_order_relaxed);
+
+      do
+      {
+        if (current == Unregister_Timer)
+        {
+          return false;
+        }
+      } while (!request.compare_exchange_weak(current, new_request, etl::memory_order_release, etl::memory_order_relaxed));
+
+      has_requests.store(true, etl::memory_order_release);
+
+      return true;
+    }
+
+    //*******************************************
+    /// Carries out the pending requests.
+    //*******************************************
+    void process_requests()
+    {
+      if (!has_requests.exchange(false, etl::memory_order_acquire))
+      {
+        return;
+      }
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        timer_data& timer = timer_array[i];
+
+        const uint_least8_t request = timer.request.exchange(No_Request, etl::memory_order_acquire);
+
+        if (request == No_Request)
+        {
+          continue;
+        }
+
+        if (timer.is_active())
+        {
+          active_list.remove(timer.id, false);
+        }
+
+        switch (request)
+        {
+          case Start_Delayed:
+          case Start_Immediate:
+          {
+            timer.delta = (request == Start_Immediate) ? 0U : timer.period.load(etl::memory_order_relaxed);
+            active_list.insert(timer.id);
+            break;
+          }
+
+          case Unregister_Timer:
+          {
+            timer.callback = callback_type();
+            --number_of_registered_timers;
+            timer.registered.store(false, etl::memory_order_release);
+            break;
+          }
+
+          case Stop_Timer:
+          default:
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    void update_next_delta()
+    {
+      next_delta.store(active_list.empty() ? uint32_t(etl::timer::state::Inactive) : active_list.front().delta);
+    }
+
+    //*************************************************************************
+    /// A specialised intrusive linked list for timer data.
+    //*************************************************************************
+    class timer_list
+    {
+    public:
+
+      //*******************************
+      timer_list(timer_data* ptimers_)
+        : head(etl::timer::id::NO_TIMER)
+        , tail(etl::timer::id::NO_TIMER)
+        , ptimers(ptimers_)
+      {
+      }
+
+      //*******************************
+      bool empty() const
+      {
+        return head == etl::timer::id::NO_TIMER;
+      }
+
+      //*******************************
+      // Inserts the timer at the correct delta position
+      //*******************************
+      void insert(etl::timer::id::type id_)
+      {
+        timer_data& timer = ptimers[id_];
+
+        if (head == etl::timer::id::NO_TIMER)
+        {
+          // No entries yet.
+          head = id_;
+          tail = id_;
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+        }
+        else
+        {
+          // We already have entries.
+          etl::timer::id::type test_id = head;
+
+          while (test_id != etl::timer::id::NO_TIMER)
+          {
+            timer_data& test = ptimers[test_id];
+
+            // Find the correct place to insert.
+            if (timer.delta <= test.delta)
+            {
+              if (test.id == head)
+              {
+                head = timer.id;
+              }
+
+              // Insert before test.
+              timer.previous = test.previous;
+              test.previous  = timer.id;
+              timer.next     = test.id;
+
+              // Adjust the next delta to compensate.
+              test.delta -= timer.delta;
+
+              if (timer.previous != etl::timer::id::NO_TIMER)
+              {
+                ptimers[timer.previous].next = timer.id;
+              }
+              break;
+            }
+            else
+            {
+              timer.delta -= test.delta;
+            }
+
+            test_id = test.next;
+          }
+
+          // Reached the end?
+          if (test_id == etl::timer::id::NO_TIMER)
+          {
+            // Tag on to the tail.
+            ptimers[tail].next = timer.id;
+            timer.previous     = tail;
+            timer.next         = etl::timer::id::NO_TIMER;
+            tail               = timer.id;
+          }
+        }
+      }
+
+      //*******************************
+      void remove(etl::timer::id::type id_, bool has_expired)
+      {
+        timer_data& timer = ptimers[id_];
+
+        if (head == id_)
+        {
+          head = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (tail == id_)
+        {
+          tail = timer.previous;
+        }
+        else
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        if (!has_expired)
+        {
+          // Adjust the next delta.
+          if (timer.next != etl::timer::id::NO_TIMER)
+          {
+            ptimers[timer.next].delta += timer.delta;
+          }
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+        timer.delta    = etl::timer::state::Inactive;
+      }
+
+      //*******************************
+      timer_data& front()
+      {
+        return ptimers[head];
+      }
+
+      //*******************************
+      const timer_data& front() const
+      {
+        return ptimers[head];
+      }
+
+      //*******************************
+      void clear()
+      {
+        etl::timer::id::type id = head;
+
+        while (id != etl::timer::id::NO_TIMER)
+        {
+          timer_data& timer = ptimers[id];
+          id = timer.next;
+          timer.previous = etl::timer::id::NO_TIMER;
+          timer.next     = etl::timer::id::NO_TIMER;
+        }
+
+        head = etl::timer::id::NO_TIMER;
+        tail = etl::timer::id::NO_TIMER;
+      }
+
+    private:
+
+      etl::timer::id::type head;
+      etl::timer::id::type tail;
+
+      timer_data* const ptimers;
+    };
+
+    // Disabled.
+    icallback_timer_deferred(const icallback_timer_deferred&) ETL_DELETE;
+    icallback_timer_deferred& operator =(const icallback_timer_deferred&) ETL_DELETE;
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The list of active timers. Only used by 'tick'.
+    timer_list active_list;
+
+    etl::atomic<bool>          enabled;
+    etl::atomic<bool>          catch_up;
+    etl::atomic<bool>          has_requests;
+    etl::atomic<uint32_t>      next_delta;
+    etl::atomic<uint_least8_t> number_of_registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The deferred callback timer.
+  ///\ingroup callback_timer_deferred
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS_>
+  class callback_timer_deferred : public etl::icallback_timer_deferred
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
+
+    typedef etl::icallback_timer_deferred::callback_type callback_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer_deferred()
+      : icallback_timer_deferred(timer_array, MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    etl::icallback_timer_deferred::timer_data timer_array[MAX_TIMERS_];
+  };
+}
+
+#endif
+#endif
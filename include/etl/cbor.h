@@ -0,0 +1,1165 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CBOR_INCLUDED
+#define ETL_CBOR_INCLUDED
+
+#include "platform.h"
+#include "byte_stream.h"
+#include "string_view.h"
+#include "span.h"
+#include "optional.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "enum_type.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup cbor cbor
+/// Encodes and decodes CBOR (RFC 8949) on a byte_stream_writer or
+/// byte_stream_reader, without dynamic memory.
+/// CBOR is always big endian; the writer and reader handle the byte order
+/// themselves, so the endianness of the byte stream does not matter.
+/// The nesting of arrays and maps is tracked on a fixed size stack.
+/// Definite length containers close themselves once all of their items have
+/// been written; end_array and end_map close indefinite length ones.
+/// The reader returns byte and text strings as views into the stream's buffer.
+/// Indefinite length strings cannot be viewed as one piece, so the reader
+/// reports them as Unsupported.
+///\ingroup utilities
+//*****************************************************************************
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// The types of CBOR item.
+  ///\ingroup cbor
+  //***************************************************************************
+  struct cbor_type
+  {
+    enum enum_type
+    {
+      Unsigned_Integer,
+      Negative_Integer,
+      Byte_String,
+      Text_String,
+      Begin_Array,
+      End_Array,
+      Begin_Map,
+      End_Map,
+      Tag,
+      Boolean,
+      Null,
+      Undefined,
+      Simple,
+      Floating_Point,
+      End_Of_Data,
+      Error
+    };
+
+    ETL_DECLARE_ENUM_TYPE(cbor_type, uint_least8_t)
+    ETL_ENUM_TYPE(Unsigned_Integer, "Unsigned_Integer")
+    ETL_ENUM_TYPE(Negative_Integer, "Negative_Integer")
+    ETL_ENUM_TYPE(Byte_String,      "Byte_String")
+    ETL_ENUM_TYPE(Text_String,      "Text_String")
+    ETL_ENUM_TYPE(Begin_Array,      "Begin_Array")
+    ETL_ENUM_TYPE(End_Array,        "End_Array")
+    ETL_ENUM_TYPE(Begin_Map,        "Begin_Map")
+    ETL_ENUM_TYPE(End_Map,          "End_Map")
+    ETL_ENUM_TYPE(Tag,              "Tag")
+    ETL_ENUM_TYPE(Boolean,          "Boolean")
+    ETL_ENUM_TYPE(Null,             "Null")
+    ETL_ENUM_TYPE(Undefined,        "Undefined")
+    ETL_ENUM_TYPE(Simple,           "Simple")
+    ETL_ENUM_TYPE(Floating_Point,   "Floating_Point")
+    ETL_ENUM_TYPE(End_Of_Data,      "End_Of_Data")
+    ETL_ENUM_TYPE(Error,            "Error")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The reason for an Error item.
+  ///\ingroup cbor
+  //***************************************************************************
+  struct cbor_error
+  {
+    enum enum_type
+    {
+      None,
+      Malformed,
+      Too_Deep,
+      Out_Of_Data,
+      Unsupported
+    };
+
+    ETL_DECLARE_ENUM_TYPE(cbor_error, uint_least8_t)
+    ETL_ENUM_TYPE(None,        "None")
+    ETL_ENUM_TYPE(Malformed,   "Malformed")
+    ETL_ENUM_TYPE(Too_Deep,    "Too_Deep")
+    ETL_ENUM_TYPE(Out_Of_Data, "Out_Of_Data")
+    ETL_ENUM_TYPE(Unsupported, "Unsupported")
+    ETL_END_ENUM_TYPE
+  };
+
+  namespace private_cbor
+  {
+    static ETL_CONSTANT uint8_t Major_Unsigned   = 0U;
+    static ETL_CONSTANT uint8_t Major_Negative   = 1U;
+    static ETL_CONSTANT uint8_t Major_Bytes      = 2U;
+    static ETL_CONSTANT uint8_t Major_Text       = 3U;
+    static ETL_CONSTANT uint8_t Major_Array      = 4U;
+    static ETL_CONSTANT uint8_t Major_Map        = 5U;
+    static ETL_CONSTANT uint8_t Major_Tag        = 6U;
+    static ETL_CONSTANT uint8_t Major_Simple     = 7U;
+
+    static ETL_CONSTANT uint8_t Simple_False     = 20U;
+    static ETL_CONSTANT uint8_t Simple_True      = 21U;
+    static ETL_CONSTANT uint8_t Simple_Null      = 22U;
+    static ETL_CONSTANT uint8_t Simple_Undefined = 23U;
+
+    static ETL_CONSTANT uint8_t One_Byte         = 24U;
+    static ETL_CONSTANT uint8_t Two_Bytes        = 25U;
+    static ETL_CONSTANT uint8_t Four_Bytes       = 26U;
+    static ETL_CONSTANT uint8_t Eight_Bytes      = 27U;
+    static ETL_CONSTANT uint8_t Indefinite       = 31U;
+
+    static ETL_CONSTANT uint8_t Break            = 0xFFU;
+
+    //*************************************************************************
+    /// An open array or map.
+    /// 'remaining' counts down the items of a definite length container, or
+    /// counts up the items of an indefinite one, so that maps can be checked
+    /// for whole pairs.
+    //*************************************************************************
+    struct level
+    {
+      uint64_t remaining;
+      bool     is_map;
+      bool     indefinite;
+    };
+
+    //*************************************************************************
+    /// Converts an IEEE 754 half precision value.
+    //*************************************************************************
+    inline float half_to_float(uint16_t half)
+    {
+      const uint32_t sign     = (half & 0x8000UL) << 16;
+      const uint32_t exponent = (half >> 10) & 0x1FU;
+      const uint32_t mantissa = half & 0x3FFU;
+
+      uint32_t bits;
+
+      if (exponent == 0U)
+      {
+        // Zero or subnormal; exact in single precision.
+        float value = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+
+        memcpy(&bits, &value, sizeof(bits));
+        bits |= sign;
+      }
+      else if (exponent == 0x1FU)
+      {
+        bits = sign | 0x7F800000UL | (mantissa << 13);
+      }
+      else
+      {
+        bits = sign | ((exponent + (127U - 15U)) << 23) | (mantissa << 13);
+      }
+
+      float result;
+      memcpy(&result, &bits, sizeof(result));
+
+      return result;
+    }
+  }
+
+  //***************************************************************************
+  /// Writes CBOR items to a byte_stream_writer.
+  /// Each function returns <b>false</b>, and writes nothing, if there is not
+  /// enough space in the stream, or the item is not allowed at this point.
+  ///\ingroup cbor
+  //***************************************************************************
+  class icbor_writer
+  {
+  public:
+
+    //*************************************************************************
+    /// Writes an unsigned integer.
+    //*************************************************************************
+    bool write_unsigned(uint64_t value)
+    {
+      return write_scalar(private_cbor::Major_Unsigned, value);
+    }
+
+    //*************************************************************************
+    /// Writes a signed integer.
+    //*************************************************************************
+    bool write_signed(int64_t value)
+    {
+      if (value < 0)
+      {
+        // -1 - value, without overflowing for the most negative value.
+        return write_scalar(private_cbor::Major_Negative, static_cast<uint64_t>(-(value + 1)));
+      }
+
+      return write_scalar(private_cbor::Major_Unsigned, static_cast<uint64_t>(value));
+    }
+
+    //*************************************************************************
+    /// Writes an integer of any type.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, bool>::type
+      write(T value)
+    {
+      return etl::is_signed<T>::value ? write_signed(value) : write_unsigned(value);
+    }
+
+    //*************************************************************************
+    /// Writes a boolean.
+    //*************************************************************************
+    bool write(bool value)
+    {
+      return write_scalar(private_cbor::Major_Simple, value ? private_cbor::Simple_True : private_cbor::Simple_False);
+    }
+
+    //*************************************************************************
+    /// Writes a single precision float.
+    //*************************************************************************
+    bool write(float value)
+    {
+      uint32_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      return write_float(private_cbor::Four_Bytes, bits);
+    }
+
+#include "private/diagnostic_float_equal_push.h"
+    //*************************************************************************
+    /// Writes a double precision float.
+    /// Uses single precision if that holds the value exactly.
+    //*************************************************************************
+    bool write(double value)
+    {
+      const float single = static_cast<float>(value);
+
+      if (static_cast<double>(single) == value)
+      {
+        return write(single);
+      }
+
+      uint64_t bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      return write_float(private_cbor::Eight_Bytes, bits);
+    }
+#include "private/diagnostic_pop.h"
+
+    //*************************************************************************
+    /// Writes null.
+    //*************************************************************************
+    bool write_null()
+    {
+      return write_scalar(private_cbor::Major_Simple, private_cbor::Simple_Null);
+    }
+
+    //*************************************************************************
+    /// Writes undefined.
+    //*************************************************************************
+    bool write_undefined()
+    {
+      return write_scalar(private_cbor::Major_Simple, private_cbor::Simple_Undefined);
+    }
+
+    //*************************************************************************
+    /// Writes a simple value, other than those reserved for false, true, null,
+    /// undefined and the float encodings.
+    //*************************************************************************
+    bool write_simple(uint8_t value)
+    {
+      if (((value >= private_cbor::Simple_False) && (value < 32U)))
+      {
+        return false;
+      }
+
+      return write_scalar(private_cbor::Major_Simple, value);
+    }
+
+    //*************************************************************************
+    /// Writes a byte string.
+    //*************************************************************************
+    bool write_bytes(const void* data, size_t length)
+    {
+      return write_string(private_cbor::Major_Bytes, static_cast<const char*>(data), length);
+    }
+
+    //*************************************************************************
+    /// Writes a byte string.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    typename etl::enable_if<sizeof(T) == 1U, bool>::type
+      write_bytes(etl::span<T, Extent> data)
+    {
+      return write_bytes(data.data(), data.size());
+    }
+
+    //*************************************************************************
+    /// Writes a UTF-8 text string.
+    //*************************************************************************
+    bool write_text(etl::string_view text)
+    {
+      return write_string(private_cbor::Major_Text, text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Writes a tag, which applies to the next item.
+    //*************************************************************************
+    bool write_tag(uint64_t tag)
+    {
+      return write_head_and_data(private_cbor::Major_Tag, head_info(tag), tag, ETL_NULLPTR, 0U);
+    }
+
+    //*************************************************************************
+    /// Starts an array of 'length' items.
+    //*************************************************************************
+    bool begin_array(size_t length)
+    {
+      return begin_container(private_cbor::Major_Array, length, false, false);
+    }
+
+    //*************************************************************************
+    /// Starts an array of indefinite length.
+    //*************************************************************************
+    bool begin_array()
+    {
+      return begin_container(private_cbor::Major_Array, 0U, false, true);
+    }
+
+    //*************************************************************************
+    /// Ends an array of indefinite length.
+    //*************************************************************************
+    bool end_array()
+    {
+      return end_container(false);
+    }
+
+    //*************************************************************************
+    /// Starts a map of 'length' key/value pairs.
+    //*************************************************************************
+    bool begin_map(size_t length)
+    {
+      return begin_container(private_cbor::Major_Map, length, true, false);
+    }
+
+    //*************************************************************************
+    /// Starts a map of indefinite length.
+    //*************************************************************************
+    bool begin_map()
+    {
+      return begin_container(private_cbor::Major_Map, 0U, true, true);
+    }
+
+    //*************************************************************************
+    /// Ends a map of indefinite length.
+    //*************************************************************************
+    bool end_map()
+    {
+      return end_container(true);
+    }
+
+    //*************************************************************************
+    /// Returns the number of open arrays and maps.
+    //*************************************************************************
+    size_t depth() const
+    {
+      return current_depth;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if every array and map has been closed.
+    //*************************************************************************
+    bool is_complete() const
+    {
+      return current_depth == 0U;
+    }
+
+    //*************************************************************************
+    /// Forgets any open arrays and maps.
+    /// Does not change the stream.
+    //*************************************************************************
+    void reset()
+    {
+      current_depth = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icbor_writer(etl::byte_stream_writer& stream_, private_cbor::level* p_stack_, size_t max_depth_)
+      : stream(stream_)
+      , p_stack(p_stack_)
+      , Max_Depth(max_depth_)
+      , current_depth(0U)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The additional information for an argument.
+    //*************************************************************************
+    static uint8_t head_info(uint64_t argument)
+    {
+      return (argument < 24U)          ? static_cast<uint8_t>(argument) :
+             (argument <= 0xFFU)       ? private_cbor::One_Byte :
+             (argument <= 0xFFFFU)     ? private_cbor::Two_Bytes :
+             (argument <= 0xFFFFFFFFU) ? private_cbor::Four_Bytes : private_cbor::Eight_Bytes;
+    }
+
+    //*************************************************************************
+    /// Writes the head, then the data, if all of it fits.
+    //*************************************************************************
+    bool write_head_and_data(uint8_t major, uint8_t info, uint64_t argument, const char* data, size_t length)
+    {
+      uint8_t head[9];
+      size_t  head_size = 1U;
+
+      head[0] = static_cast<uint8_t>((major << 5) | info);
+
+      if ((info >= private_cbor::One_Byte) && (info <= private_cbor::Eight_Bytes))
+      {
+        const size_t n = size_t(1U) << (info - private_cbor::One_Byte);
+
+        for (size_t i = n; i != 0U; --i)
+        {
+          head[i] = static_cast<uint8_t>(argument);
+          argument >>= 8;
+        }
+
+        head_size += n;
+      }
+
+      if (stream.available_bytes() < (head_size + length))
+      {
+        return false;
+      }
+
+      stream.write_unchecked(head, head_size);
+
+      if (length != 0U)
+      {
+        stream.write_unchecked(data, length);
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Counts an item in the enclosing container.
+    //*************************************************************************
+    void count_item()
+    {
+      if (current_depth != 0U)
+      {
+        private_cbor::level& top = p_stack[current_depth - 1U];
+
+        if (top.indefinite)
+        {
+          ++top.remaining;
+        }
+        else
+        {
+          --top.remaining;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Closes the definite length containers that are now full.
+    //*************************************************************************
+    void close_full_containers()
+    {
+      while ((current_depth != 0U) && !p_stack[current_depth - 1U].indefinite && (p_stack[current_depth - 1U].remaining == 0U))
+      {
+        --current_depth;
+      }
+    }
+
+    //*************************************************************************
+    bool write_scalar(uint8_t major, uint64_t argument)
+    {
+      if (!write_head_and_data(major, head_info(argument), argument, ETL_NULLPTR, 0U))
+      {
+        return false;
+      }
+
+      count_item();
+      close_full_containers();
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool write_float(uint8_t info, uint64_t bits)
+    {
+      if (!write_head_and_data(private_cbor::Major_Simple, info, bits, ETL_NULLPTR, 0U))
+      {
+        return false;
+      }
+
+      count_item();
+      close_full_containers();
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool write_string(uint8_t major, const char* data, size_t length)
+    {
+      if (!write_head_and_data(major, head_info(length), length, data, length))
+      {
+        return false;
+      }
+
+      count_item();
+      close_full_containers();
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool begin_container(uint8_t major, size_t length, bool is_map, bool indefinite)
+    {
+      const bool is_empty = !indefinite && (length == 0U);
+
+      if (!is_empty && (current_depth == Max_Depth))
+      {
+        return false;
+      }
+
+      const uint8_t info = indefinite ? private_cbor::Indefinite : head_info(length);
+
+      if (!write_head_and_data(major, info, length, ETL_NULLPTR, 0U))
+      {
+        return false;
+      }
+
+      count_item();
+
+      if (is_empty)
+      {
+        close_full_containers();
+      }
+      else
+      {
+        private_cbor::level& level = p_stack[current_depth];
+
+        const uint64_t items = length;
+
+        level.remaining  = indefinite ? 0U : (is_map ? (items * 2U) : items);
+        level.is_map     = is_map;
+        level.indefinite = indefinite;
+
+        ++current_depth;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool end_container(bool is_map)
+    {
+      if (current_depth == 0U)
+      {
+        return false;
+      }
+
+      const private_cbor::level& top = p_stack[current_depth - 1U];
+
+      // Maps must hold whole pairs.
+      if (!top.indefinite || (top.is_map != is_map) || (is_map && ((top.remaining % 2U) != 0U)))
+      {
+        return false;
+      }
+
+      if (stream.available_bytes() == 0U)
+      {
+        return false;
+      }
+
+      stream.write_unchecked(private_cbor::Break);
+
+      --current_depth;
+      close_full_containers();
+
+      return true;
+    }
+
+    // Disable copy construction and assignment.
+    icbor_writer(const icbor_writer&) ETL_DELETE;
+    icbor_writer& operator =(const icbor_writer&) ETL_DELETE;
+
+    etl::byte_stream_writer& stream;
+    private_cbor::level*     p_stack;
+    const size_t             Max_Depth;
+    size_t                   current_depth;
+  };
+
+  //***************************************************************************
+  /// A CBOR writer.
+  ///\tparam Max_Depth The deepest nesting of arrays and maps.
+  ///\ingroup cbor
+  //***************************************************************************
+  template <size_t Max_Depth_>
+  class cbor_writer : public etl::icbor_writer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Depth_ > 0U, "Zero depth cbor_writer is not valid");
+
+    static ETL_CONSTANT size_t Max_Depth = Max_Depth_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit cbor_writer(etl::byte_stream_writer& stream_)
+      : etl::icbor_writer(stream_, stack, Max_Depth_)
+    {
+    }
+
+  private:
+
+    private_cbor::level stack[Max_Depth_];
+  };
+
+  template <size_t Max_Depth_>
+  ETL_CONSTANT size_t cbor_writer<Max_Depth_>::Max_Depth;
+
+  //***************************************************************************
+  /// A decoded CBOR item.
+  ///\ingroup cbor
+  //***************************************************************************
+  struct cbor_item
+  {
+    cbor_item()
+      : type(cbor_type::End_Of_Data)
+      , value(0U)
+      , floating_point(0.0)
+      , data()
+      , indefinite(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns the value of an Unsigned_Integer or Negative_Integer, if it
+    /// fits in T.
+    //*************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::optional<T> >::type
+      as() const
+    {
+      etl::optional<T> result;
+
+      if (type == cbor_type::Unsigned_Integer)
+      {
+        const uint64_t maximum = etl::integral_limits<T>::max;
+
+        if (value <= maximum)
+        {
+          const T converted = value;
+          result = converted;
+        }
+      }
+      else if ((type == cbor_type::Negative_Integer) && etl::is_signed<T>::value)
+      {
+        // The value is -1 - value.
+        const int64_t  minimum = etl::integral_limits<T>::min;
+        const uint64_t limit   = static_cast<uint64_t>(-(minimum + 1));
+
+        if (value <= limit)
+        {
+          const T converted = -static_cast<int64_t>(value) - 1;
+          result = converted;
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Returns the contents of a Text_String.
+    //*************************************************************************
+    etl::string_view text() const
+    {
+      return etl::string_view(data.data(), data.size());
+    }
+
+    cbor_type             type;
+    uint64_t              value;          ///< The integer, string length, number of items or pairs, tag, simple value, or 1 for true.
+    double                floating_point; ///< The value of a Floating_Point.
+    etl::span<const char> data;           ///< The contents of a Byte_String or Text_String, in the stream's buffer.
+    bool                  indefinite;     ///< Whether a Begin_Array or Begin_Map has an indefinite length.
+  };
+
+  //***************************************************************************
+  /// Reads CBOR items from a byte_stream_reader.
+  ///\ingroup cbor
+  //***************************************************************************
+  class icbor_reader
+  {
+  public:
+
+    //*************************************************************************
+    /// Returns the next item.
+    /// End_Array and End_Map are returned for definite length containers too,
+    /// once all of their items have been read.
+    //*************************************************************************
+    cbor_item next()
+    {
+      cbor_item item;
+
+      if (error_code != cbor_error::None)
+      {
+        item.type = cbor_type::Error;
+        return item;
+      }
+
+      // Close a definite length container once all of its items have been read.
+      if (current_depth != 0U)
+      {
+        const private_cbor::level& top = p_stack[current_depth - 1U];
+
+        if (!top.indefinite && (top.remaining == 0U))
+        {
+          --current_depth;
+          item.type = top.is_map ? cbor_type::End_Map : cbor_type::End_Array;
+          return item;
+        }
+      }
+
+      if (stream.available_bytes() == 0U)
+      {
+        if ((current_depth == 0U) && !tagged)
+        {
+          item.type = cbor_type::End_Of_Data;
+          return item;
+        }
+
+        return fail(cbor_error::Out_Of_Data);
+      }
+
+      const uint8_t initial = stream.read_unchecked<uint8_t>();
+      const uint8_t major   = initial >> 5;
+      const uint8_t info    = initial & 0x1FU;
+
+      if (initial == private_cbor::Break)
+      {
+        return end_indefinite();
+      }
+
+      uint64_t argument = info;
+
+      if (info >= private_cbor::One_Byte)
+      {
+        if (info > private_cbor::Eight_Bytes)
+        {
+          if (info != private_cbor::Indefinite)
+          {
+            return fail(cbor_error::Malformed);
+          }
+
+          if ((major == private_cbor::Major_Bytes) || (major == private_cbor::Major_Text))
+          {
+            return fail(cbor_error::Unsupported);
+          }
+
+          if ((major != private_cbor::Major_Array) && (major != private_cbor::Major_Map))
+          {
+            return fail(cbor_error::Malformed);
+          }
+        }
+        else
+        {
+          const size_t n = size_t(1U) << (info - private_cbor::One_Byte);
+
+          if (stream.available_bytes() < n)
+          {
+            return fail(cbor_error::Out_Of_Data);
+          }
+
+          argument = 0U;
+
+          for (size_t i = 0U; i < n; ++i)
+          {
+            argument = (argument << 8) | stream.read_unchecked<uint8_t>();
+          }
+        }
+      }
+
+      item.value = argument;
+
+      if (major == private_cbor::Major_Tag)
+      {
+        // The tag belongs to the next item, which is the one that counts.
+        tagged    = true;
+        item.type = cbor_type::Tag;
+        return item;
+      }
+
+      tagged = false;
+
+      switch (major)
+      {
+        case private_cbor::Major_Unsigned:
+        {
+          item.type = cbor_type::Unsigned_Integer;
+          break;
+        }
+
+        case private_cbor::Major_Negative:
+        {
+          item.type = cbor_type::Negative_Integer;
+          break;
+        }
+
+        case private_cbor::Major_Bytes:
+        case private_cbor::Major_Text:
+        {
+          if (stream.available_bytes() < argument)
+          {
+            return fail(cbor_error::Out_Of_Data);
+          }
+
+          item.type = (major == private_cbor::Major_Bytes) ? cbor_type::Byte_String : cbor_type::Text_String;
+          const size_t length = argument;
+
+          item.data = stream.read_unchecked<char>(length);
+          break;
+        }
+
+        case private_cbor::Major_Array:
+        case private_cbor::Major_Map:
+        {
+          return begin_container(item, major == private_cbor::Major_Map, info == private_cbor::Indefinite);
+        }
+
+        case private_cbor::Major_Simple:
+        default:
+        {
+          if (!read_simple(item, info))
+          {
+            return fail(cbor_error::Malformed);
+          }
+
+          break;
+        }
+      }
+
+      count_item();
+
+      return item;
+    }
+
+    //*************************************************************************
+    /// Skips the next item, including everything in it if it is an array or
+    /// map, and any tags before it.
+    ///\return <b>false</b> if an error was found or there was no item to skip.
+    //*************************************************************************
+    bool skip()
+    {
+      const size_t target = current_depth;
+
+      while (true)
+      {
+        const cbor_item item = next();
+
+        // An error, or the end of the enclosing container.
+        if ((item.type == cbor_type::End_Of_Data) || (item.type == cbor_type::Error) || (current_depth < target))
+        {
+          return false;
+        }
+
+        if ((current_depth == target) && (item.type != cbor_type::Tag))
+        {
+          return true;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the reason for the last Error.
+    //*************************************************************************
+    cbor_error error() const
+    {
+      return error_code;
+    }
+
+    //*************************************************************************
+    /// Returns the number of open arrays and maps.
+    //*************************************************************************
+    size_t depth() const
+    {
+      return current_depth;
+    }
+
+    //*************************************************************************
+    /// Forgets any open arrays and maps and clears the error.
+    /// Does not change the stream.
+    //*************************************************************************
+    void reset()
+    {
+      current_depth = 0U;
+      tagged        = false;
+      error_code    = cbor_error::None;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    icbor_reader(etl::byte_stream_reader& stream_, private_cbor::level* p_stack_, size_t max_depth_)
+      : stream(stream_)
+      , p_stack(p_stack_)
+      , Max_Depth(max_depth_)
+      , current_depth(0U)
+      , tagged(false)
+      , error_code(cbor_error::None)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    cbor_item fail(cbor_error::enum_type reason)
+    {
+      error_code = reason;
+
+      cbor_item item;
+      item.type = cbor_type::Error;
+
+      return item;
+    }
+
+    //*************************************************************************
+    /// Counts an item in the enclosing container.
+    //*************************************************************************
+    void count_item()
+    {
+      if (current_depth != 0U)
+      {
+        private_cbor::level& top = p_stack[current_depth - 1U];
+
+        if (top.indefinite)
+        {
+          ++top.remaining;
+        }
+        else
+        {
+          --top.remaining;
+        }
+      }
+    }
+
+    //*************************************************************************
+    cbor_item begin_container(cbor_item& item, bool is_map, bool indefinite)
+    {
+      item.type       = is_map ? cbor_type::Begin_Map : cbor_type::Begin_Array;
+      item.indefinite = indefinite;
+
+      if (current_depth == Max_Depth)
+      {
+        return fail(cbor_error::Too_Deep);
+      }
+
+      count_item();
+
+      private_cbor::level& level = p_stack[current_depth];
+
+      level.remaining  = indefinite ? 0U : (is_map ? (item.value * 2U) : item.value);
+      level.is_map     = is_map;
+      level.indefinite = indefinite;
+
+      if (indefinite)
+      {
+        item.value = 0U;
+      }
+
+      ++current_depth;
+
+      return item;
+    }
+
+    //*************************************************************************
+    cbor_item end_indefinite()
+    {
+      if ((current_depth == 0U) || tagged)
+      {
+        return fail(cbor_error::Malformed);
+      }
+
+      const private_cbor::level& top = p_stack[current_depth - 1U];
+
+      if (!top.indefinite || (top.is_map && ((top.remaining % 2U) != 0U)))
+      {
+        return fail(cbor_error::Malformed);
+      }
+
+      --current_depth;
+
+      cbor_item item;
+      item.type = top.is_map ? cbor_type::End_Map : cbor_type::End_Array;
+
+      return item;
+    }
+
+    //*************************************************************************
+    /// Decodes major type 7.
+    //*************************************************************************
+    bool read_simple(cbor_item& item, uint8_t info)
+    {
+      switch (info)
+      {
+        case private_cbor::Simple_False:
+        case private_cbor::Simple_True:
+        {
+          item.type  = cbor_type::Boolean;
+          item.value = (info == private_cbor::Simple_True) ? 1U : 0U;
+          return true;
+        }
+
+        case private_cbor::Simple_Null:
+        {
+          item.type = cbor_type::Null;
+          return true;
+        }
+
+        case private_cbor::Simple_Undefined:
+        {
+          item.type = cbor_type::Undefined;
+          return true;
+        }
+
+        case private_cbor::One_Byte:
+        {
+          // The two byte form is only for values that do not fit in one.
+          item.type = cbor_type::Simple;
+          return item.value >= 32U;
+        }
+
+        case private_cbor::Two_Bytes:
+        {
+          item.type           = cbor_type::Floating_Point;
+          item.floating_point = private_cbor::half_to_float(static_cast<uint16_t>(item.value));
+          return true;
+        }
+
+        case private_cbor::Four_Bytes:
+        {
+          const uint32_t bits = static_cast<uint32_t>(item.value);
+          float value;
+          memcpy(&value, &bits, sizeof(value));
+
+          item.type           = cbor_type::Floating_Point;
+          item.floating_point = value;
+          return true;
+        }
+
+        case private_cbor::Eight_Bytes:
+        {
+          double value;
+          memcpy(&value, &item.value, sizeof(value));
+
+          item.type           = cbor_type::Floating_Point;
+          item.floating_point = value;
+          return true;
+        }
+
+        default:
+        {
+          item.type = cbor_type::Simple;
+          return info < private_cbor::Simple_False;
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    icbor_reader(const icbor_reader&) ETL_DELETE;
+    icbor_reader& operator =(const icbor_reader&) ETL_DELETE;
+
+    etl::byte_stream_reader& stream;
+    private_cbor::level*     p_stack;
+    const size_t             Max_Depth;
+    size_t                   current_depth;
+    bool                     tagged;
+    cbor_error               error_code;
+  };
+
+  //***************************************************************************
+  /// A CBOR reader.
+  ///\tparam Max_Depth The deepest nesting of arrays and maps.
+  ///\ingroup cbor
+  //***************************************************************************
+  template <size_t Max_Depth_>
+  class cbor_reader : public etl::icbor_reader
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Depth_ > 0U, "Zero depth cbor_reader is not valid");
+
+    static ETL_CONSTANT size_t Max_Depth = Max_Depth_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit cbor_reader(etl::byte_stream_reader& stream_)
+      : etl::icbor_reader(stream_, stack, Max_Depth_)
+    {
+    }
+
+  private:
+
+    private_cbor::level stack[Max_Depth_];
+  };
+
+  template <size_t Max_Depth_>
+  ETL_CONSTANT size_t cbor_reader<Max_Depth_>::Max_Depth;
+}
+
+#endif
+#endif
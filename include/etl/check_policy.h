@@ -0,0 +1,220 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHECK_POLICY_INCLUDED
+#define ETL_CHECK_POLICY_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+///\defgroup check_policy check_policy
+/// Tags that select the checks made by a single container call, independent
+/// of the global ETL_CHECK_PUSH_POP setting.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Always check, whatever ETL_CHECK_PUSH_POP is set to.
+  /// The check reports through ETL_ASSERT, so it follows the configured
+  /// exception, log or assert mechanism.
+  ///\ingroup check_policy
+  //***************************************************************************
+  struct checked_t
+  {
+    explicit ETL_CONSTEXPR checked_t() {}
+  };
+
+  //***************************************************************************
+  /// Check only when ETL_DEBUG is defined.
+  ///\ingroup check_policy
+  //***************************************************************************
+  struct debug_checked_t
+  {
+    explicit ETL_CONSTEXPR debug_checked_t() {}
+  };
+
+  //***************************************************************************
+  /// Never check. The caller guarantees that the operation is valid.
+  ///\ingroup check_policy
+  //***************************************************************************
+  struct unchecked_t
+  {
+    explicit ETL_CONSTEXPR unchecked_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr checked_t       checked{};
+  inline constexpr debug_checked_t debug_checked{};
+  inline constexpr unchecked_t     unchecked{};
+#endif
+
+  //***************************************************************************
+  /// Is the type one of the check policy tags?
+  ///\ingroup check_policy
+  //***************************************************************************
+  template <typename T>
+  struct is_check_policy : public etl::false_type
+  {
+  };
+
+  template <>
+  struct is_check_policy<etl::checked_t> : public etl::true_type
+  {
+  };
+
+  template <>
+  struct is_check_policy<etl::debug_checked_t> : public etl::true_type
+  {
+  };
+
+  template <>
+  struct is_check_policy<etl::unchecked_t> : public etl::true_type
+  {
+  };
+
+  //***************************************************************************
+  /// Does the check policy make the check?
+  ///\ingroup check_policy
+  //***************************************************************************
+  template <typename TPolicy>
+  struct check_policy_enabled;
+
+  template <>
+  struct check_policy_enabled<etl::checked_t> : public etl::true_type
+  {
+  };
+
+  template <>
+  struct check_policy_enabled<etl::debug_checked_t> : public etl::bool_constant<ETL_IS_DEBUG_BUILD == 1>
+  {
+  };
+
+  template <>
+  struct check_policy_enabled<etl::unchecked_t> : public etl::false_type
+  {
+  };
+
+  //***************************************************************************
+  /// Binds a check policy to a container, so that a block of code can use
+  /// one policy for every call without passing the tag each time.
+  /// The container must provide the tagged overloads for the members used.
+  ///\code
+  /// etl::checked_access<etl::ivector<int>, etl::unchecked_t> fast(samples);
+  /// fast.push_back(value);
+  ///\endcode
+  ///\ingroup check_policy
+  //***************************************************************************
+  template <typename TContainer, typename TPolicy>
+  class checked_access
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_check_policy<TPolicy>::value, "Not a check policy");
+
+    typedef TContainer                              container_type;
+    typedef TPolicy                                 policy_type;
+    typedef typename TContainer::value_type         value_type;
+    typedef typename TContainer::size_type          size_type;
+    typedef typename TContainer::reference          reference;
+    typedef typename TContainer::const_reference    const_reference;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit checked_access(TContainer& container_)
+      : container(container_)
+    {
+    }
+
+    //*************************************************************************
+    /// The container.
+    //*************************************************************************
+    TContainer& get() const
+    {
+      return container;
+    }
+
+    //*************************************************************************
+    reference at(size_type i) const
+    {
+      return container.at(i, TPolicy());
+    }
+
+    //*************************************************************************
+    reference front() const
+    {
+      return container.front(TPolicy());
+    }
+
+    //*************************************************************************
+    reference back() const
+    {
+      return container.back(TPolicy());
+    }
+
+    //*************************************************************************
+    void push_back(const_reference value) const
+    {
+      container.push_back(TPolicy(), value);
+    }
+
+    //*************************************************************************
+    void push_front(const_reference value) const
+    {
+      container.push_front(TPolicy(), value);
+    }
+
+    //*************************************************************************
+    void pop() const
+    {
+      container.pop(TPolicy());
+    }
+
+    //*************************************************************************
+    void pop_back() const
+    {
+      container.pop_back(TPolicy());
+    }
+
+    //*************************************************************************
+    void pop_front() const
+    {
+      container.pop_front(TPolicy());
+    }
+
+  private:
+
+    TContainer& container;
+  };
+}
+
+#endif
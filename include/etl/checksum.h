@@ -30,14 +30,133 @@ SOFTWARE.
 #include "platform.h"
 #include "binary.h"
 #include "frame_check_sequence.h"
+#include "algorithm.h"
 
 #include <stdint.h>
+#include <string.h>
 
 ///\defgroup checksum Checksum calculation
 ///\ingroup maths
 
 namespace etl
 {
+  namespace private_checksum
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_t;
+#else
+    typedef uint32_t word_t;
+#endif
+
+    //*************************************************************************
+    /// Loads a word from an unaligned byte pointer.
+    //*************************************************************************
+    template <typename TPointer>
+    word_t load_word(TPointer p)
+    {
+      word_t word;
+      memcpy(&word, p, sizeof(word));
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Sums the bytes of the whole words in the range, advancing 'begin' past them.
+    /// The bytes are added in 16 bit lanes, which are folded before they can overflow.
+    //*************************************************************************
+    template <typename TPointer>
+    word_t sum_words(TPointer& begin, const TPointer end)
+    {
+      // 0x00FF00FF...
+      static ETL_CONSTANT word_t Low_Bytes = word_t(~word_t(0U)) / 0xFFFFU * 0xFFU;
+
+      // Each word adds at most 2 x 255 to each lane.
+      static ETL_CONSTANT size_t Words_Per_Fold = 128U;
+
+      word_t total = 0U;
+
+      while (size_t(end - begin) >= sizeof(word_t))
+      {
+        const size_t words = etl::min(size_t(end - begin) / sizeof(word_t), Words_Per_Fold);
+        word_t lanes = 0U;
+
+        for (size_t i = 0U; i < words; ++i)
+        {
+          const word_t word = load_word(begin);
+          lanes += (word & Low_Bytes) + ((word >> 8U) & Low_Bytes);
+          begin += sizeof(word_t);
+        }
+
+        for (size_t i = 0U; i < (sizeof(word_t) / 2U); ++i)
+        {
+          total += (lanes >> (16U * i)) & 0xFFFFU;
+        }
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// XORs the bytes of the whole words in the range, advancing 'begin' past them.
+    //*************************************************************************
+    template <typename TPointer>
+    uint8_t xor_words(TPointer& begin, const TPointer end)
+    {
+      word_t total = 0U;
+
+      while (size_t(end - begin) >= sizeof(word_t))
+      {
+        total ^= load_word(begin);
+        begin += sizeof(word_t);
+      }
+
+      // Fold the word down to a byte.
+      for (size_t shift = (sizeof(word_t) * 4U); shift >= 8U; shift /= 2U)
+      {
+        total ^= (total >> shift);
+      }
+
+      return uint8_t(total);
+    }
+
+    //*************************************************************************
+    /// Adds up to 'Block_Bytes' bytes to a pair of running sums with the
+    /// modulo deferred to the end. Four bytes are taken at a time, so that
+    /// sum2 is updated once for each group rather than once for each byte.
+    //*************************************************************************
+    template <uint32_t Modulus, size_t Block_Bytes, typename TPointer>
+    void add_fletcher_block(uint32_t& sum1, uint32_t& sum2, TPointer begin, const TPointer end)
+    {
+      while (begin != end)
+      {
+        const size_t length = etl::min(size_t(end - begin), Block_Bytes);
+        const TPointer block_end = begin + length;
+
+        while (size_t(block_end - begin) >= 4U)
+        {
+          const uint32_t b0 = uint8_t(begin[0]);
+          const uint32_t b1 = uint8_t(begin[1]);
+          const uint32_t b2 = uint8_t(begin[2]);
+          const uint32_t b3 = uint8_t(begin[3]);
+
+          sum2 += (4U * sum1) + (4U * b0) + (3U * b1) + (2U * b2) + b3;
+          sum1 += b0 + b1 + b2 + b3;
+          begin += 4U;
+        }
+
+        while (begin != block_end)
+        {
+          sum1 += uint8_t(*begin);
+          sum2 += sum1;
+          ++begin;
+        }
+
+        sum1 %= Modulus;
+        sum2 %= Modulus;
+      }
+    }
+  }
+
   //***************************************************************************
   /// Standard addition checksum policy.
   //***************************************************************************
@@ -46,6 +165,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Contiguous blocks are handled by the block add.
+    typedef void supports_block_add;
+
     T initial() const
     {
       return 0;
@@ -56,6 +178,23 @@ namespace etl
       return sum + value;
     }
 
+    //*************************************************************************
+    /// Adds a contiguous block of bytes, a word at a time.
+    //*************************************************************************
+    template <typename TPointer>
+    T add(T sum, TPointer begin, const TPointer end) const
+    {
+      sum += private_checksum::sum_words(begin, end);
+
+      while (begin != end)
+      {
+        sum = add(sum, uint8_t(*begin));
+        ++begin;
+      }
+
+      return sum;
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -94,6 +233,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Contiguous blocks are handled by the block add.
+    typedef void supports_block_add;
+
     T initial() const
     {
       return 0;
@@ -104,6 +246,23 @@ namespace etl
       return sum ^ value;
     }
 
+    //*************************************************************************
+    /// Adds a contiguous block of bytes, a word at a time.
+    //*************************************************************************
+    template <typename TPointer>
+    T add(T sum, TPointer begin, const TPointer end) const
+    {
+      sum = add(sum, private_checksum::xor_words(begin, end));
+
+      while (begin != end)
+      {
+        sum = add(sum, uint8_t(*begin));
+        ++begin;
+      }
+
+      return sum;
+    }
+
     T final(T sum) const
     {
       return sum;
@@ -142,6 +301,9 @@ namespace etl
   {
     typedef T value_type;
 
+    // Contiguous blocks are handled by the block add.
+    typedef void supports_block_add;
+
     T initial() const
     {
       return 0;
@@ -152,12 +314,128 @@ namespace etl
       return sum ^ etl::parity(value);
     }
 
+    //*************************************************************************
+    /// Adds a contiguous block of bytes, a word at a time.
+    /// The parity of the bytes is the parity of their XOR.
+    //*************************************************************************
+    template <typename TPointer>
+    T add(T sum, TPointer begin, const TPointer end) const
+    {
+      sum = add(sum, private_checksum::xor_words(begin, end));
+
+      while (begin != end)
+      {
+        sum = add(sum, uint8_t(*begin));
+        ++begin;
+      }
+
+      return sum;
+    }
+
     T final(T sum) const
     {
       return sum;
     }
   };
 
+  //***************************************************************************
+  /// Fletcher-16 checksum policy.
+  /// The state holds sum2 in the upper byte and sum1 in the lower.
+  //***************************************************************************
+  struct checksum_policy_fletcher16
+  {
+    typedef uint16_t value_type;
+
+    // Contiguous blocks are handled by the block add.
+    typedef void supports_block_add;
+
+    static ETL_CONSTANT uint32_t Modulus = 255U;
+
+    // The most bytes that can be added before the 32 bit sums must be reduced.
+    static ETL_CONSTANT size_t Block_Bytes = 5802U;
+
+    uint16_t initial() const
+    {
+      return 0U;
+    }
+
+    uint16_t add(uint16_t state, uint8_t value) const
+    {
+      const uint32_t sum1 = ((state & 0xFFU) + value) % Modulus;
+      const uint32_t sum2 = ((state >> 8U) + sum1) % Modulus;
+
+      return uint16_t((sum2 << 8U) | sum1);
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous block of bytes, deferring the modulo.
+    //*************************************************************************
+    template <typename TPointer>
+    uint16_t add(uint16_t state, TPointer begin, const TPointer end) const
+    {
+      uint32_t sum1 = state & 0xFFU;
+      uint32_t sum2 = state >> 8U;
+
+      private_checksum::add_fletcher_block<Modulus, Block_Bytes>(sum1, sum2, begin, end);
+
+      return uint16_t((sum2 << 8U) | sum1);
+    }
+
+    uint16_t final(uint16_t state) const
+    {
+      return state;
+    }
+  };
+
+  //***************************************************************************
+  /// Adler-32 checksum policy.
+  /// The state holds B in the upper 16 bits and A in the lower.
+  //***************************************************************************
+  struct checksum_policy_adler32
+  {
+    typedef uint32_t value_type;
+
+    // Contiguous blocks are handled by the block add.
+    typedef void supports_block_add;
+
+    static ETL_CONSTANT uint32_t Modulus = 65521U;
+
+    // The most bytes that can be added before the 32 bit sums must be reduced.
+    static ETL_CONSTANT size_t Block_Bytes = 5552U;
+
+    uint32_t initial() const
+    {
+      return 1U;
+    }
+
+    uint32_t add(uint32_t state, uint8_t value) const
+    {
+      const uint32_t a = ((state & 0xFFFFU) + value) % Modulus;
+      const uint32_t b = ((state >> 16U) + a) % Modulus;
+
+      return (b << 16U) | a;
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous block of bytes, deferring the modulo.
+    //*************************************************************************
+    template <typename TPointer>
+    uint32_t add(uint32_t state, TPointer begin, const TPointer end) const
+    {
+      uint32_t a = state & 0xFFFFU;
+      uint32_t b = state >> 16U;
+
+      private_checksum::add_fletcher_block<Modulus, Block_Bytes>(a, b, begin, end);
+
+      return (b << 16U) | a;
+    }
+
+    uint32_t final(uint32_t state) const
+    {
+      return state;
+    }
+  };
+
   //*************************************************************************
   /// Standard Checksum.
   //*************************************************************************
@@ -302,6 +580,62 @@ namespace etl
       this->add(begin, end);
     }
   };
+
+  //*************************************************************************
+  /// Fletcher-16 Checksum.
+  //*************************************************************************
+  class fletcher16 : public etl::frame_check_sequence<etl::checksum_policy_fletcher16>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    fletcher16()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    fletcher16(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+
+  //*************************************************************************
+  /// Adler-32 Checksum.
+  //*************************************************************************
+  class adler32 : public etl::frame_check_sequence<etl::checksum_policy_adler32>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    adler32()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    adler32(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
 }
 
 #endif
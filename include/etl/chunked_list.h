@@ -0,0 +1,1599 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CHUNKED_LIST_INCLUDED
+#define ETL_CHUNKED_LIST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "memory.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "static_assert.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup chunked_list chunked_list
+/// An unrolled linked list with the capacity defined at compile time.
+/// Each node holds a small contiguous array of elements, so iteration walks
+/// memory much like a vector, while inserting or erasing only shifts the
+/// elements of one node.
+/// A full node is split in two, and a node that falls below half full takes
+/// from or merges with the next one. Every node except the last is therefore
+/// at least half full, which bounds the number of nodes that must be reserved.
+/// Inserting or erasing invalidates all iterators.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the chunked_list.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  class chunked_list_exception : public etl::exception
+  {
+  public:
+
+    chunked_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the chunked_list.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  class chunked_list_full : public etl::chunked_list_exception
+  {
+  public:
+
+    chunked_list_full(string_type file_name_, numeric_type line_number_)
+      : etl::chunked_list_exception(ETL_ERROR_TEXT("chunked_list:full", ETL_CHUNKED_LIST_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the chunked_list.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  class chunked_list_empty : public etl::chunked_list_exception
+  {
+  public:
+
+    chunked_list_empty(string_type file_name_, numeric_type line_number_)
+      : etl::chunked_list_exception(ETL_ERROR_TEXT("chunked_list:empty", ETL_CHUNKED_LIST_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all chunked_lists.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  class ichunked_list
+  {
+  public:
+
+    typedef T         value_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef T*        pointer;
+    typedef const T*  const_pointer;
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+  protected:
+
+    //*************************************************************************
+    /// A node holds up to ELEMENTS_PER_NODE contiguous elements.
+    //*************************************************************************
+    struct node_t
+    {
+      node_t* previous;
+      node_t* next;
+      pointer values;
+      size_t  count;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, T>
+    {
+    public:
+
+      friend class ichunked_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_node(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        if (++index == p_node->count)
+        {
+          p_node = p_node->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_node = p_node->previous;
+          index  = p_node->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_node->values[index];
+      }
+
+      pointer operator ->() const
+      {
+        return p_node->values + index;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(node_t* p_node_, size_t index_)
+        : p_node(p_node_)
+        , index(index_)
+      {
+      }
+
+      node_t* p_node;
+      size_t  index;
+    };
+
+    //*************************************************************************
+    /// const_iterator
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const T>
+    {
+    public:
+
+      friend class ichunked_list;
+
+      const_iterator()
+        : p_node(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename ichunked_list::iterator& other)
+        : p_node(other.p_node)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        if (++index == p_node->count)
+        {
+          p_node = p_node->next;
+          index  = 0U;
+        }
+
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        if (index == 0U)
+        {
+          p_node = p_node->previous;
+          index  = p_node->count;
+        }
+
+        --index;
+
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_node->values[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return p_node->values + index;
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_node == rhs.p_node) && (lhs.index == rhs.index);
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(node_t* p_node_, size_t index_)
+        : p_node(p_node_)
+        , index(index_)
+      {
+      }
+
+      node_t* p_node;
+      size_t  index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(terminal_node.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(terminal_node.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(terminal_node.next, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(&terminal_node, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(const_cast<node_t*>(&terminal_node), 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(const_cast<node_t*>(&terminal_node), 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return terminal_node.next->values[0];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return terminal_node.next->values[0];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return terminal_node.previous->values[terminal_node.previous->count - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return terminal_node.previous->values[terminal_node.previous->count - 1U];
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values to the list.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the range does not fit.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      clear();
+
+      while (first != last)
+      {
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(chunked_list_full));
+
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Assigns 'n' copies of a value to the list.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    void assign(size_t n, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(n <= MAX_SIZE, ETL_ERROR(chunked_list_full));
+
+      clear();
+
+      while (n-- > 0U)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      // Inserting may move the element that 'value' refers to.
+      if (is_element(etl::addressof(value)))
+      {
+        T copy(value);
+#if ETL_USING_CPP11
+        return insert(position, etl::move(copy));
+#else
+        return insert(position, copy);
+#endif
+      }
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(value);
+      element_created();
+
+      return itr;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value at the position by moving it.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(etl::move(value));
+      element_created();
+
+      return itr;
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts 'n' copies of a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if there is not enough free space.
+    ///\return An iterator to the first new element, or 'position' if 'n' is zero.
+    //*************************************************************************
+    iterator insert(const_iterator position, size_t n, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(n <= available(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = to_iterator(position);
+
+      while (n-- > 0U)
+      {
+        itr = insert(itr, value);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if there is not enough free space.
+    ///\return An iterator to the first new element, or 'position' if the range is empty.
+    //*************************************************************************
+    template <typename TIterator>
+    iterator insert(const_iterator position, TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      if (first == last)
+      {
+        return to_iterator(position);
+      }
+
+      iterator itr = insert(position, *first);
+      ++first;
+
+      // Each insert moves elements around, so only the returned iterator is valid.
+      size_t offset = 1U;
+
+      while (first != last)
+      {
+        ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+        ++itr;
+        itr = insert(itr, *first);
+        ++first;
+        ++offset;
+      }
+
+      // Step back to the first new element.
+      while (--offset > 0U)
+      {
+        --itr;
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    //*************************************************************************
+    void push_front(const_reference value)
+    {
+      insert(cbegin(), value);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Pushes a value to the front by moving it.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    //*************************************************************************
+    void push_front(rvalue_reference value)
+    {
+      insert(cbegin(), etl::move(value));
+    }
+#endif
+
+    //*************************************************************************
+    /// Pushes a value to the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      insert(cend(), value);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Pushes a value to the back by moving it.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      insert(cend(), etl::move(value));
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Emplaces a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename ... Args>
+    iterator emplace(const_iterator position, Args && ... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(etl::forward<Args>(args)...);
+      element_created();
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_front(Args && ... args)
+    {
+      return *emplace(cbegin(), etl::forward<Args>(args)...);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename ... Args>
+    reference emplace_back(Args && ... args)
+    {
+      return *emplace(cend(), etl::forward<Args>(args)...);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename T1>
+    iterator emplace(const_iterator position, const T1& value1)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(value1);
+      element_created();
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    iterator emplace(const_iterator position, const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(value1, value2);
+      element_created();
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(value1, value2, value3);
+      element_created();
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the position.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return An iterator to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    iterator emplace(const_iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(chunked_list_full), end());
+
+      iterator itr = make_slot(position.p_node, position.index);
+      ::new (itr.p_node->values + itr.index) T(value1, value2, value3, value4);
+      element_created();
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_front(const T1& value1)
+    {
+      return *emplace(cbegin(), value1);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_front(const T1& value1, const T2& value2)
+    {
+      return *emplace(cbegin(), value1, value2);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_front(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return *emplace(cbegin(), value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    reference emplace_front(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return *emplace(cbegin(), value1, value2, value3, value4);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1>
+    reference emplace_back(const T1& value1)
+    {
+      return *emplace(cend(), value1);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    reference emplace_back(const T1& value1, const T2& value2)
+    {
+      return *emplace(cend(), value1, value2);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return *emplace(cend(), value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if the list is full.
+    ///\return A reference to the new element.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    reference emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return *emplace(cend(), value1, value2, value3, value4);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value at the front.
+    /// If asserts or exceptions are enabled, emits chunked_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(chunked_list_empty));
+
+      erase(cbegin());
+    }
+
+    //*************************************************************************
+    /// Removes the value at the back.
+    /// If asserts or exceptions are enabled, emits chunked_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(chunked_list_empty));
+
+      erase(const_iterator(terminal_node.previous, terminal_node.previous->count - 1U));
+    }
+
+    //*************************************************************************
+    /// Erases the value at the position.
+    ///\return An iterator to the element that followed the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      node_t* p_node = position.p_node;
+      size_t  index  = position.index;
+
+      erase_at(p_node, index);
+      --current_size;
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      if (p_node->next == &terminal_node)
+      {
+        // The last node may hold any number of elements.
+        if (p_node->count == 0U)
+        {
+          release_node(p_node);
+
+          return end();
+        }
+      }
+      else if (p_node->count < MIN_ELEMENTS)
+      {
+        node_t* p_next = p_node->next;
+
+        if ((p_node->count + p_next->count) <= ELEMENTS_PER_NODE)
+        {
+          // Merge the next node into this one.
+          relocate_to_back(p_node, p_next->values, p_next->values + p_next->count);
+          p_next->count = 0U;
+          release_node(p_next);
+        }
+        else
+        {
+          // Take the first element of the next node.
+          if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+          {
+            relocate_to_back(p_node, p_next->values, p_next->values + 1U);
+            etl::mem_relocate(p_next->values + 1U, p_next->values + p_next->count, p_next->values);
+            --p_next->count;
+          }
+          else
+          {
+            etl::uninitialized_move(p_next->values, p_next->values + 1U, p_node->values + p_node->count);
+            ++p_node->count;
+            erase_at(p_next, 0U);
+          }
+        }
+      }
+
+      // Elements that followed the erased one are still at or after 'index'.
+      if (index == p_node->count)
+      {
+        return iterator(p_node->next, 0U);
+      }
+
+      return iterator(p_node, index);
+    }
+
+    //*************************************************************************
+    /// Erases a range of values.
+    ///\return An iterator to the element that followed the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      // Each erase moves elements around, so count them first.
+      size_t n = static_cast<size_t>(etl::distance(first, last));
+
+      iterator itr = to_iterator(first);
+
+      while (n-- > 0U)
+      {
+        itr = erase(itr);
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Clears the list.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        node_t* p_node = terminal_node.next;
+
+        while (p_node != &terminal_node)
+        {
+          etl::destroy(p_node->values, p_node->values + p_node->count);
+          p_node = p_node->next;
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Resizes the list, adding default constructed values if it grows.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    void resize(size_t n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= MAX_SIZE, ETL_ERROR(chunked_list_full));
+
+      while (size() > n)
+      {
+        pop_back();
+      }
+
+      while (size() < n)
+      {
+        emplace_back_default();
+      }
+    }
+
+    //*************************************************************************
+    /// Resizes the list, adding copies of 'value' if it grows.
+    /// If asserts or exceptions are enabled, emits chunked_list_full if 'n' is greater than the capacity.
+    //*************************************************************************
+    void resize(size_t n, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(n <= MAX_SIZE, ETL_ERROR(chunked_list_full));
+
+      while (size() > n)
+      {
+        pop_back();
+      }
+
+      while (size() < n)
+      {
+        push_back(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all elements equal to the value.
+    //*************************************************************************
+    void remove(const_reference value)
+    {
+      // 'value' may be an element of the list, so compare with a copy.
+      const T compare(value);
+
+      iterator itr = begin();
+
+      while (itr != end())
+      {
+        if (*itr == compare)
+        {
+          itr = erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all elements that satisfy the predicate.
+    //*************************************************************************
+    template <typename TPredicate>
+    void remove_if(TPredicate predicate)
+    {
+      iterator itr = begin();
+
+      while (itr != end())
+      {
+        if (predicate(*itr))
+        {
+          itr = erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the list.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the list.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the list.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements held in each node.
+    //*************************************************************************
+    size_type elements_per_node() const
+    {
+      return ELEMENTS_PER_NODE;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ichunked_list& operator =(const ichunked_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    ichunked_list& operator =(ichunked_list&& rhs)
+    {
+      move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ichunked_list(node_t* p_node_buffer_, pointer p_value_buffer_, size_t max_size_, size_t max_nodes_, size_t elements_per_node_)
+      : p_node_buffer(p_node_buffer_)
+      , p_value_buffer(p_value_buffer_)
+      , p_free(ETL_NULLPTR)
+      , current_size(0U)
+      , MAX_SIZE(max_size_)
+      , MAX_NODES(max_nodes_)
+      , ELEMENTS_PER_NODE(elements_per_node_)
+      , MIN_ELEMENTS(elements_per_node_ / 2U)
+    {
+    }
+
+    //*************************************************************************
+    /// Puts all of the nodes back in the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      terminal_node.previous = &terminal_node;
+      terminal_node.next     = &terminal_node;
+      terminal_node.values   = ETL_NULLPTR;
+      terminal_node.count    = 0U;
+
+      p_free = ETL_NULLPTR;
+
+      for (size_t i = MAX_NODES; i > 0U; --i)
+      {
+        node_t& node = p_node_buffer[i - 1U];
+
+        node.previous = ETL_NULLPTR;
+        node.next     = p_free;
+        node.values   = p_value_buffer + ((i - 1U) * ELEMENTS_PER_NODE);
+        node.count    = 0U;
+
+        p_free = &node;
+      }
+
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements of another list to this one.
+    //*************************************************************************
+    void move_container(ichunked_list&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        for (iterator itr = rhs.begin(); itr != rhs.end(); ++itr)
+        {
+          push_back(etl::move(*itr));
+        }
+
+        rhs.clear();
+      }
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Default constructs a value at the back.
+    //*************************************************************************
+    void emplace_back_default()
+    {
+      iterator itr = make_slot(&terminal_node, 0U);
+      ::new (itr.p_node->values + itr.index) T();
+      element_created();
+    }
+
+    //*************************************************************************
+    /// Records the construction of an element in a slot from make_slot.
+    //*************************************************************************
+    void element_created()
+    {
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Makes an uninitialised slot for a new element before 'index' in the node.
+    /// The terminal node means the end of the list.
+    ///\return An iterator to the slot.
+    //*************************************************************************
+    iterator make_slot(node_t* p_node, size_t index)
+    {
+      if (p_node == &terminal_node)
+      {
+        p_node = terminal_node.previous;
+
+        if (p_node == &terminal_node)
+        {
+          p_node = allocate_node(&terminal_node);
+        }
+
+        index = p_node->count;
+      }
+      else if ((index == 0U) && (p_node->previous != &terminal_node) && (p_node->previous->count < ELEMENTS_PER_NODE))
+      {
+        // Append to the previous node, as nothing needs to be shifted.
+        p_node = p_node->previous;
+        index  = p_node->count;
+      }
+
+      if (p_node->count == ELEMENTS_PER_NODE)
+      {
+        node_t* p_new_node = allocate_node(p_node->next);
+
+        if ((index == ELEMENTS_PER_NODE) && (p_new_node->next == &terminal_node))
+        {
+          // Appending to a full last node starts a new one.
+          p_node = p_new_node;
+          index  = 0U;
+        }
+        else
+        {
+          // Split the full node, so that both halves are at least half full after the insert.
+          const size_t split = (ELEMENTS_PER_NODE + 1U) / 2U;
+
+          if (index < split)
+          {
+            relocate_to_back(p_new_node, p_node->values + (split - 1U), p_node->values + p_node->count);
+            p_node->count = split - 1U;
+          }
+          else
+          {
+            relocate_to_back(p_new_node, p_node->values + split, p_node->values + p_node->count);
+            p_node->count = split;
+            p_node = p_new_node;
+            index -= split;
+          }
+        }
+      }
+
+      open_gap(p_node, index);
+
+      return iterator(p_node, index);
+    }
+
+    //*************************************************************************
+    /// Shifts the elements from 'index' up by one, leaving an uninitialised slot.
+    //*************************************************************************
+    void open_gap(node_t* p_node, size_t index)
+    {
+      pointer p_first = p_node->values + index;
+      pointer p_last  = p_node->values + p_node->count;
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::mem_relocate(p_first, p_last, p_first + 1U);
+      }
+      else if (p_first != p_last)
+      {
+        etl::uninitialized_move(p_last - 1U, p_last, p_last);
+        etl::move_backward(p_first, p_last - 1U, p_last);
+        etl::destroy_at(p_first);
+      }
+
+      ++p_node->count;
+    }
+
+    //*************************************************************************
+    /// Destroys the element at 'index' and shifts the ones after it down by one.
+    //*************************************************************************
+    void erase_at(node_t* p_node, size_t index)
+    {
+      pointer p_first = p_node->values + index;
+      pointer p_last  = p_node->values + p_node->count;
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(p_first);
+        etl::mem_relocate(p_first + 1U, p_last, p_first);
+      }
+      else
+      {
+        etl::move(p_first + 1U, p_last, p_first);
+        etl::destroy_at(p_last - 1U);
+      }
+
+      --p_node->count;
+    }
+
+    //*************************************************************************
+    /// Moves [p_first, p_last) to the back of the node and ends their lifetimes at the source.
+    //*************************************************************************
+    void relocate_to_back(node_t* p_node, pointer p_first, pointer p_last)
+    {
+      pointer p_destination = p_node->values + p_node->count;
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::mem_relocate(p_first, p_last, p_destination);
+      }
+      else
+      {
+        etl::uninitialized_move(p_first, p_last, p_destination);
+        etl::destroy(p_first, p_last);
+      }
+
+      p_node->count += static_cast<size_t>(p_last - p_first);
+    }
+
+    //*************************************************************************
+    /// Takes a node from the free list and links it before 'p_next'.
+    //*************************************************************************
+    node_t* allocate_node(node_t* p_next)
+    {
+      node_t* p_node = p_free;
+      p_free = p_free->next;
+
+      p_node->count    = 0U;
+      p_node->next     = p_next;
+      p_node->previous = p_next->previous;
+      p_next->previous->next = p_node;
+      p_next->previous       = p_node;
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Unlinks an empty node and returns it to the free list.
+    //*************************************************************************
+    void release_node(node_t* p_node)
+    {
+      p_node->previous->next = p_node->next;
+      p_node->next->previous = p_node->previous;
+
+      p_node->previous = ETL_NULLPTR;
+      p_node->next     = p_free;
+      p_free = p_node;
+    }
+
+    //*************************************************************************
+    /// Checks whether the address is within the element storage.
+    //*************************************************************************
+    bool is_element(const_pointer p) const
+    {
+      return (p >= p_value_buffer) && (p < (p_value_buffer + (MAX_NODES * ELEMENTS_PER_NODE)));
+    }
+
+    //*************************************************************************
+    /// Converts a const_iterator to an iterator.
+    //*************************************************************************
+    static iterator to_iterator(const_iterator itr)
+    {
+      return iterator(itr.p_node, itr.index);
+    }
+
+    // Disable copy construction.
+    ichunked_list(const ichunked_list&) ETL_DELETE;
+
+    node_t          terminal_node;  ///< The end of the circular list of nodes.
+    node_t*         p_node_buffer;  ///< The node storage.
+    pointer         p_value_buffer; ///< The element storage, ELEMENTS_PER_NODE for each node.
+    node_t*         p_free;         ///< The list of free nodes.
+    size_type       current_size;   ///< The number of elements.
+    const size_type MAX_SIZE;
+    const size_type MAX_NODES;
+    const size_type ELEMENTS_PER_NODE;
+    const size_type MIN_ELEMENTS;   ///< The least number of elements in any node but the last.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_CHUNKED_LIST) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ichunked_list()
+    {
+    }
+#else
+  protected:
+    ~ichunked_list()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A chunked_list with the capacity defined at compile time.
+  ///\tparam T                  The element type.
+  ///\tparam MAX_SIZE_          The maximum number of elements.
+  ///\tparam ELEMENTS_PER_NODE_ The number of elements in each node.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE_ = 16U>
+  class chunked_list : public etl::ichunked_list<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity chunked_list is not valid");
+    ETL_STATIC_ASSERT(ELEMENTS_PER_NODE_ >= 2U, "chunked_list nodes must hold at least two elements");
+
+    static ETL_CONSTANT size_t MAX_SIZE          = MAX_SIZE_;
+    static ETL_CONSTANT size_t ELEMENTS_PER_NODE = ELEMENTS_PER_NODE_;
+
+    // Every node but the last holds at least ELEMENTS_PER_NODE / 2 elements.
+    static ETL_CONSTANT size_t MAX_NODES = ((MAX_SIZE_ - 1U) / (ELEMENTS_PER_NODE_ / 2U)) + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    chunked_list()
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Construct with 'n' default constructed values.
+    //*************************************************************************
+    explicit chunked_list(size_t initial_size)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->resize(initial_size);
+    }
+
+    //*************************************************************************
+    /// Construct with 'n' copies of a value.
+    //*************************************************************************
+    chunked_list(size_t initial_size, const T& value)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->assign(initial_size, value);
+    }
+
+    //*************************************************************************
+    /// Construct from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    chunked_list(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from an initializer_list.
+    //*************************************************************************
+    chunked_list(std::initializer_list<T> init)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    chunked_list(const chunked_list& other)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    chunked_list(chunked_list&& other)
+      : etl::ichunked_list<T>(nodes, values.begin(), MAX_SIZE, MAX_NODES, ELEMENTS_PER_NODE)
+    {
+      this->initialise();
+      this->move_container(etl::move(other));
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~chunked_list()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    chunked_list& operator =(const chunked_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    chunked_list& operator =(chunked_list&& rhs)
+    {
+      this->move_container(etl::move(rhs));
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    typename etl::ichunked_list<T>::node_t                      nodes[MAX_NODES];
+    etl::uninitialized_buffer_of<T, MAX_NODES * ELEMENTS_PER_NODE_> values;
+  };
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE_>
+  ETL_CONSTANT size_t chunked_list<T, MAX_SIZE_, ELEMENTS_PER_NODE_>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE_>
+  ETL_CONSTANT size_t chunked_list<T, MAX_SIZE_, ELEMENTS_PER_NODE_>::ELEMENTS_PER_NODE;
+
+  template <typename T, const size_t MAX_SIZE_, const size_t ELEMENTS_PER_NODE_>
+  ETL_CONSTANT size_t chunked_list<T, MAX_SIZE_, ELEMENTS_PER_NODE_>::MAX_NODES;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator ==(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator !=(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator <(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+
+  //***************************************************************************
+  /// Greater than operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator >(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return (rhs < lhs);
+  }
+
+  //***************************************************************************
+  /// Less than or equal operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator <=(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return !(lhs > rhs);
+  }
+
+  //***************************************************************************
+  /// Greater than or equal operator.
+  ///\ingroup chunked_list
+  //***************************************************************************
+  template <typename T>
+  bool operator >=(const etl::ichunked_list<T>& lhs, const etl::ichunked_list<T>& rhs)
+  {
+    return !(lhs < rhs);
+  }
+}
+
+#endif
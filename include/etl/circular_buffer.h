@@ -41,6 +41,9 @@ SOFTWARE.
 #include "iterator.h"
 #include "static_assert.h"
 #include "initializer_list.h"
+#include "span.h"
+#include "utility.h"
+#include "check_policy.h"
 
 namespace etl
 {
@@ -83,6 +86,19 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Full exception for the circular_buffer.
+  //***************************************************************************
+  class circular_buffer_full : public etl::circular_buffer_exception
+  {
+  public:
+
+    circular_buffer_full(string_type file_name_, numeric_type line_number_)
+      : etl::circular_buffer_exception(ETL_ERROR_TEXT("circular_buffer:full", ETL_CIRCULAR_BUFFER_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
   //***************************************************************************
   ///
   //***************************************************************************
@@ -157,6 +173,16 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    void decrement_in()
+    {
+      if (in == 0U) ETL_UNLIKELY
+      {
+        in = buffer_size;
+      }
+      --in;
+    }
+
     //*************************************************************************
     void increment_out()
     {
@@ -192,6 +218,9 @@ namespace etl
 
     typedef typename etl::iterator_traits<pointer>::difference_type difference_type;
 
+    typedef etl::pair<etl::span<T>, etl::span<T> >             span_pair;       ///< Up to two contiguous regions of the buffer.
+    typedef etl::pair<etl::span<const T>, etl::span<const T> > const_span_pair; ///< Up to two contiguous regions of the buffer.
+
     //*************************************************************************
     /// Iterator iterating through the circular buffer.
     //*************************************************************************
@@ -825,6 +854,38 @@ namespace etl
       return pbuffer[out];
     }
 
+    //*************************************************************************
+    /// Get a reference to the item at the front of the buffer, checked
+    /// according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, reference>::type
+      front(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      return pbuffer[out];
+    }
+
+    //*************************************************************************
+    /// Get a const reference to the item at the front of the buffer, checked
+    /// according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, const_reference>::type
+      front(TPolicy) const
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      return pbuffer[out];
+    }
+
     //*************************************************************************
     /// Get a reference to the item at the back of the buffer.
     /// Asserts an error if the buffer is empty.
@@ -847,6 +908,38 @@ namespace etl
       return pbuffer[in == 0U ? buffer_size - 1 : in - 1U];
     }
 
+    //*************************************************************************
+    /// Get a reference to the item at the back of the buffer, checked
+    /// according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, reference>::type
+      back(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      return pbuffer[in == 0U ? buffer_size - 1 : in - 1U];
+    }
+
+    //*************************************************************************
+    /// Get a const reference to the item at the back of the buffer, checked
+    /// according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, const_reference>::type
+      back(TPolicy) const
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      return pbuffer[in == 0U ? buffer_size - 1 : in - 1U];
+    }
+
     //*************************************************************************
     /// Get a reference to the item.
     //*************************************************************************
@@ -936,6 +1029,52 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*************************************************************************
+    /// pop_back
+    /// Removes the most recently pushed item.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      decrement_in();
+      pbuffer[in].~T();
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// pop, checked according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      pbuffer[out].~T();
+      increment_out();
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// pop_back, checked according to the policy tag instead of always.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop_back(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(circular_buffer_empty));
+      }
+
+      decrement_in();
+      pbuffer[in].~T();
+      ETL_DECREMENT_DEBUG_COUNT;
+    }
+
     //*************************************************************************
     /// pop(n)
     //*************************************************************************
@@ -947,6 +1086,108 @@ namespace etl
       }
     }
 
+    //*************************************************************************
+    /// Gets the free space as up to two contiguous regions, in write order.
+    /// The second region is empty unless the free space wraps.
+    /// Values written to the regions are added by commit_write().
+    /// For trivially copyable types only, as the storage holds no objects.
+    //*************************************************************************
+    span_pair write_regions()
+    {
+      if (in >= out)
+      {
+        // The slot before 'out' is always left free.
+        const size_type end = (out == 0U) ? buffer_size - 1U : buffer_size;
+
+        return span_pair(etl::span<T>(pbuffer + in, end - in),
+                         etl::span<T>(pbuffer, (out == 0U) ? 0U : out - 1U));
+      }
+      else
+      {
+        return span_pair(etl::span<T>(pbuffer + in, out - 1U - in),
+                         etl::span<T>());
+      }
+    }
+
+    //*************************************************************************
+    /// Adds n values written to the regions from write_regions().
+    /// Asserts an error if n is larger than available().
+    //*************************************************************************
+    void commit_write(size_type n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= available(), ETL_ERROR(circular_buffer_full));
+
+      in += n;
+
+      if (in >= buffer_size)
+      {
+        in -= buffer_size;
+      }
+
+      ETL_ADD_DEBUG_COUNT(n);
+    }
+
+    //*************************************************************************
+    /// Gets the stored values as up to two contiguous regions, oldest first.
+    /// The second region is empty unless the values wrap.
+    //*************************************************************************
+    span_pair read_regions()
+    {
+      if (in >= out)
+      {
+        return span_pair(etl::span<T>(pbuffer + out, in - out),
+                         etl::span<T>());
+      }
+      else
+      {
+        return span_pair(etl::span<T>(pbuffer + out, buffer_size - out),
+                         etl::span<T>(pbuffer, in));
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the stored values as up to two contiguous regions, oldest first.
+    /// The second region is empty unless the values wrap.
+    //*************************************************************************
+    const_span_pair read_regions() const
+    {
+      if (in >= out)
+      {
+        return const_span_pair(etl::span<const T>(pbuffer + out, in - out),
+                               etl::span<const T>());
+      }
+      else
+      {
+        return const_span_pair(etl::span<const T>(pbuffer + out, buffer_size - out),
+                               etl::span<const T>(pbuffer, in));
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the n oldest values, after they have been read from read_regions().
+    /// Asserts an error if n is larger than size().
+    //*************************************************************************
+    void consume(size_type n)
+    {
+      ETL_ASSERT_OR_RETURN(n <= size(), ETL_ERROR(circular_buffer_empty));
+
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<T>::value)
+      {
+        out += n;
+
+        if (out >= buffer_size)
+        {
+          out -= buffer_size;
+        }
+
+        ETL_SUBTRACT_DEBUG_COUNT(n);
+      }
+      else
+      {
+        pop(n);
+      }
+    }
+
     //*************************************************************************
     /// Clears the buffer.
     //*************************************************************************
@@ -0,0 +1,357 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMBINATION_ENUMERATOR_INCLUDED
+#define ETL_COMBINATION_ENUMERATOR_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "binary.h"
+#include "smallest.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+///\defgroup combination_enumerator combination_enumerator
+/// Enumerates the K combinations of N elements in revolving door order.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup combination_enumerator
+  /// Enumerates the K element subsets of {0 .. N-1} as bitmasks, in revolving
+  /// door (Gray code) order. Each step removes one element and adds another,
+  /// so a cost can be updated incrementally from removed() and added().
+  /// rank() and unrank() allow the sequence to be split into ranges, such as
+  /// one per thread.
+  ///\tparam N     The number of elements.
+  ///\tparam K     The number of elements in each combination.
+  ///\tparam TMask The bitmask type. Default is the smallest that holds N bits.
+  //***************************************************************************
+  template <size_t N, size_t K, typename TMask = typename etl::smallest_uint_for_bits<(N == 0U) ? 1U : N>::type>
+  class combination_enumerator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(K <= N, "K must not be greater than N");
+    ETL_STATIC_ASSERT(N <= etl::integral_limits<TMask>::bits, "The mask type is too small for N");
+
+    typedef TMask                                            mask_type;
+    typedef typename etl::smallest_uint_for_value<N + 1U>::type element_type;
+
+    static ETL_CONSTANT size_t Npos = N;
+
+    //*************************************************************************
+    /// Constructs at the first combination, {0 .. K-1}.
+    //*************************************************************************
+    combination_enumerator()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructs at the combination with rank 'r'.
+    //*************************************************************************
+    explicit combination_enumerator(size_t r)
+    {
+      unrank(r);
+    }
+
+    //*************************************************************************
+    /// Returns to the first combination.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 1U; i <= K; ++i)
+      {
+        t[i] = element_type(i);
+      }
+
+      set_sentinel();
+      rebuild_mask();
+
+      current_rank  = 0U;
+      removed_index = Npos;
+      added_index   = Npos;
+    }
+
+    //*************************************************************************
+    /// Steps to the next combination.
+    /// Returns false, and returns to the first combination, if the current
+    /// combination was the last.
+    //*************************************************************************
+    bool next()
+    {
+      if ((current_rank + 1U) >= size())
+      {
+        reset();
+        return false;
+      }
+
+      const mask_type previous = bits;
+
+      successor();
+      ++current_rank;
+
+      const mask_type removed_bits = previous & ~bits;
+      const mask_type added_bits   = bits & ~previous;
+
+      removed_index = etl::count_trailing_zeros(removed_bits);
+      added_index   = etl::count_trailing_zeros(added_bits);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The current combination, as a bitmask of the chosen elements.
+    //*************************************************************************
+    mask_type mask() const
+    {
+      return bits;
+    }
+
+    //*************************************************************************
+    /// The i'th smallest chosen element.
+    //*************************************************************************
+    size_t operator [](size_t i) const
+    {
+      return size_t(t[i + 1U]) - 1U;
+    }
+
+    //*************************************************************************
+    /// The element removed by the last step, or Npos.
+    //*************************************************************************
+    size_t removed() const
+    {
+      return removed_index;
+    }
+
+    //*************************************************************************
+    /// The element added by the last step, or Npos.
+    //*************************************************************************
+    size_t added() const
+    {
+      return added_index;
+    }
+
+    //*************************************************************************
+    /// The position of the current combination in the sequence.
+    //*************************************************************************
+    size_t rank() const
+    {
+      return current_rank;
+    }
+
+    //*************************************************************************
+    /// Sets the combination to the one at position 'r' in the sequence.
+    //*************************************************************************
+    void unrank(size_t r)
+    {
+      current_rank  = r;
+      removed_index = Npos;
+      added_index   = Npos;
+
+      size_t x = N;
+
+      for (size_t i = K; i > 0U; --i)
+      {
+        while (binomial(x, i) > r)
+        {
+          --x;
+        }
+
+        t[i] = element_type(x + 1U);
+        r    = binomial(x + 1U, i) - r - 1U;
+      }
+
+      set_sentinel();
+      rebuild_mask();
+    }
+
+    //*************************************************************************
+    /// Gets the rank of the combination 'm' within the sequence.
+    //*************************************************************************
+    static size_t rank_of(mask_type m)
+    {
+      // The alternating sum stays in range, so unsigned wrap around is harmless.
+      size_t r = 0U - (K % 2U);
+      size_t i = 1U;
+
+      for (size_t e = 0U; (e < N) && (i <= K); ++e)
+      {
+        if ((m & bit(e)) != 0U)
+        {
+          if (((K - i) % 2U) == 0U)
+          {
+            r += binomial(e + 1U, i);
+          }
+          else
+          {
+            r -= binomial(e + 1U, i);
+          }
+
+          ++i;
+        }
+      }
+
+      return r;
+    }
+
+    //*************************************************************************
+    /// The number of combinations.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t size()
+    {
+      return binomial(N, K);
+    }
+
+    //*************************************************************************
+    /// The binomial coefficient 'n' choose 'k'.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t binomial(size_t n, size_t k)
+    {
+      if (k > n)
+      {
+        return 0U;
+      }
+
+      size_t result = 1U;
+
+      for (size_t i = 1U; i <= k; ++i)
+      {
+        result = (result * (n - k + i)) / i;
+      }
+
+      return result;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Revolving door successor. Kreher and Stinson, Algorithm 2.13.
+    /// Uses one based elements in t[1 .. K], with t[K + 1] = N + 1.
+    //*************************************************************************
+    void successor()
+    {
+      size_t j = 1U;
+
+      while ((j <= K) && (t[j] == j))
+      {
+        ++j;
+      }
+
+      if (((K + j) % 2U) != 0U)
+      {
+        if (j == 1U)
+        {
+          assign(1U, size_t(t[1U]) - 1U);
+        }
+        else
+        {
+          assign(j - 1U, j);
+
+          if (j > 2U)
+          {
+            assign(j - 2U, j - 1U);
+          }
+        }
+      }
+      else
+      {
+        if (t[j + 1U] != (t[j] + 1U))
+        {
+          assign(j - 1U, t[j]);
+          assign(j, size_t(t[j]) + 1U);
+        }
+        else
+        {
+          assign(j + 1U, t[j]);
+          assign(j, j);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sets t[i], updating the mask.
+    /// The intermediate mask may be wrong, but is correct once t[] is a set again.
+    /// t[0] is a placeholder that the algorithm may write to.
+    //*************************************************************************
+    void assign(size_t i, size_t value)
+    {
+      if (i == 0U)
+      {
+        return;
+      }
+
+      bits ^= bit(size_t(t[i]) - 1U);
+      bits ^= bit(value - 1U);
+      t[i]  = element_type(value);
+    }
+
+    //*************************************************************************
+    void set_sentinel()
+    {
+      t[0U]      = element_type(0U);
+      t[K + 1U]  = element_type(N + 1U);
+    }
+
+    //*************************************************************************
+    void rebuild_mask()
+    {
+      bits = 0U;
+
+      for (size_t i = 1U; i <= K; ++i)
+      {
+        bits |= bit(size_t(t[i]) - 1U);
+      }
+    }
+
+    //*************************************************************************
+    static mask_type bit(size_t e)
+    {
+      mask_type m = 1U;
+      m <<= e;
+      return m;
+    }
+
+    etl::array<element_type, K + 2U> t;
+    mask_type                        bits;
+    size_t                           current_rank;
+    size_t                           removed_index;
+    size_t                           added_index;
+  };
+
+  template <size_t N, size_t K, typename TMask>
+  ETL_CONSTANT size_t combination_enumerator<N, K, TMask>::Npos;
+}
+
+#endif
@@ -0,0 +1,733 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPACT_LIST_INCLUDED
+#define ETL_COMPACT_LIST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "alignment.h"
+#include "iterator.h"
+#include "placement_new.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup compact_list compact_list
+/// A fixed capacity doubly linked list whose nodes are linked by index rather
+/// than by pointer. The index is the smallest unsigned type that holds the
+/// capacity, so the links of a list of up to 65535 elements take 4 bytes a
+/// node, instead of the 16 bytes of etl::list.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the compact_list.
+  ///\ingroup compact_list
+  //***************************************************************************
+  class compact_list_exception : public etl::exception
+  {
+  public:
+
+    compact_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the compact_list.
+  ///\ingroup compact_list
+  //***************************************************************************
+  class compact_list_full : public etl::compact_list_exception
+  {
+  public:
+
+    compact_list_full(string_type file_name_, numeric_type line_number_)
+      : etl::compact_list_exception(ETL_ERROR_TEXT("compact_list:full", ETL_COMPACT_LIST_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the compact_list.
+  ///\ingroup compact_list
+  //***************************************************************************
+  class compact_list_empty : public etl::compact_list_exception
+  {
+  public:
+
+    compact_list_empty(string_type file_name_, numeric_type line_number_)
+      : etl::compact_list_exception(ETL_ERROR_TEXT("compact_list:empty", ETL_COMPACT_LIST_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A fixed capacity list with index linked nodes.
+  /// The list is circular through a terminal link at index VMax_Size, which
+  /// is not a node.
+  ///\tparam T          The element type.
+  ///\tparam VMax_Size  The maximum number of elements.
+  ///\ingroup compact_list
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  class compact_list
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Size > 0U, "Zero capacity compact_list");
+
+    typedef T                                                   value_type;
+    typedef T&                                                  reference;
+    typedef const T&                                            const_reference;
+    typedef T*                                                  pointer;
+    typedef const T*                                            const_pointer;
+    typedef size_t                                              size_type;
+    typedef ptrdiff_t                                           difference_type;
+    typedef typename etl::smallest_uint_for_value<VMax_Size>::type index_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = VMax_Size;
+
+  private:
+
+    static ETL_CONSTANT index_type Terminal = index_type(VMax_Size);
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class compact_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_list(ETL_NULLPTR)
+        , index(Terminal)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        index = p_list->link(index).next;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        index = p_list->link(index).previous;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_list->value(index);
+      }
+
+      pointer operator ->() const
+      {
+        return &p_list->value(index);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(compact_list* p_list_, index_type index_)
+        : p_list(p_list_)
+        , index(index_)
+      {
+      }
+
+      compact_list* p_list;
+      index_type    index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class compact_list;
+
+      const_iterator()
+        : p_list(ETL_NULLPTR)
+        , index(Terminal)
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : p_list(other.p_list)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        index = p_list->link(index).next;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        index = p_list->link(index).previous;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_list->value(index);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_list->value(index);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const compact_list* p_list_, index_type index_)
+        : p_list(p_list_)
+        , index(index_)
+      {
+      }
+
+      const compact_list* p_list;
+      index_type          index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compact_list()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    compact_list(const compact_list& other)
+    {
+      initialise();
+      assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Constructor from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    compact_list(TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+    {
+      initialise();
+      assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~compact_list()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compact_list& operator =(const compact_list& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assigns a range of values.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_full if the range is too large.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator               begin()         { return iterator(this, terminal.next); }
+    const_iterator         begin() const   { return const_iterator(this, terminal.next); }
+    const_iterator         cbegin() const  { return const_iterator(this, terminal.next); }
+    iterator               end()           { return iterator(this, Terminal); }
+    const_iterator         end() const     { return const_iterator(this, Terminal); }
+    const_iterator         cend() const    { return const_iterator(this, Terminal); }
+    reverse_iterator       rbegin()        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const  { return const_reverse_iterator(end()); }
+    reverse_iterator       rend()          { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const    { return const_reverse_iterator(begin()); }
+
+    //*************************************************************************
+    /// Gets a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return value(terminal.next);
+    }
+
+    //*************************************************************************
+    const_reference front() const
+    {
+      return value(terminal.next);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return value(terminal.previous);
+    }
+
+    //*************************************************************************
+    const_reference back() const
+    {
+      return value(terminal.previous);
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the front.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_full if the list is full.
+    //*************************************************************************
+    void push_front(const_reference value_)
+    {
+      insert(begin(), value_);
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the back.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_full if the list is full.
+    //*************************************************************************
+    void push_back(const_reference value_)
+    {
+      insert(end(), value_);
+    }
+
+    //*************************************************************************
+    /// Removes the first value.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(compact_list_empty));
+
+      erase(begin());
+    }
+
+    //*************************************************************************
+    /// Removes the last value.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(compact_list_empty));
+
+      erase(iterator(this, terminal.previous));
+    }
+
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits an etl::compact_list_full if the list is full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value_)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(compact_list_full));
+        return end();
+      }
+
+      const index_type i = allocate();
+
+      ::new (&nodes[i].storage) T(value_);
+
+      const index_type next     = position.index;
+      const index_type previous = link(next).previous;
+
+      nodes[i].link.previous = previous;
+      nodes[i].link.next     = next;
+      link(previous).next    = i;
+      link(next).previous    = i;
+
+      ++current_size;
+
+      return iterator(this, i);
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values before 'position'.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(const_iterator position, TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(position, *first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the value at 'position'.
+    ///\return An iterator to the value after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const index_type i        = position.index;
+      const index_type next     = nodes[i].link.next;
+      const index_type previous = nodes[i].link.previous;
+
+      link(previous).next = next;
+      link(next).previous = previous;
+
+      value(i).~T();
+      release(i);
+      --current_size;
+
+      return iterator(this, next);
+    }
+
+    //*************************************************************************
+    /// Erases a range of values.
+    ///\return An iterator to the value after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(this, last.index);
+    }
+
+    //*************************************************************************
+    /// Removes the values equal to 'value_'.
+    //*************************************************************************
+    void remove(const_reference value_)
+    {
+      iterator itr = begin();
+
+      while (itr != end())
+      {
+        if (*itr == value_)
+        {
+          itr = erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Reverses the list.
+    //*************************************************************************
+    void reverse()
+    {
+      index_type i = Terminal;
+
+      do
+      {
+        link_type& l = link(i);
+        const index_type next = l.next;
+
+        l.next     = l.previous;
+        l.previous = next;
+        i          = next;
+      } while (i != Terminal);
+    }
+
+    //*************************************************************************
+    /// Clears the list.
+    //*************************************************************************
+    void clear()
+    {
+      if (!etl::is_trivially_destructible<T>::value)
+      {
+        for (index_type i = terminal.next; i != Terminal; i = nodes[i].link.next)
+        {
+          value(i).~T();
+        }
+      }
+
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks whether the list is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the list is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax_Size - current_size;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The links of a node.
+    //*************************************************************************
+    struct link_type
+    {
+      index_type previous;
+      index_type next;
+    };
+
+    //*************************************************************************
+    /// A node is its links followed by the storage for its value.
+    //*************************************************************************
+    struct node_type
+    {
+      link_type link;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+    //*************************************************************************
+    link_type& link(index_type i)
+    {
+      return (i == Terminal) ? terminal : nodes[i].link;
+    }
+
+    //*************************************************************************
+    const link_type& link(index_type i) const
+    {
+      return (i == Terminal) ? terminal : nodes[i].link;
+    }
+
+    //*************************************************************************
+    reference value(index_type i)
+    {
+      return *reinterpret_cast<T*>(&nodes[i].storage);
+    }
+
+    //*************************************************************************
+    const_reference value(index_type i) const
+    {
+      return *reinterpret_cast<const T*>(&nodes[i].storage);
+    }
+
+    //*************************************************************************
+    /// Gets a free node.
+    /// Nodes are added to the free list as they are first needed.
+    //*************************************************************************
+    index_type allocate()
+    {
+      index_type i;
+
+      if (free_head != Terminal)
+      {
+        i         = free_head;
+        free_head = nodes[i].link.next;
+      }
+      else
+      {
+        i = index_type(items_initialised++);
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    void release(index_type i)
+    {
+      nodes[i].link.next = free_head;
+      free_head          = i;
+    }
+
+    //*************************************************************************
+    void initialise()
+    {
+      terminal.previous = Terminal;
+      terminal.next     = Terminal;
+      free_head         = Terminal;
+      items_initialised = 0U;
+      current_size      = 0U;
+    }
+
+    node_type  nodes[VMax_Size];
+    link_type  terminal;
+    index_type free_head;
+    size_t     items_initialised;
+    size_t     current_size;
+  };
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT size_t compact_list<T, VMax_Size>::MAX_SIZE;
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT typename compact_list<T, VMax_Size>::index_type compact_list<T, VMax_Size>::Terminal;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup compact_list
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  bool operator ==(const etl::compact_list<T, VMax_Size>& lhs, const etl::compact_list<T, VMax_Size>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup compact_list
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  bool operator !=(const etl::compact_list<T, VMax_Size>& lhs, const etl::compact_list<T, VMax_Size>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
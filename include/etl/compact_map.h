@@ -0,0 +1,647 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COMPACT_MAP_INCLUDED
+#define ETL_COMPACT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "private/compact_tree.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup compact_map compact_map
+/// A fixed capacity map, ordered by key, whose nodes are linked by index
+/// rather than by pointer. The index is the smallest unsigned type that holds
+/// the capacity, so the links of a map of up to 65535 elements take 7 bytes
+/// a node, instead of the 24 to 32 bytes of etl::map, and more of the nodes
+/// fit in the cache.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the compact_map.
+  ///\ingroup compact_map
+  //***************************************************************************
+  class compact_map_exception : public etl::exception
+  {
+  public:
+
+    compact_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the compact_map.
+  ///\ingroup compact_map
+  //***************************************************************************
+  class compact_map_full : public etl::compact_map_exception
+  {
+  public:
+
+    compact_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::compact_map_exception(ETL_ERROR_TEXT("compact_map:full", ETL_COMPACT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the compact_map.
+  ///\ingroup compact_map
+  //***************************************************************************
+  class compact_map_out_of_bounds : public etl::compact_map_exception
+  {
+  public:
+
+    compact_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::compact_map_exception(ETL_ERROR_TEXT("compact_map:bounds", ETL_COMPACT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A fixed capacity map with index linked nodes.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam VMax_Size   The maximum number of elements.
+  ///\tparam TKeyCompare The key comparison functor.
+  ///\ingroup compact_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare = etl::less<TKey> >
+  class compact_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                   key_type;
+    typedef TMapped                                mapped_type;
+    typedef TKeyCompare                            key_compare;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type*                            pointer;
+    typedef const value_type*                      const_pointer;
+    typedef size_t                                 size_type;
+    typedef ptrdiff_t                              difference_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = VMax_Size;
+
+  private:
+
+    //*************************************************************************
+    struct key_of
+    {
+      const key_type& operator ()(const value_type& value) const
+      {
+        return value.first;
+      }
+    };
+
+    typedef etl::private_compact_tree::compact_tree<value_type, key_type, key_of, key_compare, VMax_Size> tree_type;
+    typedef typename tree_type::index_type index_type;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class compact_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_tree(ETL_NULLPTR)
+        , index(tree_type::Null)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        index = p_tree->next(index);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        index = p_tree->previous(index);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_tree->value(index);
+      }
+
+      pointer operator ->() const
+      {
+        return &p_tree->value(index);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(tree_type* p_tree_, index_type index_)
+        : p_tree(p_tree_)
+        , index(index_)
+      {
+      }
+
+      tree_type* p_tree;
+      index_type index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class compact_map;
+
+      const_iterator()
+        : p_tree(ETL_NULLPTR)
+        , index(tree_type::Null)
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : p_tree(other.p_tree)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        index = p_tree->next(index);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        index = p_tree->previous(index);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_tree->value(index);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_tree->value(index);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const tree_type* p_tree_, index_type index_)
+        : p_tree(p_tree_)
+        , index(index_)
+      {
+      }
+
+      const tree_type* p_tree;
+      index_type       index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    compact_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    compact_map(const compact_map& other)
+    {
+      insert(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Constructor from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    compact_map(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    compact_map& operator =(const compact_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        insert(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator               begin()         { return iterator(&tree, tree.first()); }
+    const_iterator         begin() const   { return const_iterator(&tree, tree.first()); }
+    const_iterator         cbegin() const  { return const_iterator(&tree, tree.first()); }
+    iterator               end()           { return iterator(&tree, tree_type::Null); }
+    const_iterator         end() const     { return const_iterator(&tree, tree_type::Null); }
+    const_iterator         cend() const    { return const_iterator(&tree, tree_type::Null); }
+    reverse_iterator       rbegin()        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const  { return const_reverse_iterator(end()); }
+    reverse_iterator       rend()          { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const    { return const_reverse_iterator(begin()); }
+
+    //*************************************************************************
+    /// Returns a reference to the mapped value for the key, inserting a
+    /// default constructed one if the key is not in the map.
+    /// If asserts or exceptions are enabled, emits an etl::compact_map_full if the map is full.
+    //*************************************************************************
+    mapped_type& operator [](const key_type& key)
+    {
+      return insert(value_type(key, mapped_type())).first->second;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::compact_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    mapped_type& at(const key_type& key)
+    {
+      iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(compact_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::compact_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(compact_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if its key is not already in the map.
+    /// If asserts or exceptions are enabled, emits an etl::compact_map_full if the map is full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      index_type parent;
+      bool       left;
+
+      const index_type existing = tree.locate(value.first, parent, left);
+
+      if (existing != tree_type::Null)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(&tree, existing), false);
+      }
+
+      if (tree.full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(compact_map_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(&tree, tree.insert_at(parent, left, value)), true);
+    }
+
+    //*************************************************************************
+    /// Inserts a value. The hint is not used.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the element with the key.
+    ///\return The number of elements erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      const index_type i = tree.find(key);
+
+      if (i == tree_type::Null)
+      {
+        return 0U;
+      }
+
+      tree.erase(i);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const index_type next = tree.next(position.index);
+
+      tree.erase(position.index);
+
+      return iterator(&tree, next);
+    }
+
+    //*************************************************************************
+    /// Erases the elements in a range.
+    ///\return An iterator to the element after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(&tree, last.index);
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      tree.clear();
+    }
+
+    //*************************************************************************
+    /// Finds the element with the key.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      return iterator(&tree, tree.find(key));
+    }
+
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return const_iterator(&tree, tree.find(key));
+    }
+
+    //*************************************************************************
+    /// Checks whether the key is in the map.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return tree.find(key) != tree_type::Null;
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key not less than 'key'.
+    //*************************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return iterator(&tree, tree.lower_bound(key));
+    }
+
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(&tree, tree.lower_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key greater than 'key'.
+    //*************************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      return iterator(&tree, tree.upper_bound(key));
+    }
+
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(&tree, tree.upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the range of elements with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison functor.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return tree.key_comp();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return tree.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return tree.empty();
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return tree.full();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax_Size - tree.size();
+    }
+
+  private:
+
+    tree_type tree;
+  };
+
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  ETL_CONSTANT size_t compact_map<TKey, TMapped, VMax_Size, TKeyCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup compact_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  bool operator ==(const etl::compact_map<TKey, TMapped, VMax_Size, TKeyCompare>& lhs,
+                   const etl::compact_map<TKey, TMapped, VMax_Size, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup compact_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  bool operator !=(const etl::compact_map<TKey, TMapped, VMax_Size, TKeyCompare>& lhs,
+                   const etl::compact_map<TKey, TMapped, VMax_Size, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,663 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+#define ETL_CONCURRENT_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex.h"
+#include "functional.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC && ETL_HAS_MUTEX
+
+///\defgroup concurrent_unordered_map concurrent_unordered_map
+/// A fixed capacity hash map that may be shared between threads.
+/// The buckets are split between a number of stripes, each with its own mutex,
+/// so that writers to different stripes do not wait for each other.
+/// Readers take no lock. Each stripe has a sequence count, in the manner of
+/// etl::seqlock, and a reader retries if a writer changed the stripe while it
+/// was searching. A reader that keeps being interrupted by writers falls back
+/// to taking the stripe's lock.
+/// There are no iterators. Values are copied out, or changed in place under
+/// the lock with 'update'.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup concurrent_unordered_map
+  /// The base class for concurrent_unordered_map.
+  /// The key and mapped types must be trivially copyable, as readers copy them
+  /// while a writer may be changing them.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TMutex = etl::mutex>
+  class iconcurrent_unordered_map
+  {
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TKey>::value,    "concurrent_unordered_map requires a trivially copyable key");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TMapped>::value, "concurrent_unordered_map requires a trivially copyable mapped type");
+
+  public:
+
+    typedef TKey      key_type;
+    typedef TMapped   mapped_type;
+    typedef THash     hasher;
+    typedef TKeyEqual key_equal;
+    typedef TMutex    mutex_type;
+    typedef size_t    size_type;
+
+    //*************************************************************************
+    /// Inserts a value, if the key is not already in the map.
+    ///\return <b>true</b> if inserted, <b>false</b> if the key exists or the map is full.
+    //*************************************************************************
+    bool insert(const key_type& key, const mapped_type& mapped)
+    {
+      const size_t bucket = bucket_of(key);
+      stripe_type& stripe = stripe_of(bucket);
+
+      etl::lock_guard<mutex_type> guard(stripe.mutex);
+
+      if (search(bucket, key) != No_Node)
+      {
+        return false;
+      }
+
+      return insert_new(stripe, bucket, key, mapped);
+    }
+
+    //*************************************************************************
+    /// Inserts a value, or assigns it if the key is already in the map.
+    ///\return <b>false</b> if the key is new and the map is full.
+    //*************************************************************************
+    bool insert_or_assign(const key_type& key, const mapped_type& mapped)
+    {
+      const size_t bucket = bucket_of(key);
+      stripe_type& stripe = stripe_of(bucket);
+
+      etl::lock_guard<mutex_type> guard(stripe.mutex);
+
+      const size_t index = search(bucket, key);
+
+      if (index == No_Node)
+      {
+        return insert_new(stripe, bucket, key, mapped);
+      }
+
+      begin_write(stripe);
+      store_words(nodes[index].mapped_words, mapped);
+      end_write(stripe);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Changes a value in place, under the stripe's lock.
+    /// 'function' is called with a reference to a copy of the value, which
+    /// then replaces it.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    template <typename TFunction>
+    bool update(const key_type& key, TFunction function)
+    {
+      const size_t bucket = bucket_of(key);
+      stripe_type& stripe = stripe_of(bucket);
+
+      etl::lock_guard<mutex_type> guard(stripe.mutex);
+
+      const size_t index = search(bucket, key);
+
+      if (index == No_Node)
+      {
+        return false;
+      }
+
+      mapped_type mapped;
+      load_words(nodes[index].mapped_words, mapped);
+
+      function(mapped);
+
+      begin_write(stripe);
+      store_words(nodes[index].mapped_words, mapped);
+      end_write(stripe);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the value with the key.
+    ///\return The number of values erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      const size_t bucket = bucket_of(key);
+      stripe_type& stripe = stripe_of(bucket);
+
+      size_t index;
+
+      {
+        etl::lock_guard<mutex_type> guard(stripe.mutex);
+
+        size_t previous = No_Node;
+        index = buckets[bucket].load(etl::memory_order_relaxed);
+
+        while ((index != No_Node) && !key_matches(index, key))
+        {
+          previous = index;
+          index    = nodes[index].next.load(etl::memory_order_relaxed);
+        }
+
+        if (index == No_Node)
+        {
+          return 0U;
+        }
+
+        const size_t next = nodes[index].next.load(etl::memory_order_relaxed);
+
+        begin_write(stripe);
+
+        if (previous == No_Node)
+        {
+          buckets[bucket].store(next, etl::memory_order_relaxed);
+        }
+        else
+        {
+          nodes[previous].next.store(next, etl::memory_order_relaxed);
+        }
+
+        end_write(stripe);
+      }
+
+      // Readers that reach the node will see the stripe's sequence has changed.
+      free_node(index);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Copies the value with the key, without taking a lock.
+    ///\return <b>true</b> if the key was found.
+    //*************************************************************************
+    bool find(const key_type& key, mapped_type& mapped) const
+    {
+      const size_t bucket = bucket_of(key);
+      stripe_type& stripe = stripe_of(bucket);
+
+      for (size_t attempt = 0U; attempt < Max_Optimistic_Reads; ++attempt)
+      {
+        const uint32_t before = stripe.sequence.load(etl::memory_order_acquire);
+
+        if ((before & 1U) == 0U)
+        {
+          const size_t index = search(bucket, key);
+
+          mapped_type copy;
+
+          if (index != No_Node)
+          {
+            load_words(nodes[index].mapped_words, copy);
+          }
+
+          etl::atomic_thread_fence(etl::memory_order_acquire);
+
+          if (stripe.sequence.load(etl::memory_order_relaxed) == before)
+          {
+            if (index != No_Node)
+            {
+              mapped = copy;
+            }
+
+            return index != No_Node;
+          }
+        }
+      }
+
+      // The writers keep getting in the way, so wait for them.
+      etl::lock_guard<mutex_type> guard(stripe.mutex);
+
+      const size_t index = search(bucket, key);
+
+      if (index != No_Node)
+      {
+        load_words(nodes[index].mapped_words, mapped);
+      }
+
+      return index != No_Node;
+    }
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      mapped_type mapped;
+
+      return find(key, mapped);
+    }
+
+    //*************************************************************************
+    /// Counts the values with the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Erases all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t s = 0U; s < number_of_stripes; ++s)
+      {
+        stripes[s].mutex.lock();
+        begin_write(stripes[s]);
+      }
+
+      initialise();
+
+      for (size_t s = number_of_stripes; s > 0U; --s)
+      {
+        end_write(stripes[s - 1U]);
+        stripes[s - 1U].mutex.unlock();
+      }
+    }
+
+    //*************************************************************************
+    /// The number of values in the map.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size.load();
+    }
+
+    //*************************************************************************
+    /// Checks if the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == max_size();
+    }
+
+    //*************************************************************************
+    /// The maximum number of values in the map.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return number_of_nodes;
+    }
+
+    //*************************************************************************
+    /// The maximum number of values in the map.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return number_of_nodes;
+    }
+
+    //*************************************************************************
+    /// The number of free spaces.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+    //*************************************************************************
+    /// The number of buckets.
+    //*************************************************************************
+    size_t bucket_count() const
+    {
+      return number_of_buckets;
+    }
+
+    //*************************************************************************
+    /// The number of lock stripes.
+    //*************************************************************************
+    size_t stripe_count() const
+    {
+      return number_of_stripes;
+    }
+
+  protected:
+
+    typedef uint32_t word_type;
+
+    static ETL_CONSTANT size_t Key_Words    = (sizeof(TKey) + sizeof(word_type) - 1U) / sizeof(word_type);
+    static ETL_CONSTANT size_t Mapped_Words = (sizeof(TMapped) + sizeof(word_type) - 1U) / sizeof(word_type);
+    static ETL_CONSTANT size_t No_Node      = etl::integral_limits<size_t>::max;
+
+    //*************************************************************************
+    /// A value. The key and mapped value are held as atomic words, so that
+    /// the copies made by readers are not data races.
+    //*************************************************************************
+    struct node_type
+    {
+      etl::atomic<size_t>    next;
+      etl::atomic<word_type> key_words[Key_Words];
+      etl::atomic<word_type> mapped_words[Mapped_Words];
+    };
+
+    //*************************************************************************
+    /// A group of buckets sharing a lock.
+    //*************************************************************************
+    struct stripe_type
+    {
+      stripe_type()
+        : sequence(0U)
+      {
+      }
+
+      mutex_type            mutex;
+      etl::atomic<uint32_t> sequence;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iconcurrent_unordered_map(node_type* nodes_, size_t number_of_nodes_,
+                              etl::atomic<size_t>* buckets_, size_t number_of_buckets_,
+                              stripe_type* stripes_, size_t number_of_stripes_)
+      : nodes(nodes_)
+      , buckets(buckets_)
+      , stripes(stripes_)
+      , number_of_nodes(number_of_nodes_)
+      , number_of_buckets(number_of_buckets_)
+      , number_of_stripes(number_of_stripes_)
+      , free_head(No_Node)
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Empties the buckets and links all of the nodes into the free list.
+    /// Called by the derived class, once its storage has been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < number_of_buckets; ++i)
+      {
+        buckets[i].store(No_Node, etl::memory_order_relaxed);
+      }
+
+      etl::lock_guard<mutex_type> guard(free_mutex);
+
+      for (size_t i = 0U; i < number_of_nodes; ++i)
+      {
+        nodes[i].next.store((i + 1U) < number_of_nodes ? (i + 1U) : No_Node, etl::memory_order_relaxed);
+      }
+
+      free_head = (number_of_nodes != 0U) ? 0U : No_Node;
+      current_size.store(0U);
+    }
+
+  private:
+
+    /// The number of lock free attempts a reader makes before taking the lock.
+    static ETL_CONSTANT size_t Max_Optimistic_Reads = 8U;
+
+    //*************************************************************************
+    size_t bucket_of(const key_type& key) const
+    {
+      return hasher()(key) % number_of_buckets;
+    }
+
+    //*************************************************************************
+    stripe_type& stripe_of(size_t bucket) const
+    {
+      return stripes[bucket % number_of_stripes];
+    }
+
+    //*************************************************************************
+    /// Searches a bucket for a key.
+    /// May be called without the lock, when the result must be validated
+    /// against the stripe's sequence. The number of steps is bounded, as an
+    /// unlocked reader may follow links that are being changed.
+    //*************************************************************************
+    size_t search(size_t bucket, const key_type& key) const
+    {
+      size_t index = buckets[bucket].load(etl::memory_order_relaxed);
+
+      for (size_t steps = 0U; (index < number_of_nodes) && (steps < number_of_nodes); ++steps)
+      {
+        if (key_matches(index, key))
+        {
+          return index;
+        }
+
+        index = nodes[index].next.load(etl::memory_order_relaxed);
+      }
+
+      return No_Node;
+    }
+
+    //*************************************************************************
+    bool key_matches(size_t index, const key_type& key) const
+    {
+      key_type node_key;
+      load_words(nodes[index].key_words, node_key);
+
+      return key_equal()(node_key, key);
+    }
+
+    //*************************************************************************
+    /// Takes a free node and links it to the front of the bucket.
+    /// The stripe's lock is held.
+    //*************************************************************************
+    bool insert_new(stripe_type& stripe, size_t bucket, const key_type& key, const mapped_type& mapped)
+    {
+      const size_t index = allocate_node();
+
+      if (index == No_Node)
+      {
+        return false;
+      }
+
+      node_type& node = nodes[index];
+
+      begin_write(stripe);
+      store_words(node.key_words, key);
+      store_words(node.mapped_words, mapped);
+      node.next.store(buckets[bucket].load(etl::memory_order_relaxed), etl::memory_order_relaxed);
+      buckets[bucket].store(index, etl::memory_order_relaxed);
+      end_write(stripe);
+
+      return true;
+    }
+
+    //*************************************************************************
+    size_t allocate_node()
+    {
+      etl::lock_guard<mutex_type> guard(free_mutex);
+
+      const size_t index = free_head;
+
+      if (index != No_Node)
+      {
+        free_head = nodes[index].next.load(etl::memory_order_relaxed);
+        ++current_size;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    void free_node(size_t index)
+    {
+      etl::lock_guard<mutex_type> guard(free_mutex);
+
+      nodes[index].next.store(free_head, etl::memory_order_relaxed);
+      free_head = index;
+      --current_size;
+    }
+
+    //*************************************************************************
+    static void begin_write(stripe_type& stripe)
+    {
+      // An odd sequence marks a write in progress.
+      stripe.sequence.store(stripe.sequence.load(etl::memory_order_relaxed) + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    static void end_write(stripe_type& stripe)
+    {
+      stripe.sequence.store(stripe.sequence.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    template <typename T, size_t N>
+    static void store_words(etl::atomic<word_type> (&words)[N], const T& value)
+    {
+      word_type copy[N];
+
+      copy[N - 1U] = 0U;
+      memcpy(copy, &value, sizeof(T));
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        words[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    template <typename T, size_t N>
+    static void load_words(const etl::atomic<word_type> (&words)[N], T& value)
+    {
+      word_type copy[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        copy[i] = words[i].load(etl::memory_order_relaxed);
+      }
+
+      memcpy(&value, copy, sizeof(T));
+    }
+
+    node_type* const           nodes;
+    etl::atomic<size_t>* const buckets;
+    stripe_type* const         stripes;
+
+    const size_t number_of_nodes;
+    const size_t number_of_buckets;
+    const size_t number_of_stripes;
+
+    mutex_type          free_mutex;
+    size_t              free_head;
+    etl::atomic<size_t> current_size;
+
+    // Disable copy construction and assignment.
+    iconcurrent_unordered_map(const iconcurrent_unordered_map&) ETL_DELETE;
+    iconcurrent_unordered_map& operator =(const iconcurrent_unordered_map&) ETL_DELETE;
+  };
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex>::Key_Words;
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex>::Mapped_Words;
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex>::No_Node;
+
+  template <typename TKey, typename TMapped, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex>::Max_Optimistic_Reads;
+
+  //***************************************************************************
+  ///\ingroup concurrent_unordered_map
+  /// A fixed capacity hash map that may be shared between threads.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam MAX_SIZE_   The maximum number of values.
+  ///\tparam MAX_BUCKETS_ The number of buckets.
+  ///\tparam MAX_STRIPES_ The number of lock stripes.
+  ///\tparam TMutex      The lock type, such as etl::mutex or etl::spin_mutex.
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_ = MAX_SIZE_, const size_t MAX_STRIPES_ = 8U,
+            typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename TMutex = etl::mutex>
+  class concurrent_unordered_map : public etl::iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex>
+  {
+  private:
+
+    typedef etl::iconcurrent_unordered_map<TKey, TMapped, THash, TKeyEqual, TMutex> base;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U),    "Zero capacity");
+    ETL_STATIC_ASSERT((MAX_BUCKETS_ > 0U), "Zero buckets");
+    ETL_STATIC_ASSERT((MAX_STRIPES_ > 0U), "Zero stripes");
+
+    static ETL_CONSTANT size_t MAX_SIZE    = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_BUCKETS = MAX_BUCKETS_;
+    static ETL_CONSTANT size_t MAX_STRIPES = (MAX_STRIPES_ < MAX_BUCKETS_) ? MAX_STRIPES_ : MAX_BUCKETS_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    concurrent_unordered_map()
+      : base(node_storage, MAX_SIZE, bucket_storage, MAX_BUCKETS, stripe_storage, MAX_STRIPES)
+    {
+      base::initialise();
+    }
+
+  private:
+
+    typename base::node_type   node_storage[MAX_SIZE];
+    etl::atomic<size_t>        bucket_storage[MAX_BUCKETS];
+    typename base::stripe_type stripe_storage[MAX_STRIPES];
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual, TMutex>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual, TMutex>::MAX_BUCKETS;
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, const size_t MAX_BUCKETS_, const size_t MAX_STRIPES_, typename THash, typename TKeyEqual, typename TMutex>
+  ETL_CONSTANT size_t concurrent_unordered_map<TKey, TMapped, MAX_SIZE_, MAX_BUCKETS_, MAX_STRIPES_, THash, TKeyEqual, TMutex>::MAX_STRIPES;
+}
+
+#endif
+#endif
@@ -0,0 +1,555 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONST_MAP_INCLUDED
+#define ETL_CONST_MAP_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "functional.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup const_map const_map
+/// An immutable map that may be constructed at compile time.
+/// The elements are sorted by key when the map is constructed, so a
+/// 'static constexpr' table needs no start up code and lives in read only
+/// memory. Lookup is a binary search, O(logN).
+/// Requires C++14 or above for compile time construction.
+/// Keys must be unique. is_valid() may be used in a static_assert to check.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_USING_CPP14
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_exception : public etl::exception
+  {
+  public:
+
+    const_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the const_map.
+  ///\ingroup const_map
+  //***************************************************************************
+  class const_map_out_of_bounds : public etl::const_map_exception
+  {
+  public:
+
+    const_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::const_map_exception(ETL_ERROR_TEXT("const_map:bounds", ETL_CONST_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An immutable map that may be constructed at compile time.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam Size        The number of elements.
+  ///\tparam TKeyCompare The key comparison type.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Size, typename TKeyCompare = etl::less<TKey> >
+  class const_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Size > 0U, "const_map must have at least one element");
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                  key_type;
+    typedef TMapped                               mapped_type;
+    typedef TKeyCompare                           key_compare;
+    typedef const value_type&                     const_reference;
+    typedef const value_type*                     const_pointer;
+    typedef const mapped_type&                    const_mapped_reference;
+    typedef const key_type&                       const_key_reference;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    typedef const value_type*                            const_iterator;
+    typedef const_iterator                               iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    static ETL_CONSTANT size_t MAX_SIZE = Size;
+
+    //*************************************************************************
+    /// Constructs the map from an array of elements in any order.
+    /// The elements are sorted by key. Equal keys keep their relative order.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit const_map(const value_type (&values)[Size])
+      : const_map(values, sorted_order(values), etl::make_index_sequence<Size>())
+    {
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator begin() const
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cbegin() const
+    {
+      return element_list;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator end() const
+    {
+      return element_list + Size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator cend() const
+    {
+      return element_list + Size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value mapped to the key.
+    /// If asserts or exceptions are enabled, emits const_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_mapped_reference at(const_key_reference key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(const_map_out_of_bounds));
+
+      return itr->second;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_mapped_reference at(const K& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(const_map_out_of_bounds));
+
+      return itr->second;
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds an element.
+    ///\return An iterator to the element or end() if not found.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator find(const_key_reference key) const
+    {
+      return find_element(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator find(const K& key) const
+    {
+      return find_element(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks if the map contains the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains(const_key_reference key) const
+    {
+      return find_element(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 bool contains(const K& key) const
+    {
+      return find_element(key) != end();
+    }
+#endif
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t count(const_key_reference key) const
+    {
+      return (find_element(key) != end()) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 size_t count(const K& key) const
+    {
+      return (find_element(key) != end()) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key not less than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator lower_bound(const_key_reference key) const
+    {
+      return lower_bound_element(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator lower_bound(const K& key) const
+    {
+      return lower_bound_element(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key greater than the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const_iterator upper_bound(const_key_reference key) const
+    {
+      return upper_bound_element(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 const_iterator upper_bound(const K& key) const
+    {
+      return upper_bound_element(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Returns the range of elements with the key.
+    //*************************************************************************
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound_element(key), upper_bound_element(key));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    ETL_CONSTEXPR14 ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound_element(key), upper_bound_element(key));
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks that the keys are unique.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_valid() const
+    {
+      for (size_t i = 1U; i < Size; ++i)
+      {
+        if (!key_compare()(element_list[i - 1U].first, element_list[i].first))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison function.
+    //*************************************************************************
+    ETL_CONSTEXPR14 key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type size() const
+    {
+      return Size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the map is empty.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type max_size() const
+    {
+      return Size;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_type capacity() const
+    {
+      return Size;
+    }
+
+  private:
+
+    /// The sorted positions of the constructor's elements.
+    struct order_t
+    {
+      size_t index[Size];
+    };
+
+    //*************************************************************************
+    /// Copies the elements in sorted order.
+    //*************************************************************************
+    template <size_t... Indices>
+    ETL_CONSTEXPR14 const_map(const value_type (&values)[Size], const order_t& order, etl::index_sequence<Indices...>)
+      : element_list{ values[order.index[Indices]]... }
+    {
+    }
+
+    //*************************************************************************
+    /// Returns the sorted order of the elements, using a stable bottom up
+    /// merge sort, as compile time evaluation limits rule out O(N^2) sorts
+    /// for larger tables.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 order_t sorted_order(const value_type (&values)[Size])
+    {
+      order_t order   = {};
+      order_t scratch = {};
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        order.index[i] = i;
+      }
+
+      for (size_t width = 1U; width < Size; width *= 2U)
+      {
+        for (size_t left = 0U; left < Size; left += 2U * width)
+        {
+          const size_t middle = ((Size - left) > width)        ? left + width        : Size;
+          const size_t right  = ((Size - left) > (2U * width)) ? left + (2U * width) : Size;
+
+          size_t i = left;
+          size_t j = middle;
+
+          for (size_t k = left; k < right; ++k)
+          {
+            // Only take from the right run when it is less, to keep the sort stable.
+            if ((j < right) && ((i == middle) || key_compare()(values[order.index[j]].first, values[order.index[i]].first)))
+            {
+              scratch.index[k] = order.index[j++];
+            }
+            else
+            {
+              scratch.index[k] = order.index[i++];
+            }
+          }
+        }
+
+        order = scratch;
+      }
+
+      return order;
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator lower_bound_element(const K& key) const
+    {
+      const_iterator first = element_list;
+      size_t         count = Size;
+
+      while (count > 0U)
+      {
+        const size_t   step = count / 2U;
+        const_iterator itr  = first + step;
+
+        if (key_compare()(itr->first, key))
+        {
+          first  = itr + 1;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator upper_bound_element(const K& key) const
+    {
+      const_iterator first = element_list;
+      size_t         count = Size;
+
+      while (count > 0U)
+      {
+        const size_t   step = count / 2U;
+        const_iterator itr  = first + step;
+
+        if (!key_compare()(key, itr->first))
+        {
+          first  = itr + 1;
+          count -= step + 1U;
+        }
+        else
+        {
+          count = step;
+        }
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    template <typename K>
+    ETL_CONSTEXPR14 const_iterator find_element(const K& key) const
+    {
+      const_iterator itr = lower_bound_element(key);
+
+      if ((itr != end()) && !key_compare()(key, itr->first))
+      {
+        return itr;
+      }
+
+      return end();
+    }
+
+    value_type element_list[Size];
+  };
+
+  template <typename TKey, typename TMapped, size_t Size, typename TKeyCompare>
+  ETL_CONSTANT size_t const_map<TKey, TMapped, Size, TKeyCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Makes a const_map from an array of elements, deducing the size.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey>, size_t Size>
+  ETL_CONSTEXPR14 etl::const_map<TKey, TMapped, Size, TKeyCompare> make_const_map(const ETL_OR_STD::pair<const TKey, TMapped> (&values)[Size])
+  {
+    return etl::const_map<TKey, TMapped, Size, TKeyCompare>(values);
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Size, typename TKeyCompare>
+  ETL_CONSTEXPR14 bool operator ==(const etl::const_map<TKey, TMapped, Size, TKeyCompare>& lhs, const etl::const_map<TKey, TMapped, Size, TKeyCompare>& rhs)
+  {
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      if (!((lhs.begin()[i].first == rhs.begin()[i].first) && (lhs.begin()[i].second == rhs.begin()[i].second)))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup const_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t Size, typename TKeyCompare>
+  ETL_CONSTEXPR14 bool operator !=(const etl::const_map<TKey, TMapped, Size, TKeyCompare>& lhs, const etl::const_map<TKey, TMapped, Size, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,740 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CORO_TASK_INCLUDED
+#define ETL_CORO_TASK_INCLUDED
+
+#include "platform.h"
+#include "task.h"
+#include "generic_pool.h"
+#include "atomic.h"
+#include "utility.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_USING_CPP20 && ETL_USING_STL && defined(__cpp_impl_coroutine)
+  #define ETL_USING_CORO_TASK 1
+  #include <coroutine>
+  #include <exception>
+#else
+  #define ETL_USING_CORO_TASK 0
+#endif
+
+///\defgroup coro_task coro_task
+/// Tasks for etl::scheduler written as C++20 coroutines, with frames
+/// allocated from a fixed pool.
+/// A waiting coroutine's condition is checked each time the scheduler polls
+/// the task, so the polling scheduler policies must be used, not
+/// scheduler_policy_ready_priority.
+///\ingroup containers
+
+#if ETL_USING_CORO_TASK
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for coroutine frame allocators.
+  /// allocate_frame returns a null pointer if there is no space.
+  ///\ingroup coro_task
+  //***************************************************************************
+  class icoro_frame_allocator
+  {
+  public:
+
+    virtual void* allocate_frame(size_t size) = 0;
+    virtual void  release_frame(void* p_frame) = 0;
+
+  protected:
+
+    ~icoro_frame_allocator()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The space that each frame allocation uses for its allocator pointer.
+  ///\ingroup coro_task
+  //***************************************************************************
+  ETL_INLINE_VAR constexpr size_t coro_frame_header_size = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+  //***************************************************************************
+  /// A coroutine frame allocator using a fixed pool of same sized blocks.
+  /// The frame size of a coroutine is only known to the compiler, so
+  /// VFrame_Size must be found by trial. It includes coro_frame_header_size.
+  ///\tparam VFrame_Size The size of each block.
+  ///\tparam VN_Frames   The number of blocks.
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <size_t VFrame_Size, size_t VN_Frames>
+  class coro_frame_pool : public icoro_frame_allocator
+  {
+  public:
+
+    static constexpr size_t Frame_Size = VFrame_Size;
+    static constexpr size_t N_Frames   = VN_Frames;
+
+    //*******************************************
+    /// Allocates a frame, or returns a null pointer if the frame is too large
+    /// or the pool is empty.
+    //*******************************************
+    void* allocate_frame(size_t size) ETL_OVERRIDE
+    {
+      if ((size > Frame_Size) || pool.full())
+      {
+        return ETL_NULLPTR;
+      }
+
+      return pool.template allocate<frame_t>();
+    }
+
+    //*******************************************
+    /// Releases a frame.
+    //*******************************************
+    void release_frame(void* p_frame) ETL_OVERRIDE
+    {
+      pool.release(p_frame);
+    }
+
+    //*******************************************
+    /// The number of free frames.
+    //*******************************************
+    size_t available() const
+    {
+      return pool.available();
+    }
+
+  private:
+
+    static constexpr size_t Alignment = __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    typedef typename etl::aligned_storage<Frame_Size, Alignment>::type frame_t;
+
+    etl::generic_pool<sizeof(frame_t), Alignment, N_Frames> pool;
+  };
+
+  class coro_routine;
+
+  //***************************************************************************
+  /// The part of the coroutine promise that does not depend on the
+  /// coroutine's parameters.
+  ///\ingroup coro_task
+  //***************************************************************************
+  class coro_promise_base
+  {
+  public:
+
+    //*******************************************
+    std::suspend_always initial_suspend() noexcept
+    {
+      return {};
+    }
+
+    //*******************************************
+    std::suspend_always final_suspend() noexcept
+    {
+      return {};
+    }
+
+    //*******************************************
+    void return_void()
+    {
+    }
+
+    //*******************************************
+    void unhandled_exception()
+    {
+      std::terminate();
+    }
+
+    //*******************************************
+    /// Checks whether the condition the coroutine is waiting for is met.
+    //*******************************************
+    bool is_ready() const
+    {
+      return (p_ready == ETL_NULLPTR) || p_ready(p_context);
+    }
+
+    //*******************************************
+    /// Sets the condition that the coroutine is waiting for.
+    /// Called by awaiters when the coroutine suspends.
+    //*******************************************
+    void wait_for(bool (*p_ready_)(const void*), const void* p_context_)
+    {
+      p_ready   = p_ready_;
+      p_context = p_context_;
+    }
+
+    //*******************************************
+    /// Clears the wait condition.
+    //*******************************************
+    void clear_wait()
+    {
+      p_ready   = ETL_NULLPTR;
+      p_context = ETL_NULLPTR;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Allocates a frame with space for the allocator pointer in front.
+    //*******************************************
+    static void* allocate(size_t size, etl::icoro_frame_allocator& allocator)
+    {
+      char* p_block = static_cast<char*>(allocator.allocate_frame(size + coro_frame_header_size));
+
+      if (p_block == ETL_NULLPTR)
+      {
+        return ETL_NULLPTR;
+      }
+
+      *reinterpret_cast<etl::icoro_frame_allocator**>(p_block) = &allocator;
+
+      return p_block + coro_frame_header_size;
+    }
+
+    //*******************************************
+    /// Releases a frame to the allocator that it came from.
+    //*******************************************
+    static void release(void* p_frame)
+    {
+      char* p_block = static_cast<char*>(p_frame) - coro_frame_header_size;
+
+      etl::icoro_frame_allocator* p_allocator = *reinterpret_cast<etl::icoro_frame_allocator**>(p_block);
+      p_allocator->release_frame(p_block);
+    }
+
+  private:
+
+    bool (*p_ready)(const void*) = ETL_NULLPTR;
+    const void* p_context        = ETL_NULLPTR;
+  };
+
+  namespace private_coro_task
+  {
+    //*******************************************
+    /// Finds the first parameter that is a frame allocator.
+    //*******************************************
+    template <typename T, typename... TRest>
+    etl::icoro_frame_allocator& find_allocator(T& first, TRest&... rest)
+    {
+      if constexpr (etl::is_base_of<etl::icoro_frame_allocator, etl::remove_cv_t<T>>::value)
+      {
+        return first;
+      }
+      else
+      {
+        return find_allocator(rest...);
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// The promise for a coroutine returning etl::coro_routine.
+  /// The parameters are those of the coroutine, with the object first for a
+  /// member function.
+  /// operator new and operator delete are declared together, and operator new
+  /// is not a template, so that compilers pair them as a matching allocation.
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <typename... TArgs>
+  class coro_promise : public etl::coro_promise_base
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<etl::icoro_frame_allocator, etl::remove_cvref_t<TArgs>>::value || ...),
+                      "A coroutine returning etl::coro_routine must have an etl::icoro_frame_allocator parameter");
+
+    //*******************************************
+    etl::coro_routine get_return_object();
+
+    //*******************************************
+    static etl::coro_routine get_return_object_on_allocation_failure();
+
+    //*******************************************
+    /// Allocates the frame from the coroutine's allocator parameter.
+    //*******************************************
+    static void* operator new(size_t size, etl::remove_reference_t<TArgs>&... args) noexcept
+    {
+      return allocate(size, private_coro_task::find_allocator(args...));
+    }
+
+    //*******************************************
+    /// Releases the frame to the allocator that it came from.
+    //*******************************************
+    static void operator delete(void* p_frame) noexcept
+    {
+      release(p_frame);
+    }
+  };
+
+  //***************************************************************************
+  /// The return type of a coroutine run by an etl::coro_task.
+  /// The frame is allocated from the first etl::icoro_frame_allocator parameter
+  /// of the coroutine. There is no fallback to the heap.
+  /// If the allocator has no space the routine is invalid.
+  ///\ingroup coro_task
+  //***************************************************************************
+  class coro_routine
+  {
+  public:
+
+    //*******************************************
+    /// Constructs an invalid routine.
+    //*******************************************
+    coro_routine()
+      : handle()
+      , p_promise(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Move constructor.
+    //*******************************************
+    coro_routine(coro_routine&& other)
+      : handle(other.handle)
+      , p_promise(other.p_promise)
+    {
+      other.handle    = std::coroutine_handle<>();
+      other.p_promise = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Move assignment.
+    //*******************************************
+    coro_routine& operator =(coro_routine&& other)
+    {
+      if (this != &other)
+      {
+        destroy();
+        handle          = other.handle;
+        p_promise       = other.p_promise;
+        other.handle    = std::coroutine_handle<>();
+        other.p_promise = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+
+    //*******************************************
+    /// Destructor. Destroys the coroutine frame.
+    //*******************************************
+    ~coro_routine()
+    {
+      destroy();
+    }
+
+    //*******************************************
+    /// Checks whether the routine has a coroutine frame.
+    //*******************************************
+    bool valid() const
+    {
+      return bool(handle);
+    }
+
+    //*******************************************
+    /// Checks whether the coroutine has finished.
+    //*******************************************
+    bool done() const
+    {
+      return !handle || handle.done();
+    }
+
+    //*******************************************
+    /// Checks whether the coroutine can be resumed.
+    //*******************************************
+    bool is_ready() const
+    {
+      return !done() && p_promise->is_ready();
+    }
+
+    //*******************************************
+    /// Resumes the coroutine until it next suspends.
+    //*******************************************
+    void resume()
+    {
+      p_promise->clear_wait();
+      handle.resume();
+    }
+
+    //*******************************************
+    /// Destroys the coroutine frame.
+    //*******************************************
+    void destroy()
+    {
+      if (handle)
+      {
+        handle.destroy();
+        handle    = std::coroutine_handle<>();
+        p_promise = ETL_NULLPTR;
+      }
+    }
+
+  private:
+
+    template <typename...>
+    friend class coro_promise;
+
+    coro_routine(std::coroutine_handle<> handle_, etl::coro_promise_base& promise)
+      : handle(handle_)
+      , p_promise(&promise)
+    {
+    }
+
+    coro_routine(const coro_routine&) ETL_DELETE;
+    coro_routine& operator =(const coro_routine&) ETL_DELETE;
+
+    std::coroutine_handle<>  handle;
+    etl::coro_promise_base* p_promise;
+  };
+
+  //*******************************************
+  template <typename... TArgs>
+  etl::coro_routine coro_promise<TArgs...>::get_return_object()
+  {
+    return etl::coro_routine(std::coroutine_handle<coro_promise>::from_promise(*this), *this);
+  }
+
+  //*******************************************
+  template <typename... TArgs>
+  etl::coro_routine coro_promise<TArgs...>::get_return_object_on_allocation_failure()
+  {
+    return etl::coro_routine();
+  }
+}
+
+//*****************************************************************************
+/// Selects etl::coro_promise for coroutines returning etl::coro_routine.
+//*****************************************************************************
+template <typename... TArgs>
+struct std::coroutine_traits<etl::coro_routine, TArgs...>
+{
+  typedef etl::coro_promise<TArgs...> promise_type;
+};
+
+namespace etl
+{
+  //***************************************************************************
+  /// A task that runs a coroutine.
+  /// Reports work when the coroutine is waiting for nothing, or for a
+  /// condition that is now met, and resumes it to do the work.
+  /// For use with the polling scheduler policies.
+  ///\ingroup coro_task
+  //***************************************************************************
+  class coro_task : public etl::task
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    coro_task(etl::task_priority_t priority)
+      : task(priority)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    coro_task(etl::task_priority_t priority, etl::coro_routine&& routine_)
+      : task(priority)
+      , routine(etl::move(routine_))
+    {
+    }
+
+    //*******************************************
+    /// Sets the coroutine to run, destroying any previous one.
+    //*******************************************
+    void set_routine(etl::coro_routine&& routine_)
+    {
+      routine = etl::move(routine_);
+    }
+
+    //*******************************************
+    /// Checks whether the coroutine has finished, or there is none.
+    //*******************************************
+    bool is_done() const
+    {
+      return routine.done();
+    }
+
+    //*******************************************
+    /// Returns 1 if the coroutine can be resumed, otherwise 0.
+    //*******************************************
+    uint32_t task_request_work() const ETL_OVERRIDE
+    {
+      return (task_is_running() && routine.is_ready()) ? 1U : 0U;
+    }
+
+    //*******************************************
+    /// Resumes the coroutine until it next suspends.
+    //*******************************************
+    void task_process_work() ETL_OVERRIDE
+    {
+      if (task_request_work() != 0U)
+      {
+        routine.resume();
+      }
+    }
+
+  private:
+
+    etl::coro_routine routine;
+  };
+
+  //***************************************************************************
+  /// Awaits a pop from a queue, such as etl::queue_spsc_atomic.
+  /// The queue must have bool pop(value_type&) and empty().
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <typename TQueue>
+  class coro_pop_awaiter
+  {
+  public:
+
+    typedef typename TQueue::value_type value_type;
+
+    explicit coro_pop_awaiter(TQueue& queue_)
+      : queue(queue_)
+      , value()
+      , popped(false)
+    {
+    }
+
+    bool await_ready()
+    {
+      popped = queue.pop(value);
+
+      return popped;
+    }
+
+    template <typename TPromise>
+    void await_suspend(std::coroutine_handle<TPromise> handle)
+    {
+      handle.promise().wait_for(&is_not_empty, &queue);
+    }
+
+    value_type await_resume()
+    {
+      if (!popped)
+      {
+        queue.pop(value);
+      }
+
+      return etl::move(value);
+    }
+
+  private:
+
+    static bool is_not_empty(const void* p_queue)
+    {
+      return !static_cast<const TQueue*>(p_queue)->empty();
+    }
+
+    TQueue&    queue;
+    value_type value;
+    bool       popped;
+  };
+
+  //***************************************************************************
+  /// Suspends until a value can be popped from the queue, then returns it.
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <typename TQueue>
+  etl::coro_pop_awaiter<TQueue> coro_pop(TQueue& queue)
+  {
+    return etl::coro_pop_awaiter<TQueue>(queue);
+  }
+
+  //***************************************************************************
+  /// A flag that a coroutine can wait for, such as a timer expiry.
+  /// May be set from a callback timer or an interrupt.
+  /// Waiting consumes the flag.
+  ///\ingroup coro_task
+  //***************************************************************************
+  class coro_flag
+  {
+  public:
+
+    coro_flag()
+      : flag(false)
+    {
+    }
+
+    //*******************************************
+    /// Sets the flag, allowing a waiting coroutine to continue.
+    //*******************************************
+    void set()
+    {
+      flag.store(true);
+    }
+
+    //*******************************************
+    /// Clears the flag.
+    //*******************************************
+    void reset()
+    {
+      flag.store(false);
+    }
+
+    //*******************************************
+    /// Checks whether the flag is set.
+    //*******************************************
+    bool is_set() const
+    {
+      return flag.load();
+    }
+
+    //*******************************************
+    /// The awaiter.
+    //*******************************************
+    class awaiter
+    {
+    public:
+
+      explicit awaiter(coro_flag& owner_)
+        : owner(owner_)
+      {
+      }
+
+      bool await_ready()
+      {
+        return owner.is_set();
+      }
+
+      template <typename TPromise>
+      void await_suspend(std::coroutine_handle<TPromise> handle)
+      {
+        handle.promise().wait_for(&is_set, &owner);
+      }
+
+      void await_resume()
+      {
+        owner.reset();
+      }
+
+    private:
+
+      static bool is_set(const void* p_owner)
+      {
+        return static_cast<const coro_flag*>(p_owner)->is_set();
+      }
+
+      coro_flag& owner;
+    };
+
+    //*******************************************
+    /// Suspends until the flag is set.
+    //*******************************************
+    awaiter operator co_await()
+    {
+      return awaiter(*this);
+    }
+
+  private:
+
+    etl::atomic<bool> flag;
+  };
+
+  //***************************************************************************
+  /// Awaits a number of ticks of a clock.
+  /// TClock is a callable returning an unsigned tick count, which may wrap.
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <typename TClock>
+  class coro_delay_awaiter
+  {
+  public:
+
+    typedef typename etl::decay<decltype(etl::declval<TClock&>()())>::type tick_type;
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<tick_type>::value, "The clock must return an unsigned tick count");
+
+    coro_delay_awaiter(TClock& clock_, tick_type ticks_)
+      : clock(clock_)
+      , start(clock_())
+      , ticks(ticks_)
+    {
+    }
+
+    bool await_ready() const
+    {
+      return expired(this);
+    }
+
+    template <typename TPromise>
+    void await_suspend(std::coroutine_handle<TPromise> handle)
+    {
+      handle.promise().wait_for(&expired, this);
+    }
+
+    void await_resume()
+    {
+    }
+
+  private:
+
+    static bool expired(const void* p_awaiter)
+    {
+      const coro_delay_awaiter& awaiter = *static_cast<const coro_delay_awaiter*>(p_awaiter);
+
+      const tick_type elapsed = awaiter.clock() - awaiter.start;
+
+      return elapsed >= awaiter.ticks;
+    }
+
+    TClock&   clock;
+    tick_type start;
+    tick_type ticks;
+  };
+
+  //***************************************************************************
+  /// Suspends until 'ticks' ticks of 'clock' have passed.
+  ///\ingroup coro_task
+  //***************************************************************************
+  template <typename TClock, typename TTicks>
+  etl::coro_delay_awaiter<TClock> coro_delay(TClock& clock, TTicks ticks)
+  {
+    return etl::coro_delay_awaiter<TClock>(clock, typename etl::coro_delay_awaiter<TClock>::tick_type(ticks));
+  }
+
+  //***************************************************************************
+  /// Suspends until the next time the scheduler calls the task.
+  ///\ingroup coro_task
+  //***************************************************************************
+  inline std::suspend_always coro_yield()
+  {
+    return {};
+  }
+}
+
+#endif
+#endif
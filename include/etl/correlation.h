@@ -34,6 +34,7 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "static_assert.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -68,6 +69,27 @@ namespace etl
     {
       typedef double calc_t;
     };
+
+    //***************************************************************************
+    /// The default calculation type for welford_correlation.
+    //***************************************************************************
+    template <typename TInput>
+    struct welford_correlation_traits
+    {
+      typedef double calc_t;
+    };
+
+    template <>
+    struct welford_correlation_traits<float>
+    {
+      typedef float calc_t;
+    };
+
+    template <>
+    struct welford_correlation_traits<long double>
+    {
+      typedef long double calc_t;
+    };
   }
 
   //***************************************************************************
@@ -174,6 +196,20 @@ namespace etl
       add(first1, last1, first2);
     }
 
+    //*********************************
+    /// Merge the values added to another correlation.
+    //*********************************
+    void merge(const correlation& other)
+    {
+      inner_product   += other.inner_product;
+      sum_of_squares1 += other.sum_of_squares1;
+      sum_of_squares2 += other.sum_of_squares2;
+      sum1            += other.sum1;
+      sum2            += other.sum2;
+      counter         += other.counter;
+      recalculate     = true;
+    }
+
     //*********************************
     /// Get the correlation.
     //*********************************
@@ -287,6 +323,238 @@ namespace etl
 
   template <bool Correlation_Type, typename TInput, typename TCalc>
   ETL_CONSTANT int correlation<Correlation_Type, TInput, TCalc>::Adjustment;
+
+  //***************************************************************************
+  /// Correlation, using Welford's algorithm.
+  /// Keeps running means and the sums of products of differences from them,
+  /// which do not lose precision over long runs in the way that raw sums do.
+  /// Partial results may be merged, and pairs removed for sliding windows.
+  //***************************************************************************
+  template <bool Correlation_Type, typename TInput, typename TCalc = typename private_correlation::welford_correlation_traits<TInput>::calc_t>
+  class welford_correlation
+    : public etl::binary_function<TInput, TInput, void>
+  {
+  private:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    static ETL_CONSTANT int Adjustment = (Correlation_Type == correlation_type::Population) ? 0 : 1;
+
+  public:
+
+    typedef TCalc calc_t;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    welford_correlation()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    welford_correlation(TIterator first1, TIterator last1, TIterator first2)
+    {
+      clear();
+      add(first1, last1, first2);
+    }
+
+    //*********************************
+    /// Add a pair of values.
+    //*********************************
+    void add(TInput value1, TInput value2)
+    {
+      const calc_t x = calc_t(value1);
+      const calc_t y = calc_t(value2);
+
+      ++counter;
+
+      const calc_t n      = calc_t(counter);
+      const calc_t delta1 = x - mean1;
+      const calc_t delta2 = y - mean2;
+
+      mean1 += delta1 / n;
+      mean2 += delta2 / n;
+
+      m2_1 += delta1 * (x - mean1);
+      m2_2 += delta2 * (y - mean2);
+      c_12 += delta1 * (y - mean2);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first1, TIterator last1, TIterator first2)
+    {
+      while (first1 != last1)
+      {
+        add(*first1, *first2);
+        ++first1;
+        ++first2;
+      }
+    }
+
+    //*********************************
+    /// Remove a pair of values that was previously added.
+    //*********************************
+    void remove(TInput value1, TInput value2)
+    {
+      if (counter <= 1U)
+      {
+        clear();
+        return;
+      }
+
+      const calc_t x = calc_t(value1);
+      const calc_t y = calc_t(value2);
+
+      --counter;
+
+      const calc_t n      = calc_t(counter);
+      const calc_t delta1 = x - mean1;
+      const calc_t delta2 = y - mean2;
+
+      mean1 -= delta1 / n;
+      mean2 -= delta2 / n;
+
+      m2_1 -= delta1 * (x - mean1);
+      m2_2 -= delta2 * (y - mean2);
+      c_12 -= delta1 * (y - mean2);
+
+      // Guard against rounding taking them below zero.
+      if (m2_1 < calc_t(0))
+      {
+        m2_1 = calc_t(0);
+      }
+
+      if (m2_2 < calc_t(0))
+      {
+        m2_2 = calc_t(0);
+      }
+    }
+
+    //*********************************
+    /// Merge the values added to another correlation.
+    //*********************************
+    void merge(const welford_correlation& other)
+    {
+      if (other.counter == 0U)
+      {
+        return;
+      }
+
+      if (counter == 0U)
+      {
+        *this = other;
+        return;
+      }
+
+      const calc_t n1     = calc_t(counter);
+      const calc_t n2     = calc_t(other.counter);
+      const calc_t n      = n1 + n2;
+      const calc_t delta1 = other.mean1 - mean1;
+      const calc_t delta2 = other.mean2 - mean2;
+      const calc_t weight = (n1 * n2) / n;
+
+      mean1   += delta1 * (n2 / n);
+      mean2   += delta2 * (n2 / n);
+      m2_1    += other.m2_1 + ((delta1 * delta1) * weight);
+      m2_2    += other.m2_2 + ((delta2 * delta2) * weight);
+      c_12    += other.c_12 + ((delta1 * delta2) * weight);
+      counter += other.counter;
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a pair of values.
+    //*********************************
+    void operator ()(TInput value1, TInput value2)
+    {
+      add(value1, value2);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first1, TIterator last1, TIterator first2)
+    {
+      add(first1, last1, first2);
+    }
+
+    //*********************************
+    /// Get the covariance.
+    //*********************************
+    double get_covariance() const
+    {
+      if (counter > uint32_t(Adjustment))
+      {
+        return double(c_12 / calc_t(counter - uint32_t(Adjustment)));
+      }
+
+      return 0.0;
+    }
+
+    //*********************************
+    /// Get the correlation.
+    //*********************************
+    double get_correlation() const
+    {
+      // The adjustment cancels out.
+      if ((m2_1 > calc_t(0)) && (m2_2 > calc_t(0)))
+      {
+        return double(c_12) / sqrt(double(m2_1) * double(m2_2));
+      }
+
+      return 0.0;
+    }
+
+    //*********************************
+    /// Get the correlation.
+    //*********************************
+    operator double() const
+    {
+      return get_correlation();
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(counter);
+    }
+
+    //*********************************
+    /// Clear the correlation.
+    //*********************************
+    void clear()
+    {
+      mean1   = calc_t(0);
+      mean2   = calc_t(0);
+      m2_1    = calc_t(0);
+      m2_2    = calc_t(0);
+      c_12    = calc_t(0);
+      counter = 0U;
+    }
+
+  private:
+
+    calc_t   mean1;
+    calc_t   mean2;
+    calc_t   m2_1;
+    calc_t   m2_2;
+    calc_t   c_12;
+    uint32_t counter;
+  };
+
+  template <bool Correlation_Type, typename TInput, typename TCalc>
+  ETL_CONSTANT int welford_correlation<Correlation_Type, TInput, TCalc>::Adjustment;
 }
 
 #endif
@@ -0,0 +1,240 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_COUNT_MIN_SKETCH_INCLUDED
+#define ETL_COUNT_MIN_SKETCH_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "bloom_filter.h"
+#include "integral_limits.h"
+#include "hash.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stdint.h>
+
+///\defgroup count_min_sketch count_min_sketch
+/// A Count-Min sketch frequency estimator.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Estimates how many times each key has been added, in a fixed
+  /// VDepth x Width array of counters. An estimate is never less than the true
+  /// count, and exceeds it by more than e * total / Width with a probability of
+  /// at most e^-VDepth.
+  /// Adds use conservative update, incrementing only the counters that hold
+  /// the current minimum, which reduces over-estimation.
+  /// Counters saturate at the maximum of TCounter.
+  /// Sketches of the same size and hash may be merged, so each core or task
+  /// may count separately.
+  ///\tparam DESIRED_WIDTH The desired number of counters per row. Rounded up to a power of 2.
+  ///\tparam VDepth        The number of rows. 1 to 16.
+  ///\tparam TKey          The key type.
+  ///\tparam THash         The hash generator class. Defaults to etl::hash<TKey>.
+  ///\tparam TCounter      The unsigned counter type.
+  ///\ingroup count_min_sketch
+  //***************************************************************************
+  template <size_t DESIRED_WIDTH, size_t VDepth, typename TKey, typename THash = etl::hash<TKey>, typename TCounter = uint32_t>
+  class count_min_sketch
+  {
+  private:
+
+    typedef typename etl::parameter_type<TKey>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VDepth >= 1U) && (VDepth <= 16U), "VDepth must be 1 to 16");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TCounter>::value, "TCounter must be an unsigned type");
+
+    typedef TCounter counter_type;
+
+    enum
+    {
+      WIDTH = private_bloom_filter::power_of_2_not_less_than<DESIRED_WIDTH>::value,
+      DEPTH = VDepth
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    count_min_sketch()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the sketch.
+    //***************************************************************************
+    void clear()
+    {
+      for (size_t row = 0U; row < VDepth; ++row)
+      {
+        etl::fill_n(counters[row], size_t(WIDTH), TCounter(0U));
+      }
+
+      total_count = 0U;
+    }
+
+    //***************************************************************************
+    /// Adds 'count' occurrences of a key.
+    /// Returns the new estimate for the key.
+    //***************************************************************************
+    TCounter add(parameter_t key, TCounter count = 1U)
+    {
+      size_t index[VDepth];
+      locate(key, index);
+
+      TCounter minimum = counters[0][index[0]];
+
+      for (size_t row = 1U; row < VDepth; ++row)
+      {
+        minimum = etl::min(minimum, counters[row][index[row]]);
+      }
+
+      const TCounter target = saturating_add(minimum, count);
+
+      for (size_t row = 0U; row < VDepth; ++row)
+      {
+        TCounter& counter = counters[row][index[row]];
+
+        if (counter < target)
+        {
+          counter = target;
+        }
+      }
+
+      total_count += count;
+
+      return target;
+    }
+
+    //***************************************************************************
+    /// Returns the estimated count for a key.
+    //***************************************************************************
+    TCounter estimate(parameter_t key) const
+    {
+      size_t index[VDepth];
+      locate(key, index);
+
+      TCounter minimum = counters[0][index[0]];
+
+      for (size_t row = 1U; row < VDepth; ++row)
+      {
+        minimum = etl::min(minimum, counters[row][index[row]]);
+      }
+
+      return minimum;
+    }
+
+    //***************************************************************************
+    /// Merges another sketch, so that this estimates the combined counts.
+    /// Estimates remain upper bounds of the true counts.
+    //***************************************************************************
+    void merge(const count_min_sketch& other)
+    {
+      for (size_t row = 0U; row < VDepth; ++row)
+      {
+        for (size_t i = 0U; i < size_t(WIDTH); ++i)
+        {
+          counters[row][i] = saturating_add(counters[row][i], other.counters[row][i]);
+        }
+      }
+
+      total_count += other.total_count;
+    }
+
+    //***************************************************************************
+    /// Returns the total of all counts added.
+    //***************************************************************************
+    uint64_t total() const
+    {
+      return total_count;
+    }
+
+    //***************************************************************************
+    /// Returns the number of counters per row.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of rows.
+    //***************************************************************************
+    size_t depth() const
+    {
+      return VDepth;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Finds the counter in each row for a key.
+    /// The row positions are derived from two hashes.
+    //***************************************************************************
+    void locate(parameter_t key, size_t* index) const
+    {
+      const uint32_t h1 = private_bloom_filter::mix_hash(private_bloom_filter::fold_hash(THash()(key)));
+      const uint32_t h2 = private_bloom_filter::mix_hash(h1 + 0x9E3779B9UL) | 1U;
+
+      uint32_t h = h1;
+
+      for (size_t row = 0U; row < VDepth; ++row)
+      {
+        index[row] = size_t(h & (uint32_t(WIDTH) - 1U));
+        h += h2;
+        h = (h >> 17U) | (h << 15U);
+      }
+    }
+
+    //***************************************************************************
+    static TCounter saturating_add(TCounter a, TCounter b)
+    {
+      const TCounter limit    = etl::integral_limits<TCounter>::max;
+      const TCounter headroom = limit - a;
+
+      TCounter sum = a;
+      sum += b;
+
+      return (b > headroom) ? limit : sum;
+    }
+
+    /// The counters.
+    TCounter counters[VDepth][WIDTH];
+    uint64_t total_count;
+  };
+}
+
+#endif
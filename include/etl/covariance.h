@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_simd.h"
 
 #include <stdint.h>
 
@@ -152,6 +154,20 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a pair of blocks of values.
+    /// Pairs are taken up to the length of the shorter block.
+    /// Accumulates several partial sums at once, using vector instructions where supported.
+    //*********************************
+    void add(etl::span<const TInput> values1, etl::span<const TInput> values2)
+    {
+      const size_t n = (values1.size() < values2.size()) ? values1.size() : values2.size();
+
+      private_statistics::block_accumulate<TInput, TCalc, calc_t>::inner_product(values1.data(), values2.data(), n, inner_product, sum1, sum2);
+      counter += uint32_t(n);
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
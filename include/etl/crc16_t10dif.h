@@ -73,6 +73,7 @@ namespace etl
   typedef etl::crc16_t10dif_t<256U> crc16_t10dif_t256;
   typedef etl::crc16_t10dif_t<16U>  crc16_t10dif_t16;
   typedef etl::crc16_t10dif_t<4U>   crc16_t10dif_t4;
+  typedef etl::crc16_t10dif_t<etl::crc_accelerated> crc16_t10dif_accelerated;
   typedef crc16_t10dif_t256         crc16_t10dif;
 }
 #endif
@@ -0,0 +1,432 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_RUNTIME_INCLUDED
+#define ETL_CRC_RUNTIME_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "private/crc_parameters.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup crc_runtime crc_runtime
+/// A CRC whose parameters are chosen at run time.
+/// The lookup table is generated into a buffer supplied by the caller, once,
+/// and may be shared by any number of CRC calculators.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// The parameters of a CRC, in the same form as the compile time CRCs.
+  /// The polynomial and initial value are not reflected. Reflect applies to
+  /// both the input and the output.
+  ///\tparam TAccumulator The unsigned type that holds the CRC.
+  ///\ingroup crc_runtime
+  //***************************************************************************
+  template <typename TAccumulator>
+  struct crc_runtime_parameters
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TAccumulator>::value && (etl::integral_limits<TAccumulator>::bits >= 8U), "TAccumulator must be an unsigned type of at least 8 bits");
+
+    typedef TAccumulator accumulator_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param width_ The width of the CRC in bits, from 1 to the width of TAccumulator.
+    //*************************************************************************
+    crc_runtime_parameters(size_t       width_,
+                           TAccumulator polynomial_,
+                           TAccumulator initial_,
+                           TAccumulator xor_out_,
+                           bool         reflect_)
+      : width(width_)
+      , polynomial(polynomial_)
+      , initial(initial_)
+      , xor_out(xor_out_)
+      , reflect(reflect_)
+    {
+    }
+
+    //*************************************************************************
+    /// Creates the parameters from those of a compile time CRC.
+    /// e.g. etl::crc_runtime_parameters<uint16_t>::from<etl::private_crc::crc16_x25_parameters>()
+    //*************************************************************************
+    template <typename TCrcParameters>
+    static crc_runtime_parameters from()
+    {
+      ETL_STATIC_ASSERT((etl::is_same<typename TCrcParameters::accumulator_type, TAccumulator>::value), "Accumulator types must match");
+
+      return crc_runtime_parameters(TCrcParameters::Accumulator_Bits, TCrcParameters::Polynomial, TCrcParameters::Initial, TCrcParameters::Xor_Out, TCrcParameters::Reflect);
+    }
+
+    size_t       width;
+    TAccumulator polynomial;
+    TAccumulator initial;
+    TAccumulator xor_out;
+    bool         reflect;
+  };
+
+  //***************************************************************************
+  /// A CRC lookup table generated at run time into a caller supplied buffer.
+  /// With VSlices greater than 1, VSlices bytes are processed per step using
+  /// slice-by-N tables.
+  ///\tparam TAccumulator The unsigned type that holds the CRC.
+  ///\tparam VSlices      The number of 256 entry tables. 1, 2, 4 or 8.
+  ///\ingroup crc_runtime
+  //***************************************************************************
+  template <typename TAccumulator, size_t VSlices = 1U>
+  class crc_runtime_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VSlices == 1U) || (VSlices == 2U) || (VSlices == 4U) || (VSlices == 8U), "VSlices must be 1, 2, 4 or 8");
+
+    typedef TAccumulator                         accumulator_type;
+    typedef crc_runtime_parameters<TAccumulator> parameters_type;
+
+    /// The number of entries that the buffer must hold.
+    static ETL_CONSTANT size_t Size = 256U * VSlices;
+
+    //*************************************************************************
+    /// Generates the table for 'parameters' into 'buffer', which must hold
+    /// Size entries and must outlive the table.
+    //*************************************************************************
+    crc_runtime_table(const parameters_type& parameters_, TAccumulator* buffer)
+      : parameters(parameters_)
+      , table(buffer)
+      , shift(Bits - parameters_.width)
+    {
+      const TAccumulator top = TAccumulator(TAccumulator(1U) << (Bits - 1U));
+
+      // The register is MSB aligned when not reflected, and LSB aligned when reflected.
+      if (parameters.reflect)
+      {
+        register_polynomial = TAccumulator(etl::reverse_bits(parameters.polynomial) >> shift);
+        register_initial    = TAccumulator(etl::reverse_bits(parameters.initial) >> shift);
+      }
+      else
+      {
+        register_polynomial = TAccumulator(parameters.polynomial << shift);
+        register_initial    = TAccumulator(parameters.initial << shift);
+      }
+
+      for (size_t i = 0U; i < 256U; ++i)
+      {
+        TAccumulator entry;
+
+        if (parameters.reflect)
+        {
+          entry = TAccumulator(i);
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            entry = ((entry & 1U) != 0U) ? TAccumulator((entry >> 1U) ^ register_polynomial) : TAccumulator(entry >> 1U);
+          }
+        }
+        else
+        {
+          entry = TAccumulator(TAccumulator(i) << (Bits - 8U));
+
+          for (size_t bit = 0U; bit < 8U; ++bit)
+          {
+            entry = ((entry & top) != 0U) ? TAccumulator((entry << 1U) ^ register_polynomial) : TAccumulator(entry << 1U);
+          }
+        }
+
+        table[i] = entry;
+      }
+
+      // Each further slice is the previous one followed by a zero byte.
+      for (size_t slice = 1U; slice < VSlices; ++slice)
+      {
+        const TAccumulator* previous = table + ((slice - 1U) * 256U);
+        TAccumulator*       current  = table + (slice * 256U);
+
+        for (size_t i = 0U; i < 256U; ++i)
+        {
+          current[i] = update(previous[i], 0U);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the register value at the start of a calculation.
+    //*************************************************************************
+    TAccumulator initial() const
+    {
+      return register_initial;
+    }
+
+    //*************************************************************************
+    /// Adds one byte to the register.
+    //*************************************************************************
+    TAccumulator update(TAccumulator crc, uint8_t value) const
+    {
+      if (parameters.reflect)
+      {
+        return TAccumulator(shift_down(crc, 8U) ^ table[uint8_t(crc ^ value)]);
+      }
+      else
+      {
+        return TAccumulator(shift_up(crc, 8U) ^ table[uint8_t((crc >> (Bits - 8U)) ^ value)]);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a block of bytes to the register, VSlices bytes at a time.
+    //*************************************************************************
+    TAccumulator update(TAccumulator crc, const uint8_t* begin, const uint8_t* end) const
+    {
+      if (VSlices > 1U)
+      {
+        const size_t blocks = size_t(end - begin) / VSlices;
+
+        if (parameters.reflect)
+        {
+          for (size_t block = 0U; block < blocks; ++block)
+          {
+            TAccumulator result = shift_down(crc, 8U * VSlices);
+
+            for (size_t j = 0U; j < VSlices; ++j)
+            {
+              const uint8_t index = uint8_t(begin[j] ^ uint8_t(shift_down(crc, 8U * j)));
+
+              result ^= table[((VSlices - 1U - j) * 256U) + index];
+            }
+
+            crc    = result;
+            begin += VSlices;
+          }
+        }
+        else
+        {
+          for (size_t block = 0U; block < blocks; ++block)
+          {
+            TAccumulator result = shift_up(crc, 8U * VSlices);
+
+            for (size_t j = 0U; j < VSlices; ++j)
+            {
+              const size_t  position = 8U * (j + 1U);
+              const uint8_t high     = (position <= Bits) ? uint8_t(crc >> (Bits - position)) : uint8_t(0U);
+              const uint8_t index    = uint8_t(begin[j] ^ high);
+
+              result ^= table[((VSlices - 1U - j) * 256U) + index];
+            }
+
+            crc    = result;
+            begin += VSlices;
+          }
+        }
+      }
+
+      while (begin != end)
+      {
+        crc = update(crc, *begin++);
+      }
+
+      return crc;
+    }
+
+    //*************************************************************************
+    /// Returns the CRC for a register value.
+    //*************************************************************************
+    TAccumulator final(TAccumulator crc) const
+    {
+      const TAccumulator aligned = parameters.reflect ? crc : TAccumulator(crc >> shift);
+
+      return TAccumulator((aligned ^ parameters.xor_out) & mask());
+    }
+
+    //*************************************************************************
+    /// Returns the parameters.
+    //*************************************************************************
+    const parameters_type& get_parameters() const
+    {
+      return parameters;
+    }
+
+    //*************************************************************************
+    /// Returns the table entries.
+    //*************************************************************************
+    const TAccumulator* data() const
+    {
+      return table;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bits = etl::integral_limits<TAccumulator>::bits;
+
+    //*************************************************************************
+    /// Shifts that give zero when shifting by the width of the type or more.
+    //*************************************************************************
+    static TAccumulator shift_down(TAccumulator value, size_t n)
+    {
+      return (n < Bits) ? TAccumulator(value >> n) : TAccumulator(0U);
+    }
+
+    static TAccumulator shift_up(TAccumulator value, size_t n)
+    {
+      return (n < Bits) ? TAccumulator(value << n) : TAccumulator(0U);
+    }
+
+    //*************************************************************************
+    TAccumulator mask() const
+    {
+      return TAccumulator(etl::integral_limits<TAccumulator>::max >> shift);
+    }
+
+    parameters_type parameters;
+    TAccumulator*   table;
+    size_t          shift;
+    TAccumulator    register_polynomial;
+    TAccumulator    register_initial;
+  };
+
+  template <typename TAccumulator, size_t VSlices>
+  ETL_CONSTANT size_t crc_runtime_table<TAccumulator, VSlices>::Size;
+
+  template <typename TAccumulator, size_t VSlices>
+  ETL_CONSTANT size_t crc_runtime_table<TAccumulator, VSlices>::Bits;
+
+  //***************************************************************************
+  /// Calculates a CRC using a table generated at run time.
+  /// Has the same interface as the compile time CRCs.
+  ///\tparam TAccumulator The unsigned type that holds the CRC.
+  ///\tparam VSlices      The number of slices in the table.
+  ///\ingroup crc_runtime
+  //***************************************************************************
+  template <typename TAccumulator, size_t VSlices = 1U>
+  class crc_runtime
+  {
+  public:
+
+    typedef TAccumulator                                value_type;
+    typedef crc_runtime_table<TAccumulator, VSlices>    table_type;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param table_ The shared table. Must outlive the calculator.
+    //*************************************************************************
+    explicit crc_runtime(const table_type& table_)
+      : table(&table_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    //*************************************************************************
+    template <typename TIterator>
+    crc_runtime(const table_type& table_, TIterator begin, const TIterator end)
+      : table(&table_)
+    {
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the CRC to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      crc = table->initial();
+    }
+
+    //*************************************************************************
+    /// Adds a range of bytes.
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
+
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a byte.
+    //*************************************************************************
+    void add(uint8_t value)
+    {
+      crc = table->update(crc, value);
+    }
+
+    //*************************************************************************
+    /// Returns the CRC.
+    //*************************************************************************
+    value_type value() const
+    {
+      return table->final(crc);
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type() const
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Pointers use the block update.
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::true_type)
+    {
+      crc = table->update(crc, reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+    }
+
+    //*************************************************************************
+    template <typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    const table_type* table;
+    value_type        crc;
+  };
+}
+
+#endif
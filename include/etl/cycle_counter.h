@@ -0,0 +1,217 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CYCLE_COUNTER_INCLUDED
+#define ETL_CYCLE_COUNTER_INCLUDED
+
+#include "platform.h"
+
+#include <stdint.h>
+
+//*****************************************************************************
+// Selects the counter used by etl::cycle_counter. One of the following may be
+// defined in the user's profile to override the default.
+// ETL_CYCLE_COUNTER_USE_DWT           Cortex-M3/M4/M7 DWT cycle counter.
+// ETL_CYCLE_COUNTER_USE_SYSTICK       Cortex-M SysTick, reloading at 0xFFFFFF.
+//                                     Not for use when an RTOS owns SysTick.
+// ETL_CYCLE_COUNTER_USE_RDTSC         x86 time stamp counter.
+// ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME POSIX CLOCK_MONOTONIC, in nanoseconds.
+// ETL_CYCLE_COUNTER_USE_USER          ETL_CYCLE_COUNTER_NOW() is defined by the
+//                                     user and returns a uint64_t tick count.
+//*****************************************************************************
+#if !defined(ETL_CYCLE_COUNTER_USE_DWT)           && \
+    !defined(ETL_CYCLE_COUNTER_USE_SYSTICK)       && \
+    !defined(ETL_CYCLE_COUNTER_USE_RDTSC)         && \
+    !defined(ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME) && \
+    !defined(ETL_CYCLE_COUNTER_USE_USER)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_CYCLE_COUNTER_USE_RDTSC
+  #elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+    #define ETL_CYCLE_COUNTER_USE_RDTSC
+  #elif defined(__unix__) || defined(__APPLE__)
+    #define ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME
+  #elif defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_8M_MAIN__)
+    #define ETL_CYCLE_COUNTER_USE_DWT
+  #elif defined(__ARM_ARCH_6M__) || defined(__ARM_ARCH_8M_BASE__)
+    #define ETL_CYCLE_COUNTER_USE_SYSTICK
+  #endif
+#endif
+
+#if defined(ETL_CYCLE_COUNTER_USE_RDTSC)
+  #if defined(ETL_COMPILER_MICROSOFT)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+#elif defined(ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME)
+  #include <time.h>
+#endif
+
+#if defined(ETL_CYCLE_COUNTER_USE_DWT)           || \
+    defined(ETL_CYCLE_COUNTER_USE_SYSTICK)       || \
+    defined(ETL_CYCLE_COUNTER_USE_RDTSC)         || \
+    defined(ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME) || \
+    defined(ETL_CYCLE_COUNTER_USE_USER)
+  #define ETL_HAS_CYCLE_COUNTER 1
+#else
+  #define ETL_HAS_CYCLE_COUNTER 0
+#endif
+
+#if ETL_HAS_CYCLE_COUNTER
+
+namespace etl
+{
+  //***************************************************************************
+  /// A free running counter for timing short sections of code.
+  /// Call start() once before the first use.
+  /// Differences between two readings are taken with elapsed(), which allows
+  /// for the counter wrapping once.
+  //***************************************************************************
+  class cycle_counter
+  {
+  public:
+
+#if defined(ETL_CYCLE_COUNTER_USE_DWT) || defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+    typedef uint32_t value_type;
+#else
+    typedef uint64_t value_type;
+#endif
+
+    //*************************************************************************
+    /// Enables the counter, where that is needed.
+    //*************************************************************************
+    static void start()
+    {
+#if defined(ETL_CYCLE_COUNTER_USE_DWT)
+      // Unlock the DWT, which is locked on some Cortex-M7 parts.
+      register32(Dwt_Lar) = 0xC5ACCE55UL;
+      register32(Demcr)  |= Demcr_Trcena;
+      register32(Dwt_Cyccnt) = 0U;
+      register32(Dwt_Ctrl)  |= Dwt_Ctrl_Cyccntena;
+#elif defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+      // Free running from the processor clock, with no interrupt.
+      register32(Syst_Csr) = 0U;
+      register32(Syst_Rvr) = Systick_Mask;
+      register32(Syst_Cvr) = 0U;
+      register32(Syst_Csr) = Syst_Csr_Enable | Syst_Csr_Clksource;
+#endif
+    }
+
+    //*************************************************************************
+    /// The current count.
+    //*************************************************************************
+    static value_type now()
+    {
+#if defined(ETL_CYCLE_COUNTER_USE_DWT)
+      return register32(Dwt_Cyccnt);
+#elif defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+      return register32(Syst_Cvr);
+#elif defined(ETL_CYCLE_COUNTER_USE_RDTSC)
+      return __rdtsc();
+#elif defined(ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME)
+      timespec ts;
+      clock_gettime(CLOCK_MONOTONIC, &ts);
+
+      return (value_type(ts.tv_sec) * 1000000000ULL) + value_type(ts.tv_nsec);
+#else
+      return ETL_CYCLE_COUNTER_NOW();
+#endif
+    }
+
+    //*************************************************************************
+    /// The ticks from 'first' to 'last'.
+    //*************************************************************************
+    static value_type elapsed(value_type first, value_type last)
+    {
+#if defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+      // SysTick counts down.
+      return (first - last) & Systick_Mask;
+#else
+      return last - first;
+#endif
+    }
+
+    //*************************************************************************
+    /// The largest interval that can be measured.
+    //*************************************************************************
+    static value_type max_elapsed()
+    {
+#if defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+      return Systick_Mask;
+#else
+      const value_type none = 0U;
+      return ~none;
+#endif
+    }
+
+    //*************************************************************************
+    /// The name of the unit counted.
+    //*************************************************************************
+    static const char* units()
+    {
+#if defined(ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME)
+      return "ns";
+#elif defined(ETL_CYCLE_COUNTER_USE_USER)
+      return "ticks";
+#else
+      return "cycles";
+#endif
+    }
+
+  private:
+
+#if defined(ETL_CYCLE_COUNTER_USE_DWT) || defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+    static volatile uint32_t& register32(uintptr_t address)
+    {
+      return *reinterpret_cast<volatile uint32_t*>(address);
+    }
+#endif
+
+#if defined(ETL_CYCLE_COUNTER_USE_DWT)
+    static ETL_CONSTANT uintptr_t Demcr              = 0xE000EDFCUL;
+    static ETL_CONSTANT uintptr_t Dwt_Ctrl           = 0xE0001000UL;
+    static ETL_CONSTANT uintptr_t Dwt_Cyccnt         = 0xE0001004UL;
+    static ETL_CONSTANT uintptr_t Dwt_Lar            = 0xE0001FB0UL;
+    static ETL_CONSTANT uint32_t  Demcr_Trcena       = 0x01000000UL;
+    static ETL_CONSTANT uint32_t  Dwt_Ctrl_Cyccntena = 0x00000001UL;
+#elif defined(ETL_CYCLE_COUNTER_USE_SYSTICK)
+    static ETL_CONSTANT uintptr_t Syst_Csr           = 0xE000E010UL;
+    static ETL_CONSTANT uintptr_t Syst_Rvr           = 0xE000E014UL;
+    static ETL_CONSTANT uintptr_t Syst_Cvr           = 0xE000E018UL;
+    static ETL_CONSTANT uint32_t  Syst_Csr_Enable    = 0x00000001UL;
+    static ETL_CONSTANT uint32_t  Syst_Csr_Clksource = 0x00000004UL;
+    static ETL_CONSTANT uint32_t  Systick_Mask       = 0x00FFFFFFUL;
+#endif
+  };
+}
+
+#endif
+
+#endif
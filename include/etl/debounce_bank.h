@@ -0,0 +1,377 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DEBOUNCE_BANK_INCLUDED
+#define ETL_DEBOUNCE_BANK_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "log.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup debounce_bank debounce_bank
+/// Debounces many inputs at once, with the same valid, hold and repeat
+/// behaviour as etl::debounce.
+/// Each word of inputs keeps its counters as vertical, or bit sliced,
+/// counters. Bit 'i' of counter plane 'j' is bit 'j' of the count for input
+/// 'i', so one add updates a whole word of inputs with a few logical
+/// operations per counter bit.
+///\ingroup utilities
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Debounces N_Inputs inputs.
+  ///\tparam N_Inputs     The number of inputs.
+  ///\tparam VALID_COUNT  The count for a valid state.
+  ///\tparam HOLD_COUNT   The count after the valid state for a hold state. 0 for no hold.
+  ///\tparam REPEAT_COUNT The count after the hold state for each key repeat. 0 for no repeat.
+  ///\tparam TWord        The word type that holds the inputs. Default uint32_t.
+  ///\ingroup debounce_bank
+  //***************************************************************************
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT = 0, uint16_t REPEAT_COUNT = 0, typename TWord = uint32_t>
+  class debounce_bank
+  {
+  public:
+
+    ETL_STATIC_ASSERT(N_Inputs != 0U, "N_Inputs must not be zero");
+    ETL_STATIC_ASSERT(VALID_COUNT != 0U, "VALID_COUNT must not be zero");
+    ETL_STATIC_ASSERT(etl::is_unsigned<TWord>::value, "TWord must be an unsigned type");
+
+    typedef TWord word_type;
+
+    static ETL_CONSTANT size_t Bits_Per_Word   = etl::integral_limits<word_type>::bits;
+    static ETL_CONSTANT size_t Number_Of_Words = (N_Inputs + Bits_Per_Word - 1U) / Bits_Per_Word;
+
+  private:
+
+    static ETL_CONSTANT word_type All_Ones = etl::integral_limits<word_type>::max;
+
+    static ETL_CONSTANT uint16_t Max_Count = (VALID_COUNT > HOLD_COUNT) ? ((VALID_COUNT > REPEAT_COUNT) ? VALID_COUNT : REPEAT_COUNT)
+                                                                        : ((HOLD_COUNT > REPEAT_COUNT)  ? HOLD_COUNT  : REPEAT_COUNT);
+
+  public:
+
+    /// The number of bits in each count.
+    /// A count stops when all of its bits are set, which is at least the largest of the counts.
+    static ETL_CONSTANT size_t Count_Bits = etl::log2<Max_Count>::value + 1U;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param initial_state The initial state of every input. Default = false.
+    //*************************************************************************
+    explicit debounce_bank(bool initial_state = false)
+    {
+      reset(initial_state);
+    }
+
+    //*************************************************************************
+    /// Sets every input to the state, with no change flagged.
+    //*************************************************************************
+    void reset(bool initial_state = false)
+    {
+      for (size_t w = 0U; w < Number_Of_Words; ++w)
+      {
+        words[w].sample = 0U;
+        words[w].state0 = initial_state ? lane_mask(w) : 0U;
+        words[w].state1 = 0U;
+        words[w].change = 0U;
+
+        for (size_t j = 0U; j < Count_Bits; ++j)
+        {
+          words[w].count[j] = 0U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for every input.
+    /// Input 'i' is bit (i % Bits_Per_Word) of p_samples[i / Bits_Per_Word].
+    ///\param p_samples Number_Of_Words words of samples.
+    ///\return 'true' if any input changed state.
+    //*************************************************************************
+    bool add(const word_type* p_samples)
+    {
+      word_type any = 0U;
+
+      for (size_t w = 0U; w < Number_Of_Words; ++w)
+      {
+        any |= add(w, p_samples[w]);
+      }
+
+      return any != 0U;
+    }
+
+    //*************************************************************************
+    /// Adds a new sample for one word of inputs.
+    /// Each word of inputs is debounced independently, so the words may be
+    /// sampled at different times, each at its own regular rate.
+    ///\param word_index The index of the word of inputs.
+    ///\param samples    The samples for the inputs in the word.
+    ///\return The mask of the inputs in the word that changed state.
+    //*************************************************************************
+    word_type add(size_t word_index, word_type samples)
+    {
+      word_lanes& lanes = words[word_index];
+
+      const word_type s = samples & lane_mask(word_index);
+
+      // Restart the count of the inputs whose sample has changed.
+      const word_type changed_sample = s ^ lanes.sample;
+      lanes.sample = s;
+
+      for (size_t j = 0U; j < Count_Bits; ++j)
+      {
+        lanes.count[j] &= complement(changed_sample);
+      }
+
+      // Count, for the inputs whose count has not stopped.
+      word_type stopped = All_Ones;
+
+      for (size_t j = 0U; j < Count_Bits; ++j)
+      {
+        stopped &= lanes.count[j];
+      }
+
+      const word_type counting = complement(stopped) & lane_mask(word_index);
+
+      word_type carry = counting;
+
+      for (size_t j = 0U; j < Count_Bits; ++j)
+      {
+        const word_type next_carry = lanes.count[j] & carry;
+        lanes.count[j] ^= carry;
+        carry = next_carry;
+      }
+
+      const word_type valid  = counting & equal_to<VALID_COUNT>(lanes);
+      const word_type hold   = counting & equal_to<HOLD_COUNT>(lanes);
+      const word_type repeat = counting & equal_to<REPEAT_COUNT>(lanes);
+
+      // The current states.
+      const word_type ns        = complement(s);
+      const word_type off       = complement(lanes.state0 | lanes.state1);
+      const word_type on        = lanes.state0 & complement(lanes.state1);
+      const word_type held      = lanes.state1 & complement(lanes.state0);
+      const word_type repeating = lanes.state0 & lanes.state1;
+
+      // The transitions.
+      const word_type set_on   = off & s & valid;
+      const word_type set_off  = ns & valid & complement(off);
+      const word_type set_held = on & s & hold;
+      const word_type set_rep  = held & s & repeat;
+      const word_type repeated = repeating & s & repeat;
+
+      const word_type keep = complement(set_off);
+
+      const word_type next0 = set_on | (on & keep & complement(set_held)) | set_rep | (repeating & keep);
+      const word_type next1 = set_held | ((held | repeating) & keep);
+
+      const word_type change = (next0 ^ lanes.state0) | (next1 ^ lanes.state1) | repeated;
+
+      lanes.state0 = next0;
+      lanes.state1 = next1;
+      lanes.change = change;
+
+      // Restart the count of the inputs that changed state.
+      for (size_t j = 0U; j < Count_Bits; ++j)
+      {
+        lanes.count[j] &= complement(change);
+      }
+
+      return change;
+    }
+
+    //*************************************************************************
+    /// Checks whether the input changed state on the last add.
+    //*************************************************************************
+    bool has_changed(size_t input) const
+    {
+      return test(changed_mask(input / Bits_Per_Word), input);
+    }
+
+    //*************************************************************************
+    /// Checks whether the input is set.
+    //*************************************************************************
+    bool is_set(size_t input) const
+    {
+      return test(set_mask(input / Bits_Per_Word), input);
+    }
+
+    //*************************************************************************
+    /// Checks whether the input is held.
+    //*************************************************************************
+    bool is_held(size_t input) const
+    {
+      return test(held_mask(input / Bits_Per_Word), input);
+    }
+
+    //*************************************************************************
+    /// Checks whether the input is repeating.
+    //*************************************************************************
+    bool is_repeating(size_t input) const
+    {
+      return test(repeating_mask(input / Bits_Per_Word), input);
+    }
+
+    //*************************************************************************
+    /// The mask of the inputs in the word that changed state on the last add.
+    //*************************************************************************
+    word_type changed_mask(size_t word_index) const
+    {
+      return words[word_index].change;
+    }
+
+    //*************************************************************************
+    /// The mask of the inputs in the word that are set.
+    //*************************************************************************
+    word_type set_mask(size_t word_index) const
+    {
+      return words[word_index].state0 | words[word_index].state1;
+    }
+
+    //*************************************************************************
+    /// The mask of the inputs in the word that are held or repeating.
+    //*************************************************************************
+    word_type held_mask(size_t word_index) const
+    {
+      return words[word_index].state1;
+    }
+
+    //*************************************************************************
+    /// The mask of the inputs in the word that are repeating.
+    //*************************************************************************
+    word_type repeating_mask(size_t word_index) const
+    {
+      return words[word_index].state0 & words[word_index].state1;
+    }
+
+    //*************************************************************************
+    /// The number of inputs.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return N_Inputs;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The bit sliced state of a word of inputs.
+    /// The state is Off = 0, On = 1, Held = 2 and Repeating = 3, in two planes.
+    //*************************************************************************
+    struct word_lanes
+    {
+      word_type sample;
+      word_type state0;
+      word_type state1;
+      word_type change;
+      word_type count[Count_Bits];
+    };
+
+    //*************************************************************************
+    /// The mask of the inputs that are used in the word.
+    //*************************************************************************
+    static word_type lane_mask(size_t word_index)
+    {
+      const size_t remaining = N_Inputs - (word_index * Bits_Per_Word);
+
+      if (remaining >= Bits_Per_Word)
+      {
+        return All_Ones;
+      }
+
+      const word_type mask = (word_type(1) << remaining) - 1U;
+
+      return mask;
+    }
+
+    //*************************************************************************
+    /// The mask of the inputs whose count equals VCount.
+    /// A count of zero never matches, as the count is checked after it is incremented.
+    //*************************************************************************
+    template <uint16_t VCount>
+    static word_type equal_to(const word_lanes& lanes)
+    {
+      if (VCount == 0U)
+      {
+        return 0U;
+      }
+
+      word_type result = All_Ones;
+
+      for (size_t j = 0U; j < Count_Bits; ++j)
+      {
+        result &= (((VCount >> j) & 1U) != 0U) ? lanes.count[j] : complement(lanes.count[j]);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    static word_type complement(word_type value)
+    {
+      const word_type result = ~value;
+
+      return result;
+    }
+
+    //*************************************************************************
+    static bool test(word_type mask, size_t input)
+    {
+      return ((mask >> (input % Bits_Per_Word)) & 1U) != 0U;
+    }
+
+    word_lanes words[Number_Of_Words];
+  };
+
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT, uint16_t REPEAT_COUNT, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<N_Inputs, VALID_COUNT, HOLD_COUNT, REPEAT_COUNT, TWord>::Bits_Per_Word;
+
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT, uint16_t REPEAT_COUNT, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<N_Inputs, VALID_COUNT, HOLD_COUNT, REPEAT_COUNT, TWord>::Number_Of_Words;
+
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT, uint16_t REPEAT_COUNT, typename TWord>
+  ETL_CONSTANT TWord debounce_bank<N_Inputs, VALID_COUNT, HOLD_COUNT, REPEAT_COUNT, TWord>::All_Ones;
+
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT, uint16_t REPEAT_COUNT, typename TWord>
+  ETL_CONSTANT uint16_t debounce_bank<N_Inputs, VALID_COUNT, HOLD_COUNT, REPEAT_COUNT, TWord>::Max_Count;
+
+  template <size_t N_Inputs, uint16_t VALID_COUNT, uint16_t HOLD_COUNT, uint16_t REPEAT_COUNT, typename TWord>
+  ETL_CONSTANT size_t debounce_bank<N_Inputs, VALID_COUNT, HOLD_COUNT, REPEAT_COUNT, TWord>::Count_Bits;
+}
+
+#endif
@@ -0,0 +1,369 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DEFERRED_REFERENCE_COUNTED_MESSAGE_POOL_INCLUDED
+#define ETL_DEFERRED_REFERENCE_COUNTED_MESSAGE_POOL_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "imemory_block_allocator.h"
+#include "ireference_counted_message_pool.h"
+#include "reference_counted_message.h"
+#include "reference_counted_message_pool.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "atomic.h"
+#include "alignment.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A pool of reference counted messages that defers their destruction.
+  /// When a message's count reaches zero it is pushed on to a lock-free
+  /// intrusive list instead of being destructed and released to the allocator.
+  /// Releasing is therefore wait-free for a single producer and lock-free for
+  /// several, and is safe from interrupts and latency critical routers.
+  /// The messages are destructed and their blocks released as a batch, under a
+  /// single lock, by a call to 'reclaim' from a maintenance context.
+  /// 'reclaim' must only be called from one context at a time.
+  /// Each block holds a link ahead of the message, so the allocator must be
+  /// sized with this pool's pool_message_parameters.
+  ///\tparam TCounter   The reference counter type.
+  ///\tparam VAlignment The alignment of the blocks. Must be at least that of any of the messages.
+  //***************************************************************************
+  template <typename TCounter, size_t VAlignment = etl::alignment_of<void*>::value>
+  class deferred_reference_counted_message_pool : public etl::ireference_counted_message_pool
+  {
+  private:
+
+    //*************************************************************************
+    /// The link that precedes each message in its block.
+    //*************************************************************************
+    struct link_type
+    {
+      link_type* next;
+    };
+
+  public:
+
+    static ETL_CONSTANT size_t Alignment = VAlignment;
+
+    /// The size of the link that precedes each message in a block.
+    static ETL_CONSTANT size_t Header_Size = ((sizeof(link_type) + VAlignment - 1U) / VAlignment) * VAlignment;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    deferred_reference_counted_message_pool(etl::imemory_block_allocator& memory_block_allocator_)
+      : memory_block_allocator(memory_block_allocator_)
+      , deferred_head(ETL_NULLPTR)
+      , deferred_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor
+    /// Reclaims any messages still waiting.
+    //*************************************************************************
+    ~deferred_reference_counted_message_pool()
+    {
+      reclaim();
+    }
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate(const TMessage& message)
+    {
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      void* p_message = allocate_block<TMessage>();
+
+      rcm_t* p = ETL_NULLPTR;
+
+      if (p_message != ETL_NULLPTR)
+      {
+        p = ::new(p_message) rcm_t(message, *this);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate a reference counted message from the pool.
+    //*************************************************************************
+    template <typename TMessage>
+    etl::reference_counted_message<TMessage, TCounter>* allocate()
+    {
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      void* p_message = allocate_block<TMessage>();
+
+      rcm_t* p = ETL_NULLPTR;
+
+      if (p_message != ETL_NULLPTR)
+      {
+        p = ::new(p_message) rcm_t(*this);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Defers the destruction of a message until the next call to 'reclaim'.
+    //*************************************************************************
+    void release(const etl::ireference_counted_message& rcmessage) ETL_OVERRIDE
+    {
+      link_type* p_link = get_link(rcmessage);
+
+      p_link->next = deferred_head.load(etl::memory_order_relaxed);
+
+      while (!deferred_head.compare_exchange_weak(p_link->next, p_link, etl::memory_order_release, etl::memory_order_relaxed))
+      {
+        // Try again with the new head.
+      }
+
+      ++deferred_count;
+    }
+
+    //*************************************************************************
+    /// Defers the destruction of a batch of messages.
+    //*************************************************************************
+    void release_batch(etl::ireference_counted_message* const* messages, size_t count) ETL_OVERRIDE
+    {
+      if (count == 0U)
+      {
+        return;
+      }
+
+      // Chain the batch together, then push it in one go.
+      link_type* p_first = get_link(*messages[0]);
+      link_type* p_last  = p_first;
+
+      for (size_t i = 1U; i < count; ++i)
+      {
+        link_type* p_link = get_link(*messages[i]);
+        p_last->next = p_link;
+        p_last = p_link;
+      }
+
+      p_last->next = deferred_head.load(etl::memory_order_relaxed);
+
+      while (!deferred_head.compare_exchange_weak(p_last->next, p_first, etl::memory_order_release, etl::memory_order_relaxed))
+      {
+        // Try again with the new head.
+      }
+
+      deferred_count += count;
+    }
+
+    //*************************************************************************
+    /// Destructs all of the deferred messages and releases their blocks to
+    /// the allocator under a single lock.
+    /// Returns the number of messages reclaimed.
+    //*************************************************************************
+    size_t reclaim()
+    {
+      link_type* p_link = deferred_head.exchange(ETL_NULLPTR, etl::memory_order_acquire);
+
+      size_t count = 0U;
+      bool released = true;
+
+      if (p_link != ETL_NULLPTR)
+      {
+        // Destruct outside of the lock.
+        for (link_type* p = p_link; p != ETL_NULLPTR; p = p->next)
+        {
+          get_message(p)->~ireference_counted_message();
+          ++count;
+        }
+
+        lock();
+        while (p_link != ETL_NULLPTR)
+        {
+          link_type* p_next = p_link->next;
+          released = memory_block_allocator.release(p_link) && released;
+          p_link = p_next;
+        }
+        unlock();
+
+        deferred_count -= count;
+      }
+
+      ETL_ASSERT(released, ETL_ERROR(etl::reference_counted_message_pool_release_failure));
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// The number of messages waiting to be reclaimed.
+    //*************************************************************************
+    size_t deferred_size() const
+    {
+      return deferred_count.load();
+    }
+
+    //*************************************************************************
+    /// Are there messages waiting to be reclaimed?
+    //*************************************************************************
+    bool has_deferred() const
+    {
+      return deferred_head.load(etl::memory_order_relaxed) != ETL_NULLPTR;
+    }
+
+#if ETL_USING_CPP11
+    //*****************************************************
+    /// The block size and alignment needed for the messages.
+    //*****************************************************
+    template <typename TMessage1, typename... TMessages>
+    struct pool_message_parameters
+    {
+    private:
+
+      typedef typename etl::reference_counted_message_pool<TCounter>::template pool_message_parameters<TMessage1, TMessages...> base_parameters;
+
+      ETL_STATIC_ASSERT(base_parameters::max_alignment <= VAlignment, "A message needs a greater alignment than the pool");
+
+    public:
+
+      // The maximum size.
+      static constexpr size_t max_size = ((Header_Size + base_parameters::max_size + VAlignment - 1U) / VAlignment) * VAlignment;
+
+      // The maximum alignment.
+      static constexpr size_t max_alignment = VAlignment;
+    };
+#else
+    //*****************************************************
+    /// The block size and alignment needed for the messages.
+    //*****************************************************
+    template <typename TMessage1,              typename TMessage2  = TMessage1, typename TMessage3  = TMessage1, typename TMessage4  = TMessage1,
+              typename TMessage5  = TMessage1, typename TMessage6  = TMessage1, typename TMessage7  = TMessage1, typename TMessage8  = TMessage1>
+    struct pool_message_parameters
+    {
+    private:
+
+      typedef typename etl::reference_counted_message_pool<TCounter>::template pool_message_parameters<TMessage1, TMessage2, TMessage3, TMessage4,
+                                                                                                       TMessage5, TMessage6, TMessage7, TMessage8> base_parameters;
+
+      ETL_STATIC_ASSERT(base_parameters::max_alignment <= VAlignment, "A message needs a greater alignment than the pool");
+
+    public:
+
+      static const size_t max_size      = ((Header_Size + base_parameters::max_size + VAlignment - 1U) / VAlignment) * VAlignment;
+      static const size_t max_alignment = VAlignment;
+    };
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Allocates a block for a message and returns the address of the message.
+    //*************************************************************************
+    template <typename TMessage>
+    void* allocate_block()
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<etl::imessage, TMessage>::value), "Not a message type");
+
+      typedef etl::reference_counted_message<TMessage, TCounter> rcm_t;
+
+      ETL_STATIC_ASSERT(etl::alignment_of<rcm_t>::value <= VAlignment, "The message needs a greater alignment than the pool");
+
+      lock();
+      char* p_block = static_cast<char*>(memory_block_allocator.allocate(Header_Size + sizeof(rcm_t), VAlignment));
+      unlock();
+
+      ETL_ASSERT((p_block != ETL_NULLPTR), ETL_ERROR(etl::reference_counted_message_pool_allocation_failure));
+
+      return (p_block != ETL_NULLPTR) ? static_cast<void*>(p_block + Header_Size) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    static link_type* get_link(const etl::ireference_counted_message& rcmessage)
+    {
+      char* p_message = reinterpret_cast<char*>(const_cast<etl::ireference_counted_message*>(&rcmessage));
+
+      return reinterpret_cast<link_type*>(p_message - Header_Size);
+    }
+
+    //*************************************************************************
+    static etl::ireference_counted_message* get_message(link_type* p_link)
+    {
+      return reinterpret_cast<etl::ireference_counted_message*>(reinterpret_cast<char*>(p_link) + Header_Size);
+    }
+
+    /// The raw memory block pool.
+    etl::imemory_block_allocator& memory_block_allocator;
+
+    /// The messages waiting to be reclaimed.
+    etl::atomic<link_type*> deferred_head;
+    etl::atomic<size_t>     deferred_count;
+
+    // Should not be copied.
+    deferred_reference_counted_message_pool(const deferred_reference_counted_message_pool&) ETL_DELETE;
+    deferred_reference_counted_message_pool& operator =(const deferred_reference_counted_message_pool&) ETL_DELETE;
+  };
+
+  template <typename TCounter, size_t VAlignment>
+  ETL_CONSTANT size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::Alignment;
+
+  template <typename TCounter, size_t VAlignment>
+  ETL_CONSTANT size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::Header_Size;
+
+#if ETL_USING_CPP11
+  template <typename TCounter, size_t VAlignment>
+  template <typename TMessage1, typename... TMessages>
+  constexpr size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::pool_message_parameters<TMessage1, TMessages...>::max_size;
+
+  template <typename TCounter, size_t VAlignment>
+  template <typename TMessage1, typename... TMessages>
+  constexpr size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::pool_message_parameters<TMessage1, TMessages...>::max_alignment;
+
+  using atomic_counted_deferred_message_pool = deferred_reference_counted_message_pool<etl::atomic_int>;
+#else
+  template <typename TCounter, size_t VAlignment>
+  template <typename TMessage1, typename TMessage2, typename TMessage3, typename TMessage4,
+            typename TMessage5, typename TMessage6, typename TMessage7, typename TMessage8>
+  const size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::pool_message_parameters<TMessage1, TMessage2, TMessage3, TMessage4, TMessage5, TMessage6, TMessage7, TMessage8>::max_size;
+
+  template <typename TCounter, size_t VAlignment>
+  template <typename TMessage1, typename TMessage2, typename TMessage3, typename TMessage4,
+            typename TMessage5, typename TMessage6, typename TMessage7, typename TMessage8>
+  const size_t deferred_reference_counted_message_pool<TCounter, VAlignment>::pool_message_parameters<TMessage1, TMessage2, TMessage3, TMessage4, TMessage5, TMessage6, TMessage7, TMessage8>::max_alignment;
+#endif
+}
+
+#endif
+#endif
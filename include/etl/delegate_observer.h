@@ -39,6 +39,8 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "utility.h"
+#include "span.h"
+#include "file_error_numbers.h"
 
 namespace etl
 {
@@ -72,6 +74,9 @@ namespace etl
 
   //*********************************************************************
   /// The object that is being observed.
+  /// Observers are etl::delegate objects, so notifications are dispatched
+  /// without a virtual call.
+  ///\tparam TNotification The notification type.
   ///\tparam MAX_OBSERVERS The maximum number of observers that can be accommodated.
   ///\ingroup observer
   //*********************************************************************
@@ -79,7 +84,7 @@ namespace etl
   class delegate_observable
   {
   public:
-    
+
     typedef etl::delegate<void(TNotification)> observer_type;
 
   private:
@@ -89,7 +94,7 @@ namespace etl
     //***********************************
     struct observer_item
     {
-      observer_item(observer_type observer_)
+      observer_item(const observer_type& observer_)
         : observer(observer_)
         , enabled(true)
       {
@@ -104,8 +109,8 @@ namespace etl
     //***********************************
     struct compare_observers
     {
-      compare_observers(observer_type& observer_)
-        : observer(&observer_)
+      compare_observers(const observer_type& observer_)
+        : observer(observer_)
       {
       }
 
@@ -114,10 +119,11 @@ namespace etl
         return observer == item.observer;
       }
 
-      observer_type observer;
+      const observer_type& observer;
     };
 
     typedef etl::vector<observer_item, MAX_OBSERVERS> Observer_List;
+    typedef etl::vector<observer_type, MAX_OBSERVERS> Dispatch_List;
 
   public:
 
@@ -126,23 +132,24 @@ namespace etl
 
     //*****************************************************************
     /// Add an observer to the list.
-    /// If asserts or exceptions are enabled then an etl::observable_observer_list_full
+    /// If asserts or exceptions are enabled then an etl::delegate_observer_list_full
     /// is emitted if the observer list is already full.
     ///\param observer A reference to the observer.
     //*****************************************************************
-    void add_observer(observer_type& observer)
+    void add_observer(const observer_type& observer)
     {
-		  // See if we already have it in our list.
+      // See if we already have it in our list.
       typename Observer_List::iterator i_observer_item = find_observer(observer);
 
-		  // Not there?
+      // Not there?
       if (i_observer_item == observer_list.end())
       {
         // Is there enough room?
-        ETL_ASSERT_OR_RETURN(!observer_list.full(), ETL_ERROR(etl::observer_list_full));
+        ETL_ASSERT_OR_RETURN(!observer_list.full(), ETL_ERROR(etl::delegate_observer_list_full));
 
         // Add it.
         observer_list.push_back(observer_item(observer));
+        update_dispatch_list();
       }
     }
 
@@ -151,7 +158,7 @@ namespace etl
     ///\param observer A reference to the observer.
     ///\return <b>true</b> if the observer was removed, <b>false</b> if not.
     //*****************************************************************
-    bool remove_observer(observer_type& observer)
+    bool remove_observer(const observer_type& observer)
     {
       // See if we have it in our list.
       typename Observer_List::iterator i_observer_item = find_observer(observer);
@@ -161,6 +168,7 @@ namespace etl
       {
         // Erase it.
         observer_list.erase(i_observer_item);
+        update_dispatch_list();
         return true;
       }
       else
@@ -174,7 +182,7 @@ namespace etl
     ///\param observer A reference to the observer.
     ///\param state    <b>true</b> to enable, <b>false</b> to disable. Default is enable.
     //*****************************************************************
-    void enable_observer(observer_type& observer, bool state = true)
+    void enable_observer(const observer_type& observer, bool state = true)
     {
       // See if we have it in our list.
       typename Observer_List::iterator i_observer_item = find_observer(observer);
@@ -183,22 +191,16 @@ namespace etl
       if (i_observer_item != observer_list.end())
       {
         i_observer_item->enabled = state;
+        update_dispatch_list();
       }
     }
 
     //*****************************************************************
     /// Disable an observer
     //*****************************************************************
-    void disable_observer(observer_type& observer)
+    void disable_observer(const observer_type& observer)
     {
-      // See if we have it in our list.
-      typename Observer_List::iterator i_observer_item = find_observer(observer);
-
-      // Found it?
-      if (i_observer_item != observer_list.end())
-      {
-        i_observer_item->enabled = false;
-      }
+      enable_observer(observer, false);
     }
 
     //*****************************************************************
@@ -207,6 +209,7 @@ namespace etl
     void clear_observers()
     {
       observer_list.clear();
+      dispatch_list.clear();
     }
 
     //*****************************************************************
@@ -219,43 +222,75 @@ namespace etl
 
     //*****************************************************************
     /// Notify all of the observers, sending them the notification.
-    ///\tparam TNotification The notification type.
     ///\param n The notification.
     //*****************************************************************
-    void notify_observers(TNotification n)
+    void notify_observers(TNotification n) const
     {
-      typename Observer_List::iterator i_observer_item = observer_list.begin();
+      typename Dispatch_List::const_iterator i_observer = dispatch_list.begin();
 
-      while (i_observer_item != observer_list.end())
+      while (i_observer != dispatch_list.end())
       {
-        if (i_observer_item->enabled)
+        (*i_observer)(n);
+        ++i_observer;
+      }
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers with a batch of notifications.
+    /// Each observer receives the whole batch before the next observer
+    /// is called.
+    ///\param batch The notifications.
+    //*****************************************************************
+    template <typename T>
+    void notify_observers(etl::span<const T> batch) const
+    {
+      typename Dispatch_List::const_iterator i_observer = dispatch_list.begin();
+
+      while (i_observer != dispatch_list.end())
+      {
+        const observer_type& observer = *i_observer;
+
+        for (typename etl::span<const T>::iterator i_notification = batch.begin(); i_notification != batch.end(); ++i_notification)
         {
-          i_observer_item->p_observer->notification(n);
+          observer(*i_notification);
         }
 
-        ++i_observer_item;
+        ++i_observer;
       }
     }
 
-  protected:
+  private:
 
-    ~observable()
+    //*****************************************************************
+    /// Rebuilds the list of enabled observers.
+    //*****************************************************************
+    void update_dispatch_list()
     {
-    }
+      dispatch_list.clear();
 
-  private:
+      for (typename Observer_List::const_iterator i_observer_item = observer_list.begin(); i_observer_item != observer_list.end(); ++i_observer_item)
+      {
+        if (i_observer_item->enabled)
+        {
+          dispatch_list.push_back(i_observer_item->observer);
+        }
+      }
+    }
 
     //*****************************************************************
     /// Find an observer in the list.
     /// Returns the end of the list if not found.
     //*****************************************************************
-    typename Observer_List::iterator find_observer(observer_type& observer_)
+    typename Observer_List::iterator find_observer(const observer_type& observer_)
     {
       return etl::find_if(observer_list.begin(), observer_list.end(), compare_observers(observer_));
     }
 
     /// The list of observers.
     Observer_List observer_list;
+
+    /// The enabled observers, in the order they were added.
+    Dispatch_List dispatch_list;
   };
 }
 
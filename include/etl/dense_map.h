@@ -0,0 +1,768 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_MAP_INCLUDED
+#define ETL_DENSE_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "memory.h"
+#include "alignment.h"
+#include "smallest.h"
+#include "placement_new.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "private/dense_occupancy.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_map dense_map
+/// A map of the integral keys 0 to VMax - 1, held as an array of VMax
+/// values indexed by key, with one occupancy bit per key. Insert, erase and
+/// find are O(1) and iteration is in key order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the dense_map.
+  ///\ingroup dense_map
+  //***************************************************************************
+  class dense_map_exception : public etl::exception
+  {
+  public:
+
+    dense_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the dense_map.
+  ///\ingroup dense_map
+  //***************************************************************************
+  class dense_map_out_of_range : public etl::dense_map_exception
+  {
+  public:
+
+    dense_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::dense_map_exception(ETL_ERROR_TEXT("dense_map:range", ETL_DENSE_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the dense_map.
+  ///\ingroup dense_map
+  //***************************************************************************
+  class dense_map_out_of_bounds : public etl::dense_map_exception
+  {
+  public:
+
+    dense_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::dense_map_exception(ETL_ERROR_TEXT("dense_map:bounds", ETL_DENSE_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A map of the keys 0 to VMax - 1.
+  ///\tparam VMax    The number of possible keys.
+  ///\tparam TMapped The mapped type.
+  ///\tparam TKey    The key type. Defaults to the smallest unsigned type that holds VMax - 1.
+  ///\ingroup dense_map
+  //***************************************************************************
+  template <size_t VMax, typename TMapped, typename TKey = typename etl::smallest_uint_for_value<VMax - 1U>::type>
+  class dense_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, TMapped> value_type;
+    typedef TKey                                   key_type;
+    typedef TMapped                                mapped_type;
+    typedef etl::less<TKey>                        key_compare;
+    typedef value_type&                            reference;
+    typedef const value_type&                      const_reference;
+    typedef value_type*                            pointer;
+    typedef const value_type*                      const_pointer;
+    typedef size_t                                 size_type;
+    typedef ptrdiff_t                              difference_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = VMax;
+
+  private:
+
+    typedef etl::private_dense::occupancy<VMax> occupancy_type;
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class dense_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , key(occupancy_type::Npos)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        key = p_map->occupancy.find_next(key + 1U);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        key = p_map->occupancy.find_previous(key);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_map->value(key);
+      }
+
+      pointer operator ->() const
+      {
+        return &p_map->value(key);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.key == rhs.key;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(dense_map* p_map_, size_t key_)
+        : p_map(p_map_)
+        , key(key_)
+      {
+      }
+
+      dense_map* p_map;
+      size_t     key;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class dense_map;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , key(occupancy_type::Npos)
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : p_map(other.p_map)
+        , key(other.key)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        key = p_map->occupancy.find_next(key + 1U);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        key = p_map->occupancy.find_previous(key);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_map->value(key);
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_map->value(key);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.key == rhs.key;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const dense_map* p_map_, size_t key_)
+        : p_map(p_map_)
+        , key(key_)
+      {
+      }
+
+      const dense_map* p_map;
+      size_t           key;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_map()
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dense_map(const dense_map& other)
+    {
+      insert(other.begin(), other.end());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    dense_map(dense_map&& other)
+    {
+      move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_map(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~dense_map()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dense_map& operator =(const dense_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        insert(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    dense_map& operator =(dense_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator               begin()         { return iterator(this, occupancy.first()); }
+    const_iterator         begin() const   { return const_iterator(this, occupancy.first()); }
+    const_iterator         cbegin() const  { return const_iterator(this, occupancy.first()); }
+    iterator               end()           { return iterator(this, occupancy_type::Npos); }
+    const_iterator         end() const     { return const_iterator(this, occupancy_type::Npos); }
+    const_iterator         cend() const    { return const_iterator(this, occupancy_type::Npos); }
+    reverse_iterator       rbegin()        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const  { return const_reverse_iterator(end()); }
+    reverse_iterator       rend()          { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const    { return const_reverse_iterator(begin()); }
+
+    //*************************************************************************
+    /// Returns a reference to the mapped value for the key, inserting a
+    /// default constructed one if the key is not in the map.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_range if the key is not less than VMax.
+    //*************************************************************************
+    mapped_type& operator [](const key_type& key)
+    {
+      return insert(value_type(key, mapped_type())).first->second;
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    mapped_type& at(const key_type& key)
+    {
+      ETL_ASSERT(contains(key), ETL_ERROR(dense_map_out_of_bounds));
+
+      return value(static_cast<size_t>(key)).second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      ETL_ASSERT(contains(key), ETL_ERROR(dense_map_out_of_bounds));
+
+      return value(static_cast<size_t>(key)).second;
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if its key is not already in the map.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_range if the key is not less than VMax.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      const size_t key = static_cast<size_t>(value.first);
+
+      if (!occupancy_type::in_range(value.first))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_map_out_of_range));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (occupancy.test(key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, key), false);
+      }
+
+      ::new (&storage[key]) value_type(value);
+      occupancy.set(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, key), true);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value by moving it, if its key is not already in the map.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_range if the key is not less than VMax.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(value_type&& value)
+    {
+      const size_t key = static_cast<size_t>(value.first);
+
+      if (!occupancy_type::in_range(value.first))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_map_out_of_range));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (occupancy.test(key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, key), false);
+      }
+
+      ::new (&storage[key]) value_type(etl::move(value));
+      occupancy.set(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, key), true);
+    }
+#endif
+
+    //*************************************************************************
+    /// Inserts a value. The hint is not used.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*************************************************************************
+    /// Inserts a range of values.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Inserts a value or assigns to the mapped value of an existing key.
+    /// If asserts or exceptions are enabled, emits an etl::dense_map_out_of_range if the key is not less than VMax.
+    ///\return An iterator to the element and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& mapped)
+    {
+      if (contains(key))
+      {
+        value(static_cast<size_t>(key)).second = mapped;
+
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, static_cast<size_t>(key)), false);
+      }
+
+      return insert(value_type(key, mapped));
+    }
+
+    //*************************************************************************
+    /// Erases the key.
+    ///\return The number of elements erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      if (!contains(key))
+      {
+        return 0U;
+      }
+
+      destroy(static_cast<size_t>(key));
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t key = position.key;
+
+      destroy(key);
+
+      return iterator(this, occupancy.find_next(key + 1U));
+    }
+
+    //*************************************************************************
+    /// Erases the elements in a range.
+    ///\return An iterator to the element after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(this, last.key);
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(etl::is_trivially_destructible<value_type>::value)
+      {
+        occupancy.clear();
+      }
+      else
+      {
+        size_t key = occupancy.first();
+
+        while (key != occupancy_type::Npos)
+        {
+          destroy(key);
+          key = occupancy.find_next(key + 1U);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the key.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      return contains(key) ? iterator(this, static_cast<size_t>(key)) : end();
+    }
+
+    //*************************************************************************
+    /// Finds the key.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return contains(key) ? const_iterator(this, static_cast<size_t>(key)) : end();
+    }
+
+    //*************************************************************************
+    /// Checks whether the key is in the map.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return occupancy_type::in_range(key) && occupancy.test(static_cast<size_t>(key));
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key not less than 'key'.
+    //*************************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return iterator(this, occupancy.lower_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key not less than 'key'.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(this, occupancy.lower_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key greater than 'key'.
+    //*************************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      return iterator(this, occupancy.upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key greater than 'key'.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(this, occupancy.upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the range of elements with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const key_type& key)
+    {
+      return ETL_OR_STD::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the range of elements with the key.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison functor.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return occupancy.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return occupancy.size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return occupancy.size() == VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax - occupancy.size();
+    }
+
+  private:
+
+    typedef typename etl::aligned_storage<sizeof(value_type), etl::alignment_of<value_type>::value>::type storage_type;
+
+    //*************************************************************************
+    value_type& value(size_t key)
+    {
+      return *reinterpret_cast<value_type*>(&storage[key]);
+    }
+
+    //*************************************************************************
+    const value_type& value(size_t key) const
+    {
+      return *reinterpret_cast<const value_type*>(&storage[key]);
+    }
+
+    //*************************************************************************
+    void destroy(size_t key)
+    {
+      etl::destroy_at(&value(key));
+      occupancy.reset(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    void move_from(dense_map& other)
+    {
+      size_t key = other.occupancy.first();
+
+      while (key != occupancy_type::Npos)
+      {
+        insert(etl::move(other.value(key)));
+        key = other.occupancy.find_next(key + 1U);
+      }
+
+      other.clear();
+    }
+#endif
+
+    occupancy_type occupancy;
+    storage_type   storage[VMax];
+  };
+
+  template <size_t VMax, typename TMapped, typename TKey>
+  ETL_CONSTANT size_t dense_map<VMax, TMapped, TKey>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup dense_map
+  //***************************************************************************
+  template <size_t VMax, typename TMapped, typename TKey>
+  bool operator ==(const etl::dense_map<VMax, TMapped, TKey>& lhs, const etl::dense_map<VMax, TMapped, TKey>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup dense_map
+  //***************************************************************************
+  template <size_t VMax, typename TMapped, typename TKey>
+  bool operator !=(const etl::dense_map<VMax, TMapped, TKey>& lhs, const etl::dense_map<VMax, TMapped, TKey>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,450 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_SET_INCLUDED
+#define ETL_DENSE_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "utility.h"
+#include "smallest.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "private/dense_occupancy.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup dense_set dense_set
+/// A set of the integral keys 0 to VMax - 1, held as one occupancy bit per
+/// key. Insert, erase and find are O(1) and iteration is in key order.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the dense_set.
+  ///\ingroup dense_set
+  //***************************************************************************
+  class dense_set_exception : public etl::exception
+  {
+  public:
+
+    dense_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the dense_set.
+  ///\ingroup dense_set
+  //***************************************************************************
+  class dense_set_out_of_range : public etl::dense_set_exception
+  {
+  public:
+
+    dense_set_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::dense_set_exception(ETL_ERROR_TEXT("dense_set:range", ETL_DENSE_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A set of the keys 0 to VMax - 1.
+  /// The keys are not stored, so the iterators return them by value.
+  ///\tparam VMax The number of possible keys.
+  ///\tparam TKey The key type. Defaults to the smallest unsigned type that holds VMax - 1.
+  ///\ingroup dense_set
+  //***************************************************************************
+  template <size_t VMax, typename TKey = typename etl::smallest_uint_for_value<VMax - 1U>::type>
+  class dense_set
+  {
+  private:
+
+    typedef etl::private_dense::occupancy<VMax> occupancy_type;
+
+  public:
+
+    typedef TKey             key_type;
+    typedef TKey             value_type;
+    typedef etl::less<TKey>  key_compare;
+    typedef etl::less<TKey>  value_compare;
+    typedef value_type       reference;
+    typedef value_type       const_reference;
+    typedef size_t           size_type;
+    typedef ptrdiff_t        difference_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = VMax;
+
+    //*************************************************************************
+    /// const_iterator.
+    /// The elements of a set may not be modified, so iterator is the same type.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type, ptrdiff_t, const value_type*, value_type>
+    {
+    public:
+
+      friend class dense_set;
+
+      const_iterator()
+        : p_occupancy(ETL_NULLPTR)
+        , key(occupancy_type::Npos)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        key = p_occupancy->find_next(key + 1U);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        key = p_occupancy->find_previous(key);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --(*this);
+        return temp;
+      }
+
+      value_type operator *() const
+      {
+        return static_cast<value_type>(key);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.key == rhs.key;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const occupancy_type* p_occupancy_, size_t key_)
+        : p_occupancy(p_occupancy_)
+        , key(key_)
+      {
+      }
+
+      const occupancy_type* p_occupancy;
+      size_t                key;
+    };
+
+    typedef const_iterator                               iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef const_reverse_iterator                       reverse_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    dense_set()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor from a range.
+    //*************************************************************************
+    template <typename TIterator>
+    dense_set(TIterator first, TIterator last)
+    {
+      insert(first, last);
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    const_iterator         begin() const   { return const_iterator(&occupancy, occupancy.first()); }
+    const_iterator         cbegin() const  { return const_iterator(&occupancy, occupancy.first()); }
+    const_iterator         end() const     { return const_iterator(&occupancy, occupancy_type::Npos); }
+    const_iterator         cend() const    { return const_iterator(&occupancy, occupancy_type::Npos); }
+    const_reverse_iterator rbegin() const  { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const    { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend() const   { return const_reverse_iterator(begin()); }
+
+    //*************************************************************************
+    /// Inserts a key, if it is not already in the set.
+    /// If asserts or exceptions are enabled, emits an etl::dense_set_out_of_range if the key is not less than VMax.
+    ///\return An iterator to the element and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      const size_t key = static_cast<size_t>(value);
+
+      if (!occupancy_type::in_range(value))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(dense_set_out_of_range));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      if (occupancy.test(key))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(&occupancy, key), false);
+      }
+
+      occupancy.set(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(&occupancy, key), true);
+    }
+
+    //*************************************************************************
+    /// Inserts a key. The hint is not used.
+    //*************************************************************************
+    iterator insert(const_iterator /*position*/, const_reference value)
+    {
+      return insert(value).first;
+    }
+
+    //*************************************************************************
+    /// Inserts a range of keys.
+    //*************************************************************************
+    template <typename TIterator>
+    void insert(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        insert(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases the key.
+    ///\return The number of elements erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      if (!contains(key))
+      {
+        return 0U;
+      }
+
+      occupancy.reset(static_cast<size_t>(key));
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t key = position.key;
+
+      occupancy.reset(key);
+
+      return iterator(&occupancy, occupancy.find_next(key + 1U));
+    }
+
+    //*************************************************************************
+    /// Erases the elements in a range.
+    ///\return An iterator to the element after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(&occupancy, last.key);
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      occupancy.clear();
+    }
+
+    //*************************************************************************
+    /// Finds the key.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      return contains(key) ? const_iterator(&occupancy, static_cast<size_t>(key)) : end();
+    }
+
+    //*************************************************************************
+    /// Checks whether the key is in the set.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return occupancy_type::in_range(key) && occupancy.test(static_cast<size_t>(key));
+    }
+
+    //*************************************************************************
+    /// Counts the elements equal to the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element not less than 'key'.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return const_iterator(&occupancy, occupancy.lower_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element greater than 'key'.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      return const_iterator(&occupancy, occupancy.upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the range of elements equal to 'key'.
+    //*************************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
+    {
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(lower_bound(key), upper_bound(key));
+    }
+
+    //*************************************************************************
+    /// Returns the key comparison functor.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return key_compare();
+    }
+
+    //*************************************************************************
+    /// Returns the value comparison functor.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return value_compare();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return occupancy.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether the set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return occupancy.size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return occupancy.size() == VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax - occupancy.size();
+    }
+
+  private:
+
+    occupancy_type occupancy;
+  };
+
+  template <size_t VMax, typename TKey>
+  ETL_CONSTANT size_t dense_set<VMax, TKey>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\ingroup dense_set
+  //***************************************************************************
+  template <size_t VMax, typename TKey>
+  bool operator ==(const etl::dense_set<VMax, TKey>& lhs, const etl::dense_set<VMax, TKey>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\ingroup dense_set
+  //***************************************************************************
+  template <size_t VMax, typename TKey>
+  bool operator !=(const etl::dense_set<VMax, TKey>& lhs, const etl::dense_set<VMax, TKey>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -44,6 +44,8 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "span.h"
+#include "check_policy.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -776,6 +778,46 @@ namespace etl
       return *result;
     }
 
+    //*************************************************************************
+    /// Gets a reference to the item at the index, checked according to the
+    /// policy tag instead of always.
+    ///\return A reference to the item at the index.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, reference>::type
+      at(size_t index, TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
+      }
+
+      iterator result(_begin);
+      result += index;
+
+      return *result;
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the item at the index, checked according to
+    /// the policy tag instead of always.
+    ///\return A const reference to the item at the index.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, const_reference>::type
+      at(size_t index, TPolicy) const
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(index < current_size, ETL_ERROR(deque_out_of_bounds));
+      }
+
+      iterator result(_begin);
+      result += index;
+
+      return *result;
+    }
+
     //*************************************************************************
     /// Gets a reference to the item at the index.
     ///\return A reference to the item at the index.
@@ -1736,6 +1778,42 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Adds an item to the back of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param item The item to push_back to the deque.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, const_reference item)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      }
+
+      create_element_back(item);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the back of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param item The item to push_back to the deque.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, rvalue_reference item)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      }
+
+      create_element_back(etl::move(item));
+    }
+#endif
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
     //*************************************************************************
     /// Emplaces an item to the back of the deque.
@@ -1858,6 +1936,22 @@ namespace etl
       destroy_element_back();
     }
 
+    //*************************************************************************
+    /// Removes an item from the back of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop_back(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
+      }
+
+      destroy_element_back();
+    }
+
     //*************************************************************************
     /// Adds an item to the front of the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full if the deque is already full.
@@ -1886,6 +1980,42 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Adds an item to the front of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param item The item to push_front to the deque.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_front(TPolicy, const_reference item)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      }
+
+      create_element_front(item);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds an item to the front of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param item The item to push_front to the deque.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_front(TPolicy, rvalue_reference item)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(deque_full));
+      }
+
+      create_element_front(etl::move(item));
+    }
+#endif
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
     //*************************************************************************
     /// Emplaces an item to the front of the deque.
@@ -2008,6 +2138,22 @@ namespace etl
       destroy_element_front();
     }
 
+    //*************************************************************************
+    /// Removes an item from the front of the deque, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop_front(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(deque_empty));
+      }
+
+      destroy_element_front();
+    }
+
     //*************************************************************************
     /// Resizes the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full is 'new_size' is too large.
@@ -2106,6 +2252,64 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Calls the function with an etl::span<T> for each contiguous run of
+    /// elements, from front to back. There are at most two runs.
+    ///\param function The function to call.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_segment(TFunction function)
+    {
+      if (!empty())
+      {
+        if (_begin.index < _end.index)
+        {
+          function(etl::span<T>(p_buffer + _begin.index, p_buffer + _end.index));
+        }
+        else
+        {
+          function(etl::span<T>(p_buffer + _begin.index, p_buffer + BUFFER_SIZE));
+
+          if (_end.index != 0)
+          {
+            function(etl::span<T>(p_buffer, p_buffer + _end.index));
+          }
+        }
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls the function with an etl::span<const T> for each contiguous run of
+    /// elements, from front to back. There are at most two runs.
+    ///\param function The function to call.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_segment(TFunction function) const
+    {
+      if (!empty())
+      {
+        if (_begin.index < _end.index)
+        {
+          function(etl::span<const T>(p_buffer + _begin.index, p_buffer + _end.index));
+        }
+        else
+        {
+          function(etl::span<const T>(p_buffer + _begin.index, p_buffer + BUFFER_SIZE));
+
+          if (_end.index != 0)
+          {
+            function(etl::span<const T>(p_buffer, p_buffer + _end.index));
+          }
+        }
+      }
+
+      return function;
+    }
+
 #ifdef ETL_IDEQUE_REPAIR_ENABLE
     //*************************************************************************
     /// Fix the internal pointers after a low level memory copy.
@@ -2605,6 +2809,100 @@ namespace etl
   {
     return !(lhs < rhs);
   }
+
+  namespace private_deque
+  {
+    //*************************************************************************
+    template <typename TOutputIterator>
+    struct copy_segment
+    {
+      explicit copy_segment(TOutputIterator destination_)
+        : destination(destination_)
+      {
+      }
+
+      template <typename TSpan>
+      void operator()(const TSpan& segment)
+      {
+        destination = etl::copy(segment.begin(), segment.end(), destination);
+      }
+
+      TOutputIterator destination;
+    };
+
+    //*************************************************************************
+    template <typename T>
+    struct fill_segment
+    {
+      explicit fill_segment(const T& value_)
+        : value(value_)
+      {
+      }
+
+      void operator()(const etl::span<T>& segment) const
+      {
+        etl::fill(segment.begin(), segment.end(), value);
+      }
+
+      const T& value;
+    };
+
+    //*************************************************************************
+    template <typename TSum>
+    struct accumulate_segment
+    {
+      explicit accumulate_segment(TSum sum_)
+        : sum(sum_)
+      {
+      }
+
+      template <typename TSpan>
+      void operator()(const TSpan& segment)
+      {
+        sum = etl::accumulate(segment.begin(), segment.end(), sum);
+      }
+
+      TSum sum;
+    };
+  }
+
+  //***************************************************************************
+  /// Copies the deque to the destination, one contiguous run at a time.
+  ///\param source      The deque to copy.
+  ///\param destination The start of the destination.
+  ///\return An iterator to one past the last element copied.
+  ///\ingroup deque
+  //***************************************************************************
+  template <typename T, typename TOutputIterator>
+  TOutputIterator copy(const etl::ideque<T>& source, TOutputIterator destination)
+  {
+    return source.for_each_segment(private_deque::copy_segment<TOutputIterator>(destination)).destination;
+  }
+
+  //***************************************************************************
+  /// Assigns the value to every element of the deque, one contiguous run at a time.
+  ///\param destination The deque to fill.
+  ///\param value       The value to assign.
+  ///\ingroup deque
+  //***************************************************************************
+  template <typename T>
+  void fill(etl::ideque<T>& destination, const T& value)
+  {
+    destination.for_each_segment(private_deque::fill_segment<T>(value));
+  }
+
+  //***************************************************************************
+  /// Sums the elements of the deque, one contiguous run at a time.
+  ///\param source The deque to sum.
+  ///\param sum    The initial value.
+  ///\return The sum.
+  ///\ingroup deque
+  //***************************************************************************
+  template <typename T, typename TSum>
+  TSum accumulate(const etl::ideque<T>& source, TSum sum)
+  {
+    return source.for_each_segment(private_deque::accumulate_segment<TSum>(sum)).sum;
+  }
 }
 
 #include "private/minmax_pop.h"
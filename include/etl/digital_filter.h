@@ -0,0 +1,572 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DIGITAL_FILTER_INCLUDED
+#define ETL_DIGITAL_FILTER_INCLUDED
+
+#include "platform.h"
+#include "functional.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "algorithm.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/dsp_simd.h"
+
+#include <stdint.h>
+
+///\defgroup digital_filter digital_filter
+/// FIR, biquad IIR and decimating FIR filters for floating point and fixed point samples.
+/// Fixed point samples and coefficients are signed integers with Fraction_Bits
+/// fractional bits, accumulated at double width and rounded and saturated on output.
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_dsp
+  {
+    //*************************************************************************
+    /// Fixed point sample traits.
+    //*************************************************************************
+    template <typename T, typename TAccumulator, size_t FIR_Bits>
+    struct fixed_point_traits
+    {
+      typedef TAccumulator accumulator_type;
+
+      static ETL_CONSTANT size_t FIR_Fraction_Bits = FIR_Bits;
+      static ETL_CONSTANT size_t IIR_Fraction_Bits = FIR_Bits - 1U; // One more integer bit for the feedback coefficients.
+
+      //*******************************
+      /// Rounds, rescales and saturates an accumulated value.
+      //*******************************
+      template <size_t Fraction_Bits>
+      static T to_sample(accumulator_type value)
+      {
+        value += (accumulator_type(1) << Fraction_Bits) >> 1;
+        value >>= Fraction_Bits; // Arithmetic shift.
+
+        if (value > accumulator_type(etl::integral_limits<T>::max))
+        {
+          return etl::integral_limits<T>::max;
+        }
+
+        if (value < accumulator_type(etl::integral_limits<T>::min))
+        {
+          return etl::integral_limits<T>::min;
+        }
+
+        return static_cast<T>(value);
+      }
+    };
+
+    template <typename T, typename TAccumulator, size_t FIR_Bits>
+    ETL_CONSTANT size_t fixed_point_traits<T, TAccumulator, FIR_Bits>::FIR_Fraction_Bits;
+
+    template <typename T, typename TAccumulator, size_t FIR_Bits>
+    ETL_CONSTANT size_t fixed_point_traits<T, TAccumulator, FIR_Bits>::IIR_Fraction_Bits;
+
+    //*************************************************************************
+    /// Sample traits. Floating point.
+    //*************************************************************************
+    template <typename T>
+    struct dsp_traits
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "Samples must be floating point, int8_t, int16_t or int32_t");
+
+      typedef T accumulator_type;
+
+      static ETL_CONSTANT size_t FIR_Fraction_Bits = 0U;
+      static ETL_CONSTANT size_t IIR_Fraction_Bits = 0U;
+
+      template <size_t Fraction_Bits>
+      static T to_sample(accumulator_type value)
+      {
+        return value;
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t dsp_traits<T>::FIR_Fraction_Bits;
+
+    template <typename T>
+    ETL_CONSTANT size_t dsp_traits<T>::IIR_Fraction_Bits;
+
+    //*************************************************************************
+    /// Q7 samples.
+    //*************************************************************************
+    template <>
+    struct dsp_traits<int8_t> : public fixed_point_traits<int8_t, int32_t, 7U>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Q15 samples.
+    //*************************************************************************
+    template <>
+    struct dsp_traits<int16_t> : public fixed_point_traits<int16_t, int64_t, 15U>
+    {
+    };
+
+    //*************************************************************************
+    /// Q31 samples.
+    //*************************************************************************
+    template <>
+    struct dsp_traits<int32_t> : public fixed_point_traits<int32_t, int64_t, 31U>
+    {
+    };
+#else
+    //*************************************************************************
+    /// Q15 samples.
+    //*************************************************************************
+    template <>
+    struct dsp_traits<int16_t> : public fixed_point_traits<int16_t, int32_t, 15U>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// The coefficients and delay line of an FIR filter.
+    /// The delay line is stored twice over, so that the latest Taps samples
+    /// are always contiguous, oldest first, and the output is one dot product.
+    //*************************************************************************
+    template <typename T, size_t Taps, size_t Fraction_Bits>
+    class fir_core
+    {
+    public:
+
+      typedef dsp_traits<T>                        traits;
+      typedef typename traits::accumulator_type    accumulator_type;
+
+      //*******************************
+      fir_core()
+      {
+        etl::fill_n(coefficients, Taps, T(0));
+        reset();
+      }
+
+      //*******************************
+      void set_coefficients(etl::span<const T, Taps> coefficients_)
+      {
+        // Reversed, to match the oldest first delay line.
+        etl::reverse_copy(coefficients_.begin(), coefficients_.end(), coefficients);
+      }
+
+      //*******************************
+      void reset()
+      {
+        etl::fill_n(delay_line, 2U * Taps, T(0));
+        index = 0U;
+      }
+
+      //*******************************
+      void push(T sample)
+      {
+        delay_line[index]        = sample;
+        delay_line[index + Taps] = sample;
+
+        index = (index + 1U == Taps) ? 0U : index + 1U;
+      }
+
+      //*******************************
+      T output() const
+      {
+        const accumulator_type sum = dot_product<T, accumulator_type>::calculate(coefficients, delay_line + index, Taps);
+
+        return traits::template to_sample<Fraction_Bits>(sum);
+      }
+
+    private:
+
+      T      coefficients[Taps];
+      T      delay_line[2U * Taps];
+      size_t index;
+    };
+  }
+
+  //***************************************************************************
+  /// Finite impulse response filter.
+  /// y[n] = sum(h[k] * x[n - k]) for k = 0 to Taps - 1.
+  ///\tparam T             float, double, int8_t (Q7), int16_t (Q15) or int32_t (Q31).
+  ///\tparam Taps          The number of coefficients.
+  ///\tparam Fraction_Bits The fractional bits of fixed point coefficients. Ignored for floating point.
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename T, size_t Taps, size_t Fraction_Bits = private_dsp::dsp_traits<T>::FIR_Fraction_Bits>
+  class fir_filter : public etl::unary_function<T, T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Taps > 0U, "Taps must be greater than 0");
+
+    static ETL_CONSTANT size_t Tap_Count = Taps;
+
+    typedef T value_type;
+
+    //*****************************************************************
+    /// Constructor. All coefficients zero.
+    //*****************************************************************
+    fir_filter()
+    {
+    }
+
+    //*****************************************************************
+    /// Constructor.
+    ///\param coefficients h[0] to h[Taps - 1].
+    //*****************************************************************
+    explicit fir_filter(etl::span<const T, Taps> coefficients)
+    {
+      core.set_coefficients(coefficients);
+    }
+
+    //*****************************************************************
+    /// Sets the coefficients, h[0] to h[Taps - 1].
+    /// The delay line is kept.
+    //*****************************************************************
+    void set_coefficients(etl::span<const T, Taps> coefficients)
+    {
+      core.set_coefficients(coefficients);
+    }
+
+    //*****************************************************************
+    /// Clears the delay line.
+    //*****************************************************************
+    void reset()
+    {
+      core.reset();
+    }
+
+    //*****************************************************************
+    /// Filters one sample.
+    //*****************************************************************
+    T process(T sample)
+    {
+      core.push(sample);
+
+      return core.output();
+    }
+
+    //*****************************************************************
+    /// Filters a block of samples.
+    /// The input and output may be the same.
+    ///\return The number of samples filtered, the smaller of the two sizes.
+    //*****************************************************************
+    size_t process(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        core.push(input[i]);
+        output[i] = core.output();
+      }
+
+      return n;
+    }
+
+    //*****************************************************************
+    /// operator ()
+    //*****************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    private_dsp::fir_core<T, Taps, Fraction_Bits> core;
+  };
+
+  template <typename T, size_t Taps, size_t Fraction_Bits>
+  ETL_CONSTANT size_t fir_filter<T, Taps, Fraction_Bits>::Tap_Count;
+
+  //***************************************************************************
+  /// Decimating finite impulse response filter.
+  /// Filters and keeps every Factor'th sample, only calculating the outputs that are kept.
+  ///\tparam T             float, double, int8_t (Q7), int16_t (Q15) or int32_t (Q31).
+  ///\tparam Taps          The number of coefficients.
+  ///\tparam Factor        The decimation factor.
+  ///\tparam Fraction_Bits The fractional bits of fixed point coefficients. Ignored for floating point.
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename T, size_t Taps, size_t Factor, size_t Fraction_Bits = private_dsp::dsp_traits<T>::FIR_Fraction_Bits>
+  class fir_decimator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Taps > 0U, "Taps must be greater than 0");
+    ETL_STATIC_ASSERT(Factor > 0U, "Factor must be greater than 0");
+
+    static ETL_CONSTANT size_t Tap_Count         = Taps;
+    static ETL_CONSTANT size_t Decimation_Factor = Factor;
+
+    typedef T value_type;
+
+    //*****************************************************************
+    /// Constructor. All coefficients zero.
+    //*****************************************************************
+    fir_decimator()
+      : phase(0U)
+    {
+    }
+
+    //*****************************************************************
+    /// Constructor.
+    ///\param coefficients h[0] to h[Taps - 1].
+    //*****************************************************************
+    explicit fir_decimator(etl::span<const T, Taps> coefficients)
+      : phase(0U)
+    {
+      core.set_coefficients(coefficients);
+    }
+
+    //*****************************************************************
+    /// Sets the coefficients, h[0] to h[Taps - 1].
+    /// The delay line is kept.
+    //*****************************************************************
+    void set_coefficients(etl::span<const T, Taps> coefficients)
+    {
+      core.set_coefficients(coefficients);
+    }
+
+    //*****************************************************************
+    /// Clears the delay line and the decimation phase.
+    //*****************************************************************
+    void reset()
+    {
+      core.reset();
+      phase = 0U;
+    }
+
+    //*****************************************************************
+    /// Adds one sample.
+    ///\param output Set to the filtered sample when one is produced.
+    ///\return <b>true</b> if an output was produced.
+    //*****************************************************************
+    bool process(T sample, T& output)
+    {
+      core.push(sample);
+
+      if (++phase == Factor)
+      {
+        phase  = 0U;
+        output = core.output();
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*****************************************************************
+    /// Filters and decimates a block of samples.
+    /// Stops at the end of the input, or just after the input that fills the output.
+    /// An output of input.size() / Factor + 1 samples is always enough.
+    ///\return The number of outputs written.
+    //*****************************************************************
+    size_t process(etl::span<const T> input, etl::span<T> output)
+    {
+      size_t n_output = 0U;
+
+      for (size_t i = 0U; (i < input.size()) && (n_output < output.size()); ++i)
+      {
+        if (process(input[i], output[n_output]))
+        {
+          ++n_output;
+        }
+      }
+
+      return n_output;
+    }
+
+  private:
+
+    private_dsp::fir_core<T, Taps, Fraction_Bits> core;
+    size_t phase;
+  };
+
+  template <typename T, size_t Taps, size_t Factor, size_t Fraction_Bits>
+  ETL_CONSTANT size_t fir_decimator<T, Taps, Factor, Fraction_Bits>::Tap_Count;
+
+  template <typename T, size_t Taps, size_t Factor, size_t Fraction_Bits>
+  ETL_CONSTANT size_t fir_decimator<T, Taps, Factor, Fraction_Bits>::Decimation_Factor;
+
+  //***************************************************************************
+  /// Cascade of second order IIR sections, in direct form I.
+  /// y[n] = b0 * x[n] + b1 * x[n - 1] + b2 * x[n - 2] - a1 * y[n - 1] - a2 * y[n - 2]
+  /// Coefficients are normalised so that a0 is 1 and are supplied as
+  /// { b0, b1, b2, a1, a2 } for each stage in turn.
+  /// Fixed point stage outputs are rounded and saturated before the next stage.
+  ///\tparam T             float, double, int8_t (Q1.6), int16_t (Q1.14) or int32_t (Q1.30).
+  ///\tparam Stages        The number of second order stages.
+  ///\tparam Fraction_Bits The fractional bits of fixed point coefficients. Ignored for floating point.
+  ///\ingroup digital_filter
+  //***************************************************************************
+  template <typename T, size_t Stages, size_t Fraction_Bits = private_dsp::dsp_traits<T>::IIR_Fraction_Bits>
+  class biquad_cascade : public etl::unary_function<T, T>
+  {
+  private:
+
+    typedef private_dsp::dsp_traits<T>           traits;
+    typedef typename traits::accumulator_type    accumulator_type;
+
+  public:
+
+    ETL_STATIC_ASSERT(Stages > 0U, "Stages must be greater than 0");
+
+    static ETL_CONSTANT size_t Stage_Count            = Stages;
+    static ETL_CONSTANT size_t Coefficients_Per_Stage = 5U;
+    static ETL_CONSTANT size_t Coefficient_Count      = 5U * Stages;
+
+    typedef T value_type;
+
+    //*****************************************************************
+    /// Constructor. All coefficients zero.
+    //*****************************************************************
+    biquad_cascade()
+    {
+      etl::fill_n(coefficients, 5U * Stages, T(0));
+      reset();
+    }
+
+    //*****************************************************************
+    /// Constructor.
+    ///\param coefficients { b0, b1, b2, a1, a2 } for each stage.
+    //*****************************************************************
+    explicit biquad_cascade(etl::span<const T, 5U * Stages> coefficients_)
+    {
+      set_coefficients(coefficients_);
+      reset();
+    }
+
+    //*****************************************************************
+    /// Sets the coefficients, { b0, b1, b2, a1, a2 } for each stage.
+    /// The state is kept.
+    //*****************************************************************
+    void set_coefficients(etl::span<const T, 5U * Stages> coefficients_)
+    {
+      etl::copy(coefficients_.begin(), coefficients_.end(), coefficients);
+    }
+
+    //*****************************************************************
+    /// Clears the state of all stages.
+    //*****************************************************************
+    void reset()
+    {
+      etl::fill_n(state, 4U * Stages, T(0));
+    }
+
+    //*****************************************************************
+    /// Filters one sample.
+    //*****************************************************************
+    T process(T sample)
+    {
+      for (size_t stage = 0U; stage < Stages; ++stage)
+      {
+        sample = process_stage(stage, sample);
+      }
+
+      return sample;
+    }
+
+    //*****************************************************************
+    /// Filters a block of samples, one stage at a time.
+    /// The input and output may be the same.
+    ///\return The number of samples filtered, the smaller of the two sizes.
+    //*****************************************************************
+    size_t process(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = process_stage(0U, input[i]);
+      }
+
+      for (size_t stage = 1U; stage < Stages; ++stage)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          output[i] = process_stage(stage, output[i]);
+        }
+      }
+
+      return n;
+    }
+
+    //*****************************************************************
+    /// operator ()
+    //*****************************************************************
+    T operator ()(T sample)
+    {
+      return process(sample);
+    }
+
+  private:
+
+    //*****************************************************************
+    /// One second order section.
+    //*****************************************************************
+    T process_stage(size_t stage, T x)
+    {
+      const T* c = coefficients + (5U * stage);
+      T*       s = state + (4U * stage); // x[n-1], x[n-2], y[n-1], y[n-2]
+
+      accumulator_type sum = (accumulator_type(c[0]) * accumulator_type(x))
+                           + (accumulator_type(c[1]) * accumulator_type(s[0]))
+                           + (accumulator_type(c[2]) * accumulator_type(s[1]))
+                           - (accumulator_type(c[3]) * accumulator_type(s[2]))
+                           - (accumulator_type(c[4]) * accumulator_type(s[3]));
+
+      const T y = traits::template to_sample<Fraction_Bits>(sum);
+
+      s[1] = s[0];
+      s[0] = x;
+      s[3] = s[2];
+      s[2] = y;
+
+      return y;
+    }
+
+    T coefficients[5U * Stages];
+    T state[4U * Stages];
+  };
+
+  template <typename T, size_t Stages, size_t Fraction_Bits>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Fraction_Bits>::Stage_Count;
+
+  template <typename T, size_t Stages, size_t Fraction_Bits>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Fraction_Bits>::Coefficients_Per_Stage;
+
+  template <typename T, size_t Stages, size_t Fraction_Bits>
+  ETL_CONSTANT size_t biquad_cascade<T, Stages, Fraction_Bits>::Coefficient_Count;
+}
+
+#endif
@@ -0,0 +1,378 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EPOCH_RECLAIMER_INCLUDED
+#define ETL_EPOCH_RECLAIMER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "ipool.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup epoch_reclaimer epoch_reclaimer
+/// Safe memory reclamation for lock-free linked structures, using epochs.
+/// Each thread or interrupt context that reads shared nodes acquires a slot,
+/// and brackets its reads with 'enter' and 'exit'. A node that has been
+/// unlinked is retired in the current epoch. The global epoch can only move on
+/// when every context inside a critical section has seen it, so a node retired
+/// two epochs ago cannot still be referenced and is returned to its etl::ipool.
+/// Cheaper than hazard pointers for readers, but a context that stays inside a
+/// critical section holds up all reclamation.
+///\ingroup memory
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup epoch_reclaimer
+  /// A fixed size epoch based reclaimer.
+  /// Does not allocate. The nodes are destroyed in, and released to, the pool
+  /// given to the constructor. The pool's release must be safe to call from
+  /// each context that retires nodes.
+  ///\tparam VSlots   The maximum number of contexts that may use the reclaimer at once.
+  ///\tparam VRetired The number of nodes that a slot may retire in each epoch.
+  //***************************************************************************
+  template <size_t VSlots, size_t VRetired = 16U>
+  class epoch_reclaimer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSlots > 0U,   "There must be at least one slot");
+    ETL_STATIC_ASSERT(VRetired > 0U, "There must be room for at least one retired node");
+
+    typedef size_t slot_type;
+
+    static ETL_CONSTANT size_t    Slots   = VSlots;
+    static ETL_CONSTANT size_t    Retired = VRetired;
+    static ETL_CONSTANT slot_type No_Slot = etl::integral_limits<slot_type>::max;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool that the nodes were allocated from.
+    //*************************************************************************
+    explicit epoch_reclaimer(etl::ipool& pool_)
+      : pool(pool_)
+      , global_epoch(0U)
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        in_use[i].store(false);
+        local_epoch[i].store(Quiescent);
+
+        for (size_t b = 0U; b < Buckets; ++b)
+        {
+          buckets[i][b].epoch = 0U;
+          buckets[i][b].count = 0U;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Reclaims all of the retired nodes.
+    /// No context may still be using the reclaimer.
+    //*************************************************************************
+    ~epoch_reclaimer()
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        for (size_t b = 0U; b < Buckets; ++b)
+        {
+          reclaim_bucket(buckets[i][b]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Acquires a slot for the calling context.
+    ///\return The slot, or No_Slot if they are all in use.
+    //*************************************************************************
+    slot_type acquire_slot()
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        bool expected = false;
+
+        if (in_use[i].compare_exchange_strong(expected, true))
+        {
+          return i;
+        }
+      }
+
+      return No_Slot;
+    }
+
+    //*************************************************************************
+    /// Releases a slot.
+    /// Any nodes that cannot yet be reclaimed stay with the slot for its next owner.
+    //*************************************************************************
+    void release_slot(slot_type slot)
+    {
+      local_epoch[slot].store(Quiescent, etl::memory_order_release);
+      reclaim(slot);
+      in_use[slot].store(false);
+    }
+
+    //*************************************************************************
+    /// Enters a critical section.
+    /// Shared nodes may be dereferenced until 'exit'.
+    //*************************************************************************
+    void enter(slot_type slot)
+    {
+      const uint32_t epoch = global_epoch.load();
+
+      local_epoch[slot].store(uint32_t(epoch << 1U) | Active);
+
+      reclaim_before(slot, epoch);
+    }
+
+    //*************************************************************************
+    /// Exits a critical section.
+    //*************************************************************************
+    void exit(slot_type slot)
+    {
+      local_epoch[slot].store(Quiescent, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Retires a node that has been unlinked from the shared structure.
+    /// It is destroyed once every context has left the epoch it was retired in.
+    ///\return false if the slot's retired list for this epoch is full and
+    /// the epoch cannot yet move on. The node has not been retired.
+    //*************************************************************************
+    template <typename T>
+    bool retire(slot_type slot, T* p_node)
+    {
+      bucket_type* p_bucket = get_bucket(slot);
+
+      if (p_bucket->count == VRetired)
+      {
+        // Try to move the epoch on and start a new bucket.
+        try_advance();
+        reclaim_before(slot, global_epoch.load());
+        p_bucket = get_bucket(slot);
+
+        if (p_bucket->count == VRetired)
+        {
+          return false;
+        }
+      }
+
+      retired_node& node = p_bucket->nodes[p_bucket->count++];
+      node.p_node    = p_node;
+      node.destroyer = &destroy_node<T>;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the global epoch on if every context inside a critical section
+    /// has seen the current one.
+    ///\return true if the epoch moved on.
+    //*************************************************************************
+    bool try_advance()
+    {
+      uint32_t epoch = global_epoch.load();
+
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        const uint32_t local = local_epoch[i].load();
+
+        if (((local & Active) != 0U) && ((local >> 1U) != (epoch & Epoch_Mask)))
+        {
+          return false;
+        }
+      }
+
+      return global_epoch.compare_exchange_strong(epoch, uint32_t(epoch + 1U));
+    }
+
+    //*************************************************************************
+    /// Tries to move the epoch on and destroys the slot's nodes that can no
+    /// longer be referenced.
+    ///\return The number of nodes destroyed.
+    //*************************************************************************
+    size_t reclaim(slot_type slot)
+    {
+      try_advance();
+
+      return reclaim_before(slot, global_epoch.load());
+    }
+
+    //*************************************************************************
+    /// The number of nodes retired by a slot and not yet destroyed.
+    //*************************************************************************
+    size_t retired_size(slot_type slot) const
+    {
+      size_t count = 0U;
+
+      for (size_t b = 0U; b < Buckets; ++b)
+      {
+        count += buckets[slot][b].count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// The current global epoch.
+    //*************************************************************************
+    uint32_t epoch() const
+    {
+      return global_epoch.load();
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t   Buckets    = 3U;
+    static ETL_CONSTANT uint32_t Quiescent  = 0U;
+    static ETL_CONSTANT uint32_t Active     = 1U;
+    static ETL_CONSTANT uint32_t Epoch_Mask = etl::integral_limits<uint32_t>::max >> 1U;
+
+    typedef void (*destroyer_type)(etl::ipool&, const void*);
+
+    //*************************************************************************
+    struct retired_node
+    {
+      const void*    p_node;
+      destroyer_type destroyer;
+    };
+
+    //*************************************************************************
+    struct bucket_type
+    {
+      uint32_t     epoch;
+      size_t       count;
+      retired_node nodes[VRetired];
+    };
+
+    //*************************************************************************
+    template <typename T>
+    static void destroy_node(etl::ipool& pool_, const void* p_node)
+    {
+      pool_.destroy(static_cast<const T*>(p_node));
+    }
+
+    //*************************************************************************
+    /// Gets the slot's bucket for the current epoch.
+    /// A bucket left over from three or more epochs ago is reclaimed first.
+    //*************************************************************************
+    bucket_type* get_bucket(slot_type slot)
+    {
+      const uint32_t epoch  = global_epoch.load();
+      bucket_type&   bucket = buckets[slot][epoch % Buckets];
+
+      if (bucket.epoch != epoch)
+      {
+        reclaim_bucket(bucket);
+        bucket.epoch = epoch;
+      }
+
+      return &bucket;
+    }
+
+    //*************************************************************************
+    /// Destroys the slot's nodes that were retired two or more epochs before 'epoch'.
+    //*************************************************************************
+    size_t reclaim_before(slot_type slot, uint32_t epoch)
+    {
+      size_t reclaimed = 0U;
+
+      for (size_t b = 0U; b < Buckets; ++b)
+      {
+        bucket_type& bucket = buckets[slot][b];
+
+        if ((bucket.count != 0U) && (uint32_t(epoch - bucket.epoch) >= 2U))
+        {
+          reclaimed += reclaim_bucket(bucket);
+        }
+      }
+
+      return reclaimed;
+    }
+
+    //*************************************************************************
+    size_t reclaim_bucket(bucket_type& bucket)
+    {
+      const size_t count = bucket.count;
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        bucket.nodes[i].destroyer(pool, bucket.nodes[i].p_node);
+      }
+
+      bucket.count = 0U;
+
+      return count;
+    }
+
+    etl::ipool& pool;
+
+    etl::atomic<uint32_t> global_epoch;
+    etl::atomic<uint32_t> local_epoch[VSlots];
+    etl::atomic<bool>     in_use[VSlots];
+
+    // Only used by the slot's owner.
+    bucket_type buckets[VSlots][Buckets];
+
+    // Disabled.
+    epoch_reclaimer(const epoch_reclaimer&) ETL_DELETE;
+    epoch_reclaimer& operator =(const epoch_reclaimer&) ETL_DELETE;
+  };
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT size_t epoch_reclaimer<VSlots, VRetired>::Slots;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT size_t epoch_reclaimer<VSlots, VRetired>::Retired;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT typename epoch_reclaimer<VSlots, VRetired>::slot_type epoch_reclaimer<VSlots, VRetired>::No_Slot;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT size_t epoch_reclaimer<VSlots, VRetired>::Buckets;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT uint32_t epoch_reclaimer<VSlots, VRetired>::Quiescent;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT uint32_t epoch_reclaimer<VSlots, VRetired>::Active;
+
+  template <size_t VSlots, size_t VRetired>
+  ETL_CONSTANT uint32_t epoch_reclaimer<VSlots, VRetired>::Epoch_Mask;
+}
+
+#endif
+#endif
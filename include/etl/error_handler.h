@@ -257,12 +257,97 @@ namespace etl
 }
 #endif
 
+namespace etl
+{
+  namespace private_error_handler
+  {
+    //*************************************************************************
+    /// The count of reported errors, per error type.
+    //*************************************************************************
+    template <typename TError>
+    struct error_count_storage
+    {
+      static size_t count;
+    };
+
+    template <typename TError>
+    size_t error_count_storage<TError>::count = 0U;
+
+    //*************************************************************************
+    /// Counts the error and, if ETL_LOG_ERRORS is defined, sends it to the
+    /// error handler.
+    //*************************************************************************
+    template <typename TError>
+    void count_and_log(const TError& e)
+    {
+      ++error_count_storage<TError>::count;
+
+#if defined(ETL_LOG_ERRORS)
+      etl::error_handler::error(e);
+#else
+      (void)e;
+#endif
+    }
+
+    //*************************************************************************
+    /// Reports the error.
+    /// Out of line and marked cold, so that the call sites in the containers
+    /// only contain the test and a call.
+    //*************************************************************************
+    template <typename TError>
+    ETL_COLD ETL_NOINLINE
+    void report(const TError& e)
+    {
+      count_and_log(e);
+    }
+
+#if ETL_USING_EXCEPTIONS
+    //*************************************************************************
+    /// Reports the error then throws it.
+    //*************************************************************************
+    template <typename TError>
+    ETL_NORETURN ETL_COLD ETL_NOINLINE
+    void report_and_throw(const TError& e)
+    {
+      count_and_log(e);
+
+      throw e;
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// Gets the number of times that an error of type TError has been reported
+  /// by ETL_ASSERT or ETL_ASSERT_FAIL.
+  /// Only counted when exceptions are enabled or ETL_LOG_ERRORS is defined.
+  /// The count is not atomic.
+  ///\ingroup error_handler
+  //***************************************************************************
+  template <typename TError>
+  size_t error_count()
+  {
+    return private_error_handler::error_count_storage<TError>::count;
+  }
+
+  //***************************************************************************
+  /// Resets the number of times that an error of type TError has been reported.
+  ///\ingroup error_handler
+  //***************************************************************************
+  template <typename TError>
+  void reset_error_count()
+  {
+    private_error_handler::error_count_storage<TError>::count = 0U;
+  }
+}
+
 //***************************************************************************
 /// Asserts a condition.
 /// Versions of the macro that return a constant value of 'true' will allow the compiler to optimise away
 /// any 'if' statements that it is contained within.
 /// If ETL_NO_CHECKS is defined then no runtime checks are executed at all.
 /// If asserts or exceptions are enabled then the error is thrown if the assert fails. The return value is always 'true'.
+/// When exceptions are enabled or ETL_LOG_ERRORS is defined, the error is reported from an out of line, cold
+/// function, so the call site contains only the test and a call. Each report increments etl::error_count<TError>().
 /// If ETL_LOG_ERRORS is defined then the error is logged if the assert fails. The return value is the value of the boolean test.
 /// Otherwise 'assert' is called. The return value is always 'true'.
 ///\ingroup error_handler
@@ -276,33 +361,22 @@ namespace etl
   #define ETL_ASSERT_FAIL_AND_RETURN(e)          ETL_DO_NOTHING // Does nothing.
   #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) ETL_DO_NOTHING // Does nothing.
 #elif ETL_USING_EXCEPTIONS
-  #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e));}}                                // If the condition fails, calls the error handler then throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) {etl::error_handler::error((e)); throw((e)); return;}}              // If the condition fails, calls the error handler then throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) {etl::error_handler::error((e)); throw((e)); return(v);}}  // If the condition fails, calls the error handler then throws an exception.
-    
-    #define ETL_ASSERT_FAIL(e) {etl::error_handler::error((e)); throw((e));}                                          // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::error_handler::error((e)); throw((e)); return;}                       // Calls the error handler then throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::error_handler::error((e)); throw((e)); return(v);}           // Calls the error handler then throws an exception.
-  #else
-    #define ETL_ASSERT(b, e) {if (!(b)) {throw((e));}}                    // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) {throw((e));}}          // If the condition fails, throws an exception.
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) {throw((e));}} // If the condition fails, throws an exception.
-    
-    #define ETL_ASSERT_FAIL(e) {throw((e));}                              // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {throw((e));}                   // Throws an exception.
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {throw((e));}          // Throws an exception.
+  #define ETL_ASSERT(b, e) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::report_and_throw((e));}}                // If the condition fails, reports the error then throws an exception.
+  #define ETL_ASSERT_OR_RETURN(b, e) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::report_and_throw((e));}}      // If the condition fails, reports the error then throws an exception.
+  #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if (!(b)) ETL_UNLIKELY {etl::private_error_handler::report_and_throw((e));}} // If the condition fails, reports the error then throws an exception.
 
-  #endif
+  #define ETL_ASSERT_FAIL(e) {etl::private_error_handler::report_and_throw((e));}                                  // Reports the error then throws an exception.
+  #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::private_error_handler::report_and_throw((e));}                       // Reports the error then throws an exception.
+  #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::private_error_handler::report_and_throw((e));}              // Reports the error then throws an exception.
 #else
   #if defined(ETL_LOG_ERRORS)
-    #define ETL_ASSERT(b, e) {if(!(b)) {etl::error_handler::error((e));}}                                 // If the condition fails, calls the error handler
-    #define ETL_ASSERT_OR_RETURN(b, e) {if(!(b)) {etl::error_handler::error((e)); return;}}               // If the condition fails, calls the error handler and return
-    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if(!(b)) {etl::error_handler::error((e)); return (v);}}  // If the condition fails, calls the error handler and return a value
+    #define ETL_ASSERT(b, e) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::report((e));}}                                // If the condition fails, calls the error handler
+    #define ETL_ASSERT_OR_RETURN(b, e) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::report((e)); return;}}              // If the condition fails, calls the error handler and return
+    #define ETL_ASSERT_OR_RETURN_VALUE(b, e, v) {if(!(b)) ETL_UNLIKELY {etl::private_error_handler::report((e)); return (v);}} // If the condition fails, calls the error handler and return a value
     
-    #define ETL_ASSERT_FAIL(e) {etl::error_handler::error((e));}                                          // Calls the error handler
-    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::error_handler::error((e)); return;}                       // Calls the error handler and return
-    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::error_handler::error((e)); return (v);}          // Calls the error handler and return a value
+    #define ETL_ASSERT_FAIL(e) {etl::private_error_handler::report((e));}                                          // Calls the error handler
+    #define ETL_ASSERT_FAIL_AND_RETURN(e) {etl::private_error_handler::report((e)); return;}                       // Calls the error handler and return
+    #define ETL_ASSERT_FAIL_AND_RETURN_VALUE(e, v) {etl::private_error_handler::report((e)); return (v);}          // Calls the error handler and return a value
   #else
     #if ETL_IS_DEBUG_BUILD
       #define ETL_ASSERT(b, e) assert((b))                                                                // If the condition fails, asserts.
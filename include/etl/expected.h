@@ -277,20 +277,24 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_CPP11
     //*******************************************
     /// Copy constructor
+    /// Defaulted, so that the expected is trivially copyable if the
+    /// value and error types are.
     //*******************************************
-    ETL_CONSTEXPR14 expected(const expected& other) ETL_NOEXCEPT
-      : storage(other.storage)
-    {
-    }
+    ETL_CONSTEXPR14 expected(const expected& other) = default;
 
-#if ETL_USING_CPP11
     //*******************************************
     /// Move constructor
     //*******************************************
-    ETL_CONSTEXPR14 expected(expected&& other) ETL_NOEXCEPT
-      : storage(etl::move(other.storage))
+    ETL_CONSTEXPR14 expected(expected&& other) = default;
+#else
+    //*******************************************
+    /// Copy constructor
+    //*******************************************
+    expected(const expected& other) ETL_NOEXCEPT
+      : storage(other.storage)
     {
     }
 #endif
@@ -383,27 +387,27 @@ namespace etl
 #endif
 #endif
 
+#if ETL_USING_CPP11
     //*******************************************
-    ///
+    /// Copy assign
+    /// Defaulted, so that the expected is trivially copyable if the
+    /// value and error types are.
     //*******************************************
-    this_type& operator =(const this_type& other)
-    {
-      ETL_STATIC_ASSERT(etl::is_copy_constructible<TValue>::value && etl::is_copy_constructible<TError>::value, "Not copy assignable");
-
-      storage = other.storage;
-
-      return *this;
-    }
+    this_type& operator =(const this_type& other) = default;
 
-#if ETL_USING_CPP11
+    //*******************************************
+    /// Move assign
+    //*******************************************
+    this_type& operator =(this_type&& other) = default;
+#else
     //*******************************************
     ///
     //*******************************************
-    this_type& operator =(this_type&& other)
+    this_type& operator =(const this_type& other)
     {
-      ETL_STATIC_ASSERT(etl::is_move_constructible<TValue>::value && etl::is_move_constructible<TError>::value, "Not move assignable");
+      ETL_STATIC_ASSERT(etl::is_copy_constructible<TValue>::value && etl::is_copy_constructible<TError>::value, "Not copy assignable");
 
-      storage = etl::move(other.storage);
+      storage = other.storage;
 
       return *this;
     }
@@ -773,46 +777,45 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_CPP11
     //*******************************************
     /// Copy construct
+    /// Defaulted, so that the expected is trivially copyable if the
+    /// error type is.
     //*******************************************
-    ETL_CONSTEXPR14
-      expected(const this_type& other)
-      : storage(other.storage)
-    {
-    }
+    ETL_CONSTEXPR14 expected(const this_type& other) = default;
 
-#if ETL_USING_CPP11
     //*******************************************
     /// Move construct
     //*******************************************
-    ETL_CONSTEXPR14
-      expected(this_type&& other)
-      : storage(etl::move(other.storage))
-    {
-    }
-#endif
+    ETL_CONSTEXPR14 expected(this_type&& other) = default;
 
     //*******************************************
     /// Copy assign
     //*******************************************
-    this_type& operator =(const this_type& other)
-    {
-      ETL_STATIC_ASSERT(etl::is_copy_constructible<TError>::value, "Not copy assignable");
+    this_type& operator =(const this_type& other) = default;
 
-      storage = other.storage;
-      return *this;
+    //*******************************************
+    /// Move assign
+    //*******************************************
+    this_type& operator =(this_type&& other) = default;
+#else
+    //*******************************************
+    /// Copy construct
+    //*******************************************
+    expected(const this_type& other)
+      : storage(other.storage)
+    {
     }
 
-#if ETL_USING_CPP11
     //*******************************************
-    /// Move assign
+    /// Copy assign
     //*******************************************
-    this_type& operator =(this_type&& other)
+    this_type& operator =(const this_type& other)
     {
-      ETL_STATIC_ASSERT(etl::is_move_constructible<TError>::value, "Not move assignable");
+      ETL_STATIC_ASSERT(etl::is_copy_constructible<TError>::value, "Not copy assignable");
 
-      storage = etl::move(other.storage);
+      storage = other.storage;
       return *this;
     }
 #endif
@@ -0,0 +1,79 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EXTERN_TEMPLATES_INCLUDED
+#define ETL_EXTERN_TEMPLATES_INCLUDED
+
+#include "platform.h"
+#include "basic_string.h"
+#include "vector.h"
+
+#include <stdint.h>
+
+///\defgroup extern_templates extern_templates
+/// Explicit instantiations of the fixed capacity container bases.
+/// etl::string<N>, etl::vector<T, N> etc. are thin wrappers over a base class
+/// that holds all of the code. The bases are instantiated once, in the
+/// etl_instantiations library, and declared 'extern' here so that including
+/// translation units do not instantiate them again.
+/// Every translation unit must see the same ETL configuration as the library.
+/// Define ETL_EXTERN_TEMPLATES_INSTANTIATE before including this header,
+/// in one translation unit only, to provide the definitions.
+///\ingroup utilities
+
+#if ETL_USING_CPP11
+  #if defined(ETL_EXTERN_TEMPLATES_INSTANTIATE)
+    #define ETL_EXTERN_TEMPLATE template
+  #else
+    #define ETL_EXTERN_TEMPLATE extern template
+  #endif
+
+namespace etl
+{
+  ETL_EXTERN_TEMPLATE class ibasic_string<char>;
+  ETL_EXTERN_TEMPLATE class ibasic_string<wchar_t>;
+  ETL_EXTERN_TEMPLATE class ibasic_string<char16_t>;
+  ETL_EXTERN_TEMPLATE class ibasic_string<char32_t>;
+  #if ETL_HAS_CHAR8_T
+  ETL_EXTERN_TEMPLATE class ibasic_string<char8_t>;
+  #endif
+
+  ETL_EXTERN_TEMPLATE class ivector<char>;
+  ETL_EXTERN_TEMPLATE class ivector<uint8_t>;
+  ETL_EXTERN_TEMPLATE class ivector<int8_t>;
+  ETL_EXTERN_TEMPLATE class ivector<uint16_t>;
+  ETL_EXTERN_TEMPLATE class ivector<uint32_t>;
+  ETL_EXTERN_TEMPLATE class ivector<int>;
+}
+
+  #undef ETL_EXTERN_TEMPLATE
+#endif
+
+#endif
@@ -0,0 +1,1146 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FAST_MATH_INCLUDED
+#define ETL_FAST_MATH_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "limits.h"
+#include "bit.h"
+#include "log.h"
+#include "span.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+///\defgroup fast_math fast_math
+/// Run time approximations of the elementary functions that do not call the
+/// standard maths library.
+/// etl::fast_math  Minimax polynomials for float and double.
+/// etl::cordic     Shift and add CORDIC for Q15 and Q31 fixed point.
+/// etl::sin_table  An interpolated sine table, generated at compile time for C++14 and above.
+/// Angles for the fixed point classes are binary angles, where the full range
+/// of the unsigned angle type is one turn.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// The precision of the etl::fast_math approximations.
+  /// The maximum errors, in the absence of floating point rounding, are:
+  ///           sin, cos   atan, atan2   exp (relative)   log
+  /// Low       6.8e-5     8.2e-5        7.5e-5           7.7e-6
+  /// Medium    5.9e-7     1.7e-6        2.6e-6           4.1e-8
+  /// High      3.4e-9     3.8e-8        1.9e-9           2.4e-10
+  ///\ingroup fast_math
+  //***************************************************************************
+  struct fast_math_precision
+  {
+    enum enum_type
+    {
+      Low,
+      Medium,
+      High
+    };
+  };
+
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// Minimax polynomials, evaluated by Horner's method.
+    /// sin(x)   = x * sin(x^2)          for |x| <= pi / 2
+    /// atan(x)  = x * atan(x^2)         for |x| <= 1
+    /// exp(x)   = exp(x)                for |x| <= ln(2) / 2
+    /// log(x)   = 2 * s * log(s^2)      for s = (x - 1) / (x + 1), 1 / sqrt(2) <= x <= sqrt(2)
+    //*************************************************************************
+    template <int Precision>
+    struct polynomials;
+
+    template <>
+    struct polynomials<etl::fast_math_precision::Low>
+    {
+      template <typename T>
+      static ETL_CONSTEXPR T sin(T x2)
+      {
+        return T(0.999696773140858) + (x2 * (T(-0.16567307932269593) + (x2 * T(0.007514377178816304))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T atan(T x2)
+      {
+        return T(0.9992138125801967) + (x2 * (T(-0.3211749693604124) + (x2 * (T(0.1462644636746126) + (x2 * T(-0.03898651420226439))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T exp(T x)
+      {
+        return T(0.9999280735404956) + (x * (T(1.0001641857610948) + (x * (T(0.5049632641822398) + (x * T(0.16566842347964333))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T log(T s2)
+      {
+        return T(0.9999776335605652) + (s2 * T(0.33934748108107865));
+      }
+    };
+
+    template <>
+    struct polynomials<etl::fast_math_precision::Medium>
+    {
+      template <typename T>
+      static ETL_CONSTEXPR T sin(T x2)
+      {
+        return T(0.9999966159079733) + (x2 * (T(-0.16664828381887745) + (x2 * (T(0.00830632522710874) + (x2 * T(-0.00018363653975867785))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T atan(T x2)
+      {
+        return T(0.9999772190802949) + (x2 * (T(-0.33262282784855113) + (x2 * (T(0.19354037581947703) + (x2 * (T(-0.11642648129776692) + (x2 * (T(0.05264735073436753) + (x2 * T(-0.011719135450403016))))))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T exp(T x)
+      {
+        return T(0.9999992614457144) + (x * (T(0.9999634048526979) + (x * (T(0.5000435866145754) + (x * (T(0.16790907215230025) + (x * T(0.04145860818751203))))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T log(T s2)
+      {
+        return T(1.0000001192798758) + (s2 * (T(0.33326095739245876) + (s2 * T(0.20648733713779777))));
+      }
+    };
+
+    template <>
+    struct polynomials<etl::fast_math_precision::High>
+    {
+      template <typename T>
+      static ETL_CONSTEXPR T sin(T x2)
+      {
+        return T(0.9999999765898822) + (x2 * (T(-0.16666647634639836) + (x2 * (T(0.008332899823353973) + (x2 * (T(-0.0001980089776293002) + (x2 * T(2.5904885007931373e-06))))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T atan(T x2)
+      {
+        return T(0.9999993355778618) + (x2 * (T(-0.33329860783131166) + (x2 * (T(0.19946565641054864) + (x2 * (T(-0.13908629508407194) + (x2 * (T(0.0964219723775721) + (x2 * (T(-0.055912325691700314) + (x2 * (T(0.021862957208379514) + (x2 * T(-0.004054567046412804))))))))))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T exp(T x)
+      {
+        return T(1.0000000005541665) + (x * (T(1.0000000363231976) + (x * (T(0.49999992079816696) + (x * (T(0.16666420169849686) + (x * (T(0.04166822556952568) + (x * (T(0.008374815804362865) + (x * T(0.0013836845990719037))))))))))));
+      }
+
+      template <typename T>
+      static ETL_CONSTEXPR T log(T s2)
+      {
+        return T(0.9999999993072206) + (s2 * (T(0.33333408185996644) + (s2 * (T(0.19987378389391164) + (s2 * T(0.14963257269794455))))));
+      }
+    };
+
+    //*************************************************************************
+    /// The floating point representation, for exp and log.
+    //*************************************************************************
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<float>
+    {
+      typedef uint32_t bits_type;
+
+      enum
+      {
+        Mantissa_Bits = 23,
+        Exponent_Bits = 8,
+        Exponent_Bias = 127
+      };
+
+      // ln(FLT_MAX)
+      static float max_log()
+      {
+        return 88.72283f;
+      }
+
+      // ln(FLT_MIN)
+      static float min_log()
+      {
+        return -87.33654f;
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct float_traits<double>
+    {
+      typedef uint64_t bits_type;
+
+      enum
+      {
+        Mantissa_Bits = 52,
+        Exponent_Bits = 11,
+        Exponent_Bias = 1023
+      };
+
+      // ln(DBL_MAX)
+      static double max_log()
+      {
+        return 709.782712893384;
+      }
+
+      // ln(DBL_MIN)
+      static double min_log()
+      {
+        return -708.3964185322641;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Constants, to more digits than etl::math.
+    //*************************************************************************
+    struct constants
+    {
+      static ETL_CONSTEXPR double pi()         { return 3.14159265358979323846; }
+      static ETL_CONSTEXPR double half_pi()    { return 1.57079632679489661923; }
+      static ETL_CONSTEXPR double inv_two_pi() { return 0.15915494309189533577; }
+      static ETL_CONSTEXPR double sqrt2()      { return 1.41421356237309504880; }
+      static ETL_CONSTEXPR double log2e()      { return 1.44269504088896340736; }
+
+      // 2 * pi and ln(2) split so that n * hi is exact for moderate n.
+      static ETL_CONSTEXPR double two_pi_hi()  { return 6.28125; }
+      static ETL_CONSTEXPR double two_pi_lo()  { return 1.93530717958647692528e-3; }
+      static ETL_CONSTEXPR double ln2_hi()     { return 0.693145751953125; }
+      static ETL_CONSTEXPR double ln2_lo()     { return 1.42860682030941723212e-6; }
+    };
+  }
+
+  //***************************************************************************
+  /// Fast floating point approximations of sin, cos, atan, atan2, exp, and log.
+  /// No function calls the standard maths library, and none use tables.
+  /// The trigonometric functions reduce the argument by whole turns, so accuracy
+  /// falls slowly as |x| grows; the argument must be less than 1e9 in magnitude.
+  ///\tparam T         float or double.
+  ///\tparam Precision One of etl::fast_math_precision. Default Medium.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T, etl::fast_math_precision::enum_type Precision = etl::fast_math_precision::Medium>
+  class fast_math
+  {
+  private:
+
+    typedef private_fast_math::polynomials<Precision> polynomial;
+    typedef private_fast_math::float_traits<T>        traits;
+    typedef private_fast_math::constants              constants;
+    typedef typename traits::bits_type                bits_type;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "fast_math requires float or double");
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// sin(x)
+    //*************************************************************************
+    static T sin(T x)
+    {
+      T r = reduce(x);
+
+      // Reflect into [-pi / 2, pi / 2].
+      if (r > T(constants::half_pi()))
+      {
+        r = T(constants::pi()) - r;
+      }
+      else if (r < T(-constants::half_pi()))
+      {
+        r = T(-constants::pi()) - r;
+      }
+
+      return r * polynomial::sin(r * r);
+    }
+
+    //*************************************************************************
+    /// cos(x)
+    //*************************************************************************
+    static T cos(T x)
+    {
+      // cos(x) = sin(pi / 2 - |x|)
+      const T r = T(constants::half_pi()) - absolute(reduce(x));
+
+      return r * polynomial::sin(r * r);
+    }
+
+    //*************************************************************************
+    /// sin(x) and cos(x), sharing the argument reduction.
+    //*************************************************************************
+    static void sin_cos(T x, T& sin_value, T& cos_value)
+    {
+      const T r = reduce(x);
+      const T c = T(constants::half_pi()) - absolute(r);
+
+      T s = r;
+
+      if (r > T(constants::half_pi()))
+      {
+        s = T(constants::pi()) - r;
+      }
+      else if (r < T(-constants::half_pi()))
+      {
+        s = T(-constants::pi()) - r;
+      }
+
+      sin_value = s * polynomial::sin(s * s);
+      cos_value = c * polynomial::sin(c * c);
+    }
+
+    //*************************************************************************
+    /// atan(x)
+    //*************************************************************************
+    static T atan(T x)
+    {
+      const T a = absolute(x);
+      T       result;
+
+      if (a > T(1))
+      {
+        // atan(x) = pi / 2 - atan(1 / x)
+        const T r = T(1) / a;
+        result = T(constants::half_pi()) - (r * polynomial::atan(r * r));
+      }
+      else
+      {
+        result = a * polynomial::atan(a * a);
+      }
+
+      return (x < T(0)) ? -result : result;
+    }
+
+    //*************************************************************************
+    /// atan2(y, x), in the range [-pi, pi].
+    /// Returns 0 for atan2(0, 0).
+    //*************************************************************************
+    static T atan2(T y, T x)
+    {
+      const T ax = absolute(x);
+      const T ay = absolute(y);
+
+      const T numerator   = etl::min(ax, ay);
+      const T denominator = etl::max(ax, ay);
+
+      if (!(denominator > T(0)))
+      {
+        return T(0);
+      }
+
+      const T a = numerator / denominator;
+      T result  = a * polynomial::atan(a * a);
+
+      if (ay > ax)
+      {
+        result = T(constants::half_pi()) - result;
+      }
+
+      if (x < T(0))
+      {
+        result = T(constants::pi()) - result;
+      }
+
+      return (y < T(0)) ? -result : result;
+    }
+
+    //*************************************************************************
+    /// exp(x)
+    /// Returns infinity above ln(max) and 0 below ln(min).
+    //*************************************************************************
+    static T exp(T x)
+    {
+      if (!(x <= traits::max_log()))
+      {
+        // Too large, or NaN.
+        return (x > traits::max_log()) ? etl::numeric_limits<T>::infinity() : x;
+      }
+
+      if (x < traits::min_log())
+      {
+        return T(0);
+      }
+
+      // x = n * ln(2) + r, |r| <= ln(2) / 2
+      const int32_t n = round_to_int(x * T(constants::log2e()));
+      const T r = (x - (T(n) * T(constants::ln2_hi()))) - (T(n) * T(constants::ln2_lo()));
+
+      // 2^n in two halves, so that neither leaves the normal range.
+      const int32_t n1 = n / 2;
+      const int32_t n2 = n - n1;
+
+      return (polynomial::exp(r) * power_of_2(n1)) * power_of_2(n2);
+    }
+
+    //*************************************************************************
+    /// log(x)
+    /// Returns -infinity for 0 and NaN for negative values.
+    //*************************************************************************
+    static T log(T x)
+    {
+      if (x < T(0))
+      {
+        return etl::numeric_limits<T>::quiet_NaN();
+      }
+
+      if (!(x > T(0)))
+      {
+        // Zero, or NaN.
+        return (x <= T(0)) ? -etl::numeric_limits<T>::infinity() : x;
+      }
+
+      if (!(x <= etl::numeric_limits<T>::max()))
+      {
+        // Infinity.
+        return x;
+      }
+
+      const bits_type Mantissa_Mask = (bits_type(1U) << traits::Mantissa_Bits) - 1U;
+      const bits_type Exponent_Mask = (bits_type(1U) << traits::Exponent_Bits) - 1U;
+
+      bits_type bits     = etl::bit_cast<bits_type>(x);
+      int32_t  exponent = int32_t((bits >> traits::Mantissa_Bits) & Exponent_Mask) - int32_t(traits::Exponent_Bias);
+
+      // Normalise subnormals.
+      if (((bits >> traits::Mantissa_Bits) & Exponent_Mask) == 0U)
+      {
+        bits     = etl::bit_cast<bits_type>(x * power_of_2(traits::Mantissa_Bits));
+        exponent = int32_t((bits >> traits::Mantissa_Bits) & Exponent_Mask) - int32_t(traits::Exponent_Bias) - int32_t(traits::Mantissa_Bits);
+      }
+
+      // x = m * 2^exponent, 1 / sqrt(2) <= m <= sqrt(2)
+      T m = etl::bit_cast<T>((bits & Mantissa_Mask) | (bits_type(traits::Exponent_Bias) << traits::Mantissa_Bits));
+
+      if (m > T(constants::sqrt2()))
+      {
+        m *= T(0.5);
+        ++exponent;
+      }
+
+      const T s = (m - T(1)) / (m + T(1));
+      const T e = T(exponent);
+
+      return (e * T(constants::ln2_hi())) + ((e * T(constants::ln2_lo())) + (T(2) * s * polynomial::log(s * s)));
+    }
+
+    //*************************************************************************
+    /// Block versions.
+    /// Each processes as many values as the shortest span and returns the count.
+    //*************************************************************************
+    static size_t sin(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = sin(input[i]);
+      }
+
+      return n;
+    }
+
+    static size_t cos(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = cos(input[i]);
+      }
+
+      return n;
+    }
+
+    static size_t sin_cos(etl::span<const T> input, etl::span<T> sin_values, etl::span<T> cos_values)
+    {
+      const size_t n = etl::min(input.size(), etl::min(sin_values.size(), cos_values.size()));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        sin_cos(input[i], sin_values[i], cos_values[i]);
+      }
+
+      return n;
+    }
+
+    static size_t atan(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = atan(input[i]);
+      }
+
+      return n;
+    }
+
+    static size_t atan2(etl::span<const T> y, etl::span<const T> x, etl::span<T> output)
+    {
+      const size_t n = etl::min(output.size(), etl::min(y.size(), x.size()));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = atan2(y[i], x[i]);
+      }
+
+      return n;
+    }
+
+    static size_t exp(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = exp(input[i]);
+      }
+
+      return n;
+    }
+
+    static size_t log(etl::span<const T> input, etl::span<T> output)
+    {
+      const size_t n = etl::min(input.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = log(input[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    //*************************************************************************
+    static T absolute(T x)
+    {
+      return (x < T(0)) ? -x : x;
+    }
+
+    //*************************************************************************
+    static int32_t round_to_int(T x)
+    {
+      return int32_t(x + ((x < T(0)) ? T(-0.5) : T(0.5)));
+    }
+
+    //*************************************************************************
+    /// Reduces x to [-pi, pi] by whole turns.
+    //*************************************************************************
+    static T reduce(T x)
+    {
+      const T n = T(round_to_int(x * T(constants::inv_two_pi())));
+
+      return (x - (n * T(constants::two_pi_hi()))) - (n * T(constants::two_pi_lo()));
+    }
+
+    //*************************************************************************
+    /// 2^n, for n in the normal exponent range.
+    //*************************************************************************
+    static T power_of_2(int32_t n)
+    {
+      return etl::bit_cast<T>(bits_type(n + int32_t(traits::Exponent_Bias)) << traits::Mantissa_Bits);
+    }
+  };
+
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// atan(2^-i) as 32 bit binary angles.
+    //*************************************************************************
+    inline int32_t cordic_arctangent(size_t i)
+    {
+      static ETL_CONSTANT int32_t table[32] =
+      {
+        536870912L, 316933406L, 167458907L, 85004756L, 42667331L, 21354465L, 10679838L, 5340245L,
+        2670163L, 1335087L, 667544L, 333772L, 166886L, 83443L, 41722L, 20861L,
+        10430L, 5215L, 2608L, 1304L, 652L, 326L, 163L, 81L,
+        41L, 20L, 10L, 5L, 3L, 1L, 1L, 0L
+      };
+
+      return table[i];
+    }
+
+    //*************************************************************************
+    /// CORDIC arithmetic.
+    /// The internal values carry Guard_Bits extra bits, to limit the rounding
+    /// error of the shifts, and the internal angles are 32 bit binary angles.
+    /// The gain table holds the inverse CORDIC gain after n iterations, in the
+    /// format of T.
+    //*************************************************************************
+    template <typename T>
+    struct cordic_traits;
+
+    template <>
+    struct cordic_traits<int16_t>
+    {
+      typedef uint16_t angle_type;
+      typedef uint16_t magnitude_type;
+      typedef int32_t  internal_type;
+
+      enum
+      {
+        Bits           = 16,
+        Guard_Bits     = 8,
+        Angle_Shift    = 16,
+        Max_Iterations = 24
+      };
+
+      static internal_type inverse_gain(size_t iterations)
+      {
+        static ETL_CONSTANT uint16_t table[16] =
+        {
+          23170U, 20724U, 20106U, 19950U, 19911U, 19902U, 19899U, 19899U,
+          19899U, 19898U, 19898U, 19898U, 19898U, 19898U, 19898U, 19898U
+        };
+
+        return internal_type(table[etl::min(iterations, size_t(16U)) - 1U]);
+      }
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct cordic_traits<int32_t>
+    {
+      typedef uint32_t angle_type;
+      typedef uint32_t magnitude_type;
+      typedef int64_t  internal_type;
+
+      enum
+      {
+        Bits           = 32,
+        Guard_Bits     = 8,
+        Angle_Shift    = 0,
+        Max_Iterations = 32
+      };
+
+      static internal_type inverse_gain(size_t iterations)
+      {
+        static ETL_CONSTANT uint32_t table[16] =
+        {
+          1518500250UL, 1358187913UL, 1317635818UL, 1307460871UL, 1304914694UL, 1304277995UL, 1304118810UL, 1304079014UL,
+          1304069065UL, 1304066577UL, 1304065955UL, 1304065800UL, 1304065761UL, 1304065751UL, 1304065749UL, 1304065748UL
+        };
+
+        return internal_type(table[etl::min(iterations, size_t(16U)) - 1U]);
+      }
+    };
+#endif
+  }
+
+  //***************************************************************************
+  /// Fixed point sin, cos, atan2 and magnitude by CORDIC.
+  /// The iterations use only shifts and adds; the one multiply removes the
+  /// CORDIC gain from the magnitude.
+  /// Angles are binary angles; 0x4000 is pi / 2 for int16_t, 0x40000000 for int32_t.
+  /// Each iteration adds about one bit of precision.
+  ///\tparam T          int16_t (Q15) or int32_t (Q31).
+  ///\tparam Iterations The number of iterations. Default 16 for int16_t, 30 for int32_t.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T, size_t Iterations = ((private_fast_math::cordic_traits<T>::Bits == 16) ? 16U : 30U)>
+  class cordic
+  {
+  private:
+
+    typedef private_fast_math::cordic_traits<T> traits;
+    typedef typename traits::internal_type      internal_type;
+
+  public:
+
+    ETL_STATIC_ASSERT((Iterations >= 1U) && (Iterations <= size_t(traits::Max_Iterations)), "Iterations out of range");
+
+    typedef T                                value_type;
+    typedef typename traits::angle_type      angle_type;
+    typedef typename traits::magnitude_type  magnitude_type;
+
+    //*************************************************************************
+    /// sin(angle) and cos(angle).
+    //*************************************************************************
+    static void sin_cos(angle_type angle, T& sin_value, T& cos_value)
+    {
+      // The iterations converge for |angle| <= pi / 2, so rotate the rest by pi.
+      const size_t quadrant = size_t(angle >> (traits::Bits - 2));
+      const bool   negate   = (quadrant == 1U) || (quadrant == 2U);
+
+      if (negate)
+      {
+        angle = angle_type(angle + Half_Turn);
+      }
+
+      // Signed 32 bit angle.
+      internal_type z = internal_type(angle);
+
+      if (angle >= Half_Turn)
+      {
+        z -= internal_type(Half_Turn);
+        z -= internal_type(Half_Turn);
+      }
+
+      z *= internal_type(1) << traits::Angle_Shift;
+
+      // Start from the inverse gain, to avoid a multiply at the end.
+      internal_type x = (traits::inverse_gain(Iterations) * internal_type(etl::integral_limits<T>::max)) >> (traits::Bits - 1 - traits::Guard_Bits);
+      internal_type y = 0;
+
+      for (size_t i = 0U; i < Iterations; ++i)
+      {
+        const internal_type dx = x >> i;
+        const internal_type dy = y >> i;
+
+        if (z >= 0)
+        {
+          x -= dy;
+          y += dx;
+          z -= private_fast_math::cordic_arctangent(i);
+        }
+        else
+        {
+          x += dy;
+          y -= dx;
+          z += private_fast_math::cordic_arctangent(i);
+        }
+      }
+
+      if (negate)
+      {
+        x = -x;
+        y = -y;
+      }
+
+      sin_value = saturate(y);
+      cos_value = saturate(x);
+    }
+
+    //*************************************************************************
+    /// sin(angle)
+    //*************************************************************************
+    static T sin(angle_type angle)
+    {
+      T s;
+      T c;
+
+      sin_cos(angle, s, c);
+
+      return s;
+    }
+
+    //*************************************************************************
+    /// cos(angle)
+    //*************************************************************************
+    static T cos(angle_type angle)
+    {
+      T s;
+      T c;
+
+      sin_cos(angle, s, c);
+
+      return c;
+    }
+
+    //*************************************************************************
+    /// The angle and magnitude of the vector (x, y).
+    /// The magnitude is unsigned, as it may exceed the maximum of T by sqrt(2).
+    /// The angle of (0, 0) is 0.
+    //*************************************************************************
+    static void polar(T y, T x, magnitude_type& magnitude, angle_type& angle)
+    {
+      if ((x == 0) && (y == 0))
+      {
+        magnitude = 0U;
+        angle     = 0U;
+        return;
+      }
+
+      internal_type xi = internal_type(x) * (internal_type(1) << traits::Guard_Bits);
+      internal_type yi = internal_type(y) * (internal_type(1) << traits::Guard_Bits);
+      internal_type z  = 0;
+
+      // The iterations converge for x >= 0, so rotate the rest by pi.
+      uint32_t offset = 0U;
+
+      if (xi < 0)
+      {
+        xi = -xi;
+        yi = -yi;
+        offset = 0x80000000UL;
+      }
+
+      for (size_t i = 0U; i < Iterations; ++i)
+      {
+        const internal_type dx = xi >> i;
+        const internal_type dy = yi >> i;
+
+        if (yi >= 0)
+        {
+          xi += dy;
+          yi -= dx;
+          z  += private_fast_math::cordic_arctangent(i);
+        }
+        else
+        {
+          xi -= dy;
+          yi += dx;
+          z  -= private_fast_math::cordic_arctangent(i);
+        }
+      }
+
+      const internal_type gain = traits::inverse_gain(Iterations);
+      const uint32_t      bam  = uint32_t(z) + offset;
+
+      magnitude = magnitude_type((((xi >> traits::Guard_Bits) * gain) + (internal_type(1) << (traits::Bits - 2))) >> (traits::Bits - 1));
+      angle     = angle_type((bam + ((uint32_t(1U) << traits::Angle_Shift) >> 1)) >> traits::Angle_Shift);
+    }
+
+    //*************************************************************************
+    /// atan2(y, x), as a binary angle.
+    //*************************************************************************
+    static angle_type atan2(T y, T x)
+    {
+      magnitude_type m;
+      angle_type     a;
+
+      polar(y, x, m, a);
+
+      return a;
+    }
+
+    //*************************************************************************
+    /// sqrt(x^2 + y^2)
+    //*************************************************************************
+    static magnitude_type magnitude(T y, T x)
+    {
+      magnitude_type m;
+      angle_type     a;
+
+      polar(y, x, m, a);
+
+      return m;
+    }
+
+    //*************************************************************************
+    /// Block versions.
+    /// Each processes as many values as the shortest span and returns the count.
+    //*************************************************************************
+    static size_t sin_cos(etl::span<const angle_type> angles, etl::span<T> sin_values, etl::span<T> cos_values)
+    {
+      const size_t n = etl::min(angles.size(), etl::min(sin_values.size(), cos_values.size()));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        sin_cos(angles[i], sin_values[i], cos_values[i]);
+      }
+
+      return n;
+    }
+
+    static size_t atan2(etl::span<const T> y, etl::span<const T> x, etl::span<angle_type> angles)
+    {
+      const size_t n = etl::min(angles.size(), etl::min(y.size(), x.size()));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        angles[i] = atan2(y[i], x[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    static ETL_CONSTANT angle_type Half_Turn = angle_type(angle_type(1U) << (traits::Bits - 1));
+
+    //*************************************************************************
+    /// Removes the guard bits, rounds and saturates.
+    //*************************************************************************
+    static T saturate(internal_type value)
+    {
+      value = (value + (internal_type(1) << (traits::Guard_Bits - 1))) >> traits::Guard_Bits;
+
+      return (value > internal_type(etl::integral_limits<T>::max)) ? etl::integral_limits<T>::max
+                                                                   : ((value < -internal_type(etl::integral_limits<T>::max)) ? T(-etl::integral_limits<T>::max)
+                                                                                                                              : T(value));
+    }
+  };
+
+  template <typename T, size_t Iterations>
+  ETL_CONSTANT typename cordic<T, Iterations>::angle_type cordic<T, Iterations>::Half_Turn;
+
+  namespace private_fast_math
+  {
+    //*************************************************************************
+    /// Sample and interpolation types for etl::sin_table.
+    //*************************************************************************
+    template <typename T>
+    struct sin_table_traits
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "sin_table values must be floating point, int16_t or int32_t");
+
+      typedef uint32_t angle_type;
+      typedef T        difference_type;
+
+      static ETL_CONSTANT bool Is_Fixed_Point = false;
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        return T(value);
+      }
+
+      // a + ((b - a) * fraction / 2^Fraction_Bits)
+      template <size_t Fraction_Bits>
+      static T interpolate(T a, T b, angle_type fraction)
+      {
+        return a + ((b - a) * (T(fraction) * (T(1) / T(angle_type(1U) << Fraction_Bits))));
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT bool sin_table_traits<T>::Is_Fixed_Point;
+
+    template <typename T, typename TAngle, typename TDifference>
+    struct fixed_point_sin_table_traits
+    {
+      typedef TAngle      angle_type;
+      typedef TDifference difference_type;
+
+      static ETL_CONSTANT bool Is_Fixed_Point = true;
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        const double scaled = value * double(etl::integral_limits<T>::max);
+
+        return (scaled >= double(etl::integral_limits<T>::max)) ? etl::integral_limits<T>::max
+                                                                 : ((scaled <= -double(etl::integral_limits<T>::max)) ? T(-etl::integral_limits<T>::max)
+                                                                                                                       : T(scaled + ((scaled >= 0.0) ? 0.5 : -0.5)));
+      }
+
+      // a + ((b - a) * fraction / 2^Fraction_Bits), rounded.
+      template <size_t Fraction_Bits>
+      static T interpolate(T a, T b, angle_type fraction)
+      {
+        const difference_type delta = (difference_type(b) - difference_type(a)) * difference_type(fraction);
+
+        return T(difference_type(a) + ((delta + (difference_type(1) << (Fraction_Bits - 1U))) >> Fraction_Bits));
+      }
+    };
+
+    template <typename T, typename TAngle, typename TDifference>
+    ETL_CONSTANT bool fixed_point_sin_table_traits<T, TAngle, TDifference>::Is_Fixed_Point;
+
+    template <>
+    struct sin_table_traits<int16_t> : public fixed_point_sin_table_traits<int16_t, uint16_t, int32_t>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    template <>
+    struct sin_table_traits<int32_t> : public fixed_point_sin_table_traits<int32_t, uint32_t, int64_t>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// A quarter wave of sin(x), with one extra entry for interpolation.
+    //*************************************************************************
+    template <typename T, size_t Quarter>
+    struct sin_table_values
+    {
+      ETL_CONSTEXPR14 sin_table_values()
+        : value()
+      {
+        for (size_t i = 0U; i <= Quarter; ++i)
+        {
+          const double x = (constants::half_pi() * double(i)) / double(Quarter);
+
+          value[i] = sin_table_traits<T>::from_double(x * polynomials<etl::fast_math_precision::High>::sin(x * x));
+        }
+      }
+
+      T value[Quarter + 1U];
+    };
+  }
+
+  //***************************************************************************
+  /// Linearly interpolated sine table.
+  /// Stores a quarter wave; sin and cos are found by symmetry.
+  /// The table is generated at compile time for C++14 and above.
+  /// Angles are binary angles; uint16_t for int16_t, otherwise uint32_t.
+  ///\tparam T    float, double, int16_t (Q15) or int32_t (Q31).
+  ///\tparam Size The number of table steps in a full turn. A power of 2, at least 4.
+  ///             The maximum interpolation error is about 4.9 / Size^2.
+  ///\ingroup fast_math
+  //***************************************************************************
+  template <typename T, size_t Size = 1024U>
+  class sin_table
+  {
+  private:
+
+    typedef private_fast_math::sin_table_traits<T> traits;
+
+  public:
+
+    typedef T                             value_type;
+    typedef typename traits::angle_type   angle_type;
+
+  private:
+
+    static ETL_CONSTANT size_t Angle_Bits    = etl::integral_limits<angle_type>::bits;
+    static ETL_CONSTANT size_t Quarter       = Size / 4U;
+    static ETL_CONSTANT size_t Index_Bits    = etl::log2<Size>::value;
+    static ETL_CONSTANT size_t Fraction_Bits = Angle_Bits - Index_Bits;
+
+    typedef private_fast_math::sin_table_values<T, Size / 4U> table_type;
+
+  public:
+
+    ETL_STATIC_ASSERT((Size >= 4U) && ((Size & (Size - 1U)) == 0U), "Size must be a power of 2, at least 4");
+    ETL_STATIC_ASSERT(etl::log2<Size>::value < etl::integral_limits<typename private_fast_math::sin_table_traits<T>::angle_type>::bits, "Size too large for the angle type");
+
+    //*************************************************************************
+    /// sin(angle)
+    //*************************************************************************
+    static T sin(angle_type angle)
+    {
+      const size_t     index    = size_t(angle >> Fraction_Bits);
+      const angle_type fraction = angle_type(angle & angle_type((angle_type(1U) << Fraction_Bits) - 1U));
+      const size_t     quadrant = index / Quarter;
+      const size_t     i        = index % Quarter;
+
+      T a;
+      T b;
+
+      if ((quadrant & 1U) == 0U)
+      {
+        a = table.value[i];
+        b = table.value[i + 1U];
+      }
+      else
+      {
+        a = table.value[Quarter - i];
+        b = table.value[Quarter - i - 1U];
+      }
+
+      const T result = traits::template interpolate<Fraction_Bits>(a, b, fraction);
+
+      return (quadrant >= 2U) ? T(-result) : result;
+    }
+
+    //*************************************************************************
+    /// cos(angle)
+    //*************************************************************************
+    static T cos(angle_type angle)
+    {
+      return sin(angle_type(angle + Quarter_Turn));
+    }
+
+    //*************************************************************************
+    /// sin(angle) and cos(angle).
+    //*************************************************************************
+    static void sin_cos(angle_type angle, T& sin_value, T& cos_value)
+    {
+      sin_value = sin(angle);
+      cos_value = cos(angle);
+    }
+
+    //*************************************************************************
+    /// Block versions.
+    /// Each processes as many values as the shortest span and returns the count.
+    //*************************************************************************
+    static size_t sin(etl::span<const angle_type> angles, etl::span<T> output)
+    {
+      const size_t n = etl::min(angles.size(), output.size());
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        output[i] = sin(angles[i]);
+      }
+
+      return n;
+    }
+
+    static size_t sin_cos(etl::span<const angle_type> angles, etl::span<T> sin_values, etl::span<T> cos_values)
+    {
+      const size_t n = etl::min(angles.size(), etl::min(sin_values.size(), cos_values.size()));
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        sin_cos(angles[i], sin_values[i], cos_values[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    static ETL_CONSTANT angle_type Quarter_Turn = angle_type(angle_type(1U) << (Angle_Bits - 2U));
+
+#if ETL_USING_CPP14
+    static constexpr table_type table = table_type();
+#else
+    static const table_type table;
+#endif
+  };
+
+  template <typename T, size_t Size>
+  ETL_CONSTANT size_t sin_table<T, Size>::Angle_Bits;
+
+  template <typename T, size_t Size>
+  ETL_CONSTANT size_t sin_table<T, Size>::Quarter;
+
+  template <typename T, size_t Size>
+  ETL_CONSTANT size_t sin_table<T, Size>::Index_Bits;
+
+  template <typename T, size_t Size>
+  ETL_CONSTANT size_t sin_table<T, Size>::Fraction_Bits;
+
+  template <typename T, size_t Size>
+  ETL_CONSTANT typename sin_table<T, Size>::angle_type sin_table<T, Size>::Quarter_Turn;
+
+#if ETL_USING_CPP14
+  template <typename T, size_t Size>
+  constexpr typename sin_table<T, Size>::table_type sin_table<T, Size>::table;
+#else
+  template <typename T, size_t Size>
+  const typename sin_table<T, Size>::table_type sin_table<T, Size>::table;
+#endif
+}
+
+#endif
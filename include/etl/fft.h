@@ -0,0 +1,589 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FFT_INCLUDED
+#define ETL_FFT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "math_constants.h"
+#include "log.h"
+#include "span.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+///\defgroup fft fft
+/// Fixed size, in place, Fast Fourier Transforms.
+/// The twiddle factors are calculated once per size and type, at compile time
+/// for C++14 and above.
+/// Fixed point transforms (int16_t as Q15, int32_t as Q31) scale each stage
+/// so that they cannot overflow, giving forward results scaled by 1 / N.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// A complex value for the FFTs.
+  /// Laid out as { real, imaginary }, the same as interleaved sample arrays.
+  ///\ingroup fft
+  //***************************************************************************
+  template <typename T>
+  struct fft_complex
+  {
+    T real;
+    T imag;
+  };
+
+  namespace private_fft
+  {
+    //*************************************************************************
+    /// sin(x) for |x| <= pi / 2, by Taylor series.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline double sin_series(double x)
+    {
+      double term = x;
+      double sum  = x;
+
+      for (int n = 1; n <= 12; ++n)
+      {
+        term *= -(x * x) / double((2 * n) * ((2 * n) + 1));
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// cos(x) for |x| <= pi / 2, by Taylor series.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline double cos_series(double x)
+    {
+      double term = 1.0;
+      double sum  = 1.0;
+
+      for (int n = 1; n <= 12; ++n)
+      {
+        term *= -(x * x) / double(((2 * n) - 1) * (2 * n));
+        sum  += term;
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Floating point arithmetic.
+    //*************************************************************************
+    template <typename T>
+    struct fft_traits
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value, "FFT samples must be floating point, int16_t or int32_t");
+
+      typedef T accumulator_type;
+
+      static ETL_CONSTANT bool Is_Fixed_Point = false;
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        return T(value);
+      }
+
+      // The real part of x * w, in sample scale.
+      static accumulator_type multiply_real(const fft_complex<T>& x, const fft_complex<T>& w)
+      {
+        return (x.real * w.real) - (x.imag * w.imag);
+      }
+
+      // The imaginary part of x * w, in sample scale.
+      static accumulator_type multiply_imag(const fft_complex<T>& x, const fft_complex<T>& w)
+      {
+        return (x.real * w.imag) + (x.imag * w.real);
+      }
+
+      // Floating point values are not scaled.
+      template <size_t Shift>
+      static T scale(accumulator_type value)
+      {
+        return value;
+      }
+
+      static T negate(T value)
+      {
+        return -value;
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT bool fft_traits<T>::Is_Fixed_Point;
+
+    //*************************************************************************
+    /// Fixed point arithmetic.
+    //*************************************************************************
+    template <typename T, typename TAccumulator>
+    struct fixed_point_fft_traits
+    {
+      typedef TAccumulator accumulator_type;
+
+      static ETL_CONSTANT bool   Is_Fixed_Point = true;
+      static ETL_CONSTANT size_t Fraction_Bits  = etl::integral_limits<T>::bits - 1U;
+
+      static ETL_CONSTEXPR14 T from_double(double value)
+      {
+        const double scaled = value * double(etl::integral_limits<T>::max);
+
+        return (scaled >= double(etl::integral_limits<T>::max)) ? etl::integral_limits<T>::max
+                                                                 : ((scaled <= -double(etl::integral_limits<T>::max)) ? T(-etl::integral_limits<T>::max)
+                                                                                                                       : T(scaled + ((scaled >= 0.0) ? 0.5 : -0.5)));
+      }
+
+      // The real part of x * w, in sample scale.
+      static accumulator_type multiply_real(const fft_complex<T>& x, const fft_complex<T>& w)
+      {
+        const accumulator_type value = (accumulator_type(x.real) * accumulator_type(w.real)) - (accumulator_type(x.imag) * accumulator_type(w.imag));
+
+        return (value + (accumulator_type(1) << (Fraction_Bits - 1U))) >> Fraction_Bits;
+      }
+
+      // The imaginary part of x * w, in sample scale.
+      static accumulator_type multiply_imag(const fft_complex<T>& x, const fft_complex<T>& w)
+      {
+        const accumulator_type value = (accumulator_type(x.real) * accumulator_type(w.imag)) + (accumulator_type(x.imag) * accumulator_type(w.real));
+
+        return (value + (accumulator_type(1) << (Fraction_Bits - 1U))) >> Fraction_Bits;
+      }
+
+      // Rounds, divides by 2^Shift and saturates.
+      template <size_t Shift>
+      static T scale(accumulator_type value)
+      {
+        value = (value + ((accumulator_type(1) << Shift) >> 1)) >> Shift;
+
+        if (value > accumulator_type(etl::integral_limits<T>::max))
+        {
+          return etl::integral_limits<T>::max;
+        }
+
+        if (value < accumulator_type(etl::integral_limits<T>::min))
+        {
+          return etl::integral_limits<T>::min;
+        }
+
+        return T(value);
+      }
+
+      // Saturates -min to max.
+      static T negate(T value)
+      {
+        return (value == etl::integral_limits<T>::min) ? etl::integral_limits<T>::max : T(-value);
+      }
+    };
+
+    template <typename T, typename TAccumulator>
+    ETL_CONSTANT bool fixed_point_fft_traits<T, TAccumulator>::Is_Fixed_Point;
+
+    template <typename T, typename TAccumulator>
+    ETL_CONSTANT size_t fixed_point_fft_traits<T, TAccumulator>::Fraction_Bits;
+
+    //*************************************************************************
+    /// Q15.
+    //*************************************************************************
+    template <>
+    struct fft_traits<int16_t> : public fixed_point_fft_traits<int16_t, int32_t>
+    {
+    };
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Q31.
+    //*************************************************************************
+    template <>
+    struct fft_traits<int32_t> : public fixed_point_fft_traits<int32_t, int64_t>
+    {
+    };
+#endif
+
+    //*************************************************************************
+    /// The twiddle factors W(N, k) = exp(-2 pi i k / N) for k = 0 to N/2 - 1.
+    //*************************************************************************
+    template <typename T, size_t N>
+    struct fft_twiddle_table
+    {
+      ETL_CONSTEXPR14 fft_twiddle_table()
+        : w()
+      {
+        for (size_t k = 0U; k < (N / 2U); ++k)
+        {
+          double angle = (2.0 * etl::math::pi * double(k)) / double(N);
+          double sign  = 1.0;
+
+          // Reduce to the range of the series.
+          if (angle > (etl::math::pi / 2.0))
+          {
+            angle = etl::math::pi - angle;
+            sign  = -1.0;
+          }
+
+          w[k].real = fft_traits<T>::from_double(sign * cos_series(angle));
+          w[k].imag = fft_traits<T>::from_double(-sin_series(angle));
+        }
+      }
+
+      fft_complex<T> w[N / 2U];
+    };
+  }
+
+  //***************************************************************************
+  /// Fixed size complex FFT.
+  /// Radix-4 stages, with one radix-2 stage when N is an odd power of 2.
+  ///\tparam N The number of points. A power of 2, at least 2.
+  ///\tparam T float, double, int16_t (Q15) or int32_t (Q31).
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T = float>
+  class fft
+  {
+  private:
+
+    typedef private_fft::fft_traits<T>                  traits;
+    typedef typename traits::accumulator_type           accumulator_type;
+    typedef private_fft::fft_twiddle_table<T, N>        twiddle_table;
+
+  public:
+
+    ETL_STATIC_ASSERT((N >= 2U) && ((N & (N - 1U)) == 0U), "N must be a power of 2, at least 2");
+
+    static ETL_CONSTANT size_t Size = N;
+
+    typedef T                 value_type;
+    typedef fft_complex<T>    complex_type;
+
+    //*************************************************************************
+    /// Forward transform, in place.
+    /// Fixed point results are scaled by 1 / N.
+    //*************************************************************************
+    void forward(etl::span<complex_type, N> data) const
+    {
+      transform(data.data());
+    }
+
+    //*************************************************************************
+    /// Inverse transform, in place.
+    /// Floating point results are scaled by 1 / N, so that inverse(forward(x)) == x.
+    /// Fixed point results are not scaled.
+    //*************************************************************************
+    void inverse(etl::span<complex_type, N> data) const
+    {
+      complex_type* x = data.data();
+
+      conjugate(x);
+      transform(x);
+      conjugate(x);
+
+      if (!traits::Is_Fixed_Point)
+      {
+        const T scale = T(1) / T(N);
+
+        for (size_t i = 0U; i < N; ++i)
+        {
+          x[i].real *= scale;
+          x[i].imag *= scale;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The twiddle factor W(N, k) = exp(-2 pi i k / N), for k = 0 to N - 1.
+    //*************************************************************************
+    static complex_type twiddle(size_t k)
+    {
+      if (k < (N / 2U))
+      {
+        return table.w[k];
+      }
+
+      // W(N, k + N/2) = -W(N, k)
+      const complex_type& w = table.w[k - (N / 2U)];
+      const complex_type  result = { traits::negate(w.real), traits::negate(w.imag) };
+
+      return result;
+    }
+
+  private:
+
+    //*************************************************************************
+    static void conjugate(complex_type* x)
+    {
+      for (size_t i = 0U; i < N; ++i)
+      {
+        x[i].imag = traits::negate(x[i].imag);
+      }
+    }
+
+    //*************************************************************************
+    /// Decimation in time, in place.
+    //*************************************************************************
+    static void transform(complex_type* x)
+    {
+      bit_reverse(x);
+
+      size_t half = 1U; // The half size of the radix-2 butterflies so far.
+
+      // One radix-2 stage when log2(N) is odd.
+      if ((Log2_N % 2U) == 1U)
+      {
+        for (size_t i = 0U; i < N; i += 2U)
+        {
+          const complex_type a = x[i];
+          const complex_type b = x[i + 1U];
+
+          x[i].real      = traits::template scale<1U>(accumulator_type(a.real) + accumulator_type(b.real));
+          x[i].imag      = traits::template scale<1U>(accumulator_type(a.imag) + accumulator_type(b.imag));
+          x[i + 1U].real = traits::template scale<1U>(accumulator_type(a.real) - accumulator_type(b.real));
+          x[i + 1U].imag = traits::template scale<1U>(accumulator_type(a.imag) - accumulator_type(b.imag));
+        }
+
+        half = 2U;
+      }
+
+      // Radix-4 stages, each combining two radix-2 stages.
+      for (; half < N; half *= 4U)
+      {
+        const size_t stride = N / (4U * half); // Twiddle index step for W(4 * half, j).
+
+        for (size_t start = 0U; start < N; start += (4U * half))
+        {
+          for (size_t j = 0U; j < half; ++j)
+          {
+            complex_type* p = x + start + j;
+
+            const complex_type a = p[0];
+
+            // B = W^2j * b, C = W^j * c, D = W^3j * d, for W = W(4 * half).
+            const complex_type w1 = table.w[j * stride];
+            const complex_type w2 = table.w[2U * j * stride];
+            const complex_type w3 = twiddle(3U * j * stride);
+
+            const accumulator_type b_re = traits::multiply_real(p[half], w2);
+            const accumulator_type b_im = traits::multiply_imag(p[half], w2);
+            const accumulator_type c_re = traits::multiply_real(p[2U * half], w1);
+            const accumulator_type c_im = traits::multiply_imag(p[2U * half], w1);
+            const accumulator_type d_re = traits::multiply_real(p[3U * half], w3);
+            const accumulator_type d_im = traits::multiply_imag(p[3U * half], w3);
+
+            const accumulator_type sum_ab_re  = accumulator_type(a.real) + b_re;
+            const accumulator_type sum_ab_im  = accumulator_type(a.imag) + b_im;
+            const accumulator_type diff_ab_re = accumulator_type(a.real) - b_re;
+            const accumulator_type diff_ab_im = accumulator_type(a.imag) - b_im;
+            const accumulator_type sum_cd_re  = c_re + d_re;
+            const accumulator_type sum_cd_im  = c_im + d_im;
+            const accumulator_type diff_cd_re = c_re - d_re;
+            const accumulator_type diff_cd_im = c_im - d_im;
+
+            p[0].real        = traits::template scale<2U>(sum_ab_re + sum_cd_re);
+            p[0].imag        = traits::template scale<2U>(sum_ab_im + sum_cd_im);
+            p[2U * half].real = traits::template scale<2U>(sum_ab_re - sum_cd_re);
+            p[2U * half].imag = traits::template scale<2U>(sum_ab_im - sum_cd_im);
+
+            // (a - B) -/+ i(C - D)
+            p[half].real      = traits::template scale<2U>(diff_ab_re + diff_cd_im);
+            p[half].imag      = traits::template scale<2U>(diff_ab_im - diff_cd_re);
+            p[3U * half].real = traits::template scale<2U>(diff_ab_re - diff_cd_im);
+            p[3U * half].imag = traits::template scale<2U>(diff_ab_im + diff_cd_re);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    static void bit_reverse(complex_type* x)
+    {
+      size_t j = 0U;
+
+      for (size_t i = 1U; i < N; ++i)
+      {
+        size_t bit = N >> 1U;
+
+        while ((j & bit) != 0U)
+        {
+          j  ^= bit;
+          bit >>= 1U;
+        }
+
+        j ^= bit;
+
+        if (i < j)
+        {
+          const complex_type temp = x[i];
+          x[i] = x[j];
+          x[j] = temp;
+        }
+      }
+    }
+
+    static ETL_CONSTANT size_t Log2_N = etl::log2<N>::value;
+
+#if ETL_USING_CPP14
+    static constexpr twiddle_table table = twiddle_table();
+#else
+    static const twiddle_table table;
+#endif
+  };
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t fft<N, T>::Size;
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t fft<N, T>::Log2_N;
+
+#if ETL_USING_CPP14
+  template <size_t N, typename T>
+  constexpr typename fft<N, T>::twiddle_table fft<N, T>::table;
+#else
+  template <size_t N, typename T>
+  const typename fft<N, T>::twiddle_table fft<N, T>::table;
+#endif
+
+  //***************************************************************************
+  /// Fixed size FFT of real samples.
+  /// Uses an N/2 point complex FFT, and returns bins 0 to N/2.
+  /// The remaining bins are the complex conjugates, X[N - k] = conj(X[k]).
+  ///\tparam N The number of samples. A power of 2, at least 4.
+  ///\tparam T float, double, int16_t (Q15) or int32_t (Q31).
+  ///\ingroup fft
+  //***************************************************************************
+  template <size_t N, typename T = float>
+  class real_fft
+  {
+  private:
+
+    typedef private_fft::fft_traits<T>                  traits;
+    typedef typename traits::accumulator_type           accumulator_type;
+    typedef private_fft::fft_twiddle_table<T, N>        twiddle_table;
+
+  public:
+
+    ETL_STATIC_ASSERT((N >= 4U) && ((N & (N - 1U)) == 0U), "N must be a power of 2, at least 4");
+
+    static ETL_CONSTANT size_t Size     = N;
+    static ETL_CONSTANT size_t Bin_Count = (N / 2U) + 1U;
+
+    typedef T              value_type;
+    typedef fft_complex<T> complex_type;
+
+    //*************************************************************************
+    /// Forward transform.
+    /// Fixed point results are scaled by 1 / N.
+    ///\param input  N real samples.
+    ///\param output Bins 0 to N/2.
+    //*************************************************************************
+    void forward(etl::span<const T, N> input, etl::span<complex_type, (N / 2U) + 1U> output) const
+    {
+      complex_type* z = output.data();
+
+      // Pack the even samples as real and the odd as imaginary.
+      for (size_t n = 0U; n < (N / 2U); ++n)
+      {
+        z[n].real = input[2U * n];
+        z[n].imag = input[(2U * n) + 1U];
+      }
+
+      half_fft.forward(etl::span<complex_type, N / 2U>(z, N / 2U));
+
+      // Separate the spectra of the even and odd samples, and recombine.
+      for (size_t k = 0U; k <= (N / 4U); ++k)
+      {
+        const size_t       m  = (N / 2U) - k;
+        const complex_type zk = z[k];
+        const complex_type zm = (k == 0U) ? z[0] : z[m];
+
+        // E = (Z[k] + conj(Z[m])) / 2, O = (Z[k] - conj(Z[m])) / 2
+        // Fixed point divides by 4, to match the 1 / N scaling.
+        complex_type e;
+        e.real = traits::template scale<Split_Shift>(accumulator_type(zk.real) + accumulator_type(zm.real));
+        e.imag = traits::template scale<Split_Shift>(accumulator_type(zk.imag) - accumulator_type(zm.imag));
+
+        complex_type o;
+        o.real = traits::template scale<Split_Shift>(accumulator_type(zk.real) - accumulator_type(zm.real));
+        o.imag = traits::template scale<Split_Shift>(accumulator_type(zk.imag) + accumulator_type(zm.imag));
+
+        if (!traits::Is_Fixed_Point)
+        {
+          e.real *= T(0.5);
+          e.imag *= T(0.5);
+          o.real *= T(0.5);
+          o.imag *= T(0.5);
+        }
+
+        // P = W(N, k) * O
+        const complex_type&    w = table.w[k];
+        const accumulator_type p = traits::multiply_real(o, w);
+        const accumulator_type q = traits::multiply_imag(o, w);
+
+        // X[k] = E - iP, X[m] = conj(E) - i conj(P)
+        z[k].real = traits::template scale<0U>(accumulator_type(e.real) + q);
+        z[k].imag = traits::template scale<0U>(accumulator_type(e.imag) - p);
+        z[m].real = traits::template scale<0U>(accumulator_type(e.real) - q);
+        z[m].imag = traits::template scale<0U>(-accumulator_type(e.imag) - p);
+      }
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Split_Shift = traits::Is_Fixed_Point ? 2U : 0U;
+
+    etl::fft<N / 2U, T> half_fft;
+
+#if ETL_USING_CPP14
+    static constexpr twiddle_table table = twiddle_table();
+#else
+    static const twiddle_table table;
+#endif
+  };
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t real_fft<N, T>::Size;
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t real_fft<N, T>::Bin_Count;
+
+  template <size_t N, typename T>
+  ETL_CONSTANT size_t real_fft<N, T>::Split_Shift;
+
+#if ETL_USING_CPP14
+  template <size_t N, typename T>
+  constexpr typename real_fft<N, T>::twiddle_table real_fft<N, T>::table;
+#else
+  template <size_t N, typename T>
+  const typename real_fft<N, T>::twiddle_table real_fft<N, T>::table;
+#endif
+}
+
+#endif
@@ -103,5 +103,44 @@ SOFTWARE.
 #define ETL_EXPECTED_FILE_ID "70"
 #define ETL_ALIGNMENT_FILE_ID "71"
 #define ETL_BASE64_FILE_ID "72"
+#define ETL_FLAT_UNORDERED_MAP_FILE_ID "73"
+#define ETL_ROBIN_HOOD_UNORDERED_SET_FILE_ID "74"
+#define ETL_MONOTONIC_ARENA_FILE_ID "75"
+#define ETL_QUEUED_MESSAGE_ROUTER_FILE_ID "76"
+#define ETL_SCHEDULER_WORK_STEALING_FILE_ID "77"
+#define ETL_BTREE_MAP_FILE_ID "78"
+#define ETL_BTREE_SET_FILE_ID "79"
+#define ETL_FROZEN_FLAT_MAP_FILE_ID "80"
+#define ETL_FROZEN_FLAT_SET_FILE_ID "81"
+#define ETL_CONST_MAP_FILE_ID "82"
+#define ETL_SOA_VECTOR_FILE_ID "83"
+#define ETL_SLOT_MAP_FILE_ID "84"
+#define ETL_HIERARCHICAL_BITSET_FILE_ID "85"
+#define ETL_QUEUED_FSM_FILE_ID "86"
+#define ETL_INPLACE_FUNCTION_FILE_ID "87"
+#define ETL_DELEGATE_OBSERVER_FILE_ID "88"
+#define ETL_HYBRID_MESSAGE_PACKET_FILE_ID "89"
+#define ETL_CHUNKED_LIST_FILE_ID "90"
+#define ETL_INDEXED_PRIORITY_QUEUE_FILE_ID "91"
+#define ETL_RADIX_HEAP_FILE_ID "92"
+#define ETL_PACKET_VIEW_FILE_ID "93"
+#define ETL_PERSISTENT_FILE_ID "94"
+#define ETL_INTRUSIVE_INDEX_LIST_FILE_ID "95"
+#define ETL_INTRUSIVE_INDEX_FORWARD_LIST_FILE_ID "96"
+#define ETL_COMPACT_LIST_FILE_ID "97"
+#define ETL_COMPACT_MAP_FILE_ID "98"
+#define ETL_COMPACT_SET_FILE_ID "99"
+#define ETL_DENSE_SET_FILE_ID "100"
+#define ETL_DENSE_MAP_FILE_ID "101"
+#define ETL_SHARED_STRING_FILE_ID "102"
+#define ETL_RECORD_BUFFER_MPSC_ATOMIC_FILE_ID "103"
+#define ETL_FRAMING_FILE_ID "104"
+#define ETL_LZSS_FILE_ID "105"
+#define ETL_INTERVAL_MAP_FILE_ID "106"
+#define ETL_TOPIC_TRIE_FILE_ID "107"
+#define ETL_RATE_LIMITER_FILE_ID "108"
+#define ETL_MULTI_BUFFER_FILE_ID "109"
+#define ETL_REORDER_BUFFER_FILE_ID "110"
+#define ETL_HASH_RING_FILE_ID "111"
 
 #endif
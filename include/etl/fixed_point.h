@@ -0,0 +1,595 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_POINT_INCLUDED
+#define ETL_FIXED_POINT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "smallest.h"
+#include "span.h"
+#include "static_assert.h"
+#include "private/fixed_point_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "private/minmax_push.h"
+
+///\defgroup fixed_point fixed_point
+/// Signed fixed point numbers with saturating arithmetic.
+/// A value is stored as a signed integer, scaled by 2^Fraction_Bits.
+/// Results that do not fit are clamped to the representable range.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  /// A signed fixed point number.
+  /// Sign + Integer_Bits + Fraction_Bits bits, in a signed integer of at most 32 bits.
+  /// Products are calculated at double width, rounded to nearest (halves up)
+  /// and saturated.
+  /// The class holds only the storage value, so a span of fixed_point has the
+  /// layout of an array of the storage type.
+  ///\tparam VInteger_Bits  The number of integer bits, excluding the sign.
+  ///\tparam VFraction_Bits The number of fraction bits.
+  ///\tparam TStorage       The signed storage type.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage = typename etl::smallest_int_for_bits<VInteger_Bits + VFraction_Bits + 1U>::type>
+  class fixed_point
+  {
+  public:
+
+    typedef TStorage                                                                       storage_type;
+    typedef typename etl::smallest_int_for_bits<2U * etl::integral_limits<TStorage>::bits>::type wide_type;
+
+    static ETL_CONSTANT size_t Integer_Bits  = VInteger_Bits;
+    static ETL_CONSTANT size_t Fraction_Bits = VFraction_Bits;
+
+    ETL_STATIC_ASSERT(etl::is_signed<TStorage>::value, "The storage type must be signed");
+    ETL_STATIC_ASSERT(sizeof(TStorage) <= sizeof(int32_t), "The storage type must be at most 32 bits");
+    ETL_STATIC_ASSERT((VInteger_Bits + VFraction_Bits + 1U) <= size_t(etl::integral_limits<TStorage>::bits), "Too many bits for the storage type");
+
+    //*************************************************************************
+    /// Default constructor. Zero.
+    //*************************************************************************
+    ETL_CONSTEXPR fixed_point()
+      : value(0)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a floating point value, rounded to nearest and saturated.
+    //*************************************************************************
+    explicit fixed_point(double d)
+      : value(from_double(d))
+    {
+    }
+
+    //*************************************************************************
+    /// Converts from another format, rounded to nearest and saturated.
+    //*************************************************************************
+    template <size_t VInteger_Bits2, size_t VFraction_Bits2, typename TStorage2>
+    explicit fixed_point(const fixed_point<VInteger_Bits2, VFraction_Bits2, TStorage2>& other)
+      : value(saturate(shift_fraction<VFraction_Bits2, VFraction_Bits>(int64_t(other.raw()))))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from the raw storage value.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point from_raw(storage_type raw_value)
+    {
+      return fixed_point(raw_value, raw_tag());
+    }
+
+    //*************************************************************************
+    /// Constructs from an integer, saturated.
+    //*************************************************************************
+    static fixed_point from_integer(int32_t i)
+    {
+      return from_raw(saturate(int64_t(i) * (int64_t(1) << Fraction_Bits)));
+    }
+
+    //*************************************************************************
+    /// Constructs from a value scaled by SCALING, as used by the scaled
+    /// rounding functions. For example, from_scaled<100>(314) is 3.14.
+    /// Rounded to nearest and saturated.
+    //*************************************************************************
+    template <uint32_t SCALING>
+    static fixed_point from_scaled(int32_t scaled)
+    {
+      ETL_STATIC_ASSERT(SCALING != 0U, "Scaling must not be zero");
+
+      const int64_t numerator = int64_t(scaled) * (int64_t(1) << Fraction_Bits);
+
+      return from_raw(saturate(divide_nearest(numerator, int64_t(SCALING))));
+    }
+
+    //*************************************************************************
+    /// The value multiplied by SCALING and rounded to nearest, for use with
+    /// the scaled rounding functions. For example, 3.14159 to_scaled<100>() is 314.
+    //*************************************************************************
+    template <uint32_t SCALING>
+    int64_t to_scaled() const
+    {
+      return shift_fraction<Fraction_Bits, 0U>(int64_t(value) * int64_t(SCALING));
+    }
+
+    //*************************************************************************
+    /// The raw storage value.
+    //*************************************************************************
+    ETL_CONSTEXPR storage_type raw() const
+    {
+      return value;
+    }
+
+    //*************************************************************************
+    /// The value as a double.
+    //*************************************************************************
+    double to_double() const
+    {
+      return double(value) / double(int64_t(1) << Fraction_Bits);
+    }
+
+    //*************************************************************************
+    /// The value as a float.
+    //*************************************************************************
+    float to_float() const
+    {
+      return float(to_double());
+    }
+
+    //*************************************************************************
+    /// The value rounded to the nearest integer, halves up.
+    //*************************************************************************
+    int32_t to_integer() const
+    {
+      return int32_t(shift_fraction<Fraction_Bits, 0U>(int64_t(value)));
+    }
+
+    //*************************************************************************
+    /// The largest, smallest and smallest positive values.
+    //*************************************************************************
+    static ETL_CONSTEXPR fixed_point max()
+    {
+      return from_raw(storage_type(Max_Raw));
+    }
+
+    static ETL_CONSTEXPR fixed_point min()
+    {
+      return from_raw(storage_type(Min_Raw));
+    }
+
+    static ETL_CONSTEXPR fixed_point epsilon()
+    {
+      return from_raw(storage_type(1));
+    }
+
+    //*************************************************************************
+    /// Saturating arithmetic.
+    //*************************************************************************
+    fixed_point& operator +=(fixed_point rhs)
+    {
+      value = saturate(wide_type(value) + wide_type(rhs.value));
+      return *this;
+    }
+
+    fixed_point& operator -=(fixed_point rhs)
+    {
+      value = saturate(wide_type(value) - wide_type(rhs.value));
+      return *this;
+    }
+
+    fixed_point& operator *=(fixed_point rhs)
+    {
+      value = multiply_raw(value, rhs.value);
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Saturating divide, rounded to nearest.
+    /// Division by zero gives max() or min(), with the sign of the dividend.
+    //*************************************************************************
+    fixed_point& operator /=(fixed_point rhs)
+    {
+      if (rhs.value == 0)
+      {
+        value = (value < 0) ? storage_type(Min_Raw) : storage_type(Max_Raw);
+      }
+      else
+      {
+        value = saturate(divide_nearest(int64_t(value) * (int64_t(1) << Fraction_Bits), int64_t(rhs.value)));
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    friend fixed_point operator +(fixed_point lhs, fixed_point rhs)
+    {
+      return lhs += rhs;
+    }
+
+    friend fixed_point operator -(fixed_point lhs, fixed_point rhs)
+    {
+      return lhs -= rhs;
+    }
+
+    friend fixed_point operator *(fixed_point lhs, fixed_point rhs)
+    {
+      return lhs *= rhs;
+    }
+
+    friend fixed_point operator /(fixed_point lhs, fixed_point rhs)
+    {
+      return lhs /= rhs;
+    }
+
+    //*************************************************************************
+    /// Saturating negate. -min() is max().
+    //*************************************************************************
+    fixed_point operator -() const
+    {
+      return from_raw(saturate(-wide_type(value)));
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(fixed_point lhs, fixed_point rhs) { return lhs.value == rhs.value; }
+    friend ETL_CONSTEXPR bool operator !=(fixed_point lhs, fixed_point rhs) { return lhs.value != rhs.value; }
+    friend ETL_CONSTEXPR bool operator <(fixed_point lhs, fixed_point rhs)  { return lhs.value <  rhs.value; }
+    friend ETL_CONSTEXPR bool operator <=(fixed_point lhs, fixed_point rhs) { return lhs.value <= rhs.value; }
+    friend ETL_CONSTEXPR bool operator >(fixed_point lhs, fixed_point rhs)  { return lhs.value >  rhs.value; }
+    friend ETL_CONSTEXPR bool operator >=(fixed_point lhs, fixed_point rhs) { return lhs.value >= rhs.value; }
+
+    //*************************************************************************
+    /// Block operations.
+    /// Each processes the smaller of the input and output sizes.
+    /// The output may be the same buffer as an input.
+    /// 16 and 32 bit formats that fill their storage use the saturating
+    /// instructions of the target, where available.
+    //*************************************************************************
+
+    //*************************************************************************
+    /// out[i] = a[i] + b[i]
+    //*************************************************************************
+    static void add(etl::span<const fixed_point> a, etl::span<const fixed_point> b, etl::span<fixed_point> out)
+    {
+      const size_t n = block_size(a, b, out);
+      size_t i = 0U;
+
+      if ETL_IF_CONSTEXPR(Fills_Storage)
+      {
+        i = simd_add(raw_data(a), raw_data(b), raw_data(out), n);
+      }
+
+      for (; i < n; ++i)
+      {
+        out[i] = a[i] + b[i];
+      }
+    }
+
+    //*************************************************************************
+    /// out[i] = a[i] - b[i]
+    //*************************************************************************
+    static void subtract(etl::span<const fixed_point> a, etl::span<const fixed_point> b, etl::span<fixed_point> out)
+    {
+      const size_t n = block_size(a, b, out);
+      size_t i = 0U;
+
+      if ETL_IF_CONSTEXPR(Fills_Storage)
+      {
+        i = simd_subtract(raw_data(a), raw_data(b), raw_data(out), n);
+      }
+
+      for (; i < n; ++i)
+      {
+        out[i] = a[i] - b[i];
+      }
+    }
+
+    //*************************************************************************
+    /// out[i] = a[i] * b[i]
+    //*************************************************************************
+    static void multiply(etl::span<const fixed_point> a, etl::span<const fixed_point> b, etl::span<fixed_point> out)
+    {
+      const size_t n = block_size(a, b, out);
+      size_t i = 0U;
+
+      if ETL_IF_CONSTEXPR(Is_Q_Format)
+      {
+        i = simd_multiply(raw_data(a), raw_data(b), raw_data(out), n);
+      }
+
+      for (; i < n; ++i)
+      {
+        out[i] = a[i] * b[i];
+      }
+    }
+
+    //*************************************************************************
+    /// out[i] = in[i] * gain
+    //*************************************************************************
+    static void scale(etl::span<const fixed_point> in, fixed_point gain, etl::span<fixed_point> out)
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        out[i] = in[i] * gain;
+      }
+    }
+
+    //*************************************************************************
+    /// The sum of a[i] * b[i], accumulated exactly at 64 bits, then rounded
+    /// and saturated. Processes the smaller of the two sizes.
+    /// Only for storage of up to 16 bits, so that the sum cannot overflow.
+    //*************************************************************************
+    static fixed_point dot_product(etl::span<const fixed_point> a, etl::span<const fixed_point> b)
+    {
+      ETL_STATIC_ASSERT(sizeof(TStorage) <= sizeof(int16_t), "dot_product needs storage of at most 16 bits");
+
+      const size_t n = (a.size() < b.size()) ? a.size() : b.size();
+
+      int64_t sum = 0;
+      size_t  i   = 0U;
+
+      i = simd_dot_product(raw_data(a), raw_data(b), n, sum);
+
+      for (; i < n; ++i)
+      {
+        sum += int64_t(a[i].value) * int64_t(b[i].value);
+      }
+
+      return from_raw(saturate(shift_fraction<2U * Fraction_Bits, Fraction_Bits>(sum)));
+    }
+
+  private:
+
+    struct raw_tag {};
+
+    static ETL_CONSTANT int64_t Max_Raw = (int64_t(1) << (VInteger_Bits + VFraction_Bits)) - 1;
+    static ETL_CONSTANT int64_t Min_Raw = -(int64_t(1) << (VInteger_Bits + VFraction_Bits));
+
+    static ETL_CONSTANT bool Fills_Storage = ((VInteger_Bits + VFraction_Bits + 1U) == size_t(etl::integral_limits<TStorage>::bits)) &&
+                                             (etl::is_same<TStorage, int16_t>::value || etl::is_same<TStorage, int32_t>::value);
+    static ETL_CONSTANT bool Is_Q_Format   = Fills_Storage && (VInteger_Bits == 0U);
+
+    //*************************************************************************
+    ETL_CONSTEXPR fixed_point(storage_type raw_value, raw_tag)
+      : value(raw_value)
+    {
+    }
+
+    //*************************************************************************
+    /// Clamps to the representable range.
+    //*************************************************************************
+    template <typename T>
+    static storage_type saturate(T v)
+    {
+      if (int64_t(v) > Max_Raw)
+      {
+        return storage_type(Max_Raw);
+      }
+
+      if (int64_t(v) < Min_Raw)
+      {
+        return storage_type(Min_Raw);
+      }
+
+      return storage_type(v);
+    }
+
+    //*************************************************************************
+    /// Changes the number of fraction bits, rounding to nearest, halves up.
+    //*************************************************************************
+    template <size_t From_Bits, size_t To_Bits>
+    static int64_t shift_fraction(int64_t v)
+    {
+      if ETL_IF_CONSTEXPR(From_Bits > To_Bits)
+      {
+        const size_t shift = (From_Bits > To_Bits) ? From_Bits - To_Bits : 0U;
+
+        return (v + ((int64_t(1) << shift) >> 1)) >> shift; // Arithmetic shift.
+      }
+      else
+      {
+        const size_t shift = (To_Bits > From_Bits) ? To_Bits - From_Bits : 0U;
+
+        return v * (int64_t(1) << shift);
+      }
+    }
+
+    //*************************************************************************
+    /// Divides, rounding to nearest, halves away from zero.
+    //*************************************************************************
+    static int64_t divide_nearest(int64_t numerator, int64_t denominator)
+    {
+      if (denominator < 0)
+      {
+        numerator   = -numerator;
+        denominator = -denominator;
+      }
+
+      const int64_t half = denominator / 2;
+
+      return (numerator >= 0) ? (numerator + half) / denominator : (numerator - half) / denominator;
+    }
+
+    //*************************************************************************
+    static storage_type multiply_raw(storage_type lhs, storage_type rhs)
+    {
+      return saturate(shift_fraction<2U * Fraction_Bits, Fraction_Bits>(int64_t(wide_type(lhs) * wide_type(rhs))));
+    }
+
+    //*************************************************************************
+    static double round_half_up(double d)
+    {
+      const double truncated = double(int64_t(d));
+
+      return ((d - truncated) >= 0.5) ? truncated + 1.0 : (((d - truncated) < -0.5) ? truncated - 1.0 : truncated);
+    }
+
+    //*************************************************************************
+    static storage_type from_double(double d)
+    {
+      const double scaled = d * double(int64_t(1) << Fraction_Bits);
+
+      if (scaled >= double(Max_Raw))
+      {
+        return storage_type(Max_Raw);
+      }
+
+      if (scaled <= double(Min_Raw))
+      {
+        return storage_type(Min_Raw);
+      }
+
+      return storage_type(int64_t(round_half_up(scaled)));
+    }
+
+    //*************************************************************************
+    static size_t block_size(etl::span<const fixed_point> a, etl::span<const fixed_point> b, etl::span<fixed_point> out)
+    {
+      size_t n = (a.size() < b.size()) ? a.size() : b.size();
+
+      return (n < out.size()) ? n : out.size();
+    }
+
+    //*************************************************************************
+    static const storage_type* raw_data(etl::span<const fixed_point> s)
+    {
+      return reinterpret_cast<const storage_type*>(s.data());
+    }
+
+    static storage_type* raw_data(etl::span<fixed_point> s)
+    {
+      return reinterpret_cast<storage_type*>(s.data());
+    }
+
+    //*************************************************************************
+    /// Selects the kernels for the storage type.
+    /// The other storage types have none, and process no values.
+    //*************************************************************************
+    static size_t simd_add(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_add(a, b, out, n);
+    }
+
+    static size_t simd_add(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_add(a, b, out, n);
+    }
+
+    template <typename T>
+    static size_t simd_add(const T*, const T*, T*, size_t)
+    {
+      return 0U;
+    }
+
+    static size_t simd_subtract(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_subtract(a, b, out, n);
+    }
+
+    static size_t simd_subtract(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_subtract(a, b, out, n);
+    }
+
+    template <typename T>
+    static size_t simd_subtract(const T*, const T*, T*, size_t)
+    {
+      return 0U;
+    }
+
+    static size_t simd_multiply(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_multiply_q15(a, b, out, n);
+    }
+
+    static size_t simd_multiply(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      return etl::private_fixed_point::simd_multiply_q31(a, b, out, n);
+    }
+
+    template <typename T>
+    static size_t simd_multiply(const T*, const T*, T*, size_t)
+    {
+      return 0U;
+    }
+
+    static size_t simd_dot_product(const int16_t* a, const int16_t* b, size_t n, int64_t& sum)
+    {
+      return etl::private_fixed_point::simd_dot_product(a, b, n, sum);
+    }
+
+    template <typename T>
+    static size_t simd_dot_product(const T*, const T*, size_t, int64_t&)
+    {
+      return 0U;
+    }
+
+    storage_type value;
+  };
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT size_t fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Integer_Bits;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT size_t fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Fraction_Bits;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT int64_t fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Max_Raw;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT int64_t fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Min_Raw;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT bool fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Fills_Storage;
+
+  template <size_t VInteger_Bits, size_t VFraction_Bits, typename TStorage>
+  ETL_CONSTANT bool fixed_point<VInteger_Bits, VFraction_Bits, TStorage>::Is_Q_Format;
+
+  //***************************************************************************
+  /// The common DSP formats.
+  ///\ingroup fixed_point
+  //***************************************************************************
+  typedef etl::fixed_point<0U,  7U,  int8_t>  q7_t;
+  typedef etl::fixed_point<0U,  15U, int16_t> q15_t;
+  typedef etl::fixed_point<0U,  31U, int32_t> q31_t;
+  typedef etl::fixed_point<15U, 16U, int32_t> q16_16_t;
+}
+
+#include "private/minmax_pop.h"
+
+#endif
@@ -323,10 +323,30 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_map from a range that is already sorted by
+    /// key and has no duplicate keys. The ordering is not checked.
+    /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        if (refmap_t::full())
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(flat_map_full));
+          return;
+        }
+
+        refmap_t::append_unordered(create_value(*first));
         ++first;
       }
     }
@@ -400,8 +420,9 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The values are appended as a batch, sorted and merged with the existing
+    /// elements in one pass. Values with existing or repeated keys are ignored.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
@@ -410,8 +431,24 @@ namespace etl
     {
       while (first != last)
       {
-        insert(*first);
-        ++first;
+        if (refmap_t::full())
+        {
+          // No room for a batch; an existing key is still accepted.
+          insert(*first);
+          ++first;
+        }
+        else
+        {
+          const size_t old_size = size();
+
+          while ((first != last) && !refmap_t::full())
+          {
+            refmap_t::append_unordered(create_value(*first));
+            ++first;
+          }
+
+          refmap_t::merge_appended(old_size, destroy_value(storage, etl_debug_count));
+        }
       }
     }
 
@@ -1021,6 +1058,40 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
 
+    //*************************************************************************
+    /// Creates a value in the storage.
+    //*************************************************************************
+    value_type& create_value(const_reference value)
+    {
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new ((void*)pvalue) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return *pvalue;
+    }
+
+    //*************************************************************************
+    /// Destroys values that were not merged into the map.
+    //*************************************************************************
+    struct destroy_value
+    {
+      destroy_value(storage_t& storage_, etl::debug_count& etl_debug_count_)
+        : storage(storage_)
+        , etl_debug_count(etl_debug_count_)
+      {
+      }
+
+      void operator ()(value_type& value)
+      {
+        value.~value_type();
+        storage.release(etl::addressof(value));
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      storage_t&         storage;
+      etl::debug_count&  etl_debug_count;
+    };
+
 #if ETL_USING_CPP11
     //*************************************************************************
     template <typename TValueType>
@@ -1175,6 +1246,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted by key and
+    /// has no duplicate keys. The ordering is not checked.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_map(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : etl::iflat_map<TKey, TValue, TCompare>(lookup, storage)
+    {
+      this->assign(tag, first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
@@ -214,10 +214,30 @@ namespace etl
 #endif
 
       clear();
+      insert(first, last);
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_set from a range that is already sorted and
+    /// has no duplicates. The ordering is not checked.
+    /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(etl::sorted_unique_t, TIterator first, TIterator last)
+    {
+      clear();
 
       while (first != last)
       {
-        insert(*first);
+        if (refset_t::full())
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(flat_set_full));
+          return;
+        }
+
+        refset_t::append_unordered(create_value(*first));
         ++first;
       }
     }
@@ -300,8 +320,9 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_set.
+    /// The values are appended as a batch, sorted and merged with the existing
+    /// elements in one pass. Existing or repeated values are ignored.
     /// If asserts or exceptions are enabled, emits flat_set_full if the flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
@@ -310,8 +331,24 @@ namespace etl
     {
       while (first != last)
       {
-        insert(*first);
-        ++first;
+        if (refset_t::full())
+        {
+          // No room for a batch; an existing value is still accepted.
+          insert(*first);
+          ++first;
+        }
+        else
+        {
+          const size_t old_size = size();
+
+          while ((first != last) && !refset_t::full())
+          {
+            refset_t::append_unordered(create_value(*first));
+            ++first;
+          }
+
+          refset_t::merge_appended(old_size, destroy_value(storage, etl_debug_count));
+        }
       }
     }
 
@@ -956,6 +993,40 @@ namespace etl
     /// Internal debugging.
     ETL_DECLARE_DEBUG_COUNT;
 
+    //*************************************************************************
+    /// Creates a value in the storage.
+    //*************************************************************************
+    value_type& create_value(const_reference value)
+    {
+      value_type* pvalue = storage.allocate<value_type>();
+      ::new ((void*)pvalue) value_type(value);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return *pvalue;
+    }
+
+    //*************************************************************************
+    /// Destroys values that were not merged into the set.
+    //*************************************************************************
+    struct destroy_value
+    {
+      destroy_value(storage_t& storage_, etl::debug_count& etl_debug_count_)
+        : storage(storage_)
+        , etl_debug_count(etl_debug_count_)
+      {
+      }
+
+      void operator ()(value_type& value)
+      {
+        value.~value_type();
+        storage.release(etl::addressof(value));
+        ETL_DECREMENT_DEBUG_COUNT;
+      }
+
+      storage_t&         storage;
+      etl::debug_count&  etl_debug_count;
+    };
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -1056,6 +1127,20 @@ namespace etl
       this->assign(first, last);
     }
 
+    //*************************************************************************
+    /// Constructor, from an iterator range that is already sorted and has no
+    /// duplicates. The ordering is not checked.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_set(etl::sorted_unique_t tag, TIterator first, TIterator last)
+      : etl::iflat_set<T, TCompare>(lookup, storage)
+    {
+      this->assign(tag, first, last);
+    }
+
 #if ETL_HAS_INITIALIZER_LIST
     //*************************************************************************
     /// Construct from initializer_list.
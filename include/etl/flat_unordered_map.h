@@ -0,0 +1,1510 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_UNORDERED_MAP_INCLUDED
+#define ETL_FLAT_UNORDERED_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "binary.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "memory.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup flat_unordered_map flat_unordered_map
+/// An open addressing unordered_map with the capacity defined at compile time.
+/// Keys and values are stored inline in a slot array, alongside an array of
+/// one byte control words that are probed a group at a time.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_exception : public etl::exception
+  {
+  public:
+
+    flat_unordered_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_full : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:full", ETL_FLAT_UNORDERED_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_out_of_range : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:range", ETL_FLAT_UNORDERED_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_unordered_map.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  class flat_unordered_map_iterator : public etl::flat_unordered_map_exception
+  {
+  public:
+
+    flat_unordered_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_map_exception(ETL_ERROR_TEXT("flat_unordered_map:iterator", ETL_FLAT_UNORDERED_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_unordered_map
+  {
+    //*************************************************************************
+    /// Control bytes and the SWAR operations on a group of them.
+    /// A control byte is 'Empty', 'Deleted', or holds the low 7 bits of the
+    /// hash of the key in a full slot.
+    //*************************************************************************
+    template <typename TGroup>
+    struct control_group
+    {
+      typedef TGroup group_t;
+
+      static ETL_CONSTANT size_t  Width   = sizeof(group_t);
+      static ETL_CONSTANT uint8_t Empty   = 0x80U;
+      static ETL_CONSTANT uint8_t Deleted = 0xFEU;
+      static ETL_CONSTANT group_t Lsbs    = group_t(~group_t(0U)) / 0xFFU;
+      static ETL_CONSTANT group_t Msbs    = group_t(Lsbs << 7U);
+
+      //***********************************************************************
+      /// Loads a group of control bytes. The first byte is the least significant.
+      //***********************************************************************
+      static group_t load(const uint8_t* pcontrol)
+      {
+        group_t group = 0U;
+
+        for (size_t i = 0U; i < Width; ++i)
+        {
+          group |= group_t(group_t(pcontrol[i]) << (8U * i));
+        }
+
+        return group;
+      }
+
+      //***********************************************************************
+      /// A mask of the bytes that may match h2.
+      /// May contain false positives, which are eliminated by the key compare.
+      //***********************************************************************
+      static group_t match(group_t group, uint8_t h2)
+      {
+        const group_t x = group_t(group ^ group_t(Lsbs * h2));
+
+        return group_t(group_t(x - Lsbs) & group_t(~x) & Msbs);
+      }
+
+      //***********************************************************************
+      /// A mask of the empty bytes.
+      //***********************************************************************
+      static group_t match_empty(group_t group)
+      {
+        return group_t(group & group_t(~(group << 6U)) & Msbs);
+      }
+
+      //***********************************************************************
+      /// A mask of the empty or deleted bytes.
+      //***********************************************************************
+      static group_t match_empty_or_deleted(group_t group)
+      {
+        return group_t(group & Msbs);
+      }
+
+      //***********************************************************************
+      /// A mask of the full bytes.
+      //***********************************************************************
+      static group_t match_full(group_t group)
+      {
+        return group_t(group_t(~group) & Msbs);
+      }
+
+      //***********************************************************************
+      /// The index of the lowest byte in the mask.
+      //***********************************************************************
+      static size_t lowest(group_t mask)
+      {
+        return size_t(etl::count_trailing_zeros(mask)) / 8U;
+      }
+
+      //***********************************************************************
+      /// Removes the lowest byte from the mask.
+      //***********************************************************************
+      static group_t next(group_t mask)
+      {
+        return group_t(mask & group_t(mask - 1U));
+      }
+    };
+
+    template <typename TGroup>
+    ETL_CONSTANT size_t control_group<TGroup>::Width;
+
+    template <typename TGroup>
+    ETL_CONSTANT uint8_t control_group<TGroup>::Empty;
+
+    template <typename TGroup>
+    ETL_CONSTANT uint8_t control_group<TGroup>::Deleted;
+
+    template <typename TGroup>
+    ETL_CONSTANT TGroup control_group<TGroup>::Lsbs;
+
+    template <typename TGroup>
+    ETL_CONSTANT TGroup control_group<TGroup>::Msbs;
+
+#if ETL_USING_64BIT_TYPES
+    typedef control_group<uint64_t> control_t;
+#else
+    typedef control_group<uint32_t> control_t;
+#endif
+
+    //*************************************************************************
+    /// The number of groups needed for a maximum load of 7/8.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct group_count
+    {
+      static ETL_CONSTANT size_t Min_Slots  = Max_Size + (Max_Size / 7U) + 1U;
+      static ETL_CONSTANT size_t Min_Groups = (Min_Slots + control_t::Width - 1U) / control_t::Width;
+      static ETL_CONSTANT size_t value      = (Min_Groups <= 1U) ? 1U : size_t(etl::power_of_2_round_up<Min_Groups>::value);
+    };
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t group_count<Max_Size>::Min_Slots;
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t group_count<Max_Size>::Min_Groups;
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t group_count<Max_Size>::value;
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_unordered_map.
+  /// Can be used as a reference type for all flat_unordered_map containing a specific type.
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class iflat_unordered_map
+  {
+  public:
+
+    typedef ETL_OR_STD::pair<const TKey, T> value_type;
+
+    typedef TKey              key_type;
+    typedef T                 mapped_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    /// Defines the parameter types
+    typedef const key_type&    const_key_reference;
+#if ETL_USING_CPP11
+    typedef key_type&&         rvalue_key_reference;
+#endif
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+  protected:
+
+    typedef private_flat_unordered_map::control_t control_t;
+    typedef typename control_t::group_t           group_t;
+
+  public:
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iflat_unordered_map;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pmap(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pmap(other.pmap)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = pmap->next_full(index + 1U);
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pmap  = other.pmap;
+        index = other.index;
+
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.pmap == rhs.pmap) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(iflat_unordered_map* pmap_, size_t index_)
+        : pmap(pmap_)
+        , index(index_)
+      {
+      }
+
+      iflat_unordered_map* pmap;
+      size_t               index;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iflat_unordered_map;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pmap(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename iflat_unordered_map::iterator& other)
+        : pmap(other.pmap)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pmap(other.pmap)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = pmap->next_full(index + 1U);
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pmap  = other.pmap;
+        index = other.index;
+
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pmap->pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pmap->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.pmap == rhs.pmap) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const iflat_unordered_map* pmap_, size_t index_)
+        : pmap(pmap_)
+        , index(index_)
+      {
+      }
+
+      const iflat_unordered_map* pmap;
+      size_t                     index;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the flat_unordered_map.
+    ///\return An iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the flat_unordered_map.
+    ///\return A const iterator to the beginning of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the flat_unordered_map.
+    ///\return An iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(this, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the flat_unordered_map.
+    ///\return A const iterator to the end of the flat_unordered_map.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, number_of_slots);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](rvalue_key_reference key)
+    {
+      const size_t hash  = hash_of(key);
+      size_t       index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(key), mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference operator [](const_key_reference key)
+    {
+      const size_t hash  = hash_of(key);
+      size_t       index = find_index(key, hash);
+
+      if (index == number_of_slots)
+      {
+        index = prepare_insert(hash);
+        ::new ((void*)etl::addressof(pslots[index])) value_type(key, mapped_type());
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::flat_unordered_map_out_of_range if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      ETL_ASSERT(index != number_of_slots, ETL_ERROR(flat_unordered_map_out_of_range));
+
+      return pslots[index].second;
+    }
+
+    //*********************************************************************
+    /// Assigns values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_unordered_map_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(flat_unordered_map_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key_value_pair)
+    {
+      const size_t hash  = hash_of(key_value_pair.first);
+      size_t       index = find_index(key_value_pair.first, hash);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_unordered_map_full), ETL_OR_STD::make_pair(end(), false));
+
+      index = prepare_insert(hash);
+      ::new ((void*)etl::addressof(pslots[index])) value_type(key_value_pair);
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key_value_pair)
+    {
+      const size_t hash  = hash_of(key_value_pair.first);
+      size_t       index = find_index(key_value_pair.first, hash);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(flat_unordered_map_full), ETL_OR_STD::make_pair(end(), false));
+
+      index = prepare_insert(hash);
+      ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(key_value_pair));
+      ETL_INCREMENT_DEBUG_COUNT;
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key_value_pair)
+    {
+      return insert(key_value_pair).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key_value_pair)
+    {
+      return insert(etl::move(key_value_pair)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_unordered_map.
+    /// If asserts or exceptions are enabled, emits flat_unordered_map_full if the flat_unordered_map does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(const_key_reference key)
+    {
+      const size_t index = find_index(key, hash_of(key));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Erasing never moves other elements, so iterators to them remain valid.
+    ///\param ielement Iterator to the element.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      erase_slot(ielement.index);
+
+      return iterator(this, next_full(ielement.index + 1U));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      size_t index = first_.index;
+
+      while (index != last_.index)
+      {
+        erase_slot(index);
+        index = next_full(index + 1U);
+      }
+
+      return iterator(this, last_.index);
+    }
+
+    //*************************************************************************
+    /// Clears the flat_unordered_map.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key, hash_of(key)) == number_of_slots) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return iterator(this, find_index(key, hash_of(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_iterator(this, find_index(key, hash_of(key)));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the flat_unordered_map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_unordered_map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the flat_unordered_map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the flat_unordered_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of slots.
+    ///\return The number of slots.
+    //*************************************************************************
+    size_type slot_count() const
+    {
+      return number_of_slots;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / slot_count.
+    ///\return The load factor = size / slot_count.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(slot_count());
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_unordered_map& operator = (const iflat_unordered_map& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    iflat_unordered_map& operator = (iflat_unordered_map&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_unordered_map(uint8_t* pcontrol_, value_type* pslots_, size_t number_of_groups_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pcontrol(pcontrol_)
+      , pslots(pslots_)
+      , number_of_groups(number_of_groups_)
+      , number_of_slots(number_of_groups_ * control_t::Width)
+      , maximum_size(maximum_size_)
+      , growth_limit(number_of_slots - (number_of_slots / 8U))
+      , current_size(0U)
+      , number_of_deleted(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      etl::fill_n(pcontrol, number_of_slots, control_t::Empty);
+    }
+
+    //*********************************************************************
+    /// Initialise the flat_unordered_map.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = next_full(0U); i != number_of_slots; i = next_full(i + 1U))
+        {
+          pslots[i].~value_type();
+          ETL_DECREMENT_DEBUG_COUNT;
+        }
+      }
+
+      etl::fill_n(pcontrol, number_of_slots, control_t::Empty);
+      current_size      = 0U;
+      number_of_deleted = 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        iterator temp = first;
+        ++temp;
+        insert(etl::move(*first));
+        first = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// Hashes the key, mixing the bits so that the group and control byte
+    /// are both well distributed, even for identity hashes.
+    //*********************************************************************
+    size_t hash_of(const_key_reference key) const
+    {
+#if ETL_USING_64BIT_TYPES
+      const size_t multiplier = static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+#else
+      const size_t multiplier = static_cast<size_t>(0x9E3779B9UL);
+#endif
+
+      size_t hash = size_t(key_hash_function(key)) * multiplier;
+
+      return hash ^ (hash >> (etl::integral_limits<size_t>::bits / 2U));
+    }
+
+    //*********************************************************************
+    /// The control byte for a hash.
+    //*********************************************************************
+    static uint8_t h2_of(size_t hash)
+    {
+      return uint8_t(hash & 0x7FU);
+    }
+
+    //*********************************************************************
+    /// The first group to probe for a hash.
+    //*********************************************************************
+    size_t first_group_of(size_t hash) const
+    {
+      return (hash >> 7U) & (number_of_groups - 1U);
+    }
+
+    //*********************************************************************
+    /// Finds the slot containing the key.
+    /// Groups are probed in triangular order, which visits all of them when the
+    /// number of groups is a power of 2. The search ends at a group with an empty slot.
+    ///\return The index of the slot, or number_of_slots if not found.
+    //*********************************************************************
+    size_t find_index(const_key_reference key, size_t hash) const
+    {
+      const uint8_t h2    = h2_of(hash);
+      size_t        group = first_group_of(hash);
+
+      for (size_t probe = 0U; probe < number_of_groups; ++probe)
+      {
+        const size_t  first_slot = group * control_t::Width;
+        const group_t controls   = control_t::load(pcontrol + first_slot);
+
+        group_t matches = control_t::match(controls, h2);
+
+        while (matches != 0U)
+        {
+          const size_t index = first_slot + control_t::lowest(matches);
+
+          if (key_equal_function(pslots[index].first, key))
+          {
+            return index;
+          }
+
+          matches = control_t::next(matches);
+        }
+
+        if (control_t::match_empty(controls) != 0U)
+        {
+          break;
+        }
+
+        group = (group + probe + 1U) & (number_of_groups - 1U);
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Finds the first empty or deleted slot for the hash.
+    //*********************************************************************
+    size_t find_free_index(size_t hash) const
+    {
+      size_t group = first_group_of(hash);
+
+      for (size_t probe = 0U; probe < number_of_groups; ++probe)
+      {
+        const size_t  first_slot = group * control_t::Width;
+        const group_t free       = control_t::match_empty_or_deleted(control_t::load(pcontrol + first_slot));
+
+        if (free != 0U)
+        {
+          return first_slot + control_t::lowest(free);
+        }
+
+        group = (group + probe + 1U) & (number_of_groups - 1U);
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Claims a free slot for a new element with the hash.
+    /// The caller constructs the element in the returned slot.
+    //*********************************************************************
+    size_t prepare_insert(size_t hash)
+    {
+      // Too many tombstones make unsuccessful searches long, so clear them out.
+      if ((number_of_deleted != 0U) && ((current_size + number_of_deleted) >= growth_limit))
+      {
+        drop_deleted();
+      }
+
+      const size_t index = find_free_index(hash);
+
+      if (pcontrol[index] == control_t::Deleted)
+      {
+        --number_of_deleted;
+      }
+
+      pcontrol[index] = h2_of(hash);
+      ++current_size;
+
+      return index;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in a slot.
+    /// If the group has an empty slot then probes already stop here, so the
+    /// slot can be marked as empty, otherwise it must be a tombstone.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      pslots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      const size_t first_slot = index - (index % control_t::Width);
+
+      if (control_t::match_empty(control_t::load(pcontrol + first_slot)) != 0U)
+      {
+        pcontrol[index] = control_t::Empty;
+      }
+      else
+      {
+        pcontrol[index] = control_t::Deleted;
+        ++number_of_deleted;
+      }
+
+      --current_size;
+    }
+
+    //*********************************************************************
+    /// Rehashes the elements in place, removing all tombstones.
+    //*********************************************************************
+    void drop_deleted()
+    {
+      // Mark deleted slots as empty and full slots as needing a rehash.
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        pcontrol[i] = (pcontrol[i] == control_t::Deleted) ? control_t::Empty
+                                                           : (((pcontrol[i] & 0x80U) == 0U) ? control_t::Deleted : pcontrol[i]);
+      }
+
+      for (size_t i = 0U; i < number_of_slots; ++i)
+      {
+        if (pcontrol[i] != control_t::Deleted)
+        {
+          continue;
+        }
+
+        const size_t hash   = hash_of(pslots[i].first);
+        const size_t target = find_free_index(hash);
+
+        if ((target / control_t::Width) == (i / control_t::Width))
+        {
+          // Already in the right group.
+          pcontrol[i] = h2_of(hash);
+        }
+        else if (pcontrol[target] == control_t::Empty)
+        {
+          // Move to the empty slot.
+          relocate(pslots + target, pslots + i);
+          pcontrol[target] = h2_of(hash);
+          pcontrol[i]      = control_t::Empty;
+        }
+        else
+        {
+          // Swap with the element that still needs a rehash, then process that one.
+          swap_slots(pslots + target, pslots + i);
+          pcontrol[target] = h2_of(hash);
+          --i;
+        }
+      }
+
+      number_of_deleted = 0U;
+    }
+
+    //*********************************************************************
+    /// Moves the element from one slot to an unused slot.
+    //*********************************************************************
+    static void relocate(value_type* pdestination, value_type* psource)
+    {
+#if ETL_USING_CPP11
+      ::new ((void*)pdestination) value_type(etl::move(*psource));
+#else
+      ::new ((void*)pdestination) value_type(*psource);
+#endif
+      psource->~value_type();
+    }
+
+    //*********************************************************************
+    /// Swaps the elements in two slots.
+    //*********************************************************************
+    static void swap_slots(value_type* pa, value_type* pb)
+    {
+#if ETL_USING_CPP11
+      value_type temp(etl::move(*pa));
+#else
+      value_type temp(*pa);
+#endif
+      pa->~value_type();
+      relocate(pa, pb);
+#if ETL_USING_CPP11
+      ::new ((void*)pb) value_type(etl::move(temp));
+#else
+      ::new ((void*)pb) value_type(temp);
+#endif
+    }
+
+    //*********************************************************************
+    /// Finds the next full slot, a group at a time.
+    ///\return The index of the slot, or number_of_slots if there are no more.
+    //*********************************************************************
+    size_t next_full(size_t index) const
+    {
+      while (index < number_of_slots)
+      {
+        const size_t offset     = index % control_t::Width;
+        const size_t first_slot = index - offset;
+
+        group_t full = control_t::match_full(control_t::load(pcontrol + first_slot));
+        full = group_t(full & group_t(group_t(~group_t(0U)) << (8U * offset)));
+
+        if (full != 0U)
+        {
+          return first_slot + control_t::lowest(full);
+        }
+
+        index = first_slot + control_t::Width;
+      }
+
+      return number_of_slots;
+    }
+
+    // Disable copy construction.
+    iflat_unordered_map(const iflat_unordered_map&);
+
+    /// The control bytes.
+    uint8_t* pcontrol;
+
+    /// The slots.
+    value_type* pslots;
+
+    /// The number of groups of slots.
+    const size_t number_of_groups;
+
+    /// The number of slots.
+    const size_t number_of_slots;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The number of used and deleted slots that triggers removal of tombstones.
+    const size_t growth_limit;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The number of tombstones.
+    size_t number_of_deleted;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_UNORDERED_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_unordered_map()
+    {
+    }
+#else
+  protected:
+    ~iflat_unordered_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>::const_iterator itr = lhs.begin();
+
+    while (itr != lhs.end())
+    {
+      typename etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>::const_iterator other = rhs.find(itr->first);
+
+      if ((other == rhs.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_unordered_map.
+  ///\param rhs Reference to the second flat_unordered_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_map
+  //***************************************************************************
+  template <typename TKey, typename T, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>& lhs, const etl::iflat_unordered_map<TKey, T, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_unordered_map implementation that uses a fixed size buffer.
+  //*************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class flat_unordered_map : public etl::iflat_unordered_map<TKey, TValue, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_unordered_map<TKey, TValue, THash, TKeyEqual> base;
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_GROUPS = private_flat_unordered_map::group_count<MAX_SIZE_>::value;
+    static ETL_CONSTANT size_t MAX_SLOTS  = MAX_GROUPS * private_flat_unordered_map::control_t::Width;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_unordered_map(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, slots.begin(), MAX_GROUPS, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_unordered_map(const flat_unordered_map& other)
+      : base(control, slots.begin(), MAX_GROUPS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    flat_unordered_map(flat_unordered_map&& other)
+      : base(control, slots.begin(), MAX_GROUPS, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_unordered_map(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, slots.begin(), MAX_GROUPS, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    flat_unordered_map(std::initializer_list<ETL_OR_STD::pair<TKey, TValue>> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(control, slots.begin(), MAX_GROUPS, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_unordered_map()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_unordered_map& operator = (const flat_unordered_map& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    flat_unordered_map& operator = (flat_unordered_map&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The control bytes.
+    uint8_t control[MAX_SLOTS];
+
+    /// The slots.
+    etl::uninitialized_buffer_of<typename base::value_type, MAX_SLOTS> slots;
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_unordered_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_unordered_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_GROUPS;
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t flat_unordered_map<TKey, TValue, MAX_SIZE_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename... TPairs>
+  flat_unordered_map(TPairs...) -> flat_unordered_map<typename etl::nth_type_t<0, TPairs...>::first_type,
+                                                      typename etl::nth_type_t<0, TPairs...>::second_type,
+                                                      sizeof...(TPairs)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename T, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... TPairs>
+  constexpr auto make_flat_unordered_map(TPairs&&... pairs) -> etl::flat_unordered_map<TKey, T, sizeof...(TPairs), THash, TKeyEqual>
+  {
+    return { {etl::forward<TPairs>(pairs)...} };
+  }
+#endif
+}
+
+#endif
@@ -0,0 +1,766 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+#include "platform.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "nth_type.h"
+#include "integral_limits.h"
+#include "string.h"
+#include "string_view.h"
+#include "format_spec.h"
+#include "to_string.h"
+
+#include <stdint.h>
+
+///\defgroup format format
+/// Formats values into a string using a format string that is parsed at compile time.
+/// The format string grammar is a subset of std::format.
+///   "{}"                : The next argument, default format.
+///   "{1}"               : Argument 1, default format.
+///   "{:[[fill]align][#][0][width][.precision][type]}"
+///   align               : '<' left, '>' right.
+///   '#'                 : Show the base prefix.
+///   '0'                 : Pad with '0' when no alignment is given.
+///   type                : 'd', 'x', 'X', 'o', 'b', 'B' for integrals, 'f' for floating point,
+///                         's' for strings and bool, 'c' for char, 'p' for pointers.
+///   "{{" and "}}"       : Literal braces.
+/// Floating point values without a precision use the shortest round trip form.
+/// As with etl::to_string, the fill goes before any sign or prefix.
+///\ingroup string
+
+#if ETL_USING_CPP17
+
+namespace etl
+{
+  //***************************************************************************
+  /// The value of etl::format_max_size when the output length has no upper bound.
+  ///\ingroup format
+  //***************************************************************************
+  inline constexpr size_t format_unbounded = etl::integral_limits<size_t>::max;
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Called when the format string is malformed.
+    /// Not constexpr, so that the error is reported at compile time.
+    //*************************************************************************
+    inline void format_string_error(const char* /*reason*/)
+    {
+    }
+
+    //*************************************************************************
+    /// A literal run of text, or a replacement field.
+    //*************************************************************************
+    struct segment
+    {
+      size_t   offset        = 0U;
+      size_t   length        = 0U;
+      bool     is_field      = false;
+      size_t   argument      = 0U;
+      char     fill          = ' ';
+      char     align         = 0;
+      bool     show_base     = false;
+      bool     zero_pad      = false;
+      uint32_t width         = 0U;
+      bool     has_precision = false;
+      uint32_t precision     = 0U;
+      char     type          = 0;
+    };
+
+    //*************************************************************************
+    constexpr bool is_digit(char c)
+    {
+      return (c >= '0') && (c <= '9');
+    }
+
+    //*************************************************************************
+    constexpr uint32_t parse_number(etl::string_view text, size_t& i)
+    {
+      uint32_t value = 0U;
+
+      while ((i < text.size()) && is_digit(text[i]))
+      {
+        value = (value * 10U) + static_cast<uint32_t>(text[i] - '0');
+        ++i;
+
+        if (value > 255U)
+        {
+          format_string_error("Number too large in the format string");
+        }
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Parses the format spec after the ':' of a field.
+    //*************************************************************************
+    constexpr void parse_spec(etl::string_view text, size_t& i, segment& seg)
+    {
+      const size_t size = text.size();
+
+      // Fill and align.
+      if (((i + 1U) < size) && ((text[i + 1U] == '<') || (text[i + 1U] == '>') || (text[i + 1U] == '^')) && (text[i] != '}'))
+      {
+        seg.fill  = text[i];
+        seg.align = text[i + 1U];
+        i += 2U;
+      }
+      else if ((i < size) && ((text[i] == '<') || (text[i] == '>') || (text[i] == '^')))
+      {
+        seg.align = text[i];
+        ++i;
+      }
+
+      if (seg.align == '^')
+      {
+        format_string_error("Centre alignment is not supported");
+      }
+
+      if ((i < size) && ((text[i] == '+') || (text[i] == '-') || (text[i] == ' ')))
+      {
+        format_string_error("Sign options are not supported");
+      }
+
+      if ((i < size) && (text[i] == '#'))
+      {
+        seg.show_base = true;
+        ++i;
+      }
+
+      if ((i < size) && (text[i] == '0'))
+      {
+        seg.zero_pad = true;
+        ++i;
+      }
+
+      seg.width = parse_number(text, i);
+
+      if ((i < size) && (text[i] == '.'))
+      {
+        ++i;
+
+        if ((i >= size) || !is_digit(text[i]))
+        {
+          format_string_error("Missing precision in the format string");
+        }
+
+        seg.has_precision = true;
+        seg.precision     = parse_number(text, i);
+      }
+
+      if ((i < size) && (text[i] != '}'))
+      {
+        seg.type = text[i];
+        ++i;
+      }
+    }
+
+    //*************************************************************************
+    /// Parses the format string into segments.
+    /// Pass a null pointer to just count the segments.
+    ///\return The number of segments.
+    //*************************************************************************
+    constexpr size_t parse(etl::string_view text, segment* segments)
+    {
+      const size_t size = text.size();
+
+      size_t count         = 0U;
+      size_t i             = 0U;
+      size_t next_argument = 0U;
+      bool   is_automatic  = false;
+      bool   is_manual     = false;
+
+      while (i < size)
+      {
+        segment seg;
+
+        if (((text[i] == '{') || (text[i] == '}')) && ((i + 1U) < size) && (text[i + 1U] == text[i]))
+        {
+          // An escaped brace.
+          seg.offset = i;
+          seg.length = 1U;
+          i += 2U;
+        }
+        else if (text[i] == '}')
+        {
+          format_string_error("Unmatched '}' in the format string");
+          ++i;
+        }
+        else if (text[i] == '{')
+        {
+          ++i;
+          seg.is_field = true;
+
+          if ((i < size) && is_digit(text[i]))
+          {
+            seg.argument = parse_number(text, i);
+            is_manual    = true;
+          }
+          else
+          {
+            seg.argument = next_argument++;
+            is_automatic = true;
+          }
+
+          if (is_manual && is_automatic)
+          {
+            format_string_error("Cannot mix automatic and manual argument indexes");
+          }
+
+          if ((i < size) && (text[i] == ':'))
+          {
+            ++i;
+            parse_spec(text, i, seg);
+          }
+
+          if ((i >= size) || (text[i] != '}'))
+          {
+            format_string_error("Missing '}' in the format string");
+          }
+
+          ++i;
+        }
+        else
+        {
+          // A run of literal text.
+          seg.offset = i;
+
+          while ((i < size) && (text[i] != '{') && (text[i] != '}'))
+          {
+            ++i;
+          }
+
+          seg.length = i - seg.offset;
+        }
+
+        if (segments != ETL_NULLPTR)
+        {
+          segments[count] = seg;
+        }
+
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// The parsed form of a format string.
+    /// TSource supplies the text from a static constexpr view() function.
+    //*************************************************************************
+    template <typename TSource>
+    struct parsed_format
+    {
+      static constexpr etl::string_view text = TSource::view();
+      static constexpr size_t           size = parse(text, ETL_NULLPTR);
+
+      struct storage
+      {
+        segment items[(size == 0U) ? 1U : size];
+      };
+
+      static constexpr storage make()
+      {
+        storage s{};
+        parse(text, s.items);
+
+        return s;
+      }
+
+      static constexpr storage segments = make();
+    };
+
+    //*************************************************************************
+    /// Argument categories.
+    //*************************************************************************
+    template <typename T>
+    struct is_character_string : etl::bool_constant<etl::is_same<T, const char*>::value ||
+                                                    etl::is_same<T, char*>::value ||
+                                                    etl::is_same<T, etl::string_view>::value ||
+                                                    etl::is_base_of<etl::istring, T>::value>
+    {
+    };
+
+    template <typename T>
+    struct is_bounded_string : etl::false_type
+    {
+    };
+
+    template <size_t Size>
+    struct is_bounded_string<etl::string<Size> > : etl::true_type
+    {
+    };
+
+    template <typename T>
+    struct is_formatted_integral : etl::bool_constant<etl::is_integral<T>::value &&
+                                                      !etl::is_same<T, bool>::value &&
+                                                      !etl::is_same<T, char>::value>
+    {
+    };
+
+    //*************************************************************************
+    /// Checks that the presentation type suits the argument.
+    //*************************************************************************
+    template <typename T>
+    constexpr bool is_valid_type(const segment& seg)
+    {
+      const char t = seg.type;
+
+      if constexpr (etl::is_same<T, bool>::value)
+      {
+        return (t == 0) || (t == 's');
+      }
+      else if constexpr (etl::is_same<T, char>::value)
+      {
+        return (t == 0) || (t == 'c');
+      }
+      else if constexpr (is_formatted_integral<T>::value)
+      {
+        return (t == 0) || (t == 'd') || (t == 'x') || (t == 'X') || (t == 'o') || (t == 'b') || (t == 'B');
+      }
+      else if constexpr (etl::is_floating_point<T>::value)
+      {
+        return (t == 0) || (t == 'f');
+      }
+      else if constexpr (is_character_string<T>::value)
+      {
+        return (t == 0) || (t == 's');
+      }
+      else if constexpr (etl::is_pointer<T>::value)
+      {
+        return (t == 0) || (t == 'p');
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Creates the format spec for a field.
+    //*************************************************************************
+    template <typename T>
+    constexpr etl::format_spec make_spec(const segment& seg)
+    {
+      etl::format_spec spec;
+
+      // Numbers go right by default, text goes left.
+      const bool is_text = etl::is_same<T, bool>::value || etl::is_same<T, char>::value || is_character_string<T>::value;
+
+      spec.width(seg.width).fill(seg.fill).show_base(seg.show_base).boolalpha(true);
+
+      if (seg.align == '<')
+      {
+        spec.left();
+      }
+      else if (seg.align == '>')
+      {
+        spec.right();
+      }
+      else if (seg.zero_pad)
+      {
+        spec.right().fill('0');
+      }
+      else if (is_text)
+      {
+        spec.left();
+      }
+      else
+      {
+        spec.right();
+      }
+
+      switch (seg.type)
+      {
+        case 'x': spec.hex();                  break;
+        case 'X': spec.hex().upper_case(true);    break;
+        case 'o': spec.octal();                break;
+        case 'b': spec.binary();               break;
+        case 'B': spec.binary().upper_case(true); break;
+        default:                               break;
+      }
+
+      if constexpr (etl::is_floating_point<T>::value)
+      {
+        if (seg.has_precision)
+        {
+          spec.precision(seg.precision);
+        }
+        else
+        {
+          spec.shortest(true);
+        }
+      }
+
+      if constexpr (etl::is_pointer<T>::value && !is_character_string<T>::value)
+      {
+        spec.hex().show_base(true);
+      }
+
+      return spec;
+    }
+
+    //*************************************************************************
+    /// The longest text a field can produce.
+    //*************************************************************************
+    template <typename T>
+    constexpr size_t field_max_size(const segment& seg)
+    {
+      size_t length = 0U;
+
+      if constexpr (etl::is_same<T, bool>::value)
+      {
+        length = 5U;
+      }
+      else if constexpr (etl::is_same<T, char>::value)
+      {
+        length = 1U;
+      }
+      else if constexpr (is_formatted_integral<T>::value)
+      {
+        const size_t bits = etl::integral_limits<T>::bits;
+
+        switch (seg.type)
+        {
+          case 'b': case 'B': length = bits;                                      break;
+          case 'o':           length = (bits + 2U) / 3U;                          break;
+          case 'x': case 'X': length = (bits + 3U) / 4U;                          break;
+          default:            length = size_t(etl::numeric_limits<T>::digits10) + 1U; break;
+        }
+
+        length += (etl::is_signed<T>::value ? 1U : 0U) + (seg.show_base ? 2U : 0U);
+      }
+      else if constexpr (etl::is_floating_point<T>::value)
+      {
+        // Sign, up to a 64 bit integral part, point and precision; or the shortest form.
+        length = seg.has_precision ? (1U + 20U + 1U + seg.precision) : 24U;
+      }
+      else if constexpr (is_bounded_string<T>::value)
+      {
+        length = T::MAX_SIZE;
+      }
+      else if constexpr (is_character_string<T>::value)
+      {
+        return etl::format_unbounded;
+      }
+      else if constexpr (etl::is_pointer<T>::value)
+      {
+        length = 2U + (sizeof(uintptr_t) * 2U);
+      }
+
+      return (length > seg.width) ? length : size_t(seg.width);
+    }
+
+    //*************************************************************************
+    /// Finds the maximum field size for the argument selected by the segment.
+    //*************************************************************************
+    template <typename T, typename... TRest>
+    constexpr size_t argument_max_size(const segment& seg, size_t argument)
+    {
+      if (argument == 0U)
+      {
+        return field_max_size<etl::decay_t<T> >(seg);
+      }
+      else if constexpr (sizeof...(TRest) != 0U)
+      {
+        return argument_max_size<TRest...>(seg, argument - 1U);
+      }
+      else
+      {
+        return etl::format_unbounded;
+      }
+    }
+
+    //*************************************************************************
+    template <typename TSource, typename... TArgs>
+    constexpr size_t max_size()
+    {
+      typedef parsed_format<TSource> parsed;
+
+      size_t total = 0U;
+
+      for (size_t i = 0U; i < parsed::size; ++i)
+      {
+        const segment& seg = parsed::segments.items[i];
+
+        size_t length = seg.length;
+
+        if (seg.is_field)
+        {
+          if constexpr (sizeof...(TArgs) != 0U)
+          {
+            length = argument_max_size<TArgs...>(seg, seg.argument);
+          }
+          else
+          {
+            length = etl::format_unbounded;
+          }
+        }
+
+        if ((length == etl::format_unbounded) || (total > (etl::format_unbounded - length)))
+        {
+          return etl::format_unbounded;
+        }
+
+        total += length;
+      }
+
+      return total;
+    }
+
+    //*************************************************************************
+    /// Gets argument Index from the pack.
+    //*************************************************************************
+    template <size_t Index, typename T, typename... TRest>
+    constexpr const auto& get_argument(const T& first, const TRest&... rest)
+    {
+      if constexpr (Index == 0U)
+      {
+        return first;
+      }
+      else
+      {
+        return get_argument<Index - 1U>(rest...);
+      }
+    }
+
+    //*************************************************************************
+    /// Appends one formatted argument.
+    //*************************************************************************
+    template <typename T>
+    void format_argument(etl::istring& str, const etl::format_spec& spec, const T& value)
+    {
+      if constexpr (etl::is_same<T, bool>::value)
+      {
+        etl::private_to_string::add_boolean(value, str, spec, true);
+      }
+      else if constexpr (etl::is_same<T, char>::value)
+      {
+        etl::istring::iterator start = str.end();
+        str.push_back(value);
+        etl::private_to_string::add_alignment(str, start, spec);
+      }
+      else if constexpr (etl::is_integral<T>::value || etl::is_floating_point<T>::value)
+      {
+        etl::private_to_string::to_string(value, str, spec, true);
+      }
+      else if constexpr (etl::is_base_of<etl::istring, T>::value)
+      {
+        etl::private_to_string::add_string(static_cast<const etl::istring&>(value), str, spec, true);
+      }
+      else if constexpr (is_character_string<etl::decay_t<T> >::value)
+      {
+        etl::private_to_string::add_string_view(etl::string_view(value), str, spec, true);
+      }
+      else
+      {
+        etl::private_to_string::add_pointer(value, str, spec, true);
+      }
+    }
+
+    //*************************************************************************
+    /// Appends one segment: either literal text or a formatted argument.
+    //*************************************************************************
+    template <typename TSource, size_t Index, typename... TArgs>
+    void format_segment(etl::istring& str, const TArgs&... args)
+    {
+      typedef parsed_format<TSource> parsed;
+
+      constexpr segment seg = parsed::segments.items[Index];
+
+      if constexpr (!seg.is_field)
+      {
+        str.append(parsed::text.data() + seg.offset, seg.length);
+      }
+      else
+      {
+        static_assert(seg.argument < sizeof...(TArgs), "Format string refers to a missing argument");
+
+        if constexpr (seg.argument < sizeof...(TArgs))
+        {
+          typedef etl::decay_t<etl::nth_type_t<seg.argument, TArgs...> > argument_t;
+
+          static_assert(is_valid_type<argument_t>(seg), "Format type does not suit the argument");
+
+          constexpr etl::format_spec spec = make_spec<argument_t>(seg);
+
+          format_argument(str, spec, get_argument<seg.argument>(args...));
+        }
+      }
+    }
+
+    //*************************************************************************
+    template <typename TSource, size_t... Indices, typename... TArgs>
+    void format_segments(etl::istring& str, etl::index_sequence<Indices...>, const TArgs&... args)
+    {
+      (format_segment<TSource, Indices>(str, args...), ...);
+    }
+
+#if ETL_USING_CPP20
+    //*************************************************************************
+    /// Adapts a format_literal to the source interface.
+    //*************************************************************************
+    template <auto Literal>
+    struct literal_source
+    {
+      static constexpr etl::string_view view()
+      {
+        return Literal.view();
+      }
+    };
+#endif
+  }
+
+#if ETL_USING_CPP20
+  //***************************************************************************
+  /// A format string passed as a template parameter.
+  ///\ingroup format
+  //***************************************************************************
+  template <size_t Size>
+  struct format_literal
+  {
+    constexpr format_literal(const char (&text_)[Size])
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        text[i] = text_[i];
+      }
+    }
+
+    constexpr etl::string_view view() const
+    {
+      return etl::string_view(text, Size - 1U);
+    }
+
+    char text[Size] = {};
+  };
+#endif
+
+  //***************************************************************************
+  /// The upper bound on the length of the formatted text, or etl::format_unbounded.
+  /// Strings other than etl::string<N> have no bound.
+  /// etl::format_max_size<int, double>(ETL_FORMAT_STRING("{} {}"));
+  ///\ingroup format
+  //***************************************************************************
+  template <typename... TArgs, typename TSource>
+  constexpr size_t format_max_size(TSource)
+  {
+    return private_format::max_size<TSource, TArgs...>();
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to the string.
+  /// Create the source with ETL_FORMAT_STRING("...").
+  ///\ingroup format
+  //***************************************************************************
+  template <typename TSource, typename... TArgs>
+  etl::istring& format_to(etl::istring& str, TSource, const TArgs&... args)
+  {
+    typedef private_format::parsed_format<TSource> parsed;
+
+    private_format::format_segments<TSource>(str, etl::make_index_sequence<parsed::size>(), args...);
+
+    return str;
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to a fixed capacity string.
+  /// Fails to compile if the output could be longer than the capacity.
+  /// Pass the string as an etl::istring& to skip the check.
+  ///\ingroup format
+  //***************************************************************************
+  template <size_t Size, typename TSource, typename... TArgs>
+  etl::istring& format_to(etl::string<Size>& str, TSource source, const TArgs&... args)
+  {
+    constexpr size_t Max_Size = private_format::max_size<TSource, TArgs...>();
+
+    static_assert((Max_Size == etl::format_unbounded) || (Max_Size <= Size), "String is too small for the formatted output");
+
+    return etl::format_to(static_cast<etl::istring&>(str), source, args...);
+  }
+
+#if ETL_USING_CPP20
+  //***************************************************************************
+  /// The upper bound on the length of the formatted text, or etl::format_unbounded.
+  ///\ingroup format
+  //***************************************************************************
+  template <etl::format_literal Literal, typename... TArgs>
+  constexpr size_t format_max_size()
+  {
+    return private_format::max_size<private_format::literal_source<Literal>, TArgs...>();
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to the string.
+  /// etl::format_to<"{} {:08x}">(str, a, b);
+  ///\ingroup format
+  //***************************************************************************
+  template <etl::format_literal Literal, typename... TArgs>
+  etl::istring& format_to(etl::istring& str, const TArgs&... args)
+  {
+    return etl::format_to(str, private_format::literal_source<Literal>(), args...);
+  }
+
+  //***************************************************************************
+  /// Appends the formatted arguments to a fixed capacity string.
+  /// Fails to compile if the output could be longer than the capacity.
+  ///\ingroup format
+  //***************************************************************************
+  template <etl::format_literal Literal, size_t Size, typename... TArgs>
+  etl::istring& format_to(etl::string<Size>& str, const TArgs&... args)
+  {
+    return etl::format_to(str, private_format::literal_source<Literal>(), args...);
+  }
+#endif
+}
+
+//*****************************************************************************
+/// Creates a format string source for etl::format_to.
+/// The text must be a string literal.
+//*****************************************************************************
+#define ETL_FORMAT_STRING(text)                                     \
+  [] {                                                              \
+    struct etl_format_source                                        \
+    {                                                               \
+      static constexpr etl::string_view view()                      \
+      {                                                             \
+        return etl::string_view(text, sizeof(text) - 1U);           \
+      }                                                             \
+    };                                                              \
+    return etl_format_source();                                     \
+  }()
+
+#endif
+#endif
@@ -43,6 +43,7 @@ SOFTWARE.
 #include "nullptr.h"
 #include "type_traits.h"
 #include "memory.h"
+#include "memory_statistics.h"
 #include "iterator.h"
 #include "static_assert.h"
 #include "placement_new.h"
@@ -232,6 +233,26 @@ namespace etl
       return p_node_pool->available();
     }
 
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    /// Gets the node allocation statistics of this forward_list.
+    /// Nodes handed over by a move from a forward_list on the same pool count as a
+    /// release from the source and an allocation here.
+    //*************************************************************************
+    const etl::memory_statistics& get_memory_statistics() const
+    {
+      return node_statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the node allocation statistics of this forward_list.
+    //*************************************************************************
+    void reset_memory_statistics()
+    {
+      node_statistics.reset();
+    }
+#endif
+
     //*************************************************************************
     /// Reverses the forward_list.
     //*************************************************************************
@@ -353,6 +374,9 @@ namespace etl
     size_type   MAX_SIZE;       ///< The maximum size of the forward_list.
     bool        pool_is_shared; ///< If <b>true</b> then the pool is shared between lists.
     ETL_DECLARE_DEBUG_COUNT;     ///< Internal debugging.
+#if defined(ETL_MEMORY_STATISTICS)
+    etl::memory_statistics node_statistics; ///< The node allocation statistics.
+#endif
   };
 
   //***************************************************************************
@@ -419,6 +443,12 @@ namespace etl
       iterator& operator ++()
       {
         p_node = p_node->next;
+#if ETL_HAS_NODE_PREFETCH
+        if (p_node != ETL_NULLPTR)
+        {
+          ETL_PREFETCH(p_node->next);
+        }
+#endif
         return *this;
       }
 
@@ -502,6 +532,12 @@ namespace etl
       const_iterator& operator ++()
       {
         p_node = p_node->next;
+#if ETL_HAS_NODE_PREFETCH
+        if (p_node != ETL_NULLPTR)
+        {
+          ETL_PREFETCH(p_node->next);
+        }
+#endif
         return *this;
       }
 
@@ -1461,6 +1497,9 @@ namespace etl
         if (etl::is_trivially_destructible<T>::value && !has_shared_pool())
         {
           ETL_ASSERT(p_node_pool != ETL_NULLPTR, ETL_ERROR(forward_list_no_pool));
+#if defined(ETL_MEMORY_STATISTICS)
+          node_statistics.record_release(p_node_pool->size());
+#endif
           p_node_pool->release_all();
           ETL_RESET_DEBUG_COUNT;
         }
@@ -1473,6 +1512,7 @@ namespace etl
           while (p_first != ETL_NULLPTR)
           {
             p_next = p_first->next;                                 // Remember the next node.
+            ETL_NODE_PREFETCH(p_next);                              // Fetch it while destroying this one.
             destroy_data_node(static_cast<data_node_t&>(*p_first)); // Destroy the pool object.
             p_first = p_next;                                       // Move to the next node.
           }
@@ -1523,6 +1563,12 @@ namespace etl
           // Are we using the same pool?
           if (this->get_node_pool() == rhs.get_node_pool())
           {
+#if defined(ETL_MEMORY_STATISTICS)
+            const size_t n = rhs.size();
+            rhs.node_statistics.record_release(n);
+            node_statistics.record_allocation(n);
+#endif
+
             // Just link the nodes to this list.
             this->start_node.next = rhs.start_node.next;
 
@@ -1615,7 +1661,22 @@ namespace etl
     data_node_t* allocate_data_node()
     {
       data_node_t* (etl::ipool::*func)() = &etl::ipool::allocate<data_node_t>;
+#if defined(ETL_MEMORY_STATISTICS)
+      data_node_t* p_node = (p_node_pool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+        node_statistics.record_allocation();
+      }
+      else
+      {
+        node_statistics.record_failed_allocation();
+      }
+
+      return p_node;
+#else
       return (p_node_pool->*func)();
+#endif
     }
 
     //*************************************************************************
@@ -1626,6 +1687,9 @@ namespace etl
       node.value.~T();
       p_node_pool->release(&node);
       ETL_DECREMENT_DEBUG_COUNT;
+#if defined(ETL_MEMORY_STATISTICS)
+      node_statistics.record_release();
+#endif
     }
 
     // Disable copy construction.
@@ -86,6 +86,30 @@ namespace etl
 
       TFrame_Check_Sequence* p_fcs;
     };
+
+    //***************************************************
+    /// Detects whether a policy can add a contiguous block of bytes.
+    /// A policy declares support by defining the type 'supports_block_add' and
+    /// providing 'value_type add(value_type, const T* begin, const T* end) const'.
+    //***************************************************
+    template <typename TPolicy>
+    class has_block_add
+    {
+    private:
+
+      typedef char yes;
+      struct no { char dummy[2]; };
+
+      template <typename U> static yes test(typename U::supports_block_add*);
+      template <typename U> static no  test(...);
+
+    public:
+
+      static ETL_CONSTANT bool value = (sizeof(test<TPolicy>(0)) == sizeof(yes));
+    };
+
+    template <typename TPolicy>
+    ETL_CONSTANT bool has_block_add<TPolicy>::value;
   }
 
   //***************************************************************************
@@ -144,11 +168,10 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin);
-        ++begin;
-      }
+      // Contiguous ranges are passed as a block to policies that support it.
+      typedef etl::integral_constant<bool, private_frame_check_sequence::has_block_add<policy_type>::value && etl::is_pointer<TIterator>::value> use_block_add;
+
+      add_range(begin, end, use_block_add());
     }
 
     //*************************************************************************
@@ -185,6 +208,28 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin);
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range as a block.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      frame_check = policy.add(frame_check, begin, end);
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
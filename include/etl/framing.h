@@ -0,0 +1,1029 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FRAMING_INCLUDED
+#define ETL_FRAMING_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "byte_stream.h"
+#include "crc16_x25.h"
+#include "endianness.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "span.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
+
+///\defgroup framing framing
+/// Streaming COBS, SLIP and HDLC framing with an optional frame check sequence.
+/// The encoders escape the payload and add it to the frame check sequence in
+/// one pass, copying runs of bytes that need no escaping a word at a time.
+/// The decoders accept the input in chunks of any size and call a function
+/// for each complete frame whose frame check sequence matches.
+/// The frame check sequence follows the payload, in the order given by the
+/// endian template parameter.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for framing.
+  ///\ingroup framing
+  //***************************************************************************
+  class framing_exception : public etl::exception
+  {
+  public:
+
+    framing_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for an encoded frame that does not fit the output.
+  ///\ingroup framing
+  //***************************************************************************
+  class framing_overflow : public framing_exception
+  {
+  public:
+
+    framing_overflow(string_type file_name_, numeric_type line_number_)
+      : framing_exception(ETL_ERROR_TEXT("framing:overflow", ETL_FRAMING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A frame check sequence that adds nothing to the frame.
+  ///\ingroup framing
+  //***************************************************************************
+  struct framing_no_crc
+  {
+    typedef uint8_t value_type;
+
+    void reset()
+    {
+    }
+
+    void add(uint8_t)
+    {
+    }
+
+    template <typename TIterator>
+    void add(TIterator, TIterator)
+    {
+    }
+
+    value_type value() const
+    {
+      return 0U;
+    }
+  };
+
+  namespace private_framing
+  {
+    //*************************************************************************
+    /// The number of bytes of the frame check sequence.
+    //*************************************************************************
+    template <typename TCrc>
+    struct crc_size
+    {
+      static ETL_CONSTANT size_t value = sizeof(typename TCrc::value_type);
+    };
+
+    template <>
+    struct crc_size<etl::framing_no_crc>
+    {
+      static ETL_CONSTANT size_t value = 0U;
+    };
+
+    template <typename TCrc>
+    ETL_CONSTANT size_t crc_size<TCrc>::value;
+
+    //*************************************************************************
+    /// Converts a frame check sequence to bytes in the transmitted order.
+    //*************************************************************************
+    template <typename TCrc, int VEndian>
+    void crc_to_bytes(typename TCrc::value_type value, uint8_t* bytes)
+    {
+      const size_t n = crc_size<TCrc>::value;
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const size_t shift = (VEndian == etl::endian::little) ? (i * 8U) : ((n - 1U - i) * 8U);
+
+        bytes[i] = uint8_t((value >> shift) & 0xFFU);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first byte that is 'a' or 'b', or 'length' if
+    /// there is none. Whole words are checked with etl::has_byte_n.
+    //*************************************************************************
+    inline size_t find_either(const uint8_t* p, size_t length, uint8_t a, uint8_t b)
+    {
+      size_t i = 0U;
+
+      while ((i + sizeof(uint32_t)) <= length)
+      {
+        uint32_t word;
+        memcpy(&word, p + i, sizeof(uint32_t));
+
+        if (etl::has_byte_n(word, a) || etl::has_byte_n(word, b))
+        {
+          break;
+        }
+
+        i += sizeof(uint32_t);
+      }
+
+      while ((i < length) && (p[i] != a) && (p[i] != b))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first zero byte, or 'length' if there is none.
+    //*************************************************************************
+    inline size_t find_zero(const uint8_t* p, size_t length)
+    {
+      size_t i = 0U;
+
+      while ((i + sizeof(uint32_t)) <= length)
+      {
+        uint32_t word;
+        memcpy(&word, p + i, sizeof(uint32_t));
+
+        if (etl::has_zero_byte(word))
+        {
+          break;
+        }
+
+        i += sizeof(uint32_t);
+      }
+
+      while ((i < length) && (p[i] != 0U))
+      {
+        ++i;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// The output of an encoder.
+    //*************************************************************************
+    class frame_output
+    {
+    public:
+
+      frame_output(uint8_t* p_buffer_, size_t capacity_)
+        : p_buffer(p_buffer_)
+        , capacity(capacity_)
+        , length(0U)
+        , overflow(false)
+      {
+      }
+
+      void put(uint8_t value)
+      {
+        if (length < capacity)
+        {
+          p_buffer[length++] = value;
+        }
+        else
+        {
+          overflow = true;
+        }
+      }
+
+      void put(const uint8_t* p, size_t n)
+      {
+        if (n <= (capacity - length))
+        {
+          memcpy(p_buffer + length, p, n);
+          length += n;
+        }
+        else
+        {
+          overflow = true;
+        }
+      }
+
+      uint8_t* p_buffer;
+      size_t   capacity;
+      size_t   length;
+      bool     overflow;
+    };
+
+    //*************************************************************************
+    /// Collects a decoded frame and checks its frame check sequence.
+    /// The frame check sequence is calculated as each chunk arrives, leaving
+    /// out the last bytes that may turn out to be the received sequence.
+    //*************************************************************************
+    template <size_t VMax_Payload, typename TCrc, int VEndian>
+    class frame_assembler
+    {
+    public:
+
+      static ETL_CONSTANT size_t Crc_Size = crc_size<TCrc>::value;
+      static ETL_CONSTANT size_t Capacity = VMax_Payload + Crc_Size;
+
+      frame_assembler()
+        : length(0U)
+        , checked(0U)
+        , overflow(false)
+        , frame_count(0U)
+        , crc_error_count(0U)
+        , framing_error_count(0U)
+      {
+        crc.reset();
+      }
+
+      void append(const uint8_t* p, size_t n)
+      {
+        if (n > (Capacity - length))
+        {
+          overflow = true;
+        }
+        else if (!overflow && (n != 0U))
+        {
+          memcpy(buffer + length, p, n);
+          length += n;
+
+          if (length > (checked + Crc_Size))
+          {
+            crc.add(buffer + checked, buffer + (length - Crc_Size));
+            checked = length - Crc_Size;
+          }
+        }
+      }
+
+      void append(uint8_t value)
+      {
+        append(&value, 1U);
+      }
+
+      bool empty() const
+      {
+        return (length == 0U) && !overflow;
+      }
+
+      //*******************************
+      /// Ends the frame. Calls 'function' if it is valid.
+      /// Returns true if the function was called.
+      template <typename TFunction>
+      bool complete(TFunction& function)
+      {
+        bool valid = false;
+
+        if (overflow || (length < Crc_Size))
+        {
+          ++framing_error_count;
+        }
+        else
+        {
+          uint8_t expected[Crc_Size + 1U];
+          private_framing::crc_to_bytes<TCrc, VEndian>(crc.value(), expected);
+
+          if (memcmp(expected, buffer + (length - Crc_Size), Crc_Size) == 0)
+          {
+            valid = true;
+          }
+          else
+          {
+            ++crc_error_count;
+          }
+        }
+
+        if (valid)
+        {
+          ++frame_count;
+          function(etl::span<const uint8_t>(buffer, length - Crc_Size));
+        }
+
+        clear();
+
+        return valid;
+      }
+
+      //*******************************
+      /// Abandons the frame as a framing error.
+      void discard()
+      {
+        ++framing_error_count;
+        clear();
+      }
+
+      void clear()
+      {
+        length   = 0U;
+        checked  = 0U;
+        overflow = false;
+        crc.reset();
+      }
+
+      void reset()
+      {
+        clear();
+        frame_count         = 0U;
+        crc_error_count     = 0U;
+        framing_error_count = 0U;
+      }
+
+      uint8_t buffer[Capacity];
+      size_t  length;
+      size_t  checked;
+      bool    overflow;
+      TCrc    crc;
+      size_t  frame_count;
+      size_t  crc_error_count;
+      size_t  framing_error_count;
+    };
+
+    template <size_t VMax_Payload, typename TCrc, int VEndian>
+    ETL_CONSTANT size_t frame_assembler<VMax_Payload, TCrc, VEndian>::Crc_Size;
+
+    template <size_t VMax_Payload, typename TCrc, int VEndian>
+    ETL_CONSTANT size_t frame_assembler<VMax_Payload, TCrc, VEndian>::Capacity;
+
+    //*************************************************************************
+    /// SLIP, RFC 1055.
+    //*************************************************************************
+    struct slip_policy
+    {
+      static ETL_CONSTANT uint8_t Flag   = 0xC0U;
+      static ETL_CONSTANT uint8_t Escape = 0xDBU;
+
+      static uint8_t escape(uint8_t value)
+      {
+        return (value == Flag) ? uint8_t(0xDCU) : uint8_t(0xDDU);
+      }
+
+      // Anything else after an escape is a protocol violation, which RFC 1055 passes through.
+      static uint8_t unescape(uint8_t value)
+      {
+        return (value == 0xDCU) ? Flag : ((value == 0xDDU) ? Escape : value);
+      }
+    };
+
+    //*************************************************************************
+    /// HDLC asynchronous framing, RFC 1662, with no control characters escaped.
+    //*************************************************************************
+    struct hdlc_policy
+    {
+      static ETL_CONSTANT uint8_t Flag   = 0x7EU;
+      static ETL_CONSTANT uint8_t Escape = 0x7DU;
+
+      static uint8_t escape(uint8_t value)
+      {
+        return uint8_t(value ^ 0x20U);
+      }
+
+      static uint8_t unescape(uint8_t value)
+      {
+        return uint8_t(value ^ 0x20U);
+      }
+    };
+
+    //*************************************************************************
+    /// An encoder for byte stuffed frames.
+    //*************************************************************************
+    template <typename TPolicy, typename TCrc, int VEndian>
+    class stuffing_encoder
+    {
+    public:
+
+      static ETL_CONSTANT size_t Crc_Size = crc_size<TCrc>::value;
+
+      //*******************************
+      /// The largest frame that a payload of 'length' bytes encodes to.
+      static ETL_CONSTEXPR size_t max_encoded_size(size_t length)
+      {
+        return (2U * (length + Crc_Size)) + 2U;
+      }
+
+      //*******************************
+      /// Starts a frame in 'output'.
+      explicit stuffing_encoder(etl::span<uint8_t> output)
+        : out(output.data(), output.size())
+      {
+        crc.reset();
+        out.put(TPolicy::Flag);
+      }
+
+      //*******************************
+      /// Adds part of the payload.
+      void add(etl::span<const uint8_t> data)
+      {
+        stuff(data.data(), data.size(), true);
+      }
+
+      //*******************************
+      /// Adds the frame check sequence and the closing flag.
+      /// Returns the length of the frame.
+      /// If asserts or exceptions are enabled, emits etl::framing_overflow if the frame did not fit.
+      size_t finish()
+      {
+        uint8_t fcs[Crc_Size + 1U];
+        private_framing::crc_to_bytes<TCrc, VEndian>(crc.value(), fcs);
+
+        stuff(fcs, Crc_Size, false);
+        out.put(TPolicy::Flag);
+
+        ETL_ASSERT_OR_RETURN_VALUE(!out.overflow, ETL_ERROR(framing_overflow), 0U);
+
+        return out.length;
+      }
+
+      //*******************************
+      /// The number of bytes written so far.
+      size_t size() const
+      {
+        return out.length;
+      }
+
+      //*******************************
+      /// Encodes a whole frame.
+      /// Returns the length of the frame.
+      /// If asserts or exceptions are enabled, emits etl::framing_overflow if the frame did not fit.
+      static size_t encode(etl::span<const uint8_t> payload, etl::span<uint8_t> output)
+      {
+        stuffing_encoder encoder(output);
+        encoder.add(payload);
+
+        return encoder.finish();
+      }
+
+      //*******************************
+      /// Encodes a whole frame to the free space of a byte stream.
+      /// Returns the length of the frame.
+      static size_t encode(etl::span<const uint8_t> payload, etl::byte_stream_writer& writer)
+      {
+        etl::span<char> free = writer.free_data();
+
+        const size_t length = encode(payload, etl::span<uint8_t>(reinterpret_cast<uint8_t*>(free.data()), free.size()));
+        writer.skip<char>(length);
+
+        return length;
+      }
+
+    private:
+
+      void stuff(const uint8_t* p, size_t n, bool add_to_crc)
+      {
+        while (n != 0U)
+        {
+          const size_t run = private_framing::find_either(p, n, TPolicy::Flag, TPolicy::Escape);
+
+          out.put(p, run);
+
+          if (add_to_crc)
+          {
+            crc.add(p, p + run);
+          }
+
+          if (run == n)
+          {
+            break;
+          }
+
+          const uint8_t value = p[run];
+
+          if (add_to_crc)
+          {
+            crc.add(value);
+          }
+
+          out.put(TPolicy::Escape);
+          out.put(TPolicy::escape(value));
+
+          p += run + 1U;
+          n -= run + 1U;
+        }
+      }
+
+      frame_output out;
+      TCrc         crc;
+    };
+
+    template <typename TPolicy, typename TCrc, int VEndian>
+    ETL_CONSTANT size_t stuffing_encoder<TPolicy, TCrc, VEndian>::Crc_Size;
+
+    //*************************************************************************
+    /// A streaming decoder for byte stuffed frames.
+    //*************************************************************************
+    template <typename TPolicy, size_t VMax_Payload, typename TCrc, int VEndian>
+    class stuffing_decoder
+    {
+    public:
+
+      static ETL_CONSTANT size_t Max_Payload = VMax_Payload;
+
+      stuffing_decoder()
+        : escaped(false)
+      {
+      }
+
+      //*******************************
+      /// Decodes a chunk of input.
+      /// Calls 'function(etl::span<const uint8_t>)' with the payload of each valid frame.
+      /// Returns the number of valid frames.
+      template <typename TFunction>
+      size_t decode(etl::span<const uint8_t> input, TFunction function)
+      {
+        const uint8_t* p = input.data();
+        size_t         n = input.size();
+        size_t         count = 0U;
+
+        while (n != 0U)
+        {
+          if (escaped)
+          {
+            escaped = false;
+
+            const uint8_t value = *p++;
+            --n;
+
+            if (value == TPolicy::Flag)
+            {
+              // An escape followed by a flag aborts the frame.
+              frame.discard();
+            }
+            else
+            {
+              frame.append(TPolicy::unescape(value));
+            }
+
+            continue;
+          }
+
+          const size_t run = private_framing::find_either(p, n, TPolicy::Flag, TPolicy::Escape);
+
+          frame.append(p, run);
+          p += run;
+          n -= run;
+
+          if (n != 0U)
+          {
+            const uint8_t value = *p++;
+            --n;
+
+            if (value == TPolicy::Escape)
+            {
+              escaped = true;
+            }
+            else if (!frame.empty())
+            {
+              if (frame.complete(function))
+              {
+                ++count;
+              }
+            }
+          }
+        }
+
+        return count;
+      }
+
+      //*******************************
+      /// Decodes the unread data of a byte stream.
+      template <typename TFunction>
+      size_t decode(etl::byte_stream_reader& reader, TFunction function)
+      {
+        etl::span<const char> data = reader.free_data();
+
+        reader.skip<char>(data.size());
+
+        return decode(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()), data.size()), function);
+      }
+
+      size_t frame_count()         const { return frame.frame_count; }
+      size_t crc_error_count()     const { return frame.crc_error_count; }
+      size_t framing_error_count() const { return frame.framing_error_count; }
+
+      //*******************************
+      /// Discards any partial frame and clears the counts.
+      void reset()
+      {
+        frame.reset();
+        escaped = false;
+      }
+
+    private:
+
+      frame_assembler<VMax_Payload, TCrc, VEndian> frame;
+      bool                                         escaped;
+    };
+
+    template <typename TPolicy, size_t VMax_Payload, typename TCrc, int VEndian>
+    ETL_CONSTANT size_t stuffing_decoder<TPolicy, VMax_Payload, TCrc, VEndian>::Max_Payload;
+  }
+
+  //***************************************************************************
+  /// COBS encoder.
+  /// Writes the payload and frame check sequence with consistent overhead
+  /// byte stuffing, followed by a zero delimiter.
+  ///\ingroup framing
+  //***************************************************************************
+  template <typename TCrc = etl::framing_no_crc, int VEndian = etl::endian::little>
+  class cobs_encoder
+  {
+  public:
+
+    static ETL_CONSTANT size_t Crc_Size = private_framing::crc_size<TCrc>::value;
+
+    //*************************************************************************
+    /// The largest frame that a payload of 'length' bytes encodes to.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_encoded_size(size_t length)
+    {
+      return (length + Crc_Size) + ((length + Crc_Size) / 254U) + 2U;
+    }
+
+    //*************************************************************************
+    /// Starts a frame in 'output'.
+    //*************************************************************************
+    explicit cobs_encoder(etl::span<uint8_t> output)
+      : out(output.data(), output.size())
+      , code_index(0U)
+      , code(1U)
+      , block_open(false)
+    {
+      crc.reset();
+      open_block();
+    }
+
+    //*************************************************************************
+    /// Adds part of the payload.
+    //*************************************************************************
+    void add(etl::span<const uint8_t> data)
+    {
+      stuff(data.data(), data.size(), true);
+    }
+
+    //*************************************************************************
+    /// Adds the frame check sequence and the delimiter.
+    /// Returns the length of the frame.
+    /// If asserts or exceptions are enabled, emits etl::framing_overflow if the frame did not fit.
+    //*************************************************************************
+    size_t finish()
+    {
+      uint8_t fcs[Crc_Size + 1U];
+      private_framing::crc_to_bytes<TCrc, VEndian>(crc.value(), fcs);
+
+      stuff(fcs, Crc_Size, false);
+
+      if (block_open)
+      {
+        close_block();
+      }
+
+      out.put(0U);
+
+      ETL_ASSERT_OR_RETURN_VALUE(!out.overflow, ETL_ERROR(framing_overflow), 0U);
+
+      return out.length;
+    }
+
+    //*************************************************************************
+    /// The number of bytes written so far.
+    //*************************************************************************
+    size_t size() const
+    {
+      return out.length;
+    }
+
+    //*************************************************************************
+    /// Encodes a whole frame.
+    /// Returns the length of the frame.
+    /// If asserts or exceptions are enabled, emits etl::framing_overflow if the frame did not fit.
+    //*************************************************************************
+    static size_t encode(etl::span<const uint8_t> payload, etl::span<uint8_t> output)
+    {
+      cobs_encoder encoder(output);
+      encoder.add(payload);
+
+      return encoder.finish();
+    }
+
+    //*************************************************************************
+    /// Encodes a whole frame to the free space of a byte stream.
+    /// Returns the length of the frame.
+    //*************************************************************************
+    static size_t encode(etl::span<const uint8_t> payload, etl::byte_stream_writer& writer)
+    {
+      etl::span<char> free = writer.free_data();
+
+      const size_t length = encode(payload, etl::span<uint8_t>(reinterpret_cast<uint8_t*>(free.data()), free.size()));
+      writer.skip<char>(length);
+
+      return length;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reserves the code byte of a new block.
+    //*************************************************************************
+    void open_block()
+    {
+      code_index = out.length;
+      code       = 1U;
+      block_open = true;
+      out.put(0U);
+    }
+
+    //*************************************************************************
+    /// Writes the code byte of the current block.
+    //*************************************************************************
+    void close_block()
+    {
+      if (code_index < out.length)
+      {
+        out.p_buffer[code_index] = code;
+      }
+
+      block_open = false;
+    }
+
+    //*************************************************************************
+    void stuff(const uint8_t* p, size_t n, bool add_to_crc)
+    {
+      while (n != 0U)
+      {
+        // A block that ended at 254 bytes only starts another block if there is more data.
+        if (!block_open)
+        {
+          open_block();
+        }
+
+        const size_t limit = etl::min(n, size_t(0xFFU - code));
+        const size_t run   = private_framing::find_zero(p, limit);
+
+        out.put(p, run);
+        code = uint8_t(code + run);
+
+        if (add_to_crc)
+        {
+          crc.add(p, p + ((run < limit) ? (run + 1U) : run));
+        }
+
+        if (run < limit)
+        {
+          // The zero ends the block.
+          close_block();
+          open_block();
+
+          p += run + 1U;
+          n -= run + 1U;
+        }
+        else
+        {
+          p += run;
+          n -= run;
+
+          if (code == 0xFFU)
+          {
+            close_block();
+          }
+        }
+      }
+    }
+
+    private_framing::frame_output out;
+    TCrc                          crc;
+    size_t                        code_index;
+    uint8_t                       code;
+    bool                          block_open;
+  };
+
+  template <typename TCrc, int VEndian>
+  ETL_CONSTANT size_t cobs_encoder<TCrc, VEndian>::Crc_Size;
+
+  //***************************************************************************
+  /// Streaming COBS decoder.
+  /// Frames end with a zero delimiter.
+  ///\tparam VMax_Payload The largest payload, not including the frame check sequence.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t VMax_Payload, typename TCrc = etl::framing_no_crc, int VEndian = etl::endian::little>
+  class cobs_decoder
+  {
+  public:
+
+    static ETL_CONSTANT size_t Max_Payload = VMax_Payload;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    cobs_decoder()
+      : remaining(0U)
+      , zero_pending(false)
+      , started(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Decodes a chunk of input.
+    /// Calls 'function(etl::span<const uint8_t>)' with the payload of each valid frame.
+    /// Returns the number of valid frames.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t decode(etl::span<const uint8_t> input, TFunction function)
+    {
+      const uint8_t* p = input.data();
+      size_t         n = input.size();
+      size_t         count = 0U;
+
+      while (n != 0U)
+      {
+        if (remaining == 0U)
+        {
+          // A code byte or the delimiter.
+          const uint8_t value = *p++;
+          --n;
+
+          if (value == 0U)
+          {
+            if (started && frame.complete(function))
+            {
+              ++count;
+            }
+
+            clear();
+          }
+          else
+          {
+            if (zero_pending)
+            {
+              frame.append(0U);
+            }
+
+            remaining    = size_t(value - 1U);
+            zero_pending = (value != 0xFFU);
+            started      = true;
+          }
+        }
+        else
+        {
+          const size_t limit = etl::min(n, remaining);
+          const size_t run   = private_framing::find_zero(p, limit);
+
+          frame.append(p, run);
+          remaining -= run;
+          p += run;
+          n -= run;
+
+          if (run < limit)
+          {
+            // A delimiter inside a block truncates the frame.
+            ++p;
+            --n;
+            frame.discard();
+            clear();
+          }
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Decodes the unread data of a byte stream.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t decode(etl::byte_stream_reader& reader, TFunction function)
+    {
+      etl::span<const char> data = reader.free_data();
+
+      reader.skip<char>(data.size());
+
+      return decode(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(data.data()), data.size()), function);
+    }
+
+    size_t frame_count()         const { return frame.frame_count; }
+    size_t crc_error_count()     const { return frame.crc_error_count; }
+    size_t framing_error_count() const { return frame.framing_error_count; }
+
+    //*************************************************************************
+    /// Discards any partial frame and clears the counts.
+    //*************************************************************************
+    void reset()
+    {
+      frame.reset();
+      clear();
+    }
+
+  private:
+
+    void clear()
+    {
+      remaining    = 0U;
+      zero_pending = false;
+      started      = false;
+      frame.clear();
+    }
+
+    private_framing::frame_assembler<VMax_Payload, TCrc, VEndian> frame;
+    size_t                                                        remaining;
+    bool                                                          zero_pending;
+    bool                                                          started;
+  };
+
+  template <size_t VMax_Payload, typename TCrc, int VEndian>
+  ETL_CONSTANT size_t cobs_decoder<VMax_Payload, TCrc, VEndian>::Max_Payload;
+
+  //***************************************************************************
+  /// SLIP encoder, RFC 1055.
+  /// Frames start and end with an END byte.
+  ///\ingroup framing
+  //***************************************************************************
+  template <typename TCrc = etl::framing_no_crc, int VEndian = etl::endian::little>
+  class slip_encoder : public private_framing::stuffing_encoder<private_framing::slip_policy, TCrc, VEndian>
+  {
+  public:
+
+    explicit slip_encoder(etl::span<uint8_t> output)
+      : private_framing::stuffing_encoder<private_framing::slip_policy, TCrc, VEndian>(output)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Streaming SLIP decoder, RFC 1055.
+  ///\tparam VMax_Payload The largest payload, not including the frame check sequence.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t VMax_Payload, typename TCrc = etl::framing_no_crc, int VEndian = etl::endian::little>
+  class slip_decoder : public private_framing::stuffing_decoder<private_framing::slip_policy, VMax_Payload, TCrc, VEndian>
+  {
+  };
+
+  //***************************************************************************
+  /// HDLC asynchronous framing encoder, RFC 1662.
+  /// The frame check sequence is the CRC16 X.25, least significant byte
+  /// first, by default. Only the flag and escape bytes are escaped.
+  ///\ingroup framing
+  //***************************************************************************
+  template <typename TCrc = etl::crc16_x25, int VEndian = etl::endian::little>
+  class hdlc_encoder : public private_framing::stuffing_encoder<private_framing::hdlc_policy, TCrc, VEndian>
+  {
+  public:
+
+    explicit hdlc_encoder(etl::span<uint8_t> output)
+      : private_framing::stuffing_encoder<private_framing::hdlc_policy, TCrc, VEndian>(output)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Streaming HDLC asynchronous framing decoder, RFC 1662.
+  ///\tparam VMax_Payload The largest payload, not including the frame check sequence.
+  ///\ingroup framing
+  //***************************************************************************
+  template <size_t VMax_Payload, typename TCrc = etl::crc16_x25, int VEndian = etl::endian::little>
+  class hdlc_decoder : public private_framing::stuffing_decoder<private_framing::hdlc_policy, VMax_Payload, TCrc, VEndian>
+  {
+  };
+}
+
+#endif
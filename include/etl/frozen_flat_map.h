@@ -0,0 +1,1109 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROZEN_FLAT_MAP_INCLUDED
+#define ETL_FROZEN_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include "private/branchless_search.h"
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup frozen_flat_map frozen_flat_map
+/// A read mostly map with the capacity defined at compile time.
+/// The keys and the mapped values are held in two separate sorted arrays,
+/// so a lookup only touches the contiguous keys and uses a branchless
+/// binary search. Suited to configuration and lookup tables that are built
+/// once and then only searched.
+/// The map is built from a range or an initializer list. Mapped values may
+/// be modified, but elements are not inserted or erased individually.
+/// Build is O(N) for sorted input and O(N^2) at worst. Lookup is O(logN).
+/// Both TKey and TMapped must be default constructible and assignable.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_exception : public etl::exception
+  {
+  public:
+
+    frozen_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_full : public etl::frozen_flat_map_exception
+  {
+  public:
+
+    frozen_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::frozen_flat_map_exception(ETL_ERROR_TEXT("frozen_flat_map:full", ETL_FROZEN_FLAT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the frozen_flat_map.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  class frozen_flat_map_out_of_bounds : public etl::frozen_flat_map_exception
+  {
+  public:
+
+    frozen_flat_map_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::frozen_flat_map_exception(ETL_ERROR_TEXT("frozen_flat_map:bounds", ETL_FROZEN_FLAT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all frozen_flat_maps.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = etl::less<TKey> >
+  class ifrozen_flat_map
+  {
+  public:
+
+    typedef TKey                            key_type;
+    typedef TMapped                         mapped_type;
+    typedef ETL_OR_STD::pair<TKey, TMapped> value_type;
+    typedef TKeyCompare                     key_compare;
+    typedef size_t                          size_type;
+    typedef ptrdiff_t                       difference_type;
+
+    typedef const key_type&    const_key_reference;
+    typedef mapped_type&       mapped_reference;
+    typedef const mapped_type& const_mapped_reference;
+
+    //*************************************************************************
+    /// The keys and values are held apart, so the iterators return a pair
+    /// of references rather than a reference to a stored pair.
+    //*************************************************************************
+    struct reference
+    {
+      const TKey& first;
+      TMapped&    second;
+    };
+
+    struct const_reference
+    {
+      const TKey&    first;
+      const TMapped& second;
+    };
+
+    //*************************************************************************
+    /// Allows operator -> on the iterators.
+    //*************************************************************************
+    template <typename TReference>
+    class arrow_proxy
+    {
+    public:
+
+      explicit arrow_proxy(const TReference& reference_)
+        : ref(reference_)
+      {
+      }
+
+      const TReference* operator ->() const
+      {
+        return &ref;
+      }
+
+    private:
+
+      TReference ref;
+    };
+
+    typedef arrow_proxy<reference>       pointer;
+    typedef arrow_proxy<const_reference> const_pointer;
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, value_type, difference_type, pointer, reference>
+    {
+    public:
+
+      friend class ifrozen_flat_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      iterator& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return *this;
+      }
+
+      iterator& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return *this;
+      }
+
+      iterator operator +(difference_type n) const
+      {
+        iterator temp(*this);
+        temp += n;
+        return temp;
+      }
+
+      iterator operator -(difference_type n) const
+      {
+        iterator temp(*this);
+        temp -= n;
+        return temp;
+      }
+
+      difference_type operator -(const iterator& other) const
+      {
+        return difference_type(index) - difference_type(other.index);
+      }
+
+      reference operator *() const
+      {
+        reference ref = { p_map->p_keys[index], p_map->p_values[index] };
+        return ref;
+      }
+
+      reference operator [](difference_type n) const
+      {
+        return *(*this + n);
+      }
+
+      pointer operator ->() const
+      {
+        return pointer(**this);
+      }
+
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index != rhs.index;
+      }
+
+      friend bool operator < (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      friend bool operator <= (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index <= rhs.index;
+      }
+
+      friend bool operator > (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index > rhs.index;
+      }
+
+      friend bool operator >= (const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index >= rhs.index;
+      }
+
+    private:
+
+      iterator(ifrozen_flat_map& map_, size_t index_)
+        : p_map(&map_)
+        , index(index_)
+      {
+      }
+
+      ifrozen_flat_map* p_map;
+      size_t            index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, const value_type, difference_type, const_pointer, const_reference>
+    {
+    public:
+
+      friend class ifrozen_flat_map;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      const_iterator(const typename ifrozen_flat_map::iterator& other)
+        : p_map(other.p_map)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      const_iterator& operator +=(difference_type n)
+      {
+        index = size_t(difference_type(index) + n);
+        return *this;
+      }
+
+      const_iterator& operator -=(difference_type n)
+      {
+        index = size_t(difference_type(index) - n);
+        return *this;
+      }
+
+      const_iterator operator +(difference_type n) const
+      {
+        const_iterator temp(*this);
+        temp += n;
+        return temp;
+      }
+
+      const_iterator operator -(difference_type n) const
+      {
+        const_iterator temp(*this);
+        temp -= n;
+        return temp;
+      }
+
+      difference_type operator -(const const_iterator& other) const
+      {
+        return difference_type(index) - difference_type(other.index);
+      }
+
+      const_reference operator *() const
+      {
+        const_reference ref = { p_map->p_keys[index], p_map->p_values[index] };
+        return ref;
+      }
+
+      const_reference operator [](difference_type n) const
+      {
+        return *(*this + n);
+      }
+
+      const_pointer operator ->() const
+      {
+        return const_pointer(**this);
+      }
+
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index != rhs.index;
+      }
+
+      friend bool operator < (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      friend bool operator <= (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index <= rhs.index;
+      }
+
+      friend bool operator > (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index > rhs.index;
+      }
+
+      friend bool operator >= (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index >= rhs.index;
+      }
+
+    private:
+
+      const_iterator(const ifrozen_flat_map& map_, size_t index_)
+        : p_map(&map_)
+        , index(index_)
+      {
+      }
+
+      const ifrozen_flat_map* p_map;
+      size_t                  index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns a const_iterator to the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the map.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the map.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Returns the sorted array of keys.
+    //*************************************************************************
+    const key_type* keys() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns the array of mapped values, in key order.
+    //*************************************************************************
+    mapped_type* values()
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Returns the array of mapped values, in key order.
+    //*************************************************************************
+    const mapped_type* values() const
+    {
+      return p_values;
+    }
+
+    //*********************************************************************
+    /// Returns a reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::frozen_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A reference to the value at index 'key'
+    //*********************************************************************
+    mapped_reference at(const_key_reference key)
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(frozen_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    mapped_reference at(const K& key)
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(frozen_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'key'
+    /// If asserts or exceptions are enabled, emits an etl::frozen_flat_map_out_of_bounds if the key is not in the range.
+    ///\param key The key.
+    ///\return A const reference to the value at index 'key'
+    //*********************************************************************
+    const_mapped_reference at(const_key_reference key) const
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(frozen_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_mapped_reference at(const K& key) const
+    {
+      const size_t index = find_index(key);
+
+      ETL_ASSERT(index != current_size, ETL_ERROR(frozen_flat_map_out_of_bounds));
+
+      return p_values[index];
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    iterator find(const_key_reference key)
+    {
+      return iterator(*this, find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      return iterator(*this, find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return const_iterator(*this, find_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return const_iterator(*this, find_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != current_size;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator lower_bound(const_key_reference key)
+    {
+      return iterator(*this, lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator lower_bound(const K& key)
+    {
+      return iterator(*this, lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return const_iterator(*this, lower_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return const_iterator(*this, lower_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    iterator upper_bound(const_key_reference key)
+    {
+      return iterator(*this, upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    iterator upper_bound(const K& key)
+    {
+      return iterator(*this, upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return const_iterator(*this, upper_bound_index(key));
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return const_iterator(*this, upper_bound_index(key));
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const_key_reference key)
+    {
+      const size_t first = lower_bound_index(key);
+      const size_t last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::make_pair(iterator(*this, first), iterator(*this, last));
+    }
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const size_t first = lower_bound_index(key);
+      const size_t last  = ((first != current_size) && !compare(key, p_keys[first])) ? first + 1U : first;
+
+      return ETL_OR_STD::make_pair(const_iterator(*this, first), const_iterator(*this, last));
+    }
+
+    //*********************************************************************
+    /// Rebuilds the map from a range of key/value pairs.
+    /// If a key appears more than once, the first is kept.
+    /// If asserts or exceptions are enabled, emits frozen_flat_map_full if
+    /// the unique keys do not fit.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        add(first->first, first->second);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the map.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the map.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity_ - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ifrozen_flat_map& operator = (const ifrozen_flat_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT(rhs.size() <= capacity_, ETL_ERROR(frozen_flat_map_full));
+
+        current_size = 0U;
+
+        while ((current_size < rhs.size()) && (current_size < capacity_))
+        {
+          p_keys[current_size]   = rhs.p_keys[current_size];
+          p_values[current_size] = rhs.p_values[current_size];
+          ++current_size;
+        }
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ifrozen_flat_map(key_type* p_keys_, mapped_type* p_values_, size_t capacity__)
+      : p_keys(p_keys_)
+      , p_values(p_values_)
+      , current_size(0U)
+      , capacity_(capacity__)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a key and value, keeping the keys sorted.
+    //*************************************************************************
+    void add(const key_type& key, const mapped_type& value)
+    {
+      size_t index = current_size;
+
+      // Sorted input only needs a comparison with the last key.
+      if ((current_size != 0U) && !compare(p_keys[current_size - 1U], key))
+      {
+        index = lower_bound_index(key);
+
+        if (!compare(key, p_keys[index]))
+        {
+          // Already in the map.
+          return;
+        }
+      }
+
+      if (current_size == capacity_)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(frozen_flat_map_full));
+        return;
+      }
+
+      for (size_t i = current_size; i > index; --i)
+      {
+        p_keys[i]   = ETL_MOVE(p_keys[i - 1U]);
+        p_values[i] = ETL_MOVE(p_values[i - 1U]);
+      }
+
+      p_keys[index]   = key;
+      p_values[index] = value;
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Search helpers.
+    //*************************************************************************
+    template <typename K>
+    size_t lower_bound_index(const K& key) const
+    {
+      return etl::private_branchless_search::lower_bound(p_keys, current_size, key, compare);
+    }
+
+    template <typename K>
+    size_t upper_bound_index(const K& key) const
+    {
+      return etl::private_branchless_search::upper_bound(p_keys, current_size, key, compare);
+    }
+
+    template <typename K>
+    size_t find_index(const K& key) const
+    {
+      const size_t index = lower_bound_index(key);
+
+      return ((index != current_size) && !compare(key, p_keys[index])) ? index : current_size;
+    }
+
+    // Disable copy construction.
+    ifrozen_flat_map(const ifrozen_flat_map&);
+
+    key_type*    p_keys;
+    mapped_type* p_values;
+    size_t       current_size;
+    const size_t capacity_;
+    key_compare  compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FROZEN_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ifrozen_flat_map()
+    {
+    }
+#else
+  protected:
+    ~ifrozen_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A frozen_flat_map with the capacity defined at compile time.
+  ///\tparam TKey     The key type.
+  ///\tparam TValue   The mapped type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare The key comparison functor.
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class frozen_flat_map : public etl::ifrozen_flat_map<TKey, TValue, TCompare>
+  {
+  private:
+
+    typedef etl::ifrozen_flat_map<TKey, TValue, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity frozen_flat_map is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    frozen_flat_map()
+      : base_t(key_buffer, value_buffer, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    frozen_flat_map(const frozen_flat_map& other)
+      : base_t(key_buffer, value_buffer, MAX_SIZE)
+    {
+      base_t::operator =(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range of key/value pairs.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    frozen_flat_map(TIterator first, TIterator last)
+      : base_t(key_buffer, value_buffer, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    frozen_flat_map(std::initializer_list<typename base_t::value_type> init)
+      : base_t(key_buffer, value_buffer, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    frozen_flat_map& operator = (const frozen_flat_map& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    TKey   key_buffer[MAX_SIZE];
+    TValue value_buffer[MAX_SIZE];
+  };
+
+  template <typename TKey, typename TValue, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t frozen_flat_map<TKey, TValue, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first frozen_flat_map.
+  ///\param rhs Reference to the second frozen_flat_map.
+  ///\return <b>true</b> if the maps are equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator ==(const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) &&
+           etl::equal(lhs.keys(), lhs.keys() + lhs.size(), rhs.keys()) &&
+           etl::equal(lhs.values(), lhs.values() + lhs.size(), rhs.values());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first frozen_flat_map.
+  ///\param rhs Reference to the second frozen_flat_map.
+  ///\return <b>true</b> if the maps are not equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare>
+  bool operator !=(const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& lhs, const etl::ifrozen_flat_map<TKey, TMapped, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,600 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FROZEN_FLAT_SET_INCLUDED
+#define ETL_FROZEN_FLAT_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "initializer_list.h"
+
+#include "private/branchless_search.h"
+#include "private/comparator_is_transparent.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup frozen_flat_set frozen_flat_set
+/// A read mostly set with the capacity defined at compile time.
+/// The keys are held in a sorted array and searched with a branchless
+/// binary search. Suited to lookup tables that are built once and then
+/// only searched.
+/// The set is built from a range or an initializer list. Elements are not
+/// inserted or erased individually.
+/// Build is O(N) for sorted input and O(N^2) at worst. Lookup is O(logN).
+/// TKey must be default constructible and assignable.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the frozen_flat_set.
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  class frozen_flat_set_exception : public etl::exception
+  {
+  public:
+
+    frozen_flat_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the frozen_flat_set.
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  class frozen_flat_set_full : public etl::frozen_flat_set_exception
+  {
+  public:
+
+    frozen_flat_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::frozen_flat_set_exception(ETL_ERROR_TEXT("frozen_flat_set:full", ETL_FROZEN_FLAT_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all frozen_flat_sets.
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare = etl::less<TKey> >
+  class ifrozen_flat_set
+  {
+  public:
+
+    typedef TKey              key_type;
+    typedef TKey              value_type;
+    typedef TKeyCompare       key_compare;
+    typedef TKeyCompare       value_compare;
+    typedef const value_type& reference;
+    typedef const value_type& const_reference;
+    typedef const value_type* pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+
+    typedef const key_type& const_key_reference;
+
+    /// The keys are contiguous, so the iterators are pointers.
+    typedef const value_type*                            iterator;
+    typedef const value_type*                            const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_keys + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the set.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_keys;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the set.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_keys + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the set.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the set.
+    //*************************************************************************
+    const_reverse_iterator crbegin() const
+    {
+      return const_reverse_iterator(cend());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the set.
+    //*************************************************************************
+    const_reverse_iterator crend() const
+    {
+      return const_reverse_iterator(cbegin());
+    }
+
+    //*************************************************************************
+    /// Returns the sorted array of keys.
+    //*************************************************************************
+    const key_type* data() const
+    {
+      return p_keys;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator pointing to the element or end() if not found.
+    //*********************************************************************
+    const_iterator find(const_key_reference key) const
+    {
+      return p_keys + find_index(key);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      return p_keys + find_index(key);
+    }
+#endif
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(const_key_reference key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find_index(key) != current_size) ? 1U : 0U;
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the set contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find_index(key) != current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find_index(key) != current_size;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the lower bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator lower_bound(const_key_reference key) const
+    {
+      return p_keys + etl::private_branchless_search::lower_bound(p_keys, current_size, key, compare);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator lower_bound(const K& key) const
+    {
+      return p_keys + etl::private_branchless_search::lower_bound(p_keys, current_size, key, compare);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the upper bound of a key
+    ///\param key The key to search for.
+    ///\return An iterator.
+    //*********************************************************************
+    const_iterator upper_bound(const_key_reference key) const
+    {
+      return p_keys + etl::private_branchless_search::upper_bound(p_keys, current_size, key, compare);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KC = TKeyCompare, etl::enable_if_t<comparator_is_transparent<KC>::value, int> = 0>
+    const_iterator upper_bound(const K& key) const
+    {
+      return p_keys + etl::private_branchless_search::upper_bound(p_keys, current_size, key, compare);
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds the range of equal elements of a key
+    ///\param key The key to search for.
+    ///\return An iterator pair.
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const_key_reference key) const
+    {
+      const_iterator first = lower_bound(key);
+      const_iterator last  = ((first != end()) && !compare(key, *first)) ? first + 1 : first;
+
+      return ETL_OR_STD::make_pair(first, last);
+    }
+
+    //*********************************************************************
+    /// Rebuilds the set from a range of keys.
+    /// If asserts or exceptions are enabled, emits frozen_flat_set_full if
+    /// the unique keys do not fit.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears the set.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the current size of the set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks the 'empty' state of the set.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks the 'full' state of the set.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum possible size of the set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity_ - current_size;
+    }
+
+    //*************************************************************************
+    /// How to compare two key elements.
+    //*************************************************************************
+    key_compare key_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// How to compare two value elements.
+    //*************************************************************************
+    value_compare value_comp() const
+    {
+      return compare;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    ifrozen_flat_set& operator = (const ifrozen_flat_set& rhs)
+    {
+      if (&rhs != this)
+      {
+        ETL_ASSERT(rhs.size() <= capacity_, ETL_ERROR(frozen_flat_set_full));
+
+        current_size = 0U;
+
+        while ((current_size < rhs.size()) && (current_size < capacity_))
+        {
+          p_keys[current_size] = rhs.p_keys[current_size];
+          ++current_size;
+        }
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ifrozen_flat_set(key_type* p_keys_, size_t capacity__)
+      : p_keys(p_keys_)
+      , current_size(0U)
+      , capacity_(capacity__)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a key, keeping the keys sorted.
+    //*************************************************************************
+    void add(const key_type& key)
+    {
+      size_t index = current_size;
+
+      // Sorted input only needs a comparison with the last key.
+      if ((current_size != 0U) && !compare(p_keys[current_size - 1U], key))
+      {
+        index = etl::private_branchless_search::lower_bound(p_keys, current_size, key, compare);
+
+        if (!compare(key, p_keys[index]))
+        {
+          // Already in the set.
+          return;
+        }
+      }
+
+      if (current_size == capacity_)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(frozen_flat_set_full));
+        return;
+      }
+
+      for (size_t i = current_size; i > index; --i)
+      {
+        p_keys[i] = ETL_MOVE(p_keys[i - 1U]);
+      }
+
+      p_keys[index] = key;
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the index of the key, or the size if not found.
+    //*************************************************************************
+    template <typename K>
+    size_t find_index(const K& key) const
+    {
+      const size_t index = etl::private_branchless_search::lower_bound(p_keys, current_size, key, compare);
+
+      return ((index != current_size) && !compare(key, p_keys[index])) ? index : current_size;
+    }
+
+    // Disable copy construction.
+    ifrozen_flat_set(const ifrozen_flat_set&);
+
+    key_type*    p_keys;
+    size_t       current_size;
+    const size_t capacity_;
+    key_compare  compare;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FROZEN_FLAT_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ifrozen_flat_set()
+    {
+    }
+#else
+  protected:
+    ~ifrozen_flat_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// A frozen_flat_set with the capacity defined at compile time.
+  ///\tparam TKey      The key type.
+  ///\tparam MAX_SIZE_ The maximum number of elements that can be stored.
+  ///\tparam TCompare  The key comparison functor.
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class frozen_flat_set : public etl::ifrozen_flat_set<TKey, TCompare>
+  {
+  private:
+
+    typedef etl::ifrozen_flat_set<TKey, TCompare> base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((MAX_SIZE_ > 0U), "Zero capacity frozen_flat_set is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    frozen_flat_set()
+      : base_t(key_buffer, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    frozen_flat_set(const frozen_flat_set& other)
+      : base_t(key_buffer, MAX_SIZE)
+    {
+      base_t::operator =(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    frozen_flat_set(TIterator first, TIterator last)
+      : base_t(key_buffer, MAX_SIZE)
+    {
+      this->assign(first, last);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Constructor, from an initializer_list.
+    //*************************************************************************
+    frozen_flat_set(std::initializer_list<TKey> init)
+      : base_t(key_buffer, MAX_SIZE)
+    {
+      this->assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    frozen_flat_set& operator = (const frozen_flat_set& rhs)
+    {
+      base_t::operator =(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    TKey key_buffer[MAX_SIZE];
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t frozen_flat_set<TKey, MAX_SIZE_, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first frozen_flat_set.
+  ///\param rhs Reference to the second frozen_flat_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator ==(const etl::ifrozen_flat_set<TKey, TKeyCompare>& lhs, const etl::ifrozen_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first frozen_flat_set.
+  ///\param rhs Reference to the second frozen_flat_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup frozen_flat_set
+  //***************************************************************************
+  template <typename TKey, typename TKeyCompare>
+  bool operator !=(const etl::ifrozen_flat_set<TKey, TKeyCompare>& lhs, const etl::ifrozen_flat_set<TKey, TKeyCompare>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,230 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FUNCTION_SERVICE_INCLUDED
+#define ETL_FUNCTION_SERVICE_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// Associates a function with an id, for etl::function_service.
+  /// \tparam Id       The id.
+  /// \tparam Function The function to call for the id.
+  //***************************************************************************
+  template <size_t Id, void (*Function)(size_t)>
+  struct function_service_entry
+  {
+  };
+
+  namespace private_function_service
+  {
+    typedef void (*function_type)(size_t);
+
+    //*************************************************************************
+    /// The function for ids that have no entry, if none is supplied.
+    //*************************************************************************
+    inline void ignore(size_t)
+    {
+    }
+
+    //*************************************************************************
+    /// Finds the first function for Id, or Unhandled if there is none.
+    /// A null Unhandled is replaced by a function that does nothing.
+    //*************************************************************************
+    template <size_t Id, function_type Unhandled, typename... TEntries>
+    struct find_function
+    {
+      static constexpr function_type value = (Unhandled != nullptr) ? Unhandled : &ignore;
+    };
+
+    template <size_t Id, function_type Unhandled, size_t Entry_Id, function_type Function, typename... TEntries>
+    struct find_function<Id, Unhandled, etl::function_service_entry<Entry_Id, Function>, TEntries...>
+    {
+      static constexpr function_type value = (Id == Entry_Id) ? Function : find_function<Id, Unhandled, TEntries...>::value;
+    };
+
+    //*************************************************************************
+    /// Counts the entries for Id.
+    //*************************************************************************
+    template <size_t Id, typename... TEntries>
+    struct count_entries
+    {
+      static constexpr size_t value = 0U;
+    };
+
+    template <size_t Id, size_t Entry_Id, function_type Function, typename... TEntries>
+    struct count_entries<Id, etl::function_service_entry<Entry_Id, Function>, TEntries...>
+    {
+      static constexpr size_t value = ((Id == Entry_Id) ? 1U : 0U) + count_entries<Id, TEntries...>::value;
+    };
+
+    //*************************************************************************
+    /// Checks that every entry has a unique id between Offset and Offset + Range - 1.
+    //*************************************************************************
+    template <size_t Offset, size_t Range, typename TEntries, typename... TRemaining>
+    struct is_valid_entries;
+
+    template <size_t Offset, size_t Range, typename... TEntries>
+    struct is_valid_entries<Offset, Range, void(TEntries...)>
+    {
+      static constexpr bool value = true;
+    };
+
+    template <size_t Offset, size_t Range, typename... TEntries, size_t Entry_Id, function_type Function, typename... TRemaining>
+    struct is_valid_entries<Offset, Range, void(TEntries...), etl::function_service_entry<Entry_Id, Function>, TRemaining...>
+    {
+      static constexpr bool value = (Entry_Id >= Offset) &&
+                                    (Entry_Id < (Offset + Range)) &&
+                                    (count_entries<Entry_Id, TEntries...>::value == 1U) &&
+                                    is_valid_entries<Offset, Range, void(TEntries...), TRemaining...>::value;
+    };
+
+    //*************************************************************************
+    /// The table of functions, indexed by id - Offset.
+    //*************************************************************************
+    template <size_t Offset, function_type Unhandled, typename TIndices, typename... TEntries>
+    struct table;
+
+    template <size_t Offset, function_type Unhandled, size_t... Indices, typename... TEntries>
+    struct table<Offset, Unhandled, etl::index_sequence<Indices...>, TEntries...>
+    {
+      static constexpr function_type value[sizeof...(Indices)] = { find_function<Offset + Indices, Unhandled, TEntries...>::value... };
+    };
+
+    template <size_t Offset, function_type Unhandled, size_t... Indices, typename... TEntries>
+    constexpr function_type table<Offset, Unhandled, etl::index_sequence<Indices...>, TEntries...>::value[sizeof...(Indices)];
+  }
+
+  //***************************************************************************
+  /// An indexed function service where the table of functions is built at
+  /// compile time. There is no registration, no object and no vtable. A call
+  /// with a run time id is a range check and a single indirect call through
+  /// a static constexpr table. A call with a compile time id is a direct call.
+  /// \tparam Offset    The lowest id value.
+  /// \tparam Range     The number of ids to handle.
+  /// \tparam Unhandled The function for ids without an entry, or nullptr to
+  ///                   ignore them.
+  /// \tparam TEntries  The etl::function_service_entry for each handled id.
+  /// The ids must range between Offset and Offset + Range - 1.
+  //***************************************************************************
+  template <size_t Offset, size_t Range, void (*Unhandled)(size_t), typename... TEntries>
+  class function_service
+  {
+  private:
+
+    typedef private_function_service::table<Offset, Unhandled, etl::make_index_sequence<Range>, TEntries...> table_type;
+
+    // The 'unhandled' function, or one that does nothing.
+    typedef private_function_service::find_function<Offset + Range, Unhandled> unhandled_type;
+
+    ETL_STATIC_ASSERT(Range > 0U, "Range must be greater than zero");
+    ETL_STATIC_ASSERT((private_function_service::is_valid_entries<Offset, Range, void(TEntries...), TEntries...>::value), "Entry ids must be unique and in range");
+
+  public:
+
+    typedef void (*function_type)(size_t);
+
+    //*************************************************************************
+    /// Calls the function for the id.
+    /// Compile time assert if the id is out of range.
+    /// \tparam Id The id of the function.
+    //*************************************************************************
+    template <size_t Id>
+    static void call()
+    {
+      ETL_STATIC_ASSERT(Id < (Offset + Range), "Id out of range");
+      ETL_STATIC_ASSERT(Id >= Offset,          "Id out of range");
+
+      get_function<Id>()(Id);
+    }
+
+    //*************************************************************************
+    /// Calls the function for the id.
+    /// Ids out of range call the 'unhandled' function.
+    /// \param id Id of the function.
+    //*************************************************************************
+    static void call(size_t id)
+    {
+      // Ids below Offset wrap to large values.
+      const size_t index = id - Offset;
+
+      if (index < Range)
+      {
+        table_type::value[index](id);
+      }
+      else
+      {
+        unhandled_type::value(id);
+      }
+    }
+
+    //*************************************************************************
+    /// A handler with no parameters, that calls the function for the id.
+    /// Suitable for an interrupt vector table entry.
+    /// \tparam Id The id of the function.
+    //*************************************************************************
+    template <size_t Id>
+    static void handler()
+    {
+      call<Id>();
+    }
+
+    //*************************************************************************
+    /// Gets the function for the id, at compile time.
+    /// \tparam Id The id of the function.
+    //*************************************************************************
+    template <size_t Id>
+    static constexpr function_type get_function()
+    {
+      return private_function_service::find_function<Id, Unhandled, TEntries...>::value;
+    }
+
+    //*************************************************************************
+    /// Gets the table of functions, indexed by id - Offset.
+    //*************************************************************************
+    static constexpr const function_type* get_table()
+    {
+      return table_type::value;
+    }
+  };
+}
+
+#endif
+
+#endif
@@ -351,6 +351,67 @@ namespace etl
     ifsm_state& operator =(const ifsm_state&);
   };
 
+#if ETL_USING_CPP17 && !defined(ETL_FSM_FORCE_CPP03_IMPLEMENTATION) // For C++17 and above
+  //***************************************************************************
+  /// A list of FSM states that is checked at compile time.
+  /// The states must be listed in state id order, from 0.
+  /// The fsm takes the list without run time checks.
+  /// The pack holds pointers to the states, and must outlive the fsm.
+  //***************************************************************************
+  template <typename... TStates>
+  class fsm_state_pack
+  {
+  public:
+
+    static constexpr size_t Number_Of_States = sizeof...(TStates);
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    fsm_state_pack(TStates&... states)
+      : state_list{ static_cast<etl::ifsm_state*>(&states)... }
+    {
+      ETL_STATIC_ASSERT(Number_Of_States > 0U, "The state list is empty");
+      ETL_STATIC_ASSERT(Number_Of_States < size_t(ifsm_state::No_State_Change), "Too many states");
+      ETL_STATIC_ASSERT(ids_in_order(), "The state ids must be 0 to N-1, in order");
+    }
+
+    //*******************************************
+    /// Gets the list of states, in state id order.
+    //*******************************************
+    etl::ifsm_state** get_states()
+    {
+      return state_list;
+    }
+
+    //*******************************************
+    /// Gets the number of states.
+    //*******************************************
+    static constexpr size_t size()
+    {
+      return Number_Of_States;
+    }
+
+  private:
+
+    //*******************************************
+    static constexpr bool ids_in_order()
+    {
+      bool   in_order = true;
+      size_t index    = 0U;
+
+      ((in_order = in_order && (size_t(TStates::STATE_ID) == index++)), ...);
+
+      return in_order;
+    }
+
+    etl::ifsm_state* state_list[Number_Of_States];
+  };
+
+  template <typename... TStates>
+  fsm_state_pack(TStates&...) -> fsm_state_pack<TStates...>;
+#endif
+
   //***************************************************************************
   /// The FSM class.
   //***************************************************************************
@@ -392,6 +453,25 @@ namespace etl
       }
     }
 
+#if ETL_USING_CPP17 && !defined(ETL_FSM_FORCE_CPP03_IMPLEMENTATION) // For C++17 and above
+    //*******************************************
+    /// Set the states for the FSM from a compile time checked list.
+    /// The count, ids and order have already been checked, so there are
+    /// no run time checks.
+    //*******************************************
+    template <typename... TStates>
+    void set_states(etl::fsm_state_pack<TStates...>& states)
+    {
+      state_list       = states.get_states();
+      number_of_states = etl::fsm_state_id_t(sizeof...(TStates));
+
+      for (etl::fsm_state_id_t i = 0; i < number_of_states; ++i)
+      {
+        state_list[i]->set_fsm_context(*this);
+      }
+    }
+#endif
+
     //*******************************************
     /// Starts the FSM.
     /// Can only be called once.
@@ -590,20 +670,142 @@ namespace etl
   private:
 
     //********************************************
-    struct result_t
+    typedef etl::fsm_state_id_t (*handler_t)(fsm_state&, const etl::imessage&);
+
+    static constexpr size_t Number_Of_Messages = sizeof...(TMessageTypes);
+
+    //********************************************
+    static constexpr size_t min_message_id()
+    {
+      size_t id = ~size_t(0);
+      ((id = (size_t(TMessageTypes::ID) < id) ? size_t(TMessageTypes::ID) : id), ...);
+      return id;
+    }
+
+    //********************************************
+    static constexpr size_t max_message_id()
     {
-      bool was_handled;
-      etl::fsm_state_id_t state_id;
+      size_t id = 0U;
+      ((id = (size_t(TMessageTypes::ID) > id) ? size_t(TMessageTypes::ID) : id), ...);
+      return id;
+    }
+
+    static constexpr size_t Min_Message_Id   = (Number_Of_Messages == 0U) ? 0U : min_message_id();
+    static constexpr size_t Message_Id_Range = (Number_Of_Messages == 0U) ? 0U : (max_message_id() - Min_Message_Id + 1U);
+
+    // Use a table indexed by message id unless the ids are too sparse,
+    // in which case use a table sorted by id.
+    static constexpr bool Is_Dense = (Message_Id_Range <= ((4U * Number_Of_Messages) + 8U));
+
+    //********************************************
+    /// Handler table, indexed by message id.
+    //********************************************
+    struct dense_dispatch_table
+    {
+      constexpr dense_dispatch_table()
+        : handler()
+      {
+        (add(TMessageTypes::ID, &on_message<TMessageTypes>), ...);
+      }
+
+      constexpr void add(size_t id, handler_t h)
+      {
+        // The first message type with the id takes precedence.
+        if (handler[id - Min_Message_Id] == nullptr)
+        {
+          handler[id - Min_Message_Id] = h;
+        }
+      }
+
+      handler_t find(size_t id) const
+      {
+        const size_t index = id - Min_Message_Id;
+
+        return (index < Message_Id_Range) ? handler[index] : nullptr;
+      }
+
+      handler_t handler[(Message_Id_Range == 0U) ? 1U : Message_Id_Range];
     };
 
+    //********************************************
+    /// Handler table, sorted by message id.
+    //********************************************
+    struct sparse_dispatch_table
+    {
+      constexpr sparse_dispatch_table()
+        : id()
+        , handler()
+        , size(0U)
+      {
+        (add(TMessageTypes::ID, &on_message<TMessageTypes>), ...);
+      }
+
+      constexpr void add(size_t id_, handler_t h)
+      {
+        size_t i = size;
+
+        for (size_t j = 0U; j < size; ++j)
+        {
+          // The first message type with the id takes precedence.
+          if (id[j] == id_)
+          {
+            return;
+          }
+        }
+
+        for (; (i > 0U) && (id[i - 1U] > id_); --i)
+        {
+          id[i]      = id[i - 1U];
+          handler[i] = handler[i - 1U];
+        }
+
+        id[i]      = id_;
+        handler[i] = h;
+        ++size;
+      }
+
+      handler_t find(size_t id_) const
+      {
+        size_t low  = 0U;
+        size_t high = size;
+
+        while (low < high)
+        {
+          const size_t middle = low + ((high - low) / 2U);
+
+          if (id[middle] < id_)
+          {
+            low = middle + 1U;
+          }
+          else
+          {
+            high = middle;
+          }
+        }
+
+        return ((low < size) && (id[low] == id_)) ? handler[low] : nullptr;
+      }
+
+      size_t    id[Number_Of_Messages];
+      handler_t handler[Number_Of_Messages];
+      size_t    size;
+    };
+
+    typedef etl::conditional_t<Is_Dense, dense_dispatch_table, sparse_dispatch_table> dispatch_table_t;
+
     //********************************************
     etl::fsm_state_id_t process_event(const etl::imessage& message)
     {
-      etl::fsm_state_id_t new_state_id;
+      etl::fsm_state_id_t new_state_id = Pass_To_Parent;
 
-      const bool was_handled = (process_event_type<TMessageTypes>(message, new_state_id) || ...);
+      const handler_t handler = find_handler(message.get_message_id());
+
+      if (handler != nullptr)
+      {
+        new_state_id = handler(*this, message);
+      }
 
-      if (!was_handled || (new_state_id == Pass_To_Parent))
+      if ((handler == nullptr) || (new_state_id == Pass_To_Parent))
       {
         new_state_id = (p_parent != nullptr) ? p_parent->process_event(message) : static_cast<TDerived*>(this)->on_event_unknown(message);
       }
@@ -612,19 +814,27 @@ namespace etl
     }
 
     //********************************************
-    template <typename TMessage>
-    bool process_event_type(const etl::imessage& msg, etl::fsm_state_id_t& state_id)
+    static handler_t find_handler(etl::message_id_t id)
     {
-      if (TMessage::ID == msg.get_message_id())
+      if constexpr (Number_Of_Messages == 0U)
       {
-        state_id = static_cast<TDerived*>(this)->on_event(static_cast<const TMessage&>(msg));
-        return true;
+        (void)id;
+        return nullptr;
       }
       else
       {
-        return false;
+        static constexpr dispatch_table_t table{};
+
+        return table.find(size_t(id));
       }
     }
+
+    //********************************************
+    template <typename TMessage>
+    static etl::fsm_state_id_t on_message(fsm_state& state, const etl::imessage& msg)
+    {
+      return static_cast<TDerived&>(state).on_event(static_cast<const TMessage&>(msg));
+    }
   };
 
   /// Definition of STATE_ID
@@ -82,6 +82,32 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    size_t allocate_n(U** items, size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_n<U>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    size_t allocate_n(etl::span<U*, Extent> items)
+    {
+      return allocate_n(items.data(), items.size());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -250,6 +276,32 @@ namespace etl
       return ipool::allocate<U>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    size_t allocate_n(U** items, size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= VAlignment, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= VTypeSize, "Type too large for pool");
+      return ipool::allocate_n<U>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    size_t allocate_n(etl::span<U*, Extent> items)
+    {
+      return allocate_n(items.data(), items.size());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
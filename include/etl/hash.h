@@ -40,9 +40,11 @@ SOFTWARE.
 #include "type_traits.h"
 #include "static_assert.h"
 #include "math.h"
+#include "wyhash.h"
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 
 ///\defgroup hash Standard hash calculations
 ///\ingroup maths
@@ -53,6 +55,88 @@ namespace etl
 {
   namespace private_hash
   {
+    //*************************************************************************
+    /// Reads an unaligned 32 bit word in native byte order.
+    //*************************************************************************
+    inline uint32_t read_32(const uint8_t* p)
+    {
+      uint32_t value;
+      memcpy(&value, p, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Word at a time 32 bit hash.
+    /// The same as MurmurHash3_x86_32 with a seed of zero, on little endian platforms.
+    //*************************************************************************
+    inline uint32_t word_hash_32(const uint8_t* begin, const uint8_t* end)
+    {
+      const uint32_t c1 = 0xCC9E2D51UL;
+      const uint32_t c2 = 0x1B873593UL;
+
+      const size_t length = static_cast<size_t>(end - begin);
+
+      uint32_t h = 0U;
+
+      while ((end - begin) >= 4)
+      {
+        uint32_t k = read_32(begin);
+
+        k *= c1;
+        k  = (k << 15U) | (k >> 17U);
+        k *= c2;
+
+        h ^= k;
+        h  = (h << 13U) | (h >> 19U);
+        h  = (h * 5U) + 0xE6546B64UL;
+
+        begin += 4;
+      }
+
+      const size_t remaining = static_cast<size_t>(end - begin);
+
+      if (remaining != 0U)
+      {
+        uint32_t k = uint32_t(begin[0]);
+
+        if (remaining >= 2U)
+        {
+          k ^= uint32_t(begin[1]) << 8U;
+        }
+
+        if (remaining == 3U)
+        {
+          k ^= uint32_t(begin[2]) << 16U;
+        }
+
+        k *= c1;
+        k  = (k << 15U) | (k >> 17U);
+        k *= c2;
+        h ^= k;
+      }
+
+      h ^= uint32_t(length);
+      h ^= h >> 16U;
+      h *= 0x85EBCA6BUL;
+      h ^= h >> 13U;
+      h *= 0xC2B2AE35UL;
+      h ^= h >> 16U;
+
+      return h;
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    /// Word at a time 64 bit hash.
+    /// The same as etl::wyhash_64 with a seed of zero.
+    //*************************************************************************
+    inline uint64_t word_hash_64(const uint8_t* begin, const uint8_t* end)
+    {
+      return etl::wyhash_64(begin, static_cast<size_t>(end - begin));
+    }
+#endif
+
     //*************************************************************************
     /// Hash to use when size_t is 16 bits.
     /// T is always expected to be size_t.
@@ -61,7 +145,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_USING_WORD_HASH
+      uint32_t h = word_hash_32(begin, end);
+#else
       uint32_t h = fnv_1a_32(begin, end);
+#endif
 
       return static_cast<size_t>(h ^ (h >> 16U));
     }
@@ -74,7 +162,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_USING_WORD_HASH
+      return word_hash_32(begin, end);
+#else
       return fnv_1a_32(begin, end);
+#endif
     }
 
 #if ETL_USING_64BIT_TYPES
@@ -86,7 +178,11 @@ namespace etl
     typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
     generic_hash(const uint8_t* begin, const uint8_t* end)
     {
+#if ETL_USING_WORD_HASH
+      return static_cast<size_t>(word_hash_64(begin, end));
+#else
       return fnv_1a_64(begin, end);
+#endif
     }
 #endif
 
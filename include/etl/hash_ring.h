@@ -0,0 +1,395 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HASH_RING_INCLUDED
+#define ETL_HASH_RING_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "algorithm.h"
+#include "hash.h"
+#include "murmur3.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup hash_ring hash_ring
+/// Consistent hashing for spreading keys over a changing set of nodes.
+///\ingroup containers
+
+namespace etl
+{
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Jump consistent hash.
+  /// Maps a key to one of 'buckets' buckets. When the number of buckets grows
+  /// from n to n + 1, only 1/(n + 1) of the keys move, and all of them move to
+  /// the new bucket. Buckets can only be added or removed at the end.
+  /// See Lamping & Veach, "A Fast, Minimal Memory, Consistent Hash Algorithm".
+  ///\param key     The key, usually the result of a hash.
+  ///\param buckets The number of buckets. Zero is treated as one.
+  ///\return The bucket, in the range [0, buckets).
+  ///\ingroup hash_ring
+  //***************************************************************************
+  inline uint32_t jump_consistent_hash(uint64_t key, uint32_t buckets)
+  {
+    int64_t b = -1;
+    int64_t j = 0;
+
+    while (j < int64_t(buckets))
+    {
+      b   = j;
+      key = (key * 2862933555777941757ULL) + 1U;
+      j   = int64_t(double(b + 1) * (double(int64_t(1) << 31) / double((key >> 33) + 1U)));
+    }
+
+    return (b < 0) ? 0U : uint32_t(b);
+  }
+#endif
+
+  //***************************************************************************
+  /// Exception for the hash_ring.
+  //***************************************************************************
+  class hash_ring_exception : public etl::exception
+  {
+  public:
+
+    hash_ring_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Raised when a node is added to a full hash_ring.
+  //***************************************************************************
+  class hash_ring_full : public etl::hash_ring_exception
+  {
+  public:
+
+    hash_ring_full(string_type file_name_, numeric_type line_number_)
+      : etl::hash_ring_exception(ETL_ERROR_TEXT("hash_ring:full", ETL_HASH_RING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Raised when a key is looked up in an empty hash_ring.
+  //***************************************************************************
+  class hash_ring_empty : public etl::hash_ring_exception
+  {
+  public:
+
+    hash_ring_empty(string_type file_name_, numeric_type line_number_)
+      : etl::hash_ring_exception(ETL_ERROR_TEXT("hash_ring:empty", ETL_HASH_RING_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A fixed capacity consistent hash ring.
+  /// Each node is placed on a 32 bit ring at VVirtual_Nodes points. A key is
+  /// owned by the node at the first point at or after the key's hash, wrapping
+  /// at the top of the ring. Adding or removing a node only moves the keys
+  /// at its own points; every other key keeps its node.
+  /// The points are held sorted in an etl::array, so lookups are a binary
+  /// search, O(log(VNodes * VVirtual_Nodes)).
+  /// Node and key hashes are etl::hash, mixed with murmur3.
+  ///\tparam VNodes         The maximum number of nodes.
+  ///\tparam VVirtual_Nodes The number of points per node.
+  ///\tparam TNode          The node identifier. Must be default constructible,
+  ///                       equality comparable and hashable by etl::hash.
+  ///\ingroup hash_ring
+  //***************************************************************************
+  template <size_t VNodes, size_t VVirtual_Nodes, typename TNode = uint32_t>
+  class hash_ring
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VNodes > 0U, "hash_ring must have at least one node");
+    ETL_STATIC_ASSERT(VVirtual_Nodes > 0U, "hash_ring must have at least one virtual node");
+
+    typedef TNode    node_type;
+    typedef size_t   size_type;
+    typedef uint32_t hash_type;
+
+    static ETL_CONSTANT size_t Max_Nodes     = VNodes;
+    static ETL_CONSTANT size_t Virtual_Nodes = VVirtual_Nodes;
+    static ETL_CONSTANT size_t Max_Points    = VNodes * VVirtual_Nodes;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    hash_ring()
+      : node_count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a node to the ring.
+    /// Emits hash_ring_full if the ring is full.
+    ///\return <b>true</b> if the node was added, <b>false</b> if it was
+    /// already present or the ring is full.
+    //*************************************************************************
+    bool add(const TNode& node)
+    {
+      if (contains(node))
+      {
+        return false;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(hash_ring_full), false);
+
+      const hash_type node_hash = hash_value(node);
+
+      point* const first = points.begin();
+      point*       last  = first + point_count();
+
+      for (size_t replica = 0U; replica < VVirtual_Nodes; ++replica)
+      {
+        const point p = { hash_point(node_hash, replica), node };
+
+        point* position = etl::upper_bound(first, last, p.position, compare_point());
+
+        etl::copy_backward(position, last, last + 1);
+        *position = p;
+        ++last;
+      }
+
+      nodes[node_count] = node;
+      ++node_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes a node from the ring.
+    ///\return <b>true</b> if the node was removed, <b>false</b> if it was not
+    /// present.
+    //*************************************************************************
+    bool remove(const TNode& node)
+    {
+      TNode* const first_node = nodes.begin();
+      TNode* const last_node  = first_node + node_count;
+      TNode* const itr        = etl::find(first_node, last_node, node);
+
+      if (itr == last_node)
+      {
+        return false;
+      }
+
+      // Compact the remaining points, keeping their order.
+      point* const first = points.begin();
+      point* const last  = first + point_count();
+      point* destination = first;
+
+      for (point* source = first; source != last; ++source)
+      {
+        if (!(source->node == node))
+        {
+          *destination++ = *source;
+        }
+      }
+
+      etl::copy(itr + 1, last_node, itr);
+      --node_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the node that owns the key.
+    /// Emits hash_ring_empty if the ring has no nodes.
+    //*************************************************************************
+    template <typename TKey>
+    const TNode& get(const TKey& key) const
+    {
+      return get_from_hash(hash_value(key));
+    }
+
+    //*************************************************************************
+    /// Gets the node that owns the position on the ring.
+    /// Emits hash_ring_empty if the ring has no nodes.
+    //*************************************************************************
+    const TNode& get_from_hash(hash_type hash) const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(hash_ring_empty));
+
+      const point* const first = points.begin();
+      const point* const last  = first + point_count();
+
+      const point* position = etl::lower_bound(first, last, hash, compare_point());
+
+      // Wrap around the top of the ring.
+      if (position == last)
+      {
+        position = first;
+      }
+
+      return position->node;
+    }
+
+    //*************************************************************************
+    /// Is the node in the ring?
+    //*************************************************************************
+    bool contains(const TNode& node) const
+    {
+      const TNode* const first = nodes.begin();
+      const TNode* const last  = first + node_count;
+
+      return etl::find(first, last, node) != last;
+    }
+
+    //*************************************************************************
+    /// Gets the n'th node, in the order that they were added.
+    //*************************************************************************
+    const TNode& node(size_t index) const
+    {
+      return nodes[index];
+    }
+
+    //*************************************************************************
+    /// Removes all of the nodes.
+    //*************************************************************************
+    void clear()
+    {
+      node_count = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of nodes.
+    //*************************************************************************
+    size_t size() const
+    {
+      return node_count;
+    }
+
+    //*************************************************************************
+    /// The number of points on the ring.
+    //*************************************************************************
+    size_t point_count() const
+    {
+      return node_count * VVirtual_Nodes;
+    }
+
+    //*************************************************************************
+    /// Are there no nodes?
+    //*************************************************************************
+    bool empty() const
+    {
+      return node_count == 0U;
+    }
+
+    //*************************************************************************
+    /// Is the ring full?
+    //*************************************************************************
+    bool full() const
+    {
+      return node_count == VNodes;
+    }
+
+    //*************************************************************************
+    /// The maximum number of nodes.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return VNodes;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A point on the ring.
+    //*************************************************************************
+    struct point
+    {
+      hash_type position;
+      TNode     node;
+    };
+
+    //*************************************************************************
+    /// Orders points by their position on the ring.
+    //*************************************************************************
+    struct compare_point
+    {
+      bool operator()(const point& lhs, hash_type rhs) const
+      {
+        return lhs.position < rhs;
+      }
+
+      bool operator()(hash_type lhs, const point& rhs) const
+      {
+        return lhs < rhs.position;
+      }
+    };
+
+    //*************************************************************************
+    /// Mixes etl::hash of the value with murmur3, as etl::hash of an integral
+    /// type may be the value itself.
+    //*************************************************************************
+    template <typename T>
+    static hash_type hash_value(const T& value)
+    {
+      const size_t hash = etl::hash<T>()(value);
+      const uint8_t* const p = reinterpret_cast<const uint8_t*>(&hash);
+
+      return etl::murmur3<hash_type>(p, p + sizeof(hash)).value();
+    }
+
+    //*************************************************************************
+    /// The position of a node's n'th point.
+    //*************************************************************************
+    static hash_type hash_point(hash_type node_hash, size_t replica)
+    {
+      const uint8_t* const p = reinterpret_cast<const uint8_t*>(&node_hash);
+
+      return etl::murmur3<hash_type>(p, p + sizeof(node_hash), static_cast<hash_type>(replica)).value();
+    }
+
+    etl::array<point, Max_Points> points; ///< Sorted by position.
+    etl::array<TNode, VNodes>     nodes;  ///< In the order that they were added.
+    size_t                        node_count;
+  };
+
+  template <size_t VNodes, size_t VVirtual_Nodes, typename TNode>
+  ETL_CONSTANT size_t hash_ring<VNodes, VVirtual_Nodes, TNode>::Max_Nodes;
+
+  template <size_t VNodes, size_t VVirtual_Nodes, typename TNode>
+  ETL_CONSTANT size_t hash_ring<VNodes, VVirtual_Nodes, TNode>::Virtual_Nodes;
+
+  template <size_t VNodes, size_t VVirtual_Nodes, typename TNode>
+  ETL_CONSTANT size_t hash_ring<VNodes, VVirtual_Nodes, TNode>::Max_Points;
+}
+
+#endif
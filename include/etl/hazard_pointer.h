@@ -0,0 +1,317 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HAZARD_POINTER_INCLUDED
+#define ETL_HAZARD_POINTER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "ipool.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+///\defgroup hazard_pointer hazard_pointer
+/// Safe memory reclamation for lock-free linked structures, using hazard pointers.
+/// Each thread or interrupt context that reads shared nodes acquires a slot.
+/// Before dereferencing a node it publishes the pointer in one of its slot's
+/// hazards. A node that has been unlinked is retired rather than released, and
+/// it is only returned to its etl::ipool once no hazard refers to it.
+///\ingroup memory
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup hazard_pointer
+  /// A fixed size hazard pointer domain.
+  /// Does not allocate. The nodes are destroyed in, and released to, the pool
+  /// given to the constructor. The pool's release must be safe to call from
+  /// each context that retires nodes.
+  ///\tparam VSlots   The maximum number of contexts that may use the domain at once.
+  ///\tparam VHazards The number of hazards per slot.
+  ///\tparam VRetired The number of retired nodes that a slot may hold before it scans.
+  //***************************************************************************
+  template <size_t VSlots, size_t VHazards = 2U, size_t VRetired = 2U * VSlots * VHazards>
+  class hazard_pointer_domain
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSlots > 0U,   "There must be at least one slot");
+    ETL_STATIC_ASSERT(VHazards > 0U, "There must be at least one hazard per slot");
+    ETL_STATIC_ASSERT(VRetired > (VSlots * VHazards), "The retired list must be larger than the total number of hazards");
+
+    typedef size_t slot_type;
+
+    static ETL_CONSTANT size_t    Slots   = VSlots;
+    static ETL_CONSTANT size_t    Hazards = VHazards;
+    static ETL_CONSTANT size_t    Retired = VRetired;
+    static ETL_CONSTANT slot_type No_Slot = etl::integral_limits<slot_type>::max;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool that the nodes were allocated from.
+    //*************************************************************************
+    explicit hazard_pointer_domain(etl::ipool& pool_)
+      : pool(pool_)
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        in_use[i].store(false);
+        retired_count[i] = 0U;
+
+        for (size_t h = 0U; h < VHazards; ++h)
+        {
+          hazards[i][h].store(ETL_NULLPTR);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Reclaims all of the retired nodes.
+    /// No context may still be using the domain.
+    //*************************************************************************
+    ~hazard_pointer_domain()
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        clear_all(i);
+      }
+
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        scan(i);
+      }
+    }
+
+    //*************************************************************************
+    /// Acquires a slot for the calling context.
+    ///\return The slot, or No_Slot if they are all in use.
+    //*************************************************************************
+    slot_type acquire_slot()
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        bool expected = false;
+
+        if (in_use[i].compare_exchange_strong(expected, true))
+        {
+          return i;
+        }
+      }
+
+      return No_Slot;
+    }
+
+    //*************************************************************************
+    /// Releases a slot.
+    /// Clears its hazards and reclaims what it can. Any nodes that are still
+    /// hazardous stay with the slot for its next owner.
+    //*************************************************************************
+    void release_slot(slot_type slot)
+    {
+      clear_all(slot);
+      scan(slot);
+      in_use[slot].store(false);
+    }
+
+    //*************************************************************************
+    /// Reads a shared pointer and protects the node it points to.
+    /// The node may be safely dereferenced until the hazard is cleared or reused.
+    ///\param slot   The caller's slot.
+    ///\param index  The hazard to use.
+    ///\param source The shared pointer.
+    //*************************************************************************
+    template <typename T>
+    T* protect(slot_type slot, size_t index, const etl::atomic<T*>& source)
+    {
+      T* p = source.load();
+
+      while (true)
+      {
+        hazards[slot][index].store(p);
+
+        // Still the same once the hazard is visible?
+        T* p_check = source.load();
+
+        if (p_check == p)
+        {
+          return p;
+        }
+
+        p = p_check;
+      }
+    }
+
+    //*************************************************************************
+    /// Clears a hazard.
+    //*************************************************************************
+    void clear(slot_type slot, size_t index)
+    {
+      hazards[slot][index].store(ETL_NULLPTR, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Clears all of a slot's hazards.
+    //*************************************************************************
+    void clear_all(slot_type slot)
+    {
+      for (size_t h = 0U; h < VHazards; ++h)
+      {
+        clear(slot, h);
+      }
+    }
+
+    //*************************************************************************
+    /// Retires a node that has been unlinked from the shared structure.
+    /// It is destroyed once no hazard refers to it.
+    //*************************************************************************
+    template <typename T>
+    void retire(slot_type slot, T* p_node)
+    {
+      if (retired_count[slot] == VRetired)
+      {
+        scan(slot);
+      }
+
+      retired_node& node = retired[slot][retired_count[slot]++];
+      node.p_node    = p_node;
+      node.destroyer = &destroy_node<T>;
+
+      if (retired_count[slot] == VRetired)
+      {
+        scan(slot);
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys the slot's retired nodes that are not hazardous.
+    ///\return The number of nodes destroyed.
+    //*************************************************************************
+    size_t scan(slot_type slot)
+    {
+      size_t kept      = 0U;
+      size_t reclaimed = 0U;
+
+      for (size_t i = 0U; i < retired_count[slot]; ++i)
+      {
+        retired_node& node = retired[slot][i];
+
+        if (is_hazardous(node.p_node))
+        {
+          retired[slot][kept++] = node;
+        }
+        else
+        {
+          node.destroyer(pool, node.p_node);
+          ++reclaimed;
+        }
+      }
+
+      retired_count[slot] = kept;
+
+      return reclaimed;
+    }
+
+    //*************************************************************************
+    /// The number of nodes retired by a slot and not yet destroyed.
+    //*************************************************************************
+    size_t retired_size(slot_type slot) const
+    {
+      return retired_count[slot];
+    }
+
+  private:
+
+    typedef void (*destroyer_type)(etl::ipool&, const void*);
+
+    //*************************************************************************
+    struct retired_node
+    {
+      const void*    p_node;
+      destroyer_type destroyer;
+    };
+
+    //*************************************************************************
+    template <typename T>
+    static void destroy_node(etl::ipool& pool_, const void* p_node)
+    {
+      pool_.destroy(static_cast<const T*>(p_node));
+    }
+
+    //*************************************************************************
+    bool is_hazardous(const void* p_node) const
+    {
+      for (size_t i = 0U; i < VSlots; ++i)
+      {
+        for (size_t h = 0U; h < VHazards; ++h)
+        {
+          if (hazards[i][h].load() == p_node)
+          {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    etl::ipool& pool;
+
+    etl::atomic<const void*> hazards[VSlots][VHazards];
+    etl::atomic<bool>        in_use[VSlots];
+
+    // Only used by the slot's owner.
+    retired_node retired[VSlots][VRetired];
+    size_t       retired_count[VSlots];
+
+    // Disabled.
+    hazard_pointer_domain(const hazard_pointer_domain&) ETL_DELETE;
+    hazard_pointer_domain& operator =(const hazard_pointer_domain&) ETL_DELETE;
+  };
+
+  template <size_t VSlots, size_t VHazards, size_t VRetired>
+  ETL_CONSTANT size_t hazard_pointer_domain<VSlots, VHazards, VRetired>::Slots;
+
+  template <size_t VSlots, size_t VHazards, size_t VRetired>
+  ETL_CONSTANT size_t hazard_pointer_domain<VSlots, VHazards, VRetired>::Hazards;
+
+  template <size_t VSlots, size_t VHazards, size_t VRetired>
+  ETL_CONSTANT size_t hazard_pointer_domain<VSlots, VHazards, VRetired>::Retired;
+
+  template <size_t VSlots, size_t VHazards, size_t VRetired>
+  ETL_CONSTANT typename hazard_pointer_domain<VSlots, VHazards, VRetired>::slot_type hazard_pointer_domain<VSlots, VHazards, VRetired>::No_Slot;
+}
+
+#endif
+#endif
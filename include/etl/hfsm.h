@@ -42,12 +42,62 @@ namespace etl
   {
   public:
 
+    //*******************************************
+    /// An entry in the transition cache.
+    /// Records the common ancestor for a source and target state.
+    //*******************************************
+    struct transition_cache_entry
+    {
+      const etl::ifsm_state* p_source;
+      const etl::ifsm_state* p_target;
+      etl::ifsm_state*       p_root;
+    };
+
     //*******************************************
     /// Constructor.
     //*******************************************
     hfsm(etl::message_router_id_t id)
       : fsm(id)
+      , p_cache(ETL_NULLPTR)
+      , cache_size(0U)
+    {
+    }
+
+    //*******************************************
+    /// Sets a buffer used to cache the common ancestor of recent transitions.
+    /// A cached transition replays its exits and entries without searching
+    /// the hierarchy for the common ancestor.
+    /// The cache is direct mapped on the source and target state ids.
+    /// Call clear_transition_cache() after changing the state hierarchy.
+    //*******************************************
+    void set_transition_cache(transition_cache_entry* p_entries, size_t size)
+    {
+      p_cache    = p_entries;
+      cache_size = (p_entries == ETL_NULLPTR) ? 0U : size;
+
+      clear_transition_cache();
+    }
+
+    //*******************************************
+    /// Sets an array used to cache the common ancestor of recent transitions.
+    //*******************************************
+    template <size_t Size>
+    void set_transition_cache(transition_cache_entry (&entries)[Size])
+    {
+      set_transition_cache(entries, Size);
+    }
+
+    //*******************************************
+    /// Clears the transition cache.
+    //*******************************************
+    void clear_transition_cache()
     {
+      for (size_t i = 0U; i < cache_size; ++i)
+      {
+        p_cache[i].p_source = ETL_NULLPTR;
+        p_cache[i].p_target = ETL_NULLPTR;
+        p_cache[i].p_root   = ETL_NULLPTR;
+      }
     }
 
     //*******************************************
@@ -108,7 +158,7 @@ namespace etl
         // Have we changed state?
         if (p_next_state != p_state)
         {
-          etl::ifsm_state* p_root = common_ancestor(p_state, p_next_state);
+          etl::ifsm_state* p_root = find_common_ancestor(p_state, p_next_state);
           do_exits(p_root, p_state);
 
           p_state = p_next_state;
@@ -126,6 +176,31 @@ namespace etl
 
   private:
 
+    //*******************************************
+    /// Return the first common ancestor of the two states, from the cache if
+    /// there is one.
+    //*******************************************
+    etl::ifsm_state* find_common_ancestor(etl::ifsm_state* p_source, etl::ifsm_state* p_target)
+    {
+      if (cache_size == 0U)
+      {
+        return common_ancestor(p_source, p_target);
+      }
+
+      const size_t index = ((size_t(p_source->get_state_id()) * size_t(number_of_states)) + size_t(p_target->get_state_id())) % cache_size;
+
+      transition_cache_entry& entry = p_cache[index];
+
+      if ((entry.p_source != p_source) || (entry.p_target != p_target))
+      {
+        entry.p_source = p_source;
+        entry.p_target = p_target;
+        entry.p_root   = common_ancestor(p_source, p_target);
+      }
+
+      return entry.p_root;
+    }
+
     //*******************************************
     /// Return the first common ancestor of the two states.
     //*******************************************
@@ -244,6 +319,9 @@ namespace etl
         p_current = p_current->p_parent;
       }
     }
+
+    transition_cache_entry* p_cache;    ///< The transition cache, or null.
+    size_t                  cache_size; ///< The number of entries in the transition cache.
   };
 }
 #endif
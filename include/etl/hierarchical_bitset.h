@@ -0,0 +1,512 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HIERARCHICAL_BITSET_INCLUDED
+#define ETL_HIERARCHICAL_BITSET_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "integral_limits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup hierarchical_bitset hierarchical_bitset
+/// A fixed size bitset that keeps summary bitmaps of its 64 bit words.
+/// For each word, one summary bit records whether it has any bit set and
+/// another records whether it has any bit clear. A single top word summarises
+/// each summary word in the same way.
+/// find_first and find_next jump straight to the next word that can contain a
+/// match, so they take at most three word lookups at any size, at the cost of
+/// a few extra word updates for each modification.
+/// Up to 64 * 64 * 64 (262144) bits are supported.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_USING_64BIT_TYPES
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the hierarchical_bitset.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  class hierarchical_bitset_exception : public etl::exception
+  {
+  public:
+
+    hierarchical_bitset_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the hierarchical_bitset.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  class hierarchical_bitset_out_of_range : public etl::hierarchical_bitset_exception
+  {
+  public:
+
+    hierarchical_bitset_out_of_range(string_type file_name_, numeric_type line_number_)
+      : etl::hierarchical_bitset_exception(ETL_ERROR_TEXT("hierarchical_bitset:out of range", ETL_HIERARCHICAL_BITSET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A bitset with summary bitmaps for fast searches.
+  ///\tparam Active_Bits The number of bits.
+  ///\ingroup hierarchical_bitset
+  //***************************************************************************
+  template <size_t Active_Bits>
+  class hierarchical_bitset
+  {
+  public:
+
+    static ETL_CONSTANT size_t npos = etl::integral_limits<size_t>::max;
+
+    static ETL_CONSTANT size_t Bits_Per_Word   = 64U;
+    static ETL_CONSTANT size_t Number_Of_Words = (Active_Bits + Bits_Per_Word - 1U) / Bits_Per_Word;
+    static ETL_CONSTANT size_t Summary_Words   = (Number_Of_Words + Bits_Per_Word - 1U) / Bits_Per_Word;
+
+    ETL_STATIC_ASSERT(Active_Bits > 0U, "hierarchical_bitset must have at least one bit");
+    ETL_STATIC_ASSERT(Summary_Words <= Bits_Per_Word, "hierarchical_bitset supports up to 262144 bits");
+
+    //*************************************************************************
+    /// Default constructor. All bits are clear.
+    //*************************************************************************
+    hierarchical_bitset()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// The number of bits.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t size()
+    {
+      return Active_Bits;
+    }
+
+    //*************************************************************************
+    /// Tests a bit.
+    //*************************************************************************
+    bool test(size_t position) const
+    {
+      ETL_ASSERT(position < Active_Bits, ETL_ERROR(etl::hierarchical_bitset_out_of_range));
+
+      return (words[position / Bits_Per_Word] & bit_mask(position % Bits_Per_Word)) != 0U;
+    }
+
+    //*************************************************************************
+    /// Tests a bit.
+    //*************************************************************************
+    bool operator [](size_t position) const
+    {
+      return test(position);
+    }
+
+    //*************************************************************************
+    /// Sets all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& set()
+    {
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        words[i] = word_mask(i);
+      }
+
+      rebuild_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Sets a bit to a value.
+    //*************************************************************************
+    hierarchical_bitset& set(size_t position, bool value = true)
+    {
+      ETL_ASSERT(position < Active_Bits, ETL_ERROR(etl::hierarchical_bitset_out_of_range));
+
+      const size_t   index = position / Bits_Per_Word;
+      const uint64_t mask  = bit_mask(position % Bits_Per_Word);
+
+      if (value)
+      {
+        words[index] |= mask;
+      }
+      else
+      {
+        words[index] &= ~mask;
+      }
+
+      update_summaries(index);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Clears all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& reset()
+    {
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        words[i] = 0U;
+      }
+
+      rebuild_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Clears a bit.
+    //*************************************************************************
+    hierarchical_bitset& reset(size_t position)
+    {
+      return set(position, false);
+    }
+
+    //*************************************************************************
+    /// Flips all of the bits.
+    //*************************************************************************
+    hierarchical_bitset& flip()
+    {
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        words[i] = ~words[i] & word_mask(i);
+      }
+
+      rebuild_summaries();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Flips a bit.
+    //*************************************************************************
+    hierarchical_bitset& flip(size_t position)
+    {
+      ETL_ASSERT(position < Active_Bits, ETL_ERROR(etl::hierarchical_bitset_out_of_range));
+
+      const size_t index = position / Bits_Per_Word;
+
+      words[index] ^= bit_mask(position % Bits_Per_Word);
+
+      update_summaries(index);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The number of bits set.
+    /// Only the words that the summary marks as non-zero are counted.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t n = 0U;
+
+      for (size_t s = 0U; s < Summary_Words; ++s)
+      {
+        uint64_t summary = set_summary[s];
+
+        while (summary != 0U)
+        {
+          n += etl::count_bits(words[(s * Bits_Per_Word) + etl::count_trailing_zeros(summary)]);
+          summary &= summary - 1U;
+        }
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Are any of the bits set?
+    //*************************************************************************
+    bool any() const
+    {
+      return set_top != 0U;
+    }
+
+    //*************************************************************************
+    /// Are none of the bits set?
+    //*************************************************************************
+    bool none() const
+    {
+      return set_top == 0U;
+    }
+
+    //*************************************************************************
+    /// Are all of the bits set?
+    //*************************************************************************
+    bool all() const
+    {
+      return clear_top == 0U;
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state.
+    ///\param state The state to search for.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_first(bool state) const
+    {
+      return find_from_word(state, 0U);
+    }
+
+    //*************************************************************************
+    /// Finds the next bit in the specified state.
+    ///\param state    The state to search for.
+    ///\param position The position to start from.
+    ///\returns The position of the bit or npos if none were found.
+    //*************************************************************************
+    size_t find_next(bool state, size_t position) const
+    {
+      if (position >= Active_Bits)
+      {
+        return npos;
+      }
+
+      const size_t index = position / Bits_Per_Word;
+
+      // Check the rest of the starting word.
+      const uint64_t value = word_state(index, state) & (~uint64_t(0U) << (position % Bits_Per_Word));
+
+      if (value != 0U)
+      {
+        return (index * Bits_Per_Word) + etl::count_trailing_zeros(value);
+      }
+
+      return find_from_word(state, index + 1U);
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    friend bool operator ==(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        if (lhs.words[i] != rhs.words[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    friend bool operator !=(const hierarchical_bitset& lhs, const hierarchical_bitset& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t   Last_Word_Bits = Active_Bits - ((Number_Of_Words - 1U) * Bits_Per_Word);
+    static ETL_CONSTANT uint64_t Last_Word_Mask = (Last_Word_Bits == Bits_Per_Word) ? ~uint64_t(0U)
+                                                                                    : ((uint64_t(1U) << (Last_Word_Bits % Bits_Per_Word)) - 1U);
+
+    //*************************************************************************
+    /// A mask for a single bit.
+    //*************************************************************************
+    static uint64_t bit_mask(size_t bit)
+    {
+      return uint64_t(1U) << bit;
+    }
+
+    //*************************************************************************
+    /// The mask of the valid bits in a word.
+    //*************************************************************************
+    static uint64_t word_mask(size_t index)
+    {
+      return (index == (Number_Of_Words - 1U)) ? Last_Word_Mask : ~uint64_t(0U);
+    }
+
+    //*************************************************************************
+    /// A word, with the bits in the searched for state set.
+    //*************************************************************************
+    uint64_t word_state(size_t index, bool state) const
+    {
+      return state ? words[index] : (~words[index] & word_mask(index));
+    }
+
+    //*************************************************************************
+    /// Finds the first bit in the specified state, starting at a word.
+    //*************************************************************************
+    size_t find_from_word(bool state, size_t index) const
+    {
+      if (index >= Number_Of_Words)
+      {
+        return npos;
+      }
+
+      const uint64_t* summary = state ? set_summary : clear_summary;
+
+      size_t   s     = index / Bits_Per_Word;
+      uint64_t value = summary[s] & (~uint64_t(0U) << (index % Bits_Per_Word));
+
+      // Nothing in this summary word, so find the next one from the top word.
+      if (value == 0U)
+      {
+        if (++s >= Summary_Words)
+        {
+          return npos;
+        }
+
+        const uint64_t top = (state ? set_top : clear_top) & (~uint64_t(0U) << s);
+
+        if (top == 0U)
+        {
+          return npos;
+        }
+
+        s     = etl::count_trailing_zeros(top);
+        value = summary[s];
+      }
+
+      index = (s * Bits_Per_Word) + etl::count_trailing_zeros(value);
+
+      return (index * Bits_Per_Word) + etl::count_trailing_zeros(word_state(index, state));
+    }
+
+    //*************************************************************************
+    /// Updates the summaries after a word has changed.
+    //*************************************************************************
+    void update_summaries(size_t index)
+    {
+      const size_t   s    = index / Bits_Per_Word;
+      const uint64_t mask = bit_mask(index % Bits_Per_Word);
+
+      if (words[index] != 0U)
+      {
+        set_summary[s] |= mask;
+      }
+      else
+      {
+        set_summary[s] &= ~mask;
+      }
+
+      if (words[index] != word_mask(index))
+      {
+        clear_summary[s] |= mask;
+      }
+      else
+      {
+        clear_summary[s] &= ~mask;
+      }
+
+      update_top(s);
+    }
+
+    //*************************************************************************
+    /// Updates the top words after a summary word has changed.
+    //*************************************************************************
+    void update_top(size_t s)
+    {
+      const uint64_t mask = bit_mask(s);
+
+      set_top   = (set_summary[s]   != 0U) ? (set_top   | mask) : (set_top   & ~mask);
+      clear_top = (clear_summary[s] != 0U) ? (clear_top | mask) : (clear_top & ~mask);
+    }
+
+    //*************************************************************************
+    /// Rebuilds all of the summaries from the words.
+    //*************************************************************************
+    void rebuild_summaries()
+    {
+      for (size_t s = 0U; s < Summary_Words; ++s)
+      {
+        set_summary[s]   = 0U;
+        clear_summary[s] = 0U;
+      }
+
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        const uint64_t mask = bit_mask(i % Bits_Per_Word);
+
+        if (words[i] != 0U)
+        {
+          set_summary[i / Bits_Per_Word] |= mask;
+        }
+
+        if (words[i] != word_mask(i))
+        {
+          clear_summary[i / Bits_Per_Word] |= mask;
+        }
+      }
+
+      set_top   = 0U;
+      clear_top = 0U;
+
+      for (size_t s = 0U; s < Summary_Words; ++s)
+      {
+        update_top(s);
+      }
+    }
+
+    uint64_t words[Number_Of_Words];
+    uint64_t set_summary[Summary_Words];
+    uint64_t clear_summary[Summary_Words];
+    uint64_t set_top;
+    uint64_t clear_top;
+  };
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::npos;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Bits_Per_Word;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Number_Of_Words;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Summary_Words;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT size_t hierarchical_bitset<Active_Bits>::Last_Word_Bits;
+
+  template <size_t Active_Bits>
+  ETL_CONSTANT uint64_t hierarchical_bitset<Active_Bits>::Last_Word_Mask;
+}
+
+#endif
+#endif
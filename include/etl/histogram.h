@@ -39,6 +39,10 @@ SOFTWARE.
 #include "static_assert.h"
 #include "type_traits.h"
 #include "integral_limits.h"
+#include "iterator.h"
+#include "bit.h"
+#include "log.h"
+#include "power.h"
 
 namespace etl
 {
@@ -122,6 +126,16 @@ namespace etl
         return etl::accumulate(accumulator.begin(), accumulator.end(), size_t(0));
       }
 
+      //*********************************
+      /// Adds a number of counts to a bin.
+      /// The bin index is the key less the start index.
+      /// For merging histograms gathered elsewhere.
+      //*********************************
+      void add_to_bin(size_t index, TCount n)
+      {
+        accumulator[index] = TCount(accumulator[index] + n);
+      }
+
     protected:
 
       etl::array<TCount, Max_Size> accumulator;
@@ -294,6 +308,7 @@ namespace etl
     /// Copy constructor
     //*********************************
     histogram(const histogram& other)
+      : start_index(other.start_index)
     {
       this->accumulator = other.accumulator;
     }
@@ -303,6 +318,7 @@ namespace etl
     /// Move constructor
     //*********************************
     histogram(histogram&& other)
+      : start_index(other.start_index)
     {
       this->accumulator = etl::move(other.accumulator);
     }
@@ -313,6 +329,7 @@ namespace etl
     //*********************************
     histogram& operator =(const histogram& rhs)
     {
+      start_index       = rhs.start_index;
       this->accumulator = rhs.accumulator;
 
       return *this;
@@ -324,6 +341,7 @@ namespace etl
     //*********************************
     histogram& operator =(histogram&& rhs)
     {
+      start_index       = rhs.start_index;
       this->accumulator = etl::move(rhs.accumulator);
 
       return *this;
@@ -598,6 +616,490 @@ namespace etl
 
   template <typename TKey, typename TCount, size_t Max_Size_>
   ETL_CONSTANT size_t sparse_histogram<TKey, TCount, Max_Size_>::Max_Size;
+
+  namespace private_histogram
+  {
+    //***************************************************************************
+    /// Index of the highest set bit of V. 0 for 0 and 1.
+    //***************************************************************************
+    template <uintmax_t V>
+    struct hdr_highest_bit
+    {
+      enum value_type
+      {
+        value = 1 + hdr_highest_bit<V / 2U>::value
+      };
+    };
+
+    template <>
+    struct hdr_highest_bit<1U>
+    {
+      enum value_type
+      {
+        value = 0
+      };
+    };
+
+    template <>
+    struct hdr_highest_bit<0U>
+    {
+      enum value_type
+      {
+        value = 0
+      };
+    };
+
+    //***************************************************************************
+    /// The compile time bucket layout of an hdr_histogram.
+    /// Bucket 0 holds the values 0 to Sub_Bucket_Count - 1 at unit resolution.
+    /// Each following bucket doubles the value range and the sub-bucket width,
+    /// reusing only the upper half of its sub-buckets.
+    //***************************************************************************
+    template <uintmax_t Max_Value, size_t Significant_Digits>
+    struct hdr_histogram_layout
+    {
+      enum value_type
+      {
+        Sub_Bucket_Count = etl::power_of_2_round_up<2U * etl::power<10U, Significant_Digits>::value>::value,
+        Sub_Bucket_Half  = Sub_Bucket_Count / 2,
+        Sub_Bucket_Bits  = etl::log2<Sub_Bucket_Count>::value,
+        Highest_Bit      = hdr_highest_bit<Max_Value>::value,
+        Max_Bucket       = (Highest_Bit > (Sub_Bucket_Bits - 1)) ? Highest_Bit - (Sub_Bucket_Bits - 1) : 0,
+        Bucket_Count     = (Max_Bucket + 2) * Sub_Bucket_Half
+      };
+    };
+  }
+
+  //***************************************************************************
+  /// High dynamic range histogram.
+  /// Records unsigned values from 0 to Max_Value in log-linear buckets that
+  /// keep the relative error within Significant_Digits decimal digits.
+  /// The bucket storage is sized at compile time and the bucket for a value
+  /// is found from its count of leading zeros.
+  /// Values greater than Max_Value are recorded as Max_Value.
+  ///\tparam TValue             The unsigned value type.
+  ///\tparam TCount             The count type.
+  ///\tparam Max_Value          The highest trackable value.
+  ///\tparam Significant_Digits The number of significant decimal digits. 1 to 5.
+  //***************************************************************************
+  template <typename TValue, typename TCount, TValue Max_Value_, size_t Significant_Digits_ = 3U>
+  class hdr_histogram
+    : public etl::private_histogram::histogram_common<TCount, etl::private_histogram::hdr_histogram_layout<Max_Value_, Significant_Digits_>::Bucket_Count>
+    , public etl::unary_function<TValue, void>
+  {
+  private:
+
+    typedef etl::private_histogram::hdr_histogram_layout<Max_Value_, Significant_Digits_> layout;
+    typedef etl::private_histogram::histogram_common<TCount, layout::Bucket_Count>     base_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TValue>::value && etl::is_unsigned<TValue>::value, "Only unsigned integral values allowed");
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value, "Only integral count allowed");
+    ETL_STATIC_ASSERT((Significant_Digits_ >= 1U) && (Significant_Digits_ <= 5U), "Significant digits must be 1 to 5");
+
+    typedef TValue value_type;
+    typedef TCount count_type;
+
+    static ETL_CONSTANT value_type Max_Value          = Max_Value_;
+    static ETL_CONSTANT size_t     Significant_Digits = Significant_Digits_;
+    static ETL_CONSTANT size_t     Sub_Bucket_Count   = layout::Sub_Bucket_Count;
+    static ETL_CONSTANT size_t     Bucket_Count       = layout::Bucket_Count;
+
+    //*************************************************************************
+    /// The value presented by a percentile_iterator.
+    //*************************************************************************
+    struct percentile_value
+    {
+      value_type value;            ///< The highest value equivalent to the bucket.
+      value_type lowest_value;     ///< The lowest value equivalent to the bucket.
+      count_type count;            ///< The count of the bucket.
+      size_t     cumulative_count; ///< The count of this and all lower buckets.
+      double     percentile;       ///< The percentile reached at this bucket.
+    };
+
+    //*************************************************************************
+    /// Iterates the non-empty buckets in ascending value order.
+    //*************************************************************************
+    class percentile_iterator
+    {
+    public:
+
+      friend class hdr_histogram;
+
+      typedef ETL_OR_STD::forward_iterator_tag iterator_category;
+      typedef percentile_value                 value_type;
+      typedef ptrdiff_t                        difference_type;
+      typedef const percentile_value*          pointer;
+      typedef const percentile_value&          reference;
+
+      //*******************************
+      percentile_iterator()
+        : p_histogram(ETL_NULLPTR)
+        , index(Bucket_Count)
+        , current()
+      {
+      }
+
+      //*******************************
+      percentile_iterator& operator ++()
+      {
+        index = p_histogram->next_index(index + 1U);
+        update();
+
+        return *this;
+      }
+
+      //*******************************
+      percentile_iterator operator ++(int)
+      {
+        percentile_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*******************************
+      reference operator *() const
+      {
+        return current;
+      }
+
+      //*******************************
+      pointer operator ->() const
+      {
+        return &current;
+      }
+
+      //*******************************
+      friend bool operator ==(const percentile_iterator& lhs, const percentile_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      //*******************************
+      friend bool operator !=(const percentile_iterator& lhs, const percentile_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************
+      percentile_iterator(const hdr_histogram& histogram, size_t index_)
+        : p_histogram(&histogram)
+        , index(index_)
+        , current()
+      {
+        update();
+      }
+
+      //*******************************
+      void update()
+      {
+        if (index < Bucket_Count)
+        {
+          current.count             = p_histogram->accumulator[index];
+          current.cumulative_count += static_cast<size_t>(current.count);
+          current.lowest_value      = hdr_histogram::lowest_value_at_index(index);
+          current.value             = p_histogram->highest_value_at_index(index);
+          current.percentile        = (100.0 * static_cast<double>(current.cumulative_count)) / static_cast<double>(p_histogram->total_count);
+        }
+      }
+
+      const hdr_histogram* p_histogram;
+      size_t               index;
+      percentile_value     current;
+    };
+
+    //*********************************
+    /// Constructor
+    //*********************************
+    hdr_histogram()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor
+    //*********************************
+    template <typename TIterator>
+    hdr_histogram(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(value_type value)
+    {
+      add(value, count_type(1));
+    }
+
+    //*********************************
+    /// Add a value n times.
+    //*********************************
+    void add(value_type value, count_type n)
+    {
+      if (value > Max_Value)
+      {
+        value = Max_Value;
+      }
+
+      this->accumulator[index_of(value)] += n;
+      total_count += static_cast<size_t>(n);
+
+      if (value < min_value)
+      {
+        min_value = value;
+      }
+
+      if (value > max_value)
+      {
+        max_value = value;
+      }
+    }
+
+    //*********************************
+    /// Add a range of values.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    //*********************************
+    void operator ()(value_type value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Merge the counts of another histogram with the same layout.
+    //*********************************
+    void merge(const hdr_histogram& other)
+    {
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        this->accumulator[i] += other.accumulator[i];
+      }
+
+      total_count += other.total_count;
+
+      if (other.min_value < min_value)
+      {
+        min_value = other.min_value;
+      }
+
+      if (other.max_value > max_value)
+      {
+        max_value = other.max_value;
+      }
+    }
+
+    //*********************************
+    /// Clear the histogram.
+    //*********************************
+    void clear()
+    {
+      base_t::clear();
+      total_count = 0U;
+      min_value   = Max_Value;
+      max_value   = value_type(0);
+    }
+
+    //*********************************
+    /// Count of items in the histogram.
+    //*********************************
+    size_t count() const
+    {
+      return total_count;
+    }
+
+    //*********************************
+    /// Returns true if nothing has been added.
+    //*********************************
+    bool empty() const
+    {
+      return total_count == 0U;
+    }
+
+    //*********************************
+    /// The lowest value added. 0 if empty.
+    //*********************************
+    value_type min() const
+    {
+      return empty() ? value_type(0) : min_value;
+    }
+
+    //*********************************
+    /// The highest value added. 0 if empty.
+    //*********************************
+    value_type max() const
+    {
+      return max_value;
+    }
+
+    //*********************************
+    /// The count of values equivalent to value.
+    //*********************************
+    count_type count_at_value(value_type value) const
+    {
+      return this->accumulator[index_of(value > Max_Value ? Max_Value : value)];
+    }
+
+    //*********************************
+    /// The value of the given percentile, 0 to 100.
+    /// Returns the highest value equivalent to the bucket where the percentile
+    /// is reached, limited to the highest value added. 0 if empty.
+    //*********************************
+    value_type value_at_percentile(double percentile) const
+    {
+      if (empty())
+      {
+        return value_type(0);
+      }
+
+      percentile = (percentile < 0.0) ? 0.0 : ((percentile > 100.0) ? 100.0 : percentile);
+
+      size_t target = static_cast<size_t>(((percentile / 100.0) * static_cast<double>(total_count)) + 0.5);
+
+      if (target == 0U)
+      {
+        target = 1U;
+      }
+
+      size_t cumulative = 0U;
+
+      for (size_t i = 0U; i < Bucket_Count; ++i)
+      {
+        cumulative += static_cast<size_t>(this->accumulator[i]);
+
+        if (cumulative >= target)
+        {
+          return highest_value_at_index(i);
+        }
+      }
+
+      return max_value;
+    }
+
+    //*********************************
+    /// Iterator to the first non-empty bucket.
+    //*********************************
+    percentile_iterator percentile_begin() const
+    {
+      return percentile_iterator(*this, next_index(0U));
+    }
+
+    //*********************************
+    /// Iterator past the last non-empty bucket.
+    //*********************************
+    percentile_iterator percentile_end() const
+    {
+      return percentile_iterator(*this, Bucket_Count);
+    }
+
+    //*********************************
+    /// The bucket index for a value.
+    //*********************************
+    static size_t index_of(value_type value)
+    {
+      const value_type masked = static_cast<value_type>(value | value_type(Sub_Bucket_Count - 1U));
+      const int        bucket = (etl::integral_limits<value_type>::bits - 1 - etl::countl_zero(masked)) - (layout::Sub_Bucket_Bits - 1);
+
+      return (static_cast<size_t>(bucket) * layout::Sub_Bucket_Half) + static_cast<size_t>(value >> bucket);
+    }
+
+    //*********************************
+    /// The lowest value that shares the bucket with value.
+    //*********************************
+    static value_type lowest_equivalent_value(value_type value)
+    {
+      return lowest_value_at_index(index_of(value > Max_Value ? Max_Value : value));
+    }
+
+    //*********************************
+    /// The highest value that shares the bucket with value.
+    //*********************************
+    static value_type highest_equivalent_value(value_type value)
+    {
+      const size_t index = index_of(value > Max_Value ? Max_Value : value);
+
+      return static_cast<value_type>(lowest_value_at_index(index) + ((value_type(1) << bucket_at_index(index)) - 1U));
+    }
+
+  private:
+
+    //*********************************
+    static size_t bucket_at_index(size_t index)
+    {
+      return (index < Sub_Bucket_Count) ? 0U : (index / layout::Sub_Bucket_Half) - 1U;
+    }
+
+    //*********************************
+    static value_type lowest_value_at_index(size_t index)
+    {
+      const size_t bucket = bucket_at_index(index);
+
+      return static_cast<value_type>(value_type(index - (bucket * layout::Sub_Bucket_Half)) << bucket);
+    }
+
+    //*********************************
+    value_type highest_value_at_index(size_t index) const
+    {
+      const size_t     bucket  = bucket_at_index(index);
+      const value_type lowest  = lowest_value_at_index(index);
+      const value_type highest = static_cast<value_type>(lowest + ((value_type(1) << bucket) - 1U));
+
+      return (highest > max_value) ? max_value : highest;
+    }
+
+    //*********************************
+    size_t next_index(size_t index) const
+    {
+      while ((index < Bucket_Count) && (this->accumulator[index] == count_type(0)))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    size_t     total_count;
+    value_type min_value;
+    value_type max_value;
+  };
+
+  template <typename TValue, typename TCount, TValue Max_Value_, size_t Significant_Digits_>
+  ETL_CONSTANT TValue hdr_histogram<TValue, TCount, Max_Value_, Significant_Digits_>::Max_Value;
+
+  template <typename TValue, typename TCount, TValue Max_Value_, size_t Significant_Digits_>
+  ETL_CONSTANT size_t hdr_histogram<TValue, TCount, Max_Value_, Significant_Digits_>::Significant_Digits;
+
+  template <typename TValue, typename TCount, TValue Max_Value_, size_t Significant_Digits_>
+  ETL_CONSTANT size_t hdr_histogram<TValue, TCount, Max_Value_, Significant_Digits_>::Sub_Bucket_Count;
+
+  template <typename TValue, typename TCount, TValue Max_Value_, size_t Significant_Digits_>
+  ETL_CONSTANT size_t hdr_histogram<TValue, TCount, Max_Value_, Significant_Digits_>::Bucket_Count;
 }
 
 #endif
@@ -0,0 +1,467 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HYBRID_MESSAGE_PACKET_INCLUDED
+#define ETL_HYBRID_MESSAGE_PACKET_INCLUDED
+
+#include "platform.h"
+
+#if ETL_HAS_VIRTUAL_MESSAGES && ETL_USING_CPP17
+
+#include "message.h"
+#include "shared_message.h"
+#include "ireference_counted_message_pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "file_error_numbers.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "alignment.h"
+#include "utility.h"
+
+#include <stdint.h>
+
+///\defgroup hybrid_message_packet hybrid_message_packet
+/// A message packet that stores small messages inline and large messages in a pool.
+///\ingroup messaging
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for hybrid_message_packet.
+  ///\ingroup hybrid_message_packet
+  //***************************************************************************
+  class hybrid_message_packet_exception : public etl::exception
+  {
+  public:
+
+    hybrid_message_packet_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A large message was added before a pool was set.
+  ///\ingroup hybrid_message_packet
+  //***************************************************************************
+  class hybrid_message_packet_no_pool : public etl::hybrid_message_packet_exception
+  {
+  public:
+
+    hybrid_message_packet_no_pool(string_type file_name_, numeric_type line_number_)
+      : hybrid_message_packet_exception(ETL_ERROR_TEXT("hybrid_message_packet:no pool", ETL_HYBRID_MESSAGE_PACKET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A message packet with the same interface as etl::message_packet.
+  /// Messages no larger than Max_Inline_Size are stored in the packet.
+  /// Larger messages are stored in an etl::shared_message allocated from a
+  /// pool, so the packet is only as large as its largest small message or an
+  /// etl::shared_message, whichever is larger.
+  /// Moving a packet that holds a large message transfers the shared message.
+  /// Copying it allocates a new copy from the pool.
+  ///\tparam TPool           The pool type. Must have allocate(const TMessage&), like etl::reference_counted_message_pool.
+  ///\tparam Max_Inline_Size The largest message size that is stored in the packet.
+  ///\tparam TMessageTypes   The message types.
+  ///\ingroup hybrid_message_packet
+  //***************************************************************************
+  template <typename TPool, size_t Max_Inline_Size, typename... TMessageTypes>
+  class hybrid_message_packet
+  {
+  private:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<etl::ireference_counted_message_pool, TPool>::value), "TPool not derived from etl::ireference_counted_message_pool");
+
+    template <typename T>
+    static constexpr bool IsMessagePacket = etl::is_same_v<etl::remove_cvref_t<T>, hybrid_message_packet>;
+
+    template <typename T>
+    static constexpr bool IsInMessageList = etl::is_one_of_v<etl::remove_cvref_t<T>, TMessageTypes...>;
+
+    template <typename T>
+    static constexpr bool IsIMessage = etl::is_same_v<etl::remove_cvref_t<T>, etl::imessage>;
+
+    //**********************************************
+    static constexpr size_t storage_size()
+    {
+      size_t size = sizeof(etl::shared_message);
+      ((size = ((sizeof(TMessageTypes) <= Max_Inline_Size) && (sizeof(TMessageTypes) > size)) ? sizeof(TMessageTypes) : size), ...);
+      return size;
+    }
+
+    //**********************************************
+    static constexpr size_t storage_alignment()
+    {
+      size_t alignment = etl::alignment_of<etl::shared_message>::value;
+      ((alignment = ((sizeof(TMessageTypes) <= Max_Inline_Size) && (etl::alignment_of<TMessageTypes>::value > alignment)) ? etl::alignment_of<TMessageTypes>::value : alignment), ...);
+      return alignment;
+    }
+
+  public:
+
+    typedef TPool pool_type;
+
+    //**********************************************
+    /// Is the message type stored in the packet?
+    //**********************************************
+    template <typename TMessage>
+    static constexpr bool Is_Inline = (sizeof(TMessage) <= Max_Inline_Size);
+
+    enum
+    {
+      SIZE      = storage_size(),
+      ALIGNMENT = storage_alignment()
+    };
+
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    hybrid_message_packet()
+      : state(Empty)
+    {
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Construct from a message.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename T, typename = etl::enable_if_t<!IsMessagePacket<T>>>
+    explicit hybrid_message_packet(T&& msg)
+      : state(Empty)
+    {
+      if constexpr (IsIMessage<T>)
+      {
+        if (accepts(msg))
+        {
+          add_new_message(etl::forward<T>(msg));
+        }
+
+        ETL_ASSERT(is_valid(), ETL_ERROR(unhandled_message_exception));
+      }
+      else if constexpr (IsInMessageList<T>)
+      {
+        emplace_message<etl::remove_cvref_t<T>>(etl::forward<T>(msg));
+      }
+      else
+      {
+        ETL_STATIC_ASSERT(IsInMessageList<T>, "Message not in packet type list");
+      }
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Copy constructor.
+    /// A large message is copied to a new pool message.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    hybrid_message_packet(const hybrid_message_packet& other)
+      : state(Empty)
+    {
+      copy(other);
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    /// Move constructor.
+    /// A large message is transferred without a copy.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    hybrid_message_packet(hybrid_message_packet&& other)
+      : state(Empty)
+    {
+      move(other);
+    }
+#include "private/diagnostic_pop.h"
+
+    //**********************************************
+    hybrid_message_packet& operator =(const hybrid_message_packet& rhs)
+    {
+      if (this != &rhs)
+      {
+        delete_current_message();
+        copy(rhs);
+      }
+
+      return *this;
+    }
+
+    //**********************************************
+    hybrid_message_packet& operator =(hybrid_message_packet&& rhs)
+    {
+      if (this != &rhs)
+      {
+        delete_current_message();
+        move(rhs);
+      }
+
+      return *this;
+    }
+
+    //********************************************
+    ~hybrid_message_packet()
+    {
+      delete_current_message();
+    }
+
+    //********************************************
+    etl::imessage& get() ETL_NOEXCEPT
+    {
+      return (state == Shared) ? get_shared().get_message() : *static_cast<etl::imessage*>(data);
+    }
+
+    //********************************************
+    const etl::imessage& get() const ETL_NOEXCEPT
+    {
+      return (state == Shared) ? get_shared().get_message() : *static_cast<const etl::imessage*>(data);
+    }
+
+    //********************************************
+    bool is_valid() const
+    {
+      return state != Empty;
+    }
+
+    //********************************************
+    /// Is the message stored in the packet, rather than in the pool?
+    //********************************************
+    bool is_inline() const
+    {
+      return state == Inline;
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(etl::message_id_t id)
+    {
+      return ((TMessageTypes::ID == id) || ...);
+    }
+
+    //**********************************************
+    static ETL_CONSTEXPR bool accepts(const etl::imessage& msg)
+    {
+      return accepts(msg.get_message_id());
+    }
+
+    //**********************************************
+    template <etl::message_id_t Id>
+    static ETL_CONSTEXPR bool accepts()
+    {
+      return ((TMessageTypes::ID == Id) || ...);
+    }
+
+    //**********************************************
+    template <typename TMessage>
+    static ETL_CONSTEXPR
+      typename etl::enable_if<etl::is_base_of<etl::imessage, TMessage>::value, bool>::type
+      accepts()
+    {
+      return accepts<TMessage::ID>();
+    }
+
+    //**********************************************
+    /// Sets the pool that large messages are allocated from.
+    /// Shared by all packets of this type. The pool must outlive every
+    /// packet that holds one of its messages, and must be cleared with
+    /// clear_pool() before it is destroyed.
+    //**********************************************
+    static void set_pool(TPool& pool)
+    {
+      p_pool = &pool;
+    }
+
+    //**********************************************
+    /// Clears the pool. Constructing a packet from a large message will then
+    /// raise hybrid_message_packet_no_pool until set_pool() is called again.
+    //**********************************************
+    static void clear_pool()
+    {
+      p_pool = ETL_NULLPTR;
+    }
+
+    //**********************************************
+    /// Gets the pool that large messages are allocated from.
+    //**********************************************
+    static TPool* get_pool()
+    {
+      return p_pool;
+    }
+
+  private:
+
+    enum storage_state
+    {
+      Empty,
+      Inline,
+      Shared
+    };
+
+    //********************************************
+    etl::shared_message& get_shared()
+    {
+      return *static_cast<etl::shared_message*>(data);
+    }
+
+    //********************************************
+    const etl::shared_message& get_shared() const
+    {
+      return *static_cast<const etl::shared_message*>(data);
+    }
+
+    //**********************************************
+    void copy(const hybrid_message_packet& other)
+    {
+      if (other.is_valid())
+      {
+        add_new_message(other.get());
+      }
+    }
+
+    //**********************************************
+    void move(hybrid_message_packet& other)
+    {
+      if (other.state == Shared)
+      {
+        void* p = data;
+        ::new (p) etl::shared_message(etl::move(other.get_shared()));
+        state = Shared;
+
+        other.delete_current_message();
+      }
+      else if (other.state == Inline)
+      {
+        add_new_message(etl::move(other.get()));
+      }
+    }
+
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    void delete_current_message()
+    {
+      if (state == Inline)
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+        pmsg->~imessage();
+      }
+      else if (state == Shared)
+      {
+        get_shared().~shared_message();
+      }
+
+      state = Empty;
+    }
+#include "private/diagnostic_pop.h"
+
+    //********************************************
+    void add_new_message(const etl::imessage& msg)
+    {
+      (add_new_message_type<TMessageTypes>(msg) || ...);
+    }
+
+    //********************************************
+    void add_new_message(etl::imessage&& msg)
+    {
+      (add_new_message_type<TMessageTypes>(etl::move(msg)) || ...);
+    }
+
+    //********************************************
+    template <typename TType>
+    bool add_new_message_type(const etl::imessage& msg)
+    {
+      if (TType::ID == msg.get_message_id())
+      {
+        emplace_message<TType>(static_cast<const TType&>(msg));
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //********************************************
+    template <typename TType>
+    bool add_new_message_type(etl::imessage&& msg)
+    {
+      if (TType::ID == msg.get_message_id())
+      {
+        emplace_message<TType>(static_cast<TType&&>(msg));
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //********************************************
+    /// Stores small messages in the packet and large ones in the pool.
+    //********************************************
+#include "private/diagnostic_uninitialized_push.h"
+    template <typename TType, typename TMessage>
+    void emplace_message(TMessage&& msg)
+    {
+      void* p = data;
+
+      if constexpr (Is_Inline<TType>)
+      {
+        ::new (p) TType(etl::forward<TMessage>(msg));
+        state = Inline;
+      }
+      else
+      {
+        ETL_ASSERT_OR_RETURN(p_pool != ETL_NULLPTR, ETL_ERROR(hybrid_message_packet_no_pool));
+
+        etl::shared_message* p_shared = ::new (p) etl::shared_message(*p_pool, static_cast<const TType&>(msg));
+        state = Shared;
+
+        // The pool could not allocate the message.
+        if (!p_shared->is_valid())
+        {
+          delete_current_message();
+        }
+      }
+    }
+#include "private/diagnostic_pop.h"
+
+    typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    storage_state state;
+
+    static TPool* p_pool;
+  };
+
+  template <typename TPool, size_t Max_Inline_Size, typename... TMessageTypes>
+  TPool* hybrid_message_packet<TPool, Max_Inline_Size, TMessageTypes...>::p_pool = ETL_NULLPTR;
+}
+
+#endif
+#endif
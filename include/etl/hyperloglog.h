@@ -0,0 +1,222 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_HYPERLOGLOG_INCLUDED
+#define ETL_HYPERLOGLOG_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "binary.h"
+#include "bloom_filter.h"
+#include "hash.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+
+#include <math.h>
+#include <stdint.h>
+
+///\defgroup hyperloglog hyperloglog
+/// A HyperLogLog cardinality estimator.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Estimates the number of distinct keys that have been added, in a fixed
+  /// 2^VPrecision bytes. The standard error is 1.04 / sqrt(2^VPrecision).
+  /// Estimators using the same precision and hash may be merged, so each core
+  /// or task may count separately.
+  ///\tparam VPrecision The log2 of the number of registers. 4 to 16.
+  ///\tparam TKey       The key type.
+  ///\tparam THash      The hash generator class. Defaults to etl::hash<TKey>.
+  ///\ingroup hyperloglog
+  //***************************************************************************
+  template <size_t VPrecision, typename TKey, typename THash = etl::hash<TKey> >
+  class hyperloglog
+  {
+  private:
+
+    typedef typename etl::parameter_type<TKey>::type parameter_t;
+
+  public:
+
+    ETL_STATIC_ASSERT((VPrecision >= 4U) && (VPrecision <= 16U), "VPrecision must be 4 to 16");
+
+    enum
+    {
+      PRECISION = VPrecision,
+      REGISTERS = 1 << VPrecision
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    hyperloglog()
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Clears the estimator.
+    //***************************************************************************
+    void clear()
+    {
+      etl::fill_n(registers, size_t(REGISTERS), uint8_t(0U));
+    }
+
+    //***************************************************************************
+    /// Adds a key.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const uint32_t h1 = private_bloom_filter::mix_hash(private_bloom_filter::fold_hash(THash()(key)));
+      const uint32_t h2 = private_bloom_filter::mix_hash(h1 + 0x9E3779B9UL);
+
+      const uint64_t hash = (uint64_t(h1) << 32U) | h2;
+
+      // The register from the upper bits, the rank from the position of the first set bit of the rest.
+      const size_t   index = size_t(hash >> (64U - VPrecision));
+      const uint64_t rest  = (hash << VPrecision) | (uint64_t(1U) << (VPrecision - 1U));
+      const uint8_t  rank  = uint8_t(etl::count_leading_zeros(rest) + 1U);
+
+      if (rank > registers[index])
+      {
+        registers[index] = rank;
+      }
+    }
+
+    //***************************************************************************
+    /// Merges another estimator, so that this estimates the size of the union.
+    /// The registers are a contiguous array of bytes, so the loop vectorises.
+    //***************************************************************************
+    void merge(const hyperloglog& other)
+    {
+      for (size_t i = 0U; i < size_t(REGISTERS); ++i)
+      {
+        registers[i] = etl::max(registers[i], other.registers[i]);
+      }
+    }
+
+    //***************************************************************************
+    /// Returns the estimated number of distinct keys.
+    //***************************************************************************
+    double estimate() const
+    {
+      const double m = double(REGISTERS);
+
+      double sum   = 0.0;
+      size_t zeros = 0U;
+
+      for (size_t i = 0U; i < size_t(REGISTERS); ++i)
+      {
+        sum += 1.0 / double(uint64_t(1U) << registers[i]);
+
+        if (registers[i] == 0U)
+        {
+          ++zeros;
+        }
+      }
+
+      const double raw = alpha() * m * m / sum;
+
+      // Linear counting is more accurate for small cardinalities.
+      if ((raw <= (2.5 * m)) && (zeros != 0U))
+      {
+        return m * ::log(m / double(zeros));
+      }
+
+      return raw;
+    }
+
+    //***************************************************************************
+    /// Returns the standard error of the estimate, as a fraction.
+    //***************************************************************************
+    static double standard_error()
+    {
+      return 1.04 / ::sqrt(double(REGISTERS));
+    }
+
+    //***************************************************************************
+    /// Returns true if no keys have been added.
+    //***************************************************************************
+    bool empty() const
+    {
+      for (size_t i = 0U; i < size_t(REGISTERS); ++i)
+      {
+        if (registers[i] != 0U)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Returns the registers.
+    //***************************************************************************
+    const uint8_t* data() const
+    {
+      return registers;
+    }
+
+    //***************************************************************************
+    /// Returns the size of the registers.
+    //***************************************************************************
+    static ETL_CONSTEXPR size_t size_bytes()
+    {
+      return size_t(REGISTERS);
+    }
+
+  private:
+
+    //***************************************************************************
+    /// The bias correction constant.
+    //***************************************************************************
+    static double alpha()
+    {
+      const size_t m = size_t(REGISTERS);
+
+      return (m == 16U) ? 0.673 :
+             (m == 32U) ? 0.697 :
+             (m == 64U) ? 0.709 : (0.7213 / (1.0 + (1.079 / double(m))));
+    }
+
+    /// The registers, each the highest rank seen.
+#if ETL_USING_CPP11 && !defined(ETL_COMPILER_ARM5)
+    alignas(64) uint8_t registers[REGISTERS];
+#else
+    uint8_t registers[REGISTERS];
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,763 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "memory.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A fixed capacity priority queue where every value is identified by a handle.
+/// The value of a handle may be changed, or the value erased, in O(log n),
+/// without the erase and reinsert that etl::priority_queue would need.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the indexed_priority_queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public etl::exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the indexed_priority_queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_INDEXED_PRIORITY_QUEUE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the indexed_priority_queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_empty : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_empty(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:empty", ETL_INDEXED_PRIORITY_QUEUE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid handle exception for the indexed_priority_queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_invalid_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:invalid handle", ETL_INDEXED_PRIORITY_QUEUE_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all indexed_priority_queues.
+  /// Values are stored in fixed slots and a d-ary heap of slot indexes orders them.
+  /// The handle returned by push is the slot index and remains valid until the
+  /// value is popped or erased, after which it may be reused by a later push.
+  ///\tparam T        The type of value that the queue holds.
+  ///\tparam TCompare The comparison used to order the values.
+  ///\tparam Arity    The number of children of each heap node.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  template <typename T, typename TCompare = etl::less<T>, const size_t Arity = 2>
+  class iindexed_priority_queue
+  {
+    ETL_STATIC_ASSERT(Arity >= 2U, "Arity must be at least 2");
+
+  public:
+
+    typedef T         value_type;
+    typedef TCompare  compare_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef size_t    size_type;
+    typedef size_t    handle_type;
+
+    static ETL_CONSTANT size_t      ARITY          = Arity;
+    static ETL_CONSTANT handle_type Invalid_Handle = ~handle_type(0U);
+
+    //*************************************************************************
+    /// Gets a reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[p_heap[0]];
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    handle_type push(const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(value);
+
+      return insert_last();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    handle_type push(rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(etl::move(value));
+
+      return insert_last();
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_INDEXED_PRIORITY_QUEUE_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(etl::forward<Args>(args)...);
+
+      return insert_last();
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    template <typename T1>
+    handle_type emplace(const T1& value1)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(value1);
+
+      return insert_last();
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    handle_type emplace(const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(value1, value2);
+
+      return insert_last();
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(value1, value2, value3);
+
+      return insert_last();
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_full if the queue is full.
+    ///\return The handle of the value, or Invalid_Handle if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(indexed_priority_queue_full), Invalid_Handle);
+
+      ::new (p_values + p_heap[current_size]) T(value1, value2, value3, value4);
+
+      return insert_last();
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_empty if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(indexed_priority_queue_empty));
+
+      erase_at(0U);
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value, assigns it to destination and removes
+    /// it from the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_empty if the queue is empty.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(indexed_priority_queue_empty));
+
+      destination = ETL_MOVE(p_values[p_heap[0]]);
+      erase_at(0U);
+    }
+
+    //*************************************************************************
+    /// Replaces the value of a handle and restores the heap order.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a value in the queue.
+    //*************************************************************************
+    void update(handle_type handle, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      p_values[handle] = value;
+      restore(p_positions[handle]);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Replaces the value of a handle by moving and restores the heap order.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a value in the queue.
+    //*************************************************************************
+    void update(handle_type handle, rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      p_values[handle] = etl::move(value);
+      restore(p_positions[handle]);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value of a handle from the queue.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a value in the queue.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT_OR_RETURN(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      erase_at(p_positions[handle]);
+    }
+
+    //*************************************************************************
+    /// Checks if the handle refers to a value in the queue.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < CAPACITY) && (p_positions[handle] < current_size);
+    }
+
+    //*************************************************************************
+    /// Gets the value of a handle.
+    /// Use update to change it, so that the heap order is kept.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Gets the value of a handle.
+    /// If asserts or exceptions are enabled, emits indexed_priority_queue_invalid_handle
+    /// if the handle does not refer to a value in the queue.
+    //*************************************************************************
+    const_reference at(handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(indexed_priority_queue_invalid_handle));
+
+      return p_values[handle];
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the queue.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the queue.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the queue.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Removes all of the values. All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        for (size_type i = 0U; i < current_size; ++i)
+        {
+          p_values[p_heap[i]].~T();
+        }
+      }
+
+      ETL_SUBTRACT_DEBUG_COUNT(current_size);
+      current_size = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iindexed_priority_queue(T* p_values_, handle_type* p_heap_, size_type* p_positions_, size_type capacity_)
+      : p_values(p_values_)
+      , p_heap(p_heap_)
+      , p_positions(p_positions_)
+      , CAPACITY(capacity_)
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises the queue to the empty state.
+    /// Every slot is free, in the part of the heap array beyond current_size.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < CAPACITY; ++i)
+      {
+        p_heap[i]      = i;
+        p_positions[i] = i;
+      }
+
+      current_size = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Copies the values and handles of a queue of the same capacity.
+    //*************************************************************************
+    void copy_from(const iindexed_priority_queue& other)
+    {
+      clear();
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_values + other.p_heap[i]) T(other.p_values[other.p_heap[i]]);
+      }
+
+      copy_heap(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values and copies the handles of a queue of the same capacity.
+    //*************************************************************************
+    void move_from(iindexed_priority_queue& other)
+    {
+      clear();
+
+      for (size_type i = 0U; i < other.current_size; ++i)
+      {
+        ::new (p_values + other.p_heap[i]) T(etl::move(other.p_values[other.p_heap[i]]));
+      }
+
+      copy_heap(other);
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Adds the value just constructed in the first free slot to the heap.
+    //*************************************************************************
+    handle_type insert_last()
+    {
+      const handle_type handle = p_heap[current_size];
+
+      ETL_INCREMENT_DEBUG_COUNT;
+      sift_up(current_size++);
+
+      return handle;
+    }
+
+    //*************************************************************************
+    /// Destroys the value at a heap position and returns its slot to the free part.
+    //*************************************************************************
+    void erase_at(size_type position)
+    {
+      const handle_type handle = p_heap[position];
+
+      p_values[handle].~T();
+      ETL_DECREMENT_DEBUG_COUNT;
+      --current_size;
+
+      if (position != current_size)
+      {
+        // Swap with the last heap entry, so that the freed slot follows the heap.
+        const handle_type last = p_heap[current_size];
+
+        place(last, position);
+        place(handle, current_size);
+        restore(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at a heap position up or down to restore the heap order.
+    //*************************************************************************
+    void restore(size_type position)
+    {
+      if ((position > 0U) && compare(p_values[p_heap[(position - 1U) / Arity]], p_values[p_heap[position]]))
+      {
+        sift_up(position);
+      }
+      else
+      {
+        sift_down(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the value at a heap position towards the top.
+    //*************************************************************************
+    void sift_up(size_type position)
+    {
+      const handle_type handle = p_heap[position];
+
+      while (position > 0U)
+      {
+        const size_type parent = (position - 1U) / Arity;
+
+        if (!compare(p_values[p_heap[parent]], p_values[handle]))
+        {
+          break;
+        }
+
+        place(p_heap[parent], position);
+        position = parent;
+      }
+
+      place(handle, position);
+    }
+
+    //*************************************************************************
+    /// Moves the value at a heap position towards the leaves.
+    //*************************************************************************
+    void sift_down(size_type position)
+    {
+      const handle_type handle = p_heap[position];
+
+      size_type child = (Arity * position) + 1U;
+
+      while (child < current_size)
+      {
+        // Find the highest priority child.
+        const size_type last_child = ((current_size - child) > Arity) ? child + Arity : current_size;
+        size_type best = child;
+
+        for (++child; child < last_child; ++child)
+        {
+          if (compare(p_values[p_heap[best]], p_values[p_heap[child]]))
+          {
+            best = child;
+          }
+        }
+
+        if (!compare(p_values[handle], p_values[p_heap[best]]))
+        {
+          break;
+        }
+
+        place(p_heap[best], position);
+        position = best;
+        child    = (Arity * position) + 1U;
+      }
+
+      place(handle, position);
+    }
+
+    //*************************************************************************
+    /// Puts a handle at a heap position.
+    //*************************************************************************
+    void place(handle_type handle, size_type position)
+    {
+      p_heap[position]    = handle;
+      p_positions[handle] = position;
+    }
+
+    //*************************************************************************
+    /// Copies the heap and position maps from a queue of the same capacity.
+    //*************************************************************************
+    void copy_heap(const iindexed_priority_queue& other)
+    {
+      for (size_type i = 0U; i < CAPACITY; ++i)
+      {
+        p_heap[i]      = other.p_heap[i];
+        p_positions[i] = other.p_positions[i];
+      }
+
+      ETL_ADD_DEBUG_COUNT(other.current_size);
+      current_size = other.current_size;
+    }
+
+    // Disable copy construction and assignment.
+    iindexed_priority_queue(const iindexed_priority_queue&) ETL_DELETE;
+    iindexed_priority_queue& operator =(const iindexed_priority_queue&) ETL_DELETE;
+
+    T* const           p_values;     ///< The value slots, indexed by handle.
+    handle_type* const p_heap;       ///< The heap of handles, followed by the free handles.
+    size_type* const   p_positions;  ///< The position of each handle in p_heap.
+    const size_type    CAPACITY;
+    size_type          current_size;
+    TCompare           compare;
+
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INDEXED_PRIORITY_QUEUE) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iindexed_priority_queue()
+    {
+    }
+#else
+  protected:
+    ~iindexed_priority_queue()
+    {
+    }
+#endif
+  };
+
+  template <typename T, typename TCompare, const size_t Arity>
+  ETL_CONSTANT size_t iindexed_priority_queue<T, TCompare, Arity>::ARITY;
+
+  template <typename T, typename TCompare, const size_t Arity>
+  ETL_CONSTANT typename iindexed_priority_queue<T, TCompare, Arity>::handle_type iindexed_priority_queue<T, TCompare, Arity>::Invalid_Handle;
+
+  //***************************************************************************
+  /// An indexed_priority_queue with the capacity defined at compile time.
+  ///\code
+  /// etl::indexed_priority_queue<Route, 32, RouteCompare, 4> queue;
+  /// etl::indexed_priority_queue<Route, 32, RouteCompare, 4>::handle_type h = queue.push(route);
+  /// queue.update(h, shorter_route);
+  ///\endcode
+  ///\tparam T         The type of value that the queue holds.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\tparam TCompare  The comparison used to order the values.
+  ///\tparam Arity     The number of children of each heap node.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_, typename TCompare = etl::less<T>, const size_t Arity = 2>
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, TCompare, Arity>
+  {
+  public:
+
+    typedef etl::iindexed_priority_queue<T, TCompare, Arity> base_t;
+
+    typedef typename base_t::size_type   size_type;
+    typedef typename base_t::handle_type handle_type;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity indexed_priority_queue is not valid");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base_t(values.begin(), heap, positions, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Handles from 'other' are valid for the copy.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other)
+      : base_t(values.begin(), heap, positions, MAX_SIZE)
+    {
+      this->initialise();
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Handles from 'other' are valid for the new queue.
+    //*************************************************************************
+    indexed_priority_queue(indexed_priority_queue&& other)
+      : base_t(values.begin(), heap, positions, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    indexed_priority_queue& operator =(indexed_priority_queue&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, MAX_SIZE_> values;
+    handle_type                                heap[MAX_SIZE_];
+    size_type                                  positions[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_, typename TCompare, const size_t Arity>
+  ETL_CONSTANT size_t indexed_priority_queue<T, MAX_SIZE_, TCompare, Arity>::MAX_SIZE;
+}
+
+#endif
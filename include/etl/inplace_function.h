@@ -0,0 +1,525 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INPLACE_FUNCTION_INCLUDED
+#define ETL_INPLACE_FUNCTION_INCLUDED
+
+#include "platform.h"
+
+#if ETL_USING_CPP11
+
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "optional.h"
+#include "alignment.h"
+#include "largest.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+// The default capacity, in bytes, of an etl::inplace_function.
+//*****************************************************************************
+#if !defined(ETL_INPLACE_FUNCTION_DEFAULT_CAPACITY)
+  #define ETL_INPLACE_FUNCTION_DEFAULT_CAPACITY (4U * sizeof(void*))
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for inplace_function exceptions.
+  //***************************************************************************
+  class inplace_function_exception : public exception
+  {
+  public:
+
+    inplace_function_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when an empty inplace_function is called.
+  //***************************************************************************
+  class inplace_function_uninitialised : public inplace_function_exception
+  {
+  public:
+
+    inplace_function_uninitialised(string_type file_name_, numeric_type line_number_)
+      : inplace_function_exception(ETL_ERROR_TEXT("inplace_function:uninitialised", ETL_INPLACE_FUNCTION_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //*************************************************************************
+  /// Declaration.
+  //*************************************************************************
+  template <typename TSignature,
+            size_t Capacity  = ETL_INPLACE_FUNCTION_DEFAULT_CAPACITY,
+            size_t Alignment = etl::largest_alignment<void*, double, long long>::value>
+  class inplace_function;
+
+  namespace private_inplace_function
+  {
+    typedef decltype(nullptr) nullptr_type;
+
+    //*************************************************************************
+    /// The operations on a stored callable.
+    /// One instance exists for each callable type and signature.
+    //*************************************************************************
+    template <typename TReturn, typename... TParams>
+    struct vtable
+    {
+      TReturn (*invoke)(void* object, TParams&&... params);
+      void    (*copy)(void* destination, const void* source);
+      void    (*move)(void* destination, void* source);
+      void    (*destroy)(void* object);
+    };
+
+    //*************************************************************************
+    /// The operations for callable type T.
+    //*************************************************************************
+    template <typename T, typename TReturn, typename... TParams>
+    struct vtable_for
+    {
+      static TReturn invoke(void* object, TParams&&... params)
+      {
+        return (*static_cast<T*>(object))(etl::forward<TParams>(params)...);
+      }
+
+      static void copy(void* destination, const void* source)
+      {
+        ::new (destination) T(*static_cast<const T*>(source));
+      }
+
+      // Moves the callable and destroys the source.
+      static void move(void* destination, void* source)
+      {
+        T* p = static_cast<T*>(source);
+
+        ::new (destination) T(etl::move(*p));
+        p->~T();
+      }
+
+      static void destroy(void* object)
+      {
+        static_cast<T*>(object)->~T();
+      }
+
+      static const vtable<TReturn, TParams...> value;
+    };
+
+    template <typename T, typename TReturn, typename... TParams>
+    const vtable<TReturn, TParams...> vtable_for<T, TReturn, TParams...>::value =
+    {
+      &vtable_for<T, TReturn, TParams...>::invoke,
+      &vtable_for<T, TReturn, TParams...>::copy,
+      &vtable_for<T, TReturn, TParams...>::move,
+      &vtable_for<T, TReturn, TParams...>::destroy
+    };
+
+    //*************************************************************************
+    template <typename T>
+    struct is_inplace_function : etl::false_type
+    {
+    };
+
+    template <typename TSignature, size_t Capacity, size_t Alignment>
+    struct is_inplace_function<etl::inplace_function<TSignature, Capacity, Alignment> > : etl::true_type
+    {
+    };
+  }
+
+  //*************************************************************************
+  /// An owning callable wrapper that stores its callable inline.
+  /// Unlike etl::delegate it holds a copy of the callable, so a capturing
+  /// lambda may go out of scope. Unlike std::function it never allocates;
+  /// a callable that does not fit in Capacity bytes, or needs a stricter
+  /// alignment than Alignment, is a compile time error.
+  /// Calls go through a table of function pointers shared by all
+  /// inplace_functions that hold the same callable type.
+  ///\tparam TSignature The call signature. e.g. int(char, long)
+  ///\tparam Capacity   The storage size, in bytes, for the callable.
+  ///\tparam Alignment  The storage alignment.
+  //*************************************************************************
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  class inplace_function<TReturn(TParams...), Capacity, Alignment>
+  {
+  private:
+
+    typedef private_inplace_function::vtable<TReturn, TParams...> vtable_type;
+
+    template <typename T>
+    using vtable_for = private_inplace_function::vtable_for<T, TReturn, TParams...>;
+
+    template <typename T>
+    using enable_if_callable_t = etl::enable_if_t<!private_inplace_function::is_inplace_function<etl::decay_t<T> >::value &&
+                                                  !etl::is_same<etl::decay_t<T>, private_inplace_function::nullptr_type>::value, int>;
+
+    ETL_STATIC_ASSERT(Capacity > 0U, "Capacity must be greater than zero");
+
+  public:
+
+    template <typename, size_t, size_t>
+    friend class inplace_function;
+
+    static ETL_CONSTANT size_t CAPACITY  = Capacity;
+    static ETL_CONSTANT size_t ALIGNMENT = Alignment;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    inplace_function() ETL_NOEXCEPT
+      : p_vtable(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct empty from nullptr.
+    //*************************************************************************
+    inplace_function(private_inplace_function::nullptr_type) ETL_NOEXCEPT
+      : p_vtable(ETL_NULLPTR)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a lambda, functor or function pointer.
+    //*************************************************************************
+    template <typename TCallable, enable_if_callable_t<TCallable> = 0>
+    inplace_function(TCallable&& callable)
+      : p_vtable(ETL_NULLPTR)
+    {
+      create(etl::forward<TCallable>(callable));
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    inplace_function(const inplace_function& other)
+      : p_vtable(ETL_NULLPTR)
+    {
+      copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    /// The other inplace_function is left empty.
+    //*************************************************************************
+    inplace_function(inplace_function&& other)
+      : p_vtable(ETL_NULLPTR)
+    {
+      move_from(other);
+    }
+
+    //*************************************************************************
+    /// Copy from an inplace_function with a smaller capacity.
+    //*************************************************************************
+    template <size_t Other_Capacity, size_t Other_Alignment>
+    inplace_function(const inplace_function<TReturn(TParams...), Other_Capacity, Other_Alignment>& other)
+      : p_vtable(ETL_NULLPTR)
+    {
+      ETL_STATIC_ASSERT(Other_Capacity <= Capacity, "Capacity too small");
+      ETL_STATIC_ASSERT((Alignment % Other_Alignment) == 0U, "Incompatible alignment");
+
+      copy_from(other);
+    }
+
+    //*************************************************************************
+    /// Move from an inplace_function with a smaller capacity.
+    //*************************************************************************
+    template <size_t Other_Capacity, size_t Other_Alignment>
+    inplace_function(inplace_function<TReturn(TParams...), Other_Capacity, Other_Alignment>&& other)
+      : p_vtable(ETL_NULLPTR)
+    {
+      ETL_STATIC_ASSERT(Other_Capacity <= Capacity, "Capacity too small");
+      ETL_STATIC_ASSERT((Alignment % Other_Alignment) == 0U, "Incompatible alignment");
+
+      move_from(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~inplace_function()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    //*************************************************************************
+    inplace_function& operator =(const inplace_function& rhs)
+    {
+      if (this != &rhs)
+      {
+        clear();
+        copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    inplace_function& operator =(inplace_function&& rhs)
+    {
+      if (this != &rhs)
+      {
+        clear();
+        move_from(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign nullptr, clearing the inplace_function.
+    //*************************************************************************
+    inplace_function& operator =(private_inplace_function::nullptr_type)
+    {
+      clear();
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assign a lambda, functor or function pointer.
+    //*************************************************************************
+    template <typename TCallable, enable_if_callable_t<TCallable> = 0>
+    inplace_function& operator =(TCallable&& callable)
+    {
+      clear();
+      create(etl::forward<TCallable>(callable));
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Destroys the callable.
+    //*************************************************************************
+    void clear()
+    {
+      if (p_vtable != ETL_NULLPTR)
+      {
+        p_vtable->destroy(&storage);
+        p_vtable = ETL_NULLPTR;
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps with another inplace_function.
+    //*************************************************************************
+    void swap(inplace_function& other)
+    {
+      if (this != &other)
+      {
+        inplace_function temp(etl::move(other));
+
+        other = etl::move(*this);
+        *this = etl::move(temp);
+      }
+    }
+
+    //*************************************************************************
+    /// Calls the callable.
+    //*************************************************************************
+    TReturn operator()(TParams... args) const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(inplace_function_uninitialised));
+
+      return p_vtable->invoke(&storage, etl::forward<TParams>(args)...);
+    }
+
+    //*************************************************************************
+    /// Calls the callable if valid.
+    /// 'void' return.
+    //*************************************************************************
+    template <typename TRet = TReturn>
+    typename etl::enable_if_t<etl::is_same<TRet, void>::value, bool>
+      call_if(TParams... args) const
+    {
+      if (is_valid())
+      {
+        p_vtable->invoke(&storage, etl::forward<TParams>(args)...);
+        return true;
+      }
+      else
+      {
+        return false;
+      }
+    }
+
+    //*************************************************************************
+    /// Calls the callable if valid.
+    /// Non 'void' return.
+    //*************************************************************************
+    template <typename TRet = TReturn>
+    typename etl::enable_if_t<!etl::is_same<TRet, void>::value, etl::optional<TReturn>>
+      call_if(TParams... args) const
+    {
+      etl::optional<TReturn> result;
+
+      if (is_valid())
+      {
+        result = p_vtable->invoke(&storage, etl::forward<TParams>(args)...);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Calls the callable if valid, or the alternative.
+    //*************************************************************************
+    template <typename TAlternative>
+    TReturn call_or(TAlternative alternative, TParams... args) const
+    {
+      if (is_valid())
+      {
+        return p_vtable->invoke(&storage, etl::forward<TParams>(args)...);
+      }
+      else
+      {
+        return alternative(etl::forward<TParams>(args)...);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if a callable is stored.
+    //*************************************************************************
+    ETL_NODISCARD
+    bool is_valid() const
+    {
+      return p_vtable != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if a callable is stored.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return is_valid();
+    }
+
+  private:
+
+    //*************************************************************************
+    template <typename TCallable>
+    void create(TCallable&& callable)
+    {
+      typedef etl::decay_t<TCallable> callable_type;
+
+      ETL_STATIC_ASSERT(sizeof(callable_type) <= Capacity, "Callable too large for the capacity");
+      ETL_STATIC_ASSERT((Alignment % etl::alignment_of<callable_type>::value) == 0U, "Callable alignment too strict");
+      ETL_STATIC_ASSERT(etl::is_copy_constructible<callable_type>::value, "Callable must be copy constructible");
+
+      ::new (&storage) callable_type(etl::forward<TCallable>(callable));
+      p_vtable = &vtable_for<callable_type>::value;
+    }
+
+    //*************************************************************************
+    template <typename TOther>
+    void copy_from(const TOther& other)
+    {
+      if (other.p_vtable != ETL_NULLPTR)
+      {
+        other.p_vtable->copy(&storage, &other.storage);
+        p_vtable = other.p_vtable;
+      }
+    }
+
+    //*************************************************************************
+    template <typename TOther>
+    void move_from(TOther& other)
+    {
+      if (other.p_vtable != ETL_NULLPTR)
+      {
+        other.p_vtable->move(&storage, &other.storage);
+        p_vtable       = other.p_vtable;
+        other.p_vtable = ETL_NULLPTR;
+      }
+    }
+
+    const vtable_type* p_vtable;
+
+    // Mutable, as calling a const inplace_function may change the callable's state.
+    mutable typename etl::aligned_storage<Capacity, Alignment>::type storage;
+  };
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::CAPACITY;
+
+  template <typename TReturn, typename... TParams, size_t Capacity, size_t Alignment>
+  ETL_CONSTANT size_t inplace_function<TReturn(TParams...), Capacity, Alignment>::ALIGNMENT;
+
+  //*************************************************************************
+  /// Swaps two inplace_functions.
+  //*************************************************************************
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  void swap(etl::inplace_function<TSignature, Capacity, Alignment>& lhs, etl::inplace_function<TSignature, Capacity, Alignment>& rhs)
+  {
+    lhs.swap(rhs);
+  }
+
+  //*************************************************************************
+  /// Compare with nullptr.
+  //*************************************************************************
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  bool operator ==(const etl::inplace_function<TSignature, Capacity, Alignment>& lhs, private_inplace_function::nullptr_type)
+  {
+    return !lhs.is_valid();
+  }
+
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  bool operator ==(private_inplace_function::nullptr_type, const etl::inplace_function<TSignature, Capacity, Alignment>& rhs)
+  {
+    return !rhs.is_valid();
+  }
+
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  bool operator !=(const etl::inplace_function<TSignature, Capacity, Alignment>& lhs, private_inplace_function::nullptr_type)
+  {
+    return lhs.is_valid();
+  }
+
+  template <typename TSignature, size_t Capacity, size_t Alignment>
+  bool operator !=(private_inplace_function::nullptr_type, const etl::inplace_function<TSignature, Capacity, Alignment>& rhs)
+  {
+    return rhs.is_valid();
+  }
+}
+
+#endif
+
+#endif
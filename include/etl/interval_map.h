@@ -0,0 +1,1213 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTERVAL_MAP_INCLUDED
+#define ETL_INTERVAL_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "iterator.h"
+#include "pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "private/minmax_push.h"
+
+//*****************************************************************************
+///\defgroup interval_map interval_map
+/// A map of half open intervals [low, high) to values, with the capacity
+/// defined at compile time. Overlap and stabbing queries are O(log n + k).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_exception : public etl::exception
+  {
+  public:
+
+    interval_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_full : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::interval_map_exception(ETL_ERROR_TEXT("interval_map:full", ETL_INTERVAL_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid interval exception for the interval_map.
+  /// Raised when the low bound is not less than the high bound.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_invalid_interval : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_invalid_interval(string_type file_name_, numeric_type line_number_)
+      : etl::interval_map_exception(ETL_ERROR_TEXT("interval_map:invalid interval", ETL_INTERVAL_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the interval_map.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_iterator : public etl::interval_map_exception
+  {
+  public:
+
+    interval_map_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::interval_map_exception(ETL_ERROR_TEXT("interval_map:iterator", ETL_INTERVAL_MAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all interval_maps.
+  ///\ingroup interval_map
+  //***************************************************************************
+  class interval_map_base
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Gets the number of intervals in the map.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the map.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity of the map.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return max_size() - size();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    interval_map_base(size_type max_size_)
+      : current_size(0U)
+      , CAPACITY(max_size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~interval_map_base()
+    {
+    }
+
+    size_type       current_size; ///< The number of intervals in the map.
+    const size_type CAPACITY;     ///< The maximum number of intervals in the map.
+  };
+
+  //***************************************************************************
+  /// The interface for interval_maps of any capacity.
+  /// Intervals are half open, [low, high), and may overlap each other.
+  /// They are held in an AA tree, ordered by their low bound, where each node
+  /// records the largest high bound in its subtree. This lets a query step over
+  /// any subtree that cannot contain an overlapping interval.
+  ///\tparam TKey     The type of the interval bounds.
+  ///\tparam TMapped  The type of the value associated with each interval.
+  ///\tparam TCompare The ordering of the bounds. Default etl::less<TKey>.
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TCompare = etl::less<TKey> >
+  class iinterval_map : public etl::interval_map_base
+  {
+  public:
+
+    typedef TKey            key_type;
+    typedef TMapped         mapped_type;
+    typedef TCompare        key_compare;
+    typedef const TKey&     const_key_reference;
+    typedef ptrdiff_t       difference_type;
+    typedef size_t          size_type;
+
+    //*************************************************************************
+    /// The stored interval and its associated value.
+    /// The bounds are fixed once the interval is in the map.
+    //*************************************************************************
+    struct value_type
+    {
+      value_type(const_key_reference low_, const_key_reference high_, const mapped_type& mapped_)
+        : low(low_)
+        , high(high_)
+        , mapped(mapped_)
+      {
+      }
+
+      const key_type low;
+      const key_type high;
+      mapped_type    mapped;
+    };
+
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+
+  protected:
+
+    //*************************************************************************
+    /// The node in which an interval is stored.
+    //*************************************************************************
+    struct Node
+    {
+      Node(const_key_reference low_, const_key_reference high_, const mapped_type& mapped_)
+        : parent(ETL_NULLPTR)
+        , left(ETL_NULLPTR)
+        , right(ETL_NULLPTR)
+        , level(1U)
+        , max_high(high_)
+        , value(low_, high_, mapped_)
+      {
+      }
+
+      Node*         parent;
+      Node*         left;
+      Node*         right;
+      uint_least8_t level;
+      key_type      max_high; ///< The largest high bound in this subtree.
+      value_type    value;
+    };
+
+  public:
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    /// Visits the intervals in order of their low bound.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, value_type>
+    {
+    public:
+
+      friend class iinterval_map;
+      friend class const_iterator;
+
+      iterator()
+        : p_map(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      iterator(iinterval_map& map, Node* node)
+        : p_map(&map)
+        , p_node(node)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p_node = iinterval_map::next_node(p_node);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        p_node = iinterval_map::next_node(p_node);
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        p_node = p_map->prev_node(p_node);
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        p_node = p_map->prev_node(p_node);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_node->value;
+      }
+
+      pointer operator ->() const
+      {
+        return &(p_node->value);
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_node == rhs.p_node);
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iinterval_map* p_map;
+      Node*          p_node;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    /// Visits the intervals in order of their low bound.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class iinterval_map;
+
+      const_iterator()
+        : p_map(ETL_NULLPTR)
+        , p_node(ETL_NULLPTR)
+      {
+      }
+
+      const_iterator(const iinterval_map& map, const Node* node)
+        : p_map(&map)
+        , p_node(node)
+      {
+      }
+
+      const_iterator(const typename iinterval_map::iterator& other)
+        : p_map(other.p_map)
+        , p_node(other.p_node)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        p_node = iinterval_map::next_node(p_node);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        p_node = iinterval_map::next_node(p_node);
+        return temp;
+      }
+
+      const_iterator& operator --()
+      {
+        p_node = p_map->prev_node(p_node);
+        return *this;
+      }
+
+      const_iterator operator --(int)
+      {
+        const_iterator temp(*this);
+        p_node = p_map->prev_node(p_node);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_node->value;
+      }
+
+      const_pointer operator ->() const
+      {
+        return &(p_node->value);
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_map == rhs.p_map) && (lhs.p_node == rhs.p_node);
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const iinterval_map* p_map;
+      const Node*          p_node;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, leftmost(p_root));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, leftmost(p_root));
+    }
+
+    //*************************************************************************
+    /// Gets the beginning of the map.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, leftmost(p_root));
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the end of the map.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the map.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse beginning of the map.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the map.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Gets the reverse end of the map.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Inserts the interval [low, high) with its value.
+    /// Intervals may overlap those already in the map.
+    /// If asserts or exceptions are enabled, emits interval_map_full if the map
+    /// is full, or interval_map_invalid_interval if low is not less than high.
+    ///\return An iterator to the inserted interval, or end() on failure.
+    //*************************************************************************
+    iterator insert(const_key_reference low, const_key_reference high, const mapped_type& mapped)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(interval_map_full), end());
+      ETL_ASSERT_OR_RETURN_VALUE(compare(low, high), ETL_ERROR(interval_map_invalid_interval), end());
+
+      Node* p_node = p_node_pool->template create<Node>(low, high, mapped);
+
+      p_root = insert_node(p_root, p_node);
+      p_root->parent = ETL_NULLPTR;
+      ++current_size;
+
+      return iterator(*this, p_node);
+    }
+
+    //*************************************************************************
+    /// Erases the interval at the position.
+    /// If asserts or exceptions are enabled, emits interval_map_iterator if the
+    /// position is end().
+    ///\return An iterator to the interval following the one erased.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(position.p_node != ETL_NULLPTR, ETL_ERROR(interval_map_iterator), end());
+
+      Node* p_node = const_cast<Node*>(position.p_node);
+
+      // The tree is about to be restructured, so find the successor first.
+      Node* p_next = next_node(p_node);
+
+      p_root = erase_node(p_root, p_node);
+
+      if (p_root != ETL_NULLPTR)
+      {
+        p_root->parent = ETL_NULLPTR;
+      }
+
+      p_node_pool->destroy(p_node);
+      --current_size;
+
+      return iterator(*this, p_next);
+    }
+
+    //*************************************************************************
+    /// Erases the intervals in the range.
+    ///\return An iterator to the interval following the last one erased.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      while (first != last)
+      {
+        first = erase(first);
+      }
+
+      return iterator(*this, const_cast<Node*>(last.p_node));
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_subtree(p_root);
+      p_root       = ETL_NULLPTR;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Finds an interval that overlaps [low, high).
+    ///\return An iterator to an overlapping interval, or end() if there are none.
+    //*************************************************************************
+    iterator find_overlap(const_key_reference low, const_key_reference high)
+    {
+      return iterator(*this, const_cast<Node*>(find_overlap_node(low, high)));
+    }
+
+    //*************************************************************************
+    /// Finds an interval that overlaps [low, high).
+    ///\return An iterator to an overlapping interval, or end() if there are none.
+    //*************************************************************************
+    const_iterator find_overlap(const_key_reference low, const_key_reference high) const
+    {
+      return const_iterator(*this, find_overlap_node(low, high));
+    }
+
+    //*************************************************************************
+    /// Checks if any interval overlaps [low, high).
+    //*************************************************************************
+    bool overlaps(const_key_reference low, const_key_reference high) const
+    {
+      return find_overlap_node(low, high) != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Calls the function for each interval that overlaps [low, high), in order
+    /// of their low bound.
+    ///\param function A function or functor taking a reference to value_type.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_overlap(const_key_reference low, const_key_reference high, TFunction function)
+    {
+      if (compare(low, high))
+      {
+        visit_overlaps<Node>(p_root, low, high, function);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls the function for each interval that overlaps [low, high), in order
+    /// of their low bound.
+    ///\param function A function or functor taking a const reference to value_type.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_overlap(const_key_reference low, const_key_reference high, TFunction function) const
+    {
+      if (compare(low, high))
+      {
+        visit_overlaps<const Node>(p_root, low, high, function);
+      }
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls the function for each interval that contains the point, in order
+    /// of their low bound. An interval [low, high) contains low but not high.
+    ///\param function A function or functor taking a reference to value_type.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_containing(const_key_reference point, TFunction function)
+    {
+      visit_containing<Node>(p_root, point, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Calls the function for each interval that contains the point, in order
+    /// of their low bound. An interval [low, high) contains low but not high.
+    ///\param function A function or functor taking a const reference to value_type.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_containing(const_key_reference point, TFunction function) const
+    {
+      visit_containing<const Node>(p_root, point, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Counts the intervals that overlap [low, high).
+    //*************************************************************************
+    size_t count_overlaps(const_key_reference low, const_key_reference high) const
+    {
+      return for_each_overlap(low, high, counter()).count;
+    }
+
+    //*************************************************************************
+    /// Counts the intervals that contain the point.
+    //*************************************************************************
+    size_t count_containing(const_key_reference point) const
+    {
+      return for_each_containing(point, counter()).count;
+    }
+
+    //*************************************************************************
+    /// Assigns the intervals of another interval_map.
+    //*************************************************************************
+    void assign(const iinterval_map& other)
+    {
+      if (this != &other)
+      {
+        clear();
+
+        for (const_iterator itr = other.begin(); itr != other.end(); ++itr)
+        {
+          insert(itr->low, itr->high, itr->mapped);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iinterval_map& operator =(const iinterval_map& rhs)
+    {
+      assign(rhs);
+
+      return *this;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iinterval_map(etl::ipool& node_pool, size_t max_size_)
+      : etl::interval_map_base(max_size_)
+      , p_node_pool(&node_pool)
+      , p_root(ETL_NULLPTR)
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Counts the intervals passed to it.
+    //*************************************************************************
+    struct counter
+    {
+      counter()
+        : count(0U)
+      {
+      }
+
+      void operator ()(const value_type&)
+      {
+        ++count;
+      }
+
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Checks if a interval overlaps [low, high).
+    //*************************************************************************
+    bool is_overlap(const Node* p_node, const_key_reference low, const_key_reference high) const
+    {
+      return compare(low, p_node->value.high) && compare(p_node->value.low, high);
+    }
+
+    //*************************************************************************
+    /// The strict ordering of the nodes.
+    /// Equal low bounds are ordered by address, so that every node has a
+    /// unique position to search for.
+    //*************************************************************************
+    bool is_before(const Node* lhs, const Node* rhs) const
+    {
+      if (compare(lhs->value.low, rhs->value.low))
+      {
+        return true;
+      }
+
+      if (compare(rhs->value.low, lhs->value.low))
+      {
+        return false;
+      }
+
+      return lhs < rhs;
+    }
+
+    //*************************************************************************
+    /// Recalculates the largest high bound in the subtree.
+    //*************************************************************************
+    void update(Node* p_node) const
+    {
+      p_node->max_high = p_node->value.high;
+
+      if ((p_node->left != ETL_NULLPTR) && compare(p_node->max_high, p_node->left->max_high))
+      {
+        p_node->max_high = p_node->left->max_high;
+      }
+
+      if ((p_node->right != ETL_NULLPTR) && compare(p_node->max_high, p_node->right->max_high))
+      {
+        p_node->max_high = p_node->right->max_high;
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the left child and its parent link.
+    //*************************************************************************
+    static void set_left(Node* p_node, Node* p_child)
+    {
+      p_node->left = p_child;
+
+      if (p_child != ETL_NULLPTR)
+      {
+        p_child->parent = p_node;
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the right child and its parent link.
+    //*************************************************************************
+    static void set_right(Node* p_node, Node* p_child)
+    {
+      p_node->right = p_child;
+
+      if (p_child != ETL_NULLPTR)
+      {
+        p_child->parent = p_node;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the level of a node. Null nodes are level 0.
+    //*************************************************************************
+    static uint_least8_t level_of(const Node* p_node)
+    {
+      return (p_node == ETL_NULLPTR) ? uint_least8_t(0U) : p_node->level;
+    }
+
+    //*************************************************************************
+    /// Removes a left horizontal link by rotating right.
+    //*************************************************************************
+    Node* skew(Node* p_node) const
+    {
+      if ((p_node != ETL_NULLPTR) && (level_of(p_node->left) == p_node->level))
+      {
+        Node* p_left = p_node->left;
+
+        set_left(p_node, p_left->right);
+        set_right(p_left, p_node);
+        update(p_node);
+        update(p_left);
+
+        return p_left;
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Removes two consecutive right horizontal links by rotating left.
+    //*************************************************************************
+    Node* split(Node* p_node) const
+    {
+      if ((p_node != ETL_NULLPTR) &&
+          (p_node->right != ETL_NULLPTR) &&
+          (level_of(p_node->right->right) == p_node->level))
+      {
+        Node* p_right = p_node->right;
+
+        set_right(p_node, p_right->left);
+        set_left(p_right, p_node);
+        ++p_right->level;
+        update(p_node);
+        update(p_right);
+
+        return p_right;
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Inserts a node in to the subtree.
+    ///\return The new root of the subtree.
+    //*************************************************************************
+    Node* insert_node(Node* p_subtree, Node* p_node)
+    {
+      if (p_subtree == ETL_NULLPTR)
+      {
+        return p_node;
+      }
+
+      if (is_before(p_node, p_subtree))
+      {
+        set_left(p_subtree, insert_node(p_subtree->left, p_node));
+      }
+      else
+      {
+        set_right(p_subtree, insert_node(p_subtree->right, p_node));
+      }
+
+      update(p_subtree);
+
+      return split(skew(p_subtree));
+    }
+
+    //*************************************************************************
+    /// Erases a node from the subtree.
+    ///\return The new root of the subtree.
+    //*************************************************************************
+    Node* erase_node(Node* p_subtree, Node* p_node)
+    {
+      if (p_subtree == p_node)
+      {
+        if (p_node->left == ETL_NULLPTR)
+        {
+          // A level 1 node. Any right child is a single level 1 node.
+          return p_node->right;
+        }
+
+        // Replace the node with its successor, which is a level 1 node.
+        Node* p_successor = leftmost(p_node->right);
+
+        Node* p_right = erase_node(p_node->right, p_successor);
+
+        set_left(p_successor, p_node->left);
+        set_right(p_successor, p_right);
+        p_successor->level = p_node->level;
+        p_subtree = p_successor;
+      }
+      else if (is_before(p_node, p_subtree))
+      {
+        set_left(p_subtree, erase_node(p_subtree->left, p_node));
+      }
+      else
+      {
+        set_right(p_subtree, erase_node(p_subtree->right, p_node));
+      }
+
+      update(p_subtree);
+
+      // Restore the levels.
+      const uint_least8_t level = uint_least8_t(etl::min(level_of(p_subtree->left), level_of(p_subtree->right)) + 1U);
+
+      if (level < p_subtree->level)
+      {
+        p_subtree->level = level;
+
+        if ((p_subtree->right != ETL_NULLPTR) && (level < p_subtree->right->level))
+        {
+          p_subtree->right->level = level;
+        }
+      }
+
+      p_subtree = skew(p_subtree);
+      set_right(p_subtree, skew(p_subtree->right));
+
+      if (p_subtree->right != ETL_NULLPTR)
+      {
+        set_right(p_subtree->right, skew(p_subtree->right->right));
+      }
+
+      p_subtree = split(p_subtree);
+      set_right(p_subtree, split(p_subtree->right));
+
+      return p_subtree;
+    }
+
+    //*************************************************************************
+    /// Finds a node that overlaps [low, high).
+    //*************************************************************************
+    const Node* find_overlap_node(const_key_reference low, const_key_reference high) const
+    {
+      const Node* p_node = compare(low, high) ? p_root : ETL_NULLPTR;
+
+      while ((p_node != ETL_NULLPTR) && !is_overlap(p_node, low, high))
+      {
+        // If the left subtree reaches past low then either it has an overlap
+        // or nothing to the right can have one.
+        if ((p_node->left != ETL_NULLPTR) && compare(low, p_node->left->max_high))
+        {
+          p_node = p_node->left;
+        }
+        else
+        {
+          p_node = p_node->right;
+        }
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Visits the nodes in the subtree that overlap [low, high).
+    //*************************************************************************
+    template <typename TNode, typename TFunction>
+    void visit_overlaps(TNode* p_node, const_key_reference low, const_key_reference high, TFunction& function) const
+    {
+      // Skip subtrees that end before low.
+      if ((p_node == ETL_NULLPTR) || !compare(low, p_node->max_high))
+      {
+        return;
+      }
+
+      visit_overlaps<TNode>(p_node->left, low, high, function);
+
+      // Everything further right starts at or after this node.
+      if (compare(p_node->value.low, high))
+      {
+        if (compare(low, p_node->value.high))
+        {
+          function(p_node->value);
+        }
+
+        visit_overlaps<TNode>(p_node->right, low, high, function);
+      }
+    }
+
+    //*************************************************************************
+    /// Visits the nodes in the subtree that contain the point.
+    //*************************************************************************
+    template <typename TNode, typename TFunction>
+    void visit_containing(TNode* p_node, const_key_reference point, TFunction& function) const
+    {
+      // Skip subtrees that end at or before the point.
+      if ((p_node == ETL_NULLPTR) || !compare(point, p_node->max_high))
+      {
+        return;
+      }
+
+      visit_containing<TNode>(p_node->left, point, function);
+
+      // Everything further right starts at or after this node.
+      if (!compare(point, p_node->value.low))
+      {
+        if (compare(point, p_node->value.high))
+        {
+          function(p_node->value);
+        }
+
+        visit_containing<TNode>(p_node->right, point, function);
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys all of the nodes in the subtree.
+    //*************************************************************************
+    void destroy_subtree(Node* p_node)
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        destroy_subtree(p_node->left);
+        destroy_subtree(p_node->right);
+        p_node_pool->destroy(p_node);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the leftmost node of the subtree.
+    //*************************************************************************
+    template <typename TNode>
+    static TNode* leftmost(TNode* p_node)
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        while (p_node->left != ETL_NULLPTR)
+        {
+          p_node = p_node->left;
+        }
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Gets the rightmost node of the subtree.
+    //*************************************************************************
+    template <typename TNode>
+    static TNode* rightmost(TNode* p_node)
+    {
+      if (p_node != ETL_NULLPTR)
+      {
+        while (p_node->right != ETL_NULLPTR)
+        {
+          p_node = p_node->right;
+        }
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// Gets the next node in order. Null after the last node.
+    //*************************************************************************
+    template <typename TNode>
+    static TNode* next_node(TNode* p_node)
+    {
+      if (p_node->right != ETL_NULLPTR)
+      {
+        return leftmost(p_node->right);
+      }
+
+      TNode* p_parent = p_node->parent;
+
+      while ((p_parent != ETL_NULLPTR) && (p_node == p_parent->right))
+      {
+        p_node   = p_parent;
+        p_parent = p_parent->parent;
+      }
+
+      return p_parent;
+    }
+
+    //*************************************************************************
+    /// Gets the previous node in order. The last node if at end.
+    //*************************************************************************
+    template <typename TNode>
+    TNode* prev_node(TNode* p_node) const
+    {
+      if (p_node == ETL_NULLPTR)
+      {
+        return rightmost(static_cast<TNode*>(p_root));
+      }
+
+      if (p_node->left != ETL_NULLPTR)
+      {
+        return rightmost(p_node->left);
+      }
+
+      TNode* p_parent = p_node->parent;
+
+      while ((p_parent != ETL_NULLPTR) && (p_node == p_parent->left))
+      {
+        p_node   = p_parent;
+        p_parent = p_parent->parent;
+      }
+
+      return p_parent;
+    }
+
+    etl::ipool* p_node_pool; ///< The pool of nodes.
+    Node*       p_root;      ///< The root of the tree.
+    key_compare compare;     ///< The bound comparator.
+
+    // Disable copy construction.
+    iinterval_map(const iinterval_map&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_INTERVAL_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iinterval_map()
+    {
+    }
+#else
+  protected:
+    ~iinterval_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// An interval_map with the capacity defined at compile time.
+  ///\tparam TKey     The type of the interval bounds.
+  ///\tparam TMapped  The type of the value associated with each interval.
+  ///\tparam MAX_SIZE_ The maximum number of intervals.
+  ///\tparam TCompare The ordering of the bounds. Default etl::less<TKey>.
+  ///\ingroup interval_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TCompare = etl::less<TKey> >
+  class interval_map : public etl::iinterval_map<TKey, TMapped, TCompare>
+  {
+  public:
+
+    typedef etl::iinterval_map<TKey, TMapped, TCompare> base_t;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    interval_map()
+      : base_t(node_pool, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    interval_map(const interval_map& other)
+      : base_t(node_pool, MAX_SIZE)
+    {
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~interval_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    interval_map& operator =(const interval_map& rhs)
+    {
+      this->assign(rhs);
+
+      return *this;
+    }
+
+  private:
+
+    /// The pool of nodes used for the interval_map.
+    etl::pool<typename base_t::Node, MAX_SIZE> node_pool;
+  };
+
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TCompare>
+  ETL_CONSTANT size_t interval_map<TKey, TMapped, MAX_SIZE_, TCompare>::MAX_SIZE;
+}
+
+#include "private/minmax_pop.h"
+
+#endif
@@ -385,6 +385,7 @@ namespace etl
       {
         // Read the appropriate 'etl_next'.
         p_value = p_value->etl_next;
+        ETL_NODE_PREFETCH(p_value->etl_next);
         return *this;
       }
 
@@ -465,6 +466,7 @@ namespace etl
       {
         // Read the appropriate 'etl_next'.
         p_value = p_value->etl_next;
+        ETL_NODE_PREFETCH(p_value->etl_next);
         return *this;
       }
 
@@ -0,0 +1,591 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_INDEX_FORWARD_LIST_INCLUDED
+#define ETL_INTRUSIVE_INDEX_FORWARD_LIST_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "static_assert.h"
+#include "iterator.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the intrusive_index_forward_list.
+  ///\ingroup intrusive_index_forward_list
+  //***************************************************************************
+  class intrusive_index_forward_list_exception : public exception
+  {
+  public:
+
+    intrusive_index_forward_list_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the intrusive_index_forward_list.
+  ///\ingroup intrusive_index_forward_list
+  //***************************************************************************
+  class intrusive_index_forward_list_empty : public intrusive_index_forward_list_exception
+  {
+  public:
+
+    intrusive_index_forward_list_empty(string_type file_name_, numeric_type line_number_)
+      : intrusive_index_forward_list_exception(ETL_ERROR_TEXT("intrusive_index_forward_list:empty", ETL_INTRUSIVE_INDEX_FORWARD_LIST_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Already linked exception for the intrusive_index_forward_list.
+  ///\ingroup intrusive_index_forward_list
+  //***************************************************************************
+  class intrusive_index_forward_list_value_is_already_linked : public intrusive_index_forward_list_exception
+  {
+  public:
+
+    intrusive_index_forward_list_value_is_already_linked(string_type file_name_, numeric_type line_number_)
+      : intrusive_index_forward_list_exception(ETL_ERROR_TEXT("intrusive_index_forward_list:value is already linked", ETL_INTRUSIVE_INDEX_FORWARD_LIST_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of range exception for the intrusive_index_forward_list.
+  /// Raised for a value that is not in the node array.
+  ///\ingroup intrusive_index_forward_list
+  //***************************************************************************
+  class intrusive_index_forward_list_out_of_range : public intrusive_index_forward_list_exception
+  {
+  public:
+
+    intrusive_index_forward_list_out_of_range(string_type file_name_, numeric_type line_number_)
+      : intrusive_index_forward_list_exception(ETL_ERROR_TEXT("intrusive_index_forward_list:out of range", ETL_INTRUSIVE_INDEX_FORWARD_LIST_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An intrusive singly linked list whose links are indexes in to an array
+  /// of nodes, rather than pointers.
+  /// The value type must derive from etl::index_forward_link<ID, TIndex>.
+  /// The list holds only the index of its head and the address of the array,
+  /// so the array and the list may be copied or mapped elsewhere together and
+  /// the list pointed at the new array with rebase().
+  ///\tparam TValue The value type, held in the node array.
+  ///\tparam TLink  The link type, an etl::index_forward_link.
+  ///\ingroup intrusive_index_forward_list
+  //***************************************************************************
+  template <typename TValue, typename TLink = etl::index_forward_link<0> >
+  class intrusive_index_forward_list
+  {
+  public:
+
+    ETL_STATIC_ASSERT((etl::is_base_of<TLink, TValue>::value), "TValue must derive from TLink");
+
+    typedef TValue                        value_type;
+    typedef TValue&                       reference;
+    typedef const TValue&                 const_reference;
+    typedef TValue*                       pointer;
+    typedef const TValue*                 const_pointer;
+    typedef TLink                         link_type;
+    typedef typename TLink::index_type    index_type;
+    typedef size_t                        size_type;
+    typedef intrusive_index_forward_list<TValue, TLink> list_type;
+
+    static ETL_CONSTANT index_type Terminal = TLink::Terminal;
+
+    class const_iterator;
+
+    //*************************************************************************
+    /// iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, value_type>
+    {
+    public:
+
+      friend class intrusive_index_forward_list;
+      friend class const_iterator;
+
+      iterator()
+        : p_list(ETL_NULLPTR)
+        , index(Terminal)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        index = p_list->next_of(index);
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return p_list->p_base[index];
+      }
+
+      pointer operator ->() const
+      {
+        return &p_list->p_base[index];
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      iterator(list_type* p_list_, index_type index_)
+        : p_list(p_list_)
+        , index(index_)
+      {
+      }
+
+      list_type* p_list;
+      index_type index;
+    };
+
+    //*************************************************************************
+    /// const_iterator.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class intrusive_index_forward_list;
+
+      const_iterator()
+        : p_list(ETL_NULLPTR)
+        , index(Terminal)
+      {
+      }
+
+      const_iterator(const iterator& other)
+        : p_list(other.p_list)
+        , index(other.index)
+      {
+      }
+
+      const_iterator& operator ++()
+      {
+        index = p_list->next_of(index);
+        return *this;
+      }
+
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      const_reference operator *() const
+      {
+        return p_list->p_base[index];
+      }
+
+      const_pointer operator ->() const
+      {
+        return &p_list->p_base[index];
+      }
+
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      const_iterator(const list_type* p_list_, index_type index_)
+        : p_list(p_list_)
+        , index(index_)
+      {
+      }
+
+      const list_type* p_list;
+      index_type       index;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_base_    The start of the node array.
+    ///\param capacity_  The number of nodes in the array.
+    /// If asserts or exceptions are enabled, emits an etl::intrusive_index_forward_list_out_of_range
+    /// if the capacity needs a reserved index.
+    //*************************************************************************
+    intrusive_index_forward_list(value_type* p_base_, size_t capacity_)
+      : p_base(p_base_)
+      , capacity(capacity_)
+      , head(Terminal)
+      , current_size(0U)
+    {
+      ETL_ASSERT(capacity_ < size_t(Terminal), ETL_ERROR(intrusive_index_forward_list_out_of_range));
+    }
+
+    //*************************************************************************
+    /// Constructor from a node array.
+    //*************************************************************************
+    template <size_t VCapacity>
+    explicit intrusive_index_forward_list(value_type (&nodes)[VCapacity])
+      : p_base(nodes)
+      , capacity(VCapacity)
+      , head(Terminal)
+      , current_size(0U)
+    {
+      ETL_STATIC_ASSERT(VCapacity < size_t(Terminal), "Too many nodes for the index type");
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Unlinks the nodes.
+    //*************************************************************************
+    ~intrusive_index_forward_list()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Points the list at a node array that has moved.
+    /// The new array must hold the nodes as they were in the old one.
+    //*************************************************************************
+    void rebase(value_type* p_base_)
+    {
+      p_base = p_base_;
+    }
+
+    //*************************************************************************
+    /// Gets the start of the node array.
+    //*************************************************************************
+    value_type* base()
+    {
+      return p_base;
+    }
+
+    //*************************************************************************
+    /// Gets the start of the node array.
+    //*************************************************************************
+    const value_type* base() const
+    {
+      return p_base;
+    }
+
+    //*************************************************************************
+    /// Gets the index of a value in the node array.
+    //*************************************************************************
+    index_type index_of(const_reference value) const
+    {
+      return index_type(&value - p_base);
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    /// before_begin() may only be passed to insert_after and erase_after.
+    //*************************************************************************
+    iterator before_begin()
+    {
+      return iterator(this, Before_Begin);
+    }
+
+    const_iterator before_begin() const
+    {
+      return const_iterator(this, Before_Begin);
+    }
+
+    iterator begin()
+    {
+      return iterator(this, head);
+    }
+
+    const_iterator begin() const
+    {
+      return const_iterator(this, head);
+    }
+
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, head);
+    }
+
+    iterator end()
+    {
+      return iterator(this, Terminal);
+    }
+
+    const_iterator end() const
+    {
+      return const_iterator(this, Terminal);
+    }
+
+    const_iterator cend() const
+    {
+      return const_iterator(this, Terminal);
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the first value.
+    /// If asserts or exceptions are enabled, emits an etl::intrusive_index_forward_list_empty if the list is empty.
+    //*************************************************************************
+    reference front()
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(intrusive_index_forward_list_empty));
+
+      return p_base[head];
+    }
+
+    const_reference front() const
+    {
+      ETL_ASSERT(!empty(), ETL_ERROR(intrusive_index_forward_list_empty));
+
+      return p_base[head];
+    }
+
+    //*************************************************************************
+    /// Pushes a value to the front of the list.
+    //*************************************************************************
+    void push_front(reference value)
+    {
+      insert_after(before_begin(), value);
+    }
+
+    //*************************************************************************
+    /// Removes the value at the front of the list.
+    /// If asserts or exceptions are enabled, emits an etl::intrusive_index_forward_list_empty if the list is empty.
+    //*************************************************************************
+    void pop_front()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(intrusive_index_forward_list_empty));
+
+      erase_after(before_begin());
+    }
+
+    //*************************************************************************
+    /// Inserts a value after 'position'.
+    /// If asserts or exceptions are enabled, emits an etl::intrusive_index_forward_list_value_is_already_linked
+    /// if the value is in a list, or an etl::intrusive_index_forward_list_out_of_range if it is not in the node array.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert_after(const_iterator position, reference value)
+    {
+      link_type& link = value;
+
+      ETL_ASSERT_OR_RETURN_VALUE(!link.is_linked(), ETL_ERROR(intrusive_index_forward_list_value_is_already_linked), end());
+      ETL_ASSERT_OR_RETURN_VALUE(is_in_array(value), ETL_ERROR(intrusive_index_forward_list_out_of_range), end());
+
+      const index_type index = index_of(value);
+      index_type&      next  = next_link(position.index);
+
+      link.etl_next = next;
+      next          = index;
+
+      ++current_size;
+
+      return iterator(this, index);
+    }
+
+    //*************************************************************************
+    /// Erases the value after 'position'.
+    ///\return An iterator to the value after the erased one.
+    //*************************************************************************
+    iterator erase_after(const_iterator position)
+    {
+      index_type& next = next_link(position.index);
+
+      if (next != Terminal)
+      {
+        link_type& link = link_at(next);
+
+        next = link.etl_next;
+        link.clear();
+        --current_size;
+      }
+
+      return iterator(this, next);
+    }
+
+    //*************************************************************************
+    /// Removes a value from the list.
+    /// O(N), as the value before it must be found.
+    /// Does nothing if the value is not in the list.
+    //*************************************************************************
+    void remove(reference value)
+    {
+      const index_type index    = index_of(value);
+      index_type       previous = Before_Begin;
+
+      for (index_type i = head; i != Terminal; i = next_of(i))
+      {
+        if (i == index)
+        {
+          erase_after(const_iterator(this, previous));
+          return;
+        }
+
+        previous = i;
+      }
+    }
+
+    //*************************************************************************
+    /// Reverses the list.
+    //*************************************************************************
+    void reverse()
+    {
+      index_type previous = Terminal;
+      index_type index    = head;
+
+      while (index != Terminal)
+      {
+        link_type& link = link_at(index);
+        const index_type next = link.etl_next;
+
+        link.etl_next = previous;
+        previous      = index;
+        index         = next;
+      }
+
+      head = previous;
+    }
+
+    //*************************************************************************
+    /// Unlinks all of the values.
+    //*************************************************************************
+    void clear()
+    {
+      index_type index = head;
+
+      while (index != Terminal)
+      {
+        link_type& link = link_at(index);
+        index = link.etl_next;
+        link.clear();
+      }
+
+      head         = Terminal;
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the list is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return head == Terminal;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the list.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of nodes in the node array.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return capacity;
+    }
+
+  private:
+
+    /// The index of the position before the first value.
+    /// The largest valid index is one less, so it is never the index of a node.
+    static ETL_CONSTANT index_type Before_Begin = index_type(TLink::Terminal - 1U);
+
+    //*************************************************************************
+    bool is_in_array(const_reference value) const
+    {
+      return (&value >= p_base) && (&value < (p_base + capacity));
+    }
+
+    //*************************************************************************
+    link_type& link_at(index_type index)
+    {
+      return static_cast<link_type&>(p_base[index]);
+    }
+
+    //*************************************************************************
+    index_type next_of(index_type index) const
+    {
+      return (index == Before_Begin) ? head : static_cast<const link_type&>(p_base[index]).etl_next;
+    }
+
+    //*************************************************************************
+    index_type& next_link(index_type index)
+    {
+      return (index == Before_Begin) ? head : link_at(index).etl_next;
+    }
+
+    value_type* p_base;
+    size_t      capacity;
+    index_type  head;
+    size_t      current_size;
+
+    // Disabled.
+    intrusive_index_forward_list(const intrusive_index_forward_list&) ETL_DELETE;
+    intrusive_index_forward_list& operator =(const intrusive_index_forward_list&) ETL_DELETE;
+  };
+
+  template <typename TValue, typename TLink>
+  ETL_CONSTANT typename TLink::index_type intrusive_index_forward_list<TValue, TLink>::Terminal;
+
+  template <typename TValue, typename TLink>
+  ETL_CONSTANT typename TLink::index_type intrusive_index_forward_list<TValue, TLink>::Before_Begin;
+}
+
+#endif
@@ -38,8 +38,11 @@ SOFTWARE.
 #include "error_handler.h"
 #include "utility.h"
 #include "algorithm.h"
+#include "integral_limits.h"
+#include "static_assert.h"
 
 #include <assert.h>
+#include <stdint.h>
 
 //*****************************************************************************
 // Note:
@@ -1320,6 +1323,118 @@ namespace etl
   {
     return node->is_linked();
   }
+
+  //***************************************************************************
+  /// A forward link that holds the index of the next node, not a pointer.
+  /// The nodes are held in an array and the index is relative to its start,
+  /// so a 16 bit index is a quarter of the size of a 64 bit pointer, and the
+  /// array may be moved or shared between address spaces.
+  /// Used by etl::intrusive_index_forward_list.
+  ///\tparam TIndex An unsigned integral type. The two largest values are reserved.
+  //***************************************************************************
+  template <size_t ID_, typename TIndex = uint16_t>
+  struct index_forward_link
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TIndex>::value, "TIndex must be an unsigned integral type");
+
+    enum
+    {
+      ID = ID_,
+    };
+
+    typedef TIndex index_type;
+
+    /// The index of a link that is not in a list.
+    static ETL_CONSTANT index_type Unlinked = etl::integral_limits<index_type>::max;
+
+    /// The index that terminates a list.
+    static ETL_CONSTANT index_type Terminal = index_type(etl::integral_limits<index_type>::max - 1U);
+
+    //***********************************
+    index_forward_link()
+      : etl_next(Unlinked)
+    {
+    }
+
+    //***********************************
+    void clear()
+    {
+      etl_next = Unlinked;
+    }
+
+    //***********************************
+    ETL_NODISCARD
+    bool is_linked() const
+    {
+      return etl_next != Unlinked;
+    }
+
+    index_type etl_next;
+  };
+
+  template <size_t ID_, typename TIndex>
+  ETL_CONSTANT TIndex index_forward_link<ID_, TIndex>::Unlinked;
+
+  template <size_t ID_, typename TIndex>
+  ETL_CONSTANT TIndex index_forward_link<ID_, TIndex>::Terminal;
+
+  //***************************************************************************
+  /// A bidirectional link that holds the indexes of the previous and next
+  /// nodes, not pointers.
+  /// The nodes are held in an array and the indexes are relative to its start,
+  /// so a pair of 16 bit indexes is a quarter of the size of a pair of 64 bit
+  /// pointers, and the array may be moved or shared between address spaces.
+  /// Used by etl::intrusive_index_list.
+  ///\tparam TIndex An unsigned integral type. The two largest values are reserved.
+  //***************************************************************************
+  template <size_t ID_, typename TIndex = uint16_t>
+  struct index_bidirectional_link
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TIndex>::value, "TIndex must be an unsigned integral type");
+
+    enum
+    {
+      ID = ID_,
+    };
+
+    typedef TIndex index_type;
+
+    /// The index of a link that is not in a list.
+    static ETL_CONSTANT index_type Unlinked = etl::integral_limits<index_type>::max;
+
+    /// The index that terminates a list at either end.
+    static ETL_CONSTANT index_type Terminal = index_type(etl::integral_limits<index_type>::max - 1U);
+
+    //***********************************
+    index_bidirectional_link()
+      : etl_previous(Unlinked)
+      , etl_next(Unlinked)
+    {
+    }
+
+    //***********************************
+    void clear()
+    {
+      etl_previous = Unlinked;
+      etl_next     = Unlinked;
+    }
+
+    //***********************************
+    ETL_NODISCARD
+    bool is_linked() const
+    {
+      return etl_next != Unlinked;
+    }
+
+    index_type etl_previous;
+    index_type etl_next;
+  };
+
+  template <size_t ID_, typename TIndex>
+  ETL_CONSTANT TIndex index_bidirectional_link<ID_, TIndex>::Unlinked;
+
+  template <size_t ID_, typename TIndex>
+  ETL_CONSTANT TIndex index_bidirectional_link<ID_, TIndex>::Terminal;
 }
 
 #endif
@@ -0,0 +1,214 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+#define ETL_INTRUSIVE_QUEUE_MPSC_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "intrusive_queue.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_queue
+  /// A lock free, multiple producer, single consumer intrusive queue of values
+  /// derived from an etl::forward_link. Does not allocate.
+  ///
+  /// Producers push on to a lock free stack. When the consumer's list is empty
+  /// it takes the whole stack in one exchange and reverses it, so values are
+  /// popped in the order that they were pushed. push_back is O(1), apart from
+  /// retries when another producer pushes at the same time, and pop is amortised O(1).
+  /// As the consumer never compares and swaps the shared stack, there is no ABA problem.
+  ///
+  /// push_back may be called from any number of threads or interrupts.
+  /// front, pop and empty must only be called from the one consumer context.
+  /// \tparam TValue The type of value that the queue holds.
+  /// \tparam TLink  The forward link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_queue_mpsc_atomic
+  {
+    ETL_STATIC_ASSERT(etl::is_forward_link<TLink>::value, "TLink must be an etl::forward_link");
+
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_queue_mpsc_atomic()
+      : p_incoming(&terminator)
+      , p_front(&terminator)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// May be called from any producer context.
+    /// If asserts or exceptions are enabled, emits intrusive_queue_value_is_already_linked
+    /// if the value is already in a container.
+    ///\param value The value to push to the queue.
+    //*************************************************************************
+    void push_back(link_type& value)
+    {
+      ETL_ASSERT_OR_RETURN(!value.is_linked(), ETL_ERROR(intrusive_queue_value_is_already_linked));
+
+      link_type* p_old;
+
+      do
+      {
+        p_old = p_incoming.load(etl::memory_order_relaxed);
+        value.etl_next = p_old;
+      } while (!p_incoming.compare_exchange_weak(p_old, &value, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Gets the oldest value in the queue without removing it.
+    /// Consumer only.
+    ///\return A pointer to the value, or ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    pointer front()
+    {
+      if (p_front == &terminator)
+      {
+        take_incoming();
+      }
+
+      return (p_front == &terminator) ? ETL_NULLPTR : static_cast<pointer>(p_front);
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue.
+    /// Consumer only.
+    ///\return A pointer to the value, or ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    pointer pop()
+    {
+      if (p_front == &terminator)
+      {
+        take_incoming();
+
+        if (p_front == &terminator)
+        {
+          return ETL_NULLPTR;
+        }
+      }
+
+      link_type* p_link = p_front;
+
+      p_front = static_cast<link_type*>(p_link->etl_next);
+      p_link->clear();
+
+      return static_cast<pointer>(p_link);
+    }
+
+    //*************************************************************************
+    /// Removes the oldest value from the queue and pushes it to the destination.
+    /// Consumer only.
+    /// NOTE: The destination must be an intrusive container that supports a push_back(TLink) member function.
+    ///\return <b>true</b> if a value was moved, <b>false</b> if the queue was empty.
+    //*************************************************************************
+    template <typename TContainer>
+    bool pop_into(TContainer& destination)
+    {
+      link_type* p_link = pop();
+
+      if (p_link == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      destination.push_back(*p_link);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks if the queue is in the empty state.
+    /// Consumer only. Values pushed after the call may not be seen.
+    //*************************************************************************
+    bool empty() const
+    {
+      return (p_front == &terminator) && (p_incoming.load(etl::memory_order_acquire) == &terminator);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes the values pushed since the last call and reverses them in to the consumer's list.
+    //*************************************************************************
+    void take_incoming()
+    {
+      link_type* p_current  = p_incoming.exchange(&terminator, etl::memory_order_acquire);
+      link_type* p_previous = &terminator;
+
+      while (p_current != &terminator)
+      {
+        link_type* p_next = static_cast<link_type*>(p_current->etl_next);
+
+        p_current->etl_next = p_previous;
+        p_previous = p_current;
+        p_current  = p_next;
+      }
+
+      p_front = p_previous;
+    }
+
+    // Disable copy construction and assignment.
+    intrusive_queue_mpsc_atomic(const intrusive_queue_mpsc_atomic&);
+    intrusive_queue_mpsc_atomic& operator = (const intrusive_queue_mpsc_atomic& rhs);
+
+    etl::atomic<link_type*> p_incoming; ///< The values pushed by the producers, newest first.
+    link_type*              p_front;    ///< The consumer's values, oldest first.
+    link_type               terminator; ///< Terminator link of both lists.
+  };
+}
+
+#endif
+#endif
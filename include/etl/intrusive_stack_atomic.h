@@ -0,0 +1,173 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INTRUSIVE_STACK_ATOMIC_INCLUDED
+#define ETL_INTRUSIVE_STACK_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "intrusive_links.h"
+#include "intrusive_stack.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup intrusive_stack
+  /// A lock free intrusive stack (Treiber stack) of values derived from an etl::forward_link.
+  /// Does not allocate. push_back and pop are O(1), apart from retries when
+  /// another context changes the top at the same time.
+  ///
+  /// push_back and pop_all_into may be called from any number of threads or interrupts.
+  /// pop must only be called from one context at a time, as a value that is
+  /// popped and pushed again while another pop is in progress would corrupt the stack (ABA).
+  /// pop_all_into takes the whole stack in one exchange and is always safe.
+  /// \tparam TValue The type of value that the stack holds.
+  /// \tparam TLink  The forward link type that the value is derived from.
+  //***************************************************************************
+  template <typename TValue, typename TLink>
+  class intrusive_stack_atomic
+  {
+    ETL_STATIC_ASSERT(etl::is_forward_link<TLink>::value, "TLink must be an etl::forward_link");
+
+  public:
+
+    // Node typedef.
+    typedef TLink link_type;
+
+    // STL style typedefs.
+    typedef TValue            value_type;
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    intrusive_stack_atomic()
+      : p_top(&terminator)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a value to the stack.
+    /// If asserts or exceptions are enabled, emits intrusive_stack_value_is_already_linked
+    /// if the value is already in a container.
+    ///\param value The value to push to the stack.
+    //*************************************************************************
+    void push_back(link_type& value)
+    {
+      ETL_ASSERT_OR_RETURN(!value.is_linked(), ETL_ERROR(intrusive_stack_value_is_already_linked));
+
+      link_type* p_old;
+
+      do
+      {
+        p_old = p_top.load(etl::memory_order_relaxed);
+        value.etl_next = p_old;
+      } while (!p_top.compare_exchange_weak(p_old, &value, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Removes the value at the top of the stack.
+    /// Must not be called from more than one context at a time.
+    ///\return A pointer to the value, or ETL_NULLPTR if the stack is empty.
+    //*************************************************************************
+    pointer pop()
+    {
+      link_type* p_old;
+      link_type* p_next;
+
+      do
+      {
+        p_old = p_top.load(etl::memory_order_acquire);
+
+        if (p_old == &terminator)
+        {
+          return ETL_NULLPTR;
+        }
+
+        p_next = static_cast<link_type*>(p_old->etl_next);
+      } while (!p_top.compare_exchange_weak(p_old, p_next, etl::memory_order_acquire, etl::memory_order_acquire));
+
+      p_old->clear();
+
+      return static_cast<pointer>(p_old);
+    }
+
+    //*************************************************************************
+    /// Removes all of the values, top first, and pushes them to the destination.
+    /// NOTE: The destination must be an intrusive container that supports a push_back(TLink) member function.
+    //*************************************************************************
+    template <typename TContainer>
+    void pop_all_into(TContainer& destination)
+    {
+      link_type* p_link = p_top.exchange(&terminator, etl::memory_order_acquire);
+
+      while (p_link != &terminator)
+      {
+        link_type* p_next = static_cast<link_type*>(p_link->etl_next);
+
+        p_link->clear();
+        destination.push_back(*p_link);
+        p_link = p_next;
+      }
+    }
+
+    //*************************************************************************
+    /// Checks if the stack is in the empty state.
+    /// The result may be out of date as soon as it is returned when other contexts push or pop.
+    //*************************************************************************
+    bool empty() const
+    {
+      return p_top.load(etl::memory_order_acquire) == &terminator;
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    intrusive_stack_atomic(const intrusive_stack_atomic&);
+    intrusive_stack_atomic& operator = (const intrusive_stack_atomic& rhs);
+
+    etl::atomic<link_type*> p_top;      ///< The current top of the stack.
+    link_type               terminator; ///< Terminator link of the stack.
+  };
+}
+
+#endif
+#endif
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "limits.h"
+#include "span.h"
+#include "private/conditioning_simd.h"
 
 #include <stdint.h>
 
@@ -73,6 +75,18 @@ namespace etl
       return minuend - (value - offset);
     }
 
+    //*****************************************************************
+    /// Inverts a block of samples.
+    /// Processes the smaller of in.size() and out.size() samples.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*****************************************************************
+    void process(etl::span<const TInput> in, etl::span<TInput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      etl::private_conditioning::block_kernel<TInput>::invert(in.data(), out.data(), n, offset, minuend);
+    }
+
   private:
 
     const TInput offset;
@@ -38,11 +38,161 @@ SOFTWARE.
 #include "platform.h"
 #include "nullptr.h"
 #include "iterator.h"
+#include "span.h"
+#include "delegate.h"
 
 #include <stdint.h>
+#include <stddef.h>
+
+#if !defined(ETL_IO_PORT_BURST_UNROLL)
+  // The number of values transferred by each pass of a burst loop.
+  #define ETL_IO_PORT_BURST_UNROLL 4
+#endif
 
 namespace etl
 {
+  //***************************************************************************
+  /// A transfer passed to a DMA engine.
+  /// The engine calls 'completion' with the number of values transferred,
+  /// usually from its interrupt.
+  //***************************************************************************
+  struct io_port_transfer
+  {
+    typedef etl::delegate<void(size_t)> completion_type;
+
+    enum direction_type
+    {
+      Read,  ///< From the port to 'buffer'.
+      Write  ///< From 'data' to the port.
+    };
+
+    direction_type  direction;
+    uintptr_t       port;         ///< The address of the port.
+    void*           buffer;       ///< The destination of a Read.
+    const void*     data;         ///< The source of a Write.
+    size_t          count;        ///< The number of values.
+    size_t          element_size; ///< The size of each value.
+    completion_type completion;
+  };
+
+  //***************************************************************************
+  /// Starts a DMA transfer.
+  /// Returns false if the engine cannot take the transfer, in which case the
+  /// port transfers the values itself.
+  //***************************************************************************
+  typedef etl::delegate<bool(const etl::io_port_transfer&)> io_port_dma;
+
+  namespace private_io_port
+  {
+    //*************************************************************************
+    /// Reads 'count' values from a port.
+    //*************************************************************************
+    template <typename T>
+    void read_burst(const volatile T* port, T* p_data, size_t count)
+    {
+      for (size_t blocks = count / ETL_IO_PORT_BURST_UNROLL; blocks != 0U; --blocks)
+      {
+        for (size_t i = 0U; i < ETL_IO_PORT_BURST_UNROLL; ++i)
+        {
+          *p_data++ = *port;
+        }
+      }
+
+      for (size_t i = count % ETL_IO_PORT_BURST_UNROLL; i != 0U; --i)
+      {
+        *p_data++ = *port;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes 'count' values to a port.
+    //*************************************************************************
+    template <typename T>
+    void write_burst(volatile T* port, const T* p_data, size_t count)
+    {
+      for (size_t blocks = count / ETL_IO_PORT_BURST_UNROLL; blocks != 0U; --blocks)
+      {
+        for (size_t i = 0U; i < ETL_IO_PORT_BURST_UNROLL; ++i)
+        {
+          *port = *p_data++;
+        }
+      }
+
+      for (size_t i = count % ETL_IO_PORT_BURST_UNROLL; i != 0U; --i)
+      {
+        *port = *p_data++;
+      }
+    }
+
+    //*************************************************************************
+    /// Reads with a DMA engine, or with a burst if the engine does not start.
+    //*************************************************************************
+    template <typename T>
+    bool read_dma(const volatile T* port, etl::span<T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      if (dma.is_valid())
+      {
+        etl::io_port_transfer transfer;
+
+        transfer.direction    = etl::io_port_transfer::Read;
+        transfer.port         = reinterpret_cast<uintptr_t>(port);
+        transfer.buffer       = data.data();
+        transfer.data         = ETL_NULLPTR;
+        transfer.count        = data.size();
+        transfer.element_size = sizeof(T);
+        transfer.completion   = completion;
+
+        if (dma(transfer))
+        {
+          return true;
+        }
+      }
+
+      read_burst(port, data.data(), data.size());
+
+      if (completion.is_valid())
+      {
+        completion(data.size());
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Writes with a DMA engine, or with a burst if the engine does not start.
+    //*************************************************************************
+    template <typename T>
+    bool write_dma(volatile T* port, etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      if (dma.is_valid())
+      {
+        etl::io_port_transfer transfer;
+
+        transfer.direction    = etl::io_port_transfer::Write;
+        transfer.port         = reinterpret_cast<uintptr_t>(port);
+        transfer.buffer       = ETL_NULLPTR;
+        transfer.data         = data.data();
+        transfer.count        = data.size();
+        transfer.element_size = sizeof(T);
+        transfer.completion   = completion;
+
+        if (dma(transfer))
+        {
+          return true;
+        }
+      }
+
+      write_burst(port, data.data(), data.size());
+
+      if (completion.is_valid())
+      {
+        completion(data.size());
+      }
+
+      return false;
+    }
+  }
+
   //***************************************************************************
   /// Read write port.
   //***************************************************************************
@@ -74,6 +224,34 @@ namespace etl
       *reinterpret_cast<pointer>(ADDRESS) = value_;
     }
 
+    /// Burst read.
+    void read(etl::span<T> data) const
+    {
+      private_io_port::read_burst(reinterpret_cast<const_pointer>(ADDRESS), data.data(), data.size());
+    }
+
+    /// Read with a DMA engine, or with a burst read if the engine does not start.
+    /// 'completion' is called with the number of values read.
+    /// Returns true if the DMA engine started.
+    bool read(etl::span<T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::read_dma(reinterpret_cast<const_pointer>(ADDRESS), data, dma, completion);
+    }
+
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      private_io_port::write_burst(reinterpret_cast<pointer>(ADDRESS), data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::write_dma(reinterpret_cast<pointer>(ADDRESS), data, dma, completion);
+    }
+
     /// Write.
     io_port_rw& operator =(T value_)
     {
@@ -148,6 +326,20 @@ namespace etl
       return *reinterpret_cast<const_pointer>(ADDRESS);
     }
 
+    /// Burst read.
+    void read(etl::span<T> data) const
+    {
+      private_io_port::read_burst(reinterpret_cast<const_pointer>(ADDRESS), data.data(), data.size());
+    }
+
+    /// Read with a DMA engine, or with a burst read if the engine does not start.
+    /// 'completion' is called with the number of values read.
+    /// Returns true if the DMA engine started.
+    bool read(etl::span<T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::read_dma(reinterpret_cast<const_pointer>(ADDRESS), data, dma, completion);
+    }
+
     /// Read
     const_reference operator *() const
     {
@@ -212,6 +404,20 @@ namespace etl
       *reinterpret_cast<pointer>(ADDRESS) = value_;
     }
 
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      private_io_port::write_burst(reinterpret_cast<pointer>(ADDRESS), data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::write_dma(reinterpret_cast<pointer>(ADDRESS), data, dma, completion);
+    }
+
     /// Write
     io_port_wo& operator *()
     {
@@ -289,6 +495,30 @@ namespace etl
       *reinterpret_cast<pointer>(ADDRESS) = shadow_value;
     }
 
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+      }
+
+      private_io_port::write_burst(reinterpret_cast<pointer>(ADDRESS), data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+      }
+
+      return private_io_port::write_dma(reinterpret_cast<pointer>(ADDRESS), data, dma, completion);
+    }
+
     /// Write.
     io_port_wos& operator =(T value_)
     {
@@ -410,6 +640,34 @@ namespace etl
       *address = value_;
     }
 
+    /// Burst read.
+    void read(etl::span<T> data) const
+    {
+      private_io_port::read_burst(address, data.data(), data.size());
+    }
+
+    /// Read with a DMA engine, or with a burst read if the engine does not start.
+    /// 'completion' is called with the number of values read.
+    /// Returns true if the DMA engine started.
+    bool read(etl::span<T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::read_dma(address, data, dma, completion);
+    }
+
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      private_io_port::write_burst(address, data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::write_dma(address, data, dma, completion);
+    }
+
     /// Write.
     io_port_rw& operator =(T value_)
     {
@@ -509,6 +767,20 @@ namespace etl
       return *address;
     }
 
+    /// Burst read.
+    void read(etl::span<T> data) const
+    {
+      private_io_port::read_burst(address, data.data(), data.size());
+    }
+
+    /// Read with a DMA engine, or with a burst read if the engine does not start.
+    /// 'completion' is called with the number of values read.
+    /// Returns true if the DMA engine started.
+    bool read(etl::span<T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::read_dma(address, data, dma, completion);
+    }
+
     /// Read
     const_reference operator *() const
     {
@@ -598,6 +870,20 @@ namespace etl
       *address = value_;
     }
 
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      private_io_port::write_burst(address, data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      return private_io_port::write_dma(address, data, dma, completion);
+    }
+
     /// Write.
     void operator =(T value)
     {
@@ -771,6 +1057,30 @@ namespace etl
       *address = shadow_value;
     }
 
+    /// Burst write.
+    void write(etl::span<const T> data)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+      }
+
+      private_io_port::write_burst(address, data.data(), data.size());
+    }
+
+    /// Write with a DMA engine, or with a burst write if the engine does not start.
+    /// 'completion' is called with the number of values written.
+    /// Returns true if the DMA engine started.
+    bool write(etl::span<const T> data, const etl::io_port_dma& dma, const etl::io_port_transfer::completion_type& completion)
+    {
+      if (!data.empty())
+      {
+        shadow_value = data.back();
+      }
+
+      return private_io_port::write_dma(address, data, dma, completion);
+    }
+
     /// Write.
     io_port_wos& operator =(T value_)
     {
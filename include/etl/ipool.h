@@ -38,6 +38,8 @@ SOFTWARE.
 #include "utility.h"
 #include "memory.h"
 #include "placement_new.h"
+#include "span.h"
+#include "memory_statistics.h"
 
 #define ETL_POOL_CPP03_CODE 0
 
@@ -120,6 +122,37 @@ namespace etl
       return reinterpret_cast<T*>(allocate_item());
     }
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    /// \param items Receives the pointers to the allocated storage.
+    /// \param n     The number of items to allocate.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** items, size_t n)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return allocate_items(reinterpret_cast<char**>(items), n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    /// \return The number of items allocated.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    size_t allocate_n(etl::span<T*, Extent> items)
+    {
+      return allocate_n(items.data(), items.size());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create default.
@@ -242,11 +275,36 @@ namespace etl
       release_item((char*)p);
     }
 
+    //*************************************************************************
+    /// Release n objects to the pool in one operation.
+    /// If asserts or exceptions are enabled and any of the objects do not belong
+    /// to this pool then an etl::pool_object_not_in_pool is thrown and none are released.
+    /// \param items The pointers to the objects to be released.
+    /// \param n     The number of objects to release.
+    //*************************************************************************
+    template <typename T>
+    void release_n(T* const* items, size_t n)
+    {
+      release_items(reinterpret_cast<const void* const*>(items), n);
+    }
+
+    //*************************************************************************
+    /// Release each of the objects in the span to the pool in one operation.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    void release_n(etl::span<T*, Extent> items)
+    {
+      release_n(items.data(), items.size());
+    }
+
     //*************************************************************************
     /// Release all objects in the pool.
     //*************************************************************************
     void release_all()
     {
+#if defined(ETL_MEMORY_STATISTICS)
+      statistics.record_release(items_allocated);
+#endif
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
@@ -313,6 +371,24 @@ namespace etl
       return items_allocated == Max_Size;
     }
 
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    /// Gets the allocation statistics of the pool.
+    //*************************************************************************
+    const etl::memory_statistics& get_memory_statistics() const
+    {
+      return statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the allocation statistics of the pool.
+    //*************************************************************************
+    void reset_memory_statistics()
+    {
+      statistics.reset();
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -363,15 +439,113 @@ namespace etl
           // No more left!
           p_next = ETL_NULLPTR;
         }
+
+#if defined(ETL_MEMORY_STATISTICS)
+        statistics.record_allocation();
+#endif
       }
       else
       {
+#if defined(ETL_MEMORY_STATISTICS)
+        statistics.record_failed_allocation();
+#endif
         ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
       }
 
       return p_value;
     }
 
+    //*************************************************************************
+    /// Allocate n items from the pool.
+    //*************************************************************************
+    size_t allocate_items(char** items, size_t n)
+    {
+      // Enough free space left?
+      if (n > size_t(Max_Size - items_allocated))
+      {
+#if defined(ETL_MEMORY_STATISTICS)
+        statistics.record_failed_allocation();
+#endif
+        ETL_ASSERT_FAIL(ETL_ERROR(pool_no_allocation));
+        return 0U;
+      }
+
+      if (n == 0U)
+      {
+        return 0U;
+      }
+
+      // Initialise as many as n single allocations would have done.
+      const uint32_t n_initialise = etl::min(Max_Size - items_initialised, uint32_t(n));
+
+      char* p = p_buffer + (items_initialised * Item_Size);
+
+      for (uint32_t i = 0U; i < n_initialise; ++i)
+      {
+        char* np = p + Item_Size;
+        *reinterpret_cast<char**>(p) = np;
+        p = np;
+      }
+
+      items_initialised += n_initialise;
+
+      // Unlink n items from the head of the free list.
+      for (size_t i = 0U; i < n; ++i)
+      {
+        items[i] = p_next;
+        p_next   = *reinterpret_cast<char**>(p_next);
+      }
+
+      items_allocated += uint32_t(n);
+
+#if defined(ETL_MEMORY_STATISTICS)
+      statistics.record_allocation(n);
+#endif
+
+      if (items_allocated == Max_Size)
+      {
+        // No more left!
+        p_next = ETL_NULLPTR;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Release n items back to the pool.
+    //*************************************************************************
+    void release_items(const void* const* items, size_t n)
+    {
+      if (n == 0U)
+      {
+        return;
+      }
+
+      ETL_ASSERT_OR_RETURN(n <= items_allocated, ETL_ERROR(pool_no_allocation));
+
+      // Do they all belong to us?
+      for (size_t i = 0U; i < n; ++i)
+      {
+        ETL_ASSERT_OR_RETURN(is_item_in_pool(static_cast<const char*>(items[i])), ETL_ERROR(pool_object_not_in_pool));
+      }
+
+      // Link the items together and splice them onto the head of the free list.
+      for (size_t i = 0U; i < (n - 1U); ++i)
+      {
+        *reinterpret_cast<char**>(const_cast<void*>(items[i])) = static_cast<char*>(const_cast<void*>(items[i + 1U]));
+      }
+
+      *reinterpret_cast<char**>(const_cast<void*>(items[n - 1U])) = p_next;
+
+      p_next = static_cast<char*>(const_cast<void*>(items[0]));
+
+      items_allocated -= uint32_t(n);
+
+#if defined(ETL_MEMORY_STATISTICS)
+      statistics.record_release(n);
+#endif
+    }
+
     //*************************************************************************
     /// Release an item back to the pool.
     //*************************************************************************
@@ -414,6 +588,10 @@ namespace etl
         p_next = p_value;
 
         --items_allocated;
+
+#if defined(ETL_MEMORY_STATISTICS)
+        statistics.record_release();
+#endif
       }
       else 
       {
@@ -454,6 +632,10 @@ namespace etl
     const uint32_t Item_Size;    ///< The size of allocated items.
     const uint32_t Max_Size;     ///< The maximum number of objects that can be allocated.
 
+#if defined(ETL_MEMORY_STATISTICS)
+    etl::memory_statistics statistics; ///< The allocation statistics.
+#endif
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -33,6 +33,8 @@ SOFTWARE.
 
 #include "platform.h"
 
+#include <stddef.h>
+
 namespace etl
 {
   class ireference_counted_message;
@@ -47,6 +49,18 @@ namespace etl
     virtual ~ireference_counted_message_pool() {}
     virtual void release(const etl::ireference_counted_message& msg) = 0;
 
+    //***************************************************************************
+    /// Release a batch of messages.
+    /// Override to release them under a single lock.
+    //***************************************************************************
+    virtual void release_batch(etl::ireference_counted_message* const* messages, size_t count)
+    {
+      for (size_t i = 0U; i < count; ++i)
+      {
+        release(*messages[i]);
+      }
+    }
+
   protected:
 
     //***************************************************************************
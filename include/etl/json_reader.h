@@ -0,0 +1,1055 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_JSON_READER_INCLUDED
+#define ETL_JSON_READER_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "basic_string.h"
+#include "to_arithmetic.h"
+#include "transcode.h"
+#include "enum_type.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup json_reader json_reader
+/// A pull tokenizer for JSON that uses no dynamic memory.
+/// Input is supplied in chunks with feed() and tokens are read with next().
+/// When next() returns Need_More, the chunk has been used up and may be
+/// released before the next one is fed.
+/// Tokens refer to the input where they can. A token that is split between
+/// chunks is copied to an internal buffer of Max_Token_Size characters, and
+/// its text refers to that instead. Either way, the text is valid until the
+/// next call to next() or feed().
+/// Strings and keys are returned without their quotes, with the escapes
+/// left in place. Use etl::json_unescape to decode them.
+/// A sequence of top level values is allowed, as in a stream of messages.
+/// Call finish() once all of the input has been fed; the reader then returns
+/// End_Of_Input, or Error if the input stopped inside a value.
+///\code
+/// etl::span<char> data = bip.read_reserve();
+/// reader.feed(etl::string_view(data.data(), data.size()));
+/// for (etl::json_token token = reader.next(); token.type != etl::json_token_type::Need_More; token = reader.next())
+/// {
+///   ...
+/// }
+/// bip.read_commit(data);
+///\endcode
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The types of JSON token.
+  ///\ingroup json_reader
+  //***************************************************************************
+  struct json_token_type
+  {
+    enum enum_type
+    {
+      Begin_Object,
+      End_Object,
+      Begin_Array,
+      End_Array,
+      Key,
+      String,
+      Number,
+      True,
+      False,
+      Null,
+      Need_More,
+      End_Of_Input,
+      Error
+    };
+
+    ETL_DECLARE_ENUM_TYPE(json_token_type, uint_least8_t)
+    ETL_ENUM_TYPE(Begin_Object, "Begin_Object")
+    ETL_ENUM_TYPE(End_Object,   "End_Object")
+    ETL_ENUM_TYPE(Begin_Array,  "Begin_Array")
+    ETL_ENUM_TYPE(End_Array,    "End_Array")
+    ETL_ENUM_TYPE(Key,          "Key")
+    ETL_ENUM_TYPE(String,       "String")
+    ETL_ENUM_TYPE(Number,       "Number")
+    ETL_ENUM_TYPE(True,         "True")
+    ETL_ENUM_TYPE(False,        "False")
+    ETL_ENUM_TYPE(Null,         "Null")
+    ETL_ENUM_TYPE(Need_More,    "Need_More")
+    ETL_ENUM_TYPE(End_Of_Input, "End_Of_Input")
+    ETL_ENUM_TYPE(Error,        "Error")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The reason for an Error token.
+  ///\ingroup json_reader
+  //***************************************************************************
+  struct json_error
+  {
+    enum enum_type
+    {
+      None,
+      Syntax,
+      Too_Deep,
+      Token_Too_Long,
+      Unexpected_End
+    };
+
+    ETL_DECLARE_ENUM_TYPE(json_error, uint_least8_t)
+    ETL_ENUM_TYPE(None,           "None")
+    ETL_ENUM_TYPE(Syntax,         "Syntax")
+    ETL_ENUM_TYPE(Too_Deep,       "Too_Deep")
+    ETL_ENUM_TYPE(Token_Too_Long, "Token_Too_Long")
+    ETL_ENUM_TYPE(Unexpected_End, "Unexpected_End")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// A JSON token.
+  ///\ingroup json_reader
+  //***************************************************************************
+  struct json_token
+  {
+    json_token()
+      : type(json_token_type::Need_More)
+      , text()
+      , has_escapes(false)
+    {
+    }
+
+    explicit json_token(json_token_type type_, etl::string_view text_ = etl::string_view(), bool has_escapes_ = false)
+      : type(type_)
+      , text(text_)
+      , has_escapes(has_escapes_)
+    {
+    }
+
+    //*************************************************************************
+    /// Converts the text of a Number token.
+    //*************************************************************************
+    template <typename T>
+    etl::to_arithmetic_result<T> as() const
+    {
+      return etl::to_arithmetic<T>(text);
+    }
+
+    json_token_type  type;
+    etl::string_view text;        ///< The text of a Key, String or Number, or the literal.
+    bool             has_escapes; ///< Whether a Key or String contains escapes.
+  };
+
+  namespace private_json_reader
+  {
+    //*************************************************************************
+    /// Returns true for white space.
+    //*************************************************************************
+    inline bool is_space(char c)
+    {
+      return (c == ' ') || (c == '\n') || (c == '\r') || (c == '\t');
+    }
+
+    //*************************************************************************
+    /// Returns true for characters that may appear in a number.
+    //*************************************************************************
+    inline bool is_number_char(char c)
+    {
+      return ((c >= '0') && (c <= '9')) || (c == '-') || (c == '+') || (c == '.') || (c == 'e') || (c == 'E');
+    }
+
+    //*************************************************************************
+    /// Returns true for characters that may appear in a literal.
+    //*************************************************************************
+    inline bool is_literal_char(char c)
+    {
+      return (c >= 'a') && (c <= 'z');
+    }
+
+    //*************************************************************************
+    /// Returns the value of a hex digit, or -1.
+    //*************************************************************************
+    inline int hex_value(char c)
+    {
+      return ((c >= '0') && (c <= '9')) ? (c - '0') :
+             ((c >= 'a') && (c <= 'f')) ? (c - 'a' + 10) :
+             ((c >= 'A') && (c <= 'F')) ? (c - 'A' + 10) : -1;
+    }
+
+    //*************************************************************************
+    /// Checks the number against the JSON grammar.
+    /// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+    //*************************************************************************
+    inline bool is_valid_number(etl::string_view text)
+    {
+      const char*       p   = text.data();
+      const char* const end = p + text.size();
+
+      if ((p != end) && (*p == '-'))
+      {
+        ++p;
+      }
+
+      if (p == end)
+      {
+        return false;
+      }
+
+      if (*p == '0')
+      {
+        ++p;
+      }
+      else if ((*p >= '1') && (*p <= '9'))
+      {
+        while ((p != end) && (*p >= '0') && (*p <= '9'))
+        {
+          ++p;
+        }
+      }
+      else
+      {
+        return false;
+      }
+
+      if ((p != end) && (*p == '.'))
+      {
+        ++p;
+
+        const char* const digits = p;
+
+        while ((p != end) && (*p >= '0') && (*p <= '9'))
+        {
+          ++p;
+        }
+
+        if (p == digits)
+        {
+          return false;
+        }
+      }
+
+      if ((p != end) && ((*p == 'e') || (*p == 'E')))
+      {
+        ++p;
+
+        if ((p != end) && ((*p == '+') || (*p == '-')))
+        {
+          ++p;
+        }
+
+        const char* const digits = p;
+
+        while ((p != end) && (*p >= '0') && (*p <= '9'))
+        {
+          ++p;
+        }
+
+        if (p == digits)
+        {
+          return false;
+        }
+      }
+
+      return p == end;
+    }
+  }
+
+  //***************************************************************************
+  /// The interface to a json_reader.
+  ///\ingroup json_reader
+  //***************************************************************************
+  class ijson_reader
+  {
+  public:
+
+    //*************************************************************************
+    /// Supplies the next chunk of input.
+    /// Any input left from the last chunk is discarded, so only call this
+    /// once next() has returned Need_More.
+    //*************************************************************************
+    void feed(etl::string_view input)
+    {
+      p_next = input.data();
+      p_end  = p_next + input.size();
+    }
+
+    //*************************************************************************
+    /// Marks the end of the input.
+    //*************************************************************************
+    void finish()
+    {
+      finished = true;
+    }
+
+    //*************************************************************************
+    /// Returns the next token.
+    //*************************************************************************
+    json_token next()
+    {
+      if (error_code != json_error::None)
+      {
+        return json_token(json_token_type::Error);
+      }
+
+      if (scan != Scan_None)
+      {
+        return continue_token();
+      }
+
+      while (true)
+      {
+        while ((p_next != p_end) && private_json_reader::is_space(*p_next))
+        {
+          ++p_next;
+          ++consumed;
+        }
+
+        if (p_next == p_end)
+        {
+          if (!finished)
+          {
+            return json_token(json_token_type::Need_More);
+          }
+
+          if ((depth == 0U) && (expect == Expect_Value))
+          {
+            return json_token(json_token_type::End_Of_Input);
+          }
+
+          return fail(json_error::Unexpected_End);
+        }
+
+        const char c = *p_next;
+
+        switch (expect)
+        {
+          case Expect_Colon:
+          {
+            if (c != ':')
+            {
+              return fail(json_error::Syntax);
+            }
+
+            advance();
+            expect = Expect_Value;
+            break;
+          }
+
+          case Expect_Comma_Or_End:
+          {
+            if (c == ',')
+            {
+              advance();
+              expect = in_object() ? Expect_Key : Expect_Value;
+              break;
+            }
+
+            return end_container(c);
+          }
+
+          case Expect_Key_Or_End:
+          {
+            if (c == '}')
+            {
+              return end_container(c);
+            }
+
+            return begin_key(c);
+          }
+
+          case Expect_Key:
+          {
+            return begin_key(c);
+          }
+
+          case Expect_Value_Or_End:
+          {
+            if (c == ']')
+            {
+              return end_container(c);
+            }
+
+            return begin_value(c);
+          }
+
+          case Expect_Value:
+          default:
+          {
+            return begin_value(c);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      p_next        = ETL_NULLPTR;
+      p_end         = ETL_NULLPTR;
+      depth         = 0U;
+      expect        = Expect_Value;
+      scan          = Scan_None;
+      escape_state  = 0U;
+      escapes       = false;
+      carry_size    = 0U;
+      consumed      = 0U;
+      finished      = false;
+      error_code    = json_error::None;
+    }
+
+    //*************************************************************************
+    /// Returns the reason for the last Error.
+    //*************************************************************************
+    json_error error() const
+    {
+      return error_code;
+    }
+
+    //*************************************************************************
+    /// Returns the number of characters consumed from all of the input.
+    /// After an Error, this is the position of the error.
+    //*************************************************************************
+    size_t position() const
+    {
+      return consumed;
+    }
+
+    //*************************************************************************
+    /// Returns the current nesting depth.
+    //*************************************************************************
+    size_t current_depth() const
+    {
+      return depth;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ijson_reader(bool* p_stack_, size_t max_depth_, char* p_carry_, size_t max_token_size_)
+      : p_stack(p_stack_)
+      , Max_Depth(max_depth_)
+      , p_carry(p_carry_)
+      , Max_Token_Size(max_token_size_)
+    {
+      reset();
+    }
+
+  private:
+
+    enum expect_type
+    {
+      Expect_Value,
+      Expect_Value_Or_End,
+      Expect_Key,
+      Expect_Key_Or_End,
+      Expect_Colon,
+      Expect_Comma_Or_End
+    };
+
+    enum scan_type
+    {
+      Scan_None,
+      Scan_Key,
+      Scan_String,
+      Scan_Number,
+      Scan_Literal
+    };
+
+    enum scan_result
+    {
+      Scan_Complete,
+      Scan_Partial,
+      Scan_Invalid
+    };
+
+    //*************************************************************************
+    void advance()
+    {
+      ++p_next;
+      ++consumed;
+    }
+
+    //*************************************************************************
+    bool in_object() const
+    {
+      return p_stack[depth - 1U];
+    }
+
+    //*************************************************************************
+    json_token fail(json_error::enum_type reason)
+    {
+      error_code = reason;
+      scan       = Scan_None;
+
+      return json_token(json_token_type::Error);
+    }
+
+    //*************************************************************************
+    /// Sets the state that follows a complete value.
+    //*************************************************************************
+    void value_done()
+    {
+      expect = (depth == 0U) ? Expect_Value : Expect_Comma_Or_End;
+    }
+
+    //*************************************************************************
+    json_token begin_container(bool is_object)
+    {
+      if (depth == Max_Depth)
+      {
+        return fail(json_error::Too_Deep);
+      }
+
+      p_stack[depth] = is_object;
+      ++depth;
+      advance();
+
+      expect = is_object ? Expect_Key_Or_End : Expect_Value_Or_End;
+
+      return json_token(is_object ? json_token_type::Begin_Object : json_token_type::Begin_Array);
+    }
+
+    //*************************************************************************
+    json_token end_container(char c)
+    {
+      const bool is_object = (depth != 0U) && in_object();
+
+      if ((depth == 0U) || (c != (is_object ? '}' : ']')))
+      {
+        return fail(json_error::Syntax);
+      }
+
+      --depth;
+      advance();
+      value_done();
+
+      return json_token(is_object ? json_token_type::End_Object : json_token_type::End_Array);
+    }
+
+    //*************************************************************************
+    json_token begin_key(char c)
+    {
+      if (c != '"')
+      {
+        return fail(json_error::Syntax);
+      }
+
+      advance();
+
+      return start_token(Scan_Key);
+    }
+
+    //*************************************************************************
+    json_token begin_value(char c)
+    {
+      switch (c)
+      {
+        case '{':
+        {
+          return begin_container(true);
+        }
+
+        case '[':
+        {
+          return begin_container(false);
+        }
+
+        case '"':
+        {
+          advance();
+          return start_token(Scan_String);
+        }
+
+        default:
+        {
+          if (private_json_reader::is_number_char(c))
+          {
+            return start_token(Scan_Number);
+          }
+
+          if (private_json_reader::is_literal_char(c))
+          {
+            return start_token(Scan_Literal);
+          }
+
+          return fail(json_error::Syntax);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Scans forward from p_next for the end of the current token.
+    /// Leaves p_next at the end of the text, before any closing quote.
+    //*************************************************************************
+    scan_result scan_token()
+    {
+      switch (scan)
+      {
+        case Scan_Key:
+        case Scan_String:
+        {
+          while (p_next != p_end)
+          {
+            const char c = *p_next;
+
+            if (escape_state == 0U)
+            {
+              if (c == '"')
+              {
+                return Scan_Complete;
+              }
+
+              if (c == '\\')
+              {
+                escape_state = 1U;
+                escapes      = true;
+              }
+              else if (static_cast<unsigned char>(c) < 0x20U)
+              {
+                return Scan_Invalid;
+              }
+            }
+            else if (escape_state == 1U)
+            {
+              if (c == 'u')
+              {
+                escape_state = 5U; // Four hex digits to follow.
+              }
+              else if ((c == '"') || (c == '\\') || (c == '/') || (c == 'b') || (c == 'f') || (c == 'n') || (c == 'r') || (c == 't'))
+              {
+                escape_state = 0U;
+              }
+              else
+              {
+                return Scan_Invalid;
+              }
+            }
+            else
+            {
+              if (private_json_reader::hex_value(c) < 0)
+              {
+                return Scan_Invalid;
+              }
+
+              escape_state = (escape_state == 2U) ? 0U : (escape_state - 1U);
+            }
+
+            advance();
+          }
+
+          return Scan_Partial;
+        }
+
+        case Scan_Number:
+        {
+          while ((p_next != p_end) && private_json_reader::is_number_char(*p_next))
+          {
+            advance();
+          }
+
+          return (p_next == p_end) ? Scan_Partial : Scan_Complete;
+        }
+
+        case Scan_Literal:
+        default:
+        {
+          while ((p_next != p_end) && private_json_reader::is_literal_char(*p_next))
+          {
+            advance();
+          }
+
+          return (p_next == p_end) ? Scan_Partial : Scan_Complete;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Starts a Key, String, Number or literal at p_next.
+    //*************************************************************************
+    json_token start_token(scan_type type)
+    {
+      scan         = type;
+      escape_state = 0U;
+      escapes      = false;
+      carry_size   = 0U;
+
+      const char* const p_start = p_next;
+
+      const scan_result result = scan_token();
+
+      if (result == Scan_Invalid)
+      {
+        return fail(json_error::Syntax);
+      }
+
+      etl::string_view text(p_start, static_cast<size_t>(p_next - p_start));
+
+      if (result == Scan_Partial)
+      {
+        if (!append_carry(text))
+        {
+          return fail(json_error::Token_Too_Long);
+        }
+
+        if (!finished)
+        {
+          return json_token(json_token_type::Need_More);
+        }
+
+        text = etl::string_view(p_carry, carry_size);
+      }
+
+      return complete_token(text, result == Scan_Complete);
+    }
+
+    //*************************************************************************
+    /// Continues a token that was split at the end of the last chunk.
+    //*************************************************************************
+    json_token continue_token()
+    {
+      const char* const p_start = p_next;
+
+      const scan_result result = scan_token();
+
+      if (result == Scan_Invalid)
+      {
+        return fail(json_error::Syntax);
+      }
+
+      if (!append_carry(etl::string_view(p_start, static_cast<size_t>(p_next - p_start))))
+      {
+        return fail(json_error::Token_Too_Long);
+      }
+
+      if ((result == Scan_Partial) && !finished)
+      {
+        return json_token(json_token_type::Need_More);
+      }
+
+      return complete_token(etl::string_view(p_carry, carry_size), result == Scan_Complete);
+    }
+
+    //*************************************************************************
+    bool append_carry(etl::string_view text)
+    {
+      if ((carry_size + text.size()) > Max_Token_Size)
+      {
+        return false;
+      }
+
+      etl::copy_n(text.data(), text.size(), p_carry + carry_size);
+      carry_size += text.size();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks and returns a token once its end has been found.
+    /// 'terminated' is false if the input ended first.
+    //*************************************************************************
+    json_token complete_token(etl::string_view text, bool terminated)
+    {
+      const scan_type type = scan;
+
+      scan = Scan_None;
+
+      switch (type)
+      {
+        case Scan_Key:
+        case Scan_String:
+        {
+          if (!terminated)
+          {
+            return fail(json_error::Unexpected_End);
+          }
+
+          advance(); // The closing quote.
+
+          if (type == Scan_Key)
+          {
+            expect = Expect_Colon;
+            return json_token(json_token_type::Key, text, escapes);
+          }
+
+          value_done();
+          return json_token(json_token_type::String, text, escapes);
+        }
+
+        case Scan_Number:
+        {
+          if (!private_json_reader::is_valid_number(text))
+          {
+            return fail(json_error::Syntax);
+          }
+
+          value_done();
+          return json_token(json_token_type::Number, text);
+        }
+
+        case Scan_Literal:
+        default:
+        {
+          json_token_type token_type;
+
+          if (text == etl::string_view("true"))
+          {
+            token_type = json_token_type::True;
+          }
+          else if (text == etl::string_view("false"))
+          {
+            token_type = json_token_type::False;
+          }
+          else if (text == etl::string_view("null"))
+          {
+            token_type = json_token_type::Null;
+          }
+          else
+          {
+            return fail(json_error::Syntax);
+          }
+
+          value_done();
+          return json_token(token_type, text);
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    ijson_reader(const ijson_reader&) ETL_DELETE;
+    ijson_reader& operator =(const ijson_reader&) ETL_DELETE;
+
+    const char*  p_next;
+    const char*  p_end;
+    bool*        p_stack;       ///< true for an object, false for an array, for each level.
+    const size_t Max_Depth;
+    char*        p_carry;       ///< The text of a token that is split between chunks.
+    const size_t Max_Token_Size;
+    size_t       depth;
+    expect_type  expect;
+    scan_type    scan;
+    uint_least8_t escape_state; ///< 0, 1 after a backslash, or 2 + the number of hex digits left.
+    bool         escapes;
+    size_t       carry_size;
+    size_t       consumed;
+    bool         finished;
+    json_error   error_code;
+  };
+
+  //***************************************************************************
+  /// A json_reader.
+  ///\tparam Max_Depth      The deepest nesting of objects and arrays.
+  ///\tparam Max_Token_Size The longest token that may be split between chunks.
+  ///\ingroup json_reader
+  //***************************************************************************
+  template <size_t Max_Depth_, size_t Max_Token_Size_ = 64U>
+  class json_reader : public etl::ijson_reader
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Max_Depth_ > 0U, "Zero depth json_reader is not valid");
+    ETL_STATIC_ASSERT(Max_Token_Size_ > 0U, "Zero token size json_reader is not valid");
+
+    static ETL_CONSTANT size_t Max_Depth      = Max_Depth_;
+    static ETL_CONSTANT size_t Max_Token_Size = Max_Token_Size_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    json_reader()
+      : etl::ijson_reader(stack, Max_Depth_, carry, Max_Token_Size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct and feed the first chunk.
+    //*************************************************************************
+    explicit json_reader(etl::string_view input)
+      : etl::ijson_reader(stack, Max_Depth_, carry, Max_Token_Size_)
+    {
+      feed(input);
+    }
+
+  private:
+
+    bool stack[Max_Depth_];
+    char carry[Max_Token_Size_];
+  };
+
+  template <size_t Max_Depth_, size_t Max_Token_Size_>
+  ETL_CONSTANT size_t json_reader<Max_Depth_, Max_Token_Size_>::Max_Depth;
+
+  template <size_t Max_Depth_, size_t Max_Token_Size_>
+  ETL_CONSTANT size_t json_reader<Max_Depth_, Max_Token_Size_>::Max_Token_Size;
+
+  //***************************************************************************
+  /// Decodes the escapes in the text of a Key or String and appends the
+  /// result to the string. \u escapes, including surrogate pairs, are
+  /// written as UTF-8.
+  ///\return <b>false</b> if an escape is invalid or the result did not fit.
+  ///\ingroup json_reader
+  //***************************************************************************
+  inline bool json_unescape(etl::string_view text, etl::ibasic_string<char>& destination)
+  {
+    typedef etl::private_transcode::utf<1U> utf8;
+
+    const char*       p   = text.data();
+    const char* const end = p + text.size();
+
+    while (p != end)
+    {
+      if (*p != '\\')
+      {
+        if (destination.full())
+        {
+          return false;
+        }
+
+        destination.push_back(*p);
+        ++p;
+        continue;
+      }
+
+      ++p;
+
+      if (p == end)
+      {
+        return false;
+      }
+
+      const char c = *p;
+      ++p;
+
+      char simple = 0;
+
+      switch (c)
+      {
+        case '"':  simple = '"';  break;
+        case '\\': simple = '\\'; break;
+        case '/':  simple = '/';  break;
+        case 'b':  simple = '\b'; break;
+        case 'f':  simple = '\f'; break;
+        case 'n':  simple = '\n'; break;
+        case 'r':  simple = '\r'; break;
+        case 't':  simple = '\t'; break;
+        case 'u':  break;
+        default:   return false;
+      }
+
+      if (c != 'u')
+      {
+        if (destination.full())
+        {
+          return false;
+        }
+
+        destination.push_back(simple);
+        continue;
+      }
+
+      uint_least32_t code_point = 0U;
+
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        if ((end - p) < 4)
+        {
+          return false;
+        }
+
+        uint_least32_t unit = 0U;
+
+        for (int i = 0; i < 4; ++i)
+        {
+          const int value = private_json_reader::hex_value(*p++);
+
+          if (value < 0)
+          {
+            return false;
+          }
+
+          unit = (unit << 4) | static_cast<uint_least32_t>(value);
+        }
+
+        if (pass == 0)
+        {
+          if ((unit >= 0xDC00U) && (unit <= 0xDFFFU))
+          {
+            return false;
+          }
+
+          if ((unit < 0xD800U) || (unit > 0xDBFFU))
+          {
+            code_point = unit;
+            break;
+          }
+
+          // A high surrogate must be followed by an escaped low surrogate.
+          if (((end - p) < 2) || (p[0] != '\\') || (p[1] != 'u'))
+          {
+            return false;
+          }
+
+          p += 2;
+          code_point = unit;
+        }
+        else
+        {
+          if ((unit < 0xDC00U) || (unit > 0xDFFFU))
+          {
+            return false;
+          }
+
+          code_point = 0x10000UL + ((code_point - 0xD800U) << 10) + (unit - 0xDC00U);
+        }
+      }
+
+      const size_t units = utf8::encoded_length(code_point);
+
+      if (units > destination.available())
+      {
+        return false;
+      }
+
+      const size_t size = destination.size();
+
+      destination.uninitialized_resize(size + units);
+      utf8::encode(code_point, units, destination.data() + size);
+    }
+
+    return true;
+  }
+}
+
+#endif
@@ -35,6 +35,8 @@ SOFTWARE.
 #include "functional.h"
 #include "type_traits.h"
 #include "algorithm.h"
+#include "span.h"
+#include "private/conditioning_simd.h"
 
 #include <stdint.h>
 
@@ -77,8 +79,39 @@ namespace etl
       return TLimit()(value, lowest, highest);
     }
 
+    //*****************************************************************
+    /// Limits a block of samples.
+    /// Processes the smaller of in.size() and out.size() samples.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*****************************************************************
+    void process(etl::span<const TInput> in, etl::span<TInput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      process(in.data(), out.data(), n, etl::integral_constant<bool, etl::is_same<TLimit, etl::private_limiter::limit<TInput> >::value>());
+    }
+
   private:
 
+    //*****************************************************************
+    /// The default limit uses the block kernel.
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<bool, true>) const
+    {
+      etl::private_conditioning::block_kernel<TInput>::limit(in, out, n, lowest, highest);
+    }
+
+    //*****************************************************************
+    /// Other limits are applied to each sample.
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<bool, false>) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        out[i] = TLimit()(in[i], lowest, highest);
+      }
+    }
+
     const TInput lowest;
     const TInput highest;
   };
@@ -43,6 +43,7 @@ SOFTWARE.
 #include "type_traits.h"
 #include "algorithm.h"
 #include "memory.h"
+#include "memory_statistics.h"
 #include "iterator.h"
 #include "static_assert.h"
 #include "parameter_type.h"
@@ -286,6 +287,26 @@ namespace etl
       return p_node_pool->available();
     }
 
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    /// Gets the node allocation statistics of this list.
+    /// Nodes handed over by a move from a list on the same pool count as a
+    /// release from the source and an allocation here.
+    //*************************************************************************
+    const etl::memory_statistics& get_memory_statistics() const
+    {
+      return node_statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the node allocation statistics of this list.
+    //*************************************************************************
+    void reset_memory_statistics()
+    {
+      node_statistics.reset();
+    }
+#endif
+
   protected:
 
     //*************************************************************************
@@ -398,6 +419,9 @@ namespace etl
     size_type   MAX_SIZE;        ///< The maximum size of the list.
     bool        pool_is_shared;  ///< If <b>true</b> then the pool is shared between lists.
     ETL_DECLARE_DEBUG_COUNT;      ///< Internal debugging.
+#if defined(ETL_MEMORY_STATISTICS)
+    etl::memory_statistics node_statistics; ///< The node allocation statistics.
+#endif
   };
 
   //***************************************************************************
@@ -500,6 +524,7 @@ namespace etl
       iterator& operator ++()
       {
         p_node = p_node->next;
+        ETL_NODE_PREFETCH(p_node->next);
         return *this;
       }
 
@@ -596,6 +621,7 @@ namespace etl
       const_iterator& operator ++()
       {
         p_node = p_node->next;
+        ETL_NODE_PREFETCH(p_node->next);
         return *this;
       }
 
@@ -1856,6 +1882,9 @@ namespace etl
           if (etl::is_trivially_destructible<T>::value && !has_shared_pool())
           {
             ETL_ASSERT(p_node_pool != ETL_NULLPTR, ETL_ERROR(list_no_pool));
+#if defined(ETL_MEMORY_STATISTICS)
+            node_statistics.record_release(p_node_pool->size());
+#endif
             p_node_pool->release_all();
             ETL_RESET_DEBUG_COUNT;;
           }
@@ -1866,6 +1895,7 @@ namespace etl
 
             while (p_first != p_last)
             {
+              ETL_NODE_PREFETCH(p_first->next);                       // Fetch the next node while destroying this one.
               destroy_data_node(static_cast<data_node_t&>(*p_first)); // Destroy the current node.
               p_first = p_first->next;                                // Move to the next node.
             }
@@ -1891,6 +1921,12 @@ namespace etl
           // Are we using the same pool?
           if (this->get_node_pool() == rhs.get_node_pool())
           {
+#if defined(ETL_MEMORY_STATISTICS)
+            const size_t n = rhs.size();
+            rhs.node_statistics.record_release(n);
+            node_statistics.record_allocation(n);
+#endif
+
             // Just link the nodes to this list.
             join(terminal_node,  rhs.get_head());
             join(rhs.get_tail(), terminal_node);
@@ -2026,7 +2062,22 @@ namespace etl
     data_node_t* allocate_data_node()
     {
       data_node_t* (etl::ipool::*func)() = &etl::ipool::allocate<data_node_t>;
+#if defined(ETL_MEMORY_STATISTICS)
+      data_node_t* p_node = (p_node_pool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+        node_statistics.record_allocation();
+      }
+      else
+      {
+        node_statistics.record_failed_allocation();
+      }
+
+      return p_node;
+#else
       return (p_node_pool->*func)();
+#endif
     }
 
     //*************************************************************************
@@ -2038,6 +2089,9 @@ namespace etl
       node.value.~T();
       p_node_pool->release(&node);
       ETL_DECREMENT_DEBUG_COUNT;
+#if defined(ETL_MEMORY_STATISTICS)
+      node_statistics.record_release();
+#endif
     }
 
     // Disable copy construction.
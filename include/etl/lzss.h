@@ -0,0 +1,701 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LZSS_INCLUDED
+#define ETL_LZSS_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "byte_stream.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "span.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+ETL_STATIC_ASSERT(ETL_USING_8BIT_TYPES, "This file does not currently support targets with no 8bit type");
+
+///\defgroup lzss lzss
+/// A static memory LZ77 family codec.
+/// The compressed stream is a sequence of groups. Each group starts with a
+/// flag byte, least significant bit first, that describes up to eight items.
+/// A clear bit is a literal byte.
+/// A set bit is a two byte match, most significant byte first, that holds
+/// (distance - 1) in the upper VWindow_Bits and (length - Min_Match) in the
+/// lower VLength_Bits.
+/// Every token is byte aligned so that the decoder needs no bit reader.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for lzss.
+  ///\ingroup lzss
+  //***************************************************************************
+  class lzss_exception : public etl::exception
+  {
+  public:
+
+    lzss_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a match that refers to data before the start of the stream.
+  ///\ingroup lzss
+  //***************************************************************************
+  class lzss_invalid_stream : public lzss_exception
+  {
+  public:
+
+    lzss_invalid_stream(string_type file_name_, numeric_type line_number_)
+      : lzss_exception(ETL_ERROR_TEXT("lzss:invalid stream", ETL_LZSS_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for output that does not fit.
+  ///\ingroup lzss
+  //***************************************************************************
+  class lzss_overflow : public lzss_exception
+  {
+  public:
+
+    lzss_overflow(string_type file_name_, numeric_type line_number_)
+      : lzss_exception(ETL_ERROR_TEXT("lzss:overflow", ETL_LZSS_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The stream format shared by the compressor and decompressor.
+  ///\ingroup lzss
+  //***************************************************************************
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  struct lzss_format
+  {
+    ETL_STATIC_ASSERT((VWindow_Bits + VLength_Bits) == 16U, "A match must fit in 16 bits");
+    ETL_STATIC_ASSERT((VWindow_Bits >= 8U) && (VWindow_Bits <= 14U), "The window must be between 8 and 14 bits");
+
+    static ETL_CONSTANT size_t Window_Bits = VWindow_Bits;
+    static ETL_CONSTANT size_t Length_Bits = VLength_Bits;
+    static ETL_CONSTANT size_t Window_Size = size_t(1U) << VWindow_Bits;
+    static ETL_CONSTANT size_t Min_Match   = 3U;
+    static ETL_CONSTANT size_t Max_Match   = Min_Match + (size_t(1U) << VLength_Bits) - 1U;
+    static ETL_CONSTANT size_t Length_Mask = (size_t(1U) << VLength_Bits) - 1U;
+
+    //*************************************************************************
+    /// The largest compressed stream for 'length' bytes of input.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t max_compressed_size(size_t length)
+    {
+      return length + ((length + 7U) / 8U);
+    }
+  };
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Window_Bits;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Length_Bits;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Window_Size;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Min_Match;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Max_Match;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_format<VWindow_Bits, VLength_Bits>::Length_Mask;
+
+  //***************************************************************************
+  /// Streaming LZSS compressor.
+  /// Matches are found with hash chains over a buffer of twice the window.
+  /// Uses (2 * Window_Size * 3) + (2 << VHash_Bits) bytes of state.
+  ///\tparam VWindow_Bits The log2 of the window size.
+  ///\tparam VLength_Bits The bits for the match length. VWindow_Bits + VLength_Bits must be 16.
+  ///\tparam VHash_Bits   The log2 of the number of hash chains.
+  ///\tparam VMax_Chain   The most candidates that are tried for each match.
+  ///\ingroup lzss
+  //***************************************************************************
+  template <size_t VWindow_Bits = 11U, size_t VLength_Bits = 5U, size_t VHash_Bits = 10U, size_t VMax_Chain = 16U>
+  class lzss_compressor : public lzss_format<VWindow_Bits, VLength_Bits>
+  {
+  private:
+
+    typedef lzss_format<VWindow_Bits, VLength_Bits> format;
+
+  public:
+
+    ETL_STATIC_ASSERT(format::Max_Match <= format::Window_Size, "The longest match must not exceed the window");
+    ETL_STATIC_ASSERT((VHash_Bits >= 4U) && (VHash_Bits <= 16U), "The hash must be between 4 and 16 bits");
+    ETL_STATIC_ASSERT(VMax_Chain > 0U, "At least one candidate must be tried");
+
+    static ETL_CONSTANT size_t Hash_Size   = size_t(1U) << VHash_Bits;
+    static ETL_CONSTANT size_t Buffer_Size = 2U * format::Window_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lzss_compressor()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Compresses a chunk of input to 'writer'.
+    /// Returns the number of input bytes consumed. This is less than the size
+    /// of the input only if the writer is full.
+    //*************************************************************************
+    size_t compress(etl::span<const uint8_t> input, etl::byte_stream_writer& writer)
+    {
+      const uint8_t* p_input   = input.data();
+      size_t         remaining = input.size();
+
+      for (;;)
+      {
+        if (!flush(writer))
+        {
+          break;
+        }
+
+        if ((remaining != 0U) && ((end - position) < format::Max_Match))
+        {
+          const size_t n = fill(p_input, remaining);
+
+          p_input   += n;
+          remaining -= n;
+        }
+
+        if ((end - position) < format::Max_Match)
+        {
+          // Wait for more input, so that the next match may be as long as possible.
+          break;
+        }
+
+        encode_item();
+      }
+
+      return input.size() - remaining;
+    }
+
+    //*************************************************************************
+    /// Compresses the rest of the input and writes the final group to 'writer'.
+    /// Returns true if the stream is complete, after which the compressor is
+    /// ready for a new stream. Returns false if the writer is full, in which
+    /// case call again when it has been emptied.
+    //*************************************************************************
+    bool finish(etl::byte_stream_writer& writer)
+    {
+      for (;;)
+      {
+        if (!flush(writer))
+        {
+          return false;
+        }
+
+        if (position == end)
+        {
+          break;
+        }
+
+        encode_item();
+      }
+
+      if (item_count != 0U)
+      {
+        item_count = 8U;
+
+        if (!flush(writer))
+        {
+          return false;
+        }
+      }
+
+      reset();
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Compresses a complete stream.
+    /// Returns the size of the compressed stream.
+    /// If asserts or exceptions are enabled, emits etl::lzss_overflow if the output is too small.
+    //*************************************************************************
+    size_t compress_all(etl::span<const uint8_t> input, etl::span<uint8_t> output)
+    {
+      reset();
+
+      etl::byte_stream_writer writer(output.data(), output.size(), etl::endian::big);
+
+      const bool complete = (compress(input, writer) == input.size()) && finish(writer);
+
+      if (!complete)
+      {
+        reset();
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(complete, ETL_ERROR(lzss_overflow), 0U);
+
+      return writer.size_bytes();
+    }
+
+    //*************************************************************************
+    /// Discards the current stream.
+    //*************************************************************************
+    void reset()
+    {
+      position      = 0U;
+      end           = 0U;
+      group_length  = 1U;
+      group_flushed = 0U;
+      item_count    = 0U;
+      group[0]      = 0U;
+
+      for (size_t i = 0U; i < Hash_Size; ++i)
+      {
+        head[i] = Nil;
+      }
+    }
+
+  private:
+
+    static ETL_CONSTANT uint16_t Nil = 0xFFFFU;
+
+    //*************************************************************************
+    /// Copies input to the buffer, sliding the buffer down by a window if it is full.
+    //*************************************************************************
+    size_t fill(const uint8_t* p_input, size_t length)
+    {
+      if (end == Buffer_Size)
+      {
+        slide();
+      }
+
+      const size_t n = etl::min(length, Buffer_Size - end);
+
+      memcpy(buffer + end, p_input, n);
+      end += n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Discards the oldest window of the buffer.
+    //*************************************************************************
+    void slide()
+    {
+      memmove(buffer, buffer + format::Window_Size, end - format::Window_Size);
+      position -= format::Window_Size;
+      end      -= format::Window_Size;
+
+      for (size_t i = 0U; i < Hash_Size; ++i)
+      {
+        head[i] = rebase(head[i]);
+      }
+
+      for (size_t i = 0U; i < format::Window_Size; ++i)
+      {
+        chain[i] = rebase(chain[i + format::Window_Size]);
+      }
+    }
+
+    //*************************************************************************
+    static uint16_t rebase(uint16_t index)
+    {
+      return ((index != Nil) && (index >= format::Window_Size)) ? uint16_t(index - format::Window_Size) : Nil;
+    }
+
+    //*************************************************************************
+    size_t hash(size_t index) const
+    {
+      const uint32_t value = (uint32_t(buffer[index]) << 16) | (uint32_t(buffer[index + 1U]) << 8) | uint32_t(buffer[index + 2U]);
+
+      return size_t((value * 2654435761UL) & 0xFFFFFFFFUL) >> (32U - VHash_Bits);
+    }
+
+    //*************************************************************************
+    /// Adds the string at 'index' to the hash chains.
+    /// Returns the previous head of its chain.
+    //*************************************************************************
+    uint16_t insert(size_t index)
+    {
+      const size_t   h        = hash(index);
+      const uint16_t previous = head[h];
+
+      chain[index] = previous;
+      head[h]      = uint16_t(index);
+
+      return previous;
+    }
+
+    //*************************************************************************
+    /// Encodes a literal or a match at the current position.
+    //*************************************************************************
+    void encode_item()
+    {
+      const size_t available = etl::min(end - position, format::Max_Match);
+      size_t best_length   = 0U;
+      size_t best_distance = 0U;
+
+      if (available >= format::Min_Match)
+      {
+        uint16_t candidate = insert(position);
+        size_t   tries     = VMax_Chain;
+
+        while ((candidate != Nil) && (tries-- != 0U))
+        {
+          const size_t distance = position - candidate;
+
+          if (distance > format::Window_Size)
+          {
+            break;
+          }
+
+          const uint8_t* p_current   = buffer + position;
+          const uint8_t* p_candidate = buffer + candidate;
+
+          if (p_candidate[best_length] == p_current[best_length])
+          {
+            size_t length = 0U;
+
+            while ((length < available) && (p_candidate[length] == p_current[length]))
+            {
+              ++length;
+            }
+
+            if (length > best_length)
+            {
+              best_length   = length;
+              best_distance = distance;
+
+              if (length == available)
+              {
+                break;
+              }
+            }
+          }
+
+          candidate = chain[candidate];
+        }
+      }
+
+      if (best_length >= format::Min_Match)
+      {
+        const size_t token = ((best_distance - 1U) << VLength_Bits) | (best_length - format::Min_Match);
+
+        group[0] = uint8_t(group[0] | (1U << item_count));
+        group[group_length++] = uint8_t(token >> 8);
+        group[group_length++] = uint8_t(token);
+
+        for (size_t i = 1U; i < best_length; ++i)
+        {
+          if ((position + i + format::Min_Match) <= end)
+          {
+            insert(position + i);
+          }
+        }
+
+        position += best_length;
+      }
+      else
+      {
+        group[group_length++] = buffer[position++];
+      }
+
+      ++item_count;
+    }
+
+    //*************************************************************************
+    /// Writes a complete group to 'writer'.
+    /// Returns false if the group could not all be written.
+    //*************************************************************************
+    bool flush(etl::byte_stream_writer& writer)
+    {
+      if (item_count == 8U)
+      {
+        etl::span<char> free = writer.free_data();
+
+        const size_t n = etl::min(group_length - group_flushed, free.size());
+
+        memcpy(free.data(), group + group_flushed, n);
+        writer.skip<char>(n);
+        group_flushed += n;
+
+        if (group_flushed != group_length)
+        {
+          return false;
+        }
+
+        group_length  = 1U;
+        group_flushed = 0U;
+        item_count    = 0U;
+        group[0]      = 0U;
+      }
+
+      return true;
+    }
+
+    uint8_t  buffer[Buffer_Size];
+    uint16_t chain[Buffer_Size];
+    uint16_t head[Hash_Size];
+    size_t   position;
+    size_t   end;
+    uint8_t  group[17];
+    size_t   group_length;
+    size_t   group_flushed;
+    size_t   item_count;
+  };
+
+  template <size_t VWindow_Bits, size_t VLength_Bits, size_t VHash_Bits, size_t VMax_Chain>
+  ETL_CONSTANT size_t lzss_compressor<VWindow_Bits, VLength_Bits, VHash_Bits, VMax_Chain>::Hash_Size;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits, size_t VHash_Bits, size_t VMax_Chain>
+  ETL_CONSTANT size_t lzss_compressor<VWindow_Bits, VLength_Bits, VHash_Bits, VMax_Chain>::Buffer_Size;
+
+  template <size_t VWindow_Bits, size_t VLength_Bits, size_t VHash_Bits, size_t VMax_Chain>
+  ETL_CONSTANT uint16_t lzss_compressor<VWindow_Bits, VLength_Bits, VHash_Bits, VMax_Chain>::Nil;
+
+  //***************************************************************************
+  /// Streaming LZSS decompressor.
+  /// Keeps the last window of output so that the input and output may be
+  /// supplied in pieces of any size.
+  ///\tparam VWindow_Bits The log2 of the window size. Must match the compressor.
+  ///\tparam VLength_Bits The bits for the match length. Must match the compressor.
+  ///\ingroup lzss
+  //***************************************************************************
+  template <size_t VWindow_Bits = 11U, size_t VLength_Bits = 5U>
+  class lzss_decompressor : public lzss_format<VWindow_Bits, VLength_Bits>
+  {
+  private:
+
+    typedef lzss_format<VWindow_Bits, VLength_Bits> format;
+
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    lzss_decompressor()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Decompresses a chunk of input to 'writer'.
+    /// Returns the number of input bytes consumed. This is less than the size
+    /// of the input only if the writer is full.
+    /// If asserts or exceptions are enabled, emits etl::lzss_invalid_stream if a
+    /// match refers to data before the start of the stream.
+    //*************************************************************************
+    size_t decompress(etl::span<const uint8_t> input, etl::byte_stream_writer& writer)
+    {
+      etl::span<char> free = writer.free_data();
+
+      const uint8_t* p_input    = input.data();
+      const uint8_t* p_end      = p_input + input.size();
+      uint8_t*       p_output   = reinterpret_cast<uint8_t*>(free.data());
+      uint8_t*       p_capacity = p_output + free.size();
+      uint8_t*       p_begin    = p_output;
+      bool           valid      = true;
+
+      for (;;)
+      {
+        // Finish any match that was interrupted by a full writer.
+        while ((copy_remaining != 0U) && (p_output != p_capacity))
+        {
+          const uint8_t value = history[(history_index - copy_distance) & Mask];
+
+          history[history_index++ & Mask] = value;
+          *p_output++ = value;
+          --copy_remaining;
+        }
+
+        if ((copy_remaining != 0U) || (p_input == p_end))
+        {
+          break;
+        }
+
+        if (flags_remaining == 0U)
+        {
+          flags           = *p_input++;
+          flags_remaining = 8U;
+        }
+        else if ((flags & 1U) == 0U)
+        {
+          if (p_output == p_capacity)
+          {
+            break;
+          }
+
+          const uint8_t value = *p_input++;
+
+          history[history_index++ & Mask] = value;
+          *p_output++ = value;
+          next_flag();
+        }
+        else if (!high_pending)
+        {
+          high         = *p_input++;
+          high_pending = true;
+        }
+        else
+        {
+          const size_t token = (size_t(high) << 8) | size_t(*p_input++);
+
+          high_pending   = false;
+          copy_distance  = (token >> VLength_Bits) + 1U;
+          copy_remaining = (token & format::Length_Mask) + format::Min_Match;
+          next_flag();
+
+          if (copy_distance > history_index)
+          {
+            copy_remaining = 0U;
+            valid          = false;
+            break;
+          }
+        }
+      }
+
+      writer.skip<char>(size_t(p_output - p_begin));
+
+      if (!valid)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(lzss_invalid_stream));
+      }
+
+      return size_t(p_input - input.data());
+    }
+
+    //*************************************************************************
+    /// Decompresses a complete stream directly to 'output', which also serves as the window.
+    /// Returns the size of the decompressed data.
+    /// If asserts or exceptions are enabled, emits etl::lzss_overflow if the output is too
+    /// small, or etl::lzss_invalid_stream if a match refers to data before the start of the stream.
+    //*************************************************************************
+    static size_t decompress_all(etl::span<const uint8_t> input, etl::span<uint8_t> output)
+    {
+      const uint8_t* p_input  = input.data();
+      const uint8_t* p_end    = p_input + input.size();
+      uint8_t*       p_output = output.data();
+      const size_t   capacity = output.size();
+      size_t         size     = 0U;
+
+      while (p_input != p_end)
+      {
+        uint32_t flags = *p_input++;
+
+        for (size_t i = 0U; (i < 8U) && (p_input != p_end); ++i, flags >>= 1U)
+        {
+          if ((flags & 1U) == 0U)
+          {
+            ETL_ASSERT_OR_RETURN_VALUE(size < capacity, ETL_ERROR(lzss_overflow), size);
+
+            p_output[size++] = *p_input++;
+          }
+          else
+          {
+            ETL_ASSERT_OR_RETURN_VALUE((p_end - p_input) >= 2, ETL_ERROR(lzss_invalid_stream), size);
+
+            const size_t token    = (size_t(p_input[0]) << 8) | size_t(p_input[1]);
+            const size_t distance = (token >> VLength_Bits) + 1U;
+            const size_t length   = (token & format::Length_Mask) + format::Min_Match;
+            p_input += 2;
+
+            ETL_ASSERT_OR_RETURN_VALUE(distance <= size, ETL_ERROR(lzss_invalid_stream), size);
+            ETL_ASSERT_OR_RETURN_VALUE(length <= (capacity - size), ETL_ERROR(lzss_overflow), size);
+
+            const uint8_t* p_source = p_output + (size - distance);
+            uint8_t*       p_target = p_output + size;
+
+            // Overlapping matches repeat the bytes just written, so the copy must go forwards.
+            for (size_t j = 0U; j < length; ++j)
+            {
+              p_target[j] = p_source[j];
+            }
+
+            size += length;
+          }
+        }
+      }
+
+      return size;
+    }
+
+    //*************************************************************************
+    /// Starts a new stream.
+    //*************************************************************************
+    void reset()
+    {
+      history_index   = 0U;
+      copy_distance   = 0U;
+      copy_remaining  = 0U;
+      flags           = 0U;
+      flags_remaining = 0U;
+      high            = 0U;
+      high_pending    = false;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Mask = format::Window_Size - 1U;
+
+    //*************************************************************************
+    void next_flag()
+    {
+      flags = uint8_t(flags >> 1U);
+      --flags_remaining;
+    }
+
+    uint8_t history[format::Window_Size];
+    size_t  history_index;
+    size_t  copy_distance;
+    size_t  copy_remaining;
+    uint8_t flags;
+    size_t  flags_remaining;
+    uint8_t high;
+    bool    high_pending;
+  };
+
+  template <size_t VWindow_Bits, size_t VLength_Bits>
+  ETL_CONSTANT size_t lzss_decompressor<VWindow_Bits, VLength_Bits>::Mask;
+}
+
+#endif
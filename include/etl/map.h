@@ -36,6 +36,7 @@ SOFTWARE.
 #include "iterator.h"
 #include "functional.h"
 #include "pool.h"
+#include "memory_statistics.h"
 #include "exception.h"
 #include "error_handler.h"
 #include "debug_count.h"
@@ -177,6 +178,24 @@ namespace etl
       return max_size() - size();
     }
 
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    /// Gets the node allocation statistics of this map.
+    //*************************************************************************
+    const etl::memory_statistics& get_memory_statistics() const
+    {
+      return node_statistics;
+    }
+
+    //*************************************************************************
+    /// Clears the node allocation statistics of this map.
+    //*************************************************************************
+    void reset_memory_statistics()
+    {
+      node_statistics.reset();
+    }
+#endif
+
   protected:
 
     enum
@@ -451,6 +470,9 @@ namespace etl
     const size_type CAPACITY; ///< The maximum size of the map.
     Node* root_node;          ///< The node that acts as the map root.
     ETL_DECLARE_DEBUG_COUNT;
+#if defined(ETL_MEMORY_STATISTICS)
+    etl::memory_statistics node_statistics; ///< The node allocation statistics.
+#endif
   };
 
   //***************************************************************************
@@ -1548,7 +1570,22 @@ namespace etl
     Data_Node& allocate_data_node()
     {
       Data_Node* (etl::ipool::*func)() = &etl::ipool::allocate<Data_Node>;
+#if defined(ETL_MEMORY_STATISTICS)
+      Data_Node* p_node = (p_node_pool->*func)();
+
+      if (p_node != ETL_NULLPTR)
+      {
+        this->node_statistics.record_allocation();
+      }
+      else
+      {
+        this->node_statistics.record_failed_allocation();
+      }
+
+      return *p_node;
+#else
       return *(p_node_pool->*func)();
+#endif
     }
 
     //*************************************************************************
@@ -1559,6 +1596,9 @@ namespace etl
       node.value.~value_type();
       p_node_pool->release(&node);
       ETL_DECREMENT_DEBUG_COUNT;
+#if defined(ETL_MEMORY_STATISTICS)
+      this->node_statistics.record_release();
+#endif
     }
 
     //*************************************************************************
@@ -2138,6 +2178,14 @@ namespace etl
           // Set parent node as the next position
           position = parent;
         }
+
+#if ETL_HAS_NODE_PREFETCH
+        // The next step descends the right subtree of the new position.
+        if (position)
+        {
+          ETL_PREFETCH(position->children[kRight]);
+        }
+#endif
       }
     }
 
@@ -2170,6 +2218,14 @@ namespace etl
           // Set parent node as the next position
           position = parent;
         }
+
+#if ETL_HAS_NODE_PREFETCH
+        // The next step descends the right subtree of the new position.
+        if (position)
+        {
+          ETL_PREFETCH(position->children[kRight]);
+        }
+#endif
       }
     }
 
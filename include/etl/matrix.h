@@ -0,0 +1,823 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MATRIX_INCLUDED
+#define ETL_MATRIX_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "span.h"
+#include "iterator.h"
+#include "absolute.h"
+#include "utility.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup matrix matrix
+/// A fixed size row major matrix, for the small matrices of filters and
+/// estimators. The elements are held in the same layout as
+/// etl::multi_array<T, VRows, VColumns>, so rows are viewed as spans and
+/// columns as strided views, without copies.
+/// The loop bounds are compile time constants, so that the compiler can
+/// unroll small matrices completely.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A view of a column of a matrix.
+  ///\tparam T       The element type. May be const.
+  ///\tparam VSize   The number of elements.
+  ///\tparam VStride The distance between elements.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VSize, size_t VStride>
+  class matrix_column_view
+  {
+  public:
+
+    typedef typename etl::remove_cv<T>::type value_type;
+    typedef T&                               reference;
+    typedef T*                               pointer;
+    typedef size_t                           size_type;
+
+    //*************************************************************************
+    /// Iterator.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, T>
+    {
+    public:
+
+      iterator()
+        : p(ETL_NULLPTR)
+      {
+      }
+
+      explicit iterator(pointer p_)
+        : p(p_)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        p += VStride;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        p += VStride;
+        return temp;
+      }
+
+      reference operator *() const
+      {
+        return *p;
+      }
+
+      pointer operator ->() const
+      {
+        return p;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p == rhs.p;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.p != rhs.p;
+      }
+
+    private:
+
+      pointer p;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_first_ A pointer to the first element of the column.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit matrix_column_view(pointer p_first_)
+      : p_first(p_first_)
+    {
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at 'i'.
+    //*************************************************************************
+    ETL_CONSTEXPR reference operator [](size_t i) const
+    {
+      return p_first[i * VStride];
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator begin() const
+    {
+      return iterator(p_first);
+    }
+
+    iterator end() const
+    {
+      return iterator(p_first + (VSize * VStride));
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return VSize;
+    }
+
+  private:
+
+    pointer p_first;
+  };
+
+  //***************************************************************************
+  /// A fixed size row major matrix.
+  ///\tparam T        The element type.
+  ///\tparam VRows    The number of rows.
+  ///\tparam VColumns The number of columns.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  class matrix
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VRows != 0U) && (VColumns != 0U), "A matrix must have at least one row and column");
+
+    typedef T                                   value_type;
+    typedef size_t                              size_type;
+    typedef etl::array<T, VColumns>             row_type;
+    typedef etl::array<row_type, VRows>         elements_type;
+    typedef etl::array<T, VRows>                column_vector_type;
+    typedef etl::array<T, VColumns>             row_vector_type;
+    typedef etl::span<T, VColumns>              row_view;
+    typedef etl::span<const T, VColumns>        const_row_view;
+    typedef etl::matrix_column_view<T, VRows, VColumns>       column_view;
+    typedef etl::matrix_column_view<const T, VRows, VColumns> const_column_view;
+
+    static ETL_CONSTANT size_t Rows    = VRows;
+    static ETL_CONSTANT size_t Columns = VColumns;
+
+    // The column views need the rows to follow each other without padding.
+    ETL_STATIC_ASSERT(sizeof(row_type) == (sizeof(T) * VColumns), "The rows must be contiguous");
+
+    //*************************************************************************
+    /// Constructs a matrix of zeros.
+    //*************************************************************************
+    matrix()
+    {
+      fill(T(0));
+    }
+
+    //*************************************************************************
+    /// Constructs from an array of rows.
+    //*************************************************************************
+    explicit matrix(const T (&values)[VRows][VColumns])
+    {
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          elements[r][c] = values[r][c];
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from nested etl::arrays, such as etl::multi_array<T, VRows, VColumns>.
+    //*************************************************************************
+    explicit matrix(const elements_type& values)
+      : elements(values)
+    {
+    }
+
+    //*************************************************************************
+    /// The identity matrix.
+    //*************************************************************************
+    static matrix identity()
+    {
+      ETL_STATIC_ASSERT(VRows == VColumns, "The identity must be square");
+
+      matrix result;
+
+      for (size_t i = 0U; i < VRows; ++i)
+      {
+        result.elements[i][i] = T(1);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Sets every element to the value.
+    //*************************************************************************
+    void fill(const T& value)
+    {
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        elements[r].fill(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at row 'r', column 'c'.
+    //*************************************************************************
+    T& operator ()(size_t r, size_t c)
+    {
+      return elements[r][c];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the element at row 'r', column 'c'.
+    //*************************************************************************
+    const T& operator ()(size_t r, size_t c) const
+    {
+      return elements[r][c];
+    }
+
+    //*************************************************************************
+    /// The elements, as nested etl::arrays.
+    //*************************************************************************
+    elements_type& data()
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// The elements, as nested etl::arrays.
+    //*************************************************************************
+    const elements_type& data() const
+    {
+      return elements;
+    }
+
+    //*************************************************************************
+    /// A view of row 'r'.
+    //*************************************************************************
+    row_view row(size_t r)
+    {
+      return row_view(elements[r].data(), VColumns);
+    }
+
+    //*************************************************************************
+    /// A const view of row 'r'.
+    //*************************************************************************
+    const_row_view row(size_t r) const
+    {
+      return const_row_view(elements[r].data(), VColumns);
+    }
+
+    //*************************************************************************
+    /// A view of column 'c'.
+    //*************************************************************************
+    column_view column(size_t c)
+    {
+      return column_view(elements[0].data() + c);
+    }
+
+    //*************************************************************************
+    /// A const view of column 'c'.
+    //*************************************************************************
+    const_column_view column(size_t c) const
+    {
+      return const_column_view(elements[0].data() + c);
+    }
+
+    //*************************************************************************
+    /// Returns the transpose.
+    //*************************************************************************
+    matrix<T, VColumns, VRows> transpose() const
+    {
+      matrix<T, VColumns, VRows> result;
+
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          result(c, r) = elements[r][c];
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Adds a matrix.
+    //*************************************************************************
+    matrix& operator +=(const matrix& rhs)
+    {
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          elements[r][c] += rhs.elements[r][c];
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Subtracts a matrix.
+    //*************************************************************************
+    matrix& operator -=(const matrix& rhs)
+    {
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          elements[r][c] -= rhs.elements[r][c];
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Multiplies by a scalar.
+    //*************************************************************************
+    matrix& operator *=(const T& rhs)
+    {
+      for (size_t r = 0U; r < VRows; ++r)
+      {
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          elements[r][c] *= rhs;
+        }
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The determinant, by Gaussian elimination with partial pivoting.
+    //*************************************************************************
+    T determinant() const
+    {
+      ETL_STATIC_ASSERT(VRows == VColumns, "The determinant needs a square matrix");
+
+      if (VRows == 1U)
+      {
+        return elements[0][0];
+      }
+
+      if (VRows == 2U)
+      {
+        return (elements[0][0] * elements[1][1]) - (elements[0][1] * elements[1][0]);
+      }
+
+      matrix work(*this);
+      T      result = T(1);
+
+      for (size_t k = 0U; k < VRows; ++k)
+      {
+        const size_t pivot = work.pivot_row(k);
+
+        if (is_zero(work.elements[pivot][k]))
+        {
+          return T(0);
+        }
+
+        if (pivot != k)
+        {
+          work.swap_rows(pivot, k);
+          result = -result;
+        }
+
+        result *= work.elements[k][k];
+
+        for (size_t r = k + 1U; r < VRows; ++r)
+        {
+          const T factor = work.elements[r][k] / work.elements[k][k];
+
+          for (size_t c = k; c < VColumns; ++c)
+          {
+            work.elements[r][c] -= factor * work.elements[k][c];
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Calculates the inverse.
+    /// 2x2 and 3x3 matrices use the adjugate. Larger matrices use
+    /// Gauss-Jordan elimination with partial pivoting.
+    ///\param result Set to the inverse. Unchanged if the matrix is singular.
+    ///\return <b>false</b> if the matrix is singular.
+    //*************************************************************************
+    bool inverse(matrix& result) const
+    {
+      ETL_STATIC_ASSERT(VRows == VColumns, "The inverse needs a square matrix");
+
+      if (VRows == 1U)
+      {
+        return inverse_1x1(result);
+      }
+      else if (VRows == 2U)
+      {
+        return inverse_2x2(result);
+      }
+      else if (VRows == 3U)
+      {
+        return inverse_3x3(result);
+      }
+      else
+      {
+        return inverse_gauss_jordan(result);
+      }
+    }
+
+    //*************************************************************************
+    /// Equality.
+    //*************************************************************************
+    friend bool operator ==(const matrix& lhs, const matrix& rhs)
+    {
+      return lhs.elements == rhs.elements;
+    }
+
+    //*************************************************************************
+    /// Inequality.
+    //*************************************************************************
+    friend bool operator !=(const matrix& lhs, const matrix& rhs)
+    {
+      return !(lhs == rhs);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Checks for an exact zero, as the pivot of a singular matrix.
+    //*************************************************************************
+    static bool is_zero(const T& value)
+    {
+      return !(value < T(0)) && !(T(0) < value);
+    }
+
+    //*************************************************************************
+    /// The row, from 'k' down, with the largest magnitude in column 'k'.
+    //*************************************************************************
+    size_t pivot_row(size_t k) const
+    {
+      size_t pivot     = k;
+      T      magnitude = etl::absolute(elements[k][k]);
+
+      for (size_t r = k + 1U; r < VRows; ++r)
+      {
+        const T value = etl::absolute(elements[r][k]);
+
+        if (magnitude < value)
+        {
+          magnitude = value;
+          pivot     = r;
+        }
+      }
+
+      return pivot;
+    }
+
+    //*************************************************************************
+    void swap_rows(size_t a, size_t b)
+    {
+      row_type temp = elements[a];
+      elements[a]   = elements[b];
+      elements[b]   = temp;
+    }
+
+    //*************************************************************************
+    // The element at (r, c), or zero outside the matrix.
+    // Lets the fixed size inverses compile for every size.
+    //*************************************************************************
+    T at_or_zero(size_t r, size_t c) const
+    {
+      return ((r < VRows) && (c < VColumns)) ? elements[r][c] : T(0);
+    }
+
+    //*************************************************************************
+    void set_if_inside(size_t r, size_t c, const T& value)
+    {
+      if ((r < VRows) && (c < VColumns))
+      {
+        elements[r][c] = value;
+      }
+    }
+
+    //*************************************************************************
+    bool inverse_1x1(matrix& result) const
+    {
+      const T a = at_or_zero(0U, 0U);
+
+      if (is_zero(a))
+      {
+        return false;
+      }
+
+      result.set_if_inside(0U, 0U, T(1) / a);
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool inverse_2x2(matrix& result) const
+    {
+      const T a = at_or_zero(0U, 0U);
+      const T b = at_or_zero(0U, 1U);
+      const T c = at_or_zero(1U, 0U);
+      const T d = at_or_zero(1U, 1U);
+
+      const T det = (a * d) - (b * c);
+
+      if (is_zero(det))
+      {
+        return false;
+      }
+
+      const T reciprocal = T(1) / det;
+
+      result.set_if_inside(0U, 0U, d * reciprocal);
+      result.set_if_inside(0U, 1U, -b * reciprocal);
+      result.set_if_inside(1U, 0U, -c * reciprocal);
+      result.set_if_inside(1U, 1U, a * reciprocal);
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool inverse_3x3(matrix& result) const
+    {
+      const T a = at_or_zero(0U, 0U);
+      const T b = at_or_zero(0U, 1U);
+      const T c = at_or_zero(0U, 2U);
+      const T d = at_or_zero(1U, 0U);
+      const T e = at_or_zero(1U, 1U);
+      const T f = at_or_zero(1U, 2U);
+      const T g = at_or_zero(2U, 0U);
+      const T h = at_or_zero(2U, 1U);
+      const T i = at_or_zero(2U, 2U);
+
+      // The cofactors of the first row.
+      const T A = (e * i) - (f * h);
+      const T B = (f * g) - (d * i);
+      const T C = (d * h) - (e * g);
+
+      const T det = (a * A) + (b * B) + (c * C);
+
+      if (is_zero(det))
+      {
+        return false;
+      }
+
+      const T reciprocal = T(1) / det;
+
+      result.set_if_inside(0U, 0U, A * reciprocal);
+      result.set_if_inside(0U, 1U, ((c * h) - (b * i)) * reciprocal);
+      result.set_if_inside(0U, 2U, ((b * f) - (c * e)) * reciprocal);
+      result.set_if_inside(1U, 0U, B * reciprocal);
+      result.set_if_inside(1U, 1U, ((a * i) - (c * g)) * reciprocal);
+      result.set_if_inside(1U, 2U, ((c * d) - (a * f)) * reciprocal);
+      result.set_if_inside(2U, 0U, C * reciprocal);
+      result.set_if_inside(2U, 1U, ((b * g) - (a * h)) * reciprocal);
+      result.set_if_inside(2U, 2U, ((a * e) - (b * d)) * reciprocal);
+
+      return true;
+    }
+
+    //*************************************************************************
+    bool inverse_gauss_jordan(matrix& result) const
+    {
+      matrix work(*this);
+      matrix inverse = identity();
+
+      for (size_t k = 0U; k < VRows; ++k)
+      {
+        const size_t pivot = work.pivot_row(k);
+
+        if (is_zero(work.elements[pivot][k]))
+        {
+          return false;
+        }
+
+        if (pivot != k)
+        {
+          work.swap_rows(pivot, k);
+          inverse.swap_rows(pivot, k);
+        }
+
+        const T reciprocal = T(1) / work.elements[k][k];
+
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          work.elements[k][c]    *= reciprocal;
+          inverse.elements[k][c] *= reciprocal;
+        }
+
+        for (size_t r = 0U; r < VRows; ++r)
+        {
+          if (r != k)
+          {
+            const T factor = work.elements[r][k];
+
+            for (size_t c = 0U; c < VColumns; ++c)
+            {
+              work.elements[r][c]    -= factor * work.elements[k][c];
+              inverse.elements[r][c] -= factor * inverse.elements[k][c];
+            }
+          }
+        }
+      }
+
+      result = inverse;
+
+      return true;
+    }
+
+    elements_type elements;
+  };
+
+  template <typename T, size_t VRows, size_t VColumns>
+  ETL_CONSTANT size_t matrix<T, VRows, VColumns>::Rows;
+
+  template <typename T, size_t VRows, size_t VColumns>
+  ETL_CONSTANT size_t matrix<T, VRows, VColumns>::Columns;
+
+  //***************************************************************************
+  /// Adds two matrices.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  etl::matrix<T, VRows, VColumns> operator +(const etl::matrix<T, VRows, VColumns>& lhs, const etl::matrix<T, VRows, VColumns>& rhs)
+  {
+    etl::matrix<T, VRows, VColumns> result(lhs);
+    result += rhs;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Subtracts two matrices.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  etl::matrix<T, VRows, VColumns> operator -(const etl::matrix<T, VRows, VColumns>& lhs, const etl::matrix<T, VRows, VColumns>& rhs)
+  {
+    etl::matrix<T, VRows, VColumns> result(lhs);
+    result -= rhs;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Multiplies a matrix by a scalar.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  etl::matrix<T, VRows, VColumns> operator *(const etl::matrix<T, VRows, VColumns>& lhs, const T& rhs)
+  {
+    etl::matrix<T, VRows, VColumns> result(lhs);
+    result *= rhs;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Multiplies two matrices.
+  /// Four rows of the result are calculated together, so that each row of
+  /// 'rhs' is loaded once for four rows of 'lhs'. The innermost loop runs
+  /// along a row of 'rhs' and the result, so that it can be vectorised.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VInner, size_t VColumns>
+  etl::matrix<T, VRows, VColumns> operator *(const etl::matrix<T, VRows, VInner>& lhs, const etl::matrix<T, VInner, VColumns>& rhs)
+  {
+    const size_t Tile = 4U;
+
+    etl::matrix<T, VRows, VColumns> result;
+
+    size_t r = 0U;
+
+    for (; (r + Tile) <= VRows; r += Tile)
+    {
+      for (size_t k = 0U; k < VInner; ++k)
+      {
+        const T a0 = lhs(r, k);
+        const T a1 = lhs(r + 1U, k);
+        const T a2 = lhs(r + 2U, k);
+        const T a3 = lhs(r + 3U, k);
+
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          const T b = rhs(k, c);
+
+          result(r, c)      += a0 * b;
+          result(r + 1U, c) += a1 * b;
+          result(r + 2U, c) += a2 * b;
+          result(r + 3U, c) += a3 * b;
+        }
+      }
+    }
+
+    for (; r < VRows; ++r)
+    {
+      for (size_t k = 0U; k < VInner; ++k)
+      {
+        const T a = lhs(r, k);
+
+        for (size_t c = 0U; c < VColumns; ++c)
+        {
+          result(r, c) += a * rhs(k, c);
+        }
+      }
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Multiplies a matrix by a column vector.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  etl::array<T, VRows> operator *(const etl::matrix<T, VRows, VColumns>& lhs, const etl::array<T, VColumns>& rhs)
+  {
+    etl::array<T, VRows> result;
+
+    for (size_t r = 0U; r < VRows; ++r)
+    {
+      T sum = T(0);
+
+      for (size_t c = 0U; c < VColumns; ++c)
+      {
+        sum += lhs(r, c) * rhs[c];
+      }
+
+      result[r] = sum;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Multiplies a row vector by a matrix.
+  ///\ingroup matrix
+  //***************************************************************************
+  template <typename T, size_t VRows, size_t VColumns>
+  etl::array<T, VColumns> operator *(const etl::array<T, VRows>& lhs, const etl::matrix<T, VRows, VColumns>& rhs)
+  {
+    etl::array<T, VColumns> result;
+    result.fill(T(0));
+
+    for (size_t r = 0U; r < VRows; ++r)
+    {
+      const T a = lhs[r];
+
+      for (size_t c = 0U; c < VColumns; ++c)
+      {
+        result[c] += a * rhs(r, c);
+      }
+    }
+
+    return result;
+  }
+}
+
+#endif
@@ -0,0 +1,439 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MDSPAN_INCLUDED
+#define ETL_MDSPAN_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "strided_span.h"
+
+#include <stddef.h>
+
+///\defgroup mdspan mdspan
+/// A fixed rank, multi dimensional view of a contiguous buffer, with runtime
+/// extents and a layout policy that maps indices to offsets.
+///\ingroup containers
+
+namespace etl
+{
+#if ETL_USING_CPP11
+
+  namespace private_mdspan
+  {
+    //*************************************************************************
+    /// The extents and strides shared by all of the layout mappings.
+    //*************************************************************************
+    template <size_t VRank>
+    class mapping_base
+    {
+    public:
+
+      ETL_STATIC_ASSERT(VRank > 0U, "The rank must be at least one");
+
+      typedef etl::array<size_t, VRank> index_type;
+
+      //***********************************
+      /// The offset of the element at 'indices'.
+      //***********************************
+      ETL_CONSTEXPR14 size_t operator ()(const index_type& indices) const
+      {
+        size_t offset = 0U;
+
+        for (size_t r = 0U; r < VRank; ++r)
+        {
+          offset += indices[r] * strides_[r];
+        }
+
+        return offset;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const index_type& extents() const
+      {
+        return extents_;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 const index_type& strides() const
+      {
+        return strides_;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 size_t extent(size_t r) const
+      {
+        return extents_[r];
+      }
+
+      //***********************************
+      ETL_CONSTEXPR14 size_t stride(size_t r) const
+      {
+        return strides_[r];
+      }
+
+      //***********************************
+      /// The number of elements in the view.
+      //***********************************
+      ETL_CONSTEXPR14 size_t size() const
+      {
+        size_t count = 1U;
+
+        for (size_t r = 0U; r < VRank; ++r)
+        {
+          count *= extents_[r];
+        }
+
+        return count;
+      }
+
+      //***********************************
+      /// The number of buffer elements needed to hold the view.
+      //***********************************
+      ETL_CONSTEXPR14 size_t required_span_size() const
+      {
+        if (size() == 0U)
+        {
+          return 0U;
+        }
+
+        size_t span_size = 1U;
+
+        for (size_t r = 0U; r < VRank; ++r)
+        {
+          span_size += (extents_[r] - 1U) * strides_[r];
+        }
+
+        return span_size;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR14 bool operator ==(const mapping_base& lhs, const mapping_base& rhs)
+      {
+        return (lhs.extents_ == rhs.extents_) && (lhs.strides_ == rhs.strides_);
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR14 bool operator !=(const mapping_base& lhs, const mapping_base& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    protected:
+
+      ETL_CONSTEXPR14 mapping_base(const index_type& extents__, const index_type& strides__)
+        : extents_(extents__)
+        , strides_(strides__)
+      {
+      }
+
+      index_type extents_;
+      index_type strides_;
+    };
+  }
+
+  //***************************************************************************
+  /// Row major layout. The last index varies fastest.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_right
+  {
+    template <size_t VRank>
+    class mapping : public private_mdspan::mapping_base<VRank>
+    {
+    public:
+
+      typedef typename private_mdspan::mapping_base<VRank>::index_type index_type;
+
+      ETL_CONSTEXPR14 explicit mapping(const index_type& extents__)
+        : private_mdspan::mapping_base<VRank>(extents__, make_strides(extents__))
+      {
+      }
+
+    private:
+
+      static ETL_CONSTEXPR14 index_type make_strides(const index_type& extents__)
+      {
+        index_type result{};
+        size_t step = 1U;
+
+        for (size_t r = VRank; r > 0U; --r)
+        {
+          result[r - 1U] = step;
+          step *= extents__[r - 1U];
+        }
+
+        return result;
+      }
+    };
+  };
+
+  //***************************************************************************
+  /// Column major layout. The first index varies fastest.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_left
+  {
+    template <size_t VRank>
+    class mapping : public private_mdspan::mapping_base<VRank>
+    {
+    public:
+
+      typedef typename private_mdspan::mapping_base<VRank>::index_type index_type;
+
+      ETL_CONSTEXPR14 explicit mapping(const index_type& extents__)
+        : private_mdspan::mapping_base<VRank>(extents__, make_strides(extents__))
+      {
+      }
+
+    private:
+
+      static ETL_CONSTEXPR14 index_type make_strides(const index_type& extents__)
+      {
+        index_type result{};
+        size_t step = 1U;
+
+        for (size_t r = 0U; r < VRank; ++r)
+        {
+          result[r] = step;
+          step *= extents__[r];
+        }
+
+        return result;
+      }
+    };
+  };
+
+  //***************************************************************************
+  /// Layout with an explicit stride for each index.
+  /// Used for sub-views of the other layouts, such as a tile of an image.
+  ///\ingroup mdspan
+  //***************************************************************************
+  struct layout_stride
+  {
+    template <size_t VRank>
+    class mapping : public private_mdspan::mapping_base<VRank>
+    {
+    public:
+
+      typedef typename private_mdspan::mapping_base<VRank>::index_type index_type;
+
+      ETL_CONSTEXPR14 mapping(const index_type& extents__, const index_type& strides__)
+        : private_mdspan::mapping_base<VRank>(extents__, strides__)
+      {
+      }
+
+      //***********************************
+      /// Converts from any other layout mapping.
+      //***********************************
+      template <typename TMapping>
+      ETL_CONSTEXPR14 explicit mapping(const TMapping& other)
+        : private_mdspan::mapping_base<VRank>(other.extents(), other.strides())
+      {
+      }
+    };
+  };
+
+  //***************************************************************************
+  /// A multi dimensional view of a contiguous buffer.
+  ///\tparam T       The element type.
+  ///\tparam VRank   The number of dimensions.
+  ///\tparam TLayout The layout policy. Default layout_right.
+  ///\ingroup mdspan
+  //***************************************************************************
+  template <typename T, size_t VRank, typename TLayout = etl::layout_right>
+  class mdspan
+  {
+  public:
+
+    typedef T                                               element_type;
+    typedef typename etl::remove_cv<T>::type                value_type;
+    typedef TLayout                                         layout_type;
+    typedef typename TLayout::template mapping<VRank>       mapping_type;
+    typedef typename mapping_type::index_type               index_type;
+    typedef size_t                                          size_type;
+    typedef T&                                              reference;
+    typedef T*                                              pointer;
+
+    //*************************************************************************
+    /// Constructs from a pointer and a mapping.
+    //*************************************************************************
+    ETL_CONSTEXPR14 mdspan(pointer p_data_, const mapping_type& map_)
+      : p_data(p_data_)
+      , map(map_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer and the extents.
+    /// Not available for layout_stride.
+    //*************************************************************************
+    ETL_CONSTEXPR14 mdspan(pointer p_data_, const index_type& extents__)
+      : p_data(p_data_)
+      , map(extents__)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer and a list of extents.
+    /// Not available for layout_stride.
+    //*************************************************************************
+    template <typename... TExtents, typename = typename etl::enable_if<(sizeof...(TExtents) == VRank) && (VRank > 1U)>::type>
+    ETL_CONSTEXPR14 mdspan(pointer p_data_, TExtents... extents__)
+      : p_data(p_data_)
+      , map(index_type{ { static_cast<size_t>(extents__)... } })
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a const view from a non-const view.
+    //*************************************************************************
+    template <typename U, typename = typename etl::enable_if<etl::is_same<const U, T>::value && !etl::is_same<U, T>::value>::type>
+    ETL_CONSTEXPR14 mdspan(const mdspan<U, VRank, TLayout>& other)
+      : p_data(other.data_handle())
+      , map(other.mapping())
+    {
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at 'indices...'.
+    //*************************************************************************
+    template <typename... TIndices>
+    ETL_CONSTEXPR14 reference operator ()(TIndices... indices) const
+    {
+      ETL_STATIC_ASSERT(sizeof...(TIndices) == VRank, "The number of indices must match the rank");
+
+      return p_data[map(index_type{ { static_cast<size_t>(indices)... } })];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at 'indices'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 reference operator [](const index_type& indices) const
+    {
+      return p_data[map(indices)];
+    }
+
+    //*************************************************************************
+    /// The rank.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t rank()
+    {
+      return VRank;
+    }
+
+    //*************************************************************************
+    /// The extent of dimension 'r'.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t extent(size_t r) const
+    {
+      return map.extent(r);
+    }
+
+    //*************************************************************************
+    /// The stride of dimension 'r', in elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t stride(size_t r) const
+    {
+      return map.stride(r);
+    }
+
+    //*************************************************************************
+    /// The extents of all dimensions.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const index_type& extents() const
+    {
+      return map.extents();
+    }
+
+    //*************************************************************************
+    /// The number of elements in the view.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t size() const
+    {
+      return map.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether the view has no elements.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool empty() const
+    {
+      return map.size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the pointer to the buffer.
+    //*************************************************************************
+    ETL_CONSTEXPR14 pointer data_handle() const
+    {
+      return p_data;
+    }
+
+    //*************************************************************************
+    /// Returns the mapping.
+    //*************************************************************************
+    ETL_CONSTEXPR14 const mapping_type& mapping() const
+    {
+      return map;
+    }
+
+    //*************************************************************************
+    /// Returns a view of the extents 'sub_extents' from 'offsets'.
+    /// e.g. A tile of an image.
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::mdspan<T, VRank, etl::layout_stride> subview(const index_type& offsets, const index_type& sub_extents) const
+    {
+      typedef typename etl::layout_stride::template mapping<VRank> stride_mapping_type;
+
+      return etl::mdspan<T, VRank, etl::layout_stride>(p_data + map(offsets), stride_mapping_type(sub_extents, map.strides()));
+    }
+
+    //*************************************************************************
+    /// Returns a view of dimension 'r', starting at 'start'.
+    /// e.g. A column of an image, or a channel of interleaved samples.
+    //*************************************************************************
+    ETL_CONSTEXPR14 etl::strided_span<T> line(size_t r, const index_type& start) const
+    {
+      return etl::strided_span<T>(p_data + map(start), map.extent(r) - start[r], map.stride(r));
+    }
+
+  private:
+
+    pointer      p_data;
+    mapping_type map;
+  };
+
+#endif
+}
+
+#endif
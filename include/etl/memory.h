@@ -2331,6 +2331,24 @@ namespace etl
                                               sizeof(typename etl::iterator_traits<TPointer>::value_type) * n));
   }
 
+  //***************************************************************************
+  /// Relocates the objects in [sb, se) to db using memmove.
+  /// The lifetimes of the source objects end and those at the destination begin,
+  /// without calling any constructors or destructors. The ranges may overlap.
+  /// Type must be trivially relocatable. See etl::is_trivially_relocatable.
+  /// \param source begin
+  /// \param source end
+  /// \param destination begin
+  /// \return A pointer to the destination.
+  //***************************************************************************
+  template <typename T>
+  T* mem_relocate(T* sb, T* se, T* db) ETL_NOEXCEPT
+  {
+    return static_cast<T*>(memmove(static_cast<void*>(db),
+                                   static_cast<const void*>(sb),
+                                   sizeof(T) * static_cast<size_t>(se - sb)));
+  }
+
   //***************************************************************************
   /// Template wrapper for memcmp.
   /// \param source begin
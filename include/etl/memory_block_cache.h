@@ -0,0 +1,308 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MEMORY_BLOCK_CACHE_INCLUDED
+#define ETL_MEMORY_BLOCK_CACHE_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "function.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// A cache of memory blocks in front of a shared memory block allocator.
+  /// Intended to be owned by a single thread, so that most allocations and
+  /// releases do not touch the shared allocator. Blocks are taken from and
+  /// returned to the shared allocator in batches of VBatch_Size, within a
+  /// single lock/unlock if the callbacks are supplied.
+  /// The cache itself is not thread safe.
+  ///\tparam VBlock_Size The size of the blocks cached.
+  ///\tparam VAlignment  The alignment of the blocks cached.
+  ///\tparam VBatch_Size The number of blocks moved to or from the shared allocator at a time.
+  //*************************************************************************
+  template <size_t VBlock_Size, size_t VAlignment, size_t VBatch_Size>
+  class memory_block_cache : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VBatch_Size > 0U, "Batch size must be greater than zero");
+
+    static ETL_CONSTANT size_t Block_Size = VBlock_Size;
+    static ETL_CONSTANT size_t Alignment  = VAlignment;
+    static ETL_CONSTANT size_t Batch_Size = VBatch_Size;
+    static ETL_CONSTANT size_t Capacity   = 2U * VBatch_Size;
+
+    //*************************************************************************
+    /// Usage statistics for the cache.
+    //*************************************************************************
+    struct statistics
+    {
+      size_t allocations; ///< The number of blocks allocated from the cache.
+      size_t releases;    ///< The number of blocks released to the cache.
+      size_t refills;     ///< The number of batches taken from the shared allocator.
+      size_t flushes;     ///< The number of batches returned to the shared allocator.
+    };
+
+    //*************************************************************************
+    /// Constructor, for a shared allocator that is already thread safe.
+    //*************************************************************************
+    explicit memory_block_cache(etl::imemory_block_allocator& shared_)
+      : shared(shared_)
+      , p_lock(ETL_NULLPTR)
+      , p_unlock(ETL_NULLPTR)
+      , block_count(0U)
+    {
+      clear_statistics();
+    }
+
+    //*************************************************************************
+    /// Constructor, with callbacks that lock and unlock the shared allocator.
+    //*************************************************************************
+    memory_block_cache(etl::imemory_block_allocator& shared_, const etl::ifunction<void>& lock_, const etl::ifunction<void>& unlock_)
+      : shared(shared_)
+      , p_lock(&lock_)
+      , p_unlock(&unlock_)
+      , block_count(0U)
+    {
+      clear_statistics();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns all cached blocks to the shared allocator.
+    //*************************************************************************
+    ~memory_block_cache()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Returns all cached blocks to the shared allocator.
+    //*************************************************************************
+    void flush()
+    {
+      if (block_count != 0U)
+      {
+        return_blocks(block_count);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of blocks held by the cache.
+    //*************************************************************************
+    size_t size() const
+    {
+      return block_count;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of blocks held by the cache.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Capacity;
+    }
+
+    //*************************************************************************
+    /// Returns the usage statistics.
+    //*************************************************************************
+    const statistics& get_statistics() const
+    {
+      return stats;
+    }
+
+    //*************************************************************************
+    /// Clears the usage statistics.
+    //*************************************************************************
+    void clear_statistics()
+    {
+      stats.allocations = 0U;
+      stats.releases    = 0U;
+      stats.refills     = 0U;
+      stats.flushes     = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if ((required_alignment > Alignment) || (required_size > Block_Size))
+      {
+        return ETL_NULLPTR;
+      }
+
+      if (block_count == 0U)
+      {
+        take_blocks();
+
+        if (block_count == 0U)
+        {
+          return ETL_NULLPTR;
+        }
+      }
+
+      ++stats.allocations;
+
+      return blocks[--block_count];
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!shared.is_owner_of(pblock))
+      {
+        return false;
+      }
+
+      if (block_count == Capacity)
+      {
+        return_blocks(Batch_Size);
+      }
+
+      ++stats.releases;
+      blocks[block_count++] = const_cast<void*>(pblock);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the shared allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return shared.is_owner_of(pblock);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes up to a batch of blocks from the shared allocator.
+    //*************************************************************************
+    void take_blocks()
+    {
+      lock();
+
+      while (block_count < Batch_Size)
+      {
+        void* p = shared.allocate(Block_Size, Alignment);
+
+        if (p == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        blocks[block_count++] = p;
+      }
+
+      unlock();
+
+      if (block_count != 0U)
+      {
+        ++stats.refills;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the oldest blocks to the shared allocator.
+    /// The most recently released blocks are kept, as they are the most likely
+    /// to still be in the data cache.
+    //*************************************************************************
+    void return_blocks(size_t n)
+    {
+      lock();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        shared.release(blocks[i]);
+      }
+
+      unlock();
+
+      for (size_t i = n; i < block_count; ++i)
+      {
+        blocks[i - n] = blocks[i];
+      }
+
+      block_count -= n;
+      ++stats.flushes;
+    }
+
+    //*************************************************************************
+    void lock() const
+    {
+      if (p_lock != ETL_NULLPTR)
+      {
+        (*p_lock)();
+      }
+    }
+
+    //*************************************************************************
+    void unlock() const
+    {
+      if (p_unlock != ETL_NULLPTR)
+      {
+        (*p_unlock)();
+      }
+    }
+
+    etl::imemory_block_allocator& shared; ///< The shared allocator.
+
+    const etl::ifunction<void>* p_lock;   ///< The callback that locks the shared allocator, or null.
+    const etl::ifunction<void>* p_unlock; ///< The callback that unlocks the shared allocator, or null.
+
+    void*      blocks[Capacity]; ///< The cached blocks. The most recently released is last.
+    size_t     block_count;      ///< The number of cached blocks.
+    statistics stats;            ///< The usage statistics.
+  };
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VBatch_Size>
+  ETL_CONSTANT size_t memory_block_cache<VBlock_Size, VAlignment, VBatch_Size>::Block_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VBatch_Size>
+  ETL_CONSTANT size_t memory_block_cache<VBlock_Size, VAlignment, VBatch_Size>::Alignment;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VBatch_Size>
+  ETL_CONSTANT size_t memory_block_cache<VBlock_Size, VAlignment, VBatch_Size>::Batch_Size;
+
+  template <size_t VBlock_Size, size_t VAlignment, size_t VBatch_Size>
+  ETL_CONSTANT size_t memory_block_cache<VBlock_Size, VAlignment, VBatch_Size>::Capacity;
+}
+
+#endif
@@ -0,0 +1,238 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MEMORY_STATISTICS_INCLUDED
+#define ETL_MEMORY_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup memory_statistics memory_statistics
+/// Usage statistics for pools and the node based containers that allocate
+/// from them. Define ETL_MEMORY_STATISTICS to enable them; they add nothing
+/// to the pools or containers otherwise.
+/// Pools and containers both expose get_memory_statistics() and
+/// reset_memory_statistics(), so a pool shared between several containers
+/// can be sized from its own peak, and each container from its share of it.
+/// Average lifetimes are only measured once a tick source has been set with
+/// etl::set_memory_statistics_tick.
+///\ingroup memory
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The allocation statistics of a pool or container.
+  ///\ingroup memory_statistics
+  //***************************************************************************
+  class memory_statistics
+  {
+  public:
+
+    typedef uint32_t (*tick_function)();
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    memory_statistics()
+      : current(0U)
+      , peak(0U)
+      , allocations(0U)
+      , releases(0U)
+      , failures(0U)
+      , occupancy_ticks(0U)
+      , last_tick(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of items currently allocated.
+    //*************************************************************************
+    size_t current_size() const
+    {
+      return current;
+    }
+
+    //*************************************************************************
+    /// The highest number of items allocated at once.
+    //*************************************************************************
+    size_t peak_size() const
+    {
+      return peak;
+    }
+
+    //*************************************************************************
+    /// The number of successful item allocations.
+    //*************************************************************************
+    size_t allocation_count() const
+    {
+      return allocations;
+    }
+
+    //*************************************************************************
+    /// The number of item releases.
+    //*************************************************************************
+    size_t release_count() const
+    {
+      return releases;
+    }
+
+    //*************************************************************************
+    /// The number of allocations that failed for lack of space.
+    //*************************************************************************
+    size_t failed_allocation_count() const
+    {
+      return failures;
+    }
+
+    //*************************************************************************
+    /// The average number of ticks between the allocation and release of an item.
+    /// Derived from the time integral of the number of allocated items divided
+    /// by the number of releases, so no per item timestamp is stored.
+    /// Returns 0 if there is no tick source or nothing has been released.
+    //*************************************************************************
+    uint32_t average_lifetime() const
+    {
+      return (releases == 0U) ? 0U : static_cast<uint32_t>(occupancy_ticks / releases);
+    }
+
+    //*************************************************************************
+    /// Records the allocation of 'n' items.
+    //*************************************************************************
+    void record_allocation(size_t n = 1U)
+    {
+      update_occupancy();
+
+      current     += n;
+      allocations += n;
+
+      if (current > peak)
+      {
+        peak = current;
+      }
+    }
+
+    //*************************************************************************
+    /// Records the release of 'n' items.
+    //*************************************************************************
+    void record_release(size_t n = 1U)
+    {
+      update_occupancy();
+
+      current  -= (n < current) ? n : current;
+      releases += n;
+    }
+
+    //*************************************************************************
+    /// Records an allocation that failed.
+    //*************************************************************************
+    void record_failed_allocation()
+    {
+      ++failures;
+    }
+
+    //*************************************************************************
+    /// Clears the counters. The peak restarts from the current size.
+    //*************************************************************************
+    void reset()
+    {
+      peak            = current;
+      allocations     = 0U;
+      releases        = 0U;
+      failures        = 0U;
+      occupancy_ticks = 0U;
+      last_tick       = read_tick();
+    }
+
+    //*************************************************************************
+    /// Gets the tick source shared by all statistics.
+    //*************************************************************************
+    static tick_function& tick_source()
+    {
+      static tick_function p_tick = ETL_NULLPTR;
+
+      return p_tick;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reads the tick source, or 0 if there is none.
+    //*************************************************************************
+    static uint32_t read_tick()
+    {
+      tick_function p_tick = tick_source();
+
+      return (p_tick != ETL_NULLPTR) ? p_tick() : 0U;
+    }
+
+    //*************************************************************************
+    /// Accumulates the item ticks since the last change in the number of items.
+    //*************************************************************************
+    void update_occupancy()
+    {
+      if (tick_source() != ETL_NULLPTR)
+      {
+        const uint32_t tick = read_tick();
+
+        // Unsigned subtraction allows for the tick counter wrapping.
+        const uint32_t elapsed = tick - last_tick;
+        const uint64_t items   = current;
+
+        occupancy_ticks += items * elapsed;
+        last_tick = tick;
+      }
+    }
+
+    size_t   current;
+    size_t   peak;
+    size_t   allocations;
+    size_t   releases;
+    size_t   failures;
+    uint64_t occupancy_ticks;
+    uint32_t last_tick;
+  };
+
+  //***************************************************************************
+  /// Sets the tick source used to measure average lifetimes, for all statistics.
+  /// Pass a null pointer to stop measuring.
+  ///\ingroup memory_statistics
+  //***************************************************************************
+  inline void set_memory_statistics_tick(etl::memory_statistics::tick_function p_tick)
+  {
+    etl::memory_statistics::tick_source() = p_tick;
+  }
+}
+
+#endif
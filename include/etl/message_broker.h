@@ -34,7 +34,9 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "message_trace.h"
 #include "span.h"
+#include "flat_multimap.h"
 
 #include <stdint.h>
 
@@ -95,6 +97,10 @@ namespace etl
 
     typedef etl::span<const etl::message_id_t> message_id_span_t;
 
+    class subscription;
+
+    typedef etl::iflat_multimap<etl::message_id_t, subscription*> index_t;
+
     //*******************************************
     class subscription : public subscription_node
     {
@@ -136,6 +142,9 @@ namespace etl
     message_broker()
       : imessage_router(etl::imessage_router::MESSAGE_BROKER)
       , head()
+      , p_index(ETL_NULLPTR)
+      , index_valid(false)
+      , dispatch_depth(0U)
     {
     }
 
@@ -145,6 +154,9 @@ namespace etl
     message_broker(etl::imessage_router& successor_)
       : imessage_router(etl::imessage_router::MESSAGE_BROKER, successor_)
       , head()
+      , p_index(ETL_NULLPTR)
+      , index_valid(false)
+      , dispatch_depth(0U)
     {
     }
 
@@ -154,6 +166,9 @@ namespace etl
     message_broker(etl::message_router_id_t id_)
       : imessage_router(id_)
       , head()
+      , p_index(ETL_NULLPTR)
+      , index_valid(false)
+      , dispatch_depth(0U)
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
@@ -164,22 +179,28 @@ namespace etl
     message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_)
       : imessage_router(id_, successor_)
       , head()
+      , p_index(ETL_NULLPTR)
+      , index_valid(false)
+      , dispatch_depth(0U)
     {
       ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
     }
 
     //*******************************************
     /// Subscribe to the broker.
+    /// The subscription's message id list must not change while it is subscribed.
     //*******************************************
     void subscribe(etl::message_broker::subscription& new_sub)
     {
       initialise_insertion_point(new_sub.get_router(), &new_sub);
+      rebuild_index();
     }
 
     //*******************************************
     void unsubscribe(etl::imessage_router& router)
     {
       initialise_insertion_point(&router, ETL_NULLPTR);
+      rebuild_index();
     }
 
     //*******************************************
@@ -197,32 +218,9 @@ namespace etl
     virtual void receive(etl::message_router_id_t destination_router_id,
                          const etl::imessage&     msg) ETL_OVERRIDE
     {
-      const etl::message_id_t id = msg.get_message_id();
-
       if (!empty())
       {
-        // Scan the subscription lists.
-        subscription* sub = static_cast<subscription*>(head.get_next());
-
-        while (sub != ETL_NULLPTR)
-        {
-          message_id_span_t message_ids = sub->message_id_list();
-
-          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
-
-          if (itr != message_ids.end())
-          {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(msg);
-            }
-          }
-
-          sub = sub->next_subscription();
-        }
+        send_to_subscribers(destination_router_id, msg.get_message_id(), msg);
       }
 
       // Always pass the message on to the successor.
@@ -238,32 +236,9 @@ namespace etl
     virtual void receive(etl::message_router_id_t destination_router_id, 
                          etl::shared_message      shared_msg) ETL_OVERRIDE
     {
-      const etl::message_id_t id = shared_msg.get_message().get_message_id();
-
       if (!empty())
       {
-        // Scan the subscription lists.
-        subscription* sub = static_cast<subscription*>(head.get_next());
-
-        while (sub != ETL_NULLPTR)
-        {
-          message_id_span_t message_ids = sub->message_id_list();
-
-          message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
-
-          if (itr != message_ids.end())
-          {
-            etl::imessage_router* router = sub->get_router();
-
-            if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
-                destination_router_id == router->get_message_router_id())
-            {
-              router->receive(shared_msg);
-            }
-          }
-
-          sub = sub->next_subscription();
-        }
+        send_to_subscribers(destination_router_id, shared_msg.get_message().get_message_id(), shared_msg);
       }
 
       // Always pass the message on to a successor.
@@ -287,6 +262,7 @@ namespace etl
     void clear()
     {
       head.terminate();
+      rebuild_index();
     }
 
     //********************************************
@@ -313,8 +289,176 @@ namespace etl
       return head.get_next() == ETL_NULLPTR;
     }
 
+    //********************************************
+    /// Are messages found through the id index?
+    /// False if there is no index, or it is too small for the subscriptions.
+    //********************************************
+    bool is_indexed() const
+    {
+      return index_valid;
+    }
+
+    //********************************************
+    /// Rebuilds the id index from the subscriptions.
+    /// Called from subscribe(), unsubscribe() and clear().
+    /// If called while a message is being delivered, the rebuild is deferred
+    /// until the delivery has finished.
+    //********************************************
+    void rebuild_index()
+    {
+      index_valid = false;
+
+      if ((p_index == ETL_NULLPTR) || (dispatch_depth != 0U))
+      {
+        return;
+      }
+
+      p_index->clear();
+
+      subscription* sub = static_cast<subscription*>(head.get_next());
+
+      while (sub != ETL_NULLPTR)
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        for (message_id_span_t::iterator itr = message_ids.begin(); itr != message_ids.end(); ++itr)
+        {
+          // Repeated ids only deliver once.
+          if (etl::find(message_ids.begin(), itr, *itr) == itr)
+          {
+            if (p_index->full())
+            {
+              // Fall back to scanning the subscriptions.
+              p_index->clear();
+              return;
+            }
+
+            p_index->insert(index_t::value_type(*itr, sub));
+          }
+        }
+
+        sub = sub->next_subscription();
+      }
+
+      index_valid = true;
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor, with an id index.
+    //*******************************************
+    message_broker(etl::message_router_id_t id_, index_t& index_)
+      : imessage_router(id_)
+      , head()
+      , p_index(&index_)
+      , index_valid(false)
+      , dispatch_depth(0U)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //*******************************************
+    /// Constructor, with an id index.
+    //*******************************************
+    message_broker(etl::message_router_id_t id_, etl::imessage_router& successor_, index_t& index_)
+      : imessage_router(id_, successor_)
+      , head()
+      , p_index(&index_)
+      , index_valid(false)
+      , dispatch_depth(0U)
+    {
+      ETL_ASSERT((id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER) || (id_ == etl::imessage_router::MESSAGE_BROKER), ETL_ERROR(etl::message_router_illegal_id));
+    }
+
   private:
 
+    //*******************************************
+    /// Sends the message to the subscribers of the id.
+    //*******************************************
+    template <typename TMessage>
+    void send_to_subscribers(etl::message_router_id_t destination_router_id, etl::message_id_t id, TMessage& msg)
+    {
+      ++dispatch_depth;
+
+      subscription* sub = static_cast<subscription*>(head.get_next());
+
+      if (index_valid)
+      {
+        ETL_OR_STD::pair<index_t::iterator, index_t::iterator> range = p_index->equal_range(id);
+
+        sub = ETL_NULLPTR;
+
+        while (range.first != range.second)
+        {
+          subscription* indexed_sub = range.first->second;
+
+          send_to_subscriber(destination_router_id, indexed_sub, msg);
+
+          if (!index_valid)
+          {
+            // The subscriptions were changed by a router.
+            // Carry on from this subscription with a scan.
+            sub = indexed_sub->next_subscription();
+            break;
+          }
+
+          ++range.first;
+        }
+      }
+
+      // Scan the subscription lists.
+      while (sub != ETL_NULLPTR)
+      {
+        message_id_span_t message_ids = sub->message_id_list();
+
+        message_id_span_t::iterator itr = etl::find(message_ids.begin(), message_ids.end(), id);
+
+        if (itr != message_ids.end())
+        {
+          send_to_subscriber(destination_router_id, sub, msg);
+        }
+
+        sub = sub->next_subscription();
+      }
+
+      --dispatch_depth;
+
+      if ((dispatch_depth == 0U) && (p_index != ETL_NULLPTR) && !index_valid)
+      {
+        rebuild_index();
+      }
+    }
+
+    //*******************************************
+    template <typename TMessage>
+    void send_to_subscriber(etl::message_router_id_t destination_router_id, subscription* sub, TMessage& msg)
+    {
+      etl::imessage_router* router = sub->get_router();
+
+      if (destination_router_id == etl::imessage_router::ALL_MESSAGE_ROUTERS ||
+          destination_router_id == router->get_message_router_id())
+      {
+        deliver(*router, msg);
+      }
+    }
+
+    //*******************************************
+    static void deliver(etl::imessage_router& router, const etl::imessage& msg)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(msg.get_message_id(), router.get_message_router_id());
+
+      router.receive(msg);
+    }
+
+    //*******************************************
+    static void deliver(etl::imessage_router& router, etl::shared_message& shared_msg)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(shared_msg.get_message().get_message_id(), router.get_message_router_id());
+
+      router.receive(shared_msg);
+    }
+
     //*******************************************
     void initialise_insertion_point(const etl::imessage_router* p_router, etl::message_broker::subscription* p_new_sub)
     {
@@ -349,7 +493,67 @@ namespace etl
     }
 
     subscription_node head;
+    index_t*          p_index;
+    bool              index_valid;
+    size_t            dispatch_depth;
+  };
+
+  //***************************************************************************
+  /// Message broker with an index from message id to subscriptions.
+  /// Messages are only offered to the subscriptions that list their id.
+  ///\tparam VMax_Entries The maximum number of (id, subscription) pairs.
+  /// If the subscriptions need more, the broker scans all of them instead.
+  //***************************************************************************
+  template <size_t VMax_Entries>
+  class message_broker_indexed : public etl::message_broker
+  {
+  public:
+
+    static ETL_CONSTANT size_t Max_Entries = VMax_Entries;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed()
+      : message_broker(etl::imessage_router::MESSAGE_BROKER, index)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::imessage_router& successor_)
+      : message_broker(etl::imessage_router::MESSAGE_BROKER, successor_, index)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_)
+      : message_broker(id_, index)
+    {
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_broker_indexed(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : message_broker(id_, successor_, index)
+    {
+      rebuild_index();
+    }
+
+  private:
+
+    etl::flat_multimap<etl::message_id_t, subscription*, VMax_Entries> index;
   };
+
+  template <size_t VMax_Entries>
+  ETL_CONSTANT size_t message_broker_indexed<VMax_Entries>::Max_Entries;
 }
 
 #endif
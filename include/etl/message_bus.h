@@ -38,6 +38,8 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "message_trace.h"
+#include "bit.h"
 
 #include <stdint.h>
 
@@ -104,6 +106,7 @@ namespace etl
                                                              compare_router_id());
 
           router_list.insert(irouter, &router);
+          rebuild_index();
         }
       }
 
@@ -127,6 +130,7 @@ namespace etl
                                                                                                     compare_router_id());
 
         router_list.erase(range.first, range.second);
+        rebuild_index();
       }
     }
 
@@ -140,6 +144,7 @@ namespace etl
       if (irouter != router_list.end())
       {
         router_list.erase(irouter);
+        rebuild_index();
       }
     }
 
@@ -165,19 +170,40 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
-          router_list_t::iterator irouter = router_list.begin();
+          const etl::message_id_t id = message.get_message_id();
 
-          // Broadcast to everyone.
-          while (irouter != router_list.end())
+          if (is_indexed(id))
           {
-            etl::imessage_router& router = **irouter;
+            // Only visit the routers that accept the id.
+            const uint32_t* prow = index_row(id);
 
-            if (router.accepts(message.get_message_id()))
+            for (size_t word = 0U; word < index_words; ++word)
             {
-              router.receive(message);
+              uint32_t bits = prow[word];
+
+              while (bits != 0U)
+              {
+                deliver(*router_list[(word * Bits_Per_Word) + size_t(etl::countr_zero(bits))], message);
+                bits &= (bits - 1U);
+              }
             }
+          }
+          else
+          {
+            router_list_t::iterator irouter = router_list.begin();
 
-            ++irouter;
+            // Broadcast to everyone.
+            while (irouter != router_list.end())
+            {
+              etl::imessage_router& router = **irouter;
+
+              if (router.accepts(id))
+              {
+                deliver(router, message);
+              }
+
+              ++irouter;
+            }
           }
 
           break;
@@ -200,7 +226,7 @@ namespace etl
           {
             if ((*(range.first))->accepts(message.get_message_id()))
             {
-              (*(range.first))->receive(message);
+              deliver(**range.first, message);
             }
 
             ++range.first;
@@ -246,19 +272,40 @@ namespace etl
         // Broadcast to all routers.
       case etl::imessage_router::ALL_MESSAGE_ROUTERS:
       {
-        router_list_t::iterator irouter = router_list.begin();
+        const etl::message_id_t id = shared_msg.get_message().get_message_id();
 
-        // Broadcast to everyone.
-        while (irouter != router_list.end())
+        if (is_indexed(id))
         {
-          etl::imessage_router& router = **irouter;
+          // Only visit the routers that accept the id.
+          const uint32_t* prow = index_row(id);
 
-          if (router.accepts(shared_msg.get_message().get_message_id()))
+          for (size_t word = 0U; word < index_words; ++word)
           {
-            router.receive(shared_msg);
+            uint32_t bits = prow[word];
+
+            while (bits != 0U)
+            {
+              deliver(*router_list[(word * Bits_Per_Word) + size_t(etl::countr_zero(bits))], shared_msg);
+              bits &= (bits - 1U);
+            }
           }
+        }
+        else
+        {
+          router_list_t::iterator irouter = router_list.begin();
 
-          ++irouter;
+          // Broadcast to everyone.
+          while (irouter != router_list.end())
+          {
+            etl::imessage_router& router = **irouter;
+
+            if (router.accepts(id))
+            {
+              deliver(router, shared_msg);
+            }
+
+            ++irouter;
+          }
         }
 
         break;
@@ -279,7 +326,7 @@ namespace etl
         {
           if ((*(range.first))->accepts(shared_msg.get_message().get_message_id()))
           {
-            (*(range.first))->receive(shared_msg);
+            deliver(**range.first, shared_msg);
           }
 
           ++range.first;
@@ -336,6 +383,48 @@ namespace etl
     void clear()
     {
       router_list.clear();
+      rebuild_index();
+    }
+
+    //*******************************************
+    /// The number of message ids, from zero, that have a subscriber index.
+    /// Broadcasts of these ids only visit the routers that accept them.
+    //*******************************************
+    size_t indexed_message_ids() const
+    {
+      return index_ids;
+    }
+
+    //*******************************************
+    /// Rebuilds the subscriber index.
+    /// The index records which ids each router accepted when it subscribed.
+    /// Call this if a subscribed router's accepted ids change, for example
+    /// after setting a successor.
+    //*******************************************
+    void rebuild_index()
+    {
+      if (index_ids == 0U)
+      {
+        return;
+      }
+
+      etl::fill_n(p_index, index_ids * index_words, 0U);
+
+      for (size_t position = 0U; position < router_list.size(); ++position)
+      {
+        const etl::imessage_router& router = *router_list[position];
+
+        const size_t   word = position / Bits_Per_Word;
+        const uint32_t bit  = 1U << (position % Bits_Per_Word);
+
+        for (size_t id = 0U; id < index_ids; ++id)
+        {
+          if (router.accepts(etl::message_id_t(id)))
+          {
+            p_index[(id * index_words) + word] |= bit;
+          }
+        }
+      }
     }
 
     //********************************************
@@ -363,7 +452,10 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(ETL_NULLPTR),
+        index_ids(0U),
+        index_words(0U)
     {
     }
 
@@ -372,12 +464,65 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list, etl::imessage_router& successor)
       : imessage_router(etl::imessage_router::MESSAGE_BUS, successor),
-      router_list(list)
+      router_list(list),
+      p_index(ETL_NULLPTR),
+      index_ids(0U),
+      index_words(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    /// The index has a row of index_words_ words for each of the first index_ids_ message ids.
+    /// The derived class must call rebuild_index() once the list is constructed.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t index_ids_, size_t index_words_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        index_ids(index_ids_),
+        index_words(index_words_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor, with a subscriber index.
+    /// The index has a row of index_words_ words for each of the first index_ids_ message ids.
+    /// The derived class must call rebuild_index() once the list is constructed.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t index_ids_, size_t index_words_, etl::imessage_router& successor)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS, successor),
+        router_list(list),
+        p_index(p_index_),
+        index_ids(index_ids_),
+        index_words(index_words_)
     {
     }
 
+    static ETL_CONSTANT size_t Bits_Per_Word = 32U;
+
   private:
 
+    //*******************************************
+    /// Passes a message to a subscribed router.
+    //*******************************************
+    static void deliver(etl::imessage_router& router, const etl::imessage& message)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(message.get_message_id(), router.get_message_router_id());
+
+      router.receive(message);
+    }
+
+    //*******************************************
+    /// Passes a shared message to a subscribed router.
+    //*******************************************
+    static void deliver(etl::imessage_router& router, etl::shared_message& shared_msg)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(shared_msg.get_message().get_message_id(), router.get_message_router_id());
+
+      router.receive(shared_msg);
+    }
+
     //*******************************************
     // How to compare routers to router ids.
     //*******************************************
@@ -394,13 +539,33 @@ namespace etl
       }
     };
 
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return size_t(id) < index_ids;
+    }
+
+    //*******************************************
+    const uint32_t* index_row(etl::message_id_t id) const
+    {
+      return p_index + (size_t(id) * index_words);
+    }
+
     router_list_t& router_list;
+    uint32_t*      p_index;     ///< One row of router bits for each indexed message id.
+    size_t         index_ids;   ///< The number of indexed message ids.
+    size_t         index_words; ///< The number of words in a row.
   };
 
   //***************************************************************************
   /// The message bus
+  /// \tparam MAX_ROUTERS_  The maximum number of subscribed routers.
+  /// \tparam VIndexed_Ids  Message ids below this have a subscriber index, so a
+  ///                       broadcast only visits the routers that accept it.
+  ///                       Costs VIndexed_Ids * ((MAX_ROUTERS_ + 31) / 32) words.
+  ///                       Zero disables the index.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t VIndexed_Ids = 0U>
   class message_bus : public etl::imessage_bus
   {
   public:
@@ -409,22 +574,34 @@ namespace etl
     /// Constructor.
     //*******************************************
     message_bus()
-      : imessage_bus(router_list)
+      : imessage_bus(router_list, index, VIndexed_Ids, Index_Words)
     {
+      imessage_bus::rebuild_index();
     }
 
     //*******************************************
     /// Constructor.
     //*******************************************
     message_bus(etl::imessage_router& successor)
-      : imessage_bus(router_list, successor)
+      : imessage_bus(router_list, index, VIndexed_Ids, Index_Words, successor)
     {
+      imessage_bus::rebuild_index();
     }
 
   private:
 
+    static ETL_CONSTANT size_t Index_Words = (MAX_ROUTERS_ + (Bits_Per_Word - 1U)) / Bits_Per_Word;
+    static ETL_CONSTANT size_t Index_Size  = (VIndexed_Ids == 0U) ? 1U : VIndexed_Ids * Index_Words;
+
     etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    uint32_t index[Index_Size];
   };
+
+  template <uint_least8_t MAX_ROUTERS_, size_t VIndexed_Ids>
+  ETL_CONSTANT size_t message_bus<MAX_ROUTERS_, VIndexed_Ids>::Index_Words;
+
+  template <uint_least8_t MAX_ROUTERS_, size_t VIndexed_Ids>
+  ETL_CONSTANT size_t message_bus<MAX_ROUTERS_, VIndexed_Ids>::Index_Size;
 }
 
 #endif
@@ -0,0 +1,219 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_RATE_LIMITER_INCLUDED
+#define ETL_MESSAGE_RATE_LIMITER_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "rate_limiter.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// An admission stage in front of a message bus, or any other router.
+  /// Messages are rate limited per destination router id, with broadcasts
+  /// sharing the ALL_MESSAGE_ROUTERS bucket. Admitted messages are passed to
+  /// the destination. Rejected messages are passed to the successor, if
+  /// there is one, and are otherwise dropped.
+  /// The limiter keeps its own time, advanced by 'tick' from the same source
+  /// as the timers, and the buckets refill lazily from it.
+  ///\tparam VMax_Destinations The number of destinations tracked at once.
+  ///\tparam TBucket           The bucket type. etl::token_bucket or etl::leaky_bucket.
+  //***************************************************************************
+  template <size_t VMax_Destinations, typename TBucket = etl::token_bucket>
+  class message_rate_limiter : public etl::imessage_router
+  {
+  public:
+
+    typedef TBucket                                                                 bucket_type;
+    typedef typename TBucket::tick_type                                             tick_type;
+    typedef etl::rate_limiter_table<etl::message_router_id_t, VMax_Destinations, TBucket> table_type;
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Constructor.
+    ///\param destination_ The router that admitted messages are passed to, usually an etl::imessage_bus.
+    ///\param prototype    The bucket that is copied for each destination.
+    ///\param id_          The id of this router.
+    //*******************************************
+    message_rate_limiter(etl::imessage_router& destination_, const bucket_type& prototype, etl::message_router_id_t id_ = etl::imessage_router::MESSAGE_BUS)
+      : imessage_router(id_)
+      , destination(destination_)
+      , table(prototype)
+      , now(0U)
+      , rejected(0U)
+    {
+    }
+
+    //*******************************************
+    virtual void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, msg);
+    }
+
+    //*******************************************
+    virtual void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      receive(etl::imessage_router::ALL_MESSAGE_ROUTERS, shared_msg);
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, const etl::imessage& msg) ETL_OVERRIDE
+    {
+      if (admit(destination_router_id))
+      {
+        destination.receive(destination_router_id, msg);
+      }
+      else if (has_successor())
+      {
+        get_successor().receive(destination_router_id, msg);
+      }
+    }
+
+    //*******************************************
+    virtual void receive(etl::message_router_id_t destination_router_id, etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      if (admit(destination_router_id))
+      {
+        destination.receive(destination_router_id, shared_msg);
+      }
+      else if (has_successor())
+      {
+        get_successor().receive(destination_router_id, shared_msg);
+      }
+    }
+
+    //*******************************************
+    /// Advances the time.
+    //*******************************************
+    void tick(tick_type count)
+    {
+      now += count;
+    }
+
+    //*******************************************
+    /// Gets the time.
+    //*******************************************
+    tick_type time() const
+    {
+      return now;
+    }
+
+    //*******************************************
+    /// Gets the number of messages rejected.
+    //*******************************************
+    size_t rejected_count() const
+    {
+      return rejected;
+    }
+
+    //*******************************************
+    /// Clears the number of messages rejected.
+    //*******************************************
+    void clear_rejected_count()
+    {
+      rejected = 0U;
+    }
+
+    //*******************************************
+    /// Gets the table of buckets.
+    //*******************************************
+    table_type& get_table()
+    {
+      return table;
+    }
+
+    //*******************************************
+    /// Gets the table of buckets.
+    //*******************************************
+    const table_type& get_table() const
+    {
+      return table;
+    }
+
+    using imessage_router::accepts;
+
+    //*******************************************
+    /// Accepts the messages that the destination accepts.
+    //*******************************************
+    virtual bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return destination.accepts(id);
+    }
+
+    //*******************************************
+    ETL_DEPRECATED virtual bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*******************************************
+    virtual bool is_producer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*******************************************
+    virtual bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+  private:
+
+    //*******************************************
+    /// Takes a token for the destination.
+    //*******************************************
+    bool admit(etl::message_router_id_t destination_router_id)
+    {
+      const bool admitted = table.try_consume(destination_router_id, now);
+
+      if (!admitted)
+      {
+        ++rejected;
+      }
+
+      return admitted;
+    }
+
+    etl::imessage_router& destination;
+    table_type            table;
+    tick_type             now;
+    size_t                rejected;
+  };
+}
+
+#endif
@@ -54,6 +54,7 @@ SOFTWARE.
 #include "platform.h"
 #include "message.h"
 #include "shared_message.h"
+#include "message_trace.h"
 #if ETL_HAS_VIRTUAL_MESSAGES
   #include "message_packet.h"
 #endif
@@ -348,6 +349,8 @@ namespace etl
   static inline void send_message(etl::imessage_router& destination,
                                   const etl::imessage&  message)
   {
+    ETL_MESSAGE_TRACE_SCOPE(message.get_message_id(), destination.get_message_router_id());
+
     destination.receive(message);
   }
 
@@ -357,6 +360,8 @@ namespace etl
   static inline void send_message(etl::imessage_router& destination,
                                   etl::shared_message message)
   {
+    ETL_MESSAGE_TRACE_SCOPE(message.get_message().get_message_id(), destination.get_message_router_id());
+
     destination.receive(message);
   }
 
@@ -367,6 +372,8 @@ namespace etl
                                   etl::message_router_id_t id,
                                   const etl::imessage& message)
   {
+    ETL_MESSAGE_TRACE_SCOPE(message.get_message_id(), destination.get_message_router_id());
+
     destination.receive(id, message);
   }
 
@@ -377,6 +384,8 @@ namespace etl
                                   etl::message_router_id_t id,
                                   etl::shared_message message)
   {
+    ETL_MESSAGE_TRACE_SCOPE(message.get_message().get_message_id(), destination.get_message_router_id());
+
     destination.receive(id, message);
   }
 
@@ -384,6 +393,183 @@ namespace etl
 // For C++17 and above.
 //*************************************************************************************************
 #if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+
+  //***************************************************************************
+  /// Message ids below this are looked up with a bitset, larger ones with a
+  /// binary search.
+  //***************************************************************************
+#if !defined(ETL_MESSAGE_ROUTER_BITSET_ID_LIMIT)
+  #define ETL_MESSAGE_ROUTER_BITSET_ID_LIMIT 256
+#endif
+
+  namespace private_message_router
+  {
+    //*************************************************************************
+    template <typename... TIds>
+    constexpr etl::message_id_t max_message_id(TIds... ids)
+    {
+      etl::message_id_t result = 0;
+      ((result = (ids > result) ? ids : result), ...);
+      return result;
+    }
+
+    //*************************************************************************
+    /// The number of set bits.
+    /// Local, so that the router does not need the whole of bit.h.
+    //*************************************************************************
+    constexpr size_t count_bits(uint32_t value)
+    {
+      value = value - ((value >> 1U) & 0x55555555UL);
+      value = (value & 0x33333333UL) + ((value >> 2U) & 0x33333333UL);
+      value = (value + (value >> 4U)) & 0x0F0F0F0FUL;
+      value = value * 0x01010101UL;
+
+      return value >> 24U;
+    }
+
+    //*************************************************************************
+    /// A compile time table of handlers, sorted by message id.
+    /// Lookup is a bitset test and a popcount, or a binary search for large ids.
+    /// If an id is repeated, the first handler is used.
+    /// \tparam THandler          The handler function pointer type.
+    /// \tparam VBitset_Id_Limit  Use the bitset if all of the ids are below this.
+    /// \tparam Ids               The message ids, in handler order.
+    //*************************************************************************
+    template <typename THandler, size_t VBitset_Id_Limit, etl::message_id_t... Ids>
+    class dispatch_table
+    {
+    public:
+
+      static constexpr size_t            Number_Of_Ids = sizeof...(Ids);
+      static constexpr etl::message_id_t Max_Id        = max_message_id(Ids...);
+      static constexpr bool              Use_Bitset    = (size_t(Max_Id) < VBitset_Id_Limit);
+      static constexpr size_t            Bits_Per_Word = 32U;
+      static constexpr size_t            Bitset_Words  = Use_Bitset ? (size_t(Max_Id) / Bits_Per_Word) + 1U : 1U;
+
+      //***********************************
+      /// Constructs from the handlers, in the same order as the ids.
+      //***********************************
+      constexpr dispatch_table(const THandler (&handlers_)[Number_Of_Ids + 1U])
+        : ids()
+        , handlers()
+        , size(0U)
+        , words()
+        , ranks()
+      {
+        const etl::message_id_t unsorted[Number_Of_Ids + 1U] = { Ids..., 0 };
+
+        for (size_t i = 0U; i < Number_Of_Ids; ++i)
+        {
+          const etl::message_id_t id = unsorted[i];
+
+          size_t position = 0U;
+
+          while ((position < size) && (ids[position] < id))
+          {
+            ++position;
+          }
+
+          if ((position == size) || (ids[position] != id))
+          {
+            for (size_t j = size; j > position; --j)
+            {
+              ids[j]      = ids[j - 1U];
+              handlers[j] = handlers[j - 1U];
+            }
+
+            ids[position]      = id;
+            handlers[position] = handlers_[i];
+            ++size;
+          }
+        }
+
+        if (Use_Bitset)
+        {
+          for (size_t i = 0U; i < size; ++i)
+          {
+            words[size_t(ids[i]) / Bits_Per_Word] |= uint32_t(1U) << (size_t(ids[i]) % Bits_Per_Word);
+          }
+
+          for (size_t i = 1U; i < Bitset_Words; ++i)
+          {
+            ranks[i] = ranks[i - 1U] + count_bits(words[i - 1U]);
+          }
+        }
+      }
+
+      //***********************************
+      /// Is there a handler for the id?
+      //***********************************
+      constexpr bool contains(etl::message_id_t id) const
+      {
+        return find_index(id) != size;
+      }
+
+      //***********************************
+      /// Gets the handler for the id, or ETL_NULLPTR.
+      //***********************************
+      constexpr THandler find(etl::message_id_t id) const
+      {
+        const size_t index = find_index(id);
+
+        return (index == size) ? ETL_NULLPTR : handlers[index];
+      }
+
+    private:
+
+      //***********************************
+      /// Gets the index of the id, or size if not present.
+      //***********************************
+      constexpr size_t find_index(etl::message_id_t id) const
+      {
+        if constexpr (Use_Bitset)
+        {
+          if (id > Max_Id)
+          {
+            return size;
+          }
+
+          const size_t   word = size_t(id) / Bits_Per_Word;
+          const uint32_t bit  = uint32_t(1U) << (size_t(id) % Bits_Per_Word);
+
+          if ((words[word] & bit) == 0U)
+          {
+            return size;
+          }
+
+          return ranks[word] + count_bits(words[word] & (bit - 1U));
+        }
+        else
+        {
+          size_t first = 0U;
+          size_t last  = size;
+
+          while (first < last)
+          {
+            const size_t middle = first + ((last - first) / 2U);
+
+            if (ids[middle] < id)
+            {
+              first = middle + 1U;
+            }
+            else
+            {
+              last = middle;
+            }
+          }
+
+          return ((first != size) && (ids[first] == id)) ? first : size;
+        }
+      }
+
+      etl::message_id_t ids[Number_Of_Ids + 1U];
+      THandler          handlers[Number_Of_Ids + 1U];
+      size_t            size;
+      uint32_t          words[Bitset_Words];
+      size_t            ranks[Bitset_Words];
+    };
+  }
+
   //***************************************************************************
   // The definition for all message types.
   //***************************************************************************
@@ -427,9 +613,13 @@ namespace etl
 
     void receive(const etl::imessage& msg) ETL_OVERRIDE
     {
-      const bool was_handled = (receive_message_type<TMessageTypes>(msg) || ...);
+      const handler_type handler = get_dispatch_table().find(msg.get_message_id());
 
-      if (!was_handled)
+      if (handler != ETL_NULLPTR)
+      {
+        handler(*this, msg);
+      }
+      else
       {
         if (has_successor())
         {
@@ -467,7 +657,14 @@ namespace etl
 
     bool accepts(etl::message_id_t id) const ETL_OVERRIDE
     {
-      return (accepts_type<TMessageTypes>(id) || ...);
+      if (get_dispatch_table().contains(id))
+      {
+        return true;
+      }
+      else
+      {
+        return has_successor() && get_successor().accepts(id);
+      }
     }
 
     //********************************************
@@ -490,40 +687,26 @@ namespace etl
 
   private:
 
+    typedef void (*handler_type)(message_router&, const etl::imessage&);
+
     //********************************************
     template <typename TMessage>
-    bool receive_message_type(const etl::imessage& msg)
+    static void dispatch(message_router& router, const etl::imessage& msg)
     {
-      if (TMessage::ID == msg.get_message_id())
-      {
-        static_cast<TDerived*>(this)->on_receive(static_cast<const TMessage&>(msg));
-        return true;
-      }
-      else
-      {
-        return false;
-      }
+      static_cast<TDerived&>(router).on_receive(static_cast<const TMessage&>(msg));
     }
 
     //********************************************
-    template <typename TMessage>
-    bool accepts_type(etl::message_id_t id) const
+    /// The handlers for the message types, built at compile time.
+    //********************************************
+    static const auto& get_dispatch_table()
     {
-      if (TMessage::ID == id)
-      {
-        return true;
-      }
-      else
-      {
-        if (has_successor())
-        {
-          return get_successor().accepts(id);
-        }
-        else
-        {
-          return false;
-        }
-      }
+      typedef private_message_router::dispatch_table<handler_type, ETL_MESSAGE_ROUTER_BITSET_ID_LIMIT, TMessageTypes::ID...> table_type;
+
+      static constexpr handler_type handlers[] = { &message_router::template dispatch<TMessageTypes>..., ETL_NULLPTR };
+      static constexpr table_type   table(handlers);
+
+      return table;
     }
   };
 #else
@@ -0,0 +1,471 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TIMER_WHEEL_INCLUDED
+#define ETL_MESSAGE_TIMER_WHEEL_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "atomic.h"
+#include "placement_new.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the message timer wheel.
+  /// A message timer with the same interface as etl::imessage_timer_atomic
+  /// that keeps its active timers in a hierarchical timing wheel.
+  /// start and stop are O(1) and tick is amortised O(1) per expired timer,
+  /// whatever the number of active timers.
+  //***************************************************************************
+  template <typename TSemaphore, size_t VLevel_Bits = 6U>
+  class imessage_timer_wheel
+  {
+  public:
+
+    //*******************************************
+    /// Register a timer.
+    //*******************************************
+    etl::timer::id::type register_timer(const etl::imessage&     message_,
+                                        etl::imessage_router&    router_,
+                                        uint32_t                 period_,
+                                        bool                     repeating_,
+                                        etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      etl::timer::id::type id = etl::timer::id::NO_TIMER;
+
+      bool is_space = (number_of_registered_timers < MAX_TIMERS);
+
+      if (is_space)
+      {
+        // There's no point adding null message routers.
+        if (!router_.is_null_router())
+        {
+          // Search for the free space.
+          for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+          {
+            timer_data& timer = timer_array[i];
+
+            if (timer.id == etl::timer::id::NO_TIMER)
+            {
+              // Create in-place.
+              new (&timer) timer_data(i, message_, router_, period_, repeating_, destination_router_id_);
+              ++number_of_registered_timers;
+              id = i;
+              break;
+            }
+          }
+        }
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ++process_semaphore;
+            wheel.remove(timer.id);
+            --process_semaphore;
+          }
+
+          // Reset in-place.
+          new (&timer) timer_data();
+          --number_of_registered_timers;
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Enable/disable the timer.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Enable/disable catch-up mode.
+    /// When enabled, a repeating timer that expires more than once during a
+    /// single call to 'tick' is only fired once, and is then rescheduled in
+    /// phase with its period.
+    //*******************************************
+    void enable_catch_up(bool state_)
+    {
+      catch_up = state_;
+    }
+
+    //*******************************************
+    /// Get the catch-up mode.
+    //*******************************************
+    bool is_catch_up_enabled() const
+    {
+      return catch_up;
+    }
+
+    //*******************************************
+    /// Clears the timer of data.
+    //*******************************************
+    void clear()
+    {
+      ++process_semaphore;
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      wheel.clear();
+      --process_semaphore;
+
+      number_of_registered_timers = 0;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (process_semaphore == 0U)
+        {
+          // Timers started with no delay.
+          process_expired(count);
+
+          while (wheel.advance(count))
+          {
+            process_expired(count);
+          }
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          // Has a valid period.
+          if (timer.period != etl::timer::state::Inactive)
+          {
+            ++process_semaphore;
+            if (timer.is_active())
+            {
+              wheel.remove(timer.id);
+            }
+
+            wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+            --process_semaphore;
+
+            result = true;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      bool result = false;
+
+      // Valid timer id?
+      if (id_ != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id_];
+
+        // Registered timer?
+        if (timer.id != etl::timer::id::NO_TIMER)
+        {
+          if (timer.is_active())
+          {
+            ++process_semaphore;
+            wheel.remove(timer.id);
+            --process_semaphore;
+          }
+
+          result = true;
+        }
+      }
+
+      return result;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event.
+    /// Returns etl::timer::state::Inactive if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      ++process_semaphore;
+      uint32_t delta = wheel.time_to_next();
+      --process_semaphore;
+
+      return delta;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , period(0U)
+        , expiry(0U)
+        , destination_router_id(etl::imessage_bus::ALL_MESSAGE_ROUTERS)
+        , slot(wheel_type::No_Slot)
+        , id(etl::timer::id::NO_TIMER)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      timer_data(etl::timer::id::type     id_,
+                 const etl::imessage&     message_,
+                 etl::imessage_router&    irouter_,
+                 uint32_t                 period_,
+                 bool                     repeating_,
+                 etl::message_router_id_t destination_router_id_ = etl::imessage_bus::ALL_MESSAGE_ROUTERS)
+        : p_message(&message_)
+        , p_router(&irouter_)
+        , period(period_)
+        , expiry(0U)
+        , destination_router_id(destination_router_id_)
+        , slot(wheel_type::No_Slot)
+        , id(id_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != wheel_type::No_Slot;
+      }
+
+      const etl::imessage*     p_message;
+      etl::imessage_router*    p_router;
+      uint32_t                 period;
+      uint32_t                 expiry;
+      etl::message_router_id_t destination_router_id;
+      uint16_t                 slot;
+      etl::timer::id::type     id;
+      uint_least8_t            previous;
+      uint_least8_t            next;
+      bool                     repeating;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    imessage_timer_wheel(timer_data* const timer_array_, const uint_least8_t MAX_TIMERS_)
+      : timer_array(timer_array_)
+      , wheel(timer_array_, MAX_TIMERS_)
+      , enabled(false)
+      , catch_up(false)
+      , process_semaphore(0U)
+      , number_of_registered_timers(0U)
+      , MAX_TIMERS(MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    typedef etl::private_timer_wheel::timer_wheel<timer_data, VLevel_Bits> wheel_type;
+
+    //*******************************************
+    /// Sends the messages of all expired timers.
+    /// 'remaining' is the number of ticks still to be processed.
+    //*******************************************
+    void process_expired(uint32_t remaining)
+    {
+      etl::timer::id::type id = wheel.pop_expired();
+
+      while (id != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id];
+
+        if (timer.p_router != ETL_NULLPTR)
+        {
+          timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+        }
+
+        if (timer.repeating)
+        {
+          // Reinsert the timer.
+          wheel.insert(timer.id, catch_up ? etl::private_timer::catch_up_delta(timer.period, remaining) : timer.period);
+        }
+
+        id = wheel.pop_expired();
+      }
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The wheel of active timers.
+    wheel_type wheel;
+
+    bool enabled;
+    bool catch_up;
+    mutable TSemaphore process_semaphore;
+    uint_least8_t number_of_registered_timers;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+  };
+
+  //***************************************************************************
+  /// The message timer wheel
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS_, typename TSemaphore, size_t VLevel_Bits = 6U>
+  class message_timer_wheel : public etl::imessage_timer_wheel<TSemaphore, VLevel_Bits>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer_wheel()
+      : imessage_timer_wheel<TSemaphore, VLevel_Bits>(timer_array, MAX_TIMERS_)
+    {
+    }
+
+  private:
+
+    typename etl::imessage_timer_wheel<TSemaphore, VLevel_Bits>::timer_data timer_array[MAX_TIMERS_];
+  };
+}
+
+#endif
+#endif
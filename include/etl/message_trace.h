@@ -0,0 +1,327 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MESSAGE_TRACE_INCLUDED
+#define ETL_MESSAGE_TRACE_INCLUDED
+
+#include "platform.h"
+#include "message_types.h"
+
+//*****************************************************************************
+/// Optional tracing of messages through routers, buses and brokers.
+/// Define ETL_MESSAGE_TRACE to enable it. When it is not defined the trace
+/// macros expand to nothing.
+/// The timestamp type may be set with ETL_MESSAGE_TRACE_TIMESTAMP_TYPE.
+/// The default is uint32_t, to suit a cycle counter.
+//*****************************************************************************
+#if defined(ETL_MESSAGE_TRACE)
+
+#include "delegate.h"
+#include "histogram.h"
+#include "array.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ETL_HAS_MESSAGE_TRACE 1
+
+#if !defined(ETL_MESSAGE_TRACE_TIMESTAMP_TYPE)
+  #define ETL_MESSAGE_TRACE_TIMESTAMP_TYPE uint32_t
+#endif
+
+namespace etl
+{
+  typedef ETL_MESSAGE_TRACE_TIMESTAMP_TYPE message_trace_timestamp_t;
+
+  //***************************************************************************
+  /// A trace event.
+  //***************************************************************************
+  struct message_trace_event
+  {
+    enum enum_type
+    {
+      Enqueue,  ///< The message was put in a queue.
+      Dispatch, ///< The message was passed to a router, bus or broker.
+      Complete  ///< The router, bus or broker has returned.
+    };
+  };
+
+  //***************************************************************************
+  /// The information passed to the trace callback.
+  //***************************************************************************
+  struct message_trace_record
+  {
+    message_trace_event::enum_type event;
+    etl::message_id_t              message_id;
+    etl::message_router_id_t       router_id;
+    etl::message_trace_timestamp_t timestamp;
+    etl::message_trace_timestamp_t duration; ///< The time since Dispatch, for Complete. Otherwise zero.
+  };
+
+  //***************************************************************************
+  /// The trace callback and clock.
+  //***************************************************************************
+  class message_trace
+  {
+  public:
+
+    typedef etl::delegate<void(const etl::message_trace_record&)> callback_type;
+    typedef etl::delegate<etl::message_trace_timestamp_t(void)>   clock_type;
+
+    //*************************************************************************
+    /// Sets the function that receives the trace records.
+    //*************************************************************************
+    static void set_callback(const callback_type& callback)
+    {
+      get_callback() = callback;
+    }
+
+    //*************************************************************************
+    /// Sets the function that supplies the timestamps.
+    /// Without a clock, every timestamp is zero.
+    //*************************************************************************
+    static void set_clock(const clock_type& clock)
+    {
+      get_clock() = clock;
+    }
+
+    //*************************************************************************
+    /// Removes the callback and the clock.
+    //*************************************************************************
+    static void clear()
+    {
+      get_callback() = callback_type();
+      get_clock()    = clock_type();
+    }
+
+    //*************************************************************************
+    /// Gets the current time from the clock.
+    //*************************************************************************
+    static etl::message_trace_timestamp_t now()
+    {
+      const clock_type& clock = get_clock();
+
+      return clock.is_valid() ? clock() : etl::message_trace_timestamp_t(0);
+    }
+
+    //*************************************************************************
+    /// Sends a record to the callback, if there is one.
+    //*************************************************************************
+    static void trace(message_trace_event::enum_type event,
+                      etl::message_id_t              message_id,
+                      etl::message_router_id_t       router_id,
+                      etl::message_trace_timestamp_t timestamp,
+                      etl::message_trace_timestamp_t duration = etl::message_trace_timestamp_t(0))
+    {
+      const callback_type& callback = get_callback();
+
+      if (callback.is_valid())
+      {
+        const etl::message_trace_record record = { event, message_id, router_id, timestamp, duration };
+
+        callback(record);
+      }
+    }
+
+    //*************************************************************************
+    /// Sends an event that happens now.
+    //*************************************************************************
+    static void trace(message_trace_event::enum_type event,
+                      etl::message_id_t              message_id,
+                      etl::message_router_id_t       router_id)
+    {
+      if (get_callback().is_valid())
+      {
+        trace(event, message_id, router_id, now());
+      }
+    }
+
+    //*************************************************************************
+    /// Sends Dispatch on construction and Complete on destruction.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      scope(etl::message_id_t message_id_, etl::message_router_id_t router_id_)
+        : message_id(message_id_)
+        , router_id(router_id_)
+        , start(now())
+      {
+        trace(message_trace_event::Dispatch, message_id, router_id, start);
+      }
+
+      ~scope()
+      {
+        const etl::message_trace_timestamp_t finish   = now();
+        const etl::message_trace_timestamp_t duration = finish - start;
+
+        trace(message_trace_event::Complete, message_id, router_id, finish, duration);
+      }
+
+    private:
+
+      // Disabled.
+      scope(const scope&);
+      scope& operator =(const scope&);
+
+      const etl::message_id_t              message_id;
+      const etl::message_router_id_t       router_id;
+      const etl::message_trace_timestamp_t start;
+    };
+
+  private:
+
+    //*************************************************************************
+    static callback_type& get_callback()
+    {
+      static callback_type callback;
+
+      return callback;
+    }
+
+    //*************************************************************************
+    static clock_type& get_clock()
+    {
+      static clock_type clock;
+
+      return clock;
+    }
+  };
+
+  //***************************************************************************
+  /// A latency histogram for each message id, fed from the Complete records.
+  /// Pass on_trace() to message_trace::set_callback().
+  ///\tparam VMax_Id       Ids from zero up to, and not including, this are recorded.
+  ///\tparam VBuckets      The number of buckets for each id.
+  ///\tparam VBucket_Width The width of each bucket, in timestamp units.
+  /// Latencies beyond the last bucket are added to the last bucket.
+  ///\tparam TCount        The count type.
+  //***************************************************************************
+  template <size_t VMax_Id, size_t VBuckets, size_t VBucket_Width = 1U, typename TCount = uint32_t>
+  class message_latency_histogram
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Id > 0U,       "Zero ids");
+    ETL_STATIC_ASSERT(VBuckets > 0U,      "Zero buckets");
+    ETL_STATIC_ASSERT(VBucket_Width > 0U, "Zero bucket width");
+
+    typedef etl::histogram<size_t, TCount, VBuckets, 0> histogram_type;
+
+    static ETL_CONSTANT size_t Max_Id       = VMax_Id;
+    static ETL_CONSTANT size_t Buckets      = VBuckets;
+    static ETL_CONSTANT size_t Bucket_Width = VBucket_Width;
+
+    //*************************************************************************
+    /// Adds a latency for a message id.
+    /// Ids that are out of range are ignored.
+    //*************************************************************************
+    void add(etl::message_id_t id, etl::message_trace_timestamp_t latency)
+    {
+      if (size_t(id) < VMax_Id)
+      {
+        size_t bucket = size_t(latency) / VBucket_Width;
+
+        if (bucket >= VBuckets)
+        {
+          bucket = VBuckets - 1U;
+        }
+
+        histograms[id].add(bucket);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds the latency from a Complete record.
+    //*************************************************************************
+    void on_trace(const etl::message_trace_record& record)
+    {
+      if (record.event == message_trace_event::Complete)
+      {
+        add(record.message_id, record.duration);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the histogram for an id.
+    //*************************************************************************
+    const histogram_type& operator [](etl::message_id_t id) const
+    {
+      return histograms[id];
+    }
+
+    //*************************************************************************
+    /// Clears all of the histograms.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < VMax_Id; ++i)
+      {
+        histograms[i].clear();
+      }
+    }
+
+  private:
+
+    etl::array<histogram_type, VMax_Id> histograms;
+  };
+
+  template <size_t VMax_Id, size_t VBuckets, size_t VBucket_Width, typename TCount>
+  ETL_CONSTANT size_t message_latency_histogram<VMax_Id, VBuckets, VBucket_Width, TCount>::Max_Id;
+
+  template <size_t VMax_Id, size_t VBuckets, size_t VBucket_Width, typename TCount>
+  ETL_CONSTANT size_t message_latency_histogram<VMax_Id, VBuckets, VBucket_Width, TCount>::Buckets;
+
+  template <size_t VMax_Id, size_t VBuckets, size_t VBucket_Width, typename TCount>
+  ETL_CONSTANT size_t message_latency_histogram<VMax_Id, VBuckets, VBucket_Width, TCount>::Bucket_Width;
+}
+
+#define ETL_MESSAGE_TRACE_CONCAT2(a, b) a##b
+#define ETL_MESSAGE_TRACE_CONCAT(a, b)  ETL_MESSAGE_TRACE_CONCAT2(a, b)
+
+/// Traces Dispatch now, and Complete at the end of the enclosing scope.
+#define ETL_MESSAGE_TRACE_SCOPE(message_id, router_id) \
+  const etl::message_trace::scope ETL_MESSAGE_TRACE_CONCAT(etl_message_trace_scope_, __LINE__)((message_id), (router_id))
+
+/// Traces a message being put in a queue.
+#define ETL_MESSAGE_TRACE_ENQUEUE(message_id, router_id) \
+  etl::message_trace::trace(etl::message_trace_event::Enqueue, (message_id), (router_id))
+
+#else
+
+#define ETL_HAS_MESSAGE_TRACE 0
+
+#define ETL_MESSAGE_TRACE_SCOPE(message_id, router_id)
+#define ETL_MESSAGE_TRACE_ENQUEUE(message_id, router_id)
+
+#endif
+
+#endif
@@ -0,0 +1,472 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MICROBENCHMARK_INCLUDED
+#define ETL_MICROBENCHMARK_INCLUDED
+
+#include "platform.h"
+#include "cycle_counter.h"
+#include "delegate.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_CYCLE_COUNTER
+
+///\defgroup microbenchmark Microbenchmarks
+/// A small benchmark framework that runs on the target, timed by etl::cycle_counter.
+/// Benchmarks are registered with ETL_BENCHMARK and are run by
+/// etl::run_benchmarks, which passes each result to a user supplied delegate.
+/// No memory is allocated.
+///\code
+/// void crc32_4k(etl::benchmark_state& state)
+/// {
+///   while (state.keep_running())
+///   {
+///     uint32_t crc = etl::crc32(data, data + 4096);
+///     etl::benchmark_do_not_optimize(crc);
+///   }
+///
+///   state.set_bytes_processed(state.iterations() * 4096);
+/// }
+///
+/// ETL_BENCHMARK(crc32_4k);
+///\endcode
+///\ingroup utilities
+
+#if !defined(ETL_BENCHMARK_MIN_TICKS)
+  // The fewest counter ticks that each benchmark is run for.
+  #define ETL_BENCHMARK_MIN_TICKS 1000000UL
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Runs the timed loop of a benchmark and records the time taken.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  class benchmark_state
+  {
+  public:
+
+    typedef etl::cycle_counter::value_type tick_type;
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Counts down the iterations for 'for (auto _ : state)'.
+    /// The timer stops when the count reaches zero.
+    //*************************************************************************
+    class iterator
+    {
+    public:
+
+      // Not trivial, so that the unused loop variable does not cause a warning.
+      struct value_type
+      {
+        value_type()
+        {
+        }
+
+        ~value_type()
+        {
+        }
+      };
+
+      iterator(benchmark_state* state_, uint32_t remaining_)
+        : state(state_)
+        , remaining(remaining_)
+      {
+      }
+
+      value_type operator *() const
+      {
+        return value_type();
+      }
+
+      iterator& operator ++()
+      {
+        --remaining;
+        return *this;
+      }
+
+      bool operator !=(const iterator&)
+      {
+        if (remaining != 0U)
+        {
+          return true;
+        }
+
+        state->stop();
+        return false;
+      }
+
+    private:
+
+      benchmark_state* state;
+      uint32_t         remaining;
+    };
+
+    //*************************************************************************
+    /// Starts the timer.
+    //*************************************************************************
+    iterator begin()
+    {
+      begin_timing();
+      return iterator(this, max_iterations);
+    }
+
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(this, 0U);
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit benchmark_state(uint32_t max_iterations_)
+      : max_iterations(max_iterations_)
+      , remaining(max_iterations_)
+      , started(false)
+      , first(0U)
+      , last(0U)
+      , items(0U)
+      , bytes(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// For 'while (state.keep_running())', which works before C++11.
+    /// Starts the timer on the first call and stops it on the last.
+    //*************************************************************************
+    bool keep_running()
+    {
+      if (!started)
+      {
+        begin_timing();
+      }
+
+      if (remaining != 0U)
+      {
+        --remaining;
+        return true;
+      }
+
+      stop();
+      return false;
+    }
+
+    //*************************************************************************
+    /// The number of times the loop runs.
+    //*************************************************************************
+    uint32_t iterations() const
+    {
+      return max_iterations;
+    }
+
+    //*************************************************************************
+    /// Records the items or bytes processed by all of the iterations.
+    //*************************************************************************
+    void set_items_processed(uint64_t items_)
+    {
+      items = items_;
+    }
+
+    void set_bytes_processed(uint64_t bytes_)
+    {
+      bytes = bytes_;
+    }
+
+    uint64_t items_processed() const
+    {
+      return items;
+    }
+
+    uint64_t bytes_processed() const
+    {
+      return bytes;
+    }
+
+    //*************************************************************************
+    /// The ticks taken by the loop.
+    //*************************************************************************
+    tick_type elapsed() const
+    {
+      return etl::cycle_counter::elapsed(first, last);
+    }
+
+  private:
+
+    void begin_timing()
+    {
+      started = true;
+      first   = etl::cycle_counter::now();
+    }
+
+    void stop()
+    {
+      last = etl::cycle_counter::now();
+    }
+
+    uint32_t  max_iterations;
+    uint32_t  remaining;
+    bool      started;
+    tick_type first;
+    tick_type last;
+    uint64_t  items;
+    uint64_t  bytes;
+  };
+
+  //***************************************************************************
+  /// The result of one benchmark, passed to the sink.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  struct benchmark_result
+  {
+    const char* name;
+    const char* units;                  ///< The unit of the tick counts.
+    uint32_t    iterations;
+    uint64_t    ticks;                  ///< For all of the iterations.
+    uint64_t    ticks_per_iteration;
+    uint64_t    items_processed;
+    uint64_t    bytes_processed;
+  };
+
+  typedef etl::delegate<void(const etl::benchmark_result&)> benchmark_sink;
+
+  //***************************************************************************
+  /// A registered benchmark.
+  /// Registrations are static objects, linked in the order of construction.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  class benchmark_registration
+  {
+  public:
+
+    typedef void (*function_type)(etl::benchmark_state&);
+
+    //*************************************************************************
+    /// Adds the benchmark to the end of the list.
+    //*************************************************************************
+    benchmark_registration(const char* name_, function_type function_)
+      : name(name_)
+      , function(function_)
+      , next(ETL_NULLPTR)
+    {
+      if (head() == ETL_NULLPTR)
+      {
+        head() = this;
+      }
+      else
+      {
+        tail()->next = this;
+      }
+
+      tail() = this;
+    }
+
+    //*************************************************************************
+    /// The first registered benchmark, or ETL_NULLPTR if there are none.
+    //*************************************************************************
+    static const benchmark_registration* first()
+    {
+      return head();
+    }
+
+    //*************************************************************************
+    /// The next registered benchmark, or ETL_NULLPTR if this is the last.
+    //*************************************************************************
+    const benchmark_registration* get_next() const
+    {
+      return next;
+    }
+
+    const char*   name;
+    function_type function;
+
+  private:
+
+    static benchmark_registration*& head()
+    {
+      static benchmark_registration* p_head = ETL_NULLPTR;
+      return p_head;
+    }
+
+    static benchmark_registration*& tail()
+    {
+      static benchmark_registration* p_tail = ETL_NULLPTR;
+      return p_tail;
+    }
+
+    benchmark_registration* next;
+
+    // Disable copy construction and assignment.
+    benchmark_registration(const benchmark_registration&) ETL_DELETE;
+    benchmark_registration& operator =(const benchmark_registration&) ETL_DELETE;
+  };
+
+  //***************************************************************************
+  /// Runs one benchmark, increasing the iterations until it runs for at
+  /// least 'min_ticks', and returns the result.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  inline etl::benchmark_result run_benchmark(const etl::benchmark_registration& registration,
+                                             uint64_t min_ticks = ETL_BENCHMARK_MIN_TICKS)
+  {
+    // Keep well inside the range of the counter.
+    const uint64_t max_ticks = etl::cycle_counter::max_elapsed() / 2U;
+
+    if (min_ticks > max_ticks)
+    {
+      min_ticks = max_ticks;
+    }
+
+    uint32_t iterations = 1U;
+
+    while (true)
+    {
+      etl::benchmark_state state(iterations);
+      registration.function(state);
+
+      const uint64_t ticks = state.elapsed();
+
+      // Enough time, or as many iterations as can be counted.
+      if ((ticks >= min_ticks) || (iterations >= 0x80000000UL))
+      {
+        etl::benchmark_result result;
+
+        result.name                = registration.name;
+        result.units               = etl::cycle_counter::units();
+        result.iterations          = iterations;
+        result.ticks               = ticks;
+        result.ticks_per_iteration = ticks / iterations;
+        result.items_processed     = state.items_processed();
+        result.bytes_processed     = state.bytes_processed();
+
+        return result;
+      }
+
+      // Grow towards the target, by no more than ten times.
+      uint64_t next = (ticks == 0U) ? (uint64_t(iterations) * 10U)
+                                    : ((uint64_t(iterations) * min_ticks * 5U) / (ticks * 4U));
+
+      if (next > (uint64_t(iterations) * 10U))
+      {
+        next = uint64_t(iterations) * 10U;
+      }
+
+      if (next <= iterations)
+      {
+        next = uint64_t(iterations) + 1U;
+      }
+
+      iterations = (next > 0x80000000ULL) ? 0x80000000UL : uint32_t(next);
+    }
+  }
+
+  //***************************************************************************
+  /// Runs the registered benchmarks whose names contain 'filter', passing
+  /// each result to 'sink'.
+  ///\param sink      Receives the results.
+  ///\param filter    Only names containing this text are run. Default = all.
+  ///\param min_ticks The fewest ticks to run each benchmark for.
+  ///\return The number of benchmarks run.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  inline size_t run_benchmarks(etl::benchmark_sink sink,
+                               const char*         filter    = ETL_NULLPTR,
+                               uint64_t            min_ticks = ETL_BENCHMARK_MIN_TICKS)
+  {
+    etl::cycle_counter::start();
+
+    size_t count = 0U;
+
+    for (const etl::benchmark_registration* p = etl::benchmark_registration::first(); p != ETL_NULLPTR; p = p->get_next())
+    {
+      if ((filter == ETL_NULLPTR) || (strstr(p->name, filter) != ETL_NULLPTR))
+      {
+        const etl::benchmark_result result = etl::run_benchmark(*p, min_ticks);
+
+        if (sink.is_valid())
+        {
+          sink(result);
+        }
+
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Stops the compiler from discarding a value.
+  ///\ingroup microbenchmark
+  //***************************************************************************
+  template <typename T>
+  inline void benchmark_do_not_optimize(T& value)
+  {
+#if defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6)
+    __asm__ __volatile__("" : "+r,m"(value) : : "memory");
+#elif defined(ETL_COMPILER_GCC)
+    // GCC rejects "+r,m" when optimising, so prefer memory.
+    __asm__ __volatile__("" : "+m,r"(value) : : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+  }
+
+  template <typename T>
+  inline void benchmark_do_not_optimize(const T& value)
+  {
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6)
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+  }
+}
+
+#define ETL_BENCHMARK_CONCAT2(a, b) a##b
+#define ETL_BENCHMARK_CONCAT(a, b)  ETL_BENCHMARK_CONCAT2(a, b)
+
+//*****************************************************************************
+/// Registers 'function', which takes an etl::benchmark_state&.
+//*****************************************************************************
+#define ETL_BENCHMARK(function) \
+  static etl::benchmark_registration ETL_BENCHMARK_CONCAT(etl_benchmark_registration_, __LINE__)(#function, function)
+
+#endif
+
+#endif
@@ -0,0 +1,324 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MONOTONIC_ARENA_INCLUDED
+#define ETL_MONOTONIC_ARENA_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for monotonic arenas.
+  //***************************************************************************
+  class monotonic_arena_exception : public etl::exception
+  {
+  public:
+
+    monotonic_arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Rewind to a marker that is not within the allocated region.
+  //***************************************************************************
+  class monotonic_arena_invalid_marker : public etl::monotonic_arena_exception
+  {
+  public:
+
+    monotonic_arena_invalid_marker(string_type file_name_, numeric_type line_number_)
+      : etl::monotonic_arena_exception(ETL_ERROR_TEXT("monotonic_arena:invalid marker", ETL_MONOTONIC_ARENA_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A monotonic (bump) arena over a user supplied buffer.
+  /// Allocation moves a pointer forward. Memory is never released
+  /// individually; it is all reclaimed at once by reset(), or back to an
+  /// earlier point by rewind().
+  /// Objects created in the arena are not destroyed by reset() or rewind().
+  //***************************************************************************
+  class monotonic_arena
+  {
+  public:
+
+    /// The position of the arena, as returned by get_marker().
+    typedef size_t marker_type;
+
+    //*************************************************************************
+    /// Rewinds the arena to the position at construction when it goes out of scope.
+    //*************************************************************************
+    class scoped_marker
+    {
+    public:
+
+      explicit scoped_marker(monotonic_arena& arena_)
+        : arena(arena_)
+        , marker(arena_.get_marker())
+      {
+      }
+
+      ~scoped_marker()
+      {
+        // The arena may already have been reset within the scope.
+        if (marker <= arena.get_marker())
+        {
+          arena.rewind(marker);
+        }
+      }
+
+    private:
+
+      // Disable copy construction and assignment.
+      scoped_marker(const scoped_marker&) ETL_DELETE;
+      scoped_marker& operator =(const scoped_marker&) ETL_DELETE;
+
+      monotonic_arena&  arena;
+      const marker_type marker;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer      The buffer to allocate from.
+    ///\param buffer_size The size of the buffer, in bytes.
+    //*************************************************************************
+    monotonic_arena(void* buffer, size_t buffer_size)
+      : p_buffer(static_cast<char*>(buffer))
+      , buffer_size(buffer_size)
+      , used(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates 'size' bytes with the required alignment.
+    /// The alignment must be a power of two.
+    /// Returns ETL_NULLPTR if the arena does not have enough space.
+    //*************************************************************************
+    void* allocate(size_t size, size_t alignment)
+    {
+      if ((alignment == 0U) || ((alignment & (alignment - 1U)) != 0U))
+      {
+        return ETL_NULLPTR;
+      }
+
+      const size_t address = reinterpret_cast<uintptr_t>(p_buffer) + used;
+      const size_t padding = (alignment - (address & (alignment - 1U))) & (alignment - 1U);
+
+      if ((padding > (buffer_size - used)) || (size > (buffer_size - used - padding)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      char* p = p_buffer + used + padding;
+      used += padding + size;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocates uninitialised storage for n objects of type T.
+    /// Returns ETL_NULLPTR if the arena does not have enough space.
+    //*************************************************************************
+    template <typename T>
+    T* allocate(size_t n = 1U)
+    {
+      if (n > (buffer_size / sizeof(T)))
+      {
+        return ETL_NULLPTR;
+      }
+
+      return static_cast<T*>(allocate(n * sizeof(T), etl::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Gets the current position of the arena.
+    //*************************************************************************
+    marker_type get_marker() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Releases everything allocated since the marker was taken.
+    //*************************************************************************
+    void rewind(marker_type marker)
+    {
+      ETL_ASSERT_OR_RETURN(marker <= used, ETL_ERROR(monotonic_arena_invalid_marker));
+
+      used = marker;
+    }
+
+    //*************************************************************************
+    /// Releases everything allocated from the arena.
+    //*************************************************************************
+    void reset()
+    {
+      used = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if the pointer is within the allocated region of the arena.
+    //*************************************************************************
+    bool is_owner_of(const void* p) const
+    {
+      const intptr_t distance = static_cast<const char*>(p) - p_buffer;
+
+      return (distance >= 0) && (size_t(distance) < used);
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes allocated, including padding.
+    //*************************************************************************
+    size_t size() const
+    {
+      return used;
+    }
+
+    //*************************************************************************
+    /// Returns the size of the buffer.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of bytes not yet allocated.
+    //*************************************************************************
+    size_t available() const
+    {
+      return buffer_size - used;
+    }
+
+    //*************************************************************************
+    /// Returns true if nothing has been allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return used == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns true if all of the buffer has been allocated.
+    //*************************************************************************
+    bool full() const
+    {
+      return used == buffer_size;
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    monotonic_arena(const monotonic_arena&) ETL_DELETE;
+    monotonic_arena& operator =(const monotonic_arena&) ETL_DELETE;
+
+    char* const  p_buffer;
+    const size_t buffer_size;
+    size_t       used;
+  };
+
+  //***************************************************************************
+  /// A memory block allocator that allocates from a monotonic arena.
+  /// Releasing a block succeeds if it belongs to the arena, but the memory
+  /// is only reclaimed when the arena is reset or rewound.
+  /// Allows the arena to back etl::reference_counted_message_pool.
+  //***************************************************************************
+  class monotonic_arena_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit monotonic_arena_memory_block_allocator(etl::monotonic_arena& arena_)
+      : arena(arena_)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the arena.
+    //*************************************************************************
+    etl::monotonic_arena& get_arena()
+    {
+      return arena;
+    }
+
+    //*************************************************************************
+    /// Gets the arena.
+    //*************************************************************************
+    const etl::monotonic_arena& get_arena() const
+    {
+      return arena;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      return arena.allocate(required_size, required_alignment);
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      return arena.is_owner_of(pblock);
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      return arena.is_owner_of(pblock);
+    }
+
+  private:
+
+    etl::monotonic_arena& arena;
+  };
+}
+
+#endif
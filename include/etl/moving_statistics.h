@@ -0,0 +1,674 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MOVING_STATISTICS_INCLUDED
+#define ETL_MOVING_STATISTICS_INCLUDED
+
+#include "platform.h"
+#include "circular_buffer.h"
+#include "functional.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "variance.h"
+
+#include <math.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_moving_statistics
+  {
+    //***************************************************
+    /// add_insert_iterator
+    /// An output iterator used to add new values.
+    //***************************************************
+    template <typename TMoving_Statistic>
+    class add_insert_iterator : public etl::iterator<ETL_OR_STD::output_iterator_tag, typename TMoving_Statistic::value_type, void, void, void>
+    {
+    public:
+
+      //***********************************
+      explicit add_insert_iterator(TMoving_Statistic& ms) ETL_NOEXCEPT
+        : p_ms(&ms)
+      {
+      }
+
+      //***********************************
+      add_insert_iterator& operator*() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++() ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator++(int) ETL_NOEXCEPT
+      {
+        return *this;
+      }
+
+      //***********************************
+      add_insert_iterator& operator =(typename TMoving_Statistic::value_type value)
+      {
+        p_ms->add(value);
+        return *this;
+      }
+
+    private:
+
+      TMoving_Statistic* p_ms;
+    };
+
+    //***************************************************
+    /// The type used to sum the window.
+    /// Integral samples are summed in the widest integral type.
+    //***************************************************
+    template <typename T, bool IsIntegral = etl::is_integral<T>::value>
+    struct sum_type
+    {
+      typedef T type;
+    };
+
+    template <typename T>
+    struct sum_type<T, true>
+    {
+#if ETL_USING_64BIT_TYPES
+      typedef typename etl::conditional<etl::is_signed<T>::value, int64_t, uint64_t>::type type;
+#else
+      typedef typename etl::conditional<etl::is_signed<T>::value, int32_t, uint32_t>::type type;
+#endif
+    };
+
+    //***************************************************
+    /// The default calculation type for moving_variance.
+    //***************************************************
+    template <typename T>
+    struct variance_calc_type
+    {
+      typedef double type;
+    };
+
+    template <>
+    struct variance_calc_type<float>
+    {
+      typedef float type;
+    };
+
+    template <>
+    struct variance_calc_type<long double>
+    {
+      typedef long double type;
+    };
+
+    //***************************************************
+    /// Moving minimum or maximum.
+    /// Keeps a monotonic queue of the samples that may yet become the extreme.
+    /// Each sample is pushed and popped at most once, so updates are O(1) amortised.
+    //***************************************************
+    template <typename T, size_t Window_Size, typename TCompare>
+    class moving_extreme
+    {
+    public:
+
+      ETL_STATIC_ASSERT(Window_Size > 0U, "Window size must be at least 1");
+
+      typedef T value_type;
+
+      //*************************************************************************
+      /// Adds a new sample, dropping the oldest if the window is full.
+      //*************************************************************************
+      void add(T new_value)
+      {
+        if (!candidates.empty() && ((next_index - candidates.front().index) >= Window_Size))
+        {
+          candidates.pop();
+        }
+
+        while (!candidates.empty() && !compare(candidates.back().value, new_value))
+        {
+          candidates.pop_back();
+        }
+
+        candidates.push_back(entry(new_value, next_index));
+        ++next_index;
+
+        if (sample_count < Window_Size)
+        {
+          ++sample_count;
+        }
+      }
+
+      //*************************************************************************
+      /// Gets the extreme of the samples in the window.
+      /// The window must not be empty.
+      //*************************************************************************
+      T value() const
+      {
+        return candidates.front().value;
+      }
+
+      //*************************************************************************
+      /// Clears the window.
+      //*************************************************************************
+      void clear()
+      {
+        candidates.clear();
+        next_index   = 0U;
+        sample_count = 0U;
+      }
+
+      //*************************************************************************
+      /// The number of samples in the window.
+      //*************************************************************************
+      size_t size() const
+      {
+        return sample_count;
+      }
+
+      //*************************************************************************
+      /// Returns true if no samples have been added.
+      //*************************************************************************
+      bool empty() const
+      {
+        return sample_count == 0U;
+      }
+
+      //*************************************************************************
+      /// Returns true if the window is full.
+      //*************************************************************************
+      bool full() const
+      {
+        return sample_count == Window_Size;
+      }
+
+    protected:
+
+      //*************************************************************************
+      moving_extreme()
+        : next_index(0U)
+        , sample_count(0U)
+      {
+      }
+
+    private:
+
+      struct entry
+      {
+        entry(T value_, size_t index_)
+          : value(value_)
+          , index(index_)
+        {
+        }
+
+        T      value;
+        size_t index;
+      };
+
+      etl::circular_buffer<entry, Window_Size> candidates;
+      TCompare compare;
+      size_t   next_index;   ///< Wraps, but only the difference from the oldest index is used.
+      size_t   sample_count;
+    };
+  }
+
+  //***************************************************************************
+  /// Moving Average
+  /// The exact average of the last Window_Size samples.
+  /// Floating point sums are recalculated from the window every Window_Size
+  /// samples, so that rounding errors do not build up.
+  /// \tparam T           The sample value type.
+  /// \tparam Window_Size The number of samples to average over.
+  //***************************************************************************
+  template <typename T, const size_t Window_Size>
+  class moving_average
+  {
+  private:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "Window size must be at least 1");
+
+    typedef moving_average<T, Window_Size> this_t;
+
+  public:
+
+    typedef T value_type;
+    typedef typename private_moving_statistics::sum_type<T>::type sum_type;
+    typedef private_moving_statistics::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size; ///< The number of samples averaged over.
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    moving_average()
+      : total(sum_type(0))
+      , since_resum(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a new sample, dropping the oldest if the window is full.
+    /// \param new_value The value to add.
+    //*************************************************************************
+    void add(T new_value)
+    {
+      if (samples.full())
+      {
+        total -= sum_type(samples.front());
+        samples.pop();
+      }
+
+      samples.push_back(new_value);
+      total += sum_type(new_value);
+
+      if (etl::is_floating_point<sum_type>::value && (++since_resum == Window_Size))
+      {
+        resum();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the current moving average.
+    /// \return The current average, or zero if the window is empty.
+    //*************************************************************************
+    T value() const
+    {
+      if (samples.empty())
+      {
+        return T(0);
+      }
+
+      return T(total / sum_type(samples.size()));
+    }
+
+    //*************************************************************************
+    /// Gets the sum of the samples in the window.
+    //*************************************************************************
+    sum_type sum() const
+    {
+      return total;
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void clear()
+    {
+      samples.clear();
+      total       = sum_type(0);
+      since_resum = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of samples in the window.
+    //*************************************************************************
+    size_t size() const
+    {
+      return samples.size();
+    }
+
+    //*************************************************************************
+    /// Returns true if no samples have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return samples.empty();
+    }
+
+    //*************************************************************************
+    /// Returns true if the window is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Recalculates the sum from the window.
+    //*************************************************************************
+    void resum()
+    {
+      total = sum_type(0);
+
+      for (typename etl::circular_buffer<T, Window_Size>::const_iterator itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        total += sum_type(*itr);
+      }
+
+      since_resum = 0U;
+    }
+
+    etl::circular_buffer<T, Window_Size> samples;
+    sum_type total;
+    size_t   since_resum;
+  };
+
+  template <typename T, const size_t Window_Size>
+  ETL_CONSTANT size_t moving_average<T, Window_Size>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// Moving Minimum
+  /// The minimum of the last Window_Size samples.
+  /// \tparam T           The sample value type.
+  /// \tparam Window_Size The number of samples in the window.
+  /// \tparam TCompare    The comparison. Default = etl::less<T>.
+  //***************************************************************************
+  template <typename T, const size_t Window_Size, typename TCompare = etl::less<T> >
+  class moving_min : public private_moving_statistics::moving_extreme<T, Window_Size, TCompare>
+  {
+  private:
+
+    typedef moving_min<T, Window_Size, TCompare> this_t;
+
+  public:
+
+    typedef private_moving_statistics::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size; ///< The number of samples in the window.
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    moving_min()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+  };
+
+  template <typename T, const size_t Window_Size, typename TCompare>
+  ETL_CONSTANT size_t moving_min<T, Window_Size, TCompare>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// Moving Maximum
+  /// The maximum of the last Window_Size samples.
+  /// \tparam T           The sample value type.
+  /// \tparam Window_Size The number of samples in the window.
+  /// \tparam TCompare    The comparison. Default = etl::greater<T>.
+  //***************************************************************************
+  template <typename T, const size_t Window_Size, typename TCompare = etl::greater<T> >
+  class moving_max : public private_moving_statistics::moving_extreme<T, Window_Size, TCompare>
+  {
+  private:
+
+    typedef moving_max<T, Window_Size, TCompare> this_t;
+
+  public:
+
+    typedef private_moving_statistics::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size; ///< The number of samples in the window.
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    moving_max()
+    {
+    }
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+  };
+
+  template <typename T, const size_t Window_Size, typename TCompare>
+  ETL_CONSTANT size_t moving_max<T, Window_Size, TCompare>::WINDOW_SIZE;
+
+  //***************************************************************************
+  /// Moving Variance
+  /// The variance of the last Window_Size samples.
+  /// Uses a sliding window form of Welford's algorithm. The mean and sum of
+  /// squared differences are recalculated from the window every Window_Size
+  /// samples, so that rounding errors do not build up.
+  /// \tparam Variance_Type etl::variance_type::Population or etl::variance_type::Sample.
+  /// \tparam T             The sample value type.
+  /// \tparam Window_Size   The number of samples in the window.
+  /// \tparam TCalc         The floating point calculation type.
+  //***************************************************************************
+  template <bool Variance_Type, typename T, const size_t Window_Size, typename TCalc = typename private_moving_statistics::variance_calc_type<T>::type>
+  class moving_variance
+  {
+  private:
+
+    ETL_STATIC_ASSERT(Window_Size > 0U, "Window size must be at least 1");
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    typedef moving_variance<Variance_Type, T, Window_Size, TCalc> this_t;
+
+    static ETL_CONSTANT size_t Adjustment = (Variance_Type == variance_type::Population) ? 0U : 1U;
+
+  public:
+
+    typedef T     value_type;
+    typedef TCalc calc_t;
+    typedef private_moving_statistics::add_insert_iterator<this_t> add_insert_iterator;
+
+    static ETL_CONSTANT size_t WINDOW_SIZE = Window_Size; ///< The number of samples in the window.
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    moving_variance()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a new sample, dropping the oldest if the window is full.
+    /// \param new_value The value to add.
+    //*************************************************************************
+    void add(T new_value)
+    {
+      const calc_t x = calc_t(new_value);
+
+      if (samples.full())
+      {
+        const calc_t oldest   = calc_t(samples.front());
+        const calc_t old_mean = mean_value;
+        const calc_t delta    = x - oldest;
+
+        samples.pop();
+        samples.push_back(new_value);
+
+        mean_value += delta / calc_t(Window_Size);
+        m2         += delta * ((x - mean_value) + (oldest - old_mean));
+
+        // Guard against rounding taking it below zero.
+        if (m2 < calc_t(0))
+        {
+          m2 = calc_t(0);
+        }
+      }
+      else
+      {
+        samples.push_back(new_value);
+
+        const calc_t delta = x - mean_value;
+        mean_value += delta / calc_t(samples.size());
+        m2         += delta * (x - mean_value);
+      }
+
+      if (++since_resum == Window_Size)
+      {
+        resum();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the variance of the window.
+    /// \return The variance, or zero if there are not enough samples.
+    //*************************************************************************
+    double get_variance() const
+    {
+      if (samples.size() > Adjustment)
+      {
+        return double(m2 / calc_t(samples.size() - Adjustment));
+      }
+
+      return 0.0;
+    }
+
+    //*************************************************************************
+    /// Gets the standard deviation of the window.
+    //*************************************************************************
+    double get_standard_deviation() const
+    {
+      return sqrt(get_variance());
+    }
+
+    //*************************************************************************
+    /// Gets the mean of the window.
+    //*************************************************************************
+    double get_mean() const
+    {
+      return double(mean_value);
+    }
+
+    //*************************************************************************
+    /// Gets the variance of the window.
+    //*************************************************************************
+    operator double() const
+    {
+      return get_variance();
+    }
+
+    //*************************************************************************
+    /// Clears the window.
+    //*************************************************************************
+    void clear()
+    {
+      samples.clear();
+      mean_value  = calc_t(0);
+      m2          = calc_t(0);
+      since_resum = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of samples in the window.
+    //*************************************************************************
+    size_t size() const
+    {
+      return samples.size();
+    }
+
+    //*************************************************************************
+    /// Returns true if no samples have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return samples.empty();
+    }
+
+    //*************************************************************************
+    /// Returns true if the window is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return samples.full();
+    }
+
+    //*************************************************************************
+    /// Gets an iterator for input.
+    /// \return An iterator.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Recalculates the mean and sum of squared differences from the window.
+    //*************************************************************************
+    void resum()
+    {
+      typedef typename etl::circular_buffer<T, Window_Size>::const_iterator iterator_t;
+
+      calc_t sum = calc_t(0);
+
+      for (iterator_t itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        sum += calc_t(*itr);
+      }
+
+      mean_value = sum / calc_t(samples.size());
+      m2         = calc_t(0);
+
+      for (iterator_t itr = samples.begin(); itr != samples.end(); ++itr)
+      {
+        const calc_t delta = calc_t(*itr) - mean_value;
+        m2 += delta * delta;
+      }
+
+      since_resum = 0U;
+    }
+
+    etl::circular_buffer<T, Window_Size> samples;
+    calc_t mean_value;
+    calc_t m2;
+    size_t since_resum;
+  };
+
+  template <bool Variance_Type, typename T, const size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t moving_variance<Variance_Type, T, Window_Size, TCalc>::Adjustment;
+
+  template <bool Variance_Type, typename T, const size_t Window_Size, typename TCalc>
+  ETL_CONSTANT size_t moving_variance<Variance_Type, T, Window_Size, TCalc>::WINDOW_SIZE;
+}
+
+#endif
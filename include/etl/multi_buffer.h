@@ -0,0 +1,438 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MULTI_BUFFER_INCLUDED
+#define ETL_MULTI_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "memory.h"
+#include "span.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the multi_buffer.
+  //***************************************************************************
+  class multi_buffer_exception : public etl::exception
+  {
+  public:
+
+    multi_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Raised when the application acquires a second buffer, or releases when
+  /// it holds none.
+  //***************************************************************************
+  class multi_buffer_not_acquired : public etl::multi_buffer_exception
+  {
+  public:
+
+    multi_buffer_not_acquired(string_type file_name_, numeric_type line_number_)
+      : etl::multi_buffer_exception(ETL_ERROR_TEXT("multi_buffer:acquire", ETL_MULTI_BUFFER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The default cache maintenance for the multi_buffer, which does nothing.
+  /// For a data cache that is not coherent with DMA, such as on the Cortex-M7,
+  /// supply a type with the same members, where
+  /// before_fill cleans and invalidates the buffer, for example with
+  /// SCB_CleanInvalidateDCache_by_Addr, so that no dirty line is written back
+  /// over the DMA data, and before_process invalidates it, for example with
+  /// SCB_InvalidateDCache_by_Addr, so that the CPU reads what the DMA wrote.
+  /// Line_Size is the cache line size, which aligns and pads each buffer so
+  /// that maintenance never touches a neighbour.
+  //***************************************************************************
+  struct multi_buffer_no_cache
+  {
+    static ETL_CONSTANT size_t Line_Size = 1U;
+
+    static void before_fill(void*, size_t)
+    {
+    }
+
+    static void before_process(void*, size_t)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A set of buffers shared by a producer, usually a DMA transfer and its
+  /// interrupt, and the application that processes what it produces.
+  /// Two buffers give ping-pong buffering, three give triple buffering.
+  ///
+  /// The producer fills one buffer at a time. When it is full, fill_complete
+  /// queues it for processing and returns the next buffer to fill. The
+  /// application acquires the oldest full buffer, processes it in place and
+  /// releases it. Buffers change hands with atomic operations and the data
+  /// is never copied.
+  ///
+  /// The producer never waits. If no buffer is free when a fill completes,
+  /// the oldest full buffer that the application has not acquired is
+  /// filled again, and counted as an overrun.
+  ///\tparam T      The element type.
+  ///\tparam VSize  The number of elements in each buffer.
+  ///\tparam VCount The number of buffers. At least 2.
+  ///\tparam TCache The cache maintenance. Default etl::multi_buffer_no_cache.
+  //***************************************************************************
+  template <typename T, size_t VSize, size_t VCount = 2U, typename TCache = etl::multi_buffer_no_cache>
+  class multi_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "multi_buffer buffers must not be empty");
+    ETL_STATIC_ASSERT(VCount >= 2U, "multi_buffer needs at least two buffers");
+    ETL_STATIC_ASSERT(VCount < 256U, "multi_buffer supports up to 255 buffers");
+
+    typedef T            value_type;
+    typedef etl::span<T> span_type;
+
+    static ETL_CONSTANT size_t Size  = VSize;
+    static ETL_CONSTANT size_t Count = VCount;
+
+    //*************************************************************************
+    /// Constructor.
+    /// The buffers are zeroed and the first is prepared for filling.
+    //*************************************************************************
+    multi_buffer()
+      : fill_index(0U)
+      , process_index(No_Buffer)
+      , commit_sequence(0U)
+      , overrun_count(0U)
+    {
+      memset(storage.raw, 0, sizeof(storage.raw));
+
+      states[0].store(Filling, etl::memory_order_relaxed);
+
+      for (size_t i = 1U; i < VCount; ++i)
+      {
+        states[i].store(Free, etl::memory_order_relaxed);
+      }
+
+      TCache::before_fill(buffer(0U), Stride);
+    }
+
+    //*************************************************************************
+    /// Gets the buffer being filled.
+    /// Producer only.
+    //*************************************************************************
+    span_type fill_span()
+    {
+      return span_type(buffer(fill_index), VSize);
+    }
+
+    //*************************************************************************
+    /// Queues the buffer being filled for processing.
+    /// Producer only.
+    ///\return The next buffer to fill.
+    //*************************************************************************
+    span_type fill_complete()
+    {
+      const uint32_t sequence = commit_sequence.load(etl::memory_order_relaxed) + 1U;
+
+      states[fill_index].store(make_state(Ready, sequence), etl::memory_order_release);
+      commit_sequence.store(sequence, etl::memory_order_release);
+
+      fill_index = claim_fill_buffer();
+
+      TCache::before_fill(buffer(fill_index), Stride);
+
+      return fill_span();
+    }
+
+    //*************************************************************************
+    /// Acquires the oldest full buffer for processing.
+    /// Only one buffer may be held at a time.
+    /// Application only.
+    ///\return The buffer, or an empty span if no buffer is full.
+    //*************************************************************************
+    span_type acquire()
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(process_index == No_Buffer, ETL_ERROR(multi_buffer_not_acquired), span_type());
+
+      for (;;)
+      {
+        // Every buffer committed up to this sequence is visible, so the oldest of
+        // them is the oldest of all. Any committed later are left for next time.
+        const uint32_t limit = commit_sequence.load(etl::memory_order_acquire);
+
+        state_type   expected;
+        const size_t index = find_oldest_ready(expected, limit);
+
+        if (index == No_Buffer)
+        {
+          return span_type();
+        }
+
+        // The producer may take this buffer back first, so look again if it does.
+        // The state includes the sequence, so a buffer that has been refilled is not mistaken for the oldest.
+        if (states[index].compare_exchange_strong(expected, Processing, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          process_index = index;
+          TCache::before_process(buffer(index), Stride);
+
+          return span_type(buffer(index), VSize);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Releases the buffer being processed, so that it can be filled again.
+    /// Application only.
+    //*************************************************************************
+    void release()
+    {
+      ETL_ASSERT_OR_RETURN(process_index != No_Buffer, ETL_ERROR(multi_buffer_not_acquired));
+
+      states[process_index].store(Free, etl::memory_order_release);
+      process_index = No_Buffer;
+    }
+
+    //*************************************************************************
+    /// Checks if the application holds a buffer.
+    /// Application only.
+    //*************************************************************************
+    bool is_acquired() const
+    {
+      return process_index != No_Buffer;
+    }
+
+    //*************************************************************************
+    /// Gets the number of full buffers waiting to be processed.
+    //*************************************************************************
+    size_t ready_count() const
+    {
+      size_t count = 0U;
+
+      for (size_t i = 0U; i < VCount; ++i)
+      {
+        if (kind_of(states[i].load(etl::memory_order_acquire)) == Ready)
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Gets the number of full buffers that were filled again before being processed.
+    //*************************************************************************
+    uint32_t overruns() const
+    {
+      return overrun_count.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Clears the overrun count.
+    //*************************************************************************
+    void clear_overruns()
+    {
+      overrun_count.store(0U, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    enum
+    {
+      Free,
+      Filling,
+      Ready,
+      Processing
+    };
+
+    // The state of a buffer is its kind in the low bits and, when ready, its
+    // sequence in the high bits.
+    typedef uint32_t state_type;
+
+    static ETL_CONSTANT state_type Kind_Bits     = 2U;
+    static ETL_CONSTANT state_type Kind_Mask     = (1U << Kind_Bits) - 1U;
+    static ETL_CONSTANT state_type Sequence_Mask = 0xFFFFFFFFUL >> Kind_Bits;
+    static ETL_CONSTANT state_type Sequence_Half = 1UL << (31U - Kind_Bits);
+
+    static ETL_CONSTANT size_t No_Buffer = VCount;
+    static ETL_CONSTANT size_t Alignment = (TCache::Line_Size > etl::alignment_of<T>::value) ? TCache::Line_Size : etl::alignment_of<T>::value;
+    static ETL_CONSTANT size_t Stride    = (((VSize * sizeof(T)) + Alignment - 1U) / Alignment) * Alignment;
+
+    //*************************************************************************
+    /// Gets a buffer.
+    //*************************************************************************
+    T* buffer(size_t index)
+    {
+      return reinterpret_cast<T*>(storage.raw + (index * Stride));
+    }
+
+    //*************************************************************************
+    /// Checks if sequence a is before sequence b.
+    //*************************************************************************
+    static bool is_before(uint32_t a, uint32_t b)
+    {
+      return ((a - b) & Sequence_Mask) >= Sequence_Half;
+    }
+
+    //*************************************************************************
+    /// Makes a state from a kind and a sequence.
+    //*************************************************************************
+    static state_type make_state(state_type kind, uint32_t sequence)
+    {
+      return (sequence << Kind_Bits) | kind;
+    }
+
+    //*************************************************************************
+    /// Gets the kind of a state.
+    //*************************************************************************
+    static state_type kind_of(state_type state)
+    {
+      return state & Kind_Mask;
+    }
+
+    //*************************************************************************
+    /// Finds the ready buffer that was completed first, ignoring any completed
+    /// after the limit.
+    ///\param oldest_state Receives the state of the buffer found.
+    //*************************************************************************
+    size_t find_oldest_ready(state_type& oldest_state, uint32_t limit) const
+    {
+      size_t oldest = No_Buffer;
+
+      oldest_state = 0U;
+
+      for (size_t i = 0U; i < VCount; ++i)
+      {
+        const state_type state = states[i].load(etl::memory_order_acquire);
+
+        // Compare by difference, so that the sequence may wrap.
+        if ((kind_of(state) == Ready) && !is_before(limit, state >> Kind_Bits))
+        {
+          if ((oldest == No_Buffer) || is_before(state >> Kind_Bits, oldest_state >> Kind_Bits))
+          {
+            oldest       = i;
+            oldest_state = state;
+          }
+        }
+      }
+
+      return oldest;
+    }
+
+    //*************************************************************************
+    /// Claims the next buffer to fill.
+    /// A free buffer if there is one, otherwise the oldest ready buffer.
+    //*************************************************************************
+    size_t claim_fill_buffer()
+    {
+      for (;;)
+      {
+        // Only the producer takes free buffers, so no exchange is needed.
+        for (size_t i = 0U; i < VCount; ++i)
+        {
+          if (kind_of(states[i].load(etl::memory_order_acquire)) == Free)
+          {
+            states[i].store(Filling, etl::memory_order_relaxed);
+
+            return i;
+          }
+        }
+
+        state_type   expected;
+        const size_t index = find_oldest_ready(expected, commit_sequence.load(etl::memory_order_relaxed));
+
+        if (index != No_Buffer)
+        {
+          // The application may acquire this buffer first, so look again if it does.
+          if (states[index].compare_exchange_strong(expected, Filling, etl::memory_order_acquire, etl::memory_order_relaxed))
+          {
+            overrun_count.fetch_add(1U, etl::memory_order_relaxed);
+
+            return index;
+          }
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    multi_buffer(const multi_buffer&) ETL_DELETE;
+    multi_buffer& operator =(const multi_buffer&) ETL_DELETE;
+
+    etl::uninitialized_buffer<Stride, VCount, Alignment> storage;
+    etl::atomic<state_type>                              states[VCount];
+    size_t                                               fill_index;      ///< Producer only.
+    size_t                                               process_index;   ///< Application only.
+    etl::atomic<uint32_t>                                commit_sequence;
+    etl::atomic<uint32_t>                                overrun_count;
+  };
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT size_t multi_buffer<T, VSize, VCount, TCache>::Size;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT size_t multi_buffer<T, VSize, VCount, TCache>::Count;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT typename multi_buffer<T, VSize, VCount, TCache>::state_type multi_buffer<T, VSize, VCount, TCache>::Kind_Bits;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT typename multi_buffer<T, VSize, VCount, TCache>::state_type multi_buffer<T, VSize, VCount, TCache>::Kind_Mask;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT typename multi_buffer<T, VSize, VCount, TCache>::state_type multi_buffer<T, VSize, VCount, TCache>::Sequence_Mask;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT typename multi_buffer<T, VSize, VCount, TCache>::state_type multi_buffer<T, VSize, VCount, TCache>::Sequence_Half;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT size_t multi_buffer<T, VSize, VCount, TCache>::No_Buffer;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT size_t multi_buffer<T, VSize, VCount, TCache>::Alignment;
+
+  template <typename T, size_t VSize, size_t VCount, typename TCache>
+  ETL_CONSTANT size_t multi_buffer<T, VSize, VCount, TCache>::Stride;
+}
+
+#endif
+#endif
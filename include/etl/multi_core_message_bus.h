@@ -0,0 +1,372 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MULTI_CORE_MESSAGE_BUS_INCLUDED
+#define ETL_MULTI_CORE_MESSAGE_BUS_INCLUDED
+
+#include "platform.h"
+#include "message.h"
+#include "message_types.h"
+#include "message_router.h"
+#include "message_bus.h"
+#include "shared_message.h"
+#include "queue_spsc_atomic.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "algorithm.h"
+#include "vector.h"
+#include "span.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC && ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// A message bus for several cores, each with its own subscribers.
+  /// Routers are subscribed to the core that they run on. A shared message
+  /// sent from a core is received immediately by that core's routers, and is
+  /// forwarded to the inbox of each other core that has a router accepting it.
+  /// Each core calls process() to pass the messages in its inboxes to its
+  /// routers, a batch at a time.
+  ///
+  /// Every pair of cores has one lock free single producer, single consumer
+  /// inbox, so no core waits for another.
+  /// Once delivered, a forwarded message is handed back to the core that sent
+  /// it, and is destroyed there by that core's next call to process(). The
+  /// message therefore is always released to its pool on the core that
+  /// allocated it, so each core may use its own pool without a lock.
+  /// The reference count is still changed on the receiving core while the
+  /// message is being delivered, so the pool must use an atomic counter, as
+  /// etl::atomic_counted_message_pool does.
+  /// A router that keeps a copy of a forwarded message moves the release to
+  /// its own core, and then the pool must also be thread safe.
+  ///
+  /// Routers must be subscribed and unsubscribed before the cores start
+  /// sending, as the subscriptions are read by every core.
+  ///\tparam VCores            The number of cores.
+  ///\tparam VRouters_Per_Core The maximum number of routers on each core.
+  ///\tparam VInbox_Size       The number of messages each inbox can hold.
+  ///\tparam VIndexed_Ids      The number of indexed message ids of each core's etl::message_bus.
+  //***************************************************************************
+  template <size_t VCores, uint_least8_t VRouters_Per_Core, size_t VInbox_Size, size_t VIndexed_Ids = 0U>
+  class multi_core_message_bus
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VCores > 0U, "There must be at least one core");
+    ETL_STATIC_ASSERT(VInbox_Size > 0U, "Inboxes must hold at least one message");
+
+    typedef etl::message_bus<VRouters_Per_Core, VIndexed_Ids> core_bus_type;
+    typedef size_t                                            size_type;
+
+    static ETL_CONSTANT size_t Cores      = VCores;
+    static ETL_CONSTANT size_t Inbox_Size = VInbox_Size;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    multi_core_message_bus()
+    {
+      for (size_t i = 0U; i < VCores; ++i)
+      {
+        drops[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*******************************************
+    /// Subscribes a router to a core.
+    /// Returns false if the core does not exist, or already has
+    /// VRouters_Per_Core routers.
+    //*******************************************
+    bool subscribe(size_t core, etl::imessage_router& router)
+    {
+      if ((core >= VCores) || !buses[core].subscribe(router))
+      {
+        return false;
+      }
+
+      routers[core].push_back(&router);
+
+      return true;
+    }
+
+    //*******************************************
+    /// Unsubscribes a router from a core.
+    //*******************************************
+    void unsubscribe(size_t core, etl::imessage_router& router)
+    {
+      if (core < VCores)
+      {
+        buses[core].unsubscribe(router);
+
+        typename router_list_t::iterator itr = etl::find(routers[core].begin(), routers[core].end(), &router);
+
+        if (itr != routers[core].end())
+        {
+          routers[core].erase(itr);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Gets the number of routers subscribed to a core.
+    //*******************************************
+    size_t size(size_t core) const
+    {
+      return routers[core].size();
+    }
+
+    //*******************************************
+    /// Checks if any router on the core accepts the message id.
+    //*******************************************
+    bool accepts(size_t core, etl::message_id_t id) const
+    {
+      if (core < VCores)
+      {
+        for (typename router_list_t::const_iterator itr = routers[core].begin(); itr != routers[core].end(); ++itr)
+        {
+          if ((*itr)->accepts(id))
+          {
+            return true;
+          }
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sends a shared message from a core.
+    /// The core's own routers receive it before this returns. Each other core
+    /// with an accepting router is sent a copy through its inbox.
+    /// Must only be called on the source core.
+    /// Returns false if the message is not valid, or if any inbox was full, in
+    /// which case that core does not receive the message and the drop is counted.
+    //*******************************************
+    bool send(size_t source_core, etl::shared_message shared_msg)
+    {
+      if (!shared_msg.is_valid())
+      {
+        return false;
+      }
+
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+
+      bool all_sent = true;
+
+      // Forward before delivering locally, so the remote cores can
+      // start work while the local routers run.
+      for (size_t destination = 0U; destination < VCores; ++destination)
+      {
+        if ((destination != source_core) && accepts(destination, id))
+        {
+          if (!inbox(source_core, destination).push(shared_msg))
+          {
+            drops[source_core].fetch_add(1U, etl::memory_order_relaxed);
+            all_sent = false;
+          }
+        }
+      }
+
+      buses[source_core].receive(shared_msg);
+
+      return all_sent;
+    }
+
+    //*******************************************
+    /// Sends a message that is not shared from a core.
+    /// A message without a reference count cannot safely outlive the call, so
+    /// it is only received by the core's own routers.
+    //*******************************************
+    void send(size_t source_core, const etl::imessage& message)
+    {
+      buses[source_core].receive(message);
+    }
+
+    //*******************************************
+    /// Processes the messages for a core.
+    /// Destroys the messages that other cores have finished with, then passes
+    /// up to max_messages from the core's inboxes to its routers.
+    /// Must only be called on the core.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_t process(size_t core, size_t max_messages = etl::integral_limits<size_t>::max)
+    {
+      release_returned(core);
+
+      size_t count = 0U;
+
+      for (size_t source = 0U; (source < VCores) && (count < max_messages); ++source)
+      {
+        if (source != core)
+        {
+          count += process_inbox(source, core, max_messages - count);
+        }
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Gets the number of messages waiting in a core's inboxes.
+    /// Only approximate while other cores are sending.
+    //*******************************************
+    size_t pending(size_t core) const
+    {
+      size_t count = 0U;
+
+      for (size_t source = 0U; source < VCores; ++source)
+      {
+        count += inboxes[source][core].size();
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Gets the number of messages that a core could not forward.
+    //*******************************************
+    size_t drop_count(size_t core) const
+    {
+      return drops[core].load(etl::memory_order_relaxed);
+    }
+
+    //*******************************************
+    /// Clears the drop count of a core.
+    //*******************************************
+    void reset_statistics(size_t core)
+    {
+      drops[core].store(0U, etl::memory_order_relaxed);
+    }
+
+  private:
+
+    typedef etl::queue_spsc_atomic<etl::shared_message, VInbox_Size> queue_type;
+    typedef etl::vector<etl::imessage_router*, VRouters_Per_Core>    router_list_t;
+
+    //*******************************************
+    /// The inbox from one core to another.
+    //*******************************************
+    queue_type& inbox(size_t source, size_t destination)
+    {
+      return inboxes[source][destination];
+    }
+
+    //*******************************************
+    /// The queue that hands a delivered message back to the core that sent it.
+    //*******************************************
+    queue_type& returns(size_t source, size_t destination)
+    {
+      return returned[source][destination];
+    }
+
+    //*******************************************
+    /// Destroys the messages that were sent by the core and have been delivered.
+    //*******************************************
+    void release_returned(size_t core)
+    {
+      for (size_t destination = 0U; destination < VCores; ++destination)
+      {
+        if (destination != core)
+        {
+          queue_type& queue = returns(core, destination);
+
+          etl::span<etl::shared_message> batch = queue.front_span();
+
+          while (!batch.empty())
+          {
+            queue.commit_pop(batch.size());
+            batch = queue.front_span();
+          }
+        }
+      }
+    }
+
+    //*******************************************
+    /// Delivers a batch of messages from one inbox.
+    /// Stops when the queue back to the sender is full, so the messages
+    /// stay in the inbox until the sender has called process().
+    //*******************************************
+    size_t process_inbox(size_t source, size_t destination, size_t max_messages)
+    {
+      queue_type& queue        = inbox(source, destination);
+      queue_type& return_queue = returns(source, destination);
+
+      size_t count = 0U;
+
+      etl::span<etl::shared_message> batch = queue.front_span();
+
+      while (!batch.empty() && (count < max_messages))
+      {
+        const size_t space = return_queue.available();
+
+        size_t n = etl::min(batch.size(), etl::min(space, max_messages - count));
+
+        if (n == 0U)
+        {
+          break;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          buses[destination].receive(batch[i]);
+          return_queue.push(etl::move(batch[i]));
+        }
+
+        queue.commit_pop(n);
+        count += n;
+
+        batch = queue.front_span();
+      }
+
+      return count;
+    }
+
+    core_bus_type       buses[VCores];
+    router_list_t       routers[VCores];
+    queue_type          inboxes[VCores][VCores];
+    queue_type          returned[VCores][VCores];
+    etl::atomic<size_t> drops[VCores];
+  };
+
+  template <size_t VCores, uint_least8_t VRouters_Per_Core, size_t VInbox_Size, size_t VIndexed_Ids>
+  ETL_CONSTANT size_t multi_core_message_bus<VCores, VRouters_Per_Core, VInbox_Size, VIndexed_Ids>::Cores;
+
+  template <size_t VCores, uint_least8_t VRouters_Per_Core, size_t VInbox_Size, size_t VIndexed_Ids>
+  ETL_CONSTANT size_t multi_core_message_bus<VCores, VRouters_Per_Core, VInbox_Size, VIndexed_Ids>::Inbox_Size;
+}
+
+#endif
+#endif
@@ -0,0 +1,436 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MULTI_PATTERN_MATCHER_INCLUDED
+#define ETL_MULTI_PATTERN_MATCHER_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "smallest.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+/// Finds every occurrence of a set of patterns in one pass over the text,
+/// using the Aho-Corasick algorithm.
+//*****************************************************************************
+namespace etl
+{
+  //***************************************************************************
+  /// A match found by etl::multi_pattern_matcher.
+  //***************************************************************************
+  struct pattern_match
+  {
+    size_t pattern;  ///< The index of the pattern, in the order they were added.
+    size_t position; ///< The offset of the start of the match in the text.
+    size_t length;   ///< The length of the pattern.
+  };
+
+  //***************************************************************************
+  /// A fixed capacity Aho-Corasick automaton.
+  /// Add the patterns, call build(), then scan texts. The text is read once,
+  /// whatever the number of patterns.
+  /// The automaton is the trie of the patterns, with each state's children
+  /// held as a list of siblings, plus a failure link and a link to the next
+  /// state on the failure chain that ends a pattern. Each state costs six
+  /// small integers, so the memory does not depend on the size of the alphabet.
+  /// In C++14 and later the automaton may be built at compile time, by
+  /// make_multi_pattern_matcher() or a constexpr function.
+  ///\tparam VMax_States   The maximum number of states: one, plus one for
+  ///                      each character of the patterns that is not a
+  ///                      prefix shared with an earlier pattern.
+  ///\tparam VMax_Patterns The maximum number of patterns.
+  //***************************************************************************
+  template <size_t VMax_States, size_t VMax_Patterns = VMax_States - 1U>
+  class multi_pattern_matcher
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_States > 1U, "There must be at least two states");
+    ETL_STATIC_ASSERT(VMax_Patterns > 0U, "There must be at least one pattern");
+
+    typedef typename etl::smallest_uint_for_value<VMax_States - 1U>::type state_type;
+    typedef typename etl::smallest_uint_for_value<VMax_Patterns>::type    pattern_type;
+
+    static ETL_CONSTANT size_t Max_States   = VMax_States;
+    static ETL_CONSTANT size_t Max_Patterns = VMax_Patterns;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR14 multi_pattern_matcher()
+      : label()
+      , first_child()
+      , next_sibling()
+      , fail()
+      , next_output()
+      , pattern_end()
+      , lengths()
+      , n_states(1U)
+      , n_patterns(0U)
+      , built(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds a pattern. The automaton must be built again before it is used.
+    /// Returns false if the pattern is empty, has already been added, or
+    /// there is not enough room for it.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool add(const etl::string_view& pattern)
+    {
+      if (pattern.empty() || (n_patterns == VMax_Patterns))
+      {
+        return false;
+      }
+
+      // Follow the prefix that is already in the trie.
+      size_t     i     = 0U;
+      state_type state = Root;
+
+      while (i < pattern.size())
+      {
+        const state_type next = child(state, to_label(pattern[i]));
+
+        if (next == Root)
+        {
+          break;
+        }
+
+        state = next;
+        ++i;
+      }
+
+      if ((i == pattern.size()) && (pattern_end[state] != 0U))
+      {
+        return false;
+      }
+
+      if ((pattern.size() - i) > (VMax_States - n_states))
+      {
+        return false;
+      }
+
+      for (; i < pattern.size(); ++i)
+      {
+        const state_type next = static_cast<state_type>(n_states);
+
+        ++n_states;
+
+        label[next]        = to_label(pattern[i]);
+        next_sibling[next] = first_child[state];
+        first_child[state] = next;
+
+        state = next;
+      }
+
+      lengths[n_patterns] = pattern.size();
+      ++n_patterns;
+
+      pattern_end[state] = static_cast<pattern_type>(n_patterns);
+      built = false;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Calculates the failure and output links.
+    /// Must be called after the patterns have been added, before scanning.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void build()
+    {
+      // A breadth first walk, so each state's failure link is to a state
+      // that has already been done.
+      state_type queue[VMax_States] = {};
+      size_t     head = 0U;
+      size_t     tail = 0U;
+
+      for (state_type s = first_child[Root]; s != Root; s = next_sibling[s])
+      {
+        fail[s]        = Root;
+        next_output[s] = Root;
+        queue[tail++]  = s;
+      }
+
+      while (head != tail)
+      {
+        const state_type parent = queue[head++];
+
+        for (state_type s = first_child[parent]; s != Root; s = next_sibling[s])
+        {
+          state_type f = fail[parent];
+
+          while ((f != Root) && (child(f, label[s]) == Root))
+          {
+            f = fail[f];
+          }
+
+          f = child(f, label[s]);
+
+          fail[s]        = f;
+          next_output[s] = (pattern_end[f] != 0U) ? f : next_output[f];
+          queue[tail++]  = s;
+        }
+      }
+
+      built = true;
+    }
+
+    //*************************************************************************
+    /// Scans the text, calling callback(const etl::pattern_match&) for each
+    /// match, in the order that the matches end. Of the matches that end at
+    /// the same place, the longest is first.
+    /// Returns the number of matches.
+    //*************************************************************************
+    template <typename TCallback>
+    ETL_CONSTEXPR14 size_t scan(const etl::string_view& text, TCallback callback) const
+    {
+      size_t count = 0U;
+
+      state_type state = Root;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        state = step(state, to_label(text[i]));
+
+        for (state_type out = (pattern_end[state] != 0U) ? state : next_output[state]; out != Root; out = next_output[out])
+        {
+          const size_t index = size_t(pattern_end[out]) - 1U;
+
+          const etl::pattern_match match = { index, (i + 1U) - lengths[index], lengths[index] };
+
+          callback(match);
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Writes each match to 'out', in the order given by scan().
+    /// Returns the output iterator.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    ETL_CONSTEXPR14 TOutputIterator find_all(const etl::string_view& text, TOutputIterator out) const
+    {
+      state_type state = Root;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        state = step(state, to_label(text[i]));
+
+        for (state_type s = (pattern_end[state] != 0U) ? state : next_output[state]; s != Root; s = next_output[s])
+        {
+          const size_t index = size_t(pattern_end[s]) - 1U;
+
+          const etl::pattern_match match = { index, (i + 1U) - lengths[index], lengths[index] };
+
+          *out = match;
+          ++out;
+        }
+      }
+
+      return out;
+    }
+
+    //*************************************************************************
+    /// Finds the first match to end in the text.
+    /// Returns false if there is none.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool find_first(const etl::string_view& text, etl::pattern_match& match) const
+    {
+      state_type state = Root;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        state = step(state, to_label(text[i]));
+
+        const state_type s = (pattern_end[state] != 0U) ? state : next_output[state];
+
+        if (s != Root)
+        {
+          const size_t index = size_t(pattern_end[s]) - 1U;
+
+          match.pattern  = index;
+          match.position = (i + 1U) - lengths[index];
+          match.length   = lengths[index];
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Checks if any pattern is in the text.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool contains_any(const etl::string_view& text) const
+    {
+      etl::pattern_match match = { 0U, 0U, 0U };
+
+      return find_first(text, match);
+    }
+
+    //*************************************************************************
+    /// Removes all of the patterns.
+    //*************************************************************************
+    ETL_CONSTEXPR14 void clear()
+    {
+      for (size_t i = 0U; i < VMax_States; ++i)
+      {
+        first_child[i] = Root;
+        pattern_end[i] = 0U;
+      }
+
+      n_states   = 1U;
+      n_patterns = 0U;
+      built      = false;
+    }
+
+    //*************************************************************************
+    /// Checks if build() has been called since the last pattern was added.
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool is_built() const
+    {
+      return built;
+    }
+
+    //*************************************************************************
+    /// The number of patterns.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t pattern_count() const
+    {
+      return n_patterns;
+    }
+
+    //*************************************************************************
+    /// The length of a pattern.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t pattern_length(size_t pattern) const
+    {
+      return lengths[pattern];
+    }
+
+    //*************************************************************************
+    /// The number of states in use.
+    //*************************************************************************
+    ETL_CONSTEXPR14 size_t state_count() const
+    {
+      return n_states;
+    }
+
+  private:
+
+    // The root is never a child or a pattern end, so it also means 'none'.
+    static ETL_CONSTANT state_type Root = 0U;
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 unsigned char to_label(char c)
+    {
+      return static_cast<unsigned char>(c);
+    }
+
+    //*************************************************************************
+    /// Gets the child of a state with the label, or Root if there is none.
+    //*************************************************************************
+    ETL_CONSTEXPR14 state_type child(state_type state, unsigned char c) const
+    {
+      state_type s = first_child[state];
+
+      while ((s != Root) && (label[s] != c))
+      {
+        s = next_sibling[s];
+      }
+
+      return s;
+    }
+
+    //*************************************************************************
+    /// Moves from a state on a character, following failure links as needed.
+    //*************************************************************************
+    ETL_CONSTEXPR14 state_type step(state_type state, unsigned char c) const
+    {
+      state_type next = child(state, c);
+
+      while ((next == Root) && (state != Root))
+      {
+        state = fail[state];
+        next  = child(state, c);
+      }
+
+      return next;
+    }
+
+    unsigned char label[VMax_States];
+    state_type    first_child[VMax_States];
+    state_type    next_sibling[VMax_States];
+    state_type    fail[VMax_States];
+    state_type    next_output[VMax_States];
+    pattern_type  pattern_end[VMax_States]; ///< The pattern index plus one, or zero.
+    size_t        lengths[VMax_Patterns];
+    size_t        n_states;
+    size_t        n_patterns;
+    bool          built;
+  };
+
+  template <size_t VMax_States, size_t VMax_Patterns>
+  ETL_CONSTANT size_t multi_pattern_matcher<VMax_States, VMax_Patterns>::Max_States;
+
+  template <size_t VMax_States, size_t VMax_Patterns>
+  ETL_CONSTANT size_t multi_pattern_matcher<VMax_States, VMax_Patterns>::Max_Patterns;
+
+  template <size_t VMax_States, size_t VMax_Patterns>
+  ETL_CONSTANT typename multi_pattern_matcher<VMax_States, VMax_Patterns>::state_type multi_pattern_matcher<VMax_States, VMax_Patterns>::Root;
+
+#if ETL_USING_CPP14
+  //***************************************************************************
+  /// Makes a built matcher from the patterns.
+  /// May be used to build the automaton at compile time.
+  //***************************************************************************
+  template <size_t VMax_States, size_t VMax_Patterns = VMax_States - 1U, typename... TPatterns>
+  constexpr etl::multi_pattern_matcher<VMax_States, VMax_Patterns> make_multi_pattern_matcher(const TPatterns&... patterns)
+  {
+    etl::multi_pattern_matcher<VMax_States, VMax_Patterns> matcher;
+
+    const bool added[] = { true, matcher.add(etl::string_view(patterns))... };
+    (void)added;
+
+    matcher.build();
+
+    return matcher;
+  }
+#endif
+}
+
+#endif
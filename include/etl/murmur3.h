@@ -35,6 +35,8 @@ SOFTWARE.
 #include "ihash.h"
 #include "binary.h"
 #include "error_handler.h"
+#include "type_traits.h"
+#include "iterator.h"
 
 #include <stdint.h>
 
@@ -88,20 +90,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -127,20 +116,8 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin) << (block_fill_count * 8U);
-        ++begin;
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      // Contiguous ranges are read a whole block at a time.
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
     }
 
     //*************************************************************************
@@ -153,16 +130,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8U);
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block = 0;
-      }
-
-      ++char_count;
+      add_byte(value_);
     }
 
     //*************************************************************************
@@ -184,6 +152,66 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8U);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block();
+        block_fill_count = 0;
+        block = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      // Complete any partly filled block.
+      while ((block_fill_count != 0U) && (begin != end))
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+
+      while (size_t(end - begin) >= FULL_BLOCK)
+      {
+        // Little endian, whatever the alignment or the byte order of the target.
+        block = value_type(uint8_t(begin[0]))         |
+                (value_type(uint8_t(begin[1])) << 8U)  |
+                (value_type(uint8_t(begin[2])) << 16U) |
+                (value_type(uint8_t(begin[3])) << 24U);
+
+        add_block();
+        block       = 0;
+        begin      += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
@@ -236,6 +264,302 @@ namespace etl
     static ETL_CONSTANT value_type MULTIPLY   = 5;
     static ETL_CONSTANT value_type ADD        = 0xE6546B64UL;
   };
+
+#if ETL_USING_64BIT_TYPES
+  //***************************************************************************
+  /// Calculates the 128 bit murmur3 hash, optimised for 64 bit targets.
+  /// This is MurmurHash3_x64_128 from the reference implementation.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    //*************************************************************************
+    /// The 128 bit hash, as the two 64 bit halves in the order of the reference output.
+    //*************************************************************************
+    struct value_type
+    {
+      friend bool operator ==(const value_type& lhs, const value_type& rhs)
+      {
+        return (lhs.h1 == rhs.h1) && (lhs.h2 == rhs.h2);
+      }
+
+      friend bool operator !=(const value_type& lhs, const value_type& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      uint64_t h1;
+      uint64_t h2;
+    };
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      h1               = seed;
+      h2               = seed;
+      char_count       = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      // Contiguous ranges are read a whole block at a time.
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_byte(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+
+      value_type result;
+      result.h1 = h1;
+      result.h2 = h2;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the first 64 bits of the hash, for hash tables.
+    //*************************************************************************
+    uint64_t value_64()
+    {
+      finalise();
+
+      return h1;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit word.
+    //*************************************************************************
+    template<typename TPointer>
+    static uint64_t load_64(TPointer p, size_t length = 8U)
+    {
+      uint64_t word = 0U;
+
+      for (size_t i = 0U; i < length; ++i)
+      {
+        word |= uint64_t(uint8_t(p[i])) << (8U * i);
+      }
+
+      return word;
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the current block.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      block[block_fill_count] = value_;
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(load_64(block), load_64(block + 8U));
+        block_fill_count = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      // Complete any partly filled block.
+      while ((block_fill_count != 0U) && (begin != end))
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+
+      while (size_t(end - begin) >= FULL_BLOCK)
+      {
+        add_block(load_64(begin), load_64(begin + 8U));
+        begin      += FULL_BLOCK;
+        char_count += FULL_BLOCK;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
+    //*************************************************************************
+    /// Mixes the first half of a block.
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= 0x87C37B91114253D5ULL;
+      k1  = rotate_left(k1, 31U);
+      k1 *= 0x4CF5AD432745937FULL;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    /// Mixes the second half of a block.
+    //*************************************************************************
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= 0x4CF5AD432745937FULL;
+      k2  = rotate_left(k2, 33U);
+      k2 *= 0x87C37B91114253D5ULL;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    /// Final avalanche.
+    //*************************************************************************
+    static uint64_t fmix_64(uint64_t k)
+    {
+      k ^= (k >> 33U);
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= (k >> 33U);
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= (k >> 33U);
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block(uint64_t k1, uint64_t k2)
+    {
+      h1 ^= mix_k1(k1);
+      h1  = rotate_left(h1, 27U);
+      h1 += h2;
+      h1  = (h1 * 5U) + 0x52DCE729UL;
+
+      h2 ^= mix_k2(k2);
+      h2  = rotate_left(h2, 31U);
+      h2 += h1;
+      h2  = (h2 * 5U) + 0x38495AB5UL;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        if (block_fill_count > 8U)
+        {
+          h2 ^= mix_k2(load_64(block + 8U, block_fill_count - 8U));
+        }
+
+        if (block_fill_count > 0U)
+        {
+          h1 ^= mix_k1(load_64(block, (block_fill_count > 8U) ? 8U : block_fill_count));
+        }
+
+        h1 ^= char_count;
+        h2 ^= char_count;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = fmix_64(h1);
+        h2 = fmix_64(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        is_finalised = true;
+      }
+    }
+
+    static ETL_CONSTANT uint8_t FULL_BLOCK = 16U;
+
+    bool     is_finalised;
+    uint8_t  block_fill_count;
+    size_t   char_count;
+    uint8_t  block[FULL_BLOCK];
+    uint64_t h1;
+    uint64_t h2;
+    uint32_t seed;
+  };
+#endif
 }
 
 #endif
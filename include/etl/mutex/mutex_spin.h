@@ -0,0 +1,425 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MUTEX_SPIN_INCLUDED
+#define ETL_MUTEX_SPIN_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+//*****************************************************************************
+// ETL_SPIN_PAUSE  tells the CPU that it is in a spin wait loop.
+// ETL_SPIN_YIELD  gives up the time slice once the backoff limit has been reached.
+// ETL_SPIN_MAX_BACKOFF is the most pauses between two attempts before yielding.
+// Each may be defined in the user's profile to suit the target or RTOS.
+//*****************************************************************************
+#if !defined(ETL_SPIN_PAUSE)
+  #if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && (defined(__i386__) || defined(__x86_64__))
+    #define ETL_SPIN_PAUSE() __builtin_ia32_pause()
+  #elif (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG) || defined(ETL_COMPILER_ARM6)) && (defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7)))
+    #define ETL_SPIN_PAUSE() __asm__ __volatile__("yield")
+  #elif defined(ETL_COMPILER_MICROSOFT) && (defined(_M_IX86) || defined(_M_X64))
+    #include <intrin.h>
+    #define ETL_SPIN_PAUSE() _mm_pause()
+  #else
+    #define ETL_SPIN_PAUSE()
+  #endif
+#endif
+
+#if !defined(ETL_SPIN_YIELD)
+  #if ETL_USING_STL && ETL_USING_CPP11
+    #include <thread>
+    #define ETL_SPIN_YIELD() std::this_thread::yield()
+  #else
+    #define ETL_SPIN_YIELD() ETL_SPIN_PAUSE()
+  #endif
+#endif
+
+#if !defined(ETL_SPIN_MAX_BACKOFF)
+  #define ETL_SPIN_MAX_BACKOFF 64U
+#endif
+
+namespace etl
+{
+  namespace private_mutex_spin
+  {
+    //*************************************************************************
+    /// Exponential backoff for spin waits.
+    /// Pauses for 1, 2, 4 ... ETL_SPIN_MAX_BACKOFF times, then yields on each wait.
+    //*************************************************************************
+    class backoff
+    {
+    public:
+
+      backoff()
+        : spins(1U)
+      {
+      }
+
+      void wait()
+      {
+        if (spins <= ETL_SPIN_MAX_BACKOFF)
+        {
+          for (uint32_t i = 0U; i < spins; ++i)
+          {
+            ETL_SPIN_PAUSE();
+          }
+
+          spins *= 2U;
+        }
+        else
+        {
+          ETL_SPIN_YIELD();
+        }
+      }
+
+    private:
+
+      uint32_t spins;
+    };
+
+    //*************************************************************************
+    /// Counts the lock calls that found the lock already held.
+    //*************************************************************************
+    class contention_counter
+    {
+    public:
+
+      //*******************************************
+      /// The number of lock calls that had to wait.
+      //*******************************************
+      uint32_t get_contention_count() const
+      {
+        return contentions.load(etl::memory_order_relaxed);
+      }
+
+      //*******************************************
+      /// Sets the contention count to zero.
+      //*******************************************
+      void reset_contention_count()
+      {
+        contentions.store(0U, etl::memory_order_relaxed);
+      }
+
+    protected:
+
+      contention_counter()
+        : contentions(0U)
+      {
+      }
+
+      void record_contention()
+      {
+        contentions.fetch_add(1U, etl::memory_order_relaxed);
+      }
+
+    private:
+
+      etl::atomic<uint32_t> contentions;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief A test and test-and-set spin lock with exponential backoff.
+  /// Lowest latency when the lock is rarely contended. Not fair.
+  //***************************************************************************
+  class spin_mutex : public etl::private_mutex_spin::contention_counter
+  {
+  public:
+
+    spin_mutex()
+      : locked(0U)
+    {
+    }
+
+    void lock()
+    {
+      if (try_lock())
+      {
+        return;
+      }
+
+      record_contention();
+
+      etl::private_mutex_spin::backoff delay;
+
+      do
+      {
+        // Spin on a load, so that the cache line is shared while waiting.
+        while (locked.load(etl::memory_order_relaxed) != 0U)
+        {
+          delay.wait();
+        }
+      } while (locked.exchange(1U, etl::memory_order_acquire) != 0U);
+    }
+
+    bool try_lock()
+    {
+      return (locked.load(etl::memory_order_relaxed) == 0U) &&
+             (locked.exchange(1U, etl::memory_order_acquire) == 0U);
+    }
+
+    void unlock()
+    {
+      locked.store(0U, etl::memory_order_release);
+    }
+
+  private:
+
+    spin_mutex(const spin_mutex&) ETL_DELETE;
+    spin_mutex& operator=(const spin_mutex&) ETL_DELETE;
+
+    etl::atomic<uint32_t> locked;
+  };
+
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief A ticket lock. Waiters are granted the lock in the order that they called lock.
+  /// Waiters back off in proportion to their place in the queue.
+  //***************************************************************************
+  class ticket_mutex : public etl::private_mutex_spin::contention_counter
+  {
+  public:
+
+    ticket_mutex()
+      : next_ticket(0U)
+      , now_serving(0U)
+    {
+    }
+
+    void lock()
+    {
+      const uint32_t ticket = next_ticket.fetch_add(1U, etl::memory_order_relaxed);
+
+      uint32_t serving = now_serving.load(etl::memory_order_acquire);
+
+      if (serving == ticket)
+      {
+        return;
+      }
+
+      record_contention();
+
+      etl::private_mutex_spin::backoff delay;
+
+      while (serving != ticket)
+      {
+        // Wait longer when further back in the queue.
+        for (uint32_t place = ticket - serving; place > 1U; --place)
+        {
+          ETL_SPIN_PAUSE();
+        }
+
+        delay.wait();
+        serving = now_serving.load(etl::memory_order_acquire);
+      }
+    }
+
+    bool try_lock()
+    {
+      uint32_t ticket = now_serving.load(etl::memory_order_acquire);
+
+      // Only take a ticket if it would be served immediately.
+      return next_ticket.compare_exchange_strong(ticket, ticket + 1U, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    void unlock()
+    {
+      now_serving.store(now_serving.load(etl::memory_order_relaxed) + 1U, etl::memory_order_release);
+    }
+
+  private:
+
+    ticket_mutex(const ticket_mutex&) ETL_DELETE;
+    ticket_mutex& operator=(const ticket_mutex&) ETL_DELETE;
+
+    etl::atomic<uint32_t> next_ticket;
+    etl::atomic<uint32_t> now_serving;
+  };
+
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief An MCS queue lock. Fair, and each waiter spins on its own node, so
+  /// waiting does not pass a shared cache line between the cores.
+  /// Uses the variant where the waiter's node is on its stack only while it waits,
+  /// so that lock and unlock need no arguments, as for the other mutexes.
+  //***************************************************************************
+  class mcs_mutex : public etl::private_mutex_spin::contention_counter
+  {
+  public:
+
+    mcs_mutex()
+      : tail(ETL_NULLPTR)
+    {
+      holder.next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+      holder.waiting.store(0U, etl::memory_order_relaxed);
+    }
+
+    void lock()
+    {
+      if (try_lock())
+      {
+        return;
+      }
+
+      record_contention();
+      lock_slow();
+    }
+
+    bool try_lock()
+    {
+      node_t* p_expected = ETL_NULLPTR;
+
+      return tail.compare_exchange_strong(p_expected, &holder, etl::memory_order_acquire, etl::memory_order_relaxed);
+    }
+
+    void unlock()
+    {
+      node_t* p_next = holder.next.load(etl::memory_order_acquire);
+
+      if (p_next == ETL_NULLPTR)
+      {
+        node_t* p_expected = &holder;
+
+        if (tail.compare_exchange_strong(p_expected, ETL_NULLPTR, etl::memory_order_release, etl::memory_order_relaxed))
+        {
+          return;
+        }
+
+        // A waiter has joined the queue but has not linked itself yet.
+        p_next = wait_for_next(holder);
+      }
+
+      p_next->waiting.store(0U, etl::memory_order_release);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A queue entry.
+    /// 'holder' is the entry for the owner, so that waiters may join behind it.
+    //*************************************************************************
+    struct node_t
+    {
+      etl::atomic<node_t*>  next;
+      etl::atomic<uint32_t> waiting;
+    };
+
+    //*************************************************************************
+    /// Joins the queue and waits to be granted the lock.
+    //*************************************************************************
+    void lock_slow()
+    {
+      node_t node;
+      node.next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+      node.waiting.store(1U, etl::memory_order_relaxed);
+
+      while (true)
+      {
+        node_t* p_tail = tail.load(etl::memory_order_acquire);
+
+        if (p_tail == ETL_NULLPTR)
+        {
+          // Released since the last attempt.
+          if (try_lock())
+          {
+            return;
+          }
+        }
+        else if (tail.compare_exchange_strong(p_tail, &node, etl::memory_order_acq_rel, etl::memory_order_relaxed))
+        {
+          p_tail->next.store(&node, etl::memory_order_release);
+
+          etl::private_mutex_spin::backoff delay;
+
+          while (node.waiting.load(etl::memory_order_acquire) != 0U)
+          {
+            delay.wait();
+          }
+
+          // Now the owner. Move the successor to the holder, as 'node' is about to go out of scope.
+          node_t* p_next = node.next.load(etl::memory_order_acquire);
+
+          if (p_next == ETL_NULLPTR)
+          {
+            holder.next.store(ETL_NULLPTR, etl::memory_order_relaxed);
+
+            node_t* p_expected = &node;
+
+            if (!tail.compare_exchange_strong(p_expected, &holder, etl::memory_order_acq_rel, etl::memory_order_relaxed))
+            {
+              // A waiter has joined behind 'node' but has not linked itself yet.
+              p_next = wait_for_next(node);
+              holder.next.store(p_next, etl::memory_order_release);
+            }
+          }
+          else
+          {
+            holder.next.store(p_next, etl::memory_order_release);
+          }
+
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Waits for a waiter to link itself behind a node.
+    //*************************************************************************
+    static node_t* wait_for_next(node_t& node)
+    {
+      etl::private_mutex_spin::backoff delay;
+
+      node_t* p_next = node.next.load(etl::memory_order_acquire);
+
+      while (p_next == ETL_NULLPTR)
+      {
+        delay.wait();
+        p_next = node.next.load(etl::memory_order_acquire);
+      }
+
+      return p_next;
+    }
+
+    mcs_mutex(const mcs_mutex&) ETL_DELETE;
+    mcs_mutex& operator=(const mcs_mutex&) ETL_DELETE;
+
+    etl::atomic<node_t*> tail;   ///< The last entry in the queue, or null when unlocked.
+    node_t               holder; ///< The owner's entry. Its 'next' is the first waiter.
+  };
+}
+
+#endif
+#endif
@@ -30,21 +30,64 @@ SOFTWARE.
 #define ETL_NTH_TYPE_INCLUDED
 
 #include "platform.h"
+#include "utility.h"
 
 namespace etl
 {
 #if ETL_USING_CPP11
+  #if ETL_USING_BUILTIN_TYPE_PACK_ELEMENT
   template <size_t N, typename T1, typename... TRest>
   struct nth_type
   {
-    using type = typename nth_type<N - 1U, TRest...>::type;
+    ETL_STATIC_ASSERT(N <= sizeof...(TRest), "etl::nth_type index out of range");
+
+    using type = __type_pack_element<N, T1, TRest...>;
   };
+  #else
+  namespace private_nth_type
+  {
+    //*************************************************************************
+    /// A type tagged with its position in the list.
+    //*************************************************************************
+    template <size_t Index, typename T>
+    struct indexed_type
+    {
+      using type = T;
+    };
+
+    //*************************************************************************
+    /// Inherits an indexed_type for each type in the list.
+    //*************************************************************************
+    template <typename TIndices, typename... TTypes>
+    struct indexed_types;
 
-  template <typename T1, typename... TRest>
-  struct nth_type<0U, T1, TRest...>
+    template <size_t... Indices, typename... TTypes>
+    struct indexed_types<etl::index_sequence<Indices...>, TTypes...> : indexed_type<Indices, TTypes>...
+    {
+    };
+
+    //*************************************************************************
+    /// Picks the base with the index, deducing the type.
+    /// The instantiation depth does not grow with the length of the list.
+    //*************************************************************************
+    template <size_t Index, typename T>
+    indexed_type<Index, T> select(const indexed_type<Index, T>*);
+  }
+
+  template <size_t N, typename T1, typename... TRest>
+  struct nth_type
   {
-    using type = T1;
+    ETL_STATIC_ASSERT(N <= sizeof...(TRest), "etl::nth_type index out of range");
+
+  private:
+
+    typedef private_nth_type::indexed_types<etl::make_index_sequence<sizeof...(TRest) + 1U>, T1, TRest...> list_type;
+
+  public:
+
+    using type = typename decltype(private_nth_type::select<N>(static_cast<const list_type*>(ETL_NULLPTR)))::type;
   };
+  #endif
 
   template <size_t N, typename... TTypes>
   using nth_type_t = typename nth_type<N, TTypes...>::type;
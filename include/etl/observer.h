@@ -58,6 +58,7 @@ SOFTWARE.
 #include "exception.h"
 #include "error_handler.h"
 #include "utility.h"
+#include "span.h"
 
 namespace etl
 {
@@ -158,6 +159,7 @@ namespace etl
 
         // Add it.
         observer_list.push_back(observer_item(observer));
+        update_dispatch_list();
       }
     }
 
@@ -176,6 +178,7 @@ namespace etl
       {
         // Erase it.
         observer_list.erase(i_observer_item);
+        update_dispatch_list();
         return true;
       }
       else
@@ -198,6 +201,7 @@ namespace etl
       if (i_observer_item != observer_list.end())
       {
         i_observer_item->enabled = state;
+        update_dispatch_list();
       }
     }
 
@@ -213,6 +217,7 @@ namespace etl
       if (i_observer_item != observer_list.end())
       {
         i_observer_item->enabled = false;
+        update_dispatch_list();
       }
     }
 
@@ -222,6 +227,7 @@ namespace etl
     void clear_observers()
     {
       observer_list.clear();
+      dispatch_list.clear();
     }
 
     //*****************************************************************
@@ -240,16 +246,31 @@ namespace etl
     template <typename TNotification>
     void notify_observers(TNotification n)
     {
-      typename Observer_List::iterator i_observer_item = observer_list.begin();
+      typename Dispatch_List::const_iterator i_observer = dispatch_list.begin();
 
-      while (i_observer_item != observer_list.end())
+      while (i_observer != dispatch_list.end())
       {
-        if (i_observer_item->enabled)
-        {
-          i_observer_item->p_observer->notification(n);
-        }
+        (*i_observer)->notification(n);
+        ++i_observer;
+      }
+    }
+
+    //*****************************************************************
+    /// Notify all of the observers with a batch of notifications.
+    /// Each observer is called once, with the whole batch, so the
+    /// observer must handle etl::span<const T> notifications.
+    ///\tparam T The type of the notifications in the batch.
+    ///\param batch The notifications.
+    //*****************************************************************
+    template <typename T>
+    void notify_observers(etl::span<const T> batch)
+    {
+      typename Dispatch_List::const_iterator i_observer = dispatch_list.begin();
 
-        ++i_observer_item;
+      while (i_observer != dispatch_list.end())
+      {
+        (*i_observer)->notification(batch);
+        ++i_observer;
       }
     }
 
@@ -261,6 +282,24 @@ namespace etl
 
   private:
 
+    typedef etl::vector<TObserver*, MAX_OBSERVERS> Dispatch_List;
+
+    //*****************************************************************
+    /// Rebuilds the list of enabled observers.
+    //*****************************************************************
+    void update_dispatch_list()
+    {
+      dispatch_list.clear();
+
+      for (typename Observer_List::const_iterator i_observer_item = observer_list.begin(); i_observer_item != observer_list.end(); ++i_observer_item)
+      {
+        if (i_observer_item->enabled)
+        {
+          dispatch_list.push_back(i_observer_item->p_observer);
+        }
+      }
+    }
+
     //*****************************************************************
     /// Find an observer in the list.
     /// Returns the end of the list if not found.
@@ -272,6 +311,9 @@ namespace etl
 
     /// The list of observers.
     Observer_List observer_list;
+
+    /// The enabled observers, in the order they were added.
+    Dispatch_List dispatch_list;
   };
 
 #if ETL_USING_CPP11 && !defined(ETL_OBSERVER_FORCE_CPP03_IMPLEMENTATION)
@@ -712,22 +712,24 @@ namespace etl
     {
     }
 
+#if ETL_USING_CPP11
     //***************************************************************************
     /// Copy constructor.
+    /// Defaulted, so that the optional is trivially copyable.
     //***************************************************************************
-    ETL_CONSTEXPR14 optional(const optional& other)
-      : valid(bool(other))
-      , storage(other.storage)
-    {
-    }
+    ETL_CONSTEXPR14 optional(const optional& other) = default;
 
-#if ETL_USING_CPP11
     //***************************************************************************
     /// Move constructor.
     //***************************************************************************
-    ETL_CONSTEXPR14 optional(optional&& other)
+    ETL_CONSTEXPR14 optional(optional&& other) = default;
+#else
+    //***************************************************************************
+    /// Copy constructor.
+    //***************************************************************************
+    optional(const optional& other)
       : valid(bool(other))
-      , storage(etl::move(other.storage))
+      , storage(other.storage)
     {
     }
 #endif
@@ -761,34 +763,28 @@ namespace etl
       return *this;
     }
 
+#if ETL_USING_CPP11
     //***************************************************************************
     /// Assignment operator from optional.
+    /// Defaulted, so that the optional is trivially copyable.
     //***************************************************************************
-    ETL_CONSTEXPR14 optional& operator =(const optional& other)
-    {
-      if (this != &other)
-      {
-        if (other.valid)
-        {
-          storage.value = other.storage.value;
-        }
-        valid = other.valid;
-      }
-
-      return *this;
-    }
+    ETL_CONSTEXPR14 optional& operator =(const optional& other) = default;
 
-#if ETL_USING_CPP11
     //***************************************************************************
     /// Assignment operator from optional.
     //***************************************************************************
-    ETL_CONSTEXPR14 optional& operator =(optional&& other)
+    ETL_CONSTEXPR14 optional& operator =(optional&& other) = default;
+#else
+    //***************************************************************************
+    /// Assignment operator from optional.
+    //***************************************************************************
+    optional& operator =(const optional& other)
     {
       if (this != &other)
       {
         if (other.valid)
         {
-          storage.value = etl::move(other.storage.value);
+          storage.value = other.storage.value;
         }
         valid = other.valid;
       }
@@ -0,0 +1,415 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_OVERWRITE_RING_SPSC_INCLUDED
+#define ETL_OVERWRITE_RING_SPSC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "algorithm.h"
+#include "power.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+#include "private/minmax_push.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A single producer, single consumer ring that overwrites the oldest value
+  /// when full, for sampling. The producer, which may be an interrupt, never
+  /// waits and never fails.
+  ///
+  /// Each slot is a sequence lock stamped with the number of the sample it
+  /// holds. A reader copies a slot and checks that the stamp was the same
+  /// before and after, so a sample is either read intact or is known to have
+  /// been overwritten. Reads are lock free but not wait free.
+  ///
+  /// The consumer may read the latest samples, which does not remove them, or
+  /// pop samples in order, counting any that were overwritten before being popped.
+  /// A consumer in an interrupt that can preempt the producer must use the
+  /// 'try' functions, as the others would never see the write complete.
+  ///\tparam T    The trivially copyable type of the samples.
+  ///\tparam VSize The number of slots. Must be a power of 2.
+  //***************************************************************************
+  template <typename T, size_t VSize>
+  class overwrite_ring_spsc
+  {
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "overwrite_ring_spsc requires a trivially copyable type");
+    ETL_STATIC_ASSERT((VSize >= 2U) && etl::is_power_of_2<VSize>::value, "overwrite_ring_spsc size must be a power of 2");
+
+  public:
+
+    typedef T        value_type;
+    typedef size_t   size_type;
+    typedef uint32_t sequence_type;
+
+    static ETL_CONSTANT size_t Size = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    overwrite_ring_spsc()
+      : write_count(0U)
+      , read_count(0U)
+      , overrun_count(0U)
+    {
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        slots[i].stamp.store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes a sample, overwriting the oldest if the ring is full.
+    /// Producer only.
+    //*************************************************************************
+    void push(const T& value)
+    {
+      const sequence_type sample = write_count.load(etl::memory_order_relaxed);
+      slot_type&          slot   = slots[sample & Mask];
+
+      word_type copy[Number_Of_Words];
+
+      copy[Number_Of_Words - 1U] = 0U;
+      memcpy(copy, &value, sizeof(T));
+
+      // An odd stamp marks a write in progress.
+      slot.stamp.store(writing_stamp(sample), etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        slot.words[i].store(copy[i], etl::memory_order_relaxed);
+      }
+
+      slot.stamp.store(written_stamp(sample), etl::memory_order_release);
+      write_count.store(sample + 1U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to read the latest 'count' samples, oldest first.
+    /// Consumer only.
+    ///\return <b>true</b> if they were read, <b>false</b> if there are fewer than
+    /// 'count' samples or one was overwritten during the read.
+    //*************************************************************************
+    bool try_read_latest(T* p_values, size_t count) const
+    {
+      const sequence_type written = write_count.load(etl::memory_order_acquire);
+
+      if ((count > VSize) || (count > written))
+      {
+        return false;
+      }
+
+      const sequence_type first = written - sequence_type(count);
+
+      for (size_t i = 0U; i < count; ++i)
+      {
+        if (!try_read_sample(first + sequence_type(i), p_values[i]))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads up to 'count' of the latest samples, oldest first, retrying if
+    /// any are overwritten during the read.
+    /// Reading fewer samples than the size makes a retry less likely.
+    /// Consumer only.
+    ///\return The number of samples read.
+    //*************************************************************************
+    size_t read_latest(T* p_values, size_t count) const
+    {
+      size_t available;
+
+      do
+      {
+        const sequence_type written = write_count.load(etl::memory_order_acquire);
+
+        available = etl::min(etl::min(count, VSize), size_t(written));
+      } while (!try_read_latest(p_values, available));
+
+      return available;
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to read the latest sample.
+    /// Consumer only.
+    ///\return <b>false</b> if there are no samples, or it was overwritten during the read.
+    //*************************************************************************
+    bool try_latest(T& value) const
+    {
+      return try_read_latest(&value, 1U);
+    }
+
+    //*************************************************************************
+    /// Reads the latest sample.
+    /// Consumer only.
+    ///\return <b>false</b> if there are no samples.
+    //*************************************************************************
+    bool latest(T& value) const
+    {
+      return read_latest(&value, 1U) == 1U;
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to pop the oldest sample that has not been popped.
+    /// Samples that have been overwritten are skipped, and counted as overruns.
+    /// Consumer only.
+    ///\return <b>false</b> if there are no new samples, or the oldest was
+    /// overwritten during the read.
+    //*************************************************************************
+    bool try_pop(T& value)
+    {
+      const sequence_type written = write_count.load(etl::memory_order_acquire);
+
+      skip_overwritten(written);
+
+      if (read_count == written)
+      {
+        return false;
+      }
+
+      if (!try_read_sample(read_count, value))
+      {
+        return false;
+      }
+
+      ++read_count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops the oldest sample that has not been popped, retrying if it is
+    /// overwritten during the read.
+    /// Consumer only.
+    ///\return <b>false</b> if there are no new samples.
+    //*************************************************************************
+    bool pop(T& value)
+    {
+      while (!try_pop(value))
+      {
+        if (read_count == write_count.load(etl::memory_order_acquire))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the number of samples that have not been popped and are still held.
+    /// Consumer only.
+    //*************************************************************************
+    size_t size() const
+    {
+      const sequence_type unread = write_count.load(etl::memory_order_acquire) - read_count;
+
+      return etl::min(size_t(unread), VSize);
+    }
+
+    //*************************************************************************
+    /// Checks if there are no samples that have not been popped.
+    /// Consumer only.
+    //*************************************************************************
+    bool empty() const
+    {
+      return read_count == write_count.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Gets the number of samples that were overwritten before being popped.
+    /// Consumer only.
+    //*************************************************************************
+    size_t overruns() const
+    {
+      return overrun_count;
+    }
+
+    //*************************************************************************
+    /// Clears the overrun count.
+    /// Consumer only.
+    //*************************************************************************
+    void clear_overruns()
+    {
+      overrun_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Discards the samples that have not been popped.
+    /// Consumer only.
+    //*************************************************************************
+    void discard()
+    {
+      read_count = write_count.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Gets the number of samples written. Wraps at 2^32.
+    //*************************************************************************
+    sequence_type total_written() const
+    {
+      return write_count.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// Gets the number of slots.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t capacity() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Gets the number of slots.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t max_size() const
+    {
+      return VSize;
+    }
+
+  private:
+
+    typedef uint32_t word_type;
+
+    static ETL_CONSTANT size_t        Number_Of_Words = (sizeof(T) + sizeof(word_type) - 1U) / sizeof(word_type);
+    static ETL_CONSTANT sequence_type Mask            = sequence_type(VSize - 1U);
+
+    //*************************************************************************
+    /// A sample and the stamp that identifies it.
+    //*************************************************************************
+    struct slot_type
+    {
+      etl::atomic<sequence_type> stamp;
+      etl::atomic<word_type>     words[Number_Of_Words];
+    };
+
+    //*************************************************************************
+    /// The stamp while the sample is being written.
+    //*************************************************************************
+    static sequence_type writing_stamp(sequence_type sample)
+    {
+      return (sample << 1U) + 1U;
+    }
+
+    //*************************************************************************
+    /// The stamp once the sample has been written.
+    /// The slots start with a zero stamp, which is only reused long after
+    /// every slot has been written.
+    //*************************************************************************
+    static sequence_type written_stamp(sequence_type sample)
+    {
+      return (sample << 1U) + 2U;
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to read a sample.
+    //*************************************************************************
+    bool try_read_sample(sequence_type sample, T& value) const
+    {
+      const slot_type&    slot     = slots[sample & Mask];
+      const sequence_type expected = written_stamp(sample);
+
+      if (slot.stamp.load(etl::memory_order_acquire) != expected)
+      {
+        return false;
+      }
+
+      word_type copy[Number_Of_Words];
+
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        copy[i] = slot.words[i].load(etl::memory_order_relaxed);
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      if (slot.stamp.load(etl::memory_order_relaxed) != expected)
+      {
+        return false;
+      }
+
+      memcpy(&value, copy, sizeof(T));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the read position past any samples that have been overwritten.
+    //*************************************************************************
+    void skip_overwritten(sequence_type written)
+    {
+      const sequence_type unread = written - read_count;
+
+      if (unread > sequence_type(VSize))
+      {
+        const sequence_type lost = unread - sequence_type(VSize);
+
+        read_count    += lost;
+        overrun_count += lost;
+      }
+    }
+
+    // Disable copy construction and assignment.
+    overwrite_ring_spsc(const overwrite_ring_spsc&) ETL_DELETE;
+    overwrite_ring_spsc& operator =(const overwrite_ring_spsc&) ETL_DELETE;
+
+    slot_type                  slots[VSize];
+    etl::atomic<sequence_type> write_count;
+    sequence_type              read_count;
+    size_t                     overrun_count;
+  };
+
+  template <typename T, size_t VSize>
+  ETL_CONSTANT size_t overwrite_ring_spsc<T, VSize>::Size;
+
+  template <typename T, size_t VSize>
+  ETL_CONSTANT size_t overwrite_ring_spsc<T, VSize>::Number_Of_Words;
+
+  template <typename T, size_t VSize>
+  ETL_CONSTANT typename overwrite_ring_spsc<T, VSize>::sequence_type overwrite_ring_spsc<T, VSize>::Mask;
+}
+
+#include "private/minmax_pop.h"
+
+#endif
+#endif
@@ -0,0 +1,507 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PACKET_VIEW_INCLUDED
+#define ETL_PACKET_VIEW_INCLUDED
+
+#include "platform.h"
+#include "span.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "nullptr.h"
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup packet_view packet_view
+/// Views of received buffers as objects, without copying, and lists of
+/// spans for sending a frame in pieces.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception base for packet views and iovecs.
+  ///\ingroup packet_view
+  //***************************************************************************
+  class packet_view_exception : public etl::exception
+  {
+  public:
+
+    packet_view_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An invalid packet view was accessed.
+  ///\ingroup packet_view
+  //***************************************************************************
+  class packet_view_invalid : public etl::packet_view_exception
+  {
+  public:
+
+    packet_view_invalid(string_type file_name_, numeric_type line_number_)
+      : packet_view_exception(ETL_ERROR_TEXT("packet_view:invalid", ETL_PACKET_VIEW_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An iovec was full.
+  ///\ingroup packet_view
+  //***************************************************************************
+  class iovec_full : public etl::packet_view_exception
+  {
+  public:
+
+    iovec_full(string_type file_name_, numeric_type line_number_)
+      : packet_view_exception(ETL_ERROR_TEXT("iovec:full", ETL_PACKET_VIEW_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A non-owning view of a buffer as a T, in place.
+  /// The view is valid if the buffer is large enough for a T and is aligned
+  /// for a T. T should be a trivially copyable type, such as a protocol header.
+  ///\code
+  /// etl::packet_view<const Header> header(rx_buffer);
+  ///
+  /// if (header.is_valid() && (header->type == Data))
+  /// {
+  ///   process(header.payload());
+  /// }
+  ///\endcode
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename T>
+  class packet_view
+  {
+  public:
+
+    typedef T        value_type;
+    typedef T&       reference;
+    typedef T*       pointer;
+    typedef typename etl::conditional<etl::is_const<T>::value, const uint8_t, uint8_t>::type byte_type;
+    typedef typename etl::conditional<etl::is_const<T>::value, const void, void>::type       void_type;
+    typedef etl::span<byte_type> span_type;
+
+    //*************************************************************************
+    /// Default constructor. The view is invalid.
+    //*************************************************************************
+    packet_view() ETL_NOEXCEPT
+      : p_object(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , length(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Views a buffer.
+    /// The view is invalid if the buffer is too small or misaligned.
+    //*************************************************************************
+    packet_view(void_type* buffer, size_t length_) ETL_NOEXCEPT
+      : p_object(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , length(0U)
+    {
+      assign(buffer, length_);
+    }
+
+    //*************************************************************************
+    /// Views a span of bytes.
+    /// The view is invalid if the span is too small or misaligned.
+    //*************************************************************************
+    template <size_t Extent>
+    packet_view(const etl::span<byte_type, Extent>& buffer) ETL_NOEXCEPT
+      : p_object(ETL_NULLPTR)
+      , p_buffer(ETL_NULLPTR)
+      , length(0U)
+    {
+      assign(buffer.data(), buffer.size());
+    }
+
+    //*************************************************************************
+    /// Returns true if a buffer can be viewed as a T.
+    //*************************************************************************
+    static bool is_valid_buffer(const void* buffer, size_t length_) ETL_NOEXCEPT
+    {
+      return (buffer != ETL_NULLPTR) &&
+             (length_ >= sizeof(T)) &&
+             ((reinterpret_cast<uintptr_t>(buffer) % etl::alignment_of<T>::value) == 0U);
+    }
+
+    //*************************************************************************
+    /// Views a new buffer.
+    ///\return true if the view is valid.
+    //*************************************************************************
+    bool assign(void_type* buffer, size_t length_) ETL_NOEXCEPT
+    {
+      if (is_valid_buffer(buffer, length_))
+      {
+        p_object = static_cast<pointer>(buffer);
+        p_buffer = static_cast<byte_type*>(buffer);
+        length   = length_;
+      }
+      else
+      {
+        p_object = ETL_NULLPTR;
+        p_buffer = ETL_NULLPTR;
+        length   = 0U;
+      }
+
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// Returns true if the view refers to a buffer.
+    //*************************************************************************
+    bool is_valid() const ETL_NOEXCEPT
+    {
+      return p_object != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Returns true if the view refers to a buffer.
+    //*************************************************************************
+    ETL_EXPLICIT operator bool() const ETL_NOEXCEPT
+    {
+      return is_valid();
+    }
+
+    //*************************************************************************
+    /// The object in the buffer.
+    /// If asserts or exceptions are enabled, emits packet_view_invalid if the view is invalid.
+    //*************************************************************************
+    reference get() const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(packet_view_invalid));
+
+      return *p_object;
+    }
+
+    //*************************************************************************
+    reference operator *() const
+    {
+      return get();
+    }
+
+    //*************************************************************************
+    pointer operator ->() const
+    {
+      ETL_ASSERT(is_valid(), ETL_ERROR(packet_view_invalid));
+
+      return p_object;
+    }
+
+    //*************************************************************************
+    /// The whole buffer.
+    //*************************************************************************
+    span_type buffer() const ETL_NOEXCEPT
+    {
+      return is_valid() ? span_type(p_buffer, length) : span_type();
+    }
+
+    //*************************************************************************
+    /// The bytes of the buffer after the T.
+    //*************************************************************************
+    span_type payload() const ETL_NOEXCEPT
+    {
+      return is_valid() ? span_type(p_buffer + sizeof(T), length - sizeof(T)) : span_type();
+    }
+
+    //*************************************************************************
+    /// The size of the buffer.
+    //*************************************************************************
+    size_t size() const ETL_NOEXCEPT
+    {
+      return length;
+    }
+
+  private:
+
+    pointer    p_object;
+    byte_type* p_buffer;
+    size_t     length;
+  };
+
+  //***************************************************************************
+  /// Makes a packet_view of a span of bytes.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename T, size_t Extent>
+  etl::packet_view<T> make_packet_view(const etl::span<typename etl::packet_view<T>::byte_type, Extent>& buffer) ETL_NOEXCEPT
+  {
+    return etl::packet_view<T>(buffer);
+  }
+
+  //***************************************************************************
+  /// A list of spans that make up one frame, for scatter/gather I/O.
+  /// The base for all iovecs with the same element type.
+  ///\tparam T The element type of the spans, such as 'const uint8_t'.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename T>
+  class iiovec
+  {
+  public:
+
+    typedef etl::span<T>      span_type;
+    typedef span_type         value_type;
+    typedef const span_type&  const_reference;
+    typedef const span_type*  const_iterator;
+    typedef size_t            size_type;
+
+    //*************************************************************************
+    /// Adds a span to the end of the list.
+    /// Empty spans are not added.
+    /// If asserts or exceptions are enabled, emits iovec_full if the list is full.
+    //*************************************************************************
+    void push_back(const span_type& span)
+    {
+      if (!span.empty())
+      {
+        ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(iovec_full));
+
+        p_spans[current_size] = span;
+        ++current_size;
+        bytes += span.size();
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a buffer to the end of the list.
+    /// If asserts or exceptions are enabled, emits iovec_full if the list is full.
+    //*************************************************************************
+    void push_back(T* data, size_t length)
+    {
+      if (length != 0U)
+      {
+        push_back(span_type(data, length));
+      }
+    }
+
+    //*************************************************************************
+    /// Removes every span.
+    //*************************************************************************
+    void clear() ETL_NOEXCEPT
+    {
+      current_size = 0U;
+      bytes        = 0U;
+    }
+
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return p_spans[i];
+    }
+
+    //*************************************************************************
+    const_iterator begin() const ETL_NOEXCEPT
+    {
+      return p_spans;
+    }
+
+    //*************************************************************************
+    const_iterator end() const ETL_NOEXCEPT
+    {
+      return p_spans + current_size;
+    }
+
+    //*************************************************************************
+    /// The number of spans.
+    //*************************************************************************
+    size_type size() const ETL_NOEXCEPT
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The most spans that the list can hold.
+    //*************************************************************************
+    size_type max_size() const ETL_NOEXCEPT
+    {
+      return capacity;
+    }
+
+    //*************************************************************************
+    bool empty() const ETL_NOEXCEPT
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    bool full() const ETL_NOEXCEPT
+    {
+      return current_size == capacity;
+    }
+
+    //*************************************************************************
+    /// The number of elements in all of the spans.
+    //*************************************************************************
+    size_t total_size() const ETL_NOEXCEPT
+    {
+      return bytes;
+    }
+
+    //*************************************************************************
+    /// Copies the spans, in order, to a buffer, for links that cannot gather.
+    /// Copies as much as will fit.
+    ///\return The number of elements copied.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    size_t copy_to(const etl::span<U, Extent>& destination) const
+    {
+      ETL_STATIC_ASSERT(sizeof(U) == sizeof(T), "Different element sizes");
+
+      size_t copied = 0U;
+
+      for (size_t i = 0U; (i < current_size) && (copied < destination.size()); ++i)
+      {
+        const size_t remaining = destination.size() - copied;
+        const size_t length    = (p_spans[i].size() < remaining) ? p_spans[i].size() : remaining;
+
+        memcpy(destination.data() + copied, p_spans[i].data(), length * sizeof(T));
+        copied += length;
+      }
+
+      return copied;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iiovec(span_type* p_spans_, size_t capacity_) ETL_NOEXCEPT
+      : p_spans(p_spans_)
+      , capacity(capacity_)
+      , current_size(0U)
+      , bytes(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Copies the spans of another list.
+    //*************************************************************************
+    void assign(const iiovec& other) ETL_NOEXCEPT
+    {
+      clear();
+
+      for (size_t i = 0U; (i < other.current_size) && (i < capacity); ++i)
+      {
+        push_back(other.p_spans[i]);
+      }
+    }
+
+  private:
+
+    // Disabled.
+    iiovec(const iiovec&);
+
+    span_type*   p_spans;
+    const size_t capacity;
+    size_t       current_size;
+    size_t       bytes;
+  };
+
+  //***************************************************************************
+  /// A list of up to MAX_SPANS spans that make up one frame.
+  ///\code
+  /// etl::iovec<const uint8_t, 3> frame;
+  ///
+  /// frame.push_back(header.buffer());
+  /// frame.push_back(payload);
+  /// frame.push_back(etl::span<const uint8_t>(crc_bytes));
+  ///
+  /// driver.send(frame.begin(), frame.size());
+  ///\endcode
+  ///\tparam T         The element type of the spans, such as 'const uint8_t'.
+  ///\tparam MAX_SPANS The most spans that the list can hold.
+  ///\ingroup packet_view
+  //***************************************************************************
+  template <typename T, size_t MAX_SPANS>
+  class iovec : public etl::iiovec<T>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_SPANS > 0U, "Zero spans");
+
+    typedef typename etl::iiovec<T>::span_type span_type;
+
+    static ETL_CONSTANT size_t Max_Spans = MAX_SPANS;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iovec() ETL_NOEXCEPT
+      : etl::iiovec<T>(spans, MAX_SPANS)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    iovec(const iovec& other) ETL_NOEXCEPT
+      : etl::iiovec<T>(spans, MAX_SPANS)
+    {
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// Assignment.
+    //*************************************************************************
+    iovec& operator =(const iovec& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        this->assign(other);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    span_type spans[MAX_SPANS];
+  };
+
+  template <typename T, size_t MAX_SPANS>
+  ETL_CONSTANT size_t iovec<T, MAX_SPANS>::Max_Spans;
+}
+
+#endif
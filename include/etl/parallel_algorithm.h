@@ -0,0 +1,628 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PARALLEL_ALGORITHM_INCLUDED
+#define ETL_PARALLEL_ALGORITHM_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "atomic.h"
+#include "delegate.h"
+#include "functional.h"
+#include "iterator.h"
+#include "memory.h"
+#include "nullptr.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "mutex/mutex_spin.h"
+
+#include <stddef.h>
+
+///\defgroup parallel_algorithm parallel algorithm
+/// Algorithms that split a range into a fixed number of parts and run the
+/// parts on the threads of a user supplied executor.
+/// The caller runs the first part itself, then waits for the others.
+/// Nothing is allocated; the parts live on the caller's stack.
+///\ingroup algorithm
+
+#if ETL_HAS_ATOMIC
+
+#if !defined(ETL_PARALLEL_MAX_TASKS)
+  // The most parts that a range is split into.
+  #define ETL_PARALLEL_MAX_TASKS 16U
+#endif
+
+#if !defined(ETL_PARALLEL_MIN_CHUNK_SIZE)
+  // The default fewest elements in each part.
+  #define ETL_PARALLEL_MIN_CHUNK_SIZE 1024U
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// Runs the parts of a parallel algorithm.
+  /// 'submit' must run each task that it is given, once, on another thread.
+  /// 'wait', if set, is called repeatedly while the caller waits for the
+  /// tasks to finish, and may run queued tasks. Otherwise the caller spins
+  /// with backoff.
+  /// A default constructed executor runs everything on the caller's thread.
+  ///\code
+  /// void submit_to_pool(const etl::parallel_executor::task_type& task)
+  /// {
+  ///   pool.push(task);
+  /// }
+  ///
+  /// etl::parallel_executor executor(etl::parallel_executor::submit_type::create<submit_to_pool>(), 4U);
+  ///
+  /// etl::sort(executor, data.begin(), data.end());
+  ///\endcode
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  class parallel_executor
+  {
+  public:
+
+    typedef etl::delegate<void(void)>                  task_type;
+    typedef etl::delegate<void(const task_type&)>      submit_type;
+    typedef etl::delegate<void(void)>                  wait_type;
+
+    //*************************************************************************
+    /// Runs everything on the caller's thread.
+    //*************************************************************************
+    parallel_executor()
+      : submitter()
+      , waiter()
+      , thread_count(1U)
+      , min_chunk(ETL_PARALLEL_MIN_CHUNK_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param submit_        Runs a task on another thread.
+    ///\param thread_count_  The number of threads, including the caller, that may run parts at once.
+    ///\param min_chunk_size The fewest elements in each part.
+    //*************************************************************************
+    parallel_executor(const submit_type& submit_, size_t thread_count_, size_t min_chunk_size = ETL_PARALLEL_MIN_CHUNK_SIZE)
+      : submitter(submit_)
+      , waiter()
+      , thread_count((thread_count_ == 0U) ? 1U : thread_count_)
+      , min_chunk((min_chunk_size == 0U) ? 1U : min_chunk_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets the function called while waiting for tasks to finish.
+    //*************************************************************************
+    void set_wait(const wait_type& wait_)
+    {
+      waiter = wait_;
+    }
+
+    //*************************************************************************
+    /// Runs a task on another thread.
+    //*************************************************************************
+    void submit(const task_type& task) const
+    {
+      submitter(task);
+    }
+
+    //*************************************************************************
+    /// Waits until 'remaining' is zero.
+    //*************************************************************************
+    void wait_for(const etl::atomic<size_t>& remaining) const
+    {
+      etl::private_mutex_spin::backoff backoff;
+
+      while (remaining.load(etl::memory_order_acquire) != 0U)
+      {
+        if (waiter.is_valid())
+        {
+          waiter();
+        }
+        else
+        {
+          backoff.wait();
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// The number of parts to split 'length' elements into.
+    //*************************************************************************
+    size_t parts(size_t length) const
+    {
+      if (!submitter.is_valid() || (length == 0U))
+      {
+        return 1U;
+      }
+
+      size_t count    = (thread_count < ETL_PARALLEL_MAX_TASKS) ? thread_count : ETL_PARALLEL_MAX_TASKS;
+      size_t by_size  = (length + min_chunk - 1U) / min_chunk;
+
+      return (by_size < count) ? by_size : count;
+    }
+
+    //*************************************************************************
+    /// The number of threads that may run parts at once.
+    //*************************************************************************
+    size_t concurrency() const
+    {
+      return submitter.is_valid() ? thread_count : 1U;
+    }
+
+    //*************************************************************************
+    /// The fewest elements in each part.
+    //*************************************************************************
+    size_t min_chunk_size() const
+    {
+      return min_chunk;
+    }
+
+  private:
+
+    submit_type submitter;
+    wait_type   waiter;
+    size_t      thread_count;
+    size_t      min_chunk;
+  };
+
+  namespace private_parallel
+  {
+    //*************************************************************************
+    /// The offset of the start of part 'i' of 'count'.
+    //*************************************************************************
+    inline size_t part_begin(size_t length, size_t count, size_t i)
+    {
+      const size_t remainder = length % count;
+
+      return ((length / count) * i) + ((i < remainder) ? i : remainder);
+    }
+
+    //*************************************************************************
+    /// Runs one part of a job on a worker.
+    //*************************************************************************
+    template <typename TJob>
+    class task
+    {
+    public:
+
+      void set(TJob& job_, size_t index_, etl::atomic<size_t>& remaining_)
+      {
+        p_job       = &job_;
+        index       = index_;
+        p_remaining = &remaining_;
+      }
+
+      void run()
+      {
+        p_job->run(index);
+        p_remaining->fetch_sub(1U, etl::memory_order_release);
+      }
+
+    private:
+
+      TJob*                p_job;
+      size_t               index;
+      etl::atomic<size_t>* p_remaining;
+    };
+
+    //*************************************************************************
+    /// Runs parts 1 to count - 1 on the executor and part 0 on the caller,
+    /// then waits for them all.
+    //*************************************************************************
+    template <typename TJob>
+    void run(const etl::parallel_executor& executor, TJob& job, size_t count)
+    {
+      if (count > 1U)
+      {
+        etl::atomic<size_t> remaining(count - 1U);
+        task<TJob>          tasks[ETL_PARALLEL_MAX_TASKS];
+
+        for (size_t i = 1U; i < count; ++i)
+        {
+          tasks[i].set(job, i, remaining);
+          executor.submit(etl::parallel_executor::task_type::create<task<TJob>, &task<TJob>::run>(tasks[i]));
+        }
+
+        job.run(0U);
+        executor.wait_for(remaining);
+      }
+      else
+      {
+        job.run(0U);
+      }
+    }
+
+    //*************************************************************************
+    /// The common part of the jobs.
+    //*************************************************************************
+    template <typename TIterator>
+    struct range_job
+    {
+      range_job(TIterator first_, size_t length_, size_t count_)
+        : first(first_)
+        , length(length_)
+        , count(count_)
+      {
+      }
+
+      TIterator begin(size_t i) const
+      {
+        return etl::next(first, ptrdiff_t(part_begin(length, count, i)));
+      }
+
+      TIterator end(size_t i) const
+      {
+        return etl::next(first, ptrdiff_t(part_begin(length, count, i + 1U)));
+      }
+
+      TIterator    first;
+      const size_t length;
+      const size_t count;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TFunction>
+    struct for_each_job : public range_job<TIterator>
+    {
+      for_each_job(TIterator first_, size_t length_, size_t count_, TFunction function_)
+        : range_job<TIterator>(first_, length_, count_)
+        , function(function_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        etl::for_each(this->begin(i), this->end(i), function);
+      }
+
+      TFunction function;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator, typename TFunction>
+    struct transform_job : public range_job<TInputIterator>
+    {
+      transform_job(TInputIterator first_, size_t length_, size_t count_, TOutputIterator output_, TFunction function_)
+        : range_job<TInputIterator>(first_, length_, count_)
+        , output(output_)
+        , function(function_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        etl::transform(this->begin(i), this->end(i), etl::next(output, ptrdiff_t(part_begin(this->length, this->count, i))), function);
+      }
+
+      TOutputIterator output;
+      TFunction       function;
+    };
+
+    //*************************************************************************
+    template <typename TInputIterator, typename TOutputIterator>
+    struct copy_job : public range_job<TInputIterator>
+    {
+      copy_job(TInputIterator first_, size_t length_, size_t count_, TOutputIterator output_)
+        : range_job<TInputIterator>(first_, length_, count_)
+        , output(output_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        etl::copy(this->begin(i), this->end(i), etl::next(output, ptrdiff_t(part_begin(this->length, this->count, i))));
+      }
+
+      TOutputIterator output;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TPredicate>
+    struct count_if_job : public range_job<TIterator>
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+
+      count_if_job(TIterator first_, size_t length_, size_t count_, TPredicate predicate_)
+        : range_job<TIterator>(first_, length_, count_)
+        , predicate(predicate_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        counts[i] = etl::count_if(this->begin(i), this->end(i), predicate);
+      }
+
+      TPredicate      predicate;
+      difference_type counts[ETL_PARALLEL_MAX_TASKS];
+    };
+
+    //*************************************************************************
+    /// Each part is reduced from its first element, so that 'init' is only
+    /// used once.
+    //*************************************************************************
+    template <typename TIterator, typename T, typename TOperation>
+    struct reduce_job : public range_job<TIterator>
+    {
+      reduce_job(TIterator first_, size_t length_, size_t count_, TOperation operation_)
+        : range_job<TIterator>(first_, length_, count_)
+        , operation(operation_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        TIterator itr  = this->begin(i);
+        TIterator last = this->end(i);
+
+        T* p_sum = ::new (static_cast<void*>(&sums[int(i)])) T(*itr);
+
+        while (++itr != last)
+        {
+          *p_sum = operation(*p_sum, *itr);
+        }
+      }
+
+      TOperation                                           operation;
+      etl::uninitialized_buffer_of<T, ETL_PARALLEL_MAX_TASKS> sums;
+    };
+
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct sort_job : public range_job<TIterator>
+    {
+      sort_job(TIterator first_, size_t length_, size_t count_, TCompare compare_)
+        : range_job<TIterator>(first_, length_, count_)
+        , compare(compare_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        etl::sort(this->begin(i), this->end(i), compare);
+      }
+
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Merges pairs of sorted parts, each 'width' parts wide, in place.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    struct merge_job
+    {
+      typedef typename etl::iterator_traits<TIterator>::difference_type difference_type;
+      typedef typename etl::iterator_traits<TIterator>::value_type      value_type;
+
+      merge_job(const range_job<TIterator>& parts_, size_t width_, TCompare compare_)
+        : parts(parts_)
+        , width(width_)
+        , compare(compare_)
+      {
+      }
+
+      void run(size_t i)
+      {
+        const size_t left   = i * 2U * width;
+        const size_t middle = left + width;
+        const size_t right  = ((middle + width) < parts.count) ? (middle + width) : parts.count;
+
+        TIterator first = parts.begin(left);
+        TIterator mid   = parts.begin(middle);
+        TIterator last  = parts.begin(right);
+
+        if ((mid != last) && compare(*mid, *etl::prev(mid)))
+        {
+          // No buffer, so the merge is done in place.
+          private_merge_sort::merge_adaptive(first, mid, last,
+                                             difference_type(mid - first), difference_type(last - mid),
+                                             static_cast<value_type*>(ETL_NULLPTR), difference_type(0),
+                                             compare);
+        }
+      }
+
+      const range_job<TIterator>& parts;
+      const size_t                width;
+      TCompare                    compare;
+    };
+  }
+
+  //***************************************************************************
+  /// Calls 'function' for each element, in parallel.
+  /// Each part has its own copy of 'function'.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TFunction>
+  void for_each(const etl::parallel_executor& executor, TIterator first, TIterator last, TFunction function)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    private_parallel::for_each_job<TIterator, TFunction> job(first, length, executor.parts(length), function);
+    private_parallel::run(executor, job, job.count);
+  }
+
+  //***************************************************************************
+  /// Transforms each element, in parallel.
+  /// Requires random access output iterators.
+  ///\return An iterator to the end of the output.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator, typename TFunction>
+  TOutputIterator transform(const etl::parallel_executor& executor, TInputIterator first, TInputIterator last, TOutputIterator output, TFunction function)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    private_parallel::transform_job<TInputIterator, TOutputIterator, TFunction> job(first, length, executor.parts(length), output, function);
+    private_parallel::run(executor, job, job.count);
+
+    return etl::next(output, ptrdiff_t(length));
+  }
+
+  //***************************************************************************
+  /// Copies the elements, in parallel.
+  /// Requires random access output iterators.
+  ///\return An iterator to the end of the output.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TInputIterator, typename TOutputIterator>
+  TOutputIterator copy(const etl::parallel_executor& executor, TInputIterator first, TInputIterator last, TOutputIterator output)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    private_parallel::copy_job<TInputIterator, TOutputIterator> job(first, length, executor.parts(length), output);
+    private_parallel::run(executor, job, job.count);
+
+    return etl::next(output, ptrdiff_t(length));
+  }
+
+  //***************************************************************************
+  /// Counts the elements for which 'predicate' is true, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TPredicate>
+  typename etl::iterator_traits<TIterator>::difference_type
+    count_if(const etl::parallel_executor& executor, TIterator first, TIterator last, TPredicate predicate)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    private_parallel::count_if_job<TIterator, TPredicate> job(first, length, executor.parts(length), predicate);
+    private_parallel::run(executor, job, job.count);
+
+    typename etl::iterator_traits<TIterator>::difference_type total = 0;
+
+    for (size_t i = 0U; i < job.count; ++i)
+    {
+      total += job.counts[i];
+    }
+
+    return total;
+  }
+
+  //***************************************************************************
+  /// Reduces the elements with 'operation', in parallel.
+  /// The parts are combined in order, but the grouping is not defined, so
+  /// 'operation' must be associative.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TOperation>
+  T reduce(const etl::parallel_executor& executor, TIterator first, TIterator last, T init, TOperation operation)
+  {
+    const size_t length = size_t(etl::distance(first, last));
+
+    if (length == 0U)
+    {
+      return init;
+    }
+
+    private_parallel::reduce_job<TIterator, T, TOperation> job(first, length, executor.parts(length), operation);
+    private_parallel::run(executor, job, job.count);
+
+    for (size_t i = 0U; i < job.count; ++i)
+    {
+      init = job.operation(init, job.sums[int(i)]);
+      job.sums[int(i)].~T();
+    }
+
+    return init;
+  }
+
+  //***************************************************************************
+  /// Sums the elements, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T reduce(const etl::parallel_executor& executor, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(executor, first, last, init, etl::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Accumulates the elements, in parallel.
+  /// The same as etl::reduce, so 'operation' must be associative.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T, typename TOperation>
+  T accumulate(const etl::parallel_executor& executor, TIterator first, TIterator last, T init, TOperation operation)
+  {
+    return etl::reduce(executor, first, last, init, operation);
+  }
+
+  //***************************************************************************
+  /// Sums the elements, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename T>
+  T accumulate(const etl::parallel_executor& executor, TIterator first, TIterator last, T init)
+  {
+    return etl::reduce(executor, first, last, init, etl::plus<T>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, in parallel.
+  /// Each part is sorted, then pairs of parts are merged in place, in parallel,
+  /// until one remains. Not stable. Requires random access iterators.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void sort(const etl::parallel_executor& executor, TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(etl::is_random_access_iterator<TIterator>::value, "Parallel sort requires random access iterators");
+
+    const size_t length = size_t(etl::distance(first, last));
+
+    private_parallel::sort_job<TIterator, TCompare> job(first, length, executor.parts(length), compare);
+    private_parallel::run(executor, job, job.count);
+
+    for (size_t width = 1U; width < job.count; width *= 2U)
+    {
+      // The pairs that have a right hand part.
+      const size_t pairs = (job.count - width + (2U * width) - 1U) / (2U * width);
+
+      private_parallel::merge_job<TIterator, TCompare> merge(job, width, compare);
+      private_parallel::run(executor, merge, pairs);
+    }
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, in parallel.
+  ///\ingroup parallel_algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(const etl::parallel_executor& executor, TIterator first, TIterator last)
+  {
+    etl::sort(executor, first, last, etl::less<typename etl::iterator_traits<TIterator>::value_type>());
+  }
+}
+
+#endif
+
+#endif
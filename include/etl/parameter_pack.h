@@ -31,6 +31,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "type_traits.h"
+#include "nth_type.h"
 
 #include <stdint.h>
 
@@ -57,6 +58,7 @@ namespace etl
     template <typename T>
     class index_of_type
     {
+#if !ETL_USING_CPP14
     private:
 
       //***********************************
@@ -72,13 +74,18 @@ namespace etl
       {
         static constexpr size_t value = 1;
       };
+#endif
 
     public:
 
       static_assert(etl::is_one_of<T, TTypes...>::value, "T is not in parameter pack");
 
       /// The index value.
+#if ETL_USING_CPP14
+      static constexpr size_t value = etl::private_type_traits::index_of_first_true<etl::is_same<T, TTypes>::value...>();
+#else
       static constexpr size_t value = index_of_type_helper<T, TTypes...>::value - 1;
+#endif
     };
 
 #if ETL_USING_CPP17
@@ -92,28 +99,12 @@ namespace etl
     template <size_t I>
     class type_from_index
     {
-    private:
-
-      //***********************************
-      template <size_t II, size_t N, typename T1, typename... TRest>
-      struct type_from_index_helper
-      {
-        using type = typename etl::conditional<II == N, T1, typename type_from_index_helper<II, N + 1, TRest...>::type>::type;
-      };
-
-      //***********************************
-      template <size_t II, size_t N, typename T1>
-      struct type_from_index_helper<II, N, T1>
-      {
-        using type = T1;
-      };
-
     public:
 
       static_assert(I < sizeof...(TTypes), "Index out of bounds of parameter pack");
 
       /// Template alias
-      using type = typename type_from_index_helper<I, 0, TTypes...>::type;
+      using type = typename etl::nth_type<I, TTypes...>::type;
     };
 
     //***********************************
@@ -0,0 +1,455 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PENDING_REQUEST_TABLE_INCLUDED
+#define ETL_PENDING_REQUEST_TABLE_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "smallest.h"
+#include "power.h"
+#include "log.h"
+#include "delegate.h"
+#include "message.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+///\defgroup pending_request_table pending_request_table
+/// A table of outstanding requests, for request/response protocols.
+///\ingroup containers
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// A table of outstanding requests keyed by transaction id, each with a
+  /// timeout and a completion delegate.
+  /// Lookup by id uses an open addressed hash table, and the timeouts are kept
+  /// in a hierarchical timing wheel, so add, complete and cancel are O(1) and
+  /// tick is amortised O(1) per expired request, whatever the number in flight.
+  /// The completion delegate is called with the response when the request is
+  /// completed, or with a null pointer when it times out. The request is
+  /// removed before the delegate is called, so the delegate may add requests.
+  /// Not interrupt safe. Requires C++11 for the two parameter delegate.
+  ///\tparam VN              The maximum number of outstanding requests.
+  ///\tparam TTransaction_Id The integral transaction id type.
+  ///\tparam VLevel_Bits     The number of bits per level of the timing wheel.
+  ///\ingroup pending_request_table
+  //***************************************************************************
+  template <size_t VN, typename TTransaction_Id = uint32_t, size_t VLevel_Bits = 6U>
+  class pending_request_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VN > 0U, "The table must hold at least one request");
+    ETL_STATIC_ASSERT(etl::is_integral<TTransaction_Id>::value, "The transaction id must be integral");
+
+    typedef TTransaction_Id                                               transaction_id_type;
+    typedef etl::delegate<void(transaction_id_type, const etl::imessage*)> callback_type;
+    typedef size_t                                                        size_type;
+
+    static ETL_CONSTANT size_t MAX_REQUESTS = VN;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    pending_request_table()
+      : wheel(requests, index_type(MAX_REQUESTS))
+      , free_head(No_Index)
+      , count(0U)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Adds a request that times out after 'timeout' ticks.
+    /// A zero timeout expires on the next call to tick.
+    /// Returns <b>false</b> if the table is full or the id is already pending.
+    //*************************************************************************
+    bool add(transaction_id_type id, uint32_t timeout, const callback_type& callback)
+    {
+      if ((free_head == No_Index) || (find_slot(id) != No_Slot))
+      {
+        return false;
+      }
+
+      const index_type index = free_head;
+      request_data& request  = requests[index];
+      free_head = request.next;
+
+      request.id       = id;
+      request.callback = callback;
+      request.next     = No_Index;
+
+      insert_slot(index);
+      wheel.insert(index, timeout);
+      ++count;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Completes a pending request with its response.
+    /// Calls the completion delegate with the response.
+    /// Returns <b>false</b> if the id is not pending, such as for a late or
+    /// duplicate response.
+    //*************************************************************************
+    bool complete(transaction_id_type id, const etl::imessage& response)
+    {
+      const size_t slot = find_slot(id);
+
+      if (slot == No_Slot)
+      {
+        return false;
+      }
+
+      const index_type index = slots[slot];
+      wheel.remove(index);
+      finish(index, slot, &response);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Removes a pending request without calling its delegate.
+    /// Returns <b>false</b> if the id is not pending.
+    //*************************************************************************
+    bool cancel(transaction_id_type id)
+    {
+      const size_t slot = find_slot(id);
+
+      if (slot == No_Slot)
+      {
+        return false;
+      }
+
+      const index_type index = slots[slot];
+      wheel.remove(index);
+      erase_slot(slot);
+      release(index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Checks whether a request is pending.
+    //*************************************************************************
+    bool is_pending(transaction_id_type id) const
+    {
+      return find_slot(id) != No_Slot;
+    }
+
+    //*************************************************************************
+    /// Advances time by 'ticks' and calls the delegates of the requests that
+    /// have timed out.
+    /// Returns <b>true</b> if any requests timed out.
+    //*************************************************************************
+    bool tick(uint32_t ticks)
+    {
+      // Requests added with no timeout.
+      bool timed_out = process_expired();
+
+      while (wheel.advance(ticks))
+      {
+        timed_out = process_expired() || timed_out;
+      }
+
+      return timed_out;
+    }
+
+    //*************************************************************************
+    /// The number of ticks until the next request times out.
+    /// O(N) in the maximum number of requests.
+    /// Returns etl::timer::state::Inactive if there are no requests.
+    //*************************************************************************
+    uint32_t time_to_next() const
+    {
+      return wheel.time_to_next();
+    }
+
+    //*************************************************************************
+    /// Removes all requests without calling their delegates.
+    //*************************************************************************
+    void clear()
+    {
+      wheel.clear();
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The number of pending requests.
+    //*************************************************************************
+    size_type size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks whether there are no pending requests.
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the table is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return count == MAX_REQUESTS;
+    }
+
+    //*************************************************************************
+    /// The maximum number of pending requests.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_REQUESTS;
+    }
+
+    //*************************************************************************
+    /// The number of requests that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_REQUESTS - count;
+    }
+
+  private:
+
+    typedef typename etl::smallest_uint_for_value<VN>::type index_type;
+
+    //*************************************************************************
+    /// A pending request.
+    /// 'next' links the free list when the request is not in the wheel.
+    //*************************************************************************
+    struct request_data
+    {
+      callback_type       callback;
+      transaction_id_type id;
+      uint32_t            expiry;
+      uint16_t            slot;
+      index_type          previous;
+      index_type          next;
+    };
+
+    typedef etl::private_timer_wheel::timer_wheel<request_data, VLevel_Bits, index_type> wheel_type;
+
+    static ETL_CONSTANT index_type No_Index  = wheel_type::No_Id;
+    static ETL_CONSTANT size_t     Hash_Size = size_t(etl::power_of_2_round_up<2U * VN>::value);
+    static ETL_CONSTANT size_t     Hash_Bits = size_t(etl::log2<Hash_Size>::value);
+    static ETL_CONSTANT size_t     Hash_Mask = Hash_Size - 1U;
+    static ETL_CONSTANT size_t     No_Slot   = Hash_Size;
+
+    //*************************************************************************
+    /// Resets the requests, free list and hash table.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < MAX_REQUESTS; ++i)
+      {
+        request_data& request = requests[i];
+
+        request.callback = callback_type();
+        request.slot     = wheel_type::No_Slot;
+        request.previous = No_Index;
+        request.next     = (i + 1U < MAX_REQUESTS) ? index_type(i + 1U) : No_Index;
+      }
+
+      for (size_t i = 0U; i < Hash_Size; ++i)
+      {
+        slots[i] = No_Index;
+      }
+
+      free_head = 0U;
+      count     = 0U;
+    }
+
+    //*************************************************************************
+    /// The home slot of an id, by Fibonacci hashing.
+    //*************************************************************************
+    static size_t home_slot(transaction_id_type id)
+    {
+      typedef typename etl::make_unsigned<transaction_id_type>::type unsigned_id_type;
+
+      const unsigned_id_type key = id;
+
+      // Fold ids wider than 32 bits.
+      const uint32_t folded = static_cast<uint32_t>((key ^ ((key >> 16U) >> 16U)) & 0xFFFFFFFFULL);
+
+      const uint32_t hash = static_cast<uint32_t>(folded * 2654435769ULL);
+
+      return hash >> (32U - Hash_Bits);
+    }
+
+    //*************************************************************************
+    /// The hash table slot of a pending id, or No_Slot.
+    //*************************************************************************
+    size_t find_slot(transaction_id_type id) const
+    {
+      size_t slot = home_slot(id);
+
+      while (slots[slot] != No_Index)
+      {
+        if (requests[slots[slot]].id == id)
+        {
+          return slot;
+        }
+
+        slot = (slot + 1U) & Hash_Mask;
+      }
+
+      return No_Slot;
+    }
+
+    //*************************************************************************
+    /// Adds a request to the hash table.
+    //*************************************************************************
+    void insert_slot(index_type index)
+    {
+      size_t slot = home_slot(requests[index].id);
+
+      while (slots[slot] != No_Index)
+      {
+        slot = (slot + 1U) & Hash_Mask;
+      }
+
+      slots[slot] = index;
+    }
+
+    //*************************************************************************
+    /// Removes a request from the hash table.
+    /// Moves back any following entries that would no longer be found, so
+    /// there are no tombstones and lookups stay short.
+    //*************************************************************************
+    void erase_slot(size_t hole)
+    {
+      size_t slot = (hole + 1U) & Hash_Mask;
+
+      while (slots[slot] != No_Index)
+      {
+        const size_t home = home_slot(requests[slots[slot]].id);
+
+        if (((slot - home) & Hash_Mask) >= ((slot - hole) & Hash_Mask))
+        {
+          slots[hole] = slots[slot];
+          hole = slot;
+        }
+
+        slot = (slot + 1U) & Hash_Mask;
+      }
+
+      slots[hole] = No_Index;
+    }
+
+    //*************************************************************************
+    /// Returns a request to the free list.
+    //*************************************************************************
+    void release(index_type index)
+    {
+      request_data& request = requests[index];
+
+      request.callback = callback_type();
+      request.next     = free_head;
+      free_head        = index;
+      --count;
+    }
+
+    //*************************************************************************
+    /// Removes a request that has left the wheel and calls its delegate.
+    //*************************************************************************
+    void finish(index_type index, size_t slot, const etl::imessage* p_response)
+    {
+      const transaction_id_type id       = requests[index].id;
+      const callback_type       callback = requests[index].callback;
+
+      erase_slot(slot);
+      release(index);
+
+      if (callback.is_valid())
+      {
+        callback(id, p_response);
+      }
+    }
+
+    //*************************************************************************
+    /// Calls the delegates of all of the requests that have timed out.
+    /// Returns <b>true</b> if there were any.
+    //*************************************************************************
+    bool process_expired()
+    {
+      bool timed_out = false;
+
+      index_type index = wheel.pop_expired();
+
+      while (index != No_Index)
+      {
+        finish(index, find_slot(requests[index].id), ETL_NULLPTR);
+        timed_out = true;
+
+        index = wheel.pop_expired();
+      }
+
+      return timed_out;
+    }
+
+    request_data requests[MAX_REQUESTS];
+    index_type   slots[Hash_Size];
+    wheel_type   wheel;
+    index_type   free_head;
+    size_type    count;
+  };
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT size_t pending_request_table<VN, TTransaction_Id, VLevel_Bits>::MAX_REQUESTS;
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT typename pending_request_table<VN, TTransaction_Id, VLevel_Bits>::index_type pending_request_table<VN, TTransaction_Id, VLevel_Bits>::No_Index;
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT size_t pending_request_table<VN, TTransaction_Id, VLevel_Bits>::Hash_Size;
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT size_t pending_request_table<VN, TTransaction_Id, VLevel_Bits>::Hash_Bits;
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT size_t pending_request_table<VN, TTransaction_Id, VLevel_Bits>::Hash_Mask;
+
+  template <size_t VN, typename TTransaction_Id, size_t VLevel_Bits>
+  ETL_CONSTANT size_t pending_request_table<VN, TTransaction_Id, VLevel_Bits>::No_Slot;
+}
+
+#endif
+#endif
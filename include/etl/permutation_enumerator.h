@@ -0,0 +1,314 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERMUTATION_ENUMERATOR_INCLUDED
+#define ETL_PERMUTATION_ENUMERATOR_INCLUDED
+
+#include "platform.h"
+#include "array.h"
+#include "iterator.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+///\defgroup permutation_enumerator permutation_enumerator
+/// Enumerates the permutations of N elements using Heap's algorithm.
+///\ingroup maths
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup permutation_enumerator
+  /// Enumerates the permutations of {0 .. N-1} using Heap's algorithm.
+  /// Each step swaps one pair of positions, so a cost can be updated
+  /// incrementally, and the same swap can be applied to the caller's data.
+  /// rank() and unrank() allow the sequence to be split into ranges, such as
+  /// one per thread.
+  ///\tparam N The number of elements.
+  //***************************************************************************
+  template <size_t N>
+  class permutation_enumerator
+  {
+  public:
+
+    ETL_STATIC_ASSERT((N <= 12U) || ((sizeof(size_t) >= 8U) && (N <= 20U)), "N! does not fit in size_t");
+
+    typedef typename etl::smallest_uint_for_value<(N == 0U) ? 0U : N - 1U>::type index_type;
+
+    static ETL_CONSTANT size_t Npos = N;
+
+    //*************************************************************************
+    /// Constructs at the first permutation, the identity.
+    //*************************************************************************
+    permutation_enumerator()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructs at the permutation with rank 'r'.
+    //*************************************************************************
+    explicit permutation_enumerator(size_t r)
+    {
+      unrank(r);
+    }
+
+    //*************************************************************************
+    /// Returns to the first permutation.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t p = 0U; p < N; ++p)
+      {
+        indices[p] = index_type(p);
+        counters[p] = index_type(0U);
+      }
+
+      level        = 1U;
+      first_index  = Npos;
+      second_index = Npos;
+    }
+
+    //*************************************************************************
+    /// Steps to the next permutation, swapping one pair of positions.
+    /// Returns false, and returns to the first permutation, if the current
+    /// permutation was the last.
+    //*************************************************************************
+    bool next()
+    {
+      while (level < N)
+      {
+        if (counters[level] < level)
+        {
+          swap_at(level, counters[level]);
+          ++counters[level];
+          level = 1U;
+
+          return true;
+        }
+
+        counters[level] = index_type(0U);
+        ++level;
+      }
+
+      reset();
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Steps to the next permutation, applying the same swap to the range
+    /// starting at 'first'.
+    /// Returns false, and leaves the range unchanged, if the current
+    /// permutation was the last.
+    //*************************************************************************
+    template <typename TIterator>
+    bool next(TIterator first)
+    {
+      if (next())
+      {
+        using ETL_OR_STD::swap;
+
+        TIterator a = first;
+        TIterator b = first;
+        etl::advance(a, first_index);
+        etl::advance(b, second_index);
+        swap(*a, *b);
+
+        return true;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// The element at position 'p'.
+    //*************************************************************************
+    size_t operator [](size_t p) const
+    {
+      return indices[p];
+    }
+
+    //*************************************************************************
+    /// The current permutation.
+    //*************************************************************************
+    const etl::array<index_type, N>& permutation() const
+    {
+      return indices;
+    }
+
+    //*************************************************************************
+    /// The positions swapped by the last step, or Npos.
+    //*************************************************************************
+    size_t first_swapped() const
+    {
+      return first_index;
+    }
+
+    size_t second_swapped() const
+    {
+      return second_index;
+    }
+
+    //*************************************************************************
+    /// The position of the current permutation in the sequence.
+    /// The counters are the digits of the rank in the factorial number system.
+    //*************************************************************************
+    size_t rank() const
+    {
+      size_t r      = 0U;
+      size_t weight = 1U;
+
+      for (size_t i = 1U; i < N; ++i)
+      {
+        weight *= i;
+        r      += counters[i] * weight;
+      }
+
+      return r;
+    }
+
+    //*************************************************************************
+    /// Sets the permutation to the one at position 'r' in the sequence.
+    /// Takes O(N^2) steps, rather than the r steps needed with next().
+    //*************************************************************************
+    void unrank(size_t r)
+    {
+      reset();
+
+      for (size_t i = (N == 0U) ? 0U : N - 1U; i > 0U; --i)
+      {
+        const size_t f     = factorial(i);
+        const size_t digit = r / f;
+        r %= f;
+
+        // Each digit is a complete pass over the first i positions, then a swap.
+        for (size_t j = 0U; j < digit; ++j)
+        {
+          apply_complete_pass(i);
+          swap_at(i, j);
+        }
+
+        counters[i] = index_type(digit);
+      }
+
+      first_index  = Npos;
+      second_index = Npos;
+    }
+
+    //*************************************************************************
+    /// The number of permutations.
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t size()
+    {
+      return factorial(N);
+    }
+
+  private:
+
+    //*************************************************************************
+    static ETL_CONSTEXPR14 size_t factorial(size_t n)
+    {
+      size_t result = 1U;
+
+      for (size_t i = 2U; i <= n; ++i)
+      {
+        result *= i;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Heap's swap for the counter at level 'i'.
+    //*************************************************************************
+    void swap_at(size_t i, size_t j)
+    {
+      first_index  = ((i % 2U) == 0U) ? 0U : j;
+      second_index = i;
+
+      const index_type temp = indices[first_index];
+      indices[first_index]  = indices[second_index];
+      indices[second_index] = temp;
+    }
+
+    //*************************************************************************
+    /// Applies the net effect of enumerating all permutations of the first
+    /// 'k' positions.
+    /// Odd k (and 2) swaps the first and last.
+    /// Even k of 4 or more maps a[0..k-1] to
+    /// a[k-3], a[k-2], a[1] .. a[k-4], a[k-1], a[0].
+    //*************************************************************************
+    void apply_complete_pass(size_t k)
+    {
+      if (k < 2U)
+      {
+        return;
+      }
+
+      if (((k % 2U) != 0U) || (k == 2U))
+      {
+        const index_type temp = indices[0U];
+        indices[0U]     = indices[k - 1U];
+        indices[k - 1U] = temp;
+      }
+      else
+      {
+        const index_type a0 = indices[0U];
+        const index_type a3 = indices[k - 3U];
+        const index_type a2 = indices[k - 2U];
+        const index_type a1 = indices[k - 1U];
+
+        for (size_t p = k - 3U; p >= 2U; --p)
+        {
+          indices[p] = indices[p - 1U];
+        }
+
+        indices[0U]     = a3;
+        indices[1U]     = a2;
+        indices[k - 2U] = a1;
+        indices[k - 1U] = a0;
+      }
+    }
+
+    etl::array<index_type, N> indices;
+    etl::array<index_type, N> counters;
+    size_t                    level;
+    size_t                    first_index;
+    size_t                    second_index;
+  };
+
+  template <size_t N>
+  ETL_CONSTANT size_t permutation_enumerator<N>::Npos;
+}
+
+#endif
@@ -0,0 +1,467 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERSISTENT_FLAT_MAP_INCLUDED
+#define ETL_PERSISTENT_FLAT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "persistent_vector.h"
+#include "private/persistent_header.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity sorted map that may be placed in persistent storage.
+  /// The elements are held in key order in a persistent_vector, so lookup is
+  /// a binary search and insert and erase move the elements above them.
+  /// The default constructor does not touch the storage; call attach() or
+  /// format() before use.
+  ///\tparam TKey       The key type. Must be trivially copyable.
+  ///\tparam TMapped    The mapped type. Must be trivially copyable.
+  ///\tparam VMax_Size  The maximum number of elements.
+  ///\tparam TKeyCompare The key comparison functor.
+  ///\ingroup persistent
+  //***************************************************************************
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare = etl::less<TKey> >
+  class persistent_flat_map
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TKey>::value,    "persistent_flat_map requires a trivially copyable key");
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<TMapped>::value, "persistent_flat_map requires a trivially copyable mapped type");
+
+    typedef TKey        key_type;
+    typedef TMapped     mapped_type;
+    typedef TKeyCompare key_compare;
+
+    //*************************************************************************
+    /// The element type.
+    /// A plain struct rather than a pair, so that it is trivially copyable.
+    /// The key must not be modified through an iterator.
+    //*************************************************************************
+    struct value_type
+    {
+      key_type    first;
+      mapped_type second;
+    };
+
+  private:
+
+    typedef etl::persistent_vector<value_type, VMax_Size> storage_type;
+
+  public:
+
+    typedef value_type&                                   reference;
+    typedef const value_type&                             const_reference;
+    typedef value_type*                                   pointer;
+    typedef const value_type*                             const_pointer;
+    typedef typename storage_type::iterator               iterator;
+    typedef typename storage_type::const_iterator         const_iterator;
+    typedef typename storage_type::reverse_iterator       reverse_iterator;
+    typedef typename storage_type::const_reverse_iterator const_reverse_iterator;
+    typedef size_t                                        size_type;
+    typedef ptrdiff_t                                     difference_type;
+
+    static ETL_CONSTANT size_t   MAX_SIZE = VMax_Size;
+    static ETL_CONSTANT uint32_t Magic    = 0x50464D50UL; // "PFMP"
+
+    //*************************************************************************
+    /// Constructor.
+    /// Does not modify the storage, so that a map in RAM that is not
+    /// initialised at start up keeps its contents.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    persistent_flat_map() = default;
+#else
+    persistent_flat_map()
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a map placed in a buffer, such as a memory mapped file.
+    /// The buffer must be at least sizeof(persistent_flat_map) bytes and be
+    /// suitably aligned. Call attach() or format() on the result.
+    //*************************************************************************
+    static persistent_flat_map& from_buffer(void* p_buffer)
+    {
+      return *static_cast<persistent_flat_map*>(p_buffer);
+    }
+
+    //*************************************************************************
+    /// Attaches to the storage.
+    /// Keeps the contents if the storage holds a map with the same layout
+    /// and version, otherwise formats it as empty.
+    ///\return <b>true</b> if the contents were kept.
+    //*************************************************************************
+    bool attach(uint32_t version = 0U)
+    {
+      if (is_valid(version))
+      {
+        return true;
+      }
+
+      format(version);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Formats the storage as an empty map.
+    //*************************************************************************
+    void format(uint32_t version = 0U)
+    {
+      storage.format(version);
+      header.format(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(value_type)));
+    }
+
+    //*************************************************************************
+    /// Checks whether the storage holds a map with the same layout and version.
+    //*************************************************************************
+    bool is_valid(uint32_t version = 0U) const
+    {
+      return header.is_valid(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(value_type))) &&
+             storage.is_valid(version);
+    }
+
+    //*************************************************************************
+    /// Invalidates the storage, so that the next attach() formats it.
+    //*************************************************************************
+    void detach()
+    {
+      header.invalidate();
+      storage.detach();
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    iterator               begin()         { return storage.begin(); }
+    const_iterator         begin() const   { return storage.begin(); }
+    const_iterator         cbegin() const  { return storage.cbegin(); }
+    iterator               end()           { return storage.end(); }
+    const_iterator         end() const     { return storage.end(); }
+    const_iterator         cend() const    { return storage.cend(); }
+    reverse_iterator       rbegin()        { return storage.rbegin(); }
+    const_reverse_iterator rbegin() const  { return storage.rbegin(); }
+    reverse_iterator       rend()          { return storage.rend(); }
+    const_reverse_iterator rend() const    { return storage.rend(); }
+
+    //*************************************************************************
+    /// Returns a reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    mapped_type& at(const key_type& key)
+    {
+      iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(persistent_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the mapped value for the key.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_out_of_bounds if the key is not in the map.
+    //*************************************************************************
+    const mapped_type& at(const key_type& key) const
+    {
+      const_iterator itr = find(key);
+
+      ETL_ASSERT(itr != end(), ETL_ERROR(persistent_out_of_bounds));
+
+      return itr->second;
+    }
+
+    //*************************************************************************
+    /// Inserts a key and mapped value, if the key is not already in the map.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the map is full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const key_type& key, const mapped_type& mapped)
+    {
+      iterator itr = lower_bound(key);
+
+      if ((itr != end()) && !compare(key, itr->first))
+      {
+        return ETL_OR_STD::pair<iterator, bool>(itr, false);
+      }
+
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_full));
+        return ETL_OR_STD::pair<iterator, bool>(end(), false);
+      }
+
+      value_type value;
+      value.first  = key;
+      value.second = mapped;
+
+      return ETL_OR_STD::pair<iterator, bool>(storage.insert(itr, value), true);
+    }
+
+    //*************************************************************************
+    /// Inserts a value, if its key is not already in the map.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference value)
+    {
+      return insert(value.first, value.second);
+    }
+
+    //*************************************************************************
+    /// Inserts a key and mapped value, or assigns the mapped value if the key
+    /// is already in the map.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the map is full.
+    ///\return An iterator to the element with the key and <b>true</b> if it was inserted.
+    //*************************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert_or_assign(const key_type& key, const mapped_type& mapped)
+    {
+      ETL_OR_STD::pair<iterator, bool> result = insert(key, mapped);
+
+      if (!result.second && (result.first != end()))
+      {
+        result.first->second = mapped;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Erases the element with the key.
+    ///\return The number of elements erased.
+    //*************************************************************************
+    size_t erase(const key_type& key)
+    {
+      iterator itr = find(key);
+
+      if (itr == end())
+      {
+        return 0U;
+      }
+
+      storage.erase(itr);
+
+      return 1U;
+    }
+
+    //*************************************************************************
+    /// Erases the element at 'position'.
+    ///\return An iterator to the element after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return storage.erase(position);
+    }
+
+    //*************************************************************************
+    /// Erases the elements in the range.
+    ///\return An iterator to the element after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      return storage.erase(first, last);
+    }
+
+    //*************************************************************************
+    /// Finds the element with the key.
+    ///\return An iterator to the element, or end() if not found.
+    //*************************************************************************
+    iterator find(const key_type& key)
+    {
+      iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !compare(key, itr->first)) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Finds the element with the key.
+    ///\return A const iterator to the element, or end() if not found.
+    //*************************************************************************
+    const_iterator find(const key_type& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !compare(key, itr->first)) ? itr : end();
+    }
+
+    //*************************************************************************
+    /// Checks whether the key is in the map.
+    //*************************************************************************
+    bool contains(const key_type& key) const
+    {
+      return find(key) != end();
+    }
+
+    //*************************************************************************
+    /// Counts the elements with the key.
+    //*************************************************************************
+    size_t count(const key_type& key) const
+    {
+      return contains(key) ? 1U : 0U;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key not less than 'key'.
+    //*************************************************************************
+    iterator lower_bound(const key_type& key)
+    {
+      return etl::lower_bound(begin(), end(), key, key_less(compare));
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the first element with a key not less than 'key'.
+    //*************************************************************************
+    const_iterator lower_bound(const key_type& key) const
+    {
+      return etl::lower_bound(begin(), end(), key, key_less(compare));
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element with a key greater than 'key'.
+    //*************************************************************************
+    iterator upper_bound(const key_type& key)
+    {
+      iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !compare(key, itr->first)) ? itr + 1 : itr;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the first element with a key greater than 'key'.
+    //*************************************************************************
+    const_iterator upper_bound(const key_type& key) const
+    {
+      const_iterator itr = lower_bound(key);
+
+      return ((itr != end()) && !compare(key, itr->first)) ? itr + 1 : itr;
+    }
+
+    //*************************************************************************
+    /// Clears the map.
+    //*************************************************************************
+    void clear()
+    {
+      storage.clear();
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return storage.size();
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return storage.empty();
+    }
+
+    //*************************************************************************
+    /// Checks whether the map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return storage.full();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of elements.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return storage.available();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Compares an element's key with a key.
+    //*************************************************************************
+    struct key_less
+    {
+      explicit key_less(const key_compare& compare_)
+        : kcompare(compare_)
+      {
+      }
+
+      bool operator ()(const value_type& element, const key_type& key) const
+      {
+        return kcompare(element.first, key);
+      }
+
+      const key_compare& kcompare;
+    };
+
+    etl::private_persistent::header header;
+    storage_type                    storage;
+
+    // The comparison is stateless and not part of the stored layout.
+    static key_compare              compare;
+  };
+
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  TKeyCompare persistent_flat_map<TKey, TMapped, VMax_Size, TKeyCompare>::compare;
+
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  ETL_CONSTANT size_t persistent_flat_map<TKey, TMapped, VMax_Size, TKeyCompare>::MAX_SIZE;
+
+  template <typename TKey, typename TMapped, size_t VMax_Size, typename TKeyCompare>
+  ETL_CONSTANT uint32_t persistent_flat_map<TKey, TMapped, VMax_Size, TKeyCompare>::Magic;
+}
+
+#endif
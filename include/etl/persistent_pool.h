@@ -0,0 +1,410 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERSISTENT_POOL_INCLUDED
+#define ETL_PERSISTENT_POOL_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "private/persistent_header.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity pool that may be placed in persistent storage.
+  /// The free list is a list of indexes, not pointers, so the pool may be
+  /// mapped at a different address each time. Objects are best referred to
+  /// by index (index_of / at) when the reference is itself persistent.
+  /// Slots are linked in to the free list as they are first needed, as with
+  /// etl::pool, so formatting is O(1).
+  /// The default constructor does not touch the storage; call attach() or
+  /// format() before use.
+  ///\tparam T          The object type. Must be trivially copyable.
+  ///\tparam VMax_Size  The number of objects.
+  ///\ingroup persistent
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  class persistent_pool
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "persistent_pool requires a trivially copyable type");
+    ETL_STATIC_ASSERT(VMax_Size > 0U, "Zero capacity persistent_pool");
+    ETL_STATIC_ASSERT(VMax_Size < 0xFFFFFFFEUL, "Capacity too large");
+
+    typedef T        value_type;
+    typedef T*       pointer;
+    typedef const T* const_pointer;
+    typedef size_t   size_type;
+
+    static ETL_CONSTANT size_t   MAX_SIZE = VMax_Size;
+    static ETL_CONSTANT uint32_t Magic    = 0x50504F4CUL; // "PPOL"
+
+    /// The index returned for a pointer that is not in the pool.
+    static ETL_CONSTANT uint32_t Null_Index = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    /// Constructor.
+    /// Does not modify the storage, so that a pool in RAM that is not
+    /// initialised at start up keeps its contents.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    persistent_pool() = default;
+#else
+    persistent_pool()
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a pool placed in a buffer, such as a memory mapped file.
+    /// The buffer must be at least sizeof(persistent_pool) bytes and be
+    /// suitably aligned. Call attach() or format() on the result.
+    //*************************************************************************
+    static persistent_pool& from_buffer(void* p_buffer)
+    {
+      return *static_cast<persistent_pool*>(p_buffer);
+    }
+
+    //*************************************************************************
+    /// Attaches to the storage.
+    /// Keeps the allocations if the storage holds a pool with the same layout
+    /// and version, otherwise formats it as empty.
+    ///\return <b>true</b> if the allocations were kept.
+    //*************************************************************************
+    bool attach(uint32_t version = 0U)
+    {
+      if (is_valid(version))
+      {
+        return true;
+      }
+
+      format(version);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Formats the storage as an empty pool.
+    //*************************************************************************
+    void format(uint32_t version = 0U)
+    {
+      items_allocated   = 0U;
+      items_initialised = 0U;
+      free_head         = Null_Index;
+      header.format(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(T)));
+    }
+
+    //*************************************************************************
+    /// Checks whether the storage holds a pool with the same layout and version.
+    //*************************************************************************
+    bool is_valid(uint32_t version = 0U) const
+    {
+      return header.is_valid(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(T))) &&
+             (items_allocated   <= items_initialised) &&
+             (items_initialised <= VMax_Size) &&
+             ((free_head == Null_Index) || (free_head < items_initialised));
+    }
+
+    //*************************************************************************
+    /// Invalidates the storage, so that the next attach() formats it.
+    //*************************************************************************
+    void detach()
+    {
+      header.invalidate();
+    }
+
+    //*************************************************************************
+    /// Allocates storage for an object.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the pool is empty.
+    ///\return A pointer to the storage, or ETL_NULLPTR.
+    //*************************************************************************
+    T* allocate()
+    {
+      uint32_t index = Null_Index;
+
+      if (free_head != Null_Index)
+      {
+        index     = free_head;
+        free_head = next[index];
+      }
+      else if (items_initialised < VMax_Size)
+      {
+        index = items_initialised++;
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_full));
+        return ETL_NULLPTR;
+      }
+
+      next[index] = Allocated;
+      ++items_allocated;
+
+      return address_of(index);
+    }
+
+    //*************************************************************************
+    /// Allocates and constructs an object.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the pool is empty.
+    //*************************************************************************
+    T* create()
+    {
+      T* p = allocate();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocates and constructs an object from a value.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the pool is empty.
+    //*************************************************************************
+    T* create(const T& value)
+    {
+      T* p = allocate();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(value);
+      }
+
+      return p;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Allocates and constructs an object from arguments.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the pool is empty.
+    //*************************************************************************
+    template <typename... TArgs>
+    T* emplace(TArgs&&... args)
+    {
+      T* p = allocate();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) T(etl::forward<TArgs>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the storage of an object.
+    /// Trivially copyable objects need no destruction.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_out_of_bounds if the object is not allocated from the pool.
+    //*************************************************************************
+    void release(const T* p)
+    {
+      const uint32_t index = index_of(p);
+
+      if ((index == Null_Index) || (next[index] != Allocated))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_out_of_bounds));
+        return;
+      }
+
+      next[index] = free_head;
+      free_head   = index;
+      --items_allocated;
+    }
+
+    //*************************************************************************
+    /// Releases the storage of an object.
+    //*************************************************************************
+    void destroy(const T* p)
+    {
+      release(p);
+    }
+
+    //*************************************************************************
+    /// Gets the index of an object in the pool.
+    /// The index stays valid when the storage is mapped at another address.
+    ///\return The index, or Null_Index if the pointer is not to an object in the pool.
+    //*************************************************************************
+    uint32_t index_of(const T* p) const
+    {
+      const T* p_begin = address_of(0U);
+
+      if ((p < p_begin) || (p >= (p_begin + VMax_Size)))
+      {
+        return Null_Index;
+      }
+
+      return uint32_t(p - p_begin);
+    }
+
+    //*************************************************************************
+    /// Gets the object at an index.
+    ///\return A pointer to the object, or ETL_NULLPTR if the index is not allocated.
+    //*************************************************************************
+    T* at(uint32_t index)
+    {
+      return is_allocated(index) ? address_of(index) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the object at an index.
+    ///\return A const pointer to the object, or ETL_NULLPTR if the index is not allocated.
+    //*************************************************************************
+    const T* at(uint32_t index) const
+    {
+      return is_allocated(index) ? address_of(index) : ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Checks whether the object at an index is allocated.
+    /// For finding the live objects after a warm start.
+    //*************************************************************************
+    bool is_allocated(uint32_t index) const
+    {
+      return (index < items_initialised) && (next[index] == Allocated);
+    }
+
+    //*************************************************************************
+    /// Checks whether the pointer is to an object in the pool.
+    //*************************************************************************
+    bool is_in_pool(const T* p) const
+    {
+      return index_of(p) != Null_Index;
+    }
+
+    //*************************************************************************
+    /// Releases all of the objects.
+    //*************************************************************************
+    void release_all()
+    {
+      items_allocated   = 0U;
+      items_initialised = 0U;
+      free_head         = Null_Index;
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated objects.
+    //*************************************************************************
+    size_type size() const
+    {
+      return items_allocated;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free objects.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax_Size - items_allocated;
+    }
+
+    //*************************************************************************
+    /// Returns the number of objects.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of objects.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Checks whether no objects are allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return items_allocated == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether all of the objects are allocated.
+    //*************************************************************************
+    bool full() const
+    {
+      return items_allocated == VMax_Size;
+    }
+
+  private:
+
+    /// The link value for an allocated object.
+    static ETL_CONSTANT uint32_t Allocated = 0xFFFFFFFEUL;
+
+    //*************************************************************************
+    T* address_of(uint32_t index)
+    {
+      return reinterpret_cast<T*>(buffer) + index;
+    }
+
+    //*************************************************************************
+    const T* address_of(uint32_t index) const
+    {
+      return reinterpret_cast<const T*>(buffer) + index;
+    }
+
+    typedef typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage_type;
+
+    etl::private_persistent::header header;
+    uint32_t                        items_allocated;
+    uint32_t                        items_initialised;
+    uint32_t                        free_head;
+    uint32_t                        next[VMax_Size];
+    storage_type                    buffer[VMax_Size];
+  };
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT size_t persistent_pool<T, VMax_Size>::MAX_SIZE;
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT uint32_t persistent_pool<T, VMax_Size>::Magic;
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT uint32_t persistent_pool<T, VMax_Size>::Null_Index;
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT uint32_t persistent_pool<T, VMax_Size>::Allocated;
+}
+
+#endif
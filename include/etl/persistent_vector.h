@@ -0,0 +1,529 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PERSISTENT_VECTOR_INCLUDED
+#define ETL_PERSISTENT_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "iterator.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "private/persistent_header.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+///\defgroup persistent persistent
+/// Fixed capacity containers that may be placed in storage that outlives the
+/// program, such as a memory mapped file or RAM that is not initialised at
+/// start up. The layout holds no pointers, only a header, counts and indexes,
+/// so the storage may be mapped at a different address each time.
+/// attach() reuses the contents of storage that holds a matching layout, and
+/// formats it otherwise, without parsing or copying the elements.
+/// The element types must be trivially copyable.
+/// An operation interrupted part way, by a reset or a crash, may leave the
+/// contents inconsistent; only the header is checked on attach.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity vector that may be placed in persistent storage.
+  /// The default constructor does not touch the storage; call attach() or
+  /// format() before use.
+  ///\tparam T          The element type. Must be trivially copyable.
+  ///\tparam VMax_Size  The maximum number of elements.
+  ///\ingroup persistent
+  //***************************************************************************
+  template <typename T, size_t VMax_Size>
+  class persistent_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "persistent_vector requires a trivially copyable type");
+    ETL_STATIC_ASSERT(VMax_Size > 0U, "Zero capacity persistent_vector");
+    ETL_STATIC_ASSERT(VMax_Size <= 0xFFFFFFFFUL, "Capacity too large");
+
+    typedef T                                     value_type;
+    typedef T&                                    reference;
+    typedef const T&                              const_reference;
+    typedef T*                                    pointer;
+    typedef const T*                              const_pointer;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                size_type;
+    typedef ptrdiff_t                             difference_type;
+
+    static ETL_CONSTANT size_t   MAX_SIZE = VMax_Size;
+    static ETL_CONSTANT uint32_t Magic    = 0x50564543UL; // "PVEC"
+
+    //*************************************************************************
+    /// Constructor.
+    /// Does not modify the storage, so that a vector in RAM that is not
+    /// initialised at start up keeps its contents.
+    //*************************************************************************
+#if ETL_USING_CPP11
+    persistent_vector() = default;
+#else
+    persistent_vector()
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets a vector placed in a buffer, such as a memory mapped file.
+    /// The buffer must be at least sizeof(persistent_vector) bytes and be
+    /// suitably aligned. Call attach() or format() on the result.
+    //*************************************************************************
+    static persistent_vector& from_buffer(void* p_buffer)
+    {
+      return *static_cast<persistent_vector*>(p_buffer);
+    }
+
+    //*************************************************************************
+    /// Attaches to the storage.
+    /// Keeps the contents if the storage holds a vector with the same layout
+    /// and version, otherwise formats it as empty.
+    ///\param version The user's layout version. Change it to discard contents
+    ///               saved by a build with an incompatible element type.
+    ///\return <b>true</b> if the contents were kept.
+    //*************************************************************************
+    bool attach(uint32_t version = 0U)
+    {
+      if (is_valid(version))
+      {
+        return true;
+      }
+
+      format(version);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Formats the storage as an empty vector.
+    //*************************************************************************
+    void format(uint32_t version = 0U)
+    {
+      current_size = 0U;
+      header.format(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(T)));
+    }
+
+    //*************************************************************************
+    /// Checks whether the storage holds a vector with the same layout and version.
+    //*************************************************************************
+    bool is_valid(uint32_t version = 0U) const
+    {
+      return header.is_valid(Magic, version, uint32_t(VMax_Size), uint32_t(sizeof(T))) &&
+             (current_size <= VMax_Size);
+    }
+
+    //*************************************************************************
+    /// Invalidates the storage, so that the next attach() formats it.
+    //*************************************************************************
+    void detach()
+    {
+      header.invalidate();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the beginning of the vector.
+    //*************************************************************************
+    iterator begin()
+    {
+      return data();
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return data();
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the beginning of the vector.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return data();
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end of the vector.
+    //*************************************************************************
+    iterator end()
+    {
+      return data() + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return data() + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a const iterator to the end of the vector.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return data() + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the reverse beginning of the vector.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a const reverse iterator to the end + 1 of the vector.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the beginning of the vector data.
+    /// The pointer is only valid while the storage stays at the same address.
+    //*************************************************************************
+    pointer data()
+    {
+      return reinterpret_cast<pointer>(buffer);
+    }
+
+    //*************************************************************************
+    /// Returns a const pointer to the beginning of the vector data.
+    //*************************************************************************
+    const_pointer data() const
+    {
+      return reinterpret_cast<const_pointer>(buffer);
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    //*************************************************************************
+    reference operator [](size_t i)
+    {
+      return data()[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    //*************************************************************************
+    const_reference operator [](size_t i) const
+    {
+      return data()[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(persistent_out_of_bounds));
+
+      return data()[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the value at index 'i'.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(persistent_out_of_bounds));
+
+      return data()[i];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    reference front()
+    {
+      return data()[0];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the first element.
+    //*************************************************************************
+    const_reference front() const
+    {
+      return data()[0];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    reference back()
+    {
+      return data()[current_size - 1U];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the last element.
+    //*************************************************************************
+    const_reference back() const
+    {
+      return data()[current_size - 1U];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the end.
+    /// The value is written before the size, so an interrupted push_back
+    /// leaves the vector as it was.
+    /// Writes outside the storage are never made, even if asserts are disabled.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the vector is full.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      if (current_size == VMax_Size)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_full));
+        return;
+      }
+
+      ::new (static_cast<void*>(data() + current_size)) T(value);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Removes the last value.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_empty if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      if (current_size == 0U)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_empty));
+        return;
+      }
+
+      --current_size;
+    }
+
+    //*************************************************************************
+    /// Inserts a value before 'position'.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the vector is full.
+    ///\return An iterator to the inserted value.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      iterator p = to_iterator(position);
+
+      if (current_size == VMax_Size)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_full));
+        return p;
+      }
+
+      // Copy first, in case the value is in the vector.
+      const T copy(value);
+
+      memmove(static_cast<void*>(p + 1), static_cast<const void*>(p), size_t(end() - p) * sizeof(T));
+      ::new (static_cast<void*>(p)) T(copy);
+      ++current_size;
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Erases the value at 'position'.
+    ///\return An iterator to the value after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return erase(position, position + 1);
+    }
+
+    //*************************************************************************
+    /// Erases the values in the range.
+    ///\return An iterator to the value after the erased ones.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      iterator p = to_iterator(first);
+      iterator q = to_iterator(last);
+
+      memmove(static_cast<void*>(p), static_cast<const void*>(q), size_t(end() - q) * sizeof(T));
+      current_size -= uint32_t(q - p);
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Assigns values from a range.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the range is too large.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      while (first != last)
+      {
+        push_back(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// Resizes the vector.
+    /// New values are copies of 'value'.
+    /// If asserts or exceptions are enabled, emits an etl::persistent_full if the size is too large.
+    //*************************************************************************
+    void resize(size_t new_size, const_reference value = T())
+    {
+      if (new_size > VMax_Size)
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(persistent_full));
+        return;
+      }
+
+      while (current_size < new_size)
+      {
+        ::new (static_cast<void*>(data() + current_size)) T(value);
+        ++current_size;
+      }
+
+      current_size = uint32_t(new_size);
+    }
+
+    //*************************************************************************
+    /// Clears the vector.
+    //*************************************************************************
+    void clear()
+    {
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks whether the vector is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks whether the vector is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type max_size() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR size_type capacity() const
+    {
+      return VMax_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of values that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax_Size - current_size;
+    }
+
+  private:
+
+    //*************************************************************************
+    iterator to_iterator(const_iterator itr)
+    {
+      return data() + (itr - data());
+    }
+
+    typedef typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage_type;
+
+    etl::private_persistent::header header;
+    uint32_t                        current_size;
+    storage_type                    buffer[VMax_Size];
+  };
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT size_t persistent_vector<T, VMax_Size>::MAX_SIZE;
+
+  template <typename T, size_t VMax_Size>
+  ETL_CONSTANT uint32_t persistent_vector<T, VMax_Size>::Magic;
+}
+
+#endif
@@ -0,0 +1,302 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PIPELINE_INCLUDED
+#define ETL_PIPELINE_INCLUDED
+
+#include "platform.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "span.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup pipeline pipeline
+/// Chains unary functors, such as the signal conditioning functors, so that
+/// a block of samples passes through every stage in one pass over memory,
+/// without intermediate buffers the size of the block.
+///\ingroup utilities
+//*****************************************************************************
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  namespace private_pipeline
+  {
+    //*************************************************************************
+    /// Checks whether a stage has a process(span<const TInput>, span<TOutput>) member.
+    //*************************************************************************
+    template <typename TStage, typename TInput, typename TOutput, typename = void>
+    struct has_process : etl::false_type
+    {
+    };
+
+    template <typename TStage, typename TInput, typename TOutput>
+    struct has_process<TStage, TInput, TOutput,
+                       etl::void_t<decltype(etl::declval<const TStage&>().process(etl::declval<etl::span<const TInput> >(), etl::declval<etl::span<TOutput> >()))> >
+      : etl::true_type
+    {
+    };
+
+    //*************************************************************************
+    /// Applies a stage to a block, using its own block process if it has one.
+    //*************************************************************************
+    template <typename TStage, typename TInput, typename TOutput>
+    void apply_block(const TStage& stage, const TInput* in, TOutput* out, size_t n, etl::true_type)
+    {
+      stage.process(etl::span<const TInput>(in, n), etl::span<TOutput>(out, n));
+    }
+
+    template <typename TStage, typename TInput, typename TOutput>
+    void apply_block(const TStage& stage, const TInput* in, TOutput* out, size_t n, etl::false_type)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        out[i] = stage(in[i]);
+      }
+    }
+
+    template <typename TStage, typename TInput, typename TOutput>
+    void apply_block(const TStage& stage, const TInput* in, TOutput* out, size_t n)
+    {
+      apply_block(stage, in, out, n, has_process<TStage, TInput, TOutput>());
+    }
+  }
+
+  //***************************************************************************
+  /// A chain of unary functors, applied first to last.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename... TStages>
+  class pipeline;
+
+  //***************************************************************************
+  /// The last stage.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename TStage>
+  class pipeline<TStage>
+  {
+  public:
+
+    template <typename... TOthers>
+    friend class pipeline;
+
+    //*************************************************************************
+    /// The type that the pipeline returns for an input type.
+    //*************************************************************************
+    template <typename TInput>
+    struct result
+    {
+      typedef typename etl::decay<decltype(etl::declval<const TStage&>()(etl::declval<const TInput&>()))>::type type;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit pipeline(const TStage& stage_)
+      : stage(stage_)
+    {
+    }
+
+    //*************************************************************************
+    /// Applies the stage to one value.
+    //*************************************************************************
+    template <typename TInput>
+    typename result<TInput>::type operator ()(const TInput& value) const
+    {
+      return stage(value);
+    }
+
+    //*************************************************************************
+    /// Applies the stage to a block of values.
+    /// Processes the smaller of in.size() and out.size() values.
+    //*************************************************************************
+    template <typename TInput, typename TOutput>
+    void process(etl::span<const TInput> in, etl::span<TOutput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      etl::private_pipeline::apply_block(stage, in.data(), out.data(), n);
+    }
+
+    //*************************************************************************
+    /// Applies the stage to a block of values.
+    /// Processes the smaller of in.size() and out.size() values.
+    //*************************************************************************
+    template <size_t Tile_Size, typename TInput, typename TOutput>
+    void process_tiled(etl::span<const TInput> in, etl::span<TOutput> out) const
+    {
+      process(in, out);
+    }
+
+  private:
+
+    //*************************************************************************
+    template <size_t Tile_Size, typename TInput, typename TOutput>
+    void process_tile(const TInput* in, TOutput* out, size_t n) const
+    {
+      etl::private_pipeline::apply_block(stage, in, out, n);
+    }
+
+    TStage stage;
+  };
+
+  //***************************************************************************
+  /// A stage followed by the rest of the pipeline.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename TStage, typename... TRest>
+  class pipeline<TStage, TRest...>
+  {
+  private:
+
+    typedef etl::pipeline<TRest...> rest_type;
+
+  public:
+
+    template <typename... TOthers>
+    friend class pipeline;
+
+    //*************************************************************************
+    /// The type that the pipeline returns for an input type.
+    //*************************************************************************
+    template <typename TInput>
+    struct result
+    {
+      typedef typename etl::decay<decltype(etl::declval<const TStage&>()(etl::declval<const TInput&>()))>::type stage_type;
+      typedef typename rest_type::template result<stage_type>::type                                               type;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR pipeline(const TStage& stage_, const TRest&... rest_)
+      : stage(stage_)
+      , rest(rest_...)
+    {
+    }
+
+    //*************************************************************************
+    /// Applies every stage to one value.
+    //*************************************************************************
+    template <typename TInput>
+    typename result<TInput>::type operator ()(const TInput& value) const
+    {
+      return rest(stage(value));
+    }
+
+    //*************************************************************************
+    /// Applies every stage to each value in turn, in a single loop.
+    /// Processes the smaller of in.size() and out.size() values.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*************************************************************************
+    template <typename TInput, typename TOutput>
+    void process(etl::span<const TInput> in, etl::span<TOutput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      const TInput* p_in  = in.data();
+      TOutput*      p_out = out.data();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = (*this)(p_in[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Applies every stage to tiles of up to Tile_Size values.
+    /// Each stage processes the whole tile, using its own block process if it
+    /// has one, before the next stage starts. The intermediate values are
+    /// held in a buffer of Tile_Size values per stage on the stack, so the
+    /// tile should be small enough for the buffers to stay in the L1 cache.
+    /// Processes the smaller of in.size() and out.size() values.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*************************************************************************
+    template <size_t Tile_Size, typename TInput, typename TOutput>
+    void process_tiled(etl::span<const TInput> in, etl::span<TOutput> out) const
+    {
+      ETL_STATIC_ASSERT(Tile_Size != 0U, "Tile_Size must not be zero");
+
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      const TInput* p_in  = in.data();
+      TOutput*      p_out = out.data();
+
+      for (size_t i = 0U; i < n; i += Tile_Size)
+      {
+        const size_t tile = ((n - i) < Tile_Size) ? (n - i) : Tile_Size;
+
+        process_tile<Tile_Size>(p_in + i, p_out + i, tile);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    template <size_t Tile_Size, typename TInput, typename TOutput>
+    void process_tile(const TInput* in, TOutput* out, size_t n) const
+    {
+      typedef typename result<TInput>::stage_type stage_type;
+
+      stage_type buffer[Tile_Size];
+
+      etl::private_pipeline::apply_block(stage, in, buffer, n);
+      rest.template process_tile<Tile_Size>(buffer, out, n);
+    }
+
+    TStage    stage;
+    rest_type rest;
+  };
+
+  //***************************************************************************
+  /// Makes a pipeline from stages.
+  ///\ingroup pipeline
+  //***************************************************************************
+  template <typename... TStages>
+  ETL_CONSTEXPR etl::pipeline<typename etl::decay<TStages>::type...> make_pipeline(const TStages&... stages)
+  {
+    return etl::pipeline<typename etl::decay<TStages>::type...>(stages...);
+  }
+
+#if ETL_USING_CPP17
+  //***************************************************************************
+  /// Template deduction guide.
+  //***************************************************************************
+  template <typename... TStages>
+  pipeline(TStages...) -> pipeline<TStages...>;
+#endif
+}
+
+#endif
+#endif
@@ -202,6 +202,15 @@ SOFTWARE.
   #define ETL_HAS_IDEQUE_REPAIR 0
 #endif
 
+//*************************************
+// Option to enable software prefetch of the next node while traversing
+// the node based containers.
+#if defined(ETL_NODE_PREFETCH_ENABLE)
+  #define ETL_HAS_NODE_PREFETCH 1
+#else
+  #define ETL_HAS_NODE_PREFETCH 0
+#endif
+
 //*************************************
 // Indicate if C++ exceptions are enabled.
 #if defined(ETL_THROW_EXCEPTIONS)
@@ -226,6 +235,20 @@ SOFTWARE.
   #define ETL_USING_LEGACY_BITSET 0
 #endif
 
+//*************************************
+// Indicate if etl::hash uses the word at a time hash rather than FNV-1a.
+#if defined(ETL_USE_WORD_HASH)
+  #define ETL_USING_WORD_HASH 1
+#else
+  #define ETL_USING_WORD_HASH 0
+#endif
+
+//*************************************
+// The minimum offset between two objects, written by different cores, that avoids false sharing.
+#if !defined(ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE)
+  #define ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE 64
+#endif
+
 //*************************************
 // Indicate if array_view is mutable.
 #if defined(ETL_ARRAY_VIEW_IS_MUTABLE)
@@ -242,6 +265,15 @@ SOFTWARE.
   #define ETL_HAS_VIRTUAL_MESSAGES 1
 #endif
 
+//*************************************
+// Option to remove shortest round trip floating point formatting, to save code space.
+// It also needs 64 bit types.
+#if defined(ETL_DISABLE_SHORTEST_FLOATING_POINT) || ETL_NOT_USING_64BIT_TYPES
+  #define ETL_HAS_SHORTEST_FLOATING_POINT 0
+#else
+  #define ETL_HAS_SHORTEST_FLOATING_POINT 1
+#endif
+
 //*************************************
 // The macros below are dependent on the profile.
 // C++11
@@ -276,7 +308,11 @@ SOFTWARE.
   #define ETL_EXPLICIT
   #define ETL_OVERRIDE
   #define ETL_FINAL
-  #define ETL_NORETURN
+  #if ETL_USING_GCC_COMPILER || ETL_USING_CLANG_COMPILER
+    #define ETL_NORETURN                  __attribute__((noreturn))
+  #else
+    #define ETL_NORETURN
+  #endif
   #define ETL_NOEXCEPT
   #define ETL_NOEXCEPT_EXPR(...)
   #define ETL_MOVE(x) x
@@ -349,6 +385,37 @@ SOFTWARE.
   #define ETL_ASSUME ETL_DO_NOTHING
 #endif
 
+//*************************************
+// Function attributes for rarely executed code, such as error reporting.
+// Keeps it out of line and away from the hot paths that call it.
+#if ETL_USING_GCC_COMPILER || ETL_USING_CLANG_COMPILER
+  #define ETL_COLD     __attribute__((cold))
+  #define ETL_NOINLINE __attribute__((noinline))
+#elif ETL_USING_MICROSOFT_COMPILER
+  #define ETL_COLD
+  #define ETL_NOINLINE __declspec(noinline)
+#else
+  #define ETL_COLD
+  #define ETL_NOINLINE
+#endif
+
+//*************************************
+// Software prefetch of memory that is about to be read.
+// A hint only. Any address may be passed, including null.
+// ETL_NODE_PREFETCH is used while traversing node based containers, and
+// only prefetches when ETL_NODE_PREFETCH_ENABLE is defined.
+#if ETL_USING_GCC_COMPILER || ETL_USING_CLANG_COMPILER
+  #define ETL_PREFETCH(address) __builtin_prefetch(address)
+#else
+  #define ETL_PREFETCH(address) ETL_DO_NOTHING
+#endif
+
+#if ETL_HAS_NODE_PREFETCH
+  #define ETL_NODE_PREFETCH(address) ETL_PREFETCH(address)
+#else
+  #define ETL_NODE_PREFETCH(address) ETL_DO_NOTHING
+#endif
+
 //*************************************
 // Determine if the ETL can use char8_t type.
 #if ETL_NO_SMALL_CHAR_SUPPORT
@@ -441,6 +508,7 @@ namespace etl
     // General
     static ETL_CONSTANT long cplusplus                        = __cplusplus;
     static ETL_CONSTANT int  language_standard                = ETL_LANGUAGE_STANDARD;
+    static ETL_CONSTANT size_t hardware_destructive_interference_size = ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE;
 
     // Using...
     static ETL_CONSTANT bool using_stl                        = (ETL_USING_STL == 1);
@@ -462,6 +530,7 @@ namespace etl
     static ETL_CONSTANT bool using_texas_instruments_compiler = (ETL_USING_TEXAS_INSTRUMENTS_COMPILER == 1);
     static ETL_CONSTANT bool using_generic_compiler           = (ETL_USING_GENERIC_COMPILER == 1);
     static ETL_CONSTANT bool using_legacy_bitset              = (ETL_USING_LEGACY_BITSET == 1);
+    static ETL_CONSTANT bool using_word_hash                  = (ETL_USING_WORD_HASH == 1);
     static ETL_CONSTANT bool using_exceptions                 = (ETL_USING_EXCEPTIONS == 1);
     
     // Has...
@@ -481,7 +550,9 @@ namespace etl
     static ETL_CONSTANT bool has_ivector_repair               = (ETL_HAS_IVECTOR_REPAIR == 1);
     static ETL_CONSTANT bool has_mutable_array_view           = (ETL_HAS_MUTABLE_ARRAY_VIEW == 1);
     static ETL_CONSTANT bool has_ideque_repair                = (ETL_HAS_IDEQUE_REPAIR == 1);
+    static ETL_CONSTANT bool has_node_prefetch                = (ETL_HAS_NODE_PREFETCH == 1);
     static ETL_CONSTANT bool has_virtual_messages             = (ETL_HAS_VIRTUAL_MESSAGES == 1);
+    static ETL_CONSTANT bool has_shortest_floating_point      = (ETL_HAS_SHORTEST_FLOATING_POINT == 1);
 
     // Is...
     static ETL_CONSTANT bool is_debug_build                   = (ETL_IS_DEBUG_BUILD == 1);
@@ -81,6 +81,27 @@ namespace etl
       return base_t::template allocate<T>();
     }
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    //*************************************************************************
+    size_t allocate_n(T** items, size_t n)
+    {
+      return base_t::template allocate_n<T>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t allocate_n(etl::span<T*, Extent> items)
+    {
+      return base_t::template allocate_n<T>(items.data(), items.size());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -160,6 +181,29 @@ namespace etl
       base_t::release(p_object);
     }
 
+    //*************************************************************************
+    /// Releases n objects in one operation.
+    /// Undefined behaviour if the pool does not contain 'U' objects derived from 'U'.
+    /// \param items The pointers to the objects to be released.
+    /// \param n     The number of objects to release.
+    //*************************************************************************
+    template <typename U>
+    void release_n(U* const* items, size_t n)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release_n(items, n);
+    }
+
+    //*************************************************************************
+    /// Releases each of the objects in the span in one operation.
+    /// Undefined behaviour if the pool does not contain 'U' objects derived from 'U'.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    void release_n(etl::span<U*, Extent> items)
+    {
+      release_n(items.data(), items.size());
+    }
+
     //*************************************************************************
     /// Destroys the object.
     /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
@@ -214,6 +258,27 @@ namespace etl
       return base_t::template allocate<T>(); 
     }
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    /// If asserts or exceptions are enabled and there are not enough free items an
+    /// etl::pool_no_allocation if thrown.
+    //*************************************************************************
+    size_t allocate_n(T** items, size_t n)
+    {
+      return base_t::template allocate_n<T>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t allocate_n(etl::span<T*, Extent> items)
+    {
+      return base_t::template allocate_n<T>(items.data(), items.size());
+    }
+
 #if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_CPP03_CODE || ETL_USING_STLPORT
     //*************************************************************************
     /// Allocate storage for an object from the pool and create with default.
@@ -293,6 +358,29 @@ namespace etl
       base_t::release(p_object);
     }
 
+    //*************************************************************************
+    /// Releases n objects in one operation.
+    /// Undefined behaviour if the pool does not contain 'U' objects derived from 'U'.
+    /// \param items The pointers to the objects to be released.
+    /// \param n     The number of objects to release.
+    //*************************************************************************
+    template <typename U>
+    void release_n(U* const* items, size_t n)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      base_t::release_n(items, n);
+    }
+
+    //*************************************************************************
+    /// Releases each of the objects in the span in one operation.
+    /// Undefined behaviour if the pool does not contain 'U' objects derived from 'U'.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    void release_n(etl::span<U*, Extent> items)
+    {
+      release_n(items.data(), items.size());
+    }
+
     //*************************************************************************
     /// Destroys the object.
     /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
@@ -0,0 +1,609 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_POOL_MT_INCLUDED
+#define ETL_POOL_MT_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "alignment.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+#define ETL_POOL_MT_CPP03_CODE 0
+
+//*****************************************************************************
+///\defgroup pool_mt pool_mt
+/// A fixed capacity pool that may be shared between threads and interrupts.
+/// The free list is a lock free stack. The head of the list is a single
+/// atomic word holding the index of the first free item and a tag that is
+/// incremented on every change, so that a stale head cannot be mistaken for
+/// a current one (the ABA problem).
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for thread safe pools.
+  ///\ingroup pool_mt
+  //***************************************************************************
+  class ipool_mt
+  {
+  public:
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate()
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      return reinterpret_cast<T*>(allocate_item());
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_MT_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Emplace with variadic constructor parameters.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      T* p = allocate<T>();
+
+      if (p)
+      {
+        ::new (p) T(etl::forward<Args>(args)...);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'T'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename T>
+    void destroy(const T* const p_object)
+    {
+      if (sizeof(T) > Item_Size)
+      {
+        ETL_ASSERT(false, ETL_ERROR(etl::pool_element_size));
+      }
+
+      p_object->~T();
+      release(p_object);
+    }
+
+    //*************************************************************************
+    /// Release an object in the pool.
+    /// If asserts or exceptions are enabled and the object does not belong to this
+    /// pool then an etl::pool_object_not_in_pool is thrown.
+    /// \param p_object A pointer to the object to be released.
+    //*************************************************************************
+    void release(const void* const p_object)
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      release_item((char*)p);
+    }
+
+    //*************************************************************************
+    /// Release all objects in the pool.
+    /// Not thread safe. No other thread may be using the pool.
+    //*************************************************************************
+    void release_all()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Check to see if the object belongs to the pool.
+    /// \param p_object A pointer to the object to be checked.
+    /// \return <b>true<\b> if it does, otherwise <b>false</b>
+    //*************************************************************************
+    bool is_in_pool(const void* const p_object) const
+    {
+      const uintptr_t p = uintptr_t(p_object);
+      return is_item_in_pool((const char*)p);
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of items in the pool.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free items in the pool.
+    /// May be out of date on return if other threads are using the pool.
+    //*************************************************************************
+    size_t available() const
+    {
+      return Max_Size - items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated items in the pool.
+    /// May be out of date on return if other threads are using the pool.
+    //*************************************************************************
+    size_t size() const
+    {
+      return items_allocated.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no allocated items in the pool.
+    /// May be out of date on return if other threads are using the pool.
+    /// \return <b>true</b> if there are none allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if there are no free items in the pool.
+    /// May be out of date on return if other threads are using the pool.
+    /// \return <b>true</b> if there are none free.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == Max_Size;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ipool_mt(char* p_buffer_, size_t item_size_, size_t max_size_)
+      : p_buffer(p_buffer_)
+      , free_head(0U)
+      , items_allocated(0U)
+      , Item_Size(item_size_)
+      , Max_Size(max_size_)
+      , Index_Mask(index_mask_for(max_size_))
+    {
+      initialise();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The smallest all ones mask that can hold every index, and Max_Size
+    /// for the end of the list. The bits above the mask hold the tag.
+    //*************************************************************************
+    static size_t index_mask_for(size_t max_size_)
+    {
+      size_t mask = 0U;
+
+      while (mask < max_size_)
+      {
+        mask = (mask << 1U) | 1U;
+      }
+
+      return mask;
+    }
+
+    //*************************************************************************
+    /// Links every item in to the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_t i = 0U; i < Max_Size; ++i)
+      {
+        set_link(p_buffer + (i * Item_Size), i + 1U);
+      }
+
+      items_allocated.store(0U, etl::memory_order_relaxed);
+      free_head.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// The index of the next free item is stored in the first bytes of a free item.
+    //*************************************************************************
+    static size_t get_link(const char* p_item)
+    {
+      return *reinterpret_cast<const volatile size_t*>(p_item);
+    }
+
+    //*************************************************************************
+    static void set_link(char* p_item, size_t index)
+    {
+      *reinterpret_cast<volatile size_t*>(p_item) = index;
+    }
+
+    //*************************************************************************
+    /// Returns a new head with the index and the next tag.
+    //*************************************************************************
+    size_t make_head(size_t old_head, size_t index) const
+    {
+      return ((old_head + (Index_Mask + 1U)) & ~Index_Mask) | index;
+    }
+
+    //*************************************************************************
+    /// Allocate an item from the pool.
+    /// Pops the head of the free list.
+    //*************************************************************************
+    char* allocate_item()
+    {
+      size_t head = free_head.load(etl::memory_order_acquire);
+
+      while (true)
+      {
+        const size_t index = head & Index_Mask;
+
+        if (index == Max_Size)
+        {
+          ETL_ASSERT_FAIL(ETL_ERROR(pool_no_allocation));
+          return ETL_NULLPTR;
+        }
+
+        char* p_item = p_buffer + (index * Item_Size);
+
+        // If another thread takes this item first the link may be stale,
+        // but the tag will have changed and the exchange will fail.
+        const size_t next = get_link(p_item);
+
+        if (free_head.compare_exchange_weak(head, make_head(head, next), etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          items_allocated.fetch_add(1U, etl::memory_order_relaxed);
+
+          return p_item;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Release an item back to the pool.
+    /// Pushes it on to the head of the free list.
+    //*************************************************************************
+    void release_item(char* p_item)
+    {
+      // Does it belong to us?
+      ETL_ASSERT_OR_RETURN(is_item_in_pool(p_item), ETL_ERROR(pool_object_not_in_pool));
+
+      const size_t index = static_cast<size_t>(p_item - p_buffer) / Item_Size;
+
+      size_t head = free_head.load(etl::memory_order_relaxed);
+
+      do
+      {
+        set_link(p_item, head & Index_Mask);
+      } while (!free_head.compare_exchange_weak(head, make_head(head, index), etl::memory_order_release, etl::memory_order_relaxed));
+
+      items_allocated.fetch_sub(1U, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Check if the item belongs to this pool.
+    //*************************************************************************
+    bool is_item_in_pool(const char* p) const
+    {
+      // Within the range of the buffer?
+      intptr_t distance = p - p_buffer;
+      bool is_within_range = (distance >= 0) && (distance <= intptr_t((Item_Size * Max_Size) - Item_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid object boundary?
+      bool is_valid_address = ((distance % intptr_t(Item_Size)) == 0);
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+    // Disable copy construction and assignment.
+    ipool_mt(const ipool_mt&);
+    ipool_mt& operator =(const ipool_mt&);
+
+    char* p_buffer;
+
+    etl::atomic<size_t> free_head;       ///< The tag and index of the first free item.
+    etl::atomic<size_t> items_allocated; ///< The number of items allocated.
+
+    const size_t Item_Size;  ///< The size of allocated items.
+    const size_t Max_Size;   ///< The maximum number of objects that can be allocated.
+    const size_t Index_Mask; ///< The bits of the head that hold the index.
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_POOL) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ipool_mt()
+    {
+    }
+#else
+  protected:
+    ~ipool_mt()
+    {
+    }
+#endif
+  };
+
+  //*************************************************************************
+  /// A templated thread safe pool implementation that uses a fixed size pool.
+  ///\ingroup pool_mt
+  //*************************************************************************
+  template <typename T, const size_t VSize>
+  class pool_mt : public etl::ipool_mt
+  {
+  public:
+
+    static ETL_CONSTANT size_t SIZE      = VSize;
+    static ETL_CONSTANT size_t ALIGNMENT = etl::alignment_of<T>::value;
+    static ETL_CONSTANT size_t TYPE_SIZE = sizeof(T);
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    pool_mt()
+      : etl::ipool_mt(reinterpret_cast<char*>(&buffer[0]), sizeof(Element), VSize)
+    {
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// Uses the default constructor.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* allocate()
+    {
+      return ipool_mt::template allocate<T>();
+    }
+
+#if ETL_CPP11_NOT_SUPPORTED || ETL_POOL_MT_CPP03_CODE || ETL_USING_STLPORT
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with default.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    T* create()
+    {
+      return ipool_mt::template create<T>();
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 1 parameter.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1>
+    T* create(const T1& value1)
+    {
+      return ipool_mt::template create<T>(value1);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 2 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      return ipool_mt::template create<T>(value1, value2);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 3 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return ipool_mt::template create<T>(value1, value2, value3);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with 4 parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return ipool_mt::template create<T>(value1, value2, value3, value4);
+    }
+#else
+    //*************************************************************************
+    /// Allocate storage for an object from the pool and create with variadic parameters.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a null pointer is returned.
+    //*************************************************************************
+    template <typename... Args>
+    T* create(Args&&... args)
+    {
+      return ipool_mt::template create<T>(etl::forward<Args>(args)...);
+    }
+#endif
+
+    //*************************************************************************
+    /// Releases the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void release(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_same<U, T>::value || etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      ipool_mt::release(p_object);
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U' object derived from 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const U* const p_object)
+    {
+      ETL_STATIC_ASSERT((etl::is_base_of<U, T>::value), "Pool does not contain this type");
+      ipool_mt::destroy(p_object);
+    }
+
+  private:
+
+    // The pool element.
+    union Element
+    {
+      size_t next;                                                                ///< Index of the next free element.
+      char   value[sizeof(T)];                                                    ///< Storage for value type.
+      typename etl::type_with_alignment<etl::alignment_of<T>::value>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[VSize];
+
+    // Should not be copied.
+    pool_mt(const pool_mt&) ETL_DELETE;
+    pool_mt& operator =(const pool_mt&) ETL_DELETE;
+  };
+
+  template <typename T, const size_t VSize>
+  ETL_CONSTANT size_t pool_mt<T, VSize>::SIZE;
+
+  template <typename T, const size_t VSize>
+  ETL_CONSTANT size_t pool_mt<T, VSize>::ALIGNMENT;
+
+  template <typename T, const size_t VSize>
+  ETL_CONSTANT size_t pool_mt<T, VSize>::TYPE_SIZE;
+}
+
+#endif
+
+#endif
@@ -110,8 +110,10 @@ namespace etl
   /// \tparam T The type of value that the queue holds.
   /// \tparam TContainer to hold the T queue values
   /// \tparam TCompare to use in comparing T values
+  /// \tparam Arity The number of children of each heap node. Defaults to a binary heap.
+  /// A 4-ary heap is shallower and keeps the children of a node adjacent in memory.
   //***************************************************************************
-  template <typename T, typename TContainer, typename TCompare = etl::less<T> >
+  template <typename T, typename TContainer, typename TCompare = etl::less<T>, const size_t Arity = 2>
   class ipriority_queue
   {
   public:
@@ -119,6 +121,8 @@ namespace etl
     typedef T                     value_type;         ///< The type stored in the queue.
     typedef TContainer            container_type;     ///< The container type used for priority queue.
     typedef TCompare              compare_type;       ///< The comparison type.
+
+    static ETL_CONSTANT size_t ARITY = Arity;         ///< The number of children of each heap node.
     typedef T&                    reference;          ///< A reference to the type used in the queue.
     typedef const T&              const_reference;    ///< A const reference to the type used in the queue.
 #if ETL_USING_CPP11
@@ -158,7 +162,7 @@ namespace etl
       // Put element at end
       container.push_back(value);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 
 #if ETL_USING_CPP11
@@ -175,7 +179,7 @@ namespace etl
       // Put element at end
       container.push_back(etl::move(value));
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 #endif
 
@@ -194,7 +198,7 @@ namespace etl
       // Put element at end
       container.emplace_back(etl::forward<Args>(args)...);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 #else
     //*************************************************************************
@@ -210,7 +214,7 @@ namespace etl
       // Put element at end
       container.emplace_back();
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 
     //*************************************************************************
@@ -227,7 +231,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 
     //*************************************************************************
@@ -244,7 +248,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 
     //*************************************************************************
@@ -261,7 +265,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 
     //*************************************************************************
@@ -278,7 +282,7 @@ namespace etl
       // Put element at end
       container.emplace_back(value1, value2, value3, value4);
       // Make elements in container into heap
-      etl::push_heap(container.begin(), container.end(), compare);
+      push_heap();
     }
 #endif
 
@@ -302,7 +306,7 @@ namespace etl
 
       clear();
       container.assign(first, last);
-      etl::make_heap(container.begin(), container.end(), compare);
+      make_heap();
     }
 
     //*************************************************************************
@@ -312,7 +316,7 @@ namespace etl
     void pop()
     {
       // Move largest element to end
-      etl::pop_heap(container.begin(), container.end(), compare);
+      pop_heap();
       // Actually remove largest element at end
       container.pop_back();
     }
@@ -440,6 +444,51 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds the last element of the container to the heap.
+    //*************************************************************************
+    void push_heap()
+    {
+      if ETL_IF_CONSTEXPR(Arity == 2U)
+      {
+        etl::push_heap(container.begin(), container.end(), compare);
+      }
+      else
+      {
+        etl::push_d_ary_heap<Arity>(container.begin(), container.end(), compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the highest priority element to the end of the container.
+    //*************************************************************************
+    void pop_heap()
+    {
+      if ETL_IF_CONSTEXPR(Arity == 2U)
+      {
+        etl::pop_heap(container.begin(), container.end(), compare);
+      }
+      else
+      {
+        etl::pop_d_ary_heap<Arity>(container.begin(), container.end(), compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Arranges the elements of the container into a heap.
+    //*************************************************************************
+    void make_heap()
+    {
+      if ETL_IF_CONSTEXPR(Arity == 2U)
+      {
+        etl::make_heap(container.begin(), container.end(), compare);
+      }
+      else
+      {
+        etl::make_d_ary_heap<Arity>(container.begin(), container.end(), compare);
+      }
+    }
+
     // Disable copy construction.
     ipriority_queue(const ipriority_queue&);
 
@@ -455,9 +504,10 @@ namespace etl
   /// This queue does not support concurrent access by different threads.
   /// \tparam T    The type this queue should support.
   /// \tparam SIZE The maximum capacity of the queue.
+  /// \tparam Arity The number of children of each heap node.
   //***************************************************************************
-  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type> >
-  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare>
+  template <typename T, const size_t SIZE, typename TContainer = etl::vector<T, SIZE>, typename TCompare = etl::less<typename TContainer::value_type>, const size_t Arity = 2>
+  class priority_queue : public etl::ipriority_queue<T, TContainer, TCompare, Arity>
   {
   public:
 
@@ -470,7 +520,7 @@ namespace etl
     /// Default constructor.
     //*************************************************************************
     priority_queue()
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
     }
 
@@ -478,9 +528,9 @@ namespace etl
     /// Copy constructor
     //*************************************************************************
     priority_queue(const priority_queue& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::clone(rhs);
     }
 
 #if ETL_USING_CPP11
@@ -488,9 +538,9 @@ namespace etl
     /// Move constructor
     //*************************************************************************
     priority_queue(priority_queue&& rhs)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::move(etl::move(rhs));
     }
 #endif
 
@@ -502,9 +552,9 @@ namespace etl
     //*************************************************************************
     template <typename TIterator>
     priority_queue(TIterator first, TIterator last)
-      : etl::ipriority_queue<T, TContainer, TCompare>()
+      : etl::ipriority_queue<T, TContainer, TCompare, Arity>()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::assign(first, last);
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::assign(first, last);
     }
 
     //*************************************************************************
@@ -512,7 +562,7 @@ namespace etl
     //*************************************************************************
     ~priority_queue()
     {
-      etl::ipriority_queue<T, TContainer, TCompare>::clear();
+      etl::ipriority_queue<T, TContainer, TCompare, Arity>::clear();
     }
 
     //*************************************************************************
@@ -522,7 +572,7 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clone(rhs);
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::clone(rhs);
       }
 
       return *this;
@@ -536,8 +586,8 @@ namespace etl
     {
       if (&rhs != this)
       {
-        etl::ipriority_queue<T, TContainer, TCompare>::clear();
-        etl::ipriority_queue<T, TContainer, TCompare>::move(etl::move(rhs));
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::clear();
+        etl::ipriority_queue<T, TContainer, TCompare, Arity>::move(etl::move(rhs));
       }
 
       return *this;
@@ -545,8 +595,11 @@ namespace etl
 #endif
   };
 
-  template <typename T, const size_t SIZE, typename TContainer, typename TCompare>
-  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare>::size_type priority_queue<T, SIZE, TContainer, TCompare>::MAX_SIZE;
+  template <typename T, typename TContainer, typename TCompare, const size_t Arity>
+  ETL_CONSTANT size_t ipriority_queue<T, TContainer, TCompare, Arity>::ARITY;
+
+  template <typename T, const size_t SIZE, typename TContainer, typename TCompare, const size_t Arity>
+  ETL_CONSTANT typename priority_queue<T, SIZE, TContainer, TCompare, Arity>::size_type priority_queue<T, SIZE, TContainer, TCompare, Arity>::MAX_SIZE;
 }
 
 #endif
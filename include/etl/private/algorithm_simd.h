@@ -0,0 +1,968 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ALGORITHM_SIMD_INCLUDED
+#define ETL_ALGORITHM_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../utility.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Vector implementations of find, count, min/max, mismatch and the sorting
+// of the columns of a table for contiguous ranges of 8, 16 and 32 bit
+// integrals and floats, and of the intersection of sorted sets of 32 bit
+// integrals.
+// Each function returns the number of elements processed, which is always a
+// multiple of the number of lanes, unless it has found what it is looking for,
+// in which case it returns its index. The caller handles the remainder.
+// They are only called at run time, as the intrinsics are not constexpr.
+//*****************************************************************************
+
+#if ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  // The algorithms are constexpr, so the vector paths cannot be selected.
+  #define ETL_USING_ALGORITHM_SIMD 0
+#elif ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_ALGORITHM_SIMD 1
+#else
+  #define ETL_USING_ALGORITHM_SIMD 0
+#endif
+
+#if ETL_USING_ALGORITHM_SIMD
+
+namespace etl
+{
+  namespace private_algorithm_simd
+  {
+    //*************************************************************************
+    /// The vector instructions for the target that do not depend on the lane type.
+    //*************************************************************************
+    typedef etl::private_simd::byte_vector simd_instructions;
+
+    //*************************************************************************
+    /// The lane type that a vector operation on T uses, or void if there is none.
+    //*************************************************************************
+    template <size_t Size, bool Is_Signed>
+    struct simd_integral_type
+    {
+      typedef void type;
+    };
+
+    template <> struct simd_integral_type<1U, true>  { typedef int8_t   type; };
+    template <> struct simd_integral_type<1U, false> { typedef uint8_t  type; };
+    template <> struct simd_integral_type<2U, true>  { typedef int16_t  type; };
+    template <> struct simd_integral_type<2U, false> { typedef uint16_t type; };
+    template <> struct simd_integral_type<4U, true>  { typedef int32_t  type; };
+    template <> struct simd_integral_type<4U, false> { typedef uint32_t type; };
+
+    template <typename T>
+    struct simd_lane_type
+    {
+      typedef typename etl::remove_cv<T>::type value_type;
+
+      typedef typename etl::conditional<etl::is_integral<value_type>::value && !etl::is_same<value_type, bool>::value,
+                                        typename simd_integral_type<sizeof(value_type), etl::is_signed<value_type>::value>::type,
+                                        typename etl::conditional<etl::is_same<value_type, float>::value, float, void>::type>::type type;
+    };
+
+    //*************************************************************************
+    /// The vector instructions for each lane type.
+    /// Integral minimum and maximum that the target lacks use the sign bias
+    /// or a compare and select.
+    //*************************************************************************
+    template <typename T>
+    struct simd_lane;
+
+#if ETL_USING_SIMD_AVX2
+    template <>
+    struct simd_lane<int8_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(int8_t v)                  { return _mm256_set1_epi8(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epi8(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epi8(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint8_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(uint8_t v)                 { return _mm256_set1_epi8(static_cast<char>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epu8(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epu8(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int16_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(int16_t v)                 { return _mm256_set1_epi16(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi16(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epi16(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epi16(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint16_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(uint16_t v)                { return _mm256_set1_epi16(static_cast<short>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi16(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epu16(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epu16(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int32_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(int32_t v)                 { return _mm256_set1_epi32(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epi32(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epi32(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint32_t>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(uint32_t v)                { return _mm256_set1_epi32(static_cast<int>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_cmpeq_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_min_epu32(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_max_epu32(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<float>
+    {
+      typedef __m256i vector_type;
+
+      static vector_type splat(float v)                   { return _mm256_castps_si256(_mm256_set1_ps(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ)); }
+      static vector_type min(vector_type a, vector_type b) { return _mm256_castps_si256(_mm256_min_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+      static vector_type max(vector_type a, vector_type b) { return _mm256_castps_si256(_mm256_max_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b))); }
+
+      static bool is_ordered(vector_type v)
+      {
+        const __m256 f = _mm256_castsi256_ps(v);
+
+        return _mm256_movemask_ps(_mm256_cmp_ps(f, f, _CMP_UNORD_Q)) == 0;
+      }
+    };
+#elif ETL_USING_SIMD_SSE2
+    template <>
+    struct simd_lane<uint8_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type splat(uint8_t v)                 { return _mm_set1_epi8(static_cast<char>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm_min_epu8(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm_max_epu8(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int8_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type bias()                           { return _mm_set1_epi8(static_cast<char>(0x80)); }
+      static vector_type splat(int8_t v)                  { return _mm_set1_epi8(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm_xor_si128(_mm_min_epu8(_mm_xor_si128(a, bias()), _mm_xor_si128(b, bias())), bias()); }
+      static vector_type max(vector_type a, vector_type b) { return _mm_xor_si128(_mm_max_epu8(_mm_xor_si128(a, bias()), _mm_xor_si128(b, bias())), bias()); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int16_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type splat(int16_t v)                 { return _mm_set1_epi16(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi16(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm_min_epi16(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return _mm_max_epi16(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint16_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type bias()                           { return _mm_set1_epi16(static_cast<short>(0x8000)); }
+      static vector_type splat(uint16_t v)                { return _mm_set1_epi16(static_cast<short>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi16(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return _mm_xor_si128(_mm_min_epi16(_mm_xor_si128(a, bias()), _mm_xor_si128(b, bias())), bias()); }
+      static vector_type max(vector_type a, vector_type b) { return _mm_xor_si128(_mm_max_epi16(_mm_xor_si128(a, bias()), _mm_xor_si128(b, bias())), bias()); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int32_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type splat(int32_t v)                 { return _mm_set1_epi32(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return select(_mm_cmpgt_epi32(a, b), b, a); }
+      static vector_type max(vector_type a, vector_type b) { return select(_mm_cmpgt_epi32(a, b), a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+
+      static vector_type select(vector_type m, vector_type a, vector_type b) { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    };
+
+    template <>
+    struct simd_lane<uint32_t>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type bias()                           { return _mm_set1_epi32(static_cast<int>(0x80000000UL)); }
+      static vector_type gt(vector_type a, vector_type b)  { return _mm_cmpgt_epi32(_mm_xor_si128(a, bias()), _mm_xor_si128(b, bias())); }
+      static vector_type splat(uint32_t v)                { return _mm_set1_epi32(static_cast<int>(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_cmpeq_epi32(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return simd_lane<int32_t>::select(gt(a, b), b, a); }
+      static vector_type max(vector_type a, vector_type b) { return simd_lane<int32_t>::select(gt(a, b), a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<float>
+    {
+      typedef __m128i vector_type;
+
+      static vector_type splat(float v)                   { return _mm_castps_si128(_mm_set1_ps(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+      static vector_type min(vector_type a, vector_type b) { return _mm_castps_si128(_mm_min_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+      static vector_type max(vector_type a, vector_type b) { return _mm_castps_si128(_mm_max_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b))); }
+
+      static bool is_ordered(vector_type v)
+      {
+        const __m128 f = _mm_castsi128_ps(v);
+
+        return _mm_movemask_ps(_mm_cmpunord_ps(f, f)) == 0;
+      }
+    };
+#else
+    template <>
+    struct simd_lane<int8_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(int8_t v)                  { return vreinterpretq_u8_s8(vdupq_n_s8(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vceqq_u8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_s8(vminq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_s8(vmaxq_s8(vreinterpretq_s8_u8(a), vreinterpretq_s8_u8(b))); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint8_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(uint8_t v)                 { return vdupq_n_u8(v); }
+      static vector_type eq(vector_type a, vector_type b)  { return vceqq_u8(a, b); }
+      static vector_type min(vector_type a, vector_type b) { return vminq_u8(a, b); }
+      static vector_type max(vector_type a, vector_type b) { return vmaxq_u8(a, b); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int16_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(int16_t v)                 { return vreinterpretq_u8_s16(vdupq_n_s16(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_s16(vminq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_s16(vmaxq_s16(vreinterpretq_s16_u8(a), vreinterpretq_s16_u8(b))); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint16_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(uint16_t v)                { return vreinterpretq_u8_u16(vdupq_n_u16(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vreinterpretq_u8_u16(vceqq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_u16(vminq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_u16(vmaxq_u16(vreinterpretq_u16_u8(a), vreinterpretq_u16_u8(b))); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<int32_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(int32_t v)                 { return vreinterpretq_u8_s32(vdupq_n_s32(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_s32(vminq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_s32(vmaxq_s32(vreinterpretq_s32_u8(a), vreinterpretq_s32_u8(b))); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<uint32_t>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(uint32_t v)                { return vreinterpretq_u8_u32(vdupq_n_u32(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_u32(vminq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_u32(vmaxq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b))); }
+      static bool        is_ordered(vector_type)           { return true; }
+    };
+
+    template <>
+    struct simd_lane<float>
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type splat(float v)                   { return vreinterpretq_u8_f32(vdupq_n_f32(v)); }
+      static vector_type eq(vector_type a, vector_type b)  { return vreinterpretq_u8_u32(vceqq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b))); }
+      static vector_type min(vector_type a, vector_type b) { return vreinterpretq_u8_f32(vminq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b))); }
+      static vector_type max(vector_type a, vector_type b) { return vreinterpretq_u8_f32(vmaxq_f32(vreinterpretq_f32_u8(a), vreinterpretq_f32_u8(b))); }
+
+      static bool is_ordered(vector_type v)
+      {
+        return simd_instructions::mask(eq(v, v)) == simd_instructions::All_Bits;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Ranges that find and count can vectorise.
+    /// Integral values are converted to the element type, so that they
+    /// compare as they would with the usual arithmetic conversions.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    struct is_find_range
+    {
+      typedef typename etl::remove_pointer<TIterator>::type element_type;
+      typedef typename simd_lane_type<element_type>::type   lane_type;
+
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value &&
+                                       !etl::is_void<lane_type>::value &&
+                                       (etl::is_same<lane_type, float>::value ? etl::is_same<typename etl::remove_cv<T>::type, float>::value
+                                                                              : (etl::is_integral<T>::value && !etl::is_same<typename etl::remove_cv<T>::type, bool>::value));
+    };
+
+    //*************************************************************************
+    /// Ranges that min_element and minmax_element can vectorise.
+    //*************************************************************************
+    template <typename TIterator>
+    struct is_minmax_range
+    {
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator>::value &&
+                                       !etl::is_void<typename simd_lane_type<typename etl::remove_pointer<TIterator>::type>::type>::value;
+    };
+
+    //*************************************************************************
+    /// Pairs of ranges that equal and mismatch can vectorise, as bytes.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_mismatch_range
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator1>::type>::type element_type1;
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator2>::type>::type element_type2;
+
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator1>::value &&
+                                       etl::is_pointer<TIterator2>::value &&
+                                       etl::is_same<element_type1, element_type2>::value &&
+                                       etl::is_integral<element_type1>::value &&
+                                       !etl::is_same<element_type1, bool>::value;
+    };
+
+    //*************************************************************************
+    /// Pairs of ranges that set_intersection_unique can vectorise.
+    //*************************************************************************
+    template <typename TIterator1, typename TIterator2>
+    struct is_set_intersection_range
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator1>::type>::type element_type1;
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator2>::type>::type element_type2;
+
+      static ETL_CONSTANT bool value = etl::is_pointer<TIterator1>::value &&
+                                       etl::is_pointer<TIterator2>::value &&
+                                       etl::is_same<element_type1, element_type2>::value &&
+                                       (etl::is_same<element_type1, int32_t>::value || etl::is_same<element_type1, uint32_t>::value);
+    };
+
+    //*************************************************************************
+    /// find
+    /// Sets 'found' and returns the index of the first element equal to 'value'.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_find(const void* psrc, size_t n, TLane value, bool& found)
+    {
+      typedef simd_instructions simd;
+      typedef simd_lane<TLane>  lane;
+
+      static ETL_CONSTANT size_t Lanes     = simd::Width / sizeof(TLane);
+      static ETL_CONSTANT size_t Lane_Bits = simd::Bits_Per_Byte * sizeof(TLane);
+
+      const unsigned char* p = static_cast<const unsigned char*>(psrc);
+      const typename lane::vector_type target = lane::splat(value);
+
+      size_t i = 0U;
+
+      found = false;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        const typename simd::mask_type matches = simd::mask(lane::eq(simd::load(p + (i * sizeof(TLane))), target));
+
+        if (matches != 0U)
+        {
+          found = true;
+          return i + (simd::first_set(matches) / Lane_Bits);
+        }
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// count
+    /// Adds the number of elements equal to 'value' to 'count'.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_count(const void* psrc, size_t n, TLane value, size_t& count)
+    {
+      typedef simd_instructions simd;
+      typedef simd_lane<TLane>  lane;
+
+      static ETL_CONSTANT size_t Lanes     = simd::Width / sizeof(TLane);
+      static ETL_CONSTANT size_t Lane_Bits = simd::Bits_Per_Byte * sizeof(TLane);
+
+      const unsigned char* p = static_cast<const unsigned char*>(psrc);
+      const typename lane::vector_type target = lane::splat(value);
+
+      size_t i = 0U;
+      size_t bits = 0U;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        bits += simd::count_set(simd::mask(lane::eq(simd::load(p + (i * sizeof(TLane))), target)));
+      }
+
+      count += bits / Lane_Bits;
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// min_max
+    /// Sets the smallest and largest values of the processed elements.
+    /// Returns zero, processing nothing, if there are fewer elements than
+    /// lanes or the range contains a NaN, as vector min/max do not order them
+    /// as the scalar comparisons would.
+    //*************************************************************************
+    template <typename TLane>
+    size_t simd_min_max(const void* psrc, size_t n, TLane& minimum, TLane& maximum)
+    {
+      typedef simd_instructions simd;
+      typedef simd_lane<TLane>  lane;
+      typedef typename lane::vector_type vector_type;
+
+      static ETL_CONSTANT size_t Lanes = simd::Width / sizeof(TLane);
+
+      const unsigned char* p = static_cast<const unsigned char*>(psrc);
+
+      if (n < Lanes)
+      {
+        return 0U;
+      }
+
+      vector_type vmin = simd::load(p);
+      vector_type vmax = vmin;
+
+      if (!lane::is_ordered(vmin))
+      {
+        return 0U;
+      }
+
+      size_t i = Lanes;
+
+      for (; (i + Lanes) <= n; i += Lanes)
+      {
+        const vector_type v = simd::load(p + (i * sizeof(TLane)));
+
+        if (!lane::is_ordered(v))
+        {
+          return 0U;
+        }
+
+        vmin = lane::min(vmin, v);
+        vmax = lane::max(vmax, v);
+      }
+
+      TLane mins[Lanes];
+      TLane maxs[Lanes];
+
+      memcpy(mins, &vmin, sizeof(mins));
+      memcpy(maxs, &vmax, sizeof(maxs));
+
+      minimum = mins[0];
+      maximum = maxs[0];
+
+      for (size_t j = 1U; j < Lanes; ++j)
+      {
+        minimum = (mins[j] < minimum) ? mins[j] : minimum;
+        maximum = (maximum < maxs[j]) ? maxs[j] : maximum;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// mismatch
+    /// Sets 'found' and returns the index of the first byte that differs.
+    //*************************************************************************
+    inline size_t simd_mismatch(const void* plhs, const void* prhs, size_t n_bytes, bool& found)
+    {
+      typedef simd_instructions  simd;
+      typedef simd_lane<uint8_t> lane;
+
+      const unsigned char* p1 = static_cast<const unsigned char*>(plhs);
+      const unsigned char* p2 = static_cast<const unsigned char*>(prhs);
+
+      size_t i = 0U;
+
+      found = false;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        const typename simd::mask_type differs = simd::mask(lane::eq(simd::load(p1 + i), simd::load(p2 + i))) ^ simd::All_Bits;
+
+        if (differs != 0U)
+        {
+          found = true;
+          return i + (simd::first_set(differs) / simd::Bits_Per_Byte);
+        }
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Four 32 bit lanes, for the intersection of sorted sets.
+    /// 'match_any' sets bit n if lane n of 'a' is equal to any lane of 'b'.
+    //*************************************************************************
+    struct simd_block4
+    {
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2
+      typedef __m128i vector_type;
+
+      static vector_type load(const void* p) { return etl::private_simd::load_128(p); }
+
+      static uint32_t match_any(vector_type a, vector_type b)
+      {
+        const vector_type m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(a, b),
+                                                        _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 3, 2, 1)))),
+                                           _mm_or_si128(_mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(1, 0, 3, 2))),
+                                                        _mm_cmpeq_epi32(a, _mm_shuffle_epi32(b, _MM_SHUFFLE(2, 1, 0, 3)))));
+
+        return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+      }
+#else
+      typedef uint32x4_t vector_type;
+
+      static vector_type load(const void* p) { return vld1q_u32(static_cast<const uint32_t*>(p)); }
+
+      static uint32_t match_any(vector_type a, vector_type b)
+      {
+        const vector_type m = vorrq_u32(vorrq_u32(vceqq_u32(a, b), vceqq_u32(a, vextq_u32(b, b, 1))),
+                                        vorrq_u32(vceqq_u32(a, vextq_u32(b, b, 2)), vceqq_u32(a, vextq_u32(b, b, 3))));
+
+        return (vgetq_lane_u32(m, 0) & 1U) | (vgetq_lane_u32(m, 1) & 2U) | (vgetq_lane_u32(m, 2) & 4U) | (vgetq_lane_u32(m, 3) & 8U);
+      }
+#endif
+    };
+
+    //*************************************************************************
+    /// set_intersection
+    /// Writes the elements common to two sorted ranges of unique elements.
+    /// Each block of four elements of 'a' is compared with every rotation of a
+    /// block of four elements of 'b', then the block with the smaller last
+    /// element is passed. Sets 'i' and 'j' to where the blocks stopped.
+    //*************************************************************************
+    template <typename TLane, typename TOutputIterator>
+    TOutputIterator simd_set_intersection(const TLane* a, size_t n1, const TLane* b, size_t n2, size_t& i, size_t& j, TOutputIterator out)
+    {
+      i = 0U;
+      j = 0U;
+
+      while (((i + 4U) <= n1) && ((j + 4U) <= n2))
+      {
+        uint32_t matches = simd_block4::match_any(simd_block4::load(a + i), simd_block4::load(b + j));
+
+        for (size_t lane = 0U; matches != 0U; ++lane)
+        {
+          if ((matches & 1U) != 0U)
+          {
+            *out = a[i + lane];
+            ++out;
+          }
+
+          matches >>= 1U;
+        }
+
+        const TLane last_a = a[i + 3U];
+        const TLane last_b = b[j + 3U];
+
+        if (!(last_b < last_a))
+        {
+          i += 4U;
+        }
+
+        if (!(last_a < last_b))
+        {
+          j += 4U;
+        }
+      }
+
+      return out;
+    }
+
+#include "diagnostic_float_equal_push.h"
+    //*************************************************************************
+    /// The element adapters called by the algorithms.
+    /// The overloads for ranges that cannot be vectorised are never called.
+    //*************************************************************************
+    template <typename TIterator, typename T>
+    typename etl::enable_if<is_find_range<TIterator, T>::value, TIterator>::type
+      find(TIterator first, TIterator last, const T& value)
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type element_type;
+      typedef typename simd_lane_type<element_type>::type lane_type;
+
+      const element_type converted = static_cast<element_type>(value);
+
+      if (!(converted == value))
+      {
+        // No element can compare equal to a value that the element type cannot represent.
+        return last;
+      }
+
+      const size_t n = static_cast<size_t>(last - first);
+      bool found;
+
+      size_t i = simd_find<lane_type>(first, n, static_cast<lane_type>(converted), found);
+
+      if (!found)
+      {
+        while ((i < n) && !(first[i] == value))
+        {
+          ++i;
+        }
+      }
+
+      return first + i;
+    }
+
+    template <typename TIterator, typename T>
+    typename etl::enable_if<!is_find_range<TIterator, T>::value, TIterator>::type
+      find(TIterator, TIterator last, const T&)
+    {
+      return last;
+    }
+
+    //*********************************
+    template <typename TIterator, typename T>
+    typename etl::enable_if<is_find_range<TIterator, T>::value, size_t>::type
+      count(TIterator first, TIterator last, const T& value)
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type element_type;
+      typedef typename simd_lane_type<element_type>::type lane_type;
+
+      const element_type converted = static_cast<element_type>(value);
+
+      if (!(converted == value))
+      {
+        return 0U;
+      }
+
+      const size_t n = static_cast<size_t>(last - first);
+      size_t c = 0U;
+
+      for (size_t i = simd_count<lane_type>(first, n, static_cast<lane_type>(converted), c); i < n; ++i)
+      {
+        if (first[i] == value)
+        {
+          ++c;
+        }
+      }
+
+      return c;
+    }
+
+    template <typename TIterator, typename T>
+    typename etl::enable_if<!is_find_range<TIterator, T>::value, size_t>::type
+      count(TIterator, TIterator, const T&)
+    {
+      return 0U;
+    }
+
+    //*********************************
+    /// Sets 'minimum' and 'maximum' to the first smallest and first largest elements.
+    /// Returns false if the range was not processed.
+    template <typename TIterator>
+    typename etl::enable_if<is_minmax_range<TIterator>::value, bool>::type
+      minmax_element(TIterator first, TIterator last, TIterator& minimum, TIterator& maximum, bool find_maximum)
+    {
+      typedef typename etl::remove_cv<typename etl::remove_pointer<TIterator>::type>::type element_type;
+      typedef typename simd_lane_type<element_type>::type lane_type;
+
+      const size_t n = static_cast<size_t>(last - first);
+
+      lane_type min_value;
+      lane_type max_value;
+
+      size_t i = simd_min_max<lane_type>(first, n, min_value, max_value);
+
+      if (i == 0U)
+      {
+        return false;
+      }
+
+      for (; i < n; ++i)
+      {
+        const lane_type value = static_cast<lane_type>(first[i]);
+
+        if (value != value)
+        {
+          // A NaN in the remainder.
+          return false;
+        }
+
+        min_value = (value < min_value) ? value : min_value;
+        max_value = (max_value < value) ? value : max_value;
+      }
+
+      bool found;
+
+      i = simd_find<lane_type>(first, n, min_value, found);
+
+      while (!found && !(static_cast<lane_type>(first[i]) == min_value))
+      {
+        ++i;
+      }
+
+      minimum = first + i;
+
+      if (find_maximum)
+      {
+        i = simd_find<lane_type>(first, n, max_value, found);
+
+        while (!found && !(static_cast<lane_type>(first[i]) == max_value))
+        {
+          ++i;
+        }
+
+        maximum = first + i;
+      }
+
+      return true;
+    }
+
+    template <typename TIterator>
+    typename etl::enable_if<!is_minmax_range<TIterator>::value, bool>::type
+      minmax_element(TIterator, TIterator, TIterator&, TIterator&, bool)
+    {
+      return false;
+    }
+
+    //*********************************
+    /// Returns the first pair of elements that differ, or the end of the first 'n'.
+    template <typename TIterator1, typename TIterator2>
+    typename etl::enable_if<is_mismatch_range<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch(TIterator1 first1, TIterator2 first2, size_t n)
+    {
+      typedef typename etl::remove_pointer<TIterator1>::type element_type;
+
+      bool found;
+
+      size_t i = simd_mismatch(first1, first2, n * sizeof(element_type), found) / sizeof(element_type);
+
+      if (!found)
+      {
+        while ((i < n) && (first1[i] == first2[i]))
+        {
+          ++i;
+        }
+      }
+
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1 + i, first2 + i);
+    }
+
+    template <typename TIterator1, typename TIterator2>
+    typename etl::enable_if<!is_mismatch_range<TIterator1, TIterator2>::value, ETL_OR_STD::pair<TIterator1, TIterator2> >::type
+      mismatch(TIterator1 first1, TIterator2 first2, size_t)
+    {
+      return ETL_OR_STD::pair<TIterator1, TIterator2>(first1, first2);
+    }
+
+    //*********************************
+    /// Writes the elements common to two sorted ranges of unique elements.
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+    typename etl::enable_if<is_set_intersection_range<TIterator1, TIterator2>::value, TOutputIterator>::type
+      set_intersection_unique(TIterator1 first1, TIterator1 last1, TIterator2 first2, TIterator2 last2, TOutputIterator out)
+    {
+      const size_t n1 = static_cast<size_t>(last1 - first1);
+      const size_t n2 = static_cast<size_t>(last2 - first2);
+
+      size_t i;
+      size_t j;
+
+      out = simd_set_intersection(first1, n1, first2, n2, i, j, out);
+
+      while ((i < n1) && (j < n2))
+      {
+        if (first1[i] < first2[j])
+        {
+          ++i;
+        }
+        else if (first2[j] < first1[i])
+        {
+          ++j;
+        }
+        else
+        {
+          *out = first1[i];
+          ++out;
+          ++i;
+          ++j;
+        }
+      }
+
+      return out;
+    }
+
+    template <typename TIterator1, typename TIterator2, typename TOutputIterator>
+    typename etl::enable_if<!is_set_intersection_range<TIterator1, TIterator2>::value, TOutputIterator>::type
+      set_intersection_unique(TIterator1, TIterator1, TIterator2, TIterator2, TOutputIterator out)
+    {
+      return out;
+    }
+
+    //*********************************
+    /// Compares and exchanges vectors of the columns of a table.
+    template <typename TLane>
+    struct simd_column_exchange
+    {
+      typedef typename simd_lane<TLane>::vector_type vector_type;
+
+      void operator ()(size_t i, size_t j)
+      {
+        const vector_type a = vectors[i];
+        const vector_type b = vectors[j];
+
+        // The maximum takes its arguments swapped, so that a value is never
+        // duplicated if the other is unordered.
+        vectors[i] = simd_lane<TLane>::min(a, b);
+        vectors[j] = simd_lane<TLane>::max(b, a);
+      }
+
+      vector_type* vectors;
+    };
+
+    //*********************************
+    /// Sorts each column of a table of VRows rows with the sorting network,
+    /// a vector of columns at a time.
+    /// Returns the number of columns sorted.
+    template <size_t VRows, typename TNetwork, typename T>
+    typename etl::enable_if<!etl::is_void<typename simd_lane_type<T>::type>::value, size_t>::type
+      sort_network_columns(T* data, size_t columns)
+    {
+      typedef typename simd_lane_type<T>::type                      lane_type;
+      typedef typename simd_column_exchange<lane_type>::vector_type vector_type;
+
+      const size_t Lanes = simd_instructions::Width / sizeof(T);
+
+      vector_type vectors[VRows];
+
+      size_t c = 0U;
+
+      for (; (c + Lanes) <= columns; c += Lanes)
+      {
+        for (size_t r = 0U; r < VRows; ++r)
+        {
+          vectors[r] = simd_instructions::load(data + (r * columns) + c);
+        }
+
+        simd_column_exchange<lane_type> exchange = { vectors };
+        TNetwork::for_each(exchange);
+
+        for (size_t r = 0U; r < VRows; ++r)
+        {
+          simd_instructions::store(data + (r * columns) + c, vectors[r]);
+        }
+      }
+
+      return c;
+    }
+
+    template <size_t VRows, typename TNetwork, typename T>
+    typename etl::enable_if<etl::is_void<typename simd_lane_type<T>::type>::value, size_t>::type
+      sort_network_columns(T*, size_t)
+    {
+      return 0U;
+    }
+#include "diagnostic_pop.h"
+  }
+}
+
+#endif
+#endif
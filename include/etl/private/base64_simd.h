@@ -0,0 +1,389 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BASE64_SIMD_INCLUDED
+#define ETL_BASE64_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Vector implementations of Base64 encoding and decoding.
+// Encoding converts 12 bytes to 16 characters per 128 bit vector, using the
+// multiply/shuffle unpacking and the saturating subtract lookup of W. Muła and
+// D. Lemire. Decoding classifies each character by nibble lookups, rejects any
+// vector that contains a character outside of the alphabet, and packs the
+// sextets back to bytes with multiply/add instructions.
+// Each function returns the number of input elements processed, which is
+// always a whole number of groups. The caller handles the remainder.
+// They are only called at run time, as the intrinsics are not constexpr.
+//*****************************************************************************
+
+#if ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  // The codec functions are constexpr, so the vector paths cannot be selected.
+  #define ETL_USING_BASE64_SIMD 0
+#elif ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3 || ETL_USING_SIMD_NEON
+  #define ETL_USING_BASE64_SIMD 1
+#else
+  #define ETL_USING_BASE64_SIMD 0
+#endif
+
+#if ETL_USING_BASE64_SIMD
+
+namespace etl
+{
+  namespace private_base64
+  {
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+    //*************************************************************************
+    /// Splits bytes 0 to 11 of each 128 bit lane into 16 sextet indexes.
+    //*************************************************************************
+    inline __m128i ssse3_encode_indexes(__m128i in)
+    {
+      in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+      const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+      const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+
+      return _mm_or_si128(t0, t1);
+    }
+
+    //*************************************************************************
+    /// Translates sextet indexes to their characters.
+    //*************************************************************************
+    inline __m128i ssse3_encode_characters(__m128i indexes)
+    {
+      const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                            '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+      __m128i selector = _mm_subs_epu8(indexes, _mm_set1_epi8(51));
+      selector = _mm_or_si128(selector, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indexes), _mm_set1_epi8(13)));
+
+      return _mm_add_epi8(indexes, _mm_shuffle_epi8(offsets, selector));
+    }
+
+    //*************************************************************************
+    /// Translates characters to sextet indexes.
+    /// Returns false if any character is not in the alphabet.
+    //*************************************************************************
+    inline bool ssse3_decode_indexes(__m128i& in)
+    {
+      const __m128i lut_lo   = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+      const __m128i lut_hi   = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+      const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+      const __m128i mask_2F  = _mm_set1_epi8(0x2F);
+
+      const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_2F);
+      const __m128i lo_nibbles = _mm_and_si128(in, mask_2F);
+      const __m128i hi         = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+      const __m128i lo         = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+
+      if (etl::private_simd::mask_128(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0U)
+      {
+        return false;
+      }
+
+      const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(_mm_cmpeq_epi8(in, mask_2F), hi_nibbles));
+
+      in = _mm_add_epi8(in, roll);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Packs 16 sextet indexes into bytes 0 to 11.
+    //*************************************************************************
+    inline __m128i ssse3_decode_bytes(__m128i indexes)
+    {
+      const __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(indexes, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+
+      return _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    }
+#endif
+
+#if ETL_USING_SIMD_AVX2
+    //*************************************************************************
+    /// The AVX2 versions of the above, working on both 128 bit lanes.
+    //*************************************************************************
+    inline __m256i avx2_encode_indexes(__m256i in)
+    {
+      in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1,
+                                                   10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+      const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+      const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+
+      return _mm256_or_si256(t0, t1);
+    }
+
+    //*********************************
+    inline __m256i avx2_encode_characters(__m256i indexes)
+    {
+      const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                               '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+                                               'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                               '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+      __m256i selector = _mm256_subs_epu8(indexes, _mm256_set1_epi8(51));
+      selector = _mm256_or_si256(selector, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indexes), _mm256_set1_epi8(13)));
+
+      return _mm256_add_epi8(indexes, _mm256_shuffle_epi8(offsets, selector));
+    }
+
+    //*********************************
+    inline bool avx2_decode_indexes(__m256i& in)
+    {
+      const __m256i lut_lo   = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+      const __m256i lut_hi   = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+      const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+      const __m256i mask_2F  = _mm256_set1_epi8(0x2F);
+
+      const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2F);
+      const __m256i lo_nibbles = _mm256_and_si256(in, mask_2F);
+      const __m256i hi         = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+      const __m256i lo         = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+      if (etl::private_simd::mask_256(_mm256_cmpgt_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256())) != 0U)
+      {
+        return false;
+      }
+
+      const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2F), hi_nibbles));
+
+      in = _mm256_add_epi8(in, roll);
+
+      return true;
+    }
+
+    //*********************************
+    // Packs 32 sextet indexes into bytes 0 to 23.
+    inline __m256i avx2_decode_bytes(__m256i indexes)
+    {
+      const __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(indexes, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+
+      const __m256i packed = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                                                          2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+      return _mm256_permutevar8x32_epi32(packed, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    }
+#endif
+
+#if ETL_USING_SIMD_NEON
+    //*************************************************************************
+    /// Translates sextet indexes to their characters.
+    //*************************************************************************
+    inline uint8x16_t neon_encode_characters(uint8x16_t indexes)
+    {
+      // Start from 'A' and correct the offset for each higher range.
+      uint8x16_t result = vaddq_u8(indexes, vdupq_n_u8('A'));
+
+      result = vaddq_u8(result, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(26)), vdupq_n_u8(static_cast<uint8_t>('a' - 26 - 'A'))));
+      result = vaddq_u8(result, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(52)), vdupq_n_u8(static_cast<uint8_t>(('0' - 52) - ('a' - 26)))));
+      result = vaddq_u8(result, vandq_u8(vcgeq_u8(indexes, vdupq_n_u8(62)), vdupq_n_u8(static_cast<uint8_t>(('+' - 62) - ('0' - 52)))));
+      result = vaddq_u8(result, vandq_u8(vceqq_u8(indexes, vdupq_n_u8(63)), vdupq_n_u8(static_cast<uint8_t>(('/' - 63) - ('+' - 62)))));
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Translates characters to sextet indexes.
+    /// Clears 'valid' if any character is not in the alphabet.
+    //*************************************************************************
+    inline uint8x16_t neon_decode_indexes(uint8x16_t in, uint8x16_t& valid)
+    {
+      const uint8x16_t upper = vcltq_u8(vsubq_u8(in, vdupq_n_u8('A')), vdupq_n_u8(26));
+      const uint8x16_t lower = vcltq_u8(vsubq_u8(in, vdupq_n_u8('a')), vdupq_n_u8(26));
+      const uint8x16_t digit = vcltq_u8(vsubq_u8(in, vdupq_n_u8('0')), vdupq_n_u8(10));
+      const uint8x16_t plus  = vceqq_u8(in, vdupq_n_u8('+'));
+      const uint8x16_t slash = vceqq_u8(in, vdupq_n_u8('/'));
+
+      valid = vandq_u8(valid, vorrq_u8(vorrq_u8(upper, lower), vorrq_u8(digit, vorrq_u8(plus, slash))));
+
+      uint8x16_t result = vandq_u8(upper, vsubq_u8(in, vdupq_n_u8('A')));
+      result = vorrq_u8(result, vandq_u8(lower, vsubq_u8(in, vdupq_n_u8('a' - 26))));
+      result = vorrq_u8(result, vandq_u8(digit, vaddq_u8(in, vdupq_n_u8(52 - '0'))));
+      result = vorrq_u8(result, vandq_u8(plus,  vdupq_n_u8(62)));
+      result = vorrq_u8(result, vandq_u8(slash, vdupq_n_u8(63)));
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Are all of the lanes set?
+    //*************************************************************************
+    inline bool neon_all_set(uint8x16_t v)
+    {
+      return etl::private_simd::equal_128(v, vdupq_n_u8(0xFFU));
+    }
+#endif
+
+    //*************************************************************************
+    /// Encodes whole groups of three bytes.
+    /// Returns the number of bytes encoded. Four characters are written for each three.
+    //*************************************************************************
+    inline size_t simd_encode(const void* input, size_t input_length, char* output)
+    {
+      const unsigned char* p_in = static_cast<const unsigned char*>(input);
+
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      // Two 16 byte loads, 12 bytes apart.
+      for (; (i + 28U) <= input_length; i += 24U)
+      {
+        const __m128i lo = etl::private_simd::load_128(p_in + i);
+        const __m128i hi = etl::private_simd::load_128(p_in + i + 12U);
+
+        const __m256i in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+
+        etl::private_simd::store_256(output, avx2_encode_characters(avx2_encode_indexes(in)));
+        output += 32U;
+      }
+#endif
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+      for (; (i + 16U) <= input_length; i += 12U)
+      {
+        const __m128i in = etl::private_simd::load_128(p_in + i);
+
+        etl::private_simd::store_128(output, ssse3_encode_characters(ssse3_encode_indexes(in)));
+        output += 16U;
+      }
+#elif ETL_USING_SIMD_NEON
+      unsigned char* p_out = reinterpret_cast<unsigned char*>(output);
+
+      for (; (i + 48U) <= input_length; i += 48U)
+      {
+        const uint8x16x3_t in = vld3q_u8(p_in + i);
+
+        const uint8x16_t mask = vdupq_n_u8(0x3F);
+
+        uint8x16x4_t indexes;
+        indexes.val[0] = vshrq_n_u8(in.val[0], 2);
+        indexes.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask);
+        indexes.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask);
+        indexes.val[3] = vandq_u8(in.val[2], mask);
+
+        uint8x16x4_t characters;
+        characters.val[0] = neon_encode_characters(indexes.val[0]);
+        characters.val[1] = neon_encode_characters(indexes.val[1]);
+        characters.val[2] = neon_encode_characters(indexes.val[2]);
+        characters.val[3] = neon_encode_characters(indexes.val[3]);
+
+        vst4q_u8(p_out, characters);
+        p_out += 64U;
+      }
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Decodes whole groups of four characters.
+    /// Stops at the first vector that contains padding or a character that is
+    /// not in the alphabet.
+    /// Returns the number of characters decoded. Three bytes are written for each four.
+    //*************************************************************************
+    inline size_t simd_decode(const char* input, size_t input_length, void* output, size_t output_length)
+    {
+      unsigned char* p_out = static_cast<unsigned char*>(output);
+
+      size_t i = 0U;
+      size_t o = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      // 32 bytes are stored, of which 24 are valid.
+      for (; ((i + 32U) <= input_length) && ((o + 32U) <= output_length); i += 32U, o += 24U)
+      {
+        __m256i in = etl::private_simd::load_256(input + i);
+
+        if (!avx2_decode_indexes(in))
+        {
+          return i;
+        }
+
+        etl::private_simd::store_256(p_out + o, avx2_decode_bytes(in));
+      }
+#endif
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+      // 16 bytes are stored, of which 12 are valid.
+      for (; ((i + 16U) <= input_length) && ((o + 16U) <= output_length); i += 16U, o += 12U)
+      {
+        __m128i in = etl::private_simd::load_128(input + i);
+
+        if (!ssse3_decode_indexes(in))
+        {
+          return i;
+        }
+
+        etl::private_simd::store_128(p_out + o, ssse3_decode_bytes(in));
+      }
+#elif ETL_USING_SIMD_NEON
+      const unsigned char* p_in = reinterpret_cast<const unsigned char*>(input);
+
+      for (; ((i + 64U) <= input_length) && ((o + 48U) <= output_length); i += 64U, o += 48U)
+      {
+        const uint8x16x4_t in = vld4q_u8(p_in + i);
+
+        uint8x16_t valid = vdupq_n_u8(0xFF);
+
+        const uint8x16_t a = neon_decode_indexes(in.val[0], valid);
+        const uint8x16_t b = neon_decode_indexes(in.val[1], valid);
+        const uint8x16_t c = neon_decode_indexes(in.val[2], valid);
+        const uint8x16_t d = neon_decode_indexes(in.val[3], valid);
+
+        if (!neon_all_set(valid))
+        {
+          return i;
+        }
+
+        uint8x16x3_t bytes;
+        bytes.val[0] = vorrq_u8(vshlq_n_u8(a, 2), vshrq_n_u8(b, 4));
+        bytes.val[1] = vorrq_u8(vshlq_n_u8(b, 4), vshrq_n_u8(c, 2));
+        bytes.val[2] = vorrq_u8(vshlq_n_u8(c, 6), d);
+
+        vst3q_u8(p_out + o, bytes);
+      }
+#endif
+
+      return i;
+    }
+  }
+}
+
+#endif
+#endif
@@ -45,6 +45,7 @@ SOFTWARE.
 #include "../error_handler.h"
 #include "../span.h"
 #include "../string.h"
+#include "bitset_simd.h"
 
 #include <string.h>
 #include <stddef.h>
@@ -151,8 +152,16 @@ namespace etl
     ETL_CONSTEXPR14 size_t count(const_pointer pbuffer, size_t number_of_elements) const ETL_NOEXCEPT
     {
       size_t n = 0UL;
+      size_t i = 0UL;
 
-      for (size_t i = 0UL; i < number_of_elements; ++i)
+#if ETL_USING_BITSET_SIMD_COUNT
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        i = private_bitset::simd_count(reinterpret_cast<const unsigned char*>(pbuffer), number_of_elements * sizeof(element_type), n) / sizeof(element_type);
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
       {
         n += etl::count_bits(pbuffer[i]);
       }
@@ -160,6 +169,38 @@ namespace etl
       return n;
     }
 
+    //*************************************************************************
+    /// Are the two buffers equal?
+    //*************************************************************************
+    ETL_CONSTEXPR14 bool equal(const_pointer pbuffer, const_pointer pbuffer2, size_t number_of_elements) const ETL_NOEXCEPT
+    {
+      size_t i = 0UL;
+
+#if ETL_USING_BITSET_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        bool is_equal = true;
+
+        i = private_bitset::simd_equal(reinterpret_cast<const unsigned char*>(pbuffer), reinterpret_cast<const unsigned char*>(pbuffer2), number_of_elements * sizeof(element_type), is_equal) / sizeof(element_type);
+
+        if (!is_equal)
+        {
+          return false;
+        }
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
+      {
+        if (pbuffer[i] != pbuffer2[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
     //*************************************************************************
     /// Tests a bit at a position.
     /// Positions greater than the number of configured bits will return <b>false</b>.
@@ -426,7 +467,16 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 void flip(pointer pbuffer, size_t number_of_elements) ETL_NOEXCEPT
     {
-      for (size_t i = 0UL; i < number_of_elements; ++i)
+      size_t i = 0U;
+
+#if ETL_USING_BITSET_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        i = private_bitset::simd_flip(reinterpret_cast<unsigned char*>(pbuffer), number_of_elements * sizeof(element_type)) / sizeof(element_type);
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
       {
         pbuffer[i] = ~pbuffer[i];
       }
@@ -520,49 +570,33 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 size_t find_next(const_pointer pbuffer, size_t number_of_elements, size_t total_bits, bool state, size_t position) const ETL_NOEXCEPT
     {
+      if (position >= total_bits)
+      {
+        return npos;
+      }
+
       // Where to start.
       size_t index = position >> log2<Bits_Per_Element>::value;
       size_t bit   = position & (Bits_Per_Element - 1);
 
-      element_type mask = 1 << bit;
+      // Search a whole element at a time for the first bit in the required state.
+      // Bits below the start position in the first element are masked off.
+      element_type value = state ? pbuffer[index] : element_type(~pbuffer[index]);
+      value &= element_type(All_Set_Element << bit);
 
-      // For each element in the bitset...
-      while (index < number_of_elements)
+      while (value == All_Clear_Element)
       {
-        element_type value = pbuffer[index];
-
-        // Needs checking?
-        if ((state && (value != All_Clear_Element)) ||
-            (!state && (value != All_Set_Element)))
-        {
-          // For each bit in the element...
-          while ((bit < Bits_Per_Element) && (position < total_bits))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
-        }
-        else
+        if (++index >= number_of_elements)
         {
-          position += (Bits_Per_Element - bit);
+          return npos;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
-
-        ++index;
+        value = state ? pbuffer[index] : element_type(~pbuffer[index]);
       }
 
-      return npos;
+      position = (index << log2<Bits_Per_Element>::value) + etl::count_trailing_zeros(value);
+
+      return (position < total_bits) ? position : npos;
     }
 
     //*************************************************************************
@@ -732,7 +766,16 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 void and_equals(pointer pbuffer, const_pointer pbuffer2, size_t number_of_elements) ETL_NOEXCEPT
     {
-      for (size_t i = 0U; i < number_of_elements; ++i)
+      size_t i = 0U;
+
+#if ETL_USING_BITSET_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        i = private_bitset::simd_and_equals(reinterpret_cast<unsigned char*>(pbuffer), reinterpret_cast<const unsigned char*>(pbuffer2), number_of_elements * sizeof(element_type)) / sizeof(element_type);
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
       {
         pbuffer[i] &= pbuffer2[i];
       }
@@ -743,7 +786,16 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 void or_equals(pointer pbuffer, const_pointer pbuffer2, size_t number_of_elements) ETL_NOEXCEPT
     {
-      for (size_t i = 0U; i < number_of_elements; ++i)
+      size_t i = 0U;
+
+#if ETL_USING_BITSET_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        i = private_bitset::simd_or_equals(reinterpret_cast<unsigned char*>(pbuffer), reinterpret_cast<const unsigned char*>(pbuffer2), number_of_elements * sizeof(element_type)) / sizeof(element_type);
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
       {
         pbuffer[i] |= pbuffer2[i];
       }
@@ -754,7 +806,16 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 void xor_equals(pointer pbuffer, const_pointer pbuffer2, size_t number_of_elements) ETL_NOEXCEPT
     {
-      for (size_t i = 0U; i < number_of_elements; ++i)
+      size_t i = 0U;
+
+#if ETL_USING_BITSET_SIMD
+      if (ETL_SIMD_IS_RUNTIME)
+      {
+        i = private_bitset::simd_xor_equals(reinterpret_cast<unsigned char*>(pbuffer), reinterpret_cast<const unsigned char*>(pbuffer2), number_of_elements * sizeof(element_type)) / sizeof(element_type);
+      }
+#endif
+
+      for (; i < number_of_elements; ++i)
       {
         pbuffer[i] ^= pbuffer2[i];
       }
@@ -1485,26 +1546,17 @@ namespace etl
     {
       if (position < Active_Bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // Look for the required state in the bits from the start position upwards.
+        element_type value = state ? buffer : element_type(~buffer);
+        value &= element_type(All_Set_Element << position);
 
-        // Needs checking?
-        if ((state && (buffer != All_Clear_Element)) || (!state && (buffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < Active_Bits)
+          const size_t bit = etl::count_trailing_zeros(value);
+
+          if (bit < Active_Bits)
           {
-            // Equal to the required state?
-            if (((buffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -2331,9 +2383,7 @@ namespace etl
     //*************************************************************************
     friend ETL_CONSTEXPR14 bool operator ==(const bitset<Active_Bits, TElement, false>& lhs, const bitset<Active_Bits, TElement, false>& rhs) ETL_NOEXCEPT
     {
-      return etl::equal(lhs.buffer, 
-                        lhs.buffer + lhs.Number_Of_Elements,
-                        rhs.buffer);
+      return lhs.ibitset.equal(lhs.buffer, rhs.buffer, lhs.Number_Of_Elements);
     }
 
     //*************************************************************************
@@ -3197,26 +3247,17 @@ namespace etl
     {
       if (position < Active_Bits)
       {
-        // Where to start.
-        size_t bit = position;
-
-        element_type mask = 1U << position;
+        // Look for the required state in the bits from the start position upwards.
+        element_type value = state ? *pbuffer : element_type(~*pbuffer);
+        value &= element_type(All_Set_Element << position);
 
-        // Needs checking?
-        if ((state && (*pbuffer != All_Clear_Element)) || (!state && (*pbuffer != All_Set_Element)))
+        if (value != All_Clear_Element)
         {
-          // For each bit in the element...
-          while (bit < Active_Bits)
+          const size_t bit = etl::count_trailing_zeros(value);
+
+          if (bit < Active_Bits)
           {
-            // Equal to the required state?
-            if (((*pbuffer & mask) != 0) == state)
-            {
-              return bit;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++bit;
+            return bit;
           }
         }
       }
@@ -3974,9 +4015,7 @@ namespace etl
     //*************************************************************************
     friend ETL_CONSTEXPR14 bool operator ==(const bitset_ext<Active_Bits, TElement, false>& lhs, const bitset_ext<Active_Bits, TElement, false>& rhs) ETL_NOEXCEPT
     {
-      return etl::equal(lhs.pbuffer,
-        lhs.pbuffer + lhs.Number_Of_Elements,
-        rhs.pbuffer);
+      return lhs.ibitset.equal(lhs.pbuffer, rhs.pbuffer, lhs.Number_Of_Elements);
     }
 
     //*************************************************************************
@@ -0,0 +1,223 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BITSET_SIMD_INCLUDED
+#define ETL_BITSET_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Vector implementations of the bulk bitset operations.
+// The bitset element arrays are processed as bytes, a vector at a time.
+// Each function returns the number of bytes processed, which is always a
+// multiple of the vector width. The caller handles the remainder.
+// They are only called at run time, as the intrinsics are not constexpr.
+//*****************************************************************************
+
+#if ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  // The bitset operations are constexpr, so the vector paths cannot be selected.
+  #define ETL_USING_BITSET_SIMD 0
+#elif ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_BITSET_SIMD 1
+#else
+  #define ETL_USING_BITSET_SIMD 0
+#endif
+
+// SSE2 has no byte shuffle, so there counting is left to the scalar popcount.
+#if ETL_USING_BITSET_SIMD && (ETL_USING_SIMD_AVX2 || (ETL_USING_SIMD_NEON && !ETL_USING_SIMD_SSE2))
+  #define ETL_USING_BITSET_SIMD_COUNT 1
+#else
+  #define ETL_USING_BITSET_SIMD_COUNT 0
+#endif
+
+#if ETL_USING_BITSET_SIMD
+
+namespace etl
+{
+  namespace private_bitset
+  {
+    //*************************************************************************
+    /// The vector instructions for the target, with a bit count where the
+    /// target can count the bits of a vector.
+    //*************************************************************************
+    struct simd_instructions : public etl::private_simd::byte_vector
+    {
+#if ETL_USING_SIMD_AVX2
+      //*********************************
+      // Counts the bits in each nibble with a table lookup, then sums the bytes.
+      static size_t count(vector_type v)
+      {
+        const __m256i lookup   = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                  0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+        const __m256i low  = _mm256_and_si256(v, low_mask);
+        const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+        const __m256i bits = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low), _mm256_shuffle_epi8(lookup, high));
+        const __m256i sums = _mm256_sad_epu8(bits, _mm256_setzero_si256());
+
+        uint64_t lanes[4];
+        etl::private_simd::store_256(lanes, sums);
+
+        return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+      }
+#elif ETL_USING_SIMD_NEON
+      //*********************************
+      // Counts the bits in each byte, then sums the bytes pairwise.
+      static size_t count(vector_type v)
+      {
+        const uint64x2_t sums = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vcntq_u8(v))));
+
+        return vgetq_lane_u64(sums, 0) + vgetq_lane_u64(sums, 1);
+      }
+#endif
+    };
+
+    //*************************************************************************
+    /// and_equals
+    //*************************************************************************
+    inline size_t simd_and_equals(unsigned char* pdst, const unsigned char* psrc, size_t n_bytes)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        simd::store(pdst + i, simd::and_(simd::load(pdst + i), simd::load(psrc + i)));
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// or_equals
+    //*************************************************************************
+    inline size_t simd_or_equals(unsigned char* pdst, const unsigned char* psrc, size_t n_bytes)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        simd::store(pdst + i, simd::or_(simd::load(pdst + i), simd::load(psrc + i)));
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// xor_equals
+    //*************************************************************************
+    inline size_t simd_xor_equals(unsigned char* pdst, const unsigned char* psrc, size_t n_bytes)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        simd::store(pdst + i, simd::xor_(simd::load(pdst + i), simd::load(psrc + i)));
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// flip
+    //*************************************************************************
+    inline size_t simd_flip(unsigned char* pdst, size_t n_bytes)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        simd::store(pdst + i, simd::not_(simd::load(pdst + i)));
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// equal
+    /// Sets 'is_equal' to false and stops at the first vector that differs.
+    //*************************************************************************
+    inline size_t simd_equal(const unsigned char* plhs, const unsigned char* prhs, size_t n_bytes, bool& is_equal)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      is_equal = true;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        if (!simd::equal(simd::load(plhs + i), simd::load(prhs + i)))
+        {
+          is_equal = false;
+          break;
+        }
+      }
+
+      return i;
+    }
+
+#if ETL_USING_BITSET_SIMD_COUNT
+    //*************************************************************************
+    /// count
+    //*************************************************************************
+    inline size_t simd_count(const unsigned char* psrc, size_t n_bytes, size_t& n)
+    {
+      typedef simd_instructions simd;
+
+      size_t i = 0U;
+
+      n = 0U;
+
+      for (; (i + simd::Width) <= n_bytes; i += simd::Width)
+      {
+        n += simd::count(simd::load(psrc + i));
+      }
+
+      return i;
+    }
+#endif
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,93 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_BRANCHLESS_SEARCH_INCLUDED
+#define ETL_PRIVATE_BRANCHLESS_SEARCH_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  namespace private_branchless_search
+  {
+    //*************************************************************************
+    /// Returns the index of the first key that is not less than 'key'.
+    /// The loop has a fixed trip count for a given size and the only data
+    /// dependent step is a conditional move, so there are no mispredicted
+    /// branches however the keys compare.
+    //*************************************************************************
+    template <typename TKey, typename TOther, typename TCompare>
+    size_t lower_bound(const TKey* keys, size_t size, const TOther& key, const TCompare& compare)
+    {
+      if (size == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* base = keys;
+
+      while (size > 1U)
+      {
+        const size_t half = size / 2U;
+        base = compare(base[half], key) ? base + half : base;
+        size -= half;
+      }
+
+      return size_t(base - keys) + (compare(*base, key) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the index of the first key that is greater than 'key'.
+    //*************************************************************************
+    template <typename TKey, typename TOther, typename TCompare>
+    size_t upper_bound(const TKey* keys, size_t size, const TOther& key, const TCompare& compare)
+    {
+      if (size == 0U)
+      {
+        return 0U;
+      }
+
+      const TKey* base = keys;
+
+      while (size > 1U)
+      {
+        const size_t half = size / 2U;
+        base = !compare(key, base[half]) ? base + half : base;
+        size -= half;
+      }
+
+      return size_t(base - keys) + (!compare(key, *base) ? 1U : 0U);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,1309 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_BTREE_INCLUDED
+#define ETL_PRIVATE_BTREE_INCLUDED
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../ipool.h"
+#include "../iterator.h"
+#include "../placement_new.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_btree
+  {
+    //*************************************************************************
+    /// The key of a map value.
+    //*************************************************************************
+    template <typename TKey, typename TValue>
+    struct map_key_of
+    {
+      static const TKey& key(const TValue& value)
+      {
+        return value.first;
+      }
+    };
+
+    //*************************************************************************
+    /// The key of a set value.
+    //*************************************************************************
+    template <typename TKey>
+    struct set_key_of
+    {
+      static const TKey& key(const TKey& value)
+      {
+        return value;
+      }
+    };
+
+    //*************************************************************************
+    /// The B+tree shared by etl::ibtree_map and etl::ibtree_set.
+    /// Values are stored in leaves of up to VNode_Size elements, which are
+    /// linked in key order so that iteration is a walk along contiguous arrays.
+    /// Internal nodes hold up to VNode_Size separator keys, each of which is
+    /// the first key of the subtree to its right.
+    /// Every node except the root is kept at least half full.
+    /// TKeyOf must have a static 'key' function returning the key of a value.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename TKeyCompare, size_t VNode_Size>
+    class btree
+    {
+    public:
+
+      ETL_STATIC_ASSERT((VNode_Size >= 4U) && (VNode_Size <= 256U), "Node size must be between 4 and 256");
+
+      typedef TValue      value_type;
+      typedef TKey        key_type;
+      typedef TKeyCompare key_compare;
+      typedef size_t      size_type;
+
+      static ETL_CONSTANT size_t Node_Size     = VNode_Size;
+      static ETL_CONSTANT size_t Min_Node_Size = VNode_Size / 2U;
+
+      //*************************************************************************
+      /// Gets the size of the tree.
+      //*************************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the tree is empty.
+      //*************************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //*************************************************************************
+      /// Checks to see if the tree is full.
+      //*************************************************************************
+      bool full() const
+      {
+        return current_size == capacity_;
+      }
+
+      //*************************************************************************
+      /// Returns the maximum possible size of the tree.
+      //*************************************************************************
+      size_type max_size() const
+      {
+        return capacity_;
+      }
+
+      //*************************************************************************
+      /// Returns the capacity of the tree.
+      //*************************************************************************
+      size_type capacity() const
+      {
+        return capacity_;
+      }
+
+      //*************************************************************************
+      /// Returns the remaining capacity.
+      //*************************************************************************
+      size_t available() const
+      {
+        return capacity_ - current_size;
+      }
+
+    protected:
+
+      //*************************************************************************
+      /// The common part of leaf and internal nodes.
+      //*************************************************************************
+      struct node
+      {
+        uint16_t count;
+        bool     is_leaf;
+      };
+
+      //*************************************************************************
+      /// A leaf holds the values.
+      //*************************************************************************
+      struct leaf_node : public node
+      {
+        TValue& value(size_t i)
+        {
+          return *reinterpret_cast<TValue*>(&values[i]);
+        }
+
+        const TValue& value(size_t i) const
+        {
+          return *reinterpret_cast<const TValue*>(&values[i]);
+        }
+
+        leaf_node* previous;
+        leaf_node* next;
+        typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type values[VNode_Size];
+      };
+
+      //*************************************************************************
+      /// An internal node holds the separator keys and the children.
+      //*************************************************************************
+      struct internal_node : public node
+      {
+        TKey& key(size_t i)
+        {
+          return *reinterpret_cast<TKey*>(&keys[i]);
+        }
+
+        const TKey& key(size_t i) const
+        {
+          return *reinterpret_cast<const TKey*>(&keys[i]);
+        }
+
+        node* children[VNode_Size + 1U];
+        typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type keys[VNode_Size];
+      };
+
+      //*************************************************************************
+      /// The internal nodes visited on the way down to a leaf.
+      //*************************************************************************
+      struct path
+      {
+        static ETL_CONSTANT size_t Max_Depth = 32U;
+
+        path()
+          : depth(0U)
+        {
+        }
+
+        void push(internal_node* p_node, size_t index)
+        {
+          nodes[depth]   = p_node;
+          indexes[depth] = index;
+          ++depth;
+        }
+
+        internal_node* nodes[Max_Depth];
+        size_t         indexes[Max_Depth];
+        size_t         depth;
+      };
+
+    public:
+
+      class const_iterator;
+
+      //*************************************************************************
+      /// iterator.
+      //*************************************************************************
+      class iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, TValue>
+      {
+      public:
+
+        friend class btree;
+        friend class const_iterator;
+
+        typedef TValue& reference;
+        typedef TValue* pointer;
+
+        iterator()
+          : p_tree(ETL_NULLPTR)
+          , p_leaf(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        iterator(btree& tree_, leaf_node* p_leaf_, size_t index_)
+          : p_tree(&tree_)
+          , p_leaf(p_leaf_)
+          , index(index_)
+        {
+        }
+
+        iterator& operator ++()
+        {
+          if (++index >= p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0U;
+          }
+
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        iterator& operator --()
+        {
+          if (p_leaf == ETL_NULLPTR)
+          {
+            p_leaf = p_tree->p_last;
+            index  = p_leaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            p_leaf = p_leaf->previous;
+            index  = p_leaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        iterator operator --(int)
+        {
+          iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        reference operator *() const
+        {
+          return p_leaf->value(index);
+        }
+
+        pointer operator &() const
+        {
+          return &(p_leaf->value(index));
+        }
+
+        pointer operator ->() const
+        {
+          return &(p_leaf->value(index));
+        }
+
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        btree*     p_tree;
+        leaf_node* p_leaf;
+        size_t     index;
+      };
+
+      //*************************************************************************
+      /// const_iterator
+      //*************************************************************************
+      class const_iterator : public etl::iterator<ETL_OR_STD::bidirectional_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class btree;
+
+        typedef const TValue& reference;
+        typedef const TValue* pointer;
+
+        const_iterator()
+          : p_tree(ETL_NULLPTR)
+          , p_leaf(ETL_NULLPTR)
+          , index(0U)
+        {
+        }
+
+        const_iterator(const btree& tree_, const leaf_node* p_leaf_, size_t index_)
+          : p_tree(&tree_)
+          , p_leaf(p_leaf_)
+          , index(index_)
+        {
+        }
+
+        const_iterator(const typename btree::iterator& other)
+          : p_tree(other.p_tree)
+          , p_leaf(other.p_leaf)
+          , index(other.index)
+        {
+        }
+
+        const_iterator& operator ++()
+        {
+          if (++index >= p_leaf->count)
+          {
+            p_leaf = p_leaf->next;
+            index  = 0U;
+          }
+
+          return *this;
+        }
+
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        const_iterator& operator --()
+        {
+          if (p_leaf == ETL_NULLPTR)
+          {
+            p_leaf = p_tree->p_last;
+            index  = p_leaf->count - 1U;
+          }
+          else if (index == 0U)
+          {
+            p_leaf = p_leaf->previous;
+            index  = p_leaf->count - 1U;
+          }
+          else
+          {
+            --index;
+          }
+
+          return *this;
+        }
+
+        const_iterator operator --(int)
+        {
+          const_iterator temp(*this);
+          --(*this);
+          return temp;
+        }
+
+        reference operator *() const
+        {
+          return p_leaf->value(index);
+        }
+
+        pointer operator &() const
+        {
+          return &(p_leaf->value(index));
+        }
+
+        pointer operator ->() const
+        {
+          return &(p_leaf->value(index));
+        }
+
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return (lhs.p_leaf == rhs.p_leaf) && (lhs.index == rhs.index);
+        }
+
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        const btree*     p_tree;
+        const leaf_node* p_leaf;
+        size_t           index;
+      };
+
+    protected:
+
+      //*************************************************************************
+      /// Constructor.
+      //*************************************************************************
+      btree(etl::ipool& leaf_pool_, etl::ipool& internal_pool_, size_t capacity__)
+        : p_leaf_pool(&leaf_pool_)
+        , p_internal_pool(&internal_pool_)
+        , p_root(ETL_NULLPTR)
+        , p_first(ETL_NULLPTR)
+        , p_last(ETL_NULLPTR)
+        , current_size(0U)
+        , capacity_(capacity__)
+      {
+      }
+
+      //*************************************************************************
+      /// Destroys all of the values and releases all of the nodes.
+      //*************************************************************************
+      void clear_all()
+      {
+        if (p_root != ETL_NULLPTR)
+        {
+          leaf_node* p_leaf = p_first;
+
+          while (p_leaf != ETL_NULLPTR)
+          {
+            for (size_t i = 0U; i < p_leaf->count; ++i)
+            {
+              p_leaf->value(i).~TValue();
+            }
+
+            p_leaf = p_leaf->next;
+          }
+
+          destroy_keys(p_root);
+
+          p_leaf_pool->release_all();
+          p_internal_pool->release_all();
+
+          p_root       = ETL_NULLPTR;
+          p_first      = ETL_NULLPTR;
+          p_last       = ETL_NULLPTR;
+          current_size = 0U;
+        }
+      }
+
+      //*************************************************************************
+      /// Iterators to the first value and to the end.
+      //*************************************************************************
+      iterator begin_iterator()
+      {
+        return iterator(*this, p_first, 0U);
+      }
+
+      const_iterator begin_iterator() const
+      {
+        return const_iterator(*this, p_first, 0U);
+      }
+
+      iterator end_iterator()
+      {
+        return iterator(*this, ETL_NULLPTR, 0U);
+      }
+
+      const_iterator end_iterator() const
+      {
+        return const_iterator(*this, ETL_NULLPTR, 0U);
+      }
+
+      //*************************************************************************
+      /// Finds the value with the key.
+      //*************************************************************************
+      template <typename TOther>
+      iterator find_iterator(const TOther& key)
+      {
+        size_t index;
+        leaf_node* p_leaf = find_leaf(key, index);
+
+        return (p_leaf != ETL_NULLPTR) ? iterator(*this, p_leaf, index) : end_iterator();
+      }
+
+      template <typename TOther>
+      const_iterator find_iterator(const TOther& key) const
+      {
+        size_t index;
+        const leaf_node* p_leaf = const_cast<btree*>(this)->find_leaf(key, index);
+
+        return (p_leaf != ETL_NULLPTR) ? const_iterator(*this, p_leaf, index) : end_iterator();
+      }
+
+      //*************************************************************************
+      /// Finds the first value not less than the key.
+      //*************************************************************************
+      template <typename TOther>
+      iterator lower_bound_iterator(const TOther& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return end_iterator();
+        }
+
+        leaf_node* p_leaf = descend(key);
+
+        return make_iterator(p_leaf, leaf_lower_bound(p_leaf, key));
+      }
+
+      template <typename TOther>
+      const_iterator lower_bound_iterator(const TOther& key) const
+      {
+        return const_cast<btree*>(this)->lower_bound_iterator(key);
+      }
+
+      //*************************************************************************
+      /// Finds the first value greater than the key.
+      //*************************************************************************
+      template <typename TOther>
+      iterator upper_bound_iterator(const TOther& key)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return end_iterator();
+        }
+
+        leaf_node* p_leaf = descend(key);
+
+        return make_iterator(p_leaf, leaf_upper_bound(p_leaf, key));
+      }
+
+      template <typename TOther>
+      const_iterator upper_bound_iterator(const TOther& key) const
+      {
+        return const_cast<btree*>(this)->upper_bound_iterator(key);
+      }
+
+      //*************************************************************************
+      /// Looks for the key, recording the path taken.
+      /// Returns true if the key was found.
+      /// Either way, p_leaf and index are the position of the key.
+      //*************************************************************************
+      bool locate(const TKey& key, path& route, leaf_node*& p_leaf, size_t& index)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          p_leaf = ETL_NULLPTR;
+          index  = 0U;
+          return false;
+        }
+
+        p_leaf = descend(key, route);
+        index  = leaf_lower_bound(p_leaf, key);
+
+        return (index < p_leaf->count) && !compare(key, TKeyOf::key(p_leaf->value(index)));
+      }
+
+      //*************************************************************************
+      /// Opens an unconstructed slot for a new value at the position returned
+      /// by 'locate', splitting nodes on the path as required.
+      /// The tree must not be full.
+      /// On return, p_leaf and index are the position of the slot.
+      //*************************************************************************
+      void open_slot(const TKey& key, path& route, leaf_node*& p_leaf, size_t& index)
+      {
+        ++current_size;
+
+        if (p_leaf == ETL_NULLPTR)
+        {
+          p_leaf = create_leaf();
+          p_leaf->count = 1U;
+          p_root  = p_leaf;
+          p_first = p_leaf;
+          p_last  = p_leaf;
+          index   = 0U;
+          return;
+        }
+
+        if (p_leaf->count < VNode_Size)
+        {
+          shift_right(p_leaf, index);
+          return;
+        }
+
+        // Split the leaf.
+        leaf_node* p_right = create_leaf();
+
+        p_right->previous = p_leaf;
+        p_right->next     = p_leaf->next;
+
+        if (p_leaf->next != ETL_NULLPTR)
+        {
+          p_leaf->next->previous = p_right;
+        }
+        else
+        {
+          p_last = p_right;
+        }
+
+        p_leaf->next = p_right;
+
+        const size_t left_count = (VNode_Size + 1U) / 2U;
+        leaf_node* p_left = p_leaf;
+
+        if (index < left_count)
+        {
+          move_values(p_leaf, left_count - 1U, VNode_Size, p_right, 0U);
+          p_right->count = uint16_t(VNode_Size - left_count + 1U);
+          p_leaf->count  = uint16_t(left_count - 1U);
+          shift_right(p_leaf, index);
+
+          insert_in_parent(route, p_left, TKeyOf::key(p_right->value(0U)), p_right);
+        }
+        else
+        {
+          move_values(p_leaf, left_count, VNode_Size, p_right, 0U);
+          p_right->count = uint16_t(VNode_Size - left_count);
+          p_leaf->count  = uint16_t(left_count);
+          index -= left_count;
+          shift_right(p_right, index);
+          p_leaf = p_right;
+
+          insert_in_parent(route, p_left, (index == 0U) ? key : TKeyOf::key(p_right->value(0U)), p_right);
+        }
+      }
+
+      //*************************************************************************
+      /// Erases the value at the position returned by 'locate'.
+      //*************************************************************************
+      void erase_at(path& route, leaf_node* p_leaf, size_t index)
+      {
+        p_leaf->value(index).~TValue();
+        shift_left(p_leaf, index);
+        --current_size;
+
+        rebalance_leaf(route, p_leaf);
+      }
+
+      //*************************************************************************
+      /// Returns the key of the value at the iterator.
+      //*************************************************************************
+      static const TKey& key_at(const_iterator position)
+      {
+        return TKeyOf::key(*position);
+      }
+
+      //*************************************************************************
+      /// Compares two keys.
+      //*************************************************************************
+      template <typename T1, typename T2>
+      bool compare(const T1& lhs, const T2& rhs) const
+      {
+        return key_comparator(lhs, rhs);
+      }
+
+      //*************************************************************************
+      /// Destructor.
+      //*************************************************************************
+      ~btree()
+      {
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Makes an iterator, stepping to the next leaf when off the end.
+      //*************************************************************************
+      iterator make_iterator(leaf_node* p_leaf, size_t index)
+      {
+        if (index >= p_leaf->count)
+        {
+          p_leaf = p_leaf->next;
+          index  = 0U;
+        }
+
+        return iterator(*this, p_leaf, index);
+      }
+
+      //*************************************************************************
+      /// Finds the leaf holding the key, or null.
+      //*************************************************************************
+      template <typename TOther>
+      leaf_node* find_leaf(const TOther& key, size_t& index)
+      {
+        if (p_root == ETL_NULLPTR)
+        {
+          return ETL_NULLPTR;
+        }
+
+        leaf_node* p_leaf = descend(key);
+        index = leaf_lower_bound(p_leaf, key);
+
+        if ((index < p_leaf->count) && !compare(key, TKeyOf::key(p_leaf->value(index))))
+        {
+          return p_leaf;
+        }
+
+        return ETL_NULLPTR;
+      }
+
+      //*************************************************************************
+      /// Walks down to the leaf that would hold the key.
+      //*************************************************************************
+      template <typename TOther>
+      leaf_node* descend(const TOther& key) const
+      {
+        node* p_node = p_root;
+
+        while (!p_node->is_leaf)
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+          p_node = p_internal->children[internal_upper_bound(p_internal, key)];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      leaf_node* descend(const TKey& key, path& route)
+      {
+        node* p_node = p_root;
+
+        while (!p_node->is_leaf)
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+          const size_t index = internal_upper_bound(p_internal, key);
+          route.push(p_internal, index);
+          p_node = p_internal->children[index];
+        }
+
+        return static_cast<leaf_node*>(p_node);
+      }
+
+      //*************************************************************************
+      /// Binary searches.
+      //*************************************************************************
+      template <typename TOther>
+      size_t internal_upper_bound(const internal_node* p_node, const TOther& key) const
+      {
+        size_t first = 0U;
+        size_t count = p_node->count;
+
+        while (count > 0U)
+        {
+          const size_t step = count / 2U;
+
+          if (!compare(key, p_node->key(first + step)))
+          {
+            first += step + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return first;
+      }
+
+      template <typename TOther>
+      size_t leaf_lower_bound(const leaf_node* p_node, const TOther& key) const
+      {
+        size_t first = 0U;
+        size_t count = p_node->count;
+
+        while (count > 0U)
+        {
+          const size_t step = count / 2U;
+
+          if (compare(TKeyOf::key(p_node->value(first + step)), key))
+          {
+            first += step + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return first;
+      }
+
+      template <typename TOther>
+      size_t leaf_upper_bound(const leaf_node* p_node, const TOther& key) const
+      {
+        size_t first = 0U;
+        size_t count = p_node->count;
+
+        while (count > 0U)
+        {
+          const size_t step = count / 2U;
+
+          if (!compare(key, TKeyOf::key(p_node->value(first + step))))
+          {
+            first += step + 1U;
+            count -= step + 1U;
+          }
+          else
+          {
+            count = step;
+          }
+        }
+
+        return first;
+      }
+
+      //*************************************************************************
+      /// Node allocation.
+      //*************************************************************************
+      leaf_node* create_leaf()
+      {
+        leaf_node* p_leaf = p_leaf_pool->template allocate<leaf_node>();
+
+        p_leaf->count    = 0U;
+        p_leaf->is_leaf  = true;
+        p_leaf->previous = ETL_NULLPTR;
+        p_leaf->next     = ETL_NULLPTR;
+
+        return p_leaf;
+      }
+
+      internal_node* create_internal()
+      {
+        internal_node* p_internal = p_internal_pool->template allocate<internal_node>();
+
+        p_internal->count   = 0U;
+        p_internal->is_leaf = false;
+
+        return p_internal;
+      }
+
+      //*************************************************************************
+      /// Destroys the keys of all of the internal nodes below p_node.
+      //*************************************************************************
+      void destroy_keys(node* p_node)
+      {
+        if (!p_node->is_leaf)
+        {
+          internal_node* p_internal = static_cast<internal_node*>(p_node);
+
+          for (size_t i = 0U; i < p_internal->count; ++i)
+          {
+            p_internal->key(i).~TKey();
+          }
+
+          for (size_t i = 0U; i <= p_internal->count; ++i)
+          {
+            destroy_keys(p_internal->children[i]);
+          }
+        }
+      }
+
+      //*************************************************************************
+      /// Moves a value to an unconstructed slot.
+      //*************************************************************************
+      static void move_value(leaf_node* p_from, size_t from, leaf_node* p_to, size_t to)
+      {
+        ::new (&p_to->values[to]) TValue(ETL_MOVE(p_from->value(from)));
+        p_from->value(from).~TValue();
+      }
+
+      //*************************************************************************
+      /// Moves the values [first, last) to the unconstructed slots at 'to'.
+      //*************************************************************************
+      static void move_values(leaf_node* p_from, size_t first, size_t last, leaf_node* p_to, size_t to)
+      {
+        while (first != last)
+        {
+          move_value(p_from, first++, p_to, to++);
+        }
+      }
+
+      //*************************************************************************
+      /// Opens an unconstructed slot at 'index' in a leaf with room.
+      //*************************************************************************
+      static void shift_right(leaf_node* p_leaf, size_t index)
+      {
+        for (size_t i = p_leaf->count; i > index; --i)
+        {
+          move_value(p_leaf, i - 1U, p_leaf, i);
+        }
+
+        ++p_leaf->count;
+      }
+
+      //*************************************************************************
+      /// Closes the destroyed slot at 'index'.
+      //*************************************************************************
+      static void shift_left(leaf_node* p_leaf, size_t index)
+      {
+        for (size_t i = index + 1U; i < p_leaf->count; ++i)
+        {
+          move_value(p_leaf, i, p_leaf, i - 1U);
+        }
+
+        --p_leaf->count;
+      }
+
+      //*************************************************************************
+      /// Replaces a separator key.
+      //*************************************************************************
+      static void replace_key(internal_node* p_node, size_t index, const TKey& key)
+      {
+        p_node->key(index).~TKey();
+        ::new (&p_node->keys[index]) TKey(key);
+      }
+
+      //*************************************************************************
+      /// Inserts a key and the child to its right into an internal node with room.
+      //*************************************************************************
+      static void insert_key(internal_node* p_node, size_t index, const TKey& key, node* p_child)
+      {
+        for (size_t i = p_node->count; i > index; --i)
+        {
+          ::new (&p_node->keys[i]) TKey(p_node->key(i - 1U));
+          p_node->key(i - 1U).~TKey();
+          p_node->children[i + 1U] = p_node->children[i];
+        }
+
+        ::new (&p_node->keys[index]) TKey(key);
+        p_node->children[index + 1U] = p_child;
+        ++p_node->count;
+      }
+
+      //*************************************************************************
+      /// Removes a key and the child at 'child_index' from an internal node.
+      //*************************************************************************
+      static void remove_key(internal_node* p_node, size_t key_index, size_t child_index)
+      {
+        p_node->key(key_index).~TKey();
+
+        for (size_t i = key_index + 1U; i < p_node->count; ++i)
+        {
+          ::new (&p_node->keys[i - 1U]) TKey(p_node->key(i));
+          p_node->key(i).~TKey();
+        }
+
+        for (size_t i = child_index + 1U; i <= p_node->count; ++i)
+        {
+          p_node->children[i - 1U] = p_node->children[i];
+        }
+
+        --p_node->count;
+      }
+
+      //*************************************************************************
+      /// Inserts the separator for a newly split node into its parent,
+      /// splitting the parents as required.
+      //*************************************************************************
+      void insert_in_parent(path& route, node* p_left, const TKey& separator, node* p_right)
+      {
+        typename etl::aligned_storage<sizeof(TKey), etl::alignment_of<TKey>::value>::type promoted[2];
+        size_t current = 0U;
+        const TKey* p_separator = &separator;
+
+        while (route.depth != 0U)
+        {
+          --route.depth;
+          internal_node* p_parent = route.nodes[route.depth];
+          const size_t   index    = route.indexes[route.depth];
+
+          if (p_parent->count < VNode_Size)
+          {
+            insert_key(p_parent, index, *p_separator, p_right);
+            destroy_promoted(promoted, p_separator, current);
+            return;
+          }
+
+          // Split the parent.
+          // The combined keys are K[0, index), separator, K[index, VNode_Size).
+          const size_t middle = (VNode_Size + 1U) / 2U;
+          internal_node* p_new = create_internal();
+          TKey* p_promoted = reinterpret_cast<TKey*>(&promoted[current]);
+
+          if (index < middle)
+          {
+            // The key at middle - 1 is promoted.
+            ::new (p_promoted) TKey(p_parent->key(middle - 1U));
+            move_keys(p_parent, middle, VNode_Size, p_new);
+
+            for (size_t i = middle; i <= VNode_Size; ++i)
+            {
+              p_new->children[i - middle] = p_parent->children[i];
+            }
+
+            p_parent->key(middle - 1U).~TKey();
+            p_parent->count = uint16_t(middle - 1U);
+            insert_key(p_parent, index, *p_separator, p_right);
+          }
+          else if (index == middle)
+          {
+            // The separator itself is promoted.
+            ::new (p_promoted) TKey(*p_separator);
+            move_keys(p_parent, middle, VNode_Size, p_new);
+
+            p_new->children[0U] = p_right;
+
+            for (size_t i = middle + 1U; i <= VNode_Size; ++i)
+            {
+              p_new->children[i - middle] = p_parent->children[i];
+            }
+
+            p_parent->count = uint16_t(middle);
+          }
+          else
+          {
+            // The key at middle is promoted.
+            ::new (p_promoted) TKey(p_parent->key(middle));
+            move_keys(p_parent, middle + 1U, VNode_Size, p_new);
+
+            for (size_t i = middle + 1U; i <= VNode_Size; ++i)
+            {
+              p_new->children[i - middle - 1U] = p_parent->children[i];
+            }
+
+            p_parent->key(middle).~TKey();
+            p_parent->count = uint16_t(middle);
+            insert_key(p_new, index - middle - 1U, *p_separator, p_right);
+          }
+
+          destroy_promoted(promoted, p_separator, current);
+
+          p_separator = p_promoted;
+          current     = 1U - current;
+          p_left      = p_parent;
+          p_right     = p_new;
+        }
+
+        // A new root.
+        internal_node* p_new_root = create_internal();
+
+        ::new (&p_new_root->keys[0U]) TKey(*p_separator);
+        p_new_root->children[0U] = p_left;
+        p_new_root->children[1U] = p_right;
+        p_new_root->count = 1U;
+        p_root = p_new_root;
+
+        destroy_promoted(promoted, p_separator, current);
+      }
+
+      //*************************************************************************
+      /// Destroys the previously promoted key, if there is one.
+      //*************************************************************************
+      template <typename TStorage>
+      static void destroy_promoted(TStorage* promoted, const TKey* p_separator, size_t current)
+      {
+        // The previous promotion is in the other slot.
+        const TKey* p_previous = reinterpret_cast<const TKey*>(&promoted[1U - current]);
+
+        if (p_separator == p_previous)
+        {
+          p_previous->~TKey();
+        }
+      }
+
+      //*************************************************************************
+      /// Moves the keys [first, last) to the start of an empty internal node.
+      //*************************************************************************
+      static void move_keys(internal_node* p_from, size_t first, size_t last, internal_node* p_to)
+      {
+        size_t to = 0U;
+
+        while (first != last)
+        {
+          ::new (&p_to->keys[to]) TKey(p_from->key(first));
+          p_from->key(first).~TKey();
+          ++first;
+          ++to;
+        }
+
+        p_to->count = uint16_t(to);
+      }
+
+      //*************************************************************************
+      /// Restores the minimum fill of a leaf after an erase.
+      //*************************************************************************
+      void rebalance_leaf(path& route, leaf_node* p_leaf)
+      {
+        if (route.depth == 0U)
+        {
+          // The root leaf.
+          if (p_leaf->count == 0U)
+          {
+            p_leaf_pool->release(p_leaf);
+            p_root  = ETL_NULLPTR;
+            p_first = ETL_NULLPTR;
+            p_last  = ETL_NULLPTR;
+          }
+
+          return;
+        }
+
+        if (p_leaf->count >= Min_Node_Size)
+        {
+          return;
+        }
+
+        --route.depth;
+        internal_node* p_parent = route.nodes[route.depth];
+        const size_t   index    = route.indexes[route.depth];
+
+        leaf_node* p_left  = (index > 0U)              ? static_cast<leaf_node*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+        leaf_node* p_right = (index < p_parent->count) ? static_cast<leaf_node*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+        if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Node_Size))
+        {
+          // Borrow the last value of the left sibling.
+          shift_right(p_leaf, 0U);
+          move_value(p_left, p_left->count - 1U, p_leaf, 0U);
+          --p_left->count;
+          replace_key(p_parent, index - 1U, TKeyOf::key(p_leaf->value(0U)));
+        }
+        else if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Node_Size))
+        {
+          // Borrow the first value of the right sibling.
+          move_value(p_right, 0U, p_leaf, p_leaf->count);
+          ++p_leaf->count;
+          shift_left(p_right, 0U);
+          replace_key(p_parent, index, TKeyOf::key(p_right->value(0U)));
+        }
+        else if (p_left != ETL_NULLPTR)
+        {
+          merge_leaves(p_left, p_leaf);
+          remove_key(p_parent, index - 1U, index);
+          rebalance_internal(route, p_parent);
+        }
+        else
+        {
+          merge_leaves(p_leaf, p_right);
+          remove_key(p_parent, index, index + 1U);
+          rebalance_internal(route, p_parent);
+        }
+      }
+
+      //*************************************************************************
+      /// Moves all of the values of p_right to p_left and releases p_right.
+      //*************************************************************************
+      void merge_leaves(leaf_node* p_left, leaf_node* p_right)
+      {
+        move_values(p_right, 0U, p_right->count, p_left, p_left->count);
+        p_left->count = uint16_t(p_left->count + p_right->count);
+
+        p_left->next = p_right->next;
+
+        if (p_right->next != ETL_NULLPTR)
+        {
+          p_right->next->previous = p_left;
+        }
+        else
+        {
+          p_last = p_left;
+        }
+
+        p_leaf_pool->release(p_right);
+      }
+
+      //*************************************************************************
+      /// Restores the minimum fill of the internal nodes after a merge.
+      //*************************************************************************
+      void rebalance_internal(path& route, internal_node* p_node)
+      {
+        while (true)
+        {
+          if (route.depth == 0U)
+          {
+            // The root.
+            if (p_node->count == 0U)
+            {
+              p_root = p_node->children[0U];
+              p_internal_pool->release(p_node);
+            }
+
+            return;
+          }
+
+          if (p_node->count >= Min_Node_Size)
+          {
+            return;
+          }
+
+          --route.depth;
+          internal_node* p_parent = route.nodes[route.depth];
+          const size_t   index    = route.indexes[route.depth];
+
+          internal_node* p_left  = (index > 0U)              ? static_cast<internal_node*>(p_parent->children[index - 1U]) : ETL_NULLPTR;
+          internal_node* p_right = (index < p_parent->count) ? static_cast<internal_node*>(p_parent->children[index + 1U]) : ETL_NULLPTR;
+
+          if ((p_left != ETL_NULLPTR) && (p_left->count > Min_Node_Size))
+          {
+            // Rotate the last key of the left sibling through the parent.
+            const size_t last = p_left->count - 1U;
+
+            insert_key(p_node, 0U, p_parent->key(index - 1U), p_node->children[0U]);
+            p_node->children[0U] = p_left->children[last + 1U];
+
+            replace_key(p_parent, index - 1U, p_left->key(last));
+            p_left->key(last).~TKey();
+            --p_left->count;
+            return;
+          }
+
+          if ((p_right != ETL_NULLPTR) && (p_right->count > Min_Node_Size))
+          {
+            // Rotate the first key of the right sibling through the parent.
+            insert_key(p_node, p_node->count, p_parent->key(index), p_right->children[0U]);
+            replace_key(p_parent, index, p_right->key(0U));
+            remove_key(p_right, 0U, 0U);
+            return;
+          }
+
+          if (p_left != ETL_NULLPTR)
+          {
+            merge_internals(p_left, p_parent->key(index - 1U), p_node);
+            remove_key(p_parent, index - 1U, index);
+          }
+          else
+          {
+            merge_internals(p_node, p_parent->key(index), p_right);
+            remove_key(p_parent, index, index + 1U);
+          }
+
+          p_node = p_parent;
+        }
+      }
+
+      //*************************************************************************
+      /// Moves the separator and all of p_right to p_left and releases p_right.
+      //*************************************************************************
+      void merge_internals(internal_node* p_left, const TKey& separator, internal_node* p_right)
+      {
+        size_t to = p_left->count;
+
+        ::new (&p_left->keys[to]) TKey(separator);
+        p_left->children[to + 1U] = p_right->children[0U];
+        ++to;
+
+        for (size_t i = 0U; i < p_right->count; ++i)
+        {
+          ::new (&p_left->keys[to]) TKey(p_right->key(i));
+          p_right->key(i).~TKey();
+          p_left->children[to + 1U] = p_right->children[i + 1U];
+          ++to;
+        }
+
+        p_left->count = uint16_t(to);
+
+        p_internal_pool->release(p_right);
+      }
+
+      // Disable copy construction and assignment.
+      btree(const btree&) ETL_DELETE;
+      btree& operator =(const btree&) ETL_DELETE;
+
+      etl::ipool* p_leaf_pool;
+      etl::ipool* p_internal_pool;
+      node*       p_root;
+      leaf_node*  p_first;
+      leaf_node*  p_last;
+      size_t      current_size;
+      const size_t capacity_;
+
+      TKeyCompare key_comparator;
+    };
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename TKeyCompare, size_t VNode_Size>
+    ETL_CONSTANT size_t btree<TValue, TKey, TKeyOf, TKeyCompare, VNode_Size>::Node_Size;
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename TKeyCompare, size_t VNode_Size>
+    ETL_CONSTANT size_t btree<TValue, TKey, TKeyOf, TKeyCompare, VNode_Size>::Min_Node_Size;
+  }
+}
+
+#endif
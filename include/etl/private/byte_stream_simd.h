@@ -0,0 +1,328 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BYTE_STREAM_SIMD_INCLUDED
+#define ETL_BYTE_STREAM_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Vector implementations of the byte reversing copy used by the byte streams
+// for ranges of 16, 32 and 64 bit values.
+// Each function returns the number of values copied, which is always a
+// multiple of the number that fit in a vector. The caller handles the remainder.
+//*****************************************************************************
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_BYTE_STREAM_SIMD 1
+#else
+  #define ETL_USING_BYTE_STREAM_SIMD 0
+#endif
+
+// Stream VByte decoding needs a byte shuffle: SSSE3, or the AArch64 table lookup.
+#if ETL_USING_BYTE_STREAM_SIMD && (ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3 || (ETL_USING_SIMD_NEON && defined(__aarch64__) && !defined(__AARCH64EB__)))
+  #define ETL_USING_STREAM_VBYTE_SIMD 1
+#else
+  #define ETL_USING_STREAM_VBYTE_SIMD 0
+#endif
+
+#if ETL_USING_BYTE_STREAM_SIMD
+
+namespace etl
+{
+  namespace private_byte_stream
+  {
+    //*************************************************************************
+    /// The vector instructions for the target.
+    /// SSSE3 and AVX2 reverse with a byte shuffle. SSE2 swaps the bytes of
+    /// each 16 bit word after reordering the words. NEON has a reverse
+    /// instruction for each size.
+    //*************************************************************************
+    template <size_t Size>
+    struct simd_reverse_bytes;
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+    //*********************************
+    template <size_t Size>
+    struct simd_shuffle_reverse_bytes
+    {
+      // The shuffle index for byte i of a 16 byte lane.
+      static char index(int i)
+      {
+        return static_cast<char>((i - (i % int(Size))) + (int(Size) - 1 - (i % int(Size))));
+      }
+
+#if ETL_USING_SIMD_AVX2
+      static size_t copy(const char* source, char* destination, size_t n)
+      {
+        const __m256i mask = _mm256_setr_epi8(index(0),  index(1),  index(2),  index(3),  index(4),  index(5),  index(6),  index(7),
+                                              index(8),  index(9),  index(10), index(11), index(12), index(13), index(14), index(15),
+                                              index(0),  index(1),  index(2),  index(3),  index(4),  index(5),  index(6),  index(7),
+                                              index(8),  index(9),  index(10), index(11), index(12), index(13), index(14), index(15));
+
+        const size_t n_bytes = n * Size;
+
+        size_t i = 0U;
+
+        for (; (i + 32U) <= n_bytes; i += 32U)
+        {
+          const __m256i v = etl::private_simd::load_256(source + i);
+          etl::private_simd::store_256(destination + i, _mm256_shuffle_epi8(v, mask));
+        }
+
+        return i / Size;
+      }
+#else
+      static size_t copy(const char* source, char* destination, size_t n)
+      {
+        const __m128i mask = _mm_setr_epi8(index(0), index(1), index(2),  index(3),  index(4),  index(5),  index(6),  index(7),
+                                           index(8), index(9), index(10), index(11), index(12), index(13), index(14), index(15));
+
+        const size_t n_bytes = n * Size;
+
+        size_t i = 0U;
+
+        for (; (i + 16U) <= n_bytes; i += 16U)
+        {
+          const __m128i v = etl::private_simd::load_128(source + i);
+          etl::private_simd::store_128(destination + i, _mm_shuffle_epi8(v, mask));
+        }
+
+        return i / Size;
+      }
+#endif
+    };
+
+    template <>
+    struct simd_reverse_bytes<2U> : public simd_shuffle_reverse_bytes<2U>
+    {
+    };
+
+    template <>
+    struct simd_reverse_bytes<4U> : public simd_shuffle_reverse_bytes<4U>
+    {
+    };
+
+    template <>
+    struct simd_reverse_bytes<8U> : public simd_shuffle_reverse_bytes<8U>
+    {
+    };
+
+#elif ETL_USING_SIMD_SSE2
+    //*********************************
+    // Swaps the bytes in each 16 bit word.
+    inline __m128i sse2_swap_word_bytes(__m128i v)
+    {
+      return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+
+    //*********************************
+    template <size_t Size>
+    struct sse2_reverse_bytes
+    {
+      static __m128i reverse(__m128i v)
+      {
+        if (Size == 4U)
+        {
+          // Swap the words in each 32 bit value.
+          v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+        }
+        else if (Size == 8U)
+        {
+          // Reverse the words in each 64 bit value.
+          v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);
+        }
+
+        return sse2_swap_word_bytes(v);
+      }
+
+      static size_t copy(const char* source, char* destination, size_t n)
+      {
+        const size_t n_bytes = n * Size;
+
+        size_t i = 0U;
+
+        for (; (i + 16U) <= n_bytes; i += 16U)
+        {
+          const __m128i v = etl::private_simd::load_128(source + i);
+          etl::private_simd::store_128(destination + i, reverse(v));
+        }
+
+        return i / Size;
+      }
+    };
+
+    template <>
+    struct simd_reverse_bytes<2U> : public sse2_reverse_bytes<2U>
+    {
+    };
+
+    template <>
+    struct simd_reverse_bytes<4U> : public sse2_reverse_bytes<4U>
+    {
+    };
+
+    template <>
+    struct simd_reverse_bytes<8U> : public sse2_reverse_bytes<8U>
+    {
+    };
+
+#else
+    //*********************************
+    template <>
+    struct simd_reverse_bytes<2U>
+    {
+      static uint8x16_t reverse(uint8x16_t v) { return vrev16q_u8(v); }
+    };
+
+    template <>
+    struct simd_reverse_bytes<4U>
+    {
+      static uint8x16_t reverse(uint8x16_t v) { return vrev32q_u8(v); }
+    };
+
+    template <>
+    struct simd_reverse_bytes<8U>
+    {
+      static uint8x16_t reverse(uint8x16_t v) { return vrev64q_u8(v); }
+    };
+#endif
+
+    //*************************************************************************
+    /// Copies 'n' values of 'Size' bytes, reversing the bytes of each.
+    /// Returns the number of values copied.
+    //*************************************************************************
+    template <size_t Size>
+    typename etl::enable_if<(Size == 2U) || (Size == 4U) || (Size == 8U), size_t>::type
+      simd_reverse_bytes_copy(const char* source, char* destination, size_t n)
+    {
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3 || ETL_USING_SIMD_SSE2
+      return simd_reverse_bytes<Size>::copy(source, destination, n);
+#else
+      const uint8_t* psource      = reinterpret_cast<const uint8_t*>(source);
+      uint8_t*       pdestination = reinterpret_cast<uint8_t*>(destination);
+
+      const size_t n_bytes = n * Size;
+
+      size_t i = 0U;
+
+      for (; (i + 16U) <= n_bytes; i += 16U)
+      {
+        etl::private_simd::store_128(pdestination + i, simd_reverse_bytes<Size>::reverse(etl::private_simd::load_128(psource + i)));
+      }
+
+      return i / Size;
+#endif
+    }
+
+    //*********************************
+    template <size_t Size>
+    typename etl::enable_if<(Size != 2U) && (Size != 4U) && (Size != 8U), size_t>::type
+      simd_reverse_bytes_copy(const char*, char*, size_t)
+    {
+      return 0U;
+    }
+
+#if ETL_USING_STREAM_VBYTE_SIMD
+    //*************************************************************************
+    /// Decodes whole groups of four Stream VByte values.
+    /// The shuffle mask for each group is built from its control byte: each
+    /// output byte selects its value's offset in the data plus its position in
+    /// the value, or zero if beyond the value's length.
+    /// Stops when fewer than 16 data bytes remain, as each group loads 16.
+    /// Returns the number of values decoded and sets 'data_used'.
+    //*************************************************************************
+    inline size_t simd_stream_vbyte_decode(const unsigned char* control, const unsigned char* data, size_t data_size,
+                                           uint32_t* values, size_t length, size_t& data_used)
+    {
+      size_t i = 0U;
+
+      data_used = 0U;
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+      const __m128i positions = _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3);
+#else
+      const uint8_t position_bytes[16] = { 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 };
+      const uint8x16_t positions = etl::private_simd::load_128(position_bytes);
+#endif
+
+      for (; ((i + 4U) <= length) && ((data_used + 16U) <= data_size); i += 4U)
+      {
+        const uint32_t c = control[i / 4U];
+
+        const uint32_t length0 = (c & 0x03U) + 1U;
+        const uint32_t length1 = ((c >> 2U) & 0x03U) + 1U;
+        const uint32_t length2 = ((c >> 4U) & 0x03U) + 1U;
+        const uint32_t length3 = ((c >> 6U) & 0x03U) + 1U;
+
+        const uint32_t offset1 = length0;
+        const uint32_t offset2 = offset1 + length1;
+        const uint32_t offset3 = offset2 + length2;
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3
+        const __m128i offsets = _mm_setr_epi32(0, static_cast<int>(offset1 * 0x01010101UL), static_cast<int>(offset2 * 0x01010101UL), static_cast<int>(offset3 * 0x01010101UL));
+        const __m128i lengths = _mm_setr_epi32(static_cast<int>(length0 * 0x01010101UL), static_cast<int>(length1 * 0x01010101UL),
+                                               static_cast<int>(length2 * 0x01010101UL), static_cast<int>(length3 * 0x01010101UL));
+
+        const __m128i in_value = _mm_cmpgt_epi8(lengths, positions);
+        const __m128i mask     = _mm_or_si128(_mm_add_epi8(offsets, positions), _mm_andnot_si128(in_value, _mm_set1_epi8(static_cast<char>(0x80))));
+
+        const __m128i v = etl::private_simd::load_128(data + data_used);
+        etl::private_simd::store_128(values + i, _mm_shuffle_epi8(v, mask));
+#else
+        const uint32_t offset_words[4] = { 0U, offset1 * 0x01010101UL, offset2 * 0x01010101UL, offset3 * 0x01010101UL };
+        const uint32_t length_words[4] = { length0 * 0x01010101UL, length1 * 0x01010101UL, length2 * 0x01010101UL, length3 * 0x01010101UL };
+
+        const uint8x16_t offsets  = vreinterpretq_u8_u32(vld1q_u32(offset_words));
+        const uint8x16_t lengths  = vreinterpretq_u8_u32(vld1q_u32(length_words));
+        const uint8x16_t in_value = vcgtq_u8(lengths, positions);
+        const uint8x16_t mask     = vorrq_u8(vaddq_u8(offsets, positions), vmvnq_u8(in_value));
+
+        // Indexes of 16 or more select zero.
+        const uint8x16_t v = etl::private_simd::load_128(data + data_used);
+        vst1q_u32(values + i, vreinterpretq_u32_u8(vqtbl1q_u8(v, mask)));
+#endif
+
+        data_used += offset3 + length3;
+      }
+
+      return i;
+    }
+#endif
+  }
+}
+
+#endif
+#endif
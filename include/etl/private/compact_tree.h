@@ -0,0 +1,721 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_COMPACT_TREE_INCLUDED
+#define ETL_PRIVATE_COMPACT_TREE_INCLUDED
+
+#include "../platform.h"
+#include "../alignment.h"
+#include "../placement_new.h"
+#include "../smallest.h"
+#include "../static_assert.h"
+#include "../type_traits.h"
+#include "../utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_compact_tree
+  {
+    //*************************************************************************
+    /// A red-black tree whose nodes are linked by index in to a fixed array,
+    /// rather than by pointer.
+    /// The index type is the smallest unsigned type that holds VMax_Size, so
+    /// a tree of up to 65535 nodes has 16 bit links: three links and a colour
+    /// take 7 bytes, against 24 to 32 bytes for pointers.
+    /// A sentinel link, at index VMax_Size, stands in for the null leaves.
+    /// Unused nodes are kept on a free list, linked through their right link,
+    /// and are added to it as they are first needed.
+    ///\tparam TValue    The stored value type.
+    ///\tparam TKey      The key type.
+    ///\tparam TKeyOf    Functor returning the key of a value.
+    ///\tparam TCompare  Key comparison functor.
+    ///\tparam VMax_Size The maximum number of values.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare, size_t VMax_Size>
+    class compact_tree
+    {
+    public:
+
+      ETL_STATIC_ASSERT(VMax_Size > 0U, "Zero capacity compact tree");
+
+      typedef typename etl::smallest_uint_for_value<VMax_Size>::type index_type;
+
+      /// The index of the null leaf.
+      static ETL_CONSTANT index_type Null = index_type(VMax_Size);
+
+      //***********************************************************************
+      compact_tree()
+        : root(Null)
+        , free_head(Null)
+        , items_initialised(0U)
+        , current_size(0U)
+      {
+        sentinel.left   = Null;
+        sentinel.right  = Null;
+        sentinel.parent = Null;
+        sentinel.colour = Black;
+      }
+
+      //***********************************************************************
+      ~compact_tree()
+      {
+        clear();
+      }
+
+      //***********************************************************************
+      /// The value at an index.
+      //***********************************************************************
+      TValue& value(index_type i)
+      {
+        return *reinterpret_cast<TValue*>(&nodes[i].storage);
+      }
+
+      //***********************************************************************
+      const TValue& value(index_type i) const
+      {
+        return *reinterpret_cast<const TValue*>(&nodes[i].storage);
+      }
+
+      //***********************************************************************
+      /// The index of the smallest value, or Null.
+      //***********************************************************************
+      index_type first() const
+      {
+        return (root == Null) ? Null : minimum(root);
+      }
+
+      //***********************************************************************
+      /// The index of the largest value, or Null.
+      //***********************************************************************
+      index_type last() const
+      {
+        return (root == Null) ? Null : maximum(root);
+      }
+
+      //***********************************************************************
+      /// The index of the next value, or Null.
+      //***********************************************************************
+      index_type next(index_type i) const
+      {
+        if (link(i).right != Null)
+        {
+          return minimum(link(i).right);
+        }
+
+        index_type p = link(i).parent;
+
+        while ((p != Null) && (i == link(p).right))
+        {
+          i = p;
+          p = link(p).parent;
+        }
+
+        return p;
+      }
+
+      //***********************************************************************
+      /// The index of the previous value, or Null.
+      /// The value before Null is the last.
+      //***********************************************************************
+      index_type previous(index_type i) const
+      {
+        if (i == Null)
+        {
+          return last();
+        }
+
+        if (link(i).left != Null)
+        {
+          return maximum(link(i).left);
+        }
+
+        index_type p = link(i).parent;
+
+        while ((p != Null) && (i == link(p).left))
+        {
+          i = p;
+          p = link(p).parent;
+        }
+
+        return p;
+      }
+
+      //***********************************************************************
+      /// The index of the value with the key, or Null.
+      //***********************************************************************
+      index_type find(const TKey& key) const
+      {
+        const index_type i = lower_bound(key);
+
+        return ((i != Null) && !compare(key, key_of(value(i)))) ? i : Null;
+      }
+
+      //***********************************************************************
+      /// The index of the first value with a key not less than 'key', or Null.
+      //***********************************************************************
+      index_type lower_bound(const TKey& key) const
+      {
+        index_type i      = root;
+        index_type result = Null;
+
+        while (i != Null)
+        {
+          if (!compare(key_of(value(i)), key))
+          {
+            result = i;
+            i      = link(i).left;
+          }
+          else
+          {
+            i = link(i).right;
+          }
+        }
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// The index of the first value with a key greater than 'key', or Null.
+      //***********************************************************************
+      index_type upper_bound(const TKey& key) const
+      {
+        index_type i      = root;
+        index_type result = Null;
+
+        while (i != Null)
+        {
+          if (compare(key, key_of(value(i))))
+          {
+            result = i;
+            i      = link(i).left;
+          }
+          else
+          {
+            i = link(i).right;
+          }
+        }
+
+        return result;
+      }
+
+      //***********************************************************************
+      /// Finds where a key would be inserted.
+      ///\param parent Set to the parent of the new value.
+      ///\param left   Set to true if the new value is the parent's left child.
+      ///\return The index of the value with the key, or Null if there is none.
+      //***********************************************************************
+      index_type locate(const TKey& key, index_type& parent, bool& left) const
+      {
+        index_type i = root;
+
+        parent = Null;
+        left   = true;
+
+        while (i != Null)
+        {
+          parent = i;
+
+          if (compare(key, key_of(value(i))))
+          {
+            left = true;
+            i    = link(i).left;
+          }
+          else if (compare(key_of(value(i)), key))
+          {
+            left = false;
+            i    = link(i).right;
+          }
+          else
+          {
+            return i;
+          }
+        }
+
+        return Null;
+      }
+
+      //***********************************************************************
+      /// Constructs a value from 'arg' and links it at the position found by locate().
+      /// The tree must not be full.
+      ///\return The index of the new value.
+      //***********************************************************************
+      template <typename TArg>
+      index_type insert_at(index_type parent, bool left, const TArg& arg)
+      {
+        const index_type z = allocate();
+
+        ::new (&nodes[z].storage) TValue(arg);
+
+        link_type& lz = link(z);
+        lz.left   = Null;
+        lz.right  = Null;
+        lz.parent = parent;
+        lz.colour = Red;
+
+        if (parent == Null)
+        {
+          root = z;
+        }
+        else if (left)
+        {
+          link(parent).left = z;
+        }
+        else
+        {
+          link(parent).right = z;
+        }
+
+        insert_fixup(z);
+        ++current_size;
+
+        return z;
+      }
+
+      //***********************************************************************
+      /// Unlinks and destroys the value at an index.
+      //***********************************************************************
+      void erase(index_type z)
+      {
+        index_type y         = z;
+        uint8_t    y_colour  = link(y).colour;
+        index_type x;
+
+        if (link(z).left == Null)
+        {
+          x = link(z).right;
+          transplant(z, x);
+        }
+        else if (link(z).right == Null)
+        {
+          x = link(z).left;
+          transplant(z, x);
+        }
+        else
+        {
+          y        = minimum(link(z).right);
+          y_colour = link(y).colour;
+          x        = link(y).right;
+
+          if (link(y).parent == z)
+          {
+            link(x).parent = y;
+          }
+          else
+          {
+            transplant(y, link(y).right);
+            link(y).right = link(z).right;
+            link(link(y).right).parent = y;
+          }
+
+          transplant(z, y);
+          link(y).left = link(z).left;
+          link(link(y).left).parent = y;
+          link(y).colour = link(z).colour;
+        }
+
+        if (y_colour == Black)
+        {
+          erase_fixup(x);
+        }
+
+        value(z).~TValue();
+        release(z);
+        --current_size;
+      }
+
+      //***********************************************************************
+      /// Destroys all of the values.
+      //***********************************************************************
+      void clear()
+      {
+        if (!etl::is_trivially_destructible<TValue>::value)
+        {
+          for (index_type i = first(); i != Null; i = next(i))
+          {
+            value(i).~TValue();
+          }
+        }
+
+        root              = Null;
+        free_head         = Null;
+        items_initialised = 0U;
+        current_size      = 0U;
+        sentinel.parent   = Null;
+      }
+
+      //***********************************************************************
+      size_t size() const
+      {
+        return current_size;
+      }
+
+      //***********************************************************************
+      bool empty() const
+      {
+        return current_size == 0U;
+      }
+
+      //***********************************************************************
+      bool full() const
+      {
+        return current_size == VMax_Size;
+      }
+
+      //***********************************************************************
+      /// The key comparison functor.
+      //***********************************************************************
+      TCompare key_comp() const
+      {
+        return compare;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint8_t Red   = 0U;
+      static ETL_CONSTANT uint8_t Black = 1U;
+
+      //***********************************************************************
+      /// The links of a node.
+      //***********************************************************************
+      struct link_type
+      {
+        index_type left;
+        index_type right;
+        index_type parent;
+        uint8_t    colour;
+      };
+
+      //***********************************************************************
+      /// A node is its links followed by the storage for its value.
+      //***********************************************************************
+      struct node_type
+      {
+        link_type link;
+        typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type storage;
+      };
+
+      //***********************************************************************
+      link_type& link(index_type i)
+      {
+        return (i == Null) ? sentinel : nodes[i].link;
+      }
+
+      //***********************************************************************
+      const link_type& link(index_type i) const
+      {
+        return (i == Null) ? sentinel : nodes[i].link;
+      }
+
+      //***********************************************************************
+      index_type minimum(index_type i) const
+      {
+        while (link(i).left != Null)
+        {
+          i = link(i).left;
+        }
+
+        return i;
+      }
+
+      //***********************************************************************
+      index_type maximum(index_type i) const
+      {
+        while (link(i).right != Null)
+        {
+          i = link(i).right;
+        }
+
+        return i;
+      }
+
+      //***********************************************************************
+      index_type allocate()
+      {
+        index_type i;
+
+        if (free_head != Null)
+        {
+          i         = free_head;
+          free_head = nodes[i].link.right;
+        }
+        else
+        {
+          i = index_type(items_initialised++);
+        }
+
+        return i;
+      }
+
+      //***********************************************************************
+      void release(index_type i)
+      {
+        nodes[i].link.right = free_head;
+        free_head           = i;
+      }
+
+      //***********************************************************************
+      void rotate_left(index_type x)
+      {
+        const index_type y = link(x).right;
+
+        link(x).right = link(y).left;
+
+        if (link(y).left != Null)
+        {
+          link(link(y).left).parent = x;
+        }
+
+        replace_child(x, y);
+
+        link(y).left   = x;
+        link(x).parent = y;
+      }
+
+      //***********************************************************************
+      void rotate_right(index_type x)
+      {
+        const index_type y = link(x).left;
+
+        link(x).left = link(y).right;
+
+        if (link(y).right != Null)
+        {
+          link(link(y).right).parent = x;
+        }
+
+        replace_child(x, y);
+
+        link(y).right  = x;
+        link(x).parent = y;
+      }
+
+      //***********************************************************************
+      /// Makes 'v' the child of the parent of 'u', in place of 'u'.
+      //***********************************************************************
+      void replace_child(index_type u, index_type v)
+      {
+        const index_type p = link(u).parent;
+
+        if (p == Null)
+        {
+          root = v;
+        }
+        else if (u == link(p).left)
+        {
+          link(p).left = v;
+        }
+        else
+        {
+          link(p).right = v;
+        }
+
+        link(v).parent = p;
+      }
+
+      //***********************************************************************
+      void transplant(index_type u, index_type v)
+      {
+        replace_child(u, v);
+      }
+
+      //***********************************************************************
+      void insert_fixup(index_type z)
+      {
+        while (link(link(z).parent).colour == Red)
+        {
+          index_type zp  = link(z).parent;
+          index_type zpp = link(zp).parent;
+
+          if (zp == link(zpp).left)
+          {
+            const index_type y = link(zpp).right;
+
+            if (link(y).colour == Red)
+            {
+              link(zp).colour  = Black;
+              link(y).colour   = Black;
+              link(zpp).colour = Red;
+              z = zpp;
+            }
+            else
+            {
+              if (z == link(zp).right)
+              {
+                z = zp;
+                rotate_left(z);
+                zp  = link(z).parent;
+                zpp = link(zp).parent;
+              }
+
+              link(zp).colour  = Black;
+              link(zpp).colour = Red;
+              rotate_right(zpp);
+            }
+          }
+          else
+          {
+            const index_type y = link(zpp).left;
+
+            if (link(y).colour == Red)
+            {
+              link(zp).colour  = Black;
+              link(y).colour   = Black;
+              link(zpp).colour = Red;
+              z = zpp;
+            }
+            else
+            {
+              if (z == link(zp).left)
+              {
+                z = zp;
+                rotate_right(z);
+                zp  = link(z).parent;
+                zpp = link(zp).parent;
+              }
+
+              link(zp).colour  = Black;
+              link(zpp).colour = Red;
+              rotate_left(zpp);
+            }
+          }
+        }
+
+        link(root).colour = Black;
+      }
+
+      //***********************************************************************
+      void erase_fixup(index_type x)
+      {
+        while ((x != root) && (link(x).colour == Black))
+        {
+          const index_type xp = link(x).parent;
+
+          if (x == link(xp).left)
+          {
+            index_type w = link(xp).right;
+
+            if (link(w).colour == Red)
+            {
+              link(w).colour  = Black;
+              link(xp).colour = Red;
+              rotate_left(xp);
+              w = link(xp).right;
+            }
+
+            if ((link(link(w).left).colour == Black) && (link(link(w).right).colour == Black))
+            {
+              link(w).colour = Red;
+              x = xp;
+            }
+            else
+            {
+              if (link(link(w).right).colour == Black)
+              {
+                link(link(w).left).colour = Black;
+                link(w).colour = Red;
+                rotate_right(w);
+                w = link(xp).right;
+              }
+
+              link(w).colour  = link(xp).colour;
+              link(xp).colour = Black;
+              link(link(w).right).colour = Black;
+              rotate_left(xp);
+              x = root;
+            }
+          }
+          else
+          {
+            index_type w = link(xp).left;
+
+            if (link(w).colour == Red)
+            {
+              link(w).colour  = Black;
+              link(xp).colour = Red;
+              rotate_right(xp);
+              w = link(xp).left;
+            }
+
+            if ((link(link(w).right).colour == Black) && (link(link(w).left).colour == Black))
+            {
+              link(w).colour = Red;
+              x = xp;
+            }
+            else
+            {
+              if (link(link(w).left).colour == Black)
+              {
+                link(link(w).right).colour = Black;
+                link(w).colour = Red;
+                rotate_left(w);
+                w = link(xp).left;
+              }
+
+              link(w).colour  = link(xp).colour;
+              link(xp).colour = Black;
+              link(link(w).left).colour = Black;
+              rotate_right(xp);
+              x = root;
+            }
+          }
+        }
+
+        link(x).colour = Black;
+      }
+
+      node_type  nodes[VMax_Size];
+      link_type  sentinel;
+      index_type root;
+      index_type free_head;
+      size_t     items_initialised;
+      size_t     current_size;
+      TKeyOf     key_of;
+      TCompare   compare;
+
+      // Disabled.
+      compact_tree(const compact_tree&) ETL_DELETE;
+      compact_tree& operator =(const compact_tree&) ETL_DELETE;
+    };
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare, size_t VMax_Size>
+    ETL_CONSTANT typename compact_tree<TValue, TKey, TKeyOf, TCompare, VMax_Size>::index_type compact_tree<TValue, TKey, TKeyOf, TCompare, VMax_Size>::Null;
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare, size_t VMax_Size>
+    ETL_CONSTANT uint8_t compact_tree<TValue, TKey, TKeyOf, TCompare, VMax_Size>::Red;
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename TCompare, size_t VMax_Size>
+    ETL_CONSTANT uint8_t compact_tree<TValue, TKey, TKeyOf, TCompare, VMax_Size>::Black;
+  }
+}
+
+#endif
@@ -0,0 +1,393 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONDITIONING_SIMD_INCLUDED
+#define ETL_CONDITIONING_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Block kernels for the signal conditioning functors.
+// The generic versions are written as selects rather than branches, so that
+// the compiler may vectorise them. int16_t, int32_t and float blocks use
+// vector instructions where the target supports them.
+// Each kernel gives the same result as applying the functor to each sample.
+// The input and output may be the same buffer.
+//*****************************************************************************
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_CONDITIONING_SIMD 1
+#else
+  #define ETL_USING_CONDITIONING_SIMD 0
+#endif
+
+namespace etl
+{
+  namespace private_conditioning
+  {
+    //*************************************************************************
+    /// The vector for the target.
+    /// Only specialised for the types that the target supports.
+    //*************************************************************************
+    template <typename T>
+    struct simd_lanes
+    {
+      static ETL_CONSTANT bool Supported = false;
+    };
+
+    template <typename T>
+    ETL_CONSTANT bool simd_lanes<T>::Supported;
+
+#if ETL_USING_CONDITIONING_SIMD
+  #if ETL_USING_SIMD_AVX2
+    template <>
+    struct simd_lanes<int16_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 16U;
+
+      typedef __m256i type;
+      typedef __m256i mask;
+
+      static type load(const int16_t* p)          { return etl::private_simd::load_256(p); }
+      static void store(int16_t* p, type v)       { etl::private_simd::store_256(p, v); }
+      static type set(int16_t v)                  { return _mm256_set1_epi16(v); }
+      static type sub(type a, type b)             { return _mm256_sub_epi16(a, b); }
+      static mask less(type a, type b)            { return _mm256_cmpgt_epi16(b, a); }
+      static type select(mask m, type a, type b)  { return _mm256_blendv_epi8(b, a, m); }
+    };
+
+    template <>
+    struct simd_lanes<int32_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 8U;
+
+      typedef __m256i type;
+      typedef __m256i mask;
+
+      static type load(const int32_t* p)          { return etl::private_simd::load_256(p); }
+      static void store(int32_t* p, type v)       { etl::private_simd::store_256(p, v); }
+      static type set(int32_t v)                  { return _mm256_set1_epi32(v); }
+      static type sub(type a, type b)             { return _mm256_sub_epi32(a, b); }
+      static mask less(type a, type b)            { return _mm256_cmpgt_epi32(b, a); }
+      static type select(mask m, type a, type b)  { return _mm256_blendv_epi8(b, a, m); }
+    };
+
+    template <>
+    struct simd_lanes<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 8U;
+
+      typedef __m256 type;
+      typedef __m256 mask;
+
+      static type load(const float* p)            { return _mm256_loadu_ps(p); }
+      static void store(float* p, type v)         { _mm256_storeu_ps(p, v); }
+      static type set(float v)                    { return _mm256_set1_ps(v); }
+      static type sub(type a, type b)             { return _mm256_sub_ps(a, b); }
+      static mask less(type a, type b)            { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+      static type select(mask m, type a, type b)  { return _mm256_blendv_ps(b, a, m); }
+    };
+  #elif ETL_USING_SIMD_SSE2
+    template <>
+    struct simd_lanes<int16_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 8U;
+
+      typedef __m128i type;
+      typedef __m128i mask;
+
+      static type load(const int16_t* p)          { return etl::private_simd::load_128(p); }
+      static void store(int16_t* p, type v)       { etl::private_simd::store_128(p, v); }
+      static type set(int16_t v)                  { return _mm_set1_epi16(v); }
+      static type sub(type a, type b)             { return _mm_sub_epi16(a, b); }
+      static mask less(type a, type b)            { return _mm_cmplt_epi16(a, b); }
+      static type select(mask m, type a, type b)  { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    };
+
+    template <>
+    struct simd_lanes<int32_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef __m128i type;
+      typedef __m128i mask;
+
+      static type load(const int32_t* p)          { return etl::private_simd::load_128(p); }
+      static void store(int32_t* p, type v)       { etl::private_simd::store_128(p, v); }
+      static type set(int32_t v)                  { return _mm_set1_epi32(v); }
+      static type sub(type a, type b)             { return _mm_sub_epi32(a, b); }
+      static mask less(type a, type b)            { return _mm_cmplt_epi32(a, b); }
+      static type select(mask m, type a, type b)  { return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    };
+
+    template <>
+    struct simd_lanes<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef __m128 type;
+      typedef __m128 mask;
+
+      static type load(const float* p)            { return _mm_loadu_ps(p); }
+      static void store(float* p, type v)         { _mm_storeu_ps(p, v); }
+      static type set(float v)                    { return _mm_set1_ps(v); }
+      static type sub(type a, type b)             { return _mm_sub_ps(a, b); }
+      static mask less(type a, type b)            { return _mm_cmplt_ps(a, b); }
+      static type select(mask m, type a, type b)  { return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+    };
+  #else
+    template <>
+    struct simd_lanes<int16_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 8U;
+
+      typedef int16x8_t  type;
+      typedef uint16x8_t mask;
+
+      static type load(const int16_t* p)          { return vld1q_s16(p); }
+      static void store(int16_t* p, type v)       { vst1q_s16(p, v); }
+      static type set(int16_t v)                  { return vdupq_n_s16(v); }
+      static type sub(type a, type b)             { return vsubq_s16(a, b); }
+      static mask less(type a, type b)            { return vcltq_s16(a, b); }
+      static type select(mask m, type a, type b)  { return vbslq_s16(m, a, b); }
+    };
+
+    template <>
+    struct simd_lanes<int32_t>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef int32x4_t  type;
+      typedef uint32x4_t mask;
+
+      static type load(const int32_t* p)          { return vld1q_s32(p); }
+      static void store(int32_t* p, type v)       { vst1q_s32(p, v); }
+      static type set(int32_t v)                  { return vdupq_n_s32(v); }
+      static type sub(type a, type b)             { return vsubq_s32(a, b); }
+      static mask less(type a, type b)            { return vcltq_s32(a, b); }
+      static type select(mask m, type a, type b)  { return vbslq_s32(m, a, b); }
+    };
+
+    template <>
+    struct simd_lanes<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef float32x4_t type;
+      typedef uint32x4_t  mask;
+
+      static type load(const float* p)            { return vld1q_f32(p); }
+      static void store(float* p, type v)         { vst1q_f32(p, v); }
+      static type set(float v)                    { return vdupq_n_f32(v); }
+      static type sub(type a, type b)             { return vsubq_f32(a, b); }
+      static mask less(type a, type b)            { return vcltq_f32(a, b); }
+      static type select(mask m, type a, type b)  { return vbslq_f32(m, a, b); }
+    };
+  #endif
+#endif
+
+    //*************************************************************************
+    /// Block kernels.
+    /// The generic versions, for types without vector support.
+    //*************************************************************************
+    template <typename T, bool Simd = simd_lanes<T>::Supported>
+    struct block_kernel
+    {
+      //*********************************
+      /// value < lowest ? lowest : highest < value ? highest : value
+      //*********************************
+      static void limit(const T* in, T* out, size_t n, T lowest, T highest)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const T value   = in[i];
+          const T limited = (highest < value) ? highest : value;
+
+          out[i] = (value < lowest) ? lowest : limited;
+        }
+      }
+
+      //*********************************
+      /// value < threshold_value ? true_value : false_value
+      /// When 'Swap' is true, threshold_value < value.
+      //*********************************
+      template <bool Swap>
+      static void threshold(const T* in, T* out, size_t n, T threshold_value, T true_value, T false_value)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const T value = in[i];
+
+          out[i] = (Swap ? (threshold_value < value) : (value < threshold_value)) ? true_value : false_value;
+        }
+      }
+
+      //*********************************
+      /// minuend - (value - offset)
+      //*********************************
+      static void invert(const T* in, T* out, size_t n, T offset, T minuend)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          out[i] = minuend - (in[i] - offset);
+        }
+      }
+
+      //*********************************
+      /// The quantization of the first threshold that the value is less than,
+      /// or the last quantization if there is none.
+      //*********************************
+      static void quantize(const T* in, T* out, size_t n, const T* p_thresholds, const T* p_quantizations, size_t n_levels)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const T value  = in[i];
+          T       result = p_quantizations[n_levels];
+
+          // Working down from the last threshold leaves the first match.
+          for (size_t level = n_levels; level != 0U; --level)
+          {
+            result = (value < p_thresholds[level - 1U]) ? p_quantizations[level - 1U] : result;
+          }
+
+          out[i] = result;
+        }
+      }
+    };
+
+#if ETL_USING_CONDITIONING_SIMD
+    //*************************************************************************
+    /// Block kernels for types with vector support.
+    /// The samples after the last whole vector use the generic versions.
+    //*************************************************************************
+    template <typename T>
+    struct block_kernel<T, true>
+    {
+      typedef simd_lanes<T>           lanes;
+      typedef typename lanes::type    type;
+      typedef block_kernel<T, false>  generic;
+
+      //*********************************
+      static void limit(const T* in, T* out, size_t n, T lowest, T highest)
+      {
+        const type lo = lanes::set(lowest);
+        const type hi = lanes::set(highest);
+
+        size_t i = 0U;
+
+        for (; (i + lanes::Size) <= n; i += lanes::Size)
+        {
+          const type value   = lanes::load(in + i);
+          const type limited = lanes::select(lanes::less(hi, value), hi, value);
+
+          lanes::store(out + i, lanes::select(lanes::less(value, lo), lo, limited));
+        }
+
+        generic::limit(in + i, out + i, n - i, lowest, highest);
+      }
+
+      //*********************************
+      template <bool Swap>
+      static void threshold(const T* in, T* out, size_t n, T threshold_value, T true_value, T false_value)
+      {
+        const type t  = lanes::set(threshold_value);
+        const type tv = lanes::set(true_value);
+        const type fv = lanes::set(false_value);
+
+        size_t i = 0U;
+
+        for (; (i + lanes::Size) <= n; i += lanes::Size)
+        {
+          const type value = lanes::load(in + i);
+
+          lanes::store(out + i, lanes::select(Swap ? lanes::less(t, value) : lanes::less(value, t), tv, fv));
+        }
+
+        generic::template threshold<Swap>(in + i, out + i, n - i, threshold_value, true_value, false_value);
+      }
+
+      //*********************************
+      static void invert(const T* in, T* out, size_t n, T offset, T minuend)
+      {
+        const type o = lanes::set(offset);
+        const type m = lanes::set(minuend);
+
+        size_t i = 0U;
+
+        for (; (i + lanes::Size) <= n; i += lanes::Size)
+        {
+          lanes::store(out + i, lanes::sub(m, lanes::sub(lanes::load(in + i), o)));
+        }
+
+        generic::invert(in + i, out + i, n - i, offset, minuend);
+      }
+
+      //*********************************
+      static void quantize(const T* in, T* out, size_t n, const T* p_thresholds, const T* p_quantizations, size_t n_levels)
+      {
+        const type last = lanes::set(p_quantizations[n_levels]);
+
+        size_t i = 0U;
+
+        for (; (i + lanes::Size) <= n; i += lanes::Size)
+        {
+          const type value  = lanes::load(in + i);
+          type       result = last;
+
+          for (size_t level = n_levels; level != 0U; --level)
+          {
+            result = lanes::select(lanes::less(value, lanes::set(p_thresholds[level - 1U])), lanes::set(p_quantizations[level - 1U]), result);
+          }
+
+          lanes::store(out + i, result);
+        }
+
+        generic::quantize(in + i, out + i, n - i, p_thresholds, p_quantizations, n_levels);
+      }
+    };
+#endif
+  }
+}
+
+#endif
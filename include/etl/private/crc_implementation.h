@@ -41,12 +41,50 @@ SOFTWARE.
 
 #include "crc_parameters.h"
 
+#if ETL_USING_BUILTIN_CRC32C || ETL_USING_BUILTIN_CRC32
+  #include <string.h>
+
+  #if defined(__ARM_FEATURE_CRC32)
+    #include <arm_acle.h>
+  #else
+    #include <nmmintrin.h>
+  #endif
+#endif
+
+#if ETL_USING_SIMD_CLMUL
+  #include "simd.h"
+
+  #include <string.h>
+#endif
+
 #if defined(ETL_COMPILER_KEIL)
 #pragma diag_suppress 1300
 #endif
 
 namespace etl
 {
+  //*****************************************************************************
+  /// Table sizes that select the slice-by-8 and slice-by-16 implementations.
+  //*****************************************************************************
+  static ETL_CONSTANT size_t crc_slice_by_8  = 8U * 256U;
+  static ETL_CONSTANT size_t crc_slice_by_16 = 16U * 256U;
+
+  //*****************************************************************************
+  /// The implementation that uses the target's CRC instructions where they
+  /// support the polynomial, otherwise carry-less multiply folding where the
+  /// target has it, otherwise the slice-by-8 tables.
+  /// See etl::traits::using_builtin_crc32c, etl::traits::using_builtin_crc32
+  /// and etl::traits::using_simd_clmul.
+  //*****************************************************************************
+  struct crc_accelerated_tag
+  {
+  };
+
+  //*****************************************************************************
+  /// The table size that selects crc_accelerated_tag. It is not the size of a table.
+  //*****************************************************************************
+  static ETL_CONSTANT size_t crc_accelerated = ~size_t(0U);
+
   namespace private_crc
   {
     //*****************************************************************************
@@ -587,22 +625,927 @@ namespace etl
       }
     };
 
+    //*****************************************************************************
+    /// CRC Slice Table Entry
+    /// The CRC of byte 'Index' followed by 'Slice' zero bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    class crc_slice_table_entry
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice - 1U>::value;
+
+      static ETL_CONSTANT size_t Previous_Index = Reflect ? size_t(Previous & 0xFFU)
+                                                          : size_t((Previous >> (Accumulator_Bits - 8U)) & 0xFFU);
+
+      static ETL_CONSTANT TAccumulator Shifted = Reflect ? TAccumulator(Previous >> 8U) : TAccumulator(Previous << 8U);
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(Shifted ^ crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Previous_Index, 8U>::value);
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT size_t crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Previous_Index;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::Shifted;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index, size_t Slice>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::value;
+
+    //*********************************
+    // The first slice is the standard 256 entry table.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    class crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 8U>::value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Index>
+    ETL_CONSTANT TAccumulator crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, 0U>::value;
+
+    //*****************************************************************************
+    /// CRC Slice Tables.
+    /// Slice-by-N tables that process N bytes per iteration for contiguous blocks.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table_data;
+
+#define ETL_CRC_SLICE_TABLE_ENTRY(Slice, Index) crc_slice_table_entry<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Index, Slice>::value
+
+#define ETL_CRC_SLICE_TABLE_ROW(Slice) \
+  { \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 0U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 1U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 2U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 3U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 4U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 5U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 6U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 7U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 8U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 9U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 10U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 11U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 12U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 13U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 14U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 15U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 16U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 17U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 18U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 19U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 20U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 21U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 22U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 23U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 24U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 25U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 26U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 27U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 28U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 29U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 30U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 31U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 32U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 33U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 34U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 35U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 36U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 37U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 38U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 39U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 40U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 41U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 42U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 43U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 44U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 45U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 46U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 47U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 48U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 49U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 50U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 51U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 52U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 53U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 54U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 55U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 56U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 57U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 58U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 59U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 60U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 61U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 62U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 63U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 64U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 65U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 66U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 67U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 68U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 69U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 70U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 71U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 72U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 73U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 74U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 75U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 76U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 77U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 78U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 79U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 80U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 81U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 82U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 83U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 84U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 85U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 86U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 87U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 88U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 89U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 90U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 91U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 92U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 93U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 94U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 95U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 96U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 97U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 98U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 99U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 100U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 101U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 102U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 103U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 104U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 105U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 106U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 107U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 108U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 109U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 110U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 111U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 112U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 113U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 114U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 115U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 116U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 117U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 118U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 119U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 120U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 121U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 122U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 123U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 124U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 125U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 126U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 127U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 128U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 129U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 130U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 131U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 132U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 133U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 134U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 135U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 136U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 137U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 138U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 139U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 140U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 141U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 142U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 143U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 144U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 145U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 146U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 147U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 148U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 149U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 150U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 151U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 152U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 153U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 154U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 155U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 156U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 157U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 158U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 159U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 160U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 161U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 162U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 163U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 164U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 165U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 166U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 167U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 168U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 169U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 170U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 171U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 172U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 173U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 174U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 175U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 176U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 177U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 178U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 179U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 180U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 181U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 182U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 183U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 184U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 185U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 186U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 187U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 188U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 189U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 190U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 191U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 192U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 193U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 194U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 195U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 196U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 197U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 198U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 199U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 200U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 201U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 202U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 203U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 204U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 205U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 206U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 207U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 208U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 209U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 210U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 211U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 212U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 213U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 214U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 215U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 216U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 217U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 218U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 219U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 220U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 221U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 222U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 223U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 224U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 225U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 226U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 227U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 228U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 229U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 230U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 231U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 232U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 233U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 234U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 235U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 236U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 237U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 238U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 239U),\
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 240U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 241U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 242U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 243U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 244U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 245U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 246U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 247U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 248U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 249U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 250U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 251U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 252U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 253U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 254U), \
+    ETL_CRC_SLICE_TABLE_ENTRY(Slice, 255U) \
+  }
+
+    //*********************************
+    // Slice-by-8.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+      static const TAccumulator table[8U][256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    const TAccumulator crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>::table[8U][256U] =
+    {
+      ETL_CRC_SLICE_TABLE_ROW(0U),
+      ETL_CRC_SLICE_TABLE_ROW(1U),
+      ETL_CRC_SLICE_TABLE_ROW(2U),
+      ETL_CRC_SLICE_TABLE_ROW(3U),
+      ETL_CRC_SLICE_TABLE_ROW(4U),
+      ETL_CRC_SLICE_TABLE_ROW(5U),
+      ETL_CRC_SLICE_TABLE_ROW(6U),
+      ETL_CRC_SLICE_TABLE_ROW(7U)
+    };
+
+    //*********************************
+    // Slice-by-16.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>
+    {
+      static const TAccumulator table[16U][256U];
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    const TAccumulator crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 16U>::table[16U][256U] =
+    {
+      ETL_CRC_SLICE_TABLE_ROW(0U),
+      ETL_CRC_SLICE_TABLE_ROW(1U),
+      ETL_CRC_SLICE_TABLE_ROW(2U),
+      ETL_CRC_SLICE_TABLE_ROW(3U),
+      ETL_CRC_SLICE_TABLE_ROW(4U),
+      ETL_CRC_SLICE_TABLE_ROW(5U),
+      ETL_CRC_SLICE_TABLE_ROW(6U),
+      ETL_CRC_SLICE_TABLE_ROW(7U),
+      ETL_CRC_SLICE_TABLE_ROW(8U),
+      ETL_CRC_SLICE_TABLE_ROW(9U),
+      ETL_CRC_SLICE_TABLE_ROW(10U),
+      ETL_CRC_SLICE_TABLE_ROW(11U),
+      ETL_CRC_SLICE_TABLE_ROW(12U),
+      ETL_CRC_SLICE_TABLE_ROW(13U),
+      ETL_CRC_SLICE_TABLE_ROW(14U),
+      ETL_CRC_SLICE_TABLE_ROW(15U)
+    };
+
+#undef ETL_CRC_SLICE_TABLE_ROW
+#undef ETL_CRC_SLICE_TABLE_ENTRY
+
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    struct crc_slice_table
+    {
+      typedef crc_slice_table_data<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices> data_t;
+
+      // Contiguous blocks are handled by the block add.
+      typedef void supports_block_add;
+
+      static ETL_CONSTANT size_t Accumulator_Bytes = (Accumulator_Bits + 7U) / 8U;
+
+      ETL_STATIC_ASSERT(Slices >= Accumulator_Bytes, "Slices must be at least the size of the accumulator");
+
+      //*************************************************************************
+      /// Adds a single byte.
+      //*************************************************************************
+      TAccumulator add(TAccumulator crc, uint8_t value) const
+      {
+        return crc_update_chunk<TAccumulator, Accumulator_Bits, 8U, 0xFFU, Reflect>(crc, value, data_t::table[0]);
+      }
+
+      //*************************************************************************
+      /// Adds a contiguous block of bytes, Slices bytes at a time.
+      //*************************************************************************
+      template <typename TPointer>
+      TAccumulator add(TAccumulator crc, TPointer begin, const TPointer end) const
+      {
+        while (size_t(end - begin) >= Slices)
+        {
+          TAccumulator result = 0U;
+
+          for (size_t i = 0U; i < Slices; ++i)
+          {
+            uint8_t value = uint8_t(begin[i]);
+
+            // Merge the current CRC into the leading bytes.
+            if (i < Accumulator_Bytes)
+            {
+              value ^= Reflect ? uint8_t(crc >> (8U * i))
+                               : uint8_t(crc >> (Accumulator_Bits - (8U * (i + 1U))));
+            }
+
+            result ^= data_t::table[Slices - 1U - i][value];
+          }
+
+          crc    = result;
+          begin += Slices;
+        }
+
+        while (begin != end)
+        {
+          crc = add(crc, uint8_t(*begin));
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Slices>
+    ETL_CONSTANT size_t crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Slices>::Accumulator_Bytes;
+
+    //*****************************************************************************
+    // Hardware CRC.
+    // Specialised for the polynomials that the target calculates directly.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_has_hardware : public etl::false_type
+    {
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_hardware;
+
+#if ETL_USING_BUILTIN_CRC32C || ETL_USING_BUILTIN_CRC32
+    //*********************************
+    /// Adds bytes using the CRC instructions supplied by TInstructions.
+    /// The instructions process little endian words, which is the byte order
+    /// of reflected CRCs on all of the supported targets.
+    //*********************************
+    template <typename TInstructions>
+    struct crc_hardware_engine
+    {
+      // Contiguous blocks are handled by the block add.
+      typedef void supports_block_add;
+
+      //*************************************************************************
+      /// Adds a single byte.
+      //*************************************************************************
+      uint32_t add(uint32_t crc, uint8_t value) const
+      {
+        return TInstructions::update_8(crc, value);
+      }
+
+      //*************************************************************************
+      /// Adds a contiguous block of bytes, a word at a time.
+      //*************************************************************************
+      template <typename TPointer>
+      uint32_t add(uint32_t crc, TPointer begin, const TPointer end) const
+      {
+        while (size_t(end - begin) >= sizeof(typename TInstructions::word_type))
+        {
+          typename TInstructions::word_type word;
+          memcpy(&word, begin, sizeof(word));
+
+          crc    = TInstructions::update_word(crc, word);
+          begin += sizeof(word);
+        }
+
+        while (begin != end)
+        {
+          crc = TInstructions::update_8(crc, uint8_t(*begin));
+          ++begin;
+        }
+
+        return crc;
+      }
+    };
+#endif
+
+#if ETL_USING_BUILTIN_CRC32C
+    //*********************************
+    // CRC32C instructions.
+    struct crc32_c_instructions
+    {
+  #if defined(__ARM_FEATURE_CRC32)
+      typedef uint64_t word_type;
+
+      static uint32_t update_8(uint32_t crc, uint8_t value)      { return __crc32cb(crc, value); }
+      static uint32_t update_word(uint32_t crc, word_type value) { return __crc32cd(crc, value); }
+  #elif defined(__x86_64__) || defined(_M_X64)
+      typedef uint64_t word_type;
+
+      static uint32_t update_8(uint32_t crc, uint8_t value)      { return _mm_crc32_u8(crc, value); }
+      static uint32_t update_word(uint32_t crc, word_type value) { return static_cast<uint32_t>(_mm_crc32_u64(crc, value)); }
+  #else
+      typedef uint32_t word_type;
+
+      static uint32_t update_8(uint32_t crc, uint8_t value)      { return _mm_crc32_u8(crc, value); }
+      static uint32_t update_word(uint32_t crc, word_type value) { return _mm_crc32_u32(crc, value); }
+  #endif
+    };
+
+    template <>
+    struct crc_has_hardware<uint32_t, 32U, 0x1EDC6F41UL, true> : public etl::true_type
+    {
+    };
+
+    template <>
+    struct crc_hardware<uint32_t, 32U, 0x1EDC6F41UL, true> : public crc_hardware_engine<crc32_c_instructions>
+    {
+    };
+#endif
+
+#if ETL_USING_BUILTIN_CRC32
+    //*********************************
+    // CRC32 instructions.
+    struct crc32_instructions
+    {
+      typedef uint64_t word_type;
+
+      static uint32_t update_8(uint32_t crc, uint8_t value)      { return __crc32b(crc, value); }
+      static uint32_t update_word(uint32_t crc, word_type value) { return __crc32d(crc, value); }
+    };
+
+    template <>
+    struct crc_has_hardware<uint32_t, 32U, 0x04C11DB7UL, true> : public etl::true_type
+    {
+    };
+
+    template <>
+    struct crc_hardware<uint32_t, 32U, 0x04C11DB7UL, true> : public crc_hardware_engine<crc32_instructions>
+    {
+    };
+#endif
+
+#if ETL_USING_SIMD_CLMUL
+    //*****************************************************************************
+    /// x^Power mod Polynomial, unreflected.
+    /// Steps eight bits at a time to limit the depth of the recursion.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power, bool Is_Remainder = (Power < Accumulator_Bits)>
+    class crc_clmul_power
+    {
+    private:
+
+      static ETL_CONSTANT TAccumulator Previous = crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Power - 8U>::value;
+
+    public:
+
+      static ETL_CONSTANT TAccumulator value = crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false,
+                                               crc_partial_table_entry<TAccumulator, Accumulator_Bits, Polynomial, false, Previous>::value>::value>::value>::value>::value>::value>::value>::value;
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power, bool Is_Remainder>
+    ETL_CONSTANT TAccumulator crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Power, Is_Remainder>::Previous;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power, bool Is_Remainder>
+    ETL_CONSTANT TAccumulator crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Power, Is_Remainder>::value;
+
+    //*********************************
+    // Powers below the degree of the polynomial are their own remainder.
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power>
+    class crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Power, true>
+    {
+    public:
+
+      static ETL_CONSTANT TAccumulator value = TAccumulator(TAccumulator(1U) << Power);
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, size_t Power>
+    ETL_CONSTANT TAccumulator crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Power, true>::value;
+
+    //*****************************************************************************
+    /// The constants that fold a 128 bit remainder forward by Fold_Bits.
+    /// 'Low' multiplies the low 64 bits of the remainder and 'High' the high 64 bits.
+    /// Reflected remainders hold x^127 in bit 0, so their products are reflected
+    /// and one bit short, which the constants for one power less make up for.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Fold_Bits>
+    struct crc_clmul_constants
+    {
+      static ETL_CONSTANT uint64_t Low  = Reflect ? etl::reverse_bits_const<uint64_t, uint64_t(crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Fold_Bits + 63U>::value)>::value
+                                                  : uint64_t(crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Fold_Bits>::value);
+
+      static ETL_CONSTANT uint64_t High = Reflect ? etl::reverse_bits_const<uint64_t, uint64_t(crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Fold_Bits - 1U>::value)>::value
+                                                  : uint64_t(crc_clmul_power<TAccumulator, Accumulator_Bits, Polynomial, Fold_Bits + 64U>::value);
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Fold_Bits>
+    ETL_CONSTANT uint64_t crc_clmul_constants<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Fold_Bits>::Low;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect, size_t Fold_Bits>
+    ETL_CONSTANT uint64_t crc_clmul_constants<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Fold_Bits>::High;
+
+    //*****************************************************************************
+    /// Adds blocks of bytes by folding them with carry-less multiplies, for any polynomial.
+    /// Four 128 bit remainders are folded forward 512 bits at a time, then into one,
+    /// which the slice-by-8 table reduces to the CRC along with any remaining bytes.
+    //*****************************************************************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_clmul_table : public crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U>
+    {
+      typedef crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U> table_t;
+
+      using table_t::add;
+
+      static ETL_CONSTANT size_t Accumulator_Bytes = (Accumulator_Bits + 7U) / 8U;
+      static ETL_CONSTANT size_t Block_Size        = 16U;
+      static ETL_CONSTANT size_t Blocks            = 4U;
+
+      //*************************************************************************
+      /// Adds a contiguous block of bytes.
+      //*************************************************************************
+      template <typename TPointer>
+      TAccumulator add(TAccumulator crc, TPointer begin, const TPointer end) const
+      {
+        if (size_t(end - begin) < (Blocks * Block_Size))
+        {
+          return table_t::add(crc, begin, end);
+        }
+
+        // Merge the current CRC into the leading bytes, after which the CRC starts from zero.
+        uint8_t first[Block_Size];
+        memcpy(first, begin, Block_Size);
+
+        for (size_t i = 0U; i < Accumulator_Bytes; ++i)
+        {
+          first[i] ^= Reflect ? uint8_t(crc >> (8U * i))
+                              : uint8_t(crc >> (Accumulator_Bits - (8U * (i + 1U))));
+        }
+
+        __m128i x0 = load(first);
+        __m128i x1 = load(begin + Block_Size);
+        __m128i x2 = load(begin + (2U * Block_Size));
+        __m128i x3 = load(begin + (3U * Block_Size));
+        begin += Blocks * Block_Size;
+
+        const __m128i k4 = constants<Blocks * Block_Size * 8U>();
+
+        while (size_t(end - begin) >= (Blocks * Block_Size))
+        {
+          x0 = fold(x0, k4, load(begin));
+          x1 = fold(x1, k4, load(begin + Block_Size));
+          x2 = fold(x2, k4, load(begin + (2U * Block_Size)));
+          x3 = fold(x3, k4, load(begin + (3U * Block_Size)));
+          begin += Blocks * Block_Size;
+        }
+
+        const __m128i k1 = constants<Block_Size * 8U>();
+
+        x1 = fold(x0, k1, x1);
+        x2 = fold(x1, k1, x2);
+        x3 = fold(x2, k1, x3);
+
+        while (size_t(end - begin) >= Block_Size)
+        {
+          x3 = fold(x3, k1, load(begin));
+          begin += Block_Size;
+        }
+
+        // The remainder has the same CRC as the bytes that it replaces.
+        uint8_t remainder[Block_Size];
+        store(remainder, x3);
+
+        crc = table_t::add(TAccumulator(0U), remainder, remainder + Block_Size);
+
+        return table_t::add(crc, begin, end);
+      }
+
+    private:
+
+      //*************************************************************************
+      /// Unreflected bytes are reversed so that x^127 is in the top bit.
+      //*************************************************************************
+      static __m128i byte_order(__m128i v)
+      {
+        return Reflect ? v : _mm_shuffle_epi8(v, _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+      }
+
+      //*************************************************************************
+      static __m128i load(const void* p)
+      {
+        return byte_order(etl::private_simd::load_128(p));
+      }
+
+      //*************************************************************************
+      static void store(void* p, __m128i v)
+      {
+        etl::private_simd::store_128(p, byte_order(v));
+      }
+
+      //*************************************************************************
+      template <size_t Fold_Bits>
+      static __m128i constants()
+      {
+        typedef crc_clmul_constants<TAccumulator, Accumulator_Bits, Polynomial, Reflect, Fold_Bits> constants_t;
+
+        const uint64_t k[2] = { constants_t::Low, constants_t::High };
+
+        return etl::private_simd::load_128(k);
+      }
+
+      //*************************************************************************
+      /// Folds the remainder forward and adds the next block.
+      //*************************************************************************
+      static __m128i fold(__m128i remainder, __m128i k, __m128i next)
+      {
+        return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(remainder, k, 0x00), _mm_clmulepi64_si128(remainder, k, 0x11)), next);
+      }
+    };
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTANT size_t crc_clmul_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect>::Accumulator_Bytes;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTANT size_t crc_clmul_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect>::Block_Size;
+
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    ETL_CONSTANT size_t crc_clmul_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect>::Blocks;
+#endif
+
+    //*********************************
+    /// Selects the CRC instructions if the target has them for the polynomial,
+    /// otherwise carry-less multiply folding if the target has it,
+    /// otherwise slice-by-8.
+    //*********************************
+    template <typename TAccumulator, size_t Accumulator_Bits, TAccumulator Polynomial, bool Reflect>
+    struct crc_accelerated_table
+    {
+#if ETL_USING_SIMD_CLMUL
+      typedef crc_clmul_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect> fallback_t;
+#else
+      typedef crc_slice_table<TAccumulator, Accumulator_Bits, Polynomial, Reflect, 8U> fallback_t;
+#endif
+
+      typedef typename etl::conditional<crc_has_hardware<TAccumulator, Accumulator_Bits, Polynomial, Reflect>::value,
+                                        crc_hardware<TAccumulator, Accumulator_Bits, Polynomial, Reflect>,
+                                        fallback_t>::type type;
+    };
+
+    //*****************************************************************************
+    /// Combines the CRCs of two consecutive blocks.
+    /// Appending zero bytes to a CRC is a linear operation, represented by a GF(2)
+    /// matrix that is repeatedly squared, so the cost is O(log(length)).
+    //*****************************************************************************
+    template <typename TCrcParameters>
+    class crc_combiner
+    {
+    public:
+
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+
+      //*************************************************************************
+      /// Returns the CRC of A followed by B.
+      /// crc(A + B) = zeros(crc(A) ^ xor_out ^ initial, length(B)) ^ crc(B)
+      //*************************************************************************
+      static accumulator_type combine(accumulator_type crc_a, accumulator_type crc_b, size_t length_b)
+      {
+        const accumulator_type initial = TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                                                 : TCrcParameters::Initial;
+
+        return accumulator_type(add_zeros(accumulator_type(crc_a ^ TCrcParameters::Xor_Out ^ initial), length_b) ^ crc_b);
+      }
+
+    private:
+
+      static ETL_CONSTANT size_t Bits = TCrcParameters::Accumulator_Bits;
+
+      //*************************************************************************
+      /// Multiplies a vector by a matrix.
+      //*************************************************************************
+      static accumulator_type multiply(const accumulator_type* matrix, accumulator_type vector)
+      {
+        accumulator_type result = 0U;
+
+        while (vector != 0U)
+        {
+          if ((vector & 1U) != 0U)
+          {
+            result ^= *matrix;
+          }
+
+          vector = accumulator_type(vector >> 1U);
+          ++matrix;
+        }
+
+        return result;
+      }
+
+      //*************************************************************************
+      /// Squares a matrix.
+      //*************************************************************************
+      static void square(accumulator_type* result, const accumulator_type* matrix)
+      {
+        for (size_t i = 0U; i < Bits; ++i)
+        {
+          result[i] = multiply(matrix, matrix[i]);
+        }
+      }
+
+      //*************************************************************************
+      /// Returns the CRC after adding 'length' zero bytes.
+      //*************************************************************************
+      static accumulator_type add_zeros(accumulator_type crc, size_t length)
+      {
+        if ((length == 0U) || (crc == 0U))
+        {
+          return crc;
+        }
+
+        accumulator_type odd[Bits];
+        accumulator_type even[Bits];
+
+        // The operator for one zero bit.
+        for (size_t i = 0U; i < Bits; ++i)
+        {
+          if (TCrcParameters::Reflect)
+          {
+            odd[i] = (i == 0U) ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Polynomial>::value
+                               : accumulator_type(accumulator_type(1U) << (i - 1U));
+          }
+          else
+          {
+            odd[i] = (i == (Bits - 1U)) ? TCrcParameters::Polynomial
+                                        : accumulator_type(accumulator_type(1U) << (i + 1U));
+          }
+        }
+
+        square(even, odd); // Two zero bits.
+        square(odd, even); // Four zero bits.
+
+        // Apply the operator for each set bit of the length, in bytes.
+        while (true)
+        {
+          square(even, odd);
+
+          if ((length & 1U) != 0U)
+          {
+            crc = multiply(even, crc);
+          }
+
+          length >>= 1U;
+
+          if (length == 0U)
+          {
+            break;
+          }
+
+          square(odd, even);
+
+          if ((length & 1U) != 0U)
+          {
+            crc = multiply(odd, crc);
+          }
+
+          length >>= 1U;
+
+          if (length == 0U)
+          {
+            break;
+          }
+        }
+
+        return crc;
+      }
+    };
+
+    template <typename TCrcParameters>
+    ETL_CONSTANT size_t crc_combiner<TCrcParameters>::Bits;
+
+    //*****************************************************************************
+    /// The tag type that names the implementation for a table size.
+    //*****************************************************************************
+    template <size_t Table_Size>
+    struct crc_table_tag
+    {
+    };
+
+    template <size_t Table_Size>
+    struct crc_implementation_tag
+    {
+      typedef crc_table_tag<Table_Size> type;
+    };
+
+    template <>
+    struct crc_implementation_tag<etl::crc_accelerated>
+    {
+      typedef etl::crc_accelerated_tag type;
+    };
+
     //*****************************************************************************
     // CRC Policies.
     //*****************************************************************************
-    template <typename TCrcParameters, size_t Table_Size>
+    template <typename TCrcParameters, typename TTag>
     struct crc_policy;
 
     //*********************************
     // Policy for 256 entry table.
     template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 256U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                               TCrcParameters::Accumulator_Bits, 
-                                                               8U, 
-                                                               0xFFU, 
-                                                               TCrcParameters::Polynomial, 
-                                                               TCrcParameters::Reflect, 
-                                                               256U> 
+    struct crc_policy<TCrcParameters, crc_table_tag<256U> > : public crc_table<typename TCrcParameters::accumulator_type, 
+                                                                               TCrcParameters::Accumulator_Bits, 
+                                                                               8U, 
+                                                                               0xFFU, 
+                                                                               TCrcParameters::Polynomial, 
+                                                                               TCrcParameters::Reflect, 
+                                                                               256U> 
     {
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
@@ -624,13 +1567,13 @@ namespace etl
     //*********************************
     // Policy for 16 entry table.
     template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 16U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                              TCrcParameters::Accumulator_Bits, 
-                                                              4U, 
-                                                              0x0FU, 
-                                                              TCrcParameters::Polynomial, 
-                                                              TCrcParameters::Reflect, 
-                                                              16U> 
+    struct crc_policy<TCrcParameters, crc_table_tag<16U> > : public crc_table<typename TCrcParameters::accumulator_type, 
+                                                                              TCrcParameters::Accumulator_Bits, 
+                                                                              4U, 
+                                                                              0x0FU, 
+                                                                              TCrcParameters::Polynomial, 
+                                                                              TCrcParameters::Reflect, 
+                                                                              16U> 
     {
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
@@ -652,13 +1595,89 @@ namespace etl
     //*********************************
     // Policy for 4 entry table.
     template <typename TCrcParameters>
-    struct crc_policy<TCrcParameters, 4U> : public crc_table<typename TCrcParameters::accumulator_type, 
-                                                             TCrcParameters::Accumulator_Bits, 
-                                                             2U, 
-                                                             0x03U, 
-                                                             TCrcParameters::Polynomial, 
-                                                             TCrcParameters::Reflect, 
-                                                             4U> 
+    struct crc_policy<TCrcParameters, crc_table_tag<4U> > : public crc_table<typename TCrcParameters::accumulator_type, 
+                                                                             TCrcParameters::Accumulator_Bits, 
+                                                                             2U, 
+                                                                             0x03U, 
+                                                                             TCrcParameters::Polynomial, 
+                                                                             TCrcParameters::Reflect, 
+                                                                             4U> 
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+    //*********************************
+    // Policy for slice-by-8 tables.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, crc_table_tag<8U * 256U> > : public crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                                          TCrcParameters::Accumulator_Bits,
+                                                                                          TCrcParameters::Polynomial,
+                                                                                          TCrcParameters::Reflect,
+                                                                                          8U>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for slice-by-16 tables.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, crc_table_tag<16U * 256U> > : public crc_slice_table<typename TCrcParameters::accumulator_type,
+                                                                                           TCrcParameters::Accumulator_Bits,
+                                                                                           TCrcParameters::Polynomial,
+                                                                                           TCrcParameters::Reflect,
+                                                                                           16U>
+    {
+      typedef typename TCrcParameters::accumulator_type accumulator_type;
+      typedef accumulator_type value_type;
+
+      //*************************************************************************
+      ETL_CONSTEXPR accumulator_type initial() const
+      {
+        return TCrcParameters::Reflect ? etl::reverse_bits_const<accumulator_type, TCrcParameters::Initial>::value
+                                       : TCrcParameters::Initial;
+      }
+
+      //*************************************************************************
+      accumulator_type final(accumulator_type crc) const
+      {
+        return crc ^ TCrcParameters::Xor_Out;
+      }
+    };
+
+    //*********************************
+    // Policy for acceleration, with a slice-by-8 fallback.
+    template <typename TCrcParameters>
+    struct crc_policy<TCrcParameters, etl::crc_accelerated_tag> : public crc_accelerated_table<typename TCrcParameters::accumulator_type,
+                                                                                               TCrcParameters::Accumulator_Bits,
+                                                                                               TCrcParameters::Polynomial,
+                                                                                               TCrcParameters::Reflect>::type
     {
       typedef typename TCrcParameters::accumulator_type accumulator_type;
       typedef accumulator_type value_type;
@@ -682,11 +1701,13 @@ namespace etl
   /// Basic parameterised CRC type.
   //*****************************************************************************
   template <typename TCrcParameters, size_t Table_Size>
-  class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, Table_Size> >
+  class crc_type : public etl::frame_check_sequence<private_crc::crc_policy<TCrcParameters, typename private_crc::crc_implementation_tag<Table_Size>::type> >
   {
   public:
 
-    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U), "Table size must be 4, 16 or 256");
+    ETL_STATIC_ASSERT((Table_Size == 4U) || (Table_Size == 16U) || (Table_Size == 256U) ||
+                      (Table_Size == etl::crc_slice_by_8) || (Table_Size == etl::crc_slice_by_16) || (Table_Size == etl::crc_accelerated), 
+                      "Table size must be 4, 16, 256, crc_slice_by_8, crc_slice_by_16 or crc_accelerated");
 
     //*************************************************************************
     /// Default constructor.
@@ -707,7 +1728,32 @@ namespace etl
       this->reset();
       this->add(begin, end);
     }
+
+    //*************************************************************************
+    /// Combines the CRCs of two consecutive blocks.
+    /// \param crc_a    The CRC of the first block.
+    /// \param crc_b    The CRC of the second block.
+    /// \param length_b The length of the second block, in bytes.
+    /// \return The CRC of the first block followed by the second.
+    //*************************************************************************
+    static typename TCrcParameters::accumulator_type combine(typename TCrcParameters::accumulator_type crc_a, 
+                                                             typename TCrcParameters::accumulator_type crc_b, 
+                                                             size_t length_b)
+    {
+      return private_crc::crc_combiner<TCrcParameters>::combine(crc_a, crc_b, length_b);
+    }
   };
+
+  //*****************************************************************************
+  /// Combines the CRCs of two consecutive blocks.
+  /// e.g. etl::crc_combine<etl::crc32>(crc_a, crc_b, length_b)
+  ///\ingroup crc
+  //*****************************************************************************
+  template <typename TCrc>
+  typename TCrc::value_type crc_combine(typename TCrc::value_type crc_a, typename TCrc::value_type crc_b, size_t length_b)
+  {
+    return TCrc::combine(crc_a, crc_b, length_b);
+  }
 }
 
 #endif
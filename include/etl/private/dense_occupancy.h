@@ -0,0 +1,236 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DENSE_OCCUPANCY_INCLUDED
+#define ETL_DENSE_OCCUPANCY_INCLUDED
+
+#include "../platform.h"
+#include "../bitset.h"
+#include "../binary.h"
+#include "../type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_dense
+  {
+    //*************************************************************************
+    /// Checks whether a key is below the key range.
+    //*************************************************************************
+    template <typename TKey>
+    typename etl::enable_if<etl::is_signed<TKey>::value, bool>::type
+      is_negative(const TKey& key)
+    {
+      return key < TKey(0);
+    }
+
+    template <typename TKey>
+    typename etl::enable_if<!etl::is_signed<TKey>::value, bool>::type
+      is_negative(const TKey&)
+    {
+      return false;
+    }
+
+    //*************************************************************************
+    /// The occupancy bits of a dense container, with a cached element count.
+    /// Searches skip a word of unoccupied keys at a time. If there is no
+    /// occupied key in the searched direction, VMax is returned.
+    //*************************************************************************
+    template <size_t VMax>
+    class occupancy
+    {
+    public:
+
+      typedef uint32_t element_type;
+
+      static ETL_CONSTANT size_t Npos = VMax;
+
+      occupancy()
+        : count(0U)
+      {
+      }
+
+      //***********************************
+      bool test(size_t key) const
+      {
+        return bits.test(key);
+      }
+
+      //***********************************
+      void set(size_t key)
+      {
+        bits.set(key);
+        ++count;
+      }
+
+      //***********************************
+      void reset(size_t key)
+      {
+        bits.reset(key);
+        --count;
+      }
+
+      //***********************************
+      void clear()
+      {
+        bits.reset();
+        count = 0U;
+      }
+
+      //***********************************
+      size_t size() const
+      {
+        return count;
+      }
+
+      //***********************************
+      /// The first occupied key not less than 'key'.
+      //***********************************
+      size_t find_next(size_t key) const
+      {
+        if (key >= VMax)
+        {
+          return Npos;
+        }
+
+        const size_t found = bits.find_next(true, key);
+
+        return (found == bitset_type::npos) ? Npos : found;
+      }
+
+      //***********************************
+      /// The last occupied key less than 'key'.
+      //***********************************
+      size_t find_previous(size_t key) const
+      {
+        if (key == 0U)
+        {
+          return Npos;
+        }
+
+        if (key > VMax)
+        {
+          key = VMax;
+        }
+
+        const typename bitset_type::const_span_type words = bits.span();
+
+        size_t       index = (key - 1U) / Bits_Per_Element;
+        const size_t bit   = (key - 1U) % Bits_Per_Element;
+
+        // Only look at the bits below 'key' in the first word searched.
+        element_type word = words[index];
+
+        if (bit != (Bits_Per_Element - 1U))
+        {
+          word &= (element_type(1U) << (bit + 1U)) - 1U;
+        }
+
+        while (word == 0U)
+        {
+          if (index == 0U)
+          {
+            return Npos;
+          }
+
+          --index;
+          word = words[index];
+        }
+
+        return (index * Bits_Per_Element) + (Bits_Per_Element - 1U) - etl::count_leading_zeros(word);
+      }
+
+      //***********************************
+      /// The first occupied key not less than 'key'.
+      //***********************************
+      template <typename TKey>
+      size_t lower_bound(const TKey& key) const
+      {
+        return is_negative(key) ? first() : find_next(static_cast<size_t>(key));
+      }
+
+      //***********************************
+      /// The first occupied key greater than 'key'.
+      //***********************************
+      template <typename TKey>
+      size_t upper_bound(const TKey& key) const
+      {
+        if (is_negative(key))
+        {
+          return first();
+        }
+
+        const size_t k = static_cast<size_t>(key);
+
+        return (k >= VMax) ? Npos : find_next(k + 1U);
+      }
+
+      //***********************************
+      /// Checks whether 'key' is in the range 0 to VMax - 1.
+      //***********************************
+      template <typename TKey>
+      static bool in_range(const TKey& key)
+      {
+        return !is_negative(key) && (static_cast<size_t>(key) < VMax);
+      }
+
+      //***********************************
+      size_t first() const
+      {
+        return find_next(0U);
+      }
+
+      //***********************************
+      size_t last() const
+      {
+        return find_previous(VMax);
+      }
+
+    private:
+
+      typedef etl::bitset<VMax, element_type> bitset_type;
+
+      static ETL_CONSTANT size_t Bits_Per_Element = etl::integral_limits<element_type>::bits;
+
+      bitset_type bits;
+      size_t      count;
+    };
+
+    template <size_t VMax>
+    ETL_CONSTANT size_t occupancy<VMax>::Npos;
+
+    template <size_t VMax>
+    ETL_CONSTANT size_t occupancy<VMax>::Bits_Per_Element;
+  }
+}
+
+#endif
@@ -0,0 +1,223 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DSP_SIMD_INCLUDED
+#define ETL_DSP_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "simd.h"
+#include "statistics_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Dot product kernels for the digital filters.
+// Uses the vector types of the statistics kernels for float and double, and
+// multiply accumulate instructions for int16_t into 64 bit sums.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_dsp
+  {
+    //*************************************************************************
+    /// Dot product, with four independent accumulators.
+    //*************************************************************************
+    template <typename TAccumulator, typename T>
+    TAccumulator generic_dot_product(const T* p1, const T* p2, size_t n)
+    {
+      TAccumulator a0 = TAccumulator(0);
+      TAccumulator a1 = TAccumulator(0);
+      TAccumulator a2 = TAccumulator(0);
+      TAccumulator a3 = TAccumulator(0);
+
+      size_t i = 0U;
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        a0 += TAccumulator(p1[i])      * TAccumulator(p2[i]);
+        a1 += TAccumulator(p1[i + 1U]) * TAccumulator(p2[i + 1U]);
+        a2 += TAccumulator(p1[i + 2U]) * TAccumulator(p2[i + 2U]);
+        a3 += TAccumulator(p1[i + 3U]) * TAccumulator(p2[i + 3U]);
+      }
+
+      for (; i < n; ++i)
+      {
+        a0 += TAccumulator(p1[i]) * TAccumulator(p2[i]);
+      }
+
+      return (a0 + a1) + (a2 + a3);
+    }
+
+#if ETL_USING_STATISTICS_SIMD
+    //*************************************************************************
+    /// Dot product of float or double, two vectors at a time.
+    /// Returns the number of values used.
+    //*************************************************************************
+    template <typename T>
+    size_t simd_dot_product(const T* p1, const T* p2, size_t n, T& result)
+    {
+      typedef etl::private_statistics::simd_vector<T> vector_t;
+      typedef typename vector_t::type                 type;
+
+      const size_t Width = vector_t::Size;
+
+      type a0 = vector_t::zero();
+      type a1 = vector_t::zero();
+
+      size_t i = 0U;
+
+      for (; (i + (2U * Width)) <= n; i += (2U * Width))
+      {
+        a0 = vector_t::add(a0, vector_t::mul(vector_t::load(p1 + i),         vector_t::load(p2 + i)));
+        a1 = vector_t::add(a1, vector_t::mul(vector_t::load(p1 + i + Width), vector_t::load(p2 + i + Width)));
+      }
+
+      result = etl::private_statistics::simd_reduce<T>(vector_t::add(a0, a1));
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Dot product of int16_t, eight values at a time, into 64 bit sums.
+    /// Returns the number of values used.
+    //*************************************************************************
+    inline size_t simd_dot_product_int16(const int16_t* p1, const int16_t* p2, size_t n, int64_t& result)
+    {
+      size_t i = 0U;
+
+  #if ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_AVX2
+      __m128i a64 = _mm_setzero_si128();
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i v1 = etl::private_simd::load_128(p1 + i);
+        const __m128i v2 = etl::private_simd::load_128(p2 + i);
+
+        // Pairs of products. Only both pairs of -32768 * -32768 overflow.
+        const __m128i products = _mm_madd_epi16(v1, v2);
+        const __m128i sign     = _mm_srai_epi32(products, 31);
+
+        a64 = _mm_add_epi64(a64, _mm_unpacklo_epi32(products, sign));
+        a64 = _mm_add_epi64(a64, _mm_unpackhi_epi32(products, sign));
+      }
+
+      int64_t sums[2];
+      etl::private_simd::store_128(sums, a64);
+  #else
+      int64x2_t a64 = vdupq_n_s64(0);
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const int16x8_t v1 = vld1q_s16(p1 + i);
+        const int16x8_t v2 = vld1q_s16(p2 + i);
+
+        a64 = vpadalq_s32(a64, vmull_s16(vget_low_s16(v1),  vget_low_s16(v2)));
+        a64 = vpadalq_s32(a64, vmull_s16(vget_high_s16(v1), vget_high_s16(v2)));
+      }
+
+      int64_t sums[2];
+      vst1q_s64(sums, a64);
+  #endif
+
+      result = sums[0] + sums[1];
+
+      return i;
+    }
+#endif
+
+    //*************************************************************************
+    /// Selects the dot product method.
+    /// 0 = generic, 1 = floating point vectors, 2 = int16_t vectors.
+    //*************************************************************************
+    template <typename T, typename TAccumulator>
+    struct dot_product_method
+    {
+#if ETL_USING_STATISTICS_SIMD
+      static ETL_CONSTANT int value = (etl::is_same<T, TAccumulator>::value && etl::private_statistics::simd_vector<T>::Supported) ? 1
+                                    : (etl::is_same<T, int16_t>::value && etl::is_same<TAccumulator, int64_t>::value) ? 2
+                                    : 0;
+#else
+      static ETL_CONSTANT int value = 0;
+#endif
+    };
+
+    template <typename T, typename TAccumulator>
+    ETL_CONSTANT int dot_product_method<T, TAccumulator>::value;
+
+    //*************************************************************************
+    /// Dot product.
+    //*************************************************************************
+    template <typename T, typename TAccumulator, int Method = dot_product_method<T, TAccumulator>::value>
+    struct dot_product
+    {
+      static TAccumulator calculate(const T* p1, const T* p2, size_t n)
+      {
+        return generic_dot_product<TAccumulator>(p1, p2, n);
+      }
+    };
+
+#if ETL_USING_STATISTICS_SIMD
+    //*************************************************************************
+    /// Dot product of float or double.
+    //*************************************************************************
+    template <typename T, typename TAccumulator>
+    struct dot_product<T, TAccumulator, 1>
+    {
+      static TAccumulator calculate(const T* p1, const T* p2, size_t n)
+      {
+        TAccumulator result = TAccumulator(0);
+        const size_t i = simd_dot_product(p1, p2, n, result);
+
+        return result + generic_dot_product<TAccumulator>(p1 + i, p2 + i, n - i);
+      }
+    };
+
+    //*************************************************************************
+    /// Dot product of int16_t into int64_t.
+    //*************************************************************************
+    template <typename T, typename TAccumulator>
+    struct dot_product<T, TAccumulator, 2>
+    {
+      static TAccumulator calculate(const T* p1, const T* p2, size_t n)
+      {
+        TAccumulator result = TAccumulator(0);
+        const size_t i = simd_dot_product_int16(p1, p2, n, result);
+
+        return result + generic_dot_product<TAccumulator>(p1 + i, p2 + i, n - i);
+      }
+    };
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,337 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FIXED_POINT_SIMD_INCLUDED
+#define ETL_FIXED_POINT_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Saturating block kernels for etl::fixed_point.
+// Each kernel processes as many values as the target's instructions allow
+// and returns the number processed. The caller finishes the remainder with
+// the scalar operations, which give the same results.
+// Add and subtract are the same for any number of fraction bits, so they
+// only need the storage to be exactly 16 or 32 bits wide. Multiply needs
+// the Q15 or Q31 format, as the instructions round and shift by 15 or 31.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_fixed_point
+  {
+#if ETL_USING_SIMD_ARM_DSP && !ETL_USING_SIMD_NEON
+    //*************************************************************************
+    /// Loads and stores two int16_t as one packed 32 bit value.
+    //*************************************************************************
+    inline int32_t load_pair(const int16_t* p)
+    {
+      int32_t v;
+      memcpy(&v, p, sizeof(v));
+      return v;
+    }
+
+    inline void store_pair(int16_t* p, int32_t v)
+    {
+      memcpy(p, &v, sizeof(v));
+    }
+#endif
+
+    //*************************************************************************
+    /// Saturating add of int16_t.
+    //*************************************************************************
+    inline size_t simd_add(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      for (; (i + 16U) <= n; i += 16U)
+      {
+        const __m256i va = etl::private_simd::load_256(a + i);
+        const __m256i vb = etl::private_simd::load_256(b + i);
+        etl::private_simd::store_256(out + i, _mm256_adds_epi16(va, vb));
+      }
+#elif ETL_USING_SIMD_SSE2
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = etl::private_simd::load_128(a + i);
+        const __m128i vb = etl::private_simd::load_128(b + i);
+        etl::private_simd::store_128(out + i, _mm_adds_epi16(va, vb));
+      }
+#elif ETL_USING_SIMD_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        vst1q_s16(out + i, vqaddq_s16(vld1q_s16(a + i), vld1q_s16(b + i)));
+      }
+#elif ETL_USING_SIMD_ARM_DSP
+      for (; (i + 2U) <= n; i += 2U)
+      {
+        store_pair(out + i, __qadd16(load_pair(a + i), load_pair(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Saturating subtract of int16_t.
+    //*************************************************************************
+    inline size_t simd_subtract(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      for (; (i + 16U) <= n; i += 16U)
+      {
+        const __m256i va = etl::private_simd::load_256(a + i);
+        const __m256i vb = etl::private_simd::load_256(b + i);
+        etl::private_simd::store_256(out + i, _mm256_subs_epi16(va, vb));
+      }
+#elif ETL_USING_SIMD_SSE2
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = etl::private_simd::load_128(a + i);
+        const __m128i vb = etl::private_simd::load_128(b + i);
+        etl::private_simd::store_128(out + i, _mm_subs_epi16(va, vb));
+      }
+#elif ETL_USING_SIMD_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        vst1q_s16(out + i, vqsubq_s16(vld1q_s16(a + i), vld1q_s16(b + i)));
+      }
+#elif ETL_USING_SIMD_ARM_DSP
+      for (; (i + 2U) <= n; i += 2U)
+      {
+        store_pair(out + i, __qsub16(load_pair(a + i), load_pair(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Rounding, saturating Q15 multiply.
+    //*************************************************************************
+    inline size_t simd_multiply_q15(const int16_t* a, const int16_t* b, int16_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      // mulhrs gives (a * b + 0x4000) >> 15, which wraps to -32768 only for -32768 * -32768.
+      const __m256i overflow = _mm256_set1_epi16(int16_t(-32768));
+
+      for (; (i + 16U) <= n; i += 16U)
+      {
+        const __m256i va = etl::private_simd::load_256(a + i);
+        const __m256i vb = etl::private_simd::load_256(b + i);
+        const __m256i r  = _mm256_mulhrs_epi16(va, vb);
+        etl::private_simd::store_256(out + i, _mm256_xor_si256(r, _mm256_cmpeq_epi16(r, overflow)));
+      }
+#elif ETL_USING_SIMD_SSSE3
+      // mulhrs gives (a * b + 0x4000) >> 15, which wraps to -32768 only for -32768 * -32768.
+      const __m128i overflow = _mm_set1_epi16(int16_t(-32768));
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = etl::private_simd::load_128(a + i);
+        const __m128i vb = etl::private_simd::load_128(b + i);
+        const __m128i r  = _mm_mulhrs_epi16(va, vb);
+        etl::private_simd::store_128(out + i, _mm_xor_si128(r, _mm_cmpeq_epi16(r, overflow)));
+      }
+#elif ETL_USING_SIMD_NEON
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        vst1q_s16(out + i, vqrdmulhq_s16(vld1q_s16(a + i), vld1q_s16(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Saturating add of int32_t.
+    //*************************************************************************
+    inline size_t simd_add(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_NEON
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        vst1q_s32(out + i, vqaddq_s32(vld1q_s32(a + i), vld1q_s32(b + i)));
+      }
+#elif ETL_USING_SIMD_ARM_DSP
+      for (; i < n; ++i)
+      {
+        out[i] = __qadd(a[i], b[i]);
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Saturating subtract of int32_t.
+    //*************************************************************************
+    inline size_t simd_subtract(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_NEON
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        vst1q_s32(out + i, vqsubq_s32(vld1q_s32(a + i), vld1q_s32(b + i)));
+      }
+#elif ETL_USING_SIMD_ARM_DSP
+      for (; i < n; ++i)
+      {
+        out[i] = __qsub(a[i], b[i]);
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Rounding, saturating Q31 multiply.
+    //*************************************************************************
+    inline size_t simd_multiply_q31(const int32_t* a, const int32_t* b, int32_t* out, size_t n)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_NEON
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        vst1q_s32(out + i, vqrdmulhq_s32(vld1q_s32(a + i), vld1q_s32(b + i)));
+      }
+#else
+      (void)a;
+      (void)b;
+      (void)out;
+      (void)n;
+#endif
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Sum of the products of int16_t, into 64 bits.
+    //*************************************************************************
+    inline size_t simd_dot_product(const int16_t* a, const int16_t* b, size_t n, int64_t& result)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_SSE2
+      const __m128i overflow = _mm_set1_epi32(-2147483647 - 1);
+
+      __m128i a64 = _mm_setzero_si128();
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const __m128i va = etl::private_simd::load_128(a + i);
+        const __m128i vb = etl::private_simd::load_128(b + i);
+
+        // Pairs of products. Only a pair of -32768 * -32768 overflows, to
+        // exactly 0x80000000, which no other pair gives. It is extended as +2^31.
+        const __m128i products = _mm_madd_epi16(va, vb);
+        const __m128i sign     = _mm_andnot_si128(_mm_cmpeq_epi32(products, overflow), _mm_srai_epi32(products, 31));
+
+        a64 = _mm_add_epi64(a64, _mm_unpacklo_epi32(products, sign));
+        a64 = _mm_add_epi64(a64, _mm_unpackhi_epi32(products, sign));
+      }
+
+      int64_t sums[2];
+      etl::private_simd::store_128(sums, a64);
+      result = sums[0] + sums[1];
+#elif ETL_USING_SIMD_NEON
+      int64x2_t a64 = vdupq_n_s64(0);
+
+      for (; (i + 8U) <= n; i += 8U)
+      {
+        const int16x8_t va = vld1q_s16(a + i);
+        const int16x8_t vb = vld1q_s16(b + i);
+
+        a64 = vpadalq_s32(a64, vmull_s16(vget_low_s16(va),  vget_low_s16(vb)));
+        a64 = vpadalq_s32(a64, vmull_s16(vget_high_s16(va), vget_high_s16(vb)));
+      }
+
+      result = vgetq_lane_s64(a64, 0) + vgetq_lane_s64(a64, 1);
+#elif ETL_USING_SIMD_ARM_DSP
+      int64_t sum = 0;
+
+      for (; (i + 2U) <= n; i += 2U)
+      {
+        sum = __smlald(load_pair(a + i), load_pair(b + i), sum);
+      }
+
+      result = sum;
+#else
+      (void)a;
+      (void)b;
+      (void)n;
+      result = 0;
+#endif
+
+      return i;
+    }
+  }
+}
+
+#endif
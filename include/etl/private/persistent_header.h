@@ -0,0 +1,174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_PERSISTENT_HEADER_INCLUDED
+#define ETL_PRIVATE_PERSISTENT_HEADER_INCLUDED
+
+#include "../platform.h"
+#include "../exception.h"
+#include "../error_handler.h"
+#include "../file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the persistent containers.
+  ///\ingroup persistent
+  //***************************************************************************
+  class persistent_exception : public etl::exception
+  {
+  public:
+
+    persistent_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the persistent containers.
+  ///\ingroup persistent
+  //***************************************************************************
+  class persistent_full : public etl::persistent_exception
+  {
+  public:
+
+    persistent_full(string_type file_name_, numeric_type line_number_)
+      : etl::persistent_exception(ETL_ERROR_TEXT("persistent:full", ETL_PERSISTENT_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the persistent containers.
+  ///\ingroup persistent
+  //***************************************************************************
+  class persistent_empty : public etl::persistent_exception
+  {
+  public:
+
+    persistent_empty(string_type file_name_, numeric_type line_number_)
+      : etl::persistent_exception(ETL_ERROR_TEXT("persistent:empty", ETL_PERSISTENT_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the persistent containers.
+  ///\ingroup persistent
+  //***************************************************************************
+  class persistent_out_of_bounds : public etl::persistent_exception
+  {
+  public:
+
+    persistent_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::persistent_exception(ETL_ERROR_TEXT("persistent:bounds", ETL_PERSISTENT_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Not attached exception for the persistent containers.
+  /// Raised when a container is used before attach() or format().
+  ///\ingroup persistent
+  //***************************************************************************
+  class persistent_not_attached : public etl::persistent_exception
+  {
+  public:
+
+    persistent_not_attached(string_type file_name_, numeric_type line_number_)
+      : etl::persistent_exception(ETL_ERROR_TEXT("persistent:not attached", ETL_PERSISTENT_FILE_ID"D"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_persistent
+  {
+    //*************************************************************************
+    /// The header at the start of each persistent container.
+    /// Records the container type, the user's layout version, the capacity
+    /// and the element size, so that a container is only reattached to
+    /// storage laid out exactly as it expects. The check word guards against
+    /// the random contents of RAM that was not retained.
+    //*************************************************************************
+    struct header
+    {
+      //***********************************************************************
+      /// Writes a header for the layout.
+      //***********************************************************************
+      void format(uint32_t magic_, uint32_t version_, uint32_t capacity_, uint32_t element_size_)
+      {
+        magic        = magic_;
+        version      = version_;
+        capacity     = capacity_;
+        element_size = element_size_;
+        check        = make_check(magic_, version_, capacity_, element_size_);
+      }
+
+      //***********************************************************************
+      /// Checks that the header matches the layout.
+      //***********************************************************************
+      bool is_valid(uint32_t magic_, uint32_t version_, uint32_t capacity_, uint32_t element_size_) const
+      {
+        return (magic        == magic_)    &&
+               (version      == version_)  &&
+               (capacity     == capacity_) &&
+               (element_size == element_size_) &&
+               (check        == make_check(magic_, version_, capacity_, element_size_));
+      }
+
+      //***********************************************************************
+      /// Invalidates the header, so that the next attach formats the storage.
+      //***********************************************************************
+      void invalidate()
+      {
+        magic = 0U;
+        check = 0U;
+      }
+
+      //***********************************************************************
+      static uint32_t make_check(uint32_t magic_, uint32_t version_, uint32_t capacity_, uint32_t element_size_)
+      {
+        return ~(magic_ ^ (version_ * 0x9E3779B9UL) ^ (capacity_ << 16) ^ (capacity_ >> 16) ^ (element_size_ * 0x85EBCA6BUL));
+      }
+
+      uint32_t magic;
+      uint32_t version;
+      uint32_t capacity;
+      uint32_t element_size;
+      uint32_t check;
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,226 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SIMD_INCLUDED
+#define ETL_SIMD_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// The intrinsics for the target's vector instruction sets, and the byte
+// vector load, store and compare wrappers shared by the private *_simd.h
+// headers.
+// Each of those headers decides which instruction sets its own kernels need.
+//*****************************************************************************
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSSE3 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON || ETL_USING_SIMD_ARM_DSP
+  #define ETL_USING_SIMD 1
+#else
+  #define ETL_USING_SIMD 0
+#endif
+
+#if ETL_USING_SIMD_AVX2
+  #include <immintrin.h>
+#elif ETL_USING_SIMD_SSSE3
+  #include <tmmintrin.h>
+#elif ETL_USING_SIMD_SSE2
+  #include <emmintrin.h>
+#endif
+
+#if ETL_USING_SIMD_CLMUL
+  #include <wmmintrin.h>
+#endif
+
+#if ETL_USING_SIMD_NEON
+  #include <arm_neon.h>
+#endif
+
+#if ETL_USING_SIMD_ARM_DSP
+  #include <arm_acle.h>
+#endif
+
+//*************************************
+// The intrinsics are not constexpr, so a constexpr function may only select a
+// vector path when it is not being constant evaluated.
+#if ETL_USING_CPP14 && ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  #define ETL_SIMD_IS_RUNTIME (!__builtin_is_constant_evaluated())
+#else
+  #define ETL_SIMD_IS_RUNTIME true
+#endif
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+
+namespace etl
+{
+  namespace private_simd
+  {
+    //*************************************************************************
+    /// Unaligned loads and stores of 128 bit byte vectors.
+    /// 'mask_128' returns one bit for each byte on x86 and four on NEON.
+    //*************************************************************************
+#if ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_AVX2
+    typedef __m128i vector_128;
+
+    inline vector_128 load_128(const void* p)          { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+    inline void       store_128(void* p, vector_128 v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+    inline uint64_t   mask_128(vector_128 v)           { return static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(v))); }
+    inline bool       equal_128(vector_128 a, vector_128 b) { return _mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) == 0xFFFF; }
+#else
+    typedef uint8x16_t vector_128;
+
+    inline vector_128 load_128(const void* p)          { return vld1q_u8(static_cast<const uint8_t*>(p)); }
+    inline void       store_128(void* p, vector_128 v) { vst1q_u8(static_cast<uint8_t*>(p), v); }
+
+    //*********************************
+    // Narrows each byte to a nibble, as there is no 'movemask'.
+    inline uint64_t mask_128(vector_128 v)
+    {
+      return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(v), 4)), 0);
+    }
+
+    //*********************************
+    inline bool equal_128(vector_128 a, vector_128 b)
+    {
+      const uint64x2_t result = vreinterpretq_u64_u8(vceqq_u8(a, b));
+
+      return (vgetq_lane_u64(result, 0) & vgetq_lane_u64(result, 1)) == ~uint64_t(0U);
+    }
+#endif
+
+#if ETL_USING_SIMD_AVX2
+    //*************************************************************************
+    /// Unaligned loads and stores of 256 bit byte vectors.
+    //*************************************************************************
+    typedef __m256i vector_256;
+
+    inline vector_256 load_256(const void* p)          { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+    inline void       store_256(void* p, vector_256 v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+    inline uint32_t   mask_256(vector_256 v)           { return static_cast<uint32_t>(_mm256_movemask_epi8(v)); }
+    inline bool       equal_256(vector_256 a, vector_256 b) { return _mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)) == -1; }
+#endif
+
+    //*************************************************************************
+    /// The widest byte vector for the target.
+    /// 'mask' returns 'Bits_Per_Byte' bits for each byte of the vector.
+    //*************************************************************************
+    struct byte_vector
+    {
+#if ETL_USING_SIMD_AVX2
+      typedef vector_256 vector_type;
+      typedef uint32_t   mask_type;
+
+      static vector_type load(const void* p)                { return load_256(p); }
+      static void        store(void* p, vector_type v)      { store_256(p, v); }
+      static mask_type   mask(vector_type v)                { return mask_256(v); }
+      static bool        equal(vector_type a, vector_type b) { return equal_256(a, b); }
+      static vector_type and_(vector_type a, vector_type b) { return _mm256_and_si256(a, b); }
+      static vector_type or_(vector_type a, vector_type b)  { return _mm256_or_si256(a, b); }
+      static vector_type xor_(vector_type a, vector_type b) { return _mm256_xor_si256(a, b); }
+      static vector_type not_(vector_type a)                { return _mm256_xor_si256(a, _mm256_set1_epi8(-1)); }
+
+      static ETL_CONSTANT size_t Bits_Per_Byte = 1U;
+#elif ETL_USING_SIMD_SSE2
+      typedef vector_128 vector_type;
+      typedef uint32_t   mask_type;
+
+      static vector_type load(const void* p)                { return load_128(p); }
+      static void        store(void* p, vector_type v)      { store_128(p, v); }
+      static mask_type   mask(vector_type v)                { return static_cast<mask_type>(mask_128(v)); }
+      static bool        equal(vector_type a, vector_type b) { return equal_128(a, b); }
+      static vector_type and_(vector_type a, vector_type b) { return _mm_and_si128(a, b); }
+      static vector_type or_(vector_type a, vector_type b)  { return _mm_or_si128(a, b); }
+      static vector_type xor_(vector_type a, vector_type b) { return _mm_xor_si128(a, b); }
+      static vector_type not_(vector_type a)                { return _mm_xor_si128(a, _mm_set1_epi8(-1)); }
+
+      static ETL_CONSTANT size_t Bits_Per_Byte = 1U;
+#else
+      typedef vector_128 vector_type;
+      typedef uint64_t   mask_type;
+
+      static vector_type load(const void* p)                { return load_128(p); }
+      static void        store(void* p, vector_type v)      { store_128(p, v); }
+      static mask_type   mask(vector_type v)                { return mask_128(v); }
+      static bool        equal(vector_type a, vector_type b) { return equal_128(a, b); }
+      static vector_type and_(vector_type a, vector_type b) { return vandq_u8(a, b); }
+      static vector_type or_(vector_type a, vector_type b)  { return vorrq_u8(a, b); }
+      static vector_type xor_(vector_type a, vector_type b) { return veorq_u8(a, b); }
+      static vector_type not_(vector_type a)                { return vmvnq_u8(a); }
+
+      static ETL_CONSTANT size_t Bits_Per_Byte = 4U;
+#endif
+
+      static ETL_CONSTANT size_t    Width    = sizeof(vector_type);
+      static ETL_CONSTANT mask_type No_Bits  = 0U;
+      static ETL_CONSTANT mask_type All_Bits = ~No_Bits >> ((sizeof(mask_type) * 8U) - (Width * Bits_Per_Byte));
+
+      //*********************************
+      static size_t first_set(mask_type mask)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_ctzll(mask));
+#else
+        size_t index = 0U;
+
+        while ((mask & 1U) == 0U)
+        {
+          mask >>= 1U;
+          ++index;
+        }
+
+        return index;
+#endif
+      }
+
+      //*********************************
+      static size_t count_set(mask_type mask)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<size_t>(__builtin_popcountll(mask));
+#else
+        size_t n = 0U;
+
+        while (mask != 0U)
+        {
+          mask &= (mask - 1U);
+          ++n;
+        }
+
+        return n;
+#endif
+      }
+    };
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,620 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATISTICS_SIMD_INCLUDED
+#define ETL_STATISTICS_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+// Block accumulation for the statistics classes.
+// The generic versions keep several independent partial sums, so that each
+// addition does not have to wait for the previous one to complete.
+// float and double ranges, and int16_t ranges accumulated as integers, use
+// vector instructions where the target supports them.
+// Floating point partial sums are combined in a different order to a
+// sequential loop, so results may differ in the last few bits.
+//*****************************************************************************
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_STATISTICS_SIMD 1
+#else
+  #define ETL_USING_STATISTICS_SIMD 0
+#endif
+
+namespace etl
+{
+  namespace private_statistics
+  {
+    //*************************************************************************
+    /// Sums and/or sums of squares, with four independent accumulators.
+    //*************************************************************************
+    template <bool Sum, bool Squares, typename TCalc, typename TAccumulator, typename TInput>
+    void generic_accumulate(const TInput* p, size_t n, TAccumulator& sum, TAccumulator& sum_of_squares)
+    {
+      TAccumulator s0 = TAccumulator(0);
+      TAccumulator s1 = TAccumulator(0);
+      TAccumulator s2 = TAccumulator(0);
+      TAccumulator s3 = TAccumulator(0);
+      TAccumulator q0 = TAccumulator(0);
+      TAccumulator q1 = TAccumulator(0);
+      TAccumulator q2 = TAccumulator(0);
+      TAccumulator q3 = TAccumulator(0);
+
+      size_t i = 0U;
+
+      for (; (i + 4U) <= n; i += 4U)
+      {
+        if (Sum)
+        {
+          s0 += TCalc(p[i]);
+          s1 += TCalc(p[i + 1U]);
+          s2 += TCalc(p[i + 2U]);
+          s3 += TCalc(p[i + 3U]);
+        }
+
+        if (Squares)
+        {
+          q0 += TCalc(p[i] * p[i]);
+          q1 += TCalc(p[i + 1U] * p[i + 1U]);
+          q2 += TCalc(p[i + 2U] * p[i + 2U]);
+          q3 += TCalc(p[i + 3U] * p[i + 3U]);
+        }
+      }
+
+      for (; i < n; ++i)
+      {
+        if (Sum)
+        {
+          s0 += TCalc(p[i]);
+        }
+
+        if (Squares)
+        {
+          q0 += TCalc(p[i] * p[i]);
+        }
+      }
+
+      if (Sum)
+      {
+        sum += (s0 + s1) + (s2 + s3);
+      }
+
+      if (Squares)
+      {
+        sum_of_squares += (q0 + q1) + (q2 + q3);
+      }
+    }
+
+    //*************************************************************************
+    /// Inner product and the sums of both ranges, with two independent accumulators.
+    //*************************************************************************
+    template <typename TCalc, typename TAccumulator, typename TInput>
+    void generic_inner_product(const TInput* p1, const TInput* p2, size_t n, TAccumulator& inner_product, TAccumulator& sum1, TAccumulator& sum2)
+    {
+      TAccumulator ip0 = TAccumulator(0);
+      TAccumulator ip1 = TAccumulator(0);
+      TAccumulator a0  = TAccumulator(0);
+      TAccumulator a1  = TAccumulator(0);
+      TAccumulator b0  = TAccumulator(0);
+      TAccumulator b1  = TAccumulator(0);
+
+      size_t i = 0U;
+
+      for (; (i + 2U) <= n; i += 2U)
+      {
+        ip0 += TCalc(p1[i] * p2[i]);
+        ip1 += TCalc(p1[i + 1U] * p2[i + 1U]);
+        a0  += TCalc(p1[i]);
+        a1  += TCalc(p1[i + 1U]);
+        b0  += TCalc(p2[i]);
+        b1  += TCalc(p2[i + 1U]);
+      }
+
+      if (i < n)
+      {
+        ip0 += TCalc(p1[i] * p2[i]);
+        a0  += TCalc(p1[i]);
+        b0  += TCalc(p2[i]);
+      }
+
+      inner_product += ip0 + ip1;
+      sum1          += a0 + a1;
+      sum2          += b0 + b1;
+    }
+
+#if ETL_USING_STATISTICS_SIMD
+    //*************************************************************************
+    /// The floating point vector for the target.
+    /// Only specialised for the types that the target supports.
+    //*************************************************************************
+    template <typename T>
+    struct simd_vector
+    {
+      static ETL_CONSTANT bool Supported = false;
+    };
+
+    template <typename T>
+    ETL_CONSTANT bool simd_vector<T>::Supported;
+
+  #if ETL_USING_SIMD_AVX2
+    template <>
+    struct simd_vector<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 8U;
+
+      typedef __m256 type;
+
+      static type zero()                 { return _mm256_setzero_ps(); }
+      static type load(const float* p)   { return _mm256_loadu_ps(p); }
+      static type add(type a, type b)    { return _mm256_add_ps(a, b); }
+      static type mul(type a, type b)    { return _mm256_mul_ps(a, b); }
+      static void store(float* p, type v) { _mm256_storeu_ps(p, v); }
+    };
+
+    template <>
+    struct simd_vector<double>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef __m256d type;
+
+      static type zero()                   { return _mm256_setzero_pd(); }
+      static type load(const double* p)    { return _mm256_loadu_pd(p); }
+      static type add(type a, type b)      { return _mm256_add_pd(a, b); }
+      static type mul(type a, type b)      { return _mm256_mul_pd(a, b); }
+      static void store(double* p, type v) { _mm256_storeu_pd(p, v); }
+    };
+  #elif ETL_USING_SIMD_SSE2
+    template <>
+    struct simd_vector<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef __m128 type;
+
+      static type zero()                  { return _mm_setzero_ps(); }
+      static type load(const float* p)    { return _mm_loadu_ps(p); }
+      static type add(type a, type b)     { return _mm_add_ps(a, b); }
+      static type mul(type a, type b)     { return _mm_mul_ps(a, b); }
+      static void store(float* p, type v) { _mm_storeu_ps(p, v); }
+    };
+
+    template <>
+    struct simd_vector<double>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 2U;
+
+      typedef __m128d type;
+
+      static type zero()                   { return _mm_setzero_pd(); }
+      static type load(const double* p)    { return _mm_loadu_pd(p); }
+      static type add(type a, type b)      { return _mm_add_pd(a, b); }
+      static type mul(type a, type b)      { return _mm_mul_pd(a, b); }
+      static void store(double* p, type v) { _mm_storeu_pd(p, v); }
+    };
+  #else
+    template <>
+    struct simd_vector<float>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 4U;
+
+      typedef float32x4_t type;
+
+      static type zero()                  { return vdupq_n_f32(0.0f); }
+      static type load(const float* p)    { return vld1q_f32(p); }
+      static type add(type a, type b)     { return vaddq_f32(a, b); }
+      static type mul(type a, type b)     { return vmulq_f32(a, b); }
+      static void store(float* p, type v) { vst1q_f32(p, v); }
+    };
+
+    #if defined(__aarch64__)
+    template <>
+    struct simd_vector<double>
+    {
+      static ETL_CONSTANT bool   Supported = true;
+      static ETL_CONSTANT size_t Size      = 2U;
+
+      typedef float64x2_t type;
+
+      static type zero()                   { return vdupq_n_f64(0.0); }
+      static type load(const double* p)    { return vld1q_f64(p); }
+      static type add(type a, type b)      { return vaddq_f64(a, b); }
+      static type mul(type a, type b)      { return vmulq_f64(a, b); }
+      static void store(double* p, type v) { vst1q_f64(p, v); }
+    };
+    #endif
+  #endif
+
+    //*************************************************************************
+    /// Adds the lanes of a vector, in lane order.
+    //*************************************************************************
+    template <typename T>
+    T simd_reduce(typename simd_vector<T>::type v)
+    {
+      T lanes[simd_vector<T>::Size];
+      simd_vector<T>::store(lanes, v);
+
+      T result = T(0);
+
+      for (size_t i = 0U; i < simd_vector<T>::Size; ++i)
+      {
+        result += lanes[i];
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Sums and/or sums of squares of float or double, four vectors at a time.
+    /// Returns the number of values accumulated.
+    //*************************************************************************
+    template <bool Sum, bool Squares, typename T>
+    size_t simd_accumulate(const T* p, size_t n, T& sum, T& sum_of_squares)
+    {
+      typedef simd_vector<T>        vector_t;
+      typedef typename vector_t::type type;
+
+      const size_t Width = vector_t::Size;
+
+      type s0 = vector_t::zero();
+      type s1 = vector_t::zero();
+      type s2 = vector_t::zero();
+      type s3 = vector_t::zero();
+      type q0 = vector_t::zero();
+      type q1 = vector_t::zero();
+      type q2 = vector_t::zero();
+      type q3 = vector_t::zero();
+
+      size_t i = 0U;
+
+      for (; (i + (4U * Width)) <= n; i += (4U * Width))
+      {
+        const type v0 = vector_t::load(p + i);
+        const type v1 = vector_t::load(p + i + Width);
+        const type v2 = vector_t::load(p + i + (2U * Width));
+        const type v3 = vector_t::load(p + i + (3U * Width));
+
+        if (Sum)
+        {
+          s0 = vector_t::add(s0, v0);
+          s1 = vector_t::add(s1, v1);
+          s2 = vector_t::add(s2, v2);
+          s3 = vector_t::add(s3, v3);
+        }
+
+        if (Squares)
+        {
+          q0 = vector_t::add(q0, vector_t::mul(v0, v0));
+          q1 = vector_t::add(q1, vector_t::mul(v1, v1));
+          q2 = vector_t::add(q2, vector_t::mul(v2, v2));
+          q3 = vector_t::add(q3, vector_t::mul(v3, v3));
+        }
+      }
+
+      if (Sum)
+      {
+        sum += simd_reduce<T>(vector_t::add(vector_t::add(s0, s1), vector_t::add(s2, s3)));
+      }
+
+      if (Squares)
+      {
+        sum_of_squares += simd_reduce<T>(vector_t::add(vector_t::add(q0, q1), vector_t::add(q2, q3)));
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Inner product and sums of float or double, two vectors at a time.
+    /// Returns the number of values accumulated.
+    //*************************************************************************
+    template <typename T>
+    size_t simd_inner_product(const T* p1, const T* p2, size_t n, T& inner_product, T& sum1, T& sum2)
+    {
+      typedef simd_vector<T>        vector_t;
+      typedef typename vector_t::type type;
+
+      const size_t Width = vector_t::Size;
+
+      type ip0 = vector_t::zero();
+      type ip1 = vector_t::zero();
+      type a0  = vector_t::zero();
+      type a1  = vector_t::zero();
+      type b0  = vector_t::zero();
+      type b1  = vector_t::zero();
+
+      size_t i = 0U;
+
+      for (; (i + (2U * Width)) <= n; i += (2U * Width))
+      {
+        const type x0 = vector_t::load(p1 + i);
+        const type x1 = vector_t::load(p1 + i + Width);
+        const type y0 = vector_t::load(p2 + i);
+        const type y1 = vector_t::load(p2 + i + Width);
+
+        ip0 = vector_t::add(ip0, vector_t::mul(x0, y0));
+        ip1 = vector_t::add(ip1, vector_t::mul(x1, y1));
+        a0  = vector_t::add(a0, x0);
+        a1  = vector_t::add(a1, x1);
+        b0  = vector_t::add(b0, y0);
+        b1  = vector_t::add(b1, y1);
+      }
+
+      inner_product += simd_reduce<T>(vector_t::add(ip0, ip1));
+      sum1          += simd_reduce<T>(vector_t::add(a0, a1));
+      sum2          += simd_reduce<T>(vector_t::add(b0, b1));
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// Sums and/or sums of squares of int16_t, eight values at a time.
+    /// The 32 bit partial sums are widened to 64 bits before they can overflow.
+    /// Returns the number of values accumulated.
+    //*************************************************************************
+    template <bool Sum, bool Squares>
+    size_t simd_accumulate_int16(const int16_t* p, size_t n, int64_t& sum, uint64_t& sum_of_squares)
+    {
+      // Each 32 bit lane gains at most 2^16 per vector.
+      const size_t Block_Size = 8U * 16384U;
+
+      size_t i = 0U;
+
+  #if ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_AVX2
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i ones = _mm_set1_epi16(1);
+
+      __m128i s64 = zero;
+      __m128i q64 = zero;
+
+      while ((i + 8U) <= n)
+      {
+        const size_t block_end = ((n - i) > Block_Size) ? (i + Block_Size) : n;
+
+        __m128i s32 = zero;
+
+        for (; (i + 8U) <= block_end; i += 8U)
+        {
+          const __m128i v = etl::private_simd::load_128(p + i);
+
+          if (Sum)
+          {
+            s32 = _mm_add_epi32(s32, _mm_madd_epi16(v, ones));
+          }
+
+          if (Squares)
+          {
+            // A pair of squares is at most 2^31, so fits an unsigned 32 bit lane.
+            const __m128i q = _mm_madd_epi16(v, v);
+            q64 = _mm_add_epi64(q64, _mm_unpacklo_epi32(q, zero));
+            q64 = _mm_add_epi64(q64, _mm_unpackhi_epi32(q, zero));
+          }
+        }
+
+        if (Sum)
+        {
+          const __m128i sign = _mm_srai_epi32(s32, 31);
+          s64 = _mm_add_epi64(s64, _mm_unpacklo_epi32(s32, sign));
+          s64 = _mm_add_epi64(s64, _mm_unpackhi_epi32(s32, sign));
+        }
+      }
+
+      int64_t  sums[2];
+      uint64_t squares[2];
+      etl::private_simd::store_128(sums, s64);
+      etl::private_simd::store_128(squares, q64);
+  #else
+      int64x2_t s64 = vdupq_n_s64(0);
+      int64x2_t q64 = vdupq_n_s64(0);
+
+      while ((i + 8U) <= n)
+      {
+        const size_t block_end = ((n - i) > Block_Size) ? (i + Block_Size) : n;
+
+        int32x4_t s32 = vdupq_n_s32(0);
+
+        for (; (i + 8U) <= block_end; i += 8U)
+        {
+          const int16x8_t v = vld1q_s16(p + i);
+
+          if (Sum)
+          {
+            s32 = vpadalq_s16(s32, v);
+          }
+
+          if (Squares)
+          {
+            q64 = vpadalq_s32(q64, vmull_s16(vget_low_s16(v), vget_low_s16(v)));
+            q64 = vpadalq_s32(q64, vmull_s16(vget_high_s16(v), vget_high_s16(v)));
+          }
+        }
+
+        if (Sum)
+        {
+          s64 = vpadalq_s32(s64, s32);
+        }
+      }
+
+      int64_t  sums[2];
+      uint64_t squares[2];
+      vst1q_s64(sums, s64);
+      vst1q_u64(squares, vreinterpretq_u64_s64(q64));
+  #endif
+
+      sum            += sums[0] + sums[1];
+      sum_of_squares += squares[0] + squares[1];
+
+      return i;
+    }
+#endif
+
+    //*************************************************************************
+    /// Selects the block accumulation method.
+    /// 0 = generic, 1 = floating point vectors, 2 = int16_t vectors.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TAccumulator>
+    struct block_method
+    {
+#if ETL_USING_STATISTICS_SIMD
+      static ETL_CONSTANT int value = (etl::is_same<TInput, TCalc>::value && etl::is_same<TCalc, TAccumulator>::value && simd_vector<TInput>::Supported) ? 1
+                                    : (etl::is_same<TInput, int16_t>::value && etl::is_integral<TAccumulator>::value && (sizeof(TAccumulator) >= 4U)) ? 2
+                                    : 0;
+#else
+      static ETL_CONSTANT int value = 0;
+#endif
+    };
+
+    template <typename TInput, typename TCalc, typename TAccumulator>
+    ETL_CONSTANT int block_method<TInput, TCalc, TAccumulator>::value;
+
+    //*************************************************************************
+    /// Block accumulation.
+    /// Each function adds to the accumulators passed in.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TAccumulator, int Method = block_method<TInput, TCalc, TAccumulator>::value>
+    struct block_accumulate
+    {
+      static void sum(const TInput* p, size_t n, TAccumulator& result)
+      {
+        TAccumulator unused = TAccumulator(0);
+        generic_accumulate<true, false, TCalc>(p, n, result, unused);
+      }
+
+      static void sum_of_squares(const TInput* p, size_t n, TAccumulator& result)
+      {
+        TAccumulator unused = TAccumulator(0);
+        generic_accumulate<false, true, TCalc>(p, n, unused, result);
+      }
+
+      static void sum_and_sum_of_squares(const TInput* p, size_t n, TAccumulator& sum, TAccumulator& sum_of_squares)
+      {
+        generic_accumulate<true, true, TCalc>(p, n, sum, sum_of_squares);
+      }
+
+      static void inner_product(const TInput* p1, const TInput* p2, size_t n, TAccumulator& inner_product, TAccumulator& sum1, TAccumulator& sum2)
+      {
+        generic_inner_product<TCalc>(p1, p2, n, inner_product, sum1, sum2);
+      }
+    };
+
+#if ETL_USING_STATISTICS_SIMD
+    //*************************************************************************
+    /// Block accumulation of float or double.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TAccumulator>
+    struct block_accumulate<TInput, TCalc, TAccumulator, 1>
+    {
+      static void sum(const TInput* p, size_t n, TAccumulator& result)
+      {
+        TAccumulator unused = TAccumulator(0);
+        const size_t i = simd_accumulate<true, false>(p, n, result, unused);
+        generic_accumulate<true, false, TCalc>(p + i, n - i, result, unused);
+      }
+
+      static void sum_of_squares(const TInput* p, size_t n, TAccumulator& result)
+      {
+        TAccumulator unused = TAccumulator(0);
+        const size_t i = simd_accumulate<false, true>(p, n, unused, result);
+        generic_accumulate<false, true, TCalc>(p + i, n - i, unused, result);
+      }
+
+      static void sum_and_sum_of_squares(const TInput* p, size_t n, TAccumulator& sum, TAccumulator& sum_of_squares)
+      {
+        const size_t i = simd_accumulate<true, true>(p, n, sum, sum_of_squares);
+        generic_accumulate<true, true, TCalc>(p + i, n - i, sum, sum_of_squares);
+      }
+
+      static void inner_product(const TInput* p1, const TInput* p2, size_t n, TAccumulator& inner_product, TAccumulator& sum1, TAccumulator& sum2)
+      {
+        const size_t i = simd_inner_product(p1, p2, n, inner_product, sum1, sum2);
+        generic_inner_product<TCalc>(p1 + i, p2 + i, n - i, inner_product, sum1, sum2);
+      }
+    };
+
+    //*************************************************************************
+    /// Block accumulation of int16_t into an integral type.
+    //*************************************************************************
+    template <typename TInput, typename TCalc, typename TAccumulator>
+    struct block_accumulate<TInput, TCalc, TAccumulator, 2>
+    {
+      static void sum(const TInput* p, size_t n, TAccumulator& result)
+      {
+        int64_t  total  = 0;
+        uint64_t unused = 0U;
+        const size_t i = simd_accumulate_int16<true, false>(p, n, total, unused);
+        result += TAccumulator(total);
+
+        TAccumulator unused_tail = TAccumulator(0);
+        generic_accumulate<true, false, TCalc>(p + i, n - i, result, unused_tail);
+      }
+
+      static void sum_of_squares(const TInput* p, size_t n, TAccumulator& result)
+      {
+        int64_t  unused = 0;
+        uint64_t total  = 0U;
+        const size_t i = simd_accumulate_int16<false, true>(p, n, unused, total);
+        result += TAccumulator(total);
+
+        TAccumulator unused_tail = TAccumulator(0);
+        generic_accumulate<false, true, TCalc>(p + i, n - i, unused_tail, result);
+      }
+
+      static void sum_and_sum_of_squares(const TInput* p, size_t n, TAccumulator& sum, TAccumulator& sum_of_squares)
+      {
+        int64_t  total_sum            = 0;
+        uint64_t total_sum_of_squares = 0U;
+        const size_t i = simd_accumulate_int16<true, true>(p, n, total_sum, total_sum_of_squares);
+        sum            += TAccumulator(total_sum);
+        sum_of_squares += TAccumulator(total_sum_of_squares);
+
+        generic_accumulate<true, true, TCalc>(p + i, n - i, sum, sum_of_squares);
+      }
+
+      static void inner_product(const TInput* p1, const TInput* p2, size_t n, TAccumulator& inner_product, TAccumulator& sum1, TAccumulator& sum2)
+      {
+        generic_inner_product<TCalc>(p1, p2, n, inner_product, sum1, sum2);
+      }
+    };
+#endif
+  }
+}
+
+#endif
@@ -0,0 +1,206 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+#include "../platform.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Run time search and compare functions for contiguous character arrays.
+// Character searches on byte sized types use memchr, and equality uses memcmp,
+// as the C library versions are vectorised on most targets.
+// Ordering compares a machine word at a time to find the first difference.
+// These are not constexpr. Callers that are constexpr must only use them
+// when ETL_STRING_SEARCH_IS_RUNTIME is true.
+//*****************************************************************************
+
+#if ETL_USING_CPP14 && !ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED
+  // Constexpr callers cannot tell if they are being evaluated at compile time.
+  #define ETL_USING_STRING_SEARCH_IN_CONSTEXPR 0
+  #define ETL_STRING_SEARCH_IS_RUNTIME false
+#elif ETL_USING_CPP14
+  #define ETL_USING_STRING_SEARCH_IN_CONSTEXPR 1
+  #define ETL_STRING_SEARCH_IS_RUNTIME (!__builtin_is_constant_evaluated())
+#else
+  #define ETL_USING_STRING_SEARCH_IN_CONSTEXPR 1
+  #define ETL_STRING_SEARCH_IS_RUNTIME true
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+#if ETL_USING_64BIT_TYPES
+    typedef uint64_t word_type;
+#else
+    typedef uint32_t word_type;
+#endif
+
+    //*************************************************************************
+    /// Finds a character.
+    /// Byte sized characters use memchr.
+    ///\return A pointer to the character, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c)
+    {
+      if (sizeof(T) == 1U)
+      {
+        const void* p = memchr(first, static_cast<unsigned char>(c), static_cast<size_t>(last - first));
+
+        return (p == ETL_NULLPTR) ? last : static_cast<const T*>(p);
+      }
+      else
+      {
+        while ((first != last) && !(*first == c))
+        {
+          ++first;
+        }
+
+        return first;
+      }
+    }
+
+    //*************************************************************************
+    /// Are the two character arrays equal?
+    //*************************************************************************
+    template <typename T>
+    bool equal(const T* p1, const T* p2, size_t length)
+    {
+      return (length == 0U) || (memcmp(p1, p2, length * sizeof(T)) == 0);
+    }
+
+    //*************************************************************************
+    /// Finds the index of the first character that differs, a word at a time.
+    ///\return The index of the first difference, or 'length' if none.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch(const T* p1, const T* p2, size_t length)
+    {
+      const unsigned char* b1    = reinterpret_cast<const unsigned char*>(p1);
+      const unsigned char* b2    = reinterpret_cast<const unsigned char*>(p2);
+      const size_t         bytes = length * sizeof(T);
+
+      size_t i = 0U;
+
+      for (; (i + sizeof(word_type)) <= bytes; i += sizeof(word_type))
+      {
+        word_type w1;
+        word_type w2;
+
+        memcpy(&w1, b1 + i, sizeof(word_type));
+        memcpy(&w2, b2 + i, sizeof(word_type));
+
+        if (w1 != w2)
+        {
+          break;
+        }
+      }
+
+      // Find the character within the differing word, or the tail.
+      size_t index = i / sizeof(T);
+
+      while ((index < length) && (p1[index] == p2[index]))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// Compares two character arrays.
+    ///\return -1, 0 or 1, as the first is less than, equal to or greater than the second.
+    //*************************************************************************
+    template <typename T>
+    int compare(const T* p1, size_t length1, const T* p2, size_t length2)
+    {
+      const size_t length = (length1 < length2) ? length1 : length2;
+      const size_t index  = mismatch(p1, p2, length);
+
+      if (index != length)
+      {
+        return (p1[index] < p2[index]) ? -1 : 1;
+      }
+
+      return (length1 == length2) ? 0 : ((length1 < length2) ? -1 : 1);
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of a substring.
+    /// Finds each candidate for the first character, then verifies the rest.
+    ///\return A pointer to the start of the substring, or 'last' if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* search(const T* first, const T* last, const T* s_first, const T* s_last)
+    {
+      const size_t length = static_cast<size_t>(s_last - s_first);
+
+      if (length == 0U)
+      {
+        return first;
+      }
+
+      if ((last < first) || (static_cast<size_t>(last - first) < length))
+      {
+        return last;
+      }
+
+      // The last position that the substring could start at, plus one.
+      const T* const end_of_starts = last - (length - 1U);
+
+      while (first != end_of_starts)
+      {
+        first = find_char(first, end_of_starts, *s_first);
+
+        if (first == end_of_starts)
+        {
+          break;
+        }
+
+        if (equal(first + 1, s_first + 1, length - 1U))
+        {
+          return first;
+        }
+
+        ++first;
+      }
+
+      return last;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,373 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PRIVATE_TIMER_WHEEL_INCLUDED
+#define ETL_PRIVATE_TIMER_WHEEL_INCLUDED
+
+#include "../platform.h"
+#include "../static_assert.h"
+#include "../timer.h"
+#include "../integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace etl
+{
+  namespace private_timer_wheel
+  {
+    //*************************************************************************
+    /// A hierarchical timing wheel for the wheel based timers.
+    /// Each level has 2^VLevel_Bits slots and covers VLevel_Bits more bits
+    /// of the 32 bit tick counter than the level below it.
+    /// Timers are placed by their absolute expiry time, so start and stop are
+    /// O(1) and a tick only visits occupied slots and level boundaries.
+    /// TTimer must have the members 'expiry' (uint32_t), 'slot' (uint16_t),
+    /// 'previous' and 'next' (TId).
+    /// TId is the unsigned index type of the timers. Its maximum value marks
+    /// the end of a list, which for the default is etl::timer::id::NO_TIMER.
+    //*************************************************************************
+    template <typename TTimer, size_t VLevel_Bits, typename TId = etl::timer::id::type>
+    class timer_wheel
+    {
+    public:
+
+      ETL_STATIC_ASSERT((VLevel_Bits >= 1U) && (VLevel_Bits <= 8U), "Level bits must be between 1 and 8");
+
+      static ETL_CONSTANT size_t   Level_Bits      = VLevel_Bits;
+      static ETL_CONSTANT size_t   Slots_Per_Level = size_t(1U) << VLevel_Bits;
+      static ETL_CONSTANT size_t   Levels          = (32U + VLevel_Bits - 1U) / VLevel_Bits;
+      static ETL_CONSTANT uint16_t Expired_Slot    = uint16_t(Levels * Slots_Per_Level);
+      static ETL_CONSTANT uint16_t No_Slot         = 0xFFFFU;
+
+      typedef TId id_type;
+
+      /// The id that marks the end of a list.
+      static ETL_CONSTANT id_type No_Id = etl::integral_limits<id_type>::max;
+
+      //*******************************
+      timer_wheel(TTimer* ptimers_, id_type max_timers_)
+        : ptimers(ptimers_)
+        , max_timers(max_timers_)
+        , now(0U)
+      {
+        clear();
+      }
+
+      //*******************************
+      /// Removes all timers from the wheel.
+      /// The timers themselves are reset by the owner.
+      //*******************************
+      void clear()
+      {
+        for (size_t i = 0U; i <= Expired_Slot; ++i)
+        {
+          heads[i] = No_Id;
+        }
+
+        for (size_t i = 0U; i < Levels; ++i)
+        {
+          level_count[i] = 0U;
+        }
+      }
+
+      //*******************************
+      /// Adds a timer that expires 'delay' ticks from now.
+      /// A zero delay expires on the next call to tick.
+      //*******************************
+      void insert(id_type id_, uint32_t delay)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.expiry = now + delay;
+
+        if (delay == 0U)
+        {
+          link(Expired_Slot, id_);
+        }
+        else
+        {
+          place(id_);
+        }
+      }
+
+      //*******************************
+      /// Removes a timer from the wheel.
+      //*******************************
+      void remove(id_type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        if (timer.previous == No_Id)
+        {
+          heads[timer.slot] = timer.next;
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+        }
+
+        if (timer.next != No_Id)
+        {
+          ptimers[timer.next].previous = timer.previous;
+        }
+
+        if (timer.slot != Expired_Slot)
+        {
+          --level_count[timer.slot / Slots_Per_Level];
+        }
+
+        timer.slot     = No_Slot;
+        timer.previous = No_Id;
+        timer.next     = No_Id;
+      }
+
+      //*******************************
+      /// Removes and returns the next expired timer, or NO_TIMER if there are none.
+      //*******************************
+      id_type pop_expired()
+      {
+        id_type id = heads[Expired_Slot];
+
+        if (id != No_Id)
+        {
+          remove(id);
+        }
+
+        return id;
+      }
+
+      //*******************************
+      /// Advances the wheel to the next occupied level 0 slot or level
+      /// boundary, without passing 'count' ticks, and moves any timers that
+      /// are due to the expired list.
+      /// Returns false when 'count' has been consumed.
+      //*******************************
+      bool advance(uint32_t& count)
+      {
+        if (count == 0U)
+        {
+          return false;
+        }
+
+        // Find the lowest level that holds timers.
+        size_t level = 0U;
+
+        while ((level < Levels) && (level_count[level] == 0U))
+        {
+          ++level;
+        }
+
+        if (level == Levels)
+        {
+          // Nothing in the wheel, so just move time on.
+          now += count;
+          count = 0U;
+          return false;
+        }
+
+        uint32_t step;
+
+        if (level == 0U)
+        {
+          // Step to the next occupied slot, or the end of this rotation.
+          const size_t current = size_t(now & Slot_Mask);
+          size_t slot = current + 1U;
+
+          while ((slot < Slots_Per_Level) && (heads[slot] == No_Id))
+          {
+            ++slot;
+          }
+
+          step = uint32_t(slot - current);
+        }
+        else
+        {
+          // The lower levels are empty, so step to the next boundary of this level.
+          const uint32_t span = uint32_t(1U) << (Level_Bits * level);
+          step = span - (now & (span - 1U));
+        }
+
+        if (step > count)
+        {
+          step = count;
+        }
+
+        now   += step;
+        count -= step;
+
+        // Cascade the higher levels whose lower bits have rolled over.
+        for (size_t l = 1U; (l < Levels) && ((now & ((uint32_t(1U) << (Level_Bits * l)) - 1U)) == 0U); ++l)
+        {
+          cascade(uint16_t((l * Slots_Per_Level) + ((now >> (Level_Bits * l)) & Slot_Mask)));
+        }
+
+        // Move the timers in the current slot to the expired list.
+        const uint16_t slot = uint16_t(now & Slot_Mask);
+        id_type id = heads[slot];
+
+        while (id != No_Id)
+        {
+          const id_type next_id = ptimers[id].next;
+          remove(id);
+          link(Expired_Slot, id);
+          id = next_id;
+        }
+
+        return true;
+      }
+
+      //*******************************
+      /// The number of ticks until the next timer expires.
+      //*******************************
+      uint32_t time_to_next() const
+      {
+        if (heads[Expired_Slot] != No_Id)
+        {
+          return 0U;
+        }
+
+        uint32_t delay = etl::timer::state::Inactive;
+
+        for (id_type i = 0U; i < max_timers; ++i)
+        {
+          const TTimer& timer = ptimers[i];
+
+          if (timer.slot != No_Slot)
+          {
+            const uint32_t remaining = timer.expiry - now;
+
+            if (remaining < delay)
+            {
+              delay = remaining;
+            }
+          }
+        }
+
+        return delay;
+      }
+
+    private:
+
+      static ETL_CONSTANT uint32_t Slot_Mask = uint32_t(Slots_Per_Level - 1U);
+
+      //*******************************
+      /// Places a timer in the wheel according to its expiry time.
+      //*******************************
+      void place(id_type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        size_t level = Levels - 1U;
+
+        // An expiry that has wrapped past zero waits in the top level.
+        if (timer.expiry >= now)
+        {
+          // The level is set by the highest group of bits that differ from now.
+          const uint32_t difference = timer.expiry ^ now;
+          level = 0U;
+
+          while ((level < (Levels - 1U)) && ((difference >> (Level_Bits * (level + 1U))) != 0U))
+          {
+            ++level;
+          }
+        }
+
+        ++level_count[level];
+        link(uint16_t((level * Slots_Per_Level) + ((timer.expiry >> (Level_Bits * level)) & Slot_Mask)), id_);
+      }
+
+      //*******************************
+      /// Re-places all of the timers in a slot relative to the current time.
+      //*******************************
+      void cascade(uint16_t slot)
+      {
+        id_type id = heads[slot];
+
+        while (id != No_Id)
+        {
+          const id_type next_id = ptimers[id].next;
+          remove(id);
+          place(id);
+          id = next_id;
+        }
+      }
+
+      //*******************************
+      /// Links a timer to the front of a slot list.
+      //*******************************
+      void link(uint16_t slot, id_type id_)
+      {
+        TTimer& timer = ptimers[id_];
+
+        timer.slot     = slot;
+        timer.previous = No_Id;
+        timer.next     = heads[slot];
+
+        if (timer.next != No_Id)
+        {
+          ptimers[timer.next].previous = id_;
+        }
+
+        heads[slot] = id_;
+      }
+
+      TTimer* const       ptimers;
+      const id_type       max_timers;
+      uint32_t            now;
+
+      id_type heads[Expired_Slot + 1U];
+      id_type level_count[Levels];
+    };
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT size_t timer_wheel<TTimer, VLevel_Bits, TId>::Level_Bits;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT size_t timer_wheel<TTimer, VLevel_Bits, TId>::Slots_Per_Level;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT size_t timer_wheel<TTimer, VLevel_Bits, TId>::Levels;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT uint16_t timer_wheel<TTimer, VLevel_Bits, TId>::Expired_Slot;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT uint16_t timer_wheel<TTimer, VLevel_Bits, TId>::No_Slot;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT typename timer_wheel<TTimer, VLevel_Bits, TId>::id_type timer_wheel<TTimer, VLevel_Bits, TId>::No_Id;
+
+    template <typename TTimer, size_t VLevel_Bits, typename TId>
+    ETL_CONSTANT uint32_t timer_wheel<TTimer, VLevel_Bits, TId>::Slot_Mask;
+  }
+}
+
+#endif
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "../iterator.h"
 #include "../math.h"
 #include "../limits.h"
+#include "to_string_shortest.h"
 
 #include <math.h>
 
@@ -136,8 +137,124 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// The magnitude of a signed integral, as the unsigned type.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_signed<T>::value, typename etl::make_unsigned<T>::type>::type
+      unsigned_magnitude(T value)
+    {
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      unsigned_t magnitude = static_cast<unsigned_t>(value);
+
+      if (value < T(0))
+      {
+        magnitude = 0U - magnitude;
+      }
+
+      return magnitude;
+    }
+
+    //***************************************************************************
+    /// The magnitude of an unsigned integral.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_unsigned<T>::value, T>::type
+      unsigned_magnitude(T value)
+    {
+      return value;
+    }
+
+    //***************************************************************************
+    /// The character for a digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar digit_character(uint32_t digit, bool upper_case)
+    {
+      return (digit > 9U) ? (upper_case ? TChar('A' + (digit - 10U)) : TChar('a' + (digit - 10U))) : TChar('0' + digit);
+    }
+
+    //***************************************************************************
+    /// Writes the digits of a non-zero value backwards, ending just before 'p'.
+    /// Base 10 converts two digits per division by a constant.
+    /// Bases 2, 8 and 16 use shifts and masks.
+    ///\return A pointer to the most significant digit.
+    //***************************************************************************
+    template <typename TChar, typename TUnsigned>
+    TChar* write_digits_backwards(TUnsigned value, TChar* p, const uint32_t base, const bool upper_case)
+    {
+      static const char digit_pairs[] = "00010203040506070809"
+                                        "10111213141516171819"
+                                        "20212223242526272829"
+                                        "30313233343536373839"
+                                        "40414243444546474849"
+                                        "50515253545556575859"
+                                        "60616263646566676869"
+                                        "70717273747576777879"
+                                        "80818283848586878889"
+                                        "90919293949596979899";
+
+      uint32_t shift = 0U;
+
+      switch (base)
+      {
+        case 10U:
+        {
+          while (value >= 100U)
+          {
+            const uint32_t pair = static_cast<uint32_t>(value % 100U) * 2U;
+            value /= 100U;
+
+            *--p = TChar(digit_pairs[pair + 1U]);
+            *--p = TChar(digit_pairs[pair]);
+          }
+
+          if (value >= 10U)
+          {
+            const uint32_t pair = static_cast<uint32_t>(value) * 2U;
+
+            *--p = TChar(digit_pairs[pair + 1U]);
+            *--p = TChar(digit_pairs[pair]);
+          }
+          else
+          {
+            *--p = TChar('0' + static_cast<uint32_t>(value));
+          }
+
+          return p;
+        }
+
+        case 2U:  { shift = 1U; break; }
+        case 8U:  { shift = 3U; break; }
+        case 16U: { shift = 4U; break; }
+
+        default:
+        {
+          while (value != 0U)
+          {
+            *--p  = digit_character<TChar>(static_cast<uint32_t>(value % base), upper_case);
+            value = value / base;
+          }
+
+          return p;
+        }
+      }
+
+      const uint32_t mask = (1U << shift) - 1U;
+
+      while (value != 0U)
+      {
+        *--p    = digit_character<TChar>(static_cast<uint32_t>(value) & mask, upper_case);
+        value >>= shift;
+      }
+
+      return p;
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
+    /// The characters are built backwards in a local buffer, then appended.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value,
@@ -149,6 +266,8 @@ namespace etl
       typedef typename TIString::value_type type;
       typedef typename TIString::iterator   iterator;
 
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
       if (!append)
       {
         str.clear();
@@ -168,18 +287,21 @@ namespace etl
       }
       else
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
-        {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
-        }
+        // Enough for binary digits, a sign and a base prefix.
+        static ETL_CONSTANT size_t Buffer_Size = etl::integral_limits<unsigned_t>::bits + 3U;
+
+        type        buffer[Buffer_Size];
+        type* const buffer_end = buffer + Buffer_Size;
 
-        // If number is negative, append '-'
+        type* p = etl::private_to_string::write_digits_backwards(etl::private_to_string::unsigned_magnitude(value),
+                                                                 buffer_end,
+                                                                 format.get_base(),
+                                                                 format.is_upper_case());
+
+        // If number is negative, prepend '-'
         if ((format.get_base() == 10U) && negative)
         {
-          str.push_back(type('-'));
+          *--p = type('-');
         }
 
         if (format.is_show_base())
@@ -188,21 +310,21 @@ namespace etl
           {
             case 2U:
             {
-              str.push_back(format.is_upper_case() ? type('B') : type('b'));
-              str.push_back(type('0'));
+              *--p = format.is_upper_case() ? type('B') : type('b');
+              *--p = type('0');
               break;
             }
 
             case 8U:
             {
-              str.push_back(type('0'));
+              *--p = type('0');
               break;
             }
 
             case 16U:
             {
-              str.push_back(format.is_upper_case() ? type('X') : type('x'));
-              str.push_back(type('0'));
+              *--p = format.is_upper_case() ? type('X') : type('x');
+              *--p = type('0');
               break;
             }
 
@@ -213,8 +335,7 @@ namespace etl
           }
         }
 
-        // Reverse the string we appended.
-        etl::reverse(start, str.end());
+        str.append(p, static_cast<size_t>(buffer_end - p));
       }
 
       etl::private_to_string::add_alignment(str, start, format);
@@ -312,6 +433,12 @@ namespace etl
       {
         etl::private_to_string::add_nan_inf(isnan(value), isinf(value), str);
       }
+#if ETL_HAS_SHORTEST_FLOATING_POINT
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_floating_point_shortest(value, str, format);
+      }
+#endif
       else
       {
         // Make sure we format the two halves correctly.
@@ -0,0 +1,624 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_STRING_SHORTEST_INCLUDED
+#define ETL_TO_STRING_SHORTEST_INCLUDED
+
+#include "../platform.h"
+#include "../basic_format_spec.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Shortest round trip formatting of float and double.
+// The digits are generated with the free format algorithm of Burger and
+// Dybvig, using exact arithmetic on a small fixed size big integer. This
+// needs no tables of powers and no heap, so the code size stays small. The
+// big integer is about 160 bytes of stack for double and 32 bytes for float.
+// The result is the fewest digits that convert back to the same value, and
+// the closest to it when there is a choice.
+// Define ETL_DISABLE_SHORTEST_FLOATING_POINT to leave it out of the build.
+//*****************************************************************************
+
+#if ETL_HAS_SHORTEST_FLOATING_POINT
+
+namespace etl
+{
+  namespace private_to_string
+  {
+    //*************************************************************************
+    /// A fixed capacity unsigned big integer.
+    //*************************************************************************
+    template <size_t Words>
+    class shortest_big_unsigned
+    {
+    public:
+
+      //*******************************
+      shortest_big_unsigned()
+        : used(0U)
+      {
+      }
+
+      //*******************************
+      void assign(uint64_t value)
+      {
+        used = 0U;
+
+        while (value != 0U)
+        {
+          word[used++] = static_cast<uint32_t>(value);
+          value >>= 32U;
+        }
+      }
+
+      //*******************************
+      void shift_left(uint32_t bits)
+      {
+        if (used == 0U)
+        {
+          return;
+        }
+
+        const size_t   words = bits / 32U;
+        const uint32_t shift = bits % 32U;
+
+        if (shift != 0U)
+        {
+          uint32_t carry = 0U;
+
+          for (size_t i = 0U; i < used; ++i)
+          {
+            const uint32_t w = word[i];
+            word[i] = (w << shift) | carry;
+            carry   = w >> (32U - shift);
+          }
+
+          if (carry != 0U)
+          {
+            word[used++] = carry;
+          }
+        }
+
+        if (words != 0U)
+        {
+          for (size_t i = used; i-- > 0U;)
+          {
+            word[i + words] = word[i];
+          }
+
+          for (size_t i = 0U; i < words; ++i)
+          {
+            word[i] = 0U;
+          }
+
+          used += words;
+        }
+      }
+
+      //*******************************
+      void multiply(uint32_t multiplier)
+      {
+        uint64_t carry = 0U;
+
+        for (size_t i = 0U; i < used; ++i)
+        {
+          const uint64_t product = (uint64_t(word[i]) * multiplier) + carry;
+          word[i] = static_cast<uint32_t>(product);
+          carry   = product >> 32U;
+        }
+
+        if (carry != 0U)
+        {
+          word[used++] = static_cast<uint32_t>(carry);
+        }
+      }
+
+      //*******************************
+      void multiply_pow10(uint32_t n)
+      {
+        static const uint32_t powers[] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL };
+
+        while (n >= 9U)
+        {
+          multiply(1000000000UL);
+          n -= 9U;
+        }
+
+        if (n != 0U)
+        {
+          multiply(powers[n]);
+        }
+      }
+
+      //*******************************
+      void add(const shortest_big_unsigned& other)
+      {
+        const size_t n = (used > other.used) ? used : other.used;
+
+        uint64_t carry = 0U;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const uint64_t sum = uint64_t((i < used) ? word[i] : 0U) + ((i < other.used) ? other.word[i] : 0U) + carry;
+          word[i] = static_cast<uint32_t>(sum);
+          carry   = sum >> 32U;
+        }
+
+        used = n;
+
+        if (carry != 0U)
+        {
+          word[used++] = static_cast<uint32_t>(carry);
+        }
+      }
+
+      //*******************************
+      /// Divides in place.
+      ///\return The remainder.
+      //*******************************
+      uint32_t divide(uint32_t divisor)
+      {
+        uint64_t remainder = 0U;
+
+        for (size_t i = used; i-- > 0U;)
+        {
+          const uint64_t dividend = (remainder << 32U) | word[i];
+          word[i]   = static_cast<uint32_t>(dividend / divisor);
+          remainder = dividend % divisor;
+        }
+
+        while ((used != 0U) && (word[used - 1U] == 0U))
+        {
+          --used;
+        }
+
+        return static_cast<uint32_t>(remainder);
+      }
+
+      //*******************************
+      bool is_zero() const
+      {
+        return used == 0U;
+      }
+
+      //*******************************
+      /// Subtracts a value that is not larger than this one.
+      //*******************************
+      void subtract(const shortest_big_unsigned& other)
+      {
+        uint32_t borrow = 0U;
+
+        for (size_t i = 0U; i < used; ++i)
+        {
+          const uint64_t lhs = word[i];
+          const uint64_t rhs = uint64_t((i < other.used) ? other.word[i] : 0U) + borrow;
+
+          borrow  = (lhs < rhs) ? 1U : 0U;
+          word[i] = static_cast<uint32_t>(lhs - rhs);
+        }
+
+        while ((used != 0U) && (word[used - 1U] == 0U))
+        {
+          --used;
+        }
+      }
+
+      //*******************************
+      static int compare(const shortest_big_unsigned& lhs, const shortest_big_unsigned& rhs)
+      {
+        if (lhs.used != rhs.used)
+        {
+          return (lhs.used < rhs.used) ? -1 : 1;
+        }
+
+        for (size_t i = lhs.used; i-- > 0U;)
+        {
+          if (lhs.word[i] != rhs.word[i])
+          {
+            return (lhs.word[i] < rhs.word[i]) ? -1 : 1;
+          }
+        }
+
+        return 0;
+      }
+
+      //*******************************
+      /// Compares lhs + addend with rhs.
+      //*******************************
+      static int compare_sum(const shortest_big_unsigned& lhs, const shortest_big_unsigned& addend, const shortest_big_unsigned& rhs)
+      {
+        shortest_big_unsigned sum(lhs);
+        sum.add(addend);
+
+        return compare(sum, rhs);
+      }
+
+    private:
+
+      uint32_t word[Words];
+      size_t   used;
+    };
+
+    //*************************************************************************
+    /// The layout of the supported floating point types.
+    //*************************************************************************
+    template <typename T>
+    struct shortest_traits;
+
+    template <>
+    struct shortest_traits<float>
+    {
+      typedef float    value_type;
+      typedef uint32_t bits_type;
+
+      static ETL_CONSTANT uint32_t Mantissa_Bits = 23U;
+      static ETL_CONSTANT uint32_t Exponent_Mask = 0xFFU;
+      static ETL_CONSTANT int      Exponent_Bias = 150;
+      static ETL_CONSTANT size_t   Words         = 8U;
+      static ETL_CONSTANT size_t   Max_Digits    = 9U;
+    };
+
+    template <>
+    struct shortest_traits<double>
+    {
+      typedef double   value_type;
+      typedef uint64_t bits_type;
+
+      static ETL_CONSTANT uint32_t Mantissa_Bits = 52U;
+      static ETL_CONSTANT uint32_t Exponent_Mask = 0x7FFU;
+      static ETL_CONSTANT int      Exponent_Bias = 1075;
+      static ETL_CONSTANT size_t   Words         = 40U;
+      static ETL_CONSTANT size_t   Max_Digits    = 17U;
+    };
+
+    // long double is formatted via double.
+    template <>
+    struct shortest_traits<long double> : public shortest_traits<double>
+    {
+    };
+
+    //*************************************************************************
+    /// floor(log10(2^e)), for |e| <= 2620.
+    //*************************************************************************
+    inline int shortest_floor_log10_pow2(int e)
+    {
+      return (e >= 0) ? static_cast<int>((uint32_t(e) * 315653UL) >> 20U)
+                      : -static_cast<int>(((uint32_t(-e) * 315653UL) + 0xFFFFFUL) >> 20U);
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits for a finite, positive value.
+    /// The value is 0.d1d2...dn x 10^exponent.
+    ///\return The number of digits.
+    //*************************************************************************
+    template <typename T>
+    size_t shortest_digits(typename shortest_traits<T>::bits_type bits, char* digits, int& exponent)
+    {
+      typedef shortest_traits<T>                      traits;
+      typedef typename traits::bits_type              bits_t;
+      typedef shortest_big_unsigned<traits::Words>    big_t;
+
+      const bits_t   hidden   = bits_t(1U) << traits::Mantissa_Bits;
+      const uint32_t biased   = static_cast<uint32_t>(bits >> traits::Mantissa_Bits) & traits::Exponent_Mask;
+      uint64_t       mantissa = bits & (hidden - 1U);
+      int            e        = 1 - traits::Exponent_Bias;
+
+      if (biased != 0U)
+      {
+        mantissa |= hidden;
+        e = static_cast<int>(biased) - traits::Exponent_Bias;
+      }
+
+      // Round half to even when parsing accepts values exactly on the boundaries.
+      const bool even = (mantissa & 1U) == 0U;
+
+      // The gap below a power of two is half the gap above, except at the smallest exponent.
+      const bool unequal_gaps = (mantissa == hidden) && (biased > 1U);
+
+      // v = r / s, with the gaps to the neighbouring values of m_minus / s and m_plus / s.
+      big_t r;
+      big_t s;
+      big_t m_plus;
+      big_t m_minus;
+
+      r.assign(mantissa);
+      m_minus.assign(1U);
+
+      if (e >= 0)
+      {
+        r.shift_left(static_cast<uint32_t>(e) + (unequal_gaps ? 2U : 1U));
+        s.assign(unequal_gaps ? 4U : 2U);
+        m_plus.assign(1U);
+        m_plus.shift_left(static_cast<uint32_t>(e) + (unequal_gaps ? 1U : 0U));
+        m_minus.shift_left(static_cast<uint32_t>(e));
+      }
+      else
+      {
+        r.shift_left(unequal_gaps ? 2U : 1U);
+        s.assign(1U);
+        s.shift_left(static_cast<uint32_t>(-e) + (unequal_gaps ? 2U : 1U));
+        m_plus.assign(unequal_gaps ? 2U : 1U);
+      }
+
+      // Estimate the decimal exponent, from the position of the top bit.
+      int top_bit = -1;
+
+      for (uint64_t m = mantissa; m != 0U; m >>= 1U)
+      {
+        ++top_bit;
+      }
+
+      int k = shortest_floor_log10_pow2(e + top_bit) + 1;
+
+      if (k >= 0)
+      {
+        s.multiply_pow10(static_cast<uint32_t>(k));
+      }
+      else
+      {
+        r.multiply_pow10(static_cast<uint32_t>(-k));
+        m_plus.multiply_pow10(static_cast<uint32_t>(-k));
+        m_minus.multiply_pow10(static_cast<uint32_t>(-k));
+      }
+
+      // The estimate may be one too low.
+      const int c = big_t::compare_sum(r, m_plus, s);
+
+      if (even ? (c >= 0) : (c > 0))
+      {
+        s.multiply(10U);
+        ++k;
+      }
+
+      // Generate digits until the remainder is within the gaps.
+      size_t n = 0U;
+
+      while (true)
+      {
+        r.multiply(10U);
+        m_plus.multiply(10U);
+        m_minus.multiply(10U);
+
+        uint32_t digit = 0U;
+
+        while (big_t::compare(r, s) >= 0)
+        {
+          r.subtract(s);
+          ++digit;
+        }
+
+        const int  low      = big_t::compare(r, m_minus);
+        const int  high     = big_t::compare_sum(r, m_plus, s);
+        const bool low_end  = even ? (low <= 0)  : (low < 0);
+        const bool high_end = even ? (high >= 0) : (high > 0);
+
+        if (!low_end && !high_end)
+        {
+          digits[n++] = static_cast<char>('0' + digit);
+          continue;
+        }
+
+        if (low_end && high_end)
+        {
+          // Either digit is valid, so pick the closest, or the even one on a tie.
+          big_t twice_r(r);
+          twice_r.shift_left(1U);
+
+          const int half = big_t::compare(twice_r, s);
+
+          if ((half > 0) || ((half == 0) && ((digit & 1U) != 0U)))
+          {
+            ++digit;
+          }
+        }
+        else if (high_end)
+        {
+          ++digit;
+        }
+
+        digits[n++] = static_cast<char>('0' + digit);
+        break;
+      }
+
+      exponent = k;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Generates the exact digits of a positive integral value.
+    ///\return The number of digits.
+    //*************************************************************************
+    template <typename T>
+    size_t shortest_exact_integer(typename shortest_traits<T>::bits_type bits, char* digits)
+    {
+      typedef shortest_traits<T>                      traits;
+      typedef typename traits::bits_type              bits_t;
+      typedef shortest_big_unsigned<traits::Words>    big_t;
+
+      const bits_t   hidden = bits_t(1U) << traits::Mantissa_Bits;
+      const uint32_t biased = static_cast<uint32_t>(bits >> traits::Mantissa_Bits) & traits::Exponent_Mask;
+      const int      e      = static_cast<int>(biased) - traits::Exponent_Bias;
+
+      const uint64_t mantissa = (bits & (hidden - 1U)) | hidden;
+
+      big_t value;
+
+      if (e >= 0)
+      {
+        value.assign(mantissa);
+        value.shift_left(static_cast<uint32_t>(e));
+      }
+      else
+      {
+        // Only integral values get here, so the shifted out bits are zero.
+        value.assign(mantissa >> static_cast<uint32_t>(-e));
+      }
+
+      char   reversed[32];
+      size_t n = 0U;
+
+      while (!value.is_zero())
+      {
+        reversed[n++] = static_cast<char>('0' + value.divide(10U));
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        digits[i] = reversed[n - 1U - i];
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Appends the shortest round trip representation of a floating point value.
+    /// The value must be finite.
+    //*************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point_shortest(const T value,
+                                     TIString& str,
+                                     const etl::basic_format_spec<TIString>& format)
+    {
+      typedef shortest_traits<T>                  traits;
+      typedef typename traits::value_type         value_type;
+      typedef typename traits::bits_type          bits_t;
+      typedef typename TIString::value_type       type;
+
+      const value_type v = value;
+
+      bits_t bits;
+      memcpy(&bits, &v, sizeof(bits));
+
+      const bits_t sign_bit = bits_t(1U) << ((sizeof(bits_t) * 8U) - 1U);
+
+      if ((bits & sign_bit) != 0U)
+      {
+        str.push_back(type('-'));
+        bits &= ~sign_bit;
+      }
+
+      if (bits == 0U)
+      {
+        str.push_back(type('0'));
+        return;
+      }
+
+      // Large enough for the longest fixed representation that is not longer than scientific.
+      char   digits[32];
+      int    k = 0;
+      size_t n = shortest_digits<value_type>(bits, digits, k);
+
+      int n_digits = static_cast<int>(n);
+
+      // The lengths of the fixed and scientific representations.
+      const int fixed_length      = (k <= 0) ? (2 - k + n_digits) : ((k < n_digits) ? (n_digits + 1) : k);
+      const int sci_exponent      = k - 1;
+      const int sci_exponent_size = ((sci_exponent >= 100) || (sci_exponent <= -100)) ? 3 : 2;
+      const int sci_length        = n_digits + ((n_digits > 1) ? 1 : 0) + 2 + sci_exponent_size;
+
+      if (fixed_length <= sci_length)
+      {
+        if (k <= 0)
+        {
+          str.push_back(type('0'));
+          str.push_back(type('.'));
+
+          for (int i = 0; i < -k; ++i)
+          {
+            str.push_back(type('0'));
+          }
+
+          for (int i = 0; i < n_digits; ++i)
+          {
+            str.push_back(type(digits[i]));
+          }
+        }
+        else
+        {
+          if (k > n_digits)
+          {
+            // The value is an integer, so show it exactly, as std::to_chars does.
+            n_digits = static_cast<int>(shortest_exact_integer<value_type>(bits, digits));
+            k        = n_digits;
+          }
+
+          for (int i = 0; i < k; ++i)
+          {
+            str.push_back(type(digits[i]));
+          }
+
+          if (k < n_digits)
+          {
+            str.push_back(type('.'));
+
+            for (int i = k; i < n_digits; ++i)
+            {
+              str.push_back(type(digits[i]));
+            }
+          }
+        }
+      }
+      else
+      {
+        str.push_back(type(digits[0]));
+
+        if (n_digits > 1)
+        {
+          str.push_back(type('.'));
+
+          for (int i = 1; i < n_digits; ++i)
+          {
+            str.push_back(type(digits[i]));
+          }
+        }
+
+        str.push_back(format.is_upper_case() ? type('E') : type('e'));
+        str.push_back((sci_exponent < 0) ? type('-') : type('+'));
+
+        const int magnitude = (sci_exponent < 0) ? -sci_exponent : sci_exponent;
+
+        if (magnitude >= 100)
+        {
+          str.push_back(type('0' + (magnitude / 100)));
+        }
+
+        str.push_back(type('0' + ((magnitude / 10) % 10)));
+        str.push_back(type('0' + (magnitude % 10)));
+      }
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,468 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_UTF_SIMD_INCLUDED
+#define ETL_UTF_SIMD_INCLUDED
+
+#include "../platform.h"
+#include "simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+// Vector helpers for etl::transcode.
+// utf_simd_ascii_prefix returns the number of leading bytes that are ASCII,
+// rounded down to a whole number of vectors. The caller handles the rest.
+// utf_simd_validate_utf8 checks a whole buffer using the lookup table
+// algorithm from 'Validating UTF-8 In Less Than One Instruction Per Byte'
+// (Keiser & Lemire). It needs a byte shuffle, so it is only available for
+// SSSE3 and AArch64 NEON.
+//*****************************************************************************
+
+#if ETL_USING_SIMD_AVX2 || ETL_USING_SIMD_SSE2 || ETL_USING_SIMD_NEON
+  #define ETL_USING_UTF_SIMD 1
+#else
+  #define ETL_USING_UTF_SIMD 0
+#endif
+
+#if ETL_USING_SIMD_SSSE3 || (ETL_USING_SIMD_NEON && defined(__aarch64__))
+  #define ETL_USING_UTF8_SIMD_VALIDATION 1
+#else
+  #define ETL_USING_UTF8_SIMD_VALIDATION 0
+#endif
+
+#if ETL_USING_UTF_SIMD
+
+namespace etl
+{
+  namespace private_transcode
+  {
+    //*************************************************************************
+    /// Returns the number of whole vectors of ASCII bytes at the start of the buffer, in bytes.
+    //*************************************************************************
+    inline size_t utf_simd_ascii_prefix(const unsigned char* p, size_t length)
+    {
+      size_t i = 0U;
+
+#if ETL_USING_SIMD_AVX2
+      while ((i + 32U) <= length)
+      {
+        const __m256i v = etl::private_simd::load_256(p + i);
+
+        if (etl::private_simd::mask_256(v) != 0U)
+        {
+          break;
+        }
+
+        i += 32U;
+      }
+#endif
+
+#if ETL_USING_SIMD_SSE2
+      while ((i + 16U) <= length)
+      {
+        const __m128i v = etl::private_simd::load_128(p + i);
+
+        if (etl::private_simd::mask_128(v) != 0U)
+        {
+          break;
+        }
+
+        i += 16U;
+      }
+#elif ETL_USING_SIMD_NEON
+      while ((i + 16U) <= length)
+      {
+        const uint8x16_t v = etl::private_simd::load_128(p + i);
+
+        if (etl::private_simd::mask_128(vshrq_n_u8(v, 7)) != 0U)
+        {
+          break;
+        }
+
+        i += 16U;
+      }
+#endif
+
+      return i;
+    }
+
+#if ETL_USING_UTF8_SIMD_VALIDATION
+    //*************************************************************************
+    /// The error classes used by the lookup tables.
+    //*************************************************************************
+    struct utf8_error
+    {
+      static ETL_CONSTANT uint8_t Too_Short      = 0x01U; // A lead byte, or ASCII, followed by a continuation.
+      static ETL_CONSTANT uint8_t Too_Long       = 0x02U; // ASCII followed by a continuation.
+      static ETL_CONSTANT uint8_t Overlong_3     = 0x04U; // E0 followed by 80..9F.
+      static ETL_CONSTANT uint8_t Too_Large      = 0x08U; // F4 followed by 90..BF, or F5..FF.
+      static ETL_CONSTANT uint8_t Surrogate      = 0x10U; // ED followed by A0..BF.
+      static ETL_CONSTANT uint8_t Overlong_2     = 0x20U; // C0 or C1.
+      static ETL_CONSTANT uint8_t Too_Large_1000 = 0x40U; // F5..FF followed by 80..8F.
+      static ETL_CONSTANT uint8_t Overlong_4     = 0x40U; // F0 followed by 80..8F.
+      static ETL_CONSTANT uint8_t Two_Conts      = 0x80U; // Two continuations in a row.
+      static ETL_CONSTANT uint8_t Carry          = Too_Short | Too_Long | Two_Conts;
+    };
+
+#if ETL_USING_SIMD_SSSE3
+    //*************************************************************************
+    /// SSSE3 primitives for the validator.
+    //*************************************************************************
+    struct utf8_simd
+    {
+      typedef __m128i vector_type;
+
+      static vector_type load(const unsigned char* p)
+      {
+        return etl::private_simd::load_128(p);
+      }
+
+      static vector_type splat(uint8_t value)
+      {
+        return _mm_set1_epi8(static_cast<char>(value));
+      }
+
+      static vector_type zero()
+      {
+        return _mm_setzero_si128();
+      }
+
+      static vector_type table(uint8_t v0, uint8_t v1, uint8_t v2,  uint8_t v3,  uint8_t v4,  uint8_t v5,  uint8_t v6,  uint8_t v7,
+                               uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15)
+      {
+        return _mm_setr_epi8(static_cast<char>(v0),  static_cast<char>(v1),  static_cast<char>(v2),  static_cast<char>(v3),
+                             static_cast<char>(v4),  static_cast<char>(v5),  static_cast<char>(v6),  static_cast<char>(v7),
+                             static_cast<char>(v8),  static_cast<char>(v9),  static_cast<char>(v10), static_cast<char>(v11),
+                             static_cast<char>(v12), static_cast<char>(v13), static_cast<char>(v14), static_cast<char>(v15));
+      }
+
+      static vector_type lookup(vector_type table, vector_type indexes)
+      {
+        return _mm_shuffle_epi8(table, indexes);
+      }
+
+      static vector_type high_nibbles(vector_type v)
+      {
+        return _mm_and_si128(_mm_srli_epi16(v, 4), _mm_set1_epi8(0x0F));
+      }
+
+      static vector_type low_nibbles(vector_type v)
+      {
+        return _mm_and_si128(v, _mm_set1_epi8(0x0F));
+      }
+
+      template <int Shift>
+      static vector_type previous(vector_type input, vector_type prev_input)
+      {
+        return _mm_alignr_epi8(input, prev_input, 16 - Shift);
+      }
+
+      static vector_type bit_and(vector_type a, vector_type b)
+      {
+        return _mm_and_si128(a, b);
+      }
+
+      static vector_type bit_or(vector_type a, vector_type b)
+      {
+        return _mm_or_si128(a, b);
+      }
+
+      static vector_type bit_xor(vector_type a, vector_type b)
+      {
+        return _mm_xor_si128(a, b);
+      }
+
+      static vector_type saturating_sub(vector_type a, vector_type b)
+      {
+        return _mm_subs_epu8(a, b);
+      }
+
+      static bool is_ascii(vector_type v)
+      {
+        return etl::private_simd::mask_128(v) == 0U;
+      }
+
+      static bool any(vector_type v)
+      {
+        return !etl::private_simd::equal_128(v, _mm_setzero_si128());
+      }
+    };
+#else
+    //*************************************************************************
+    /// AArch64 NEON primitives for the validator.
+    //*************************************************************************
+    struct utf8_simd
+    {
+      typedef uint8x16_t vector_type;
+
+      static vector_type load(const unsigned char* p)
+      {
+        return etl::private_simd::load_128(p);
+      }
+
+      static vector_type splat(uint8_t value)
+      {
+        return vdupq_n_u8(value);
+      }
+
+      static vector_type zero()
+      {
+        return vdupq_n_u8(0U);
+      }
+
+      static vector_type table(uint8_t v0, uint8_t v1, uint8_t v2,  uint8_t v3,  uint8_t v4,  uint8_t v5,  uint8_t v6,  uint8_t v7,
+                               uint8_t v8, uint8_t v9, uint8_t v10, uint8_t v11, uint8_t v12, uint8_t v13, uint8_t v14, uint8_t v15)
+      {
+        const uint8_t values[16] = { v0, v1, v2, v3, v4, v5, v6, v7, v8, v9, v10, v11, v12, v13, v14, v15 };
+
+        return etl::private_simd::load_128(values);
+      }
+
+      static vector_type lookup(vector_type table, vector_type indexes)
+      {
+        return vqtbl1q_u8(table, indexes);
+      }
+
+      static vector_type high_nibbles(vector_type v)
+      {
+        return vshrq_n_u8(v, 4);
+      }
+
+      static vector_type low_nibbles(vector_type v)
+      {
+        return vandq_u8(v, vdupq_n_u8(0x0FU));
+      }
+
+      template <int Shift>
+      static vector_type previous(vector_type input, vector_type prev_input)
+      {
+        return vextq_u8(prev_input, input, 16 - Shift);
+      }
+
+      static vector_type bit_and(vector_type a, vector_type b)
+      {
+        return vandq_u8(a, b);
+      }
+
+      static vector_type bit_or(vector_type a, vector_type b)
+      {
+        return vorrq_u8(a, b);
+      }
+
+      static vector_type bit_xor(vector_type a, vector_type b)
+      {
+        return veorq_u8(a, b);
+      }
+
+      static vector_type saturating_sub(vector_type a, vector_type b)
+      {
+        return vqsubq_u8(a, b);
+      }
+
+      static bool is_ascii(vector_type v)
+      {
+        return vmaxvq_u8(v) < 0x80U;
+      }
+
+      static bool any(vector_type v)
+      {
+        return vmaxvq_u8(v) != 0U;
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Validates UTF-8 one vector at a time, carrying the state between vectors.
+    //*************************************************************************
+    class utf8_simd_validator
+    {
+    public:
+
+      typedef utf8_simd::vector_type vector_type;
+
+      utf8_simd_validator()
+        : error(utf8_simd::zero())
+        , prev_input(utf8_simd::zero())
+        , prev_incomplete(utf8_simd::zero())
+      {
+      }
+
+      //***********************************************************************
+      /// Checks the next 16 bytes.
+      //***********************************************************************
+      void check(vector_type input)
+      {
+        if (utf8_simd::is_ascii(input))
+        {
+          // ASCII cannot complete a sequence left open by the previous vector.
+          error           = utf8_simd::bit_or(error, prev_incomplete);
+          prev_incomplete = utf8_simd::zero();
+        }
+        else
+        {
+          const vector_type prev1         = utf8_simd::previous<1>(input, prev_input);
+          const vector_type special_cases = check_special_cases(input, prev1);
+
+          error           = utf8_simd::bit_or(error, check_multibyte_lengths(input, special_cases));
+          prev_incomplete = is_incomplete(input);
+        }
+
+        prev_input = input;
+      }
+
+      //***********************************************************************
+      /// Returns true if no errors have been found and the last sequence is complete.
+      //***********************************************************************
+      bool is_valid() const
+      {
+        return !utf8_simd::any(utf8_simd::bit_or(error, prev_incomplete));
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Classifies each pair of bytes using the nibbles of the first byte and
+      /// the high nibble of the second.
+      //***********************************************************************
+      static vector_type check_special_cases(vector_type input, vector_type prev1)
+      {
+        typedef utf8_error e;
+
+        const vector_type byte_1_high_table = utf8_simd::table(e::Too_Long, e::Too_Long, e::Too_Long, e::Too_Long,
+                                                               e::Too_Long, e::Too_Long, e::Too_Long, e::Too_Long,
+                                                               e::Two_Conts, e::Two_Conts, e::Two_Conts, e::Two_Conts,
+                                                               e::Too_Short | e::Overlong_2,
+                                                               e::Too_Short,
+                                                               e::Too_Short | e::Overlong_3 | e::Surrogate,
+                                                               e::Too_Short | e::Too_Large | e::Too_Large_1000 | e::Overlong_4);
+
+        const vector_type byte_1_low_table = utf8_simd::table(e::Carry | e::Overlong_3 | e::Overlong_2 | e::Overlong_4,
+                                                              e::Carry | e::Overlong_2,
+                                                              e::Carry,
+                                                              e::Carry,
+                                                              e::Carry | e::Too_Large,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000 | e::Surrogate,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000,
+                                                              e::Carry | e::Too_Large | e::Too_Large_1000);
+
+        const vector_type byte_2_high_table = utf8_simd::table(e::Too_Short, e::Too_Short, e::Too_Short, e::Too_Short,
+                                                               e::Too_Short, e::Too_Short, e::Too_Short, e::Too_Short,
+                                                               e::Too_Long | e::Overlong_2 | e::Two_Conts | e::Overlong_3 | e::Too_Large_1000 | e::Overlong_4,
+                                                               e::Too_Long | e::Overlong_2 | e::Two_Conts | e::Overlong_3 | e::Too_Large,
+                                                               e::Too_Long | e::Overlong_2 | e::Two_Conts | e::Surrogate  | e::Too_Large,
+                                                               e::Too_Long | e::Overlong_2 | e::Two_Conts | e::Surrogate  | e::Too_Large,
+                                                               e::Too_Short, e::Too_Short, e::Too_Short, e::Too_Short);
+
+        const vector_type byte_1_high = utf8_simd::lookup(byte_1_high_table, utf8_simd::high_nibbles(prev1));
+        const vector_type byte_1_low  = utf8_simd::lookup(byte_1_low_table,  utf8_simd::low_nibbles(prev1));
+        const vector_type byte_2_high = utf8_simd::lookup(byte_2_high_table, utf8_simd::high_nibbles(input));
+
+        return utf8_simd::bit_and(utf8_simd::bit_and(byte_1_high, byte_1_low), byte_2_high);
+      }
+
+      //***********************************************************************
+      /// The third and fourth bytes of three and four byte sequences must be
+      /// continuations. These are exactly the places where two continuations
+      /// in a row are allowed.
+      //***********************************************************************
+      vector_type check_multibyte_lengths(vector_type input, vector_type special_cases) const
+      {
+        const vector_type prev2 = utf8_simd::previous<2>(input, prev_input);
+        const vector_type prev3 = utf8_simd::previous<3>(input, prev_input);
+
+        // Only bytes >= 0xE0 and >= 0xF0 respectively keep their top bit.
+        const vector_type is_third_byte  = utf8_simd::saturating_sub(prev2, utf8_simd::splat(0xE0U - 0x80U));
+        const vector_type is_fourth_byte = utf8_simd::saturating_sub(prev3, utf8_simd::splat(0xF0U - 0x80U));
+
+        const vector_type must_be_2_3_continuation = utf8_simd::bit_and(utf8_simd::bit_or(is_third_byte, is_fourth_byte),
+                                                                        utf8_simd::splat(0x80U));
+
+        return utf8_simd::bit_xor(must_be_2_3_continuation, special_cases);
+      }
+
+      //***********************************************************************
+      /// Flags a sequence that starts in the last three bytes and needs more.
+      //***********************************************************************
+      static vector_type is_incomplete(vector_type input)
+      {
+        const vector_type max_value = utf8_simd::table(0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU,
+                                                       0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xFFU, 0xF0U - 1U, 0xE0U - 1U, 0xC0U - 1U);
+
+        return utf8_simd::saturating_sub(input, max_value);
+      }
+
+      vector_type error;
+      vector_type prev_input;
+      vector_type prev_incomplete;
+    };
+
+    //*************************************************************************
+    /// Returns true if the buffer is valid UTF-8.
+    /// A final partial vector is padded with zeros, which are ASCII.
+    //*************************************************************************
+    inline bool utf_simd_validate_utf8(const unsigned char* p, size_t length)
+    {
+      utf8_simd_validator validator;
+
+      size_t i = 0U;
+
+      while ((i + 16U) <= length)
+      {
+        validator.check(utf8_simd::load(p + i));
+        i += 16U;
+      }
+
+      if (i != length)
+      {
+        unsigned char tail[16] = { 0U };
+
+        memcpy(tail, p + i, length - i);
+        validator.check(utf8_simd::load(tail));
+      }
+
+      return validator.is_valid();
+    }
+#endif
+  }
+}
+
+#endif
+#endif
@@ -55,6 +55,15 @@ SOFTWARE.
     #error NOT SUPPORTED FOR C++03 OR BELOW
   #endif
 #else
+
+//*****************************************************************************
+/// The largest combined jump table used to visit several variants at once.
+/// Visits with more combinations of alternatives dispatch one variant at a time.
+//*****************************************************************************
+#if !defined(ETL_VARIANT_MAX_FLAT_VISIT_TABLE_SIZE)
+  #define ETL_VARIANT_MAX_FLAT_VISIT_TABLE_SIZE 256U
+#endif
+
 //*****************************************************************************
 ///\defgroup variant variant
 /// A class that can contain one a several specified types in a type safe manner.
@@ -312,6 +321,172 @@ namespace etl
   /// Definition of variant_npos.
   constexpr size_t variant_npos = etl::integral_limits<size_t>::max;
 
+  namespace private_variant
+  {
+    //***************************************************************************
+    /// Detects whether all of the types are trivially copyable and trivially
+    /// destructible.
+    //***************************************************************************
+    template <typename... TTypes>
+    struct is_trivial_variant
+#if defined(ETL_USER_DEFINED_TYPE_TRAITS) && !defined(ETL_USE_TYPE_TRAITS_BUILTINS)
+      : etl::false_type
+#else
+      : etl::conjunction<etl::bool_constant<etl::is_trivially_copyable<TTypes>::value &&
+                                            etl::is_trivially_destructible<TTypes>::value>...>
+#endif
+    {
+    };
+
+    //***************************************************************************
+    /// The storage for a variant.
+    /// If all of the types are trivial then the compiler generated special
+    /// members are used, and the variant is itself trivially copyable.
+    //***************************************************************************
+    template <size_t Size, size_t Alignment, bool Is_Trivial>
+    class variant_storage;
+
+    //***************************************************************************
+    /// Storage for trivial types.
+    //***************************************************************************
+    template <size_t Size, size_t Alignment>
+    class variant_storage<Size, Alignment, true>
+    {
+    protected:
+
+      /// The operation function type.
+      using operation_function = void(*)(int, char*, const char*);
+
+      etl::uninitialized_buffer<Size, 1U, Alignment> data;
+      operation_function operation;
+      size_t type_id;
+    };
+
+    //***************************************************************************
+    /// Storage for non-trivial types.
+    /// The stored value is copied, moved and destroyed through 'operation'.
+    //***************************************************************************
+    template <size_t Size, size_t Alignment>
+    class variant_storage<Size, Alignment, false>
+    {
+    protected:
+
+      /// The operation function type.
+      using operation_function = void(*)(int, char*, const char*);
+
+      //*************************************
+      ETL_CONSTEXPR14 variant_storage()
+      {
+      }
+
+      //*************************************
+#include "diagnostic_uninitialized_push.h"
+      ETL_CONSTEXPR14 variant_storage(const variant_storage& other)
+        : operation(other.operation)
+        , type_id(other.type_id)
+      {
+        if (this != &other)
+        {
+          if (other.type_id == variant_npos)
+          {
+            type_id = variant_npos;
+          }
+          else
+          {
+            operation(private_variant::Copy, data, other.data);
+          }
+        }
+      }
+#include "diagnostic_pop.h"
+
+      //*************************************
+#include "diagnostic_uninitialized_push.h"
+      ETL_CONSTEXPR14 variant_storage(variant_storage&& other)
+        : operation(other.operation)
+        , type_id(other.type_id)
+      {
+        if (this != &other)
+        {
+          if (other.type_id == variant_npos)
+          {
+            type_id = variant_npos;
+          }
+          else
+          {
+            operation(private_variant::Move, data, other.data);
+          }
+        }
+        else
+        {
+          type_id = variant_npos;
+        }
+      }
+#include "diagnostic_pop.h"
+
+      //*************************************
+      ~variant_storage()
+      {
+        if (type_id != variant_npos)
+        {
+          operation(private_variant::Destroy, data, nullptr);
+        }
+
+        operation = operation_type<void, false, false>::do_operation; // Null operation.
+        type_id = variant_npos;
+      }
+
+      //*************************************
+      variant_storage& operator =(const variant_storage& other)
+      {
+        if (this != &other)
+        {
+          if (other.type_id == variant_npos)
+          {
+            type_id = variant_npos;
+          }
+          else
+          {
+            operation(private_variant::Destroy, data, nullptr);
+
+            operation = other.operation;
+            operation(private_variant::Copy, data, other.data);
+
+            type_id = other.type_id;
+          }
+        }
+
+        return *this;
+      }
+
+      //*************************************
+      variant_storage& operator =(variant_storage&& other)
+      {
+        if (this != &other)
+        {
+          if (other.type_id == variant_npos)
+          {
+            type_id = variant_npos;
+          }
+          else
+          {
+            operation(private_variant::Destroy, data, nullptr);
+
+            operation = other.operation;
+            operation(private_variant::Move, data, other.data);
+
+            type_id = other.type_id;
+          }
+        }
+
+        return *this;
+      }
+
+      etl::uninitialized_buffer<Size, 1U, Alignment> data;
+      operation_function operation;
+      size_t type_id;
+    };
+  }
+
   //***********************************
   // variant. Forward declaration
   template <typename... TTypes>
@@ -444,7 +619,9 @@ namespace etl
   ///\ingroup variant
   //***************************************************************************
   template <typename... TTypes>
-  class variant
+  class variant : private private_variant::variant_storage<sizeof(typename etl::largest_type<TTypes...>::type),
+                                                           etl::largest_alignment<TTypes...>::value,
+                                                           private_variant::is_trivial_variant<TTypes...>::value>
   {
   public:
 
@@ -541,9 +718,10 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, etl::enable_if_t<!etl::is_same<etl::remove_cvref_t<T>, variant>::value, int> = 0>
     ETL_CONSTEXPR14 variant(T&& value)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(etl::private_variant::parameter_pack<TTypes...>::template index_of_type<etl::remove_cvref_t<T>>::value)
     {
+      operation = operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation;
+      type_id   = etl::private_variant::parameter_pack<TTypes...>::template index_of_type<etl::remove_cvref_t<T>>::value;
+
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...>::value, "Unsupported type");
 
       construct_in_place<etl::remove_cvref_t<T>>(data, etl::forward<T>(value));
@@ -556,9 +734,10 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, typename... TArgs>
     ETL_CONSTEXPR14 explicit variant(etl::in_place_type_t<T>, TArgs&&... args)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(etl::private_variant::parameter_pack<TTypes...>::template index_of_type<etl::remove_cvref_t<T>>::value)
     {
+      operation = operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation;
+      type_id   = etl::private_variant::parameter_pack<TTypes...>::template index_of_type<etl::remove_cvref_t<T>>::value;
+
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...>::value, "Unsupported type");
 
       construct_in_place_args<etl::remove_cvref_t<T>>(data, etl::forward<TArgs>(args)...);
@@ -571,8 +750,9 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <size_t Index, typename... TArgs>
     ETL_CONSTEXPR14 explicit variant(etl::in_place_index_t<Index>, TArgs&&... args)
-      : type_id(Index)
     {
+      type_id = Index;
+
       using type = typename private_variant::parameter_pack<TTypes...>:: template type_from_index_t<Index>;
       static_assert(etl::is_one_of<type, TTypes...> ::value, "Unsupported type");
 
@@ -589,9 +769,10 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <typename T, typename U, typename... TArgs >
     ETL_CONSTEXPR14 explicit variant(etl::in_place_type_t<T>, std::initializer_list<U> init, TArgs&&... args)
-      : operation(operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation)
-      , type_id(private_variant::parameter_pack<TTypes...>:: template index_of_type<etl::remove_cvref_t<T>>::value)
     {
+      operation = operation_type<etl::remove_cvref_t<T>, etl::is_copy_constructible<etl::remove_cvref_t<T>>::value, etl::is_move_constructible<etl::remove_cvref_t<T>>::value>::do_operation;
+      type_id   = private_variant::parameter_pack<TTypes...>:: template index_of_type<etl::remove_cvref_t<T>>::value;
+
       static_assert(etl::is_one_of<etl::remove_cvref_t<T>, TTypes...> ::value, "Unsupported type");
 
       construct_in_place_args<etl::remove_cvref_t<T>>(data, init, etl::forward<TArgs>(args)...);
@@ -604,8 +785,9 @@ namespace etl
 #include "diagnostic_uninitialized_push.h"
     template <size_t Index, typename U, typename... TArgs >
     ETL_CONSTEXPR14 explicit variant(etl::in_place_index_t<Index>, std::initializer_list<U> init, TArgs&&... args)
-      : type_id(Index)
     {
+      type_id = Index;
+
       using type = typename private_variant::parameter_pack<TTypes...>:: template type_from_index_t<Index>;
       static_assert(etl::is_one_of<type, TTypes...> ::value, "Unsupported type");
 
@@ -620,65 +802,18 @@ namespace etl
     /// Copy constructor.
     ///\param other The other variant object to copy.
     //***************************************************************************
-#include "diagnostic_uninitialized_push.h"
-    ETL_CONSTEXPR14 variant(const variant& other)
-      : operation(other.operation)
-      , type_id(other.type_id)
-    {
-      if (this != &other)
-      {
-        if (other.index() == variant_npos)
-        {
-          type_id = variant_npos;
-        }
-        else
-        {
-          operation(private_variant::Copy, data, other.data);
-        }
-      }
-    }
-#include "diagnostic_pop.h"
+    variant(const variant& other) = default;
 
     //***************************************************************************
     /// Move constructor.
     ///\param other The other variant object to copy.
     //***************************************************************************
-#include "diagnostic_uninitialized_push.h"
-    ETL_CONSTEXPR14 variant(variant&& other)
-      : operation(other.operation)
-      , type_id(other.type_id)
-    {
-      if (this != &other)
-      {
-        if (other.index() == variant_npos)
-        {
-          type_id = variant_npos;
-        }
-        else
-        {
-          operation(private_variant::Move, data, other.data);
-        }
-      }
-      else
-      {
-        type_id = variant_npos;
-      }
-    }
-#include "diagnostic_pop.h"
+    variant(variant&& other) = default;
 
     //***************************************************************************
     /// Destructor.
     //***************************************************************************
-    ~variant()
-    {
-      if (index() != variant_npos)
-      {
-        operation(private_variant::Destroy, data, nullptr);
-      }
-
-      operation = operation_type<void, false, false>::do_operation; // Null operation.
-      type_id = variant_npos;
-    }
+    ~variant() = default;
 
     //***************************************************************************
     /// Emplace by type with variadic constructor parameters.
@@ -747,53 +882,13 @@ namespace etl
     /// Assignment operator for variant type.
     ///\param other The variant to assign.
     //***************************************************************************
-    variant& operator =(const variant& other)
-    {
-      if (this != &other)
-      {
-        if (other.index() == variant_npos)
-        {
-          type_id = variant_npos;
-        }
-        else
-        {
-          operation(Destroy, data, nullptr);
-
-          operation = other.operation;
-          operation(Copy, data, other.data);
-
-          type_id = other.type_id;
-        }
-      }
-
-      return *this;
-    }
+    variant& operator =(const variant& other) = default;
 
     //***************************************************************************
     /// Assignment operator for variant type.
     ///\param other The variant to assign.
     //***************************************************************************
-    variant& operator =(variant&& other)
-    {
-      if (this != &other)
-      {
-        if (other.index() == variant_npos)
-        {
-          type_id = variant_npos;
-        }
-        else
-        {
-          operation(Destroy, data, nullptr);
-
-          operation = other.operation;
-          operation(Move, data, other.data);
-
-          type_id = other.type_id;
-        }
-      }
-
-      return *this;
-    }
+    variant& operator =(variant&& other) = default;
 
     //***************************************************************************
     /// Checks whether a valid value is currently stored.
@@ -948,8 +1043,14 @@ namespace etl
 
   private:
 
-    /// The operation function type.
-    using operation_function = void(*)(int, char*, const char*);
+    using storage_type = private_variant::variant_storage<sizeof(typename etl::largest_type<TTypes...>::type),
+                                                          etl::largest_alignment<TTypes...>::value,
+                                                          private_variant::is_trivial_variant<TTypes...>::value>;
+
+    using typename storage_type::operation_function;
+    using storage_type::data;
+    using storage_type::operation;
+    using storage_type::type_id;
 
     //***************************************************************************
     /// Construct the type in-place. lvalue reference.
@@ -997,21 +1098,57 @@ namespace etl
 
 #if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevent visitor by attempting each one.
+    /// Call the relevent visitor through a jump table indexed by index().
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      (attempt_visitor<I>(visitor) || ...);
+      using function_pointer = void(*)(variant&, TVisitor&);
+
+      static constexpr function_pointer jmp_table[] = { &variant::template call_visitor<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
+      {
+        jmp_table[index()](*this, visitor);
+      }
     }
 
     //***************************************************************************
-    /// Call the relevent visitor by attempting each one.
+    /// Call the relevent visitor through a jump table indexed by index().
     //***************************************************************************
     template <typename TVisitor, size_t... I>
     void do_visitor(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      (attempt_visitor<I>(visitor) || ...);
+      using function_pointer = void(*)(const variant&, TVisitor&);
+
+      static constexpr function_pointer jmp_table[] = { &variant::template call_const_visitor<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
+      {
+        jmp_table[index()](*this, visitor);
+      }
+    }
+
+    //***************************************************************************
+    /// Call a visitor with the alternative at Index.
+    //***************************************************************************
+    template <size_t Index, typename TVisitor>
+    static void call_visitor(variant& self, TVisitor& visitor)
+    {
+      // Workaround for MSVC (2023/05/13)
+      // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
+      auto& v = etl::get<Index>(self);
+      visitor.visit(v);
+    }
+
+    //***************************************************************************
+    /// Call a visitor with the alternative at Index.
+    //***************************************************************************
+    template <size_t Index, typename TVisitor>
+    static void call_const_visitor(const variant& self, TVisitor& visitor)
+    {
+      auto& v = etl::get<Index>(self);
+      visitor.visit(v);
     }
 #else
     //***************************************************************************
@@ -1115,65 +1252,57 @@ namespace etl
     }
 #endif
 
+#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call the relevent visitor through a jump table indexed by index().
     //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor)
+    template <typename TVisitor, size_t... I>
+    void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistancy.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
+      using function_pointer = void(*)(variant&, TVisitor&);
+
+      static constexpr function_pointer jmp_table[] = { &variant::template call_operator<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
       {
-        return false;
+        jmp_table[index()](*this, visitor);
       }
     }
 
     //***************************************************************************
-    /// Attempt to call a visitor.
+    /// Call the relevent visitor through a jump table indexed by index().
     //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_visitor(TVisitor& visitor) const
+    template <typename TVisitor, size_t... I>
+    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
     {
-      if (Index == index())
-      {
-        // Workaround for MSVC (2023/05/13)
-        // It doesn't compile 'visitor.visit(etl::get<Index>(*this))' correctly for C++17 & C++20.
-        // Changed all of the instances for consistancy.
-        auto& v = etl::get<Index>(*this);
-        visitor.visit(v);
-        return true;
-      }
-      else
+      using function_pointer = void(*)(const variant&, TVisitor&);
+
+      static constexpr function_pointer jmp_table[] = { &variant::template call_const_operator<I, TVisitor>... };
+
+      if (index() < sizeof...(TTypes))
       {
-        return false;
+        jmp_table[index()](*this, visitor);
       }
     }
 
-#if ETL_USING_CPP17 && !defined(ETL_VARIANT_FORCE_CPP11)
     //***************************************************************************
-    /// Call the relevent visitor by attempting each one.
+    /// Call a functor with the alternative at Index.
     //***************************************************************************
-    template <typename TVisitor, size_t... I>
-    void do_operator(TVisitor& visitor, etl::index_sequence<I...>)
+    template <size_t Index, typename TVisitor>
+    static void call_operator(variant& self, TVisitor& visitor)
     {
-      (attempt_operator<I>(visitor) || ...);
+      auto& v = etl::get<Index>(self);
+      visitor(v);
     }
 
     //***************************************************************************
-    /// Call the relevent visitor by attempting each one.
+    /// Call a functor with the alternative at Index.
     //***************************************************************************
-    template <typename TVisitor, size_t... I>
-    void do_operator(TVisitor& visitor, etl::index_sequence<I...>) const
+    template <size_t Index, typename TVisitor>
+    static void call_const_operator(const variant& self, TVisitor& visitor)
     {
-      (attempt_operator<I>(visitor) || ...);
+      auto& v = etl::get<Index>(self);
+      visitor(v);
     }
 #else
     //***************************************************************************
@@ -1305,57 +1434,6 @@ namespace etl
     }
 #endif
 
-    //***************************************************************************
-    /// Attempt to call a visitor.
-    //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor)
-    {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-
-    //***************************************************************************
-    /// Attempt to call a visitor.
-    //***************************************************************************
-    template <size_t Index, typename TVisitor>
-    bool attempt_operator(TVisitor& visitor) const
-    {
-      if (Index == index())
-      {
-        auto& v = etl::get<Index>(*this);
-        visitor(v);
-        return true;
-      }
-      else
-      {
-        return false;
-      }
-    }
-
-    //***************************************************************************
-    /// The internal storage.
-    /// Aligned on a suitable boundary, which should be good for all types.
-    //***************************************************************************
-    etl::uninitialized_buffer<Size, 1U, Alignment> data;
-
-    //***************************************************************************
-    /// The operation function.
-    //***************************************************************************
-    operation_function operation;
-
-    //***************************************************************************
-    /// The id of the current stored type.
-    //***************************************************************************
-    size_t type_id;
   };
 
   //***************************************************************************
@@ -1767,6 +1845,151 @@ namespace etl
                                           static_cast<TNext&&>(next), static_cast<TVariants&&>(vs)...);
     }
 
+    //***************************************************************************
+    /// The number of combinations of alternatives of the variants.
+    //***************************************************************************
+    template <typename... TVariants>
+    struct variant_size_product;
+
+    template <>
+    struct variant_size_product<>
+    {
+      static constexpr size_t value = 1U;
+    };
+
+    template <typename TVariant, typename... TVariants>
+    struct variant_size_product<TVariant, TVariants...>
+    {
+      static constexpr size_t value = etl::variant_size<remove_reference_t<TVariant> >::value * variant_size_product<TVariants...>::value;
+    };
+
+    //***************************************************************************
+    /// Decodes a combined index into one alternative index per variant and
+    /// calls TCallable with those alternatives.
+    //***************************************************************************
+    template <typename TRet, size_t tFlat, typename TIndices, typename... TVariants>
+    struct flat_visit_invoker;
+
+    template <typename TRet, size_t tFlat, size_t... tIndices>
+    struct flat_visit_invoker<TRet, tFlat, index_sequence<tIndices...> >
+    {
+      template <typename TCallable, typename... TVs>
+      static constexpr TRet call(TCallable&& f, TVs&&... vs)
+      {
+        return static_cast<TCallable&&>(f)(etl::get<tIndices>(static_cast<TVs&&>(vs))...);
+      }
+    };
+
+    template <typename TRet, size_t tFlat, size_t... tIndices, typename TVariant, typename... TVariants>
+    struct flat_visit_invoker<TRet, tFlat, index_sequence<tIndices...>, TVariant, TVariants...>
+      : flat_visit_invoker<TRet,
+                           tFlat % variant_size_product<TVariants...>::value,
+                           index_sequence<tIndices..., tFlat / variant_size_product<TVariants...>::value>,
+                           TVariants...>
+    {
+    };
+
+    //***************************************************************************
+    /// Makes a call to TCallable using the alternatives encoded in tFlat.
+    /// Instantiated as function pointer in the `do_visit_flat` function.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, size_t tFlat, typename... TVariants>
+    constexpr TRet do_visit_flat_single(TCallable&& f, TVariants&&... vs)
+    {
+      return flat_visit_invoker<TRet, tFlat, index_sequence<>, TVariants...>::call(static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// Helper to instantiate the function pointers needed for the combined "jump table".
+    //***************************************************************************
+    template <typename TRet, typename TCallable, typename... TVariants>
+    struct do_visit_flat_helper
+    {
+      using function_pointer = add_pointer_t<TRet(TCallable&&, TVariants&&...)>;
+
+      template <size_t tFlat>
+      static constexpr function_pointer fptr() noexcept
+      {
+        return &do_visit_flat_single<TRet, TCallable, tFlat, TVariants...>;
+      }
+    };
+
+    //***************************************************************************
+    /// Combines the indexes of the variants into one jump table index.
+    //***************************************************************************
+    constexpr size_t flat_visit_index(size_t accumulator)
+    {
+      return accumulator;
+    }
+
+    template <typename TVariant, typename... TVariants>
+    constexpr size_t flat_visit_index(size_t accumulator, const TVariant& v, const TVariants&... vs)
+    {
+      return flat_visit_index((accumulator * etl::variant_size<TVariant>::value) + v.index(), vs...);
+    }
+
+    //***************************************************************************
+    /// Checks whether any of the variants are valueless.
+    //***************************************************************************
+    constexpr bool any_valueless_by_exception()
+    {
+      return false;
+    }
+
+    template <typename TVariant, typename... TVariants>
+    constexpr bool any_valueless_by_exception(const TVariant& v, const TVariants&... vs)
+    {
+      return v.valueless_by_exception() || any_valueless_by_exception(vs...);
+    }
+
+    //***************************************************************************
+    /// Dispatch all of the variants through one combined jump table.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, size_t... tFlat, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet do_visit_flat(TCallable&& f, index_sequence<tFlat...>, TVariants&&... vs)
+    {
+      ETL_ASSERT(!any_valueless_by_exception(vs...), ETL_ERROR(bad_variant_access));
+
+      using helper_t = do_visit_flat_helper<TRet, TCallable, TVariants...>;
+      using func_ptr = typename helper_t::function_pointer;
+
+      constexpr func_ptr jmp_table[]
+      {
+        helper_t::template fptr<tFlat>()...
+      };
+
+      return jmp_table[flat_visit_index(0U, vs...)](static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// Visit several variants through one combined jump table.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet visit_select(etl::integral_constant<bool, true>, TCallable&& f, TVariants&&... vs)
+    {
+      return private_variant::do_visit_flat<TRet>(static_cast<TCallable&&>(f),
+                                                  make_index_sequence<variant_size_product<TVariants...>::value>{},
+                                                  static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// Visit the variants one at a time.
+    //***************************************************************************
+    template <typename TRet, typename TCallable, typename... TVariants>
+    static ETL_CONSTEXPR14 TRet visit_select(etl::integral_constant<bool, false>, TCallable&& f, TVariants&&... vs)
+    {
+      return private_variant::visit<TRet>(static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+    }
+
+    //***************************************************************************
+    /// Multi-variant visits use a combined table if it is small enough.
+    //***************************************************************************
+    template <typename... TVariants>
+    struct use_flat_visit
+      : etl::integral_constant<bool, (sizeof...(TVariants) > 1U) && (variant_size_product<TVariants...>::value <= ETL_VARIANT_MAX_FLAT_VISIT_TABLE_SIZE)>
+    {
+    };
+
   }  // namespace private_variant
 
   //***************************************************************************
@@ -1776,7 +1999,9 @@ namespace etl
   template <typename TRet = private_variant::visit_auto_return, typename... TVariants, typename TCallable, typename TDeducedReturn = private_variant::visit_result_t<TRet, TCallable, TVariants...> >
   static ETL_CONSTEXPR14 TDeducedReturn visit(TCallable&& f, TVariants&&... vs)
   {
-    return private_variant::visit<TDeducedReturn>(static_cast<TCallable&&>(f), static_cast<TVariants&&>(vs)...);
+    return private_variant::visit_select<TDeducedReturn>(private_variant::use_flat_visit<TVariants...>(),
+                                                         static_cast<TCallable&&>(f),
+                                                         static_cast<TVariants&&>(vs)...);
   }
 }
 #endif
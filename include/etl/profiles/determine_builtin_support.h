@@ -96,6 +96,266 @@ SOFTWARE.
   #define ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE 0
 #endif
 
+//*************************************
+// Hardware CRC instructions.
+// CRC32C is provided by SSE4.2 and the ARMv8 CRC extension. CRC32 is only provided by the ARMv8 CRC extension.
+#if !defined(ETL_USING_BUILTIN_CRC32C)
+  #if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+    #define ETL_USING_BUILTIN_CRC32C 1
+  #elif defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_BUILTIN_CRC32C 1
+  #else
+    #define ETL_USING_BUILTIN_CRC32C 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CRC32)
+  #if defined(__ARM_FEATURE_CRC32) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_USING_BUILTIN_CRC32 1
+  #else
+    #define ETL_USING_BUILTIN_CRC32 0
+  #endif
+#endif
+
+//*************************************
+// Bit counting intrinsics.
+// These map to POPCNT/TZCNT on x86 and CNT/RBIT+CLZ on ARM where the target supports them.
+#if !defined(ETL_USING_BUILTIN_POPCOUNT)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_popcountll)
+      #define ETL_USING_BUILTIN_POPCOUNT 1
+    #endif
+  #elif defined(__GNUC__)
+    #define ETL_USING_BUILTIN_POPCOUNT 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CTZ)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_ctzll)
+      #define ETL_USING_BUILTIN_CTZ 1
+    #endif
+  #elif defined(__GNUC__)
+    #define ETL_USING_BUILTIN_CTZ 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CLZ)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_clzll)
+      #define ETL_USING_BUILTIN_CLZ 1
+    #endif
+  #elif defined(__GNUC__)
+    #define ETL_USING_BUILTIN_CLZ 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BSWAP)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_bswap16) && __has_builtin(__builtin_bswap64)
+      #define ETL_USING_BUILTIN_BSWAP 1
+    #endif
+  #elif defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)))
+    #define ETL_USING_BUILTIN_BSWAP 1
+  #endif
+#endif
+
+// Clang only.
+#if !defined(ETL_USING_BUILTIN_BITREVERSE)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_bitreverse64)
+      #define ETL_USING_BUILTIN_BITREVERSE 1
+    #endif
+  #endif
+#endif
+
+// The ACLE RBIT intrinsic, from ARMv6T2 and AArch64. It is not constexpr, so is only used at run time.
+#if !defined(ETL_USING_BUILTIN_RBIT)
+  #if defined(__ARM_ACLE) && (defined(__aarch64__) || (defined(__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB >= 2)))
+    #define ETL_USING_BUILTIN_RBIT 1
+  #endif
+#endif
+
+// The MSVC bit scan and byte swap intrinsics, and POPCNT where AVX implies it.
+// They are not constexpr, so are only used at run time.
+#if !defined(ETL_USING_MSVC_BIT_INTRINSICS)
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #define ETL_USING_MSVC_BIT_INTRINSICS 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_MSVC_BIT_INTRINSICS_64)
+  #if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_ARM64))
+    #define ETL_USING_MSVC_BIT_INTRINSICS_64 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_MSVC_POPCNT)
+  #if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_IX86) || defined(_M_X64)) && defined(__AVX__)
+    #define ETL_USING_MSVC_POPCNT 1
+  #endif
+#endif
+
+// BMI2 PDEP and PEXT. They are not constexpr, so are only used at run time.
+// They are microcoded, and slow, on AMD processors before Zen 3. Define ETL_USING_BUILTIN_BMI2 as 0 when targeting them.
+#if !defined(ETL_USING_BUILTIN_BMI2)
+  #if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+    #define ETL_USING_BUILTIN_BMI2 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BMI2_64)
+  #if defined(ETL_USING_BUILTIN_BMI2) && ETL_USING_BUILTIN_BMI2 && (defined(__x86_64__) || defined(_M_X64))
+    #define ETL_USING_BUILTIN_BMI2_64 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_POPCOUNT)
+  #define ETL_USING_BUILTIN_POPCOUNT 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CTZ)
+  #define ETL_USING_BUILTIN_CTZ 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_CLZ)
+  #define ETL_USING_BUILTIN_CLZ 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BMI2)
+  #define ETL_USING_BUILTIN_BMI2 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BMI2_64)
+  #define ETL_USING_BUILTIN_BMI2_64 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BSWAP)
+  #define ETL_USING_BUILTIN_BSWAP 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_BITREVERSE)
+  #define ETL_USING_BUILTIN_BITREVERSE 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_RBIT)
+  #define ETL_USING_BUILTIN_RBIT 0
+#endif
+
+#if !defined(ETL_USING_MSVC_BIT_INTRINSICS)
+  #define ETL_USING_MSVC_BIT_INTRINSICS 0
+#endif
+
+#if !defined(ETL_USING_MSVC_BIT_INTRINSICS_64)
+  #define ETL_USING_MSVC_BIT_INTRINSICS_64 0
+#endif
+
+#if !defined(ETL_USING_MSVC_POPCNT)
+  #define ETL_USING_MSVC_POPCNT 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+      #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+    #endif
+  #elif defined(_MSC_VER) && (_MSC_VER >= 1925)
+    #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 1
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED)
+  #define ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED 0
+#endif
+
+//*************************************
+// Type pack builtins.
+// These replace recursive template instantiation when indexing and searching type lists.
+#if !defined(ETL_USING_BUILTIN_TYPE_PACK_ELEMENT)
+  #if defined(__has_builtin)
+    #if __has_builtin(__type_pack_element)
+      #define ETL_USING_BUILTIN_TYPE_PACK_ELEMENT 1
+    #endif
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_SAME)
+  #if defined(__has_builtin)
+    #if __has_builtin(__is_same)
+      #define ETL_USING_BUILTIN_IS_SAME 1
+    #endif
+  #endif
+#endif
+
+#if !defined(ETL_USING_BUILTIN_TYPE_PACK_ELEMENT)
+  #define ETL_USING_BUILTIN_TYPE_PACK_ELEMENT 0
+#endif
+
+#if !defined(ETL_USING_BUILTIN_IS_SAME)
+  #define ETL_USING_BUILTIN_IS_SAME 0
+#endif
+
+//*************************************
+// Vector instruction sets.
+// Define any of these as 0 to stop ETL using that instruction set.
+#if !defined(ETL_USING_SIMD_AVX2)
+  #if defined(__AVX2__)
+    #define ETL_USING_SIMD_AVX2 1
+  #else
+    #define ETL_USING_SIMD_AVX2 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_SIMD_SSSE3)
+  #if defined(__SSSE3__) || defined(__AVX__)
+    #define ETL_USING_SIMD_SSSE3 1
+  #else
+    #define ETL_USING_SIMD_SSSE3 0
+  #endif
+#endif
+
+#if !defined(ETL_USING_SIMD_SSE2)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_USING_SIMD_SSE2 1
+  #else
+    #define ETL_USING_SIMD_SSE2 0
+  #endif
+#endif
+
+// The carry-less multiply of PCLMULQDQ, used to fold CRCs of any polynomial.
+// The folding also needs the SSSE3 byte shuffle.
+#if !defined(ETL_USING_SIMD_CLMUL)
+  #if defined(__PCLMUL__) && ETL_USING_SIMD_SSSE3
+    #define ETL_USING_SIMD_CLMUL 1
+  #else
+    #define ETL_USING_SIMD_CLMUL 0
+  #endif
+#endif
+
+#if ETL_USING_SIMD_CLMUL && !ETL_USING_SIMD_SSSE3
+  #error ETL_USING_SIMD_CLMUL requires ETL_USING_SIMD_SSSE3
+#endif
+
+// The NEON paths have not yet been built on an ARM toolchain, so they are
+// opt-in. Define ETL_USING_SIMD_NEON as 1 on a NEON target to use them.
+#if !defined(ETL_USING_SIMD_NEON)
+  #define ETL_USING_SIMD_NEON 0
+#endif
+
+#if ETL_USING_SIMD_NEON && !(defined(__ARM_NEON) || defined(__ARM_NEON__))
+  #error ETL_USING_SIMD_NEON requires a NEON target
+#endif
+
+// The packed and saturating instructions of the Cortex-M4/M7/M33 DSP extension.
+// Opt-in, like NEON, until built on an ARM toolchain.
+#if !defined(ETL_USING_SIMD_ARM_DSP)
+  #define ETL_USING_SIMD_ARM_DSP 0
+#endif
+
+#if ETL_USING_SIMD_ARM_DSP && !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+  #error ETL_USING_SIMD_ARM_DSP requires a target with the DSP extension
+#endif
+
 namespace etl
 {
   namespace traits
@@ -107,6 +367,26 @@ namespace etl
     static ETL_CONSTANT bool using_builtin_is_trivially_constructible = (ETL_USING_BUILTIN_IS_TRIVIALLY_CONSTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_destructible  = (ETL_USING_BUILTIN_IS_TRIVIALLY_DESTRUCTIBLE == 1);
     static ETL_CONSTANT bool using_builtin_is_trivially_copyable      = (ETL_USING_BUILTIN_IS_TRIVIALLY_COPYABLE == 1);
+    static ETL_CONSTANT bool using_builtin_crc32c                     = (ETL_USING_BUILTIN_CRC32C == 1);
+    static ETL_CONSTANT bool using_builtin_crc32                      = (ETL_USING_BUILTIN_CRC32 == 1);
+    static ETL_CONSTANT bool using_builtin_popcount                   = (ETL_USING_BUILTIN_POPCOUNT == 1);
+    static ETL_CONSTANT bool using_builtin_ctz                        = (ETL_USING_BUILTIN_CTZ == 1);
+    static ETL_CONSTANT bool using_builtin_clz                        = (ETL_USING_BUILTIN_CLZ == 1);
+    static ETL_CONSTANT bool using_builtin_bswap                      = (ETL_USING_BUILTIN_BSWAP == 1);
+    static ETL_CONSTANT bool using_builtin_bitreverse                 = (ETL_USING_BUILTIN_BITREVERSE == 1);
+    static ETL_CONSTANT bool using_builtin_rbit                       = (ETL_USING_BUILTIN_RBIT == 1);
+    static ETL_CONSTANT bool using_builtin_bmi2                       = (ETL_USING_BUILTIN_BMI2 == 1);
+    static ETL_CONSTANT bool using_msvc_bit_intrinsics                = (ETL_USING_MSVC_BIT_INTRINSICS == 1);
+    static ETL_CONSTANT bool using_msvc_popcnt                        = (ETL_USING_MSVC_POPCNT == 1);
+    static ETL_CONSTANT bool using_builtin_is_constant_evaluated      = (ETL_USING_BUILTIN_IS_CONSTANT_EVALUATED == 1);
+    static ETL_CONSTANT bool using_builtin_type_pack_element          = (ETL_USING_BUILTIN_TYPE_PACK_ELEMENT == 1);
+    static ETL_CONSTANT bool using_builtin_is_same                    = (ETL_USING_BUILTIN_IS_SAME == 1);
+    static ETL_CONSTANT bool using_simd_avx2                          = (ETL_USING_SIMD_AVX2 == 1);
+    static ETL_CONSTANT bool using_simd_ssse3                         = (ETL_USING_SIMD_SSSE3 == 1);
+    static ETL_CONSTANT bool using_simd_sse2                          = (ETL_USING_SIMD_SSE2 == 1);
+    static ETL_CONSTANT bool using_simd_clmul                         = (ETL_USING_SIMD_CLMUL == 1);
+    static ETL_CONSTANT bool using_simd_neon                          = (ETL_USING_SIMD_NEON == 1);
+    static ETL_CONSTANT bool using_simd_arm_dsp                       = (ETL_USING_SIMD_ARM_DSP == 1);
   }
 }
 
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/conditioning_simd.h"
 
 ////#include <math.h>
 #include <stdint.h>
@@ -75,8 +77,39 @@ namespace etl
       return p_quantizations[n_levels];
     }
 
+    //*****************************************************************
+    /// Quantizes a block of samples.
+    /// Processes the smaller of in.size() and out.size() samples.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*****************************************************************
+    void process(etl::span<const TInput> in, etl::span<TInput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      process(in.data(), out.data(), n, etl::integral_constant<bool, etl::is_same<TCompare, etl::less<TInput> >::value>());
+    }
+
   private:
 
+    //*****************************************************************
+    /// etl::less uses the block kernel.
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<bool, true>) const
+    {
+      etl::private_conditioning::block_kernel<TInput>::quantize(in, out, n, p_thresholds, p_quantizations, n_levels);
+    }
+
+    //*****************************************************************
+    /// Other comparisons are applied to each sample.
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<bool, false>) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        out[i] = operator ()(in[i]);
+      }
+    }
+
     const TInput* const p_thresholds;
     const TInput* const p_quantizations;
     const size_t   n_levels;
@@ -44,6 +44,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "check_policy.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -333,6 +334,44 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Adds a value to the queue, checked according to the policy tag
+    /// instead of ETL_CHECK_PUSH_POP.
+    ///\param value The value to push_back to the queue.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, const_reference value)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      }
+
+      ::new (&p_buffer[in]) T(value);
+      add_in();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Adds a value to the queue, checked according to the policy tag
+    /// instead of ETL_CHECK_PUSH_POP.
+    ///\param value The value to push_back to the queue.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, rvalue_reference value)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!full(), ETL_ERROR(queue_full));
+      }
+
+      ::new (&p_buffer[in]) T(etl::move(value));
+      add_in();
+    }
+#endif
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_FORCE_CPP03_IMPLEMENTATION)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -460,6 +499,23 @@ namespace etl
       del_out();
     }
 
+    //*************************************************************************
+    /// Removes the oldest value from the queue, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(!empty(), ETL_ERROR(queue_empty));
+      }
+
+      p_buffer[out].~T();
+      del_out();
+    }
+
     //*************************************************************************
     /// Gets the oldest value and removes it from the front of the queue.
     /// If asserts or exceptions are enabled, throws an etl::queue_empty if the queue is empty.
@@ -0,0 +1,631 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "static_assert.h"
+#include "utility.h"
+#include "placement_new.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base for all queue_mpmc_atomic.
+  /// The enqueue and dequeue positions are free running counters, each on its
+  /// own cache line. The position's low bits select the cell.
+  //***************************************************************************
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      size_type dequeue = dequeue_position.load(etl::memory_order_acquire);
+      size_type enqueue = enqueue_position.load(etl::memory_order_acquire);
+
+      size_type n = size_type(enqueue - dequeue);
+
+      // The positions are read at different moments, so may be briefly inconsistent.
+      return (n > MAX_SIZE) ? MAX_SIZE : n;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    /// The signed type used to compare a cell's sequence with a position.
+    typedef typename etl::make_signed<size_type>::type difference_type;
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : enqueue_position(0),
+        dequeue_position(0),
+        MAX_SIZE(max_size_)
+    {
+    }
+
+    char padding0[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+
+    etl::atomic<size_type> enqueue_position; ///< The position of the next push.
+
+    char padding1[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+
+    etl::atomic<size_type> dequeue_position; ///< The position of the next pop.
+
+    char padding2[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+
+    const size_type MAX_SIZE; ///< The maximum number of items in the queue. Always a power of two.
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  ///\brief This is the base for all queue_mpmc_atomic's that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and consumers,
+  /// without locks. Each cell has a sequence number that says whether it is ready to
+  /// be written or read for a particular position (D. Vyukov's bounded MPMC queue).
+  /// \tparam T The type of value that the queue_mpmc_atomic holds.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::queue_mpmc_atomic_base<MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef T&&                        rvalue_reference;///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+  protected:
+
+    typedef typename base_t::difference_type difference_type;
+
+    //*************************************************************************
+    /// A cell in the queue.
+    //*************************************************************************
+    struct cell
+    {
+      T* get()
+      {
+        return reinterpret_cast<T*>(&storage);
+      }
+
+      etl::atomic<size_type> sequence; ///< The position the cell is ready for.
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type storage;
+    };
+
+  public:
+
+    using base_t::enqueue_position;
+    using base_t::dequeue_position;
+    using base_t::MAX_SIZE;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(value);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Push a value to the queue.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(etl::move(value));
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(etl::forward<Args>(args)...);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    bool emplace()
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T();
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(value1);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(value1, value2);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(value1, value2, value3);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      size_type position;
+      cell* p_cell = begin_push(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        ::new (p_cell->get()) T(value1, value2, value3, value4);
+        end_push(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      size_type position;
+      cell* p_cell = begin_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_MPMC_ATOMIC_FORCE_CPP03_IMPLEMENTATION)
+        value = etl::move(*p_cell->get());
+#else
+        value = *p_cell->get();
+#endif
+        p_cell->get()->~T();
+        end_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    //*************************************************************************
+    bool pop()
+    {
+      size_type position;
+      cell* p_cell = begin_pop(position);
+
+      if (p_cell != ETL_NULLPTR)
+      {
+        p_cell->get()->~T();
+        end_pop(p_cell, position);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Items pushed concurrently may or may not be removed.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets each cell ready for the first push to it.
+    /// Called from the derived class once its cells have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i < MAX_SIZE; ++i)
+      {
+        p_cells[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Claims the cell for the next push.
+    /// Returns ETL_NULLPTR if the queue is full.
+    //*************************************************************************
+    cell* begin_push(size_type& position)
+    {
+      position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell* p_cell = &p_cells[position & (MAX_SIZE - 1)];
+
+        size_type       sequence   = p_cell->sequence.load(etl::memory_order_acquire);
+        difference_type difference = difference_type(size_type(sequence - position));
+
+        if (difference == 0)
+        {
+          // The cell is free for this position. Try to claim it.
+          if (enqueue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed, etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The cell still holds the value from the previous lap.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another producer claimed the position.
+          position = enqueue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Publishes the pushed value to the consumers.
+    //*************************************************************************
+    static void end_push(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(size_type(position + 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Claims the cell for the next pop.
+    /// Returns ETL_NULLPTR if the queue is empty.
+    //*************************************************************************
+    cell* begin_pop(size_type& position)
+    {
+      position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell* p_cell = &p_cells[position & (MAX_SIZE - 1)];
+
+        size_type       sequence   = p_cell->sequence.load(etl::memory_order_acquire);
+        difference_type difference = difference_type(size_type(sequence - size_type(position + 1)));
+
+        if (difference == 0)
+        {
+          // The cell has a value for this position. Try to claim it.
+          if (dequeue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed, etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The cell has not yet been written for this position.
+          return ETL_NULLPTR;
+        }
+        else
+        {
+          // Another consumer claimed the position.
+          position = dequeue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Releases the cell to the producers for the next lap.
+    //*************************************************************************
+    void end_pop(cell* p_cell, size_type position)
+    {
+      p_cell->sequence.store(size_type(position + MAX_SIZE), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&) ETL_DELETE;
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    iqueue_mpmc_atomic(iqueue_mpmc_atomic&&) = delete;
+    iqueue_mpmc_atomic& operator =(iqueue_mpmc_atomic&&) = delete;
+#endif
+
+    cell* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc
+  /// A fixed capacity, lock free, mpmc queue.
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// \tparam T            The type this queue should support.
+  /// \tparam SIZE         The maximum capacity of the queue. Must be a power of two.
+  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queue_mpmc_atomic : public etl::iqueue_mpmc_atomic<T, MEMORY_MODEL>
+  {
+  private:
+
+    typedef etl::iqueue_mpmc_atomic<T, MEMORY_MODEL> base_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT((SIZE != 0) && ((SIZE & (SIZE - 1)) == 0), "Size must be a power of two");
+
+    // The sequence numbers are compared as signed differences from the positions.
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 2)), "Size too large for memory model");
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(buffer, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    queue_mpmc_atomic(const queue_mpmc_atomic&) ETL_DELETE;
+    queue_mpmc_atomic& operator = (const queue_mpmc_atomic&) ETL_DELETE;
+
+#if ETL_USING_CPP11
+    queue_mpmc_atomic(queue_mpmc_atomic&&) = delete;
+    queue_mpmc_atomic& operator = (queue_mpmc_atomic&&) = delete;
+#endif
+
+    /// The cells used in the queue_mpmc_atomic.
+    typename base_t::cell buffer[MAX_SIZE];
+  };
+
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+
+#endif
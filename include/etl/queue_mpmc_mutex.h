@@ -127,9 +127,10 @@ namespace etl
   /// etl::iqueue_mpmc_mutex<int>& iQueue = myQueue;
   ///\endcode
   /// This queue supports concurrent access by one producer and one consumer.
-  /// \tparam T The type of value that the queue_mpmc_mutex holds.
+  /// \tparam T      The type of value that the queue_mpmc_mutex holds.
+  /// \tparam TMutex The lock type, such as etl::mutex, etl::spin_mutex, etl::ticket_mutex or etl::mcs_mutex.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TMutex = etl::mutex>
   class iqueue_mpmc_mutex : public queue_mpmc_mutex_base<MEMORY_MODEL>
   {
   private:
@@ -654,7 +655,7 @@ namespace etl
 
     T* p_buffer; ///< The internal buffer.
 
-    mutable etl::mutex access; ///< The object that locks/unlocks access.
+    mutable TMutex access; ///< The object that locks/unlocks access.
   };
 
   //***************************************************************************
@@ -664,13 +665,14 @@ namespace etl
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
   /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam TMutex       The lock type.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_mpmc_mutex : public etl::iqueue_mpmc_mutex<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, typename TMutex = etl::mutex>
+  class queue_mpmc_mutex : public etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TMutex>
   {
   private:
 
-    typedef etl::iqueue_mpmc_mutex<T, MEMORY_MODEL> base_t;
+    typedef etl::iqueue_mpmc_mutex<T, MEMORY_MODEL, TMutex> base_t;
 
   public:
 
@@ -710,8 +712,8 @@ namespace etl
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[MAX_SIZE];
   };
 
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>  
-  ETL_CONSTANT typename queue_mpmc_mutex<T, SIZE, MEMORY_MODEL>::size_type queue_mpmc_mutex<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL, typename TMutex>
+  ETL_CONSTANT typename queue_mpmc_mutex<T, SIZE, MEMORY_MODEL, TMutex>::size_type queue_mpmc_mutex<T, SIZE, MEMORY_MODEL, TMutex>::MAX_SIZE;
 }
 
 #endif
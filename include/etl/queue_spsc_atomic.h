@@ -39,6 +39,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -47,9 +48,162 @@ SOFTWARE.
 
 namespace etl
 {
-  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  namespace private_queue_spsc_atomic
+  {
+    //*************************************************************************
+    /// The read and write indices, laid out next to each other.
+    //*************************************************************************
+    template <typename TSize, bool CACHE_ALIGNED>
+    class indices
+    {
+    protected:
+
+      indices()
+        : write(0),
+          read(0)
+      {
+      }
+
+      //*************************************************************************
+      /// Is there space for another item?
+      /// Called from the 'push' thread.
+      //*************************************************************************
+      bool producer_has_space(TSize next_write_index)
+      {
+        return next_write_index != read.load(etl::memory_order_acquire);
+      }
+
+      //*************************************************************************
+      /// Is there an item to read?
+      /// Called from the 'pop' thread.
+      //*************************************************************************
+      bool consumer_has_data(TSize read_index)
+      {
+        return read_index != write.load(etl::memory_order_acquire);
+      }
+
+      //*************************************************************************
+      /// Gets the read index.
+      /// Called from the 'push' thread.
+      //*************************************************************************
+      TSize producer_load_read()
+      {
+        return read.load(etl::memory_order_acquire);
+      }
+
+      //*************************************************************************
+      /// Gets the write index.
+      /// Called from the 'pop' thread.
+      //*************************************************************************
+      TSize consumer_load_write()
+      {
+        return write.load(etl::memory_order_acquire);
+      }
+
+      etl::atomic<TSize> write; ///< Where to input new data.
+      etl::atomic<TSize> read;  ///< Where to get the oldest data.
+    };
+
+    //*************************************************************************
+    /// The read and write indices, each on its own cache line, along with a
+    /// copy of the other side's index.
+    /// The other side's index is only reloaded when the copy says the queue
+    /// is full (push) or empty (pop), so the indices' cache lines are not
+    /// passed between the cores on every operation.
+    //*************************************************************************
+    template <typename TSize>
+    class indices<TSize, true>
+    {
+    protected:
+
+      indices()
+        : write(0),
+          cached_read(0),
+          read(0),
+          cached_write(0)
+      {
+      }
+
+      //*************************************************************************
+      /// Is there space for another item?
+      /// Called from the 'push' thread.
+      //*************************************************************************
+      bool producer_has_space(TSize next_write_index)
+      {
+        if (next_write_index == cached_read)
+        {
+          cached_read = read.load(etl::memory_order_acquire);
+        }
+
+        return next_write_index != cached_read;
+      }
+
+      //*************************************************************************
+      /// Is there an item to read?
+      /// Called from the 'pop' thread.
+      //*************************************************************************
+      bool consumer_has_data(TSize read_index)
+      {
+        if (read_index == cached_write)
+        {
+          cached_write = write.load(etl::memory_order_acquire);
+        }
+
+        return read_index != cached_write;
+      }
+
+      //*************************************************************************
+      /// Gets the read index, and refreshes the copy.
+      /// Called from the 'push' thread.
+      //*************************************************************************
+      TSize producer_load_read()
+      {
+        cached_read = read.load(etl::memory_order_acquire);
+
+        return cached_read;
+      }
+
+      //*************************************************************************
+      /// Gets the write index, and refreshes the copy.
+      /// Called from the 'pop' thread.
+      //*************************************************************************
+      TSize consumer_load_write()
+      {
+        cached_write = write.load(etl::memory_order_acquire);
+
+        return cached_write;
+      }
+
+      char padding0[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+
+      // Written by the 'push' thread.
+      etl::atomic<TSize> write;       ///< Where to input new data.
+      TSize              cached_read; ///< The last value of 'read' seen by the 'push' thread.
+
+      char padding1[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+
+      // Written by the 'pop' thread.
+      etl::atomic<TSize> read;         ///< Where to get the oldest data.
+      TSize              cached_write; ///< The last value of 'write' seen by the 'pop' thread.
+
+      char padding2[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+    };
+  }
+
+  //***************************************************************************
+  /// The base for all queue_spsc_atomic.
+  /// \tparam MEMORY_MODEL  The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_ALIGNED If true, the read and write indices are padded to ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE
+  ///                       to stop the 'push' and 'pop' threads falsely sharing a cache line.
+  //***************************************************************************
+  template <size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, bool CACHE_ALIGNED = false>
   class queue_spsc_atomic_base
+    : public private_queue_spsc_atomic::indices<typename etl::size_type_lookup<MEMORY_MODEL>::type, CACHE_ALIGNED>
   {
+  private:
+
+    typedef private_queue_spsc_atomic::indices<typename etl::size_type_lookup<MEMORY_MODEL>::type, CACHE_ALIGNED> indices_t;
+
   public:
 
     /// The type used for determining the size of queue.
@@ -86,18 +240,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_acquire);
       size_type read_index = read.load(etl::memory_order_acquire);
 
-      size_type n;
-
-      if (write_index >= read_index)
-      {
-        n = write_index - read_index;
-      }
-      else
-      {
-        n = RESERVED - read_index + write_index;
-      }
-
-      return n;
+      return count_between(read_index, write_index);
     }
 
     //*************************************************************************
@@ -128,9 +271,7 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
-        read(0),
-        RESERVED(reserved_)
+      : RESERVED(reserved_)
     {
     }
 
@@ -149,9 +290,29 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
-    const size_type RESERVED;     ///< The maximum number of items in the queue.
+    //*************************************************************************
+    /// The number of items from the read index up to the write index.
+    //*************************************************************************
+    size_type count_between(size_type read_index, size_type write_index) const
+    {
+      size_type n;
+
+      if (write_index >= read_index)
+      {
+        n = write_index - read_index;
+      }
+      else
+      {
+        n = RESERVED - read_index + write_index;
+      }
+
+      return n;
+    }
+
+    using indices_t::write;
+    using indices_t::read;
+
+    const size_type RESERVED; ///< The maximum number of items in the queue.
 
   private:
 
@@ -182,12 +343,12 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_spsc_atomic holds.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, bool CACHE_ALIGNED = false>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL, CACHE_ALIGNED>
   {
   private:
 
-    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL> base_t;
+    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL, CACHE_ALIGNED> base_t;
 
   public:
 
@@ -203,6 +364,11 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::count_between;
+    using base_t::producer_has_space;
+    using base_t::consumer_has_data;
+    using base_t::producer_load_read;
+    using base_t::consumer_load_write;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -212,7 +378,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -234,7 +400,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::move(value));
 
@@ -259,7 +425,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(etl::forward<Args>(args)...);
 
@@ -281,7 +447,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T();
 
@@ -304,7 +470,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -327,7 +493,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -350,7 +516,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -373,7 +539,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (producer_has_space(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -387,6 +553,101 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    /// The new values are published with a single release.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(etl::span<const T> values)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type read_index  = producer_load_read();
+
+      size_type n = count_between(read_index, write_index);
+      n = ((RESERVED - 1) - n);
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+        ::new (&p_buffer[write_index]) T(values[i]);
+        write_index = get_next_index(write_index, RESERVED);
+      }
+
+      write.store(write_index, etl::memory_order_release);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    /// The freed space is published with a single release.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(etl::span<T> values)
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = consumer_load_write();
+
+      size_type n = count_between(read_index, write_index);
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        values[i] = etl::move(p_buffer[read_index]);
+#else
+        values[i] = p_buffer[read_index];
+#endif
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      read.store(read_index, etl::memory_order_release);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer. May be fewer than size() if the values wrap
+    /// around the end of the buffer.
+    /// Call commit_pop() to remove them once they have been used.
+    //*************************************************************************
+    etl::span<T> front_span()
+    {
+      size_type read_index  = read.load(etl::memory_order_relaxed);
+      size_type write_index = consumer_load_write();
+
+      size_type n = (write_index >= read_index) ? (write_index - read_index) : (RESERVED - read_index);
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// n must not be more than the number of values in the queue.
+    //*************************************************************************
+    void commit_pop(size_type n)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      read.store(read_index, etl::memory_order_release);
+    }
+
     //*************************************************************************
     /// Peek the next value in the queue without removing it.
     //*************************************************************************
@@ -394,7 +655,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -412,7 +673,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -440,7 +701,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (!consumer_has_data(read_index))
       {
         // Queue is empty
         return false;
@@ -519,14 +780,15 @@ namespace etl
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T            The type this queue should support.
   /// \tparam SIZE         The maximum capacity of the queue.
-  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam MEMORY_MODEL  The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_ALIGNED If true, the read and write indices are kept on separate cache lines.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, bool CACHE_ALIGNED = false>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL, CACHE_ALIGNED>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, CACHE_ALIGNED> base_t;
 
   public:
 
@@ -564,8 +826,8 @@ namespace etl
     typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type buffer[RESERVED_SIZE];
   };
 
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL>
-  ETL_CONSTANT typename queue_spsc_atomic<T, SIZE, MEMORY_MODEL>::size_type queue_spsc_atomic<T, SIZE, MEMORY_MODEL>::MAX_SIZE;
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL, bool CACHE_ALIGNED>
+  ETL_CONSTANT typename queue_spsc_atomic<T, SIZE, MEMORY_MODEL, CACHE_ALIGNED>::size_type queue_spsc_atomic<T, SIZE, MEMORY_MODEL, CACHE_ALIGNED>::MAX_SIZE;
 }
 
 #endif
@@ -38,6 +38,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -106,6 +107,40 @@ namespace etl
       return pop_implementation();
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for, from an ISR.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push_from_isr(etl::span<const T> values)
+    {
+      return push_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span, from an ISR.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop_from_isr(etl::span<T> values)
+    {
+      return pop_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Gets a view of the contiguous values at the front of the queue, from an ISR.
+    //*************************************************************************
+    etl::span<T> front_span_from_isr()
+    {
+      return front_span_implementation();
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue, from an ISR.
+    //*************************************************************************
+    void commit_pop_from_isr(size_type n)
+    {
+      commit_pop_implementation(n);
+    }
+
     //*************************************************************************
     /// Peek a value at the front of the queue from an ISR
     //*************************************************************************
@@ -435,6 +470,87 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    //*************************************************************************
+    size_type push_implementation(etl::span<const T> values)
+    {
+      size_type n = MAX_SIZE - current_size;
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+        ::new (&p_buffer[write_index]) T(values[i]);
+        write_index = get_next_index(write_index, MAX_SIZE);
+      }
+
+      current_size += n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    //*************************************************************************
+    size_type pop_implementation(etl::span<T> values)
+    {
+      size_type n = current_size;
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        values[i] = etl::move(p_buffer[read_index]);
+#else
+        values[i] = p_buffer[read_index];
+#endif
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, MAX_SIZE);
+      }
+
+      current_size -= n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer.
+    //*************************************************************************
+    etl::span<T> front_span_implementation()
+    {
+      size_type n = MAX_SIZE - read_index;
+
+      if (current_size < n)
+      {
+        n = current_size;
+      }
+
+      return etl::span<T>(p_buffer + read_index, n);
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    //*************************************************************************
+    void commit_pop_implementation(size_type n)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[read_index].~T();
+        read_index = get_next_index(read_index, MAX_SIZE);
+      }
+
+      current_size -= n;
+    }
+
     //*************************************************************************
     /// Calculate the next index.
     //*************************************************************************
@@ -629,6 +745,66 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(etl::span<const T> values)
+    {
+      TAccess::lock();
+
+      size_type result = this->push_implementation(values);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(etl::span<T> values)
+    {
+      TAccess::lock();
+
+      size_type result = this->pop_implementation(values);
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer. May be fewer than size() if the values wrap
+    /// around the end of the buffer.
+    /// Call commit_pop() to remove them once they have been used.
+    //*************************************************************************
+    etl::span<T> front_span()
+    {
+      TAccess::lock();
+
+      etl::span<T> result = this->front_span_implementation();
+
+      TAccess::unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// n must not be more than the number of values in the queue.
+    //*************************************************************************
+    void commit_pop(size_type n)
+    {
+      TAccess::lock();
+
+      this->commit_pop_implementation(n);
+
+      TAccess::unlock();
+    }
+
     //*************************************************************************
     /// Pop a value from the queue.
     //*************************************************************************
@@ -39,6 +39,7 @@ SOFTWARE.
 #include "function.h"
 #include "utility.h"
 #include "placement_new.h"
+#include "span.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -446,6 +447,105 @@ namespace etl
       return result;
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    /// Unlocked
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push_from_unlocked(etl::span<const T> values)
+    {
+      return push_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    ///\return The number of values pushed.
+    //*************************************************************************
+    size_type push(etl::span<const T> values)
+    {
+      lock();
+
+      size_type result = push_implementation(values);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    /// Unlocked
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop_from_unlocked(etl::span<T> values)
+    {
+      return pop_implementation(values);
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    ///\return The number of values popped.
+    //*************************************************************************
+    size_type pop(etl::span<T> values)
+    {
+      lock();
+
+      size_type result = pop_implementation(values);
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer.
+    /// Unlocked
+    //*************************************************************************
+    etl::span<T> front_span_from_unlocked()
+    {
+      return front_span_implementation();
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer. May be fewer than size() if the values wrap
+    /// around the end of the buffer.
+    /// Call commit_pop() to remove them once they have been used.
+    //*************************************************************************
+    etl::span<T> front_span()
+    {
+      lock();
+
+      etl::span<T> result = front_span_implementation();
+
+      unlock();
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// Unlocked
+    //*************************************************************************
+    void commit_pop_from_unlocked(size_type n)
+    {
+      commit_pop_implementation(n);
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// n must not be more than the number of values in the queue.
+    //*************************************************************************
+    void commit_pop(size_type n)
+    {
+      lock();
+
+      commit_pop_implementation(n);
+
+      unlock();
+    }
+
     //*************************************************************************
     /// Peek a value from the front of the queue.
     /// Unlocked
@@ -826,6 +926,91 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Push as many of the values as there is space for.
+    /// Unlocked
+    //*************************************************************************
+    size_type push_implementation(etl::span<const T> values)
+    {
+      size_type n = this->MAX_SIZE - this->current_size;
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+        ::new (&p_buffer[this->write_index]) T(values[i]);
+        this->write_index = this->get_next_index(this->write_index, this->MAX_SIZE);
+      }
+
+      this->current_size += n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Pop as many values as will fit in the span.
+    /// Unlocked
+    //*************************************************************************
+    size_type pop_implementation(etl::span<T> values)
+    {
+      size_type n = this->current_size;
+
+      if (values.size() < n)
+      {
+        n = size_type(values.size());
+      }
+
+      for (size_type i = 0; i < n; ++i)
+      {
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_QUEUE_LOCKABLE_FORCE_CPP03_IMPLEMENTATION)
+        values[i] = etl::move(p_buffer[this->read_index]);
+#else
+        values[i] = p_buffer[this->read_index];
+#endif
+        p_buffer[this->read_index].~T();
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+      }
+
+      this->current_size -= n;
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the values at the front of the queue that are
+    /// contiguous in the buffer.
+    /// Unlocked
+    //*************************************************************************
+    etl::span<T> front_span_implementation()
+    {
+      size_type n = this->MAX_SIZE - this->read_index;
+
+      if (this->current_size < n)
+      {
+        n = this->current_size;
+      }
+
+      return etl::span<T>(p_buffer + this->read_index, n);
+    }
+
+    //*************************************************************************
+    /// Removes n values from the front of the queue.
+    /// Unlocked
+    //*************************************************************************
+    void commit_pop_implementation(size_type n)
+    {
+      for (size_type i = 0; i < n; ++i)
+      {
+        p_buffer[this->read_index].~T();
+        this->read_index = this->get_next_index(this->read_index, this->MAX_SIZE);
+      }
+
+      this->current_size -= n;
+    }
+
     // Disable copy construction and assignment.
     iqueue_spsc_locked(const iqueue_spsc_locked&) ETL_DELETE;
     iqueue_spsc_locked& operator =(const iqueue_spsc_locked&) ETL_DELETE;
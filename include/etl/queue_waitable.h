@@ -0,0 +1,362 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUE_WAITABLE_INCLUDED
+#define ETL_QUEUE_WAITABLE_INCLUDED
+
+#include "platform.h"
+#include "wait_event.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_WAIT_EVENT
+
+//*****************************************************************************
+/// The number of times a blocking call retries before the caller sleeps.
+//*****************************************************************************
+#if !defined(ETL_QUEUE_WAITABLE_SPIN_COUNT)
+  #define ETL_QUEUE_WAITABLE_SPIN_COUNT 64
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue
+  /// Adds blocking push and pop to a lockable queue.
+  /// The calls spin for a while, then sleep on an etl::wait_event until the
+  /// other side signals that the queue has changed.
+  /// Hot consumers stay low latency, while idle ones do not burn the CPU.
+  ///\code
+  /// class MyQueue : public etl::queue_lockable<int, 16>
+  /// {
+  ///   void lock() const ETL_OVERRIDE;
+  ///   void unlock() const ETL_OVERRIDE;
+  /// };
+  ///
+  /// etl::queue_waitable<MyQueue> queue;
+  ///
+  /// int value;
+  /// queue.pop_wait(value); // Sleeps until a value is pushed.
+  ///\endcode
+  /// Only push, emplace, pop and clear called through this class notify the
+  /// waiters. The _unlocked and _from_isr variants of the underlying queue do not.
+  /// \tparam TQueue      The queue type. Must be complete with its lock implemented.
+  /// \tparam VSpin_Count The number of retries before sleeping.
+  //***************************************************************************
+  template <typename TQueue, size_t VSpin_Count = ETL_QUEUE_WAITABLE_SPIN_COUNT>
+  class queue_waitable : public TQueue
+  {
+  public:
+
+    typedef TQueue                            queue_type;
+    typedef typename TQueue::value_type       value_type;       ///< The type stored in the queue.
+    typedef typename TQueue::reference        reference;        ///< A reference to the type used in the queue.
+    typedef typename TQueue::const_reference  const_reference;  ///< A const reference to the type used in the queue.
+#if ETL_USING_CPP11
+    typedef typename TQueue::rvalue_reference rvalue_reference; ///< An rvalue reference to the type used in the queue.
+#endif
+    typedef typename TQueue::size_type        size_type;        ///< The type used for determining the size of the queue.
+
+    static ETL_CONSTANT size_t Spin_Count = VSpin_Count;
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Constructor.
+    /// Arguments are passed on to the queue.
+    //*************************************************************************
+    template <typename... TArgs>
+    explicit queue_waitable(TArgs&&... args)
+      : TQueue(etl::forward<TArgs>(args)...)
+    {
+    }
+#else
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    queue_waitable()
+      : TQueue()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Arguments are passed on to the queue.
+    //*************************************************************************
+    template <typename T1>
+    explicit queue_waitable(const T1& arg1)
+      : TQueue(arg1)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Arguments are passed on to the queue.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    queue_waitable(const T1& arg1, const T2& arg2)
+      : TQueue(arg1, arg2)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// Arguments are passed on to the queue.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    queue_waitable(const T1& arg1, const T2& arg2, const T3& arg3)
+      : TQueue(arg1, arg2, arg3)
+    {
+    }
+#endif
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    bool push(const_reference value)
+    {
+      return pushed(TQueue::push(value));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    bool push(rvalue_reference value)
+    {
+      return pushed(TQueue::push(etl::move(value)));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    template <typename... Args>
+    bool emplace(Args&&... args)
+    {
+      return pushed(TQueue::emplace(etl::forward<Args>(args)...));
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    bool emplace()
+    {
+      return pushed(TQueue::emplace());
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      return pushed(TQueue::emplace(value1));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      return pushed(TQueue::emplace(value1, value2));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      return pushed(TQueue::emplace(value1, value2, value3));
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Wakes a waiting consumer.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      return pushed(TQueue::emplace(value1, value2, value3, value4));
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Wakes a waiting producer.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      return popped(TQueue::pop(value));
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    /// Wakes a waiting producer.
+    //*************************************************************************
+    bool pop()
+    {
+      return popped(TQueue::pop());
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Wakes all waiting producers.
+    //*************************************************************************
+    void clear()
+    {
+      TQueue::clear();
+      not_full.notify_all();
+    }
+
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is room.
+    //*************************************************************************
+    void push_wait(const_reference value)
+    {
+      for (size_t i = 0U; i < VSpin_Count; ++i)
+      {
+        if (push(value))
+        {
+          return;
+        }
+      }
+
+      while (true)
+      {
+        etl::wait_event::epoch_type epoch = not_full.prepare_wait();
+
+        if (push(value))
+        {
+          return;
+        }
+
+        not_full.wait(epoch);
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Push a value to the queue, waiting until there is room.
+    //*************************************************************************
+    void push_wait(rvalue_reference value)
+    {
+      // A failed push leaves the value untouched.
+      for (size_t i = 0U; i < VSpin_Count; ++i)
+      {
+        if (push(etl::move(value)))
+        {
+          return;
+        }
+      }
+
+      while (true)
+      {
+        etl::wait_event::epoch_type epoch = not_full.prepare_wait();
+
+        if (push(etl::move(value)))
+        {
+          return;
+        }
+
+        not_full.wait(epoch);
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue, waiting until there is one.
+    //*************************************************************************
+    void pop_wait(reference value)
+    {
+      for (size_t i = 0U; i < VSpin_Count; ++i)
+      {
+        if (pop(value))
+        {
+          return;
+        }
+      }
+
+      while (true)
+      {
+        etl::wait_event::epoch_type epoch = not_empty.prepare_wait();
+
+        if (pop(value))
+        {
+          return;
+        }
+
+        not_empty.wait(epoch);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    bool pushed(bool success)
+    {
+      if (success)
+      {
+        not_empty.notify_one();
+      }
+
+      return success;
+    }
+
+    //*************************************************************************
+    bool popped(bool success)
+    {
+      if (success)
+      {
+        not_full.notify_one();
+      }
+
+      return success;
+    }
+
+    etl::wait_event not_empty; ///< Signalled when a value is pushed.
+    etl::wait_event not_full;  ///< Signalled when a value is popped.
+  };
+
+  template <typename TQueue, size_t VSpin_Count>
+  ETL_CONSTANT size_t queue_waitable<TQueue, VSpin_Count>::Spin_Count;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,218 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_FSM_INCLUDED
+#define ETL_QUEUED_FSM_INCLUDED
+
+#include "platform.h"
+#include "fsm.h"
+#include "message_packet.h"
+#include "queue.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "utility.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_VIRTUAL_MESSAGES
+
+namespace etl
+{
+  //***************************************************************************
+  /// The event queue was full when a message was received.
+  //***************************************************************************
+  class queued_fsm_full : public etl::fsm_exception
+  {
+  public:
+
+    queued_fsm_full(string_type file_name_, numeric_type line_number_)
+      : etl::fsm_exception(ETL_ERROR_TEXT("queued fsm:full", ETL_QUEUED_FSM_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// An FSM or HFSM with run to completion event processing.
+  /// receive() copies the message into a fixed capacity queue of message
+  /// packets. process_events() dispatches the queued messages, one at a time,
+  /// each to completion. Messages sent to the FSM by its own handlers are
+  /// queued behind the current one, rather than handled recursively.
+  /// Emits etl::unhandled_message_exception if the message is not one of the
+  /// packet's types, and etl::queued_fsm_full if the queue is full.
+  ///\tparam TFsm       etl::fsm or etl::hfsm.
+  ///\tparam TPacket    The etl::message_packet type that holds the messages.
+  ///\tparam Queue_Size The maximum number of queued messages.
+  //***************************************************************************
+  template <typename TFsm, typename TPacket, size_t Queue_Size>
+  class queued_fsm : public TFsm
+  {
+  private:
+
+    typedef etl::queue<TPacket, Queue_Size> queue_t;
+
+  public:
+
+    typedef TPacket                      packet_type;
+    typedef typename queue_t::size_type size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = size_type(Queue_Size);
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_fsm(etl::message_router_id_t id)
+      : TFsm(id)
+      , processing(false)
+    {
+    }
+
+    using TFsm::receive;
+
+    //*******************************************
+    /// Queues the message.
+    //*******************************************
+    void receive(const etl::imessage& message) ETL_OVERRIDE
+    {
+      if (!TPacket::accepts(message))
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::unhandled_message_exception));
+      }
+      else if (queue.full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::queued_fsm_full));
+      }
+      else
+      {
+        queue.emplace(message);
+      }
+    }
+
+    //*******************************************
+    /// Dispatches up to max_n queued messages.
+    /// Messages queued by the handlers are dispatched in the same call, if
+    /// max_n allows. Does nothing if called from a handler.
+    ///\return The number of messages dispatched.
+    //*******************************************
+    size_t process_events(size_t max_n = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      if (!processing)
+      {
+        processing = true;
+
+        while ((count < max_n) && !queue.empty())
+        {
+          // Take the message out of the queue first, so that the handlers
+          // may queue more messages or clear the queue.
+#if ETL_USING_CPP11
+          TPacket packet(etl::move(queue.front()));
+#else
+          TPacket packet(queue.front());
+#endif
+          queue.pop();
+
+          TFsm::receive(packet.get());
+          ++count;
+        }
+
+        processing = false;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Discards all of the queued messages.
+    //*******************************************
+    void clear_events()
+    {
+      queue.clear();
+    }
+
+    //*******************************************
+    /// Gets the number of queued messages.
+    //*******************************************
+    size_type queued_events() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    /// Checks if there are no queued messages.
+    //*******************************************
+    bool events_empty() const
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// Checks if the queue is full.
+    //*******************************************
+    bool events_full() const
+    {
+      return queue.full();
+    }
+
+    //*******************************************
+    /// Reset the FSM to pre-started state and discards the queued messages.
+    ///\param call_on_exit_state If true will call on_exit_state() for the current state. Default = false.
+    //*******************************************
+    void reset(bool call_on_exit_state = false) ETL_OVERRIDE
+    {
+      TFsm::reset(call_on_exit_state);
+      queue.clear();
+    }
+
+    using TFsm::accepts;
+
+    //*******************************************
+    /// Accepts the messages that the packet can hold.
+    //*******************************************
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return TPacket::accepts(id);
+    }
+
+  private:
+
+    queue_t queue;      ///< The queued messages.
+    bool    processing; ///< Set while process_events() is dispatching.
+  };
+
+  template <typename TFsm, typename TPacket, size_t Queue_Size>
+  ETL_CONSTANT typename etl::queued_fsm<TFsm, TPacket, Queue_Size>::size_type etl::queued_fsm<TFsm, TPacket, Queue_Size>::MAX_SIZE;
+}
+
+#endif
+
+#endif
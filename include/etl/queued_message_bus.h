@@ -0,0 +1,447 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_MESSAGE_BUS_INCLUDED
+#define ETL_QUEUED_MESSAGE_BUS_INCLUDED
+
+#include "platform.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "message_trace.h"
+#include "delegate.h"
+#include "atomic.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// What a queued_message_bus lane does with a message when it is full.
+  //***************************************************************************
+  struct lane_overflow_policy
+  {
+    enum enum_type
+    {
+      Drop,  ///< Discard the new message and count the drop.
+      Block  ///< Wait for space, calling the wait callback while waiting.
+    };
+  };
+
+  //***************************************************************************
+  /// A router that queues shared messages in priority lanes and passes them
+  /// on to a destination, usually an etl::imessage_bus, when process_queue()
+  /// is called.
+  /// Lane 0 has the highest priority. Each call to process_queue passes on the
+  /// messages of a lane only when all of the higher priority lanes are empty,
+  /// so a flood of low priority messages cannot delay a high priority one by
+  /// more than one delivery.
+  /// The lane for a message is chosen by the lane selector, by default the
+  /// lowest priority lane, or a message may be posted to a lane directly.
+  /// Each lane has a limit, up to the queue's capacity, and an overflow policy.
+  /// Messages that are not shared cannot be queued and are passed on to the
+  /// destination immediately.
+  /// The producers and the consumer may be on different threads, as allowed by
+  /// the queue type. Use etl::queue_spsc_atomic for a single producer, or
+  /// etl::queue_mpmc_mutex for several.
+  ///\tparam VLanes The number of priority lanes.
+  ///\tparam TQueue The queue of etl::shared_message used for each lane.
+  //***************************************************************************
+  template <size_t VLanes, typename TQueue>
+  class queued_message_bus : public etl::imessage_router
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VLanes > 0U, "There must be at least one lane");
+    ETL_STATIC_ASSERT((etl::is_same<typename TQueue::value_type, etl::shared_message>::value), "The lanes must be queues of etl::shared_message");
+
+    typedef TQueue                                    queue_type;
+    typedef typename queue_type::size_type            size_type;
+    typedef etl::delegate<size_t(etl::message_id_t)> lane_selector_type;
+    typedef etl::delegate<void(void)>                wait_callback_type;
+
+    static ETL_CONSTANT size_t    Lanes         = VLanes;
+    static ETL_CONSTANT size_type Lane_Capacity = queue_type::MAX_SIZE;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_bus(etl::message_router_id_t id_, etl::imessage_router& destination_)
+      : imessage_router(id_)
+      , p_destination(&destination_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_bus(etl::message_router_id_t id_, etl::imessage_router& destination_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+      , p_destination(&destination_)
+    {
+    }
+
+    //*******************************************
+    /// Sets the delegate that chooses the lane for each message id.
+    /// Lanes beyond the last are treated as the last.
+    //*******************************************
+    void set_lane_selector(const lane_selector_type& selector_)
+    {
+      lane_selector = selector_;
+    }
+
+    //*******************************************
+    /// Sets the delegate that is called while a producer waits for space
+    /// in a lane with the Block policy.
+    //*******************************************
+    void set_wait_callback(const wait_callback_type& wait_callback_)
+    {
+      wait_callback = wait_callback_;
+    }
+
+    //*******************************************
+    /// Sets the overflow policy of a lane.
+    //*******************************************
+    void set_lane_policy(size_t lane, etl::lane_overflow_policy::enum_type policy)
+    {
+      lanes[clamp_lane(lane)].policy = policy;
+    }
+
+    //*******************************************
+    /// Gets the overflow policy of a lane.
+    //*******************************************
+    etl::lane_overflow_policy::enum_type get_lane_policy(size_t lane) const
+    {
+      return lanes[clamp_lane(lane)].policy;
+    }
+
+    //*******************************************
+    /// Sets the maximum number of messages queued in a lane.
+    /// Limited to the capacity of the queue.
+    //*******************************************
+    void set_lane_limit(size_t lane, size_type limit)
+    {
+      lanes[clamp_lane(lane)].limit = (limit < Lane_Capacity) ? limit : Lane_Capacity;
+    }
+
+    //*******************************************
+    /// Gets the maximum number of messages queued in a lane.
+    //*******************************************
+    size_type get_lane_limit(size_t lane) const
+    {
+      return lanes[clamp_lane(lane)].limit;
+    }
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Passes a message that is not shared on to the destination immediately.
+    //*******************************************
+    void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      p_destination->receive(msg);
+    }
+
+    //*******************************************
+    /// Queues a shared message in the lane chosen by the lane selector.
+    //*******************************************
+    void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+      const size_t lane = lane_selector.is_valid() ? lane_selector(shared_msg.get_message().get_message_id()) : (Lanes - 1U);
+
+#if ETL_USING_CPP11
+      post(lane, etl::move(shared_msg));
+#else
+      post(lane, shared_msg);
+#endif
+    }
+
+    //*******************************************
+    /// Queues a shared message in a lane.
+    /// Lanes beyond the last are treated as the last.
+    ///\return <b>true</b> if the message was queued, <b>false</b> if it was dropped.
+    //*******************************************
+    bool post(size_t lane, etl::shared_message shared_msg)
+    {
+      lane_data& data = lanes[clamp_lane(lane)];
+
+#if ETL_HAS_MESSAGE_TRACE
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+#endif
+
+      while (data.queue.size() >= data.limit)
+      {
+        if (data.policy == etl::lane_overflow_policy::Drop)
+        {
+          data.drops.fetch_add(1U);
+          return false;
+        }
+
+        if (wait_callback.is_valid())
+        {
+          wait_callback();
+        }
+      }
+
+#if ETL_USING_CPP11
+      const bool ok = data.queue.push(etl::move(shared_msg));
+#else
+      const bool ok = data.queue.push(shared_msg);
+#endif
+
+      if (ok)
+      {
+        ETL_MESSAGE_TRACE_ENQUEUE(id, get_message_router_id());
+        update_high_water_mark(data);
+      }
+      else
+      {
+        // Another producer filled the lane.
+        data.drops.fetch_add(1U);
+      }
+
+      return ok;
+    }
+
+    //*******************************************
+    /// Passes up to max_n queued messages to the destination, highest
+    /// priority lane first.
+    /// Must be called from the consumer thread.
+    ///\return The number of messages passed on.
+    //*******************************************
+    size_t process_queue(size_t max_n = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      while (count < max_n)
+      {
+        size_t lane = 0U;
+
+        while ((lane < Lanes) && lanes[lane].queue.empty())
+        {
+          ++lane;
+        }
+
+        if (lane == Lanes)
+        {
+          break;
+        }
+
+        // Only the consumer removes messages, so the front stays valid until popped.
+        queue_type& queue = lanes[lane].queue;
+
+        {
+          ETL_MESSAGE_TRACE_SCOPE(queue.front().get_message().get_message_id(), p_destination->get_message_router_id());
+
+          p_destination->receive(queue.front());
+        }
+
+        queue.pop();
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Discards all of the queued messages.
+    /// Must be called from the consumer thread.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Lanes; ++i)
+      {
+        lanes[i].queue.clear();
+      }
+    }
+
+    //*******************************************
+    /// Accepts the messages that the destination accepts, or the successor.
+    //*******************************************
+    using etl::imessage_router::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return p_destination->accepts(id) || (has_successor() && get_successor().accepts(id));
+    }
+
+    //*******************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*******************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*******************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*******************************************
+    /// Gets the destination router.
+    //*******************************************
+    etl::imessage_router& get_destination() const
+    {
+      return *p_destination;
+    }
+
+    //*******************************************
+    /// The number of messages queued in all lanes.
+    //*******************************************
+    size_t size() const
+    {
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < Lanes; ++i)
+      {
+        n += lanes[i].queue.size();
+      }
+
+      return n;
+    }
+
+    //*******************************************
+    /// The number of messages queued in a lane.
+    //*******************************************
+    size_type size(size_t lane) const
+    {
+      return lanes[clamp_lane(lane)].queue.size();
+    }
+
+    //*******************************************
+    /// Are there no queued messages?
+    //*******************************************
+    bool empty() const
+    {
+      for (size_t i = 0U; i < Lanes; ++i)
+      {
+        if (!lanes[i].queue.empty())
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// The number of messages dropped by a lane.
+    //*******************************************
+    uint32_t drop_count(size_t lane) const
+    {
+      return lanes[clamp_lane(lane)].drops.load();
+    }
+
+    //*******************************************
+    /// The largest number of messages that have been queued in a lane.
+    //*******************************************
+    size_type high_water_mark(size_t lane) const
+    {
+      return lanes[clamp_lane(lane)].high_water.load();
+    }
+
+    //*******************************************
+    /// Resets the drop counts and high water marks.
+    //*******************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0U; i < Lanes; ++i)
+      {
+        lanes[i].drops.store(0U);
+        lanes[i].high_water.store(0U);
+      }
+    }
+
+  private:
+
+    //*******************************************
+    /// A priority lane.
+    //*******************************************
+    struct lane_data
+    {
+      lane_data()
+        : limit(Lane_Capacity)
+        , policy(etl::lane_overflow_policy::Drop)
+        , drops(0U)
+        , high_water(0U)
+      {
+      }
+
+      queue_type                           queue;
+      size_type                            limit;
+      etl::lane_overflow_policy::enum_type policy;
+      etl::atomic<uint32_t>                drops;
+      etl::atomic<size_type>               high_water;
+    };
+
+    //*******************************************
+    static size_t clamp_lane(size_t lane)
+    {
+      return (lane < Lanes) ? lane : (Lanes - 1U);
+    }
+
+    //*******************************************
+    static void update_high_water_mark(lane_data& data)
+    {
+      const size_type depth = data.queue.size();
+      size_type       high  = data.high_water.load();
+
+      while ((depth > high) && !data.high_water.compare_exchange_weak(high, depth))
+      {
+      }
+    }
+
+    etl::imessage_router* p_destination;
+    lane_selector_type    lane_selector;
+    wait_callback_type    wait_callback;
+    lane_data             lanes[Lanes];
+  };
+
+  template <size_t VLanes, typename TQueue>
+  ETL_CONSTANT size_t queued_message_bus<VLanes, TQueue>::Lanes;
+
+  template <size_t VLanes, typename TQueue>
+  ETL_CONSTANT typename queued_message_bus<VLanes, TQueue>::size_type queued_message_bus<VLanes, TQueue>::Lane_Capacity;
+}
+
+#endif
+#endif
@@ -0,0 +1,292 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_MESSAGE_ROUTER_INCLUDED
+#define ETL_QUEUED_MESSAGE_ROUTER_INCLUDED
+
+#include "platform.h"
+#include "message_router.h"
+#include "shared_message.h"
+#include "message_trace.h"
+#include "queue_spsc_atomic.h"
+#include "integral_limits.h"
+#include "memory_model.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "utility.h"
+#include "span.h"
+
+#include <stddef.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for queued message router
+  //***************************************************************************
+  class queued_message_router_exception : public etl::exception
+  {
+  public:
+
+    queued_message_router_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The queue was full when a message was received.
+  //***************************************************************************
+  class queued_message_router_full : public etl::queued_message_router_exception
+  {
+  public:
+
+    queued_message_router_full(string_type file_name_, numeric_type line_number_)
+      : queued_message_router_exception(ETL_ERROR_TEXT("queued message router:full", ETL_QUEUED_MESSAGE_ROUTER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A router that queues shared messages and passes them on to a destination
+  /// router when process_queue() is called.
+  /// Receiving from the producer and processing the queue may happen on
+  /// different threads. There may only be one producer thread.
+  /// Messages that are not shared cannot be queued and are passed on to the
+  /// destination immediately.
+  ///\tparam VQueue_Size  The maximum number of queued messages.
+  ///\tparam MEMORY_MODEL The memory model of the queue.
+  //***************************************************************************
+  template <size_t VQueue_Size, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  class queued_message_router : public etl::imessage_router
+  {
+  private:
+
+    typedef etl::queue_spsc_atomic<etl::shared_message, VQueue_Size, MEMORY_MODEL> queue_t;
+
+  public:
+
+    typedef typename queue_t::size_type size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = queue_t::MAX_SIZE;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_router(etl::message_router_id_t id_, etl::imessage_router& destination_)
+      : imessage_router(id_)
+      , p_destination(&destination_)
+    {
+    }
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_router(etl::message_router_id_t id_, etl::imessage_router& destination_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+      , p_destination(&destination_)
+    {
+    }
+
+    using etl::imessage_router::receive;
+
+    //*******************************************
+    /// Passes a message that is not shared on to the destination immediately.
+    //*******************************************
+    void receive(const etl::imessage& msg) ETL_OVERRIDE
+    {
+      p_destination->receive(msg);
+    }
+
+    //*******************************************
+    /// Queues a shared message.
+    /// Emits queued_message_router_full if the queue is full.
+    //*******************************************
+    void receive(etl::shared_message shared_msg) ETL_OVERRIDE
+    {
+#if ETL_HAS_MESSAGE_TRACE
+      const etl::message_id_t id = shared_msg.get_message().get_message_id();
+#endif
+
+#if ETL_USING_CPP11
+      const bool ok = queue.push(etl::move(shared_msg));
+#else
+      const bool ok = queue.push(shared_msg);
+#endif
+
+      if (ok)
+      {
+        ETL_MESSAGE_TRACE_ENQUEUE(id, get_message_router_id());
+      }
+      else
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(etl::queued_message_router_full));
+      }
+    }
+
+    //*******************************************
+    /// Passes up to max_n queued messages to the destination.
+    /// Must be called from the consumer thread.
+    ///\return The number of messages passed on.
+    //*******************************************
+    size_t process_queue(size_t max_n = etl::integral_limits<size_t>::max)
+    {
+      size_t count = 0U;
+
+      while (count < max_n)
+      {
+        // The messages that are contiguous in the queue are handled as one batch.
+        etl::span<etl::shared_message> batch = queue.front_span();
+
+        if (batch.empty())
+        {
+          break;
+        }
+
+        size_t n = batch.size();
+
+        if (n > (max_n - count))
+        {
+          n = max_n - count;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          ETL_MESSAGE_TRACE_SCOPE(batch[i].get_message().get_message_id(), p_destination->get_message_router_id());
+
+          p_destination->receive(batch[i]);
+        }
+
+        queue.commit_pop(size_type(n));
+        count += n;
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Discards all of the queued messages.
+    /// Must be called from the consumer thread.
+    //*******************************************
+    void clear()
+    {
+      queue.clear();
+    }
+
+    //*******************************************
+    /// Accepts the messages that the destination accepts, or the successor.
+    //*******************************************
+    using etl::imessage_router::accepts;
+
+    bool accepts(etl::message_id_t id) const ETL_OVERRIDE
+    {
+      return p_destination->accepts(id) || (has_successor() && get_successor().accepts(id));
+    }
+
+    //*******************************************
+    ETL_DEPRECATED bool is_null_router() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*******************************************
+    bool is_producer() const ETL_OVERRIDE
+    {
+      return false;
+    }
+
+    //*******************************************
+    bool is_consumer() const ETL_OVERRIDE
+    {
+      return true;
+    }
+
+    //*******************************************
+    /// Gets the destination router.
+    //*******************************************
+    etl::imessage_router& get_destination() const
+    {
+      return *p_destination;
+    }
+
+    //*******************************************
+    /// The number of queued messages.
+    //*******************************************
+    size_type size() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    /// Are there no queued messages?
+    //*******************************************
+    bool empty() const
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// Is the queue full?
+    //*******************************************
+    bool full() const
+    {
+      return queue.full();
+    }
+
+    //*******************************************
+    /// The number of messages that can still be queued.
+    //*******************************************
+    size_type available() const
+    {
+      return queue.available();
+    }
+
+    //*******************************************
+    /// The maximum number of queued messages.
+    //*******************************************
+    size_type capacity() const
+    {
+      return queue.capacity();
+    }
+
+  private:
+
+    etl::imessage_router* p_destination;
+    queue_t               queue;
+  };
+
+  template <size_t VQueue_Size, const size_t MEMORY_MODEL>
+  ETL_CONSTANT typename queued_message_router<VQueue_Size, MEMORY_MODEL>::size_type queued_message_router<VQueue_Size, MEMORY_MODEL>::MAX_SIZE;
+}
+
+#endif
+#endif
@@ -0,0 +1,730 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RADIX_HEAP_INCLUDED
+#define ETL_RADIX_HEAP_INCLUDED
+
+#include "platform.h"
+#include "memory.h"
+#include "utility.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "bit.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "debug_count.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup radix_heap radix_heap
+/// A fixed capacity min-priority queue for monotone unsigned integer keys,
+/// such as timestamps. Each key may not be less than the last key popped.
+/// Values are kept in buckets by the highest bit in which their key differs
+/// from the last popped key. A push is O(1) and a value moves to a lower bucket
+/// at most once per key bit, so a pop is amortised O(log C) for key range C.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the radix_heap.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_exception : public etl::exception
+  {
+  public:
+
+    radix_heap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the radix_heap.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_full : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_full(string_type file_name_, numeric_type line_number_)
+      : etl::radix_heap_exception(ETL_ERROR_TEXT("radix_heap:full", ETL_RADIX_HEAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the radix_heap.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_empty : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_empty(string_type file_name_, numeric_type line_number_)
+      : etl::radix_heap_exception(ETL_ERROR_TEXT("radix_heap:empty", ETL_RADIX_HEAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Key order exception for the radix_heap.
+  /// Emitted when a key is less than the last key popped.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  class radix_heap_key_order : public etl::radix_heap_exception
+  {
+  public:
+
+    radix_heap_key_order(string_type file_name_, numeric_type line_number_)
+      : etl::radix_heap_exception(ETL_ERROR_TEXT("radix_heap:key order", ETL_RADIX_HEAP_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The base class for all radix_heaps.
+  /// Values with equal keys are popped in the order that they were pushed.
+  ///\tparam TKey The unsigned integral key type.
+  ///\tparam T    The type of value that the heap holds.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  template <typename TKey, typename T>
+  class iradix_heap
+  {
+    ETL_STATIC_ASSERT(etl::is_unsigned<TKey>::value, "radix_heap key must be an unsigned integral type");
+
+  public:
+
+    typedef TKey      key_type;
+    typedef T         value_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef size_t    size_type;
+
+    /// One bucket for keys equal to the last popped key and one per key bit.
+    static ETL_CONSTANT size_t Number_Of_Buckets = etl::integral_limits<TKey>::bits + 1U;
+
+    //*************************************************************************
+    /// Gets a reference to the value with the lowest key.
+    //*************************************************************************
+    reference top()
+    {
+      return p_values[top_index];
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the value with the lowest key.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return p_values[top_index];
+    }
+
+    //*************************************************************************
+    /// Gets the lowest key.
+    //*************************************************************************
+    key_type top_key() const
+    {
+      return p_nodes[top_index].key;
+    }
+
+    //*************************************************************************
+    /// Gets the last key popped. A key that is pushed may not be less than this.
+    //*************************************************************************
+    key_type last_key() const
+    {
+      return last;
+    }
+
+    //*************************************************************************
+    /// Adds a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    void push(key_type key, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(value);
+      insert_free(key);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    void push(key_type key, rvalue_reference value)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(etl::move(value));
+      insert_free(key);
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_RADIX_HEAP_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(key_type key, Args && ... args)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(etl::forward<Args>(args)...);
+      insert_free(key);
+    }
+#else
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    template <typename T1>
+    void emplace(key_type key, const T1& value1)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(value1);
+      insert_free(key);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    void emplace(key_type key, const T1& value1, const T2& value2)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(value1, value2);
+      insert_free(key);
+    }
+
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_full if the heap is full
+    /// or radix_heap_key_order if the key is less than the last key popped.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    void emplace(key_type key, const T1& value1, const T2& value2, const T3& value3)
+    {
+      ETL_ASSERT_OR_RETURN(!full(), ETL_ERROR(radix_heap_full));
+      ETL_ASSERT_OR_RETURN(key >= last, ETL_ERROR(radix_heap_key_order));
+
+      ::new (p_values + free_head) T(value1, value2, value3);
+      insert_free(key);
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the value with the lowest key.
+    /// If asserts or exceptions are enabled, emits radix_heap_empty if the heap is empty.
+    //*************************************************************************
+    void pop()
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(radix_heap_empty));
+
+      if (p_buckets[0].head == Npos)
+      {
+        // The lowest key becomes the last key, and its bucket is spread over the lower ones.
+        const size_type bucket = bucket_of(p_nodes[top_index].key);
+
+        last = p_nodes[top_index].key;
+        redistribute(bucket);
+      }
+
+      // The first value in bucket 0 is the top.
+      const size_type index = p_buckets[0].head;
+
+      p_buckets[0].head = p_nodes[index].next;
+
+      if (p_buckets[0].head == Npos)
+      {
+        p_buckets[0].tail = Npos;
+      }
+
+      p_values[index].~T();
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      p_nodes[index].next = free_head;
+      free_head = index;
+      --current_size;
+
+      find_top();
+    }
+
+    //*************************************************************************
+    /// Gets the value with the lowest key, assigns it to destination and removes
+    /// it from the heap.
+    /// If asserts or exceptions are enabled, emits radix_heap_empty if the heap is empty.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      ETL_ASSERT_OR_RETURN(!empty(), ETL_ERROR(radix_heap_empty));
+
+      destination = ETL_MOVE(top());
+      pop();
+    }
+
+    //*************************************************************************
+    /// Returns the number of values in the heap.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the heap.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values in the heap.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == CAPACITY;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return CAPACITY - current_size;
+    }
+
+    //*************************************************************************
+    /// Removes all of the values and resets the last key to zero.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        for (size_type bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+        {
+          for (size_type index = p_buckets[bucket].head; index != Npos; index = p_nodes[index].next)
+          {
+            p_values[index].~T();
+          }
+        }
+      }
+
+      initialise();
+    }
+
+  protected:
+
+    static ETL_CONSTANT size_type Npos = ~size_type(0U);
+
+    //*************************************************************************
+    /// An entry in a bucket list or the free list.
+    //*************************************************************************
+    struct node_t
+    {
+      key_type  key;
+      size_type next;
+    };
+
+    //*************************************************************************
+    /// A list of nodes with keys in the same bucket, in the order pushed.
+    //*************************************************************************
+    struct bucket_t
+    {
+      size_type head;
+      size_type tail;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    iradix_heap(T* p_values_, node_t* p_nodes_, bucket_t* p_buckets_, size_type capacity_)
+      : p_values(p_values_)
+      , p_nodes(p_nodes_)
+      , p_buckets(p_buckets_)
+      , CAPACITY(capacity_)
+      , current_size(0U)
+      , free_head(0U)
+      , top_index(Npos)
+      , last(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Initialises the heap to the empty state.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0U; i < CAPACITY; ++i)
+      {
+        p_nodes[i].next = i + 1U;
+      }
+
+      p_nodes[CAPACITY - 1U].next = Npos;
+
+      for (size_type bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        p_buckets[bucket].head = Npos;
+        p_buckets[bucket].tail = Npos;
+      }
+
+      current_size = 0U;
+      free_head    = 0U;
+      top_index    = Npos;
+      last         = 0U;
+      ETL_RESET_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Copies the values of another heap, in popping order.
+    //*************************************************************************
+    void copy_from(const iradix_heap& other)
+    {
+      clear();
+      last = other.last;
+
+      for (size_type bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        for (size_type index = other.p_buckets[bucket].head; index != Npos; index = other.p_nodes[index].next)
+        {
+          ::new (p_values + free_head) T(other.p_values[index]);
+          insert_free(other.p_nodes[index].key);
+        }
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the values of another heap, in popping order.
+    //*************************************************************************
+    void move_from(iradix_heap& other)
+    {
+      clear();
+      last = other.last;
+
+      for (size_type bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        for (size_type index = other.p_buckets[bucket].head; index != Npos; index = other.p_nodes[index].next)
+        {
+          ::new (p_values + free_head) T(etl::move(other.p_values[index]));
+          insert_free(other.p_nodes[index].key);
+        }
+      }
+
+      other.clear();
+    }
+#endif
+
+  private:
+
+    //*************************************************************************
+    /// Gets the bucket for a key, relative to the last popped key.
+    //*************************************************************************
+    size_type bucket_of(key_type key) const
+    {
+      const key_type difference = key ^ last;
+      const size_type bucket    = etl::bit_width(difference);
+
+      return bucket;
+    }
+
+    //*************************************************************************
+    /// Appends a node to the tail of a bucket list.
+    //*************************************************************************
+    void append(size_type bucket, size_type index)
+    {
+      p_nodes[index].next = Npos;
+
+      if (p_buckets[bucket].tail == Npos)
+      {
+        p_buckets[bucket].head = index;
+      }
+      else
+      {
+        p_nodes[p_buckets[bucket].tail].next = index;
+      }
+
+      p_buckets[bucket].tail = index;
+    }
+
+    //*************************************************************************
+    /// Adds the value just constructed in the first free slot.
+    //*************************************************************************
+    void insert_free(key_type key)
+    {
+      const size_type index = free_head;
+
+      free_head = p_nodes[index].next;
+
+      p_nodes[index].key = key;
+      append(bucket_of(key), index);
+
+      // Equal keys leave the earlier value at the top.
+      if ((top_index == Npos) || (key < p_nodes[top_index].key))
+      {
+        top_index = index;
+      }
+
+      ++current_size;
+      ETL_INCREMENT_DEBUG_COUNT;
+    }
+
+    //*************************************************************************
+    /// Moves every node in a bucket to the bucket for its key relative to the new last key.
+    /// Every node moves to a lower bucket and the relative order of equal keys is kept.
+    //*************************************************************************
+    void redistribute(size_type bucket)
+    {
+      size_type index = p_buckets[bucket].head;
+
+      p_buckets[bucket].head = Npos;
+      p_buckets[bucket].tail = Npos;
+
+      while (index != Npos)
+      {
+        const size_type next = p_nodes[index].next;
+
+        append(bucket_of(p_nodes[index].key), index);
+        index = next;
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the value with the lowest key, which is in the lowest non-empty bucket.
+    //*************************************************************************
+    void find_top()
+    {
+      top_index = Npos;
+
+      for (size_type bucket = 0U; bucket < Number_Of_Buckets; ++bucket)
+      {
+        size_type index = p_buckets[bucket].head;
+
+        if (index != Npos)
+        {
+          top_index = index;
+
+          // Every key in bucket 0 is equal to the last key.
+          if (bucket != 0U)
+          {
+            for (index = p_nodes[index].next; index != Npos; index = p_nodes[index].next)
+            {
+              if (p_nodes[index].key < p_nodes[top_index].key)
+              {
+                top_index = index;
+              }
+            }
+          }
+
+          return;
+        }
+      }
+    }
+
+    // Disable copy construction and assignment.
+    iradix_heap(const iradix_heap&) ETL_DELETE;
+    iradix_heap& operator =(const iradix_heap&) ETL_DELETE;
+
+    T* const        p_values;
+    node_t* const   p_nodes;
+    bucket_t* const p_buckets;
+    const size_type CAPACITY;
+    size_type       current_size;
+    size_type       free_head;
+    size_type       top_index;
+    key_type        last;
+
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_RADIX_HEAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iradix_heap()
+    {
+    }
+#else
+  protected:
+    ~iradix_heap()
+    {
+    }
+#endif
+  };
+
+  template <typename TKey, typename T>
+  ETL_CONSTANT size_t iradix_heap<TKey, T>::Number_Of_Buckets;
+
+  template <typename TKey, typename T>
+  ETL_CONSTANT typename iradix_heap<TKey, T>::size_type iradix_heap<TKey, T>::Npos;
+
+  //***************************************************************************
+  /// A radix_heap with the capacity defined at compile time.
+  ///\code
+  /// etl::radix_heap<uint32_t, Event, 32> events;
+  /// events.push(now + delay, event);
+  /// while (!events.empty() && (events.top_key() <= now)) { dispatch(events.top()); events.pop(); }
+  ///\endcode
+  ///\tparam TKey      The unsigned integral key type.
+  ///\tparam T         The type of value that the heap holds.
+  ///\tparam MAX_SIZE_ The maximum number of values.
+  ///\ingroup radix_heap
+  //***************************************************************************
+  template <typename TKey, typename T, const size_t MAX_SIZE_>
+  class radix_heap : public etl::iradix_heap<TKey, T>
+  {
+  public:
+
+    typedef etl::iradix_heap<TKey, T> base_t;
+
+    static ETL_CONSTANT size_t MAX_SIZE = MAX_SIZE_;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity radix_heap is not valid");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    radix_heap()
+      : base_t(values.begin(), nodes, buckets, MAX_SIZE)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    radix_heap(const radix_heap& other)
+      : base_t(values.begin(), nodes, buckets, MAX_SIZE)
+    {
+      this->initialise();
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    radix_heap(radix_heap&& other)
+      : base_t(values.begin(), nodes, buckets, MAX_SIZE)
+    {
+      this->initialise();
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~radix_heap()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    radix_heap& operator =(const radix_heap& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    radix_heap& operator =(radix_heap&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, MAX_SIZE_>  values;
+    typename base_t::node_t                     nodes[MAX_SIZE_];
+    typename base_t::bucket_t                   buckets[base_t::Number_Of_Buckets];
+  };
+
+  template <typename TKey, typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t radix_heap<TKey, T, MAX_SIZE_>::MAX_SIZE;
+}
+
+#endif
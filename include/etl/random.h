@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include "platform.h"
 #include "binary.h"
+#include "span.h"
 
 #include <stdint.h>
 
@@ -53,6 +54,18 @@ namespace etl
     virtual void initialise(uint32_t seed) = 0;
     virtual uint32_t operator()() = 0;
     virtual uint32_t range(uint32_t low, uint32_t high) = 0;
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Overridden by the generators with a loop that is not virtual.
+    //***************************************************************************
+    virtual void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = operator()();
+      }
+    }
   };
 #else
   //***************************************************************************
@@ -117,9 +130,10 @@ namespace etl
       }
 
       //***************************************************************************
-      /// Get the next random_xorshift number.
+      /// Get the next random number.
+      /// Not virtual, for use where the generator type is known.
       //***************************************************************************
-      uint32_t operator()()
+      uint32_t next()
       {
         uint32_t n = state[3];
         n ^= n << 11U;
@@ -134,13 +148,33 @@ namespace etl
         return n;
       }
 
+      //***************************************************************************
+      /// Get the next random number.
+      //***************************************************************************
+      uint32_t operator()()
+      {
+        return next();
+      }
+
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      ///\param values The span to fill.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = next();
+        }
+      }
+
       //***************************************************************************
       /// Get the next random_xorshift number in a specified inclusive range.
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
         uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
+        uint32_t n = next();
         n %= r;
         n += low;
 
@@ -194,22 +228,43 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Get the next random_clcg number.
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
     //***************************************************************************
-    uint32_t operator()()
+    uint32_t next()
     {
       value = (a * value) % m;
 
       return value;
     }
 
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = next();
+      }
+    }
+
     //***************************************************************************
     /// Get the next random_clcg number in a specified inclusive range.
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
       uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
+      uint32_t n = next();
       n %= r;
       n += low;
 
@@ -267,9 +322,10 @@ namespace etl
       }
 
       //***************************************************************************
-      /// Get the next random_clcg number.
+      /// Get the next random number.
+      /// Not virtual, for use where the generator type is known.
       //***************************************************************************
-      uint32_t operator()()
+      uint32_t next()
       {
         static ETL_CONSTANT uint32_t m = ((m1 > m2) ? m1 : m2);
 
@@ -279,13 +335,33 @@ namespace etl
         return (value1 + value2) % m;
       }
 
+      //***************************************************************************
+      /// Get the next random number.
+      //***************************************************************************
+      uint32_t operator()()
+      {
+        return next();
+      }
+
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      ///\param values The span to fill.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = next();
+        }
+      }
+
       //***************************************************************************
       /// Get the next random_clcg number in a specified inclusive range.
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
         uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
+        uint32_t n = next();
         n %= r;
         n += low;
 
@@ -346,9 +422,10 @@ namespace etl
       }
 
       //***************************************************************************
-      /// Get the next random_lsfr number.
+      /// Get the next random number.
+      /// Not virtual, for use where the generator type is known.
       //***************************************************************************
-      uint32_t operator()()
+      uint32_t next()
       {
         static ETL_CONSTANT uint32_t polynomial = 0x80200003UL;
 
@@ -362,13 +439,33 @@ namespace etl
         return value;
       }
 
+      //***************************************************************************
+      /// Get the next random number.
+      //***************************************************************************
+      uint32_t operator()()
+      {
+        return next();
+      }
+
+      //***************************************************************************
+      /// Fills a span with random numbers.
+      ///\param values The span to fill.
+      //***************************************************************************
+      void fill(etl::span<uint32_t> values)
+      {
+        for (size_t i = 0U; i < values.size(); ++i)
+        {
+          values[i] = next();
+        }
+      }
+
       //***************************************************************************
       /// Get the next random_lsfr number in a specified inclusive range.
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
         uint32_t r = high - low + 1UL;
-        uint32_t n = operator()();
+        uint32_t n = next();
         n %= r;
         n += low;
 
@@ -421,9 +518,10 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Get the next random_lsfr number.
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
     //***************************************************************************
-    uint32_t operator()()
+    uint32_t next()
     {
       value1 = 36969UL * (value1 & 0xFFFFUL) + (value1 >> 16U);
       value2 = 18000UL * (value2 & 0xFFFFUL) + (value2 >> 16U);
@@ -431,13 +529,33 @@ namespace etl
       return (value1 << 16U) + value2;
     }
 
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = next();
+      }
+    }
+
     //***************************************************************************
     /// Get the next random_lsfr number in a specified inclusive range.
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
       uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
+      uint32_t n = next();
       n %= r;
       n += low;
 
@@ -489,9 +607,10 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Get the next random_lsfr number.
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
     //***************************************************************************
-    uint32_t operator()()
+    uint32_t next()
     {
       uint64_t x = value;
       unsigned count = (unsigned)(value >> 59U);
@@ -501,13 +620,33 @@ namespace etl
       return etl::rotate_right((uint32_t)(x >> 27U), count);
     }
 
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = next();
+      }
+    }
+
     //***************************************************************************
     /// Get the next random_lsfr number in a specified inclusive range.
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
       uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
+      uint32_t n = next();
       n %= r;
       n += low;
 
@@ -521,6 +660,392 @@ namespace etl
 
     uint64_t value;
   };
+
+  //***************************************************************************
+  /// A 32 bit random number generator.
+  /// Uses the SplitMix64 generator, returning the upper 32 bits of each value.
+  /// Each value is a function of the seed and its position alone, so the
+  /// sequence can be jumped and fills have no dependency between values.
+  /// https://prng.di.unimi.it/splitmix64.c
+  //***************************************************************************
+  class random_splitmix64 : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_splitmix64()
+    {
+#include "etl/private/diagnostic_useless_cast_push.h"
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      state = static_cast<uint64_t>(n);
+#include "etl/private/diagnostic_pop.h"
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_splitmix64(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      state = seed;
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new 64 bit seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise64(uint64_t seed)
+    {
+      state = seed;
+    }
+
+    //***************************************************************************
+    /// Get the next 64 bit random number.
+    //***************************************************************************
+    uint64_t next64()
+    {
+      state += gamma;
+
+      return mix(state);
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
+    //***************************************************************************
+    uint32_t next()
+    {
+      return static_cast<uint32_t>(next64() >> 32U);
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// Each value is calculated from its position, so the loop may be vectorised.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      const uint64_t base = state;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = static_cast<uint32_t>(mix(base + ((i + uint64_t(1U)) * gamma)) >> 32U);
+      }
+
+      state = base + (gamma * values.size());
+    }
+
+    //***************************************************************************
+    /// Fills a span with 64 bit random numbers.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint64_t> values)
+    {
+      const uint64_t base = state;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = mix(base + ((i + uint64_t(1U)) * gamma));
+      }
+
+      state = base + (gamma * values.size());
+    }
+
+    //***************************************************************************
+    /// Skips the next n values.
+    //***************************************************************************
+    void discard(uint64_t n)
+    {
+      state += n * gamma;
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      uint32_t r = high - low + 1UL;
+      uint32_t n = next();
+      n %= r;
+      n += low;
+
+      return n;
+    }
+
+  private:
+
+    //***************************************************************************
+    static uint64_t mix(uint64_t z)
+    {
+      z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+
+      return z ^ (z >> 31U);
+    }
+
+    static ETL_CONSTANT uint64_t gamma = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t state;
+  };
+
+  //***************************************************************************
+  /// A 32 bit counter based random number generator.
+  /// Uses Philox4x32-10, which encrypts a 128 bit counter with a 64 bit key,
+  /// giving four values per counter.
+  /// The counter holds the position in the lower 64 bits and a stream
+  /// number in the upper 64 bits, so that independent, reproducible streams
+  /// can be given to each thread, and any stream can be jumped.
+  /// Salmon et al, "Parallel Random Numbers: As Easy as 1, 2, 3", SC11.
+  //***************************************************************************
+  class random_philox : public random
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_philox()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_philox(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value and stream.
+    ///\param seed   The new seed value.
+    ///\param stream The stream number.
+    //***************************************************************************
+    random_philox(uint32_t seed, uint64_t stream)
+    {
+      initialise(seed, stream);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value, in stream 0.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      initialise(seed, 0U);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value and stream.
+    ///\param seed   The new seed value.
+    ///\param stream The stream number.
+    //***************************************************************************
+    void initialise(uint32_t seed, uint64_t stream)
+    {
+      key[0] = seed;
+      key[1] = 0U;
+
+      counter[0] = 0U;
+      counter[1] = 0U;
+      counter[2] = static_cast<uint32_t>(stream);
+      counter[3] = static_cast<uint32_t>(stream >> 32U);
+
+      index = 4U;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
+    //***************************************************************************
+    uint32_t next()
+    {
+      if (index == 4U)
+      {
+        generate_block(position(), output);
+        advance(1U);
+        index = 0U;
+      }
+
+      return output[index++];
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    /// The blocks are independent, so the loop may be vectorised.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      size_t i = 0U;
+
+      // Use up any buffered values.
+      while ((index < 4U) && (i < values.size()))
+      {
+        values[i++] = output[index++];
+      }
+
+      const uint64_t base   = position();
+      const size_t   blocks = (values.size() - i) / 4U;
+
+      for (size_t b = 0U; b < blocks; ++b)
+      {
+        generate_block(base + b, &values[i + (4U * b)]);
+      }
+
+      advance(blocks);
+      i += 4U * blocks;
+
+      while (i < values.size())
+      {
+        values[i++] = next();
+      }
+    }
+
+    //***************************************************************************
+    /// Skips the next n values.
+    //***************************************************************************
+    void discard(uint64_t n)
+    {
+      // Use up the buffered values first.
+      while ((index < 4U) && (n != 0U))
+      {
+        ++index;
+        --n;
+      }
+
+      advance(n / 4U);
+
+      // Skip into the next block.
+      for (n %= 4U; n != 0U; --n)
+      {
+        next();
+      }
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      uint32_t r = high - low + 1UL;
+      uint32_t n = next();
+      n %= r;
+      n += low;
+
+      return n;
+    }
+
+    //***************************************************************************
+    /// Encrypts a 128 bit counter with a key.
+    /// The stateless Philox4x32-10 function.
+    //***************************************************************************
+    static void generate(const uint32_t (&ctr)[4], const uint32_t (&k)[2], uint32_t (&result)[4])
+    {
+      uint32_t c0 = ctr[0];
+      uint32_t c1 = ctr[1];
+      uint32_t c2 = ctr[2];
+      uint32_t c3 = ctr[3];
+      uint32_t k0 = k[0];
+      uint32_t k1 = k[1];
+
+      for (int round = 0; round < 10; ++round)
+      {
+        const uint64_t p0 = 0xD2511F53ULL * c0;
+        const uint64_t p1 = 0xCD9E8D57ULL * c2;
+
+        const uint32_t n0 = static_cast<uint32_t>(p1 >> 32U) ^ c1 ^ k0;
+        const uint32_t n2 = static_cast<uint32_t>(p0 >> 32U) ^ c3 ^ k1;
+
+        c0 = n0;
+        c1 = static_cast<uint32_t>(p1);
+        c2 = n2;
+        c3 = static_cast<uint32_t>(p0);
+
+        k0 += 0x9E3779B9UL;
+        k1 += 0xBB67AE85UL;
+      }
+
+      result[0] = c0;
+      result[1] = c1;
+      result[2] = c2;
+      result[3] = c3;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// The block position in the stream.
+    //***************************************************************************
+    uint64_t position() const
+    {
+      return uint64_t(counter[0]) | (uint64_t(counter[1]) << 32U);
+    }
+
+    //***************************************************************************
+    void advance(uint64_t blocks)
+    {
+      const uint64_t next_position = position() + blocks;
+
+      counter[0] = static_cast<uint32_t>(next_position);
+      counter[1] = static_cast<uint32_t>(next_position >> 32U);
+    }
+
+    //***************************************************************************
+    void generate_block(uint64_t block, uint32_t* result) const
+    {
+      const uint32_t ctr[4] = { static_cast<uint32_t>(block), static_cast<uint32_t>(block >> 32U), counter[2], counter[3] };
+      uint32_t       block_output[4];
+
+      generate(ctr, key, block_output);
+
+      result[0] = block_output[0];
+      result[1] = block_output[1];
+      result[2] = block_output[2];
+      result[3] = block_output[3];
+    }
+
+    uint32_t key[2];
+    uint32_t counter[4];
+    uint32_t output[4];
+    size_t   index;
+  };
 #endif
 
 #if ETL_USING_8BIT_TYPES
@@ -561,22 +1086,43 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Get the next random_lsfr number.
+    /// Get the next random number.
+    /// Not virtual, for use where the generator type is known.
     //***************************************************************************
-    uint32_t operator()()
+    uint32_t next()
     {
       ++value;
       hash.add(value);
       return hash.value();
     }
 
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      return next();
+    }
+
+    //***************************************************************************
+    /// Fills a span with random numbers.
+    ///\param values The span to fill.
+    //***************************************************************************
+    void fill(etl::span<uint32_t> values)
+    {
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = next();
+      }
+    }
+
     //***************************************************************************
     /// Get the next random_lsfr number in a specified inclusive range.
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
       uint32_t r = high - low + 1UL;
-      uint32_t n = operator()();
+      uint32_t n = next();
       n %= r;
       n += low;
 
@@ -0,0 +1,595 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RATE_LIMITER_INCLUDED
+#define ETL_RATE_LIMITER_INCLUDED
+
+#include "platform.h"
+#include "memory.h"
+#include "functional.h"
+#include "hash.h"
+#include "integral_limits.h"
+#include "placement_new.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup rate_limiter rate_limiter
+/// Rate limiters that refill lazily from a timestamp, rather than on every tick.
+/// Timestamps are in the same 32 bit ticks as the timers, and may wrap.
+/// A limiter should be used at least once in every 2^32 ticks.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the rate limiters.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class rate_limiter_exception : public etl::exception
+  {
+  public:
+
+    rate_limiter_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the rate_limiter_table.
+  /// Raised when a new key arrives and every bucket is in use.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class rate_limiter_table_full : public etl::rate_limiter_exception
+  {
+  public:
+
+    rate_limiter_table_full(string_type file_name_, numeric_type line_number_)
+      : etl::rate_limiter_exception(ETL_ERROR_TEXT("rate_limiter_table:full", ETL_RATE_LIMITER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Token bucket.
+  /// Holds up to 'capacity' tokens, refilled at 'tokens_per_period' tokens
+  /// every 'period_ticks' ticks. Fractions of a token are kept between calls,
+  /// so any rational rate is exact.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class token_bucket
+  {
+  public:
+
+    typedef uint32_t tick_type;
+    typedef uint32_t size_type;
+
+    //*************************************************************************
+    /// Constructor. The bucket starts full.
+    ///\param capacity_          The maximum number of tokens, or burst size.
+    ///\param tokens_per_period_ The number of tokens added each period. Must not be zero.
+    ///\param period_ticks_      The length of the period in ticks. Must not be zero.
+    ///\param now                The current time.
+    //*************************************************************************
+    token_bucket(size_type capacity_, size_type tokens_per_period_, tick_type period_ticks_, tick_type now = 0U)
+      : maximum(uint64_t(capacity_) * period_ticks_)
+      , level(maximum)
+      , rate(tokens_per_period_)
+      , period(period_ticks_)
+      , last(now)
+    {
+    }
+
+    //*************************************************************************
+    /// Takes 'count' tokens, if they are available.
+    ///\return <b>true</b> if the tokens were taken.
+    //*************************************************************************
+    bool try_consume(tick_type now, size_type count = 1U)
+    {
+      refill(now);
+
+      const uint64_t needed = uint64_t(count) * period;
+
+      if (needed > level)
+      {
+        return false;
+      }
+
+      level -= needed;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the number of whole tokens available.
+    //*************************************************************************
+    size_type available(tick_type now)
+    {
+      refill(now);
+
+      return size_type(level / period);
+    }
+
+    //*************************************************************************
+    /// Gets the number of ticks until 'count' tokens are available.
+    /// Returns the maximum tick_type if 'count' is more than the capacity.
+    //*************************************************************************
+    tick_type ticks_until_available(tick_type now, size_type count = 1U)
+    {
+      refill(now);
+
+      const uint64_t needed = uint64_t(count) * period;
+
+      if (needed > maximum)
+      {
+        return etl::integral_limits<tick_type>::max;
+      }
+
+      if (needed <= level)
+      {
+        return 0U;
+      }
+
+      return tick_type(((needed - level) + rate - 1U) / rate);
+    }
+
+    //*************************************************************************
+    /// Checks if the bucket is full, and so holds no history.
+    //*************************************************************************
+    bool is_idle(tick_type now)
+    {
+      refill(now);
+
+      return level == maximum;
+    }
+
+    //*************************************************************************
+    /// Refills the bucket.
+    //*************************************************************************
+    void reset(tick_type now)
+    {
+      level = maximum;
+      last  = now;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity of the bucket.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return size_type(maximum / period);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds the tokens for the time since the last call.
+    //*************************************************************************
+    void refill(tick_type now)
+    {
+      const tick_type elapsed = now - last;
+      last = now;
+
+      const uint64_t deficit = maximum - level;
+
+      // Compare the time, rather than the tokens, so that the product cannot overflow.
+      if (elapsed >= ((deficit + rate - 1U) / rate))
+      {
+        level = maximum;
+      }
+      else
+      {
+        level += uint64_t(elapsed) * rate;
+      }
+    }
+
+    uint64_t  maximum; ///< The capacity, in tokens * period.
+    uint64_t  level;   ///< The tokens held, in tokens * period.
+    size_type rate;    ///< The tokens added each period.
+    tick_type period;  ///< The ticks in a period.
+    tick_type last;    ///< The time of the last refill.
+  };
+
+  //***************************************************************************
+  /// Leaky bucket, used as a meter.
+  /// Each item adds 'ticks_per_item' to the bucket, which drains by one every
+  /// tick. An item conforms if the bucket can hold it, so at most 'capacity'
+  /// items are accepted back to back, and then one every 'ticks_per_item'.
+  /// Cheaper than the token_bucket, but the rate must be a whole number of
+  /// ticks per item.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  class leaky_bucket
+  {
+  public:
+
+    typedef uint32_t tick_type;
+    typedef uint32_t size_type;
+
+    //*************************************************************************
+    /// Constructor. The bucket starts empty.
+    ///\param capacity_       The maximum number of items held, or burst size.
+    ///\param ticks_per_item_ The ticks for one item to drain. Must not be zero.
+    ///\param now             The current time.
+    //*************************************************************************
+    leaky_bucket(size_type capacity_, tick_type ticks_per_item_, tick_type now = 0U)
+      : maximum(uint64_t(capacity_) * ticks_per_item_)
+      , level(0U)
+      , interval(ticks_per_item_)
+      , last(now)
+    {
+    }
+
+    //*************************************************************************
+    /// Adds 'count' items, if the bucket can hold them.
+    ///\return <b>true</b> if the items were accepted.
+    //*************************************************************************
+    bool try_consume(tick_type now, size_type count = 1U)
+    {
+      drain(now);
+
+      const uint64_t added = uint64_t(count) * interval;
+
+      if ((level + added) > maximum)
+      {
+        return false;
+      }
+
+      level += added;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the number of items that the bucket can accept now.
+    //*************************************************************************
+    size_type available(tick_type now)
+    {
+      drain(now);
+
+      return size_type((maximum - level) / interval);
+    }
+
+    //*************************************************************************
+    /// Gets the number of ticks until 'count' items can be accepted.
+    /// Returns the maximum tick_type if 'count' is more than the capacity.
+    //*************************************************************************
+    tick_type ticks_until_available(tick_type now, size_type count = 1U)
+    {
+      drain(now);
+
+      const uint64_t added = uint64_t(count) * interval;
+
+      if (added > maximum)
+      {
+        return etl::integral_limits<tick_type>::max;
+      }
+
+      if ((level + added) <= maximum)
+      {
+        return 0U;
+      }
+
+      return tick_type((level + added) - maximum);
+    }
+
+    //*************************************************************************
+    /// Checks if the bucket is empty, and so holds no history.
+    //*************************************************************************
+    bool is_idle(tick_type now)
+    {
+      drain(now);
+
+      return level == 0U;
+    }
+
+    //*************************************************************************
+    /// Empties the bucket.
+    //*************************************************************************
+    void reset(tick_type now)
+    {
+      level = 0U;
+      last  = now;
+    }
+
+    //*************************************************************************
+    /// Gets the capacity of the bucket.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return size_type(maximum / interval);
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Drains the bucket for the time since the last call.
+    //*************************************************************************
+    void drain(tick_type now)
+    {
+      const tick_type elapsed = now - last;
+      last = now;
+
+      level = (elapsed >= level) ? 0U : level - elapsed;
+    }
+
+    uint64_t  maximum;  ///< The capacity, in ticks.
+    uint64_t  level;    ///< The content, in ticks.
+    tick_type interval; ///< The ticks per item.
+    tick_type last;     ///< The time of the last drain.
+  };
+
+  //***************************************************************************
+  /// A fixed capacity table of rate limiters, one per key.
+  /// The buckets are held in an open addressed table with linear probing. Every
+  /// key's bucket is a copy of a prototype, created when the key is first seen.
+  /// A bucket that has become idle holds no history, so its slot is reused for
+  /// a new key when needed, and the table only fills if more than VSize keys
+  /// are active at once.
+  ///\tparam TKey    The key type, such as a destination id.
+  ///\tparam VSize   The number of buckets.
+  ///\tparam TBucket The bucket type. etl::token_bucket or etl::leaky_bucket.
+  ///\tparam THash   The hash for the key.
+  ///\tparam TKeyEqual The equality comparison for the key.
+  ///\ingroup rate_limiter
+  //***************************************************************************
+  template <typename TKey,
+            size_t VSize,
+            typename TBucket   = etl::token_bucket,
+            typename THash     = etl::hash<TKey>,
+            typename TKeyEqual = etl::equal_to<TKey> >
+  class rate_limiter_table
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VSize > 0U, "The table must have at least one bucket");
+
+    typedef TKey                         key_type;
+    typedef TBucket                      bucket_type;
+    typedef typename TBucket::tick_type  tick_type;
+    typedef typename TBucket::size_type  count_type;
+    typedef size_t                       size_type;
+
+    static ETL_CONSTANT size_t Size = VSize;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param prototype_ The bucket that is copied for each new key.
+    //*************************************************************************
+    explicit rate_limiter_table(const bucket_type& prototype_)
+      : prototype(prototype_)
+      , current_size(0U)
+    {
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        used[i] = false;
+      }
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~rate_limiter_table()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Takes 'count' tokens from the key's bucket, if they are available.
+    /// If asserts or exceptions are enabled, emits rate_limiter_table_full if
+    /// the key is new and no bucket is free.
+    ///\return <b>true</b> if the tokens were taken.
+    //*************************************************************************
+    bool try_consume(const key_type& key, tick_type now, count_type count = 1U)
+    {
+      bucket_type* p_bucket = find_or_create(key, now);
+
+      ETL_ASSERT_OR_RETURN_VALUE(p_bucket != ETL_NULLPTR, ETL_ERROR(rate_limiter_table_full), false);
+
+      return p_bucket->try_consume(now, count);
+    }
+
+    //*************************************************************************
+    /// Finds the bucket for the key.
+    ///\return A pointer to the bucket, or null if the key has no bucket.
+    //*************************************************************************
+    bucket_type* find(const key_type& key)
+    {
+      const size_t index = find_index(key);
+
+      return (index == VSize) ? ETL_NULLPTR : &slots[int(index)].bucket;
+    }
+
+    //*************************************************************************
+    /// Finds the bucket for the key.
+    ///\return A pointer to the bucket, or null if the key has no bucket.
+    //*************************************************************************
+    const bucket_type* find(const key_type& key) const
+    {
+      const size_t index = find_index(key);
+
+      return (index == VSize) ? ETL_NULLPTR : &slots[int(index)].bucket;
+    }
+
+    //*************************************************************************
+    /// Removes all of the buckets.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < VSize; ++i)
+      {
+        if (used[i])
+        {
+          slots[int(i)].~slot_type();
+          used[i] = false;
+        }
+      }
+
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of keys that have a bucket.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of buckets.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Checks if no key has a bucket.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A key and its bucket.
+    //*************************************************************************
+    struct slot_type
+    {
+      slot_type(const key_type& key_, const bucket_type& bucket_)
+        : key(key_)
+        , bucket(bucket_)
+      {
+      }
+
+      key_type    key;
+      bucket_type bucket;
+    };
+
+    //*************************************************************************
+    /// Gets the first slot to probe for the key.
+    //*************************************************************************
+    size_t home_index(const key_type& key) const
+    {
+      return size_t(hasher(key)) % VSize;
+    }
+
+    //*************************************************************************
+    /// Finds the slot index for the key, or VSize if not found.
+    //*************************************************************************
+    size_t find_index(const key_type& key) const
+    {
+      size_t index = home_index(key);
+
+      for (size_t probe = 0U; (probe < VSize) && used[index]; ++probe)
+      {
+        if (key_equal(slots[int(index)].key, key))
+        {
+          return index;
+        }
+
+        index = (index + 1U == VSize) ? 0U : index + 1U;
+      }
+
+      return VSize;
+    }
+
+    //*************************************************************************
+    /// Finds the bucket for the key, creating it if required.
+    /// A new key takes the first free or idle slot on its probe sequence.
+    //*************************************************************************
+    bucket_type* find_or_create(const key_type& key, tick_type now)
+    {
+      size_t index     = home_index(key);
+      size_t reuse     = VSize;
+      size_t probe     = 0U;
+
+      for (; (probe < VSize) && used[index]; ++probe)
+      {
+        if (key_equal(slots[int(index)].key, key))
+        {
+          return &slots[int(index)].bucket;
+        }
+
+        if ((reuse == VSize) && slots[int(index)].bucket.is_idle(now))
+        {
+          reuse = index;
+        }
+
+        index = (index + 1U == VSize) ? 0U : index + 1U;
+      }
+
+      if (reuse != VSize)
+      {
+        // Replace an idle bucket, which will be found first on the key's probe sequence.
+        slots[int(reuse)].~slot_type();
+        index = reuse;
+      }
+      else if (probe == VSize)
+      {
+        return ETL_NULLPTR;
+      }
+      else
+      {
+        used[index] = true;
+        ++current_size;
+      }
+
+      slot_type* p_slot = ::new (&slots[int(index)]) slot_type(key, prototype);
+      p_slot->bucket.reset(now);
+
+      return &p_slot->bucket;
+    }
+
+    // Disable copy construction and assignment.
+    rate_limiter_table(const rate_limiter_table&) ETL_DELETE;
+    rate_limiter_table& operator =(const rate_limiter_table&) ETL_DELETE;
+
+    bucket_type                                    prototype;
+    etl::uninitialized_buffer_of<slot_type, VSize> slots;
+    bool                                           used[VSize];
+    size_type                                      current_size;
+    THash                                          hasher;
+    TKeyEqual                                      key_equal;
+  };
+
+  template <typename TKey, size_t VSize, typename TBucket, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t rate_limiter_table<TKey, VSize, TBucket, THash, TKeyEqual>::Size;
+}
+
+#endif
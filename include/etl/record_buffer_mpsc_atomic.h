@@ -0,0 +1,402 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_RECORD_BUFFER_MPSC_ATOMIC_INCLUDED
+#define ETL_RECORD_BUFFER_MPSC_ATOMIC_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "alignment.h"
+#include "memory.h"
+#include "power.h"
+#include "span.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception for a record buffer.
+  //***************************************************************************
+  class record_buffer_exception : public exception
+  {
+  public:
+
+    record_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a commit of a record that was not reserved.
+  //***************************************************************************
+  class record_buffer_commit_invalid : public record_buffer_exception
+  {
+  public:
+
+    record_buffer_commit_invalid(string_type file_name_, numeric_type line_number_)
+      : record_buffer_exception(ETL_ERROR_TEXT("record_buffer:commit", ETL_RECORD_BUFFER_MPSC_ATOMIC_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A ring of variable length records, written in place by many producers
+  /// and read in place by one consumer, with no locks and no copies.
+  ///
+  /// Each record has a header word followed by its payload, padded to a
+  /// multiple of Alignment bytes. A producer claims the space for a record
+  /// by moving the write cursor with a compare and swap, writes the payload
+  /// into the returned span and then commits it with a release store to the
+  /// header. A record that would straddle the end of the ring is preceded by
+  /// a padding record that fills the end, so every payload is contiguous.
+  ///
+  /// The consumer reads committed records in the order that they were
+  /// claimed. A claimed record that has not yet been committed holds back
+  /// the records claimed after it.
+  /// The consumer clears the space of each record that it has read, so that
+  /// an uncommitted header always reads as zero.
+  //***************************************************************************
+  class irecord_buffer_mpsc_atomic
+  {
+  public:
+
+    typedef uint32_t size_type;
+
+    /// Payloads start on a multiple of this many bytes.
+    static ETL_CONSTANT size_type Alignment   = 8U;
+    static ETL_CONSTANT size_type Header_Size = Alignment;
+
+    //*************************************************************************
+    /// Reserves space for a record of 'length' bytes.
+    /// Returns the span to write the payload to, or an empty span if there
+    /// is not enough space, or 'length' is zero or more than max_record_size().
+    /// May be called by any number of producers at once.
+    //*************************************************************************
+    etl::span<uint8_t> write_reserve(size_t length)
+    {
+      if ((length == 0U) || (length > max_record_size()))
+      {
+        return etl::span<uint8_t>();
+      }
+
+      const size_type required = record_size(size_type(length));
+
+      size_type tail = write_cursor.load(etl::memory_order_relaxed);
+      size_type padding;
+
+      while (true)
+      {
+        const size_type head   = read_cursor.load(etl::memory_order_acquire);
+        const size_type offset = tail & mask;
+        const size_type to_end = buffer_size - offset;
+
+        // A record that would straddle the end starts again at the beginning.
+        padding = (required > to_end) ? to_end : 0U;
+
+        if (((tail - head) + padding + required) > buffer_size)
+        {
+          return etl::span<uint8_t>();
+        }
+
+        if (write_cursor.compare_exchange_weak(tail, tail + padding + required, etl::memory_order_acquire, etl::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+
+      size_type offset = tail & mask;
+
+      if (padding != 0U)
+      {
+        header(offset).store(Committed_Flag | Padding_Flag | (padding - Header_Size), etl::memory_order_release);
+        offset = 0U;
+      }
+
+      return etl::span<uint8_t>(p_buffer + offset + Header_Size, length);
+    }
+
+    //*************************************************************************
+    /// Commits a record returned by write_reserve, so that the consumer may read it.
+    //*************************************************************************
+    void write_commit(const etl::span<uint8_t>& record)
+    {
+      header_of(record).store(Committed_Flag | size_type(record.size()), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Abandons a record returned by write_reserve.
+    /// The consumer skips it.
+    //*************************************************************************
+    void write_cancel(const etl::span<uint8_t>& record)
+    {
+      header_of(record).store(Committed_Flag | Padding_Flag | size_type(record.size()), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Writes a record by copying 'length' bytes from 'data'.
+    /// Returns false if there is not enough space.
+    //*************************************************************************
+    bool write(const void* data, size_t length)
+    {
+      etl::span<uint8_t> record = write_reserve(length);
+
+      if (record.empty())
+      {
+        return false;
+      }
+
+      memcpy(record.data(), data, length);
+      write_commit(record);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the next committed record, or an empty span if there is none.
+    /// The record stays in the buffer until read_commit is called.
+    /// Only called by the consumer.
+    //*************************************************************************
+    etl::span<const uint8_t> read_reserve()
+    {
+      while (true)
+      {
+        const size_type head   = read_cursor.load(etl::memory_order_relaxed);
+        const size_type offset = head & mask;
+        const size_type value  = header(offset).load(etl::memory_order_acquire);
+
+        if ((value & Committed_Flag) == 0U)
+        {
+          return etl::span<const uint8_t>();
+        }
+
+        const size_type length = value & Length_Mask;
+
+        if ((value & Padding_Flag) == 0U)
+        {
+          return etl::span<const uint8_t>(p_buffer + offset + Header_Size, length);
+        }
+
+        // Skip padding and abandoned records.
+        release(head, offset, record_size(length));
+      }
+    }
+
+    //*************************************************************************
+    /// Frees the record returned by read_reserve.
+    /// Only called by the consumer.
+    /// If asserts or exceptions are enabled, emits record_buffer_commit_invalid
+    /// if the record is not the one at the read position.
+    //*************************************************************************
+    void read_commit(const etl::span<const uint8_t>& record)
+    {
+      const size_type head   = read_cursor.load(etl::memory_order_relaxed);
+      const size_type offset = head & mask;
+
+      ETL_ASSERT_OR_RETURN(record.data() == (p_buffer + offset + Header_Size), ETL_ERROR(record_buffer_commit_invalid));
+
+      release(head, offset, record_size(size_type(record.size())));
+    }
+
+    //*************************************************************************
+    /// Calls 'function(etl::span<const uint8_t>)' for up to 'max_records'
+    /// committed records, freeing each after the call.
+    /// Returns the number of records read.
+    /// Only called by the consumer.
+    //*************************************************************************
+    template <typename TFunction>
+    size_t read(TFunction function, size_t max_records = ~size_t(0U))
+    {
+      size_t count = 0U;
+
+      while (count < max_records)
+      {
+        etl::span<const uint8_t> record = read_reserve();
+
+        if (record.empty())
+        {
+          break;
+        }
+
+        function(record);
+        read_commit(record);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no claimed records.
+    /// The result may be out of date when it is returned.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of bytes that are claimed, including headers and padding.
+    /// The result may be out of date when it is returned.
+    //*************************************************************************
+    size_type size() const
+    {
+      return write_cursor.load(etl::memory_order_acquire) - read_cursor.load(etl::memory_order_acquire);
+    }
+
+    //*************************************************************************
+    /// The number of bytes in the ring.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return buffer_size;
+    }
+
+    //*************************************************************************
+    /// The largest payload, which is always able to fit once the ring has been read.
+    //*************************************************************************
+    size_type max_record_size() const
+    {
+      return (buffer_size / 2U) - Header_Size;
+    }
+
+    //*************************************************************************
+    /// The number of bytes that a record with a payload of 'length' bytes uses.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_type record_size(size_type length)
+    {
+      return Header_Size + ((length + (Alignment - 1U)) & ~(Alignment - 1U));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    irecord_buffer_mpsc_atomic(uint8_t* p_buffer_, size_type buffer_size_)
+      : p_buffer(p_buffer_)
+      , buffer_size(buffer_size_)
+      , mask(buffer_size_ - 1U)
+      , write_cursor(0U)
+      , read_cursor(0U)
+    {
+      memset(p_buffer, 0, buffer_size);
+    }
+
+  private:
+
+    typedef etl::atomic<uint32_t> header_type;
+
+    ETL_STATIC_ASSERT(sizeof(header_type) <= Header_Size, "The atomic header does not fit");
+
+    static ETL_CONSTANT size_type Committed_Flag = 0x80000000UL;
+    static ETL_CONSTANT size_type Padding_Flag   = 0x40000000UL;
+    static ETL_CONSTANT size_type Length_Mask    = 0x3FFFFFFFUL;
+
+    //*************************************************************************
+    /// The header at an offset.
+    //*************************************************************************
+    header_type& header(size_type offset)
+    {
+      return *reinterpret_cast<header_type*>(p_buffer + offset);
+    }
+
+    //*************************************************************************
+    /// The header of a reserved record.
+    //*************************************************************************
+    header_type& header_of(const etl::span<uint8_t>& record)
+    {
+      return *reinterpret_cast<header_type*>(record.data() - Header_Size);
+    }
+
+    //*************************************************************************
+    /// Clears the record at the read position and passes it.
+    //*************************************************************************
+    void release(size_type head, size_type offset, size_type bytes)
+    {
+      memset(p_buffer + offset, 0, bytes);
+      read_cursor.store(head + bytes, etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    irecord_buffer_mpsc_atomic(const irecord_buffer_mpsc_atomic&) ETL_DELETE;
+    irecord_buffer_mpsc_atomic& operator =(const irecord_buffer_mpsc_atomic&) ETL_DELETE;
+
+    uint8_t* const  p_buffer;
+    const size_type buffer_size;
+    const size_type mask;
+    etl::atomic<size_type> write_cursor;
+    etl::atomic<size_type> read_cursor;
+  };
+
+  //***************************************************************************
+  /// A ring of variable length records for many producers and one consumer.
+  /// \tparam VCapacity The number of bytes in the ring. Must be a power of 2.
+  //***************************************************************************
+  template <size_t VCapacity>
+  class record_buffer_mpsc_atomic : public irecord_buffer_mpsc_atomic
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VCapacity>::value, "The capacity must be a power of 2");
+    ETL_STATIC_ASSERT(VCapacity >= (4U * Header_Size), "The capacity is too small");
+    ETL_STATIC_ASSERT(VCapacity <= 0x40000000UL, "The capacity is too large");
+
+    static ETL_CONSTANT size_t Capacity = VCapacity;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    record_buffer_mpsc_atomic()
+      : irecord_buffer_mpsc_atomic(reinterpret_cast<uint8_t*>(buffer.raw), size_type(VCapacity))
+    {
+    }
+
+  private:
+
+    /// The storage, aligned for the headers.
+    etl::uninitialized_buffer<Header_Size, VCapacity / Header_Size, etl::alignment_of<uint64_t>::value> buffer;
+  };
+
+  template <size_t VCapacity>
+  ETL_CONSTANT size_t record_buffer_mpsc_atomic<VCapacity>::Capacity;
+}
+
+#endif
+#endif
@@ -172,6 +172,34 @@ namespace etl
       ETL_ASSERT(released, ETL_ERROR(etl::reference_counted_message_pool_release_failure));
     }
 
+    //*************************************************************************
+    /// Destruct a batch of messages and send them back to the allocator
+    /// under a single lock.
+    //*************************************************************************
+    void release_batch(etl::ireference_counted_message* const* messages, size_t count) ETL_OVERRIDE
+    {
+      bool released = true;
+
+      lock();
+      for (size_t i = 0U; i < count; ++i)
+      {
+        const etl::ireference_counted_message* p_rcmessage = messages[i];
+
+        if (memory_block_allocator.is_owner_of(p_rcmessage))
+        {
+          p_rcmessage->~ireference_counted_message();
+          released = memory_block_allocator.release(p_rcmessage) && released;
+        }
+        else
+        {
+          released = false;
+        }
+      }
+      unlock();
+
+      ETL_ASSERT(released, ETL_ERROR(etl::reference_counted_message_pool_release_failure));
+    }
+
 #if ETL_USING_CPP11
     //*****************************************************
     template <typename TMessage1, typename... TMessages>
@@ -77,6 +77,18 @@ namespace etl
     virtual void increment_reference_count() = 0;
     ETL_NODISCARD virtual int32_t decrement_reference_count() = 0;
     ETL_NODISCARD virtual int32_t get_reference_count() const = 0;
+
+    //***************************************************************************
+    /// Add n to the reference count.
+    /// Override to add them in one operation.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t n)
+    {
+      while (n-- > 0)
+      {
+        increment_reference_count();
+      }
+    }
   };
 
   //***************************************************************************
@@ -111,6 +123,14 @@ namespace etl
       ++reference_count;
     }
 
+    //***************************************************************************
+    /// Add n to the reference count.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t n) ETL_OVERRIDE
+    {
+      reference_count += n;
+    }
+
     //***************************************************************************
     /// Decrement the reference count.
     //***************************************************************************
@@ -134,6 +154,75 @@ namespace etl
     TCounter reference_count; // The reference count object.
   };
 
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A specialisation for atomic counters.
+  /// Adding references only needs relaxed ordering. Removing them is
+  /// acquire/release, so that the last owner sees every write to the object.
+  //***************************************************************************
+  template <typename T>
+  class reference_counter<etl::atomic<T> > : public ireference_counter
+  {
+  public:
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    reference_counter()
+      : reference_count(0)
+    {
+    }
+
+    //***************************************************************************
+    /// Set the reference count.
+    //***************************************************************************
+    virtual void set_reference_count(int32_t value) ETL_OVERRIDE
+    {
+      reference_count.store(T(value), etl::memory_order_release);
+    }
+
+    //***************************************************************************
+    /// Increment the reference count.
+    //***************************************************************************
+    virtual void increment_reference_count() ETL_OVERRIDE
+    {
+      reference_count.fetch_add(T(1), etl::memory_order_relaxed);
+    }
+
+    //***************************************************************************
+    /// Add n to the reference count.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t n) ETL_OVERRIDE
+    {
+      reference_count.fetch_add(T(n), etl::memory_order_relaxed);
+    }
+
+    //***************************************************************************
+    /// Decrement the reference count.
+    //***************************************************************************
+    ETL_NODISCARD virtual int32_t decrement_reference_count() ETL_OVERRIDE
+    {
+      const int32_t previous = int32_t(reference_count.fetch_sub(T(1), etl::memory_order_acq_rel));
+
+      ETL_ASSERT(previous > 0, ETL_ERROR(reference_count_overrun));
+
+      return previous - 1;
+    }
+
+    //***************************************************************************
+    /// Get the current reference count.
+    //***************************************************************************
+    ETL_NODISCARD virtual int32_t get_reference_count() const ETL_OVERRIDE
+    {
+      return int32_t(reference_count.load(etl::memory_order_acquire));
+    }
+
+  private:
+
+    etl::atomic<T> reference_count; // The reference count object.
+  };
+#endif
+
   //***************************************************************************
   /// A specialisation for a counter type of void.
   //***************************************************************************
@@ -166,6 +255,14 @@ namespace etl
       // Do nothing.
     }
 
+    //***************************************************************************
+    /// Add n to the reference count.
+    //***************************************************************************
+    virtual void add_reference_count(int32_t /*n*/) ETL_OVERRIDE
+    {
+      // Do nothing.
+    }
+
     //***************************************************************************
     /// Decrement the reference count.
     //***************************************************************************
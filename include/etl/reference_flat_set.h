@@ -898,8 +898,91 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup without ordering it.
+    /// merge_appended must be called before the set is used again.
+    //*********************************************************************
+    void append_unordered(reference value)
+    {
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Orders the values appended since the lookup held 'old_size' entries.
+    /// The new values are sorted, merged with the existing ones and any
+    /// duplicates removed, in O(N + M) when the unused lookup capacity can
+    /// hold the smaller run. Existing values take precedence, followed by the
+    /// earliest new value. Each removed value is passed to 'discard'.
+    //*********************************************************************
+    template <typename TDiscard>
+    void merge_appended(size_t old_size, TDiscard discard)
+    {
+      typedef typename lookup_t::iterator lookup_iterator;
+      typedef typename etl::iterator_traits<lookup_iterator>::difference_type difference_t;
+
+      lookup_iterator first  = lookup.begin();
+      lookup_iterator middle = first + old_size;
+      lookup_iterator last   = lookup.end();
+
+      if (middle == last)
+      {
+        return;
+      }
+
+      // The unused part of the lookup is the scratch buffer.
+      lookup_iterator buffer      = lookup.data() + lookup.size();
+      difference_t    buffer_size = difference_t(lookup.capacity() - lookup.size());
+
+      PointerCompare pointer_compare;
+
+      etl::merge_sort(middle, last, buffer, buffer + buffer_size, pointer_compare);
+
+      if ((first != middle) && pointer_compare(*middle, *(middle - 1)))
+      {
+        etl::private_merge_sort::merge_adaptive(first, middle, last, difference_t(middle - first), difference_t(last - middle), buffer, buffer_size, pointer_compare);
+      }
+      else if (first != middle)
+      {
+        // Only the boundary can hold a duplicate of an existing value.
+        first = middle - 1;
+      }
+
+      // Remove the duplicates, keeping the first of each.
+      lookup_iterator result = first;
+      lookup_iterator itr    = first;
+
+      while (++itr != last)
+      {
+        if (pointer_compare(*result, *itr))
+        {
+          *++result = *itr;
+        }
+        else
+        {
+          discard(**itr);
+        }
+      }
+
+      lookup.resize(size_t(etl::distance(lookup.begin(), result)) + 1U);
+    }
+
   private:
 
+    //*********************************************************************
+    /// How to compare lookup entries.
+    //*********************************************************************
+    class PointerCompare
+    {
+    public:
+
+      bool operator ()(const value_type* lhs, const value_type* rhs) const
+      {
+        return comp(*lhs, *rhs);
+      }
+
+      TKeyCompare comp;
+    };
+
     // Disable copy construction.
     ireference_flat_set(const ireference_flat_set&);
     ireference_flat_set& operator =(const ireference_flat_set&);
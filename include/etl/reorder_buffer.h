@@ -0,0 +1,531 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_REORDER_BUFFER_INCLUDED
+#define ETL_REORDER_BUFFER_INCLUDED
+
+#include "platform.h"
+#include "memory.h"
+#include "bitset.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "enum_type.h"
+#include "placement_new.h"
+#include "utility.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+#include "file_error_numbers.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup reorder_buffer reorder_buffer
+/// A window that puts items with wrapping sequence numbers back in order.
+/// Sequence numbers are compared with serial number arithmetic (RFC 1982),
+/// so the stream may wrap through zero.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the reorder_buffer.
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  class reorder_buffer_exception : public etl::exception
+  {
+  public:
+
+    reorder_buffer_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Raised when the next item in sequence has not arrived.
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  class reorder_buffer_not_ready : public etl::reorder_buffer_exception
+  {
+  public:
+
+    reorder_buffer_not_ready(string_type file_name_, numeric_type line_number_)
+      : etl::reorder_buffer_exception(ETL_ERROR_TEXT("reorder_buffer:not ready", ETL_REORDER_BUFFER_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The signed distance from one sequence number to another.
+  /// Positive if 'to' is after 'from'.
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  template <typename TSequence>
+  ETL_CONSTEXPR typename etl::make_signed<TSequence>::type serial_distance(TSequence from, TSequence to)
+  {
+    return static_cast<typename etl::make_signed<TSequence>::type>(static_cast<TSequence>(to - from));
+  }
+
+  //***************************************************************************
+  /// Is sequence number 'lhs' before 'rhs'?
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  template <typename TSequence>
+  ETL_CONSTEXPR bool serial_less(TSequence lhs, TSequence rhs)
+  {
+    return etl::serial_distance(lhs, rhs) > 0;
+  }
+
+  //***************************************************************************
+  /// The result of reorder_buffer::insert.
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  struct reorder_status
+  {
+    enum enum_type
+    {
+      Inserted,
+      Duplicate,
+      Late,
+      Too_Far_Ahead
+    };
+
+    ETL_DECLARE_ENUM_TYPE(reorder_status, uint_least8_t)
+    ETL_ENUM_TYPE(Inserted,      "Inserted")
+    ETL_ENUM_TYPE(Duplicate,     "Duplicate")
+    ETL_ENUM_TYPE(Late,          "Late")
+    ETL_ENUM_TYPE(Too_Far_Ahead, "Too_Far_Ahead")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// Puts items back into sequence order.
+  /// Holds items for the sequence numbers from next() to next() + Window - 1.
+  /// Each sequence number maps to a fixed slot, so insert is O(1).
+  /// A bitmap of delivered sequence numbers from next() - Window to next() - 1
+  /// separates duplicates from items that arrive after their gap was skipped.
+  ///\tparam T         The item type.
+  ///\tparam VWindow   The number of slots. A power of 2, at most half the sequence range.
+  ///\tparam TSequence The unsigned sequence number type.
+  ///\ingroup reorder_buffer
+  //***************************************************************************
+  template <typename T, size_t VWindow, typename TSequence = uint16_t>
+  class reorder_buffer
+  {
+  public:
+
+    typedef T         value_type;
+    typedef T&        reference;
+    typedef const T&  const_reference;
+#if ETL_USING_CPP11
+    typedef T&&       rvalue_reference;
+#endif
+    typedef TSequence sequence_type;
+    typedef uint32_t  tick_type;
+    typedef size_t    size_type;
+
+    ETL_STATIC_ASSERT(etl::is_unsigned<TSequence>::value, "The sequence type must be unsigned");
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VWindow>::value, "The window must be a power of 2");
+    ETL_STATIC_ASSERT((VWindow - 1U) <= size_t(etl::integral_limits<TSequence>::max / 2U), "The window must be at most half the sequence range");
+
+    static ETL_CONSTANT size_type Window = VWindow;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param first The first expected sequence number.
+    //*************************************************************************
+    explicit reorder_buffer(sequence_type first = 0U)
+      : head(first)
+      , count(0U)
+      , duplicates(0U)
+      , late(0U)
+      , lost(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~reorder_buffer()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Inserts an item.
+    ///\param sequence The sequence number of the item.
+    ///\param value    The item.
+    ///\param now      The arrival time, used by drain with a timeout.
+    //*************************************************************************
+    reorder_status insert(sequence_type sequence, const_reference value, tick_type now = 0U)
+    {
+      reorder_status status = classify(sequence);
+
+      if (status == reorder_status::Inserted)
+      {
+        const size_t index = slot(sequence);
+        ::new (&buffer[index]) T(value);
+        mark_present(index, now);
+      }
+
+      return status;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts an item.
+    ///\param sequence The sequence number of the item.
+    ///\param value    The item.
+    ///\param now      The arrival time, used by drain with a timeout.
+    //*************************************************************************
+    reorder_status insert(sequence_type sequence, rvalue_reference value, tick_type now = 0U)
+    {
+      reorder_status status = classify(sequence);
+
+      if (status == reorder_status::Inserted)
+      {
+        const size_t index = slot(sequence);
+        ::new (&buffer[index]) T(etl::move(value));
+        mark_present(index, now);
+      }
+
+      return status;
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks if the next item in sequence has arrived.
+    //*************************************************************************
+    bool ready() const
+    {
+      return present.test(slot(head));
+    }
+
+    //*************************************************************************
+    /// Gets the next item in sequence.
+    /// If asserts or exceptions are enabled, emits reorder_buffer_not_ready if it has not arrived.
+    //*************************************************************************
+    reference front()
+    {
+      ETL_ASSERT(ready(), ETL_ERROR(reorder_buffer_not_ready));
+
+      return buffer[slot(head)];
+    }
+
+    //*************************************************************************
+    /// Gets the next item in sequence.
+    /// If asserts or exceptions are enabled, emits reorder_buffer_not_ready if it has not arrived.
+    //*************************************************************************
+    const_reference front() const
+    {
+      ETL_ASSERT(ready(), ETL_ERROR(reorder_buffer_not_ready));
+
+      return buffer[slot(head)];
+    }
+
+    //*************************************************************************
+    /// Removes the next item in sequence.
+    /// If asserts or exceptions are enabled, emits reorder_buffer_not_ready if it has not arrived.
+    //*************************************************************************
+    void pop()
+    {
+      ETL_ASSERT_OR_RETURN(ready(), ETL_ERROR(reorder_buffer_not_ready));
+
+      deliver_head();
+    }
+
+    //*************************************************************************
+    /// Passes each item of the contiguous run at the head to 'f', then removes it.
+    /// 'f' is called as f(sequence_type, T&).
+    ///\return The number of items passed.
+    //*************************************************************************
+    template <typename TFunctor>
+    size_type drain(TFunctor f)
+    {
+      size_type n = 0U;
+
+      while (ready())
+      {
+        f(head, buffer[slot(head)]);
+        deliver_head();
+        ++n;
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Passes items to 'f' in order, as drain(f), but gives up on a gap once
+    /// the first item waiting behind it has been held for 'timeout' ticks.
+    /// The missing sequence numbers are counted as lost.
+    ///\return The number of items passed.
+    //*************************************************************************
+    template <typename TFunctor>
+    size_type drain(tick_type now, tick_type timeout, TFunctor f)
+    {
+      size_type n = drain(f);
+
+      while (!empty() && (tick_type(now - arrival[find_waiting()]) >= timeout))
+      {
+        skip_gap();
+        n += drain(f);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Gives up on the gap at the head, moving to the next item that has arrived.
+    ///\return The number of sequence numbers counted as lost.
+    //*************************************************************************
+    size_type skip_gap()
+    {
+      if (empty() || ready())
+      {
+        return 0U;
+      }
+
+      const size_t    index   = find_waiting();
+      const size_type missing = (index - slot(head)) & Mask;
+
+      for (size_type i = 0U; i < missing; ++i)
+      {
+        delivered.reset(slot(head));
+        ++head;
+      }
+
+      lost += missing;
+
+      return missing;
+    }
+
+    //*************************************************************************
+    /// Removes all items and restarts the sequence at 'first'.
+    /// The statistics are kept.
+    //*************************************************************************
+    void reset(sequence_type first)
+    {
+      clear();
+      delivered.reset();
+      head = first;
+    }
+
+    //*************************************************************************
+    /// Removes all items. The expected sequence number is unchanged.
+    //*************************************************************************
+    void clear()
+    {
+      if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<T>::value)
+      {
+        for (size_t i = 0U; count != 0U; ++i)
+        {
+          if (present.test(i))
+          {
+            buffer[i].~T();
+            --count;
+          }
+        }
+      }
+
+      present.reset();
+      count = 0U;
+    }
+
+    //*************************************************************************
+    /// The sequence number of the next item to deliver.
+    //*************************************************************************
+    sequence_type next() const
+    {
+      return head;
+    }
+
+    //*************************************************************************
+    /// The number of items held.
+    //*************************************************************************
+    size_type size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return Window;
+    }
+
+    //*************************************************************************
+    /// The number of items rejected because they had already been delivered,
+    /// or were already held.
+    //*************************************************************************
+    size_type duplicate_count() const
+    {
+      return duplicates;
+    }
+
+    //*************************************************************************
+    /// The number of items rejected because their gap had been skipped, or
+    /// they were more than Window behind.
+    //*************************************************************************
+    size_type late_count() const
+    {
+      return late;
+    }
+
+    //*************************************************************************
+    /// The number of sequence numbers skipped.
+    //*************************************************************************
+    size_type lost_count() const
+    {
+      return lost;
+    }
+
+    //*************************************************************************
+    /// Clears the statistics.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      duplicates = 0U;
+      late       = 0U;
+      lost       = 0U;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Mask = VWindow - 1U;
+
+    //*************************************************************************
+    static size_t slot(sequence_type sequence)
+    {
+      return size_t(sequence) & Mask;
+    }
+
+    //*************************************************************************
+    /// Decides where an incoming sequence number goes.
+    //*************************************************************************
+    reorder_status classify(sequence_type sequence)
+    {
+      typedef typename etl::make_signed<sequence_type>::type signed_type;
+
+      const signed_type distance = etl::serial_distance(head, sequence);
+      const size_t      index    = slot(sequence);
+
+      if (distance >= 0)
+      {
+        if (size_t(distance) >= Window)
+        {
+          return reorder_status::Too_Far_Ahead;
+        }
+
+        if (present.test(index))
+        {
+          ++duplicates;
+          return reorder_status::Duplicate;
+        }
+
+        return reorder_status::Inserted;
+      }
+
+      if ((size_t(-distance) <= Window) && delivered.test(index))
+      {
+        ++duplicates;
+        return reorder_status::Duplicate;
+      }
+
+      ++late;
+      return reorder_status::Late;
+    }
+
+    //*************************************************************************
+    void mark_present(size_t index, tick_type now)
+    {
+      present.set(index);
+      arrival[index] = now;
+      ++count;
+    }
+
+    //*************************************************************************
+    void deliver_head()
+    {
+      const size_t index = slot(head);
+
+      buffer[index].~T();
+      present.reset(index);
+      delivered.set(index);
+      --count;
+      ++head;
+    }
+
+    //*************************************************************************
+    /// Finds the slot of the first item held after the head.
+    /// The buffer must not be empty.
+    //*************************************************************************
+    size_t find_waiting() const
+    {
+      size_t index = present.find_next(true, slot(head));
+
+      if (index == etl::bitset<VWindow>::npos)
+      {
+        index = present.find_first(true);
+      }
+
+      return index;
+    }
+
+    // Disabled.
+    reorder_buffer(const reorder_buffer&) ETL_DELETE;
+    reorder_buffer& operator =(const reorder_buffer&) ETL_DELETE;
+
+    etl::uninitialized_buffer_of<T, VWindow> buffer;    ///< The items, indexed by sequence modulo Window.
+    etl::bitset<VWindow>                     present;   ///< The slots that hold an item.
+    etl::bitset<VWindow>                     delivered; ///< The slots whose previous sequence number was delivered, not skipped.
+    tick_type                                arrival[VWindow];
+    sequence_type                            head;
+    size_type                                count;
+    size_type                                duplicates;
+    size_type                                late;
+    size_type                                lost;
+  };
+
+  template <typename T, size_t VWindow, typename TSequence>
+  ETL_CONSTANT typename reorder_buffer<T, VWindow, TSequence>::size_type reorder_buffer<T, VWindow, TSequence>::Window;
+
+  template <typename T, size_t VWindow, typename TSequence>
+  ETL_CONSTANT size_t reorder_buffer<T, VWindow, TSequence>::Mask;
+}
+
+#endif
@@ -35,6 +35,7 @@ SOFTWARE.
 #include "functional.h"
 #include "type_traits.h"
 #include "algorithm.h"
+#include "span.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -71,6 +72,25 @@ namespace etl
       return TOutput(((value - input_min_value) * multiplier)) + output_min_value;;
     }
 
+    //*****************************************************************
+    /// Rescales a block of samples.
+    /// Processes the smaller of in.size() and out.size() samples.
+    /// The loop has no branches and uses the precomputed multiplier, so
+    /// that the compiler may vectorise it.
+    //*****************************************************************
+    void process(etl::span<const TInput> in, etl::span<TOutput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      const TInput* p_in  = in.data();
+      TOutput*      p_out = out.data();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = TOutput(((p_in[i] - input_min_value) * multiplier)) + output_min_value;
+      }
+    }
+
   private:
 
     const TInput  input_min_value;
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/statistics_simd.h"
 
 #include <math.h>
 #include <stdint.h>
@@ -127,6 +129,17 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a block of values.
+    /// Accumulates several partial sums at once, using vector instructions where supported.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      private_statistics::block_accumulate<TInput, TCalc, calc_t>::sum_of_squares(values.data(), values.size(), sum_of_squares);
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
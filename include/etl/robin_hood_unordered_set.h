@@ -0,0 +1,1240 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ROBIN_HOOD_UNORDERED_SET_INCLUDED
+#define ETL_ROBIN_HOOD_UNORDERED_SET_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "functional.h"
+#include "utility.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "nth_type.h"
+#include "power.h"
+#include "integral_limits.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "debug_count.h"
+#include "placement_new.h"
+#include "memory.h"
+#include "static_assert.h"
+#include "initializer_list.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup robin_hood_unordered_set robin_hood_unordered_set
+/// An open addressing unordered_set with the capacity defined at compile time.
+/// Uses robin hood hashing with backward shift deletion. No element is ever
+/// further than a fixed maximum probe length from its ideal slot, so the
+/// worst case cost of a lookup is bounded.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the robin_hood_unordered_set.
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  class robin_hood_unordered_set_exception : public etl::exception
+  {
+  public:
+
+    robin_hood_unordered_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the robin_hood_unordered_set.
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  class robin_hood_unordered_set_full : public etl::robin_hood_unordered_set_exception
+  {
+  public:
+
+    robin_hood_unordered_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::robin_hood_unordered_set_exception(ETL_ERROR_TEXT("robin_hood_unordered_set:full", ETL_ROBIN_HOOD_UNORDERED_SET_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the robin_hood_unordered_set.
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  class robin_hood_unordered_set_iterator : public etl::robin_hood_unordered_set_exception
+  {
+  public:
+
+    robin_hood_unordered_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::robin_hood_unordered_set_exception(ETL_ERROR_TEXT("robin_hood_unordered_set:iterator", ETL_ROBIN_HOOD_UNORDERED_SET_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Probe length exception for the robin_hood_unordered_set.
+  /// Raised when an insert would place an element beyond the maximum probe length.
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  class robin_hood_unordered_set_probe_length : public etl::robin_hood_unordered_set_exception
+  {
+  public:
+
+    robin_hood_unordered_set_probe_length(string_type file_name_, numeric_type line_number_)
+      : etl::robin_hood_unordered_set_exception(ETL_ERROR_TEXT("robin_hood_unordered_set:probe length", ETL_ROBIN_HOOD_UNORDERED_SET_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_robin_hood_unordered_set
+  {
+    //*************************************************************************
+    /// The number of home slots needed for a maximum load of 9/10.
+    //*************************************************************************
+    template <size_t Max_Size>
+    struct home_slot_count
+    {
+      static ETL_CONSTANT size_t Min_Slots = Max_Size + (Max_Size / 9U) + 1U;
+      static ETL_CONSTANT size_t value     = size_t(etl::power_of_2_round_up<Min_Slots>::value);
+    };
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t home_slot_count<Max_Size>::Min_Slots;
+
+    template <size_t Max_Size>
+    ETL_CONSTANT size_t home_slot_count<Max_Size>::value;
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized robin_hood_unordered_set.
+  /// Can be used as a reference type for all robin_hood_unordered_set containing a specific type.
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class irobin_hood_unordered_set
+  {
+  public:
+
+    typedef TKey              value_type;
+    typedef TKey              key_type;
+    typedef THash             hasher;
+    typedef TKeyEqual         key_equal;
+    typedef value_type&       reference;
+    typedef const value_type& const_reference;
+#if ETL_USING_CPP11
+    typedef value_type&&      rvalue_reference;
+#endif
+    typedef value_type*       pointer;
+    typedef const value_type* const_pointer;
+    typedef size_t            size_type;
+
+    typedef const TKey& key_parameter_t;
+
+    class const_iterator;
+
+    //*********************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, TKey>
+    {
+    public:
+
+      friend class irobin_hood_unordered_set;
+      friend class const_iterator;
+
+      //*********************************
+      iterator()
+        : pset(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      iterator(const iterator& other)
+        : pset(other.pset)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      iterator& operator ++()
+      {
+        index = pset->next_full(index + 1U);
+
+        return *this;
+      }
+
+      //*********************************
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*********************************
+      iterator& operator =(const iterator& other)
+      {
+        pset  = other.pset;
+        index = other.index;
+
+        return *this;
+      }
+
+      //*********************************
+      reference operator *() const
+      {
+        return pset->pslots[index];
+      }
+
+      //*********************************
+      pointer operator &() const
+      {
+        return &(pset->pslots[index]);
+      }
+
+      //*********************************
+      pointer operator ->() const
+      {
+        return &(pset->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const iterator& lhs, const iterator& rhs)
+      {
+        return (lhs.pset == rhs.pset) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const iterator& lhs, const iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      iterator(irobin_hood_unordered_set* pset_, size_t index_)
+        : pset(pset_)
+        , index(index_)
+      {
+      }
+
+      irobin_hood_unordered_set* pset;
+      size_t                     index;
+    };
+
+    //*********************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const TKey>
+    {
+    public:
+
+      friend class irobin_hood_unordered_set;
+      friend class iterator;
+
+      //*********************************
+      const_iterator()
+        : pset(ETL_NULLPTR)
+        , index(0U)
+      {
+      }
+
+      //*********************************
+      const_iterator(const typename irobin_hood_unordered_set::iterator& other)
+        : pset(other.pset)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator(const const_iterator& other)
+        : pset(other.pset)
+        , index(other.index)
+      {
+      }
+
+      //*********************************
+      const_iterator& operator ++()
+      {
+        index = pset->next_full(index + 1U);
+
+        return *this;
+      }
+
+      //*********************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+
+        return temp;
+      }
+
+      //*********************************
+      const_iterator& operator =(const const_iterator& other)
+      {
+        pset  = other.pset;
+        index = other.index;
+
+        return *this;
+      }
+
+      //*********************************
+      const_reference operator *() const
+      {
+        return pset->pslots[index];
+      }
+
+      //*********************************
+      const_pointer operator &() const
+      {
+        return &(pset->pslots[index]);
+      }
+
+      //*********************************
+      const_pointer operator ->() const
+      {
+        return &(pset->pslots[index]);
+      }
+
+      //*********************************
+      friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.pset == rhs.pset) && (lhs.index == rhs.index);
+      }
+
+      //*********************************
+      friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*********************************
+      const_iterator(const irobin_hood_unordered_set* pset_, size_t index_)
+        : pset(pset_)
+        , index(index_)
+      {
+      }
+
+      const irobin_hood_unordered_set* pset;
+      size_t                           index;
+    };
+
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    //*********************************************************************
+    /// Returns an iterator to the beginning of the robin_hood_unordered_set.
+    ///\return An iterator to the beginning of the robin_hood_unordered_set.
+    //*********************************************************************
+    iterator begin()
+    {
+      return iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the robin_hood_unordered_set.
+    ///\return A const iterator to the beginning of the robin_hood_unordered_set.
+    //*********************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the beginning of the robin_hood_unordered_set.
+    ///\return A const iterator to the beginning of the robin_hood_unordered_set.
+    //*********************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(this, next_full(0U));
+    }
+
+    //*********************************************************************
+    /// Returns an iterator to the end of the robin_hood_unordered_set.
+    ///\return An iterator to the end of the robin_hood_unordered_set.
+    //*********************************************************************
+    iterator end()
+    {
+      return iterator(this, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the robin_hood_unordered_set.
+    ///\return A const iterator to the end of the robin_hood_unordered_set.
+    //*********************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(this, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Returns a const_iterator to the end of the robin_hood_unordered_set.
+    ///\return A const iterator to the end of the robin_hood_unordered_set.
+    //*********************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(this, number_of_slots);
+    }
+
+    //*********************************************************************
+    /// Assigns values to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if ETL_IS_DEBUG_BUILD
+      difference_type d = etl::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(robin_hood_unordered_set_iterator));
+      ETL_ASSERT(size_t(d) <= max_size(), ETL_ERROR(robin_hood_unordered_set_full));
+#endif
+
+      clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set is already full.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_probe_length if the maximum probe length would be exceeded.
+    ///\param key The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(const_reference key)
+    {
+      const size_t home  = home_of(key);
+      const size_t index = find_index(key, home);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(robin_hood_unordered_set_full), ETL_OR_STD::make_pair(end(), false));
+      ETL_ASSERT_OR_RETURN_VALUE(can_insert(home), ETL_ERROR(robin_hood_unordered_set_probe_length), ETL_OR_STD::make_pair(end(), false));
+
+      value_type carried(key);
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, insert_new(carried, home)), true);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set is already full.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_probe_length if the maximum probe length would be exceeded.
+    ///\param key The value to insert.
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, bool> insert(rvalue_reference key)
+    {
+      const size_t home  = home_of(key);
+      const size_t index = find_index(key, home);
+
+      if (index != number_of_slots)
+      {
+        return ETL_OR_STD::pair<iterator, bool>(iterator(this, index), false);
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(!full(), ETL_ERROR(robin_hood_unordered_set_full), ETL_OR_STD::make_pair(end(), false));
+      ETL_ASSERT_OR_RETURN_VALUE(can_insert(home), ETL_ERROR(robin_hood_unordered_set_probe_length), ETL_OR_STD::make_pair(end(), false));
+
+      value_type carried(etl::move(key));
+
+      return ETL_OR_STD::pair<iterator, bool>(iterator(this, insert_new(carried, home)), true);
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a value to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param key      The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param key      The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, rvalue_reference key)
+    {
+      return insert(etl::move(key)).first;
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts a range of values to the robin_hood_unordered_set.
+    /// If asserts or exceptions are enabled, emits robin_hood_unordered_set_full if the robin_hood_unordered_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_);
+        ++first_;
+      }
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    ///\param key The key to erase.
+    ///\return The number of elements erased. 0 or 1.
+    //*********************************************************************
+    size_t erase(key_parameter_t key)
+    {
+      const size_t index = find_index(key, home_of(key));
+
+      if (index == number_of_slots)
+      {
+        return 0U;
+      }
+
+      erase_slot(index);
+
+      return 1U;
+    }
+
+    //*********************************************************************
+    /// Erases an element.
+    /// Later elements may be shifted back, so other iterators are invalidated.
+    ///\param ielement Iterator to the element.
+    ///\return An iterator to the element that followed the erased one.
+    //*********************************************************************
+    iterator erase(const_iterator ielement)
+    {
+      erase_slot(ielement.index);
+
+      // An element may have been shifted into the erased slot.
+      return iterator(this, next_full(ielement.index));
+    }
+
+    //*********************************************************************
+    /// Erases a range of elements.
+    /// The range includes all the elements between first and last, including the
+    /// element pointed by first, but not the one pointed to by last.
+    ///\param first Iterator to the first element.
+    ///\param last  Iterator to the last element.
+    ///\return An iterator to the element that followed the erased ones.
+    //*********************************************************************
+    iterator erase(const_iterator first_, const_iterator last_)
+    {
+      // Elements are shifted by each erase, so count them first.
+      size_t n = static_cast<size_t>(etl::distance(first_, last_));
+
+      iterator itr(this, first_.index);
+
+      while (n != 0U)
+      {
+        itr = erase(const_iterator(itr));
+        --n;
+      }
+
+      return itr;
+    }
+
+    //*************************************************************************
+    /// Clears the robin_hood_unordered_set.
+    //*************************************************************************
+    void clear()
+    {
+      initialise();
+    }
+
+    //*********************************************************************
+    /// Counts an element.
+    ///\param key The key to search for.
+    ///\return 1 if the key exists, otherwise 0.
+    //*********************************************************************
+    size_t count(key_parameter_t key) const
+    {
+      return (find_index(key, home_of(key)) == number_of_slots) ? 0U : 1U;
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    iterator find(key_parameter_t key)
+    {
+      return iterator(this, find_index(key, home_of(key)));
+    }
+
+    //*********************************************************************
+    /// Finds an element.
+    ///\param key The key to search for.
+    ///\return An iterator to the element if the key exists, otherwise end().
+    //*********************************************************************
+    const_iterator find(key_parameter_t key) const
+    {
+      return const_iterator(this, find_index(key, home_of(key)));
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<iterator, iterator> equal_range(key_parameter_t key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+
+    //*********************************************************************
+    /// Returns a range containing all elements with key key in the container.
+    ///\param key The key to search for.
+    ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+    //*********************************************************************
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+
+    //*************************************************************************
+    /// Gets the size of the robin_hood_unordered_set.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the robin_hood_unordered_set.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum possible size of the robin_hood_unordered_set.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return maximum_size;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the robin_hood_unordered_set is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the robin_hood_unordered_set is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == maximum_size;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    ///\return The remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return maximum_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum distance of any element from its ideal slot.
+    /// A lookup never examines more than max_probe_length() + 1 slots.
+    //*************************************************************************
+    size_t max_probe_length() const
+    {
+      return maximum_probe_length;
+    }
+
+    //*************************************************************************
+    /// Returns the load factor = size / number of ideal slots.
+    ///\return The load factor = size / number of ideal slots.
+    //*************************************************************************
+    float load_factor() const
+    {
+      return static_cast<float>(size()) / static_cast<float>(number_of_home_slots);
+    }
+
+    //*************************************************************************
+    /// Returns the function that hashes the keys.
+    ///\return The function that hashes the keys..
+    //*************************************************************************
+    hasher hash_function() const
+    {
+      return key_hash_function;
+    }
+
+    //*************************************************************************
+    /// Returns the function that compares the keys.
+    ///\return The function that compares the keys..
+    //*************************************************************************
+    key_equal key_eq() const
+    {
+      return key_equal_function;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    irobin_hood_unordered_set& operator = (const irobin_hood_unordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    irobin_hood_unordered_set& operator = (irobin_hood_unordered_set&& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        clear();
+        key_hash_function  = rhs.hash_function();
+        key_equal_function = rhs.key_eq();
+        this->move(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+#endif
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    irobin_hood_unordered_set(uint8_t* pdistances_, value_type* pslots_, size_t number_of_home_slots_, size_t maximum_probe_length_, size_t maximum_size_, hasher key_hash_function_, key_equal key_equal_function_)
+      : pdistances(pdistances_)
+      , pslots(pslots_)
+      , number_of_home_slots(number_of_home_slots_)
+      , number_of_slots(number_of_home_slots_ + maximum_probe_length_)
+      , maximum_probe_length(maximum_probe_length_)
+      , maximum_size(maximum_size_)
+      , current_size(0U)
+      , key_hash_function(key_hash_function_)
+      , key_equal_function(key_equal_function_)
+    {
+      etl::fill_n(pdistances, number_of_slots, uint8_t(0U));
+    }
+
+    //*********************************************************************
+    /// Initialise the robin_hood_unordered_set.
+    //*********************************************************************
+    void initialise()
+    {
+      if (!empty())
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (pdistances[i] != 0U)
+          {
+            pslots[i].~value_type();
+            ETL_DECREMENT_DEBUG_COUNT;
+          }
+        }
+      }
+
+      etl::fill_n(pdistances, number_of_slots, uint8_t(0U));
+      current_size = 0U;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move from a range
+    //*************************************************************************
+    void move(iterator first, iterator last)
+    {
+      while (first != last)
+      {
+        iterator temp = first;
+        ++temp;
+        insert(etl::move(*first));
+        first = temp;
+      }
+    }
+#endif
+
+  private:
+
+    //*********************************************************************
+    /// The ideal slot for a key.
+    /// The hash is mixed so that identity hashes are well distributed.
+    //*********************************************************************
+    size_t home_of(key_parameter_t key) const
+    {
+#if ETL_USING_64BIT_TYPES
+      const size_t multiplier = static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+#else
+      const size_t multiplier = static_cast<size_t>(0x9E3779B9UL);
+#endif
+
+      size_t hash = size_t(key_hash_function(key)) * multiplier;
+      hash ^= (hash >> (etl::integral_limits<size_t>::bits / 2U));
+
+      return hash & (number_of_home_slots - 1U);
+    }
+
+    //*********************************************************************
+    /// Finds the slot containing the key.
+    /// The stored distance of each slot is the probe distance + 1, or 0 if empty.
+    /// The search ends when it reaches an element nearer to its ideal slot, as
+    /// the key would have displaced it.
+    ///\return The index of the slot, or number_of_slots if not found.
+    //*********************************************************************
+    size_t find_index(key_parameter_t key, size_t home) const
+    {
+      for (size_t distance = 0U; distance <= maximum_probe_length; ++distance)
+      {
+        const size_t index  = home + distance;
+        const size_t stored = pdistances[index];
+
+        if ((stored == 0U) || ((stored - 1U) < distance))
+        {
+          break;
+        }
+
+        // Only elements with the same ideal slot can match.
+        if (((stored - 1U) == distance) && key_equal_function(pslots[index], key))
+        {
+          return index;
+        }
+      }
+
+      return number_of_slots;
+    }
+
+    //*********************************************************************
+    /// Checks that inserting at home leaves every element within the maximum probe length.
+    //*********************************************************************
+    bool can_insert(size_t home) const
+    {
+      size_t index    = home;
+      size_t distance = 0U;
+
+      while (pdistances[index] != 0U)
+      {
+        const size_t resident = pdistances[index] - 1U;
+
+        // The carried element takes this slot, and the resident is carried on.
+        if (resident < distance)
+        {
+          distance = resident;
+        }
+
+        ++index;
+        ++distance;
+
+        if (distance > maximum_probe_length)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*********************************************************************
+    /// Inserts a new element, displacing elements that are nearer to their
+    /// ideal slot than the one being carried.
+    ///\return The index of the new element.
+    //*********************************************************************
+    size_t insert_new(value_type& carried, size_t home)
+    {
+      size_t index    = home;
+      size_t distance = 0U;
+      size_t result   = number_of_slots;
+
+      while (pdistances[index] != 0U)
+      {
+        const size_t resident = pdistances[index] - 1U;
+
+        if (resident < distance)
+        {
+          using ETL_OR_STD::swap;
+          swap(carried, pslots[index]);
+
+          pdistances[index] = uint8_t(distance + 1U);
+          distance          = resident;
+
+          if (result == number_of_slots)
+          {
+            result = index;
+          }
+        }
+
+        ++index;
+        ++distance;
+      }
+
+#if ETL_USING_CPP11
+      ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(carried));
+#else
+      ::new ((void*)etl::addressof(pslots[index])) value_type(carried);
+#endif
+      ETL_INCREMENT_DEBUG_COUNT;
+      pdistances[index] = uint8_t(distance + 1U);
+      ++current_size;
+
+      return (result == number_of_slots) ? index : result;
+    }
+
+    //*********************************************************************
+    /// Destroys the element in a slot, then shifts the following elements back
+    /// until one is found in its ideal slot.
+    //*********************************************************************
+    void erase_slot(size_t index)
+    {
+      pslots[index].~value_type();
+      ETL_DECREMENT_DEBUG_COUNT;
+
+      size_t next = index + 1U;
+
+      while ((next < number_of_slots) && (pdistances[next] > 1U))
+      {
+#if ETL_USING_CPP11
+        ::new ((void*)etl::addressof(pslots[index])) value_type(etl::move(pslots[next]));
+#else
+        ::new ((void*)etl::addressof(pslots[index])) value_type(pslots[next]);
+#endif
+        pslots[next].~value_type();
+        pdistances[index] = uint8_t(pdistances[next] - 1U);
+
+        index = next;
+        ++next;
+      }
+
+      pdistances[index] = 0U;
+      --current_size;
+    }
+
+    //*********************************************************************
+    /// Finds the next full slot.
+    ///\return The index of the slot, or number_of_slots if there are no more.
+    //*********************************************************************
+    size_t next_full(size_t index) const
+    {
+      while ((index < number_of_slots) && (pdistances[index] == 0U))
+      {
+        ++index;
+      }
+
+      return index;
+    }
+
+    // Disable copy construction.
+    irobin_hood_unordered_set(const irobin_hood_unordered_set&);
+
+    /// The probe distances + 1, or 0 for empty slots.
+    uint8_t* pdistances;
+
+    /// The slots.
+    value_type* pslots;
+
+    /// The number of ideal slots. The slots are followed by an overflow area.
+    const size_t number_of_home_slots;
+
+    /// The total number of slots.
+    const size_t number_of_slots;
+
+    /// The maximum distance from the ideal slot.
+    const size_t maximum_probe_length;
+
+    /// The maximum number of elements.
+    const size_t maximum_size;
+
+    /// The number of elements.
+    size_t current_size;
+
+    /// The function that creates the hashes.
+    hasher key_hash_function;
+
+    /// The function that compares the keys for equality.
+    key_equal key_equal_function;
+
+    /// For library debugging purposes only.
+    ETL_DECLARE_DEBUG_COUNT;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_ROBIN_HOOD_UNORDERED_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~irobin_hood_unordered_set()
+    {
+    }
+#else
+  protected:
+    ~irobin_hood_unordered_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  ///\param lhs Reference to the first robin_hood_unordered_set.
+  ///\param rhs Reference to the second robin_hood_unordered_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>& lhs, const etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>::const_iterator itr = lhs.begin();
+
+    while (itr != lhs.end())
+    {
+      if (rhs.find(*itr) == rhs.end())
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first robin_hood_unordered_set.
+  ///\param rhs Reference to the second robin_hood_unordered_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup robin_hood_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>& lhs, const etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated robin_hood_unordered_set implementation that uses a fixed size buffer.
+  ///\tparam MAX_SIZE_         The maximum number of elements.
+  ///\tparam MAX_PROBE_LENGTH_ The maximum distance of an element from its ideal slot. At most 254.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_PROBE_LENGTH_ = 32U, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey> >
+  class robin_hood_unordered_set : public etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::irobin_hood_unordered_set<TKey, THash, TKeyEqual> base;
+
+    ETL_STATIC_ASSERT(MAX_PROBE_LENGTH_ <= 254U, "The maximum probe length must be no more than 254");
+
+  public:
+
+    static ETL_CONSTANT size_t MAX_SIZE         = MAX_SIZE_;
+    static ETL_CONSTANT size_t MAX_PROBE_LENGTH = MAX_PROBE_LENGTH_;
+    static ETL_CONSTANT size_t MAX_HOME_SLOTS   = private_robin_hood_unordered_set::home_slot_count<MAX_SIZE_>::value;
+    static ETL_CONSTANT size_t MAX_SLOTS        = MAX_HOME_SLOTS + MAX_PROBE_LENGTH_;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    robin_hood_unordered_set(const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(distances, slots.begin(), MAX_HOME_SLOTS, MAX_PROBE_LENGTH, MAX_SIZE, hash, equal)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    robin_hood_unordered_set(const robin_hood_unordered_set& other)
+      : base(distances, slots.begin(), MAX_HOME_SLOTS, MAX_PROBE_LENGTH, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      base::assign(other.cbegin(), other.cend());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    robin_hood_unordered_set(robin_hood_unordered_set&& other)
+      : base(distances, slots.begin(), MAX_HOME_SLOTS, MAX_PROBE_LENGTH, MAX_SIZE, other.hash_function(), other.key_eq())
+    {
+      if (this != &other)
+      {
+        base::move(other.begin(), other.end());
+      }
+    }
+#endif
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    robin_hood_unordered_set(TIterator first_, TIterator last_, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(distances, slots.begin(), MAX_HOME_SLOTS, MAX_PROBE_LENGTH, MAX_SIZE, hash, equal)
+    {
+      base::assign(first_, last_);
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    /// Construct from initializer_list.
+    //*************************************************************************
+    robin_hood_unordered_set(std::initializer_list<TKey> init, const THash& hash = THash(), const TKeyEqual& equal = TKeyEqual())
+      : base(distances, slots.begin(), MAX_HOME_SLOTS, MAX_PROBE_LENGTH, MAX_SIZE, hash, equal)
+    {
+      base::assign(init.begin(), init.end());
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~robin_hood_unordered_set()
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    robin_hood_unordered_set& operator = (const robin_hood_unordered_set& rhs)
+    {
+      base::operator=(rhs);
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    robin_hood_unordered_set& operator = (robin_hood_unordered_set&& rhs)
+    {
+      base::operator=(etl::move(rhs));
+      return *this;
+    }
+#endif
+
+  private:
+
+    /// The probe distances.
+    uint8_t distances[MAX_SLOTS];
+
+    /// The slots.
+    etl::uninitialized_buffer_of<TKey, MAX_SLOTS> slots;
+  };
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_PROBE_LENGTH_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t robin_hood_unordered_set<TKey, MAX_SIZE_, MAX_PROBE_LENGTH_, THash, TKeyEqual>::MAX_SIZE;
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_PROBE_LENGTH_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t robin_hood_unordered_set<TKey, MAX_SIZE_, MAX_PROBE_LENGTH_, THash, TKeyEqual>::MAX_PROBE_LENGTH;
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_PROBE_LENGTH_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t robin_hood_unordered_set<TKey, MAX_SIZE_, MAX_PROBE_LENGTH_, THash, TKeyEqual>::MAX_HOME_SLOTS;
+
+  template <typename TKey, const size_t MAX_SIZE_, const size_t MAX_PROBE_LENGTH_, typename THash, typename TKeyEqual>
+  ETL_CONSTANT size_t robin_hood_unordered_set<TKey, MAX_SIZE_, MAX_PROBE_LENGTH_, THash, TKeyEqual>::MAX_SLOTS;
+
+  //*************************************************************************
+  /// Template deduction guides.
+  //*************************************************************************
+#if ETL_USING_CPP17 && ETL_HAS_INITIALIZER_LIST
+  template <typename T, typename... Ts>
+  robin_hood_unordered_set(T, Ts...) -> robin_hood_unordered_set<etl::enable_if_t<(etl::is_same_v<T, Ts> && ...), T>, 1U + sizeof...(Ts)>;
+#endif
+
+  //*************************************************************************
+  /// Make
+  //*************************************************************************
+#if ETL_USING_CPP11 && ETL_HAS_INITIALIZER_LIST
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = etl::equal_to<TKey>, typename... T>
+  constexpr auto make_robin_hood_unordered_set(T&&... keys) -> etl::robin_hood_unordered_set<TKey, sizeof...(T), 32U, THash, TKeyEqual>
+  {
+    return { {etl::forward<T>(keys)...} };
+  }
+#endif
+}
+
+#endif
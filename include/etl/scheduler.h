@@ -37,6 +37,7 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "algorithm.h"
 
 #include <stdint.h>
 
@@ -222,6 +223,84 @@ namespace etl
     }
   };
 
+  //***************************************************************************
+  /// Ready Priority.
+  /// An event driven policy the scheduler can use to decide what to do next.
+  /// Tasks are not polled with task_request_work. Instead they call
+  /// set_task_ready(true) when they have work and set_task_ready(false) when
+  /// they have none left.
+  /// Calls the highest priority ready task, found from a bitmap of ready
+  /// priorities and a binary search of the task list.
+  //***************************************************************************
+  struct scheduler_policy_ready_priority
+  {
+    scheduler_policy_ready_priority()
+      : number_of_tasks(0U)
+    {
+    }
+
+    bool schedule_tasks(etl::ivector<etl::task*>& task_list)
+    {
+      // Have tasks been added since the last call?
+      if (task_list.size() != number_of_tasks)
+      {
+        ready_priorities.clear();
+
+        for (size_t index = 0UL; index < task_list.size(); ++index)
+        {
+          task_list[index]->set_task_ready_bitmap(&ready_priorities);
+        }
+
+        number_of_tasks = task_list.size();
+      }
+
+      while (ready_priorities.any())
+      {
+        const etl::task_priority_t priority = ready_priorities.highest();
+
+        // The task list is in descending priority order.
+        etl::ivector<etl::task*>::iterator itask = etl::lower_bound(task_list.begin(),
+                                                                     task_list.end(),
+                                                                     priority,
+                                                                     compare_priority());
+
+        while ((itask != task_list.end()) && ((*itask)->get_task_priority() == priority))
+        {
+          etl::task& task = **itask;
+
+          if (task.task_is_ready())
+          {
+            task.task_process_work();
+            return false;
+          }
+
+          ++itask;
+        }
+
+        // No task at this priority is ready any more.
+        ready_priorities.reset(priority);
+      }
+
+      return true;
+    }
+
+  private:
+
+    //*******************************************
+    // Used to search tasks in descending priority.
+    //*******************************************
+    struct compare_priority
+    {
+      bool operator()(etl::task* ptask, etl::task_priority_t priority) const
+      {
+        return ptask->get_task_priority() > priority;
+      }
+    };
+
+    etl::task_ready_bitmap ready_priorities;
+    size_t number_of_tasks;
+  };
+
   //***************************************************************************
   /// Scheduler base.
   //***************************************************************************
@@ -0,0 +1,305 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SCHEDULER_WORK_STEALING_INCLUDED
+#define ETL_SCHEDULER_WORK_STEALING_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "vector.h"
+#include "algorithm.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "function.h"
+#include "power.h"
+#include "scheduler.h"
+#include "task.h"
+#include "work_stealing_deque.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// 'Invalid worker' exception.
+  //***************************************************************************
+  class scheduler_invalid_worker_exception : public etl::scheduler_exception
+  {
+  public:
+
+    scheduler_invalid_worker_exception(string_type file_name_, numeric_type line_number_)
+      : etl::scheduler_exception(ETL_ERROR_TEXT("scheduler:invalid worker", ETL_SCHEDULER_WORK_STEALING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A scheduler that shares tasks between several workers, one per core.
+  /// Each task is owned by a worker. A worker polls its own tasks with
+  /// task_request_work() and pushes those with work to its own work stealing
+  /// deque. It then processes the highest priority task from the deque, or
+  /// steals the oldest, lowest priority, task from another worker's deque.
+  /// A task is never processed by more than one worker at a time.
+  /// Tasks must be added before any worker is started.
+  ///\tparam VMax_Tasks The maximum number of tasks.
+  ///\tparam VWorkers   The number of workers.
+  //***************************************************************************
+  template <size_t VMax_Tasks, size_t VWorkers>
+  class scheduler_work_stealing
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Tasks > 0U, "There must be at least one task");
+    ETL_STATIC_ASSERT(VWorkers > 0U,   "There must be at least one worker");
+
+    static ETL_CONSTANT size_t Max_Tasks = VMax_Tasks;
+    static ETL_CONSTANT size_t Workers   = VWorkers;
+
+    typedef etl::ifunction<size_t> callback_type;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    scheduler_work_stealing()
+      : scheduler_running(false)
+      , scheduler_exit(false)
+      , p_idle_callback(ETL_NULLPTR)
+      , p_watchdog_callback(ETL_NULLPTR)
+    {
+      for (size_t i = 0U; i < VMax_Tasks; ++i)
+      {
+        queued[i].store(false);
+      }
+    }
+
+    //*******************************************
+    /// Set the idle callback.
+    /// Called with the index of a worker that found no work.
+    //*******************************************
+    void set_idle_callback(callback_type& callback)
+    {
+      p_idle_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the watchdog callback.
+    /// Called with the index of the worker after each scheduling cycle.
+    //*******************************************
+    void set_watchdog_callback(callback_type& callback)
+    {
+      p_watchdog_callback = &callback;
+    }
+
+    //*******************************************
+    /// Set the running state for the scheduler.
+    //*******************************************
+    void set_scheduler_running(bool scheduler_running_)
+    {
+      scheduler_running.store(scheduler_running_);
+    }
+
+    //*******************************************
+    /// Get the running state for the scheduler.
+    //*******************************************
+    bool scheduler_is_running() const
+    {
+      return scheduler_running.load();
+    }
+
+    //*******************************************
+    /// Force all of the workers to exit.
+    //*******************************************
+    void exit_scheduler()
+    {
+      scheduler_exit.store(true);
+    }
+
+    //*******************************************
+    /// Add a task, owned by a worker.
+    /// Added to the task list in priority order.
+    //*******************************************
+    void add_task(etl::task& task, size_t worker)
+    {
+      ETL_ASSERT(!task_list.full(), ETL_ERROR(etl::scheduler_too_many_tasks_exception));
+      ETL_ASSERT(worker < VWorkers, ETL_ERROR(etl::scheduler_invalid_worker_exception));
+
+      if (!task_list.full() && (worker < VWorkers))
+      {
+        const task_entry entry = { &task, worker };
+
+        typename task_list_t::iterator itask = etl::upper_bound(task_list.begin(),
+                                                                 task_list.end(),
+                                                                 task.get_task_priority(),
+                                                                 compare_priority());
+
+        task_list.insert(itask, entry);
+
+        task.on_task_added();
+      }
+    }
+
+    //*******************************************
+    /// Add a task list, sharing the tasks between the workers in turn.
+    //*******************************************
+    template <typename TSize>
+    void add_task_list(etl::task** p_tasks, TSize size)
+    {
+      for (TSize i = 0; i < size; ++i)
+      {
+        ETL_ASSERT((p_tasks[i] != ETL_NULLPTR), ETL_ERROR(etl::scheduler_null_task_exception));
+        add_task(*(p_tasks[i]), size_t(i) % VWorkers);
+      }
+    }
+
+    //*******************************************
+    /// Runs a worker until exit_scheduler is called.
+    /// Call once from each core, with a different worker index.
+    //*******************************************
+    void start(size_t worker)
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+      ETL_ASSERT(worker < VWorkers, ETL_ERROR(etl::scheduler_invalid_worker_exception));
+
+      scheduler_running.store(true);
+
+      while (!scheduler_exit.load())
+      {
+        if (scheduler_running.load())
+        {
+          schedule(worker);
+        }
+      }
+    }
+
+    //*******************************************
+    /// Runs one scheduling cycle for a worker.
+    /// Returns true if the worker was idle.
+    //*******************************************
+    bool schedule(size_t worker)
+    {
+      // Queue the worker's own tasks that have work, lowest priority first,
+      // so that the owner pops the highest priority and thieves steal the lowest.
+      for (size_t index = task_list.size(); index != 0U; --index)
+      {
+        const task_entry& entry = task_list[index - 1U];
+
+        if ((entry.worker == worker) && !queued[index - 1U].load(etl::memory_order_acquire))
+        {
+          if (entry.p_task->task_request_work() > 0)
+          {
+            queued[index - 1U].store(true, etl::memory_order_relaxed);
+            deques[worker].push(index - 1U);
+          }
+        }
+      }
+
+      size_t index;
+      bool found = deques[worker].pop(index);
+
+      // Try to steal some work.
+      for (size_t i = 1U; !found && (i < VWorkers); ++i)
+      {
+        found = deques[(worker + i) % VWorkers].steal(index);
+      }
+
+      if (found)
+      {
+        task_list[index].p_task->task_process_work();
+        queued[index].store(false, etl::memory_order_release);
+      }
+
+      if (p_watchdog_callback)
+      {
+        (*p_watchdog_callback)(worker);
+      }
+
+      if (!found && p_idle_callback)
+      {
+        (*p_idle_callback)(worker);
+      }
+
+      return !found;
+    }
+
+    //*******************************************
+    /// The number of tasks.
+    //*******************************************
+    size_t size() const
+    {
+      return task_list.size();
+    }
+
+  private:
+
+    //*******************************************
+    struct task_entry
+    {
+      etl::task* p_task;
+      size_t     worker;
+    };
+
+    //*******************************************
+    // Used to order tasks in descending priority.
+    //*******************************************
+    struct compare_priority
+    {
+      bool operator()(etl::task_priority_t priority, const task_entry& entry) const
+      {
+        return priority > entry.p_task->get_task_priority();
+      }
+    };
+
+    typedef etl::vector<task_entry, VMax_Tasks> task_list_t;
+
+    // Each task can only be queued once, so a deque never needs more room than the task list.
+    typedef etl::work_stealing_deque<size_t, etl::power_of_2_round_up<VMax_Tasks>::value> deque_t;
+
+    task_list_t            task_list;
+    deque_t                deques[VWorkers];
+    etl::atomic<bool>      queued[VMax_Tasks];
+    etl::atomic<bool>      scheduler_running;
+    etl::atomic<bool>      scheduler_exit;
+    callback_type*         p_idle_callback;
+    callback_type*         p_watchdog_callback;
+  };
+
+  template <size_t VMax_Tasks, size_t VWorkers>
+  ETL_CONSTANT size_t scheduler_work_stealing<VMax_Tasks, VWorkers>::Max_Tasks;
+
+  template <size_t VMax_Tasks, size_t VWorkers>
+  ETL_CONSTANT size_t scheduler_work_stealing<VMax_Tasks, VWorkers>::Workers;
+}
+
+#endif
+#endif
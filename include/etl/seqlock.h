@@ -0,0 +1,204 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SEQLOCK_INCLUDED
+#define ETL_SEQLOCK_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A sequence lock for publishing a trivially copyable value to many readers.
+  /// The writer never waits for readers. A reader copies the value and retries
+  /// if the writer changed it during the copy, so reads are lock free but not wait free.
+  ///
+  /// There must only be one writer at a time.
+  /// A reader in an interrupt that can preempt the writer must use try_read,
+  /// as read would never see the write complete.
+  ///
+  /// The value is held as an array of atomic words, so that the copies made
+  /// by the readers and the writer are not data races.
+  ///\tparam T The trivially copyable type of the value.
+  //***************************************************************************
+  template <typename T>
+  class seqlock
+  {
+    ETL_STATIC_ASSERT(etl::is_trivially_copyable<T>::value, "seqlock requires a trivially copyable type");
+
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor. The value is zero initialised.
+    //*************************************************************************
+    seqlock()
+      : sequence(0U)
+    {
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        words[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructor, from an initial value.
+    //*************************************************************************
+    explicit seqlock(const T& value)
+      : sequence(0U)
+    {
+      store_words(value);
+    }
+
+    //*************************************************************************
+    /// Publishes a new value.
+    //*************************************************************************
+    void write(const T& value)
+    {
+      const uint32_t current = sequence.load(etl::memory_order_relaxed);
+
+      // An odd sequence marks a write in progress.
+      sequence.store(current + 1U, etl::memory_order_relaxed);
+      etl::atomic_thread_fence(etl::memory_order_release);
+
+      store_words(value);
+
+      sequence.store(current + 2U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Makes one attempt to read the value.
+    ///\return <b>true</b> if the value was read, <b>false</b> if a write was in progress.
+    //*************************************************************************
+    bool try_read(T& value) const
+    {
+      const uint32_t before = sequence.load(etl::memory_order_acquire);
+
+      if ((before & 1U) != 0U)
+      {
+        return false;
+      }
+
+      word_type copy[Number_Of_Words];
+
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        copy[i] = words[i].load(etl::memory_order_relaxed);
+      }
+
+      etl::atomic_thread_fence(etl::memory_order_acquire);
+
+      const uint32_t after = sequence.load(etl::memory_order_relaxed);
+
+      if (before != after)
+      {
+        return false;
+      }
+
+      memcpy(&value, copy, sizeof(T));
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Reads the value, retrying until no write overlaps the copy.
+    //*************************************************************************
+    void read(T& value) const
+    {
+      while (!try_read(value))
+      {
+      }
+    }
+
+    //*************************************************************************
+    /// Reads the value, retrying until no write overlaps the copy.
+    //*************************************************************************
+    T read() const
+    {
+      T value;
+      read(value);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Gets the sequence number. It increases by two for each completed write.
+    //*************************************************************************
+    uint32_t get_sequence() const
+    {
+      return sequence.load(etl::memory_order_acquire);
+    }
+
+  private:
+
+    typedef uint32_t word_type;
+
+    static ETL_CONSTANT size_t Number_Of_Words = (sizeof(T) + sizeof(word_type) - 1U) / sizeof(word_type);
+
+    //*************************************************************************
+    /// Copies a value in to the atomic words.
+    //*************************************************************************
+    void store_words(const T& value)
+    {
+      word_type copy[Number_Of_Words];
+
+      copy[Number_Of_Words - 1U] = 0U;
+      memcpy(copy, &value, sizeof(T));
+
+      for (size_t i = 0U; i < Number_Of_Words; ++i)
+      {
+        words[i].store(copy[i], etl::memory_order_relaxed);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    seqlock(const seqlock&) ETL_DELETE;
+    seqlock& operator =(const seqlock&) ETL_DELETE;
+
+    etl::atomic<uint32_t>  sequence;
+    etl::atomic<word_type> words[Number_Of_Words];
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t seqlock<T>::Number_Of_Words;
+}
+
+#endif
+#endif
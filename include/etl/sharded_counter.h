@@ -0,0 +1,174 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARDED_COUNTER_INCLUDED
+#define ETL_SHARDED_COUNTER_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A counter that is split in to a number of shards, one for each core.
+  /// Each shard is padded to ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE, so
+  /// that cores incrementing their own shard do not contend for a cache line.
+  /// Reading sums the shards, so it is slower than incrementing, and is not a
+  /// snapshot of a single instant.
+  ///\tparam VShards The number of shards, usually the number of cores.
+  ///\tparam T       The integral type of the count.
+  //***************************************************************************
+  template <size_t VShards, typename T = uint32_t>
+  class sharded_counter
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VShards > 0U, "There must be at least one shard");
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value, "Only integral counts allowed");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t Shards = VShards;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    sharded_counter()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Adds to a shard.
+    ///\param shard The caller's shard, such as the core number.
+    //*************************************************************************
+    void add(size_t shard, value_type n)
+    {
+      shards[shard].value.fetch_add(n, etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Adds one to a shard.
+    ///\param shard The caller's shard, such as the core number.
+    //*************************************************************************
+    void increment(size_t shard)
+    {
+      add(shard, value_type(1));
+    }
+
+    //*************************************************************************
+    /// Gets the sum of all of the shards.
+    //*************************************************************************
+    value_type load() const
+    {
+      value_type sum = value_type(0);
+
+      for (size_t i = 0U; i < VShards; ++i)
+      {
+        sum = value_type(sum + shards[i].value.load(etl::memory_order_relaxed));
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Gets the count of one shard.
+    //*************************************************************************
+    value_type load(size_t shard) const
+    {
+      return shards[shard].value.load(etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Gets the sum of all of the shards and sets them to zero.
+    /// No count is lost, or counted twice, if the shards are added to at the same time.
+    //*************************************************************************
+    value_type exchange_zero()
+    {
+      value_type sum = value_type(0);
+
+      for (size_t i = 0U; i < VShards; ++i)
+      {
+        sum = value_type(sum + shards[i].value.exchange(value_type(0), etl::memory_order_relaxed));
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Sets all of the shards to zero.
+    //*************************************************************************
+    void reset()
+    {
+      for (size_t i = 0U; i < VShards; ++i)
+      {
+        shards[i].value.store(value_type(0), etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of shards.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return VShards;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A shard, padded so that it does not share a cache line with another.
+    //*************************************************************************
+    struct shard_type
+    {
+      etl::atomic<value_type> value;
+      char                    padding[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+    };
+
+    shard_type shards[VShards];
+
+    // Disabled.
+    sharded_counter(const sharded_counter&) ETL_DELETE;
+    sharded_counter& operator =(const sharded_counter&) ETL_DELETE;
+  };
+
+  template <size_t VShards, typename T>
+  ETL_CONSTANT size_t sharded_counter<VShards, T>::Shards;
+}
+
+#endif
+#endif
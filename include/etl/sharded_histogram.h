@@ -0,0 +1,210 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARDED_HISTOGRAM_INCLUDED
+#define ETL_SHARDED_HISTOGRAM_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "histogram.h"
+#include "type_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A histogram that is split in to a number of shards, one for each core.
+  /// Each core adds to its own shard, and the shards are merged in to an
+  /// etl::histogram when read. The shards are separated by
+  /// ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE, so cores do not contend for
+  /// a cache line.
+  ///\tparam TKey     The integral key type.
+  ///\tparam TCount   The integral count type.
+  ///\tparam Max_Size The number of bins.
+  ///\tparam VShards  The number of shards, usually the number of cores.
+  //***************************************************************************
+  template <typename TKey, typename TCount, size_t Max_Size, size_t VShards>
+  class sharded_histogram
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<TKey>::value, "Only integral keys allowed");
+    ETL_STATIC_ASSERT(etl::is_integral<TCount>::value, "Only integral count allowed");
+    ETL_STATIC_ASSERT(VShards > 0U, "There must be at least one shard");
+
+    typedef TKey   key_type;
+    typedef TCount count_type;
+    typedef TCount value_type;
+
+    static ETL_CONSTANT size_t Shards = VShards;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param start_index_ The key of the first bin.
+    //*************************************************************************
+    explicit sharded_histogram(key_type start_index_ = key_type(0))
+      : start_index(start_index_)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a key to a shard.
+    ///\param shard The caller's shard, such as the core number.
+    //*************************************************************************
+    void add(size_t shard, key_type key)
+    {
+      shards[shard].bins[key - start_index].fetch_add(count_type(1), etl::memory_order_relaxed);
+    }
+
+    //*************************************************************************
+    /// Gets the count for a bin, summed over all of the shards.
+    /// As with etl::histogram, the index is that of the bin, not the key.
+    //*************************************************************************
+    count_type operator [](size_t index) const
+    {
+      count_type sum = count_type(0);
+
+      for (size_t s = 0U; s < VShards; ++s)
+      {
+        sum = count_type(sum + shards[s].bins[index].load(etl::memory_order_relaxed));
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Adds the counts of all of the shards to a histogram.
+    /// 'result' must have the same start index.
+    //*************************************************************************
+    template <typename THistogram>
+    void merge_into(THistogram& result) const
+    {
+      ETL_STATIC_ASSERT(THistogram::Max_Size == Max_Size, "Histograms are different sizes");
+
+      for (size_t s = 0U; s < VShards; ++s)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          result.add_to_bin(i, shards[s].bins[i].load(etl::memory_order_relaxed));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the merged histogram.
+    //*************************************************************************
+    etl::histogram<TKey, TCount, Max_Size> load() const
+    {
+      etl::histogram<TKey, TCount, Max_Size> result(start_index);
+
+      merge_into(result);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Gets the number of keys added, over all of the shards.
+    //*************************************************************************
+    size_t count() const
+    {
+      size_t sum = 0U;
+
+      for (size_t s = 0U; s < VShards; ++s)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          sum += size_t(shards[s].bins[i].load(etl::memory_order_relaxed));
+        }
+      }
+
+      return sum;
+    }
+
+    //*************************************************************************
+    /// Sets all of the counts to zero.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t s = 0U; s < VShards; ++s)
+      {
+        for (size_t i = 0U; i < Max_Size; ++i)
+        {
+          shards[s].bins[i].store(count_type(0), etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the number of bins.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return Max_Size;
+    }
+
+    //*************************************************************************
+    /// Gets the key of the first bin.
+    //*************************************************************************
+    key_type get_start_index() const
+    {
+      return start_index;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A shard, padded so that it does not share a cache line with another.
+    //*************************************************************************
+    struct shard_type
+    {
+      etl::atomic<count_type> bins[Max_Size];
+      char                    padding[ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE];
+    };
+
+    const key_type start_index;
+    shard_type     shards[VShards];
+
+    // Disabled.
+    sharded_histogram(const sharded_histogram&) ETL_DELETE;
+    sharded_histogram& operator =(const sharded_histogram&) ETL_DELETE;
+  };
+
+  template <typename TKey, typename TCount, size_t Max_Size, size_t VShards>
+  ETL_CONSTANT size_t sharded_histogram<TKey, TCount, Max_Size, VShards>::Shards;
+}
+
+#endif
+#endif
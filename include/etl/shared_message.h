@@ -39,12 +39,17 @@ SOFTWARE.
 #include "type_traits.h"
 #include "static_assert.h"
 
+#include <stddef.h>
+
 //*****************************************************************************
 /// A wrapper for reference counted messages.
 /// Contains pointers to a pool owner and a message defined with a ref count type.
 //*****************************************************************************
 namespace etl
 {
+  template <size_t VMax_Messages>
+  class shared_message_release_batch;
+
   class shared_message
   {
   public:
@@ -185,12 +190,143 @@ namespace etl
       return p_rcmessage != ETL_NULLPTR;
     }
 
+    //*************************************************************************
+    /// Adds n references in one operation, to be used by borrowed_copy().
+    /// Every borrowed reference must be used by exactly one borrowed_copy(),
+    /// or the message will never be released.
+    //*************************************************************************
+    void borrow_references(uint32_t n)
+    {
+      p_rcmessage->get_reference_counter().add_reference_count(int32_t(n));
+    }
+
+    //*************************************************************************
+    /// Makes a copy that uses a reference taken by borrow_references(),
+    /// so the reference count is not touched.
+    //*************************************************************************
+    ETL_NODISCARD shared_message borrowed_copy() const
+    {
+      return shared_message(p_rcmessage);
+    }
+
   private:
 
+    template <size_t VMax_Messages>
+    friend class shared_message_release_batch;
+
+    //*************************************************************************
+    /// Constructor for a copy that has already been counted.
+    //*************************************************************************
+    explicit shared_message(etl::ireference_counted_message* p_rcmessage_)
+      : p_rcmessage(p_rcmessage_)
+    {
+    }
+
     shared_message() ETL_DELETE;
 
     etl::ireference_counted_message* p_rcmessage; ///< A pointer to the reference  counted message.
   };
+
+  //***************************************************************************
+  /// Collects the shared messages whose last reference has gone and returns
+  /// them to their pool together, under a single lock.
+  /// The messages must all come from the pool given to the constructor.
+  /// Messages are returned when the batch is full, when flush() is called,
+  /// and when the batch is destroyed.
+  ///\tparam VMax_Messages The number of messages held before the batch is flushed.
+  //***************************************************************************
+  template <size_t VMax_Messages>
+  class shared_message_release_batch
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Messages > 0U, "Zero size batch");
+
+    static ETL_CONSTANT size_t Max_Messages = VMax_Messages;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit shared_message_release_batch(etl::ireference_counted_message_pool& pool_)
+      : pool(pool_)
+      , count(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Returns any collected messages.
+    //*************************************************************************
+    ~shared_message_release_batch()
+    {
+      flush();
+    }
+
+    //*************************************************************************
+    /// Drops the reference held by the shared message.
+    /// If it was the last one, the message is kept to be returned with the batch.
+    /// The shared message is no longer valid afterwards.
+    //*************************************************************************
+    void release(etl::shared_message& shared_msg)
+    {
+      etl::ireference_counted_message* p_rcmessage = shared_msg.p_rcmessage;
+
+      if (p_rcmessage != ETL_NULLPTR)
+      {
+        shared_msg.p_rcmessage = ETL_NULLPTR;
+
+        if (p_rcmessage->get_reference_counter().decrement_reference_count() == 0U)
+        {
+          if (count == VMax_Messages)
+          {
+            flush();
+          }
+
+          messages[count++] = p_rcmessage;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the collected messages to the pool.
+    //*************************************************************************
+    void flush()
+    {
+      if (count != 0U)
+      {
+        pool.release_batch(messages, count);
+        count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// The number of messages waiting to be returned.
+    //*************************************************************************
+    size_t size() const
+    {
+      return count;
+    }
+
+    //*************************************************************************
+    /// Are there no messages waiting to be returned?
+    //*************************************************************************
+    bool empty() const
+    {
+      return count == 0U;
+    }
+
+  private:
+
+    // Should not be copied.
+    shared_message_release_batch(const shared_message_release_batch&) ETL_DELETE;
+    shared_message_release_batch& operator =(const shared_message_release_batch&) ETL_DELETE;
+
+    etl::ireference_counted_message_pool& pool;
+    size_t                                count;
+    etl::ireference_counted_message*      messages[VMax_Messages];
+  };
+
+  template <size_t VMax_Messages>
+  ETL_CONSTANT size_t shared_message_release_batch<VMax_Messages>::Max_Messages;
 }
 
 #endif
@@ -0,0 +1,646 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SHARED_STRING_INCLUDED
+#define ETL_SHARED_STRING_INCLUDED
+
+#include "platform.h"
+#include "string.h"
+#include "string_view.h"
+#include "pool.h"
+#include "reference_counted_object.h"
+#include "atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "file_error_numbers.h"
+#include "placement_new.h"
+#include "utility.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+/// Strings with reference counted payloads, allocated from a pool.
+/// Copies share the payload, and a copy is only made when one is changed.
+//*****************************************************************************
+namespace etl
+{
+  //***************************************************************************
+  /// Exception type for etl::shared_string
+  //***************************************************************************
+  class shared_string_exception : public etl::exception
+  {
+  public:
+
+    shared_string_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception if a payload could not be allocated.
+  //***************************************************************************
+  class shared_string_allocation_failure : public etl::shared_string_exception
+  {
+  public:
+
+    shared_string_allocation_failure(string_type file_name_, numeric_type line_number_)
+      : shared_string_exception(ETL_ERROR_TEXT("shared_string:allocation failure", ETL_SHARED_STRING_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  class ishared_string_pool;
+
+  //***************************************************************************
+  /// The part of a pooled string that the shared_string sees.
+  //***************************************************************************
+  class shared_string_payload
+  {
+  public:
+
+    shared_string_payload(etl::ireference_counter& counter_, etl::istring& text_, etl::ishared_string_pool& owner_)
+      : counter(counter_)
+      , text(text_)
+      , owner(owner_)
+    {
+    }
+
+    etl::ireference_counter&  counter;
+    etl::istring&             text;
+    etl::ishared_string_pool& owner;
+
+  private:
+
+    shared_string_payload(const shared_string_payload&) ETL_DELETE;
+    shared_string_payload& operator =(const shared_string_payload&) ETL_DELETE;
+  };
+
+  //***************************************************************************
+  /// Interface for a pool of shared string payloads.
+  //***************************************************************************
+  class ishared_string_pool
+  {
+  public:
+
+    virtual ~ishared_string_pool() {}
+
+    //*************************************************************************
+    /// Allocates a payload with an empty string and a reference count of one.
+    /// Returns ETL_NULLPTR if the pool is empty.
+    //*************************************************************************
+    virtual etl::shared_string_payload* allocate() = 0;
+
+    //*************************************************************************
+    /// Returns a payload to the pool.
+    //*************************************************************************
+    virtual void release(etl::shared_string_payload& payload) = 0;
+
+  protected:
+
+    //*************************************************************************
+    /// The pool lock function.
+    /// Override to add thread or interrupt locking to the pool.
+    //*************************************************************************
+    virtual void lock()
+    {
+      // The default implementation does nothing.
+    }
+
+    //*************************************************************************
+    /// The pool unlock function.
+    /// Override to add thread or interrupt unlocking to the pool.
+    //*************************************************************************
+    virtual void unlock()
+    {
+      // The default implementation does nothing.
+    }
+  };
+
+  //***************************************************************************
+  /// A pool of VSize strings of VCapacity characters, each with a counter.
+  /// The counter must be atomic if the copies of a string are used by more
+  /// than one thread, and lock() and unlock() overridden if the strings are
+  /// created or destroyed by more than one thread.
+  ///\tparam VCapacity The capacity of each string.
+  ///\tparam VSize     The number of strings in the pool.
+  ///\tparam TCounter  The type of the reference count.
+  //***************************************************************************
+  template <size_t VCapacity, size_t VSize, typename TCounter = int32_t>
+  class shared_string_pool : public etl::ishared_string_pool
+  {
+  public:
+
+    static ETL_CONSTANT size_t Capacity = VCapacity;
+    static ETL_CONSTANT size_t Size     = VSize;
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    shared_string_pool()
+    {
+    }
+
+    //*************************************************************************
+    /// Allocates a payload with an empty string and a reference count of one.
+    /// Returns ETL_NULLPTR if the pool is empty.
+    //*************************************************************************
+    etl::shared_string_payload* allocate() ETL_OVERRIDE
+    {
+      node* p = ETL_NULLPTR;
+
+      lock();
+      if (!pool.full())
+      {
+        p = pool.allocate();
+      }
+      unlock();
+
+      if (p != ETL_NULLPTR)
+      {
+        ::new (p) node(*this);
+        p->counter_storage.set_reference_count(1);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Returns a payload to the pool.
+    //*************************************************************************
+    void release(etl::shared_string_payload& payload) ETL_OVERRIDE
+    {
+      node* p = static_cast<node*>(&payload);
+
+      p->~node();
+
+      lock();
+      pool.release(p);
+      unlock();
+    }
+
+    //*************************************************************************
+    /// The number of strings that can still be allocated.
+    //*************************************************************************
+    size_t available() const
+    {
+      return pool.available();
+    }
+
+    //*************************************************************************
+    /// The number of strings allocated.
+    //*************************************************************************
+    size_t size() const
+    {
+      return pool.size();
+    }
+
+    //*************************************************************************
+    /// Checks if no strings are allocated.
+    //*************************************************************************
+    bool empty() const
+    {
+      return pool.empty();
+    }
+
+    //*************************************************************************
+    /// Checks if all of the strings are allocated.
+    //*************************************************************************
+    bool full() const
+    {
+      return pool.full();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The string and its counter.
+    //*************************************************************************
+    struct node : public etl::shared_string_payload
+    {
+      explicit node(etl::ishared_string_pool& owner_)
+        : shared_string_payload(counter_storage, text_storage, owner_)
+      {
+      }
+
+      etl::reference_counter<TCounter> counter_storage;
+      etl::string<VCapacity>           text_storage;
+    };
+
+    etl::pool<node, VSize> pool;
+
+    shared_string_pool(const shared_string_pool&) ETL_DELETE;
+    shared_string_pool& operator =(const shared_string_pool&) ETL_DELETE;
+  };
+
+  template <size_t VCapacity, size_t VSize, typename TCounter>
+  ETL_CONSTANT size_t shared_string_pool<VCapacity, VSize, TCounter>::Capacity;
+
+  template <size_t VCapacity, size_t VSize, typename TCounter>
+  ETL_CONSTANT size_t shared_string_pool<VCapacity, VSize, TCounter>::Size;
+
+#if ETL_USING_CPP11 && ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// A pool with atomic counters, for strings shared between threads.
+  //***************************************************************************
+  template <size_t VCapacity, size_t VSize>
+  using atomic_shared_string_pool = etl::shared_string_pool<VCapacity, VSize, etl::atomic_int32_t>;
+#endif
+
+  //***************************************************************************
+  /// A string whose payload is shared with its copies.
+  /// Copying is O(1), as only the reference count changes. Changing a string
+  /// that has copies first gives it a payload of its own, from the same pool.
+  /// Each shared_string object must be used by only one thread at a time.
+  //***************************************************************************
+  class shared_string
+  {
+  public:
+
+    typedef etl::istring::value_type      value_type;
+    typedef etl::istring::size_type       size_type;
+    typedef etl::istring::const_reference const_reference;
+    typedef etl::istring::const_pointer   const_pointer;
+    typedef etl::istring::const_iterator  const_iterator;
+
+    //*************************************************************************
+    /// Constructs an empty string.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure if the pool is empty.
+    //*************************************************************************
+    explicit shared_string(etl::ishared_string_pool& pool)
+      : p_payload(pool.allocate())
+    {
+      ETL_ASSERT(p_payload != ETL_NULLPTR, ETL_ERROR(etl::shared_string_allocation_failure));
+    }
+
+    //*************************************************************************
+    /// Constructs from a null terminated string.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure if the pool is empty.
+    //*************************************************************************
+    shared_string(etl::ishared_string_pool& pool, const_pointer text)
+      : p_payload(pool.allocate())
+    {
+      ETL_ASSERT(p_payload != ETL_NULLPTR, ETL_ERROR(etl::shared_string_allocation_failure));
+
+      if (p_payload != ETL_NULLPTR)
+      {
+        p_payload->text.assign(text);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from a string view.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure if the pool is empty.
+    //*************************************************************************
+    shared_string(etl::ishared_string_pool& pool, const etl::string_view& text)
+      : p_payload(pool.allocate())
+    {
+      ETL_ASSERT(p_payload != ETL_NULLPTR, ETL_ERROR(etl::shared_string_allocation_failure));
+
+      if (p_payload != ETL_NULLPTR)
+      {
+        p_payload->text.assign(text.begin(), text.end());
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from a string.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure if the pool is empty.
+    //*************************************************************************
+    shared_string(etl::ishared_string_pool& pool, const etl::istring& text)
+      : p_payload(pool.allocate())
+    {
+      ETL_ASSERT(p_payload != ETL_NULLPTR, ETL_ERROR(etl::shared_string_allocation_failure));
+
+      if (p_payload != ETL_NULLPTR)
+      {
+        p_payload->text.assign(text);
+      }
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Shares the payload.
+    //*************************************************************************
+    shared_string(const shared_string& other)
+      : p_payload(other.p_payload)
+    {
+      add_reference();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    shared_string(shared_string&& other) ETL_NOEXCEPT
+      : p_payload(other.p_payload)
+    {
+      other.p_payload = ETL_NULLPTR;
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns the payload to its pool if this is the last copy.
+    //*************************************************************************
+    ~shared_string()
+    {
+      remove_reference();
+    }
+
+    //*************************************************************************
+    /// Copy assignment.
+    /// Shares the payload.
+    //*************************************************************************
+    shared_string& operator =(const shared_string& other)
+    {
+      if (p_payload != other.p_payload)
+      {
+        remove_reference();
+        p_payload = other.p_payload;
+        add_reference();
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment.
+    //*************************************************************************
+    shared_string& operator =(shared_string&& other) ETL_NOEXCEPT
+    {
+      if (&other != this)
+      {
+        remove_reference();
+        p_payload       = other.p_payload;
+        other.p_payload = ETL_NULLPTR;
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    /// Checks if the string has a payload.
+    /// False if the allocation failed, or the string has been moved from.
+    //*************************************************************************
+    ETL_NODISCARD bool is_valid() const
+    {
+      return p_payload != ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The number of strings sharing the payload.
+    //*************************************************************************
+    ETL_NODISCARD int32_t use_count() const
+    {
+      return (p_payload != ETL_NULLPTR) ? p_payload->counter.get_reference_count() : 0;
+    }
+
+    //*************************************************************************
+    /// Checks if the payload is not shared.
+    //*************************************************************************
+    ETL_NODISCARD bool is_unique() const
+    {
+      return use_count() == 1;
+    }
+
+    //*************************************************************************
+    /// Checks if two strings share a payload.
+    //*************************************************************************
+    ETL_NODISCARD bool shares_with(const shared_string& other) const
+    {
+      return (p_payload != ETL_NULLPTR) && (p_payload == other.p_payload);
+    }
+
+    //*************************************************************************
+    /// Gets the string.
+    //*************************************************************************
+    ETL_NODISCARD const etl::istring& str() const
+    {
+      return p_payload->text;
+    }
+
+    //*************************************************************************
+    /// Gets a view of the string.
+    //*************************************************************************
+    ETL_NODISCARD etl::string_view view() const
+    {
+      return etl::string_view(p_payload->text.data(), p_payload->text.size());
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD const_pointer c_str() const
+    {
+      return p_payload->text.c_str();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD const_pointer data() const
+    {
+      return p_payload->text.data();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD size_type size() const
+    {
+      return p_payload->text.size();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD size_type length() const
+    {
+      return p_payload->text.length();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD bool empty() const
+    {
+      return p_payload->text.empty();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD size_type capacity() const
+    {
+      return p_payload->text.capacity();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD const_iterator begin() const
+    {
+      return p_payload->text.begin();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD const_iterator end() const
+    {
+      return p_payload->text.end();
+    }
+
+    //*************************************************************************
+    ETL_NODISCARD const_reference operator [](size_type i) const
+    {
+      return p_payload->text[i];
+    }
+
+    //*************************************************************************
+    /// Gives the string a payload of its own, copying the text, if it is shared.
+    /// Returns false if the pool is empty, in which case the string is unchanged.
+    //*************************************************************************
+    bool make_unique()
+    {
+      if (p_payload == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      if (is_unique())
+      {
+        return true;
+      }
+
+      etl::shared_string_payload* p_new = p_payload->owner.allocate();
+
+      if (p_new == ETL_NULLPTR)
+      {
+        return false;
+      }
+
+      p_new->text.assign(p_payload->text);
+
+      remove_reference();
+      p_payload = p_new;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets the string to change it, copying it first if it is shared.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure
+    /// if a copy was needed and the pool is empty. Call make_unique() first to
+    /// handle that without an error.
+    //*************************************************************************
+    etl::istring& edit()
+    {
+      const bool unique = make_unique();
+
+      ETL_ASSERT(unique, ETL_ERROR(etl::shared_string_allocation_failure));
+      (void)unique;
+
+      return p_payload->text;
+    }
+
+    //*************************************************************************
+    /// Gets an empty string to write new text to.
+    /// The old text is not copied, even if it is shared.
+    /// If asserts or exceptions are enabled, emits shared_string_allocation_failure
+    /// if the string is shared and the pool is empty.
+    //*************************************************************************
+    etl::istring& overwrite()
+    {
+      if (!is_unique())
+      {
+        etl::shared_string_payload* p_new = p_payload->owner.allocate();
+
+        ETL_ASSERT(p_new != ETL_NULLPTR, ETL_ERROR(etl::shared_string_allocation_failure));
+
+        if (p_new != ETL_NULLPTR)
+        {
+          remove_reference();
+          p_payload = p_new;
+        }
+      }
+
+      p_payload->text.clear();
+
+      return p_payload->text;
+    }
+
+  private:
+
+    //*************************************************************************
+    void add_reference()
+    {
+      if (p_payload != ETL_NULLPTR)
+      {
+        p_payload->counter.increment_reference_count();
+      }
+    }
+
+    //*************************************************************************
+    void remove_reference()
+    {
+      if ((p_payload != ETL_NULLPTR) && (p_payload->counter.decrement_reference_count() == 0))
+      {
+        p_payload->owner.release(*p_payload);
+      }
+
+      p_payload = ETL_NULLPTR;
+    }
+
+    etl::shared_string_payload* p_payload;
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  //***************************************************************************
+  inline bool operator ==(const etl::shared_string& lhs, const etl::shared_string& rhs)
+  {
+    return lhs.shares_with(rhs) || (lhs.view() == rhs.view());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  //***************************************************************************
+  inline bool operator !=(const etl::shared_string& lhs, const etl::shared_string& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Equal operator.
+  //***************************************************************************
+  inline bool operator ==(const etl::shared_string& lhs, const etl::string_view& rhs)
+  {
+    return lhs.view() == rhs;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  //***************************************************************************
+  inline bool operator !=(const etl::shared_string& lhs, const etl::string_view& rhs)
+  {
+    return !(lhs == rhs);
+  }
+}
+
+#endif
@@ -0,0 +1,315 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+#define ETL_SIZE_CLASS_MEMORY_BLOCK_ALLOCATOR_INCLUDED
+
+#include "platform.h"
+#include "imemory_block_allocator.h"
+#include "alignment.h"
+#include "bit.h"
+#include "log.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace etl
+{
+  //*************************************************************************
+  /// A memory block allocator that serves several power of two size classes
+  /// from one buffer. Class 0 has blocks of VMin_Block_Size, each following
+  /// class doubles the block size, up to VMax_Block_Size.
+  /// Each class has VBlocks_Per_Class blocks.
+  /// The class for a requested size, and the class that owns a released block,
+  /// are both found in constant time from the bit width of the value.
+  /// If a class has no free blocks then the next larger class is tried.
+  ///\tparam VMin_Block_Size  The block size of the smallest class. Must be a power of two.
+  ///\tparam VMax_Block_Size  The block size of the largest class. Must be a power of two.
+  ///\tparam VAlignment       The alignment of every block. Must divide VMin_Block_Size.
+  ///\tparam VBlocks_Per_Class The number of blocks in each class.
+  //*************************************************************************
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  class size_class_memory_block_allocator : public imemory_block_allocator
+  {
+  public:
+
+    ETL_STATIC_ASSERT((VMin_Block_Size & (VMin_Block_Size - 1U)) == 0U, "Minimum block size must be a power of two");
+    ETL_STATIC_ASSERT((VMax_Block_Size & (VMax_Block_Size - 1U)) == 0U, "Maximum block size must be a power of two");
+    ETL_STATIC_ASSERT(VMin_Block_Size <= VMax_Block_Size, "Minimum block size must not be larger than the maximum");
+    ETL_STATIC_ASSERT(VMin_Block_Size >= sizeof(char*), "Minimum block size must be able to hold a pointer");
+    ETL_STATIC_ASSERT((VAlignment > 0U) && ((VMin_Block_Size % VAlignment) == 0U), "Alignment must divide the minimum block size");
+    ETL_STATIC_ASSERT(VBlocks_Per_Class > 0U, "Blocks per class must be greater than zero");
+
+    static ETL_CONSTANT size_t Min_Block_Size    = VMin_Block_Size;
+    static ETL_CONSTANT size_t Max_Block_Size    = VMax_Block_Size;
+    static ETL_CONSTANT size_t Alignment         = VAlignment;
+    static ETL_CONSTANT size_t Blocks_Per_Class  = VBlocks_Per_Class;
+    static ETL_CONSTANT size_t Number_Of_Classes = etl::log2<VMax_Block_Size>::value - etl::log2<VMin_Block_Size>::value + 1U;
+
+    //*************************************************************************
+    /// Default constructor
+    //*************************************************************************
+    size_class_memory_block_allocator()
+    {
+      for (size_t i = 0U; i < Number_Of_Classes; ++i)
+      {
+        free_list[i]   = ETL_NULLPTR;
+        n_unused[i]    = Blocks_Per_Class;
+        n_allocated[i] = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the index of the smallest class that can hold a block of
+    /// 'size' bytes, or Number_Of_Classes if the size is too large.
+    //*************************************************************************
+    static size_t class_index(size_t size)
+    {
+      if (size <= Min_Block_Size)
+      {
+        return 0U;
+      }
+
+      // The bit width of (size - 1) is log2 of the size rounded up to a power of two.
+      const size_t index = etl::bit_width(size - 1U) - Min_Block_Size_Log2;
+
+      return (index < Number_Of_Classes) ? index : Number_Of_Classes;
+    }
+
+    //*************************************************************************
+    /// Returns the block size of the class.
+    //*************************************************************************
+    static size_t class_block_size(size_t index)
+    {
+      return Min_Block_Size << index;
+    }
+
+    //*************************************************************************
+    /// Returns the number of free blocks in the class.
+    //*************************************************************************
+    size_t available(size_t index) const
+    {
+      return Blocks_Per_Class - n_allocated[index];
+    }
+
+    //*************************************************************************
+    /// Returns the number of allocated blocks in the class.
+    //*************************************************************************
+    size_t allocated(size_t index) const
+    {
+      return n_allocated[index];
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The overridden virtual function to allocate a block.
+    //*************************************************************************
+    virtual void* allocate_block(size_t required_size, size_t required_alignment) ETL_OVERRIDE
+    {
+      if (required_alignment <= Alignment)
+      {
+        for (size_t index = class_index(required_size); index < Number_Of_Classes; ++index)
+        {
+          char* p = allocate_from_class(index);
+
+          if (p != ETL_NULLPTR)
+          {
+            return p;
+          }
+        }
+      }
+
+      return ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// The overridden virtual function to release a block.
+    //*************************************************************************
+    virtual bool release_block(const void* const pblock) ETL_OVERRIDE
+    {
+      if (!is_owner_of_block(pblock))
+      {
+        return false;
+      }
+
+      char* p = const_cast<char*>(static_cast<const char*>(pblock));
+
+      const size_t index = class_of_offset(offset_of(p));
+
+      // Link the block into the free list of its class.
+      memcpy(p, &free_list[index], sizeof(char*));
+      free_list[index] = p;
+      --n_allocated[index];
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Returns true if the allocator is the owner of the block.
+    //*************************************************************************
+    virtual bool is_owner_of_block(const void* const pblock) const ETL_OVERRIDE
+    {
+      // Within the range of the buffer?
+      const intptr_t distance = static_cast<const char*>(pblock) - buffer_start();
+      bool is_within_range = (distance >= 0) && (distance < intptr_t(Buffer_Size));
+
+      // Modulus and division can be slow on some architectures, so only do this in debug.
+#if ETL_IS_DEBUG_BUILD
+      // Is the address on a valid block boundary?
+      bool is_valid_address = false;
+
+      if (is_within_range)
+      {
+        const size_t index = class_of_offset(size_t(distance));
+        is_valid_address = (((size_t(distance) - class_start(index)) % class_block_size(index)) == 0U);
+      }
+#else
+      bool is_valid_address = true;
+#endif
+
+      return is_within_range && is_valid_address;
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Min_Block_Size_Log2 = etl::log2<VMin_Block_Size>::value;
+
+    /// Class i occupies [Class_Unit * (2^i - 1), Class_Unit * (2^(i+1) - 1)) of the buffer.
+    static ETL_CONSTANT size_t Class_Unit  = VBlocks_Per_Class * VMin_Block_Size;
+    static ETL_CONSTANT size_t Buffer_Size = VBlocks_Per_Class * ((2U * VMax_Block_Size) - VMin_Block_Size);
+
+    //*************************************************************************
+    /// Returns the offset of the start of the class within the buffer.
+    //*************************************************************************
+    static size_t class_start(size_t index)
+    {
+      return Class_Unit * ((size_t(1U) << index) - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns the index of the class that contains the buffer offset.
+    //*************************************************************************
+    static size_t class_of_offset(size_t offset)
+    {
+      return etl::bit_width((offset / Class_Unit) + 1U) - 1U;
+    }
+
+    //*************************************************************************
+    /// Takes a block from the class, or returns ETL_NULLPTR if it is empty.
+    /// Blocks that have never been used are handed out before any are
+    /// taken from the free list, so construction does not have to touch
+    /// every block.
+    //*************************************************************************
+    char* allocate_from_class(size_t index)
+    {
+      char* p = ETL_NULLPTR;
+
+      if (free_list[index] != ETL_NULLPTR)
+      {
+        p = free_list[index];
+        memcpy(&free_list[index], p, sizeof(char*));
+      }
+      else if (n_unused[index] != 0U)
+      {
+        p = buffer_start() + class_start(index) + ((Blocks_Per_Class - n_unused[index]) * class_block_size(index));
+        --n_unused[index];
+      }
+
+      if (p != ETL_NULLPTR)
+      {
+        ++n_allocated[index];
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Returns the offset of the block within the buffer.
+    //*************************************************************************
+    size_t offset_of(const char* p) const
+    {
+      return size_t(p - buffer_start());
+    }
+
+    //*************************************************************************
+    char* buffer_start()
+    {
+      return reinterpret_cast<char*>(&buffer);
+    }
+
+    //*************************************************************************
+    const char* buffer_start() const
+    {
+      return reinterpret_cast<const char*>(&buffer);
+    }
+
+    /// The storage for all of the classes.
+    typename etl::aligned_storage<Buffer_Size, Alignment>::type buffer;
+
+    /// The head of the free list of each class.
+    char* free_list[Number_Of_Classes];
+
+    /// The number of blocks in each class that have never been allocated.
+    size_t n_unused[Number_Of_Classes];
+
+    /// The number of allocated blocks in each class.
+    size_t n_allocated[Number_Of_Classes];
+  };
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Min_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Max_Block_Size;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Alignment;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Blocks_Per_Class;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Number_Of_Classes;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Min_Block_Size_Log2;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Class_Unit;
+
+  template <size_t VMin_Block_Size, size_t VMax_Block_Size, size_t VAlignment, size_t VBlocks_Per_Class>
+  ETL_CONSTANT size_t size_class_memory_block_allocator<VMin_Block_Size, VMax_Block_Size, VAlignment, VBlocks_Per_Class>::Buffer_Size;
+}
+
+#endif
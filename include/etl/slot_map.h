@@ -0,0 +1,859 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLOT_MAP_INCLUDED
+#define ETL_SLOT_MAP_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "memory.h"
+#include "utility.h"
+#include "log.h"
+#include "placement_new.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup slot_map slot_map
+/// A container that hands out generational handles to its elements.
+/// The elements are held densely in a contiguous array, so iteration is
+/// cache friendly, while a handle stays valid until its element is erased.
+/// A handle to an erased element is detected and rejected, not aliased onto
+/// the element that later reuses the slot.
+/// Insert, erase and lookup are O(1). Erasing moves the last element into
+/// the gap, so the iteration order is not preserved.
+/// Handles are 32 bits. The bits not needed to index the capacity hold the
+/// generation, which wraps after 2^(32 - index bits) reuses of one slot.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_exception : public etl::exception
+  {
+  public:
+
+    slot_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_full : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:full", ETL_SLOT_MAP_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid handle exception for the slot_map.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_invalid_handle : public etl::slot_map_exception
+  {
+  public:
+
+    slot_map_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : etl::slot_map_exception(ETL_ERROR_TEXT("slot_map:invalid handle", ETL_SLOT_MAP_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A handle to an element of a slot_map.
+  /// A default constructed handle never refers to an element.
+  ///\ingroup slot_map
+  //***************************************************************************
+  class slot_map_handle
+  {
+  public:
+
+    static ETL_CONSTANT uint32_t Null_Value = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    ETL_CONSTEXPR slot_map_handle()
+      : id(Null_Value)
+    {
+    }
+
+    //*************************************************************************
+    ETL_CONSTEXPR explicit slot_map_handle(uint32_t id_)
+      : id(id_)
+    {
+    }
+
+    //*************************************************************************
+    /// The encoded index and generation.
+    //*************************************************************************
+    ETL_CONSTEXPR uint32_t value() const
+    {
+      return id;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return lhs.id == rhs.id;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator !=(const slot_map_handle& lhs, const slot_map_handle& rhs)
+    {
+      return lhs.id != rhs.id;
+    }
+
+  private:
+
+    uint32_t id;
+  };
+
+  //***************************************************************************
+  /// The base class for all slot_maps.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T>
+  class islot_map
+  {
+  public:
+
+    typedef T                 value_type;
+    typedef T&                reference;
+    typedef const T&          const_reference;
+#if ETL_USING_CPP11
+    typedef T&&               rvalue_reference;
+#endif
+    typedef T*                pointer;
+    typedef const T*          const_pointer;
+    typedef T*                iterator;
+    typedef const T*          const_iterator;
+    typedef size_t            size_type;
+    typedef ptrdiff_t         difference_type;
+    typedef slot_map_handle   handle_type;
+
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    iterator begin()
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first element.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return p_values;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    iterator end()
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return p_values + current_size;
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    reverse_iterator rbegin()
+    {
+      return reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to the last element.
+    //*************************************************************************
+    const_reverse_iterator rbegin() const
+    {
+      return const_reverse_iterator(end());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    reverse_iterator rend()
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns a reverse iterator to before the first element.
+    //*************************************************************************
+    const_reverse_iterator rend() const
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Inserts a copy of the value.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    handle_type insert(const_reference value)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(value);
+
+      return allocate_slot();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts the value by moving it.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    handle_type insert(rvalue_reference value)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(etl::move(value));
+
+      return allocate_slot();
+    }
+#endif
+
+#if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(etl::forward<Args>(args)...);
+
+      return allocate_slot();
+    }
+#else
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    handle_type emplace()
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T();
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    template <typename T1>
+    handle_type emplace(const T1& value1)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(value1);
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    handle_type emplace(const T1& value1, const T2& value2)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(value1, value2);
+
+      return allocate_slot();
+    }
+
+    //*************************************************************************
+    /// Constructs an element in place.
+    /// If asserts or exceptions are enabled, emits slot_map_full if the slot_map is full.
+    ///\return The handle of the new element, or a null handle if full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    handle_type emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      if (full())
+      {
+        ETL_ASSERT_FAIL(ETL_ERROR(slot_map_full));
+        return handle_type();
+      }
+
+      ::new (p_values + current_size) T(value1, value2, value3);
+
+      return allocate_slot();
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the element referred to by the handle.
+    ///\return <b>true</b> if the handle was valid and the element was erased.
+    //*************************************************************************
+    bool erase(handle_type handle)
+    {
+      const uint32_t slot_index = find_slot(handle);
+
+      if (slot_index == Invalid_Slot)
+      {
+        return false;
+      }
+
+      erase_dense(p_slots[slot_index].index);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Erases the element at the position.
+    /// The last element is moved into its place.
+    ///\return An iterator to the element that now occupies the position.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t dense_index = size_t(position - p_values);
+
+      erase_dense(dense_index);
+
+      return p_values + dense_index;
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the element referred to by the handle.
+    ///\return The pointer, or <b>nullptr</b> if the handle is not valid.
+    //*************************************************************************
+    pointer get(handle_type handle)
+    {
+      const uint32_t slot_index = find_slot(handle);
+
+      return (slot_index == Invalid_Slot) ? ETL_NULLPTR : p_values + p_slots[slot_index].index;
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the element referred to by the handle.
+    ///\return The pointer, or <b>nullptr</b> if the handle is not valid.
+    //*************************************************************************
+    const_pointer get(handle_type handle) const
+    {
+      const uint32_t slot_index = find_slot(handle);
+
+      return (slot_index == Invalid_Slot) ? ETL_NULLPTR : p_values + p_slots[slot_index].index;
+    }
+
+    //*************************************************************************
+    /// Gets the element referred to by the handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if the handle is not valid.
+    //*************************************************************************
+    reference at(handle_type handle)
+    {
+      pointer p = get(handle);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(slot_map_invalid_handle));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Gets the element referred to by the handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if the handle is not valid.
+    //*************************************************************************
+    const_reference at(handle_type handle) const
+    {
+      const_pointer p = get(handle);
+
+      ETL_ASSERT(p != ETL_NULLPTR, ETL_ERROR(slot_map_invalid_handle));
+
+      return *p;
+    }
+
+    //*************************************************************************
+    /// Gets the element referred to by the handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if the handle is not valid.
+    //*************************************************************************
+    reference operator [](handle_type handle)
+    {
+      return at(handle);
+    }
+
+    //*************************************************************************
+    /// Gets the element referred to by the handle.
+    /// If asserts or exceptions are enabled, emits slot_map_invalid_handle if the handle is not valid.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      return at(handle);
+    }
+
+    //*************************************************************************
+    /// Checks if the handle refers to an element.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return find_slot(handle) != Invalid_Slot;
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the element at the position.
+    //*************************************************************************
+    handle_type handle_of(const_iterator position) const
+    {
+      const uint32_t slot_index = p_dense_to_slot[position - p_values];
+
+      return make_handle(slot_index, p_slots[slot_index].generation);
+    }
+
+    //*************************************************************************
+    /// Erases all of the elements. All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size != 0U)
+      {
+        --current_size;
+        etl::destroy_at(p_values + current_size);
+        release_slot(p_dense_to_slot[current_size]);
+      }
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the slot_map is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return capacity_;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity_ - current_size;
+    }
+
+  protected:
+
+    /// A slot holds the element's dense index, or the next free slot.
+    struct slot_t
+    {
+      uint32_t index;
+      uint32_t generation;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islot_map(T* p_values_, slot_t* p_slots_, uint32_t* p_dense_to_slot_, size_t capacity_in, uint32_t index_bits_)
+      : p_values(p_values_)
+      , p_slots(p_slots_)
+      , p_dense_to_slot(p_dense_to_slot_)
+      , capacity_(capacity_in)
+      , index_bits(index_bits_)
+      , index_mask(uint32_t((1UL << index_bits_) - 1UL))
+      , generation_mask(uint32_t(0xFFFFFFFFUL >> index_bits_))
+      , current_size(0U)
+      , free_head(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Puts every slot on the free list.
+    //*************************************************************************
+    void initialise()
+    {
+      current_size = 0U;
+      free_head    = 0U;
+
+      for (size_t i = 0U; i < capacity_; ++i)
+      {
+        p_slots[i].index      = uint32_t(i + 1U);
+        p_slots[i].generation = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Copies the elements and slots of a slot_map of the same capacity, so
+    /// that its handles are valid for this one.
+    //*************************************************************************
+    void copy_from(const islot_map& other)
+    {
+      clear();
+
+      etl::uninitialized_copy(other.p_values, other.p_values + other.current_size, p_values);
+      copy_slots(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Moves the elements and copies the slots of a slot_map of the same capacity.
+    //*************************************************************************
+    void move_from(islot_map& other)
+    {
+      clear();
+
+      etl::uninitialized_move(other.p_values, other.p_values + other.current_size, p_values);
+      copy_slots(other);
+      other.clear();
+    }
+#endif
+
+  private:
+
+    static ETL_CONSTANT uint32_t Invalid_Slot = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    handle_type make_handle(uint32_t slot_index, uint32_t generation) const
+    {
+      return handle_type((generation << index_bits) | slot_index);
+    }
+
+    //*************************************************************************
+    /// Takes a slot from the free list for the element just constructed at the end.
+    //*************************************************************************
+    handle_type allocate_slot()
+    {
+      const uint32_t slot_index = free_head;
+
+      free_head = p_slots[slot_index].index;
+      p_slots[slot_index].index     = uint32_t(current_size);
+      p_dense_to_slot[current_size] = slot_index;
+      ++current_size;
+
+      return make_handle(slot_index, p_slots[slot_index].generation);
+    }
+
+    //*************************************************************************
+    /// Returns a slot to the free list, invalidating its handles.
+    //*************************************************************************
+    void release_slot(uint32_t slot_index)
+    {
+      p_slots[slot_index].generation = (p_slots[slot_index].generation + 1U) & generation_mask;
+      p_slots[slot_index].index      = free_head;
+      free_head = slot_index;
+    }
+
+    //*************************************************************************
+    /// Gets the slot for the handle, or Invalid_Slot.
+    //*************************************************************************
+    uint32_t find_slot(handle_type handle) const
+    {
+      const uint32_t slot_index = handle.value() & index_mask;
+      const uint32_t generation = handle.value() >> index_bits;
+
+      if (slot_index >= capacity_)
+      {
+        return Invalid_Slot;
+      }
+
+      const slot_t& slot = p_slots[slot_index];
+
+      // A free slot's index is not an element owned by that slot.
+      if ((slot.generation != generation) || (slot.index >= current_size) || (p_dense_to_slot[slot.index] != slot_index))
+      {
+        return Invalid_Slot;
+      }
+
+      return slot_index;
+    }
+
+    //*************************************************************************
+    /// Erases the element at the dense index, moving the last one into its place.
+    //*************************************************************************
+    void erase_dense(size_t dense_index)
+    {
+      const uint32_t slot_index = p_dense_to_slot[dense_index];
+      const size_t   last       = current_size - 1U;
+
+      if (dense_index != last)
+      {
+        p_values[dense_index]        = ETL_MOVE(p_values[last]);
+        p_dense_to_slot[dense_index] = p_dense_to_slot[last];
+        p_slots[p_dense_to_slot[dense_index]].index = uint32_t(dense_index);
+      }
+
+      etl::destroy_at(p_values + last);
+      --current_size;
+
+      release_slot(slot_index);
+    }
+
+    //*************************************************************************
+    void copy_slots(const islot_map& other)
+    {
+      etl::copy(other.p_slots, other.p_slots + capacity_, p_slots);
+      etl::copy(other.p_dense_to_slot, other.p_dense_to_slot + other.current_size, p_dense_to_slot);
+
+      current_size = other.current_size;
+      free_head    = other.free_head;
+    }
+
+    // Disable copy construction and assignment.
+    islot_map(const islot_map&) ETL_DELETE;
+    islot_map& operator =(const islot_map&) ETL_DELETE;
+
+    T* const        p_values;
+    slot_t* const   p_slots;
+    uint32_t* const p_dense_to_slot;
+    const size_t    capacity_;
+    const uint32_t  index_bits;
+    const uint32_t  index_mask;
+    const uint32_t  generation_mask;
+    size_t          current_size;
+    uint32_t        free_head;
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_SLOT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~islot_map()
+    {
+    }
+#else
+  protected:
+    ~islot_map()
+    {
+    }
+#endif
+  };
+
+  template <typename T>
+  ETL_CONSTANT uint32_t islot_map<T>::Invalid_Slot;
+
+  //***************************************************************************
+  /// A slot_map with the capacity defined at compile time.
+  ///\tparam T         The element type.
+  ///\tparam MAX_SIZE_ The maximum number of elements.
+  ///\ingroup slot_map
+  //***************************************************************************
+  template <typename T, const size_t MAX_SIZE_>
+  class slot_map : public etl::islot_map<T>
+  {
+  public:
+
+    static ETL_CONSTANT size_t   MAX_SIZE   = MAX_SIZE_;
+    static ETL_CONSTANT uint32_t Index_Bits = uint32_t(etl::log2<MAX_SIZE_>::value) + 1U;
+
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity slot_map is not valid");
+    ETL_STATIC_ASSERT(Index_Bits <= 24U, "slot_map capacity leaves fewer than 8 generation bits");
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    slot_map()
+      : etl::islot_map<T>(values.begin(), slots, dense_to_slot, MAX_SIZE, Index_Bits)
+    {
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Handles from 'other' are valid for the copy.
+    //*************************************************************************
+    slot_map(const slot_map& other)
+      : etl::islot_map<T>(values.begin(), slots, dense_to_slot, MAX_SIZE, Index_Bits)
+    {
+      this->initialise();
+      this->copy_from(other);
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor. Handles from 'other' are valid for the new slot_map.
+    //*************************************************************************
+    slot_map(slot_map&& other)
+      : etl::islot_map<T>(values.begin(), slots, dense_to_slot, MAX_SIZE, Index_Bits)
+    {
+      this->initialise();
+      this->move_from(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~slot_map()
+    {
+      this->clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    slot_map& operator =(const slot_map& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->copy_from(rhs);
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    slot_map& operator =(slot_map&& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->move_from(rhs);
+      }
+
+      return *this;
+    }
+#endif
+
+  private:
+
+    etl::uninitialized_buffer_of<T, MAX_SIZE_> values;
+    typename etl::islot_map<T>::slot_t         slots[MAX_SIZE_];
+    uint32_t                                   dense_to_slot[MAX_SIZE_];
+  };
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT size_t slot_map<T, MAX_SIZE_>::MAX_SIZE;
+
+  template <typename T, const size_t MAX_SIZE_>
+  ETL_CONSTANT uint32_t slot_map<T, MAX_SIZE_>::Index_Bits;
+}
+
+#endif
@@ -0,0 +1,689 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SMALL_VECTOR_INCLUDED
+#define ETL_SMALL_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "memory.h"
+#include "iterator.h"
+#include "utility.h"
+#include "ipool.h"
+#include "placement_new.h"
+#include "static_assert.h"
+#include "vector.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+//*****************************************************************************
+///\defgroup small_vector small_vector
+/// A vector that holds a few elements in place, and moves to a block from a
+/// shared pool when it needs more.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A vector with room for VInline elements in place, that grows to VMax
+  /// elements by moving them to a spill block taken from a shared etl::ipool.
+  /// Many vectors that are usually small can then share a few spill blocks,
+  /// rather than each reserving room for VMax elements.
+  /// The pool must be able to hold spill_block_type objects, such as an
+  /// etl::pool<small_vector<T, VInline, VMax>::spill_block_type, N>.
+  /// The spill block is returned to the pool by clear(), by shrink_to_fit()
+  /// when the elements fit in place, and by the destructor.
+  /// Growing into or out of the spill block invalidates iterators.
+  /// Has the interface of etl::ivector, except that capacity() is the size
+  /// of the current storage, and max_size() is VMax.
+  ///\ingroup small_vector
+  //***************************************************************************
+  template <typename T, size_t VInline, size_t VMax>
+  class small_vector
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VInline > 0U, "There must be at least one inline element");
+    ETL_STATIC_ASSERT(VMax > VInline, "The maximum size must be larger than the inline size");
+
+    typedef T                                     value_type;
+    typedef T&                                    reference;
+    typedef const T&                              const_reference;
+#if ETL_USING_CPP11
+    typedef T&&                                   rvalue_reference;
+#endif
+    typedef T*                                    pointer;
+    typedef const T*                              const_pointer;
+    typedef T*                                    iterator;
+    typedef const T*                              const_iterator;
+    typedef ETL_OR_STD::reverse_iterator<iterator>       reverse_iterator;
+    typedef ETL_OR_STD::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t                                size_type;
+    typedef typename etl::iterator_traits<iterator>::difference_type difference_type;
+
+    /// The type of the blocks in the pool.
+    typedef etl::uninitialized_buffer_of<T, VMax> spill_block_type;
+
+    static ETL_CONSTANT size_t Inline_Size = VInline;
+    static ETL_CONSTANT size_t Max_Size    = VMax;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    explicit small_vector(etl::ipool& pool)
+      : p_buffer(reinterpret_cast<pointer>(inline_buffer.raw))
+      , current_size(0U)
+      , p_spill(ETL_NULLPTR)
+      , p_pool(&pool)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, with 'n' copies of 'value'.
+    //*************************************************************************
+    small_vector(etl::ipool& pool, size_t n, const_reference value)
+      : p_buffer(reinterpret_cast<pointer>(inline_buffer.raw))
+      , current_size(0U)
+      , p_spill(ETL_NULLPTR)
+      , p_pool(&pool)
+    {
+      assign(n, value);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    small_vector(etl::ipool& pool, TIterator first, TIterator last, typename etl::enable_if<!etl::is_integral<TIterator>::value, int>::type = 0)
+      : p_buffer(reinterpret_cast<pointer>(inline_buffer.raw))
+      , current_size(0U)
+      , p_spill(ETL_NULLPTR)
+      , p_pool(&pool)
+    {
+      assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// The copy uses the same pool.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : p_buffer(reinterpret_cast<pointer>(inline_buffer.raw))
+      , current_size(0U)
+      , p_spill(ETL_NULLPTR)
+      , p_pool(other.p_pool)
+    {
+      assign(other.begin(), other.end());
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move constructor.
+    /// Takes the spill block, if the other vector has one.
+    //*************************************************************************
+    small_vector(small_vector&& other)
+      : p_buffer(reinterpret_cast<pointer>(inline_buffer.raw))
+      , current_size(0U)
+      , p_spill(ETL_NULLPTR)
+      , p_pool(other.p_pool)
+    {
+      take(other);
+    }
+#endif
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~small_vector()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    small_vector& operator =(const small_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Move assignment operator.
+    /// Takes the spill block if the other vector has one and uses the same pool.
+    //*************************************************************************
+    small_vector& operator =(small_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+
+        if (rhs.p_pool == p_pool)
+        {
+          take(rhs);
+        }
+        else
+        {
+          assign(etl::make_move_iterator(rhs.begin()), etl::make_move_iterator(rhs.end()));
+          rhs.clear();
+        }
+      }
+
+      return *this;
+    }
+#endif
+
+    //*************************************************************************
+    // Iterators.
+    //*************************************************************************
+    iterator               begin()         { return p_buffer; }
+    const_iterator         begin()   const { return p_buffer; }
+    const_iterator         cbegin()  const { return p_buffer; }
+    iterator               end()           { return p_buffer + current_size; }
+    const_iterator         end()     const { return p_buffer + current_size; }
+    const_iterator         cend()    const { return p_buffer + current_size; }
+    reverse_iterator       rbegin()        { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin()  const { return const_reverse_iterator(end()); }
+    const_reverse_iterator crbegin() const { return const_reverse_iterator(end()); }
+    reverse_iterator       rend()          { return reverse_iterator(begin()); }
+    const_reverse_iterator rend()    const { return const_reverse_iterator(begin()); }
+    const_reverse_iterator crend()   const { return const_reverse_iterator(begin()); }
+
+    //*************************************************************************
+    /// The number of elements.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no elements.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if the vector has VMax elements.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == VMax;
+    }
+
+    //*************************************************************************
+    /// The number of elements that the current storage can hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return is_inline() ? VInline : VMax;
+    }
+
+    //*************************************************************************
+    /// The maximum number of elements.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return VMax;
+    }
+
+    //*************************************************************************
+    /// The number of elements that may still be added.
+    //*************************************************************************
+    size_type available() const
+    {
+      return VMax - current_size;
+    }
+
+    //*************************************************************************
+    /// Checks if the elements are held in place.
+    //*************************************************************************
+    bool is_inline() const
+    {
+      return p_spill == ETL_NULLPTR;
+    }
+
+    //*************************************************************************
+    /// Gets the pool of spill blocks.
+    //*************************************************************************
+    etl::ipool& get_pool() const
+    {
+      return *p_pool;
+    }
+
+    //*************************************************************************
+    // Element access.
+    //*************************************************************************
+    pointer         data()                            { return p_buffer; }
+    const_pointer   data()                      const { return p_buffer; }
+    reference       operator [](size_type i)          { return p_buffer[i]; }
+    const_reference operator [](size_type i)    const { return p_buffer[i]; }
+    reference       front()                           { return p_buffer[0]; }
+    const_reference front()                     const { return p_buffer[0]; }
+    reference       back()                            { return p_buffer[current_size - 1U]; }
+    const_reference back()                      const { return p_buffer[current_size - 1U]; }
+
+    //*************************************************************************
+    /// Returns a reference to the element at the index.
+    /// If asserts or exceptions are enabled, emits an etl::vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    reference at(size_type i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Returns a const reference to the element at the index.
+    /// If asserts or exceptions are enabled, emits an etl::vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_reference at(size_type i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(vector_out_of_bounds));
+      return p_buffer[i];
+    }
+
+    //*************************************************************************
+    /// Makes room for 'n' elements, taking a spill block if needed.
+    /// If asserts or exceptions are enabled, emits vector_full if 'n' is more
+    /// than VMax or no spill block is available.
+    //*************************************************************************
+    void reserve(size_type n)
+    {
+      grow(n);
+    }
+
+    //*************************************************************************
+    /// Inserts a value at the end.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    void push_back(const_reference value)
+    {
+      if (grow(current_size + 1U))
+      {
+        ::new (p_buffer + current_size) T(value);
+        ++current_size;
+      }
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value at the end by moving it.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    void push_back(rvalue_reference value)
+    {
+      if (grow(current_size + 1U))
+      {
+        ::new (p_buffer + current_size) T(ETL_MOVE(value));
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs a value at the end.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    template <typename... TArgs>
+    reference emplace_back(TArgs&&... args)
+    {
+      if (grow(current_size + 1U))
+      {
+        ::new (p_buffer + current_size) T(etl::forward<TArgs>(args)...);
+        ++current_size;
+      }
+
+      return back();
+    }
+#endif
+
+    //*************************************************************************
+    /// Removes the last element.
+    /// If asserts or exceptions are enabled, emits vector_empty if the vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+      ETL_ASSERT_OR_RETURN(current_size != 0U, ETL_ERROR(vector_empty));
+
+      --current_size;
+      p_buffer[current_size].~T();
+    }
+
+    //*************************************************************************
+    /// Inserts a value before the position.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    iterator insert(const_iterator position, const_reference value)
+    {
+      const size_type index = size_type(position - cbegin());
+
+      T copy(value);
+
+      if (grow(current_size + 1U))
+      {
+        insert_at(index, copy);
+      }
+
+      return begin() + index;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Inserts a value before the position by moving it.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    iterator insert(const_iterator position, rvalue_reference value)
+    {
+      const size_type index = size_type(position - cbegin());
+
+      T moved(ETL_MOVE(value));
+
+      if (grow(current_size + 1U))
+      {
+        insert_at(index, moved);
+      }
+
+      return begin() + index;
+    }
+#endif
+
+    //*************************************************************************
+    /// Erases the element at the position.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      return erase(position, position + 1);
+    }
+
+    //*************************************************************************
+    /// Erases a range of elements.
+    //*************************************************************************
+    iterator erase(const_iterator first, const_iterator last)
+    {
+      const size_type index = size_type(first - cbegin());
+      const size_type n     = size_type(last - first);
+
+      if (n != 0U)
+      {
+        etl::move(begin() + index + n, end(), begin() + index);
+
+        for (size_type i = current_size - n; i < current_size; ++i)
+        {
+          p_buffer[i].~T();
+        }
+
+        current_size -= n;
+      }
+
+      return begin() + index;
+    }
+
+    //*************************************************************************
+    /// Resizes the vector, adding default constructed elements.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    void resize(size_type new_size)
+    {
+      resize(new_size, T());
+    }
+
+    //*************************************************************************
+    /// Resizes the vector, adding copies of 'value'.
+    /// If asserts or exceptions are enabled, emits vector_full if the vector cannot grow.
+    //*************************************************************************
+    void resize(size_type new_size, const_reference value)
+    {
+      if (new_size < current_size)
+      {
+        erase(cbegin() + new_size, cend());
+      }
+      else if (grow(new_size))
+      {
+        while (current_size < new_size)
+        {
+          ::new (p_buffer + current_size) T(value);
+          ++current_size;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with a range.
+    /// If asserts or exceptions are enabled, emits vector_full if the range is too large.
+    //*************************************************************************
+    template <typename TIterator>
+    typename etl::enable_if<!etl::is_integral<TIterator>::value, void>::type
+      assign(TIterator first, TIterator last)
+    {
+      clear();
+
+      const size_type n = size_type(etl::distance(first, last));
+
+      if (grow(n))
+      {
+        for (; first != last; ++first)
+        {
+          ::new (p_buffer + current_size) T(*first);
+          ++current_size;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Replaces the contents with 'n' copies of 'value'.
+    /// If asserts or exceptions are enabled, emits vector_full if 'n' is too large.
+    //*************************************************************************
+    void assign(size_type n, const_reference value)
+    {
+      clear();
+      resize(n, value);
+    }
+
+    //*************************************************************************
+    /// Removes all of the elements and returns the spill block to the pool.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size != 0U)
+      {
+        --current_size;
+        p_buffer[current_size].~T();
+      }
+
+      release_spill();
+    }
+
+    //*************************************************************************
+    /// Moves the elements back in place, and returns the spill block to the
+    /// pool, if they fit.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if (!is_inline() && (current_size <= VInline))
+      {
+        relocate(inline_buffer.begin());
+        release_spill();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Makes sure that there is room for 'n' elements.
+    //*************************************************************************
+    bool grow(size_type n)
+    {
+      if (n <= capacity())
+      {
+        return true;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE(n <= VMax, ETL_ERROR(vector_full), false);
+      ETL_ASSERT_OR_RETURN_VALUE(!p_pool->full(), ETL_ERROR(vector_full), false);
+
+      spill_block_type* p_block = p_pool->allocate<spill_block_type>();
+
+      relocate(p_block->begin());
+      p_spill = p_block;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Moves the elements to new storage.
+    //*************************************************************************
+    void relocate(pointer p_new)
+    {
+      for (size_type i = 0U; i < current_size; ++i)
+      {
+        ::new (p_new + i) T(ETL_MOVE(p_buffer[i]));
+        p_buffer[i].~T();
+      }
+
+      p_buffer = p_new;
+    }
+
+    //*************************************************************************
+    /// Returns the spill block to the pool.
+    /// The vector must be empty, or its elements already moved in place.
+    //*************************************************************************
+    void release_spill()
+    {
+      if (p_spill != ETL_NULLPTR)
+      {
+        p_pool->release(p_spill);
+        p_spill = ETL_NULLPTR;
+      }
+
+      p_buffer = inline_buffer.begin();
+    }
+
+    //*************************************************************************
+    /// Moves the elements from 'index' up by one and moves the value to
+    /// 'index'. There must be room for one more element.
+    //*************************************************************************
+    void insert_at(size_type index, reference value)
+    {
+      if (index == current_size)
+      {
+        ::new (p_buffer + current_size) T(ETL_MOVE(value));
+      }
+      else
+      {
+        ::new (p_buffer + current_size) T(ETL_MOVE(p_buffer[current_size - 1U]));
+        etl::move_backward(begin() + index, end() - 1, end());
+        p_buffer[index] = ETL_MOVE(value);
+      }
+
+      ++current_size;
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    /// Takes the contents of another empty or spilled vector with the same pool.
+    //*************************************************************************
+    void take(small_vector& other)
+    {
+      if (other.is_inline())
+      {
+        for (size_type i = 0U; i < other.current_size; ++i)
+        {
+          ::new (p_buffer + i) T(etl::move(other.p_buffer[i]));
+        }
+
+        current_size = other.current_size;
+        other.clear();
+      }
+      else
+      {
+        p_spill      = other.p_spill;
+        p_buffer     = other.p_buffer;
+        current_size = other.current_size;
+
+        other.p_spill      = ETL_NULLPTR;
+        other.p_buffer     = other.inline_buffer.begin();
+        other.current_size = 0U;
+      }
+    }
+#endif
+
+    etl::uninitialized_buffer_of<T, VInline> inline_buffer;
+    pointer                                  p_buffer;
+    size_type                                current_size;
+    spill_block_type*                        p_spill;
+    etl::ipool*                              p_pool;
+  };
+
+  template <typename T, size_t VInline, size_t VMax>
+  ETL_CONSTANT size_t small_vector<T, VInline, VMax>::Inline_Size;
+
+  template <typename T, size_t VInline, size_t VMax>
+  ETL_CONSTANT size_t small_vector<T, VInline, VMax>::Max_Size;
+
+  //***************************************************************************
+  /// Equal operator.
+  //***************************************************************************
+  template <typename T, size_t VInline, size_t VMax>
+  bool operator ==(const etl::small_vector<T, VInline, VMax>& lhs, const etl::small_vector<T, VInline, VMax>& rhs)
+  {
+    return (lhs.size() == rhs.size()) && etl::equal(lhs.begin(), lhs.end(), rhs.begin());
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  //***************************************************************************
+  template <typename T, size_t VInline, size_t VMax>
+  bool operator !=(const etl::small_vector<T, VInline, VMax>& lhs, const etl::small_vector<T, VInline, VMax>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //***************************************************************************
+  /// Less than operator.
+  //***************************************************************************
+  template <typename T, size_t VInline, size_t VMax>
+  bool operator <(const etl::small_vector<T, VInline, VMax>& lhs, const etl::small_vector<T, VInline, VMax>& rhs)
+  {
+    return etl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+}
+
+#endif
@@ -0,0 +1,893 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_VECTOR_INCLUDED
+#define ETL_SOA_VECTOR_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "iterator.h"
+#include "memory.h"
+#include "span.h"
+#include "nth_type.h"
+#include "utility.h"
+#include "type_traits.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup soa_vector soa_vector
+/// A structure of arrays vector with the capacity defined at compile time.
+/// Each column type is held in its own contiguous array, so loops that only
+/// use some of the columns only bring those into the cache.
+/// Columns are accessed as spans. The iterators are random access and
+/// visit proxy 'rows' that refer to one element of each column.
+/// Requires C++11 or above.
+///\ingroup containers
+//*****************************************************************************
+
+#if ETL_USING_CPP11
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_exception : public etl::exception
+  {
+  public:
+
+    soa_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_full : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_full(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:full", ETL_SOA_VECTOR_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Empty exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_empty : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_empty(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:empty", ETL_SOA_VECTOR_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Out of bounds exception for the soa_vector.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_out_of_bounds : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : etl::soa_vector_exception(ETL_ERROR_TEXT("soa_vector:bounds", ETL_SOA_VECTOR_FILE_ID"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_vector
+  {
+    //*************************************************************************
+    /// The storage for the columns.
+    /// Each level holds one column and passes the operation on to the next.
+    //*************************************************************************
+    template <size_t Capacity, typename... TTypes>
+    class column_storage
+    {
+    public:
+
+      void push_back(size_t) {}
+      void default_construct(size_t) {}
+      void destroy(size_t, size_t) {}
+      void erase(size_t, size_t) {}
+      void swap_rows(size_t, size_t) {}
+      void copy_construct(const column_storage&, size_t) {}
+      void move_construct(column_storage&, size_t) {}
+    };
+
+    //*************************************************************************
+    template <size_t Capacity, typename T, typename... TRest>
+    class column_storage<Capacity, T, TRest...> : public column_storage<Capacity, TRest...>
+    {
+    public:
+
+      typedef column_storage<Capacity, TRest...> base_t;
+
+      //*******************************
+      T* data()
+      {
+        return buffer.begin();
+      }
+
+      //*******************************
+      const T* data() const
+      {
+        return buffer.begin();
+      }
+
+      //*******************************
+      template <typename U, typename... URest>
+      void push_back(size_t index, U&& value, URest&&... rest)
+      {
+        ::new (data() + index) T(etl::forward<U>(value));
+        base_t::push_back(index, etl::forward<URest>(rest)...);
+      }
+
+      //*******************************
+      void default_construct(size_t index)
+      {
+        ::new (data() + index) T();
+        base_t::default_construct(index);
+      }
+
+      //*******************************
+      void destroy(size_t first, size_t last)
+      {
+        etl::destroy(data() + first, data() + last);
+        base_t::destroy(first, last);
+      }
+
+      //*******************************
+      void erase(size_t index, size_t size)
+      {
+        etl::move(data() + index + 1U, data() + size, data() + index);
+        etl::destroy_at(data() + size - 1U);
+        base_t::erase(index, size);
+      }
+
+      //*******************************
+      void swap_rows(size_t index1, size_t index2)
+      {
+        using ETL_OR_STD::swap;
+        swap(data()[index1], data()[index2]);
+        base_t::swap_rows(index1, index2);
+      }
+
+      //*******************************
+      void copy_construct(const column_storage& other, size_t size)
+      {
+        etl::uninitialized_copy(other.data(), other.data() + size, data());
+        base_t::copy_construct(other, size);
+      }
+
+      //*******************************
+      void move_construct(column_storage& other, size_t size)
+      {
+        etl::uninitialized_move(other.data(), other.data() + size, data());
+        base_t::move_construct(other, size);
+      }
+
+    private:
+
+      etl::uninitialized_buffer_of<T, Capacity> buffer;
+    };
+
+    //*************************************************************************
+    /// Gets the storage level that holds column 'Index'.
+    //*************************************************************************
+    template <size_t Index, typename TStorage>
+    struct column_level;
+
+    template <size_t Capacity, typename T, typename... TRest>
+    struct column_level<0U, column_storage<Capacity, T, TRest...> >
+    {
+      typedef column_storage<Capacity, T, TRest...> type;
+    };
+
+    template <size_t Index, size_t Capacity, typename T, typename... TRest>
+    struct column_level<Index, column_storage<Capacity, T, TRest...> >
+    {
+      typedef typename column_level<Index - 1U, column_storage<Capacity, TRest...> >::type type;
+    };
+  }
+
+  //***************************************************************************
+  /// A structure of arrays vector.
+  ///\tparam MAX_SIZE_ The maximum number of rows.
+  ///\tparam TTypes    The column types.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <size_t MAX_SIZE_, typename... TTypes>
+  class soa_vector
+  {
+  private:
+
+    typedef private_soa_vector::column_storage<MAX_SIZE_, TTypes...> storage_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) > 0U, "soa_vector must have at least one column");
+    ETL_STATIC_ASSERT(MAX_SIZE_ > 0U, "Zero capacity soa_vector is not valid");
+
+    static ETL_CONSTANT size_t MAX_SIZE     = MAX_SIZE_;
+    static ETL_CONSTANT size_t Column_Count = sizeof...(TTypes);
+
+    typedef size_t    size_type;
+    typedef ptrdiff_t difference_type;
+
+    template <size_t Index>
+    using column_type = etl::nth_type_t<Index, TTypes...>;
+
+    //*************************************************************************
+    /// A proxy for one row, referring to an element of each column.
+    //*************************************************************************
+    template <bool Is_Const>
+    class basic_row
+    {
+    public:
+
+      typedef typename etl::conditional<Is_Const, const soa_vector, soa_vector>::type container_t;
+
+      template <size_t Index>
+      using reference_type = typename etl::conditional<Is_Const, const column_type<Index>&, column_type<Index>&>::type;
+
+      //*******************************
+      basic_row(container_t& container_, size_t index_)
+        : p_container(&container_)
+        , row_index(index_)
+      {
+      }
+
+      //*******************************
+      /// Conversion from a mutable row.
+      //*******************************
+      template <bool B = Is_Const, typename = etl::enable_if_t<B> >
+      basic_row(const basic_row<false>& other)
+        : p_container(other.p_container)
+        , row_index(other.row_index)
+      {
+      }
+
+      //*******************************
+      /// Gets the element in column 'Index'.
+      //*******************************
+      template <size_t Index>
+      reference_type<Index> get() const
+      {
+        return p_container->template data<Index>()[row_index];
+      }
+
+      //*******************************
+      /// The index of the row in the container.
+      //*******************************
+      size_t index() const
+      {
+        return row_index;
+      }
+
+    private:
+
+      template <bool>
+      friend class basic_row;
+
+      container_t* p_container;
+      size_t       row_index;
+    };
+
+    typedef basic_row<false> row;
+    typedef basic_row<true>  const_row;
+
+    //*************************************************************************
+    /// Random access iterator over the rows.
+    //*************************************************************************
+    template <bool Is_Const>
+    class basic_iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, basic_row<Is_Const>, ptrdiff_t, void, basic_row<Is_Const> >
+    {
+    public:
+
+      typedef typename etl::conditional<Is_Const, const soa_vector, soa_vector>::type container_t;
+      typedef basic_row<Is_Const> row_type;
+
+      //*******************************
+      basic_iterator()
+        : p_container(ETL_NULLPTR)
+        , row_index(0U)
+      {
+      }
+
+      //*******************************
+      basic_iterator(container_t& container_, size_t index_)
+        : p_container(&container_)
+        , row_index(index_)
+      {
+      }
+
+      //*******************************
+      /// Conversion from a mutable iterator.
+      //*******************************
+      template <bool B = Is_Const, typename = etl::enable_if_t<B> >
+      basic_iterator(const basic_iterator<false>& other)
+        : p_container(other.p_container)
+        , row_index(other.row_index)
+      {
+      }
+
+      //*******************************
+      row_type operator *() const
+      {
+        return row_type(*p_container, row_index);
+      }
+
+      //*******************************
+      row_type operator [](ptrdiff_t n) const
+      {
+        return row_type(*p_container, size_t(ptrdiff_t(row_index) + n));
+      }
+
+      //*******************************
+      basic_iterator& operator ++()
+      {
+        ++row_index;
+        return *this;
+      }
+
+      //*******************************
+      basic_iterator operator ++(int)
+      {
+        basic_iterator temp(*this);
+        ++row_index;
+        return temp;
+      }
+
+      //*******************************
+      basic_iterator& operator --()
+      {
+        --row_index;
+        return *this;
+      }
+
+      //*******************************
+      basic_iterator operator --(int)
+      {
+        basic_iterator temp(*this);
+        --row_index;
+        return temp;
+      }
+
+      //*******************************
+      basic_iterator& operator +=(ptrdiff_t n)
+      {
+        row_index = size_t(ptrdiff_t(row_index) + n);
+        return *this;
+      }
+
+      //*******************************
+      basic_iterator& operator -=(ptrdiff_t n)
+      {
+        row_index = size_t(ptrdiff_t(row_index) - n);
+        return *this;
+      }
+
+      //*******************************
+      friend basic_iterator operator +(basic_iterator lhs, ptrdiff_t n)
+      {
+        return lhs += n;
+      }
+
+      //*******************************
+      friend basic_iterator operator +(ptrdiff_t n, basic_iterator rhs)
+      {
+        return rhs += n;
+      }
+
+      //*******************************
+      friend basic_iterator operator -(basic_iterator lhs, ptrdiff_t n)
+      {
+        return lhs -= n;
+      }
+
+      //*******************************
+      friend ptrdiff_t operator -(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return ptrdiff_t(lhs.row_index) - ptrdiff_t(rhs.row_index);
+      }
+
+      //*******************************
+      friend bool operator ==(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return lhs.row_index == rhs.row_index;
+      }
+
+      //*******************************
+      friend bool operator !=(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+      //*******************************
+      friend bool operator <(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return lhs.row_index < rhs.row_index;
+      }
+
+      //*******************************
+      friend bool operator >(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return rhs < lhs;
+      }
+
+      //*******************************
+      friend bool operator <=(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return !(rhs < lhs);
+      }
+
+      //*******************************
+      friend bool operator >=(const basic_iterator& lhs, const basic_iterator& rhs)
+      {
+        return !(lhs < rhs);
+      }
+
+    private:
+
+      template <bool>
+      friend class basic_iterator;
+
+      friend class soa_vector;
+
+      container_t* p_container;
+      size_t       row_index;
+    };
+
+    typedef basic_iterator<false> iterator;
+    typedef basic_iterator<true>  const_iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_vector()
+      : current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_vector(const soa_vector& other)
+      : current_size(other.current_size)
+    {
+      storage.copy_construct(other.storage, current_size);
+    }
+
+    //*************************************************************************
+    /// Move constructor.
+    //*************************************************************************
+    soa_vector(soa_vector&& other)
+      : current_size(other.current_size)
+    {
+      storage.move_construct(other.storage, current_size);
+      other.clear();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_vector()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(const soa_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        storage.copy_construct(rhs.storage, rhs.current_size);
+        current_size = rhs.current_size;
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Move assignment operator.
+    //*************************************************************************
+    soa_vector& operator =(soa_vector&& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        storage.move_construct(rhs.storage, rhs.current_size);
+        current_size = rhs.current_size;
+        rhs.clear();
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Gets a span of column 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    etl::span<column_type<Index> > column()
+    {
+      return etl::span<column_type<Index> >(data<Index>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a span of column 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    etl::span<const column_type<Index> > column() const
+    {
+      return etl::span<const column_type<Index> >(data<Index>(), current_size);
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the start of column 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    column_type<Index>* data()
+    {
+      ETL_STATIC_ASSERT(Index < Column_Count, "Column index out of range");
+
+      return static_cast<typename private_soa_vector::column_level<Index, storage_t>::type&>(storage).data();
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the start of column 'Index'.
+    //*************************************************************************
+    template <size_t Index>
+    const column_type<Index>* data() const
+    {
+      ETL_STATIC_ASSERT(Index < Column_Count, "Column index out of range");
+
+      return static_cast<const typename private_soa_vector::column_level<Index, storage_t>::type&>(storage).data();
+    }
+
+    //*************************************************************************
+    /// Gets the element in column 'Index' of row 'i'.
+    //*************************************************************************
+    template <size_t Index>
+    column_type<Index>& get(size_t i)
+    {
+      return data<Index>()[i];
+    }
+
+    //*************************************************************************
+    /// Gets the element in column 'Index' of row 'i'.
+    //*************************************************************************
+    template <size_t Index>
+    const column_type<Index>& get(size_t i) const
+    {
+      return data<Index>()[i];
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first row.
+    //*************************************************************************
+    iterator begin()
+    {
+      return iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first row.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the first row.
+    //*************************************************************************
+    const_iterator cbegin() const
+    {
+      return const_iterator(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    iterator end()
+    {
+      return iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns an iterator to the end.
+    //*************************************************************************
+    const_iterator cend() const
+    {
+      return const_iterator(*this, current_size);
+    }
+
+    //*************************************************************************
+    /// Returns the row at the index.
+    //*************************************************************************
+    row operator [](size_t i)
+    {
+      return row(*this, i);
+    }
+
+    //*************************************************************************
+    /// Returns the row at the index.
+    //*************************************************************************
+    const_row operator [](size_t i) const
+    {
+      return const_row(*this, i);
+    }
+
+    //*************************************************************************
+    /// Returns the row at the index.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    row at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return row(*this, i);
+    }
+
+    //*************************************************************************
+    /// Returns the row at the index.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if the index is out of range.
+    //*************************************************************************
+    const_row at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      return const_row(*this, i);
+    }
+
+    //*************************************************************************
+    /// Returns the first row.
+    //*************************************************************************
+    row front()
+    {
+      return row(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the first row.
+    //*************************************************************************
+    const_row front() const
+    {
+      return const_row(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// Returns the last row.
+    //*************************************************************************
+    row back()
+    {
+      return row(*this, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Returns the last row.
+    //*************************************************************************
+    const_row back() const
+    {
+      return const_row(*this, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Adds a row to the end.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the soa_vector is already full.
+    //*************************************************************************
+    void push_back(const TTypes&... values)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(current_size != MAX_SIZE, ETL_ERROR(soa_vector_full));
+#endif
+      storage.push_back(current_size, values...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Adds a row to the end.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the soa_vector is already full.
+    //*************************************************************************
+    void push_back(TTypes&&... values)
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(current_size != MAX_SIZE, ETL_ERROR(soa_vector_full));
+#endif
+      storage.push_back(current_size, etl::move(values)...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Removes the last row.
+    /// If asserts or exceptions are enabled, emits soa_vector_empty if the soa_vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT_OR_RETURN(current_size > 0U, ETL_ERROR(soa_vector_empty));
+#endif
+      --current_size;
+      storage.destroy(current_size, current_size + 1U);
+    }
+
+    //*************************************************************************
+    /// Resizes the soa_vector. New rows are default constructed.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the new size is larger than the capacity.
+    //*************************************************************************
+    void resize(size_t new_size)
+    {
+      ETL_ASSERT_OR_RETURN(new_size <= MAX_SIZE, ETL_ERROR(soa_vector_full));
+
+      while (current_size < new_size)
+      {
+        storage.default_construct(current_size);
+        ++current_size;
+      }
+
+      if (new_size < current_size)
+      {
+        storage.destroy(new_size, current_size);
+        current_size = new_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Erases a row, moving the later rows down.
+    ///\return An iterator to the row after the erased one.
+    //*************************************************************************
+    iterator erase(const_iterator position)
+    {
+      const size_t index = position.row_index;
+
+      ETL_ASSERT(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      storage.erase(index, current_size);
+      --current_size;
+
+      return iterator(*this, index);
+    }
+
+    //*************************************************************************
+    /// Erases a row by moving the last row into its place.
+    /// O(1), but does not preserve the order of the rows.
+    //*************************************************************************
+    void erase_unordered(size_t index)
+    {
+      ETL_ASSERT_OR_RETURN(index < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      --current_size;
+
+      if (index != current_size)
+      {
+        storage.swap_rows(index, current_size);
+      }
+
+      storage.destroy(current_size, current_size + 1U);
+    }
+
+    //*************************************************************************
+    /// Clears the soa_vector.
+    //*************************************************************************
+    void clear()
+    {
+      storage.destroy(0U, current_size);
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of rows.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no rows.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the soa_vector is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the capacity.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum size.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+  private:
+
+    storage_t storage;
+    size_t    current_size;
+  };
+
+  template <size_t MAX_SIZE_, typename... TTypes>
+  ETL_CONSTANT size_t soa_vector<MAX_SIZE_, TTypes...>::MAX_SIZE;
+
+  template <size_t MAX_SIZE_, typename... TTypes>
+  ETL_CONSTANT size_t soa_vector<MAX_SIZE_, TTypes...>::Column_Count;
+}
+
+#endif
+#endif
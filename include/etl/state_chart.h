@@ -34,6 +34,8 @@ SOFTWARE.
 #include "array.h"
 #include "array_view.h"
 #include "utility.h"
+#include "type_traits.h"
+#include "static_assert.h"
 
 #include <stdint.h>
 
@@ -222,6 +224,525 @@ namespace etl
     state_id_t current_state_id; ///< The current state id.
   };
 
+#if ETL_USING_CPP14 && !defined(ETL_STATE_CHART_CT_FORCE_LINEAR_SEARCH)
+    #define ETL_STATE_CHART_CT_USING_INDEX 1
+  #else
+    #define ETL_STATE_CHART_CT_USING_INDEX 0
+  #endif
+
+  #if ETL_STATE_CHART_CT_USING_INDEX
+    namespace private_state_chart
+    {
+      typedef uint16_t position_t;
+
+      //*************************************************************************
+      /// Returns one more than the largest state id referenced by the tables.
+      //*************************************************************************
+      template <typename TTransition, typename TState>
+      constexpr size_t state_id_limit(const TTransition* transitions, size_t n_transitions,
+                                      const TState* states, size_t n_states,
+                                      state_chart_traits::state_id_t initial_state)
+      {
+        size_t limit = size_t(initial_state) + 1U;
+
+        for (size_t i = 0U; i < n_transitions; ++i)
+        {
+          if (!transitions[i].from_any_state && (size_t(transitions[i].current_state_id) >= limit))
+          {
+            limit = size_t(transitions[i].current_state_id) + 1U;
+          }
+
+          if (size_t(transitions[i].next_state_id) >= limit)
+          {
+            limit = size_t(transitions[i].next_state_id) + 1U;
+          }
+        }
+
+        for (size_t i = 0U; i < n_states; ++i)
+        {
+          if (size_t(states[i].state_id) >= limit)
+          {
+            limit = size_t(states[i].state_id) + 1U;
+          }
+        }
+
+        return limit;
+      }
+
+      //*************************************************************************
+      /// Returns one more than the largest event id referenced by the table.
+      //*************************************************************************
+      template <typename TTransition>
+      constexpr size_t event_id_limit(const TTransition* transitions, size_t n_transitions)
+      {
+        size_t limit = 1U;
+
+        for (size_t i = 0U; i < n_transitions; ++i)
+        {
+          if (size_t(transitions[i].event_id) >= limit)
+          {
+            limit = size_t(transitions[i].event_id) + 1U;
+          }
+        }
+
+        return limit;
+      }
+
+      //*************************************************************************
+      /// Returns the number of 'from any state' transitions, optionally for one event.
+      //*************************************************************************
+      template <typename TTransition>
+      constexpr size_t any_state_count(const TTransition* transitions, size_t n_transitions, size_t event_id = ~size_t(0))
+      {
+        size_t count = 0U;
+
+        for (size_t i = 0U; i < n_transitions; ++i)
+        {
+          if (transitions[i].from_any_state && ((event_id == ~size_t(0)) || (size_t(transitions[i].event_id) == event_id)))
+          {
+            ++count;
+          }
+        }
+
+        return count;
+      }
+
+      //*************************************************************************
+      /// Returns true if the transition is the first with its state/event pair.
+      //*************************************************************************
+      template <typename TTransition>
+      constexpr bool is_first_of_pair(const TTransition* transitions, size_t i)
+      {
+        for (size_t j = 0U; j < i; ++j)
+        {
+          if (!transitions[j].from_any_state &&
+              (transitions[j].current_state_id == transitions[i].current_state_id) &&
+              (transitions[j].event_id == transitions[i].event_id))
+          {
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+      //*************************************************************************
+      /// Returns the number of distinct state/event pairs.
+      //*************************************************************************
+      template <typename TTransition>
+      constexpr size_t pair_count(const TTransition* transitions, size_t n_transitions)
+      {
+        size_t count = 0U;
+
+        for (size_t i = 0U; i < n_transitions; ++i)
+        {
+          if (!transitions[i].from_any_state && is_first_of_pair(transitions, i))
+          {
+            ++count;
+          }
+        }
+
+        return count;
+      }
+
+      //*************************************************************************
+      /// Returns the number of candidates stored by the sparse index.
+      /// Each distinct pair holds its own transitions plus those for any state.
+      //*************************************************************************
+      template <typename TTransition>
+      constexpr size_t pair_candidate_count(const TTransition* transitions, size_t n_transitions)
+      {
+        size_t count = 0U;
+
+        for (size_t i = 0U; i < n_transitions; ++i)
+        {
+          if (!transitions[i].from_any_state)
+          {
+            ++count;
+
+            if (is_first_of_pair(transitions, i))
+            {
+              count += any_state_count(transitions, n_transitions, transitions[i].event_id);
+            }
+          }
+        }
+
+        return count;
+      }
+
+      //*************************************************************************
+      /// Converts the candidate counts held in 'first' to the start offsets.
+      //*************************************************************************
+      constexpr void accumulate_offsets(position_t* first, size_t n_lists)
+      {
+        for (size_t i = 0U; i < n_lists; ++i)
+        {
+          first[i + 1U] += first[i];
+        }
+      }
+
+      //*************************************************************************
+      /// After filling, 'first[i]' holds the end of list 'i'; shift them back.
+      //*************************************************************************
+      constexpr void restore_offsets(position_t* first, size_t n_lists)
+      {
+        for (size_t i = n_lists; i > 0U; --i)
+        {
+          first[i] = first[i - 1U];
+        }
+
+        first[0] = 0U;
+      }
+
+      //*************************************************************************
+      /// Finds the first candidate at or after 'position'.
+      //*************************************************************************
+      inline const position_t* next_candidate(const position_t* begin, const position_t* end, size_t position)
+      {
+        // Candidate lists are short; a linear search beats a binary one.
+        while ((begin != end) && (*begin < position))
+        {
+          ++begin;
+        }
+
+        return begin;
+      }
+
+      //*************************************************************************
+      /// A dense two dimensional index of candidate transitions.
+      /// One list per (state, event) pair, in transition table order.
+      //*************************************************************************
+      template <size_t N_States, size_t N_Events, size_t N_Candidates>
+      struct dense_transition_index
+      {
+        static ETL_CONSTANT size_t N_Lists = N_States * N_Events;
+
+        template <typename TTransition>
+        constexpr dense_transition_index(const TTransition* transitions, size_t n_transitions)
+          : first()
+          , candidate()
+        {
+          for (size_t i = 0U; i < n_transitions; ++i)
+          {
+            if (transitions[i].from_any_state)
+            {
+              for (size_t s = 0U; s < N_States; ++s)
+              {
+                ++first[list(s, transitions[i].event_id) + 1U];
+              }
+            }
+            else
+            {
+              ++first[list(transitions[i].current_state_id, transitions[i].event_id) + 1U];
+            }
+          }
+
+          accumulate_offsets(first, N_Lists);
+
+          for (size_t i = 0U; i < n_transitions; ++i)
+          {
+            if (transitions[i].from_any_state)
+            {
+              for (size_t s = 0U; s < N_States; ++s)
+              {
+                candidate[first[list(s, transitions[i].event_id)]++] = position_t(i);
+              }
+            }
+            else
+            {
+              candidate[first[list(transitions[i].current_state_id, transitions[i].event_id)]++] = position_t(i);
+            }
+          }
+
+          restore_offsets(first, N_Lists);
+        }
+
+        //***********************************************************************
+        /// Gets the position of the first candidate, at or after 'position',
+        /// for the state and event. Returns 'not_found' if there is none.
+        //***********************************************************************
+        size_t find(size_t state_id, size_t event_id, size_t position, size_t not_found) const
+        {
+          // The state id is always in range, as N_States covers every id in the tables.
+          if (event_id < N_Events)
+          {
+            const size_t l = list(state_id, event_id);
+            const position_t* end = candidate + first[l + 1U];
+            const position_t* c   = next_candidate(candidate + first[l], end, position);
+
+            return (c != end) ? size_t(*c) : not_found;
+          }
+
+          return not_found;
+        }
+
+        static constexpr size_t list(size_t state_id, size_t event_id)
+        {
+          return (state_id * N_Events) + event_id;
+        }
+
+        position_t first[N_Lists + 1U];
+        position_t candidate[(N_Candidates == 0U) ? 1U : N_Candidates];
+      };
+
+      //*************************************************************************
+      /// A sparse index of candidate transitions.
+      /// One list per state/event pair found in the table, sorted by key and
+      /// searched with a binary search, plus one list per event for states
+      /// that only have 'from any state' transitions.
+      //*************************************************************************
+      template <size_t N_Events, size_t N_Keys, size_t N_Candidates, size_t N_Any>
+      struct sparse_transition_index
+      {
+        template <typename TTransition>
+        constexpr sparse_transition_index(const TTransition* transitions, size_t n_transitions)
+          : key()
+          , first()
+          , candidate()
+          , any_first()
+          , any_candidate()
+        {
+          // Insert the keys in sorted order.
+          size_t n_keys = 0U;
+
+          for (size_t i = 0U; i < n_transitions; ++i)
+          {
+            if (!transitions[i].from_any_state)
+            {
+              const position_t k = make_key(transitions[i].current_state_id, transitions[i].event_id);
+              const size_t     p = lower_bound(k, n_keys);
+
+              if ((p == n_keys) || (key[p] != k))
+              {
+                for (size_t j = n_keys; j > p; --j)
+                {
+                  key[j] = key[j - 1U];
+                }
+
+                key[p] = k;
+                ++n_keys;
+              }
+            }
+          }
+
+          // Count the candidates for each list.
+          for (size_t i = 0U; i < n_transitions; ++i)
+          {
+            if (transitions[i].from_any_state)
+            {
+              ++any_first[size_t(transitions[i].event_id) + 1U];
+
+              for (size_t k = 0U; k < N_Keys; ++k)
+              {
+                if ((size_t(key[k]) % N_Events) == size_t(transitions[i].event_id))
+                {
+                  ++first[k + 1U];
+                }
+              }
+            }
+            else
+            {
+              ++first[lower_bound(make_key(transitions[i].current_state_id, transitions[i].event_id), N_Keys) + 1U];
+            }
+          }
+
+          accumulate_offsets(first, N_Keys);
+          accumulate_offsets(any_first, N_Events);
+
+          // Fill the lists, in table order.
+          for (size_t i = 0U; i < n_transitions; ++i)
+          {
+            if (transitions[i].from_any_state)
+            {
+              any_candidate[any_first[transitions[i].event_id]++] = position_t(i);
+
+              for (size_t k = 0U; k < N_Keys; ++k)
+              {
+                if ((size_t(key[k]) % N_Events) == size_t(transitions[i].event_id))
+                {
+                  candidate[first[k]++] = position_t(i);
+                }
+              }
+            }
+            else
+            {
+              candidate[first[lower_bound(make_key(transitions[i].current_state_id, transitions[i].event_id), N_Keys)]++] = position_t(i);
+            }
+          }
+
+          restore_offsets(first, N_Keys);
+          restore_offsets(any_first, N_Events);
+        }
+
+        //***********************************************************************
+        /// Gets the position of the first candidate, at or after 'position',
+        /// for the state and event. Returns 'not_found' if there is none.
+        //***********************************************************************
+        size_t find(size_t state_id, size_t event_id, size_t position, size_t not_found) const
+        {
+          if (event_id >= N_Events)
+          {
+            return not_found;
+          }
+
+          const position_t* begin;
+          const position_t* end;
+
+          const position_t k = make_key(state_id, event_id);
+          const size_t     p = lower_bound(k, N_Keys);
+
+          if ((p != N_Keys) && (key[p] == k))
+          {
+            begin = candidate + first[p];
+            end   = candidate + first[p + 1U];
+          }
+          else
+          {
+            begin = any_candidate + any_first[event_id];
+            end   = any_candidate + any_first[event_id + 1U];
+          }
+
+          const position_t* c = next_candidate(begin, end, position);
+
+          return (c != end) ? size_t(*c) : not_found;
+        }
+
+        static constexpr position_t make_key(size_t state_id, size_t event_id)
+        {
+          return position_t((state_id * N_Events) + event_id);
+        }
+
+        constexpr size_t lower_bound(position_t k, size_t n_keys) const
+        {
+          size_t low  = 0U;
+          size_t high = n_keys;
+
+          while (low < high)
+          {
+            const size_t middle = low + ((high - low) / 2U);
+
+            if (key[middle] < k)
+            {
+              low = middle + 1U;
+            }
+            else
+            {
+              high = middle;
+            }
+          }
+
+          return low;
+        }
+
+        position_t key[(N_Keys == 0U) ? 1U : N_Keys];
+        position_t first[N_Keys + 1U];
+        position_t candidate[(N_Candidates == 0U) ? 1U : N_Candidates];
+        position_t any_first[N_Events + 1U];
+        position_t any_candidate[(N_Any == 0U) ? 1U : N_Any];
+      };
+
+      //*************************************************************************
+      /// A dense lookup from state id to state table position.
+      /// N_States covers the initial state and every id in the tables, so the
+      /// chart can never be in a state outside the index, and there is no
+      /// range check.
+      //*************************************************************************
+      template <size_t N_States>
+      struct state_index
+      {
+        template <typename TState>
+        constexpr state_index(const TState* states, size_t n_states)
+          : position()
+        {
+          for (size_t s = 0U; s < N_States; ++s)
+          {
+            position[s] = position_t(n_states);
+          }
+
+          // Search backwards so that the first of any duplicate ids is used.
+          for (size_t i = n_states; i > 0U; --i)
+          {
+            position[states[i - 1U].state_id] = position_t(i - 1U);
+          }
+        }
+
+        size_t find(size_t state_id) const
+        {
+          return size_t(position[state_id]);
+        }
+
+        position_t position[N_States];
+      };
+
+      //*************************************************************************
+      /// The compile time index of a pair of state chart tables.
+      /// Chooses the dense index unless it is more than twice the size of the
+      /// sparse one.
+      //*************************************************************************
+      template <typename TTransition, const TTransition* Transition_Table_Begin, size_t Transition_Table_Size,
+                typename TState, const TState* State_Table_Begin, size_t State_Table_Size,
+                state_chart_traits::state_id_t Initial_State>
+      struct table_index
+      {
+        ETL_STATIC_ASSERT(Transition_Table_Size < 65536U, "Transition table too large to index");
+        ETL_STATIC_ASSERT(State_Table_Size < 65536U, "State table too large to index");
+
+        static constexpr size_t N_States              = state_id_limit(Transition_Table_Begin, Transition_Table_Size, State_Table_Begin, State_Table_Size, Initial_State);
+        static constexpr size_t N_Events              = event_id_limit(Transition_Table_Begin, Transition_Table_Size);
+        static constexpr size_t N_Any                 = any_state_count(Transition_Table_Begin, Transition_Table_Size);
+        static constexpr size_t N_Specific            = Transition_Table_Size - N_Any;
+        static constexpr size_t N_Dense_Candidates    = N_Specific + (N_States * N_Any);
+        static constexpr size_t N_Keys                = pair_count(Transition_Table_Begin, Transition_Table_Size);
+        static constexpr size_t N_Sparse_Candidates   = pair_candidate_count(Transition_Table_Begin, Transition_Table_Size);
+        static constexpr size_t Dense_Size            = (N_States * N_Events) + 1U + N_Dense_Candidates;
+        static constexpr size_t Sparse_Size           = N_Keys + N_Keys + 1U + N_Sparse_Candidates + N_Events + 1U + N_Any;
+        static constexpr bool   Is_Dense              = Dense_Size <= (2U * Sparse_Size);
+
+        ETL_STATIC_ASSERT(N_Dense_Candidates < 65536U || !Is_Dense, "Transition index too large");
+        ETL_STATIC_ASSERT(N_Sparse_Candidates < 65536U, "Transition index too large");
+
+        typedef typename etl::conditional<Is_Dense,
+                                          dense_transition_index<N_States, N_Events, N_Dense_Candidates>,
+                                          sparse_transition_index<N_Events, N_Keys, N_Sparse_Candidates, N_Any> >::type transition_index_type;
+
+        typedef state_index<N_States> state_index_type;
+
+        //***********************************************************************
+        /// Finds the first transition, at or after 't', for the state and event.
+        //***********************************************************************
+        static const TTransition* find_transition(const TTransition* t, state_chart_traits::state_id_t state_id, state_chart_traits::event_id_t event_id)
+        {
+          const size_t position = size_t(t - Transition_Table_Begin);
+
+          return Transition_Table_Begin + transitions.find(state_id, event_id, position, Transition_Table_Size);
+        }
+
+        //***********************************************************************
+        /// Finds the state for the id.
+        //***********************************************************************
+        static const TState* find_state(state_chart_traits::state_id_t state_id)
+        {
+          return State_Table_Begin + states.find(state_id);
+        }
+
+        static constexpr transition_index_type transitions = transition_index_type(Transition_Table_Begin, Transition_Table_Size);
+        static constexpr state_index_type      states      = state_index_type(State_Table_Begin, State_Table_Size);
+      };
+
+      template <typename TTransition, const TTransition* Transition_Table_Begin, size_t Transition_Table_Size,
+                typename TState, const TState* State_Table_Begin, size_t State_Table_Size,
+                state_chart_traits::state_id_t Initial_State>
+      constexpr typename table_index<TTransition, Transition_Table_Begin, Transition_Table_Size, TState, State_Table_Begin, State_Table_Size, Initial_State>::transition_index_type
+        table_index<TTransition, Transition_Table_Begin, Transition_Table_Size, TState, State_Table_Begin, State_Table_Size, Initial_State>::transitions;
+
+      template <typename TTransition, const TTransition* Transition_Table_Begin, size_t Transition_Table_Size,
+                typename TState, const TState* State_Table_Begin, size_t State_Table_Size,
+                state_chart_traits::state_id_t Initial_State>
+      constexpr typename table_index<TTransition, Transition_Table_Begin, Transition_Table_Size, TState, State_Table_Begin, State_Table_Size, Initial_State>::state_index_type
+        table_index<TTransition, Transition_Table_Begin, Transition_Table_Size, TState, State_Table_Begin, State_Table_Size, Initial_State>::states;
+    }
+  #endif
+
   //***************************************************************************
   /// Simple Finite State Machine
   /// Compile time tables.
@@ -310,7 +831,7 @@ namespace etl
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -370,9 +891,31 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      return table_index::find_state(state_id);
+#else
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+#endif
     }
 
+    //*************************************************************************
+    /// Finds the first transition, at or after 't', for the event in the current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      return table_index::find_transition(t, this->current_state_id, event_id);
+#else
+      return etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+#endif
+    }
+
+#if ETL_STATE_CHART_CT_USING_INDEX
+    typedef private_state_chart::table_index<transition, Transition_Table_Begin, Transition_Table_Size,
+                                             state, State_Table_Begin, State_Table_Size,
+                                             Initial_State> table_index;
+#endif
+
     //*************************************************************************
     struct is_transition
     {
@@ -503,7 +1046,7 @@ namespace etl
         while (t != (Transition_Table_Begin + Transition_Table_Size))
         {
           // Scan the transition table from the latest position.
-          t = etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+          t = find_transition(t, event_id);
 
           // Found an entry?
           if (t != (Transition_Table_Begin + Transition_Table_Size))
@@ -567,9 +1110,31 @@ namespace etl
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      return table_index::find_state(state_id);
+#else
       return etl::find_if(State_Table_Begin, State_Table_Begin + State_Table_Size, is_state(state_id));
+#endif
+    }
+
+    //*************************************************************************
+    /// Finds the first transition, at or after 't', for the event in the current state.
+    //*************************************************************************
+    const transition* find_transition(const transition* t, event_id_t event_id) const
+    {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      return table_index::find_transition(t, this->current_state_id, event_id);
+#else
+      return etl::find_if(t, (Transition_Table_Begin + Transition_Table_Size), is_transition(event_id, this->current_state_id));
+#endif
     }
 
+#if ETL_STATE_CHART_CT_USING_INDEX
+    typedef private_state_chart::table_index<transition, Transition_Table_Begin, Transition_Table_Size,
+                                             state, State_Table_Begin, State_Table_Size,
+                                             Initial_State> table_index;
+#endif
+
     //*************************************************************************
     struct is_transition
     {
@@ -860,8 +1425,8 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
   };
 
@@ -1110,8 +1675,8 @@ namespace etl
     TObject&          object;                 ///< The object that supplies guard and action member functions.
     const transition* transition_table_begin; ///< The start of the table of transitions.
     const state*      state_table_begin;      ///< The start of the table of states.
-    uint_least8_t     transition_table_size;  ///< The size of the table of transitions.
-    uint_least8_t     state_table_size;       ///< The size of the table of states.
+    size_t            transition_table_size;  ///< The size of the table of transitions.
+    size_t            state_table_size;       ///< The size of the table of states.
     bool              started;                ///< Set if the state chart has been started.
   };
 }
@@ -0,0 +1,383 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRIDED_SPAN_INCLUDED
+#define ETL_STRIDED_SPAN_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "span.h"
+#include "private/dynamic_extent.h"
+
+#include <stddef.h>
+
+///\defgroup strided_span strided_span
+/// A view of every n'th element of a contiguous buffer, such as one channel
+/// of interleaved samples or one column of an image.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  /// A view of 'size' elements, 'stride' elements apart.
+  /// A stride of zero views one element repeated.
+  ///\ingroup strided_span
+  //***************************************************************************
+  template <typename T>
+  class strided_span
+  {
+  public:
+
+    typedef T                                element_type;
+    typedef typename etl::remove_cv<T>::type value_type;
+    typedef size_t                           size_type;
+    typedef ptrdiff_t                        difference_type;
+    typedef T&                               reference;
+    typedef const T&                         const_reference;
+    typedef T*                               pointer;
+    typedef const T*                         const_pointer;
+
+    //*************************************************************************
+    /// Iterator.
+    /// Holds the index rather than a pointer, so that it never points past
+    /// the end of the buffer.
+    //*************************************************************************
+    class iterator : public etl::iterator<ETL_OR_STD::random_access_iterator_tag, T>
+    {
+    public:
+
+      ETL_CONSTEXPR iterator()
+        : p_first(ETL_NULLPTR)
+        , step(0U)
+        , index(0)
+      {
+      }
+
+      ETL_CONSTEXPR iterator(pointer p_first_, size_t step_, ptrdiff_t index_)
+        : p_first(p_first_)
+        , step(step_)
+        , index(index_)
+      {
+      }
+
+      iterator& operator ++()
+      {
+        ++index;
+        return *this;
+      }
+
+      iterator operator ++(int)
+      {
+        iterator temp(*this);
+        ++index;
+        return temp;
+      }
+
+      iterator& operator --()
+      {
+        --index;
+        return *this;
+      }
+
+      iterator operator --(int)
+      {
+        iterator temp(*this);
+        --index;
+        return temp;
+      }
+
+      iterator& operator +=(ptrdiff_t n)
+      {
+        index += n;
+        return *this;
+      }
+
+      iterator& operator -=(ptrdiff_t n)
+      {
+        index -= n;
+        return *this;
+      }
+
+      reference operator *() const
+      {
+        return p_first[size_t(index) * step];
+      }
+
+      pointer operator ->() const
+      {
+        return &p_first[size_t(index) * step];
+      }
+
+      reference operator [](ptrdiff_t n) const
+      {
+        return p_first[size_t(index + n) * step];
+      }
+
+      friend iterator operator +(const iterator& lhs, ptrdiff_t n)
+      {
+        iterator temp(lhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator +(ptrdiff_t n, const iterator& rhs)
+      {
+        iterator temp(rhs);
+        temp += n;
+        return temp;
+      }
+
+      friend iterator operator -(const iterator& lhs, ptrdiff_t n)
+      {
+        iterator temp(lhs);
+        temp -= n;
+        return temp;
+      }
+
+      friend ptrdiff_t operator -(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index - rhs.index;
+      }
+
+      friend bool operator ==(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index == rhs.index;
+      }
+
+      friend bool operator !=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index != rhs.index;
+      }
+
+      friend bool operator <(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index < rhs.index;
+      }
+
+      friend bool operator >(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index > rhs.index;
+      }
+
+      friend bool operator <=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index <= rhs.index;
+      }
+
+      friend bool operator >=(const iterator& lhs, const iterator& rhs)
+      {
+        return lhs.index >= rhs.index;
+      }
+
+    private:
+
+      pointer   p_first;
+      size_t    step;
+      ptrdiff_t index;
+    };
+
+    typedef ETL_OR_STD::reverse_iterator<iterator> reverse_iterator;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    ETL_CONSTEXPR strided_span() ETL_NOEXCEPT
+      : p_first(ETL_NULLPTR)
+      , n_elements(0U)
+      , step(1U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a pointer to the first element, the number of elements and the stride.
+    //*************************************************************************
+    ETL_CONSTEXPR strided_span(pointer p_first_, size_t size_, size_t stride_) ETL_NOEXCEPT
+      : p_first(p_first_)
+      , n_elements(size_)
+      , step(stride_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a view of every 'stride_' element of a span, starting at 'offset'.
+    /// For interleaved samples, 'offset' is the channel and 'stride_' the number of channels.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    ETL_CONSTEXPR14 strided_span(const etl::span<U, Extent>& buffer, size_t offset, size_t stride_) ETL_NOEXCEPT
+      : p_first(buffer.data() + offset)
+      , n_elements(((offset < buffer.size()) && (stride_ != 0U)) ? (((buffer.size() - offset) + stride_ - 1U) / stride_) : 0U)
+      , step(stride_)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a span, with a stride of one.
+    //*************************************************************************
+    template <typename U, size_t Extent>
+    ETL_CONSTEXPR strided_span(const etl::span<U, Extent>& buffer) ETL_NOEXCEPT
+      : p_first(buffer.data())
+      , n_elements(buffer.size())
+      , step(1U)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs a const view from a non-const view.
+    //*************************************************************************
+    template <typename U>
+    ETL_CONSTEXPR strided_span(const strided_span<U>& other) ETL_NOEXCEPT
+      : p_first(other.data())
+      , n_elements(other.size())
+      , step(other.stride())
+    {
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the element at 'i'.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR reference operator [](size_t i) const
+    {
+      return p_first[i * step];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the first element.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR reference front() const
+    {
+      return p_first[0];
+    }
+
+    //*************************************************************************
+    /// Returns a reference to the last element.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR reference back() const
+    {
+      return p_first[(n_elements - 1U) * step];
+    }
+
+    //*************************************************************************
+    /// Returns a pointer to the first element.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR pointer data() const ETL_NOEXCEPT
+    {
+      return p_first;
+    }
+
+    //*************************************************************************
+    /// Iterators.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR iterator begin() const ETL_NOEXCEPT
+    {
+      return iterator(p_first, step, 0);
+    }
+
+    ETL_NODISCARD ETL_CONSTEXPR iterator end() const ETL_NOEXCEPT
+    {
+      return iterator(p_first, step, ptrdiff_t(n_elements));
+    }
+
+    ETL_NODISCARD reverse_iterator rbegin() const ETL_NOEXCEPT
+    {
+      return reverse_iterator(end());
+    }
+
+    ETL_NODISCARD reverse_iterator rend() const ETL_NOEXCEPT
+    {
+      return reverse_iterator(begin());
+    }
+
+    //*************************************************************************
+    /// Returns the number of elements.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR size_t size() const ETL_NOEXCEPT
+    {
+      return n_elements;
+    }
+
+    //*************************************************************************
+    /// Checks whether the view is empty.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR bool empty() const ETL_NOEXCEPT
+    {
+      return n_elements == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the distance between elements.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR size_t stride() const ETL_NOEXCEPT
+    {
+      return step;
+    }
+
+    //*************************************************************************
+    /// Returns a view of the first 'count' elements.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR strided_span first(size_t count) const ETL_NOEXCEPT
+    {
+      return strided_span(p_first, count, step);
+    }
+
+    //*************************************************************************
+    /// Returns a view of the last 'count' elements.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR strided_span last(size_t count) const ETL_NOEXCEPT
+    {
+      return strided_span(p_first + ((n_elements - count) * step), count, step);
+    }
+
+    //*************************************************************************
+    /// Returns a view of 'count' elements from 'offset'.
+    /// The default count is the rest of the view.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR strided_span subspan(size_t offset, size_t count = etl::dynamic_extent) const ETL_NOEXCEPT
+    {
+      return strided_span(p_first + (offset * step), (count == etl::dynamic_extent) ? (n_elements - offset) : count, step);
+    }
+
+    //*************************************************************************
+    /// Returns a view of every 'n'th element, from the first.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR strided_span every(size_t n) const ETL_NOEXCEPT
+    {
+      return strided_span(p_first, (n_elements + n - 1U) / n, step * n);
+    }
+
+  private:
+
+    pointer p_first;
+    size_t  n_elements;
+    size_t  step;
+  };
+}
+
+#endif
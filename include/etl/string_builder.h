@@ -0,0 +1,452 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_BUILDER_INCLUDED
+#define ETL_STRING_BUILDER_INCLUDED
+
+#include "platform.h"
+#include "ipool.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "span.h"
+#include "algorithm.h"
+#include "char_traits.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup string_builder string_builder
+/// Builds long text in fixed size chunks taken from an etl::ipool.
+/// Appending never moves text that has already been written, and several
+/// builders may share one pool, so no builder needs a buffer for the worst case.
+/// The text is read back as a list of string views, one per chunk, ready
+/// for a scatter/gather write, or may be copied out in one piece.
+/// The pool is created by the user from the builder's chunk_type:
+///\code
+/// etl::pool<etl::string_builder<128>::chunk_type, 32> pool;
+/// etl::string_builder<128> builder(pool);
+///\endcode
+///\ingroup string
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// A string builder for the character type T with chunks of Chunk_Size characters.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <typename T, size_t Chunk_Size>
+  class basic_string_builder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Chunk_Size > 0U, "Zero size chunks are not valid");
+
+    typedef T                             value_type;
+    typedef size_t                        size_type;
+    typedef etl::basic_string_view<T>     view_type;
+    typedef etl::ibasic_string<T>         istring_type;
+
+    static ETL_CONSTANT size_t CHUNK_SIZE = Chunk_Size;
+
+    //*************************************************************************
+    /// The item type that the pool must be able to hold.
+    //*************************************************************************
+    struct chunk_type
+    {
+      chunk_type* next;
+      size_t      length;
+      T           text[Chunk_Size];
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool to take chunks from.
+    //*************************************************************************
+    explicit basic_string_builder(etl::ipool& pool_)
+      : pool(pool_)
+      , p_head(ETL_NULLPTR)
+      , p_tail(ETL_NULLPTR)
+      , current_size(0U)
+      , chunks(0U)
+      , truncated(false)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor. Returns the chunks to the pool.
+    //*************************************************************************
+    ~basic_string_builder()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Appends n characters.
+    /// Stops if the pool runs out of chunks and flags the builder as truncated.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t append(const T* p, size_t n)
+    {
+      size_t appended = 0U;
+
+      while (appended < n)
+      {
+        if ((p_tail == ETL_NULLPTR) || (p_tail->length == Chunk_Size))
+        {
+          if (!add_chunk())
+          {
+            break;
+          }
+        }
+
+        const size_t count = etl::min(n - appended, Chunk_Size - p_tail->length);
+
+        etl::copy_n(p + appended, count, p_tail->text + p_tail->length);
+        p_tail->length += count;
+        appended       += count;
+      }
+
+      current_size += appended;
+
+      return appended;
+    }
+
+    //*************************************************************************
+    /// Appends a null terminated string.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t append(const T* p)
+    {
+      return append(p, etl::char_traits<T>::length(p));
+    }
+
+    //*************************************************************************
+    /// Appends a string view.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t append(const view_type& view)
+    {
+      return append(view.data(), view.size());
+    }
+
+    //*************************************************************************
+    /// Appends a string.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t append(const istring_type& text)
+    {
+      return append(text.data(), text.size());
+    }
+
+    //*************************************************************************
+    /// Appends n copies of a character.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t append(size_t n, T c)
+    {
+      size_t appended = 0U;
+
+      while (appended < n)
+      {
+        if ((p_tail == ETL_NULLPTR) || (p_tail->length == Chunk_Size))
+        {
+          if (!add_chunk())
+          {
+            break;
+          }
+        }
+
+        const size_t count = etl::min(n - appended, Chunk_Size - p_tail->length);
+
+        etl::fill_n(p_tail->text + p_tail->length, count, c);
+        p_tail->length += count;
+        appended       += count;
+      }
+
+      current_size += appended;
+
+      return appended;
+    }
+
+    //*************************************************************************
+    /// Appends a character.
+    ///\return <b>true</b> if the character was appended.
+    //*************************************************************************
+    bool push_back(T c)
+    {
+      return append(1U, c) == 1U;
+    }
+
+    //*************************************************************************
+    /// Returns the chunks to the pool and clears the truncated flag.
+    //*************************************************************************
+    void clear()
+    {
+      while (p_head != ETL_NULLPTR)
+      {
+        chunk_type* p_next = p_head->next;
+        pool.release(p_head);
+        p_head = p_next;
+      }
+
+      p_tail       = ETL_NULLPTR;
+      current_size = 0U;
+      chunks       = 0U;
+      truncated    = false;
+    }
+
+    //*************************************************************************
+    /// Writes a view of each chunk, in order, to the span.
+    ///\return The number of views written, which is less than chunk_count()
+    /// if the span is too small.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t gather(etl::span<view_type, Extent> views) const
+    {
+      size_t count = 0U;
+
+      for (const chunk_type* p_chunk = p_head; (p_chunk != ETL_NULLPTR) && (count < views.size()); p_chunk = p_chunk->next)
+      {
+        views[count] = view_type(p_chunk->text, p_chunk->length);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Copies up to n characters, starting from position, to the buffer.
+    /// Does not add a terminating null.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_t copy(T* p, size_t n, size_t position = 0U) const
+    {
+      size_t copied = 0U;
+
+      for (const chunk_type* p_chunk = p_head; (p_chunk != ETL_NULLPTR) && (copied < n); p_chunk = p_chunk->next)
+      {
+        if (position >= p_chunk->length)
+        {
+          position -= p_chunk->length;
+        }
+        else
+        {
+          const size_t count = etl::min(n - copied, p_chunk->length - position);
+
+          etl::copy_n(p_chunk->text + position, count, p + copied);
+          copied  += count;
+          position = 0U;
+        }
+      }
+
+      return copied;
+    }
+
+    //*************************************************************************
+    /// Appends the text to a string, as much as will fit.
+    ///\return The number of characters appended.
+    //*************************************************************************
+    size_t copy(istring_type& text) const
+    {
+      const size_t start = text.size();
+      const size_t count = etl::min(current_size, text.available());
+
+      text.uninitialized_resize(start + count);
+
+      return copy(text.data() + start, count);
+    }
+
+    //*************************************************************************
+    /// Returns the number of characters.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no characters.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Returns the number of chunks in use.
+    //*************************************************************************
+    size_t chunk_count() const
+    {
+      return chunks;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if an append was cut short because the pool was empty.
+    //*************************************************************************
+    bool is_truncated() const
+    {
+      return truncated;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Takes a chunk from the pool and links it to the end.
+    //*************************************************************************
+    bool add_chunk()
+    {
+      if (pool.available() == 0U)
+      {
+        truncated = true;
+        return false;
+      }
+
+      chunk_type* p_chunk = pool.allocate<chunk_type>();
+
+      if (p_chunk == ETL_NULLPTR)
+      {
+        truncated = true;
+        return false;
+      }
+
+      p_chunk->next   = ETL_NULLPTR;
+      p_chunk->length = 0U;
+
+      if (p_tail == ETL_NULLPTR)
+      {
+        p_head = p_chunk;
+      }
+      else
+      {
+        p_tail->next = p_chunk;
+      }
+
+      p_tail = p_chunk;
+      ++chunks;
+
+      return true;
+    }
+
+    // Disable copy construction and assignment.
+    basic_string_builder(const basic_string_builder&) ETL_DELETE;
+    basic_string_builder& operator =(const basic_string_builder&) ETL_DELETE;
+
+    etl::ipool& pool;
+    chunk_type* p_head;
+    chunk_type* p_tail;
+    size_t      current_size;
+    size_t      chunks;
+    bool        truncated;
+  };
+
+  template <typename T, size_t Chunk_Size>
+  ETL_CONSTANT size_t basic_string_builder<T, Chunk_Size>::CHUNK_SIZE;
+
+  //***************************************************************************
+  /// A string builder for char.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t Chunk_Size>
+  class string_builder : public etl::basic_string_builder<char, Chunk_Size>
+  {
+  public:
+
+    explicit string_builder(etl::ipool& pool_)
+      : etl::basic_string_builder<char, Chunk_Size>(pool_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A string builder for wchar_t.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t Chunk_Size>
+  class wstring_builder : public etl::basic_string_builder<wchar_t, Chunk_Size>
+  {
+  public:
+
+    explicit wstring_builder(etl::ipool& pool_)
+      : etl::basic_string_builder<wchar_t, Chunk_Size>(pool_)
+    {
+    }
+  };
+
+#if ETL_HAS_CHAR8_T
+  //***************************************************************************
+  /// A string builder for char8_t.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t Chunk_Size>
+  class u8string_builder : public etl::basic_string_builder<char8_t, Chunk_Size>
+  {
+  public:
+
+    explicit u8string_builder(etl::ipool& pool_)
+      : etl::basic_string_builder<char8_t, Chunk_Size>(pool_)
+    {
+    }
+  };
+#endif
+
+  //***************************************************************************
+  /// A string builder for char16_t.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t Chunk_Size>
+  class u16string_builder : public etl::basic_string_builder<char16_t, Chunk_Size>
+  {
+  public:
+
+    explicit u16string_builder(etl::ipool& pool_)
+      : etl::basic_string_builder<char16_t, Chunk_Size>(pool_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A string builder for char32_t.
+  ///\ingroup string_builder
+  //***************************************************************************
+  template <size_t Chunk_Size>
+  class u32string_builder : public etl::basic_string_builder<char32_t, Chunk_Size>
+  {
+  public:
+
+    explicit u32string_builder(etl::ipool& pool_)
+      : etl::basic_string_builder<char32_t, Chunk_Size>(pool_)
+    {
+    }
+  };
+}
+
+#endif
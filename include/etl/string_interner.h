@@ -0,0 +1,454 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_INTERNER_INCLUDED
+#define ETL_STRING_INTERNER_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "wyhash.h"
+#include "power.h"
+#include "smallest.h"
+#include "static_assert.h"
+#include "integral_limits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+//*****************************************************************************
+/// A table of unique strings, identified by small integer handles.
+//*****************************************************************************
+namespace etl
+{
+  //***************************************************************************
+  /// A string with its hash, for interning or finding a string without hashing
+  /// it again. When C++14 is available and the key is constexpr, the hash is
+  /// calculated at compile time.
+  //***************************************************************************
+  class string_interner_key
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructs from a null terminated string.
+    //*************************************************************************
+    ETL_CONSTEXPR14 string_interner_key(const char* text_)
+      : text(text_)
+      , hash_value(etl::wyhash_64(text.data(), text.size()))
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a string view.
+    //*************************************************************************
+    ETL_CONSTEXPR14 explicit string_interner_key(const etl::string_view& text_)
+      : text(text_)
+      , hash_value(etl::wyhash_64(text.data(), text.size()))
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the text.
+    //*************************************************************************
+    ETL_CONSTEXPR etl::string_view view() const
+    {
+      return text;
+    }
+
+    //*************************************************************************
+    /// Gets the hash.
+    //*************************************************************************
+    ETL_CONSTEXPR uint64_t hash() const
+    {
+      return hash_value;
+    }
+
+  private:
+
+    etl::string_view text;
+    uint64_t         hash_value;
+  };
+
+  //***************************************************************************
+  /// A fixed capacity table of unique strings.
+  /// Interning a string stores it once, in a single arena, and returns a
+  /// handle. Interning an equal string returns an equal handle, so strings
+  /// can then be compared by comparing their handles.
+  /// The strings are found with an open addressed hash index.
+  /// Strings cannot be removed individually, only all at once by clear().
+  ///\tparam VMax_Strings The maximum number of strings.
+  ///\tparam VMax_Bytes   The size of the arena. Each string uses its length plus one.
+  //***************************************************************************
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  class string_interner
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VMax_Strings > 0U, "There must be at least one string");
+
+    typedef typename etl::smallest_uint_for_value<VMax_Strings>::type id_type;
+
+    static ETL_CONSTANT size_t Max_Strings = VMax_Strings;
+    static ETL_CONSTANT size_t Max_Bytes   = VMax_Bytes;
+
+    //*************************************************************************
+    /// Identifies an interned string.
+    /// Handles from the same interner are equal if their strings are equal.
+    //*************************************************************************
+    class handle
+    {
+    public:
+
+      //***********************************
+      /// Constructs an invalid handle.
+      //***********************************
+      ETL_CONSTEXPR handle()
+        : id(Invalid_Id)
+      {
+      }
+
+      //***********************************
+      ETL_CONSTEXPR bool is_valid() const
+      {
+        return id != Invalid_Id;
+      }
+
+      //***********************************
+      ETL_CONSTEXPR id_type get_id() const
+      {
+        return id;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR bool operator ==(const handle& lhs, const handle& rhs)
+      {
+        return lhs.id == rhs.id;
+      }
+
+      //***********************************
+      friend ETL_CONSTEXPR bool operator !=(const handle& lhs, const handle& rhs)
+      {
+        return lhs.id != rhs.id;
+      }
+
+      //***********************************
+      /// Orders by the order of interning, not by the text.
+      //***********************************
+      friend ETL_CONSTEXPR bool operator <(const handle& lhs, const handle& rhs)
+      {
+        return lhs.id < rhs.id;
+      }
+
+    private:
+
+      friend class string_interner;
+
+      ETL_CONSTEXPR explicit handle(id_type id_)
+        : id(id_)
+      {
+      }
+
+      id_type id;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    string_interner()
+      : index()
+      , entries()
+      , n_strings(0U)
+      , n_bytes(0U)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Interns a string.
+    /// Returns an invalid handle if the string is new and there is no room.
+    //*************************************************************************
+    handle intern(const etl::string_view& text)
+    {
+      return intern(etl::string_interner_key(text));
+    }
+
+    //*************************************************************************
+    /// Interns a string from a null terminated string.
+    /// Returns an invalid handle if the string is new and there is no room.
+    //*************************************************************************
+    handle intern(const char* text)
+    {
+      return intern(etl::string_interner_key(text));
+    }
+
+    //*************************************************************************
+    /// Interns a string whose hash has already been calculated.
+    /// Returns an invalid handle if the string is new and there is no room.
+    //*************************************************************************
+    handle intern(const etl::string_interner_key& key)
+    {
+      const etl::string_view text = key.view();
+
+      size_t slot = find_slot(key);
+
+      if (index[slot] != Invalid_Id)
+      {
+        return handle(index[slot]);
+      }
+
+      if ((n_strings == VMax_Strings) || ((text.size() + 1U) > (VMax_Bytes - n_bytes)))
+      {
+        return handle();
+      }
+
+      entry& new_entry = entries[n_strings];
+
+      new_entry.offset = n_bytes;
+      new_entry.length = text.size();
+      new_entry.hash   = key.hash();
+
+      if (!text.empty())
+      {
+        memcpy(arena + n_bytes, text.data(), text.size());
+      }
+
+      arena[n_bytes + text.size()] = '\0';
+
+      n_bytes += text.size() + 1U;
+
+      const id_type id = static_cast<id_type>(n_strings);
+
+      index[slot] = id;
+      ++n_strings;
+
+      return handle(id);
+    }
+
+    //*************************************************************************
+    /// Finds a string.
+    /// Returns an invalid handle if the string has not been interned.
+    //*************************************************************************
+    handle find(const etl::string_view& text) const
+    {
+      return find(etl::string_interner_key(text));
+    }
+
+    //*************************************************************************
+    /// Finds a string from a null terminated string.
+    /// Returns an invalid handle if the string has not been interned.
+    //*************************************************************************
+    handle find(const char* text) const
+    {
+      return find(etl::string_interner_key(text));
+    }
+
+    //*************************************************************************
+    /// Finds a string whose hash has already been calculated.
+    /// Returns an invalid handle if the string has not been interned.
+    //*************************************************************************
+    handle find(const etl::string_interner_key& key) const
+    {
+      return handle(index[find_slot(key)]);
+    }
+
+    //*************************************************************************
+    /// Checks if a string has been interned.
+    //*************************************************************************
+    bool contains(const etl::string_view& text) const
+    {
+      return find(text).is_valid();
+    }
+
+    //*************************************************************************
+    /// Gets the text of an interned string.
+    /// Returns an empty view for an invalid handle.
+    //*************************************************************************
+    etl::string_view view(handle h) const
+    {
+      if (!is_interned(h))
+      {
+        return etl::string_view();
+      }
+
+      const entry& e = entries[h.id];
+
+      return etl::string_view(arena + e.offset, e.length);
+    }
+
+    //*************************************************************************
+    /// Gets the text of an interned string as a null terminated string.
+    /// Returns an empty string for an invalid handle.
+    //*************************************************************************
+    const char* c_str(handle h) const
+    {
+      return is_interned(h) ? arena + entries[h.id].offset : "";
+    }
+
+    //*************************************************************************
+    /// Checks if a handle refers to a string in this interner.
+    //*************************************************************************
+    bool is_interned(handle h) const
+    {
+      return h.is_valid() && (size_t(h.id) < n_strings);
+    }
+
+    //*************************************************************************
+    /// Removes all of the strings.
+    /// Handles that were returned before are no longer valid for this interner.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Index_Size; ++i)
+      {
+        index[i] = Invalid_Id;
+      }
+
+      n_strings = 0U;
+      n_bytes   = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of strings.
+    //*************************************************************************
+    size_t size() const
+    {
+      return n_strings;
+    }
+
+    //*************************************************************************
+    /// Checks if there are no strings.
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_strings == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks if no more strings can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return (n_strings == VMax_Strings) || (n_bytes == VMax_Bytes);
+    }
+
+    //*************************************************************************
+    /// The maximum number of strings.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return VMax_Strings;
+    }
+
+    //*************************************************************************
+    /// The number of bytes of the arena that are in use.
+    //*************************************************************************
+    size_t bytes_used() const
+    {
+      return n_bytes;
+    }
+
+    //*************************************************************************
+    /// The number of bytes of the arena that are free.
+    //*************************************************************************
+    size_t bytes_available() const
+    {
+      return VMax_Bytes - n_bytes;
+    }
+
+  private:
+
+    static ETL_CONSTANT id_type Invalid_Id = id_type(VMax_Strings);
+
+    // At most half full, so probe sequences stay short.
+    static ETL_CONSTANT size_t Index_Size = size_t(etl::power_of_2_round_up<2U * VMax_Strings>::value);
+    static ETL_CONSTANT size_t Index_Mask = Index_Size - 1U;
+
+    //*************************************************************************
+    /// Where a string is in the arena.
+    //*************************************************************************
+    struct entry
+    {
+      size_t   offset;
+      size_t   length;
+      uint64_t hash;
+    };
+
+    //*************************************************************************
+    /// Finds the index slot holding the string, or the empty slot where it
+    /// would be added.
+    //*************************************************************************
+    size_t find_slot(const etl::string_interner_key& key) const
+    {
+      const etl::string_view text = key.view();
+
+      size_t slot = size_t(key.hash() & Index_Mask);
+
+      while (index[slot] != Invalid_Id)
+      {
+        const entry& e = entries[index[slot]];
+
+        if ((e.hash == key.hash()) &&
+            (e.length == text.size()) &&
+            (text.empty() || (memcmp(arena + e.offset, text.data(), text.size()) == 0)))
+        {
+          break;
+        }
+
+        slot = (slot + 1U) & Index_Mask;
+      }
+
+      return slot;
+    }
+
+    id_type index[Index_Size];
+    entry   entries[VMax_Strings];
+    char    arena[VMax_Bytes == 0U ? 1U : VMax_Bytes];
+    size_t  n_strings;
+    size_t  n_bytes;
+  };
+
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  ETL_CONSTANT size_t string_interner<VMax_Strings, VMax_Bytes>::Max_Strings;
+
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  ETL_CONSTANT size_t string_interner<VMax_Strings, VMax_Bytes>::Max_Bytes;
+
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  ETL_CONSTANT typename string_interner<VMax_Strings, VMax_Bytes>::id_type string_interner<VMax_Strings, VMax_Bytes>::Invalid_Id;
+
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  ETL_CONSTANT size_t string_interner<VMax_Strings, VMax_Bytes>::Index_Size;
+
+  template <size_t VMax_Strings, size_t VMax_Bytes>
+  ETL_CONSTANT size_t string_interner<VMax_Strings, VMax_Bytes>::Index_Mask;
+}
+
+#endif
@@ -37,6 +37,9 @@ SOFTWARE.
 #include "memory.h"
 #include "char_traits.h"
 #include "optional.h"
+#include "iterator.h"
+#include "static_assert.h"
+#include "private/string_search.h"
 
 #include <ctype.h>
 #include <stdint.h>
@@ -756,6 +759,267 @@ namespace etl
     return etl::optional<TStringView>(view);
   }
 
+  //***************************************************************************
+  /// A set of byte sized delimiter characters, held as a 256 bit bitmap.
+  /// Membership is tested in constant time, whatever the number of delimiters.
+  //***************************************************************************
+  class string_delimiter_set
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructs an empty set.
+    //*************************************************************************
+    ETL_CONSTEXPR14 string_delimiter_set()
+      : bits()
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from a null terminated list of delimiters.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 explicit string_delimiter_set(const T* delimiters)
+      : bits()
+    {
+      while (*delimiters != 0)
+      {
+        add(*delimiters++);
+      }
+    }
+
+    //*************************************************************************
+    /// Constructs from a list of delimiters.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 string_delimiter_set(const T* delimiters, size_t length)
+      : bits()
+    {
+      for (size_t i = 0U; i < length; ++i)
+      {
+        add(delimiters[i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a delimiter.
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 void add(T c)
+    {
+      ETL_STATIC_ASSERT(sizeof(T) == 1U, "Delimiters must be byte sized characters");
+
+      const unsigned char u = c;
+
+      bits[u >> 5U] |= (uint32_t(1U) << (u & 0x1FU));
+    }
+
+    //*************************************************************************
+    /// Is the character a delimiter?
+    //*************************************************************************
+    template <typename T>
+    ETL_CONSTEXPR14 bool contains(T c) const
+    {
+      ETL_STATIC_ASSERT(sizeof(T) == 1U, "Delimiters must be byte sized characters");
+
+      const unsigned char u = c;
+
+      return (bits[u >> 5U] & (uint32_t(1U) << (u & 0x1FU))) != 0U;
+    }
+
+  private:
+
+    uint32_t bits[8];
+  };
+
+  //***************************************************************************
+  /// A lazy, non-allocating range of the tokens in a string view.
+  /// Each token is returned as a view into the original characters.
+  /// Tokens are separated by a single delimiter character, or by any of the
+  /// characters in an etl::string_delimiter_set.
+  ///	param TStringView The string view type.
+  ///	param TDelimiter  The character type, or etl::string_delimiter_set.
+  //***************************************************************************
+  template <typename TStringView, typename TDelimiter = typename TStringView::value_type>
+  class split_view
+  {
+  public:
+
+    typedef TStringView                           value_type;
+    typedef typename TStringView::value_type      char_type;
+    typedef typename TStringView::const_pointer   const_pointer;
+    typedef size_t                                size_type;
+
+    //*************************************************************************
+    /// Iterates over the tokens.
+    //*************************************************************************
+    class const_iterator : public etl::iterator<ETL_OR_STD::forward_iterator_tag, const value_type>
+    {
+    public:
+
+      friend class split_view;
+
+      //*******************************
+      const_iterator()
+        : p_split(ETL_NULLPTR)
+        , token()
+      {
+      }
+
+      //*******************************
+      const_iterator& operator ++()
+      {
+        const_pointer token_end = token.data() + token.size();
+
+        if (token_end == p_split->end_ptr)
+        {
+          p_split = ETL_NULLPTR;
+          token   = TStringView();
+        }
+        else
+        {
+          find_token(token_end + 1);
+        }
+
+        return *this;
+      }
+
+      //*******************************
+      const_iterator operator ++(int)
+      {
+        const_iterator temp(*this);
+        ++(*this);
+        return temp;
+      }
+
+      //*******************************
+      const value_type& operator *() const
+      {
+        return token;
+      }
+
+      //*******************************
+      const value_type* operator ->() const
+      {
+        return &token;
+      }
+
+      //*******************************
+      friend bool operator ==(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return (lhs.p_split == rhs.p_split) &&
+               ((lhs.p_split == ETL_NULLPTR) || (lhs.token.data() == rhs.token.data()));
+      }
+
+      //*******************************
+      friend bool operator !=(const const_iterator& lhs, const const_iterator& rhs)
+      {
+        return !(lhs == rhs);
+      }
+
+    private:
+
+      //*******************************
+      explicit const_iterator(const split_view* p_split_)
+        : p_split(p_split_)
+        , token()
+      {
+        find_token(p_split->begin_ptr);
+      }
+
+      //*******************************
+      void find_token(const_pointer start)
+      {
+        const_pointer stop = p_split->find_delimiter(start);
+
+        if (p_split->ignore_empty_tokens)
+        {
+          while ((stop == start) && (stop != p_split->end_ptr))
+          {
+            start = stop + 1;
+            stop  = p_split->find_delimiter(start);
+          }
+
+          if (stop == start)
+          {
+            p_split = ETL_NULLPTR;
+            token   = TStringView();
+            return;
+          }
+        }
+
+        token = TStringView(start, static_cast<size_t>(stop - start));
+      }
+
+      const split_view* p_split;
+      TStringView       token;
+    };
+
+    typedef const_iterator iterator;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param input               The characters to split.
+    ///\param delimiter_          The delimiter character or set of delimiters.
+    ///\param ignore_empty_tokens_ If <b>true</b>, tokens with no characters are skipped.
+    //*************************************************************************
+    split_view(const TStringView& input, const TDelimiter& delimiter_, bool ignore_empty_tokens_ = false)
+      : begin_ptr(input.data())
+      , end_ptr(input.data() + input.size())
+      , delimiter(delimiter_)
+      , ignore_empty_tokens(ignore_empty_tokens_)
+    {
+    }
+
+    //*************************************************************************
+    /// The first token.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return const_iterator(this);
+    }
+
+    //*************************************************************************
+    /// One past the last token.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return const_iterator();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the next delimiter, or the end of the input.
+    //*************************************************************************
+    const_pointer find_delimiter(const_pointer first) const
+    {
+      return (first == end_ptr) ? end_ptr : find_delimiter(first, delimiter);
+    }
+
+    //*************************************************************************
+    const_pointer find_delimiter(const_pointer first, char_type c) const
+    {
+      return etl::private_string_search::find_char(first, end_ptr, c);
+    }
+
+    //*************************************************************************
+    const_pointer find_delimiter(const_pointer first, const etl::string_delimiter_set& delimiters) const
+    {
+      while ((first != end_ptr) && !delimiters.contains(*first))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    const_pointer begin_ptr;
+    const_pointer end_ptr;
+    TDelimiter    delimiter;
+    bool          ignore_empty_tokens;
+  };
+
   //***************************************************************************
   /// pad_left
   //***************************************************************************
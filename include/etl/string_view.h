@@ -399,6 +399,13 @@ namespace etl
     //*************************************************************************
     ETL_CONSTEXPR14 int compare(basic_string_view<T, TTraits> view) const
     {
+#if ETL_USING_STRING_SEARCH_IN_CONSTEXPR
+      if (ETL_STRING_SEARCH_IS_RUNTIME)
+      {
+        return private_string_search::compare(data(), size(), view.data(), view.size());
+      }
+#endif
+
       return (*this == view) ? 0 : ((*this > view) ? 1 : -1);
     }
 
@@ -484,7 +491,18 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      const_iterator iposition = ETL_NULLPTR;
+
+#if ETL_USING_STRING_SEARCH_IN_CONSTEXPR
+      if (ETL_STRING_SEARCH_IS_RUNTIME)
+      {
+        iposition = private_string_search::search(begin() + position, end(), view.begin(), view.end());
+      }
+      else
+#endif
+      {
+        iposition = etl::search(begin() + position, end(), view.begin(), view.end());
+      }
 
       if (iposition == end())
       {
@@ -750,6 +768,14 @@ namespace etl
     //*************************************************************************
     friend ETL_CONSTEXPR14 bool operator == (const etl::basic_string_view<T, TTraits>& lhs, const etl::basic_string_view<T, TTraits>& rhs)
     {
+#if ETL_USING_STRING_SEARCH_IN_CONSTEXPR
+      if (ETL_STRING_SEARCH_IS_RUNTIME)
+      {
+        return (lhs.size() == rhs.size()) &&
+                private_string_search::equal(lhs.data(), rhs.data(), lhs.size());
+      }
+#endif
+
       return (lhs.size() == rhs.size()) &&
               etl::equal(lhs.begin(), lhs.end(), rhs.begin());
     }
@@ -32,7 +32,11 @@ SOFTWARE.
 #include "platform.h"
 #include "error_handler.h"
 #include "exception.h"
+#include "nullptr.h"
+#include "integral_limits.h"
+#include "bit.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace etl
@@ -52,6 +56,106 @@ namespace etl
 
   typedef uint_least8_t task_priority_t;
 
+  //***************************************************************************
+  /// A bitmap of the task priorities that may have work to do.
+  /// Used by the event driven scheduler policies.
+  //***************************************************************************
+  class task_ready_bitmap
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    task_ready_bitmap()
+    {
+      clear();
+    }
+
+    //*******************************************
+    /// Marks a priority as ready.
+    //*******************************************
+    void set(etl::task_priority_t priority)
+    {
+      words[priority / Bits_Per_Word] |= mask(priority);
+    }
+
+    //*******************************************
+    /// Marks a priority as not ready.
+    //*******************************************
+    void reset(etl::task_priority_t priority)
+    {
+      words[priority / Bits_Per_Word] &= ~mask(priority);
+    }
+
+    //*******************************************
+    /// Returns true if any priority is ready.
+    //*******************************************
+    bool any() const
+    {
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        if (words[i] != 0U)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Returns the highest ready priority.
+    /// Only valid if any() returns true.
+    //*******************************************
+    etl::task_priority_t highest() const
+    {
+      size_t i = Words;
+
+      while (i != 0U)
+      {
+        --i;
+
+        if (words[i] != 0U)
+        {
+          const int bit = int(Bits_Per_Word - 1U) - etl::countl_zero(words[i]);
+
+          return etl::task_priority_t((i * Bits_Per_Word) + size_t(bit));
+        }
+      }
+
+      return 0U;
+    }
+
+    //*******************************************
+    /// Marks all priorities as not ready.
+    //*******************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < Words; ++i)
+      {
+        words[i] = 0U;
+      }
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Bits_Per_Word = 32U;
+    static ETL_CONSTANT size_t Words = (size_t(etl::integral_limits<etl::task_priority_t>::max) / Bits_Per_Word) + 1U;
+
+    //*******************************************
+    /// The bit for a priority within its word.
+    //*******************************************
+    static uint32_t mask(etl::task_priority_t priority)
+    {
+      const uint32_t bit = 1U;
+
+      return bit << (priority % Bits_Per_Word);
+    }
+
+    uint32_t words[Words];
+  };
+
   //***************************************************************************
   /// Task.
   //***************************************************************************
@@ -64,7 +168,9 @@ namespace etl
     //*******************************************
     task(task_priority_t priority)
       : task_running(true),
-        task_priority(priority)
+        task_ready(false),
+        task_priority(priority),
+        p_ready_bitmap(ETL_NULLPTR)
     {
     }
 
@@ -119,10 +225,50 @@ namespace etl
       return task_priority;
     }
 
+    //*******************************************
+    /// Set the ready state for the task.
+    /// Used by event driven scheduler policies, such as
+    /// etl::scheduler_policy_ready_priority, in place of task_request_work.
+    /// Not interrupt safe.
+    //*******************************************
+    void set_task_ready(bool task_ready_)
+    {
+      task_ready = task_ready_;
+
+      if (task_ready && (p_ready_bitmap != ETL_NULLPTR))
+      {
+        p_ready_bitmap->set(task_priority);
+      }
+    }
+
+    //*******************************************
+    /// Get the ready state for the task.
+    //*******************************************
+    bool task_is_ready() const
+    {
+      return task_ready;
+    }
+
+    //*******************************************
+    /// Set the bitmap that the task marks when it becomes ready.
+    /// Called by the scheduler policy.
+    //*******************************************
+    void set_task_ready_bitmap(etl::task_ready_bitmap* p_ready_bitmap_)
+    {
+      p_ready_bitmap = p_ready_bitmap_;
+
+      if (task_ready && (p_ready_bitmap != ETL_NULLPTR))
+      {
+        p_ready_bitmap->set(task_priority);
+      }
+    }
+
   private:
 
     bool task_running;
+    bool task_ready;
     etl::task_priority_t task_priority;
+    etl::task_ready_bitmap* p_ready_bitmap;
   };
 }
 
@@ -0,0 +1,435 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TDIGEST_INCLUDED
+#define ETL_TDIGEST_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "math_constants.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <math.h>
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed memory quantile sketch, using the merging t-digest.
+  /// Values are gathered in a buffer, then merged into a sorted set of
+  /// weighted centroids. Centroids near the median may hold many values, but
+  /// those near the tails hold few, so extreme quantiles stay accurate.
+  /// Digests may be merged, so partial results can be combined.
+  /// \tparam T           The value type.
+  /// \tparam Compression The accuracy/size trade off. At most Compression + 1 centroids are kept.
+  /// \tparam Buffer_Size The number of values buffered before merging. Default = Compression.
+  //***************************************************************************
+  template <typename T, const size_t Compression = 100U, const size_t Buffer_Size = Compression>
+  class tdigest
+  {
+  public:
+
+    ETL_STATIC_ASSERT(Compression >= 10U, "Compression must be at least 10");
+    ETL_STATIC_ASSERT(Buffer_Size >= 1U, "Buffer size must be at least 1");
+
+    typedef T value_type;
+
+    static ETL_CONSTANT size_t COMPRESSION   = Compression;
+    static ETL_CONSTANT size_t MAX_CENTROIDS = Compression + 1U;
+    static ETL_CONSTANT size_t BUFFER_SIZE   = Buffer_Size;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    tdigest()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    template <typename TIterator>
+    tdigest(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*************************************************************************
+    /// Adds a value.
+    //*************************************************************************
+    void add(T value)
+    {
+      add_centroid(double(value), 1.0);
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    //*************************************************************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*************************************************************************
+    /// operator ()
+    /// Adds a value.
+    //*************************************************************************
+    void operator ()(T value)
+    {
+      add(value);
+    }
+
+    //*************************************************************************
+    /// Merges the values added to another digest.
+    //*************************************************************************
+    void merge(const tdigest& other)
+    {
+      if (&other == this)
+      {
+        const tdigest copy(other);
+        merge(copy);
+        return;
+      }
+
+      for (size_t i = 0U; i < other.centroid_count; ++i)
+      {
+        add_centroid(other.centroids[i].mean, other.centroids[i].weight);
+      }
+
+      for (size_t i = 0U; i < other.buffer_count; ++i)
+      {
+        add_centroid(other.buffer[i].mean, other.buffer[i].weight);
+      }
+
+      // The minimum and maximum from the other digest may not be centroids.
+      if (other.total_weight > 0.0)
+      {
+        min_value = (other.min_value < min_value) ? other.min_value : min_value;
+        max_value = (other.max_value > max_value) ? other.max_value : max_value;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the estimated value at quantile q, in the range 0 to 1.
+    /// Returns 0 if no values have been added.
+    //*************************************************************************
+    double quantile(double q) const
+    {
+      flush();
+
+      if (centroid_count == 0U)
+      {
+        return 0.0;
+      }
+
+      if (q <= 0.0)
+      {
+        return min_value;
+      }
+
+      if (q >= 1.0)
+      {
+        return max_value;
+      }
+
+      // Interpolate between the minimum, the centroid centres, and the maximum.
+      const double position = q * total_weight;
+
+      double previous_position = 0.0;
+      double previous_value    = min_value;
+      double cumulative        = 0.0;
+
+      for (size_t i = 0U; i < centroid_count; ++i)
+      {
+        const double centre = cumulative + (centroids[i].weight / 2.0);
+
+        if (position < centre)
+        {
+          return interpolate(position, previous_position, previous_value, centre, centroids[i].mean);
+        }
+
+        previous_position = centre;
+        previous_value    = centroids[i].mean;
+        cumulative       += centroids[i].weight;
+      }
+
+      return interpolate(position, previous_position, previous_value, total_weight, max_value);
+    }
+
+    //*************************************************************************
+    /// Gets the estimated fraction of values less than or equal to value.
+    /// Returns 0 if no values have been added.
+    //*************************************************************************
+    double cdf(T value) const
+    {
+      flush();
+
+      const double x = double(value);
+
+      if ((centroid_count == 0U) || (x < min_value))
+      {
+        return 0.0;
+      }
+
+      if (x >= max_value)
+      {
+        return 1.0;
+      }
+
+      double previous_position = 0.0;
+      double previous_value    = min_value;
+      double cumulative        = 0.0;
+
+      for (size_t i = 0U; i < centroid_count; ++i)
+      {
+        const double centre = cumulative + (centroids[i].weight / 2.0);
+
+        if (x < centroids[i].mean)
+        {
+          return interpolate(x, previous_value, previous_position, centroids[i].mean, centre) / total_weight;
+        }
+
+        previous_position = centre;
+        previous_value    = centroids[i].mean;
+        cumulative       += centroids[i].weight;
+      }
+
+      return interpolate(x, previous_value, previous_position, max_value, total_weight) / total_weight;
+    }
+
+    //*************************************************************************
+    /// Gets the smallest value added.
+    //*************************************************************************
+    double min() const
+    {
+      return (total_weight > 0.0) ? min_value : 0.0;
+    }
+
+    //*************************************************************************
+    /// Gets the largest value added.
+    //*************************************************************************
+    double max() const
+    {
+      return (total_weight > 0.0) ? max_value : 0.0;
+    }
+
+    //*************************************************************************
+    /// Gets the number of values added.
+    //*************************************************************************
+    size_t count() const
+    {
+      return size_t(total_weight);
+    }
+
+    //*************************************************************************
+    /// Returns true if no values have been added.
+    //*************************************************************************
+    bool empty() const
+    {
+      return !(total_weight > 0.0);
+    }
+
+    //*************************************************************************
+    /// Gets the number of centroids, after merging any buffered values.
+    //*************************************************************************
+    size_t size() const
+    {
+      flush();
+
+      return centroid_count;
+    }
+
+    //*************************************************************************
+    /// Merges any buffered values into the centroids.
+    //*************************************************************************
+    void flush() const
+    {
+      if (buffer_count == 0U)
+      {
+        return;
+      }
+
+      // Sort the buffered values together with the current centroids.
+      for (size_t i = 0U; i < centroid_count; ++i)
+      {
+        buffer[buffer_count + i] = centroids[i];
+      }
+
+      const size_t n = buffer_count + centroid_count;
+
+      etl::sort(buffer, buffer + n, compare_mean());
+
+      // Merge neighbours while the result stays within one unit of the scale function.
+      const double normalizer = double(Compression) / (2.0 * etl::math::pi);
+
+      centroid_count = 0U;
+
+      centroid current       = buffer[0];
+      double   weight_so_far = 0.0;
+      double   q_limit       = k_inverse(k_scale(0.0, normalizer) + 1.0, normalizer);
+
+      for (size_t i = 1U; i < n; ++i)
+      {
+        const double proposed = current.weight + buffer[i].weight;
+
+        if ((((weight_so_far + proposed) / total_weight) <= q_limit) || (centroid_count == (MAX_CENTROIDS - 1U)))
+        {
+          current.mean  += (buffer[i].mean - current.mean) * (buffer[i].weight / proposed);
+          current.weight = proposed;
+        }
+        else
+        {
+          centroids[centroid_count++] = current;
+          weight_so_far += current.weight;
+          q_limit        = k_inverse(k_scale(weight_so_far / total_weight, normalizer) + 1.0, normalizer);
+          current        = buffer[i];
+        }
+      }
+
+      centroids[centroid_count++] = current;
+      buffer_count = 0U;
+    }
+
+    //*************************************************************************
+    /// Clears the digest.
+    //*************************************************************************
+    void clear()
+    {
+      centroid_count = 0U;
+      buffer_count   = 0U;
+      total_weight   = 0.0;
+      min_value      = 0.0;
+      max_value      = 0.0;
+    }
+
+  private:
+
+    //*************************************************************************
+    struct centroid
+    {
+      double mean;
+      double weight;
+    };
+
+    //*************************************************************************
+    struct compare_mean
+    {
+      bool operator ()(const centroid& lhs, const centroid& rhs) const
+      {
+        return lhs.mean < rhs.mean;
+      }
+    };
+
+    //*************************************************************************
+    /// The k1 scale function, and its inverse.
+    //*************************************************************************
+    static double k_scale(double q, double normalizer)
+    {
+      return normalizer * asin((2.0 * q) - 1.0);
+    }
+
+    static double k_inverse(double k, double normalizer)
+    {
+      const double angle = k / normalizer;
+
+      return (angle >= (etl::math::pi / 2.0)) ? 1.0 : ((sin(angle) + 1.0) / 2.0);
+    }
+
+    //*************************************************************************
+    /// Linear interpolation from (x0, y0) to (x1, y1).
+    //*************************************************************************
+    static double interpolate(double x, double x0, double y0, double x1, double y1)
+    {
+      if (!(x1 > x0))
+      {
+        return y1;
+      }
+
+      return y0 + ((x - x0) * ((y1 - y0) / (x1 - x0)));
+    }
+
+    //*************************************************************************
+    /// Adds a weighted value to the buffer, merging if it is full.
+    //*************************************************************************
+    void add_centroid(double mean, double weight)
+    {
+      if (buffer_count == Buffer_Size)
+      {
+        flush();
+      }
+
+      if (total_weight > 0.0)
+      {
+        min_value = (mean < min_value) ? mean : min_value;
+        max_value = (mean > max_value) ? mean : max_value;
+      }
+      else
+      {
+        min_value = mean;
+        max_value = mean;
+      }
+
+      buffer[buffer_count].mean   = mean;
+      buffer[buffer_count].weight = weight;
+      ++buffer_count;
+
+      total_weight += weight;
+    }
+
+    // Room for the buffered values plus a copy of the centroids while merging.
+    mutable centroid centroids[MAX_CENTROIDS];
+    mutable centroid buffer[Buffer_Size + MAX_CENTROIDS];
+    mutable size_t   centroid_count;
+    mutable size_t   buffer_count;
+    double total_weight;
+    double min_value;
+    double max_value;
+  };
+
+  template <typename T, const size_t Compression, const size_t Buffer_Size>
+  ETL_CONSTANT size_t tdigest<T, Compression, Buffer_Size>::COMPRESSION;
+
+  template <typename T, const size_t Compression, const size_t Buffer_Size>
+  ETL_CONSTANT size_t tdigest<T, Compression, Buffer_Size>::MAX_CENTROIDS;
+
+  template <typename T, const size_t Compression, const size_t Buffer_Size>
+  ETL_CONSTANT size_t tdigest<T, Compression, Buffer_Size>::BUFFER_SIZE;
+}
+
+#endif
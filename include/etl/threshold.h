@@ -34,6 +34,8 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "span.h"
+#include "private/conditioning_simd.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -67,8 +69,47 @@ namespace etl
       return compare(value, threshold_value) ? true_value : false_value;
     }
 
+    //*****************************************************************
+    /// Thresholds a block of samples.
+    /// Processes the smaller of in.size() and out.size() samples.
+    /// 'in' and 'out' may refer to the same buffer.
+    //*****************************************************************
+    void process(etl::span<const TInput> in, etl::span<TInput> out) const
+    {
+      const size_t n = (in.size() < out.size()) ? in.size() : out.size();
+
+      process(in.data(), out.data(), n, compare_kind());
+    }
+
   private:
 
+    //*****************************************************************
+    /// 1 for etl::less, 2 for etl::greater, otherwise 0.
+    //*****************************************************************
+    typedef etl::integral_constant<int, etl::is_same<TCompare, etl::less<TInput> >::value    ? 1 :
+                                        etl::is_same<TCompare, etl::greater<TInput> >::value ? 2 : 0> compare_kind;
+
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<int, 1>) const
+    {
+      etl::private_conditioning::block_kernel<TInput>::template threshold<false>(in, out, n, threshold_value, true_value, false_value);
+    }
+
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<int, 2>) const
+    {
+      etl::private_conditioning::block_kernel<TInput>::template threshold<true>(in, out, n, threshold_value, true_value, false_value);
+    }
+
+    //*****************************************************************
+    void process(const TInput* in, TInput* out, size_t n, etl::integral_constant<int, 0>) const
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        out[i] = compare(in[i], threshold_value) ? true_value : false_value;
+      }
+    }
+
     const TInput   threshold_value;
     const TInput   true_value;
     const TInput   false_value;
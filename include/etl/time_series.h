@@ -0,0 +1,825 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIME_SERIES_INCLUDED
+#define ETL_TIME_SERIES_INCLUDED
+
+#include "platform.h"
+#include "binary.h"
+#include "bit_stream.h"
+#include "integral_limits.h"
+#include "static_assert.h"
+#include "type_traits.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+///\defgroup time_series time_series
+/// Gorilla style compression of time series.
+/// Timestamps are encoded as the difference between consecutive deltas.
+/// Floating point values are encoded as the XOR with the previous value,
+/// storing only the bits between the leading and trailing zeros.
+/// Regular timestamps cost one bit and unchanged values one bit.
+///\ingroup utilities
+
+namespace etl
+{
+  //***************************************************************************
+  /// Encodes timestamps as delta of deltas.
+  /// The first value is written in full. Each later value is written as the
+  /// change in delta with a prefix that selects the width.
+  /// '0'                 : no change.
+  /// '10'   +  7 bits    : -64 to 63.
+  /// '110'  +  9 bits    : -256 to 255.
+  /// '1110' + 12 bits    : -2048 to 2047.
+  /// '1111' + all bits   : anything else (modulo the width of T).
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename T>
+  class delta_of_delta_encoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits >= 16U), "T must be an integral type of at least 16 bits");
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    delta_of_delta_encoder()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Starts a new sequence.
+    //*************************************************************************
+    void reset()
+    {
+      previous       = 0U;
+      previous_delta = 0U;
+      started        = false;
+    }
+
+    //*************************************************************************
+    /// The number of bits that 'value' encodes to.
+    //*************************************************************************
+    size_t encoded_bits(T value) const
+    {
+      if (!started)
+      {
+        return Bits;
+      }
+
+      const uint_least8_t width = select_width(delta_of_delta(value));
+
+      return (width == 0U) ? 1U : (width == Bits) ? (4U + Bits) : (prefix_length(width) + width);
+    }
+
+    //*************************************************************************
+    /// Writes 'value' to the stream, which must have space for encoded_bits(value).
+    //*************************************************************************
+    void write_unchecked(etl::bit_stream_writer& writer, T value)
+    {
+      if (!started)
+      {
+        writer.write_unchecked(unsigned_type(value), uint_least8_t(Bits));
+        started  = true;
+        previous = unsigned_type(value);
+      }
+      else
+      {
+        const unsigned_type dod   = delta_of_delta(value);
+        const uint_least8_t width = select_width(dod);
+
+        if (width == 0U)
+        {
+          writer.write_unchecked(false);
+        }
+        else if (width == Bits)
+        {
+          writer.write_unchecked(uint8_t(0x0FU), 4U);
+          writer.write_unchecked(dod, uint_least8_t(Bits));
+        }
+        else
+        {
+          const uint_least8_t prefix_bits = prefix_length(width);
+          const uint32_t      prefix      = (uint32_t(1U) << prefix_bits) - 2U;
+          const uint32_t      payload     = uint32_t(dod) & ((uint32_t(1U) << width) - 1U);
+
+          writer.write_unchecked(uint32_t((prefix << width) | payload), uint_least8_t(prefix_bits + width));
+        }
+
+        previous_delta = unsigned_type(previous_delta + dod);
+        previous       = unsigned_type(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes 'value' to the stream.
+    /// Returns false, and writes nothing, if there is not enough space.
+    //*************************************************************************
+    bool write(etl::bit_stream_writer& writer, T value)
+    {
+      const bool success = (encoded_bits(value) <= writer.available_bits());
+
+      if (success)
+      {
+        write_unchecked(writer, value);
+      }
+
+      return success;
+    }
+
+  private:
+
+    typedef typename etl::make_unsigned<T>::type unsigned_type;
+    typedef typename etl::make_signed<T>::type   signed_type;
+
+    static ETL_CONSTANT size_t Bits = etl::integral_limits<T>::bits;
+
+    //*************************************************************************
+    unsigned_type delta_of_delta(T value) const
+    {
+      const unsigned_type delta = unsigned_type(unsigned_type(value) - previous);
+
+      return unsigned_type(delta - previous_delta);
+    }
+
+    //*************************************************************************
+    /// The payload width for a delta of delta, or 0 for no change.
+    //*************************************************************************
+    static uint_least8_t select_width(unsigned_type dod)
+    {
+      if (dod == 0U)
+      {
+        return 0U;
+      }
+
+      const signed_type value = signed_type(dod);
+
+      if ((value >= -64) && (value < 64))
+      {
+        return 7U;
+      }
+      else if ((value >= -256) && (value < 256))
+      {
+        return 9U;
+      }
+      else if ((value >= -2048) && (value < 2048))
+      {
+        return 12U;
+      }
+      else
+      {
+        return uint_least8_t(Bits);
+      }
+    }
+
+    //*************************************************************************
+    static uint_least8_t prefix_length(uint_least8_t width)
+    {
+      return (width == 7U) ? 2U : ((width == 9U) ? 3U : 4U);
+    }
+
+    unsigned_type previous;
+    unsigned_type previous_delta;
+    bool          started;
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t delta_of_delta_encoder<T>::Bits;
+
+  //***************************************************************************
+  /// Decodes timestamps written by delta_of_delta_encoder.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename T>
+  class delta_of_delta_decoder
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_integral<T>::value && (etl::integral_limits<T>::bits >= 16U), "T must be an integral type of at least 16 bits");
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    delta_of_delta_decoder()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Starts a new sequence.
+    //*************************************************************************
+    void reset()
+    {
+      previous       = 0U;
+      previous_delta = 0U;
+      started        = false;
+    }
+
+    //*************************************************************************
+    /// Reads the next value. The stream must contain it.
+    //*************************************************************************
+    T read_unchecked(etl::bit_stream_reader& reader)
+    {
+      if (!started)
+      {
+        previous = reader.read_unchecked<unsigned_type>(uint_least8_t(Bits));
+        started  = true;
+      }
+      else
+      {
+        unsigned_type dod = 0U;
+
+        if (reader.read_unchecked<bool>())
+        {
+          if (!reader.read_unchecked<bool>())
+          {
+            dod = unsigned_type(reader.read_unchecked<signed_type>(7U));
+          }
+          else if (!reader.read_unchecked<bool>())
+          {
+            dod = unsigned_type(reader.read_unchecked<signed_type>(9U));
+          }
+          else if (!reader.read_unchecked<bool>())
+          {
+            dod = unsigned_type(reader.read_unchecked<signed_type>(12U));
+          }
+          else
+          {
+            dod = reader.read_unchecked<unsigned_type>(uint_least8_t(Bits));
+          }
+        }
+
+        previous_delta = unsigned_type(previous_delta + dod);
+        previous       = unsigned_type(previous + previous_delta);
+      }
+
+      return T(previous);
+    }
+
+  private:
+
+    typedef typename etl::make_unsigned<T>::type unsigned_type;
+    typedef typename etl::make_signed<T>::type   signed_type;
+
+    static ETL_CONSTANT size_t Bits = etl::integral_limits<T>::bits;
+
+    unsigned_type previous;
+    unsigned_type previous_delta;
+    bool          started;
+  };
+
+  template <typename T>
+  ETL_CONSTANT size_t delta_of_delta_decoder<T>::Bits;
+
+  namespace private_time_series
+  {
+    //*************************************************************************
+    /// The unsigned type with the same size as a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct float_bits
+    {
+      ETL_STATIC_ASSERT(etl::is_floating_point<T>::value && ((sizeof(T) == sizeof(uint32_t)) || (sizeof(T) == sizeof(uint64_t))), "T must be a 32 or 64 bit floating point type");
+
+      typedef typename etl::conditional<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>::type type;
+
+      static ETL_CONSTANT size_t  Bits        = CHAR_BIT * sizeof(T);
+      static ETL_CONSTANT uint8_t Length_Bits = (sizeof(T) == sizeof(uint32_t)) ? 5U : 6U;
+
+      static type to_bits(T value)
+      {
+        type bits;
+        memcpy(&bits, &value, sizeof(T));
+
+        return bits;
+      }
+
+      static T from_bits(type bits)
+      {
+        T value;
+        memcpy(&value, &bits, sizeof(T));
+
+        return value;
+      }
+    };
+
+    template <typename T>
+    ETL_CONSTANT size_t float_bits<T>::Bits;
+
+    template <typename T>
+    ETL_CONSTANT uint8_t float_bits<T>::Length_Bits;
+  }
+
+  //***************************************************************************
+  /// Encodes floating point values as the XOR with the previous value.
+  /// The first value is written in full.
+  /// '0'                                  : the value is unchanged.
+  /// '10' + meaningful bits               : the XOR fits the previous leading and trailing zeros.
+  /// '11' + 5 bits leading zeros + length : a new window, followed by the meaningful bits.
+  /// The length, less one, is 5 bits for float and 6 bits for double.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename T>
+  class xor_float_encoder
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    xor_float_encoder()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Starts a new sequence.
+    //*************************************************************************
+    void reset()
+    {
+      previous = 0U;
+      leading  = 0U;
+      trailing = 0U;
+      started  = false;
+      window   = false;
+    }
+
+    //*************************************************************************
+    /// The number of bits that 'value' encodes to.
+    //*************************************************************************
+    size_t encoded_bits(T value) const
+    {
+      if (!started)
+      {
+        return traits::Bits;
+      }
+
+      const bits_type x = bits_type(traits::to_bits(value) ^ previous);
+
+      if (x == 0U)
+      {
+        return 1U;
+      }
+
+      uint_least8_t new_leading;
+      uint_least8_t new_trailing;
+      zeros(x, new_leading, new_trailing);
+
+      if (fits_window(new_leading, new_trailing))
+      {
+        return 2U + (traits::Bits - leading - trailing);
+      }
+      else
+      {
+        return 2U + 5U + traits::Length_Bits + (traits::Bits - new_leading - new_trailing);
+      }
+    }
+
+    //*************************************************************************
+    /// Writes 'value' to the stream, which must have space for encoded_bits(value).
+    //*************************************************************************
+    void write_unchecked(etl::bit_stream_writer& writer, T value)
+    {
+      const bits_type bits = traits::to_bits(value);
+
+      if (!started)
+      {
+        writer.write_unchecked(bits, uint_least8_t(traits::Bits));
+        started = true;
+      }
+      else
+      {
+        const bits_type x = bits_type(bits ^ previous);
+
+        if (x == 0U)
+        {
+          writer.write_unchecked(false);
+        }
+        else
+        {
+          uint_least8_t new_leading;
+          uint_least8_t new_trailing;
+          zeros(x, new_leading, new_trailing);
+
+          if (fits_window(new_leading, new_trailing))
+          {
+            writer.write_unchecked(uint8_t(0x02U), 2U);
+          }
+          else
+          {
+            const uint_least8_t length = uint_least8_t(traits::Bits - new_leading - new_trailing);
+
+            const uint32_t header = (uint32_t(0x03U) << (5U + traits::Length_Bits)) |
+                                    (uint32_t(new_leading) << traits::Length_Bits) |
+                                    uint32_t(length - 1U);
+
+            writer.write_unchecked(header, uint_least8_t(2U + 5U + traits::Length_Bits));
+
+            leading  = new_leading;
+            trailing = new_trailing;
+            window   = true;
+          }
+
+          writer.write_unchecked(bits_type(x >> trailing), uint_least8_t(traits::Bits - leading - trailing));
+        }
+      }
+
+      previous = bits;
+    }
+
+    //*************************************************************************
+    /// Writes 'value' to the stream.
+    /// Returns false, and writes nothing, if there is not enough space.
+    //*************************************************************************
+    bool write(etl::bit_stream_writer& writer, T value)
+    {
+      const bool success = (encoded_bits(value) <= writer.available_bits());
+
+      if (success)
+      {
+        write_unchecked(writer, value);
+      }
+
+      return success;
+    }
+
+  private:
+
+    typedef private_time_series::float_bits<T> traits;
+    typedef typename traits::type              bits_type;
+
+    //*************************************************************************
+    /// The leading zeros are limited to 31 so that they fit in 5 bits.
+    //*************************************************************************
+    static void zeros(bits_type x, uint_least8_t& new_leading, uint_least8_t& new_trailing)
+    {
+      new_leading  = etl::count_leading_zeros(x);
+      new_trailing = etl::count_trailing_zeros(x);
+
+      if (new_leading > 31U)
+      {
+        new_leading = 31U;
+      }
+    }
+
+    //*************************************************************************
+    bool fits_window(uint_least8_t new_leading, uint_least8_t new_trailing) const
+    {
+      return window && (new_leading >= leading) && (new_trailing >= trailing);
+    }
+
+    bits_type     previous;
+    uint_least8_t leading;
+    uint_least8_t trailing;
+    bool          started;
+    bool          window;
+  };
+
+  //***************************************************************************
+  /// Decodes floating point values written by xor_float_encoder.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename T>
+  class xor_float_decoder
+  {
+  public:
+
+    typedef T value_type;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    xor_float_decoder()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Starts a new sequence.
+    //*************************************************************************
+    void reset()
+    {
+      previous = 0U;
+      leading  = 0U;
+      trailing = 0U;
+      started  = false;
+    }
+
+    //*************************************************************************
+    /// Reads the next value. The stream must contain it.
+    //*************************************************************************
+    T read_unchecked(etl::bit_stream_reader& reader)
+    {
+      if (!started)
+      {
+        previous = reader.read_unchecked<bits_type>(uint_least8_t(traits::Bits));
+        started  = true;
+      }
+      else if (reader.read_unchecked<bool>())
+      {
+        if (reader.read_unchecked<bool>())
+        {
+          leading  = reader.read_unchecked<uint_least8_t>(5U);
+
+          const uint_least8_t length = uint_least8_t(reader.read_unchecked<uint_least8_t>(traits::Length_Bits) + 1U);
+
+          trailing = uint_least8_t(traits::Bits - leading - length);
+        }
+
+        const bits_type x = reader.read_unchecked<bits_type>(uint_least8_t(traits::Bits - leading - trailing));
+
+        previous = bits_type(previous ^ bits_type(x << trailing));
+      }
+
+      return traits::from_bits(previous);
+    }
+
+  private:
+
+    typedef private_time_series::float_bits<T> traits;
+    typedef typename traits::type              bits_type;
+
+    bits_type     previous;
+    uint_least8_t leading;
+    uint_least8_t trailing;
+    bool          started;
+  };
+
+  //***************************************************************************
+  /// A ring of fixed size blocks of compressed samples.
+  /// Samples are compressed into the active block. When it is full it is
+  /// copied to the ring of completed blocks, discarding the oldest if the ring
+  /// is full. Each block is a self contained compressed sequence.
+  ///\tparam TTime        The timestamp type. An integral type of at least 16 bits.
+  ///\tparam TValue       The value type. float or double.
+  ///\tparam VBlock_Bytes The size of each block.
+  ///\tparam VBlocks      The number of blocks, including the active block.
+  ///\ingroup time_series
+  //***************************************************************************
+  template <typename TTime, typename TValue, size_t VBlock_Bytes, size_t VBlocks>
+  class time_series_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VBlocks >= 2U, "At least two blocks are required");
+    ETL_STATIC_ASSERT((VBlock_Bytes * CHAR_BIT) >= (2U * (etl::integral_limits<TTime>::bits + (CHAR_BIT * sizeof(TValue)) + 4U + 13U)),
+                      "A block must hold at least two samples");
+
+    typedef TTime  time_type;
+    typedef TValue sample_value_type;
+
+    //*************************************************************************
+    /// A decoded sample.
+    //*************************************************************************
+    struct value_type
+    {
+      TTime  time;
+      TValue value;
+    };
+
+    static ETL_CONSTANT size_t Block_Bytes = VBlock_Bytes;
+    static ETL_CONSTANT size_t Blocks      = VBlocks;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    time_series_buffer()
+      : writer(active.data, VBlock_Bytes, etl::endian::big)
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Adds a sample.
+    /// When the buffer is full, the oldest block of samples is discarded.
+    //*************************************************************************
+    void push(TTime time, TValue value)
+    {
+      if ((active.count != 0U) &&
+          ((time_encoder.encoded_bits(time) + value_encoder.encoded_bits(value)) > writer.available_bits()))
+      {
+        complete_block();
+      }
+
+      time_encoder.write_unchecked(writer, time);
+      value_encoder.write_unchecked(writer, value);
+
+      ++active.count;
+      ++sample_count;
+    }
+
+    //*************************************************************************
+    /// Adds a sample.
+    /// When the buffer is full, the oldest block of samples is discarded.
+    //*************************************************************************
+    void push(const value_type& sample)
+    {
+      push(sample.time, sample.value);
+    }
+
+    //*************************************************************************
+    /// Calls 'function(const value_type&)' for each sample, oldest first.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each(TFunction function) const
+    {
+      for (size_t i = 0U; i < completed_count; ++i)
+      {
+        decode(completed[(first_completed + i) % Ring_Size], function);
+      }
+
+      decode(active, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Copies the samples, oldest first, to 'destination'.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    TOutputIterator copy(TOutputIterator destination) const
+    {
+      return for_each(copier<TOutputIterator>(destination)).destination;
+    }
+
+    //*************************************************************************
+    /// Removes all samples.
+    //*************************************************************************
+    void clear()
+    {
+      first_completed = 0U;
+      completed_count = 0U;
+      sample_count    = 0U;
+      active.count    = 0U;
+      writer.restart();
+      time_encoder.reset();
+      value_encoder.reset();
+    }
+
+    //*************************************************************************
+    /// The number of samples.
+    //*************************************************************************
+    size_t size() const
+    {
+      return sample_count;
+    }
+
+    //*************************************************************************
+    bool empty() const
+    {
+      return sample_count == 0U;
+    }
+
+    //*************************************************************************
+    /// The number of blocks in use.
+    //*************************************************************************
+    size_t block_count() const
+    {
+      return completed_count + ((active.count != 0U) ? 1U : 0U);
+    }
+
+    //*************************************************************************
+    /// The number of bytes of compressed data.
+    //*************************************************************************
+    size_t size_bytes() const
+    {
+      return (completed_count * VBlock_Bytes) + writer.size_bytes();
+    }
+
+    //*************************************************************************
+    /// The total size of the blocks.
+    //*************************************************************************
+    static ETL_CONSTEXPR size_t capacity_bytes()
+    {
+      return VBlock_Bytes * VBlocks;
+    }
+
+  private:
+
+    time_series_buffer(const time_series_buffer&) ETL_DELETE;
+    time_series_buffer& operator =(const time_series_buffer&) ETL_DELETE;
+
+    static ETL_CONSTANT size_t Ring_Size = VBlocks - 1U;
+
+    struct block_type
+    {
+      uint8_t data[VBlock_Bytes];
+      size_t  count;
+    };
+
+    template <typename TOutputIterator>
+    struct copier
+    {
+      copier(TOutputIterator destination_)
+        : destination(destination_)
+      {
+      }
+
+      void operator()(const value_type& sample)
+      {
+        *destination++ = sample;
+      }
+
+      TOutputIterator destination;
+    };
+
+    //*************************************************************************
+    template <typename TFunction>
+    static void decode(const block_type& block, TFunction& function)
+    {
+      etl::bit_stream_reader        reader(const_cast<uint8_t*>(block.data), VBlock_Bytes, etl::endian::big);
+      delta_of_delta_decoder<TTime> time_decoder;
+      xor_float_decoder<TValue>     value_decoder;
+
+      for (size_t i = 0U; i < block.count; ++i)
+      {
+        value_type sample;
+        sample.time  = time_decoder.read_unchecked(reader);
+        sample.value = value_decoder.read_unchecked(reader);
+
+        function(sample);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the active block to the ring, discarding the oldest if the ring is full.
+    //*************************************************************************
+    void complete_block()
+    {
+      if (completed_count == Ring_Size)
+      {
+        sample_count   -= completed[first_completed].count;
+        first_completed = (first_completed + 1U) % Ring_Size;
+        --completed_count;
+      }
+
+      block_type& block = completed[(first_completed + completed_count) % Ring_Size];
+      ++completed_count;
+
+      memcpy(block.data, active.data, writer.size_bytes());
+      block.count  = active.count;
+      active.count = 0U;
+
+      writer.restart();
+      time_encoder.reset();
+      value_encoder.reset();
+    }
+
+    block_type                    completed[Ring_Size];
+    size_t                        first_completed;
+    size_t                        completed_count;
+    size_t                        sample_count;
+    block_type                    active;
+    etl::bit_stream_writer        writer;
+    delta_of_delta_encoder<TTime> time_encoder;
+    xor_float_encoder<TValue>     value_encoder;
+  };
+
+  template <typename TTime, typename TValue, size_t VBlock_Bytes, size_t VBlocks>
+  ETL_CONSTANT size_t time_series_buffer<TTime, TValue, VBlock_Bytes, VBlocks>::Ring_Size;
+
+  template <typename TTime, typename TValue, size_t VBlock_Bytes, size_t VBlocks>
+  ETL_CONSTANT size_t time_series_buffer<TTime, TValue, VBlock_Bytes, VBlocks>::Block_Bytes;
+
+  template <typename TTime, typename TValue, size_t VBlock_Bytes, size_t VBlocks>
+  ETL_CONSTANT size_t time_series_buffer<TTime, TValue, VBlock_Bytes, VBlocks>::Blocks;
+}
+
+#endif
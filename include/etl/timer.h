@@ -105,6 +105,28 @@ namespace etl
       };
     };
   };
+
+  namespace private_timer
+  {
+    //*************************************************************************
+    /// Catch-up delay for a repeating timer that expired 'overshoot' ticks
+    /// before the end of the current tick.
+    /// Skips the expiries that were missed and keeps the timer in phase
+    /// with its period.
+    //*************************************************************************
+    inline uint32_t catch_up_delta(uint32_t period, uint32_t overshoot)
+    {
+      if (period == 0U)
+      {
+        return period;
+      }
+
+      const uint32_t to_next = period - (overshoot % period);
+      const uint32_t maximum = uint32_t(etl::timer::state::Inactive) - 1U;
+
+      return (overshoot > (maximum - to_next)) ? maximum : overshoot + to_next;
+    }
+  }
 }
 
 #endif
@@ -0,0 +1,712 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_SERVICE_INCLUDED
+#define ETL_TIMER_SERVICE_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message_types.h"
+#include "message.h"
+#include "message_router.h"
+#include "static_assert.h"
+#include "timer.h"
+#include "delegate.h"
+#include "placement_new.h"
+#include "private/timer_wheel.h"
+
+#include <stdint.h>
+
+///\defgroup timer_service timer_service
+/// A single timer service, shared by a number of timer groups.
+/// Each group stands in for what would otherwise be a separate callback or
+/// message timer instance. All of the groups' timers share one timing wheel
+/// and one call to 'tick', so the cost of a tick does not grow with the
+/// number of groups.
+/// A group reserves a quota of timers when it is registered. It can always
+/// register that many timers, and never more, whatever the other groups do.
+///\ingroup timer
+
+namespace etl
+{
+  //***************************************************************************
+  /// Interface for the timer service.
+  ///\ingroup timer_service
+  //***************************************************************************
+  template <typename TSemaphore, size_t VLevel_Bits = 6U>
+  class itimer_service
+  {
+  public:
+
+    typedef etl::delegate<void(void)> callback_type;
+    typedef uint_least8_t             group_id_t;
+
+    static ETL_CONSTANT group_id_t NO_GROUP = 255U;
+
+    //*******************************************
+    /// Register a group, reserving 'quota' timers for it.
+    /// Returns NO_GROUP if there is no free group, or not enough unreserved timers.
+    //*******************************************
+    group_id_t register_group(uint_least8_t quota_)
+    {
+      if ((quota_ == 0U) || (quota_ > available_quota()))
+      {
+        return NO_GROUP;
+      }
+
+      for (group_id_t i = 0U; i < MAX_GROUPS; ++i)
+      {
+        group_data& group = group_array[i];
+
+        if (group.quota == 0U)
+        {
+          group.quota   = quota_;
+          group.size    = 0U;
+          group.enabled = true;
+          reserved_quota = uint_least8_t(reserved_quota + quota_);
+
+          return i;
+        }
+      }
+
+      return NO_GROUP;
+    }
+
+    //*******************************************
+    /// Unregister a group and all of its timers.
+    //*******************************************
+    bool unregister_group(group_id_t group_id_)
+    {
+      if (!is_valid_group(group_id_))
+      {
+        return false;
+      }
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        if ((timer_array[i].id != etl::timer::id::NO_TIMER) && (timer_array[i].group == group_id_))
+        {
+          unregister_timer(i);
+        }
+      }
+
+      group_data& group = group_array[group_id_];
+
+      reserved_quota = uint_least8_t(reserved_quota - group.quota);
+      group.quota = 0U;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Enable/disable a group.
+    /// The timers of a disabled group keep running, but do not call back or
+    /// send their messages when they expire.
+    //*******************************************
+    bool enable_group(group_id_t group_id_, bool state_)
+    {
+      if (!is_valid_group(group_id_))
+      {
+        return false;
+      }
+
+      group_array[group_id_].enabled = state_;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state of a group.
+    //*******************************************
+    bool is_group_enabled(group_id_t group_id_) const
+    {
+      return is_valid_group(group_id_) && group_array[group_id_].enabled;
+    }
+
+    //*******************************************
+    /// Stops all of the timers in a group.
+    //*******************************************
+    bool stop_group(group_id_t group_id_)
+    {
+      if (!is_valid_group(group_id_))
+      {
+        return false;
+      }
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        if ((timer_array[i].id != etl::timer::id::NO_TIMER) && (timer_array[i].group == group_id_))
+        {
+          stop(i);
+        }
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// The number of timers reserved by a group.
+    //*******************************************
+    uint_least8_t group_quota(group_id_t group_id_) const
+    {
+      return is_valid_group(group_id_) ? group_array[group_id_].quota : 0U;
+    }
+
+    //*******************************************
+    /// The number of timers registered by a group.
+    //*******************************************
+    uint_least8_t group_size(group_id_t group_id_) const
+    {
+      return is_valid_group(group_id_) ? group_array[group_id_].size : 0U;
+    }
+
+    //*******************************************
+    /// The number of timers not yet reserved by a group.
+    //*******************************************
+    uint_least8_t available_quota() const
+    {
+      return uint_least8_t(MAX_TIMERS - reserved_quota);
+    }
+
+    //*******************************************
+    /// Register a callback timer in a group.
+    //*******************************************
+    etl::timer::id::type register_timer(group_id_t    group_id_,
+                                        callback_type callback_,
+                                        uint32_t      period_,
+                                        bool          repeating_)
+    {
+      etl::timer::id::type id = find_free_timer(group_id_);
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, group_id_, callback_, period_, repeating_);
+        ++group_array[group_id_].size;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Register a message timer in a group.
+    //*******************************************
+    etl::timer::id::type register_timer(group_id_t               group_id_,
+                                        const etl::imessage&     message_,
+                                        etl::imessage_router&    router_,
+                                        uint32_t                 period_,
+                                        bool                     repeating_,
+                                        etl::message_router_id_t destination_router_id_ = etl::imessage_router::ALL_MESSAGE_ROUTERS)
+    {
+      // There's no point adding null message routers.
+      if (router_.is_null_router())
+      {
+        return etl::timer::id::NO_TIMER;
+      }
+
+      etl::timer::id::type id = find_free_timer(group_id_);
+
+      if (id != etl::timer::id::NO_TIMER)
+      {
+        // Create in-place.
+        new (&timer_array[id]) timer_data(id, group_id_, message_, router_, period_, repeating_, destination_router_id_);
+        ++group_array[group_id_].size;
+      }
+
+      return id;
+    }
+
+    //*******************************************
+    /// Unregister a timer.
+    //*******************************************
+    bool unregister_timer(etl::timer::id::type id_)
+    {
+      if (!is_registered(id_))
+      {
+        return false;
+      }
+
+      timer_data& timer = timer_array[id_];
+
+      if (timer.is_active())
+      {
+        ++process_semaphore;
+        wheel.remove(timer.id);
+        --process_semaphore;
+      }
+
+      --group_array[timer.group].size;
+
+      // Reset in-place.
+      new (&timer) timer_data();
+
+      return true;
+    }
+
+    //*******************************************
+    /// Enable/disable the service.
+    //*******************************************
+    void enable(bool state_)
+    {
+      enabled = state_;
+    }
+
+    //*******************************************
+    /// Get the enable/disable state.
+    //*******************************************
+    bool is_running() const
+    {
+      return enabled;
+    }
+
+    //*******************************************
+    /// Enable/disable catch-up mode.
+    /// When enabled, a repeating timer that expires more than once during a
+    /// single call to 'tick' is only fired once, and is then rescheduled in
+    /// phase with its period.
+    //*******************************************
+    void enable_catch_up(bool state_)
+    {
+      catch_up = state_;
+    }
+
+    //*******************************************
+    /// Get the catch-up mode.
+    //*******************************************
+    bool is_catch_up_enabled() const
+    {
+      return catch_up;
+    }
+
+    //*******************************************
+    /// Clears the service of all timers and groups.
+    //*******************************************
+    void clear()
+    {
+      ++process_semaphore;
+
+      for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+      {
+        ::new (&timer_array[i]) timer_data();
+      }
+
+      wheel.clear();
+      --process_semaphore;
+
+      for (group_id_t i = 0U; i < MAX_GROUPS; ++i)
+      {
+        group_array[i] = group_data();
+      }
+
+      reserved_quota = 0U;
+    }
+
+    //*******************************************
+    // Called by the timer service to indicate the
+    // amount of time that has elapsed since the last successful call to 'tick'.
+    // Returns true if the tick was processed,
+    // false if not.
+    //*******************************************
+    bool tick(uint32_t count)
+    {
+      if (enabled)
+      {
+        if (process_semaphore == 0U)
+        {
+          // Timers started with no delay.
+          process_expired(count);
+
+          while (wheel.advance(count))
+          {
+            process_expired(count);
+          }
+
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Starts a timer.
+    //*******************************************
+    bool start(etl::timer::id::type id_, bool immediate_ = false)
+    {
+      if (!is_registered(id_))
+      {
+        return false;
+      }
+
+      timer_data& timer = timer_array[id_];
+
+      // Has a valid period.
+      if (timer.period == etl::timer::state::Inactive)
+      {
+        return false;
+      }
+
+      ++process_semaphore;
+      if (timer.is_active())
+      {
+        wheel.remove(timer.id);
+      }
+
+      wheel.insert(timer.id, immediate_ ? 0U : timer.period);
+      --process_semaphore;
+
+      return true;
+    }
+
+    //*******************************************
+    /// Stops a timer.
+    //*******************************************
+    bool stop(etl::timer::id::type id_)
+    {
+      if (!is_registered(id_))
+      {
+        return false;
+      }
+
+      timer_data& timer = timer_array[id_];
+
+      if (timer.is_active())
+      {
+        ++process_semaphore;
+        wheel.remove(timer.id);
+        --process_semaphore;
+      }
+
+      return true;
+    }
+
+    //*******************************************
+    /// Sets a timer's period.
+    //*******************************************
+    bool set_period(etl::timer::id::type id_, uint32_t period_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].period = period_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Sets a timer's mode.
+    //*******************************************
+    bool set_mode(etl::timer::id::type id_, bool repeating_)
+    {
+      if (stop(id_))
+      {
+        timer_array[id_].repeating = repeating_;
+        return true;
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Get the group that a timer belongs to.
+    /// Returns NO_GROUP if the timer is not registered.
+    //*******************************************
+    group_id_t group_of(etl::timer::id::type id_) const
+    {
+      return is_registered(id_) ? timer_array[id_].group : NO_GROUP;
+    }
+
+    //*******************************************
+    /// Get the time to the next timer event, for all groups.
+    /// Returns etl::timer::state::Inactive if no timers are active.
+    //*******************************************
+    uint32_t time_to_next() const
+    {
+      ++process_semaphore;
+      uint32_t delta = wheel.time_to_next();
+      --process_semaphore;
+
+      return delta;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The configuration of a timer.
+    struct timer_data
+    {
+      //*******************************************
+      timer_data()
+        : callback()
+        , p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , period(0U)
+        , expiry(0U)
+        , slot(wheel_type::No_Slot)
+        , destination_router_id(etl::imessage_router::ALL_MESSAGE_ROUTERS)
+        , id(etl::timer::id::NO_TIMER)
+        , group(NO_GROUP)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(true)
+      {
+      }
+
+      //*******************************************
+      /// ETL delegate callback
+      //*******************************************
+      timer_data(etl::timer::id::type id_,
+                 group_id_t           group_,
+                 callback_type        callback_,
+                 uint32_t             period_,
+                 bool                 repeating_)
+        : callback(callback_)
+        , p_message(ETL_NULLPTR)
+        , p_router(ETL_NULLPTR)
+        , period(period_)
+        , expiry(0U)
+        , slot(wheel_type::No_Slot)
+        , destination_router_id(etl::imessage_router::ALL_MESSAGE_ROUTERS)
+        , id(id_)
+        , group(group_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Message to a router
+      //*******************************************
+      timer_data(etl::timer::id::type     id_,
+                 group_id_t               group_,
+                 const etl::imessage&     message_,
+                 etl::imessage_router&    irouter_,
+                 uint32_t                 period_,
+                 bool                     repeating_,
+                 etl::message_router_id_t destination_router_id_)
+        : callback()
+        , p_message(&message_)
+        , p_router(&irouter_)
+        , period(period_)
+        , expiry(0U)
+        , slot(wheel_type::No_Slot)
+        , destination_router_id(destination_router_id_)
+        , id(id_)
+        , group(group_)
+        , previous(etl::timer::id::NO_TIMER)
+        , next(etl::timer::id::NO_TIMER)
+        , repeating(repeating_)
+      {
+      }
+
+      //*******************************************
+      /// Returns true if the timer is active.
+      //*******************************************
+      bool is_active() const
+      {
+        return slot != wheel_type::No_Slot;
+      }
+
+      callback_type            callback;
+      const etl::imessage*     p_message;
+      etl::imessage_router*    p_router;
+      uint32_t                 period;
+      uint32_t                 expiry;
+      uint16_t                 slot;
+      etl::message_router_id_t destination_router_id;
+      etl::timer::id::type     id;
+      group_id_t               group;
+      uint_least8_t            previous;
+      uint_least8_t            next;
+      bool                     repeating;
+
+    private:
+
+      // Disabled.
+      timer_data(const timer_data& other) ETL_DELETE;
+      timer_data& operator =(const timer_data& other) ETL_DELETE;
+    };
+
+    //*************************************************************************
+    /// The configuration of a group.
+    struct group_data
+    {
+      group_data()
+        : quota(0U)
+        , size(0U)
+        , enabled(false)
+      {
+      }
+
+      uint_least8_t quota;
+      uint_least8_t size;
+      bool          enabled;
+    };
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    itimer_service(timer_data* const timer_array_, const uint_least8_t MAX_TIMERS_,
+                   group_data* const group_array_, const group_id_t MAX_GROUPS_)
+      : timer_array(timer_array_)
+      , group_array(group_array_)
+      , wheel(timer_array_, MAX_TIMERS_)
+      , enabled(false)
+      , catch_up(false)
+      , process_semaphore(0U)
+      , reserved_quota(0U)
+      , MAX_TIMERS(MAX_TIMERS_)
+      , MAX_GROUPS(MAX_GROUPS_)
+    {
+    }
+
+  private:
+
+    typedef etl::private_timer_wheel::timer_wheel<timer_data, VLevel_Bits> wheel_type;
+
+    //*******************************************
+    bool is_valid_group(group_id_t group_id_) const
+    {
+      return (group_id_ < MAX_GROUPS) && (group_array[group_id_].quota != 0U);
+    }
+
+    //*******************************************
+    bool is_registered(etl::timer::id::type id_) const
+    {
+      return (id_ < MAX_TIMERS) && (timer_array[id_].id != etl::timer::id::NO_TIMER);
+    }
+
+    //*******************************************
+    /// Finds a free timer for a group that is within its quota.
+    //*******************************************
+    etl::timer::id::type find_free_timer(group_id_t group_id_) const
+    {
+      if (is_valid_group(group_id_) && (group_array[group_id_].size < group_array[group_id_].quota))
+      {
+        // Search for the free space.
+        for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+        {
+          if (timer_array[i].id == etl::timer::id::NO_TIMER)
+          {
+            return i;
+          }
+        }
+      }
+
+      return etl::timer::id::NO_TIMER;
+    }
+
+    //*******************************************
+    /// Calls back or sends the messages of all expired timers.
+    /// 'remaining' is the number of ticks still to be processed.
+    //*******************************************
+    void process_expired(uint32_t remaining)
+    {
+      etl::timer::id::type id = wheel.pop_expired();
+
+      while (id != etl::timer::id::NO_TIMER)
+      {
+        timer_data& timer = timer_array[id];
+
+        if (timer.repeating)
+        {
+          // Reinsert the timer.
+          wheel.insert(timer.id, catch_up ? etl::private_timer::catch_up_delta(timer.period, remaining) : timer.period);
+        }
+
+        if (group_array[timer.group].enabled)
+        {
+          if (timer.p_router != ETL_NULLPTR)
+          {
+            timer.p_router->receive(timer.destination_router_id, *(timer.p_message));
+          }
+          else if (timer.callback.is_valid())
+          {
+            timer.callback();
+          }
+        }
+
+        id = wheel.pop_expired();
+      }
+    }
+
+    // The array of timer data structures.
+    timer_data* const timer_array;
+
+    // The array of group data structures.
+    group_data* const group_array;
+
+    // The wheel of active timers, shared by all groups.
+    wheel_type wheel;
+
+    bool enabled;
+    bool catch_up;
+    mutable TSemaphore process_semaphore;
+    uint_least8_t reserved_quota;
+
+  public:
+
+    const uint_least8_t MAX_TIMERS;
+    const group_id_t    MAX_GROUPS;
+  };
+
+  template <typename TSemaphore, size_t VLevel_Bits>
+  ETL_CONSTANT typename itimer_service<TSemaphore, VLevel_Bits>::group_id_t itimer_service<TSemaphore, VLevel_Bits>::NO_GROUP;
+
+  //***************************************************************************
+  /// The timer service.
+  ///\ingroup timer_service
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS_, uint_least8_t MAX_GROUPS_, typename TSemaphore, size_t VLevel_Bits = 6U>
+  class timer_service : public etl::itimer_service<TSemaphore, VLevel_Bits>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254U, "No more than 254 timers are allowed");
+    ETL_STATIC_ASSERT((MAX_GROUPS_ >= 1U) && (MAX_GROUPS_ <= 254U), "Between 1 and 254 groups are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    timer_service()
+      : itimer_service<TSemaphore, VLevel_Bits>(timer_array, MAX_TIMERS_, group_array, MAX_GROUPS_)
+    {
+    }
+
+  private:
+
+    typename etl::itimer_service<TSemaphore, VLevel_Bits>::timer_data timer_array[MAX_TIMERS_];
+    typename etl::itimer_service<TSemaphore, VLevel_Bits>::group_data group_array[MAX_GROUPS_];
+  };
+}
+
+#endif
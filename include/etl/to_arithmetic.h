@@ -428,6 +428,25 @@ namespace etl
         return is_success;
       }
 
+      //*********************************
+      /// Adds eight decimal digits at once, if they would not overflow.
+      /// Leaves the value unchanged and returns false if they would.
+      //*********************************
+      ETL_NODISCARD
+      ETL_CONSTEXPR14
+      bool add_eight_digits(const uint32_t digits)
+      {
+        const TValue Scale = 100000000UL;
+
+        if ((maximum >= digits) && (integral_value <= ((maximum - digits) / Scale)))
+        {
+          integral_value = (integral_value * Scale) + digits;
+          return true;
+        }
+
+        return false;
+      }
+
       //*********************************
       ETL_NODISCARD
       ETL_CONSTEXPR14
@@ -645,6 +664,239 @@ namespace etl
       to_arithmetic_status conversion_status;
     };
 
+#if ETL_USING_64BIT_TYPES
+    //***************************************************************************
+    /// Packs eight single byte characters into a word, first character lowest.
+    /// Built from shifts rather than memcpy so that it stays constexpr.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    uint64_t load_eight_chars(const TChar* p)
+    {
+      uint64_t chunk = 0U;
+
+      for (int i = 7; i >= 0; --i)
+      {
+        chunk = (chunk << 8U) | static_cast<uint8_t>(p[i]);
+      }
+
+      return chunk;
+    }
+
+    //***************************************************************************
+    /// Checks that all eight characters in the word are decimal digits.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    bool is_eight_digits(const uint64_t chunk)
+    {
+      return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) == 0x3333333333333333ULL;
+    }
+
+    //***************************************************************************
+    /// Converts eight decimal digits in a word to their value.
+    /// Pairs, then quads, then the octet are combined with three multiplies.
+    //***************************************************************************
+    ETL_NODISCARD
+    inline
+    ETL_CONSTEXPR14
+    uint32_t parse_eight_digits(uint64_t chunk)
+    {
+      const uint64_t Mask        = 0x000000FF000000FFULL;
+      const uint64_t Multiplier1 = 100ULL + (1000000ULL << 32U);
+      const uint64_t Multiplier2 = 1ULL + (10000ULL << 32U);
+
+      chunk -= 0x3030303030303030ULL;
+      chunk  = (chunk * 10U) + (chunk >> 8U);
+      chunk  = (((chunk & Mask) * Multiplier1) + (((chunk >> 16U) & Mask) * Multiplier2)) >> 32U;
+
+      return static_cast<uint32_t>(chunk);
+    }
+
+    //***************************************************************************
+    /// Accumulates a run of decimal digits into a mantissa of up to 19 digits.
+    /// Leading zeros are not counted as significant.
+    /// Returns false if there are too many significant digits.
+    //***************************************************************************
+    template <typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool accumulate_mantissa(const TChar*& itr, const TChar* const itr_end, uint64_t& mantissa, int& significant, int& count)
+    {
+      const int Max_Significant = 19;
+
+      while (itr != itr_end)
+      {
+        if ((sizeof(TChar) == 1U) && (mantissa != 0U) && ((itr_end - itr) >= 8) && ((significant + 8) <= Max_Significant))
+        {
+          const uint64_t chunk = load_eight_chars(itr);
+
+          if (is_eight_digits(chunk))
+          {
+            mantissa     = (mantissa * 100000000ULL) + parse_eight_digits(chunk);
+            significant += 8;
+            count       += 8;
+            itr         += 8;
+            continue;
+          }
+        }
+
+        const char c = convert(*itr);
+
+        if (!is_valid(c, etl::radix::decimal))
+        {
+          break;
+        }
+
+        if ((mantissa != 0U) || (c != '0'))
+        {
+          if (++significant > Max_Significant)
+          {
+            return false;
+          }
+
+          mantissa = (mantissa * 10U) + static_cast<uint64_t>(digit_value(c, etl::radix::decimal));
+        }
+
+        ++count;
+        ++itr;
+      }
+
+      return true;
+    }
+
+    //***************************************************************************
+    /// Exact conversion of short decimal floating point text.
+    /// When the mantissa and the power of ten are both exactly representable
+    /// the result is a single correctly rounded multiply or divide.
+    /// Returns false for anything else, which is then left to the general parser.
+    //***************************************************************************
+    template <typename TValue, typename TChar>
+    ETL_NODISCARD
+    ETL_CONSTEXPR14
+    bool to_floating_point_exact(const etl::basic_string_view<TChar>& view, TValue& value)
+    {
+      const TChar*       itr     = view.begin();
+      const TChar* const itr_end = view.end();
+
+      bool is_negative = false;
+
+      if (itr != itr_end)
+      {
+        const char c = convert(*itr);
+
+        if ((c == char_constant::Positive_Char) || (c == char_constant::Negative_Char))
+        {
+          is_negative = (c == char_constant::Negative_Char);
+          ++itr;
+        }
+      }
+
+      uint64_t mantissa    = 0U;
+      int      significant = 0;
+      int      integral    = 0;
+      int      fractional  = 0;
+
+      if (!accumulate_mantissa(itr, itr_end, mantissa, significant, integral))
+      {
+        return false;
+      }
+
+      if ((itr != itr_end) && ((convert(*itr) == char_constant::Radix_Point1_Char) || (convert(*itr) == char_constant::Radix_Point2_Char)))
+      {
+        ++itr;
+
+        if (!accumulate_mantissa(itr, itr_end, mantissa, significant, fractional))
+        {
+          return false;
+        }
+      }
+
+      if ((integral + fractional) == 0)
+      {
+        return false;
+      }
+
+      // Digits after the first significant one each scale the mantissa by ten.
+      int exponent = -fractional;
+
+      if ((itr != itr_end) && (convert(*itr) == char_constant::Exponential_Char))
+      {
+        ++itr;
+
+        bool is_negative_exponent = false;
+
+        if ((itr != itr_end) && ((convert(*itr) == char_constant::Positive_Char) || (convert(*itr) == char_constant::Negative_Char)))
+        {
+          is_negative_exponent = (convert(*itr) == char_constant::Negative_Char);
+          ++itr;
+        }
+
+        int exponent_value  = 0;
+        int exponent_digits = 0;
+
+        while ((itr != itr_end) && is_valid(convert(*itr), etl::radix::decimal))
+        {
+          if (++exponent_digits > 4)
+          {
+            return false;
+          }
+
+          exponent_value = (exponent_value * 10) + digit_value(convert(*itr), etl::radix::decimal);
+          ++itr;
+        }
+
+        if (exponent_digits == 0)
+        {
+          return false;
+        }
+
+        exponent += is_negative_exponent ? -exponent_value : exponent_value;
+      }
+
+      if (itr != itr_end)
+      {
+        return false;
+      }
+
+      if (mantissa == 0U)
+      {
+        value = is_negative ? -TValue(0) : TValue(0);
+        return true;
+      }
+
+      // Powers of ten up to 10^n are exact while 5^n fits the mantissa.
+      const int Mantissa_Bits = etl::numeric_limits<TValue>::digits;
+      const int Max_Exponent  = (Mantissa_Bits * 4307) / 10000;
+
+      if ((Mantissa_Bits < 64) && (mantissa > (uint64_t(1U) << ((Mantissa_Bits < 64) ? Mantissa_Bits : 0))))
+      {
+        return false;
+      }
+
+      if ((exponent < -Max_Exponent) || (exponent > Max_Exponent))
+      {
+        return false;
+      }
+
+      TValue power = TValue(1);
+
+      for (int i = 0; i < ((exponent < 0) ? -exponent : exponent); ++i)
+      {
+        power *= TValue(10);
+      }
+
+      TValue result = static_cast<TValue>(mantissa);
+      result = (exponent < 0) ? (result / power) : (result * power);
+
+      value = is_negative ? -result : result;
+
+      return true;
+    }
+#endif
+
     //***************************************************************************
     // Define an unsigned accumulator type that is at least as large as TValue.
     //***************************************************************************
@@ -695,6 +947,25 @@ namespace etl
 
       integral_accumulator<TAccumulatorType> accumulator(radix, maximum);
 
+#if ETL_USING_64BIT_TYPES
+      // Decimal digits are taken eight at a time while they are valid and cannot overflow.
+      // Anything else is left to the character by character loop, which sets the status.
+      if ((radix == etl::radix::decimal) && (sizeof(TChar) == 1U))
+      {
+        while ((itr_end - itr) >= 8)
+        {
+          const uint64_t chunk = load_eight_chars(itr);
+
+          if (!is_eight_digits(chunk) || !accumulator.add_eight_digits(parse_eight_digits(chunk)))
+          {
+            break;
+          }
+
+          itr += 8;
+        }
+      }
+#endif
+
       while ((itr != itr_end) && accumulator.add(convert(*itr)))
       {
         // Keep looping until done or an error occurs.
@@ -901,38 +1172,49 @@ namespace etl
     }
     else
     {
-      floating_point_accumulator accumulator;
-
-      typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
-      const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
+#if ETL_USING_64BIT_TYPES
+      TValue exact_value = TValue(0);
 
-      while ((itr != itr_end) && accumulator.add(convert(*itr)))
+      if (to_floating_point_exact(view, exact_value))
       {
-        // Keep looping until done or an error occurs.
-        ++itr;
+        result = exact_value;
       }
-
-      result = unexpected_type(accumulator.status());
-
-      if (result.has_value())
+      else
+#endif
       {
-        TValue value = static_cast<TValue>(accumulator.value());
-        int exponent = accumulator.exponent();
+        floating_point_accumulator accumulator;
 
-        value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+        typename etl::basic_string_view<TChar>::const_iterator itr           = view.begin();
+        const typename etl::basic_string_view<TChar>::const_iterator itr_end = view.end();
 
-        // Check that the result is a valid floating point number.
-        if (etl::is_infinity(value))
+        while ((itr != itr_end) && accumulator.add(convert(*itr)))
         {
-          result = unexpected_type(to_arithmetic_status::Overflow);
+          // Keep looping until done or an error occurs.
+          ++itr;
         }
-        else if (etl::is_nan(value))
-        {
-          result = unexpected_type(to_arithmetic_status::Invalid_Float);
-        }
-        else
+
+        result = unexpected_type(accumulator.status());
+
+        if (result.has_value())
         {
-          result = value;
+          TValue value = static_cast<TValue>(accumulator.value());
+          int exponent = accumulator.exponent();
+
+          value *= pow(static_cast<TValue>(10.0), static_cast<TValue>(exponent));
+
+          // Check that the result is a valid floating point number.
+          if (etl::is_infinity(value))
+          {
+            result = unexpected_type(to_arithmetic_status::Overflow);
+          }
+          else if (etl::is_nan(value))
+          {
+            result = unexpected_type(to_arithmetic_status::Invalid_Float);
+          }
+          else
+          {
+            result = value;
+          }
         }
       }
     }
@@ -0,0 +1,257 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOP_K_INCLUDED
+#define ETL_TOP_K_INCLUDED
+
+#include "platform.h"
+#include "algorithm.h"
+#include "functional.h"
+#include "vector.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// Top K.
+  /// Keeps the K greatest values that have been added, as ordered by TCompare.
+  /// The values are held in a heap with the least of them at the front, so
+  /// each added value takes O(log K) time and no memory is allocated.
+  //***************************************************************************
+  template <typename T, size_t VK, typename TCompare = etl::less<T> >
+  class top_k : public etl::unary_function<T, void>
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VK > 0U, "K must be greater than zero");
+
+    typedef T        value_type;
+    typedef const T& const_reference;
+    typedef const T* const_iterator;
+    typedef size_t   size_type;
+
+    static ETL_CONSTANT size_t K = VK;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    top_k()
+      : compare()
+      , counter(0U)
+    {
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    explicit top_k(TCompare compare_)
+      : compare(compare_)
+      , counter(0U)
+    {
+    }
+
+    //*********************************
+    /// Constructor, from a range.
+    //*********************************
+    template <typename TIterator>
+    top_k(TIterator first, TIterator last)
+      : compare()
+      , counter(0U)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(const_reference value)
+    {
+      ++counter;
+
+      heap_compare heap(compare);
+
+      if (!values.full())
+      {
+        values.push_back(value);
+        etl::push_heap(values.begin(), values.end(), heap);
+      }
+      else if (compare(values.front(), value))
+      {
+        // Replace the least of the kept values.
+        etl::pop_heap(values.begin(), values.end(), heap);
+        values.back() = value;
+        etl::push_heap(values.begin(), values.end(), heap);
+      }
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(const_reference value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// The least of the kept values.
+    /// A new value must be greater than this to be kept once the top K is full.
+    //*********************************
+    const_reference threshold() const
+    {
+      return values.front();
+    }
+
+    //*********************************
+    /// Copies the kept values to 'out', greatest first.
+    /// Returns the end of the output.
+    //*********************************
+    template <typename TOutputIterator>
+    TOutputIterator copy_sorted(TOutputIterator out) const
+    {
+      etl::vector<T, VK> sorted(values.begin(), values.end());
+
+      etl::sort_heap(sorted.begin(), sorted.end(), heap_compare(compare));
+
+      return etl::copy(sorted.begin(), sorted.end(), out);
+    }
+
+    //*********************************
+    /// The kept values, in heap order.
+    //*********************************
+    const_iterator begin() const
+    {
+      return values.begin();
+    }
+
+    //*********************************
+    /// The end of the kept values.
+    //*********************************
+    const_iterator end() const
+    {
+      return values.end();
+    }
+
+    //*********************************
+    /// The number of kept values.
+    //*********************************
+    size_type size() const
+    {
+      return values.size();
+    }
+
+    //*********************************
+    /// Checks if no values have been kept.
+    //*********************************
+    bool empty() const
+    {
+      return values.empty();
+    }
+
+    //*********************************
+    /// Checks if K values have been kept.
+    //*********************************
+    bool full() const
+    {
+      return values.full();
+    }
+
+    //*********************************
+    /// Get the total number of added values.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(counter);
+    }
+
+    //*********************************
+    /// Clear the top K.
+    //*********************************
+    void clear()
+    {
+      values.clear();
+      counter = 0U;
+    }
+
+  private:
+
+    //*********************************
+    /// Orders the heap so that the least value is at the front.
+    //*********************************
+    struct heap_compare
+    {
+      explicit heap_compare(const TCompare& compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const_reference lhs, const_reference rhs) const
+      {
+        return compare(rhs, lhs);
+      }
+
+      TCompare compare;
+    };
+
+    etl::vector<T, VK> values;
+    TCompare           compare;
+    uint32_t           counter;
+  };
+
+  template <typename T, size_t VK, typename TCompare>
+  ETL_CONSTANT size_t top_k<T, VK, TCompare>::K;
+}
+
+#endif
@@ -0,0 +1,260 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOPIC_BROKER_INCLUDED
+#define ETL_TOPIC_BROKER_INCLUDED
+
+#include "platform.h"
+#include "nullptr.h"
+#include "message.h"
+#include "message_router.h"
+#include "message_trace.h"
+#include "shared_message.h"
+#include "string_view.h"
+#include "topic_trie.h"
+
+#include <stddef.h>
+
+namespace etl
+{
+  //***************************************************************************
+  /// The interface for topic brokers of any capacity.
+  /// A front end to the message routers that delivers messages published to
+  /// a string topic to the routers subscribed to a matching topic filter.
+  /// Filters may contain the '+' and '#' wildcards, as described for
+  /// etl::itopic_trie. Published messages are then passed on to a successor,
+  /// if there is one, such as an etl::message_broker for id subscriptions.
+  /// Subscriptions must not be changed while a message is being published.
+  //***************************************************************************
+  class itopic_broker
+  {
+  public:
+
+    typedef etl::itopic_trie<etl::imessage_router*> trie_type;
+
+    //*******************************************
+    /// Subscribes the router to the topic filter.
+    /// The filter's characters must remain valid while it is subscribed.
+    ///\return <b>true</b> if the router is subscribed.
+    //*******************************************
+    bool subscribe(etl::string_view filter, etl::imessage_router& router)
+    {
+      return p_trie->subscribe(filter, &router);
+    }
+
+    //*******************************************
+    /// Unsubscribes the router from the topic filter.
+    ///\return <b>true</b> if the router was subscribed.
+    //*******************************************
+    bool unsubscribe(etl::string_view filter, etl::imessage_router& router)
+    {
+      return p_trie->unsubscribe(filter, &router);
+    }
+
+    //*******************************************
+    /// Unsubscribes the router from every topic filter.
+    ///\return The number of subscriptions removed.
+    //*******************************************
+    size_t unsubscribe(etl::imessage_router& router)
+    {
+      return p_trie->unsubscribe(&router);
+    }
+
+    //*******************************************
+    /// Publishes a message to the topic.
+    ///\return The number of routers the message was delivered to.
+    //*******************************************
+    size_t publish(etl::string_view topic, const etl::imessage& msg)
+    {
+      const size_t count = p_trie->match(topic, deliverer<const etl::imessage>(msg)).count;
+
+      if (p_successor != ETL_NULLPTR)
+      {
+        p_successor->receive(msg);
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Publishes a shared message to the topic.
+    ///\return The number of routers the message was delivered to.
+    //*******************************************
+    size_t publish(etl::string_view topic, etl::shared_message shared_msg)
+    {
+      const size_t count = p_trie->match(topic, deliverer<etl::shared_message>(shared_msg)).count;
+
+      if (p_successor != ETL_NULLPTR)
+      {
+        p_successor->receive(shared_msg);
+      }
+
+      return count;
+    }
+
+    //*******************************************
+    /// Sets the router that published messages are passed on to.
+    //*******************************************
+    void set_successor(etl::imessage_router& successor)
+    {
+      p_successor = &successor;
+    }
+
+    //*******************************************
+    /// Clears the successor.
+    //*******************************************
+    void clear_successor()
+    {
+      p_successor = ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Does the broker have a successor.
+    //*******************************************
+    bool has_successor() const
+    {
+      return p_successor != ETL_NULLPTR;
+    }
+
+    //*******************************************
+    /// Removes all of the subscriptions.
+    //*******************************************
+    void clear()
+    {
+      p_trie->clear();
+    }
+
+    //*******************************************
+    /// Gets the number of subscriptions.
+    //*******************************************
+    size_t size() const
+    {
+      return p_trie->size();
+    }
+
+    //*******************************************
+    /// Checks if there are no subscriptions.
+    //*******************************************
+    bool empty() const
+    {
+      return p_trie->empty();
+    }
+
+  protected:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    explicit itopic_broker(trie_type& trie)
+      : p_trie(&trie)
+      , p_successor(ETL_NULLPTR)
+    {
+    }
+
+    //*******************************************
+    /// Destructor.
+    //*******************************************
+    ~itopic_broker()
+    {
+    }
+
+  private:
+
+    //*******************************************
+    /// Delivers a message to each matching router.
+    //*******************************************
+    template <typename TMessage>
+    struct deliverer
+    {
+      explicit deliverer(TMessage& msg_)
+        : p_msg(&msg_)
+        , count(0U)
+      {
+      }
+
+      void operator ()(etl::imessage_router* p_router)
+      {
+        deliver(*p_router, *p_msg);
+        ++count;
+      }
+
+      TMessage* p_msg;
+      size_t    count;
+    };
+
+    //*******************************************
+    static void deliver(etl::imessage_router& router, const etl::imessage& msg)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(msg.get_message_id(), router.get_message_router_id());
+
+      router.receive(msg);
+    }
+
+    //*******************************************
+    static void deliver(etl::imessage_router& router, etl::shared_message& shared_msg)
+    {
+      ETL_MESSAGE_TRACE_SCOPE(shared_msg.get_message().get_message_id(), router.get_message_router_id());
+
+      router.receive(shared_msg);
+    }
+
+    // Disable copy construction and assignment.
+    itopic_broker(const itopic_broker&);
+    itopic_broker& operator =(const itopic_broker&);
+
+    trie_type*            p_trie;
+    etl::imessage_router* p_successor;
+  };
+
+  //***************************************************************************
+  /// A topic broker with the capacity defined at compile time.
+  ///\tparam VMax_Nodes         The maximum number of distinct filter levels.
+  ///\tparam VMax_Subscriptions The maximum number of subscriptions.
+  //***************************************************************************
+  template <size_t VMax_Nodes, size_t VMax_Subscriptions>
+  class topic_broker : public etl::itopic_broker
+  {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    topic_broker()
+      : itopic_broker(trie)
+    {
+    }
+
+  private:
+
+    etl::topic_trie<etl::imessage_router*, VMax_Nodes, VMax_Subscriptions> trie;
+  };
+}
+
+#endif
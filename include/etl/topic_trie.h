@@ -0,0 +1,745 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TOPIC_TRIE_INCLUDED
+#define ETL_TOPIC_TRIE_INCLUDED
+
+#include "platform.h"
+#include "string_view.h"
+#include "pool.h"
+#include "exception.h"
+#include "error_handler.h"
+#include "nullptr.h"
+
+#include <stddef.h>
+
+//*****************************************************************************
+///\defgroup topic_trie topic_trie
+/// A trie of topic filters, with '+' and '#' wildcards, as used by MQTT.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the topic_trie.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_exception : public etl::exception
+  {
+  public:
+
+    topic_trie_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the topic_trie.
+  /// Raised when there are not enough free nodes or subscriptions.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_full : public etl::topic_trie_exception
+  {
+  public:
+
+    topic_trie_full(string_type file_name_, numeric_type line_number_)
+      : etl::topic_trie_exception(ETL_ERROR_TEXT("topic_trie:full", ETL_TOPIC_TRIE_FILE_ID"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Invalid filter exception for the topic_trie.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  class topic_trie_invalid_filter : public etl::topic_trie_exception
+  {
+  public:
+
+    topic_trie_invalid_filter(string_type file_name_, numeric_type line_number_)
+      : etl::topic_trie_exception(ETL_ERROR_TEXT("topic_trie:invalid filter", ETL_TOPIC_TRIE_FILE_ID"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_topic_trie
+  {
+    //*************************************************************************
+    /// Steps through the '/' separated levels of a topic or filter.
+    //*************************************************************************
+    class level_iterator
+    {
+    public:
+
+      explicit level_iterator(etl::string_view text)
+        : p_level(text.data())
+        , p_end(text.data() + text.size())
+        , p_level_end(find_separator(text.data(), p_end))
+        , valid(true)
+      {
+      }
+
+      //***********************************
+      /// Is there a current level.
+      //***********************************
+      bool has_level() const
+      {
+        return valid;
+      }
+
+      //***********************************
+      /// Is the current level the last one.
+      //***********************************
+      bool is_last() const
+      {
+        return p_level_end == p_end;
+      }
+
+      //***********************************
+      /// The current level.
+      //***********************************
+      etl::string_view level() const
+      {
+        return etl::string_view(p_level, size_t(p_level_end - p_level));
+      }
+
+      //***********************************
+      /// Moves to the next level.
+      //***********************************
+      void next()
+      {
+        if (is_last())
+        {
+          valid = false;
+        }
+        else
+        {
+          p_level     = p_level_end + 1;
+          p_level_end = find_separator(p_level, p_end);
+        }
+      }
+
+    private:
+
+      static const char* find_separator(const char* p_begin, const char* p_end)
+      {
+        while ((p_begin != p_end) && (*p_begin != '/'))
+        {
+          ++p_begin;
+        }
+
+        return p_begin;
+      }
+
+      const char* p_level;
+      const char* p_end;
+      const char* p_level_end;
+      bool        valid;
+    };
+
+    //*************************************************************************
+    /// Checks for the single level wildcard.
+    //*************************************************************************
+    inline bool is_single_level_wildcard(etl::string_view level)
+    {
+      return (level.size() == 1U) && (level[0] == '+');
+    }
+
+    //*************************************************************************
+    /// Checks for the multi level wildcard.
+    //*************************************************************************
+    inline bool is_multi_level_wildcard(etl::string_view level)
+    {
+      return (level.size() == 1U) && (level[0] == '#');
+    }
+
+    //*************************************************************************
+    /// Checks that a filter is valid.
+    /// Wildcards must occupy a whole level and '#' may only be the last level.
+    //*************************************************************************
+    inline bool is_valid_filter(etl::string_view filter)
+    {
+      if (filter.empty())
+      {
+        return false;
+      }
+
+      for (level_iterator itr(filter); itr.has_level(); itr.next())
+      {
+        const etl::string_view level = itr.level();
+
+        if (is_multi_level_wildcard(level))
+        {
+          if (!itr.is_last())
+          {
+            return false;
+          }
+        }
+        else if (!is_single_level_wildcard(level))
+        {
+          for (size_t i = 0U; i < level.size(); ++i)
+          {
+            if ((level[i] == '+') || (level[i] == '#'))
+            {
+              return false;
+            }
+          }
+        }
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// The interface for topic_tries of any capacity.
+  /// Each node of the trie is a level of a subscribed filter, with the
+  /// subscriptions for that filter attached to the node of its last level.
+  /// A topic is matched against every filter in a single traversal, in which
+  /// '+' matches any one level and '#' matches any number of levels,
+  /// including the parent level, so "a/#" matches "a".
+  /// As in MQTT, topics starting with '$' are not matched by a leading wildcard.
+  /// The trie refers to the characters of the filters, which must remain
+  /// valid while they are subscribed.
+  ///\tparam TValue The type of the subscriber, such as a pointer to a router.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  template <typename TValue>
+  class itopic_trie
+  {
+  public:
+
+    typedef TValue                value_type;
+    typedef const TValue&         const_reference;
+    typedef size_t                size_type;
+
+    //*************************************************************************
+    /// Subscribes the value to the filter.
+    /// Subscribing the same value to the same filter again has no effect.
+    /// If asserts or exceptions are enabled, emits topic_trie_invalid_filter
+    /// if the filter is invalid, or topic_trie_full if there is no room.
+    ///\return <b>true</b> if the value is subscribed.
+    //*************************************************************************
+    bool subscribe(etl::string_view filter, const_reference value)
+    {
+      ETL_ASSERT_OR_RETURN_VALUE(private_topic_trie::is_valid_filter(filter), ETL_ERROR(topic_trie_invalid_filter), false);
+
+      // Follow the existing levels.
+      Node* p_node = &root;
+      private_topic_trie::level_iterator itr(filter);
+
+      while (itr.has_level())
+      {
+        Node* p_child = find_child(*p_node, itr.level());
+
+        if (p_child == ETL_NULLPTR)
+        {
+          break;
+        }
+
+        p_node = p_child;
+        itr.next();
+      }
+
+      if ((itr.has_level() == false) && (find_subscription(*p_node, value) != ETL_NULLPTR))
+      {
+        return true;
+      }
+
+      // Check that there is room for the rest.
+      size_t levels = 0U;
+
+      for (private_topic_trie::level_iterator remaining = itr; remaining.has_level(); remaining.next())
+      {
+        ++levels;
+      }
+
+      ETL_ASSERT_OR_RETURN_VALUE((levels <= p_node_pool->available()) && !p_subscription_pool->full(), ETL_ERROR(topic_trie_full), false);
+
+      // Add the new levels.
+      while (itr.has_level())
+      {
+        Node* p_child = p_node_pool->template create<Node>(itr.level(), p_node);
+
+        p_child->p_next_sibling = p_node->p_first_child;
+        p_node->p_first_child   = p_child;
+        p_node = p_child;
+        itr.next();
+      }
+
+      Subscription* p_subscription = p_subscription_pool->template create<Subscription>(value);
+
+      p_subscription->p_next       = p_node->p_first_subscription;
+      p_node->p_first_subscription = p_subscription;
+      ++current_size;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Unsubscribes the value from the filter.
+    ///\return <b>true</b> if the value was subscribed.
+    //*************************************************************************
+    bool unsubscribe(etl::string_view filter, const_reference value)
+    {
+      Node* p_node = &root;
+
+      for (private_topic_trie::level_iterator itr(filter); itr.has_level() && (p_node != ETL_NULLPTR); itr.next())
+      {
+        p_node = find_child(*p_node, itr.level());
+      }
+
+      if ((p_node == ETL_NULLPTR) || !remove_subscription(*p_node, value))
+      {
+        return false;
+      }
+
+      prune(p_node);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Unsubscribes the value from every filter.
+    ///\return The number of subscriptions removed.
+    //*************************************************************************
+    size_t unsubscribe(const_reference value)
+    {
+      const size_t initial_size = current_size;
+
+      unsubscribe_all(root, value);
+
+      return initial_size - current_size;
+    }
+
+    //*************************************************************************
+    /// Calls the function with each subscriber of a filter that matches the
+    /// topic. A subscriber is called once for each of its matching filters.
+    /// The trie must not be changed by the function.
+    ///\param function A function or functor taking a const reference to value_type.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction match(etl::string_view topic, TFunction function) const
+    {
+      const bool is_system = !topic.empty() && (topic[0] == '$');
+
+      match_levels(root, private_topic_trie::level_iterator(topic), is_system, function);
+
+      return function;
+    }
+
+    //*************************************************************************
+    /// Counts the subscriptions that match the topic.
+    //*************************************************************************
+    size_t count_matches(etl::string_view topic) const
+    {
+      return match(topic, counter()).count;
+    }
+
+    //*************************************************************************
+    /// Removes all of the subscriptions.
+    //*************************************************************************
+    void clear()
+    {
+      destroy_children(root);
+      destroy_subscriptions(root);
+      current_size = 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of subscriptions.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Gets the maximum number of subscriptions.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return p_subscription_pool->max_size();
+    }
+
+    //*************************************************************************
+    /// Checks if there are no subscriptions.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Gets the number of free filter level nodes.
+    //*************************************************************************
+    size_type available_nodes() const
+    {
+      return p_node_pool->available();
+    }
+
+  protected:
+
+    struct Node;
+
+    //*************************************************************************
+    /// A subscription attached to the last level of its filter.
+    //*************************************************************************
+    struct Subscription
+    {
+      explicit Subscription(const_reference value_)
+        : value(value_)
+        , p_next(ETL_NULLPTR)
+      {
+      }
+
+      TValue        value;
+      Subscription* p_next;
+    };
+
+    //*************************************************************************
+    /// A filter level.
+    //*************************************************************************
+    struct Node
+    {
+      Node(etl::string_view level_, Node* p_parent_)
+        : level(level_)
+        , p_parent(p_parent_)
+        , p_first_child(ETL_NULLPTR)
+        , p_next_sibling(ETL_NULLPTR)
+        , p_first_subscription(ETL_NULLPTR)
+      {
+      }
+
+      etl::string_view level;
+      Node*            p_parent;
+      Node*            p_first_child;
+      Node*            p_next_sibling;
+      Subscription*    p_first_subscription;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    itopic_trie(etl::ipool& node_pool, etl::ipool& subscription_pool)
+      : root(etl::string_view(), ETL_NULLPTR)
+      , p_node_pool(&node_pool)
+      , p_subscription_pool(&subscription_pool)
+      , current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~itopic_trie()
+    {
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Counts the subscriptions passed to it.
+    //*************************************************************************
+    struct counter
+    {
+      counter()
+        : count(0U)
+      {
+      }
+
+      void operator ()(const_reference)
+      {
+        ++count;
+      }
+
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// Matches the remaining levels of the topic against the children of the node.
+    //*************************************************************************
+    template <typename TFunction>
+    void match_levels(const Node& node, private_topic_trie::level_iterator itr, bool is_system, TFunction& function) const
+    {
+      const bool wildcards_match = !(is_system && (&node == &root));
+
+      if (!itr.has_level())
+      {
+        // The whole topic is matched. A following '#' also matches the parent level.
+        call_subscribers(node, function);
+
+        for (const Node* p_child = node.p_first_child; p_child != ETL_NULLPTR; p_child = p_child->p_next_sibling)
+        {
+          if (private_topic_trie::is_multi_level_wildcard(p_child->level))
+          {
+            call_subscribers(*p_child, function);
+          }
+        }
+
+        return;
+      }
+
+      const etl::string_view level = itr.level();
+      itr.next();
+
+      for (const Node* p_child = node.p_first_child; p_child != ETL_NULLPTR; p_child = p_child->p_next_sibling)
+      {
+        if (private_topic_trie::is_multi_level_wildcard(p_child->level))
+        {
+          if (wildcards_match)
+          {
+            call_subscribers(*p_child, function);
+          }
+        }
+        else if (private_topic_trie::is_single_level_wildcard(p_child->level))
+        {
+          if (wildcards_match)
+          {
+            match_levels(*p_child, itr, is_system, function);
+          }
+        }
+        else if (p_child->level == level)
+        {
+          match_levels(*p_child, itr, is_system, function);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Calls the function for each subscription of the node.
+    //*************************************************************************
+    template <typename TFunction>
+    static void call_subscribers(const Node& node, TFunction& function)
+    {
+      for (const Subscription* p_subscription = node.p_first_subscription; p_subscription != ETL_NULLPTR; p_subscription = p_subscription->p_next)
+      {
+        function(p_subscription->value);
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the child of the node for the level.
+    //*************************************************************************
+    static Node* find_child(const Node& node, etl::string_view level)
+    {
+      Node* p_child = node.p_first_child;
+
+      while ((p_child != ETL_NULLPTR) && !(p_child->level == level))
+      {
+        p_child = p_child->p_next_sibling;
+      }
+
+      return p_child;
+    }
+
+    //*************************************************************************
+    /// Finds the subscription of the node for the value.
+    //*************************************************************************
+    static Subscription* find_subscription(const Node& node, const_reference value)
+    {
+      Subscription* p_subscription = node.p_first_subscription;
+
+      while ((p_subscription != ETL_NULLPTR) && !(p_subscription->value == value))
+      {
+        p_subscription = p_subscription->p_next;
+      }
+
+      return p_subscription;
+    }
+
+    //*************************************************************************
+    /// Removes the subscription of the node for the value.
+    //*************************************************************************
+    bool remove_subscription(Node& node, const_reference value)
+    {
+      Subscription** pp_subscription = &node.p_first_subscription;
+
+      while (*pp_subscription != ETL_NULLPTR)
+      {
+        if ((*pp_subscription)->value == value)
+        {
+          Subscription* p_subscription = *pp_subscription;
+
+          *pp_subscription = p_subscription->p_next;
+          p_subscription_pool->destroy(p_subscription);
+          --current_size;
+
+          return true;
+        }
+
+        pp_subscription = &(*pp_subscription)->p_next;
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Removes the value from the node and all of its children.
+    //*************************************************************************
+    void unsubscribe_all(Node& node, const_reference value)
+    {
+      Node* p_child = node.p_first_child;
+
+      while (p_child != ETL_NULLPTR)
+      {
+        // The child may be pruned.
+        Node* p_next = p_child->p_next_sibling;
+
+        unsubscribe_all(*p_child, value);
+        p_child = p_next;
+      }
+
+      if (remove_subscription(node, value))
+      {
+        prune(&node);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes the node, and then its ancestors, while they are unused.
+    //*************************************************************************
+    void prune(Node* p_node)
+    {
+      while ((p_node != &root) &&
+             (p_node->p_first_child == ETL_NULLPTR) &&
+             (p_node->p_first_subscription == ETL_NULLPTR))
+      {
+        Node* p_parent = p_node->p_parent;
+
+        // Unlink from the parent.
+        Node** pp_child = &p_parent->p_first_child;
+
+        while (*pp_child != p_node)
+        {
+          pp_child = &(*pp_child)->p_next_sibling;
+        }
+
+        *pp_child = p_node->p_next_sibling;
+        p_node_pool->destroy(p_node);
+
+        p_node = p_parent;
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys the subscriptions of the node.
+    //*************************************************************************
+    void destroy_subscriptions(Node& node)
+    {
+      while (node.p_first_subscription != ETL_NULLPTR)
+      {
+        Subscription* p_subscription = node.p_first_subscription;
+
+        node.p_first_subscription = p_subscription->p_next;
+        p_subscription_pool->destroy(p_subscription);
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys the children of the node.
+    //*************************************************************************
+    void destroy_children(Node& node)
+    {
+      while (node.p_first_child != ETL_NULLPTR)
+      {
+        Node* p_child = node.p_first_child;
+
+        node.p_first_child = p_child->p_next_sibling;
+        destroy_children(*p_child);
+        destroy_subscriptions(*p_child);
+        p_node_pool->destroy(p_child);
+      }
+    }
+
+    // Disable copy construction and assignment.
+    itopic_trie(const itopic_trie&);
+    itopic_trie& operator =(const itopic_trie&);
+
+    Node        root;                ///< The level before the first.
+    etl::ipool* p_node_pool;         ///< The pool of filter levels.
+    etl::ipool* p_subscription_pool; ///< The pool of subscriptions.
+    size_type   current_size;        ///< The number of subscriptions.
+  };
+
+  //***************************************************************************
+  /// A topic_trie with the capacity defined at compile time.
+  ///\tparam TValue             The type of the subscriber.
+  ///\tparam VMax_Nodes         The maximum number of distinct filter levels.
+  ///\tparam VMax_Subscriptions The maximum number of subscriptions.
+  ///\ingroup topic_trie
+  //***************************************************************************
+  template <typename TValue, size_t VMax_Nodes, size_t VMax_Subscriptions>
+  class topic_trie : public etl::itopic_trie<TValue>
+  {
+  public:
+
+    typedef etl::itopic_trie<TValue> base_t;
+
+    static ETL_CONSTANT size_t Max_Nodes         = VMax_Nodes;
+    static ETL_CONSTANT size_t Max_Subscriptions = VMax_Subscriptions;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    topic_trie()
+      : base_t(node_pool, subscription_pool)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~topic_trie()
+    {
+      this->clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    topic_trie(const topic_trie&) ETL_DELETE;
+    topic_trie& operator =(const topic_trie&) ETL_DELETE;
+
+    etl::pool<typename base_t::Node, VMax_Nodes>                 node_pool;
+    etl::pool<typename base_t::Subscription, VMax_Subscriptions> subscription_pool;
+  };
+
+  template <typename TValue, size_t VMax_Nodes, size_t VMax_Subscriptions>
+  ETL_CONSTANT size_t topic_trie<TValue, VMax_Nodes, VMax_Subscriptions>::Max_Nodes;
+
+  template <typename TValue, size_t VMax_Nodes, size_t VMax_Subscriptions>
+  ETL_CONSTANT size_t topic_trie<TValue, VMax_Nodes, VMax_Subscriptions>::Max_Subscriptions;
+}
+
+#endif
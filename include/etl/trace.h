@@ -0,0 +1,622 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRACE_INCLUDED
+#define ETL_TRACE_INCLUDED
+
+#include "platform.h"
+#include "cycle_counter.h"
+#include "delegate.h"
+#include "string_view.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+//*****************************************************************************
+/// Optional timing of hot paths, such as message handlers and timer callbacks.
+/// Define ETL_TRACE to enable it. When it is not defined the trace macros
+/// expand to nothing and no buffers are created.
+///
+///   ETL_TRACE_SCOPE(id)   Records Begin now and End at the end of the scope.
+///   ETL_TRACE_BEGIN(id)   Records Begin.
+///   ETL_TRACE_END(id)     Records End.
+///   ETL_TRACE_INSTANT(id) Records a single point in time.
+///
+/// Events are stamped by etl::cycle_counter and pushed to a lock free
+/// queue_spsc_atomic for each channel. Each channel must have only one
+/// producer, so give each core (or each interrupt priority) its own channel.
+///   ETL_TRACE_BUFFER_SIZE The number of events in each channel. Default 256.
+///   ETL_TRACE_CHANNELS    The number of channels. Default 1.
+///   ETL_TRACE_CHANNEL()   Returns the channel of the caller, such as the core id. Default 0.
+///
+/// A lower priority task drains the channels with etl::trace::read() and
+/// sends the events to the host, where etl::trace_chrome_writer converts them
+/// to the Chrome trace JSON format, which Perfetto and chrome://tracing open.
+///
+/// The timestamp type may be set with ETL_TRACE_TIMESTAMP_TYPE.
+/// The default is the type of etl::cycle_counter.
+//*****************************************************************************
+
+#if !defined(ETL_TRACE_TIMESTAMP_TYPE)
+  #if ETL_HAS_CYCLE_COUNTER
+    #define ETL_TRACE_TIMESTAMP_TYPE etl::cycle_counter::value_type
+  #else
+    #define ETL_TRACE_TIMESTAMP_TYPE uint64_t
+  #endif
+#endif
+
+namespace etl
+{
+  typedef ETL_TRACE_TIMESTAMP_TYPE trace_timestamp_t;
+
+  //***************************************************************************
+  /// A trace event.
+  //***************************************************************************
+  struct trace_event
+  {
+    // The values are the Chrome trace phases.
+    enum enum_type
+    {
+      Begin   = 'B',
+      End     = 'E',
+      Instant = 'i'
+    };
+
+    etl::trace_timestamp_t timestamp;
+    uint32_t               id;
+    uint8_t                type;
+    uint8_t                channel;
+  };
+
+  //***************************************************************************
+  /// Writes trace events in the Chrome trace JSON format.
+  /// The timestamps are unwrapped for each channel, so the events of a channel
+  /// must be written in order, and at least once for each wrap of the counter.
+  /// Times are relative to the first event written.
+  ///\tparam VChannels The number of channels. Events from other channels are ignored.
+  //***************************************************************************
+  template <size_t VChannels = 1U>
+  class trace_chrome_writer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VChannels > 0U, "Zero channels");
+
+    typedef etl::delegate<void(etl::string_view)> output_type;  ///< Receives the text.
+    typedef etl::delegate<const char*(uint32_t)>  name_type;      ///< Returns the name of an id, or ETL_NULLPTR.
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param output_           Receives the text.
+    ///\param ticks_per_second_ The rate of the timestamps.
+    ///\param counter_mask_     The bits of the timestamps that count. 0x00FFFFFF for SysTick.
+    ///\param counts_down_      True if the counter counts down, as SysTick does.
+    //*************************************************************************
+    trace_chrome_writer(const output_type& output_,
+                        uint64_t           ticks_per_second_,
+                        uint64_t           counter_mask_ = ~uint64_t(0U),
+                        bool               counts_down_  = false)
+      : output(output_)
+      , ticks_per_second(ticks_per_second_)
+      , counter_mask(counter_mask_)
+      , counts_down(counts_down_)
+      , started(false)
+      , count(0U)
+      , origin(0U)
+    {
+      for (size_t i = 0U; i < VChannels; ++i)
+      {
+        seen[i] = false;
+        last[i] = 0U;
+        time[i] = 0;
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the function that names the ids.
+    /// Ids without a name are written as numbers.
+    //*************************************************************************
+    void set_names(const name_type& names_)
+    {
+      names = names_;
+    }
+
+    //*************************************************************************
+    /// Writes the start of the trace.
+    //*************************************************************************
+    void begin()
+    {
+      write_text("{\"traceEvents\":[");
+      started = false;
+      count   = 0U;
+    }
+
+    //*************************************************************************
+    /// Writes an event.
+    ///\return false if the channel is out of range.
+    //*************************************************************************
+    bool write(const etl::trace_event& event)
+    {
+      const size_t channel = event.channel;
+
+      if (channel >= VChannels)
+      {
+        return false;
+      }
+
+      const uint64_t stamp = uint64_t(event.timestamp) & counter_mask;
+
+      if (!started)
+      {
+        started = true;
+        origin  = stamp;
+      }
+
+      if (seen[channel])
+      {
+        time[channel] += int64_t(delta(last[channel], stamp));
+      }
+      else
+      {
+        // The first event of a channel may be a little before the origin.
+        seen[channel] = true;
+        time[channel] = signed_delta(origin, stamp);
+      }
+
+      last[channel] = stamp;
+
+      if (count != 0U)
+      {
+        write_text(",");
+      }
+
+      ++count;
+
+      write_text("\n{\"name\":\"");
+      write_name(event.id);
+      write_text("\",\"ph\":\"");
+
+      const char phase = char(event.type);
+      write_text(&phase, 1U);
+
+      write_text("\",\"ts\":");
+      write_time(time[channel]);
+      write_text(",\"pid\":0,\"tid\":");
+      write_decimal(channel);
+
+      if (event.type == etl::trace_event::Instant)
+      {
+        write_text(",\"s\":\"t\"");
+      }
+
+      write_text("}");
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Writes the end of the trace.
+    //*************************************************************************
+    void end()
+    {
+      write_text("\n]}\n");
+    }
+
+  private:
+
+    //*************************************************************************
+    /// The ticks from 'first' to 'last'.
+    //*************************************************************************
+    uint64_t delta(uint64_t first, uint64_t last_) const
+    {
+      return (counts_down ? (first - last_) : (last_ - first)) & counter_mask;
+    }
+
+    //*************************************************************************
+    /// The ticks from 'first' to 'last', negative if 'last' is within half a
+    /// wrap before 'first'.
+    //*************************************************************************
+    int64_t signed_delta(uint64_t first, uint64_t last_) const
+    {
+      const uint64_t forward = delta(first, last_);
+
+      if (forward > (counter_mask >> 1U))
+      {
+        return -int64_t(delta(last_, first));
+      }
+
+      return int64_t(forward);
+    }
+
+    //*************************************************************************
+    void write_text(const char* text)
+    {
+      const char* end_of_text = text;
+
+      while (*end_of_text != '\0')
+      {
+        ++end_of_text;
+      }
+
+      write_text(text, size_t(end_of_text - text));
+    }
+
+    //*************************************************************************
+    void write_text(const char* text, size_t length)
+    {
+      output(etl::string_view(text, length));
+    }
+
+    //*************************************************************************
+    /// Writes the name of an id, escaping quotes and backslashes.
+    //*************************************************************************
+    void write_name(uint32_t id)
+    {
+      const char* name = names.is_valid() ? names(id) : ETL_NULLPTR;
+
+      if (name == ETL_NULLPTR)
+      {
+        write_decimal(id);
+        return;
+      }
+
+      const char* chunk = name;
+
+      while (*name != '\0')
+      {
+        if ((*name == '"') || (*name == '\\'))
+        {
+          write_text(chunk, size_t(name - chunk));
+          write_text("\\", 1U);
+          chunk = name;
+        }
+
+        ++name;
+      }
+
+      write_text(chunk, size_t(name - chunk));
+    }
+
+    //*************************************************************************
+    void write_decimal(uint64_t value)
+    {
+      char  buffer[20];
+      char* p = buffer + sizeof(buffer);
+
+      do
+      {
+        *--p  = char('0' + (value % 10U));
+        value /= 10U;
+      } while (value != 0U);
+
+      write_text(p, size_t((buffer + sizeof(buffer)) - p));
+    }
+
+    //*************************************************************************
+    /// Writes a time in microseconds, to the nearest nanosecond.
+    //*************************************************************************
+    void write_time(int64_t ticks)
+    {
+      uint64_t magnitude = 0U;
+
+      if (ticks < 0)
+      {
+        write_text("-", 1U);
+        magnitude = uint64_t(0U) - uint64_t(ticks);
+      }
+      else
+      {
+        magnitude = uint64_t(ticks);
+      }
+
+      // Split the ticks, so that the multiply does not overflow.
+      const uint64_t seconds = magnitude / ticks_per_second;
+      const uint64_t ns      = (seconds * 1000000000U) + (((magnitude % ticks_per_second) * 1000000000U) / ticks_per_second);
+
+      write_decimal(ns / 1000U);
+
+      const uint32_t fraction = uint32_t(ns % 1000U);
+      const char     digits[4] = { '.', char('0' + (fraction / 100U)), char('0' + ((fraction / 10U) % 10U)), char('0' + (fraction % 10U)) };
+
+      write_text(digits, 4U);
+    }
+
+    output_type    output;
+    name_type      names;
+    const uint64_t ticks_per_second;
+    const uint64_t counter_mask;
+    const bool     counts_down;
+    bool           started;
+    size_t         count;
+    uint64_t       origin;
+    bool           seen[VChannels];
+    uint64_t       last[VChannels];
+    int64_t        time[VChannels];
+  };
+}
+
+#if ETL_HAS_ATOMIC && ETL_HAS_CYCLE_COUNTER
+
+#include "queue_spsc_atomic.h"
+#include "atomic.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A ring buffer of trace events for each channel.
+  /// Each channel may have one producer and one consumer.
+  ///\tparam VSize     The number of events in each channel.
+  ///\tparam VChannels The number of channels.
+  //***************************************************************************
+  template <size_t VSize, size_t VChannels = 1U>
+  class trace_buffer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(VChannels > 0U,   "Zero channels");
+    ETL_STATIC_ASSERT(VChannels < 256U, "Too many channels");
+
+    static ETL_CONSTANT size_t Size     = VSize;
+    static ETL_CONSTANT size_t Channels = VChannels;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    trace_buffer()
+    {
+      for (size_t i = 0U; i < VChannels; ++i)
+      {
+        dropped_events[i].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+    //*************************************************************************
+    /// Records an event stamped with the time now.
+    /// Called from the producer of the channel.
+    ///\return false if the channel is out of range or full.
+    //*************************************************************************
+    bool record(size_t channel, uint32_t id, etl::trace_event::enum_type type)
+    {
+      return record(channel, id, type, etl::cycle_counter::now());
+    }
+
+    //*************************************************************************
+    /// Records an event with a timestamp.
+    /// Called from the producer of the channel.
+    ///\return false if the channel is out of range or full.
+    //*************************************************************************
+    bool record(size_t channel, uint32_t id, etl::trace_event::enum_type type, etl::trace_timestamp_t timestamp)
+    {
+      if (channel >= VChannels)
+      {
+        return false;
+      }
+
+      etl::trace_event event;
+
+      event.timestamp = timestamp;
+      event.id        = id;
+      event.type      = uint8_t(type);
+      event.channel   = uint8_t(channel);
+
+      if (queues[channel].push(event))
+      {
+        return true;
+      }
+
+      dropped_events[channel].fetch_add(1U, etl::memory_order_relaxed);
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Reads the oldest event of a channel.
+    /// Called from the consumer of the channel.
+    ///\return false if there are none.
+    //*************************************************************************
+    bool read(size_t channel, etl::trace_event& event)
+    {
+      return (channel < VChannels) && queues[channel].pop(event);
+    }
+
+    //*************************************************************************
+    /// Reads the oldest event of any channel.
+    /// Called from the consumer of every channel.
+    ///\return false if there are none.
+    //*************************************************************************
+    bool read(etl::trace_event& event)
+    {
+      for (size_t i = 0U; i < VChannels; ++i)
+      {
+        if (queues[i].pop(event))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// The number of events lost because a channel was full.
+    //*************************************************************************
+    uint32_t dropped(size_t channel) const
+    {
+      return (channel < VChannels) ? dropped_events[channel].load(etl::memory_order_relaxed) : 0U;
+    }
+
+    //*************************************************************************
+    /// Clears the count of lost events.
+    //*************************************************************************
+    void clear_dropped(size_t channel)
+    {
+      if (channel < VChannels)
+      {
+        dropped_events[channel].store(0U, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    // Disabled.
+    trace_buffer(const trace_buffer&);
+    trace_buffer& operator =(const trace_buffer&);
+
+    etl::queue_spsc_atomic<etl::trace_event, VSize, etl::memory_model::MEMORY_MODEL_LARGE, true> queues[VChannels];
+    etl::atomic<uint32_t> dropped_events[VChannels];
+  };
+
+  template <size_t VSize, size_t VChannels>
+  ETL_CONSTANT size_t trace_buffer<VSize, VChannels>::Size;
+
+  template <size_t VSize, size_t VChannels>
+  ETL_CONSTANT size_t trace_buffer<VSize, VChannels>::Channels;
+}
+
+#endif
+
+#if defined(ETL_TRACE)
+
+#if !(ETL_HAS_ATOMIC && ETL_HAS_CYCLE_COUNTER)
+  #error ETL_TRACE needs etl::atomic and etl::cycle_counter
+#endif
+
+#define ETL_HAS_TRACE 1
+
+#if !defined(ETL_TRACE_BUFFER_SIZE)
+  #define ETL_TRACE_BUFFER_SIZE 256U
+#endif
+
+#if !defined(ETL_TRACE_CHANNELS)
+  #define ETL_TRACE_CHANNELS 1U
+#endif
+
+#if !defined(ETL_TRACE_CHANNEL)
+  #define ETL_TRACE_CHANNEL() 0U
+#endif
+
+namespace etl
+{
+  //***************************************************************************
+  /// The trace buffer and recording functions.
+  //***************************************************************************
+  class trace
+  {
+  public:
+
+    typedef etl::trace_buffer<ETL_TRACE_BUFFER_SIZE, ETL_TRACE_CHANNELS> buffer_type;
+
+    //*************************************************************************
+    /// Starts the cycle counter.
+    /// Call once, before the first event.
+    //*************************************************************************
+    static void start()
+    {
+      etl::cycle_counter::start();
+    }
+
+    //*************************************************************************
+    /// Records an event on the channel of the caller.
+    //*************************************************************************
+    static void record(uint32_t id, etl::trace_event::enum_type type)
+    {
+      buffer().record(ETL_TRACE_CHANNEL(), id, type);
+    }
+
+    //*************************************************************************
+    /// Reads the oldest event of any channel.
+    ///\return false if there are none.
+    //*************************************************************************
+    static bool read(etl::trace_event& event)
+    {
+      return buffer().read(event);
+    }
+
+    //*************************************************************************
+    /// The buffer.
+    //*************************************************************************
+    static buffer_type& buffer()
+    {
+      static buffer_type trace_events;
+
+      return trace_events;
+    }
+
+    //*************************************************************************
+    /// Records Begin on construction and End on destruction.
+    //*************************************************************************
+    class scope
+    {
+    public:
+
+      explicit scope(uint32_t id_)
+        : id(id_)
+      {
+        record(id, etl::trace_event::Begin);
+      }
+
+      ~scope()
+      {
+        record(id, etl::trace_event::End);
+      }
+
+    private:
+
+      // Disabled.
+      scope(const scope&);
+      scope& operator =(const scope&);
+
+      const uint32_t id;
+    };
+  };
+}
+
+#define ETL_TRACE_CONCAT2(a, b) a##b
+#define ETL_TRACE_CONCAT(a, b)  ETL_TRACE_CONCAT2(a, b)
+
+#define ETL_TRACE_SCOPE(id)   etl::trace::scope ETL_TRACE_CONCAT(etl_trace_scope_, __LINE__)(id)
+#define ETL_TRACE_BEGIN(id)   etl::trace::record((id), etl::trace_event::Begin)
+#define ETL_TRACE_END(id)     etl::trace::record((id), etl::trace_event::End)
+#define ETL_TRACE_INSTANT(id) etl::trace::record((id), etl::trace_event::Instant)
+
+#else
+
+#define ETL_HAS_TRACE 0
+
+#define ETL_TRACE_SCOPE(id)
+#define ETL_TRACE_BEGIN(id)
+#define ETL_TRACE_END(id)
+#define ETL_TRACE_INSTANT(id)
+
+#endif
+
+#endif
@@ -0,0 +1,607 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TRANSCODE_INCLUDED
+#define ETL_TRANSCODE_INCLUDED
+
+#include "platform.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "enum_type.h"
+#include "static_assert.h"
+#include "private/utf_simd.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+///\defgroup transcode transcode
+/// Validation and conversion between UTF-8, UTF-16 and UTF-32.
+/// The encoding is chosen by the size of the character type:
+/// one byte is UTF-8, two bytes is UTF-16 and four bytes is UTF-32,
+/// so wchar_t is UTF-16 or UTF-32 according to the platform.
+/// Conversions append to fixed capacity strings and stop at the last whole
+/// code point that fits, reporting how far they got.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The outcome of a transcode.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_status
+  {
+    enum enum_type
+    {
+      Success,
+      Truncated,
+      Invalid,
+      Incomplete
+    };
+
+    ETL_DECLARE_ENUM_TYPE(transcode_status, uint_least8_t)
+    ETL_ENUM_TYPE(Success,    "Success")
+    ETL_ENUM_TYPE(Truncated,  "Truncated")
+    ETL_ENUM_TYPE(Invalid,    "Invalid")
+    ETL_ENUM_TYPE(Incomplete, "Incomplete")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a transcode.
+  /// 'read' is the number of source code units consumed, which always ends on
+  /// a code point boundary, so a truncated or incomplete conversion may be
+  /// resumed from there.
+  /// 'written' is the number of code units appended to the destination.
+  ///\ingroup transcode
+  //***************************************************************************
+  struct transcode_result
+  {
+    transcode_result()
+      : read(0U)
+      , written(0U)
+      , status(transcode_status::Success)
+    {
+    }
+
+    bool succeeded() const
+    {
+      return status == transcode_status::Success;
+    }
+
+    size_t           read;
+    size_t           written;
+    transcode_status status;
+  };
+
+  namespace private_transcode
+  {
+    static ETL_CONSTANT uint_least32_t Max_Code_Point      = 0x10FFFFUL;
+    static ETL_CONSTANT uint_least32_t High_Surrogate_Low  = 0xD800UL;
+    static ETL_CONSTANT uint_least32_t Low_Surrogate_Low   = 0xDC00UL;
+    static ETL_CONSTANT uint_least32_t Low_Surrogate_High  = 0xDFFFUL;
+
+    //*************************************************************************
+    /// Encoding rules, selected by the size of the code unit.
+    /// decode returns Success, Invalid or Incomplete.
+    //*************************************************************************
+    template <size_t Size>
+    struct utf;
+
+    //*************************************************************************
+    /// UTF-8
+    //*************************************************************************
+    template <>
+    struct utf<1U>
+    {
+      typedef uint_least8_t unit_type;
+
+      template <typename T>
+      static size_t ascii_prefix(const T* p, size_t length)
+      {
+        size_t i = 0U;
+
+#if ETL_USING_UTF_SIMD
+        i = utf_simd_ascii_prefix(static_cast<const unsigned char*>(static_cast<const void*>(p)), length);
+#endif
+
+        while (i < length)
+        {
+          const unit_type u = p[i];
+
+          if (u >= 0x80U)
+          {
+            break;
+          }
+
+          ++i;
+        }
+
+        return i;
+      }
+
+      //***********************************************************************
+      /// Decodes one code point, checking the ranges in Unicode Table 3-7,
+      /// so overlong forms, surrogates and values above U+10FFFF are invalid.
+      //***********************************************************************
+      template <typename T>
+      static transcode_status decode(const T* p, size_t length, uint_least32_t& code_point, size_t& units)
+      {
+        const unit_type lead = p[0];
+
+        unit_type lower = 0x80U;
+        unit_type upper = 0xBFU;
+
+        if (lead < 0x80U)
+        {
+          code_point = lead;
+          units      = 1U;
+          return transcode_status::Success;
+        }
+        else if (lead < 0xC2U)
+        {
+          return transcode_status::Invalid;
+        }
+        else if (lead < 0xE0U)
+        {
+          code_point = lead & 0x1FU;
+          units      = 2U;
+        }
+        else if (lead < 0xF0U)
+        {
+          lower      = (lead == 0xE0U) ? 0xA0U : 0x80U;
+          upper      = (lead == 0xEDU) ? 0x9FU : 0xBFU;
+          code_point = lead & 0x0FU;
+          units      = 3U;
+        }
+        else if (lead < 0xF5U)
+        {
+          lower      = (lead == 0xF0U) ? 0x90U : 0x80U;
+          upper      = (lead == 0xF4U) ? 0x8FU : 0xBFU;
+          code_point = lead & 0x07U;
+          units      = 4U;
+        }
+        else
+        {
+          return transcode_status::Invalid;
+        }
+
+        for (size_t i = 1U; i < units; ++i)
+        {
+          if (i == length)
+          {
+            return transcode_status::Incomplete;
+          }
+
+          const unit_type u = p[i];
+
+          if ((u < lower) || (u > upper))
+          {
+            return transcode_status::Invalid;
+          }
+
+          code_point = (code_point << 6) | (u & 0x3FU);
+          lower      = 0x80U;
+          upper      = 0xBFU;
+        }
+
+        return transcode_status::Success;
+      }
+
+      static size_t encoded_length(uint_least32_t code_point)
+      {
+        return (code_point < 0x80UL) ? 1U : (code_point < 0x800UL) ? 2U : (code_point < 0x10000UL) ? 3U : 4U;
+      }
+
+      template <typename T>
+      static void encode(uint_least32_t code_point, size_t units, T* p)
+      {
+        static const unit_type lead[5] = { 0x00U, 0x00U, 0xC0U, 0xE0U, 0xF0U };
+
+        for (size_t i = units - 1U; i != 0U; --i)
+        {
+          const unit_type u = 0x80U | (code_point & 0x3FU);
+          p[i] = u;
+          code_point >>= 6;
+        }
+
+        const unit_type u = (units == 1U) ? code_point : (lead[units] | code_point);
+        p[0] = u;
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-16
+    //*************************************************************************
+    template <>
+    struct utf<2U>
+    {
+      typedef uint_least16_t unit_type;
+
+      template <typename T>
+      static size_t ascii_prefix(const T* p, size_t length)
+      {
+        size_t i = 0U;
+
+        while (i < length)
+        {
+          const unit_type u = p[i];
+
+          if (u >= 0x80U)
+          {
+            break;
+          }
+
+          ++i;
+        }
+
+        return i;
+      }
+
+      template <typename T>
+      static transcode_status decode(const T* p, size_t length, uint_least32_t& code_point, size_t& units)
+      {
+        const unit_type first = p[0];
+
+        if ((first < High_Surrogate_Low) || (first > Low_Surrogate_High))
+        {
+          code_point = first;
+          units      = 1U;
+          return transcode_status::Success;
+        }
+
+        if (first >= Low_Surrogate_Low)
+        {
+          return transcode_status::Invalid;
+        }
+
+        if (length < 2U)
+        {
+          return transcode_status::Incomplete;
+        }
+
+        const unit_type second = p[1];
+
+        if ((second < Low_Surrogate_Low) || (second > Low_Surrogate_High))
+        {
+          return transcode_status::Invalid;
+        }
+
+        code_point = 0x10000UL + (((first - High_Surrogate_Low) << 10) | (second - Low_Surrogate_Low));
+        units      = 2U;
+
+        return transcode_status::Success;
+      }
+
+      static size_t encoded_length(uint_least32_t code_point)
+      {
+        return (code_point < 0x10000UL) ? 1U : 2U;
+      }
+
+      template <typename T>
+      static void encode(uint_least32_t code_point, size_t units, T* p)
+      {
+        if (units == 1U)
+        {
+          const unit_type u = code_point;
+          p[0] = u;
+        }
+        else
+        {
+          code_point -= 0x10000UL;
+
+          const unit_type high = High_Surrogate_Low + (code_point >> 10);
+          const unit_type low  = Low_Surrogate_Low  + (code_point & 0x3FFU);
+          p[0] = high;
+          p[1] = low;
+        }
+      }
+    };
+
+    //*************************************************************************
+    /// UTF-32
+    //*************************************************************************
+    template <>
+    struct utf<4U>
+    {
+      typedef uint_least32_t unit_type;
+
+      template <typename T>
+      static size_t ascii_prefix(const T* p, size_t length)
+      {
+        size_t i = 0U;
+
+        while (i < length)
+        {
+          const unit_type u = p[i];
+
+          if (u >= 0x80U)
+          {
+            break;
+          }
+
+          ++i;
+        }
+
+        return i;
+      }
+
+      template <typename T>
+      static transcode_status decode(const T* p, size_t /*length*/, uint_least32_t& code_point, size_t& units)
+      {
+        const unit_type u = p[0];
+
+        if ((u > Max_Code_Point) || ((u >= High_Surrogate_Low) && (u <= Low_Surrogate_High)))
+        {
+          return transcode_status::Invalid;
+        }
+
+        code_point = u;
+        units      = 1U;
+
+        return transcode_status::Success;
+      }
+
+      static size_t encoded_length(uint_least32_t /*code_point*/)
+      {
+        return 1U;
+      }
+
+      template <typename T>
+      static void encode(uint_least32_t code_point, size_t /*units*/, T* p)
+      {
+        const unit_type u = code_point;
+        p[0] = u;
+      }
+    };
+
+    //*************************************************************************
+    /// Checks that the character type is one of the supported sizes.
+    //*************************************************************************
+    template <typename T>
+    struct is_code_unit
+    {
+      static ETL_CONSTANT bool value = (sizeof(T) == 1U) || (sizeof(T) == 2U) || (sizeof(T) == 4U);
+    };
+
+    //*************************************************************************
+    /// Validates by decoding, skipping runs of ASCII.
+    //*************************************************************************
+    template <typename T>
+    bool is_valid(const T* p, size_t length)
+    {
+      typedef utf<sizeof(T)> source_utf;
+
+      size_t i = 0U;
+
+      while (i < length)
+      {
+        i += source_utf::ascii_prefix(p + i, length - i);
+
+        if (i < length)
+        {
+          uint_least32_t code_point;
+          size_t         units;
+
+          if (source_utf::decode(p + i, length - i, code_point, units) != transcode_status::Success)
+          {
+            return false;
+          }
+
+          i += units;
+        }
+      }
+
+      return true;
+    }
+  }
+
+  //***************************************************************************
+  /// Returns true if the characters are valid UTF-8.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T>
+  bool is_valid_utf8(const T* p, size_t length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T) == 1U, "UTF-8 requires a one byte character type");
+
+#if ETL_USING_UTF8_SIMD_VALIDATION
+    return private_transcode::utf_simd_validate_utf8(static_cast<const unsigned char*>(static_cast<const void*>(p)), length);
+#else
+    return private_transcode::is_valid(p, length);
+#endif
+  }
+
+  //***************************************************************************
+  /// Returns true if the view is valid UTF-8.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  bool is_valid_utf8(const etl::basic_string_view<T, TTraits>& view)
+  {
+    return etl::is_valid_utf8(view.data(), view.size());
+  }
+
+  //***************************************************************************
+  /// Returns true if the characters are valid UTF-16.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T>
+  bool is_valid_utf16(const T* p, size_t length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T) == 2U, "UTF-16 requires a two byte character type");
+
+    return private_transcode::is_valid(p, length);
+  }
+
+  //***************************************************************************
+  /// Returns true if the view is valid UTF-16.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  bool is_valid_utf16(const etl::basic_string_view<T, TTraits>& view)
+  {
+    return etl::is_valid_utf16(view.data(), view.size());
+  }
+
+  //***************************************************************************
+  /// Returns true if the characters are valid UTF-32.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T>
+  bool is_valid_utf32(const T* p, size_t length)
+  {
+    ETL_STATIC_ASSERT(sizeof(T) == 4U, "UTF-32 requires a four byte character type");
+
+    return private_transcode::is_valid(p, length);
+  }
+
+  //***************************************************************************
+  /// Returns true if the view is valid UTF-32.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename T, typename TTraits>
+  bool is_valid_utf32(const etl::basic_string_view<T, TTraits>& view)
+  {
+    return etl::is_valid_utf32(view.data(), view.size());
+  }
+
+  //***************************************************************************
+  /// Converts the source characters and appends them to the destination.
+  /// Stops at the first invalid sequence, at a sequence cut short by the end
+  /// of the source, or at the last code point that fits in the destination.
+  ///\param source      The characters to convert.
+  ///\param length      The number of characters.
+  ///\param destination The string to append to.
+  ///\return The number of code units read and written, and the status.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  transcode_result transcode(const TSource* source, size_t length, etl::ibasic_string<TDestination>& destination)
+  {
+    ETL_STATIC_ASSERT(private_transcode::is_code_unit<TSource>::value,      "Unsupported source character size");
+    ETL_STATIC_ASSERT(private_transcode::is_code_unit<TDestination>::value, "Unsupported destination character size");
+
+    typedef private_transcode::utf<sizeof(TSource)>      source_utf;
+    typedef private_transcode::utf<sizeof(TDestination)> destination_utf;
+
+    transcode_result result;
+
+    size_t i = 0U;
+
+    while (i < length)
+    {
+      // Copy a run of ASCII, which is the same in every encoding.
+      const size_t run = source_utf::ascii_prefix(source + i, length - i);
+
+      if (run != 0U)
+      {
+        const size_t  count = etl::min(run, destination.available());
+        const size_t  size  = destination.size();
+
+        destination.uninitialized_resize(size + count);
+
+        TDestination* p = destination.data() + size;
+
+        for (size_t j = 0U; j < count; ++j)
+        {
+          p[j] = source[i + j];
+        }
+
+        i              += count;
+        result.written += count;
+
+        if (count != run)
+        {
+          result.status = transcode_status::Truncated;
+          break;
+        }
+
+        if (i == length)
+        {
+          break;
+        }
+      }
+
+      uint_least32_t code_point;
+      size_t         units;
+
+      const transcode_status status = source_utf::decode(source + i, length - i, code_point, units);
+
+      if (status != transcode_status::Success)
+      {
+        result.status = status;
+        break;
+      }
+
+      const size_t encoded = destination_utf::encoded_length(code_point);
+
+      if (encoded > destination.available())
+      {
+        result.status = transcode_status::Truncated;
+        break;
+      }
+
+      const size_t size = destination.size();
+
+      destination.uninitialized_resize(size + encoded);
+      destination_utf::encode(code_point, encoded, destination.data() + size);
+
+      i              += units;
+      result.written += encoded;
+    }
+
+    result.read = i;
+
+    return result;
+  }
+
+  //***************************************************************************
+  /// Converts the view and appends it to the destination.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TTraits, typename TDestination>
+  transcode_result transcode(const etl::basic_string_view<TSource, TTraits>& source, etl::ibasic_string<TDestination>& destination)
+  {
+    return etl::transcode(source.data(), source.size(), destination);
+  }
+
+  //***************************************************************************
+  /// Converts the string and appends it to the destination.
+  ///\ingroup transcode
+  //***************************************************************************
+  template <typename TSource, typename TDestination>
+  transcode_result transcode(const etl::ibasic_string<TSource>& source, etl::ibasic_string<TDestination>& destination)
+  {
+    return etl::transcode(source.data(), source.size(), destination);
+  }
+}
+
+#endif
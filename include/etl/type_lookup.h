@@ -34,6 +34,7 @@ SOFTWARE.
 #include "static_assert.h"
 #include "integral_limits.h"
 #include "null_type.h"
+#include "nth_type.h"
 
 #include <limits.h>
 
@@ -83,6 +84,12 @@ namespace etl
     // The type for no match.
     struct nulltype {};
 
+#if ETL_USING_CPP14
+    // The type for the first pair with the id, or nulltype.
+    template <int ID>
+    using type_from_id_helper = typename etl::nth_type<etl::private_type_traits::index_of_first_true<(ID == TTypes::ID)...>(),
+                                                       typename TTypes::type..., nulltype>::type;
+#else
     // For N type pairs.
     template <size_t ID, typename T1, typename... TRest>
     struct type_from_id_helper
@@ -100,6 +107,7 @@ namespace etl
                                              typename T1::type,
                                              nulltype>::type;
     };
+#endif
 
   public:
 
@@ -109,7 +117,11 @@ namespace etl
     template <int ID>
     struct type_from_id
     {
+#if ETL_USING_CPP14
+      using type = type_from_id_helper<ID>;
+#else
       using type = typename type_from_id_helper<ID, TTypes...>::type;
+#endif
 
       static_assert(!(etl::is_same<nulltype, type>::value), "Invalid id");
     };
@@ -121,6 +133,12 @@ namespace etl
 
     static constexpr size_t UNKNOWN = etl::integral_limits<size_t>::max;
 
+#if ETL_USING_CPP14
+    // The id of the first pair with the type, or UNKNOWN.
+    template <typename T>
+    using id_from_type_helper = typename etl::nth_type<etl::private_type_traits::index_of_first_true<etl::is_same<T, typename TTypes::type>::value...>(),
+                                                       etl::integral_constant<size_t, size_t(TTypes::ID)>..., etl::integral_constant<size_t, UNKNOWN> >::type;
+#else
     // For N type pairs.
     template <typename T, typename T1, typename... TRest>
     struct id_from_type_helper
@@ -134,6 +152,7 @@ namespace etl
     {
       static constexpr size_t value = etl::is_same<T, typename T1::type>::value ? size_t(T1::ID) : UNKNOWN;
     };
+#endif
 
   public:
 
@@ -143,7 +162,11 @@ namespace etl
     template <typename T>
     struct id_from_type
     {
+#if ETL_USING_CPP14
+      static constexpr size_t value = id_from_type_helper<T>::value;
+#else
       static constexpr size_t value = id_from_type_helper<T, TTypes...>::value;
+#endif
 
       static_assert(value != UNKNOWN, "Invalid type");
     };
@@ -179,6 +202,12 @@ namespace etl
     // The type for no match.
     struct nulltype {};
 
+#if ETL_USING_CPP14
+    // The type paired with the first match, or nulltype.
+    template <typename T>
+    using type_from_type_helper = typename etl::nth_type<etl::private_type_traits::index_of_first_true<etl::is_same<T, typename TTypes::type1>::value...>(),
+                                                         typename TTypes::type2..., nulltype>::type;
+#else
     template <typename T, typename T1, typename... TRest>
     struct type_from_type_helper
     {
@@ -194,6 +223,7 @@ namespace etl
                                              typename T1::type2,
                                              nulltype>::type;
     };
+#endif
 
   public:
 
@@ -203,7 +233,11 @@ namespace etl
     public:
 
       // The matched type or nulltype
+#if ETL_USING_CPP14
+      using type = type_from_type_helper<T>;
+#else
       using type = typename type_from_type_helper<T, TTypes...>::type;
+#endif
 
       static_assert(!etl::is_same<type, nulltype>::value, "Type match not found");
     };
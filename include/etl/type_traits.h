@@ -356,12 +356,20 @@ namespace etl
 
   //***************************************************************************
   /// is_same
+#if ETL_USING_BUILTIN_IS_SAME
+  template <typename T1, typename T2> struct is_same : public etl::bool_constant<__is_same(T1, T2)> {};
+#else
   template <typename T1, typename T2> struct is_same : public false_type {};
   template <typename T> struct is_same<T, T> : public true_type {};
+#endif
 
 #if ETL_USING_CPP17
   template <typename T1, typename T2>
+  #if ETL_USING_BUILTIN_IS_SAME
+  inline constexpr bool is_same_v = __is_same(T1, T2);
+  #else
   inline constexpr bool is_same_v = is_same<T1, T2>::value;
+  #endif
 #endif
 
   //***************************************************************************
@@ -1348,20 +1356,52 @@ typedef integral_constant<bool, true>  true_type;
   };
 
 #if ETL_USING_CPP11
+  namespace private_type_traits
+  {
+    template <bool...>
+    struct bool_pack
+    {
+    };
+
+    //*************************************************************************
+    /// True if all of the values are true.
+    /// The instantiation depth does not grow with the number of values.
+    template <bool... B>
+    struct all_true : etl::is_same<bool_pack<true, B...>, bool_pack<B..., true> >
+    {
+    };
+
+  #if ETL_USING_CPP14
+    //*************************************************************************
+    /// The index of the first true value, or the number of values if none are.
+    template <bool... B>
+    constexpr size_t index_of_first_true()
+    {
+      constexpr bool values[] = { B..., true };
+
+      size_t index = 0U;
+
+      while (!values[index])
+      {
+        ++index;
+      }
+
+      return index;
+    }
+  #endif
+  }
+
   //***************************************************************************
   /// Template to determine if a type is one of a specified list.
   ///\ingroup types
   template <typename T, typename T1, typename... TRest>
   struct is_one_of
   {
-    static const bool value = etl::is_same<T, T1>::value ||
-                              etl::is_one_of<T, TRest...>::value;
-  };
-
-  template <typename T, typename T1>
-  struct is_one_of<T, T1>
-  {
-    static const bool value = etl::is_same<T, T1>::value;
+  #if ETL_USING_CPP17
+    static const bool value = (etl::is_same_v<T, T1> || ... || etl::is_same_v<T, TRest>);
+  #else
+    static const bool value = !private_type_traits::all_true<!etl::is_same<T, T1>::value, !etl::is_same<T, TRest>::value...>::value;
+  #endif
   };
 #else
   //***************************************************************************
@@ -1396,7 +1436,7 @@ typedef integral_constant<bool, true>  true_type;
 
 #if ETL_USING_CPP17
   template <typename T, typename... TRest>
-  inline constexpr bool is_one_of_v = etl::is_one_of<T, TRest...>::value;
+  inline constexpr bool is_one_of_v = (etl::is_same_v<T, TRest> || ...);
 #endif
 
   //***************************************************************************
@@ -1555,14 +1595,11 @@ typedef integral_constant<bool, true>  true_type;
   template <typename T, typename T1, typename... TRest>
   struct are_all_same
   {
-    static const bool value = etl::is_same<T, T1>::value &&
-      etl::are_all_same<T, TRest...>::value;
-  };
-
-  template <typename T, typename T1>
-  struct are_all_same<T, T1>
-  {
-    static const bool value = etl::is_same<T, T1>::value;
+  #if ETL_USING_CPP17
+    static const bool value = (etl::is_same_v<T, T1> && ... && etl::is_same_v<T, TRest>);
+  #else
+    static const bool value = private_type_traits::all_true<etl::is_same<T, T1>::value, etl::is_same<T, TRest>::value...>::value;
+  #endif
   };
 #endif
 
@@ -2104,6 +2141,22 @@ typedef integral_constant<bool, true>  true_type;
 
 #endif
 
+  //*********************************************
+  // is_trivially_relocatable
+  // A type is trivially relocatable if moving an object to a new address and
+  // destroying the original is equivalent to copying its bytes.
+  // Defaults to etl::is_trivially_copyable. Specialise as etl::true_type for
+  // types that own a resource through a pointer, but never point to themselves.
+  template <typename T>
+  struct is_trivially_relocatable : public etl::integral_constant<bool, etl::is_trivially_copyable<T>::value>
+  {
+  };
+
+#if ETL_USING_CPP17
+  template <typename T>
+  inline constexpr bool is_trivially_relocatable_v = etl::is_trivially_relocatable<T>::value;
+#endif
+
 #if ETL_USING_CPP11
   //*********************************************
   // common_type
@@ -40,6 +40,9 @@ SOFTWARE.
 #include "endianness.h"
 #include "iterator.h"
 #include "algorithm.h"
+#include "span.h"
+
+#include "private/byte_stream_simd.h"
 
 #include <string.h>
 
@@ -722,6 +725,219 @@ namespace etl
   typedef be_double_t      net_double_t;
   typedef be_long_double_t net_long_double_t;
 
+  //*************************************************************************
+  /// unaligned_span
+  ///\brief A view of a packed array of unaligned_type<T, Endian> values, or
+  /// of the equivalent bytes in a buffer, with bulk conversion to and from
+  /// arrays of T.
+  /// Bulk copies are a memcpy if Endian is the host order, otherwise a
+  /// vector byte reversal where available.
+  /// A span of const T is read only.
+  ///\tparam T      The arithmetic type, which may be const.
+  ///\tparam Endian The endianness of the stored values.
+  //*************************************************************************
+  template <typename T, int Endian_>
+  class unaligned_span
+  {
+  public:
+
+    typedef typename etl::remove_cv<T>::type value_type;
+    typedef typename etl::conditional<etl::is_const<T>::value, const unsigned char, unsigned char>::type storage_type;
+    typedef storage_type* pointer;
+    typedef typename etl::conditional<etl::is_const<T>::value,
+                                      const etl::unaligned_type<value_type, Endian_>,
+                                      etl::unaligned_type<value_type, Endian_> >::type element_type;
+
+    static ETL_CONSTANT int    Endian = Endian_;
+    static ETL_CONSTANT size_t Element_Size = sizeof(value_type);
+
+    //*************************************************************************
+    /// Construct from a pointer to the storage and the number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR unaligned_span(pointer pstorage_, size_t size_)
+      : pstorage(pstorage_)
+      , n_values(size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer to an array of unaligned_type and the number of values.
+    //*************************************************************************
+    unaligned_span(element_type* pbegin, size_t size_)
+      : pstorage(pbegin->data())
+      , n_values(size_)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from an array of unaligned_type.
+    //*************************************************************************
+    template <size_t Array_Size>
+    unaligned_span(element_type (&values)[Array_Size])
+      : pstorage(values[0].data())
+      , n_values(Array_Size)
+    {
+    }
+
+    //*************************************************************************
+    /// Construct from a span of bytes.
+    /// The number of values is the number of whole values in the span.
+    //*************************************************************************
+    template <size_t Extent>
+    ETL_CONSTEXPR unaligned_span(const etl::span<storage_type, Extent>& bytes)
+      : pstorage(bytes.data())
+      , n_values(bytes.size() / Element_Size)
+    {
+    }
+
+    //*************************************************************************
+    /// The number of values.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size() const
+    {
+      return n_values;
+    }
+
+    //*************************************************************************
+    /// The number of bytes.
+    //*************************************************************************
+    ETL_CONSTEXPR size_t size_bytes() const
+    {
+      return n_values * Element_Size;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if there are no values.
+    //*************************************************************************
+    ETL_NODISCARD ETL_CONSTEXPR bool empty() const
+    {
+      return n_values == 0U;
+    }
+
+    //*************************************************************************
+    /// Pointer to the storage.
+    //*************************************************************************
+    ETL_CONSTEXPR pointer data() const
+    {
+      return pstorage;
+    }
+
+    //*************************************************************************
+    /// Gets the value at an index.
+    //*************************************************************************
+    value_type operator[](size_t i) const
+    {
+      value_type value;
+      copy_values(pstorage + (i * Element_Size), reinterpret_cast<unsigned char*>(&value), 1U);
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// Sets the value at an index.
+    //*************************************************************************
+    void set(size_t i, value_type value) const
+    {
+      ETL_STATIC_ASSERT(!etl::is_const<T>::value, "Cannot write to a span of const");
+
+      copy_values(reinterpret_cast<const unsigned char*>(&value), pstorage + (i * Element_Size), 1U);
+    }
+
+    //*************************************************************************
+    /// A span of the values from 'offset'.
+    //*************************************************************************
+    ETL_CONSTEXPR unaligned_span subspan(size_t offset) const
+    {
+      return unaligned_span(pstorage + (offset * Element_Size), n_values - offset);
+    }
+
+    //*************************************************************************
+    /// A span of 'count' values from 'offset'.
+    //*************************************************************************
+    ETL_CONSTEXPR unaligned_span subspan(size_t offset, size_t count) const
+    {
+      return unaligned_span(pstorage + (offset * Element_Size), count);
+    }
+
+    //*************************************************************************
+    /// Copies the values to 'destination', converting to host order.
+    /// Copies as many values as will fit and returns the number copied.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t copy_to(const etl::span<value_type, Extent>& destination) const
+    {
+      const size_t n = etl::min(n_values, size_t(destination.size()));
+
+      copy_values(pstorage, reinterpret_cast<unsigned char*>(destination.data()), n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Copies the values from 'source', converting from host order.
+    /// Copies as many values as will fit and returns the number copied.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t copy_from(const etl::span<const value_type, Extent>& source) const
+    {
+      ETL_STATIC_ASSERT(!etl::is_const<T>::value, "Cannot write to a span of const");
+
+      const size_t n = etl::min(n_values, size_t(source.size()));
+
+      copy_values(reinterpret_cast<const unsigned char*>(source.data()), pstorage, n);
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// Copies the values from 'source', converting from host order.
+    /// Copies as many values as will fit and returns the number copied.
+    //*************************************************************************
+    template <size_t Extent>
+    size_t copy_from(const etl::span<value_type, Extent>& source) const
+    {
+      return copy_from(etl::span<const value_type>(source.data(), source.size()));
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Copies 'n' values, reversing the bytes of each if the stored order
+    /// is not the host order.
+    //*************************************************************************
+    static void copy_values(const unsigned char* source, unsigned char* destination, size_t n)
+    {
+      if ((Endian == etl::endianness::value()) || (Element_Size == 1U))
+      {
+        memcpy(destination, source, n * Element_Size);
+      }
+      else
+      {
+        size_t i = 0U;
+
+#if ETL_USING_BYTE_STREAM_SIMD
+        i = etl::private_byte_stream::simd_reverse_bytes_copy<Element_Size>(reinterpret_cast<const char*>(source),
+                                                                            reinterpret_cast<char*>(destination),
+                                                                            n);
+#endif
+
+        for (; i < n; ++i)
+        {
+          etl::reverse_copy(source + (i * Element_Size), source + ((i + 1U) * Element_Size), destination + (i * Element_Size));
+        }
+      }
+    }
+
+    pointer pstorage;
+    size_t  n_values;
+  };
+
+  template <typename T, int Endian_>
+  ETL_CONSTANT int unaligned_span<T, Endian_>::Endian;
+
+  template <typename T, int Endian_>
+  ETL_CONSTANT size_t unaligned_span<T, Endian_>::Element_Size;
+
 #if ETL_USING_CPP11
   template <typename T, int Endian>
   using unaligned_type_t = typename etl::unaligned_type<T, Endian>::type;
@@ -51,6 +51,9 @@ SOFTWARE.
 #include "iterator.h"
 #include "placement_new.h"
 #include "initializer_list.h"
+#include "span.h"
+
+#include "private/comparator_is_transparent.h"
 
 #include <stddef.h>
 
@@ -599,6 +602,15 @@ namespace etl
       return key_hash_function(key) % number_of_buckets;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_type get_bucket_index(const K& key) const
+    {
+      return key_hash_function(key) % number_of_buckets;
+    }
+#endif
+
     //*********************************************************************
     /// Returns the size of the bucket key.
     ///\return The bucket size of the bucket key.
@@ -1141,6 +1153,125 @@ namespace etl
       return (find(key) == end()) ? 0 : 1;
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    size_t count(const K& key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+#endif
+
+    //*********************************************************************
+    /// Finds a batch of keys.
+    /// The keys are looked up in small groups. The buckets and first nodes of
+    /// a group are prefetched before any chain is walked, so that the cache
+    /// misses of independent lookups overlap.
+    ///\param keys    The keys to search for.
+    ///\param results Receives an iterator per key, or end() if not found.
+    ///\return The number of keys searched; the smaller of the two sizes.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<iterator> results)
+    {
+      const size_t Group_Size = 8U;
+
+      const size_t n = etl::min(keys.size(), results.size());
+      bucket_t* group[Group_Size];
+
+      for (size_t first = 0U; first < n; first += Group_Size)
+      {
+        const size_t count = etl::min(n - first, Group_Size);
+
+        // Prefetch the buckets.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          group[i] = pbuckets + get_bucket_index(keys[first + i]);
+          ETL_PREFETCH(group[i]);
+        }
+
+        // Prefetch the first node of each chain.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (!group[i]->empty())
+          {
+            ETL_PREFETCH(&*group[i]->begin());
+          }
+        }
+
+        // Walk the chains.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          bucket_t* pbucket = group[i];
+          local_iterator inode = pbucket->begin();
+          local_iterator iend = pbucket->end();
+
+          while ((inode != iend) && !key_equal_function(keys[first + i], inode->key_value_pair.first))
+          {
+            ++inode;
+          }
+
+          results[first + i] = (inode != iend) ? iterator((pbuckets + number_of_buckets), pbucket, inode) : end();
+        }
+      }
+
+      return n;
+    }
+
+    //*********************************************************************
+    /// Finds a batch of keys.
+    /// The keys are looked up in small groups. The buckets and first nodes of
+    /// a group are prefetched before any chain is walked, so that the cache
+    /// misses of independent lookups overlap.
+    ///\param keys    The keys to search for.
+    ///\param results Receives an iterator per key, or end() if not found.
+    ///\return The number of keys searched; the smaller of the two sizes.
+    //*********************************************************************
+    size_t find_batch(etl::span<const key_type> keys, etl::span<const_iterator> results) const
+    {
+      const size_t Group_Size = 8U;
+
+      const size_t n = etl::min(keys.size(), results.size());
+      bucket_t* group[Group_Size];
+
+      for (size_t first = 0U; first < n; first += Group_Size)
+      {
+        const size_t count = etl::min(n - first, Group_Size);
+
+        // Prefetch the buckets.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          group[i] = pbuckets + get_bucket_index(keys[first + i]);
+          ETL_PREFETCH(group[i]);
+        }
+
+        // Prefetch the first node of each chain.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          if (!group[i]->empty())
+          {
+            ETL_PREFETCH(&*group[i]->begin());
+          }
+        }
+
+        // Walk the chains.
+        for (size_t i = 0U; i < count; ++i)
+        {
+          bucket_t* pbucket = group[i];
+          local_iterator inode = pbucket->begin();
+          local_iterator iend = pbucket->end();
+
+          while ((inode != iend) && !key_equal_function(keys[first + i], inode->key_value_pair.first))
+          {
+            ++inode;
+          }
+
+          results[first + i] = (inode != iend) ? const_iterator((pbuckets + number_of_buckets), pbucket, inode) : end();
+        }
+      }
+
+      return n;
+    }
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1175,6 +1306,39 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    iterator find(const K& key)
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Finds an element.
     ///\param key The key to search for.
@@ -1209,6 +1373,39 @@ namespace etl
       return end();
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    const_iterator find(const K& key) const
+    {
+      size_t index = get_bucket_index(key);
+
+      bucket_t* pbucket = pbuckets + index;
+      bucket_t& bucket = *pbucket;
+
+      // Is the bucket not empty?
+      if (!bucket.empty())
+      {
+        // Step though the list until we find the end or an equivalent key.
+        local_iterator inode = bucket.begin();
+        local_iterator iend = bucket.end();
+
+        while (inode != iend)
+        {
+          // Do we have this one?
+          if (key_equal_function(key, inode->key_value_pair.first))
+          {
+            return iterator((pbuckets + number_of_buckets), pbucket, inode);
+          }
+
+          ++inode;
+        }
+      }
+
+      return end();
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1230,6 +1427,23 @@ namespace etl
       return ETL_OR_STD::pair<iterator, iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<iterator, iterator> equal_range(const K& key)
+    {
+      iterator f = find(key);
+      iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<iterator, iterator>(f, l);
+    }
+#endif
+
     //*********************************************************************
     /// Returns a range containing all elements with key key in the container.
     /// The range is defined by two iterators, the first pointing to the first
@@ -1251,6 +1465,40 @@ namespace etl
       return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
     }
 
+#if ETL_USING_CPP11
+    //*********************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    ETL_OR_STD::pair<const_iterator, const_iterator> equal_range(const K& key) const
+    {
+      const_iterator f = find(key);
+      const_iterator l = f;
+
+      if (l != end())
+      {
+        ++l;
+      }
+
+      return ETL_OR_STD::pair<const_iterator, const_iterator>(f, l);
+    }
+#endif
+
+    //*************************************************************************
+    /// Check if the unordered_map contains the key.
+    //*************************************************************************
+    bool contains(const_key_reference key) const
+    {
+      return find(key) != end();
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    template <typename K, typename KH = THash, typename KE = TKeyEqual, etl::enable_if_t<comparator_is_transparent<KH>::value && comparator_is_transparent<KE>::value, int> = 0>
+    bool contains(const K& key) const
+    {
+      return find(key) != end();
+    }
+#endif
+
     //*************************************************************************
     /// Gets the size of the unordered_map.
     //*************************************************************************
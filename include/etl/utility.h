@@ -215,7 +215,7 @@ namespace etl
     }
 
     /// Copy constructor
-    pair(const pair<T1, T2>& other)
+    ETL_CONSTEXPR14 pair(const pair<T1, T2>& other)
       : first(other.first)
       , second(other.second)
     {
@@ -506,25 +506,40 @@ namespace etl
 
   namespace private_integer_sequence
   {
-    template <size_t N, typename IndexSeq>
-    struct make_index_sequence;
+    // Joins two sequences, offsetting the second by the length of the first.
+    template <typename TSequence1, typename TSequence2>
+    struct concatenate;
 
-    template <size_t N, size_t... Indices>
-    struct make_index_sequence<N, etl::integer_sequence<size_t, Indices...>>
+    template <size_t... Indices1, size_t... Indices2>
+    struct concatenate<etl::integer_sequence<size_t, Indices1...>, etl::integer_sequence<size_t, Indices2...>>
     {
-      typedef typename make_index_sequence<N - 1, etl::integer_sequence<size_t, N - 1, Indices...>>::type type;
+      typedef etl::integer_sequence<size_t, Indices1..., (sizeof...(Indices1) + Indices2)...> type;
     };
 
-    template <size_t... Indices>
-    struct make_index_sequence<0, etl::integer_sequence<size_t, Indices...>>
+    // Builds the sequence by halving, so the instantiation depth is O(logN).
+    template <size_t N>
+    struct make_index_sequence
     {
-      typedef etl::integer_sequence<size_t, Indices...> type;
+      typedef typename concatenate<typename make_index_sequence<N / 2>::type,
+                                   typename make_index_sequence<N - (N / 2)>::type>::type type;
+    };
+
+    template <>
+    struct make_index_sequence<0>
+    {
+      typedef etl::integer_sequence<size_t> type;
+    };
+
+    template <>
+    struct make_index_sequence<1>
+    {
+      typedef etl::integer_sequence<size_t, 0> type;
     };
   }
 
   //***********************************
   template <size_t N>
-  using make_index_sequence = typename private_integer_sequence::make_index_sequence<N, etl::integer_sequence<size_t>>::type;
+  using make_index_sequence = typename private_integer_sequence::make_index_sequence<N>::type;
 
   //***********************************
   template <size_t... Indices>
@@ -576,6 +591,19 @@ namespace etl
 #if ETL_USING_CPP17
   inline constexpr in_place_t in_place{};
 #endif
+
+  //***************************************************************************
+  /// sorted_unique disambiguation tag.
+  /// Indicates that a range is already sorted and has no duplicate keys.
+  //***************************************************************************
+  struct sorted_unique_t
+  {
+    explicit ETL_CONSTEXPR sorted_unique_t() {}
+  };
+
+#if ETL_USING_CPP17
+  inline constexpr sorted_unique_t sorted_unique{};
+#endif
   
   //*************************
   template <typename T> struct in_place_type_t 
@@ -34,6 +34,9 @@ SOFTWARE.
 #include "platform.h"
 #include "functional.h"
 #include "type_traits.h"
+#include "static_assert.h"
+#include "span.h"
+#include "private/statistics_simd.h"
 
 //#include <math.h>
 #include <stdint.h>
@@ -68,6 +71,27 @@ namespace etl
     {
       typedef double calc_t;
     };
+
+    //***************************************************************************
+    /// The default calculation type for welford_variance.
+    //***************************************************************************
+    template <typename TInput>
+    struct welford_variance_traits
+    {
+      typedef double calc_t;
+    };
+
+    template <>
+    struct welford_variance_traits<float>
+    {
+      typedef float calc_t;
+    };
+
+    template <>
+    struct welford_variance_traits<long double>
+    {
+      typedef long double calc_t;
+    };
   }
 
   //***************************************************************************
@@ -151,6 +175,17 @@ namespace etl
       }
     }
 
+    //*********************************
+    /// Add a block of values.
+    /// Accumulates several partial sums at once, using vector instructions where supported.
+    //*********************************
+    void add(etl::span<const TInput> values)
+    {
+      private_statistics::block_accumulate<TInput, TCalc, calc_t>::sum_and_sum_of_squares(values.data(), values.size(), sum, sum_of_squares);
+      counter += uint32_t(values.size());
+      recalculate = true;
+    }
+
     //*********************************
     /// operator ()
     /// Add a pair of values.
@@ -170,6 +205,17 @@ namespace etl
       add(first, last);
     }
 
+    //*********************************
+    /// Merge the values added to another variance.
+    //*********************************
+    void merge(const variance& other)
+    {
+      sum_of_squares += other.sum_of_squares;
+      sum            += other.sum;
+      counter        += other.counter;
+      recalculate    = true;
+    }
+
     //*********************************
     /// Get the variance.
     //*********************************
@@ -231,6 +277,199 @@ namespace etl
     mutable double variance_value;
     mutable bool   recalculate;
   };
+
+  //***************************************************************************
+  /// Variance, using Welford's algorithm.
+  /// Keeps a running mean and the sum of squared differences from it, which
+  /// does not lose precision over long runs in the way that raw sums do.
+  /// Partial results may be merged, and values removed for sliding windows.
+  //***************************************************************************
+  template <bool Variance_Type, typename TInput, typename TCalc = typename private_variance::welford_variance_traits<TInput>::calc_t>
+  class welford_variance
+    : public etl::binary_function<TInput, TInput, void>
+  {
+  private:
+
+    ETL_STATIC_ASSERT(etl::is_floating_point<TCalc>::value, "TCalc must be a floating point type");
+
+    static ETL_CONSTANT int Adjustment = (Variance_Type == variance_type::Population) ? 0 : 1;
+
+  public:
+
+    typedef TCalc calc_t;
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    welford_variance()
+    {
+      clear();
+    }
+
+    //*********************************
+    /// Constructor.
+    //*********************************
+    template <typename TIterator>
+    welford_variance(TIterator first, TIterator last)
+    {
+      clear();
+      add(first, last);
+    }
+
+    //*********************************
+    /// Add a value.
+    //*********************************
+    void add(TInput value)
+    {
+      const calc_t x = calc_t(value);
+
+      ++counter;
+
+      const calc_t delta = x - mean_value;
+      mean_value += delta / calc_t(counter);
+      m2         += delta * (x - mean_value);
+    }
+
+    //*********************************
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void add(TIterator first, TIterator last)
+    {
+      while (first != last)
+      {
+        add(*first);
+        ++first;
+      }
+    }
+
+    //*********************************
+    /// Remove a value that was previously added.
+    //*********************************
+    void remove(TInput value)
+    {
+      if (counter <= 1U)
+      {
+        clear();
+        return;
+      }
+
+      const calc_t x = calc_t(value);
+
+      --counter;
+
+      const calc_t delta = x - mean_value;
+      mean_value -= delta / calc_t(counter);
+      m2         -= delta * (x - mean_value);
+
+      // Guard against rounding taking it below zero.
+      if (m2 < calc_t(0))
+      {
+        m2 = calc_t(0);
+      }
+    }
+
+    //*********************************
+    /// Merge the values added to another variance.
+    //*********************************
+    void merge(const welford_variance& other)
+    {
+      if (other.counter == 0U)
+      {
+        return;
+      }
+
+      if (counter == 0U)
+      {
+        *this = other;
+        return;
+      }
+
+      const calc_t n1    = calc_t(counter);
+      const calc_t n2    = calc_t(other.counter);
+      const calc_t n     = n1 + n2;
+      const calc_t delta = other.mean_value - mean_value;
+
+      mean_value += delta * (n2 / n);
+      m2         += other.m2 + ((delta * delta) * ((n1 * n2) / n));
+      counter    += other.counter;
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a value.
+    //*********************************
+    void operator ()(TInput value)
+    {
+      add(value);
+    }
+
+    //*********************************
+    /// operator ()
+    /// Add a range.
+    //*********************************
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last)
+    {
+      add(first, last);
+    }
+
+    //*********************************
+    /// Get the variance.
+    //*********************************
+    double get_variance() const
+    {
+      if (counter > uint32_t(Adjustment))
+      {
+        return double(m2 / calc_t(counter - uint32_t(Adjustment)));
+      }
+
+      return 0.0;
+    }
+
+    //*********************************
+    /// Get the variance.
+    //*********************************
+    operator double() const
+    {
+      return get_variance();
+    }
+
+    //*********************************
+    /// Get the mean.
+    //*********************************
+    double get_mean() const
+    {
+      return double(mean_value);
+    }
+
+    //*********************************
+    /// Get the total number added entries.
+    //*********************************
+    size_t count() const
+    {
+      return size_t(counter);
+    }
+
+    //*********************************
+    /// Clear the variance.
+    //*********************************
+    void clear()
+    {
+      mean_value = calc_t(0);
+      m2         = calc_t(0);
+      counter    = 0U;
+    }
+
+  private:
+
+    calc_t   mean_value;
+    calc_t   m2;
+    uint32_t counter;
+  };
+
+  template <bool Variance_Type, typename TInput, typename TCalc>
+  ETL_CONSTANT int welford_variance<Variance_Type, TInput, TCalc>::Adjustment;
 }
 
 #endif
@@ -167,6 +167,28 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** items, size_t n)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+      return base_t::template allocate_n<T>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    size_t allocate_n(etl::span<T*, Extent> items)
+    {
+      return allocate_n(items.data(), items.size());
+    }
+
     //*************************************************************************
     /// Destroys the object.
     //*************************************************************************
@@ -310,6 +332,28 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Allocate storage for n objects from the pool in one operation.
+    /// Either all n are allocated or none are.
+    //*************************************************************************
+    template <typename T>
+    size_t allocate_n(T** items, size_t n)
+    {
+      ETL_STATIC_ASSERT((etl::is_one_of<T, T1, T2, T3, T4, T5, T6, T7, T8, T9, T10, T11, T12, T13, T14, T15, T16>::value), "Unsupported type");
+
+      return base_t::template allocate_n<T>(items, n);
+    }
+
+    //*************************************************************************
+    /// Allocate storage for an object from the pool for each element of the span.
+    /// Either all are allocated or none are.
+    //*************************************************************************
+    template <typename T, size_t Extent>
+    size_t allocate_n(etl::span<T*, Extent> items)
+    {
+      return allocate_n(items.data(), items.size());
+    }
+
     //*************************************************************************
     /// Destroys the object.
     //*************************************************************************
@@ -49,6 +49,7 @@ SOFTWARE.
 #include "placement_new.h"
 #include "algorithm.h"
 #include "initializer_list.h"
+#include "check_policy.h"
 
 #include <stddef.h>
 #include <stdint.h>
@@ -269,6 +270,7 @@ namespace etl
     //*********************************************************************
     void reserve(size_t n)
     {
+      (void)n; // Unused if asserts are disabled.
       ETL_ASSERT(n <= CAPACITY, ETL_ERROR(vector_out_of_bounds));
     }
 
@@ -316,6 +318,42 @@ namespace etl
       return p_buffer[i];
     }
 
+    //*********************************************************************
+    /// Returns a reference to the value at index 'i', checked according to
+    /// the policy tag instead of always.
+    ///\param i The index.
+    ///\return A reference to the value at index 'i'
+    //*********************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, reference>::type
+      at(size_t i, TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(i < size(), ETL_ERROR(vector_out_of_bounds));
+      }
+
+      return p_buffer[i];
+    }
+
+    //*********************************************************************
+    /// Returns a const reference to the value at index 'i', checked according
+    /// to the policy tag instead of always.
+    ///\param i The index.
+    ///\return A const reference to the value at index 'i'
+    //*********************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, const_reference>::type
+      at(size_t i, TPolicy) const
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT(i < size(), ETL_ERROR(vector_out_of_bounds));
+      }
+
+      return p_buffer[i];
+    }
+
     //*********************************************************************
     /// Returns a reference to the first element.
     ///\return A reference to the first element.
@@ -454,6 +492,42 @@ namespace etl
     }
 #endif
 
+    //*********************************************************************
+    /// Inserts a value at the end of the vector, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, const_reference value)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
+      }
+
+      create_back(value);
+    }
+
+#if ETL_USING_CPP11
+    //*********************************************************************
+    /// Inserts a value at the end of the vector, checked according to the
+    /// policy tag instead of ETL_CHECK_PUSH_POP.
+    ///\param value The value to add.
+    //*********************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      push_back(TPolicy, rvalue_reference value)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT_OR_RETURN(size() != CAPACITY, ETL_ERROR(vector_full));
+      }
+
+      create_back(etl::move(value));
+    }
+#endif
+
 #if ETL_USING_CPP11 && ETL_NOT_USING_STLPORT && !defined(ETL_VECTOR_FORCE_CPP03_IMPLEMENTATION)
     //*********************************************************************
     /// Constructs a value at the end of the vector.
@@ -569,6 +643,22 @@ namespace etl
       destroy_back();
     }
 
+    //*************************************************************************
+    /// Removes an element from the end of the vector, checked according to
+    /// the policy tag instead of ETL_CHECK_PUSH_POP.
+    //*************************************************************************
+    template <typename TPolicy>
+    typename etl::enable_if<etl::is_check_policy<TPolicy>::value, void>::type
+      pop_back(TPolicy)
+    {
+      if ETL_IF_CONSTEXPR(etl::check_policy_enabled<TPolicy>::value)
+      {
+        ETL_ASSERT_OR_RETURN(size() > 0, ETL_ERROR(vector_empty));
+      }
+
+      destroy_back();
+    }
+
     //*********************************************************************
     /// Inserts a value to the vector.
     /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
@@ -585,6 +675,20 @@ namespace etl
       {
         create_back(value);
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        // The value may be an element that is about to be relocated.
+        const_pointer p_value = etl::addressof(value);
+
+        if ((p_value >= position_) && (p_value < p_end))
+        {
+          ++p_value;
+        }
+
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, *p_value);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         create_back(back());
@@ -612,6 +716,12 @@ namespace etl
       {
         create_back(etl::move(value));
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        open_gap(position_, 1U);
+        etl::create_copy_at(position_, etl::move(value));
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         create_back(etl::move(back()));
@@ -641,6 +751,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -668,6 +784,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -695,6 +817,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -722,6 +850,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -749,6 +883,12 @@ namespace etl
         p = p_end++;
         ETL_INCREMENT_DEBUG_COUNT;
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        p = etl::addressof(*position_);
+        open_gap(position_, 1U);
+        ETL_INCREMENT_DEBUG_COUNT;
+      }
       else
       {
         p = etl::addressof(*position_);
@@ -776,6 +916,22 @@ namespace etl
 
       iterator position_ = to_iterator(position);
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        // The value may be an element that is about to be relocated.
+        const_pointer p_value = etl::addressof(value);
+
+        if ((p_value >= position_) && (p_value < p_end))
+        {
+          p_value += n;
+        }
+
+        open_gap(position_, n);
+        etl::uninitialized_fill_n(position_, n, *p_value);
+        ETL_ADD_DEBUG_COUNT(n);
+        return;
+      }
+
       size_t insert_n = n;
       size_t insert_begin = etl::distance(begin(), position_);
       size_t insert_end = insert_begin + insert_n;
@@ -833,6 +989,16 @@ namespace etl
 
       ETL_ASSERT_OR_RETURN((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        iterator position_ = to_iterator(position);
+
+        open_gap(position_, count);
+        etl::uninitialized_copy(first, last, position_);
+        ETL_ADD_DEBUG_COUNT(count);
+        return;
+      }
+
       size_t insert_n = count;
       size_t insert_begin = etl::distance(cbegin(), position);
       size_t insert_end = insert_begin + insert_n;
@@ -882,8 +1048,17 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      etl::move(i_element + 1, end(), i_element);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element);
+        ETL_DECREMENT_DEBUG_COUNT;
+        close_gap(i_element, 1U);
+      }
+      else
+      {
+        etl::move(i_element + 1, end(), i_element);
+        destroy_back();
+      }
 
       return i_element;
     }
@@ -897,8 +1072,17 @@ namespace etl
     {
       iterator i_element_ = to_iterator(i_element);
 
-      etl::move(i_element_ + 1, end(), i_element_);
-      destroy_back();
+      if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        etl::destroy_at(i_element_);
+        ETL_DECREMENT_DEBUG_COUNT;
+        close_gap(i_element_, 1U);
+      }
+      else
+      {
+        etl::move(i_element_ + 1, end(), i_element_);
+        destroy_back();
+      }
 
       return i_element_;
     }
@@ -920,6 +1104,14 @@ namespace etl
       {
         clear();
       }
+      else if ETL_IF_CONSTEXPR(etl::is_trivially_relocatable<T>::value)
+      {
+        size_t n_delete = etl::distance(first_, last_);
+
+        etl::destroy(first_, last_);
+        ETL_SUBTRACT_DEBUG_COUNT(n_delete);
+        close_gap(first_, n_delete);
+      }
       else
       {
         etl::move(last_, end(), first_);
@@ -1097,6 +1289,26 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT;
     }
 
+    //*********************************************************************
+    /// Relocates the elements from 'position' up by 'n', leaving an
+    /// uninitialised gap. Only used for trivially relocatable types.
+    //*********************************************************************
+    void open_gap(pointer position, size_t n)
+    {
+      etl::mem_relocate(position, p_end, position + n);
+      p_end += n;
+    }
+
+    //*********************************************************************
+    /// Relocates the elements after an uninitialised gap of 'n' at
+    /// 'position' down to fill it. Only used for trivially relocatable types.
+    //*********************************************************************
+    void close_gap(pointer position, size_t n)
+    {
+      etl::mem_relocate(position + n, p_end, position);
+      p_end -= n;
+    }
+
     // Disable copy construction.
     ivector(const ivector&) ETL_DELETE;
 
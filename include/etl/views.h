@@ -0,0 +1,935 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_VIEWS_INCLUDED
+#define ETL_VIEWS_INCLUDED
+
+#include "platform.h"
+#include "iterator.h"
+#include "type_traits.h"
+#include "utility.h"
+#include "multi_range.h"
+
+#include <stddef.h>
+
+#if ETL_USING_CPP11
+
+///\defgroup views views
+/// Lazy, composable views over containers.
+/// A view refers to its source and evaluates each element as it is iterated,
+/// so a chain such as filter, transform and take runs in a single pass with
+/// no intermediate storage.
+///\code
+/// for (int value : samples | etl::views::filter(is_valid)
+///                          | etl::views::transform(scale)
+///                          | etl::views::take(8))
+/// {
+///   total += value;
+/// }
+///\endcode
+/// Views hold a reference to a container, so the container must outlive
+/// them. Views themselves are held by value within a chain.
+///\ingroup containers
+
+namespace etl
+{
+  namespace views
+  {
+    //*************************************************************************
+    /// The base of all views.
+    //*************************************************************************
+    struct view_base
+    {
+    };
+
+    //*************************************************************************
+    /// Is T a view?
+    //*************************************************************************
+    template <typename T>
+    struct is_view : public etl::bool_constant<etl::is_base_of<view_base, typename etl::remove_cv<T>::type>::value>
+    {
+    };
+
+    namespace private_views
+    {
+      //***********************************************************************
+      /// Views are at best forward iterable.
+      /// Input sources, such as multi_range, stay as input.
+      //***********************************************************************
+      template <typename TIterator>
+      struct iterator_category
+      {
+        typedef typename etl::iterator_traits<TIterator>::iterator_category base_category;
+
+        typedef typename etl::conditional<etl::is_same<base_category, ETL_OR_STD::input_iterator_tag>::value,
+                                          ETL_OR_STD::input_iterator_tag,
+                                          ETL_OR_STD::forward_iterator_tag>::type type;
+      };
+    }
+
+    //*************************************************************************
+    /// A view of the elements in the range [begin, end).
+    //*************************************************************************
+    template <typename TIterator>
+    class ref_view : public view_base
+    {
+    public:
+
+      typedef TIterator iterator;
+
+      ref_view(TIterator first_, TIterator last_)
+        : first(first_)
+        , last(last_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return first;
+      }
+
+      iterator end() const
+      {
+        return last;
+      }
+
+      bool empty() const
+      {
+        return first == last;
+      }
+
+    private:
+
+      TIterator first;
+      TIterator last;
+    };
+
+    //*************************************************************************
+    /// An input view of the values of an etl::multi_range.
+    /// Iteration starts the range and steps it until it completes.
+    //*************************************************************************
+    template <typename T>
+    class multi_range_view : public view_base
+    {
+    public:
+
+      class iterator
+      {
+      public:
+
+        typedef ETL_OR_STD::input_iterator_tag iterator_category;
+        typedef T                              value_type;
+        typedef ptrdiff_t                      difference_type;
+        typedef const T*                       pointer;
+        typedef const T&                       reference;
+
+        iterator()
+          : p_range(ETL_NULLPTR)
+        {
+        }
+
+        explicit iterator(etl::multi_range<T>* p_range_)
+          : p_range(p_range_)
+        {
+        }
+
+        reference operator *() const
+        {
+          return p_range->value();
+        }
+
+        iterator& operator ++()
+        {
+          p_range->next();
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          p_range->next();
+          return temp;
+        }
+
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.is_end() == rhs.is_end();
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        bool is_end() const
+        {
+          return (p_range == ETL_NULLPTR) || p_range->completed();
+        }
+
+        etl::multi_range<T>* p_range;
+      };
+
+      explicit multi_range_view(etl::multi_range<T>& range_)
+        : p_range(&range_)
+      {
+      }
+
+      iterator begin() const
+      {
+        p_range->start();
+        return iterator(p_range);
+      }
+
+      iterator end() const
+      {
+        return iterator();
+      }
+
+    private:
+
+      etl::multi_range<T>* p_range;
+    };
+
+    //*************************************************************************
+    /// Gets a view of a container, array or multi_range.
+    /// Views are returned as copies.
+    //*************************************************************************
+    template <typename TRange>
+    auto all(TRange& range) -> typename etl::enable_if<!is_view<TRange>::value, ref_view<decltype(range.begin())> >::type
+    {
+      return ref_view<decltype(range.begin())>(range.begin(), range.end());
+    }
+
+    template <typename T, size_t Size>
+    ref_view<T*> all(T(&data)[Size])
+    {
+      return ref_view<T*>(data, data + Size);
+    }
+
+    template <typename T>
+    multi_range_view<T> all(etl::multi_range<T>& range)
+    {
+      return multi_range_view<T>(range);
+    }
+
+    template <typename TView>
+    auto all(TView&& view) -> typename etl::enable_if<is_view<typename etl::decay<TView>::type>::value, typename etl::decay<TView>::type>::type
+    {
+      return etl::forward<TView>(view);
+    }
+
+    template <typename TRange>
+    using all_t = decltype(etl::views::all(etl::declval<TRange>()));
+
+    //*************************************************************************
+    /// A view of the elements that satisfy a predicate.
+    //*************************************************************************
+    template <typename TView, typename TPredicate>
+    class filter_view : public view_base
+    {
+    public:
+
+      typedef typename TView::iterator base_iterator;
+
+      class iterator
+      {
+      public:
+
+        typedef typename private_views::iterator_category<base_iterator>::type iterator_category;
+        typedef typename etl::iterator_traits<base_iterator>::value_type       value_type;
+        typedef typename etl::iterator_traits<base_iterator>::difference_type  difference_type;
+        typedef typename etl::iterator_traits<base_iterator>::pointer          pointer;
+        typedef typename etl::iterator_traits<base_iterator>::reference        reference;
+
+        iterator()
+          : current()
+          , last()
+          , p_predicate(ETL_NULLPTR)
+        {
+        }
+
+        iterator(base_iterator current_, base_iterator last_, const TPredicate* p_predicate_)
+          : current(current_)
+          , last(last_)
+          , p_predicate(p_predicate_)
+        {
+          satisfy();
+        }
+
+        reference operator *() const
+        {
+          return *current;
+        }
+
+        iterator& operator ++()
+        {
+          ++current;
+          satisfy();
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        base_iterator base() const
+        {
+          return current;
+        }
+
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.current == rhs.current;
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        // Skip to the next element that satisfies the predicate.
+        void satisfy()
+        {
+          while ((current != last) && !(*p_predicate)(*current))
+          {
+            ++current;
+          }
+        }
+
+        base_iterator     current;
+        base_iterator     last;
+        const TPredicate* p_predicate;
+      };
+
+      filter_view(const TView& view_, const TPredicate& predicate_)
+        : view(view_)
+        , predicate(predicate_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(view.begin(), view.end(), &predicate);
+      }
+
+      iterator end() const
+      {
+        base_iterator last = view.end();
+        return iterator(last, last, &predicate);
+      }
+
+    private:
+
+      TView      view;
+      TPredicate predicate;
+    };
+
+    //*************************************************************************
+    /// A view of the results of applying a function to each element.
+    //*************************************************************************
+    template <typename TView, typename TFunction>
+    class transform_view : public view_base
+    {
+    public:
+
+      typedef typename TView::iterator base_iterator;
+
+      class iterator
+      {
+      public:
+
+        typedef typename private_views::iterator_category<base_iterator>::type                 iterator_category;
+        typedef decltype(etl::declval<const TFunction&>()(*etl::declval<base_iterator>()))     reference;
+        typedef typename etl::remove_cv<typename etl::remove_reference<reference>::type>::type value_type;
+        typedef typename etl::iterator_traits<base_iterator>::difference_type                  difference_type;
+        typedef void                                                                           pointer;
+
+        iterator()
+          : current()
+          , p_function(ETL_NULLPTR)
+        {
+        }
+
+        iterator(base_iterator current_, const TFunction* p_function_)
+          : current(current_)
+          , p_function(p_function_)
+        {
+        }
+
+        reference operator *() const
+        {
+          return (*p_function)(*current);
+        }
+
+        iterator& operator ++()
+        {
+          ++current;
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++current;
+          return temp;
+        }
+
+        base_iterator base() const
+        {
+          return current;
+        }
+
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.current == rhs.current;
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        base_iterator    current;
+        const TFunction* p_function;
+      };
+
+      transform_view(const TView& view_, const TFunction& function_)
+        : view(view_)
+        , function(function_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(view.begin(), &function);
+      }
+
+      iterator end() const
+      {
+        return iterator(view.end(), &function);
+      }
+
+    private:
+
+      TView     view;
+      TFunction function;
+    };
+
+    //*************************************************************************
+    /// A view of, at most, the first n elements.
+    //*************************************************************************
+    template <typename TView>
+    class take_view : public view_base
+    {
+    public:
+
+      typedef typename TView::iterator base_iterator;
+
+      class iterator
+      {
+      public:
+
+        typedef typename private_views::iterator_category<base_iterator>::type iterator_category;
+        typedef typename etl::iterator_traits<base_iterator>::value_type       value_type;
+        typedef typename etl::iterator_traits<base_iterator>::difference_type  difference_type;
+        typedef typename etl::iterator_traits<base_iterator>::pointer          pointer;
+        typedef typename etl::iterator_traits<base_iterator>::reference        reference;
+
+        iterator()
+          : current()
+          , remaining(0U)
+        {
+        }
+
+        iterator(base_iterator current_, size_t remaining_)
+          : current(current_)
+          , remaining(remaining_)
+        {
+        }
+
+        reference operator *() const
+        {
+          return *current;
+        }
+
+        iterator& operator ++()
+        {
+          ++current;
+          --remaining;
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        base_iterator base() const
+        {
+          return current;
+        }
+
+        // Ends when either the count runs out or the underlying view ends.
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.current == rhs.current) || ((lhs.remaining == 0U) && (rhs.remaining == 0U));
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        base_iterator current;
+        size_t        remaining;
+      };
+
+      take_view(const TView& view_, size_t count_)
+        : view(view_)
+        , count(count_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(view.begin(), count);
+      }
+
+      iterator end() const
+      {
+        return iterator(view.end(), 0U);
+      }
+
+    private:
+
+      TView  view;
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// A view of the elements after the first n.
+    //*************************************************************************
+    template <typename TView>
+    class drop_view : public view_base
+    {
+    public:
+
+      typedef typename TView::iterator iterator;
+
+      drop_view(const TView& view_, size_t count_)
+        : view(view_)
+        , count(count_)
+      {
+      }
+
+      iterator begin() const
+      {
+        iterator itr  = view.begin();
+        iterator last = view.end();
+
+        for (size_t i = 0U; (i < count) && (itr != last); ++i)
+        {
+          ++itr;
+        }
+
+        return itr;
+      }
+
+      iterator end() const
+      {
+        return view.end();
+      }
+
+    private:
+
+      TView  view;
+      size_t count;
+    };
+
+    //*************************************************************************
+    /// A view of every n'th element, starting with the first.
+    /// A step of zero is treated as one.
+    //*************************************************************************
+    template <typename TView>
+    class stride_view : public view_base
+    {
+    public:
+
+      typedef typename TView::iterator base_iterator;
+
+      class iterator
+      {
+      public:
+
+        typedef typename private_views::iterator_category<base_iterator>::type iterator_category;
+        typedef typename etl::iterator_traits<base_iterator>::value_type       value_type;
+        typedef typename etl::iterator_traits<base_iterator>::difference_type  difference_type;
+        typedef typename etl::iterator_traits<base_iterator>::pointer          pointer;
+        typedef typename etl::iterator_traits<base_iterator>::reference        reference;
+
+        iterator()
+          : current()
+          , last()
+          , step(1U)
+        {
+        }
+
+        iterator(base_iterator current_, base_iterator last_, size_t step_)
+          : current(current_)
+          , last(last_)
+          , step(step_)
+        {
+        }
+
+        reference operator *() const
+        {
+          return *current;
+        }
+
+        // Never steps past the end of the underlying view.
+        iterator& operator ++()
+        {
+          for (size_t i = 0U; (i < step) && (current != last); ++i)
+          {
+            ++current;
+          }
+
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        base_iterator base() const
+        {
+          return current;
+        }
+
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.current == rhs.current;
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        base_iterator current;
+        base_iterator last;
+        size_t        step;
+      };
+
+      stride_view(const TView& view_, size_t step_)
+        : view(view_)
+        , step((step_ == 0U) ? 1U : step_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(view.begin(), view.end(), step);
+      }
+
+      iterator end() const
+      {
+        base_iterator last = view.end();
+        return iterator(last, last, step);
+      }
+
+    private:
+
+      TView  view;
+      size_t step;
+    };
+
+    //*************************************************************************
+    /// A view of pairs of corresponding elements from two views.
+    /// Ends with the shorter of the two.
+    //*************************************************************************
+    template <typename TView1, typename TView2>
+    class zip_view : public view_base
+    {
+    public:
+
+      typedef typename TView1::iterator base_iterator1;
+      typedef typename TView2::iterator base_iterator2;
+
+      class iterator
+      {
+      public:
+
+        typedef typename etl::iterator_traits<base_iterator1>::reference reference1;
+        typedef typename etl::iterator_traits<base_iterator2>::reference reference2;
+
+        typedef typename private_views::iterator_category<base_iterator1>::type iterator_category;
+        typedef etl::pair<typename etl::iterator_traits<base_iterator1>::value_type,
+                          typename etl::iterator_traits<base_iterator2>::value_type> value_type;
+        typedef typename etl::iterator_traits<base_iterator1>::difference_type difference_type;
+        typedef void                                                           pointer;
+        typedef etl::pair<reference1, reference2>                              reference;
+
+        iterator()
+          : current1()
+          , current2()
+        {
+        }
+
+        iterator(base_iterator1 current1_, base_iterator2 current2_)
+          : current1(current1_)
+          , current2(current2_)
+        {
+        }
+
+        reference operator *() const
+        {
+          return reference(*current1, *current2);
+        }
+
+        iterator& operator ++()
+        {
+          ++current1;
+          ++current2;
+          return *this;
+        }
+
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          ++(*this);
+          return temp;
+        }
+
+        // Ends when either underlying view ends.
+        friend bool operator ==(const iterator& lhs, const iterator& rhs)
+        {
+          return (lhs.current1 == rhs.current1) || (lhs.current2 == rhs.current2);
+        }
+
+        friend bool operator !=(const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        base_iterator1 current1;
+        base_iterator2 current2;
+      };
+
+      zip_view(const TView1& view1_, const TView2& view2_)
+        : view1(view1_)
+        , view2(view2_)
+      {
+      }
+
+      iterator begin() const
+      {
+        return iterator(view1.begin(), view2.begin());
+      }
+
+      iterator end() const
+      {
+        return iterator(view1.end(), view2.end());
+      }
+
+    private:
+
+      TView1 view1;
+      TView2 view2;
+    };
+
+    //*************************************************************************
+    /// Pipe adaptors.
+    /// range | etl::views::filter(predicate) is equivalent to
+    /// etl::views::filter(range, predicate).
+    //*************************************************************************
+    template <typename TPredicate>
+    struct filter_adaptor
+    {
+      TPredicate predicate;
+    };
+
+    template <typename TFunction>
+    struct transform_adaptor
+    {
+      TFunction function;
+    };
+
+    struct take_adaptor
+    {
+      size_t count;
+    };
+
+    struct drop_adaptor
+    {
+      size_t count;
+    };
+
+    struct stride_adaptor
+    {
+      size_t step;
+    };
+
+    //*************************************************************************
+    /// filter
+    //*************************************************************************
+    template <typename TRange, typename TPredicate>
+    filter_view<all_t<TRange>, TPredicate> filter(TRange&& range, TPredicate predicate)
+    {
+      return filter_view<all_t<TRange>, TPredicate>(etl::views::all(etl::forward<TRange>(range)), predicate);
+    }
+
+    template <typename TPredicate>
+    filter_adaptor<TPredicate> filter(TPredicate predicate)
+    {
+      return filter_adaptor<TPredicate>{ predicate };
+    }
+
+    template <typename TRange, typename TPredicate>
+    filter_view<all_t<TRange>, TPredicate> operator |(TRange&& range, const filter_adaptor<TPredicate>& adaptor)
+    {
+      return etl::views::filter(etl::forward<TRange>(range), adaptor.predicate);
+    }
+
+    //*************************************************************************
+    /// transform
+    //*************************************************************************
+    template <typename TRange, typename TFunction>
+    transform_view<all_t<TRange>, TFunction> transform(TRange&& range, TFunction function)
+    {
+      return transform_view<all_t<TRange>, TFunction>(etl::views::all(etl::forward<TRange>(range)), function);
+    }
+
+    template <typename TFunction>
+    transform_adaptor<TFunction> transform(TFunction function)
+    {
+      return transform_adaptor<TFunction>{ function };
+    }
+
+    template <typename TRange, typename TFunction>
+    transform_view<all_t<TRange>, TFunction> operator |(TRange&& range, const transform_adaptor<TFunction>& adaptor)
+    {
+      return etl::views::transform(etl::forward<TRange>(range), adaptor.function);
+    }
+
+    //*************************************************************************
+    /// take
+    //*************************************************************************
+    template <typename TRange>
+    take_view<all_t<TRange> > take(TRange&& range, size_t count)
+    {
+      return take_view<all_t<TRange> >(etl::views::all(etl::forward<TRange>(range)), count);
+    }
+
+    inline take_adaptor take(size_t count)
+    {
+      return take_adaptor{ count };
+    }
+
+    template <typename TRange>
+    take_view<all_t<TRange> > operator |(TRange&& range, take_adaptor adaptor)
+    {
+      return etl::views::take(etl::forward<TRange>(range), adaptor.count);
+    }
+
+    //*************************************************************************
+    /// drop
+    //*************************************************************************
+    template <typename TRange>
+    drop_view<all_t<TRange> > drop(TRange&& range, size_t count)
+    {
+      return drop_view<all_t<TRange> >(etl::views::all(etl::forward<TRange>(range)), count);
+    }
+
+    inline drop_adaptor drop(size_t count)
+    {
+      return drop_adaptor{ count };
+    }
+
+    template <typename TRange>
+    drop_view<all_t<TRange> > operator |(TRange&& range, drop_adaptor adaptor)
+    {
+      return etl::views::drop(etl::forward<TRange>(range), adaptor.count);
+    }
+
+    //*************************************************************************
+    /// stride
+    //*************************************************************************
+    template <typename TRange>
+    stride_view<all_t<TRange> > stride(TRange&& range, size_t step)
+    {
+      return stride_view<all_t<TRange> >(etl::views::all(etl::forward<TRange>(range)), step);
+    }
+
+    inline stride_adaptor stride(size_t step)
+    {
+      return stride_adaptor{ step };
+    }
+
+    template <typename TRange>
+    stride_view<all_t<TRange> > operator |(TRange&& range, stride_adaptor adaptor)
+    {
+      return etl::views::stride(etl::forward<TRange>(range), adaptor.step);
+    }
+
+    //*************************************************************************
+    /// zip
+    //*************************************************************************
+    template <typename TRange1, typename TRange2>
+    zip_view<all_t<TRange1>, all_t<TRange2> > zip(TRange1&& range1, TRange2&& range2)
+    {
+      return zip_view<all_t<TRange1>, all_t<TRange2> >(etl::views::all(etl::forward<TRange1>(range1)),
+                                                       etl::views::all(etl::forward<TRange2>(range2)));
+    }
+  }
+}
+
+#endif
+#endif
@@ -0,0 +1,77 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WAIT_EVENT_INCLUDED
+#define ETL_WAIT_EVENT_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "mutex.h"
+
+//*****************************************************************************
+///\defgroup wait_event wait_event
+/// An event count that lets a thread sleep until another thread signals that
+/// something it was waiting for may have changed.
+///\code
+/// etl::wait_event::epoch_type epoch = event.prepare_wait();
+/// if (!condition())
+/// {
+///   event.wait(epoch); // Returns when notified after prepare_wait().
+/// }
+///\endcode
+/// notify_one() and notify_all() are cheap when there are no waiters.
+///\ingroup utilities
+//*****************************************************************************
+
+#if defined(ETL_TARGET_OS_CMSIS_OS2) && ETL_HAS_ATOMIC && ETL_HAS_MUTEX
+  #include "wait_event/wait_event_cmsis_os2.h"
+  #define ETL_HAS_WAIT_EVENT 1
+#elif defined(ETL_TARGET_OS_FREERTOS) && ETL_HAS_ATOMIC && ETL_HAS_MUTEX
+  #include "wait_event/wait_event_freertos.h"
+  #define ETL_HAS_WAIT_EVENT 1
+#elif (defined(ETL_TARGET_OS_LINUX) || defined(__linux__)) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG))
+  #include "wait_event/wait_event_linux.h"
+  #define ETL_HAS_WAIT_EVENT 1
+#elif ETL_USING_STL && ETL_USING_CPP11
+  #include "wait_event/wait_event_std.h"
+  #define ETL_HAS_WAIT_EVENT 1
+#else
+  #define ETL_HAS_WAIT_EVENT 0
+#endif
+
+namespace etl
+{
+  namespace traits
+  {
+    static ETL_CONSTANT bool has_wait_event = (ETL_HAS_WAIT_EVENT == 1);
+  }
+}
+
+#endif
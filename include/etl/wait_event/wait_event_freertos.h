@@ -0,0 +1,146 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WAIT_EVENT_FREERTOS_INCLUDED
+#define ETL_WAIT_EVENT_FREERTOS_INCLUDED
+
+#include "../platform.h"
+#include "../atomic.h"
+#include "../mutex.h"
+
+#include <stdint.h>
+
+#include "FreeRTOS.h"
+#include <event_groups.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup wait_event
+  ///\brief This wait_event class is implemented using FreeRTOS's event groups.
+  /// One of eight bits is set at a time, and each notification moves it along.
+  /// A waiter blocks until a bit other than the one it saw is set.
+  /// The event group is only touched when there are waiters.
+  /// Notifications must not be made from an interrupt.
+  //***************************************************************************
+  class wait_event
+  {
+  public:
+
+    typedef uint32_t epoch_type;
+
+    wait_event()
+      : generation(0U),
+        waiters(0U)
+    {
+      group = xEventGroupCreateStatic(&group_allocation);
+      xEventGroupSetBits(group, 1U);
+    }
+
+    //*************************************************************************
+    /// Gets the epoch to pass to wait().
+    /// Read this before checking the condition being waited for.
+    //*************************************************************************
+    epoch_type prepare_wait() const
+    {
+      return generation.load();
+    }
+
+    //*************************************************************************
+    /// Blocks until notified after the epoch was read.
+    /// May return spuriously, so the caller must recheck its condition.
+    //*************************************************************************
+    void wait(epoch_type epoch)
+    {
+      ++waiters;
+
+      EventBits_t bits = xEventGroupGetBits(group) & All_Bits;
+
+      if (generation.load() == epoch)
+      {
+        xEventGroupWaitBits(group, All_Bits & ~bits, pdFALSE, pdFALSE, portMAX_DELAY); // portMAX_DELAY=block forever
+      }
+
+      --waiters;
+    }
+
+    //*************************************************************************
+    /// Wakes one waiter.
+    /// Event groups wake every waiter, so this is the same as notify_all().
+    //*************************************************************************
+    void notify_one()
+    {
+      notify_all();
+    }
+
+    //*************************************************************************
+    /// Wakes all waiters.
+    //*************************************************************************
+    void notify_all()
+    {
+      ++generation;
+
+      if (waiters.load() != 0U)
+      {
+        etl::lock_guard<etl::mutex> lock(access);
+
+        EventBits_t bits = xEventGroupGetBits(group) & All_Bits;
+        EventBits_t next = (bits << 1U) & All_Bits;
+
+        if (next == 0U)
+        {
+          next = 1U;
+        }
+
+        xEventGroupSetBits(group, next);
+        xEventGroupClearBits(group, All_Bits & ~next);
+      }
+    }
+
+  private:
+
+    static ETL_CONSTANT EventBits_t All_Bits = 0xFFU;
+
+    wait_event(const wait_event&) ETL_DELETE;
+    wait_event& operator=(const wait_event&) ETL_DELETE;
+
+    etl::atomic<epoch_type> generation;
+    etl::atomic<uint32_t>   waiters;
+    etl::mutex              access;
+
+    // Memory to hold the event group
+    StaticEventGroup_t group_allocation;
+
+    // The event group handle itself
+    EventGroupHandle_t group;
+  };
+}
+
+#endif
@@ -0,0 +1,121 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WAIT_EVENT_LINUX_INCLUDED
+#define ETL_WAIT_EVENT_LINUX_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup wait_event
+  ///\brief This wait_event class is implemented using Linux futexes.
+  /// The kernel is only entered when there are waiters.
+  //***************************************************************************
+  class wait_event
+  {
+  public:
+
+    typedef uint32_t epoch_type;
+
+    wait_event()
+      : generation(0U),
+        waiters(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the epoch to pass to wait().
+    /// Read this before checking the condition being waited for.
+    //*************************************************************************
+    epoch_type prepare_wait() const
+    {
+      return __atomic_load_n(&generation, __ATOMIC_SEQ_CST);
+    }
+
+    //*************************************************************************
+    /// Blocks until notified after the epoch was read.
+    /// May return spuriously, so the caller must recheck its condition.
+    //*************************************************************************
+    void wait(epoch_type epoch)
+    {
+      __atomic_add_fetch(&waiters, 1U, __ATOMIC_SEQ_CST);
+
+      // The kernel only sleeps while the generation still equals the epoch.
+      syscall(SYS_futex, &generation, FUTEX_WAIT_PRIVATE, epoch, ETL_NULLPTR, ETL_NULLPTR, 0);
+
+      __atomic_sub_fetch(&waiters, 1U, __ATOMIC_SEQ_CST);
+    }
+
+    //*************************************************************************
+    /// Wakes one waiter.
+    //*************************************************************************
+    void notify_one()
+    {
+      notify(1);
+    }
+
+    //*************************************************************************
+    /// Wakes all waiters.
+    //*************************************************************************
+    void notify_all()
+    {
+      notify(INT_MAX);
+    }
+
+  private:
+
+    //*************************************************************************
+    void notify(int count)
+    {
+      __atomic_add_fetch(&generation, 1U, __ATOMIC_SEQ_CST);
+
+      if (__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0U)
+      {
+        syscall(SYS_futex, &generation, FUTEX_WAKE_PRIVATE, count, ETL_NULLPTR, ETL_NULLPTR, 0);
+      }
+    }
+
+    wait_event(const wait_event&) ETL_DELETE;
+    wait_event& operator=(const wait_event&) ETL_DELETE;
+
+    uint32_t generation;
+    uint32_t waiters;
+  };
+}
+
+#endif
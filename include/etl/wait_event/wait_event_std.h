@@ -0,0 +1,138 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WAIT_EVENT_STD_INCLUDED
+#define ETL_WAIT_EVENT_STD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup wait_event
+  ///\brief This wait_event class is implemented using std::condition_variable.
+  /// The mutex is only locked when there are waiters.
+  //***************************************************************************
+  class wait_event
+  {
+  public:
+
+    typedef uint32_t epoch_type;
+
+    wait_event()
+      : generation(0U),
+        waiters(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the epoch to pass to wait().
+    /// Read this before checking the condition being waited for.
+    //*************************************************************************
+    epoch_type prepare_wait() const
+    {
+      return generation.load();
+    }
+
+    //*************************************************************************
+    /// Blocks until notified after the epoch was read.
+    /// May return spuriously, so the caller must recheck its condition.
+    //*************************************************************************
+    void wait(epoch_type epoch)
+    {
+      std::unique_lock<std::mutex> lock(access);
+
+      ++waiters;
+
+      while (generation.load() == epoch)
+      {
+        condition.wait(lock);
+      }
+
+      --waiters;
+    }
+
+    //*************************************************************************
+    /// Wakes one waiter.
+    //*************************************************************************
+    void notify_one()
+    {
+      if (advance())
+      {
+        condition.notify_one();
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes all waiters.
+    //*************************************************************************
+    void notify_all()
+    {
+      if (advance())
+      {
+        condition.notify_all();
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Advances the generation and returns true if there are waiters.
+    //*************************************************************************
+    bool advance()
+    {
+      ++generation;
+
+      if (waiters.load() != 0U)
+      {
+        // Wait for the waiter to be blocked in the condition variable.
+        std::lock_guard<std::mutex> lock(access);
+        return true;
+      }
+
+      return false;
+    }
+
+    wait_event(const wait_event&) ETL_DELETE;
+    wait_event& operator=(const wait_event&) ETL_DELETE;
+
+    std::atomic<epoch_type> generation;
+    std::atomic<uint32_t>   waiters;
+    std::mutex              access;
+    std::condition_variable condition;
+  };
+}
+
+#endif
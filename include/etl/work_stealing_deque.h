@@ -0,0 +1,215 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_DEQUE_INCLUDED
+#define ETL_WORK_STEALING_DEQUE_INCLUDED
+
+#include "platform.h"
+#include "atomic.h"
+#include "power.h"
+#include "static_assert.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A fixed capacity Chase-Lev work stealing deque.
+  /// The owning thread pushes and pops at the bottom.
+  /// Any other thread may steal from the top.
+  /// T must be a type that etl::atomic supports, such as an integral or a pointer.
+  ///\tparam T         The type of the items.
+  ///\tparam VCapacity The maximum number of items. Must be a power of 2.
+  //***************************************************************************
+  template <typename T, size_t VCapacity>
+  class work_stealing_deque
+  {
+  public:
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<VCapacity>::value, "Capacity must be a power of 2");
+    ETL_STATIC_ASSERT(VCapacity <= 0x40000000UL, "Capacity too large");
+
+    typedef T      value_type;
+    typedef size_t size_type;
+
+    static ETL_CONSTANT size_type MAX_SIZE = VCapacity;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    work_stealing_deque()
+      : top(0U)
+      , bottom(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Pushes an item to the bottom.
+    /// Owner thread only.
+    /// Returns false if the deque is full.
+    //*************************************************************************
+    bool push(T value)
+    {
+      const uint32_t b = bottom.load(etl::memory_order_relaxed);
+      const uint32_t t = top.load(etl::memory_order_acquire);
+
+      if ((b - t) >= VCapacity)
+      {
+        return false;
+      }
+
+      buffer[b & Mask].store(value, etl::memory_order_relaxed);
+      bottom.store(b + 1U, etl::memory_order_seq_cst);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Pops the most recently pushed item from the bottom.
+    /// Owner thread only.
+    /// Returns false if the deque is empty, or the last item was stolen.
+    //*************************************************************************
+    bool pop(T& value)
+    {
+      const uint32_t b = bottom.load(etl::memory_order_relaxed) - 1U;
+      bottom.store(b, etl::memory_order_seq_cst);
+      uint32_t t = top.load(etl::memory_order_seq_cst);
+
+      bool result = false;
+
+      if (int32_t(b - t) >= 0)
+      {
+        value  = buffer[b & Mask].load(etl::memory_order_relaxed);
+        result = true;
+
+        if (b == t)
+        {
+          // The last item, so race any thieves for it.
+          result = top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed);
+          bottom.store(b + 1U, etl::memory_order_relaxed);
+        }
+      }
+      else
+      {
+        // Empty.
+        bottom.store(b + 1U, etl::memory_order_relaxed);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Steals the oldest item from the top.
+    /// Any thread.
+    /// Returns false if the deque is empty, or another thread got there first.
+    //*************************************************************************
+    bool steal(T& value)
+    {
+      uint32_t t = top.load(etl::memory_order_seq_cst);
+      const uint32_t b = bottom.load(etl::memory_order_seq_cst);
+
+      if (int32_t(b - t) > 0)
+      {
+        const T item = buffer[t & Mask].load(etl::memory_order_relaxed);
+
+        if (top.compare_exchange_strong(t, t + 1U, etl::memory_order_seq_cst, etl::memory_order_relaxed))
+        {
+          value = item;
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*************************************************************************
+    /// Is the deque empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0U;
+    }
+
+    //*************************************************************************
+    /// How many items are in the deque?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type size() const
+    {
+      const uint32_t b = bottom.load(etl::memory_order_acquire);
+      const uint32_t t = top.load(etl::memory_order_acquire);
+
+      const int32_t n = int32_t(b - t);
+
+      return (n > 0) ? size_type(n) : 0U;
+    }
+
+    //*************************************************************************
+    /// How many items can the deque hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the deque hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  private:
+
+    static ETL_CONSTANT uint32_t Mask = uint32_t(VCapacity - 1U);
+
+    // Disabled.
+    work_stealing_deque(const work_stealing_deque&) ETL_DELETE;
+    work_stealing_deque& operator =(const work_stealing_deque&) ETL_DELETE;
+
+    etl::atomic<uint32_t> top;
+    etl::atomic<uint32_t> bottom;
+    etl::atomic<T>        buffer[VCapacity];
+  };
+
+  template <typename T, size_t VCapacity>
+  ETL_CONSTANT typename work_stealing_deque<T, VCapacity>::size_type work_stealing_deque<T, VCapacity>::MAX_SIZE;
+
+  template <typename T, size_t VCapacity>
+  ETL_CONSTANT uint32_t work_stealing_deque<T, VCapacity>::Mask;
+}
+
+#endif
+#endif
@@ -0,0 +1,518 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+#include "platform.h"
+#include "static_assert.h"
+#include "type_traits.h"
+#include "iterator.h"
+#include "ihash.h"
+#include "error_handler.h"
+#include "frame_check_sequence.h"
+
+#include <stdint.h>
+
+#if ETL_USING_64BIT_TYPES
+
+///\defgroup wyhash wyhash hash calculation
+///\ingroup maths
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The default secret.
+    //*************************************************************************
+    template <typename T = void>
+    struct secret
+    {
+      static ETL_CONSTANT uint64_t s0 = 0x2D358DCCAA6C78A5ULL;
+      static ETL_CONSTANT uint64_t s1 = 0x8BB84B93962EACC9ULL;
+      static ETL_CONSTANT uint64_t s2 = 0x4B33A62ED433D4A3ULL;
+      static ETL_CONSTANT uint64_t s3 = 0x4D5A2DA51DE1AA47ULL;
+    };
+
+    template <typename T>
+    ETL_CONSTANT uint64_t secret<T>::s0;
+
+    template <typename T>
+    ETL_CONSTANT uint64_t secret<T>::s1;
+
+    template <typename T>
+    ETL_CONSTANT uint64_t secret<T>::s2;
+
+    template <typename T>
+    ETL_CONSTANT uint64_t secret<T>::s3;
+
+    //*************************************************************************
+    /// The 128 bit product of a and b; a receives the low half, b the high.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline void mum(uint64_t& a, uint64_t& b)
+    {
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t r = uint128_t(a) * b;
+
+      a = uint64_t(r);
+      b = uint64_t(r >> 64U);
+#else
+      const uint64_t ha = a >> 32U;
+      const uint64_t hb = b >> 32U;
+      const uint64_t la = a & 0xFFFFFFFFUL;
+      const uint64_t lb = b & 0xFFFFFFFFUL;
+
+      const uint64_t rh  = ha * hb;
+      const uint64_t rm0 = ha * lb;
+      const uint64_t rm1 = hb * la;
+      const uint64_t rl  = la * lb;
+
+      const uint64_t t  = rl + (rm0 << 32U);
+      uint64_t       c  = (t < rl) ? 1U : 0U;
+      const uint64_t lo = t + (rm1 << 32U);
+      c += (lo < t) ? 1U : 0U;
+
+      a = lo;
+      b = rh + (rm0 >> 32U) + (rm1 >> 32U) + c;
+#endif
+    }
+
+    //*************************************************************************
+    /// Multiplies and folds.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      mum(a, b);
+
+      return a ^ b;
+    }
+
+    //*************************************************************************
+    /// Little endian reads, whatever the alignment or the byte order of the target.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14 uint64_t read_64(TPointer p)
+    {
+      uint64_t value = 0U;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        value |= uint64_t(uint8_t(p[i])) << (8U * i);
+      }
+
+      return value;
+    }
+
+    template <typename TPointer>
+    ETL_CONSTEXPR14 uint64_t read_32(TPointer p)
+    {
+      uint64_t value = 0U;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        value |= uint64_t(uint8_t(p[i])) << (8U * i);
+      }
+
+      return value;
+    }
+
+    template <typename TPointer>
+    ETL_CONSTEXPR14 uint64_t read_3(TPointer p, size_t length)
+    {
+      return (uint64_t(uint8_t(p[0])) << 16U) | (uint64_t(uint8_t(p[length >> 1U])) << 8U) | uint64_t(uint8_t(p[length - 1U]));
+    }
+
+    //*************************************************************************
+    /// The seed as modified before the data is added.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t initial_seed(uint64_t seed)
+    {
+      return seed ^ mix(seed ^ secret<>::s0, secret<>::s1);
+    }
+
+    //*************************************************************************
+    /// Adds a 48 byte block to the three lanes.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14 void add_48(TPointer p, uint64_t& seed, uint64_t& see1, uint64_t& see2)
+    {
+      seed = mix(read_64(p)      ^ secret<>::s1, read_64(p + 8U)  ^ seed);
+      see1 = mix(read_64(p + 16U) ^ secret<>::s2, read_64(p + 24U) ^ see1);
+      see2 = mix(read_64(p + 32U) ^ secret<>::s3, read_64(p + 40U) ^ see2);
+    }
+
+    //*************************************************************************
+    /// Adds a 16 byte block.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14 uint64_t add_16(TPointer p, uint64_t seed)
+    {
+      return mix(read_64(p) ^ secret<>::s1, read_64(p + 8U) ^ seed);
+    }
+
+    //*************************************************************************
+    /// Combines the final two words with the seed and length.
+    //*************************************************************************
+    ETL_CONSTEXPR14 inline uint64_t finish(uint64_t a, uint64_t b, uint64_t seed, size_t length)
+    {
+      a ^= secret<>::s1;
+      b ^= seed;
+      mum(a, b);
+
+      return mix(a ^ secret<>::s0 ^ length, b ^ secret<>::s1);
+    }
+
+    //*************************************************************************
+    /// Hashes 16 bytes or fewer.
+    //*************************************************************************
+    template <typename TPointer>
+    ETL_CONSTEXPR14 uint64_t hash_short(TPointer p, size_t length, uint64_t seed)
+    {
+      uint64_t a = 0U;
+      uint64_t b = 0U;
+
+      if (length >= 4U)
+      {
+        const size_t offset = (length >> 3U) << 2U;
+
+        a = (read_32(p) << 32U) | read_32(p + offset);
+        b = (read_32(p + length - 4U) << 32U) | read_32(p + length - 4U - offset);
+      }
+      else if (length > 0U)
+      {
+        a = read_3(p, length);
+      }
+
+      return finish(a, b, seed, length);
+    }
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash (final version 4) of a contiguous block.
+  /// See https://github.com/wangyi-fudan/wyhash for more details.
+  /// Usable in constant expressions from C++14.
+  ///\param data   Pointer to the data. The elements must be one byte in size.
+  ///\param length The number of bytes.
+  ///\param seed   The seed value. Default = 0.
+  ///\ingroup wyhash
+  //***************************************************************************
+  template <typename TPointer>
+  ETL_CONSTEXPR14 uint64_t wyhash_64(TPointer data, size_t length, uint64_t seed = 0U)
+  {
+    ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TPointer>::value_type) == 1, "Incompatible type");
+
+    seed = private_wyhash::initial_seed(seed);
+
+    if (length <= 16U)
+    {
+      return private_wyhash::hash_short(data, length, seed);
+    }
+
+    size_t remaining = length;
+
+    if (remaining >= 48U)
+    {
+      uint64_t see1 = seed;
+      uint64_t see2 = seed;
+
+      do
+      {
+        private_wyhash::add_48(data, seed, see1, see2);
+        data      += 48U;
+        remaining -= 48U;
+      } while (remaining >= 48U);
+
+      seed ^= see1 ^ see2;
+    }
+
+    while (remaining > 16U)
+    {
+      seed       = private_wyhash::add_16(data, seed);
+      data      += 16U;
+      remaining -= 16U;
+    }
+
+    // The last 16 bytes, which may overlap those already added.
+    return private_wyhash::finish(private_wyhash::read_64(data + remaining - 16U),
+                                  private_wyhash::read_64(data + remaining - 8U),
+                                  seed,
+                                  length);
+  }
+
+  //***************************************************************************
+  /// Calculates the 64 bit wyhash, adding the data in any number of parts.
+  /// Gives the same result as etl::wyhash_64 over the whole of the data.
+  /// Has the same interface as the etl::frame_check_sequence based hashes.
+  ///\ingroup wyhash
+  //***************************************************************************
+  class wyhash
+  {
+  public:
+
+    typedef uint64_t value_type;
+    typedef private_frame_check_sequence::add_insert_iterator<wyhash> add_insert_iterator;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    wyhash(uint64_t seed_ = 0U)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    wyhash(TIterator begin, const TIterator end, uint64_t seed_ = 0U)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      lane0        = private_wyhash::initial_seed(seed);
+      lane1        = lane0;
+      lane2        = lane0;
+      length       = 0U;
+      buffer_count = 0U;
+      is_finalised = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename etl::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      // Contiguous ranges are read a whole block at a time.
+      add_range(begin, end, etl::integral_constant<bool, etl::is_pointer<TIterator>::value>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_byte(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      if (!is_finalised)
+      {
+        hash         = finalise();
+        is_finalised = true;
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+    //*************************************************************************
+    /// Gets an add_insert_iterator for input.
+    //*************************************************************************
+    add_insert_iterator input()
+    {
+      return add_insert_iterator(*this);
+    }
+
+  private:
+
+    static ETL_CONSTANT size_t Block_Size = 48U;
+    static ETL_CONSTANT size_t Tail_Size  = 16U;
+
+    //*************************************************************************
+    /// Adds a block, keeping its last bytes in case they are needed at the end.
+    //*************************************************************************
+    template <typename TPointer>
+    void add_block(TPointer p)
+    {
+      private_wyhash::add_48(p, lane0, lane1, lane2);
+
+      for (size_t i = 0U; i < Tail_Size; ++i)
+      {
+        tail[i] = uint8_t(p[Block_Size - Tail_Size + i]);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a byte to the buffer.
+    //*************************************************************************
+    void add_byte(uint8_t value_)
+    {
+      buffer[buffer_count] = value_;
+      ++length;
+
+      if (++buffer_count == Block_Size)
+      {
+        add_block(buffer);
+        buffer_count = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a range, one byte at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      // Complete any partly filled block.
+      while ((buffer_count != 0U) && (begin != end))
+      {
+        add_byte(uint8_t(*begin));
+        ++begin;
+      }
+
+      while (size_t(end - begin) >= Block_Size)
+      {
+        add_block(begin);
+        begin  += Block_Size;
+        length += Block_Size;
+      }
+
+      add_range(begin, end, etl::false_type());
+    }
+
+    //*************************************************************************
+    /// Calculates the hash from the state.
+    //*************************************************************************
+    uint64_t finalise() const
+    {
+      if (length <= Tail_Size)
+      {
+        return private_wyhash::hash_short(buffer, length, lane0);
+      }
+
+      uint64_t seed_ = lane0;
+
+      if (length >= Block_Size)
+      {
+        seed_ ^= lane1 ^ lane2;
+      }
+
+      const uint8_t* p         = buffer;
+      size_t         remaining = buffer_count;
+
+      while (remaining > Tail_Size)
+      {
+        seed_      = private_wyhash::add_16(p, seed_);
+        p         += Tail_Size;
+        remaining -= Tail_Size;
+      }
+
+      // The last 16 bytes, some of which may be from the last block.
+      if (buffer_count >= Tail_Size)
+      {
+        const uint8_t* last = buffer + buffer_count - Tail_Size;
+
+        return private_wyhash::finish(private_wyhash::read_64(last), private_wyhash::read_64(last + 8U), seed_, length);
+      }
+
+      uint8_t last[Tail_Size];
+      const size_t from_tail = Tail_Size - buffer_count;
+
+      for (size_t i = 0U; i < from_tail; ++i)
+      {
+        last[i] = tail[buffer_count + i];
+      }
+
+      for (size_t i = 0U; i < buffer_count; ++i)
+      {
+        last[from_tail + i] = buffer[i];
+      }
+
+      return private_wyhash::finish(private_wyhash::read_64(last), private_wyhash::read_64(last + 8U), seed_, length);
+    }
+
+    uint64_t seed;
+    uint64_t lane0;
+    uint64_t lane1;
+    uint64_t lane2;
+    uint64_t hash;
+    size_t   length;
+    size_t   buffer_count;
+    bool     is_finalised;
+    uint8_t  buffer[Block_Size];
+    uint8_t  tail[Tail_Size];
+  };
+}
+
+#endif
+
+#endif
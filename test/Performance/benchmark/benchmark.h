@@ -0,0 +1,124 @@
+// benchmark.h : A small benchmark harness with the interface of Google Benchmark.
+//
+// Only the parts used by the ETL benchmarks are provided:
+//   BENCHMARK(function), BENCHMARK_TEMPLATE(function, type),
+//   'for (auto _ : state)', state.iterations(), state.SetItemsProcessed(),
+//   state.SetBytesProcessed(), benchmark::DoNotOptimize() and benchmark::ClobberMemory().
+//
+// The benchmarks are timed and run by etl/microbenchmark.h.
+// If ETL_BENCHMARK_USE_GOOGLE is defined then Google Benchmark itself is used.
+
+#ifndef ETL_BENCHMARK_H_INCLUDED
+#define ETL_BENCHMARK_H_INCLUDED
+
+#if defined(ETL_BENCHMARK_USE_GOOGLE)
+
+#include <benchmark/benchmark.h>
+
+#else
+
+#include "etl/microbenchmark.h"
+
+#include <stdint.h>
+#include <stddef.h>
+
+namespace benchmark
+{
+  //***************************************************************************
+  /// The Google Benchmark interface to etl::benchmark_state.
+  //***************************************************************************
+  class State
+  {
+  public:
+
+    typedef etl::benchmark_state::iterator iterator;
+
+    explicit State(etl::benchmark_state& state_)
+      : state(state_)
+    {
+    }
+
+    iterator begin()
+    {
+      return state.begin();
+    }
+
+    iterator end()
+    {
+      return state.end();
+    }
+
+    int64_t iterations() const
+    {
+      return int64_t(state.iterations());
+    }
+
+    void SetItemsProcessed(int64_t items)
+    {
+      state.set_items_processed(uint64_t(items));
+    }
+
+    void SetBytesProcessed(int64_t bytes)
+    {
+      state.set_bytes_processed(uint64_t(bytes));
+    }
+
+  private:
+
+    etl::benchmark_state& state;
+  };
+
+  //***************************************************************************
+  /// Stops the compiler from discarding a value.
+  //***************************************************************************
+  template <typename T>
+  inline void DoNotOptimize(T& value)
+  {
+    etl::benchmark_do_not_optimize(value);
+  }
+
+  template <typename T>
+  inline void DoNotOptimize(const T& value)
+  {
+    etl::benchmark_do_not_optimize(value);
+  }
+
+  //***************************************************************************
+  /// Forces pending writes to memory.
+  //***************************************************************************
+  inline void ClobberMemory()
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+  }
+
+  //***************************************************************************
+  /// Calls a benchmark written for benchmark::State.
+  //***************************************************************************
+  template <void (*Function)(State&)>
+  void invoke(etl::benchmark_state& etl_state)
+  {
+    State state(etl_state);
+    Function(state);
+  }
+
+  //***************************************************************************
+  /// Runs the benchmarks selected by the command line.
+  ///   --benchmark_filter=<text>    Only run benchmarks whose names contain the text.
+  ///   --benchmark_min_time=<secs>  The least time to run each benchmark for.
+  //***************************************************************************
+  int RunBenchmarks(int argc, char* argv[]);
+}
+
+// The benchmarks are registered with etl/microbenchmark.h, so that the same
+// registrations can be run on a target by etl::run_benchmarks.
+#define BENCHMARK(function) \
+  static ::etl::benchmark_registration ETL_BENCHMARK_CONCAT(benchmark_registration_, __LINE__)(#function, &::benchmark::invoke<function>)
+
+#define BENCHMARK_TEMPLATE(function, ...) \
+  static ::etl::benchmark_registration ETL_BENCHMARK_CONCAT(benchmark_registration_, __LINE__)(#function "<" #__VA_ARGS__ ">", &::benchmark::invoke<function<__VA_ARGS__> >)
+
+#endif
+
+#endif
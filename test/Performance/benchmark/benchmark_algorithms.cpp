@@ -0,0 +1,143 @@
+// benchmark_algorithms.cpp : ETL algorithms, CRCs and conversions against std equivalents.
+
+#include "benchmark.h"
+
+#include "etl/algorithm.h"
+#include "etl/crc32.h"
+#include "etl/string.h"
+#include "etl/to_string.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+  const size_t Size      = 1000U;
+  const size_t Crc_Bytes = 4096U;
+
+  //***************************************************************************
+  std::vector<int> make_unsorted()
+  {
+    std::vector<int> data(Size);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      data[i] = int((i * 7919U) % Size);
+    }
+
+    return data;
+  }
+
+  //***************************************************************************
+  struct EtlSort
+  {
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last) const
+    {
+      etl::sort(first, last);
+    }
+  };
+
+  struct EtlStableSort
+  {
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last) const
+    {
+      etl::stable_sort(first, last);
+    }
+  };
+
+  struct StdSort
+  {
+    template <typename TIterator>
+    void operator ()(TIterator first, TIterator last) const
+    {
+      std::sort(first, last);
+    }
+  };
+
+  //***************************************************************************
+  /// Each iteration sorts a fresh copy, so the copy is included in the time.
+  //***************************************************************************
+  template <typename TSort>
+  void sort(benchmark::State& state)
+  {
+    const std::vector<int> unsorted = make_unsorted();
+    std::vector<int>       data(Size);
+    TSort                  sorter;
+
+    for (auto _ : state)
+    {
+      std::copy(unsorted.begin(), unsorted.end(), data.begin());
+      sorter(data.begin(), data.end());
+      benchmark::DoNotOptimize(data.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TCrc>
+  void crc(benchmark::State& state)
+  {
+    std::vector<uint8_t> data(Crc_Bytes);
+
+    for (size_t i = 0U; i < Crc_Bytes; ++i)
+    {
+      data[i] = uint8_t((i * 151U) + 7U);
+    }
+
+    for (auto _ : state)
+    {
+      uint32_t value = TCrc(data.data(), data.data() + data.size()).value();
+      benchmark::DoNotOptimize(value);
+    }
+
+    state.SetBytesProcessed(state.iterations() * int64_t(Crc_Bytes));
+  }
+
+  //***************************************************************************
+  void to_string_etl(benchmark::State& state)
+  {
+    etl::string<32> text;
+
+    for (auto _ : state)
+    {
+      for (int i = 0; i < int(Size); ++i)
+      {
+        etl::to_string((i * 7919) - 500000, text);
+        benchmark::DoNotOptimize(text.data());
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  void to_string_std(benchmark::State& state)
+  {
+    for (auto _ : state)
+    {
+      for (int i = 0; i < int(Size); ++i)
+      {
+        std::string text = std::to_string((i * 7919) - 500000);
+        benchmark::DoNotOptimize(text.data());
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+}
+
+BENCHMARK_TEMPLATE(sort, EtlSort);
+BENCHMARK_TEMPLATE(sort, EtlStableSort);
+BENCHMARK_TEMPLATE(sort, StdSort);
+BENCHMARK_TEMPLATE(crc, etl::crc32_t4);
+BENCHMARK_TEMPLATE(crc, etl::crc32_t16);
+BENCHMARK_TEMPLATE(crc, etl::crc32_t256);
+BENCHMARK_TEMPLATE(crc, etl::crc32_slice_by_8);
+BENCHMARK_TEMPLATE(crc, etl::crc32_slice_by_16);
+BENCHMARK_TEMPLATE(crc, etl::crc32_accelerated);
+BENCHMARK(to_string_etl);
+BENCHMARK(to_string_std);
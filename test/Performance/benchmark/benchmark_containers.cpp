@@ -0,0 +1,206 @@
+// benchmark_containers.cpp : ETL containers against their std equivalents.
+
+#include "benchmark.h"
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/map.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+
+#include <vector>
+#include <deque>
+#include <map>
+#include <unordered_map>
+
+namespace
+{
+  const size_t Size = 1000U;
+
+  //***************************************************************************
+  /// The keys in a scrambled order. 7919 is prime, so every key appears once.
+  //***************************************************************************
+  int key(size_t i)
+  {
+    return int((i * 7919U) % Size);
+  }
+
+  //***************************************************************************
+  // The std containers reserve where they can, so the comparison is not of
+  // heap allocation alone.
+  template <typename T>
+  void reserve(T&)
+  {
+  }
+
+  template <typename T>
+  void reserve(std::vector<T>& container)
+  {
+    container.reserve(Size);
+  }
+
+  template <typename TKey, typename TMapped>
+  void reserve(std::unordered_map<TKey, TMapped>& container)
+  {
+    container.reserve(Size);
+  }
+
+  //***************************************************************************
+  template <typename TVector>
+  void vector_push_back(benchmark::State& state)
+  {
+    TVector container;
+    reserve(container);
+
+    for (auto _ : state)
+    {
+      container.clear();
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        container.push_back(int(i));
+      }
+
+      benchmark::DoNotOptimize(container.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TVector>
+  void vector_iterate(benchmark::State& state)
+  {
+    TVector container;
+    reserve(container);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      container.push_back(key(i));
+    }
+
+    for (auto _ : state)
+    {
+      int sum = 0;
+
+      for (typename TVector::const_iterator itr = container.begin(); itr != container.end(); ++itr)
+      {
+        sum += *itr;
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TDeque>
+  void deque_push_back_pop_front(benchmark::State& state)
+  {
+    TDeque container;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        container.push_back(int(i));
+      }
+
+      int sum = 0;
+
+      while (!container.empty())
+      {
+        sum += container.front();
+        container.pop_front();
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void map_insert_find(benchmark::State& state)
+  {
+    TMap container;
+    reserve(container);
+
+    for (auto _ : state)
+    {
+      container.clear();
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        container.insert(typename TMap::value_type(key(i), int(i)));
+      }
+
+      int sum = 0;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        sum += container.find(int(i))->second;
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TMap>
+  void map_find(benchmark::State& state)
+  {
+    TMap container;
+    reserve(container);
+
+    for (size_t i = 0U; i < Size; ++i)
+    {
+      container.insert(typename TMap::value_type(key(i), int(i)));
+    }
+
+    for (auto _ : state)
+    {
+      int sum = 0;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        sum += container.find(key(i))->second;
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  typedef etl::vector<int, Size>                   EtlVector;
+  typedef std::vector<int>                         StdVector;
+  typedef etl::deque<int, Size>                    EtlDeque;
+  typedef std::deque<int>                          StdDeque;
+  typedef etl::map<int, int, Size>                 EtlMap;
+  typedef etl::flat_map<int, int, Size>            EtlFlatMap;
+  typedef std::map<int, int>                       StdMap;
+  typedef etl::unordered_map<int, int, Size, Size> EtlUnorderedMap;
+  typedef std::unordered_map<int, int>             StdUnorderedMap;
+}
+
+BENCHMARK_TEMPLATE(vector_push_back, EtlVector);
+BENCHMARK_TEMPLATE(vector_push_back, StdVector);
+BENCHMARK_TEMPLATE(vector_iterate, EtlVector);
+BENCHMARK_TEMPLATE(vector_iterate, StdVector);
+BENCHMARK_TEMPLATE(deque_push_back_pop_front, EtlDeque);
+BENCHMARK_TEMPLATE(deque_push_back_pop_front, StdDeque);
+BENCHMARK_TEMPLATE(map_insert_find, EtlMap);
+BENCHMARK_TEMPLATE(map_insert_find, EtlFlatMap);
+BENCHMARK_TEMPLATE(map_insert_find, StdMap);
+BENCHMARK_TEMPLATE(map_insert_find, EtlUnorderedMap);
+BENCHMARK_TEMPLATE(map_insert_find, StdUnorderedMap);
+BENCHMARK_TEMPLATE(map_find, EtlMap);
+BENCHMARK_TEMPLATE(map_find, EtlFlatMap);
+BENCHMARK_TEMPLATE(map_find, StdMap);
+BENCHMARK_TEMPLATE(map_find, EtlUnorderedMap);
+BENCHMARK_TEMPLATE(map_find, StdUnorderedMap);
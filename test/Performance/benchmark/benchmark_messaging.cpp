@@ -0,0 +1,133 @@
+// benchmark_messaging.cpp : etl::message_router dispatch against a virtual function baseline.
+
+#include "benchmark.h"
+
+#include "etl/message.h"
+#include "etl/message_router.h"
+
+namespace
+{
+  const size_t Messages = 1000U;
+
+  enum
+  {
+    Message1_Id,
+    Message2_Id,
+    Message3_Id,
+    Message4_Id
+  };
+
+  struct Message1 : public etl::message<Message1_Id> { int value; };
+  struct Message2 : public etl::message<Message2_Id> { int value; };
+  struct Message3 : public etl::message<Message3_Id> { int value; };
+  struct Message4 : public etl::message<Message4_Id> { int value; };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3, Message4>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+      , total(0)
+    {
+    }
+
+    void on_receive(const Message1& msg) { total += msg.value; }
+    void on_receive(const Message2& msg) { total -= msg.value; }
+    void on_receive(const Message3& msg) { total ^= msg.value; }
+    void on_receive(const Message4& msg) { total += 2 * msg.value; }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int total;
+  };
+
+  //***************************************************************************
+  /// The baseline is a hand written interface with a virtual function per message.
+  //***************************************************************************
+  struct IHandler
+  {
+    virtual ~IHandler() {}
+    virtual void handle1(const Message1& msg) = 0;
+    virtual void handle2(const Message2& msg) = 0;
+    virtual void handle3(const Message3& msg) = 0;
+    virtual void handle4(const Message4& msg) = 0;
+  };
+
+  struct Handler : public IHandler
+  {
+    Handler()
+      : total(0)
+    {
+    }
+
+    void handle1(const Message1& msg) override { total += msg.value; }
+    void handle2(const Message2& msg) override { total -= msg.value; }
+    void handle3(const Message3& msg) override { total ^= msg.value; }
+    void handle4(const Message4& msg) override { total += 2 * msg.value; }
+
+    int total;
+  };
+
+  //***************************************************************************
+  void message_router_receive(benchmark::State& state)
+  {
+    Message1 m1; m1.value = 1;
+    Message2 m2; m2.value = 2;
+    Message3 m3; m3.value = 3;
+    Message4 m4; m4.value = 4;
+
+    const etl::imessage* messages[] = { &m1, &m2, &m3, &m4 };
+
+    Router router;
+    etl::imessage_router& irouter = router;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Messages; ++i)
+      {
+        irouter.receive(*messages[i % 4U]);
+      }
+
+      benchmark::DoNotOptimize(router.total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Messages));
+  }
+
+  //***************************************************************************
+  void virtual_call_baseline(benchmark::State& state)
+  {
+    Message1 m1; m1.value = 1;
+    Message2 m2; m2.value = 2;
+    Message3 m3; m3.value = 3;
+    Message4 m4; m4.value = 4;
+
+    Handler   handler;
+    IHandler& ihandler = handler;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Messages; ++i)
+      {
+        switch (i % 4U)
+        {
+          case 0:  ihandler.handle1(m1); break;
+          case 1:  ihandler.handle2(m2); break;
+          case 2:  ihandler.handle3(m3); break;
+          default: ihandler.handle4(m4); break;
+        }
+      }
+
+      benchmark::DoNotOptimize(handler.total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Messages));
+  }
+}
+
+BENCHMARK(message_router_receive);
+BENCHMARK(virtual_call_baseline);
@@ -0,0 +1,141 @@
+// benchmark_queues.cpp : ETL queues against their std equivalents.
+// The lock free queues are driven from one thread, which measures the cost of
+// their operations rather than of any contention.
+
+#include "benchmark.h"
+
+#include "etl/queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/circular_buffer.h"
+#include "etl/priority_queue.h"
+
+#include <queue>
+
+namespace
+{
+  const size_t Size = 1000U;
+
+  //***************************************************************************
+  template <typename TQueue>
+  void queue_push_pop(benchmark::State& state)
+  {
+    TQueue queue;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        queue.emplace(int(i));
+      }
+
+      int sum = 0;
+
+      while (!queue.empty())
+      {
+        sum += queue.front();
+        queue.pop();
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void queue_spsc_push_pop(benchmark::State& state)
+  {
+    TQueue queue;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        queue.push(int(i));
+      }
+
+      int sum = 0;
+      int value;
+
+      while (queue.pop(value))
+      {
+        sum += value;
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TBuffer>
+  void circular_buffer_push_pop(benchmark::State& state)
+  {
+    TBuffer buffer;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        buffer.push_back(int(i));
+      }
+
+      int sum = 0;
+
+      while (!buffer.empty())
+      {
+        sum += buffer.front();
+        buffer.pop();
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void priority_queue_push_pop(benchmark::State& state)
+  {
+    TQueue queue;
+
+    for (auto _ : state)
+    {
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        queue.emplace(int((i * 7919U) % Size));
+      }
+
+      int sum = 0;
+
+      while (!queue.empty())
+      {
+        sum += queue.top();
+        queue.pop();
+      }
+
+      benchmark::DoNotOptimize(sum);
+    }
+
+    state.SetItemsProcessed(state.iterations() * int64_t(Size));
+  }
+
+  typedef etl::queue<int, Size>                                      EtlQueue;
+  typedef std::queue<int>                                            StdQueue;
+  typedef etl::queue_spsc_atomic<int, Size>                          EtlQueueSpscAtomic;
+  typedef etl::circular_buffer<int, Size>                            EtlCircularBuffer;
+  typedef etl::priority_queue<int, Size>                             EtlPriorityQueue;
+  typedef etl::priority_queue<int, Size, etl::vector<int, Size>, etl::less<int>, 4U> EtlPriorityQueue4Ary;
+  typedef std::priority_queue<int>                                   StdPriorityQueue;
+}
+
+BENCHMARK_TEMPLATE(queue_push_pop, EtlQueue);
+BENCHMARK_TEMPLATE(queue_push_pop, StdQueue);
+BENCHMARK_TEMPLATE(queue_spsc_push_pop, EtlQueueSpscAtomic);
+BENCHMARK_TEMPLATE(circular_buffer_push_pop, EtlCircularBuffer);
+BENCHMARK_TEMPLATE(priority_queue_push_pop, EtlPriorityQueue);
+BENCHMARK_TEMPLATE(priority_queue_push_pop, EtlPriorityQueue4Ary);
+BENCHMARK_TEMPLATE(priority_queue_push_pop, StdPriorityQueue);
@@ -0,0 +1,10 @@
+// etl_profile.h : The profile for the benchmarks.
+// Checks are left at their defaults, so that the timings match a release build.
+
+#ifndef ETL_PROFILE_H_INCLUDED
+#define ETL_PROFILE_H_INCLUDED
+
+// Time in nanoseconds, so that --benchmark_min_time can be converted to ticks.
+#define ETL_CYCLE_COUNTER_USE_CLOCK_GETTIME
+
+#endif
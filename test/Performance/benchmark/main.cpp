@@ -0,0 +1,94 @@
+// main.cpp : Runs the ETL benchmarks.
+//
+// Build with CMake, from the root of the repository:
+//   cmake -S . -B build -DBUILD_BENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build --target etl_benchmarks
+//   build/test/Performance/benchmark/etl_benchmarks --benchmark_filter=vector
+//
+// or with meson:
+//   meson setup build -Dbenchmarks=true --buildtype=release
+//   meson compile -C build etl_benchmarks
+
+#include "benchmark.h"
+
+#if defined(ETL_BENCHMARK_USE_GOOGLE)
+
+BENCHMARK_MAIN();
+
+#else
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace benchmark
+{
+  namespace
+  {
+    //*************************************************************************
+    /// Prints one result.
+    //*************************************************************************
+    void print_result(const etl::benchmark_result& result)
+    {
+      // The profile selects clock_gettime, so the ticks are nanoseconds.
+      const double seconds = double(result.ticks) / 1e9;
+      const double ns      = double(result.ticks) / double(result.iterations);
+
+      printf("%-60s %12.1f %-5s %12lu", result.name, ns, result.units, static_cast<unsigned long>(result.iterations));
+
+      if ((result.items_processed != 0U) && (seconds > 0.0))
+      {
+        printf(" %10.2fM items/s", (double(result.items_processed) / seconds) / 1e6);
+      }
+
+      if ((result.bytes_processed != 0U) && (seconds > 0.0))
+      {
+        printf(" %10.1fMB/s", (double(result.bytes_processed) / seconds) / (1024.0 * 1024.0));
+      }
+
+      printf("\n");
+    }
+  }
+
+  //***************************************************************************
+  int RunBenchmarks(int argc, char* argv[])
+  {
+    const char* filter   = NULL;
+    double      min_time = 0.2;
+
+    for (int i = 1; i < argc; ++i)
+    {
+      if (strncmp(argv[i], "--benchmark_filter=", 19) == 0)
+      {
+        filter = argv[i] + 19;
+      }
+      else if (strncmp(argv[i], "--benchmark_min_time=", 21) == 0)
+      {
+        min_time = atof(argv[i] + 21);
+      }
+      else
+      {
+        fprintf(stderr, "Unknown argument '%s'\n", argv[i]);
+        return 1;
+      }
+    }
+
+    if ((filter != NULL) && (*filter == '\0'))
+    {
+      filter = NULL;
+    }
+
+    printf("%-60s %18s %12s\n", "Benchmark", "Time", "Iterations");
+
+    etl::run_benchmarks(etl::benchmark_sink::create<print_result>(), filter, static_cast<uint64_t>(min_time * 1e9));
+
+    return 0;
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  return benchmark::RunBenchmarks(argc, argv);
+}
+
+#endif
@@ -0,0 +1,44 @@
+#!/bin/sh
+#******************************************************************************
+# Compile time benchmark for message_packet and message_router.
+# Compiles messaging.cpp with the variadic C++17 implementation and with the
+# generated C++03 expansions, and reports the wall time and the number of
+# preprocessed lines for each.
+#
+# Usage: ./compile_time.sh [compiler] [repetitions]
+#******************************************************************************
+
+compiler=${1:-g++}
+repetitions=${2:-5}
+include="-I../../../include"
+legacy="-DETL_MESSAGE_PACKET_FORCE_CPP03_IMPLEMENTATION -DETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION"
+
+now_ms()
+{
+  echo $(( $(date +%s%N) / 1000000 ))
+}
+
+Benchmark()
+{
+  name=$1
+  shift
+
+  lines=$($compiler "$@" $include -E messaging.cpp | wc -l)
+
+  start=$(now_ms)
+  i=0
+  while [ $i -lt $repetitions ]; do
+    $compiler "$@" $include -c messaging.cpp -o /dev/null || exit 1
+    i=$((i + 1))
+  done
+  end=$(now_ms)
+
+  echo "$name : $(( (end - start) / repetitions )) ms, $lines preprocessed lines"
+}
+
+cd "$(dirname "$0")" || exit 1
+
+Benchmark "C++11 generated  " -std=c++11
+Benchmark "C++17 generated  " -std=c++17 $legacy
+Benchmark "C++17 variadic   " -std=c++17
+Benchmark "C++20 variadic   " -std=c++20
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Compile time benchmark for message_packet and message_router.
+// Instantiates a packet and a router for 16 message types, which is the
+// largest case that the generated C++03 expansions cover.
+// See compile_time.sh.
+//*****************************************************************************
+
+#include "etl/message_packet.h"
+#include "etl/message_router.h"
+
+#define MESSAGE(n) struct Message##n : public etl::message<n> { int value; };
+
+MESSAGE(1)  MESSAGE(2)  MESSAGE(3)  MESSAGE(4)
+MESSAGE(5)  MESSAGE(6)  MESSAGE(7)  MESSAGE(8)
+MESSAGE(9)  MESSAGE(10) MESSAGE(11) MESSAGE(12)
+MESSAGE(13) MESSAGE(14) MESSAGE(15) MESSAGE(16)
+
+typedef etl::message_packet<Message1,  Message2,  Message3,  Message4,
+                            Message5,  Message6,  Message7,  Message8,
+                            Message9,  Message10, Message11, Message12,
+                            Message13, Message14, Message15, Message16> Packet;
+
+//*****************************************************************************
+struct Router : public etl::message_router<Router, Message1,  Message2,  Message3,  Message4,
+                                                   Message5,  Message6,  Message7,  Message8,
+                                                   Message9,  Message10, Message11, Message12,
+                                                   Message13, Message14, Message15, Message16>
+{
+  Router()
+    : message_router(1U)
+    , count(0)
+  {
+  }
+
+  template <typename TMessage>
+  void on_receive(const TMessage& msg)
+  {
+    count += msg.value;
+  }
+
+  void on_receive_unknown(const etl::imessage&)
+  {
+  }
+
+  int count;
+};
+
+//*****************************************************************************
+int main()
+{
+  Router router;
+
+  Message5 message5;
+  message5.value = 5;
+
+  Packet packet(message5);
+  Packet copy(packet);
+
+  router.receive(message5);
+  router.receive(copy.get());
+
+  return (router.accepts(5U) && Packet::accepts(5U)) ? 0 : 1;
+}
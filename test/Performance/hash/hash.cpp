@@ -0,0 +1,147 @@
+// hash.cpp : Compares the FNV-1a and word at a time hashes used by etl::hash.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include -I../.. hash.cpp -o hash
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <string>
+
+#include "etl/hash.h"
+#include "etl/fnv_1.h"
+#include "etl/string.h"
+#include "etl/unordered_set.h"
+
+typedef etl::string<256> Key;
+
+const size_t NKEYS      = 1000UL;
+const size_t ITERATIONS = 1000UL;
+
+volatile size_t sink;
+
+//*****************************************************************************
+struct Fnv1aHash
+{
+  size_t operator ()(const Key& key) const
+  {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(key.data());
+
+#if ETL_USING_64BIT_TYPES
+    return size_t(uint64_t(etl::fnv_1a_64(begin, begin + key.size())));
+#else
+    return size_t(uint32_t(etl::fnv_1a_32(begin, begin + key.size())));
+#endif
+  }
+};
+
+//*****************************************************************************
+struct WordHash
+{
+  size_t operator ()(const Key& key) const
+  {
+    const uint8_t* begin = reinterpret_cast<const uint8_t*>(key.data());
+
+#if ETL_USING_64BIT_TYPES
+    return size_t(etl::private_hash::word_hash_64(begin, begin + key.size()));
+#else
+    return size_t(etl::private_hash::word_hash_32(begin, begin + key.size()));
+#endif
+  }
+};
+
+//*****************************************************************************
+std::vector<Key> make_keys(size_t length)
+{
+  std::vector<Key> keys;
+
+  for (size_t i = 0UL; i < NKEYS; ++i)
+  {
+    Key key;
+
+    for (size_t j = 0UL; j < length; ++j)
+    {
+      key.push_back(char('a' + ((i * 7919UL + j * 31UL + (i >> (j % 8UL))) % 26UL)));
+    }
+
+    keys.push_back(key);
+  }
+
+  return keys;
+}
+
+//*****************************************************************************
+template <typename THash>
+double time_hash(const std::vector<Key>& keys)
+{
+  THash hasher;
+  size_t total = 0UL;
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < ITERATIONS; ++i)
+  {
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      total += hasher(keys[j]);
+    }
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  sink = total;
+
+  return std::chrono::duration<double, std::nano>(end - begin).count() / double(ITERATIONS * keys.size());
+}
+
+//*****************************************************************************
+template <typename THash>
+double time_unordered_set(const std::vector<Key>& keys)
+{
+  typedef etl::unordered_set<Key, NKEYS, NKEYS, THash> Set;
+
+  static Set set;
+  size_t found = 0UL;
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < (ITERATIONS / 10UL); ++i)
+  {
+    set.clear();
+
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      set.insert(keys[j]);
+    }
+
+    for (size_t j = 0UL; j < keys.size(); ++j)
+    {
+      found += set.count(keys[j]);
+    }
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  sink = found;
+
+  return std::chrono::duration<double, std::nano>(end - begin).count() / double((ITERATIONS / 10UL) * keys.size());
+}
+
+//*****************************************************************************
+int main()
+{
+  const size_t lengths[] = { 8UL, 32UL, 256UL };
+
+  for (size_t i = 0UL; i < (sizeof(lengths) / sizeof(lengths[0])); ++i)
+  {
+    std::vector<Key> keys = make_keys(lengths[i]);
+
+    std::cout << lengths[i] << " byte keys\n";
+    std::cout << "  FNV-1a hash          = " << time_hash<Fnv1aHash>(keys) << "ns/key\n";
+    std::cout << "  Word hash            = " << time_hash<WordHash>(keys) << "ns/key\n";
+    std::cout << "  FNV-1a unordered_set = " << time_unordered_set<Fnv1aHash>(keys) << "ns/key\n";
+    std::cout << "  Word unordered_set   = " << time_unordered_set<WordHash>(keys) << "ns/key\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+// inplace_function.cpp : Compares the cost of creating and calling an
+// etl::inplace_function, an etl::delegate and a std::function that hold a
+// capturing lambda.
+//
+// Build with, for example:
+//   g++ -O2 -std=c++17 -I../../../include -I../.. inplace_function.cpp -o inplace_function
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "etl/inplace_function.h"
+#include "etl/delegate.h"
+
+const size_t NFUNCTIONS = 1000UL;
+const size_t ITERATIONS = 10000UL;
+
+volatile int sink;
+
+//*****************************************************************************
+// A lambda that captures enough state to exceed the small buffer of most
+// std::function implementations.
+//*****************************************************************************
+struct Captures
+{
+  int a;
+  int b;
+  int c;
+  int d;
+  int e;
+  int f;
+};
+
+auto make_lambda(size_t i)
+{
+  const Captures captures = { int(i), int(i + 1), int(i + 2), int(i + 3), int(i + 4), int(i + 5) };
+
+  return [captures](int x) { return (x * captures.a) + captures.b + captures.c + captures.d + captures.e + captures.f; };
+}
+
+typedef decltype(make_lambda(0)) Lambda;
+
+//*****************************************************************************
+template <typename TFunction>
+double time_create(std::vector<TFunction>& functions)
+{
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < (ITERATIONS / 10UL); ++i)
+  {
+    functions.clear();
+
+    for (size_t j = 0UL; j < NFUNCTIONS; ++j)
+    {
+      functions.push_back(TFunction(make_lambda(j)));
+    }
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double, std::nano>(end - begin).count() / double((ITERATIONS / 10UL) * NFUNCTIONS);
+}
+
+//*****************************************************************************
+template <typename TFunction>
+double time_call(const std::vector<TFunction>& functions)
+{
+  int total = 0;
+
+  std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+
+  for (size_t i = 0UL; i < ITERATIONS; ++i)
+  {
+    for (size_t j = 0UL; j < functions.size(); ++j)
+    {
+      total += functions[j](int(i));
+    }
+  }
+
+  std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+  sink = total;
+
+  return std::chrono::duration<double, std::nano>(end - begin).count() / double(ITERATIONS * functions.size());
+}
+
+//*****************************************************************************
+int main()
+{
+  typedef etl::inplace_function<int(int), sizeof(Lambda)> Inplace;
+  typedef etl::delegate<int(int)>                         Delegate;
+  typedef std::function<int(int)>                         Function;
+
+  std::vector<Inplace>  inplace_functions;
+  std::vector<Function> std_functions;
+  std::vector<Delegate> delegates;
+
+  inplace_functions.reserve(NFUNCTIONS);
+  std_functions.reserve(NFUNCTIONS);
+  delegates.reserve(NFUNCTIONS);
+
+  std::cout << "Create (lambda of " << sizeof(Lambda) << " bytes)\n";
+  std::cout << "  etl::inplace_function = " << time_create(inplace_functions) << "ns\n";
+  std::cout << "  std::function         = " << time_create(std_functions) << "ns\n";
+
+  // A delegate does not own the lambda, so the lambdas must be kept elsewhere.
+  std::vector<Lambda> lambdas;
+  lambdas.reserve(NFUNCTIONS);
+
+  for (size_t j = 0UL; j < NFUNCTIONS; ++j)
+  {
+    lambdas.push_back(make_lambda(j));
+    delegates.push_back(Delegate(lambdas.back()));
+  }
+
+  std::cout << "Call\n";
+  std::cout << "  etl::inplace_function = " << time_call(inplace_functions) << "ns\n";
+  std::cout << "  etl::delegate         = " << time_call(delegates) << "ns\n";
+  std::cout << "  std::function         = " << time_call(std_functions) << "ns\n";
+
+  return 0;
+}
@@ -169,6 +169,17 @@ int main()
     std::cout << "Return Count Failed\n";
   }
 
-  return (log_count_passed && return_count_passed) ? 0 : 1;
+  bool error_count_passed = (etl::error_count<test_exception_1>() == 6);
+
+  if (error_count_passed)
+  {
+    std::cout << "Error Count Passed\n";
+  }
+  else
+  {
+    std::cout << "Error Count Failed\n";
+  }
+
+  return (log_count_passed && return_count_passed && error_count_passed) ? 0 : 1;
 }
 
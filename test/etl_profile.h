@@ -41,6 +41,7 @@ SOFTWARE.
 #define ETL_IN_UNIT_TEST
 //#define ETL_DEBUG_COUNT
 #define ETL_ARRAY_VIEW_IS_MUTABLE
+#define ETL_MEMORY_STATISTICS
 
 #define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
 #define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
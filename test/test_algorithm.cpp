@@ -30,6 +30,9 @@ SOFTWARE.
 
 #include "etl/algorithm.h"
 #include "etl/container.h"
+#include "etl/span.h"
+#include "etl/vector.h"
+#include "etl/array.h"
 
 #include "data.h"
 #include "iterators_for_unit_tests.h"
@@ -43,6 +46,7 @@ SOFTWARE.
 #include <numeric>
 #include <random>
 #include <memory>
+#include <limits>
 
 namespace
 {
@@ -131,6 +135,61 @@ namespace
     return os;
   }
 
+  //***************************************************************************
+  // Checks the contiguous range algorithms against the reference algorithms
+  // for every length and offset up to a few vector widths.
+  //***************************************************************************
+  template <typename T>
+  bool check_contiguous_algorithms(int range)
+  {
+    std::mt19937 generator(static_cast<uint32_t>(sizeof(T) * 1000U + range));
+    std::uniform_int_distribution<int> distribution(-range, range);
+
+    std::vector<T> data(150);
+    std::vector<T> copy(150);
+
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      data[i] = static_cast<T>(distribution(generator));
+    }
+
+    for (size_t offset = 0U; offset < 4U; ++offset)
+    {
+      for (size_t length = 0U; (offset + length) <= data.size(); ++length)
+      {
+        const T* first = data.data() + offset;
+        const T* last  = first + length;
+        const T  value = static_cast<T>(distribution(generator));
+
+        if (etl::find(first, last, value) != std::find(first, last, value))                 return false;
+        if (etl::count(first, last, value) != std::count(first, last, value))               return false;
+        if (etl::equal(first, last, data.data() + offset) != true)                          return false;
+
+        if (length != 0U)
+        {
+          if (etl::min_element(first, last) != etl::min_element(first, last, etl::less<T>())) return false;
+
+          ETL_OR_STD::pair<const T*, const T*> result   = etl::minmax_element(first, last);
+          ETL_OR_STD::pair<const T*, const T*> expected = etl::minmax_element(first, last, etl::less<T>());
+
+          if ((result.first != expected.first) || (result.second != expected.second))       return false;
+
+          // Change one element of a copy and look for it.
+          std::copy(first, last, copy.begin());
+          size_t changed = static_cast<size_t>(distribution(generator) + range) % length;
+          copy[changed] = static_cast<T>(copy[changed] + 1);
+
+          if (etl::equal(first, last, copy.data()))                                         return false;
+          if (etl::equal(first, last, copy.data(), copy.data() + length))                   return false;
+          if (etl::mismatch(first, last, copy.data()).first != (first + changed))           return false;
+          if (etl::mismatch(first, last, copy.data(), copy.data() + changed).first != (first + changed)) return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_algorithm)
   {
     //*************************************************************************
@@ -820,6 +879,41 @@ namespace
       CHECK(isEqual);
     }
 
+    //*************************************************************************
+    TEST(d_ary_heap)
+    {
+      std::vector<int> data = { 5, 12, 3, 9, 1, 7, 15, 2, 8, 11, 4, 14, 6, 10, 13 };
+
+      etl::make_d_ary_heap<4>(data.begin(), data.end());
+      CHECK(etl::is_d_ary_heap<4>(data.begin(), data.end()));
+      CHECK_EQUAL(15, data.front());
+
+      etl::pop_d_ary_heap<4>(data.begin(), data.end());
+      CHECK_EQUAL(15, data.back());
+      data.pop_back();
+      CHECK(etl::is_d_ary_heap<4>(data.begin(), data.end()));
+      CHECK_EQUAL(14, data.front());
+
+      data.push_back(20);
+      etl::push_d_ary_heap<4>(data.begin(), data.end());
+      CHECK(etl::is_d_ary_heap<4>(data.begin(), data.end()));
+      CHECK_EQUAL(20, data.front());
+
+      etl::sort_d_ary_heap<4>(data.begin(), data.end());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+
+      // An arity of 2 gives the same layout as the binary heap.
+      std::vector<int> data1 = { 5, 12, 3, 9, 1, 7, 15, 2, 8, 11, 4, 14, 6, 10, 13 };
+      std::vector<int> data2 = data1;
+
+      etl::make_d_ary_heap<2>(data1.begin(), data1.end(), std::greater<int>());
+      etl::make_heap(data2.begin(), data2.end(), std::greater<int>());
+      CHECK(etl::is_d_ary_heap<2>(data1.begin(), data1.end(), std::greater<int>()));
+      CHECK(etl::is_heap(data1.begin(), data1.end(), std::greater<int>()));
+      CHECK(std::is_heap(data2.begin(), data2.end(), std::greater<int>()));
+      CHECK_EQUAL(1, data1.front());
+    }
+
     //*************************************************************************
     TEST(heap_movable)
     {
@@ -1124,8 +1218,10 @@ namespace
         std::vector<int> data1(initial_data);
         std::vector<int> data2(initial_data);
 
-        std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
-        etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+        int* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        int* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+
+        CHECK_EQUAL(std::distance(data1.data(), result1), std::distance(data2.data(), result2));
 
         bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
         CHECK(isEqual);
@@ -1143,8 +1239,10 @@ namespace
         std::vector<NDC> data1(initial_data);
         std::vector<NDC> data2(initial_data);
 
-        std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
-        etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+        NDC* result1 = std::rotate(data1.data(), data1.data() + i, data1.data() + data1.size());
+        NDC* result2 = etl::rotate(data2.data(), data2.data() + i, data2.data() + data2.size());
+
+        CHECK_EQUAL(std::distance(data1.data(), result1), std::distance(data2.data(), result2));
 
         bool isEqual = std::equal(std::begin(data1), std::end(data1), std::begin(data2));
         CHECK(isEqual);
@@ -1900,79 +1998,271 @@ namespace
     }
 
     //*************************************************************************
-    TEST(shell_sort_default)
+    TEST(merge_sort_in_place)
     {
-      std::vector<int> data(100, 0);
-      std::iota(data.begin(), data.end(), 1);
+      std::vector<NDC> initial_data;
 
-      for (int i = 0; i < 100; ++i)
+      for (int i = 0; i < 1000; ++i)
       {
-        std::shuffle(data.begin(), data.end(), urng);
+        initial_data.push_back(NDC(int(urng() % 50), i));
+      }
 
-        std::vector<int> data1 = data;
-        std::vector<int> data2 = data;
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
 
-        std::sort(data1.begin(), data1.end());
-        etl::shell_sort(data2.begin(), data2.end());
+      std::stable_sort(data1.begin(), data1.end());
+      etl::merge_sort(data2.begin(), data2.end());
 
-        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
-        CHECK(is_same);
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(merge_sort_in_place_greater)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 50), i));
       }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
     }
 
     //*************************************************************************
-    TEST(shell_sort_greater)
+    TEST(merge_sort_with_buffer)
     {
-      std::vector<int> data(100, 0);
-      std::iota(data.begin(), data.end(), 1);
+      std::vector<NDC> initial_data;
 
-      for (int i = 0; i < 100; ++i)
+      for (int i = 0; i < 1000; ++i)
       {
-        std::shuffle(data.begin(), data.end(), urng);
+        initial_data.push_back(NDC(int(urng() % 50), i));
+      }
 
-        std::vector<int> data1 = data;
-        std::vector<int> data2 = data;
+      std::vector<NDC> data1(initial_data);
+      std::stable_sort(data1.begin(), data1.end());
 
-        std::sort(data1.begin(), data1.end(), std::greater<int>());
-        etl::shell_sort(data2.begin(), data2.end(), std::greater<int>());
+      // Full sized, minimum sized, too small and empty buffers.
+      const size_t buffer_sizes[] = { 1000, 500, 100, 7, 0 };
 
-        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      for (size_t i = 0; i < (sizeof(buffer_sizes) / sizeof(buffer_sizes[0])); ++i)
+      {
+        std::vector<NDC> data2(initial_data);
+        std::vector<NDC> buffer(buffer_sizes[i], NDC(0));
+
+        etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
         CHECK(is_same);
       }
     }
 
     //*************************************************************************
-    TEST(insertion_sort_default)
+    TEST(merge_sort_with_buffer_greater)
     {
-      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 50), i));
+      }
 
       std::vector<NDC> data1(initial_data);
       std::vector<NDC> data2(initial_data);
+      std::vector<NDC> buffer(500, NDC(0));
 
-      std::stable_sort(data1.begin(), data1.end());
-      etl::insertion_sort(data2.begin(), data2.end());
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::merge_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), std::greater<NDC>());
 
       bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
       CHECK(is_same);
     }
 
     //*************************************************************************
-    TEST(insertion_sort_greater)
+    TEST(stable_sort_with_span_buffer)
     {
-      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 50), i));
+      }
 
       std::vector<NDC> data1(initial_data);
       std::vector<NDC> data2(initial_data);
+      std::vector<NDC> data3(initial_data);
+      std::vector<NDC> buffer(500, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::stable_sort(data2.begin(), data2.end(), etl::span<NDC>(buffer.data(), buffer.size()));
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
 
       std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
-      etl::insertion_sort(data2.begin(), data2.end(), std::greater<NDC>());
+      etl::stable_sort(data3.begin(), data3.end(), etl::span<NDC>(buffer.data(), buffer.size()), std::greater<NDC>());
+
+      is_same = std::equal(data1.begin(), data1.end(), data3.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_unsigned)
+    {
+      std::vector<uint32_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint32_t(urng());
+      }
+
+      std::vector<uint32_t> data1(data);
+      std::vector<uint32_t> data2(data);
+      std::vector<uint32_t> buffer(data.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_signed)
+    {
+      std::vector<int16_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = int16_t(urng());
+      }
+
+      std::vector<int16_t> data1(data);
+      std::vector<int16_t> data2(data);
+      std::vector<int16_t> buffer(data.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), etl::span<int16_t>(buffer.data(), buffer.size()));
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_int64)
+    {
+      std::vector<int64_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        uint64_t high = urng();
+        uint64_t low  = urng();
+
+        data[i] = int64_t((high << 32U) | low);
+      }
+
+      data[0] = std::numeric_limits<int64_t>::min();
+      data[1] = std::numeric_limits<int64_t>::max();
+
+      std::vector<int64_t> data1(data);
+      std::vector<int64_t> data2(data);
+      std::vector<int64_t> buffer(data.size());
+
+      std::sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_float_and_double)
+    {
+      std::uniform_real_distribution<float>  distribution_f(-1000.0f, 1000.0f);
+      std::uniform_real_distribution<double> distribution_d(-1.0e10, 1.0e10);
+
+      std::vector<float>  data_f(1000);
+      std::vector<double> data_d(1000);
+
+      for (size_t i = 0; i < data_f.size(); ++i)
+      {
+        data_f[i] = distribution_f(urng);
+        data_d[i] = distribution_d(urng);
+      }
+
+      std::vector<float> data_f1(data_f);
+      std::vector<float> data_f2(data_f);
+      std::vector<float> buffer_f(data_f.size());
+
+      std::sort(data_f1.begin(), data_f1.end());
+      etl::radix_sort(data_f2.begin(), data_f2.end(), buffer_f.begin(), buffer_f.end());
+
+      bool is_same = std::equal(data_f1.begin(), data_f1.end(), data_f2.begin());
+      CHECK(is_same);
+
+      std::vector<double> data_d1(data_d);
+      std::vector<double> data_d2(data_d);
+      std::vector<double> buffer_d(data_d.size());
+
+      std::sort(data_d1.begin(), data_d1.end());
+      etl::radix_sort(data_d2.begin(), data_d2.end(), buffer_d.begin(), buffer_d.end());
+
+      is_same = std::equal(data_d1.begin(), data_d1.end(), data_d2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(radix_sort_key_projection_is_stable)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 50) - 25, i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> buffer(initial_data.size(), NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), buffer.begin(), buffer.end(), [](const NDC& item) { return item.value; });
 
       bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
       CHECK(is_same);
     }
 
     //*************************************************************************
-    TEST(selection_sort_default_forward_iterators)
+    TEST(radix_sort_buffer_too_small)
+    {
+      std::vector<NDC> initial_data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        initial_data.push_back(NDC(int(urng() % 10), i));
+      }
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+      std::vector<NDC> buffer(10, NDC(0));
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::radix_sort(data2.begin(), data2.end(), etl::span<NDC>(buffer.data(), buffer.size()), [](const NDC& item) { return item.value; });
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(shell_sort_default)
     {
       std::vector<int> data(100, 0);
       std::iota(data.begin(), data.end(), 1);
@@ -1981,11 +2271,11 @@ namespace
       {
         std::shuffle(data.begin(), data.end(), urng);
 
-        std::forward_list<int> data1(data.begin(), data.end());
-        std::forward_list<int> data2(data.begin(), data.end());
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
 
-        data1.sort();
-        etl::selection_sort(data2.begin(), data2.end());
+        std::sort(data1.begin(), data1.end());
+        etl::shell_sort(data2.begin(), data2.end());
 
         bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
         CHECK(is_same);
@@ -1993,7 +2283,7 @@ namespace
     }
 
     //*************************************************************************
-    TEST(selection_sort_default_bidirectional_iterators)
+    TEST(shell_sort_greater)
     {
       std::vector<int> data(100, 0);
       std::iota(data.begin(), data.end(), 1);
@@ -2002,11 +2292,11 @@ namespace
       {
         std::shuffle(data.begin(), data.end(), urng);
 
-        std::list<int> data1(data.begin(), data.end());
-        std::list<int> data2(data.begin(), data.end());
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
 
-        data1.sort();
-        etl::selection_sort(data2.begin(), data2.end());
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::shell_sort(data2.begin(), data2.end(), std::greater<int>());
 
         bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
         CHECK(is_same);
@@ -2014,9 +2304,9 @@ namespace
     }
 
     //*************************************************************************
-    TEST(selection_sort_default_random_access_iterators)
+    TEST(intro_sort_default)
     {
-      std::vector<int> data(100, 0);
+      std::vector<int> data(1000, 0);
       std::iota(data.begin(), data.end(), 1);
 
       for (int i = 0; i < 100; ++i)
@@ -2027,7 +2317,7 @@ namespace
         std::vector<int> data2 = data;
 
         std::sort(data1.begin(), data1.end());
-        etl::selection_sort(data2.begin(), data2.end());
+        etl::intro_sort(data2.begin(), data2.end());
 
         bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
         CHECK(is_same);
@@ -2035,9 +2325,9 @@ namespace
     }
 
     //*************************************************************************
-    TEST(selection_sort_greater)
+    TEST(intro_sort_greater)
     {
-      std::vector<int> data(100, 0);
+      std::vector<int> data(1000, 0);
       std::iota(data.begin(), data.end(), 1);
 
       for (int i = 0; i < 100; ++i)
@@ -2048,7 +2338,7 @@ namespace
         std::vector<int> data2 = data;
 
         std::sort(data1.begin(), data1.end(), std::greater<int>());
-        etl::selection_sort(data2.begin(), data2.end(), std::greater<int>());
+        etl::intro_sort(data2.begin(), data2.end(), std::greater<int>());
 
         bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
         CHECK(is_same);
@@ -2056,50 +2346,252 @@ namespace
     }
 
     //*************************************************************************
-    TEST(heap_sort_default)
+    TEST(intro_sort_patterns)
     {
-      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+      const size_t Size = 5000;
 
-      std::vector<NDC> data1(initial_data);
-      std::vector<NDC> data2(initial_data);
+      std::vector<int> ascending(Size);
+      std::iota(ascending.begin(), ascending.end(), 0);
 
-      std::sort(data1.begin(), data1.end());
-      etl::heap_sort(data2.begin(), data2.end());
+      std::vector<int> descending(ascending.rbegin(), ascending.rend());
 
-      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
-      CHECK(is_same);
-    }
+      std::vector<int> organ_pipe(Size);
+      for (size_t i = 0; i < Size; ++i)
+      {
+        organ_pipe[i] = int((i < (Size / 2)) ? i : (Size - i));
+      }
 
-    //*************************************************************************
-    TEST(heap_sort_greater)
-    {
-      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+      std::vector<int> sawtooth(Size);
+      for (size_t i = 0; i < Size; ++i)
+      {
+        sawtooth[i] = int(i % 37);
+      }
 
-      std::vector<NDC> data1(initial_data);
-      std::vector<NDC> data2(initial_data);
+      std::vector<int> all_equal(Size, 42);
 
-      std::sort(data1.begin(), data1.end(), std::greater<NDC>());
-      etl::heap_sort(data2.begin(), data2.end(), std::greater<NDC>());
+      std::vector<int> few_unique(Size);
+      for (size_t i = 0; i < Size; ++i)
+      {
+        few_unique[i] = int(urng() % 4);
+      }
 
-      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
-      CHECK(is_same);
-    }
+      std::vector<int> nearly_sorted(ascending);
+      std::swap(nearly_sorted[10], nearly_sorted[Size - 10]);
 
-    //*************************************************************************
-    TEST(multimax)
-    {
-      CHECK_EQUAL(8, etl::multimax(1, 2, 3, 4, 5, 6, 7, 8));
-      CHECK_EQUAL(8, etl::multimax_compare(std::less<int>(), 1, 2, 3, 4, 5, 6, 7, 8));
-      CHECK_EQUAL(1, etl::multimax_compare(std::greater<int>(), 1, 2, 3, 4, 5, 6, 7, 8));
+      std::vector<int> patterns[] = { ascending, descending, organ_pipe, sawtooth, all_equal, few_unique, nearly_sorted };
 
-      int temp[etl::multimax(1, 2, 3, 4, 5, 6, 7, 8)] = { 1, 2, 3, 4, 5, 6, 7, 8 };
-      (void)temp;
+      for (size_t i = 0; i < (sizeof(patterns) / sizeof(patterns[0])); ++i)
+      {
+        std::vector<int> data1 = patterns[i];
+        std::vector<int> data2 = patterns[i];
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
     }
 
     //*************************************************************************
-    TEST(multimax_iter)
+    TEST(intro_sort_small_ranges)
     {
-      int i[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      for (size_t size = 0; size < 40; ++size)
+      {
+        std::vector<int> data(size);
+        std::iota(data.begin(), data.end(), 0);
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::intro_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(intro_sort_non_default_constructible)
+    {
+      std::vector<NDC> data;
+
+      for (int i = 0; i < 500; ++i)
+      {
+        data.push_back(NDC(int(urng() % 100), i));
+      }
+
+      std::vector<NDC> data1(data);
+      std::vector<NDC> data2(data);
+
+      std::sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::intro_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(insertion_sort_default)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end());
+      etl::insertion_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(insertion_sort_greater)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::stable_sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::insertion_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin(), NDC::are_identical);
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(selection_sort_default_forward_iterators)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::forward_list<int> data1(data.begin(), data.end());
+        std::forward_list<int> data2(data.begin(), data.end());
+
+        data1.sort();
+        etl::selection_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(selection_sort_default_bidirectional_iterators)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::list<int> data1(data.begin(), data.end());
+        std::list<int> data2(data.begin(), data.end());
+
+        data1.sort();
+        etl::selection_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(selection_sort_default_random_access_iterators)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end());
+        etl::selection_sort(data2.begin(), data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(selection_sort_greater)
+    {
+      std::vector<int> data(100, 0);
+      std::iota(data.begin(), data.end(), 1);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        etl::selection_sort(data2.begin(), data2.end(), std::greater<int>());
+
+        bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+        CHECK(is_same);
+      }
+    }
+
+    //*************************************************************************
+    TEST(heap_sort_default)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::sort(data1.begin(), data1.end());
+      etl::heap_sort(data2.begin(), data2.end());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(heap_sort_greater)
+    {
+      std::vector<NDC> initial_data = { NDC(1, 1), NDC(2, 1), NDC(3, 1), NDC(2, 2), NDC(3, 2), NDC(4, 1), NDC(2, 3), NDC(3, 3), NDC(5, 1) };
+
+      std::vector<NDC> data1(initial_data);
+      std::vector<NDC> data2(initial_data);
+
+      std::sort(data1.begin(), data1.end(), std::greater<NDC>());
+      etl::heap_sort(data2.begin(), data2.end(), std::greater<NDC>());
+
+      bool is_same = std::equal(data1.begin(), data1.end(), data2.begin());
+      CHECK(is_same);
+    }
+
+    //*************************************************************************
+    TEST(multimax)
+    {
+      CHECK_EQUAL(8, etl::multimax(1, 2, 3, 4, 5, 6, 7, 8));
+      CHECK_EQUAL(8, etl::multimax_compare(std::less<int>(), 1, 2, 3, 4, 5, 6, 7, 8));
+      CHECK_EQUAL(1, etl::multimax_compare(std::greater<int>(), 1, 2, 3, 4, 5, 6, 7, 8));
+
+      int temp[etl::multimax(1, 2, 3, 4, 5, 6, 7, 8)] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      (void)temp;
+    }
+
+    //*************************************************************************
+    TEST(multimax_iter)
+    {
+      int i[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
 
       CHECK_EQUAL(8, *etl::multimax_iter(&i[0], &i[1], &i[2], &i[3], &i[4], &i[5], &i[6], &i[7]));
       CHECK_EQUAL(8, *etl::multimax_iter_compare(std::less<int>(), &i[0], &i[1], &i[2], &i[3], &i[4], &i[5], &i[6], &i[7]));
@@ -2187,6 +2679,92 @@ namespace
       CHECK(is_same);
     }
 
+    //*************************************************************************
+    TEST(mismatch)
+    {
+      std::vector<int> data1 = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+      std::vector<int> data2 = { 1, 2, 3, 4, 0, 6, 7, 8, 9, 10 };
+      std::list<int>   data3(data2.begin(), data2.end());
+
+      // Containers with and without contiguous iterators.
+      auto result1 = etl::mismatch(data1.begin(), data1.end(), data2.begin());
+      auto result2 = etl::mismatch(data1.begin(), data1.end(), data3.begin(), data3.end());
+      auto result3 = etl::mismatch(data1.data(), data1.data() + data1.size(), data2.data(), data2.data() + 4);
+      auto result4 = etl::mismatch(data1.begin(), data1.end(), data2.begin(), std::equal_to<int>());
+      auto result5 = etl::mismatch(data1.begin(), data1.end(), data2.begin(), data2.begin() + 4, std::equal_to<int>());
+
+      CHECK(result1.first == data1.begin() + 4);
+      CHECK(result1.second == data2.begin() + 4);
+      CHECK(result2.first == data1.begin() + 4);
+      CHECK(*result2.second == 0);
+      CHECK(result3.first == data1.data() + 4);
+      CHECK(result3.second == data2.data() + 4);
+      CHECK(result4.first == data1.begin() + 4);
+      CHECK(result5.first == data1.begin() + 4);
+    }
+
+    //*************************************************************************
+    TEST(contiguous_algorithms)
+    {
+      CHECK(check_contiguous_algorithms<int8_t>(100));
+      CHECK(check_contiguous_algorithms<uint8_t>(100));
+      CHECK(check_contiguous_algorithms<char>(5));
+      CHECK(check_contiguous_algorithms<int16_t>(1000));
+      CHECK(check_contiguous_algorithms<uint16_t>(5));
+      CHECK(check_contiguous_algorithms<int32_t>(100000));
+      CHECK(check_contiguous_algorithms<uint32_t>(5));
+      CHECK(check_contiguous_algorithms<int64_t>(5));
+      CHECK(check_contiguous_algorithms<float>(50));
+    }
+
+    //*************************************************************************
+    TEST(contiguous_algorithms_limits)
+    {
+      std::vector<int16_t> data(40, 7);
+      data[3]  = std::numeric_limits<int16_t>::min();
+      data[17] = std::numeric_limits<int16_t>::max();
+      data[33] = std::numeric_limits<int16_t>::min();
+      data[38] = std::numeric_limits<int16_t>::max();
+
+      const int16_t* first = data.data();
+      const int16_t* last  = first + data.size();
+
+      // The first of equal smallest and equal largest elements.
+      CHECK(etl::min_element(first, last) == first + 3);
+      CHECK(etl::minmax_element(first, last).first  == first + 3);
+      CHECK(etl::minmax_element(first, last).second == first + 17);
+
+      // Values that an element cannot represent.
+      CHECK(etl::find(first, last, 40000) == last);
+      CHECK(etl::count(first, last, 7 + 65536) == 0);
+      CHECK(etl::count(first, last, 7L) == 36);
+
+      // Unsigned elements compared with negative values.
+      std::vector<uint32_t> udata(20, 0xFFFFFFFFUL);
+      CHECK(etl::count(udata.data(), udata.data() + udata.size(), 0xFFFFFFFFUL) == 20);
+    }
+
+    //*************************************************************************
+    TEST(contiguous_algorithms_float_nan)
+    {
+      std::vector<float> data(40, 1.0f);
+      data[5]  = -2.0f;
+      data[20] = std::numeric_limits<float>::quiet_NaN();
+      data[30] = 3.0f;
+
+      const float* first = data.data();
+      const float* last  = first + data.size();
+
+      ETL_OR_STD::pair<const float*, const float*> result   = etl::minmax_element(first, last);
+      ETL_OR_STD::pair<const float*, const float*> expected = etl::minmax_element(first, last, etl::less<float>());
+
+      CHECK(etl::min_element(first, last) == etl::min_element(first, last, etl::less<float>()));
+      CHECK(result.first  == expected.first);
+      CHECK(result.second == expected.second);
+      CHECK(etl::find(first, last, std::numeric_limits<float>::quiet_NaN()) == last);
+      CHECK(etl::count(first, last, 1.0f) == 37);
+    }
+
     //*************************************************************************
     TEST(remove_if)
     {
@@ -2198,5 +2776,534 @@ namespace
       bool is_same = std::equal(expected.begin(), expected.end(), data.begin());
       CHECK(is_same);
     }
+
+    //*************************************************************************
+    TEST(set_operations)
+    {
+      std::vector<int> data1 = { 1, 2, 2, 3, 5, 7, 7, 7, 9, 12 };
+      std::vector<int> data2 = { 2, 3, 3, 4, 7, 7, 10, 12, 13 };
+
+      std::vector<int> expected;
+      std::vector<int> result;
+
+      std::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::merge(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_union(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      expected.clear();
+      result.clear();
+      std::set_symmetric_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+      etl::set_symmetric_difference(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(result));
+      CHECK(expected == result);
+
+      std::vector<int> subset = { 2, 7, 7, 12 };
+      std::vector<int> not_subset = { 2, 2, 2 };
+
+      CHECK(etl::includes(data1.begin(), data1.end(), subset.begin(), subset.end()));
+      CHECK(!etl::includes(data1.begin(), data1.end(), not_subset.begin(), not_subset.end()));
+      CHECK(etl::includes(data1.begin(), data1.end(), subset.begin(), subset.begin()));
+
+      // With a user defined comparison.
+      std::vector<int> reversed1(data1.rbegin(), data1.rend());
+      std::vector<int> reversed2(data2.rbegin(), data2.rend());
+
+      expected.clear();
+      result.clear();
+      std::set_union(reversed1.begin(), reversed1.end(), reversed2.begin(), reversed2.end(), std::back_inserter(expected), std::greater<int>());
+      etl::set_union(reversed1.begin(), reversed1.end(), reversed2.begin(), reversed2.end(), std::back_inserter(result), etl::greater<int>());
+      CHECK(expected == result);
+    }
+
+    //*************************************************************************
+    TEST(set_operations_galloping)
+    {
+      std::mt19937 generator(42);
+
+      for (size_t pass = 0U; pass < 20U; ++pass)
+      {
+        // Ranges of very different sizes, with duplicates.
+        std::uniform_int_distribution<int> distribution(0, 2000);
+
+        std::vector<int> small_range(pass + 1U);
+        std::vector<int> large_range(1000U + (pass * 50U));
+
+        for (int& value : small_range) { value = distribution(generator); }
+        for (int& value : large_range) { value = distribution(generator); }
+
+        std::sort(small_range.begin(), small_range.end());
+        std::sort(large_range.begin(), large_range.end());
+
+        std::vector<int> expected;
+        std::vector<int> result;
+
+        std::set_intersection(small_range.begin(), small_range.end(), large_range.begin(), large_range.end(), std::back_inserter(expected));
+        etl::set_intersection_galloping(small_range.begin(), small_range.end(), large_range.begin(), large_range.end(), std::back_inserter(result));
+        CHECK(expected == result);
+
+        expected.clear();
+        result.clear();
+        std::set_intersection(large_range.begin(), large_range.end(), small_range.begin(), small_range.end(), std::back_inserter(expected));
+        etl::set_intersection_galloping(large_range.begin(), large_range.end(), small_range.begin(), small_range.end(), std::back_inserter(result));
+        CHECK(expected == result);
+
+        expected.clear();
+        result.clear();
+        std::set_difference(small_range.begin(), small_range.end(), large_range.begin(), large_range.end(), std::back_inserter(expected));
+        etl::set_difference_galloping(small_range.begin(), small_range.end(), large_range.begin(), large_range.end(), std::back_inserter(result));
+        CHECK(expected == result);
+
+        expected.clear();
+        result.clear();
+        std::set_difference(large_range.begin(), large_range.end(), small_range.begin(), small_range.end(), std::back_inserter(expected));
+        etl::set_difference_galloping(large_range.begin(), large_range.end(), small_range.begin(), small_range.end(), std::back_inserter(result), etl::less<int>());
+        CHECK(expected == result);
+      }
+    }
+
+    //*************************************************************************
+    TEST(set_intersection_unique)
+    {
+      std::mt19937 generator(7);
+
+      for (size_t pass = 0U; pass < 50U; ++pass)
+      {
+        std::uniform_int_distribution<uint32_t> distribution(0U, 200U);
+
+        std::vector<uint32_t> data1(pass);
+        std::vector<uint32_t> data2(50U - pass);
+
+        for (uint32_t& value : data1) { value = distribution(generator); }
+        for (uint32_t& value : data2) { value = distribution(generator); }
+
+        std::sort(data1.begin(), data1.end());
+        std::sort(data2.begin(), data2.end());
+        data1.erase(std::unique(data1.begin(), data1.end()), data1.end());
+        data2.erase(std::unique(data2.begin(), data2.end()), data2.end());
+
+        std::vector<uint32_t> expected;
+        std::set_intersection(data1.begin(), data1.end(), data2.begin(), data2.end(), std::back_inserter(expected));
+
+        // Contiguous.
+        std::vector<uint32_t> result(expected.size() + 1U, 0U);
+        uint32_t* end = etl::set_intersection_unique(data1.data(), data1.data() + data1.size(), data2.data(), data2.data() + data2.size(), result.data());
+        CHECK_EQUAL(expected.size(), size_t(end - result.data()));
+        CHECK(std::equal(expected.begin(), expected.end(), result.begin()));
+
+        // Not contiguous.
+        std::list<uint32_t> list1(data1.begin(), data1.end());
+        std::vector<uint32_t> list_result;
+        etl::set_intersection_unique(list1.begin(), list1.end(), data2.begin(), data2.end(), std::back_inserter(list_result));
+        CHECK(expected == list_result);
+      }
+
+      // Signed.
+      std::vector<int32_t> signed1 = { -100, -50, -3, -2, -1, 0, 4, 8, 9, 10 };
+      std::vector<int32_t> signed2 = { -50, -4, -2, 0, 1, 2, 3, 4, 10, 11, 12 };
+      std::vector<int32_t> signed_expected = { -50, -2, 0, 4, 10 };
+      std::vector<int32_t> signed_result(10U);
+
+      int32_t* end = etl::set_intersection_unique(signed1.data(), signed1.data() + signed1.size(), signed2.data(), signed2.data() + signed2.size(), signed_result.data());
+      signed_result.resize(size_t(end - signed_result.data()));
+      CHECK(signed_expected == signed_result);
+    }
+
+    //*************************************************************************
+    TEST(merge_ranges)
+    {
+      typedef std::pair<int, int> Item; // Value, range.
+
+      std::mt19937 generator(3);
+      std::uniform_int_distribution<int> distribution(0, 50);
+
+      for (size_t n_ranges = 1U; n_ranges <= 9U; ++n_ranges)
+      {
+        std::vector<std::vector<Item>> ranges(n_ranges);
+        std::vector<Item> expected;
+
+        for (size_t r = 0U; r < n_ranges; ++r)
+        {
+          ranges[r].resize((r * 7U) % 20U);
+
+          for (Item& item : ranges[r])
+          {
+            item = Item(distribution(generator), int(r));
+          }
+
+          std::sort(ranges[r].begin(), ranges[r].end());
+          expected.insert(expected.end(), ranges[r].begin(), ranges[r].end());
+        }
+
+        // Stable, so equal values stay in the order of their ranges.
+        std::stable_sort(expected.begin(), expected.end(), [](const Item& lhs, const Item& rhs) { return lhs.first < rhs.first; });
+
+        std::vector<Item> result;
+        etl::merge_ranges<9U>(ranges.begin(), ranges.end(), std::back_inserter(result), [](const Item& lhs, const Item& rhs) { return lhs.first < rhs.first; });
+
+        CHECK(expected == result);
+      }
+
+      // etl::vector ranges, with the default comparison.
+      const etl::vector<int, 4> vectors[3] = { { 1, 4, 7 }, { 2, 5 }, { 0, 3, 6, 9 } };
+      const std::vector<int> expected = { 0, 1, 2, 3, 4, 5, 6, 7, 9 };
+
+      std::vector<int> result;
+      etl::merge_ranges<4U>(std::begin(vectors), std::end(vectors), std::back_inserter(result));
+      CHECK(expected == result);
+
+      // Only the first VMax_Ranges are merged.
+      result.clear();
+      etl::merge_ranges<2U>(std::begin(vectors), std::end(vectors), std::back_inserter(result));
+      CHECK((std::vector<int>{ 1, 2, 4, 5, 7 }) == result);
+    }
+
+    //*************************************************************************
+    TEST(nth_element)
+    {
+      std::vector<int> data(1001, 0);
+      std::iota(data.begin(), data.end(), 0);
+
+      // Random, sorted, reversed and heavily duplicated inputs.
+      std::vector<std::vector<int>> inputs;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+        inputs.push_back(data);
+      }
+
+      std::sort(data.begin(), data.end());
+      inputs.push_back(data);
+      inputs.push_back(std::vector<int>(data.rbegin(), data.rend()));
+      inputs.push_back(std::vector<int>(1001, 7));
+
+      std::vector<int> few(1001);
+      for (size_t i = 0; i < few.size(); ++i)
+      {
+        few[i] = int(i % 3);
+      }
+      inputs.push_back(few);
+
+      const size_t positions[] = { 0, 1, 15, 500, 999, 1000 };
+
+      for (size_t i = 0; i < inputs.size(); ++i)
+      {
+        std::vector<int> sorted = inputs[i];
+        std::sort(sorted.begin(), sorted.end());
+
+        for (size_t p = 0; p < (sizeof(positions) / sizeof(positions[0])); ++p)
+        {
+          std::vector<int> selected = inputs[i];
+          const size_t n = positions[p];
+
+          etl::nth_element(selected.begin(), selected.begin() + n, selected.end());
+
+          CHECK_EQUAL(sorted[n], selected[n]);
+          CHECK(std::all_of(selected.begin(), selected.begin() + n, [&](int v) { return v <= selected[n]; }));
+          CHECK(std::all_of(selected.begin() + n, selected.end(), [&](int v) { return v >= selected[n]; }));
+        }
+      }
+
+      // Small ranges and the greater comparison.
+      std::vector<int> small = { 5, 1, 4, 2, 3 };
+      etl::nth_element(small.begin(), small.begin() + 1, small.end(), std::greater<int>());
+      CHECK_EQUAL(4, small[1]);
+
+      etl::nth_element(small.begin(), small.end(), small.end());
+      etl::nth_element(small.begin(), small.begin(), small.begin());
+    }
+
+    //*************************************************************************
+    TEST(nth_element_median_of_medians)
+    {
+      // Depth zero uses the median of medians pivot from the start.
+      std::vector<int> data(2000, 0);
+      std::iota(data.begin(), data.end(), 0);
+      std::shuffle(data.begin(), data.end(), urng);
+
+      etl::private_selection::select(data.begin(), data.begin() + 1234, data.end(), etl::less<int>(), 0);
+
+      CHECK_EQUAL(1234, data[1234]);
+      CHECK(std::all_of(data.begin(), data.begin() + 1234, [](int v) { return v < 1234; }));
+    }
+
+    //*************************************************************************
+    TEST(partial_sort)
+    {
+      std::vector<int> data(1000, 0);
+      std::iota(data.begin(), data.end(), 0);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        std::shuffle(data.begin(), data.end(), urng);
+
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::partial_sort(data1.begin(), data1.begin() + 10, data1.end());
+        etl::partial_sort(data2.begin(), data2.begin() + 10, data2.end());
+
+        bool is_same = std::equal(data1.begin(), data1.begin() + 10, data2.begin());
+        CHECK(is_same);
+
+        data2 = data;
+        etl::partial_sort(data2.begin(), data2.begin() + 10, data2.end(), std::greater<int>());
+
+        for (int j = 0; j < 10; ++j)
+        {
+          CHECK_EQUAL(999 - j, data2[size_t(j)]);
+        }
+
+        std::vector<int> sorted = data;
+        std::sort(sorted.begin(), sorted.end());
+        data2 = data;
+        etl::partial_sort(data2.begin(), data2.end(), data2.end());
+        CHECK(sorted == data2);
+
+        data2 = data;
+        etl::partial_sort(data2.begin(), data2.begin(), data2.end());
+        CHECK(data == data2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(partial_sort_copy)
+    {
+      std::list<int> data = { 9, 3, 7, 1, 8, 2, 6, 4, 5, 0 };
+
+      std::array<int, 4> smallest;
+      std::array<int, 4>::iterator end = etl::partial_sort_copy(data.begin(), data.end(), smallest.begin(), smallest.end());
+      CHECK(end == smallest.end());
+      CHECK((std::array<int, 4>{ 0, 1, 2, 3 }) == smallest);
+
+      end = etl::partial_sort_copy(data.begin(), data.end(), smallest.begin(), smallest.end(), std::greater<int>());
+      CHECK((std::array<int, 4>{ 9, 8, 7, 6 }) == smallest);
+
+      // More room than input.
+      std::array<int, 16> all;
+      std::array<int, 16>::iterator all_end = etl::partial_sort_copy(data.begin(), data.end(), all.begin(), all.end());
+      CHECK_EQUAL(10, std::distance(all.begin(), all_end));
+      CHECK(std::is_sorted(all.begin(), all_end));
+
+      // Empty input.
+      all_end = etl::partial_sort_copy(data.end(), data.end(), all.begin(), all.end());
+      CHECK(all_end == all.begin());
+    }
+
+    //*************************************************************************
+    template <size_t N>
+    static bool sort_network_sorts_all_binary_inputs()
+    {
+      // The zero-one principle: a network that sorts every sequence of zeros and ones sorts everything.
+      for (uint32_t bits = 0U; bits < (1U << N); ++bits)
+      {
+        std::array<int, N> values;
+
+        for (size_t i = 0U; i < N; ++i)
+        {
+          values[i] = int((bits >> i) & 1U);
+        }
+
+        etl::sort_network<N>(values.data());
+
+        if (!std::is_sorted(values.begin(), values.end()))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    template <size_t N>
+    static bool sort_network_sorts_random_inputs()
+    {
+      for (int i = 0; i < 100; ++i)
+      {
+        std::array<int, N> values;
+
+        for (size_t j = 0U; j < N; ++j)
+        {
+          values[j] = int(urng() % 50U);
+        }
+
+        std::array<int, N> expected = values;
+        std::sort(expected.begin(), expected.end());
+        etl::sort_network<N>(values.begin());
+
+        if (values != expected)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(sort_network_binary)
+    {
+      CHECK(sort_network_sorts_all_binary_inputs<1>());
+      CHECK(sort_network_sorts_all_binary_inputs<2>());
+      CHECK(sort_network_sorts_all_binary_inputs<3>());
+      CHECK(sort_network_sorts_all_binary_inputs<4>());
+      CHECK(sort_network_sorts_all_binary_inputs<5>());
+      CHECK(sort_network_sorts_all_binary_inputs<6>());
+      CHECK(sort_network_sorts_all_binary_inputs<7>());
+      CHECK(sort_network_sorts_all_binary_inputs<8>());
+      CHECK(sort_network_sorts_all_binary_inputs<9>());
+      CHECK(sort_network_sorts_all_binary_inputs<10>());
+      CHECK(sort_network_sorts_all_binary_inputs<11>());
+      CHECK(sort_network_sorts_all_binary_inputs<12>());
+      CHECK(sort_network_sorts_all_binary_inputs<13>());
+      CHECK(sort_network_sorts_all_binary_inputs<14>());
+      CHECK(sort_network_sorts_all_binary_inputs<15>());
+      CHECK(sort_network_sorts_all_binary_inputs<16>());
+    }
+
+    //*************************************************************************
+    TEST(sort_network_random)
+    {
+      CHECK(sort_network_sorts_random_inputs<17>());
+      CHECK(sort_network_sorts_random_inputs<20>());
+      CHECK(sort_network_sorts_random_inputs<24>());
+      CHECK(sort_network_sorts_random_inputs<31>());
+      CHECK(sort_network_sorts_random_inputs<32>());
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(sort_network_size)
+    {
+      // Optimal up to eight elements.
+      CHECK_EQUAL(0U,  etl::private_sort_network::network<1>::Size);
+      CHECK_EQUAL(1U,  etl::private_sort_network::network<2>::Size);
+      CHECK_EQUAL(3U,  etl::private_sort_network::network<3>::Size);
+      CHECK_EQUAL(5U,  etl::private_sort_network::network<4>::Size);
+      CHECK_EQUAL(9U,  etl::private_sort_network::network<5>::Size);
+      CHECK_EQUAL(12U, etl::private_sort_network::network<6>::Size);
+      CHECK_EQUAL(16U, etl::private_sort_network::network<7>::Size);
+      CHECK_EQUAL(19U, etl::private_sort_network::network<8>::Size);
+      CHECK_EQUAL(63U, etl::private_sort_network::network<16>::Size);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(sort_network_array_and_compare)
+    {
+      etl::array<std::string, 5> strings = { "d", "b", "e", "a", "c" };
+      etl::sort_network(strings);
+      CHECK((etl::array<std::string, 5>{ "a", "b", "c", "d", "e" }) == strings);
+
+      etl::array<int, 6> values = { 3, 6, 1, 5, 2, 4 };
+      etl::sort_network(values, std::greater<int>());
+      CHECK((etl::array<int, 6>{ 6, 5, 4, 3, 2, 1 }) == values);
+    }
+
+    //*************************************************************************
+    template <typename T, size_t N>
+    static void check_sort_network_columns(size_t columns)
+    {
+      std::vector<T> table(N * columns);
+
+      for (size_t i = 0U; i < table.size(); ++i)
+      {
+        table[i] = T(int(urng() % 200U) - 100);
+      }
+
+      std::vector<T> expected = table;
+
+      for (size_t c = 0U; c < columns; ++c)
+      {
+        std::vector<T> column;
+
+        for (size_t r = 0U; r < N; ++r)
+        {
+          column.push_back(expected[(r * columns) + c]);
+        }
+
+        std::sort(column.begin(), column.end());
+
+        for (size_t r = 0U; r < N; ++r)
+        {
+          expected[(r * columns) + c] = column[r];
+        }
+      }
+
+      etl::sort_network_columns<N>(table.data(), columns);
+      CHECK(expected == table);
+    }
+
+    //*************************************************************************
+    TEST(sort_network_columns)
+    {
+      check_sort_network_columns<int16_t, 9>(37U);
+      check_sort_network_columns<int32_t, 9>(37U);
+      check_sort_network_columns<uint32_t, 5>(64U);
+      check_sort_network_columns<float, 7>(35U);
+      check_sort_network_columns<double, 4>(10U);
+      check_sort_network_columns<int8_t, 16>(100U);
+
+      // User defined comparison.
+      int table[3 * 4] = { 1, 5, 9, 2,
+                           3, 4, 8, 7,
+                           2, 6, 7, 9 };
+
+      etl::sort_network_columns<3>(table, 4U, std::greater<int>());
+
+      const int expected[3 * 4] = { 3, 6, 9, 9,
+                                    2, 5, 8, 7,
+                                    1, 4, 7, 2 };
+
+      CHECK_ARRAY_EQUAL(expected, table, 12);
+    }
+
+    //*************************************************************************
+    TEST(small_sort)
+    {
+      for (size_t n = 0U; n < 40U; ++n)
+      {
+        std::vector<int> data(n);
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          data[i] = int(urng() % 20U);
+        }
+
+        std::vector<int> expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> data1 = data;
+        etl::small_sort(data1.begin(), data1.end());
+        CHECK(expected == data1);
+
+        // etl::sort uses a sorting network for tiny ranges.
+        std::vector<int> data2 = data;
+        etl::sort(data2.begin(), data2.end());
+        CHECK(expected == data2);
+      }
+
+      std::vector<std::string> strings = { "c", "a", "b" };
+      etl::small_sort(strings.begin(), strings.end(), std::greater<std::string>());
+      CHECK((std::vector<std::string>{ "c", "b", "a" }) == strings);
+    }
   };
 }
@@ -0,0 +1,252 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/atomic_extensions.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  SUITE(test_atomic_extensions)
+  {
+    //*************************************************************************
+    TEST(test_fetch_max)
+    {
+      etl::atomic<uint32_t> value(10U);
+
+      CHECK_EQUAL(10U, etl::atomic_fetch_max(value, 5U));
+      CHECK_EQUAL(10U, value.load());
+
+      CHECK_EQUAL(10U, etl::atomic_fetch_max(value, 20U));
+      CHECK_EQUAL(20U, value.load());
+
+      CHECK_EQUAL(20U, etl::atomic_fetch_max(value, 20U, etl::memory_order_relaxed));
+      CHECK_EQUAL(20U, value.load());
+    }
+
+    //*************************************************************************
+    TEST(test_fetch_min)
+    {
+      etl::atomic<int> value(10);
+
+      CHECK_EQUAL(10, etl::atomic_fetch_min(value, 15));
+      CHECK_EQUAL(10, value.load());
+
+      CHECK_EQUAL(10, etl::atomic_fetch_min(value, -5));
+      CHECK_EQUAL(-5, value.load());
+    }
+
+    //*************************************************************************
+    TEST(test_fetch_max_high_water_mark_multiple_threads)
+    {
+      etl::atomic<uint32_t> high_water_mark(0U);
+      etl::atomic<uint32_t> low_water_mark(0xFFFFFFFFU);
+
+      const size_t   Threads   = 4U;
+      const uint32_t PerThread = 10000U;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&, t]()
+        {
+          for (uint32_t i = 0U; i < PerThread; ++i)
+          {
+            const uint32_t sample = uint32_t(i * Threads + t);
+            etl::atomic_fetch_max(high_water_mark, sample, etl::memory_order_relaxed);
+            etl::atomic_fetch_min(low_water_mark,  sample, etl::memory_order_relaxed);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(uint32_t(PerThread * Threads - 1U), high_water_mark.load());
+      CHECK_EQUAL(0U, low_water_mark.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_returns_at_once_if_changed)
+    {
+      etl::atomic<uint32_t> value(1U);
+
+      etl::atomic_wait(value, 0U);
+
+      CHECK_EQUAL(1U, value.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_notify_one)
+    {
+      etl::atomic<uint32_t> value(0U);
+      etl::atomic<uint32_t> result(0U);
+
+      std::thread waiter([&]()
+      {
+        etl::atomic_wait(value, 0U, etl::memory_order_acquire);
+        result.store(value.load());
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      value.store(42U, etl::memory_order_release);
+      etl::atomic_notify_one(value);
+
+      waiter.join();
+
+      CHECK_EQUAL(42U, result.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_notify_all)
+    {
+      etl::atomic<uint32_t> flag(0U);
+      etl::atomic<uint32_t> woken(0U);
+
+      const size_t Threads = 3U;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&]()
+        {
+          while (flag.load() == 0U)
+          {
+            etl::atomic_wait(flag, 0U);
+          }
+
+          ++woken;
+        }));
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      flag.store(1U);
+      etl::atomic_notify_all(flag);
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(Threads, woken.load());
+    }
+
+    //*************************************************************************
+    TEST(test_wait_notify_wider_type)
+    {
+      // Not waitable on a futex, so spins.
+      etl::atomic<uint64_t> value(0U);
+
+      std::thread waiter([&]()
+      {
+        etl::atomic_wait(value, uint64_t(0U));
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      value.store(0x100000000ULL);
+      etl::atomic_notify_one(value);
+
+      waiter.join();
+
+      CHECK_EQUAL(0x100000000ULL, value.load());
+    }
+
+#if ETL_HAS_ATOMIC_DOUBLE_WIDTH_CAS
+    //*************************************************************************
+    TEST(test_atomic_tagged_ptr)
+    {
+      int a = 1;
+      int b = 2;
+
+      etl::atomic_tagged_ptr<int> tp(etl::tagged_ptr<int>(&a, 0U));
+
+      CHECK(tp.is_always_lock_free);
+      CHECK(tp.load() == etl::tagged_ptr<int>(&a, 0U));
+
+      // Same pointer, stale tag.
+      etl::tagged_ptr<int> expected(&a, 1U);
+      CHECK(!tp.compare_exchange_strong(expected, etl::tagged_ptr<int>(&b, 2U)));
+      CHECK(expected == etl::tagged_ptr<int>(&a, 0U));
+
+      CHECK(tp.compare_exchange_strong(expected, etl::tagged_ptr<int>(&b, 1U)));
+      CHECK(tp.load() == etl::tagged_ptr<int>(&b, 1U));
+
+      CHECK(tp.exchange(etl::tagged_ptr<int>(ETL_NULLPTR, 2U)) == etl::tagged_ptr<int>(&b, 1U));
+
+      tp.store(etl::tagged_ptr<int>(&a, 3U));
+      CHECK(tp.load() == etl::tagged_ptr<int>(&a, 3U));
+    }
+
+    //*************************************************************************
+    TEST(test_atomic_tagged_ptr_multiple_threads)
+    {
+      int a = 1;
+
+      etl::atomic_tagged_ptr<int> tp(etl::tagged_ptr<int>(&a, 0U));
+
+      const size_t    Threads   = 4U;
+      const uintptr_t PerThread = 10000U;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&]()
+        {
+          for (uintptr_t i = 0U; i < PerThread; ++i)
+          {
+            etl::tagged_ptr<int> expected = tp.load();
+
+            while (!tp.compare_exchange_weak(expected, etl::tagged_ptr<int>(expected.ptr, expected.tag + 1U)))
+            {
+            }
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK(tp.load() == etl::tagged_ptr<int>(&a, Threads * PerThread));
+    }
+#endif
+  };
+}
+
+#endif
@@ -0,0 +1,174 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/atomic_snapshot.h"
+
+#include <thread>
+#include <atomic>
+#include <string>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Every element holds the same value, so a torn read can be detected.
+  struct Config
+  {
+    Config(uint32_t version_ = 0U)
+    {
+      for (size_t i = 0; i < 8; ++i)
+      {
+        values[i] = version_;
+      }
+    }
+
+    bool is_consistent() const
+    {
+      for (size_t i = 1; i < 8; ++i)
+      {
+        if (values[i] != values[0])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    uint32_t values[8];
+  };
+
+  SUITE(test_atomic_snapshot)
+  {
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      etl::atomic_snapshot<std::string> snapshot1;
+      etl::atomic_snapshot<std::string, 4> snapshot2(std::string("initial"));
+
+      CHECK_EQUAL(std::string(""), snapshot1.load());
+      CHECK_EQUAL(std::string("initial"), snapshot2.load());
+      CHECK_EQUAL(3U, snapshot1.BUFFERS);
+      CHECK_EQUAL(4U, snapshot2.BUFFERS);
+    }
+
+    //*************************************************************************
+    TEST(test_store_load)
+    {
+      etl::atomic_snapshot<std::string> snapshot;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        const std::string text = std::string("value ") + std::to_string(i);
+
+        CHECK(snapshot.store(text));
+        CHECK_EQUAL(text, snapshot.load());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_read_in_place)
+    {
+      etl::atomic_snapshot<std::string, 2> snapshot(std::string("A"));
+
+      std::string seen;
+
+      snapshot.read([&](const std::string& value)
+      {
+        seen = value;
+
+        // A reader holds the current buffer, so the other is free.
+        CHECK(snapshot.store(std::string("B")));
+
+        // The only other buffer is held by this reader.
+        CHECK(!snapshot.store(std::string("C")));
+      });
+
+      CHECK_EQUAL(std::string("A"), seen);
+      CHECK_EQUAL(std::string("B"), snapshot.load());
+      CHECK(snapshot.store(std::string("C")));
+      CHECK_EQUAL(std::string("C"), snapshot.load());
+    }
+
+    //*************************************************************************
+    TEST(test_readers_never_see_a_torn_value)
+    {
+      static const uint32_t Writes = 50000U;
+
+      etl::atomic_snapshot<Config, 6> snapshot;
+      std::atomic<bool> done(false);
+      std::atomic<bool> consistent(true);
+
+      std::thread readers[4];
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        readers[i] = std::thread([&]()
+        {
+          uint32_t last_version = 0U;
+
+          while (!done.load())
+          {
+            const Config config = snapshot.load();
+
+            if (!config.is_consistent() || (config.values[0] < last_version))
+            {
+              consistent.store(false);
+            }
+
+            last_version = config.values[0];
+          }
+        });
+      }
+
+      uint32_t version = 1U;
+
+      while (version <= Writes)
+      {
+        if (snapshot.store(Config(version)))
+        {
+          ++version;
+        }
+      }
+
+      done.store(true);
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        readers[i].join();
+      }
+
+      CHECK(consistent.load());
+      CHECK_EQUAL(Writes, snapshot.load().values[0]);
+    }
+  }
+}
+
+#endif
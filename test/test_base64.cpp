@@ -341,6 +341,28 @@ namespace
     "OycDQy37KCphrrxJcTIBFWlcXvXVm96lV8nBfYDeTIHAzyrRhlbVcTfrgDLf5N+27j/cebMXjnZljpYhuYjRbdDd/9qoek31cXf9LvLkQHKMgwBvE3JT5GtwDjfKJc1oYsCrFMdZg9KCjJNtEyHACPltrIR4SYRva/sgO5xJ+06AaYIlhpXVTZHt0ncqJECK302ALc3VWiamcRVCDj+ycBQpH40jLsHqzvl+bN8co4QrJDWnY8gLH4u6Ub/pUYDSI7XRtFmufTAdABzYcGwWccdWCP6BrvvgktjbuVd8mctC7/yzVh7RQtMMGLPurxp3qFI8ns3eITQ+H7VU1/u0vQ=="
   };
 
+  //***************************************************************************
+  void reference_encode(const unsigned char* input, size_t length, std::string& output)
+  {
+    static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    output.clear();
+
+    for (size_t i = 0U; i < length; i += 3U)
+    {
+      const uint32_t b0 = input[i];
+      const uint32_t b1 = ((i + 1U) < length) ? input[i + 1U] : 0U;
+      const uint32_t b2 = ((i + 2U) < length) ? input[i + 2U] : 0U;
+
+      const uint32_t group = (b0 << 16) | (b1 << 8) | b2;
+
+      output += alphabet[(group >> 18) & 0x3F];
+      output += alphabet[(group >> 12) & 0x3F];
+      output += ((i + 1U) < length) ? alphabet[(group >> 6) & 0x3F] : '=';
+      output += ((i + 2U) < length) ? alphabet[group & 0x3F] : '=';
+    }
+  }
+
   SUITE(test_base64)
   {
     //*************************************************************************
@@ -680,6 +702,151 @@ namespace
       CHECK_THROW((etl::base64::decode(encoded[10].data(), encoded[10].size(),
         decoded_output.data(), decoded_output.size())), etl::base64_overflow);
     }
+
+    //*************************************************************************
+    TEST(test_encode_decode_unaligned_long_buffers)
+    {
+      std::vector<unsigned char> input(1024U + 3U);
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        input[i] = static_cast<unsigned char>((i * 251U) + (i >> 8));
+      }
+
+      for (size_t offset = 0U; offset < 3U; ++offset)
+      {
+        for (size_t length = 0U; length <= 1024U; length += 7U)
+        {
+          const unsigned char* p_input = input.data() + offset;
+
+          std::string expected;
+          reference_encode(p_input, length, expected);
+
+          std::vector<char> encoded_output(etl::base64::encode_size(length) + 1U);
+
+          size_t encoded_size = etl::base64::encode(p_input, length, encoded_output.data(), encoded_output.size());
+
+          CHECK_EQUAL(expected.size(), encoded_size);
+          CHECK_EQUAL(expected, std::string(encoded_output.data(), encoded_size));
+
+          std::vector<unsigned char> decoded_output(length + 1U);
+
+          size_t decoded_size = etl::base64::decode(expected.data(), expected.size(), decoded_output.data(), length);
+
+          CHECK_EQUAL(length, decoded_size);
+          CHECK(std::equal(p_input, p_input + length, decoded_output.begin()));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_chunks)
+    {
+      const std::string& expected = encoded[256];
+
+      for (size_t chunk_size = 1U; chunk_size <= 70U; ++chunk_size)
+      {
+        etl::base64_encoder encoder;
+
+        std::array<char, 344> output;
+        size_t output_size = 0U;
+
+        for (size_t i = 0U; i < input_data_unsigned_char.size(); i += chunk_size)
+        {
+          const size_t length = std::min(chunk_size, input_data_unsigned_char.size() - i);
+
+          const size_t encode_size = encoder.encode_size(length);
+
+          const size_t written = encoder.encode(input_data_unsigned_char.data() + i, length,
+                                                output.data() + output_size, output.size() - output_size);
+
+          CHECK_EQUAL(encode_size, written);
+          CHECK_EQUAL(0U, written % 4U);
+          output_size += written;
+        }
+
+        CHECK_EQUAL(4U, encoder.flush_size());
+        output_size += encoder.flush(output.data() + output_size, output.size() - output_size);
+        CHECK_EQUAL(0U, encoder.flush_size());
+
+        CHECK_EQUAL(expected, std::string(output.data(), output_size));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_chunks_to_etl_string)
+    {
+      etl::base64_encoder encoder;
+      etl::string<344> output;
+
+      CHECK_EQUAL(0U, encoder.encode(input_data_int8_t.data(), 1U, output));
+      CHECK_EQUAL(0U, encoder.encode(input_data_int8_t.data() + 1U, 1U, output));
+      CHECK_EQUAL(4U, encoder.encode(input_data_int8_t.data() + 2U, 1U, output));
+      CHECK_EQUAL(164U, encoder.encode(input_data_int8_t.data() + 3U, 124U, output));
+      CHECK_EQUAL(172U, encoder.encode(input_data_int8_t.data() + 127U, 129U, output));
+      CHECK_EQUAL(4U, encoder.flush(output));
+      CHECK_EQUAL(0U, encoder.flush(output));
+
+      CHECK_EQUAL(encoded[256], std::string(output.data(), output.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_span_and_reset)
+    {
+      etl::base64_encoder encoder;
+
+      std::array<char, 8> output;
+
+      etl::span<const unsigned char> input(input_data_unsigned_char.data(), 4U);
+
+      CHECK_EQUAL(4U, encoder.encode(input, etl::span<char>(output.data(), output.size())));
+      encoder.reset();
+      CHECK_EQUAL(0U, encoder.flush_size());
+      CHECK_EQUAL(0U, encoder.flush(etl::span<char>(output.data(), output.size())));
+
+      CHECK_EQUAL(4U, encoder.encode(input, etl::span<char>(output.data(), output.size())));
+      CHECK_EQUAL(4U, encoder.flush(etl::span<char>(output.data() + 4U, 4U)));
+
+      CHECK_EQUAL(encoded[4], std::string(output.data(), output.size()));
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_overflow)
+    {
+      etl::base64_encoder encoder;
+
+      std::array<char, 4> output;
+
+      CHECK_THROW((encoder.encode(input_data_unsigned_char.data(), 6U, output.data(), output.size())), etl::base64_overflow);
+
+      CHECK_EQUAL(0U, encoder.encode(input_data_unsigned_char.data(), 2U, output.data(), output.size()));
+      CHECK_THROW((encoder.flush(output.data(), 3U)), etl::base64_overflow);
+    }
+
+    //*************************************************************************
+#if ETL_USING_CPP14
+    constexpr etl::array<char, 16> GetConstexprEncoderBase64()
+    {
+      etl::array<char, 16> output{ 0 };
+
+      const int8_t input[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::base64_encoder encoder;
+
+      size_t length = encoder.encode(input, 5U, output._buffer, 16U);
+      length += encoder.encode(input + 5U, 5U, output._buffer + length, 16U - length);
+      encoder.flush(output._buffer + length, 16U - length);
+
+      return output;
+    }
+
+    TEST(test_encoder_constexpr)
+    {
+      constexpr etl::array<char, 16> output = GetConstexprEncoderBase64();
+
+      CHECK_EQUAL(std::string("AAECAwQFBgcICQ=="), std::string(output.data(), output.size()));
+    }
+#endif
   };
 }
 
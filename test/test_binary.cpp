@@ -2894,6 +2894,241 @@ namespace
       CHECK_EQUAL(int64_t(0xFFFFFFFFFFFFFF00), (etl::make_msb_mask<int64_t, 56>()));
       CHECK_EQUAL(int64_t(0xFFFFFFFFFFFFFFFF), (etl::make_msb_mask<int64_t, 64>()));
     }
+
+    //*************************************************************************
+    TEST(test_zigzag)
+    {
+      CHECK_EQUAL(0U, etl::zigzag_encode(int32_t(0)));
+      CHECK_EQUAL(1U, etl::zigzag_encode(int32_t(-1)));
+      CHECK_EQUAL(2U, etl::zigzag_encode(int32_t(1)));
+      CHECK_EQUAL(3U, etl::zigzag_encode(int32_t(-2)));
+      CHECK_EQUAL(0xFFFFFFFEUL, etl::zigzag_encode(std::numeric_limits<int32_t>::max()));
+      CHECK_EQUAL(0xFFFFFFFFUL, etl::zigzag_encode(std::numeric_limits<int32_t>::min()));
+      CHECK_EQUAL(0xFFU, etl::zigzag_encode(int8_t(-128)));
+      CHECK_EQUAL(0xFFFFFFFFFFFFFFFFULL, etl::zigzag_encode(std::numeric_limits<int64_t>::min()));
+
+      for (int32_t i = -70000; i <= 70000; i += 7)
+      {
+        CHECK_EQUAL(i, etl::zigzag_decode(etl::zigzag_encode(i)));
+      }
+
+      for (int i = -128; i <= 127; ++i)
+      {
+        CHECK_EQUAL(i, etl::zigzag_decode(etl::zigzag_encode(int8_t(i))));
+      }
+
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), etl::zigzag_decode(etl::zigzag_encode(std::numeric_limits<int64_t>::min())));
+      CHECK_EQUAL(std::numeric_limits<int64_t>::max(), etl::zigzag_decode(etl::zigzag_encode(std::numeric_limits<int64_t>::max())));
+
+#if ETL_USING_CPP11
+      static_assert(etl::zigzag_encode(int16_t(-3)) == 5U, "zigzag_encode not constexpr");
+      static_assert(etl::zigzag_decode(uint16_t(5U)) == -3, "zigzag_decode not constexpr");
+#endif
+    }
+
+    //*************************************************************************
+    template <typename T>
+    static void check_bit_operation_limits()
+    {
+      const T zero = 0U;
+      const T one  = 1U;
+      const T top  = static_cast<T>(one << (etl::integral_limits<T>::bits - 1U));
+      const T all  = static_cast<T>(~zero);
+
+      CHECK_EQUAL(0U, etl::count_bits(zero));
+      CHECK_EQUAL(etl::integral_limits<T>::bits, etl::count_bits(all));
+      CHECK_EQUAL(etl::integral_limits<T>::bits, etl::count_trailing_zeros(zero));
+      CHECK_EQUAL(etl::integral_limits<T>::bits, etl::count_leading_zeros(zero));
+      CHECK_EQUAL(etl::integral_limits<T>::bits - 1U, etl::count_trailing_zeros(top));
+      CHECK_EQUAL(etl::integral_limits<T>::bits - 1U, etl::count_leading_zeros(one));
+      CHECK_EQUAL(0U, etl::count_leading_zeros(top));
+      CHECK_EQUAL(0U, etl::first_set_bit_position(one));
+      CHECK_EQUAL(top, etl::reverse_bits(one));
+      CHECK_EQUAL(all, etl::reverse_bytes(all));
+    }
+
+    //*************************************************************************
+    template <typename T>
+    static T reference_bit_deposit(T value, T mask)
+    {
+      T result = 0U;
+      int   k  = 0;
+
+      for (int i = 0; i < etl::integral_limits<T>::bits; ++i)
+      {
+        if ((mask >> i) & 1U)
+        {
+          if ((value >> k) & 1U)
+          {
+            result |= T(T(1U) << i);
+          }
+
+          ++k;
+        }
+      }
+
+      return result;
+    }
+
+    template <typename T>
+    static T reference_bit_extract(T value, T mask)
+    {
+      T result = 0U;
+      int   k  = 0;
+
+      for (int i = 0; i < etl::integral_limits<T>::bits; ++i)
+      {
+        if ((mask >> i) & 1U)
+        {
+          if ((value >> i) & 1U)
+          {
+            result |= T(T(1U) << k);
+          }
+
+          ++k;
+        }
+      }
+
+      return result;
+    }
+
+    template <typename T>
+    static void check_bit_deposit_extract()
+    {
+      etl::fnv_1a_64 hash;
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        hash.add(uint8_t(i));
+        const T value = T(hash.value());
+        hash.add(uint8_t(i));
+        const T mask  = T(hash.value() >> (i % 8U));
+
+        CHECK_EQUAL(reference_bit_deposit(value, mask), etl::bit_deposit(value, mask));
+        CHECK_EQUAL(reference_bit_extract(value, mask), etl::bit_extract(value, mask));
+        CHECK_EQUAL(value & mask, etl::bit_deposit(etl::bit_extract(value, mask), mask));
+
+        // The nth set bit is where a deposit puts bit n.
+        for (size_t n = 0U; n < size_t(etl::integral_limits<T>::bits); ++n)
+        {
+          const T bit = T(T(1U) << n);
+          const T deposited = reference_bit_deposit(bit, mask);
+
+          CHECK_EQUAL(deposited == 0U ? etl::integral_limits<T>::bits : test_trailing_zeros(deposited), etl::nth_set_bit_position(mask, n));
+        }
+      }
+    }
+
+    TEST(test_bit_deposit_extract)
+    {
+      check_bit_deposit_extract<uint8_t>();
+      check_bit_deposit_extract<uint16_t>();
+      check_bit_deposit_extract<uint32_t>();
+      check_bit_deposit_extract<uint64_t>();
+
+      CHECK_EQUAL(0x00ABU, etl::bit_extract(uint16_t(0xA0B0U), uint16_t(0xF0F0U)));
+      CHECK_EQUAL(0xA0B0U, etl::bit_deposit(uint16_t(0x00ABU), uint16_t(0xF0F0U)));
+      CHECK_EQUAL(0U, etl::nth_set_bit_position(uint32_t(0x00000101UL), 0U));
+      CHECK_EQUAL(8U, etl::nth_set_bit_position(uint32_t(0x00000101UL), 1U));
+      CHECK_EQUAL(32U, etl::nth_set_bit_position(uint32_t(0x00000101UL), 2U));
+      CHECK_EQUAL(64U, etl::nth_set_bit_position(uint64_t(0U), 0U));
+
+#if ETL_USING_CPP14
+      static_assert(etl::bit_deposit(uint32_t(0x0AUL), uint32_t(0xF0UL)) == 0xA0UL, "bit_deposit not constexpr");
+      static_assert(etl::bit_extract(uint32_t(0xA0UL), uint32_t(0xF0UL)) == 0x0AUL, "bit_extract not constexpr");
+      static_assert(etl::nth_set_bit_position(uint32_t(0x00000101UL), 1U) == 8U, "nth_set_bit_position not constexpr");
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_morton_2d)
+    {
+      for (uint32_t i = 0U; i < 65536U; i += 7U)
+      {
+        const uint16_t x = uint16_t(i);
+        const uint16_t y = uint16_t(i * 40503U);
+
+        const uint32_t code32 = etl::morton_encode(x, y);
+        CHECK_EQUAL(etl::binary_interleave(x, y), code32);
+
+        uint16_t x16 = 0U;
+        uint16_t y16 = 0U;
+        etl::morton_decode(code32, x16, y16);
+        CHECK_EQUAL(x, x16);
+        CHECK_EQUAL(y, y16);
+
+        const uint32_t lx = uint32_t(x) * 65537UL;
+        const uint32_t ly = uint32_t(y) * 40503UL;
+
+        const uint64_t code64 = etl::morton_encode(lx, ly);
+        CHECK_EQUAL(etl::binary_interleave(lx, ly), code64);
+
+        uint32_t x32 = 0U;
+        uint32_t y32 = 0U;
+        etl::morton_decode(code64, x32, y32);
+        CHECK_EQUAL(lx, x32);
+        CHECK_EQUAL(ly, y32);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_morton_3d)
+    {
+      // x in bits 0, 3, 6..., y in bits 1, 4, 7..., z in bits 2, 5, 8...
+      CHECK_EQUAL(0x09249249UL, etl::morton_encode(uint16_t(0x3FFU), uint16_t(0U), uint16_t(0U)));
+      CHECK_EQUAL(0x12492492UL, etl::morton_encode(uint16_t(0U), uint16_t(0x3FFU), uint16_t(0U)));
+      CHECK_EQUAL(0x24924924UL, etl::morton_encode(uint16_t(0U), uint16_t(0U), uint16_t(0x3FFU)));
+      CHECK_EQUAL(0x7FFFFFFFFFFFFFFFULL, etl::morton_encode(uint32_t(0x1FFFFFUL), uint32_t(0x1FFFFFUL), uint32_t(0x1FFFFFUL)));
+      CHECK_EQUAL(0x0000000000000007ULL, etl::morton_encode(uint32_t(1U), uint32_t(1U), uint32_t(1U)));
+
+      for (uint32_t i = 0U; i < 100000U; i += 13U)
+      {
+        const uint16_t x = uint16_t(i & 0x3FFU);
+        const uint16_t y = uint16_t((i * 7U) & 0x3FFU);
+        const uint16_t z = uint16_t((i * 13U) & 0x3FFU);
+
+        uint16_t x16 = 0U;
+        uint16_t y16 = 0U;
+        uint16_t z16 = 0U;
+        etl::morton_decode(etl::morton_encode(x, y, z), x16, y16, z16);
+        CHECK_EQUAL(x, x16);
+        CHECK_EQUAL(y, y16);
+        CHECK_EQUAL(z, z16);
+
+        const uint32_t lx = (i * 21U) & 0x1FFFFFUL;
+        const uint32_t ly = (i * 40503U) & 0x1FFFFFUL;
+        const uint32_t lz = (i * 65537U) & 0x1FFFFFUL;
+
+        const uint64_t code = etl::morton_encode(lx, ly, lz);
+        CHECK_EQUAL(etl::bit_deposit(uint64_t(lx), uint64_t(0x1249249249249249ULL)) |
+                    etl::bit_deposit(uint64_t(ly), uint64_t(0x2492492492492492ULL)) |
+                    etl::bit_deposit(uint64_t(lz), uint64_t(0x4924924924924924ULL)), code);
+
+        uint32_t x32 = 0U;
+        uint32_t y32 = 0U;
+        uint32_t z32 = 0U;
+        etl::morton_decode(code, x32, y32, z32);
+        CHECK_EQUAL(lx, x32);
+        CHECK_EQUAL(ly, y32);
+        CHECK_EQUAL(lz, z32);
+      }
+    }
+
+    TEST(test_bit_operation_limits)
+    {
+      check_bit_operation_limits<uint8_t>();
+      check_bit_operation_limits<uint16_t>();
+      check_bit_operation_limits<uint32_t>();
+      check_bit_operation_limits<uint64_t>();
+      check_bit_operation_limits<unsigned char>();
+      check_bit_operation_limits<unsigned short>();
+      check_bit_operation_limits<unsigned int>();
+      check_bit_operation_limits<unsigned long>();
+      check_bit_operation_limits<unsigned long long>();
+      CHECK_EQUAL(0x0201U, etl::reverse_bytes(uint16_t(0x0102U)));
+      CHECK_EQUAL(0x04030201UL, etl::reverse_bytes(uint32_t(0x01020304UL)));
+      CHECK_EQUAL(0x0807060504030201ULL, etl::reverse_bytes(uint64_t(0x0102030405060708ULL)));
+    }
   };
 }
 
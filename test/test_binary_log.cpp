@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/binary_log.h"
+#include "etl/string.h"
+
+#include <string>
+
+namespace
+{
+  typedef etl::binary_log_record<16> Record;
+
+  SUITE(test_binary_log)
+  {
+    //*************************************************************************
+    TEST(test_write_and_read_all_types)
+    {
+      char buffer[256];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::little);
+
+      int              value = 0;
+      const int32_t    i32   = -100000;
+      etl::string<8>   text("etl");
+      etl::string_view view("view");
+
+      CHECK(etl::binary_log_write(writer, 1234U, int8_t(-5), uint16_t(65535U), i32, uint64_t(0xFFFFFFFFFFFFFFFFULL),
+                                                 true, 'Z', 1.5f, 2.25, "literal", text, view, &value));
+
+      CHECK_EQUAL(etl::binary_log_size(int8_t(-5), uint16_t(65535U), i32, uint64_t(0xFFFFFFFFFFFFFFFFULL),
+                                       true, 'Z', 1.5f, 2.25, "literal", text, view, &value),
+                  writer.size_bytes());
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::little);
+      Record record;
+
+      CHECK(etl::binary_log_read(reader, record));
+      CHECK_EQUAL(1234U, record.id);
+      CHECK_EQUAL(12U, record.size);
+
+      CHECK_EQUAL(etl::binary_log_type::Int8,    record.arguments[0].type);
+      CHECK_EQUAL(-5,                            record.arguments[0].signed_value);
+      CHECK_EQUAL(etl::binary_log_type::UInt16,  record.arguments[1].type);
+      CHECK_EQUAL(65535U,                        record.arguments[1].unsigned_value);
+      CHECK_EQUAL(etl::binary_log_type::Int32,   record.arguments[2].type);
+      CHECK_EQUAL(-100000,                       record.arguments[2].signed_value);
+      CHECK_EQUAL(etl::binary_log_type::UInt64,  record.arguments[3].type);
+      CHECK_EQUAL(0xFFFFFFFFFFFFFFFFULL,         record.arguments[3].unsigned_value);
+      CHECK_EQUAL(etl::binary_log_type::Bool,    record.arguments[4].type);
+      CHECK_EQUAL(1,                             record.arguments[4].signed_value);
+      CHECK_EQUAL(etl::binary_log_type::Char,    record.arguments[5].type);
+      CHECK_EQUAL('Z',                           record.arguments[5].signed_value);
+      CHECK_EQUAL(etl::binary_log_type::Float,   record.arguments[6].type);
+      CHECK_CLOSE(1.5,                           record.arguments[6].floating_value, 0.0);
+      CHECK_EQUAL(etl::binary_log_type::Double,  record.arguments[7].type);
+      CHECK_CLOSE(2.25,                          record.arguments[7].floating_value, 0.0);
+      CHECK_EQUAL(etl::binary_log_type::String,  record.arguments[8].type);
+      CHECK(etl::string_view("literal") ==       record.arguments[8].text);
+      CHECK(etl::string_view("etl") ==           record.arguments[9].text);
+      CHECK(etl::string_view("view") ==          record.arguments[10].text);
+      CHECK_EQUAL(etl::binary_log_type::Pointer, record.arguments[11].type);
+      CHECK_EQUAL(reinterpret_cast<uintptr_t>(&value), record.arguments[11].unsigned_value);
+
+      // Nothing more to read.
+      CHECK(!etl::binary_log_read(reader, record));
+    }
+
+    //*************************************************************************
+    TEST(test_format)
+    {
+      char buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+
+      CHECK(etl::binary_log_write(writer, 1U, -42, 7U, "pump", false, 0.1));
+      CHECK(etl::binary_log_write(writer, 2U));
+
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::big);
+      Record record;
+      etl::string<64> str;
+
+      CHECK(etl::binary_log_read(reader, record));
+      etl::binary_log_format("{{{}}} {} {} {} {} {}", record, str);
+      CHECK_EQUAL(std::string("{-42} 7 pump false 0.1 "), std::string(str.c_str()));
+
+      str.clear();
+      CHECK(etl::binary_log_read(reader, record));
+      CHECK_EQUAL(2U, record.id);
+      CHECK_EQUAL(0U, record.size);
+      etl::binary_log_format("No arguments", record, str);
+      CHECK_EQUAL(std::string("No arguments"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_write_when_full)
+    {
+      char buffer[8];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::little);
+
+      CHECK(etl::binary_log_write(writer, 1U, 1U));
+      CHECK_EQUAL(8U, writer.size_bytes());
+
+      CHECK(!etl::binary_log_write(writer, 2U, uint8_t(1U)));
+      CHECK_EQUAL(8U, writer.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_read_invalid_records)
+    {
+      char buffer[64];
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::little);
+
+      CHECK(etl::binary_log_write(writer, 1U, 1, 2, 3));
+
+      // Truncated.
+      etl::byte_stream_reader truncated(buffer, writer.size_bytes() - 1U, etl::endian::little);
+      Record record;
+      CHECK(!etl::binary_log_read(truncated, record));
+
+      // Too many arguments for the record.
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::little);
+      etl::binary_log_record<2> small_record;
+      CHECK(!etl::binary_log_read(reader, small_record));
+
+      // Unknown type tag.
+      buffer[3] = char(200);
+      etl::byte_stream_reader bad_tag(buffer, writer.size_bytes(), etl::endian::little);
+      CHECK(!etl::binary_log_read(bad_tag, record));
+    }
+
+#if ETL_HAS_ATOMIC
+    //*************************************************************************
+    TEST(test_bip_buffer)
+    {
+      etl::bip_buffer_spsc_atomic<char, 64> buffer;
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(etl::binary_log_write(buffer, uint16_t(10 + i), i, "abc"));
+      }
+
+      etl::span<char> data = buffer.read_reserve();
+      etl::byte_stream_reader reader(data.data(), data.size(), etl::endian::little);
+
+      Record record;
+      etl::string<32> str;
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(etl::binary_log_read(reader, record));
+        CHECK_EQUAL(10 + i, record.id);
+
+        str.clear();
+        etl::binary_log_format("{}:{}", record, str);
+        CHECK_EQUAL(std::to_string(i) + ":abc", std::string(str.c_str()));
+      }
+
+      CHECK(!etl::binary_log_read(reader, record));
+      buffer.read_commit(data);
+      CHECK(buffer.empty());
+
+      // Not enough space.
+      etl::bip_buffer_spsc_atomic<char, 8> small_buffer;
+      CHECK(!etl::binary_log_write(small_buffer, 1U, uint64_t(0U)));
+      CHECK(small_buffer.empty());
+    }
+#endif
+  }
+}
@@ -881,6 +881,102 @@ namespace
       CHECK_EQUAL((int)expected[10], (int)storage[10]);
       CHECK_EQUAL((int)expected[11], (int)storage[11]);
     }
+
+    //*************************************************************************
+    TEST(test_write_random_widths_against_bitwise_reference)
+    {
+      std::array<char, 256> storage;
+      std::array<char, 256> expected;
+      storage.fill(0);
+      expected.fill(0);
+
+      std::vector<uint64_t>      values;
+      std::vector<uint_least8_t> widths;
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      uint64_t random = 0x9E3779B97F4A7C15ULL;
+      size_t   position = 0U;
+
+      while (bit_stream.available_bits() >= 64U)
+      {
+        random = (random * 6364136223846793005ULL) + 1442695040888963407ULL;
+
+        const uint_least8_t width = static_cast<uint_least8_t>(1U + ((random >> 32) % 64U));
+        const uint64_t      value = (width == 64U) ? random : (random & ((uint64_t(1U) << width) - 1U));
+
+        CHECK(bit_stream.write(random, width));
+
+        values.push_back(value);
+        widths.push_back(width);
+
+        // Set the expected bits one at a time.
+        for (uint_least8_t b = 1U; b <= width; ++b)
+        {
+          if (((value >> (b - 1U)) & 1U) != 0U)
+          {
+            expected[position / 8U] |= char(0x80U >> (position % 8U));
+          }
+
+          ++position;
+        }
+      }
+
+      CHECK_EQUAL(position, bit_stream.size_bits());
+      CHECK(expected == storage);
+
+      // Read them back.
+      etl::bit_stream_reader reader(storage.data(), storage.size(), etl::endian::little);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        etl::optional<uint64_t> result = reader.read<uint64_t>(widths[i]);
+
+        CHECK(result.has_value());
+        CHECK_EQUAL(values[i], result.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_packed)
+    {
+      std::array<int32_t, 9> values = { -1000, -990, -1000, -745, -999, -1000, -800, -875, -1000 };
+
+      std::array<char, 24> storage;
+      storage.fill(0);
+
+      etl::bit_stream_writer bit_stream(storage.data(), storage.size(), etl::endian::little);
+
+      // 32 bit minimum + 7 bit width + 9 offsets of 8 bits (largest is 255).
+      CHECK_EQUAL(32U + 7U + (9U * 8U), etl::bit_stream_writer::packed_size_bits(values.data(), values.size()));
+
+      CHECK(bit_stream.write_packed(values.data(), values.size()));
+      CHECK_EQUAL(32U + 7U + (9U * 8U), bit_stream.size_bits());
+
+      // All equal values pack to a width of zero.
+      std::array<uint8_t, 5> constants = { 7U, 7U, 7U, 7U, 7U };
+      CHECK(bit_stream.write_packed(constants.data(), constants.size()));
+      CHECK_EQUAL(32U + 7U + (9U * 8U) + 8U + 7U, bit_stream.size_bits());
+
+      // Not enough space.
+      CHECK_FALSE(bit_stream.write_packed(values.data(), values.size()));
+
+      etl::bit_stream_reader reader(storage.data(), bit_stream.size_bytes(), etl::endian::little);
+
+      std::array<int32_t, 9> output;
+      CHECK(reader.read_packed(output.data(), output.size()));
+      CHECK(values == output);
+
+      std::array<uint8_t, 5> constants_output;
+      CHECK(reader.read_packed(constants_output.data(), constants_output.size()));
+      CHECK(constants == constants_output);
+
+      // Incomplete block.
+      etl::bit_stream_reader short_reader(storage.data(), 10U, etl::endian::little);
+      CHECK_FALSE(short_reader.read_packed(output.data(), output.size()));
+      CHECK_EQUAL(80U, short_reader.size_bits());
+      CHECK_EQUAL(values[0], short_reader.read<int32_t>().value());
+    }
   };
 }
 
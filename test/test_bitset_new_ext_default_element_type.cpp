@@ -1832,6 +1832,83 @@ namespace
       CHECK_EQUAL(4U, bs4fnt1);
     }
 
+    //*************************************************************************
+    TEST(test_bulk_operations_large_bitset)
+    {
+      // Large enough to use the vector paths, with a partial vector at the end.
+      etl::bitset_ext<4100, uint8_t>::buffer_type buffer_a8;
+      etl::bitset_ext<4100, uint8_t> a8(buffer_a8);
+      etl::bitset_ext<4100, uint8_t>::buffer_type buffer_b8;
+      etl::bitset_ext<4100, uint8_t> b8(buffer_b8);
+      etl::bitset_ext<4100, uint64_t>::buffer_type buffer_a64;
+      etl::bitset_ext<4100, uint64_t> a64(buffer_a64);
+      etl::bitset_ext<4100, uint64_t>::buffer_type buffer_b64;
+      etl::bitset_ext<4100, uint64_t> b64(buffer_b64);
+      std::bitset<4100> compare_a;
+      std::bitset<4100> compare_b;
+
+      uint32_t seed = 4242U;
+
+      for (size_t i = 0U; i < 4100U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        bool value_a = ((seed >> 16U) & 1U) != 0U;
+        bool value_b = ((seed >> 17U) & 3U) == 0U;
+
+        a8.set(i, value_a);
+        a64.set(i, value_a);
+        compare_a.set(i, value_a);
+        b8.set(i, value_b);
+        b64.set(i, value_b);
+        compare_b.set(i, value_b);
+      }
+
+      CHECK_EQUAL(compare_a.count(), a8.count());
+      CHECK_EQUAL(compare_a.count(), a64.count());
+      CHECK(!(a8 == b8));
+      CHECK(!(a64 == b64));
+
+      a8 &= b8;
+      a64 &= b64;
+      compare_a &= compare_b;
+      CHECK_EQUAL(compare_a.count(), a8.count());
+      CHECK_EQUAL(compare_a.count(), a64.count());
+
+      a8 |= b8;
+      a64 |= b64;
+      compare_a |= compare_b;
+      CHECK(a8 == b8);
+      CHECK(a64 == b64);
+
+      a8 ^= b8;
+      a64 ^= b64;
+      compare_a ^= compare_b;
+      CHECK(a8.none());
+      CHECK(a64.none());
+
+      b8.flip();
+      b64.flip();
+      compare_b.flip();
+      CHECK_EQUAL(compare_b.count(), b8.count());
+      CHECK_EQUAL(compare_b.count(), b64.count());
+
+      for (size_t i = 0U; i < 4100U; ++i)
+      {
+        CHECK_EQUAL(compare_b.test(i), b8.test(i));
+        CHECK_EQUAL(compare_b.test(i), b64.test(i));
+      }
+
+      // A difference in the last bit only.
+      a8 = b8;
+      a64 = b64;
+      CHECK(a8 == b8);
+      CHECK(a64 == b64);
+      a8.flip(4099);
+      a64.flip(4099);
+      CHECK(!(a8 == b8));
+      CHECK(!(a64 == b64));
+    }
+
     //*************************************************************************
     TEST(test_find_next_github_issue_617)
     {
@@ -70,6 +70,16 @@ struct hash3_t
   }
 };
 
+struct packet_hash_t
+{
+  typedef uint32_t argument_type;
+
+  size_t operator ()(argument_type id) const
+  {
+    return id;
+  }
+};
+
 std::vector<const char*> exist_text     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
 std::vector<const char*> not_exist_text = { "My", "hovercraft", "is", "full", "of", "eels" };
 
@@ -260,6 +270,214 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      typedef etl::blocked_bloom_filter<2048, hash1_t> Bloom;
+
+      CHECK_EQUAL(4, Bloom::BLOCK_COUNT);
+      CHECK_EQUAL(2048U, Bloom().width());
+      CHECK_EQUAL(1, (etl::blocked_bloom_filter<1, hash1_t>::BLOCK_COUNT));
+
+      Bloom bloom;
+
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      for (size_t i = 0UL; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      size_t count = bloom.count();
+      CHECK(count > 0U);
+      CHECK(count <= (3U * exist_text.size()));
+
+      bloom.clear();
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK_EQUAL(0U, bloom.usage());
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter_false_positive_rate)
+    {
+      // 10 bits per key with 7 hashes is about 1% for a classic filter.
+      etl::blocked_bloom_filter<8192, packet_hash_t, 7> bloom;
+
+      for (uint32_t id = 0U; id < 800U; ++id)
+      {
+        bloom.add(id * 2654435761U);
+      }
+
+      bool all_exist = true;
+
+      for (uint32_t id = 0U; id < 800U; ++id)
+      {
+        all_exist = all_exist && bloom.exists(id * 2654435761U);
+      }
+
+      CHECK(all_exist);
+
+      size_t false_positives = 0U;
+
+      for (uint32_t id = 800U; id < 20800U; ++id)
+      {
+        false_positives += bloom.exists(id * 2654435761U) ? 1U : 0U;
+      }
+
+      CHECK(false_positives < 600U); // < 3%
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter)
+    {
+      etl::counting_bloom_filter<1000, packet_hash_t, 4> bloom;
+
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (uint32_t id = 0U; id < 50U; ++id)
+      {
+        bloom.add(id);
+      }
+
+      // Added twice, must be removed twice.
+      bloom.add(7U);
+
+      for (uint32_t id = 0U; id < 50U; ++id)
+      {
+        CHECK(bloom.exists(id));
+      }
+
+      for (uint32_t id = 0U; id < 50U; ++id)
+      {
+        CHECK(bloom.remove(id));
+      }
+
+      CHECK(bloom.exists(7U));
+      CHECK(bloom.remove(7U));
+      CHECK(!bloom.exists(7U));
+      CHECK(!bloom.remove(7U));
+
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK_EQUAL(0U, bloom.usage());
+
+      bloom.add(1U);
+      bloom.clear();
+      CHECK(!bloom.exists(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_counting_bloom_filter_saturation)
+    {
+      etl::counting_bloom_filter<64, packet_hash_t, 2, uint8_t> bloom;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        bloom.add(42U);
+      }
+
+      // Saturated counters are sticky.
+      for (int i = 0; i < 300; ++i)
+      {
+        bloom.remove(42U);
+      }
+
+      CHECK(bloom.exists(42U));
+    }
+
+    //*************************************************************************
+    TEST(test_cuckoo_filter)
+    {
+      typedef etl::cuckoo_filter<1000, packet_hash_t> Filter;
+
+      CHECK_EQUAL(512, Filter::BUCKET_COUNT);
+
+      Filter filter;
+
+      CHECK(filter.empty());
+      CHECK_EQUAL(2048U, filter.max_size());
+
+      for (uint32_t id = 0U; id < 1000U; ++id)
+      {
+        CHECK(filter.add(id));
+      }
+
+      CHECK_EQUAL(1000U, filter.size());
+      CHECK(!filter.full());
+
+      for (uint32_t id = 0U; id < 1000U; ++id)
+      {
+        CHECK(filter.exists(id));
+      }
+
+      size_t false_positives = 0U;
+
+      for (uint32_t id = 1000U; id < 21000U; ++id)
+      {
+        false_positives += filter.exists(id) ? 1U : 0U;
+      }
+
+      CHECK(false_positives < 20U); // About 0.01% for 16 bit fingerprints.
+
+      for (uint32_t id = 0U; id < 1000U; id += 2U)
+      {
+        CHECK(filter.remove(id));
+      }
+
+      CHECK_EQUAL(500U, filter.size());
+
+      for (uint32_t id = 1U; id < 1000U; id += 2U)
+      {
+        CHECK(filter.exists(id));
+      }
+
+      filter.clear();
+      CHECK(filter.empty());
+      CHECK(!filter.exists(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_cuckoo_filter_full)
+    {
+      etl::cuckoo_filter<64, packet_hash_t, uint16_t, 4, 50> filter;
+
+      const size_t max_size = filter.max_size();
+
+      uint32_t id = 0U;
+
+      while (filter.add(id))
+      {
+        ++id;
+      }
+
+      CHECK(filter.full());
+      CHECK(filter.size() <= max_size);
+      CHECK(filter.size() > (max_size / 2U));
+
+      // Every key added is still found, including the victim.
+      for (uint32_t i = 0U; i < id; ++i)
+      {
+        CHECK(filter.exists(i));
+      }
+
+      // Removing keys eventually frees a slot in a bucket of the victim.
+      uint32_t removed = 0U;
+
+      while (filter.full() && (removed < id))
+      {
+        CHECK(filter.remove(removed));
+        ++removed;
+      }
+
+      CHECK(!filter.full());
+      CHECK_EQUAL(id - removed, filter.size());
+      CHECK(filter.add(id));
+    }
   };
 }
-
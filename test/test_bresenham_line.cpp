@@ -31,6 +31,8 @@ SOFTWARE.
 #include "etl/bresenham_line.h"
 
 #include <vector>
+#include <algorithm>
+#include <cstdlib>
 
 namespace etl
 {
@@ -60,6 +62,88 @@ namespace
 
   using BresenhamLine = etl::bresenham_line<Value>;
 
+  //***************************************************************************
+  std::vector<Point> iterate(BresenhamLine& bl)
+  {
+    std::vector<Point> points;
+
+    for (BresenhamLine::const_iterator itr = bl.begin(); itr != bl.end(); ++itr)
+    {
+      points.push_back(*itr);
+
+      if (points.size() > 1000U)
+      {
+        break;
+      }
+    }
+
+    return points;
+  }
+
+  //***************************************************************************
+  struct PointCollector
+  {
+    PointCollector(std::vector<Point>& points_)
+      : points(points_)
+    {
+    }
+
+    void operator()(const Point& point)
+    {
+      points.push_back(point);
+    }
+
+    std::vector<Point>& points;
+  };
+
+  //***************************************************************************
+  /// Expands each run back to its points.
+  //***************************************************************************
+  struct RunCollector
+  {
+    RunCollector(std::vector<Point>& points_, std::vector<BresenhamLine::run_type>& runs_)
+      : points(points_)
+      , runs(runs_)
+    {
+    }
+
+    void operator()(const BresenhamLine::run_type& run)
+    {
+      runs.push_back(run);
+
+      Point p = run.first;
+
+      for (size_t i = 0U; i < run.length(); ++i)
+      {
+        points.push_back(p);
+
+        if (run.is_horizontal())
+        {
+          p.x = Value(p.x + ((run.last.x < run.first.x) ? -1 : 1));
+        }
+        else
+        {
+          p.y = Value(p.y + ((run.last.y < run.first.y) ? -1 : 1));
+        }
+      }
+    }
+
+    std::vector<Point>& points;
+    std::vector<BresenhamLine::run_type>& runs;
+  };
+
+  //***************************************************************************
+  /// Lines in every octant, plus the horizontal, vertical and 45 degree cases.
+  //***************************************************************************
+  const Value Lines[][4] =
+  {
+    { -5, -3,  5,  3 }, {  5,  3, -5, -3 }, {  5, -3, -5,  3 }, { -5,  3,  5, -3 },
+    { -3, -5,  3,  5 }, {  3,  5, -3, -5 }, {  3, -5, -3,  5 }, { -3,  5,  3, -5 },
+    { -5,  5,  5,  5 }, {  5,  5, -5,  5 }, {  5, -5,  5,  5 }, {  5,  5,  5, -5 },
+    {  0,  0,  7,  7 }, {  7,  7,  0,  0 }, {  0,  7,  7,  0 }, {  7,  0,  0,  7 },
+    {  0,  0, 20,  3 }, {  3,  0,  5, 40 }, {  1,  2,  1,  2 }, { -9,  4, 11, -2 }
+  };
+
   SUITE(test_bresenham_line)
   {
     //*************************************************************************
@@ -419,6 +503,213 @@ namespace
       CHECK_ARRAY_EQUAL(expected.data(), actual.data(), (std::max(expected.size(), actual.size())));
     }
 
+    //*************************************************************************
+    TEST(diagonal_45_degree_lines)
+    {
+      BresenhamLine bl(0, 0, 3, 3);
+
+      std::vector<Point> expected{ Point{ 0, 0 }, Point{ 1, 1 }, Point{ 2, 2 }, Point{ 3, 3 } };
+      std::vector<Point> actual = iterate(bl);
+
+      CHECK_EQUAL(expected.size(), bl.size());
+      CHECK_EQUAL(expected.size(), actual.size());
+      CHECK_ARRAY_EQUAL(expected.data(), actual.data(), (std::min(expected.size(), actual.size())));
+
+      bl.reset(3, 0, 0, 3);
+
+      expected = { Point{ 3, 0 }, Point{ 2, 1 }, Point{ 1, 2 }, Point{ 0, 3 } };
+      actual   = iterate(bl);
+
+      CHECK_EQUAL(expected.size(), actual.size());
+      CHECK_ARRAY_EQUAL(expected.data(), actual.data(), (std::min(expected.size(), actual.size())));
+    }
+
+    //*************************************************************************
+    TEST(iterate_twice)
+    {
+      BresenhamLine bl(-5, -3, 5, 3);
+
+      std::vector<Point> first_pass  = iterate(bl);
+      std::vector<Point> second_pass = iterate(bl);
+
+      CHECK_EQUAL(first_pass.size(), second_pass.size());
+      CHECK_ARRAY_EQUAL(first_pass.data(), second_pass.data(), (std::min(first_pass.size(), second_pass.size())));
+    }
+
+    //*************************************************************************
+    TEST(for_each_matches_iteration)
+    {
+      for (size_t i = 0U; i < sizeof(Lines) / sizeof(Lines[0]); ++i)
+      {
+        BresenhamLine bl(Lines[i][0], Lines[i][1], Lines[i][2], Lines[i][3]);
+
+        std::vector<Point> expected = iterate(bl);
+        std::vector<Point> actual;
+
+        bl.for_each(PointCollector(actual));
+
+        CHECK_EQUAL(expected.size(), actual.size());
+        CHECK_ARRAY_EQUAL(expected.data(), actual.data(), (std::min(expected.size(), actual.size())));
+      }
+    }
+
+    //*************************************************************************
+    TEST(for_each_run_matches_iteration)
+    {
+      for (size_t i = 0U; i < sizeof(Lines) / sizeof(Lines[0]); ++i)
+      {
+        BresenhamLine bl(Lines[i][0], Lines[i][1], Lines[i][2], Lines[i][3]);
+
+        std::vector<Point> expected = iterate(bl);
+        std::vector<Point> actual;
+        std::vector<BresenhamLine::run_type> runs;
+
+        bl.for_each_run(RunCollector(actual, runs));
+
+        CHECK_EQUAL(expected.size(), actual.size());
+        CHECK_ARRAY_EQUAL(expected.data(), actual.data(), (std::min(expected.size(), actual.size())));
+
+        // Consecutive runs step once on the minor axis.
+        const bool x_major = std::abs(Lines[i][2] - Lines[i][0]) >= std::abs(Lines[i][3] - Lines[i][1]);
+
+        for (size_t r = 1U; r < runs.size(); ++r)
+        {
+          if (x_major)
+          {
+            CHECK_EQUAL(1, std::abs(runs[r].first.y - runs[r - 1U].first.y));
+          }
+          else
+          {
+            CHECK_EQUAL(1, std::abs(runs[r].first.x - runs[r - 1U].first.x));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(for_each_run_lengths)
+    {
+      std::vector<Point> points;
+      std::vector<BresenhamLine::run_type> runs;
+
+      // Horizontal is one run.
+      BresenhamLine horizontal(-5, 5, 5, 5);
+      horizontal.for_each_run(RunCollector(points, runs));
+      CHECK_EQUAL(1U, runs.size());
+      CHECK_EQUAL(11U, runs[0].length());
+      CHECK_TRUE(runs[0].is_horizontal());
+
+      // Vertical is one run.
+      runs.clear();
+      BresenhamLine vertical(2, 5, 2, -5);
+      vertical.for_each_run(RunCollector(points, runs));
+      CHECK_EQUAL(1U, runs.size());
+      CHECK_EQUAL(11U, runs[0].length());
+      CHECK_FALSE(runs[0].is_horizontal());
+
+      // A shallow line is a few long runs.
+      runs.clear();
+      BresenhamLine shallow(0, 0, 20, 3);
+      shallow.for_each_run(RunCollector(points, runs));
+      CHECK_EQUAL(4U, runs.size());
+
+      size_t total = 0U;
+      for (size_t r = 0U; r < runs.size(); ++r)
+      {
+        total += runs[r].length();
+      }
+
+      CHECK_EQUAL(21U, total);
+    }
+
+    //*************************************************************************
+    TEST(clip_inside)
+    {
+      BresenhamLine bl(1, 1, 8, 4);
+
+      CHECK_TRUE(bl.clip(Point{ 0, 0 }, Point{ 9, 9 }));
+      CHECK_EQUAL((Point{ 1, 1 }), bl.front());
+      CHECK_EQUAL((Point{ 8, 4 }), bl.back());
+    }
+
+    //*************************************************************************
+    TEST(clip_outside)
+    {
+      BresenhamLine bl(-8, -1, -2, 5);
+
+      CHECK_FALSE(bl.clip(0, 0, 9, 9));
+      CHECK_EQUAL((Point{ -8, -1 }), bl.front());
+      CHECK_EQUAL((Point{ -2,  5 }), bl.back());
+
+      // Crosses the corner region without entering.
+      bl.reset(-5, 3, 3, -5);
+      CHECK_FALSE(bl.clip(0, 0, 9, 9));
+    }
+
+    //*************************************************************************
+    TEST(clip_horizontal_and_vertical)
+    {
+      BresenhamLine bl(-20, 4, 30, 4);
+
+      CHECK_TRUE(bl.clip(0, 0, 9, 9));
+      CHECK_EQUAL((Point{ 0, 4 }), bl.front());
+      CHECK_EQUAL((Point{ 9, 4 }), bl.back());
+
+      bl.reset(3, 50, 3, -50);
+
+      CHECK_TRUE(bl.clip(0, 0, 9, 9));
+      CHECK_EQUAL((Point{ 3, 9 }), bl.front());
+      CHECK_EQUAL((Point{ 3, 0 }), bl.back());
+    }
+
+    //*************************************************************************
+    TEST(clip_diagonal)
+    {
+      BresenhamLine bl(-10, -10, 20, 20);
+
+      CHECK_TRUE(bl.clip(0, 0, 9, 9));
+      CHECK_EQUAL((Point{ 0, 0 }), bl.front());
+      CHECK_EQUAL((Point{ 9, 9 }), bl.back());
+
+      std::vector<Point> points = iterate(bl);
+      CHECK_EQUAL(10U, points.size());
+    }
+
+    //*************************************************************************
+    TEST(clip_all_points_inside)
+    {
+      for (size_t i = 0U; i < sizeof(Lines) / sizeof(Lines[0]); ++i)
+      {
+        BresenhamLine bl(Lines[i][0], Lines[i][1], Lines[i][2], Lines[i][3]);
+
+        if (bl.clip(-2, -1, 4, 3))
+        {
+          std::vector<Point> points = iterate(bl);
+
+          for (size_t p = 0U; p < points.size(); ++p)
+          {
+            CHECK_TRUE((points[p].x >= -2) && (points[p].x <= 4));
+            CHECK_TRUE((points[p].y >= -1) && (points[p].y <= 3));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(non_default_work_type)
+    {
+      etl::bresenham_line<int, int32_t> bl(0, 0, 1000, 300);
+
+      size_t count = 0U;
+      for (etl::bresenham_line<int, int32_t>::const_iterator itr = bl.begin(); itr != bl.end(); ++itr)
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(1001U, count);
+      CHECK_EQUAL(1001U, bl.size());
+    }
+
     //*************************************************************************
     TEST(test_equality)
     {
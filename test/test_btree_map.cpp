@@ -0,0 +1,556 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "data.h"
+
+#include "etl/btree_map.h"
+
+namespace
+{
+  typedef TestDataDC<std::string> DC;
+
+  //*************************************************************************
+  template <typename TMap, typename TCompare>
+  bool Check_Equal(const TMap& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  //*************************************************************************
+  // Random inserts and erases, checked against std::map.
+  template <size_t VNode_Size>
+  void test_random(int seed)
+  {
+    static const size_t Max = 500U;
+
+    etl::btree_map<int, int, Max, etl::less<int>, VNode_Size> data;
+    std::map<int, int> compare;
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> key_distribution(0, 1000);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      const int key = key_distribution(generator);
+
+      if ((compare.size() < Max) && ((generator() % 3U) != 0U))
+      {
+        CHECK_EQUAL(compare.insert(std::make_pair(key, i)).second, data.insert(std::make_pair(key, i)).second);
+      }
+      else
+      {
+        CHECK_EQUAL(compare.erase(key), data.erase(key));
+      }
+
+      CHECK_EQUAL(compare.size(), data.size());
+    }
+
+    CHECK(Check_Equal(data, compare));
+    CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+    for (int key = -1; key <= 1001; ++key)
+    {
+      CHECK_EQUAL(compare.count(key), data.count(key));
+
+      if (compare.lower_bound(key) == compare.end())
+      {
+        CHECK(data.lower_bound(key) == data.end());
+      }
+      else
+      {
+        CHECK_EQUAL(compare.lower_bound(key)->first, data.lower_bound(key)->first);
+      }
+
+      if (compare.upper_bound(key) == compare.end())
+      {
+        CHECK(data.upper_bound(key) == data.end());
+      }
+      else
+      {
+        CHECK_EQUAL(compare.upper_bound(key)->first, data.upper_bound(key)->first);
+      }
+    }
+  }
+
+  SUITE(test_btree_map)
+  {
+    static const size_t SIZE = 100;
+
+    typedef etl::btree_map<int, DC, SIZE, etl::less<int>, 8U> DataDC;
+    typedef etl::ibtree_map<int, DC, etl::less<int>, 8U>     IDataDC;
+
+    typedef std::map<int, DC> Compare_Data;
+
+    //*************************************************************************
+    std::vector<std::pair<int, DC> > make_data(int first, int count)
+    {
+      std::vector<std::pair<int, DC> > data;
+
+      for (int i = first; i < (first + count); ++i)
+      {
+        data.push_back(std::make_pair(i, DC(std::string("V") + std::to_string(i))));
+      }
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.rbegin() == data.rend());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+      std::shuffle(initial_data.begin(), initial_data.end(), std::mt19937(1));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      etl::btree_map<int, int, SIZE> data = { { 3, 30 }, { 1, 10 }, { 2, 20 } };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(30, data.at(3));
+      CHECK_EQUAL(1, data.begin()->first);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_constructor)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      DataDC data2(data);
+
+      CHECK(data2 == data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      DataDC data2(std::move(data));
+
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data2, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_interface)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data1(initial_data.begin(), initial_data.end());
+      DataDC data2(initial_data.begin(), initial_data.begin() + 10);
+
+      IDataDC& idata1 = data1;
+      IDataDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      DataDC data;
+
+      data[2] = DC("B");
+      data[1] = DC("A");
+      data[2] = DC("C");
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(DC("A"), data[1]);
+      CHECK_EQUAL(DC("C"), data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, 10);
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      const DataDC& cdata = data;
+
+      CHECK_EQUAL(DC("V5"), data.at(5));
+      CHECK_EQUAL(DC("V5"), cdata.at(5));
+      CHECK_THROW(data.at(10), etl::btree_map_out_of_bounds);
+      CHECK_THROW(cdata.at(10), etl::btree_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataDC data;
+
+      ETL_OR_STD::pair<DataDC::iterator, bool> result = data.insert(std::make_pair(1, DC("A")));
+
+      CHECK(result.second);
+      CHECK_EQUAL(1, result.first->first);
+      CHECK_EQUAL(DC("A"), result.first->second);
+
+      // Duplicates are not inserted.
+      result = data.insert(std::make_pair(1, DC("B")));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(DC("A"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+
+      DataDC::iterator itr = data.insert(data.begin(), std::make_pair(0, DC("Z")));
+
+      CHECK_EQUAL(0, itr->first);
+      CHECK_EQUAL(0, data.begin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+
+      // An existing key is fine when full.
+      CHECK(!data.insert(initial_data[0]).second);
+
+      CHECK_THROW(data.insert(std::make_pair(1000, DC("Excess"))), etl::btree_map_full);
+      CHECK_THROW(data[1000], etl::btree_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_fill_and_drain)
+    {
+      // Ascending and descending orders give the most nodes.
+      etl::btree_map<int, int, 1000, etl::less<int>, 4U> data;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 999; i >= 0; --i)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      CHECK(data.empty());
+
+      for (int i = 999; i >= 0; --i)
+      {
+        data[i] = i;
+      }
+
+      CHECK(data.full());
+
+      int expected = 0;
+
+      for (etl::btree_map<int, int, 1000, etl::less<int>, 4U>::const_iterator itr = data.cbegin(); itr != data.cend(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        ++expected;
+      }
+
+      CHECK_EQUAL(1000, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      const DataDC& cdata = data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        CHECK_EQUAL(i, data.find(i)->first);
+        CHECK_EQUAL(i, cdata.find(i)->first);
+        CHECK_EQUAL(1U, data.count(i));
+        CHECK(data.contains(i));
+      }
+
+      CHECK(data.find(-1) == data.end());
+      CHECK(cdata.find(int(SIZE)) == cdata.end());
+      CHECK_EQUAL(0U, data.count(int(SIZE)));
+      CHECK(!data.contains(int(SIZE)));
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_and_equal_range)
+    {
+      DataDC data;
+
+      for (int i = 0; i < 40; i += 2)
+      {
+        data[i] = DC("X");
+      }
+
+      CHECK_EQUAL(10, data.lower_bound(10)->first);
+      CHECK_EQUAL(12, data.lower_bound(11)->first);
+      CHECK_EQUAL(12, data.upper_bound(10)->first);
+      CHECK(data.lower_bound(39) == data.end());
+      CHECK(data.upper_bound(38) == data.end());
+
+      ETL_OR_STD::pair<DataDC::iterator, DataDC::iterator> range = data.equal_range(10);
+
+      CHECK_EQUAL(10, range.first->first);
+      CHECK_EQUAL(12, range.second->first);
+
+      range = data.equal_range(11);
+
+      CHECK(range.first == range.second);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      for (int i = 0; i < int(SIZE); i += 3)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+        compare.erase(i);
+      }
+
+      CHECK_EQUAL(0U, data.erase(0));
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      DataDC::iterator itr = data.find(20);
+      itr = data.erase(itr);
+      compare.erase(20);
+
+      CHECK_EQUAL(21, itr->first);
+
+      // Erase every other element.
+      itr = data.begin();
+
+      while (itr != data.end())
+      {
+        compare.erase(itr->first);
+        itr = data.erase(itr);
+
+        if (itr != data.end())
+        {
+          ++itr;
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      DataDC::iterator itr = data.erase(data.find(10), data.find(60));
+      compare.erase(compare.find(10), compare.find(60));
+
+      CHECK_EQUAL(60, itr->first);
+      CHECK(Check_Equal(data, compare));
+
+      itr = data.erase(data.find(80), data.end());
+      compare.erase(compare.find(80), compare.end());
+
+      CHECK(itr == data.end());
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+      CHECK(data.begin() == data.end());
+
+      // The nodes are available again.
+      data.assign(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+      DataDC data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.cbegin(), data.cend(), compare.cbegin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+      CHECK(std::equal(data.crbegin(), data.crend(), compare.crbegin()));
+
+      DataDC::iterator itr = data.end();
+      --itr;
+
+      CHECK_EQUAL(int(SIZE) - 1, itr->first);
+    }
+
+    //*************************************************************************
+    TEST(test_comparisons)
+    {
+      std::vector<std::pair<int, DC> > initial_data = make_data(0, 10);
+
+      DataDC data1(initial_data.begin(), initial_data.end());
+      DataDC data2(initial_data.begin(), initial_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+
+      data2[3] = DC("Z");
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+      CHECK(data1 <= data2);
+      CHECK(data2 > data1);
+      CHECK(data2 >= data1);
+    }
+
+    //*************************************************************************
+    TEST(test_key_compare_greater)
+    {
+      etl::btree_map<int, int, SIZE, etl::greater<int>, 4U> data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data[i] = i;
+      }
+
+      CHECK_EQUAL(int(SIZE) - 1, data.begin()->first);
+      CHECK_EQUAL(50, data.lower_bound(50)->first);
+      CHECK_EQUAL(49, data.upper_bound(50)->first);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      etl::btree_map<std::string, int, SIZE, etl::less<> > data;
+
+      data[std::string("A")] = 1;
+      data[std::string("B")] = 2;
+
+      CHECK_EQUAL(2, data.find("B")->second);
+      CHECK_EQUAL(1, data.at("A"));
+      CHECK(data.contains("A"));
+      CHECK_EQUAL(1U, data.erase("A"));
+      CHECK(!data.contains("A"));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_values_destroyed)
+    {
+      DC::reset_instance_count();
+
+      {
+        std::vector<std::pair<int, DC> > initial_data = make_data(0, int(SIZE));
+
+        DataDC data(initial_data.begin(), initial_data.end());
+
+        for (int i = 0; i < int(SIZE); i += 2)
+        {
+          data.erase(i);
+        }
+
+        data.erase(data.find(51), data.find(81));
+      }
+
+      CHECK_EQUAL(0, DC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase)
+    {
+      test_random<4U>(1);
+      test_random<5U>(2);
+      test_random<16U>(3);
+      test_random<32U>(4);
+    }
+  };
+}
@@ -0,0 +1,311 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "data.h"
+
+#include "etl/btree_set.h"
+
+namespace
+{
+  typedef TestDataNDC<std::string> NDC;
+
+  //*************************************************************************
+  template <typename TSet, typename TCompare>
+  bool Check_Equal(const TSet& data, const TCompare& compare)
+  {
+    return (data.size() == compare.size()) &&
+           std::equal(data.begin(), data.end(), compare.begin());
+  }
+
+  //*************************************************************************
+  // Random inserts and erases of non-trivial keys, checked against std::set.
+  template <size_t VNode_Size>
+  void test_random(int seed)
+  {
+    static const size_t Max = 300U;
+
+    etl::btree_set<NDC, Max, etl::less<NDC>, VNode_Size> data;
+    std::set<NDC> compare;
+
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> key_distribution(0, 600);
+
+    for (int i = 0; i < 10000; ++i)
+    {
+      const NDC key(std::to_string(key_distribution(generator)));
+
+      if ((compare.size() < Max) && ((generator() % 3U) != 0U))
+      {
+        CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+      }
+      else
+      {
+        CHECK_EQUAL(compare.erase(key), data.erase(key));
+      }
+    }
+
+    CHECK(Check_Equal(data, compare));
+    CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+    // Drain in random order.
+    std::vector<NDC> keys(compare.begin(), compare.end());
+    std::shuffle(keys.begin(), keys.end(), generator);
+
+    for (size_t i = 0U; i < keys.size(); ++i)
+    {
+      CHECK_EQUAL(1U, data.erase(keys[i]));
+    }
+
+    CHECK(data.empty());
+  }
+
+  SUITE(test_btree_set)
+  {
+    static const size_t SIZE = 100;
+
+    typedef etl::btree_set<int, SIZE, etl::less<int>, 8U> DataInt;
+    typedef etl::ibtree_set<int, etl::less<int>, 8U>      IDataInt;
+
+    typedef std::set<int> Compare_Data;
+
+    //*************************************************************************
+    std::vector<int> make_data(int first, int count)
+    {
+      std::vector<int> data;
+
+      for (int i = first; i < (first + count); ++i)
+      {
+        data.push_back(i);
+      }
+
+      std::shuffle(data.begin(), data.end(), std::mt19937(first));
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataInt data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<int> initial_data = make_data(0, int(SIZE));
+
+      DataInt data(initial_data.begin(), initial_data.end());
+
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { 3, 1, 2 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, *data.begin());
+      CHECK_EQUAL(3, *data.rbegin());
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      std::vector<int> initial_data = make_data(0, int(SIZE));
+
+      DataInt data(initial_data.begin(), initial_data.end());
+      DataInt data2(data);
+
+      CHECK(data2 == data);
+
+      DataInt data3(std::move(data2));
+
+      CHECK(data3 == data);
+
+      DataInt data4;
+      data4 = data3;
+
+      CHECK(data4 == data);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_interface)
+    {
+      std::vector<int> initial_data = make_data(0, int(SIZE));
+
+      DataInt data1(initial_data.begin(), initial_data.end());
+      DataInt data2;
+
+      IDataInt& idata1 = data1;
+      IDataInt& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataInt data;
+
+      ETL_OR_STD::pair<DataInt::iterator, bool> result = data.insert(1);
+
+      CHECK(result.second);
+      CHECK_EQUAL(1, *result.first);
+
+      // Duplicates are not inserted.
+      result = data.insert(1);
+
+      CHECK(!result.second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      std::vector<int> initial_data = make_data(0, int(SIZE));
+
+      DataInt data(initial_data.begin(), initial_data.end());
+
+      // An existing key is fine when full.
+      CHECK(!data.insert(0).second);
+
+      CHECK_THROW(data.insert(1000), etl::btree_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      DataInt data;
+
+      for (int i = 0; i < 40; i += 2)
+      {
+        data.insert(i);
+      }
+
+      const DataInt& cdata = data;
+
+      CHECK_EQUAL(10, *data.find(10));
+      CHECK_EQUAL(10, *cdata.find(10));
+      CHECK(data.find(11) == data.end());
+      CHECK_EQUAL(1U, data.count(10));
+      CHECK_EQUAL(0U, data.count(11));
+      CHECK(data.contains(38));
+      CHECK_EQUAL(12, *data.lower_bound(11));
+      CHECK_EQUAL(12, *cdata.upper_bound(10));
+      CHECK(data.upper_bound(38) == data.end());
+
+      ETL_OR_STD::pair<DataInt::const_iterator, DataInt::const_iterator> range = cdata.equal_range(10);
+
+      CHECK_EQUAL(10, *range.first);
+      CHECK_EQUAL(12, *range.second);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      std::vector<int> initial_data = make_data(0, int(SIZE));
+
+      DataInt data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(5));
+      CHECK_EQUAL(0U, data.erase(5));
+      compare.erase(5);
+
+      DataInt::iterator itr = data.erase(data.find(6));
+      compare.erase(6);
+
+      CHECK_EQUAL(7, *itr);
+
+      itr = data.erase(data.find(20), data.find(70));
+      compare.erase(compare.find(20), compare.find(70));
+
+      CHECK_EQUAL(70, *itr);
+      CHECK(Check_Equal(data, compare));
+
+      data.clear();
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_comparisons)
+    {
+      DataInt data1;
+      DataInt data2;
+
+      data1.insert(1);
+      data1.insert(2);
+      data2.insert(1);
+      data2.insert(3);
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+      CHECK(data1 <= data2);
+      CHECK(data2 > data1);
+      CHECK(data2 >= data1);
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase)
+    {
+      NDC::reset_instance_count();
+
+      test_random<4U>(1);
+      test_random<7U>(2);
+      test_random<16U>(3);
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+  };
+}
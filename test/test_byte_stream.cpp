@@ -35,6 +35,7 @@ SOFTWARE.
 
 #include <array>
 #include <numeric>
+#include <limits>
 #include <vector>
 
 #include "etl/private/diagnostic_useless_cast_push.h"
@@ -1336,6 +1337,277 @@ namespace
         CHECK_EQUAL(expected[i], result[i]);
       }
     }
+    //*************************************************************************
+    template <typename T>
+    void CheckRangeMatchesSingleValues(etl::endian endianness)
+    {
+      std::vector<T> values(41U);
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        values[i] = static_cast<T>((i * 0x0102030405060708ULL) ^ 0xA5A5A5A5A5A5A5A5ULL);
+      }
+
+      for (size_t length = 0U; length <= values.size(); ++length)
+      {
+        std::vector<char> expected((values.size() * sizeof(T)) + 1U);
+        std::vector<char> actual((values.size() * sizeof(T)) + 1U);
+
+        etl::byte_stream_writer single_writer(expected.data(), expected.size(), endianness);
+        etl::byte_stream_writer range_writer(actual.data(), actual.size(), endianness);
+
+        // Write an offset byte, so that the ranges are not aligned.
+        single_writer.write(char(0x5A));
+        range_writer.write(char(0x5A));
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          single_writer.write(values[i]);
+        }
+
+        CHECK(range_writer.write(etl::span<T>(values.data(), length)));
+        CHECK_EQUAL(single_writer.size_bytes(), range_writer.size_bytes());
+        CHECK(expected == actual);
+
+        std::vector<T> output(length + 1U);
+
+        etl::byte_stream_reader reader(actual.data(), range_writer.size_bytes(), endianness);
+        CHECK_EQUAL(int(char(0x5A)), int(reader.read<char>().value()));
+        CHECK(reader.read<T>(output.data(), length).has_value());
+        CHECK(std::equal(output.begin(), output.begin() + length, values.begin()));
+        CHECK(reader.empty());
+      }
+    }
+
+    TEST(write_read_ranges_against_single_values)
+    {
+      CheckRangeMatchesSingleValues<uint16_t>(etl::endian::big);
+      CheckRangeMatchesSingleValues<uint16_t>(etl::endian::little);
+      CheckRangeMatchesSingleValues<int32_t>(etl::endian::big);
+      CheckRangeMatchesSingleValues<int32_t>(etl::endian::little);
+      CheckRangeMatchesSingleValues<uint64_t>(etl::endian::big);
+      CheckRangeMatchesSingleValues<uint64_t>(etl::endian::little);
+      CheckRangeMatchesSingleValues<char>(etl::endian::big);
+    }
+
+    //*************************************************************************
+    TEST(write_range_callback_per_value)
+    {
+      std::array<char, 4 * sizeof(int32_t)> storage;
+      std::array<int32_t, 4> put_data = { int32_t(0x00000001), int32_t(0xA55AA55A), int32_t(0x5AA55AA5), int32_t(0xFFFFFFFF) };
+
+      std::vector<size_t> sizes;
+
+      auto record_size = [&](etl::byte_stream_writer::callback_parameter_type sp)
+                         {
+                           sizes.push_back(sp.size());
+                         };
+
+      etl::byte_stream_writer::callback_type callback(record_size);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big, callback);
+
+      CHECK(writer.write(put_data.data(), put_data.size()));
+      CHECK_EQUAL(4U, sizes.size());
+      CHECK_EQUAL(sizeof(int32_t), sizes[0]);
+      CHECK_EQUAL(sizeof(int32_t), sizes[3]);
+    }
+
+    //*************************************************************************
+    TEST(read_view)
+    {
+      const etl::endian native  = etl::endianness::value();
+      const etl::endian foreign = (native == etl::endian::little) ? etl::endian::big : etl::endian::little;
+
+      alignas(uint32_t) std::array<char, 4 * sizeof(uint32_t)> storage;
+      std::array<uint32_t, 3> put_data = { 0x01020304U, 0xA55AA55AU, 0xFFFFFFFFU };
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), native);
+      CHECK(writer.write(put_data.data(), put_data.size()));
+      CHECK(writer.write(uint32_t(0x12345678U)));
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), native);
+
+      // Not enough data.
+      CHECK_FALSE(reader.read_view<uint32_t>(5U).has_value());
+
+      etl::optional<etl::span<const uint32_t> > view = reader.read_view<uint32_t>(3U);
+      CHECK(view.has_value());
+      CHECK_EQUAL(3U, view.value().size());
+      CHECK(view.value().data() == reinterpret_cast<const uint32_t*>(storage.data()));
+      CHECK_EQUAL(put_data[0], view.value()[0]);
+      CHECK_EQUAL(put_data[1], view.value()[1]);
+      CHECK_EQUAL(put_data[2], view.value()[2]);
+      CHECK_EQUAL(0x12345678U, reader.read<uint32_t>().value());
+
+      // Misaligned.
+      etl::byte_stream_reader misaligned_reader(storage.data(), storage.size(), native);
+      misaligned_reader.skip<char>(1U);
+      CHECK_FALSE(misaligned_reader.read_view<uint32_t>(1U).has_value());
+      CHECK_EQUAL(storage.size() - 1U, misaligned_reader.available_bytes());
+
+      // Single bytes are always viewable.
+      CHECK(misaligned_reader.read_view<uint8_t>(3U).has_value());
+      CHECK(misaligned_reader.read_view<uint32_t>(1U).has_value());
+
+      // Endianness mismatch.
+      etl::byte_stream_reader foreign_reader(storage.data(), storage.size(), foreign);
+      CHECK_FALSE(foreign_reader.read_view<uint32_t>(1U).has_value());
+      CHECK(foreign_reader.read_view<char>(4U).has_value());
+    }
+
+    //*************************************************************************
+    TEST(write_read_varint_encoding)
+    {
+      std::array<char, 32> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+
+      CHECK(writer.write_varint(uint32_t(1U)));
+      CHECK(writer.write_varint(uint32_t(300U)));
+      CHECK(writer.write_varint(int32_t(-1)));
+      CHECK(writer.write_varint(int32_t(-65)));
+      CHECK(writer.write_varint(std::numeric_limits<uint64_t>::max()));
+
+      CHECK_EQUAL(1U,  etl::byte_stream_writer::varint_size(uint32_t(1U)));
+      CHECK_EQUAL(2U,  etl::byte_stream_writer::varint_size(uint32_t(300U)));
+      CHECK_EQUAL(10U, etl::byte_stream_writer::varint_size(std::numeric_limits<uint64_t>::max()));
+
+      const std::array<unsigned char, 16> expected = { 0x01, 0xAC, 0x02, 0x01, 0x81, 0x01,
+                                                       0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 };
+
+      CHECK_EQUAL(expected.size(), writer.size_bytes());
+
+      for (size_t i = 0U; i < expected.size(); ++i)
+      {
+        CHECK_EQUAL(int(expected[i]), int(static_cast<unsigned char>(storage[i])));
+      }
+
+      etl::byte_stream_reader reader(storage.data(), writer.size_bytes(), etl::endian::little);
+
+      CHECK_EQUAL(1U,   reader.read_varint<uint32_t>().value());
+      CHECK_EQUAL(300U, reader.read_varint<uint32_t>().value());
+      CHECK_EQUAL(-1,   reader.read_varint<int32_t>().value());
+      CHECK_EQUAL(-65,  reader.read_varint<int32_t>().value());
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), reader.read_varint<uint64_t>().value());
+      CHECK(reader.empty());
+      CHECK_FALSE(reader.read_varint<uint32_t>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(write_read_varint_ranges)
+    {
+      std::vector<int64_t> values;
+
+      for (int shift = 0; shift < 63; ++shift)
+      {
+        values.push_back(int64_t(1) << shift);
+        values.push_back(-(int64_t(1) << shift));
+        values.push_back((int64_t(1) << shift) - 1);
+      }
+
+      values.push_back(std::numeric_limits<int64_t>::min());
+      values.push_back(std::numeric_limits<int64_t>::max());
+
+      std::vector<char> storage(etl::byte_stream_writer::varint_size(values.data(), values.size()));
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+      CHECK(writer.write_varint(values.data(), values.size()));
+      CHECK_EQUAL(storage.size(), writer.size_bytes());
+      CHECK_FALSE(writer.write_varint(int8_t(0)));
+
+      std::vector<int64_t> output(values.size());
+
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::big);
+      CHECK(reader.read_varint(output.data(), output.size()).has_value());
+      CHECK(values == output);
+    }
+
+    //*************************************************************************
+    TEST(read_varint_invalid)
+    {
+      // Truncated.
+      const std::array<char, 2> truncated = { char(0x80), char(0x80) };
+      etl::byte_stream_reader truncated_reader(truncated.data(), truncated.size(), etl::endian::little);
+      CHECK_FALSE(truncated_reader.read_varint<uint32_t>().has_value());
+      CHECK_EQUAL(2U, truncated_reader.available_bytes());
+
+      // Too long for the type.
+      const std::array<char, 3> too_long = { char(0x80), char(0x80), char(0x01) };
+      etl::byte_stream_reader too_long_reader(too_long.data(), too_long.size(), etl::endian::little);
+      CHECK_FALSE(too_long_reader.read_varint<uint8_t>().has_value());
+      CHECK_EQUAL(3U, too_long_reader.available_bytes());
+      CHECK_EQUAL(0x4000U, too_long_reader.read_varint<uint16_t>().value());
+
+      // A range where the last is truncated.
+      int32_t values[2];
+      const std::array<char, 2> range = { char(0x02), char(0x80) };
+      etl::byte_stream_reader range_reader(range.data(), range.size(), etl::endian::little);
+      CHECK_FALSE(range_reader.read_varint(values, 2U).has_value());
+      CHECK_EQUAL(2U, range_reader.available_bytes());
+    }
+
+    //*************************************************************************
+    TEST(write_read_stream_vbyte)
+    {
+      std::vector<uint32_t> values;
+
+      for (uint32_t i = 0U; i < 203U; ++i)
+      {
+        // A mix of 1, 2, 3 and 4 byte values.
+        const uint32_t magnitude = (i * 7U) % 32U;
+        values.push_back(((uint32_t(1U) << magnitude) - 1U) ^ (i * 0x9E3779B9UL & ((uint32_t(1U) << magnitude) - 1U)));
+      }
+
+      for (size_t length = 0U; length <= values.size(); length += ((length < 24U) ? 1U : 33U))
+      {
+        const size_t size = etl::byte_stream_writer::stream_vbyte_size(values.data(), length);
+
+        std::vector<char> storage(size + 1U);
+
+        etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+        CHECK(writer.write_stream_vbyte(values.data(), length));
+        CHECK_EQUAL(size, writer.size_bytes());
+
+        std::vector<uint32_t> output(length + 1U, 0xDEADBEEFUL);
+
+        etl::byte_stream_reader reader(storage.data(), writer.size_bytes(), etl::endian::little);
+        CHECK(reader.read_stream_vbyte(output.data(), length).has_value());
+        CHECK(reader.empty());
+        CHECK(std::equal(values.begin(), values.begin() + length, output.begin()));
+        CHECK_EQUAL(0xDEADBEEFUL, output[length]);
+
+        if (length != 0U)
+        {
+          // Incomplete block.
+          etl::byte_stream_reader short_reader(storage.data(), writer.size_bytes() - 1U, etl::endian::little);
+          CHECK_FALSE(short_reader.read_stream_vbyte(output.data(), length).has_value());
+          CHECK_EQUAL(writer.size_bytes() - 1U, short_reader.available_bytes());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(write_stream_vbyte_layout)
+    {
+      const std::array<uint32_t, 5> values = { 0x01U, 0x0203U, 0x040506U, 0x0708090AUL, 0x0BU };
+
+      std::array<char, 13> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+      CHECK(writer.write_stream_vbyte(values.data(), values.size()));
+      CHECK_FALSE(writer.write_stream_vbyte(values.data(), 1U));
+
+      const std::array<unsigned char, 13> expected = { 0xE4, 0x00,
+                                                       0x01, 0x03, 0x02, 0x06, 0x05, 0x04, 0x0A, 0x09, 0x08, 0x07,
+                                                       0x0B };
+
+      for (size_t i = 0U; i < expected.size(); ++i)
+      {
+        CHECK_EQUAL(int(expected[i]), int(static_cast<unsigned char>(storage[i])));
+      }
+    }
+
     //*************************************************************************
     TEST(read_byte_stream_skip)
     {
@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/byte_stream_schema.h"
+
+#include <array>
+
+namespace
+{
+  enum class Mode : uint16_t
+  {
+    Idle    = 1,
+    Running = 0x1234
+  };
+
+  struct Sample
+  {
+    int32_t  x;
+    uint8_t  flags;
+    double   value;
+    Mode     mode;
+    uint16_t channels[3];
+    bool     enabled;
+  };
+
+  typedef etl::byte_stream_schema<Sample,
+                                  ETL_BYTE_STREAM_FIELD(Sample, x),
+                                  ETL_BYTE_STREAM_FIELD(Sample, flags),
+                                  ETL_BYTE_STREAM_FIELD(Sample, value),
+                                  ETL_BYTE_STREAM_FIELD(Sample, mode),
+                                  ETL_BYTE_STREAM_FIELD(Sample, channels),
+                                  ETL_BYTE_STREAM_FIELD(Sample, enabled)> SampleSchema;
+
+  Sample CreateSample()
+  {
+    Sample sample;
+
+    sample.x           = -123456;
+    sample.flags       = 0xA5U;
+    sample.value       = 3.25;
+    sample.mode        = Mode::Running;
+    sample.channels[0] = 0x0102U;
+    sample.channels[1] = 0x0304U;
+    sample.channels[2] = 0xFFFEU;
+    sample.enabled     = true;
+
+    return sample;
+  }
+
+  SUITE(test_byte_stream_schema)
+  {
+    //*************************************************************************
+    TEST(test_sizes_and_offsets)
+    {
+      static_assert(SampleSchema::Size == (4U + 1U + 8U + 2U + 6U + 1U), "Wrong size");
+      static_assert(SampleSchema::Number_Of_Fields == 6U, "Wrong number of fields");
+
+      static_assert(SampleSchema::offset_of<0>::value == 0U,  "Wrong offset");
+      static_assert(SampleSchema::offset_of<1>::value == 4U,  "Wrong offset");
+      static_assert(SampleSchema::offset_of<2>::value == 5U,  "Wrong offset");
+      static_assert(SampleSchema::offset_of<3>::value == 13U, "Wrong offset");
+      static_assert(SampleSchema::offset_of<4>::value == 15U, "Wrong offset");
+      static_assert(SampleSchema::offset_of<5>::value == 21U, "Wrong offset");
+
+      CHECK_EQUAL(22U, SampleSchema::Size);
+    }
+
+    //*************************************************************************
+    TEST(test_write_big_endian_layout)
+    {
+      std::array<char, SampleSchema::Size> storage;
+      storage.fill(0);
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::big);
+
+      CHECK(SampleSchema::write(writer, CreateSample()));
+      CHECK_EQUAL(SampleSchema::Size, writer.size_bytes());
+
+      const std::array<unsigned char, SampleSchema::Size> expected =
+      {
+        0xFF, 0xFE, 0x1D, 0xC0,                         // x
+        0xA5,                                           // flags
+        0x40, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // value
+        0x12, 0x34,                                     // mode
+        0x01, 0x02, 0x03, 0x04, 0xFF, 0xFE,             // channels
+        0x01                                            // enabled
+      };
+
+      for (size_t i = 0U; i < expected.size(); ++i)
+      {
+        CHECK_EQUAL(int(expected[i]), int(static_cast<unsigned char>(storage[i])));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_round_trip)
+    {
+      const etl::endian endiannesses[] = { etl::endian::big, etl::endian::little };
+
+      for (etl::endian endianness : endiannesses)
+      {
+        std::array<char, SampleSchema::Size + 1U> storage;
+
+        etl::byte_stream_writer writer(storage.data(), storage.size(), endianness);
+
+        const Sample input = CreateSample();
+        CHECK(SampleSchema::write(writer, input));
+
+        Sample output = {};
+        etl::byte_stream_reader reader(storage.data(), writer.size_bytes(), endianness);
+        CHECK(SampleSchema::read(reader, output));
+        CHECK(reader.empty());
+
+        CHECK_EQUAL(input.x,     output.x);
+        CHECK_EQUAL(input.flags, output.flags);
+        CHECK_EQUAL(input.value, output.value);
+        CHECK(input.mode == output.mode);
+        CHECK_EQUAL(input.channels[0], output.channels[0]);
+        CHECK_EQUAL(input.channels[1], output.channels[1]);
+        CHECK_EQUAL(input.channels[2], output.channels[2]);
+        CHECK_EQUAL(input.enabled, output.enabled);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_insufficient_space)
+    {
+      std::array<char, SampleSchema::Size - 1U> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+      CHECK_FALSE(SampleSchema::write(writer, CreateSample()));
+      CHECK_EQUAL(0U, writer.size_bytes());
+
+      Sample output = {};
+      etl::byte_stream_reader reader(storage.data(), storage.size(), etl::endian::little);
+      CHECK_FALSE(SampleSchema::read(reader, output));
+      CHECK_EQUAL(storage.size(), reader.available_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_view)
+    {
+      std::array<char, SampleSchema::Size> storage;
+
+      etl::byte_stream_writer writer(storage.data(), storage.size(), etl::endian::little);
+      SampleSchema::write_unchecked(writer, CreateSample());
+
+      SampleSchema::view view(storage.data(), storage.size(), etl::endian::little);
+      CHECK(view.is_valid());
+      CHECK(view.data().data() == storage.data());
+
+      CHECK_EQUAL(-123456, view.get<0>());
+      CHECK_EQUAL(0xA5U, view.get<1>());
+      CHECK_EQUAL(3.25, view.get<2>());
+      CHECK(Mode::Running == view.get<3>());
+
+      etl::array<uint16_t, 3> channels = view.get<4>();
+      CHECK_EQUAL(0x0102U, channels[0]);
+      CHECK_EQUAL(0x0304U, channels[1]);
+      CHECK_EQUAL(0xFFFEU, channels[2]);
+
+      CHECK(view.get<5>());
+
+      Sample output = {};
+      view.unpack(output);
+      CHECK_EQUAL(-123456, output.x);
+      CHECK_EQUAL(0xFFFEU, output.channels[2]);
+
+      SampleSchema::view short_view(etl::span<const char>(storage.data(), storage.size() - 1U), etl::endian::little);
+      CHECK_FALSE(short_view.is_valid());
+    }
+  };
+}
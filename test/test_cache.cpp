@@ -0,0 +1,565 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/cache.h"
+
+#include <map>
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::icache<int, std::string> ICache;
+  typedef ICache::value_type            Entry;
+
+  //***************************************************************************
+  // A backing store that counts its reads and writes.
+  struct Store
+  {
+    Store()
+      : reads(0U)
+      , writes(0U)
+    {
+    }
+
+    bool read(Entry& entry)
+    {
+      ++reads;
+
+      std::map<int, std::string>::const_iterator itr = values.find(entry.first);
+
+      if (itr == values.end())
+      {
+        return false;
+      }
+
+      entry.second = itr->second;
+
+      return true;
+    }
+
+    void write(const Entry& entry)
+    {
+      ++writes;
+      values[entry.first] = entry.second;
+    }
+
+    void attach(ICache& cache)
+    {
+      cache.set_read_function(ICache::read_function_type::create<Store, &Store::read>(*this));
+      cache.set_write_function(ICache::write_function_type::create<Store, &Store::write>(*this));
+    }
+
+    std::map<int, std::string> values;
+    size_t reads;
+    size_t writes;
+  };
+
+  //***************************************************************************
+  // Reference models. The front of each list is the newest entry.
+  struct LruModel
+  {
+    explicit LruModel(size_t capacity_)
+      : capacity(capacity_)
+    {
+    }
+
+    bool get(int key)
+    {
+      for (std::list<int>::iterator itr = keys.begin(); itr != keys.end(); ++itr)
+      {
+        if (*itr == key)
+        {
+          keys.erase(itr);
+          keys.push_front(key);
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    void put(int key)
+    {
+      if (!get(key))
+      {
+        if (keys.size() == capacity)
+        {
+          keys.pop_back();
+        }
+
+        keys.push_front(key);
+      }
+    }
+
+    void erase(int key)
+    {
+      keys.remove(key);
+    }
+
+    size_t capacity;
+    std::list<int> keys;
+  };
+
+  struct SieveModel
+  {
+    struct Node
+    {
+      int  key;
+      bool visited;
+    };
+
+    typedef std::list<Node>::iterator iterator;
+
+    static iterator previous(iterator itr)
+    {
+      return --itr;
+    }
+
+    explicit SieveModel(size_t capacity_)
+      : capacity(capacity_)
+      , hand(nodes.end())
+    {
+    }
+
+    std::list<Node>::iterator find(int key)
+    {
+      for (std::list<Node>::iterator itr = nodes.begin(); itr != nodes.end(); ++itr)
+      {
+        if (itr->key == key)
+        {
+          return itr;
+        }
+      }
+
+      return nodes.end();
+    }
+
+    bool get(int key)
+    {
+      std::list<Node>::iterator itr = find(key);
+
+      if (itr == nodes.end())
+      {
+        return false;
+      }
+
+      itr->visited = true;
+      return true;
+    }
+
+    void remove(std::list<Node>::iterator itr)
+    {
+      if (hand == itr)
+      {
+        hand = (itr == nodes.begin()) ? nodes.end() : previous(itr);
+      }
+
+      nodes.erase(itr);
+    }
+
+    void put(int key)
+    {
+      if (!get(key))
+      {
+        if (nodes.size() == capacity)
+        {
+          std::list<Node>::iterator itr = (hand == nodes.end()) ? previous(nodes.end()) : hand;
+
+          while (itr->visited)
+          {
+            itr->visited = false;
+            itr = (itr == nodes.begin()) ? previous(nodes.end()) : previous(itr);
+          }
+
+          hand = itr;
+          remove(itr);
+        }
+
+        Node node = { key, false };
+        nodes.push_front(node);
+      }
+    }
+
+    void erase(int key)
+    {
+      std::list<Node>::iterator itr = find(key);
+
+      if (itr != nodes.end())
+      {
+        remove(itr);
+      }
+    }
+
+    size_t capacity;
+    std::list<Node> nodes;
+    std::list<Node>::iterator hand;
+  };
+
+  //***************************************************************************
+  std::string to_string(int i)
+  {
+    return std::string("value ") + char('A' + (i % 26)) + char('a' + ((i / 26) % 26));
+  }
+
+  //***************************************************************************
+  // Runs random operations against the cache and the model.
+  template <typename TModel>
+  void check_against_model(ICache& cache, TModel& model, size_t key_range)
+  {
+    uint32_t seed = 1U;
+
+    for (int i = 0; i < 20000; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+
+      const uint32_t operation = (seed >> 16) % 10U;
+      const int      key       = int((seed >> 4) % key_range);
+
+      if (operation < 5U)
+      {
+        CHECK_EQUAL(model.get(key), cache.get(key) != ETL_NULLPTR);
+      }
+      else if (operation < 9U)
+      {
+        model.put(key);
+        cache.put(key, to_string(key));
+      }
+      else
+      {
+        model.erase(key);
+        cache.erase(key);
+      }
+    }
+
+  }
+
+  SUITE(test_cache)
+  {
+    //*************************************************************************
+    TEST(test_lru_put_get)
+    {
+      etl::lru_cache<int, std::string, 3> cache;
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(3U, cache.max_size());
+
+      cache.put(1, "one");
+      cache.put(2, "two");
+      cache.put(3, "three");
+
+      CHECK(cache.full());
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+
+      // 2 is now the least recently used.
+      cache.put(4, "four");
+
+      CHECK_EQUAL(3U, cache.size());
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(1));
+      CHECK(cache.contains(3));
+      CHECK(cache.contains(4));
+      CHECK(cache.get(2) == ETL_NULLPTR);
+
+      // peek does not count as a use.
+      CHECK_EQUAL(std::string("three"), *cache.peek(3));
+      cache.put(5, "five");
+      CHECK(!cache.contains(3));
+
+      // Updating a value counts as a use.
+      cache.put(1, "ONE");
+      cache.put(6, "six");
+      CHECK(!cache.contains(4));
+      CHECK_EQUAL(std::string("ONE"), *cache.get(1));
+    }
+
+    //*************************************************************************
+    TEST(test_sieve_eviction)
+    {
+      etl::sieve_cache<int, std::string, 3> cache;
+
+      cache.put(1, "one");
+      cache.put(2, "two");
+      cache.put(3, "three");
+
+      // A hit does not reorder, it marks 1 as visited.
+      CHECK(cache.get(1) != ETL_NULLPTR);
+
+      // The hand starts at the oldest, 1, clears its flag, and evicts 2.
+      cache.put(4, "four");
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(2));
+      CHECK(cache.contains(3));
+
+      // The hand continues from 3.
+      cache.put(5, "five");
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(3));
+      CHECK(cache.contains(4));
+
+      // The hand moves on towards the newest, past 1, so evicts 4.
+      cache.put(6, "six");
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(4));
+      CHECK(cache.contains(5));
+      CHECK(cache.contains(6));
+
+      // 1 is left behind the hand, which follows the newer entries.
+      cache.put(7, "seven");
+      CHECK(cache.contains(1));
+      CHECK(!cache.contains(5));
+      CHECK(cache.contains(6));
+      CHECK(cache.contains(7));
+    }
+
+    //*************************************************************************
+    TEST(test_lru_against_model)
+    {
+      etl::lru_cache<int, std::string, 16> cache;
+      LruModel model(16U);
+
+      check_against_model(cache, model, 40U);
+
+      CHECK_EQUAL(model.keys.size(), cache.size());
+
+      for (std::list<int>::const_iterator itr = model.keys.begin(); itr != model.keys.end(); ++itr)
+      {
+        CHECK(cache.contains(*itr));
+        CHECK_EQUAL(to_string(*itr), *cache.peek(*itr));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_sieve_against_model)
+    {
+      etl::sieve_cache<int, std::string, 16> cache;
+      SieveModel model(16U);
+
+      check_against_model(cache, model, 40U);
+
+      CHECK_EQUAL(model.nodes.size(), cache.size());
+
+      for (std::list<SieveModel::Node>::const_iterator itr = model.nodes.begin(); itr != model.nodes.end(); ++itr)
+      {
+        CHECK(cache.contains(itr->key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_read_through)
+    {
+      Store store;
+      store.values[1] = "one";
+      store.values[2] = "two";
+
+      etl::lru_cache<int, std::string, 4> cache;
+      store.attach(cache);
+
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+      CHECK_EQUAL(1U, store.reads);
+
+      // A hit does not read.
+      CHECK_EQUAL(std::string("one"), *cache.get(1));
+      CHECK_EQUAL(1U, store.reads);
+
+      // Not in the store.
+      CHECK(cache.get(3) == ETL_NULLPTR);
+      CHECK_EQUAL(2U, store.reads);
+      CHECK_EQUAL(1U, cache.size());
+
+      // peek and contains do not read.
+      CHECK(cache.peek(2) == ETL_NULLPTR);
+      CHECK(!cache.contains(2));
+      CHECK_EQUAL(2U, store.reads);
+
+      // Loaded values are not dirty.
+      CHECK(!cache.is_dirty(1));
+      CHECK_EQUAL(0U, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_write_through)
+    {
+      Store store;
+
+      etl::sieve_cache<int, std::string, 2> cache;
+      store.attach(cache);
+
+      CHECK(cache.is_write_through());
+
+      cache.put(1, "one");
+      CHECK_EQUAL(1U, store.writes);
+      CHECK_EQUAL(std::string("one"), store.values[1]);
+      CHECK(!cache.is_dirty(1));
+
+      cache.put(1, "ONE");
+      CHECK_EQUAL(2U, store.writes);
+      CHECK_EQUAL(std::string("ONE"), store.values[1]);
+
+      // Eviction of clean entries does not write.
+      cache.put(2, "two");
+      cache.put(3, "three");
+      CHECK_EQUAL(4U, store.writes);
+      cache.flush();
+      CHECK_EQUAL(4U, store.writes);
+    }
+
+    //*************************************************************************
+    TEST(test_write_back)
+    {
+      Store store;
+
+      {
+        etl::lru_cache<int, std::string, 2> cache;
+        store.attach(cache);
+        cache.set_write_through(false);
+
+        cache.put(1, "one");
+        cache.put(2, "two");
+        cache.put(2, "TWO");
+        CHECK_EQUAL(0U, store.writes);
+        CHECK(cache.is_dirty(1));
+        CHECK(cache.is_dirty(2));
+
+        // Evicting 1 writes it back.
+        cache.put(3, "three");
+        CHECK_EQUAL(1U, store.writes);
+        CHECK_EQUAL(std::string("one"), store.values[1]);
+
+        // Flush writes the rest, once.
+        cache.flush();
+        CHECK_EQUAL(3U, store.writes);
+        CHECK_EQUAL(std::string("TWO"), store.values[2]);
+        CHECK(!cache.is_dirty(2));
+        cache.flush();
+        CHECK_EQUAL(3U, store.writes);
+
+        // Erase writes back a changed entry.
+        cache.put(3, "THREE");
+        CHECK(cache.erase(3));
+        CHECK(!cache.erase(3));
+        CHECK_EQUAL(4U, store.writes);
+        CHECK_EQUAL(std::string("THREE"), store.values[3]);
+
+        // A reloaded value comes from the store.
+        CHECK_EQUAL(std::string("one"), *cache.get(1));
+
+        cache.put(4, "four");
+      }
+
+      // Destruction writes back as well.
+      CHECK_EQUAL(5U, store.writes);
+      CHECK_EQUAL(std::string("four"), store.values[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Store store;
+
+      etl::sieve_cache<int, std::string, 8> cache;
+      store.attach(cache);
+      cache.set_write_through(false);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        cache.put(i, to_string(i));
+      }
+
+      ICache& icache = cache;
+      icache.clear();
+
+      CHECK(cache.empty());
+      CHECK_EQUAL(8U, store.writes);
+      CHECK_EQUAL(8U, cache.available());
+
+      // Still usable after clearing.
+      for (int i = 0; i < 20; ++i)
+      {
+        cache.put(i, to_string(i));
+        CHECK_EQUAL(to_string(i), *cache.get(i));
+      }
+
+      CHECK_EQUAL(8U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_keys)
+    {
+      // Keys that share low bits, with erasures to exercise the backward shift.
+      etl::lru_cache<int, std::string, 32> cache;
+
+      for (int round = 0; round < 4; ++round)
+      {
+        for (int i = 0; i < 32; ++i)
+        {
+          cache.put(i * 1024, to_string(i));
+        }
+
+        for (int i = 0; i < 32; i += 3)
+        {
+          CHECK(cache.erase(i * 1024));
+        }
+
+        for (int i = 0; i < 32; ++i)
+        {
+          if ((i % 3) == 0)
+          {
+            CHECK(!cache.contains(i * 1024));
+          }
+          else
+          {
+            CHECK_EQUAL(to_string(i), *cache.peek(i * 1024));
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_single_entry)
+    {
+      etl::lru_cache<int, int, 1> lru;
+      etl::sieve_cache<int, int, 1> sieve;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        lru.put(i, i);
+        sieve.put(i, i);
+        CHECK(sieve.get(i) != ETL_NULLPTR);
+
+        CHECK_EQUAL(1U, lru.size());
+        CHECK_EQUAL(1U, sieve.size());
+        CHECK_EQUAL(i, *lru.get(i));
+        CHECK_EQUAL(i, *sieve.peek(i));
+      }
+    }
+  };
+}
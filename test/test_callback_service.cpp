@@ -329,5 +329,81 @@ namespace
       CHECK(!member2_called);
       CHECK(unhandled_called);
     }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    typedef etl::callback_service_ct<SIZE, OFFSET>::register_callback<GLOBAL, global>
+                                                  ::register_callback<MEMBER2, unhandled> ServiceCt;
+
+    typedef ServiceCt::register_unhandled_callback<unhandled> ServiceCtUnhandled;
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_callback_service_ct_compile_time)
+    {
+      CHECK_EQUAL(2U, ServiceCt::size());
+      CHECK(ServiceCt::get_callback<GLOBAL>() == &global);
+
+      ServiceCt::callback<GLOBAL>();
+
+      CHECK(global_called);
+      CHECK(!unhandled_called);
+      CHECK_EQUAL(size_t(GLOBAL), called_id);
+
+      global_called = false;
+      ServiceCt::callback<MEMBER2>();
+
+      CHECK(!global_called);
+      CHECK(unhandled_called);
+      CHECK_EQUAL(size_t(MEMBER2), called_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_callback_service_ct_run_time)
+    {
+      ServiceCt::callback(GLOBAL);
+
+      CHECK(global_called);
+      CHECK_EQUAL(size_t(GLOBAL), called_id);
+
+      global_called = false;
+      ServiceCt::callback(MEMBER2);
+
+      CHECK(!global_called);
+      CHECK(unhandled_called);
+      CHECK_EQUAL(size_t(MEMBER2), called_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_callback_service_ct_unhandled_default)
+    {
+      ServiceCt::callback<MEMBER1>();
+      ServiceCt::callback(MEMBER1);
+      ServiceCt::callback(OUT_OF_RANGE);
+
+      CHECK(!global_called);
+      CHECK(!unhandled_called);
+      CHECK_EQUAL(UINT_MAX, called_id);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_callback_service_ct_unhandled_user_supplied)
+    {
+      CHECK_EQUAL(2U, ServiceCtUnhandled::size());
+      CHECK(ServiceCtUnhandled::get_callback<MEMBER1>() == &unhandled);
+
+      ServiceCtUnhandled::callback<MEMBER1>();
+      CHECK(unhandled_called);
+      CHECK_EQUAL(size_t(MEMBER1), called_id);
+
+      unhandled_called = false;
+      ServiceCtUnhandled::callback(OUT_OF_RANGE);
+      CHECK(unhandled_called);
+      CHECK_EQUAL(size_t(OUT_OF_RANGE), called_id);
+
+      ServiceCtUnhandled::callback(GLOBAL);
+      CHECK(global_called);
+      CHECK_EQUAL(size_t(GLOBAL), called_id);
+    }
+#endif
   };
 }
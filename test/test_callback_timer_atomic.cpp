@@ -701,6 +701,50 @@ namespace
       CHECK_EQUAL(4, timer_controller.time_to_next());
     }
 
+    //*************************************************************************
+    TEST(callback_timer_atomic_catch_up)
+    {
+      etl::callback_timer_atomic<3, std::atomic_uint32_t> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback1,        37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback1, 23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      timer_controller.enable_catch_up(true);
+      CHECK(timer_controller.is_catch_up_enabled());
+
+      // Sleep through several expiries of each timer.
+      timer_controller.tick(100);
+
+      CHECK_EQUAL(1U, test.tick_list.size());
+      CHECK_EQUAL(1U, free_tick_list1.size());
+      CHECK_EQUAL(1U, free_tick_list2.size());
+
+      // The timers are still in phase with their periods.
+      CHECK_EQUAL(10, timer_controller.time_to_next());
+
+      timer_controller.tick(10);
+      CHECK_EQUAL(1U, test.tick_list.size());
+      CHECK_EQUAL(1U, free_tick_list1.size());
+      CHECK_EQUAL(2U, free_tick_list2.size());
+      CHECK_EQUAL(1, timer_controller.time_to_next());
+
+      timer_controller.stop(id1);
+      timer_controller.stop(id2);
+      timer_controller.stop(id3);
+      CHECK_EQUAL(uint32_t(etl::timer::state::Inactive), timer_controller.time_to_next());
+    }
+
     //*************************************************************************
     class test_object
     {
@@ -0,0 +1,450 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/callback_timer_deferred.h"
+#include "etl/delegate.h"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  using callback_type = etl::icallback_timer_deferred::callback_type;
+
+  //***************************************************************************
+  // Class callback via etl::delegate
+  //***************************************************************************
+  class Test
+  {
+  public:
+
+    Test()
+      : p_controller(nullptr)
+    {
+    }
+
+    void callback()
+    {
+      tick_list.push_back(ticks);
+    }
+
+    void callback2()
+    {
+      tick_list.push_back(ticks);
+
+      p_controller->start(2);
+      p_controller->start(1);
+    }
+
+    void set_controller(etl::icallback_timer_deferred& controller)
+    {
+      p_controller = &controller;
+    }
+
+    std::vector<uint64_t> tick_list;
+
+    etl::icallback_timer_deferred* p_controller;
+  };
+
+  Test test;
+  callback_type member_callback  = callback_type::create<Test, test, &Test::callback>();
+  callback_type member_callback2 = callback_type::create<Test, test, &Test::callback2>();
+
+  //***************************************************************************
+  std::vector<uint64_t> free_tick_list1;
+
+  void free_callback1()
+  {
+    free_tick_list1.push_back(ticks);
+  }
+
+  callback_type free_function_callback = callback_type::create<free_callback1>();
+
+  //***************************************************************************
+  std::vector<uint64_t> free_tick_list2;
+
+  void free_callback2()
+  {
+    free_tick_list2.push_back(ticks);
+  }
+
+  callback_type free_function_callback2 = callback_type::create<free_callback2>();
+
+  //***************************************************************************
+  void clear_logs()
+  {
+    test.tick_list.clear();
+    free_tick_list1.clear();
+    free_tick_list2.clear();
+  }
+
+  SUITE(test_callback_timer_deferred)
+  {
+    //*************************************************************************
+    TEST(callback_timer_deferred_too_many_timers)
+    {
+      etl::callback_timer_deferred<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Single_Shot);
+
+      CHECK(id1 != etl::timer::id::NO_TIMER);
+      CHECK(id2 != etl::timer::id::NO_TIMER);
+      CHECK(id3 == etl::timer::id::NO_TIMER);
+
+      timer_controller.clear();
+      id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Single_Shot);
+      CHECK(id3 != etl::timer::id::NO_TIMER);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_one_shot)
+    {
+      etl::callback_timer_deferred<4> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Single_Shot);
+
+      clear_logs();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1UL;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 23 };
+      std::vector<uint64_t> compare3 = { 11 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_repeating_stop_start)
+    {
+      etl::callback_timer_deferred<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,         37, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  23, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 11, etl::timer::mode::Repeating);
+
+      clear_logs();
+
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1U;
+
+      while (ticks <= 100U)
+      {
+        if (ticks == 40)
+        {
+          timer_controller.start(id1);
+          timer_controller.stop(id2);
+        }
+
+        if (ticks == 80)
+        {
+          timer_controller.stop(id1);
+          timer_controller.start(id2);
+        }
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 77 };
+      std::vector<uint64_t> compare2 = { 23 };
+      std::vector<uint64_t> compare3 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_requests_wait_for_tick)
+    {
+      etl::callback_timer_deferred<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 10, etl::timer::mode::Single_Shot);
+
+      CHECK(!timer_controller.has_pending_requests());
+      CHECK(timer_controller.start(id1));
+      CHECK(timer_controller.has_pending_requests());
+      CHECK_EQUAL(etl::timer::state::Inactive, timer_controller.time_to_next());
+
+      // Requests are carried out even when disabled.
+      CHECK(!timer_controller.tick(0U));
+      CHECK(!timer_controller.has_pending_requests());
+      CHECK_EQUAL(10U, timer_controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_last_request_wins)
+    {
+      etl::callback_timer_deferred<2> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 10, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(member_callback, 20, etl::timer::mode::Single_Shot);
+
+      timer_controller.enable(true);
+
+      timer_controller.start(id1);
+      timer_controller.stop(id1);
+      timer_controller.stop(id2);
+      timer_controller.start(id2, etl::timer::start::Delayed);
+      timer_controller.tick(0U);
+
+      CHECK_EQUAL(20U, timer_controller.time_to_next());
+
+      // Restarting a running timer reschedules it.
+      timer_controller.tick(5U);
+      CHECK_EQUAL(15U, timer_controller.time_to_next());
+      timer_controller.start(id2);
+      timer_controller.tick(0U);
+      CHECK_EQUAL(20U, timer_controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_register_unregister)
+    {
+      etl::callback_timer_deferred<1> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 10, etl::timer::mode::Repeating);
+
+      clear_logs();
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+      timer_controller.tick(0U);
+
+      CHECK(timer_controller.unregister_timer(id1));
+
+      // Unregister is not replaced by a later request.
+      CHECK(!timer_controller.start(id1));
+      CHECK(!timer_controller.unregister_timer(id1));
+
+      // The id is not free until the request has been carried out.
+      CHECK_EQUAL(etl::timer::id::NO_TIMER, timer_controller.register_timer(free_function_callback, 5, etl::timer::mode::Single_Shot));
+
+      ticks = 10U;
+      timer_controller.tick(10U);
+      CHECK_EQUAL(0U, test.tick_list.size());
+      CHECK_EQUAL(etl::timer::state::Inactive, timer_controller.time_to_next());
+
+      CHECK(!timer_controller.stop(id1));
+
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 5, etl::timer::mode::Single_Shot);
+      CHECK_EQUAL(id1, id2);
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_start_from_callback)
+    {
+      etl::callback_timer_deferred<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback2,        100, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback,  10,  etl::timer::mode::Single_Shot);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_function_callback2, 22,  etl::timer::mode::Single_Shot);
+
+      (void)id1;
+      (void)id2;
+      (void)id3;
+
+      clear_logs();
+      test.set_controller(timer_controller);
+
+      timer_controller.start(id1, etl::timer::start::Immediate);
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1U;
+
+      while (ticks <= 100U)
+      {
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      // The timers started in the callback begin at the following tick.
+      std::vector<uint64_t> compare1 = { 1 };
+      std::vector<uint64_t> compare2 = { 11 };
+      std::vector<uint64_t> compare3 = { 23 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(),  compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_set_period_and_mode)
+    {
+      etl::callback_timer_deferred<1> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 10, etl::timer::mode::Single_Shot);
+
+      clear_logs();
+
+      timer_controller.enable(true);
+      timer_controller.start(id1);
+      timer_controller.tick(0U);
+
+      CHECK(timer_controller.set_period(id1, 5U));
+      CHECK(timer_controller.set_mode(id1, etl::timer::mode::Repeating));
+      CHECK(timer_controller.start(id1));
+
+      ticks = 0;
+
+      while (ticks < 20U)
+      {
+        ++ticks;
+        timer_controller.tick(1U);
+      }
+
+      std::vector<uint64_t> compare1 = { 5, 10, 15, 20 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(), compare1.size());
+
+      CHECK(!timer_controller.set_period(1U, 5U));
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_catch_up)
+    {
+      etl::callback_timer_deferred<1> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback, 10, etl::timer::mode::Repeating);
+
+      clear_logs();
+
+      timer_controller.enable(true);
+      timer_controller.enable_catch_up(true);
+      CHECK(timer_controller.is_catch_up_enabled());
+
+      timer_controller.start(id1);
+      timer_controller.tick(0U);
+
+      ticks = 35U;
+      timer_controller.tick(35U);
+
+      CHECK_EQUAL(1U, test.tick_list.size());
+      CHECK_EQUAL(5U, timer_controller.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(callback_timer_deferred_requests_from_another_thread)
+    {
+      static const int Length = 20000;
+
+      etl::callback_timer_deferred<3> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,        7, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 3, etl::timer::mode::Repeating);
+
+      clear_logs();
+
+      timer_controller.enable(true);
+
+      std::atomic<bool> done(false);
+
+      std::thread producer([&]()
+      {
+        for (int i = 0; i < Length; ++i)
+        {
+          timer_controller.start(id1, (i & 1) != 0);
+          timer_controller.stop(id2);
+          timer_controller.start(id2);
+
+          if ((i % 7) == 0)
+          {
+            timer_controller.stop(id1);
+          }
+        }
+
+        done = true;
+      });
+
+      while (!done)
+      {
+        timer_controller.tick(1U);
+      }
+
+      producer.join();
+
+      timer_controller.stop(id1);
+      timer_controller.stop(id2);
+      timer_controller.tick(1U);
+
+      CHECK(!timer_controller.has_pending_requests());
+      CHECK_EQUAL(etl::timer::state::Inactive, timer_controller.time_to_next());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,436 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/cbor.h"
+
+#include <vector>
+#include <string>
+#include <limits>
+
+namespace
+{
+  typedef std::vector<unsigned char> Bytes;
+
+  //*************************************************************************
+  // A writer over a buffer, for comparing the output with the RFC 8949 examples.
+  struct Encoder
+  {
+    Encoder()
+      : stream(buffer, sizeof(buffer), etl::endian::little)
+      , writer(stream)
+    {
+    }
+
+    Bytes bytes() const
+    {
+      etl::span<const char> used = stream.used_data();
+
+      return Bytes(used.begin(), used.end());
+    }
+
+    char                    buffer[64];
+    etl::byte_stream_writer stream;
+    etl::cbor_writer<4U>    writer;
+  };
+
+  //*************************************************************************
+  Bytes make(const char* hex)
+  {
+    Bytes result;
+
+    for (const char* p = hex; (p[0] != 0) && (p[1] != 0); p += 2)
+    {
+      result.push_back(static_cast<unsigned char>(std::stoi(std::string(p, 2), nullptr, 16)));
+    }
+
+    return result;
+  }
+
+  //*************************************************************************
+  // Renders the items of an encoding as a compact string, to check the structure.
+  std::string decode(const Bytes& bytes, etl::cbor_error* p_error = nullptr)
+  {
+    etl::byte_stream_reader stream(bytes.data(), bytes.size(), etl::endian::big);
+    etl::cbor_reader<3U>    reader(stream);
+
+    std::string result;
+
+    while (true)
+    {
+      const etl::cbor_item item = reader.next();
+
+      if (!result.empty() && (item.type != etl::cbor_type::End_Of_Data))
+      {
+        result += " ";
+      }
+
+      switch (item.type)
+      {
+        case etl::cbor_type::Unsigned_Integer: result += std::to_string(item.value); break;
+        case etl::cbor_type::Negative_Integer: result += "-" + std::to_string(item.value + 1U); break;
+        case etl::cbor_type::Byte_String:      result += "h" + std::to_string(item.data.size()); break;
+        case etl::cbor_type::Text_String:      result += "\"" + std::string(item.text().data(), item.text().size()) + "\""; break;
+        case etl::cbor_type::Begin_Array:      result += item.indefinite ? "[_" : "["; break;
+        case etl::cbor_type::End_Array:        result += "]"; break;
+        case etl::cbor_type::Begin_Map:        result += item.indefinite ? "{_" : "{"; break;
+        case etl::cbor_type::End_Map:          result += "}"; break;
+        case etl::cbor_type::Tag:              result += "t" + std::to_string(item.value) + ":"; break;
+        case etl::cbor_type::Boolean:          result += item.value ? "true" : "false"; break;
+        case etl::cbor_type::Null:             result += "null"; break;
+        case etl::cbor_type::Undefined:        result += "undefined"; break;
+        case etl::cbor_type::Simple:           result += "s" + std::to_string(item.value); break;
+        case etl::cbor_type::Floating_Point:   result += std::to_string(item.floating_point); break;
+        case etl::cbor_type::Error:
+        {
+          if (p_error != nullptr)
+          {
+            *p_error = reader.error();
+          }
+
+          return result + "!";
+        }
+
+        case etl::cbor_type::End_Of_Data:
+        default:
+        {
+          return result;
+        }
+      }
+    }
+  }
+
+  SUITE(test_cbor)
+  {
+    //*************************************************************************
+    TEST(test_write_integers)
+    {
+      const struct { int64_t value; const char* hex; } signed_cases[] =
+      {
+        { 0, "00" }, { 1, "01" }, { 10, "0a" }, { 23, "17" }, { 24, "1818" }, { 100, "1864" },
+        { 1000, "1903e8" }, { 1000000, "1a000f4240" }, { 1000000000000LL, "1b000000e8d4a51000" },
+        { -1, "20" }, { -10, "29" }, { -100, "3863" }, { -1000, "3903e7" },
+        { std::numeric_limits<int64_t>::min(), "3b7fffffffffffffff" }
+      };
+
+      for (size_t i = 0U; i < (sizeof(signed_cases) / sizeof(signed_cases[0])); ++i)
+      {
+        Encoder encoder;
+        CHECK_TRUE(encoder.writer.write(signed_cases[i].value));
+        CHECK(make(signed_cases[i].hex) == encoder.bytes());
+      }
+
+      Encoder encoder;
+      CHECK_TRUE(encoder.writer.write(std::numeric_limits<uint64_t>::max()));
+      CHECK_TRUE(encoder.writer.write(uint8_t(200U)));
+      CHECK_TRUE(encoder.writer.write(int16_t(-300)));
+      CHECK(make("1bffffffffffffffff" "18c8" "39012b") == encoder.bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_write_simple_and_floats)
+    {
+      Encoder encoder;
+
+      CHECK_TRUE(encoder.writer.write(false));
+      CHECK_TRUE(encoder.writer.write(true));
+      CHECK_TRUE(encoder.writer.write_null());
+      CHECK_TRUE(encoder.writer.write_undefined());
+      CHECK_TRUE(encoder.writer.write_simple(16U));
+      CHECK_TRUE(encoder.writer.write_simple(255U));
+      CHECK_FALSE(encoder.writer.write_simple(24U));
+      CHECK_TRUE(encoder.writer.write(100000.0f));
+      CHECK_TRUE(encoder.writer.write(1.5));  // Exact in single precision.
+      CHECK_TRUE(encoder.writer.write(1.1));
+
+      CHECK(make("f4f5f6f7f0f8ff" "fa47c35000" "fa3fc00000" "fb3ff199999999999a") == encoder.bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_write_strings)
+    {
+      Encoder encoder;
+
+      const unsigned char data[] = { 1U, 2U, 3U, 4U };
+
+      CHECK_TRUE(encoder.writer.write_text(etl::string_view("")));
+      CHECK_TRUE(encoder.writer.write_text(etl::string_view("IETF")));
+      CHECK_TRUE(encoder.writer.write_bytes(etl::span<const unsigned char>(data)));
+      CHECK_TRUE(encoder.writer.write_tag(1U));
+      CHECK_TRUE(encoder.writer.write(1363896240));
+
+      CHECK(make("60" "6449455446" "4401020304" "c11a514b67b0") == encoder.bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_write_containers)
+    {
+      {
+        // [1, [2, 3], [4, 5]]
+        Encoder encoder;
+
+        CHECK_TRUE(encoder.writer.begin_array(3U));
+        CHECK_TRUE(encoder.writer.write(1));
+        CHECK_TRUE(encoder.writer.begin_array(2U));
+        CHECK_TRUE(encoder.writer.write(2));
+        CHECK_TRUE(encoder.writer.write(3));
+        CHECK_EQUAL(1U, encoder.writer.depth());
+        CHECK_TRUE(encoder.writer.begin_array(2U));
+        CHECK_TRUE(encoder.writer.write(4));
+        CHECK_FALSE(encoder.writer.end_array()); // Definite arrays close themselves.
+        CHECK_TRUE(encoder.writer.write(5));
+        CHECK_TRUE(encoder.writer.is_complete());
+
+        CHECK(make("8301820203820405") == encoder.bytes());
+      }
+
+      {
+        // {"a": 1, "b": []}
+        Encoder encoder;
+
+        CHECK_TRUE(encoder.writer.begin_map(2U));
+        CHECK_TRUE(encoder.writer.write_text(etl::string_view("a")));
+        CHECK_TRUE(encoder.writer.write(1));
+        CHECK_TRUE(encoder.writer.write_text(etl::string_view("b")));
+        CHECK_TRUE(encoder.writer.begin_array(0U));
+        CHECK_TRUE(encoder.writer.is_complete());
+
+        CHECK(make("a26161016162" "80") == encoder.bytes());
+      }
+
+      {
+        // [_ 1, [2, 3], [_ 4, 5]] and {_ "a": 1, "b": [_ ]}
+        Encoder encoder;
+
+        CHECK_TRUE(encoder.writer.begin_array());
+        CHECK_TRUE(encoder.writer.write(1));
+        CHECK_TRUE(encoder.writer.begin_array(2U));
+        CHECK_TRUE(encoder.writer.write(2));
+        CHECK_TRUE(encoder.writer.write(3));
+        CHECK_TRUE(encoder.writer.begin_array());
+        CHECK_TRUE(encoder.writer.write(4));
+        CHECK_TRUE(encoder.writer.write(5));
+        CHECK_FALSE(encoder.writer.end_map());
+        CHECK_TRUE(encoder.writer.end_array());
+        CHECK_TRUE(encoder.writer.end_array());
+
+        CHECK_TRUE(encoder.writer.begin_map());
+        CHECK_TRUE(encoder.writer.write_text(etl::string_view("a")));
+        CHECK_FALSE(encoder.writer.end_map()); // Half a pair.
+        CHECK_TRUE(encoder.writer.write(1));
+        CHECK_TRUE(encoder.writer.write_text(etl::string_view("b")));
+        CHECK_TRUE(encoder.writer.begin_array());
+        CHECK_TRUE(encoder.writer.end_array());
+        CHECK_TRUE(encoder.writer.end_map());
+        CHECK_TRUE(encoder.writer.is_complete());
+
+        CHECK(make("9f018202039f0405ffff" "bf61610161629fffff") == encoder.bytes());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_limits)
+    {
+      Encoder encoder;
+
+      // Depth
+      CHECK_TRUE(encoder.writer.begin_array());
+      CHECK_TRUE(encoder.writer.begin_array());
+      CHECK_TRUE(encoder.writer.begin_array());
+      CHECK_TRUE(encoder.writer.begin_array(1U));
+      CHECK_FALSE(encoder.writer.begin_array(1U));
+      CHECK_TRUE(encoder.writer.begin_array(0U)); // Empty arrays are never open.
+
+      // Space: nothing is written if it does not all fit.
+      char buffer[4];
+      etl::byte_stream_writer stream(buffer, sizeof(buffer), etl::endian::big);
+      etl::cbor_writer<1U> writer(stream);
+
+      CHECK_FALSE(writer.write_text(etl::string_view("abcd")));
+      CHECK_EQUAL(0U, stream.size_bytes());
+      CHECK_FALSE(writer.write(1000000));
+      CHECK_TRUE(writer.write_text(etl::string_view("abc")));
+      CHECK_FALSE(writer.write(true));
+      CHECK_EQUAL(4U, stream.size_bytes());
+    }
+
+    //*************************************************************************
+    TEST(test_read)
+    {
+      CHECK_EQUAL(std::string("0 23 24 1000 18446744073709551615 -1 -1000"),
+                  decode(make("00" "17" "1818" "1903e8" "1bffffffffffffffff" "20" "3903e7")));
+
+      CHECK_EQUAL(std::string("[ 1 [ 2 3 ] [ 4 5 ] ]"), decode(make("8301820203820405")));
+      CHECK_EQUAL(std::string("{ \"a\" 1 \"b\" [ 2 3 ] }"), decode(make("a26161016162820203")));
+      CHECK_EQUAL(std::string("[_ 1 [ 2 3 ] [_ 4 5 ] ]"), decode(make("9f018202039f0405ffff")));
+      CHECK_EQUAL(std::string("{_ \"a\" 1 \"b\" [_ ] }"), decode(make("bf61610161629fffff")));
+      CHECK_EQUAL(std::string("[ ] { }"), decode(make("80a0")));
+      CHECK_EQUAL(std::string("false true null undefined s16 s255"), decode(make("f4f5f6f7f0f8ff")));
+      CHECK_EQUAL(std::string("t1: 1363896240 h4"), decode(make("c11a514b67b0" "4401020304")));
+    }
+
+    //*************************************************************************
+    TEST(test_read_views_and_floats)
+    {
+      const Bytes bytes = make("6449455446" "f93c00" "f97bff" "f90001" "f9c400" "f97c00" "fa47c35000" "fb3ff199999999999a");
+
+      etl::byte_stream_reader stream(bytes.data(), bytes.size(), etl::endian::big);
+      etl::cbor_reader<1U>    reader(stream);
+
+      etl::cbor_item item = reader.next();
+      CHECK_EQUAL(etl::cbor_type::Text_String, item.type);
+      CHECK(item.data.data() == reinterpret_cast<const char*>(bytes.data() + 1)); // A view, not a copy.
+      CHECK(item.text() == etl::string_view("IETF"));
+
+      const double expected[] = { 1.0, 65504.0, 5.960464477539063e-8, -4.0, std::numeric_limits<double>::infinity(), 100000.0, 1.1 };
+
+      for (size_t i = 0U; i < (sizeof(expected) / sizeof(expected[0])); ++i)
+      {
+        item = reader.next();
+        CHECK_EQUAL(etl::cbor_type::Floating_Point, item.type);
+        CHECK_EQUAL(expected[i], item.floating_point);
+      }
+
+      CHECK_EQUAL(etl::cbor_type::End_Of_Data, reader.next().type);
+    }
+
+    //*************************************************************************
+    TEST(test_read_as)
+    {
+      const Bytes bytes = make("18ff" "190100" "20" "387f" "3880" "1bffffffffffffffff" "3b7fffffffffffffff" "6161");
+
+      etl::byte_stream_reader stream(bytes.data(), bytes.size(), etl::endian::big);
+      etl::cbor_reader<1U>    reader(stream);
+
+      etl::cbor_item item = reader.next();
+      CHECK_EQUAL(255, item.as<uint8_t>().value());
+      CHECK_FALSE(item.as<int8_t>().has_value());
+
+      item = reader.next();
+      CHECK_FALSE(item.as<uint8_t>().has_value());
+      CHECK_EQUAL(256, item.as<int16_t>().value());
+
+      item = reader.next();
+      CHECK_EQUAL(-1, item.as<int8_t>().value());
+      CHECK_FALSE(item.as<uint32_t>().has_value());
+
+      item = reader.next();
+      CHECK_EQUAL(-128, item.as<int8_t>().value());
+
+      item = reader.next();
+      CHECK_FALSE(item.as<int8_t>().has_value());
+      CHECK_EQUAL(-129, item.as<int16_t>().value());
+
+      item = reader.next();
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), item.as<uint64_t>().value());
+      CHECK_FALSE(item.as<int64_t>().has_value());
+
+      item = reader.next();
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), item.as<int64_t>().value());
+
+      item = reader.next();
+      CHECK_FALSE(item.as<int>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_read_errors)
+    {
+      const struct { const char* hex; etl::cbor_error::enum_type error; } cases[] =
+      {
+        { "1903",         etl::cbor_error::Out_Of_Data },
+        { "636162",       etl::cbor_error::Out_Of_Data },
+        { "8201",         etl::cbor_error::Out_Of_Data },
+        { "c1",           etl::cbor_error::Out_Of_Data },
+        { "1c",           etl::cbor_error::Malformed   },
+        { "1f",           etl::cbor_error::Malformed   },
+        { "ff",           etl::cbor_error::Malformed   },
+        { "8101ff",       etl::cbor_error::Malformed   },
+        { "bf01ff",       etl::cbor_error::Malformed   },
+        { "f818",         etl::cbor_error::Malformed   },
+        { "fc",           etl::cbor_error::Malformed   },
+        { "5f4101ff",     etl::cbor_error::Unsupported },
+        { "81818181",     etl::cbor_error::Too_Deep    },
+      };
+
+      for (size_t i = 0U; i < (sizeof(cases) / sizeof(cases[0])); ++i)
+      {
+        etl::cbor_error error;
+
+        const std::string result = decode(make(cases[i].hex), &error);
+
+        CHECK_EQUAL('!', result.back());
+        CHECK_EQUAL(cases[i].error, error);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_skip)
+    {
+      // {"skip": [1, {"x": [_ 2]}], "keep": t1: 7}, 9
+      const Bytes bytes = make("a2" "64736b6970" "8201a161789f02ff" "646b656570" "c107" "09");
+
+      etl::byte_stream_reader stream(bytes.data(), bytes.size(), etl::endian::big);
+      etl::cbor_reader<4U>    reader(stream);
+
+      CHECK_EQUAL(etl::cbor_type::Begin_Map, reader.next().type);
+      CHECK(reader.next().text() == etl::string_view("skip"));
+      CHECK_TRUE(reader.skip());
+      CHECK(reader.next().text() == etl::string_view("keep"));
+      CHECK_TRUE(reader.skip()); // The tag and its item.
+      CHECK_FALSE(reader.skip()); // The end of the map.
+      CHECK_EQUAL(0U, reader.depth());
+      CHECK_EQUAL(9U, reader.next().value);
+    }
+
+    //*************************************************************************
+    TEST(test_round_trip)
+    {
+      char buffer[128];
+      etl::byte_stream_writer output(buffer, sizeof(buffer), etl::endian::big);
+      etl::cbor_writer<2U>    writer(output);
+
+      writer.begin_map(3U);
+      writer.write_text(etl::string_view("temperature"));
+      writer.write(-12.75);
+      writer.write_text(etl::string_view("samples"));
+      writer.begin_array(3U);
+      writer.write(uint16_t(1U));
+      writer.write(-70000);
+      writer.write(uint64_t(5000000000ULL));
+      writer.write_text(etl::string_view("ok"));
+      writer.write(true);
+
+      CHECK_TRUE(writer.is_complete());
+
+      const Bytes bytes(output.used_data().begin(), output.used_data().end());
+
+      CHECK_EQUAL(std::string("{ \"temperature\" -12.750000 \"samples\" [ 1 -70000 5000000000 ] \"ok\" true }"), decode(bytes));
+    }
+  };
+}
@@ -0,0 +1,206 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/check_policy.h"
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/circular_buffer.h"
+#include "etl/queue.h"
+
+namespace
+{
+  SUITE(test_check_policy)
+  {
+    //*************************************************************************
+    TEST(test_is_check_policy)
+    {
+      CHECK_TRUE(etl::is_check_policy<etl::checked_t>::value);
+      CHECK_TRUE(etl::is_check_policy<etl::debug_checked_t>::value);
+      CHECK_TRUE(etl::is_check_policy<etl::unchecked_t>::value);
+      CHECK_FALSE(etl::is_check_policy<int>::value);
+
+      CHECK_TRUE(etl::check_policy_enabled<etl::checked_t>::value);
+      CHECK_EQUAL(ETL_IS_DEBUG_BUILD == 1, etl::check_policy_enabled<etl::debug_checked_t>::value);
+      CHECK_FALSE(etl::check_policy_enabled<etl::unchecked_t>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_checked)
+    {
+      etl::vector<int, 2> data;
+
+      data.push_back(etl::checked_t(), 1);
+      data.push_back(etl::checked_t(), 2);
+      CHECK_THROW(data.push_back(etl::checked_t(), 3), etl::vector_full);
+      CHECK_THROW(data.at(2, etl::checked_t()), etl::vector_out_of_bounds);
+
+      data.pop_back(etl::checked_t());
+      data.pop_back(etl::checked_t());
+      CHECK_THROW(data.pop_back(etl::checked_t()), etl::vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_vector_unchecked)
+    {
+      etl::vector<int, 4> data;
+
+      data.push_back(etl::unchecked_t(), 1);
+      data.push_back(etl::unchecked_t(), 2);
+      data.push_back(etl::unchecked_t(), 3);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2, data.at(1, etl::unchecked_t()));
+
+      const etl::ivector<int>& cdata = data;
+      CHECK_EQUAL(3, cdata.at(2, etl::unchecked_t()));
+
+      data.pop_back(etl::unchecked_t());
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(2, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_vector_debug_checked)
+    {
+      etl::vector<int, 1> data;
+
+      data.push_back(etl::debug_checked_t(), 1);
+
+#if ETL_IS_DEBUG_BUILD
+      CHECK_THROW(data.push_back(etl::debug_checked_t(), 2), etl::vector_full);
+#endif
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_deque)
+    {
+      etl::deque<int, 3> data;
+
+      data.push_back(etl::unchecked_t(), 2);
+      data.push_front(etl::unchecked_t(), 1);
+      data.push_back(etl::checked_t(), 3);
+
+      CHECK_THROW(data.push_back(etl::checked_t(), 4), etl::deque_full);
+      CHECK_THROW(data.push_front(etl::checked_t(), 0), etl::deque_full);
+      CHECK_THROW(data.at(3, etl::checked_t()), etl::deque_out_of_bounds);
+
+      CHECK_EQUAL(1, data.at(0, etl::unchecked_t()));
+      CHECK_EQUAL(2, data.at(1, etl::unchecked_t()));
+      CHECK_EQUAL(3, data.at(2, etl::unchecked_t()));
+
+      data.pop_front(etl::unchecked_t());
+      data.pop_back(etl::unchecked_t());
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(2, data.front());
+
+      data.pop_back(etl::checked_t());
+      CHECK_THROW(data.pop_back(etl::checked_t()), etl::deque_empty);
+      CHECK_THROW(data.pop_front(etl::checked_t()), etl::deque_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_circular_buffer)
+    {
+      etl::circular_buffer<int, 4> data;
+
+      CHECK_THROW(data.front(etl::checked_t()), etl::circular_buffer_empty);
+      CHECK_THROW(data.back(etl::checked_t()), etl::circular_buffer_empty);
+      CHECK_THROW(data.pop(etl::checked_t()), etl::circular_buffer_empty);
+
+      data.push_back(1);
+      data.push_back(2);
+      data.push_back(3);
+      data.push_back(4);
+
+      CHECK_EQUAL(1, data.front(etl::unchecked_t()));
+      CHECK_EQUAL(4, data.back(etl::unchecked_t()));
+
+      data.pop(etl::unchecked_t());
+      data.pop_back(etl::unchecked_t());
+      CHECK_EQUAL(2, data.front());
+      CHECK_EQUAL(3, data.back());
+
+      // An integral count still selects pop(n).
+      data.pop(2);
+      CHECK_TRUE(data.empty());
+      CHECK_THROW(data.pop_back(etl::checked_t()), etl::circular_buffer_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_queue)
+    {
+      etl::queue<int, 2> data;
+
+      data.push_back(etl::unchecked_t(), 1);
+      data.push_back(etl::unchecked_t(), 2);
+      CHECK_THROW(data.push_back(etl::checked_t(), 3), etl::queue_full);
+
+      data.pop(etl::unchecked_t());
+      CHECK_EQUAL(2, data.front());
+
+      data.pop(etl::checked_t());
+      CHECK_THROW(data.pop(etl::checked_t()), etl::queue_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_checked_access)
+    {
+      etl::vector<int, 3> data;
+
+      etl::checked_access<etl::ivector<int>, etl::unchecked_t> fast(data);
+      etl::checked_access<etl::ivector<int>, etl::checked_t>   safe(data);
+
+      fast.push_back(1);
+      fast.push_back(2);
+      safe.push_back(3);
+
+      CHECK_THROW(safe.push_back(4), etl::vector_full);
+      CHECK_EQUAL(2, fast.at(1));
+      CHECK_THROW(safe.at(3), etl::vector_out_of_bounds);
+
+      fast.pop_back();
+      CHECK_EQUAL(2U, fast.get().size());
+
+      etl::deque<int, 2> buffer;
+      etl::checked_access<etl::ideque<int>, etl::checked_t> checked_queue(buffer);
+
+      checked_queue.push_front(1);
+      checked_queue.push_back(2);
+      CHECK_THROW(checked_queue.push_back(3), etl::deque_full);
+
+      checked_queue.pop_front();
+      checked_queue.pop_front();
+      CHECK_THROW(checked_queue.pop_back(), etl::deque_empty);
+    }
+  }
+}
@@ -181,6 +181,100 @@ namespace
       uint32_t hash3 = etl::checksum<uint32_t>(data3.rbegin(), data3.rend());
       CHECK_EQUAL(int(hash1), int(hash3));
     }
+
+    //*************************************************************************
+    template <typename TChecksum>
+    void check_block_add_matches_byte_add()
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 151U) + (i >> 3U) + 0x5AU);
+      }
+
+      // Cover every alignment and the tails shorter than a word.
+      for (size_t offset = 0U; offset < 9U; ++offset)
+      {
+        for (size_t length = 0U; length < 40U; ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          TChecksum by_block(begin, begin + length);
+          TChecksum by_byte(data.begin() + offset, data.begin() + offset + length);
+
+          CHECK_EQUAL(by_byte.value(), by_block.value());
+        }
+      }
+
+      TChecksum by_block(data.data(), data.data() + data.size());
+      TChecksum by_byte(data.begin(), data.end());
+
+      CHECK_EQUAL(by_byte.value(), by_block.value());
+    }
+
+    //*************************************************************************
+    TEST(test_block_add_matches_byte_add)
+    {
+      check_block_add_matches_byte_add<etl::checksum<uint8_t> >();
+      check_block_add_matches_byte_add<etl::checksum<uint16_t> >();
+      check_block_add_matches_byte_add<etl::checksum<uint32_t> >();
+      check_block_add_matches_byte_add<etl::checksum<uint64_t> >();
+      check_block_add_matches_byte_add<etl::xor_checksum<uint8_t> >();
+      check_block_add_matches_byte_add<etl::xor_checksum<uint32_t> >();
+      check_block_add_matches_byte_add<etl::parity_checksum<uint8_t> >();
+      check_block_add_matches_byte_add<etl::fletcher16>();
+      check_block_add_matches_byte_add<etl::adler32>();
+    }
+
+    //*************************************************************************
+    TEST(test_checksum_sum_large_block)
+    {
+      // Enough bytes of 0xFF to fold the lanes many times.
+      std::vector<uint8_t> data(100000U, 0xFFU);
+
+      uint32_t sum = etl::checksum<uint32_t>(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(100000U * 255U, sum);
+    }
+
+    //*************************************************************************
+    TEST(test_fletcher16)
+    {
+      std::string data1("abcde");
+      std::string data2("abcdef");
+      std::string data3("abcdefgh");
+
+      CHECK_EQUAL(0xC8F0U, etl::fletcher16(data1.data(), data1.data() + data1.size()).value());
+      CHECK_EQUAL(0x2057U, etl::fletcher16(data2.data(), data2.data() + data2.size()).value());
+      CHECK_EQUAL(0x0627U, etl::fletcher16(data3.data(), data3.data() + data3.size()).value());
+      CHECK_EQUAL(0x0627U, etl::fletcher16(data3.begin(), data3.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32)
+    {
+      std::string data("Wikipedia");
+
+      CHECK_EQUAL(0x11E60398UL, etl::adler32(data.data(), data.data() + data.size()).value());
+      CHECK_EQUAL(0x11E60398UL, etl::adler32(data.begin(), data.end()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_adler32_large_block)
+    {
+      // Longer than one deferred block of 0xFF, the worst case for the sums.
+      std::vector<uint8_t> data(20000U, 0xFFU);
+
+      etl::adler32 by_block(data.data(), data.data() + data.size());
+      etl::adler32 by_byte(data.begin(), data.end());
+
+      CHECK_EQUAL(by_byte.value(), by_block.value());
+
+      etl::fletcher16 fletcher_by_block(data.data(), data.data() + data.size());
+      etl::fletcher16 fletcher_by_byte(data.begin(), data.end());
+
+      CHECK_EQUAL(fletcher_by_byte.value(), fletcher_by_block.value());
+    }
   };
 }
-
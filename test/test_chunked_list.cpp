@@ -0,0 +1,385 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/chunked_list.h"
+
+#include <list>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  typedef etl::chunked_list<int, 40, 4>         Data;
+  typedef etl::ichunked_list<int>               IData;
+  typedef etl::chunked_list<std::string, 40, 4> DataString;
+
+  //***************************************************************************
+  template <typename TList, typename TCompare>
+  bool is_equal(const TList& list, const TCompare& compare)
+  {
+    return (list.size() == compare.size()) && std::equal(list.begin(), list.end(), compare.begin());
+  }
+
+  SUITE(test_chunked_list)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(40U, data.max_size());
+      CHECK_EQUAL(4U, data.elements_per_node());
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      int initial[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      Data data1(std::begin(initial), std::end(initial));
+      CHECK(is_equal(data1, std::vector<int>(std::begin(initial), std::end(initial))));
+
+      Data data2(5U, 7);
+      CHECK(is_equal(data2, std::vector<int>(5U, 7)));
+
+      Data data3(3U);
+      CHECK(is_equal(data3, std::vector<int>(3U, 0)));
+
+      Data data4(data1);
+      CHECK(data4 == data1);
+
+      Data data5 = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+      CHECK(data5 == data1);
+
+      Data data6(std::move(data5));
+      CHECK(data6 == data1);
+      CHECK(data5.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data;
+      std::list<int> compare;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+        data.push_front(-i);
+        compare.push_front(-i);
+      }
+
+      CHECK(is_equal(data, compare));
+      CHECK_EQUAL(compare.front(), data.front());
+      CHECK_EQUAL(compare.back(), data.back());
+
+      while (!compare.empty())
+      {
+        data.pop_back();
+        compare.pop_back();
+        CHECK(is_equal(data, compare));
+
+        if (!compare.empty())
+        {
+          data.pop_front();
+          compare.pop_front();
+          CHECK(is_equal(data, compare));
+        }
+      }
+
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_fill_to_capacity_from_the_front)
+    {
+      // Pushing to the front splits nodes in half, the worst case for node use.
+      Data data;
+
+      for (int i = 0; i < 40; ++i)
+      {
+        data.push_front(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(39, data.front());
+      CHECK_EQUAL(0, data.back());
+
+      CHECK_THROW(data.push_front(40), etl::chunked_list_full);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_empty)
+    {
+      Data data;
+
+      CHECK_THROW(data.pop_back(), etl::chunked_list_empty);
+      CHECK_THROW(data.pop_front(), etl::chunked_list_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_against_list)
+    {
+      Data data;
+      std::list<int> compare;
+
+      uint32_t seed = 12345U;
+      int      value = 0;
+
+      for (int i = 0; i < 2000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+
+        const size_t position = (seed >> 8) % (compare.size() + 1U);
+        const bool   do_erase = (compare.size() == 40U) || (!compare.empty() && (((seed >> 20) % 3U) == 0U));
+
+        Data::iterator       itr = data.begin();
+        std::list<int>::iterator compare_itr = compare.begin();
+
+        std::advance(itr, do_erase ? position % compare.size() : position);
+        std::advance(compare_itr, do_erase ? position % compare.size() : position);
+
+        if (do_erase)
+        {
+          Data::iterator next = data.erase(itr);
+          compare_itr = compare.erase(compare_itr);
+
+          CHECK_EQUAL(std::distance(compare.begin(), compare_itr), std::distance(data.begin(), next));
+        }
+        else
+        {
+          Data::iterator inserted = data.insert(itr, value);
+          compare.insert(compare_itr, value);
+
+          CHECK_EQUAL(value, *inserted);
+          ++value;
+        }
+
+        CHECK(is_equal(data, compare));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_non_trivial)
+    {
+      DataString data;
+      std::list<std::string> compare;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        const std::string text = "A long string to avoid the small buffer " + std::to_string(i);
+
+        DataString::iterator itr = data.begin();
+        std::list<std::string>::iterator compare_itr = compare.begin();
+
+        std::advance(itr, i / 2);
+        std::advance(compare_itr, i / 2);
+
+        data.insert(itr, text);
+        compare.insert(compare_itr, text);
+      }
+
+      CHECK(is_equal(data, compare));
+
+      for (int i = 0; i < 25; ++i)
+      {
+        DataString::iterator itr = data.begin();
+        std::list<std::string>::iterator compare_itr = compare.begin();
+
+        std::advance(itr, (i * 7) % data.size());
+        std::advance(compare_itr, (i * 7) % compare.size());
+
+        data.erase(itr);
+        compare.erase(compare_itr);
+
+        CHECK(is_equal(data, compare));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_insert_element_of_itself)
+    {
+      Data data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i);
+      }
+
+      // The node is full, so the insert splits it and moves 'back()'.
+      data.insert(data.begin(), data.back());
+      data.push_front(data.back());
+
+      std::vector<int> expected = { 3, 3, 0, 1, 2, 3 };
+
+      CHECK(is_equal(data, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_and_n)
+    {
+      Data data = { 0, 1, 2, 3, 4, 5 };
+      std::list<int> compare = { 0, 1, 2, 3, 4, 5 };
+
+      int range[] = { 10, 11, 12, 13, 14, 15, 16 };
+
+      Data::iterator itr = data.begin();
+      std::advance(itr, 3);
+
+      Data::iterator first = data.insert(itr, std::begin(range), std::end(range));
+      std::list<int>::iterator compare_itr = compare.begin();
+      std::advance(compare_itr, 3);
+      compare.insert(compare_itr, std::begin(range), std::end(range));
+
+      CHECK_EQUAL(10, *first);
+      CHECK(is_equal(data, compare));
+
+      first = data.insert(data.begin(), 5U, 99);
+      compare.insert(compare.begin(), 5U, 99);
+
+      CHECK_EQUAL(99, *first);
+      CHECK(is_equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      Data data;
+      std::list<int> compare;
+
+      for (int i = 0; i < 30; ++i)
+      {
+        data.push_back(i);
+        compare.push_back(i);
+      }
+
+      Data::iterator first = data.begin();
+      Data::iterator last  = data.begin();
+      std::advance(first, 5);
+      std::advance(last, 20);
+
+      std::list<int>::iterator compare_first = compare.begin();
+      std::list<int>::iterator compare_last  = compare.begin();
+      std::advance(compare_first, 5);
+      std::advance(compare_last, 20);
+
+      Data::iterator next = data.erase(first, last);
+      compare.erase(compare_first, compare_last);
+
+      CHECK_EQUAL(20, *next);
+      CHECK(is_equal(data, compare));
+
+      next = data.erase(data.begin(), data.end());
+      CHECK(next == data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      etl::chunked_list<std::pair<int, int>, 10, 2> data;
+
+      data.emplace_back(1, 2);
+      data.emplace_front(3, 4);
+      data.emplace(data.end(), 5, 6);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(data.front() == std::make_pair(3, 4));
+      CHECK(data.back()  == std::make_pair(5, 6));
+    }
+
+    //*************************************************************************
+    TEST(test_remove_resize_clear)
+    {
+      Data data = { 0, 1, 2, 1, 3, 1, 4, 5, 1 };
+
+      data.remove(1);
+      CHECK(is_equal(data, std::vector<int>{ 0, 2, 3, 4, 5 }));
+
+      data.remove_if([](int i) { return (i % 2) == 0; });
+      CHECK(is_equal(data, std::vector<int>{ 3, 5 }));
+
+      data.resize(5U, 9);
+      CHECK(is_equal(data, std::vector<int>{ 3, 5, 9, 9, 9 }));
+
+      data.resize(1U);
+      CHECK(is_equal(data, std::vector<int>{ 3 }));
+
+      data.clear();
+      CHECK(data.empty());
+
+      data.push_back(1);
+      CHECK(is_equal(data, std::vector<int>{ 1 }));
+    }
+
+    //*************************************************************************
+    TEST(test_reverse_and_const_iteration)
+    {
+      const Data data = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      std::vector<int> expected = { 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+
+      CHECK(std::equal(data.rbegin(), data.rend(), expected.begin()));
+      CHECK(std::equal(data.crbegin(), data.crend(), expected.begin()));
+
+      Data::const_iterator itr = data.cend();
+      --itr;
+      CHECK_EQUAL(9, *itr);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_and_comparison)
+    {
+      Data data1 = { 0, 1, 2, 3 };
+      Data data2;
+
+      data2 = data1;
+      CHECK(data1 == data2);
+
+      IData& idata = data2;
+      idata.push_back(4);
+
+      CHECK(data1 != data2);
+      CHECK(data1 < data2);
+      CHECK(data2 > data1);
+      CHECK(data1 <= data2);
+      CHECK(data2 >= data1);
+
+      data1 = std::move(data2);
+      CHECK(is_equal(data1, std::vector<int>{ 0, 1, 2, 3, 4 }));
+    }
+  };
+}
@@ -136,7 +136,7 @@ namespace
       Data data;
       for (auto v : test)
       {
-        data.push(v);
+        data.push_back(v);
       }
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
@@ -158,7 +158,7 @@ namespace
 
       for (uint32_t i = 0U; i < SIZE; ++i)
       {
-        data.push(ItemM(std::to_string(i)));
+        data.push_back(ItemM(std::to_string(i)));
         compare.push_back(ItemM(std::to_string(i)));
       }
 
@@ -175,7 +175,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -192,7 +192,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator itr = data.begin();
 
@@ -213,7 +213,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator itr = data.begin();
 
@@ -234,7 +234,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -251,7 +251,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -268,7 +268,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -285,7 +285,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
 
@@ -302,7 +302,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
 
@@ -319,7 +319,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
       data.pop(5);
 
       Compare compare{ Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
@@ -337,7 +337,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
       data.pop(5);
 
       Compare compare{ Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
@@ -356,9 +356,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Compare input2{ Ndc("5"), Ndc("6"), Ndc("7") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(3);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7") };
 
@@ -376,9 +376,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Compare input2{ Ndc("5"), Ndc("6"), Ndc("7") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(3);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7") };
 
@@ -396,9 +396,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(7);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
 
@@ -416,9 +416,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(7);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
 
@@ -437,7 +437,7 @@ namespace
       Data data;
       for (auto v : test)
       {
-        data.push(v);
+        data.push_back(v);
         CHECK_EQUAL(SIZE - data.size(), data.available());
       }
     }
@@ -447,7 +447,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -464,7 +464,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -477,7 +477,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -494,7 +494,7 @@ namespace
     {
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -502,6 +502,37 @@ namespace
       CHECK(ref == compare.back());
     }
 
+    //*************************************************************************
+    TEST(test_pop_back)
+    {
+      // Overrun by 3, so that the newest items wrap.
+      Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Data data;
+      data.push_back(input.begin(), input.end());
+
+      data.pop_back();
+      data.pop_back();
+      data.pop_back();
+      data.pop_back();
+
+      Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(data.back() == compare.back());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      data.push_back(Ndc("13"));
+      CHECK(data.back() == Ndc("13"));
+      CHECK_EQUAL(compare.size() + 1U, data.size());
+
+      while (!data.empty())
+      {
+        data.pop_back();
+      }
+
+      CHECK_THROW(data.pop_back(), etl::circular_buffer_empty);
+    }
+
     //*************************************************************************
     TEST(test_index_operator)
     {
@@ -509,7 +540,7 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Compare input2{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -533,7 +564,7 @@ namespace
       // Overrun by 3
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       for (size_t i = 0; i < SIZE; ++i)
       {
@@ -546,7 +577,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -569,7 +600,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -592,7 +623,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -615,7 +646,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -638,7 +669,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -661,7 +692,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -684,7 +715,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -707,7 +738,7 @@ namespace
     {
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -731,14 +762,14 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("9"), Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1;
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2(data1);
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -765,7 +796,7 @@ namespace
       DataM data1;
       for (auto&& v : input1)
       {
-        data1.push(std::move(v));
+        data1.push_back(std::move(v));
       }
 
       // Move construct from data1
@@ -775,7 +806,7 @@ namespace
       data1.clear();
       for (auto&& v : input2)
       {
-        data1.push(std::move(v));
+        data1.push_back(std::move(v));
       }
 
       CHECK(data2.begin() != data2.end());
@@ -792,17 +823,17 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
       Compare input2{ Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1;
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2;
-      data2.push(Ndc("0"));
+      data2.push_back(Ndc("0"));
 
       data2 = data1;
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -818,17 +849,17 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
       Compare input2{ Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1;
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2;
-      data2.push(Ndc("0"));
+      data2.push_back(Ndc("0"));
 
       data2 = etl::move(data1);
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -843,7 +874,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator itr1 = data.begin() + 2;
       Data::iterator itr2 = data.begin() + 3;
@@ -865,7 +896,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator itr1 = data.begin() + 2;
       Data::const_iterator itr2 = data.begin() + 3;
@@ -887,7 +918,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator begin = data.begin();
       Data::iterator end   = data.begin();
@@ -912,7 +943,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data;
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator begin = data.begin();
       Data::const_iterator end   = data.begin();
@@ -939,8 +970,8 @@ namespace
       Compare input2{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1;
       Data data2;
-      data1.push(input1.begin(), input1.end());
-      data2.push(input2.begin(), input2.end());
+      data1.push_back(input1.begin(), input1.end());
+      data2.push_back(input2.begin(), input2.end());
 
       swap(data1, data2);
 
@@ -957,8 +988,8 @@ namespace
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1;
       Data data2;
-      data1.push(input.begin(), input.end());
-      data2.push(input.begin(), input.end());
+      data1.push_back(input.begin(), input.end());
+      data2.push_back(input.begin(), input.end());
 
       CHECK(data1 == data2);
     }
@@ -971,8 +1002,8 @@ namespace
       Compare input2{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("6"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1;
       Data data2;
-      data1.push(input1.begin(), input1.end());
-      data2.push(input2.begin(), input2.end());
+      data1.push_back(input1.begin(), input1.end());
+      data2.push_back(input2.begin(), input2.end());
 
       CHECK(data1 != data2);
     }
@@ -983,7 +1014,7 @@ namespace
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
       Compare blank{ Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9"), Ndc("9") };
       Data data;
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       data.fill(Ndc("9"));
 
@@ -1064,5 +1095,119 @@ namespace
       CHECK(!is_equal);
     }
 
+    //*************************************************************************
+    TEST(test_write_regions_commit_write)
+    {
+      using CB = etl::circular_buffer<int, SIZE>;
+
+      CB data;
+
+      CB::span_pair regions = data.write_regions();
+      CHECK_EQUAL(SIZE, regions.first.size());
+      CHECK_EQUAL(0U,   regions.second.size());
+
+      const int input1[] = { 0, 1, 2, 3, 4, 5 };
+      memcpy(regions.first.data(), input1, sizeof(input1));
+      data.commit_write(6U);
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK_EQUAL(0,  data.front());
+      CHECK_EQUAL(5,  data.back());
+
+      data.consume(4U);
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(4,  data.front());
+
+      // The free space now wraps.
+      regions = data.write_regions();
+      CHECK_EQUAL(5U, regions.first.size());
+      CHECK_EQUAL(3U, regions.second.size());
+      CHECK_EQUAL(data.available(), regions.first.size() + regions.second.size());
+
+      const int input2[] = { 6, 7, 8, 9, 10, 11, 12, 13 };
+      memcpy(regions.first.data(),  input2,     regions.first.size_bytes());
+      memcpy(regions.second.data(), input2 + 5, regions.second.size_bytes());
+      data.commit_write(8U);
+
+      CHECK(data.full());
+
+      std::vector<int> expected = { 4, 5, 6, 7, 8, 9, 10, 11, 12, 13 };
+      CHECK(std::equal(expected.begin(), expected.end(), data.begin()));
+
+      regions = data.write_regions();
+      CHECK_EQUAL(0U, regions.first.size());
+      CHECK_EQUAL(0U, regions.second.size());
+    }
+
+    //*************************************************************************
+    TEST(test_read_regions_consume)
+    {
+      using CB = etl::circular_buffer<int, SIZE>;
+
+      CB data;
+
+      CB::span_pair regions = data.read_regions();
+      CHECK_EQUAL(0U, regions.first.size());
+      CHECK_EQUAL(0U, regions.second.size());
+
+      for (int i = 0; i < 15; ++i)
+      {
+        data.push_back(i);
+      }
+
+      // The values wrap.
+      regions = data.read_regions();
+      CHECK_EQUAL(data.size(), regions.first.size() + regions.second.size());
+      CHECK(regions.second.size() != 0U);
+
+      std::vector<int> output(regions.first.begin(), regions.first.end());
+      output.insert(output.end(), regions.second.begin(), regions.second.end());
+
+      std::vector<int> expected = { 5, 6, 7, 8, 9, 10, 11, 12, 13, 14 };
+      CHECK(output == expected);
+
+      const CB& cdata = data;
+      CB::const_span_pair cregions = cdata.read_regions();
+      CHECK(cregions.first.data() == regions.first.data());
+      CHECK_EQUAL(regions.first.size(), cregions.first.size());
+      CHECK_EQUAL(regions.second.size(), cregions.second.size());
+
+      data.consume(regions.first.size());
+      CHECK_EQUAL(regions.second.size(), data.size());
+
+      regions = data.read_regions();
+      CHECK_EQUAL(data.size(), regions.first.size());
+      CHECK_EQUAL(0U, regions.second.size());
+
+      data.consume(data.size());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_consume_non_trivial)
+    {
+      Data data;
+
+      data.push_back(Ndc("0"));
+      data.push_back(Ndc("1"));
+      data.push_back(Ndc("2"));
+
+      data.consume(2U);
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK(Ndc("2") == data.front());
+    }
+
+    //*************************************************************************
+    TEST(test_commit_write_consume_out_of_range)
+    {
+      using CB = etl::circular_buffer<int, SIZE>;
+
+      CB data;
+
+      CHECK_THROW(data.commit_write(SIZE + 1U), etl::circular_buffer_full);
+      CHECK_THROW(data.consume(1U), etl::circular_buffer_empty);
+    }
+
   };
 }
@@ -166,7 +166,7 @@ namespace
       Data data(buffer1.raw, SIZE);
       for (auto v : test)
       {
-        data.push(v);
+        data.push_back(v);
       }
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
@@ -188,7 +188,7 @@ namespace
 
       for (uint32_t i = 0UL; i < SIZE; ++i)
       {
-        data.push(ItemM(std::to_string(i)));
+        data.push_back(ItemM(std::to_string(i)));
         compare.push_back(ItemM(std::to_string(i)));
       }
 
@@ -205,7 +205,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -222,7 +222,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator itr = data.begin();
 
@@ -243,7 +243,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator itr = data.begin();
 
@@ -264,7 +264,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -281,7 +281,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -298,7 +298,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -315,7 +315,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
 
@@ -332,7 +332,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
 
@@ -349,7 +349,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
       data.pop(5);
 
       Compare compare{ Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
@@ -367,7 +367,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
       data.pop(5);
 
       Compare compare{ Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10") };
@@ -386,9 +386,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Compare input2{ Ndc("5"), Ndc("6"), Ndc("7") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(3);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7") };
 
@@ -406,9 +406,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4") };
       Compare input2{ Ndc("5"), Ndc("6"), Ndc("7") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(3);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7") };
 
@@ -426,9 +426,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(7);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
 
@@ -446,9 +446,9 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
       data.pop(7);
-      data.push(input2.begin(), input2.end());
+      data.push_back(input2.begin(), input2.end());
 
       Compare compare{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
 
@@ -467,7 +467,7 @@ namespace
       Data data(buffer1.raw, SIZE);
       for (auto v : test)
       {
-        data.push(v);
+        data.push_back(v);
         CHECK_EQUAL(SIZE - data.size(), data.available());
       }
     }
@@ -477,7 +477,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -494,7 +494,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -507,7 +507,7 @@ namespace
     {
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -524,7 +524,7 @@ namespace
     {
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -532,6 +532,37 @@ namespace
       CHECK(ref == compare.back());
     }
 
+    //*************************************************************************
+    TEST(test_pop_back)
+    {
+      // Overrun by 3, so that the newest items wrap.
+      Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
+      Data data(buffer1.raw, SIZE);
+      data.push_back(input.begin(), input.end());
+
+      data.pop_back();
+      data.pop_back();
+      data.pop_back();
+      data.pop_back();
+
+      Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(data.back() == compare.back());
+      CHECK(std::equal(compare.begin(), compare.end(), data.begin()));
+
+      data.push_back(Ndc("13"));
+      CHECK(data.back() == Ndc("13"));
+      CHECK_EQUAL(compare.size() + 1U, data.size());
+
+      while (!data.empty())
+      {
+        data.pop_back();
+      }
+
+      CHECK_THROW(data.pop_back(), etl::circular_buffer_empty);
+    }
+
     //*************************************************************************
     TEST(test_index_operator)
     {
@@ -539,7 +570,7 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Compare input2{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(input1.begin(), input1.end());
+      data.push_back(input1.begin(), input1.end());
 
       for (int i = 0; i < int(SIZE); ++i)
       {
@@ -563,7 +594,7 @@ namespace
       // Overrun by 3
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       for (int i = 0; i < int(SIZE); ++i)
       {
@@ -576,7 +607,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -599,7 +630,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -622,7 +653,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -645,7 +676,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -668,7 +699,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -691,7 +722,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -714,7 +745,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Compare compare = { Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
 
@@ -737,7 +768,7 @@ namespace
     {
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(input.begin(), input.end());
+      data.push_back(input.begin(), input.end());
 
       Compare compare = { Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12")  };
 
@@ -761,14 +792,14 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9") };
       Compare input2{ Ndc("9"), Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1(buffer1.raw, SIZE);
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2(data1, buffer2.raw, SIZE);
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -795,7 +826,7 @@ namespace
       DataM data1(bufferm1.raw, SIZE);
       for (auto&& v : input1)
       {
-        data1.push(std::move(v));
+        data1.push_back(std::move(v));
       }
 
       // Move construct from data1
@@ -805,7 +836,7 @@ namespace
       data1.clear();
       for (auto&& v : input2)
       {
-        data1.push(std::move(v));
+        data1.push_back(std::move(v));
       }
 
       CHECK(data2.begin() != data2.end());
@@ -822,17 +853,17 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
       Compare input2{ Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1(buffer1.raw, SIZE);
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2(buffer2.raw, SIZE);
-      data2.push(Ndc("0"));
+      data2.push_back(Ndc("0"));
 
       data2 = data1;
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -848,17 +879,17 @@ namespace
       Compare input1{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8") };
       Compare input2{ Ndc("8"), Ndc("7"), Ndc("6"), Ndc("5"), Ndc("4"), Ndc("3"), Ndc("2"), Ndc("1"), Ndc("0") };
       Data data1(buffer1.raw, SIZE);
-      data1.push(input1.begin(), input1.end());
+      data1.push_back(input1.begin(), input1.end());
 
       // Copy construct from data1
       Data data2(buffer2.raw, SIZE);
-      data2.push(Ndc("0"));
+      data2.push_back(Ndc("0"));
 
       data2 = etl::move(data1);
 
       // Now change data1
       data1.clear();
-      data1.push(input2.begin(), input2.end());
+      data1.push_back(input2.begin(), input2.end());
 
       CHECK(data2.begin() != data2.end());
       CHECK(data2.cbegin() != data2.cend());
@@ -873,7 +904,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator itr1 = data.begin() + 2;
       Data::iterator itr2 = data.begin() + 3;
@@ -895,7 +926,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator itr1 = data.begin() + 2;
       Data::const_iterator itr2 = data.begin() + 3;
@@ -917,7 +948,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::iterator begin = data.begin();
       Data::iterator end   = data.begin();
@@ -942,7 +973,7 @@ namespace
     {
       Compare test{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data(buffer1.raw, SIZE);
-      data.push(test.begin(), test.end());
+      data.push_back(test.begin(), test.end());
 
       Data::const_iterator begin = data.begin();
       Data::const_iterator end   = data.begin();
@@ -972,8 +1003,8 @@ namespace
       Compare input2{ Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1(buffer1.raw, 5U);
       Data data2(buffer2.raw, 6U);
-      data1.push(input1.begin(), input1.end());
-      data2.push(input2.begin(), input2.end());
+      data1.push_back(input1.begin(), input1.end());
+      data2.push_back(input2.begin(), input2.end());
 
       swap(data1, data2);
 
@@ -990,8 +1021,8 @@ namespace
       Compare input{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("7"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1(buffer1.raw, SIZE);
       Data data2(buffer1.raw, SIZE);
-      data1.push(input.begin(), input.end());
-      data2.push(input.begin(), input.end());
+      data1.push_back(input.begin(), input.end());
+      data2.push_back(input.begin(), input.end());
 
       CHECK(data1 == data2);
     }
@@ -1004,8 +1035,8 @@ namespace
       Compare input2{ Ndc("0"), Ndc("1"), Ndc("2"), Ndc("3"), Ndc("4"), Ndc("5"), Ndc("6"), Ndc("6"), Ndc("8"), Ndc("9"), Ndc("10"), Ndc("11"), Ndc("12") };
       Data data1(buffer1.raw, SIZE);
       Data data2(buffer2.raw, SIZE);
-      data1.push(input1.begin(), input1.end());
-      data2.push(input2.begin(), input2.end());
+      data1.push_back(input1.begin(), input1.end());
+      data2.push_back(input2.begin(), input2.end());
 
       CHECK(data1 != data2);
     }
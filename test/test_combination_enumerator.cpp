@@ -0,0 +1,212 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/combination_enumerator.h"
+#include "etl/combinations.h"
+
+#include <set>
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  //***************************************************************************
+  size_t count_bits(uint64_t value)
+  {
+    size_t count = 0U;
+
+    while (value != 0U)
+    {
+      value &= value - 1U;
+      ++count;
+    }
+
+    return count;
+  }
+
+  //***************************************************************************
+  /// Checks the complete sequence for N, K.
+  //***************************************************************************
+  template <size_t N, size_t K>
+  bool check_sequence()
+  {
+    typedef etl::combination_enumerator<N, K> Enumerator;
+
+    Enumerator e;
+    std::set<uint64_t> seen;
+
+    size_t count = 0U;
+    bool   passed = true;
+
+    do
+    {
+      const uint64_t mask = e.mask();
+
+      passed = passed && (count_bits(mask) == K);
+      passed = passed && (e.rank() == count);
+      passed = passed && (Enumerator::rank_of(e.mask()) == count);
+      passed = passed && (Enumerator(count).mask() == e.mask());
+      passed = passed && seen.insert(mask).second;
+
+      // The elements are in ascending order and match the mask.
+      uint64_t from_elements = 0U;
+
+      for (size_t i = 0U; i < K; ++i)
+      {
+        from_elements |= uint64_t(1U) << e[i];
+        passed = passed && ((i == 0U) || (e[i - 1U] < e[i]));
+      }
+
+      passed = passed && (from_elements == mask);
+
+      ++count;
+
+      if (count < Enumerator::size())
+      {
+        e.next();
+
+        // One element out, one in.
+        const uint64_t next_mask = e.mask();
+        passed = passed && (count_bits(mask ^ next_mask) == 2U);
+        passed = passed && (((mask >> e.removed()) & 1U) == 1U) && (((next_mask >> e.removed()) & 1U) == 0U);
+        passed = passed && (((mask >> e.added()) & 1U) == 0U) && (((next_mask >> e.added()) & 1U) == 1U);
+      }
+      else
+      {
+        passed = passed && !e.next();
+      }
+    } while (e.rank() != 0U);
+
+    return passed && (count == Enumerator::size()) && (seen.size() == etl::combinations<N, K>::value);
+  }
+
+  SUITE(test_combination_enumerator)
+  {
+    //*************************************************************************
+    TEST(test_size)
+    {
+      CHECK_EQUAL(1U,   (etl::combination_enumerator<5, 0>::size()));
+      CHECK_EQUAL(5U,   (etl::combination_enumerator<5, 1>::size()));
+      CHECK_EQUAL(10U,  (etl::combination_enumerator<5, 2>::size()));
+      CHECK_EQUAL(1U,   (etl::combination_enumerator<5, 5>::size()));
+      CHECK_EQUAL(252U, (etl::combination_enumerator<10, 5>::size()));
+      CHECK_EQUAL(601080390U, (etl::combination_enumerator<32, 16, uint32_t>::size()));
+    }
+
+    //*************************************************************************
+    TEST(test_first_combination)
+    {
+      etl::combination_enumerator<6, 3> e;
+
+      CHECK_EQUAL(0x07U, e.mask());
+      CHECK_EQUAL(0U, e.rank());
+      CHECK_EQUAL(0U, e[0]);
+      CHECK_EQUAL(1U, e[1]);
+      CHECK_EQUAL(2U, e[2]);
+      CHECK_EQUAL((etl::combination_enumerator<6, 3>::Npos), e.removed());
+      CHECK_EQUAL((etl::combination_enumerator<6, 3>::Npos), e.added());
+    }
+
+    //*************************************************************************
+    TEST(test_revolving_door_order)
+    {
+      // The revolving door order for 5 choose 3, as element sets.
+      const uint8_t expected[] = { 0x07, 0x0D, 0x0E, 0x0B, 0x19, 0x1A, 0x1C, 0x15, 0x16, 0x13 };
+
+      etl::combination_enumerator<5, 3> e;
+
+      for (size_t i = 0U; i < 10U; ++i)
+      {
+        CHECK_EQUAL(expected[i], e.mask());
+        CHECK_EQUAL(i != 9U, e.next());
+      }
+
+      // Back at the start.
+      CHECK_EQUAL(0x07U, e.mask());
+    }
+
+    //*************************************************************************
+    TEST(test_sequences)
+    {
+      CHECK_TRUE((check_sequence<1, 1>()));
+      CHECK_TRUE((check_sequence<4, 0>()));
+      CHECK_TRUE((check_sequence<4, 4>()));
+      CHECK_TRUE((check_sequence<5, 1>()));
+      CHECK_TRUE((check_sequence<5, 2>()));
+      CHECK_TRUE((check_sequence<6, 3>()));
+      CHECK_TRUE((check_sequence<7, 4>()));
+      CHECK_TRUE((check_sequence<8, 5>()));
+      CHECK_TRUE((check_sequence<10, 3>()));
+      CHECK_TRUE((check_sequence<12, 6>()));
+    }
+
+    //*************************************************************************
+    TEST(test_partitioned_enumeration)
+    {
+      typedef etl::combination_enumerator<12, 5> Enumerator;
+
+      const size_t Parts = 4U;
+      const size_t Total = Enumerator::size();
+
+      std::set<uint16_t> seen;
+
+      for (size_t part = 0U; part < Parts; ++part)
+      {
+        const size_t begin = (Total * part) / Parts;
+        const size_t end   = (Total * (part + 1U)) / Parts;
+
+        Enumerator e(begin);
+
+        for (size_t r = begin; r < end; ++r)
+        {
+          CHECK_EQUAL(r, e.rank());
+          seen.insert(e.mask());
+          e.next();
+        }
+      }
+
+      CHECK_EQUAL(Total, seen.size());
+    }
+
+    //*************************************************************************
+    TEST(test_wide_mask)
+    {
+      etl::combination_enumerator<40, 2, uint64_t> e;
+
+      size_t count = 1U;
+      while (e.next())
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(780U, count);
+    }
+  };
+}
@@ -0,0 +1,170 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/compact_list.h"
+
+#include <list>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::compact_list<std::string, 6> List;
+
+  //***********************************
+  std::vector<std::string> values_of(const List& list)
+  {
+    return std::vector<std::string>(list.begin(), list.end());
+  }
+
+  SUITE(test_compact_list)
+  {
+    //*************************************************************************
+    TEST(test_node_size)
+    {
+      // 16 bit links for 1000 nodes.
+      typedef etl::compact_list<uint32_t, 1000> Large;
+
+      CHECK(sizeof(Large) <= (1000U * 8U) + 32U);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      List list;
+
+      CHECK(list.empty());
+      CHECK_EQUAL(6U, list.max_size());
+      CHECK_THROW(list.pop_front(), etl::compact_list_empty);
+      CHECK_THROW(list.pop_back(), etl::compact_list_empty);
+
+      list.push_back("b");
+      list.push_back("c");
+      list.push_front("a");
+
+      CHECK_EQUAL(3U, list.size());
+      CHECK_EQUAL(std::string("a"), list.front());
+      CHECK_EQUAL(std::string("c"), list.back());
+
+      std::vector<std::string> reversed(list.rbegin(), list.rend());
+      CHECK_EQUAL(std::string("c"), reversed[0]);
+      CHECK_EQUAL(std::string("a"), reversed[2]);
+
+      list.pop_front();
+      list.pop_back();
+      CHECK_EQUAL(1U, list.size());
+      CHECK_EQUAL(std::string("b"), list.front());
+      CHECK_EQUAL(std::string("b"), list.back());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_remove_reverse)
+    {
+      List list;
+
+      list.push_back("a");
+      list.push_back("d");
+
+      List::iterator itr = list.begin();
+      ++itr;
+      itr = list.insert(itr, "c");
+      list.insert(itr, "b");
+
+      std::string more[] = { "e", "x" };
+      list.insert(list.end(), more, more + 2);
+
+      CHECK(list.full());
+      CHECK_THROW(list.push_back("y"), etl::compact_list_full);
+
+      std::string expected1[] = { "a", "b", "c", "d", "e", "x" };
+      CHECK(values_of(list) == std::vector<std::string>(expected1, expected1 + 6));
+
+      list.remove("x");
+      itr = list.erase(list.begin());
+      CHECK_EQUAL(std::string("b"), *itr);
+
+      List::iterator last = list.end();
+      --last;
+      itr = list.erase(list.begin(), last);
+      CHECK_EQUAL(std::string("e"), *itr);
+      CHECK_EQUAL(1U, list.size());
+
+      list.push_front("2");
+      list.push_front("1");
+      list.reverse();
+
+      std::string expected2[] = { "e", "2", "1" };
+      CHECK(values_of(list) == std::vector<std::string>(expected2, expected2 + 3));
+
+      list.clear();
+      CHECK(list.empty());
+      CHECK(list.begin() == list.end());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_compare)
+    {
+      std::string values[] = { "a", "b", "c" };
+
+      List list(values, values + 3);
+      List copy(list);
+
+      CHECK(copy == list);
+
+      copy.pop_back();
+      CHECK(copy != list);
+
+      copy = list;
+      CHECK(copy == list);
+    }
+
+    //*************************************************************************
+    TEST(test_reuses_nodes)
+    {
+      etl::compact_list<int, 4> list;
+      std::list<int>            compare;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        if (list.full())
+        {
+          list.pop_front();
+          compare.pop_front();
+        }
+
+        list.push_back(i);
+        compare.push_back(i);
+      }
+
+      CHECK_EQUAL(compare.size(), list.size());
+      CHECK(std::equal(compare.begin(), compare.end(), list.begin()));
+    }
+  }
+}
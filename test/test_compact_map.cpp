@@ -0,0 +1,216 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/compact_map.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::compact_map<int, std::string, 10> Map;
+
+  //***********************************
+  template <typename TMap, typename TCompare>
+  bool is_same_as(const TMap& map, const TCompare& compare)
+  {
+    if (map.size() != compare.size())
+    {
+      return false;
+    }
+
+    typename TCompare::const_iterator itr_compare = compare.begin();
+
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr, ++itr_compare)
+    {
+      if ((itr->first != itr_compare->first) || (itr->second != itr_compare->second))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_compact_map)
+  {
+    //*************************************************************************
+    TEST(test_node_size)
+    {
+      // 16 bit links for 10000 nodes.
+      typedef etl::compact_map<uint32_t, uint32_t, 10000> Large;
+
+      CHECK(sizeof(Large) <= (10000U * 16U) + 64U);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK_EQUAL(10U, map.max_size());
+
+      CHECK(map.insert(Map::value_type(3, "3")).second);
+      CHECK(map.insert(Map::value_type(1, "1")).second);
+      CHECK(map.insert(Map::value_type(2, "2")).second);
+      CHECK(!map.insert(Map::value_type(2, "x")).second);
+
+      CHECK_EQUAL(3U, map.size());
+      CHECK_EQUAL(7U, map.available());
+      CHECK_EQUAL(std::string("2"), map.find(2)->second);
+      CHECK(map.find(4) == map.end());
+      CHECK(map.contains(1));
+      CHECK_EQUAL(0U, map.count(4));
+      CHECK_EQUAL(std::string("3"), map.at(3));
+      CHECK_THROW(map.at(4), etl::compact_map_out_of_bounds);
+
+      map[4] = "4";
+      CHECK_EQUAL(std::string("4"), map[4]);
+      CHECK_EQUAL(4U, map.size());
+
+      std::vector<int> keys;
+      for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      int expected[] = { 1, 2, 3, 4 };
+      CHECK(keys == std::vector<int>(expected, expected + 4));
+
+      CHECK_EQUAL(4, map.rbegin()->first);
+      Map::iterator last = map.end();
+      --last;
+      CHECK_EQUAL(4, last->first);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      Map map;
+
+      for (int i = 0; i < 10; i += 2)
+      {
+        map[i] = "";
+      }
+
+      CHECK_EQUAL(4, map.lower_bound(4)->first);
+      CHECK_EQUAL(6, map.upper_bound(4)->first);
+      CHECK_EQUAL(6, map.lower_bound(5)->first);
+      CHECK_EQUAL(6, map.upper_bound(5)->first);
+      CHECK(map.lower_bound(9) == map.end());
+      CHECK(map.equal_range(4).first == map.find(4));
+      CHECK(map.equal_range(4).second == map.find(6));
+    }
+
+    //*************************************************************************
+    TEST(test_full_erase_copy)
+    {
+      Map map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        map[i] = std::string(1, char('a' + i));
+      }
+
+      CHECK(map.full());
+      CHECK_THROW(map[10], etl::compact_map_full);
+
+      CHECK_EQUAL(1U, map.erase(5));
+      CHECK_EQUAL(0U, map.erase(5));
+
+      Map::iterator itr = map.erase(map.find(6));
+      CHECK_EQUAL(7, itr->first);
+
+      itr = map.erase(map.begin(), map.find(3));
+      CHECK_EQUAL(3, itr->first);
+      CHECK_EQUAL(5U, map.size());
+
+      // Erased nodes are reused.
+      map[100] = "x";
+      CHECK_EQUAL(std::string("x"), map.at(100));
+
+      Map copy(map);
+      CHECK(copy == map);
+
+      Map assigned;
+      assigned[1] = "1";
+      assigned = map;
+      CHECK(assigned == map);
+
+      assigned[100] = "y";
+      CHECK(assigned != map);
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(map.begin() == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std_map)
+    {
+      typedef etl::compact_map<uint32_t, uint32_t, 1000> Large;
+
+      Large*                       p_map = new Large;
+      std::map<uint32_t, uint32_t> compare;
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint32_t key = (seed >> 8) % 1500U;
+
+        if (((seed >> 4) & 3U) != 0U)
+        {
+          if (compare.size() < 1000U)
+          {
+            (*p_map)[key] = uint32_t(i);
+            compare[key]  = uint32_t(i);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), p_map->erase(key));
+        }
+
+        if ((i % 1000) == 0)
+        {
+          CHECK(is_same_as(*p_map, compare));
+        }
+      }
+
+      CHECK(is_same_as(*p_map, compare));
+
+      delete p_map;
+    }
+  }
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/compact_set.h"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+  typedef etl::compact_set<int, 8> Set;
+
+  SUITE(test_compact_set)
+  {
+    //*************************************************************************
+    TEST(test_index_width)
+    {
+      // 8 bit links for up to 255 nodes.
+      typedef etl::compact_set<uint8_t, 200> Small;
+
+      CHECK(sizeof(Small) <= (200U * 5U) + 32U);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Set set;
+
+      int values[] = { 5, 3, 7, 1, 3 };
+      set.insert(values, values + 5);
+
+      CHECK_EQUAL(4U, set.size());
+      CHECK(set.contains(7));
+      CHECK(!set.contains(2));
+      CHECK_EQUAL(1U, set.count(5));
+      CHECK(set.find(2) == set.end());
+      CHECK_EQUAL(5, *set.lower_bound(4));
+      CHECK_EQUAL(7, *set.upper_bound(5));
+
+      std::vector<int> result(set.begin(), set.end());
+      int expected[] = { 1, 3, 5, 7 };
+      CHECK(result == std::vector<int>(expected, expected + 4));
+
+      std::vector<int> reversed(set.rbegin(), set.rend());
+      int expected_reversed[] = { 7, 5, 3, 1 };
+      CHECK(reversed == std::vector<int>(expected_reversed, expected_reversed + 4));
+
+      CHECK_EQUAL(1U, set.erase(3));
+      CHECK_EQUAL(0U, set.erase(3));
+      Set::iterator itr = set.erase(set.begin());
+      CHECK_EQUAL(5, *itr);
+      CHECK_EQUAL(2U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_copy)
+    {
+      Set set;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK(set.insert(i).second);
+      }
+
+      CHECK(set.full());
+      CHECK(!set.insert(3).second);
+      CHECK_THROW(set.insert(8), etl::compact_set_full);
+
+      Set copy(set);
+      CHECK(copy == set);
+
+      copy.erase(copy.find(4), copy.end());
+      CHECK_EQUAL(4U, copy.size());
+      CHECK(copy != set);
+
+      copy = set;
+      CHECK(copy == set);
+
+      set.clear();
+      CHECK(set.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std_set)
+    {
+      etl::compact_set<uint16_t, 250> set;
+      std::set<uint16_t>             compare;
+
+      uint32_t seed = 987U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint16_t key = uint16_t((seed >> 8) % 400U);
+
+        if (((seed >> 4) & 1U) != 0U)
+        {
+          if (compare.size() < 250U)
+          {
+            CHECK_EQUAL(compare.insert(key).second, set.insert(key).second);
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), set.erase(key));
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), set.size());
+      CHECK(std::equal(compare.begin(), compare.end(), set.begin()));
+    }
+  }
+}
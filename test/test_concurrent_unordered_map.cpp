@@ -0,0 +1,246 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/concurrent_unordered_map.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC && ETL_HAS_MUTEX
+
+namespace
+{
+  //*************************************************************************
+  struct Device
+  {
+    uint32_t id;
+    uint32_t status;
+    uint32_t check; // Always ~status, to detect torn reads.
+  };
+
+  Device make_device(uint32_t id, uint32_t status)
+  {
+    Device device = { id, status, ~status };
+    return device;
+  }
+
+  typedef etl::concurrent_unordered_map<int, Device, 16U, 8U, 4U> Map;
+
+  SUITE(test_concurrent_unordered_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK(!map.full());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(16U, map.max_size());
+      CHECK_EQUAL(16U, map.capacity());
+      CHECK_EQUAL(16U, map.available());
+      CHECK_EQUAL(8U, map.bucket_count());
+      CHECK_EQUAL(4U, map.stripe_count());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Map map;
+
+      CHECK(map.insert(1, make_device(1U, 10U)));
+      CHECK(map.insert(2, make_device(2U, 20U)));
+      CHECK(!map.insert(1, make_device(1U, 11U)));
+
+      CHECK_EQUAL(2U, map.size());
+
+      Device device = make_device(0U, 0U);
+
+      CHECK(map.find(1, device));
+      CHECK_EQUAL(10U, device.status);
+      CHECK(map.contains(2));
+      CHECK_EQUAL(1U, map.count(2));
+      CHECK(!map.find(3, device));
+      CHECK_EQUAL(0U, map.count(3));
+
+      CHECK_EQUAL(1U, map.erase(1));
+      CHECK_EQUAL(0U, map.erase(1));
+      CHECK(!map.contains(1));
+      CHECK(map.contains(2));
+      CHECK_EQUAL(1U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign_and_update)
+    {
+      Map map;
+
+      CHECK(map.insert_or_assign(1, make_device(1U, 10U)));
+      CHECK(map.insert_or_assign(1, make_device(1U, 11U)));
+      CHECK_EQUAL(1U, map.size());
+
+      CHECK(map.update(1, [](Device& d) { d = make_device(d.id, d.status + 1U); }));
+      CHECK(!map.update(2, [](Device& d) { d.status = 0U; }));
+
+      Device device = make_device(0U, 0U);
+      CHECK(map.find(1, device));
+      CHECK_EQUAL(12U, device.status);
+      CHECK_EQUAL(~12U, device.check);
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_clear)
+    {
+      Map map;
+
+      for (int i = 0; i < 16; ++i)
+      {
+        CHECK(map.insert(i, make_device(uint32_t(i), 0U)));
+      }
+
+      CHECK(map.full());
+      CHECK(!map.insert(16, make_device(16U, 0U)));
+      CHECK(!map.insert_or_assign(16, make_device(16U, 0U)));
+      CHECK(map.insert_or_assign(15, make_device(15U, 1U)));
+
+      // Erased nodes are reused.
+      CHECK_EQUAL(1U, map.erase(3));
+      CHECK(map.insert(16, make_device(16U, 0U)));
+
+      for (int i = 0; i < 17; ++i)
+      {
+        CHECK_EQUAL((i != 3), map.contains(i));
+      }
+
+      map.clear();
+
+      CHECK(map.empty());
+      CHECK(!map.contains(0));
+
+      for (int i = 0; i < 16; ++i)
+      {
+        CHECK(map.insert(i + 100, make_device(uint32_t(i), 0U)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_readers_and_writers_in_threads)
+    {
+      static const int Keys       = 32;
+      static const int Iterations = 20000;
+
+      etl::concurrent_unordered_map<int, Device, 2 * Keys, Keys, 4U> map;
+
+      for (int i = 0; i < Keys; i += 2)
+      {
+        map.insert(i, make_device(uint32_t(i), 0U));
+      }
+
+      std::atomic<bool> done(false);
+      std::atomic<bool> torn(false);
+
+      std::vector<std::thread> threads;
+
+      // Writers insert, update and erase the odd keys, and update the even ones.
+      for (int w = 0; w < 2; ++w)
+      {
+        threads.push_back(std::thread([&map, w]()
+        {
+          for (int i = 0; i < Iterations; ++i)
+          {
+            const int key = ((i * 2) + w) % Keys;
+
+            if ((key & 1) != 0)
+            {
+              if (!map.insert(key, make_device(uint32_t(key), uint32_t(i))))
+              {
+                map.erase(key);
+              }
+            }
+            else
+            {
+              map.update(key, [i](Device& d) { d = make_device(d.id, uint32_t(i)); });
+            }
+          }
+        }));
+      }
+
+      // Readers check that they never see a torn or misplaced value.
+      for (int r = 0; r < 4; ++r)
+      {
+        threads.push_back(std::thread([&map, &done, &torn]()
+        {
+          while (!done)
+          {
+            for (int key = 0; key < Keys; ++key)
+            {
+              Device device;
+
+              const bool found = map.find(key, device);
+
+              if (found && ((device.check != ~device.status) || (device.id != uint32_t(key))))
+              {
+                torn = true;
+              }
+
+              if (((key & 1) == 0) && !found)
+              {
+                torn = true;
+              }
+            }
+          }
+        }));
+      }
+
+      threads[0].join();
+      threads[1].join();
+      done = true;
+
+      for (size_t i = 2U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(!torn);
+
+      size_t count = 0U;
+
+      for (int key = 0; key < Keys; ++key)
+      {
+        count += map.count(key);
+      }
+
+      CHECK_EQUAL(count, map.size());
+    }
+  };
+}
+
+#endif
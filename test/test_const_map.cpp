@@ -0,0 +1,218 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/const_map.h"
+
+#include <map>
+#include <new>
+#include <string>
+
+#if ETL_USING_CPP14
+
+namespace
+{
+  typedef etl::const_map<int, char, 6> Map;
+
+  constexpr Map int_map({ {3, 'c'}, {1, 'a'}, {6, 'f'}, {5, 'e'}, {2, 'b'}, {4, 'd'} });
+
+  //***************************************************************************
+  struct CStringLess
+  {
+    constexpr bool operator ()(const char* lhs, const char* rhs) const
+    {
+      while ((*lhs != '\0') && (*lhs == *rhs))
+      {
+        ++lhs;
+        ++rhs;
+      }
+
+      return *lhs < *rhs;
+    }
+  };
+
+  enum class Colour
+  {
+    Red,
+    Green,
+    Blue
+  };
+
+  typedef etl::const_map<const char*, Colour, 3, CStringLess> ColourMap;
+
+  constexpr ColourMap colour_map({ {"red", Colour::Red}, {"green", Colour::Green}, {"blue", Colour::Blue} });
+
+  // Evaluated at compile time.
+  static_assert(int_map.size() == 6U, "Wrong size");
+  static_assert(int_map.is_valid(), "Duplicate keys");
+  static_assert(int_map.begin()->first == 1, "Not sorted");
+  static_assert(int_map.at(4) == 'd', "Wrong value");
+  static_assert(int_map.contains(6), "Key not found");
+  static_assert(!int_map.contains(7), "Key found");
+  static_assert(int_map.find(0) == int_map.end(), "Key found");
+  static_assert(colour_map.at("green") == Colour::Green, "Wrong value");
+
+  SUITE(test_const_map)
+  {
+    //*************************************************************************
+    TEST(test_sorted)
+    {
+      int expected = 1;
+
+      for (Map::const_iterator itr = int_map.begin(); itr != int_map.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        CHECK_EQUAL(char('a' + expected - 1), itr->second);
+        ++expected;
+      }
+
+      CHECK_EQUAL(7, expected);
+      CHECK_EQUAL(6, int_map.rbegin()->first);
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      for (int i = 1; i <= 6; ++i)
+      {
+        Map::const_iterator itr = int_map.find(i);
+
+        CHECK(itr != int_map.end());
+        CHECK_EQUAL(i, itr->first);
+        CHECK(int_map.contains(i));
+        CHECK_EQUAL(1U, int_map.count(i));
+      }
+
+      CHECK(int_map.find(0) == int_map.end());
+      CHECK(int_map.find(7) == int_map.end());
+      CHECK_EQUAL(0U, int_map.count(7));
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      CHECK_EQUAL('a', int_map.at(1));
+      CHECK_EQUAL('f', int_map.at(6));
+      CHECK_THROW(int_map.at(7), etl::const_map_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      CHECK_EQUAL(1, int_map.lower_bound(0)->first);
+      CHECK_EQUAL(3, int_map.lower_bound(3)->first);
+      CHECK_EQUAL(4, int_map.upper_bound(3)->first);
+      CHECK(int_map.lower_bound(7) == int_map.end());
+      CHECK(int_map.upper_bound(6) == int_map.end());
+
+      ETL_OR_STD::pair<Map::const_iterator, Map::const_iterator> range = int_map.equal_range(2);
+
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(2, range.first->first);
+    }
+
+    //*************************************************************************
+    TEST(test_custom_compare)
+    {
+      std::string name("blue");
+
+      CHECK(colour_map.at(name.c_str()) == Colour::Blue);
+      CHECK(colour_map.find("yellow") == colour_map.end());
+      CHECK_EQUAL(std::string("blue"), std::string(colour_map.begin()->first));
+    }
+
+    //*************************************************************************
+    TEST(test_transparent_compare)
+    {
+      constexpr etl::const_map<long, int, 3, etl::less<>> map({ {30L, 3}, {10L, 1}, {20L, 2} });
+
+      CHECK_EQUAL(2, map.at(20));
+      CHECK(map.contains(10));
+      CHECK(!map.contains(15));
+    }
+
+    //*************************************************************************
+    TEST(test_is_valid)
+    {
+      constexpr etl::const_map<int, int, 3> map({ {2, 1}, {1, 0}, {2, 2} });
+
+      static_assert(!map.is_valid(), "Duplicate keys not detected");
+
+      // Equal keys keep their original order.
+      CHECK_EQUAL(1, map.begin()[1].second);
+      CHECK_EQUAL(2, map.begin()[2].second);
+    }
+
+    //*************************************************************************
+    TEST(test_large_table_against_std_map)
+    {
+      static const size_t Size = 200U;
+
+      etl::const_map<int, int, Size>::value_type values[Size] = {};
+      std::map<int, int> compare;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        const int key = int((i * 73U) % 1000U);
+
+        // value_type has a const key, so build it in place.
+        new (&values[i]) etl::const_map<int, int, Size>::value_type(key, int(i));
+        compare[key] = int(i);
+      }
+
+      etl::const_map<int, int, Size> map(values);
+
+      CHECK(map.is_valid());
+      CHECK(std::equal(map.begin(), map.end(), compare.begin(),
+                       [](const etl::const_map<int, int, Size>::value_type& lhs, const std::pair<const int, int>& rhs)
+                       {
+                         return (lhs.first == rhs.first) && (lhs.second == rhs.second);
+                       }));
+
+      for (int key = -1; key <= 1000; ++key)
+      {
+        CHECK_EQUAL(compare.count(key), map.count(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_make_const_map)
+    {
+      constexpr auto map = etl::make_const_map<int, int>({ {2, 20}, {1, 10} });
+
+      static_assert(map.size() == 2U, "Wrong size");
+      static_assert(map.at(2) == 20, "Wrong value");
+
+      CHECK(map == map);
+      CHECK_EQUAL(10, map.begin()->second);
+    }
+  }
+}
+
+#endif
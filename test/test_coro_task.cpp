@@ -0,0 +1,355 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/coro_task.h"
+
+#if ETL_USING_CORO_TASK
+
+#include "etl/scheduler.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/function.h"
+
+#include <stdint.h>
+#include <vector>
+
+namespace
+{
+  typedef etl::queue_spsc_atomic<int, 4> Queue;
+  typedef etl::coro_frame_pool<512, 4>   Pool;
+
+  //***************************************************************************
+  struct Clock
+  {
+    uint32_t operator()() const
+    {
+      return ticks;
+    }
+
+    uint32_t ticks = 0;
+  };
+
+  //***************************************************************************
+  etl::coro_routine consumer(etl::icoro_frame_allocator&, Queue& queue, std::vector<int>& results)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      int value = co_await etl::coro_pop(queue);
+      results.push_back(value);
+    }
+  }
+
+  //***************************************************************************
+  etl::coro_routine sleeper(etl::icoro_frame_allocator&, Clock& clock, std::vector<uint32_t>& wake_times)
+  {
+    wake_times.push_back(clock());
+    co_await etl::coro_delay(clock, 3);
+    wake_times.push_back(clock());
+    co_await etl::coro_delay(clock, 5);
+    wake_times.push_back(clock());
+  }
+
+  //***************************************************************************
+  etl::coro_routine waiter(etl::icoro_frame_allocator&, etl::coro_flag& flag, int& count)
+  {
+    co_await flag;
+    ++count;
+    co_await flag;
+    ++count;
+  }
+
+  //***************************************************************************
+  etl::coro_routine counter(etl::icoro_frame_allocator&, int& count, int n)
+  {
+    for (int i = 0; i < n; ++i)
+    {
+      ++count;
+      co_await etl::coro_yield();
+    }
+  }
+
+  //***************************************************************************
+  struct Worker
+  {
+    etl::coro_routine run(etl::icoro_frame_allocator&, int n)
+    {
+      for (int i = 0; i < n; ++i)
+      {
+        total += i;
+        co_await etl::coro_yield();
+      }
+    }
+
+    int total = 0;
+  };
+
+  //***************************************************************************
+  // Feeds the coroutines and stops the scheduler when all of the tasks are done.
+  //***************************************************************************
+  struct Environment
+  {
+    Environment()
+      : idle_callback(*this, &Environment::on_idle)
+    {
+    }
+
+    void on_idle()
+    {
+      ++clock.ticks;
+
+      if ((clock.ticks == 2) || (clock.ticks == 4) || (clock.ticks == 5))
+      {
+        queue.push(int(clock.ticks * 10));
+      }
+
+      if ((clock.ticks == 6) || (clock.ticks == 9))
+      {
+        flag.set();
+      }
+
+      bool all_done = true;
+
+      for (size_t i = 0; i < tasks.size(); ++i)
+      {
+        all_done = all_done && tasks[i]->is_done();
+      }
+
+      if (all_done || (clock.ticks > 100))
+      {
+        p_scheduler->exit_scheduler();
+      }
+    }
+
+    Clock                        clock;
+    Queue                        queue;
+    etl::coro_flag               flag;
+    std::vector<etl::coro_task*> tasks;
+    etl::ischeduler*             p_scheduler = nullptr;
+    etl::function<Environment, void> idle_callback;
+  };
+
+  SUITE(test_coro_task)
+  {
+    //*************************************************************************
+    TEST(test_coro_routine_lifetime)
+    {
+      Pool pool;
+      int count = 0;
+
+      {
+        etl::coro_routine routine = counter(pool, count, 2);
+
+        CHECK_TRUE(routine.valid());
+        CHECK_FALSE(routine.done());
+        CHECK_TRUE(routine.is_ready());
+        CHECK_EQUAL(3U, pool.available());
+        CHECK_EQUAL(0, count);
+
+        routine.resume();
+        CHECK_EQUAL(1, count);
+        routine.resume();
+        CHECK_EQUAL(2, count);
+        CHECK_FALSE(routine.done());
+        routine.resume();
+        CHECK_TRUE(routine.done());
+        CHECK_FALSE(routine.is_ready());
+
+        etl::coro_routine moved(etl::move(routine));
+        CHECK_FALSE(routine.valid());
+        CHECK_TRUE(moved.valid());
+        CHECK_EQUAL(3U, pool.available());
+      }
+
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      etl::coro_frame_pool<512, 1> pool;
+      int count = 0;
+
+      etl::coro_routine first  = counter(pool, count, 1);
+      etl::coro_routine second = counter(pool, count, 1);
+
+      CHECK_TRUE(first.valid());
+      CHECK_FALSE(second.valid());
+      CHECK_TRUE(second.done());
+      CHECK_EQUAL(0U, pool.available());
+
+      first.destroy();
+      CHECK_EQUAL(1U, pool.available());
+
+      second = counter(pool, count, 1);
+      CHECK_TRUE(second.valid());
+    }
+
+    //*************************************************************************
+    TEST(test_frame_too_large)
+    {
+      etl::coro_frame_pool<etl::coro_frame_header_size, 2> pool;
+      int count = 0;
+
+      etl::coro_routine routine = counter(pool, count, 1);
+
+      CHECK_FALSE(routine.valid());
+      CHECK_EQUAL(2U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_member_function_coroutine)
+    {
+      Pool   pool;
+      Worker worker;
+
+      etl::coro_task task(0, worker.run(pool, 4));
+
+      while (!task.is_done())
+      {
+        CHECK_EQUAL(1U, task.task_request_work());
+        task.task_process_work();
+      }
+
+      CHECK_EQUAL(0 + 1 + 2 + 3, worker.total);
+      CHECK_EQUAL(0U, task.task_request_work());
+    }
+
+    //*************************************************************************
+    TEST(test_task_not_running)
+    {
+      Pool pool;
+      int count = 0;
+
+      etl::coro_task task(0);
+      CHECK_TRUE(task.is_done());
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      task.set_routine(counter(pool, count, 1));
+      CHECK_EQUAL(1U, task.task_request_work());
+
+      task.set_task_running(false);
+      CHECK_EQUAL(0U, task.task_request_work());
+      task.task_process_work();
+      CHECK_EQUAL(0, count);
+
+      task.set_task_running(true);
+      task.task_process_work();
+      CHECK_EQUAL(1, count);
+    }
+
+    //*************************************************************************
+    TEST(test_scheduler)
+    {
+      Pool        pool;
+      Environment env;
+
+      std::vector<int>      results;
+      std::vector<uint32_t> wake_times;
+      int                   flag_count = 0;
+
+      etl::coro_task consumer_task(2, consumer(pool, env.queue, results));
+      etl::coro_task sleeper_task(1, sleeper(pool, env.clock, wake_times));
+      etl::coro_task waiter_task(0, waiter(pool, env.flag, flag_count));
+
+      CHECK_EQUAL(1U, pool.available());
+
+      env.tasks.push_back(&consumer_task);
+      env.tasks.push_back(&sleeper_task);
+      env.tasks.push_back(&waiter_task);
+
+      etl::scheduler<etl::scheduler_policy_sequential_single, 3> scheduler;
+      env.p_scheduler = &scheduler;
+      scheduler.set_idle_callback(env.idle_callback);
+      scheduler.add_task(consumer_task);
+      scheduler.add_task(sleeper_task);
+      scheduler.add_task(waiter_task);
+
+      scheduler.start();
+
+      CHECK_TRUE(consumer_task.is_done());
+      CHECK_TRUE(sleeper_task.is_done());
+      CHECK_TRUE(waiter_task.is_done());
+
+      std::vector<int> expected_results = { 20, 40, 50 };
+      CHECK(expected_results == results);
+
+      std::vector<uint32_t> expected_wake_times = { 0, 3, 8 };
+      CHECK(expected_wake_times == wake_times);
+
+      CHECK_EQUAL(2, flag_count);
+      CHECK_FALSE(env.flag.is_set());
+      CHECK(env.clock.ticks < 100U);
+    }
+
+    //*************************************************************************
+    TEST(test_delay_wraparound)
+    {
+      Pool  pool;
+      Clock clock;
+      std::vector<uint32_t> wake_times;
+
+      clock.ticks = 0xFFFFFFFEUL;
+
+      etl::coro_task task(0, sleeper(pool, clock, wake_times));
+
+      task.task_process_work();
+      CHECK_EQUAL(1U, wake_times.size());
+
+      clock.ticks = 0U;
+      CHECK_EQUAL(0U, task.task_request_work());
+
+      clock.ticks = 1U;
+      CHECK_EQUAL(1U, task.task_request_work());
+      task.task_process_work();
+      CHECK_EQUAL(2U, wake_times.size());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_without_suspend)
+    {
+      Pool  pool;
+      Queue queue;
+      std::vector<int> results;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+
+      etl::coro_task task(0, consumer(pool, queue, results));
+
+      task.task_process_work();
+
+      CHECK_TRUE(task.is_done());
+      std::vector<int> expected = { 1, 2, 3 };
+      CHECK(expected == results);
+    }
+  }
+}
+
+#endif
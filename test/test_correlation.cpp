@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/correlation.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -280,5 +281,69 @@ namespace
       covariance_result = correlation3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_welford_correlation_constructor)
+    {
+      // Negative correlation.
+      etl::welford_correlation<etl::correlation_type::Population, float> correlation1(input_f.begin(), input_f.end(), input_f_inv.begin());
+      CHECK_CLOSE(-1.0, double(correlation1), 0.01);
+      CHECK_CLOSE(-8.25, correlation1.get_covariance(), 0.01);
+
+      // Zero correlation
+      etl::welford_correlation<etl::correlation_type::Population, char> correlation2(input_c.begin(), input_c.end(), input_c_flat.begin());
+      CHECK_CLOSE(0.0, double(correlation2), 0.01);
+      CHECK_CLOSE(0.0, correlation2.get_covariance(), 0.01);
+
+      // Positive correlation.
+      etl::welford_correlation<etl::correlation_type::Sample, double> correlation3(input_d.begin(), input_d.end(), input_d.begin());
+      CHECK_CLOSE(1.0, double(correlation3), 0.01);
+      CHECK_CLOSE(9.17, correlation3.get_covariance(), 0.01);
+      CHECK_EQUAL(10U, correlation3.count());
+    }
+
+    //*************************************************************************
+    TEST(test_welford_correlation_merge_and_remove)
+    {
+      std::vector<double> samples1;
+      std::vector<double> samples2;
+
+      for (size_t i = 0U; i < 600U; ++i)
+      {
+        samples1.push_back(double((i * 7919U) % 1013U));
+        samples2.push_back((samples1.back() * 0.5) + double((i * 104729U) % 331U));
+      }
+
+      etl::welford_correlation<etl::correlation_type::Sample, double> whole(samples1.begin(), samples1.end(), samples2.begin());
+
+      etl::welford_correlation<etl::correlation_type::Sample, double> part1(samples1.begin(), samples1.begin() + 250, samples2.begin());
+      etl::welford_correlation<etl::correlation_type::Sample, double> part2(samples1.begin() + 250, samples1.end(), samples2.begin() + 250);
+
+      part1.merge(part2);
+
+      CHECK_EQUAL(whole.count(), part1.count());
+      CHECK_CLOSE(whole.get_correlation(), part1.get_correlation(), 1e-9);
+      CHECK_CLOSE(whole.get_covariance(), part1.get_covariance(), 1e-6);
+
+      // The raw sum correlation merges too.
+      etl::correlation<etl::correlation_type::Sample, double> raw_part1(samples1.begin(), samples1.begin() + 250, samples2.begin());
+      etl::correlation<etl::correlation_type::Sample, double> raw_part2(samples1.begin() + 250, samples1.end(), samples2.begin() + 250);
+      raw_part1.merge(raw_part2);
+
+      CHECK_EQUAL(whole.count(), raw_part1.count());
+      CHECK_CLOSE(whole.get_correlation(), raw_part1.get_correlation(), 1e-6);
+
+      // Remove the first 250 pairs, to leave the second part.
+      etl::welford_correlation<etl::correlation_type::Sample, double> window(whole);
+
+      for (size_t i = 0U; i < 250U; ++i)
+      {
+        window.remove(samples1[i], samples2[i]);
+      }
+
+      CHECK_EQUAL(part2.count(), window.count());
+      CHECK_CLOSE(part2.get_correlation(), window.get_correlation(), 1e-9);
+      CHECK_CLOSE(part2.get_covariance(), window.get_covariance(), 1e-6);
+    }
   };
 }
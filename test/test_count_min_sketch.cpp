@@ -0,0 +1,159 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/count_min_sketch.h"
+#include "etl/hash.h"
+
+#include <map>
+#include <stdint.h>
+
+namespace
+{
+  //*************************************************************************
+  // A skewed stream of device ids. Device n appears about 1000 / (n + 1) times.
+  //*************************************************************************
+  std::map<uint32_t, uint32_t> make_counts()
+  {
+    std::map<uint32_t, uint32_t> counts;
+
+    for (uint32_t id = 0U; id < 2000U; ++id)
+    {
+      counts[id * 7919U] = 1U + (1000U / (id + 1U));
+    }
+
+    return counts;
+  }
+
+  SUITE(test_count_min_sketch)
+  {
+    //*************************************************************************
+    TEST(test_estimates_are_upper_bounds)
+    {
+      etl::count_min_sketch<1000, 4, uint32_t> sketch;
+
+      CHECK_EQUAL(1024U, sketch.width());
+      CHECK_EQUAL(4U, sketch.depth());
+
+      const std::map<uint32_t, uint32_t> counts = make_counts();
+      uint64_t total = 0U;
+
+      // Interleave the adds.
+      for (uint32_t round = 0U; round < 1001U; ++round)
+      {
+        for (std::map<uint32_t, uint32_t>::const_iterator itr = counts.begin(); itr != counts.end(); ++itr)
+        {
+          if (round < itr->second)
+          {
+            sketch.add(itr->first);
+            ++total;
+          }
+        }
+      }
+
+      CHECK_EQUAL(total, sketch.total());
+
+      size_t exact = 0U;
+
+      for (std::map<uint32_t, uint32_t>::const_iterator itr = counts.begin(); itr != counts.end(); ++itr)
+      {
+        const uint32_t estimate = sketch.estimate(itr->first);
+
+        CHECK(estimate >= itr->second);
+
+        if (estimate == itr->second)
+        {
+          ++exact;
+        }
+      }
+
+      // The top talkers are counted almost exactly.
+      CHECK(sketch.estimate(0U) <= 1010U);
+      CHECK(exact > (counts.size() / 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_add_with_count)
+    {
+      etl::count_min_sketch<64, 3, uint32_t> sketch;
+
+      CHECK_EQUAL(5U, sketch.add(42U, 5U));
+      CHECK_EQUAL(8U, sketch.add(42U, 3U));
+      CHECK_EQUAL(8U, sketch.estimate(42U));
+      CHECK_EQUAL(0U, sketch.estimate(43U) == 8U ? 1U : 0U);
+
+      sketch.clear();
+      CHECK_EQUAL(0U, sketch.estimate(42U));
+      CHECK_EQUAL(0U, sketch.total());
+    }
+
+    //*************************************************************************
+    TEST(test_saturation)
+    {
+      etl::count_min_sketch<64, 2, uint32_t, etl::hash<uint32_t>, uint8_t> sketch;
+
+      for (int i = 0; i < 300; ++i)
+      {
+        sketch.add(7U);
+      }
+
+      CHECK_EQUAL(255U, sketch.estimate(7U));
+
+      etl::count_min_sketch<64, 2, uint32_t, etl::hash<uint32_t>, uint8_t> other;
+      other.add(7U, 10U);
+
+      sketch.merge(other);
+      CHECK_EQUAL(255U, sketch.estimate(7U));
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::count_min_sketch<256, 4, uint32_t> core1;
+      etl::count_min_sketch<256, 4, uint32_t> core2;
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        core1.add(i, i);
+        core2.add(i, 2U * i);
+      }
+
+      core1.merge(core2);
+
+      CHECK_EQUAL(uint64_t(3U * 4950U), core1.total());
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        CHECK(core1.estimate(i) >= (3U * i));
+      }
+
+      CHECK_EQUAL(297U, core1.estimate(99U) >= 297U ? 297U : 0U);
+    }
+  }
+}
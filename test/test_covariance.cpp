@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/covariance.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -238,5 +239,52 @@ namespace
       covariance_result = covariance3.get_covariance();
       CHECK_CLOSE(9.17, covariance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_covariance_block_add_matches_single_values)
+    {
+      std::vector<float>  samples_f1;
+      std::vector<float>  samples_f2;
+      std::vector<double> samples_d1;
+      std::vector<double> samples_d2;
+      std::vector<int>    samples_i1;
+      std::vector<int>    samples_i2;
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 1003U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int sample1 = int16_t(seed >> 16);
+        seed = (seed * 1103515245U) + 12345U;
+        const int sample2 = int16_t(seed >> 16);
+
+        samples_i1.push_back(sample1);
+        samples_i2.push_back(sample1 - (sample2 / 2));
+        samples_f1.push_back(float(samples_i1.back()) / 32768.0f);
+        samples_f2.push_back(float(samples_i2.back()) / 32768.0f);
+        samples_d1.push_back(double(samples_i1.back()) / 32768.0);
+        samples_d2.push_back(double(samples_i2.back()) / 32768.0);
+      }
+
+      for (size_t length = 0U; length <= samples_f1.size(); length += ((length < 40U) ? 1U : 321U))
+      {
+        etl::covariance<etl::covariance_type::Population, float> single_f(samples_f1.begin(), samples_f1.begin() + length, samples_f2.begin());
+        etl::covariance<etl::covariance_type::Population, float> block_f;
+        block_f.add(etl::span<const float>(samples_f1.data(), length), etl::span<const float>(samples_f2.data(), samples_f2.size()));
+        CHECK_EQUAL(single_f.count(), block_f.count());
+        CHECK_CLOSE(single_f.get_covariance(), block_f.get_covariance(), 1e-4);
+
+        etl::covariance<etl::covariance_type::Population, double> single_d(samples_d1.begin(), samples_d1.begin() + length, samples_d2.begin());
+        etl::covariance<etl::covariance_type::Population, double> block_d;
+        block_d.add(etl::span<const double>(samples_d1.data(), length), etl::span<const double>(samples_d2.data(), length));
+        CHECK_CLOSE(single_d.get_covariance(), block_d.get_covariance(), 1e-9);
+
+        etl::covariance<etl::covariance_type::Population, int, int64_t> single_i(samples_i1.begin(), samples_i1.begin() + length, samples_i2.begin());
+        etl::covariance<etl::covariance_type::Population, int, int64_t> block_i;
+        block_i.add(etl::span<const int>(samples_i1.data(), length), etl::span<const int>(samples_i2.data(), length));
+        CHECK_EQUAL(single_i.get_covariance(), block_i.get_covariance());
+      }
+    }
   };
 }
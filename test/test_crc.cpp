@@ -57,6 +57,36 @@ SOFTWARE.
 
 namespace
 {
+  //***************************************************************************
+  // Checks that combining the CRCs of every split of the data gives the CRC of the whole.
+  template <typename TCrc>
+  bool check_combine()
+  {
+    typedef typename TCrc::value_type value_type;
+
+    std::vector<uint8_t> data(300U);
+
+    for (size_t i = 0UL; i < data.size(); ++i)
+    {
+      data[i] = uint8_t((i * 151U) + (i >> 2U));
+    }
+
+    const value_type expected = TCrc(data.begin(), data.end());
+
+    for (size_t split = 0UL; split <= data.size(); ++split)
+    {
+      value_type crc_a = TCrc(data.begin(), data.begin() + split);
+      value_type crc_b = TCrc(data.begin() + split, data.end());
+
+      if (etl::crc_combine<TCrc>(crc_a, crc_b, data.size() - split) != expected)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_crc)
   {
     //*************************************************************************
@@ -1253,6 +1283,37 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc_combine)
+    {
+      CHECK(check_combine<etl::crc8_ccitt>());
+      CHECK(check_combine<etl::crc8_rohc>());
+      CHECK(check_combine<etl::crc16>());
+      CHECK(check_combine<etl::crc16_ccitt>());
+      CHECK(check_combine<etl::crc16_genibus>());
+      CHECK(check_combine<etl::crc16_x25>());
+      CHECK(check_combine<etl::crc32>());
+      CHECK(check_combine<etl::crc32_c>());
+      CHECK(check_combine<etl::crc32_bzip2>());
+      CHECK(check_combine<etl::crc32_mpeg2>());
+      CHECK(check_combine<etl::crc32_posix>());
+      CHECK(check_combine<etl::crc64_ecma>());
+      CHECK(check_combine<etl::crc32_t16>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_combine_check_value)
+    {
+      std::string data1("1234");
+      std::string data2("56789");
+
+      uint32_t crc1 = etl::crc32(data1.begin(), data1.end());
+      uint32_t crc2 = etl::crc32(data2.begin(), data2.end());
+
+      CHECK_EQUAL(0xCBF43926UL, etl::crc32::combine(crc1, crc2, data2.size()));
+      CHECK_EQUAL(crc1, etl::crc32::combine(crc1, etl::crc32().value(), 0U));
+    }
   };
 }
 
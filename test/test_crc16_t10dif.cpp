@@ -258,6 +258,70 @@ namespace
       uint16_t crc3 = etl::crc16_t10dif_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Accelerated
+    //*************************************************************************
+    TEST(test_crc16_t10dif_accelerated)
+    {
+      std::string data("123456789");
+
+      uint16_t crc1 = etl::crc16_t10dif_accelerated(data.begin(), data.end());
+      CHECK_EQUAL(0xD0DBU, crc1);
+
+      uint16_t crc2 = etl::crc16_t10dif_accelerated(data.data(), data.data() + data.size());
+      CHECK_EQUAL(0xD0DBU, crc2);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_t10dif_accelerated_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc16_t10dif_accelerated crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint16_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xD0DBU, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc16_t10dif_accelerated_add_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      // Covers the table only, one and four block folds, and the remainders.
+      for (size_t length = 0UL; length < 300UL; ++length)
+      {
+        uint16_t expected = etl::crc16_t10dif(data.begin() + 1, data.begin() + 1 + length);
+        uint16_t actual   = etl::crc16_t10dif_accelerated(data.data() + 1, data.data() + 1 + length);
+
+        CHECK_EQUAL(expected, actual);
+      }
+
+      // Add the blocks in uneven pieces.
+      etl::crc16_t10dif_accelerated crc_calculator;
+
+      const uint8_t* p = data.data();
+      crc_calculator.add(p, p + 3);
+      crc_calculator.add(p + 3, p + 200);
+      crc_calculator.add(p + 200, p + 201);
+      crc_calculator.add(p + 201, p + data.size());
+
+      uint16_t expected = etl::crc16_t10dif(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
   };
 }
 
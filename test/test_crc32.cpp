@@ -258,6 +258,197 @@ namespace
       uint32_t crc3 = etl::crc32_t4(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    // Slice by 8
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8)
+    {
+      std::string data("123456789");
+
+      uint32_t crc1 = etl::crc32_slice_by_8(data.begin(), data.end());
+      CHECK_EQUAL(0xCBF43926UL, crc1);
+
+      uint32_t crc2 = etl::crc32_slice_by_8(data.data(), data.data() + data.size());
+      CHECK_EQUAL(0xCBF43926UL, crc2);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_slice_by_8 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_8_add_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        uint32_t expected = etl::crc32(data.begin(), data.begin() + length);
+        uint32_t actual   = etl::crc32_slice_by_8(data.data(), data.data() + length);
+
+        CHECK_EQUAL(expected, actual);
+      }
+
+      // Add the blocks in uneven pieces.
+      etl::crc32_slice_by_8 crc_calculator;
+
+      const uint8_t* p = data.data();
+      crc_calculator.add(p, p + 3);
+      crc_calculator.add(p + 3, p + 200);
+      crc_calculator.add(p + 200, p + 201);
+      crc_calculator.add(p + 201, p + data.size());
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    // Slice by 16
+    //*************************************************************************
+    TEST(test_crc32_slice_by_16)
+    {
+      std::string data("123456789");
+
+      uint32_t crc1 = etl::crc32_slice_by_16(data.begin(), data.end());
+      CHECK_EQUAL(0xCBF43926UL, crc1);
+
+      uint32_t crc2 = etl::crc32_slice_by_16(data.data(), data.data() + data.size());
+      CHECK_EQUAL(0xCBF43926UL, crc2);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_16_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_slice_by_16 crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_slice_by_16_add_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 100UL; ++length)
+      {
+        uint32_t expected = etl::crc32(data.begin(), data.begin() + length);
+        uint32_t actual   = etl::crc32_slice_by_16(data.data(), data.data() + length);
+
+        CHECK_EQUAL(expected, actual);
+      }
+
+      // Add the blocks in uneven pieces.
+      etl::crc32_slice_by_16 crc_calculator;
+
+      const uint8_t* p = data.data();
+      crc_calculator.add(p, p + 3);
+      crc_calculator.add(p + 3, p + 200);
+      crc_calculator.add(p + 200, p + 201);
+      crc_calculator.add(p + 201, p + data.size());
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
+
+    //*************************************************************************
+    // Accelerated
+    //*************************************************************************
+    TEST(test_crc32_accelerated)
+    {
+      std::string data("123456789");
+
+      uint32_t crc1 = etl::crc32_accelerated(data.begin(), data.end());
+      CHECK_EQUAL(0xCBF43926UL, crc1);
+
+      uint32_t crc2 = etl::crc32_accelerated(data.data(), data.data() + data.size());
+      CHECK_EQUAL(0xCBF43926UL, crc2);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_accelerated_add_values)
+    {
+      std::string data("123456789");
+
+      etl::crc32_accelerated crc_calculator;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        crc_calculator.add(data[i]);
+      }
+
+      uint32_t crc = crc_calculator;
+
+      CHECK_EQUAL(0xCBF43926UL, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_accelerated_add_blocks)
+    {
+      std::vector<uint8_t> data(1000U);
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 37U) + (i >> 3U));
+      }
+
+      for (size_t length = 0UL; length < 300UL; ++length)
+      {
+        uint32_t expected = etl::crc32(data.begin(), data.begin() + length);
+        uint32_t actual   = etl::crc32_accelerated(data.data() + 1, data.data() + 1 + length);
+        uint32_t shifted  = etl::crc32(data.begin() + 1, data.begin() + 1 + length);
+
+        CHECK_EQUAL(shifted, actual);
+        CHECK_EQUAL(expected, etl::crc32_accelerated(data.data(), data.data() + length).value());
+      }
+
+      // Add the blocks in uneven pieces.
+      etl::crc32_accelerated crc_calculator;
+
+      const uint8_t* p = data.data();
+      crc_calculator.add(p, p + 3);
+      crc_calculator.add(p + 3, p + 200);
+      crc_calculator.add(p + 200, p + 201);
+      crc_calculator.add(p + 201, p + data.size());
+
+      uint32_t expected = etl::crc32(data.begin(), data.end());
+
+      CHECK_EQUAL(expected, crc_calculator.value());
+    }
   };
 }
 
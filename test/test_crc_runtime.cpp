@@ -0,0 +1,167 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/crc_runtime.h"
+#include "etl/crc8_ccitt.h"
+#include "etl/crc8_rohc.h"
+#include "etl/crc16_x25.h"
+#include "etl/crc16_xmodem.h"
+#include "etl/crc16_riello.h"
+#include "etl/crc32.h"
+#include "etl/crc32_bzip2.h"
+#include "etl/crc64_ecma.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  const char check[] = "123456789";
+
+  //*************************************************************************
+  std::vector<uint8_t> make_data()
+  {
+    std::vector<uint8_t> data;
+    uint32_t seed = 17U;
+
+    for (size_t i = 0U; i < 1031U; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      data.push_back(uint8_t(seed >> 24));
+    }
+
+    return data;
+  }
+
+  //*************************************************************************
+  /// Compares a run time CRC with a compile time CRC, for all slice counts.
+  //*************************************************************************
+  template <typename TCrc, typename TParameters>
+  bool matches()
+  {
+    typedef typename TCrc::value_type accumulator_type;
+
+    const etl::crc_runtime_parameters<accumulator_type> parameters = etl::crc_runtime_parameters<accumulator_type>::template from<TParameters>();
+    const std::vector<uint8_t> data = make_data();
+
+    accumulator_type buffer1[etl::crc_runtime_table<accumulator_type, 1U>::Size];
+    accumulator_type buffer4[etl::crc_runtime_table<accumulator_type, 4U>::Size];
+    accumulator_type buffer8[etl::crc_runtime_table<accumulator_type, 8U>::Size];
+
+    etl::crc_runtime_table<accumulator_type, 1U> table1(parameters, buffer1);
+    etl::crc_runtime_table<accumulator_type, 4U> table4(parameters, buffer4);
+    etl::crc_runtime_table<accumulator_type, 8U> table8(parameters, buffer8);
+
+    bool result = true;
+
+    // Every length, so that the tail after the slices is covered.
+    for (size_t length = 0U; length < 40U; ++length)
+    {
+      const accumulator_type expected = TCrc(data.begin(), data.begin() + length).value();
+
+      result = result && (expected == etl::crc_runtime<accumulator_type, 1U>(table1, data.data(), data.data() + length).value());
+      result = result && (expected == etl::crc_runtime<accumulator_type, 4U>(table4, data.data(), data.data() + length).value());
+      result = result && (expected == etl::crc_runtime<accumulator_type, 8U>(table8, data.data(), data.data() + length).value());
+    }
+
+    const accumulator_type expected = TCrc(data.begin(), data.end()).value();
+
+    result = result && (expected == etl::crc_runtime<accumulator_type, 8U>(table8, data.begin(), data.end()).value());
+
+    return result;
+  }
+
+  SUITE(test_crc_runtime)
+  {
+    //*************************************************************************
+    TEST(test_matches_compile_time_crcs)
+    {
+      CHECK((matches<etl::crc8_ccitt,   etl::private_crc::crc8_ccitt_parameters>()));
+      CHECK((matches<etl::crc8_rohc,    etl::private_crc::crc8_rohc_parameters>()));
+      CHECK((matches<etl::crc16_x25,    etl::private_crc::crc16_x25_parameters>()));
+      CHECK((matches<etl::crc16_xmodem, etl::private_crc::crc16_xmodem_parameters>()));
+      CHECK((matches<etl::crc16_riello, etl::private_crc::crc16_riello_parameters>()));
+      CHECK((matches<etl::crc32,        etl::private_crc::crc32_parameters>()));
+      CHECK((matches<etl::crc32_bzip2,  etl::private_crc::crc32_bzip2_parameters>()));
+      CHECK((matches<etl::crc64_ecma,   etl::private_crc::crc64_ecma_parameters>()));
+    }
+
+    //*************************************************************************
+    TEST(test_narrow_widths)
+    {
+      // CRC-5/USB
+      uint8_t buffer5[256];
+      const etl::crc_runtime_table<uint8_t> crc5_usb(etl::crc_runtime_parameters<uint8_t>(5U, 0x05U, 0x1FU, 0x1FU, true), buffer5);
+      CHECK_EQUAL(0x19U, etl::crc_runtime<uint8_t>(crc5_usb, check, check + 9).value());
+
+      // CRC-24/OPENPGP
+      uint32_t buffer24[4U * 256U];
+      const etl::crc_runtime_table<uint32_t, 4U> crc24(etl::crc_runtime_parameters<uint32_t>(24U, 0x864CFBUL, 0xB704CEUL, 0x000000UL, false), buffer24);
+      typedef etl::crc_runtime<uint32_t, 4U> crc24_t;
+      CHECK_EQUAL(0x21CF02UL, crc24_t(crc24, check, check + 9).value());
+
+      // CRC-12/DECT in a 16 bit accumulator.
+      uint16_t buffer12[256];
+      const etl::crc_runtime_table<uint16_t> crc12(etl::crc_runtime_parameters<uint16_t>(12U, 0x80FU, 0x000U, 0x000U, false), buffer12);
+      CHECK_EQUAL(0xF5BU, etl::crc_runtime<uint16_t>(crc12, check, check + 9).value());
+
+      // CRC-10/GSM
+      const etl::crc_runtime_table<uint16_t> crc10(etl::crc_runtime_parameters<uint16_t>(10U, 0x175U, 0x000U, 0x3FFU, false), buffer12);
+      CHECK_EQUAL(0x12AU, etl::crc_runtime<uint16_t>(crc10, check, check + 9).value());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_table_and_incremental_add)
+    {
+      uint32_t buffer[256];
+      const etl::crc_runtime_parameters<uint32_t> parameters = etl::crc_runtime_parameters<uint32_t>::from<etl::private_crc::crc32_c_parameters>();
+      const etl::crc_runtime_table<uint32_t> table(parameters, buffer);
+
+      etl::crc_runtime<uint32_t> crc1(table);
+      etl::crc_runtime<uint32_t> crc2(table);
+
+      for (size_t i = 0U; i < 9U; ++i)
+      {
+        crc1.add(uint8_t(check[i]));
+      }
+
+      crc2.add(check, check + 4);
+      crc2.add(check + 4, check + 9);
+
+      // CRC-32C check value.
+      CHECK_EQUAL(0xE3069283UL, crc1.value());
+      CHECK_EQUAL(0xE3069283UL, uint32_t(crc2));
+
+      crc1.reset();
+      crc1.add(check, check + 9);
+      CHECK_EQUAL(0xE3069283UL, crc1.value());
+    }
+  }
+}
@@ -0,0 +1,226 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/debounce_bank.h"
+#include "etl/debounce.h"
+
+#include <vector>
+
+namespace
+{
+  //***********************************
+  // Runs a bank and one etl::debounce per input on the same samples.
+  // Each input flips with its own probability, so that some inputs bounce
+  // and some are held for long enough to hold and repeat.
+  template <typename TBank, typename TSingle>
+  bool compare_with_single(uint32_t seed, int ticks)
+  {
+    typedef typename TBank::word_type word_type;
+
+    TBank                bank;
+    std::vector<TSingle> singles(bank.size());
+    std::vector<bool>    inputs(bank.size(), false);
+
+    for (int tick = 0; tick < ticks; ++tick)
+    {
+      word_type samples[TBank::Number_Of_Words] = { 0 };
+
+      for (size_t i = 0U; i < bank.size(); ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+
+        const uint32_t chance = 1U + (i % 5U) * (i % 7U) * 6U;
+
+        if (((seed >> 8) % 256U) < chance)
+        {
+          inputs[i] = !inputs[i];
+        }
+
+        if (inputs[i])
+        {
+          samples[i / TBank::Bits_Per_Word] |= word_type(word_type(1) << (i % TBank::Bits_Per_Word));
+        }
+      }
+
+      bool any_changed = false;
+
+      for (size_t i = 0U; i < bank.size(); ++i)
+      {
+        any_changed |= singles[i].add(inputs[i]);
+      }
+
+      if (bank.add(samples) != any_changed)
+      {
+        return false;
+      }
+
+      for (size_t i = 0U; i < bank.size(); ++i)
+      {
+        if ((bank.has_changed(i)  != singles[i].has_changed()) ||
+            (bank.is_set(i)       != singles[i].is_set())      ||
+            (bank.is_held(i)      != singles[i].is_held())     ||
+            (bank.is_repeating(i) != singles[i].is_repeating()))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_debounce_bank)
+  {
+    //*************************************************************************
+    TEST(test_sizes)
+    {
+      typedef etl::debounce_bank<96, 20, 500, 100> Bank;
+
+      CHECK_EQUAL(3U, Bank::Number_Of_Words);
+      CHECK_EQUAL(9U, Bank::Count_Bits);
+      CHECK_EQUAL(96U, Bank().size());
+
+      CHECK_EQUAL(2U, (etl::debounce_bank<96, 3, 0, 0, uint64_t>::Number_Of_Words));
+      CHECK_EQUAL(2U, (etl::debounce_bank<96, 3, 0, 0, uint64_t>::Count_Bits));
+    }
+
+    //*************************************************************************
+    TEST(test_valid_hold_repeat)
+    {
+      etl::debounce_bank<40, 2, 3, 2> bank;
+
+      const uint32_t pressed[2] = { 0x00000001U, 0x00000080U };
+      const uint32_t released[2] = { 0U, 0U };
+
+      // Input 0 and input 39 are pressed.
+      CHECK(!bank.add(pressed));
+      CHECK(bank.add(pressed));
+      CHECK(bank.is_set(0));
+      CHECK(bank.is_set(39));
+      CHECK(!bank.is_set(1));
+      CHECK_EQUAL(0x00000001U, bank.changed_mask(0));
+      CHECK_EQUAL(0x00000080U, bank.changed_mask(1));
+
+      CHECK(!bank.add(pressed));
+      CHECK(!bank.add(pressed));
+      CHECK(bank.add(pressed));
+      CHECK(bank.is_held(0));
+      CHECK(!bank.is_repeating(0));
+
+      CHECK(!bank.add(pressed));
+      CHECK(bank.add(pressed));
+      CHECK(bank.is_repeating(39));
+      CHECK_EQUAL(0x00000080U, bank.repeating_mask(1));
+
+      // Each repeat is a change.
+      CHECK(!bank.add(pressed));
+      CHECK(bank.add(pressed));
+      CHECK(bank.has_changed(39));
+
+      // Released.
+      CHECK(!bank.add(released));
+      CHECK(bank.add(released));
+      CHECK(!bank.is_set(0));
+      CHECK(!bank.is_set(39));
+      CHECK_EQUAL(0U, bank.set_mask(0));
+    }
+
+    //*************************************************************************
+    TEST(test_unused_inputs_are_ignored)
+    {
+      etl::debounce_bank<4, 1, 0, 0, uint8_t> bank;
+
+      const uint8_t samples[1] = { 0xFFU };
+
+      CHECK(bank.add(samples));
+      CHECK_EQUAL(0x0FU, bank.set_mask(0));
+    }
+
+    //*************************************************************************
+    TEST(test_initial_state)
+    {
+      etl::debounce_bank<8, 2> bank(true);
+
+      CHECK(bank.is_set(7));
+
+      const uint32_t released[1] = { 0U };
+
+      CHECK(!bank.add(released));
+      CHECK(bank.add(released));
+      CHECK(!bank.is_set(7));
+
+      bank.reset(true);
+      CHECK(bank.is_set(3));
+      CHECK(!bank.has_changed(3));
+    }
+
+    //*************************************************************************
+    TEST(test_word_at_a_time)
+    {
+      etl::debounce_bank<64, 2> bank;
+
+      CHECK_EQUAL(0U, bank.add(1U, 0x00010000U));
+      CHECK_EQUAL(0x00010000U, bank.add(1U, 0x00010000U));
+      CHECK(bank.is_set(48));
+      CHECK_EQUAL(0U, bank.set_mask(0));
+    }
+
+    //*************************************************************************
+    TEST(test_matches_debounce_valid)
+    {
+      CHECK((compare_with_single<etl::debounce_bank<70, 3>, etl::debounce<3> >(1U, 5000)));
+    }
+
+    //*************************************************************************
+    TEST(test_matches_debounce_valid_at_stopped_count)
+    {
+      // The count stops at 3, which is also the valid count.
+      CHECK((compare_with_single<etl::debounce_bank<70, 3>, etl::debounce<3> >(2U, 5000)));
+
+      // The count stops at 1.
+      CHECK((compare_with_single<etl::debounce_bank<33, 1>, etl::debounce<1> >(3U, 2000)));
+    }
+
+    //*************************************************************************
+    TEST(test_matches_debounce_valid_hold)
+    {
+      CHECK((compare_with_single<etl::debounce_bank<70, 2, 5>, etl::debounce<2, 5> >(4U, 5000)));
+    }
+
+    //*************************************************************************
+    TEST(test_matches_debounce_valid_hold_repeat)
+    {
+      CHECK((compare_with_single<etl::debounce_bank<70, 2, 5, 3>, etl::debounce<2, 5, 3> >(5U, 5000)));
+      CHECK((compare_with_single<etl::debounce_bank<100, 4, 10, 4, uint64_t>, etl::debounce<4, 10, 4> >(6U, 5000)));
+      CHECK((compare_with_single<etl::debounce_bank<20, 3, 7, 2, uint8_t>, etl::debounce<3, 7, 2> >(7U, 5000)));
+      CHECK((compare_with_single<etl::debounce_bank<50, 1, 2, 3, uint16_t>, etl::debounce<1, 2, 3> >(8U, 5000)));
+    }
+  }
+}
@@ -0,0 +1,229 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/deferred_reference_counted_message_pool.h"
+#include "etl/shared_message.h"
+#include "etl/message.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <thread>
+#include <vector>
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+
+  int destructed = 0;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    ~Message1()
+    {
+      ++destructed;
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+    ~Message2()
+    {
+      ++destructed;
+    }
+
+    double d[4];
+  };
+
+  using Pool           = etl::atomic_counted_deferred_message_pool;
+  using PoolParameters = Pool::pool_message_parameters<Message1, Message2>;
+  using Allocator      = etl::fixed_sized_memory_block_allocator<PoolParameters::max_size, PoolParameters::max_alignment, 4U>;
+
+  SUITE(test_deferred_reference_counted_message_pool)
+  {
+    //*************************************************************************
+    TEST(test_pool_parameters)
+    {
+      using BaseParameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2>;
+
+      CHECK(PoolParameters::max_size >= (BaseParameters::max_size + Pool::Header_Size));
+      CHECK_EQUAL(0U, PoolParameters::max_size % PoolParameters::max_alignment);
+      CHECK_EQUAL(0U, Pool::Header_Size % Pool::Alignment);
+    }
+
+    //*************************************************************************
+    TEST(test_release_is_deferred_until_reclaim)
+    {
+      Allocator allocator;
+      Pool pool(allocator);
+
+      destructed = 0;
+
+      {
+        etl::shared_message sm1(pool, Message1(1));
+        etl::shared_message sm2(pool, Message2());
+        etl::shared_message sm3(sm1);
+
+        CHECK_EQUAL(1, static_cast<const Message1&>(sm3.get_message()).i);
+      }
+
+      // Only the temporary messages have been destructed.
+      destructed = 0;
+      CHECK_EQUAL(2U, pool.deferred_size());
+      CHECK(pool.has_deferred());
+
+      CHECK_EQUAL(2U, pool.reclaim());
+      CHECK_EQUAL(2, destructed);
+      CHECK_EQUAL(0U, pool.deferred_size());
+      CHECK(!pool.has_deferred());
+
+      CHECK_EQUAL(0U, pool.reclaim());
+    }
+
+    //*************************************************************************
+    TEST(test_blocks_are_not_reused_until_reclaim)
+    {
+      Allocator allocator;
+      Pool pool(allocator);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        etl::shared_message sm(pool, Message1(i));
+      }
+
+      CHECK_EQUAL(4U, pool.deferred_size());
+      CHECK_THROW(pool.allocate<Message2>(), etl::reference_counted_message_pool_allocation_failure);
+
+      pool.reclaim();
+
+      std::vector<etl::shared_message> messages;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        messages.push_back(etl::shared_message(pool, Message1(i)));
+      }
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(i, static_cast<const Message1&>(messages[i].get_message()).i);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_release_batch)
+    {
+      Allocator allocator;
+      Pool pool(allocator);
+
+      etl::shared_message sm1(pool, Message1(1));
+      etl::shared_message sm2(pool, Message2());
+      etl::shared_message sm3(pool, Message1(3));
+
+      {
+        etl::shared_message_release_batch<2U> batch(pool);
+
+        batch.release(sm1);
+        batch.release(sm2);
+        batch.release(sm3);
+      }
+
+      destructed = 0;
+      CHECK_EQUAL(3U, pool.deferred_size());
+      CHECK_EQUAL(3U, pool.reclaim());
+      CHECK_EQUAL(3, destructed);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_reclaims)
+    {
+      Allocator allocator;
+
+      destructed = 0;
+
+      {
+        Pool pool(allocator);
+        etl::shared_message sm(pool, Message1(1));
+        destructed = 0;
+      }
+
+      CHECK_EQUAL(1, destructed);
+    }
+
+    //*************************************************************************
+    TEST(test_release_from_several_threads)
+    {
+      static const size_t Threads    = 4U;
+      static const size_t Per_Thread = 16U;
+
+      etl::fixed_sized_memory_block_allocator<PoolParameters::max_size, PoolParameters::max_alignment, Threads * Per_Thread> allocator;
+      Pool pool(allocator);
+
+      std::vector<std::vector<etl::shared_message>> messages(Threads);
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        for (size_t i = 0U; i < Per_Thread; ++i)
+        {
+          messages[t].push_back(etl::shared_message(pool, Message1(int(i))));
+        }
+      }
+
+      destructed = 0;
+
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&messages, t]()
+        {
+          messages[t].clear();
+        }));
+      }
+
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+
+      CHECK_EQUAL(0, destructed);
+      CHECK_EQUAL(Threads * Per_Thread, pool.deferred_size());
+      CHECK_EQUAL(Threads * Per_Thread, pool.reclaim());
+      CHECK_EQUAL(int(Threads * Per_Thread), destructed);
+    }
+  };
+}
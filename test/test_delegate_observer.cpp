@@ -0,0 +1,167 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/delegate_observer.h"
+
+namespace
+{
+  //*****************************************************************************
+  struct Receiver
+  {
+    Receiver()
+      : count(0)
+      , total(0)
+    {
+    }
+
+    void on_notification(int n)
+    {
+      ++count;
+      total += n;
+    }
+
+    int count;
+    int total;
+  };
+
+  typedef etl::delegate_observable<int, 3> Observable;
+
+  int free_count = 0;
+
+  void free_observer(int)
+  {
+    ++free_count;
+  }
+
+  SUITE(test_delegate_observer)
+  {
+    //*************************************************************************
+    TEST(test_add_remove_observers)
+    {
+      Receiver receiver1;
+      Receiver receiver2;
+
+      Observable observable;
+
+      Observable::observer_type observer1 = Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1);
+      Observable::observer_type observer2 = Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver2);
+      Observable::observer_type observer3 = Observable::observer_type::create<free_observer>();
+      Observable::observer_type observer4 = Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1);
+
+      observable.add_observer(observer1);
+      CHECK_EQUAL(1U, observable.number_of_observers());
+
+      observable.add_observer(observer2);
+      CHECK_EQUAL(2U, observable.number_of_observers());
+
+      // Already added.
+      observable.add_observer(observer4);
+      CHECK_EQUAL(2U, observable.number_of_observers());
+
+      observable.add_observer(observer3);
+      CHECK_EQUAL(3U, observable.number_of_observers());
+
+      Receiver receiver3;
+      CHECK_THROW(observable.add_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver3)), etl::delegate_observer_list_full);
+
+      CHECK(observable.remove_observer(observer2));
+      CHECK_EQUAL(2U, observable.number_of_observers());
+
+      CHECK(!observable.remove_observer(observer2));
+      CHECK_EQUAL(2U, observable.number_of_observers());
+
+      observable.clear_observers();
+      CHECK_EQUAL(0U, observable.number_of_observers());
+    }
+
+    //*************************************************************************
+    TEST(test_notify_observers)
+    {
+      Receiver receiver1;
+      Receiver receiver2;
+      free_count = 0;
+
+      Observable observable;
+
+      observable.add_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1));
+      observable.add_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver2));
+      observable.add_observer(Observable::observer_type::create<free_observer>());
+
+      observable.notify_observers(1);
+      observable.notify_observers(2);
+
+      CHECK_EQUAL(2, receiver1.count);
+      CHECK_EQUAL(3, receiver1.total);
+      CHECK_EQUAL(2, receiver2.count);
+      CHECK_EQUAL(3, receiver2.total);
+      CHECK_EQUAL(2, free_count);
+
+      observable.disable_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1));
+      observable.notify_observers(3);
+
+      CHECK_EQUAL(2, receiver1.count);
+      CHECK_EQUAL(3, receiver1.total);
+      CHECK_EQUAL(3, receiver2.count);
+      CHECK_EQUAL(6, receiver2.total);
+      CHECK_EQUAL(3, free_count);
+
+      observable.enable_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1));
+      observable.notify_observers(4);
+
+      CHECK_EQUAL(3, receiver1.count);
+      CHECK_EQUAL(7, receiver1.total);
+      CHECK_EQUAL(4, receiver2.count);
+      CHECK_EQUAL(10, receiver2.total);
+      CHECK_EQUAL(4, free_count);
+    }
+
+    //*************************************************************************
+    TEST(test_notify_observers_batch)
+    {
+      Receiver receiver1;
+      Receiver receiver2;
+
+      Observable observable;
+
+      observable.add_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver1));
+      observable.add_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver2));
+      observable.disable_observer(Observable::observer_type::create<Receiver, &Receiver::on_notification>(receiver2));
+
+      const int data[] = { 1, 2, 3, 4 };
+
+      observable.notify_observers(etl::span<const int>(data));
+
+      CHECK_EQUAL(4, receiver1.count);
+      CHECK_EQUAL(10, receiver1.total);
+      CHECK_EQUAL(0, receiver2.count);
+      CHECK_EQUAL(0, receiver2.total);
+    }
+  }
+}
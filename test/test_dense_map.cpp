@@ -0,0 +1,174 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/dense_map.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace
+{
+  typedef etl::dense_map<64, std::string> Map;
+
+  SUITE(test_dense_map)
+  {
+    //*************************************************************************
+    TEST(test_insert_find)
+    {
+      Map map;
+
+      CHECK(map.insert(Map::value_type(40, "forty")).second);
+      CHECK(map.insert(Map::value_type(2, "two")).second);
+      CHECK(!map.insert(Map::value_type(2, "deux")).second);
+      map[33] = "thirty three";
+
+      CHECK_EQUAL(3U, map.size());
+      CHECK_EQUAL(std::string("two"), map.at(2));
+      CHECK_EQUAL(std::string("forty"), map.find(40)->second);
+      CHECK(map.find(41) == map.end());
+      CHECK(map.find(100) == map.end());
+      CHECK(map.contains(33));
+      CHECK_EQUAL(0U, map.count(63));
+      CHECK_THROW(map.at(5), etl::dense_map_out_of_bounds);
+      CHECK_THROW(map.insert(Map::value_type(64, "")), etl::dense_map_out_of_range);
+
+      std::vector<int> keys;
+
+      for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      int expected[] = { 2, 33, 40 };
+      CHECK(keys == std::vector<int>(expected, expected + 3));
+
+      CHECK_EQUAL(40, map.rbegin()->first);
+      CHECK_EQUAL(2, (--map.rend())->first);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_or_assign_and_bounds)
+    {
+      Map map;
+
+      CHECK(map.insert_or_assign(10, "a").second);
+      CHECK(!map.insert_or_assign(10, "b").second);
+      CHECK_EQUAL(std::string("b"), map[10]);
+
+      map[20] = "c";
+
+      CHECK_EQUAL(10, map.lower_bound(0)->first);
+      CHECK_EQUAL(20, map.upper_bound(10)->first);
+      CHECK(map.upper_bound(20) == map.end());
+
+      ETL_OR_STD::pair<Map::iterator, Map::iterator> range = map.equal_range(10);
+      CHECK_EQUAL(10, range.first->first);
+      CHECK_EQUAL(20, range.second->first);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_copy_move)
+    {
+      Map map;
+
+      for (uint8_t i = 0; i < 64; i += 4)
+      {
+        map[i] = std::string(1, char('a' + (i / 4)));
+      }
+
+      CHECK_EQUAL(16U, map.size());
+      CHECK_EQUAL(1U, map.erase(8));
+      CHECK_EQUAL(0U, map.erase(8));
+
+      Map::iterator itr = map.erase(map.find(4));
+      CHECK_EQUAL(12, itr->first);
+
+      Map copy(map);
+      CHECK(copy == map);
+
+      copy.erase(copy.find(32), copy.end());
+      CHECK_EQUAL(6U, copy.size());
+      CHECK(copy != map);
+
+      copy = map;
+      CHECK(copy == map);
+
+#if ETL_USING_CPP11
+      Map moved(etl::move(copy));
+      CHECK(moved == map);
+      CHECK(copy.empty());
+
+      copy = etl::move(moved);
+      CHECK(copy == map);
+      CHECK(moved.empty());
+#endif
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(map.begin() == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std_map)
+    {
+      etl::dense_map<1000, int> map;
+      std::map<uint16_t, int>   compare;
+
+      uint32_t seed = 12345U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint16_t key = uint16_t((seed >> 8) % 1000U);
+
+        if (((seed >> 4) & 3U) != 0U)
+        {
+          compare[key] = i;
+          map[key]     = i;
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), map.erase(key));
+        }
+      }
+
+      CHECK_EQUAL(compare.size(), map.size());
+
+      std::map<uint16_t, int>::const_iterator expected = compare.begin();
+
+      for (etl::dense_map<1000, int>::const_iterator itr = map.begin(); itr != map.end(); ++itr, ++expected)
+      {
+        CHECK_EQUAL(expected->first, itr->first);
+        CHECK_EQUAL(expected->second, itr->second);
+      }
+    }
+  }
+}
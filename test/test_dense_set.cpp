@@ -0,0 +1,190 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/dense_set.h"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+  typedef etl::dense_set<100> Set;
+
+  SUITE(test_dense_set)
+  {
+    //*************************************************************************
+    TEST(test_key_type)
+    {
+      CHECK((etl::is_same<uint8_t,  etl::dense_set<256>::key_type>::value));
+      CHECK((etl::is_same<uint16_t, etl::dense_set<4096>::key_type>::value));
+
+      // One bit per key.
+      CHECK(sizeof(etl::dense_set<4096>) <= (4096U / 8U) + 16U);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_find_erase)
+    {
+      Set set;
+
+      uint8_t values[] = { 50, 3, 99, 0, 3, 64 };
+      set.insert(values, values + 6);
+
+      CHECK_EQUAL(5U, set.size());
+      CHECK(set.contains(99));
+      CHECK(!set.contains(2));
+      CHECK(!set.contains(200));
+      CHECK_EQUAL(1U, set.count(50));
+      CHECK(set.find(2) == set.end());
+      CHECK(set.find(200) == set.end());
+      CHECK_EQUAL(50, *set.find(50));
+
+      std::vector<int> result(set.begin(), set.end());
+      int expected[] = { 0, 3, 50, 64, 99 };
+      CHECK(result == std::vector<int>(expected, expected + 5));
+
+      std::vector<int> reversed(set.rbegin(), set.rend());
+      int expected_reversed[] = { 99, 64, 50, 3, 0 };
+      CHECK(reversed == std::vector<int>(expected_reversed, expected_reversed + 5));
+
+      CHECK_EQUAL(1U, set.erase(3));
+      CHECK_EQUAL(0U, set.erase(3));
+      Set::iterator itr = set.erase(set.begin());
+      CHECK_EQUAL(50, *itr);
+      CHECK_EQUAL(3U, set.size());
+    }
+
+    //*************************************************************************
+    TEST(test_bounds)
+    {
+      Set set;
+
+      set.insert(10U);
+      set.insert(40U);
+      set.insert(90U);
+
+      CHECK_EQUAL(10, *set.lower_bound(0));
+      CHECK_EQUAL(40, *set.lower_bound(40));
+      CHECK_EQUAL(90, *set.upper_bound(40));
+      CHECK(set.upper_bound(90) == set.end());
+      CHECK(set.lower_bound(91) == set.end());
+      CHECK(set.lower_bound(250) == set.end());
+
+      ETL_OR_STD::pair<Set::const_iterator, Set::const_iterator> range = set.equal_range(40);
+      CHECK_EQUAL(40, *range.first);
+      CHECK_EQUAL(90, *range.second);
+
+      Set::const_iterator itr = set.end();
+      --itr;
+      CHECK_EQUAL(90, *itr);
+      --itr;
+      CHECK_EQUAL(40, *itr);
+      --itr;
+      CHECK_EQUAL(10, *itr);
+      CHECK(itr == set.begin());
+    }
+
+    //*************************************************************************
+    TEST(test_signed_keys)
+    {
+      etl::dense_set<10, int> set;
+
+      CHECK(set.insert(5).second);
+      CHECK(!set.contains(-1));
+      CHECK_EQUAL(0U, set.erase(-1));
+      CHECK_EQUAL(5, *set.lower_bound(-3));
+      CHECK_EQUAL(5, *set.upper_bound(-3));
+      CHECK_THROW(set.insert(-1), etl::dense_set_out_of_range);
+      CHECK_THROW(set.insert(10), etl::dense_set_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_copy)
+    {
+      etl::dense_set<8> set;
+
+      for (uint8_t i = 0; i < 8; ++i)
+      {
+        CHECK(set.insert(i).second);
+      }
+
+      CHECK(set.full());
+      CHECK(!set.insert(3).second);
+      CHECK_THROW(set.insert(8), etl::dense_set_out_of_range);
+
+      etl::dense_set<8> copy(set);
+      CHECK(copy == set);
+
+      copy.erase(copy.find(4), copy.end());
+      CHECK_EQUAL(4U, copy.size());
+      CHECK(copy != set);
+
+      copy = set;
+      CHECK(copy == set);
+
+      set.clear();
+      CHECK(set.empty());
+      CHECK(set.begin() == set.end());
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations_against_std_set)
+    {
+      etl::dense_set<4096> set;
+      std::set<uint16_t>   compare;
+
+      uint32_t seed = 987U;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const uint16_t key = uint16_t((seed >> 8) % 4096U);
+
+        if (((seed >> 4) & 3U) != 0U)
+        {
+          CHECK_EQUAL(compare.insert(key).second, set.insert(key).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), set.erase(key));
+        }
+
+        std::set<uint16_t>::const_iterator expected = compare.upper_bound(key);
+        etl::dense_set<4096>::const_iterator found  = set.upper_bound(key);
+
+        CHECK((expected == compare.end()) == (found == set.end()));
+      }
+
+      CHECK_EQUAL(compare.size(), set.size());
+      CHECK(std::equal(compare.begin(), compare.end(), set.begin()));
+      CHECK(std::equal(compare.rbegin(), compare.rend(), set.rbegin()));
+    }
+  }
+}
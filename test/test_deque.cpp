@@ -2201,6 +2201,78 @@ namespace
 
       CHECK(std::equal(blank_data.begin(), blank_data.end(), data.begin()));
     }
+
+    //*************************************************************************
+    struct SegmentCounter
+    {
+      SegmentCounter()
+        : segments(0)
+        , elements(0)
+      {
+      }
+
+      void operator()(const etl::span<const int>& segment)
+      {
+        ++segments;
+        elements += segment.size();
+      }
+
+      size_t segments;
+      size_t elements;
+    };
+
+    //*************************************************************************
+    TEST(test_for_each_segment)
+    {
+      etl::deque<int, 8> data;
+
+      SegmentCounter counter = etl::as_const(data).for_each_segment(SegmentCounter());
+      CHECK_EQUAL(0U, counter.segments);
+
+      data.push_back(1);
+      data.push_back(2);
+      data.push_back(3);
+
+      counter = etl::as_const(data).for_each_segment(SegmentCounter());
+      CHECK_EQUAL(1U, counter.segments);
+      CHECK_EQUAL(3U, counter.elements);
+
+      // Wrap around the end of the buffer.
+      data.push_front(0);
+
+      counter = etl::as_const(data).for_each_segment(SegmentCounter());
+      CHECK_EQUAL(2U, counter.segments);
+      CHECK_EQUAL(4U, counter.elements);
+    }
+
+    //*************************************************************************
+    TEST(test_segmented_copy_fill_accumulate)
+    {
+      etl::deque<int, 8> data;
+
+      for (int i = 1; i <= 5; ++i)
+      {
+        data.push_back(i);
+      }
+
+      for (int i = -1; i >= -3; --i)
+      {
+        data.push_front(i);
+      }
+
+      std::vector<int> expected(data.begin(), data.end());
+      std::vector<int> output(data.size());
+
+      std::vector<int>::iterator itr = etl::copy(data, output.begin());
+      CHECK(itr == output.end());
+      CHECK(expected == output);
+
+      CHECK_EQUAL(std::accumulate(expected.begin(), expected.end(), 0), etl::accumulate(data, 0));
+
+      etl::fill(data, 7);
+      CHECK_EQUAL(8U, data.size());
+      CHECK_EQUAL(56, etl::accumulate(data, 0));
+    }
   };
 }
 
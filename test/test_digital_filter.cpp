@@ -0,0 +1,377 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/digital_filter.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  //***************************************************************************
+  // Direct FIR, for comparison.
+  template <typename TAccumulator, typename T>
+  std::vector<TAccumulator> reference_fir(const std::vector<T>& coefficients, const std::vector<T>& input)
+  {
+    std::vector<TAccumulator> output;
+
+    for (size_t n = 0U; n < input.size(); ++n)
+    {
+      TAccumulator sum = TAccumulator(0);
+
+      for (size_t k = 0U; (k < coefficients.size()) && (k <= n); ++k)
+      {
+        sum += TAccumulator(coefficients[k]) * TAccumulator(input[n - k]);
+      }
+
+      output.push_back(sum);
+    }
+
+    return output;
+  }
+
+  //***************************************************************************
+  std::vector<int16_t> make_q15_input(size_t n)
+  {
+    std::vector<int16_t> input;
+
+    uint32_t state = 12345U;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      state = (state * 1103515245U) + 12345U;
+      input.push_back(int16_t(int32_t((state >> 16) & 0xFFFFU) - 32768));
+    }
+
+    return input;
+  }
+
+  SUITE(test_digital_filter)
+  {
+    //*************************************************************************
+    TEST(test_fir_float_impulse_response)
+    {
+      const float coefficients[5] = { 0.1f, 0.2f, 0.4f, 0.2f, 0.1f };
+
+      etl::fir_filter<float, 5> filter(coefficients);
+
+      CHECK_EQUAL(5U, filter.Tap_Count);
+
+      CHECK_CLOSE(0.1f, filter.process(1.0f), 1e-6f);
+
+      for (size_t i = 1U; i < 5U; ++i)
+      {
+        CHECK_CLOSE(coefficients[i], filter.process(0.0f), 1e-6f);
+      }
+
+      CHECK_CLOSE(0.0f, filter.process(0.0f), 1e-6f);
+
+      filter.process(5.0f);
+      filter.reset();
+      CHECK_CLOSE(0.0f, filter(0.0f), 1e-6f);
+    }
+
+    //*************************************************************************
+    TEST(test_fir_float_block_matches_reference)
+    {
+      std::vector<float> coefficients;
+      std::vector<float> input;
+
+      for (size_t i = 0U; i < 37U; ++i)
+      {
+        coefficients.push_back(float(i % 7U) / 20.0f - 0.1f);
+      }
+
+      for (size_t i = 0U; i < 200U; ++i)
+      {
+        input.push_back(float((i * 37U) % 101U) / 50.0f - 1.0f);
+      }
+
+      etl::fir_filter<float, 37> filter(etl::span<const float, 37>(coefficients.data(), 37U));
+
+      std::vector<float> output(input.size());
+      CHECK_EQUAL(input.size(), filter.process(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+
+      std::vector<double> expected = reference_fir<double>(coefficients, input);
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        CHECK_CLOSE(expected[i], output[i], 1e-4);
+      }
+
+      // In place, sample at a time.
+      etl::fir_filter<float, 37> filter2(etl::span<const float, 37>(coefficients.data(), 37U));
+
+      std::vector<float> in_place(input);
+      filter2.process(etl::span<const float>(in_place.data(), 100U), etl::span<float>(in_place.data(), 100U));
+
+      for (size_t i = 100U; i < input.size(); ++i)
+      {
+        in_place[i] = filter2.process(input[i]);
+      }
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        CHECK_EQUAL(output[i], in_place[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fir_double)
+    {
+      const double coefficients[3] = { 0.5, 0.25, 0.25 };
+
+      etl::fir_filter<double, 3> filter(coefficients);
+
+      CHECK_CLOSE(2.0, filter.process(4.0), 1e-12);
+      CHECK_CLOSE(3.0, filter.process(4.0), 1e-12);
+      CHECK_CLOSE(4.0, filter.process(4.0), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_fir_q15_matches_reference)
+    {
+      std::vector<int16_t> coefficients;
+
+      for (size_t i = 0U; i < 29U; ++i)
+      {
+        coefficients.push_back(int16_t((int32_t(i) * 977) % 4000 - 2000));
+      }
+
+      std::vector<int16_t> input = make_q15_input(300U);
+
+      etl::fir_filter<int16_t, 29> filter(etl::span<const int16_t, 29>(coefficients.data(), 29U));
+
+      std::vector<int16_t> output(input.size());
+      filter.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(output.data(), output.size()));
+
+      std::vector<int64_t> expected = reference_fir<int64_t>(coefficients, input);
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        int64_t value = (expected[i] + 16384) >> 15;
+        value = (value > 32767) ? 32767 : ((value < -32768) ? -32768 : value);
+
+        CHECK_EQUAL(value, int64_t(output[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fir_q15_gain_and_saturation)
+    {
+      const int16_t average[4] = { 8192, 8192, 8192, 8192 }; // 0.25
+
+      etl::fir_filter<int16_t, 4> filter(average);
+
+      filter.process(10000);
+      filter.process(10000);
+      filter.process(10000);
+      CHECK_EQUAL(10000, filter.process(10000));
+
+      const int16_t gain[2] = { 32767, 32767 };
+
+      etl::fir_filter<int16_t, 2> saturating(gain);
+
+      saturating.process(32767);
+      CHECK_EQUAL(32767,  saturating.process(32767));
+      saturating.process(-32768);
+      CHECK_EQUAL(-32768, saturating.process(-32768));
+    }
+
+    //*************************************************************************
+    TEST(test_fir_q31_and_q7)
+    {
+      const int32_t coefficients32[2] = { 1073741824, 1073741824 }; // 0.5
+
+      etl::fir_filter<int32_t, 2> filter32(coefficients32);
+
+      filter32.process(1000000);
+      CHECK_EQUAL(1000000, filter32.process(1000000));
+
+      const int8_t coefficients8[2] = { 64, 64 }; // 0.5
+
+      etl::fir_filter<int8_t, 2> filter8(coefficients8);
+
+      filter8.process(100);
+      CHECK_EQUAL(100, filter8.process(100));
+      CHECK_EQUAL(25,  filter8.process(-50));
+    }
+
+    //*************************************************************************
+    TEST(test_fir_decimator)
+    {
+      std::vector<int16_t> coefficients;
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        coefficients.push_back(int16_t(2048));
+      }
+
+      std::vector<int16_t> input = make_q15_input(100U);
+
+      etl::fir_filter<int16_t, 16>       filter(etl::span<const int16_t, 16>(coefficients.data(), 16U));
+      etl::fir_decimator<int16_t, 16, 3> decimator(etl::span<const int16_t, 16>(coefficients.data(), 16U));
+
+      CHECK_EQUAL(3U, decimator.Decimation_Factor);
+
+      std::vector<int16_t> expected;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        const int16_t y = filter.process(input[i]);
+
+        if ((i % 3U) == 2U)
+        {
+          expected.push_back(y);
+        }
+      }
+
+      // Sample at a time.
+      std::vector<int16_t> output;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        int16_t y = 0;
+
+        if (decimator.process(input[i], y))
+        {
+          output.push_back(y);
+        }
+      }
+
+      CHECK(expected == output);
+
+      // Blocks, with a short output that stops the first block after 30 inputs.
+      decimator.reset();
+
+      std::vector<int16_t> block(10U);
+
+      size_t n = decimator.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(block.data(), block.size()));
+      CHECK_EQUAL(10U, n);
+
+      std::vector<int16_t> rest(40U);
+      n = decimator.process(etl::span<const int16_t>(input.data() + 30U, input.size() - 30U), etl::span<int16_t>(rest.data(), rest.size()));
+      CHECK_EQUAL(expected.size() - 10U, n);
+
+      block.insert(block.end(), rest.begin(), rest.begin() + n);
+      CHECK(expected == block);
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_float_matches_reference)
+    {
+      // Two second order low pass sections.
+      const float coefficients[10] = { 0.0675f, 0.1349f, 0.0675f, -1.1430f, 0.4128f,
+                                       0.2066f, 0.4131f, 0.2066f, -0.3695f, 0.1958f };
+
+      etl::biquad_cascade<float, 2> filter(coefficients);
+
+      CHECK_EQUAL(2U, filter.Stage_Count);
+      CHECK_EQUAL(10U, filter.Coefficient_Count);
+
+      std::vector<float> input;
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        input.push_back(((i / 10U) % 2U) == 0U ? 1.0f : -1.0f);
+      }
+
+      // Direct form I, by hand.
+      std::vector<double> expected(input.begin(), input.end());
+
+      for (size_t stage = 0U; stage < 2U; ++stage)
+      {
+        const float* c = coefficients + (5U * stage);
+        double x1 = 0.0, x2 = 0.0, y1 = 0.0, y2 = 0.0;
+
+        for (size_t i = 0U; i < expected.size(); ++i)
+        {
+          const double x = expected[i];
+          const double y = (c[0] * x) + (c[1] * x1) + (c[2] * x2) - (c[3] * y1) - (c[4] * y2);
+          x2 = x1; x1 = x; y2 = y1; y1 = y;
+          expected[i] = y;
+        }
+      }
+
+      std::vector<float> output(input.size());
+      filter.process(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size()));
+
+      for (size_t i = 0U; i < output.size(); ++i)
+      {
+        CHECK_CLOSE(expected[i], output[i], 1e-4);
+      }
+
+      // Sample at a time gives the same result.
+      filter.reset();
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        CHECK_CLOSE(output[i], filter(input[i]), 1e-6f);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_biquad_q14_step_response)
+    {
+      // b = { 0.25, 0.5, 0.25 }, a = { 1, -0.5, 0.5 }. DC gain of 1.
+      const int16_t coefficients[5] = { 4096, 8192, 4096, -8192, 8192 };
+
+      etl::biquad_cascade<int16_t, 1> filter(coefficients);
+
+      int16_t y = 0;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        y = filter.process(10000);
+      }
+
+      CHECK_CLOSE(10000, y, 2);
+
+      // Block in place equals sample at a time.
+      std::vector<int16_t> input = make_q15_input(64U);
+      std::vector<int16_t> expected;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        expected.push_back(filter.process(input[i]));
+      }
+
+      etl::biquad_cascade<int16_t, 1> filter2(coefficients);
+      for (int i = 0; i < 100; ++i)
+      {
+        filter2.process(10000);
+      }
+
+      filter2.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(input.data(), input.size()));
+
+      CHECK(expected == input);
+    }
+  };
+}
@@ -0,0 +1,249 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/epoch_reclaimer.h"
+#include "etl/pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  int destroyed = 0;
+
+  //*************************************************************************
+  struct Node
+  {
+    Node(int value_)
+      : value(value_)
+    {
+    }
+
+    ~Node()
+    {
+      value = -1;
+      ++destroyed;
+    }
+
+    int value;
+  };
+
+  typedef etl::epoch_reclaimer<2U, 4U> Reclaimer;
+
+  SUITE(test_epoch_reclaimer)
+  {
+    //*************************************************************************
+    TEST(test_acquire_release_slots)
+    {
+      etl::pool<Node, 4U> pool;
+      Reclaimer reclaimer(pool);
+
+      Reclaimer::slot_type slot1 = reclaimer.acquire_slot();
+      Reclaimer::slot_type slot2 = reclaimer.acquire_slot();
+
+      CHECK(slot1 != Reclaimer::No_Slot);
+      CHECK(slot2 != Reclaimer::No_Slot);
+      CHECK(slot1 != slot2);
+      CHECK_EQUAL(Reclaimer::No_Slot, reclaimer.acquire_slot());
+
+      reclaimer.release_slot(slot2);
+      CHECK_EQUAL(slot2, reclaimer.acquire_slot());
+    }
+
+    //*************************************************************************
+    TEST(test_reader_holds_back_reclamation)
+    {
+      etl::pool<Node, 4U> pool;
+      Reclaimer reclaimer(pool);
+
+      destroyed = 0;
+
+      Reclaimer::slot_type reader = reclaimer.acquire_slot();
+      Reclaimer::slot_type writer = reclaimer.acquire_slot();
+
+      reclaimer.enter(reader);
+
+      CHECK(reclaimer.retire(writer, pool.create(1)));
+
+      // The reader has seen the current epoch, so it may move on once...
+      CHECK(reclaimer.try_advance());
+
+      // ...but not again until the reader has left.
+      CHECK(!reclaimer.try_advance());
+      CHECK_EQUAL(0U, reclaimer.reclaim(writer));
+      CHECK_EQUAL(0, destroyed);
+
+      reclaimer.exit(reader);
+
+      CHECK_EQUAL(1U, reclaimer.reclaim(writer));
+      CHECK_EQUAL(1, destroyed);
+      CHECK_EQUAL(0U, reclaimer.retired_size(writer));
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_retire_fails_when_full_and_blocked)
+    {
+      etl::pool<Node, 8U> pool;
+      Reclaimer reclaimer(pool);
+
+      destroyed = 0;
+
+      Reclaimer::slot_type reader = reclaimer.acquire_slot();
+      Reclaimer::slot_type writer = reclaimer.acquire_slot();
+
+      reclaimer.enter(reader);
+      reclaimer.try_advance();
+
+      for (size_t i = 0U; i < Reclaimer::Retired; ++i)
+      {
+        CHECK(reclaimer.retire(writer, pool.create(int(i))));
+      }
+
+      Node* p_node = pool.create(99);
+      CHECK(!reclaimer.retire(writer, p_node));
+
+      reclaimer.exit(reader);
+
+      // The epoch can now move on to a fresh bucket.
+      CHECK(reclaimer.retire(writer, p_node));
+      CHECK_EQUAL(0, destroyed);
+
+      reclaimer.reclaim(writer);
+      reclaimer.reclaim(writer);
+
+      CHECK_EQUAL(int(Reclaimer::Retired + 1U), destroyed);
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_reclaims)
+    {
+      etl::pool<Node, 4U> pool;
+
+      destroyed = 0;
+
+      {
+        Reclaimer reclaimer(pool);
+        Reclaimer::slot_type slot = reclaimer.acquire_slot();
+
+        reclaimer.retire(slot, pool.create(1));
+        CHECK_EQUAL(0, destroyed);
+      }
+
+      CHECK_EQUAL(1, destroyed);
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_readers_never_see_a_destroyed_node)
+    {
+      static const int Length = 2000;
+
+      typedef etl::epoch_reclaimer<4U, 8U> ThreadReclaimer;
+
+      etl::pool<Node, 64U> pool;
+      ThreadReclaimer reclaimer(pool);
+
+      etl::atomic<Node*> head(pool.create(0));
+      std::atomic<bool>  done(false);
+      std::atomic<bool>  failed(false);
+
+      std::vector<std::thread> readers;
+
+      for (int r = 0; r < 3; ++r)
+      {
+        readers.push_back(std::thread([&]()
+        {
+          ThreadReclaimer::slot_type slot = reclaimer.acquire_slot();
+
+          while (!done)
+          {
+            reclaimer.enter(slot);
+
+            Node* p = head.load();
+
+            if ((p != nullptr) && (p->value < 0))
+            {
+              failed = true;
+            }
+
+            reclaimer.exit(slot);
+          }
+
+          reclaimer.release_slot(slot);
+        }));
+      }
+
+      ThreadReclaimer::slot_type writer = reclaimer.acquire_slot();
+
+      for (int i = 1; i <= Length; ++i)
+      {
+        Node* p_new = nullptr;
+
+        while (p_new == nullptr)
+        {
+          p_new = pool.full() ? nullptr : pool.create(i);
+
+          if (p_new == nullptr)
+          {
+            reclaimer.reclaim(writer);
+            std::this_thread::yield();
+          }
+        }
+
+        Node* p_old = head.exchange(p_new);
+
+        while (!reclaimer.retire(writer, p_old))
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      done = true;
+
+      for (std::thread& reader : readers)
+      {
+        reader.join();
+      }
+
+      reclaimer.retire(writer, head.exchange(nullptr));
+
+      while (reclaimer.retired_size(writer) != 0U)
+      {
+        reclaimer.reclaim(writer);
+      }
+
+      CHECK(!failed);
+      CHECK_EQUAL(0U, pool.size());
+    }
+  };
+}
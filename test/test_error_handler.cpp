@@ -86,6 +86,12 @@ namespace
   };
 
   test_class static_test;
+
+  //*****************************************************************************
+  void assert_test(bool state)
+  {
+    ETL_ASSERT(state, ETL_ERROR(test_exception));
+  }
 }
 
 namespace
@@ -188,5 +194,25 @@ namespace
 
       CHECK(error_received);
     }
+
+    //*************************************************************************
+    TEST(test_error_count)
+    {
+      etl::reset_error_count<test_exception>();
+      CHECK_EQUAL(0U, etl::error_count<test_exception>());
+
+      CHECK_NO_THROW(assert_test(true));
+      CHECK_EQUAL(0U, etl::error_count<test_exception>());
+
+      CHECK_THROW(assert_test(false), test_exception);
+      CHECK_THROW(assert_test(false), test_exception);
+      CHECK_EQUAL(2U, etl::error_count<test_exception>());
+
+      // Errors of other types are counted separately.
+      CHECK_EQUAL(0U, etl::error_count<etl::exception>());
+
+      etl::reset_error_count<test_exception>();
+      CHECK_EQUAL(0U, etl::error_count<test_exception>());
+    }
   };
 }
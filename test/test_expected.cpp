@@ -32,6 +32,7 @@ SOFTWARE.
 #include "etl/type_traits.h"
 
 #include <string>
+#include <type_traits>
 
 namespace
 {
@@ -564,5 +565,33 @@ namespace
       CHECK_TRUE(thrown);
       CHECK_TRUE(exception_what == thrown_what);
     }
+
+    //*************************************************************************
+    TEST(test_expected_trivially_copyable)
+    {
+      using TrivialExpected  = etl::expected<int, char>;
+      using TrivialExpectedV = etl::expected<void, char>;
+
+#if (ETL_USING_STL || defined(ETL_USE_TYPE_TRAITS_BUILTINS)) && !defined(ETL_USER_DEFINED_TYPE_TRAITS)
+      CHECK_TRUE(std::is_trivially_copyable<TrivialExpected>::value);
+      CHECK_TRUE(std::is_trivially_copyable<TrivialExpectedV>::value);
+#endif
+      CHECK_FALSE((std::is_trivially_copyable<etl::expected<std::string, char>>::value));
+
+      TrivialExpected  exp1(42);
+      TrivialExpected  exp2(etl::unexpected<char>('E'));
+      TrivialExpectedV exp3(etl::unexpected<char>('V'));
+
+      TrivialExpected  copy1(exp1);
+      TrivialExpectedV copy3(exp3);
+      CHECK_TRUE(copy1.has_value());
+      CHECK_EQUAL(42, copy1.value());
+      CHECK_FALSE(copy3.has_value());
+      CHECK_EQUAL('V', copy3.error());
+
+      copy1 = exp2;
+      CHECK_FALSE(copy1.has_value());
+      CHECK_EQUAL('E', copy1.error());
+    }
   };
 }
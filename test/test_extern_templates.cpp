@@ -0,0 +1,79 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+// This translation unit provides the instantiations for the test build.
+#define ETL_EXTERN_TEMPLATES_INSTANTIATE
+#include "etl/extern_templates.h"
+
+#include "etl/string.h"
+#include "etl/u16string.h"
+#include "etl/vector.h"
+
+namespace
+{
+  SUITE(test_extern_templates)
+  {
+    //*************************************************************************
+    TEST(test_instantiated_strings)
+    {
+      etl::string<8> text("abc");
+      text.append("defgh");
+      text.append("ij");
+
+      CHECK(text == "abcdefgh");
+      CHECK_TRUE(text.is_truncated());
+
+      etl::u16string<4> text16(u"ab");
+      text16.insert(text16.begin(), u'z');
+
+      CHECK(text16 == u"zab");
+    }
+
+    //*************************************************************************
+    TEST(test_instantiated_vectors)
+    {
+      etl::vector<uint8_t, 4> bytes(2U, 7U);
+      bytes.push_back(8U);
+
+      etl::ivector<uint8_t>& ibytes = bytes;
+      ibytes.erase(ibytes.begin());
+
+      CHECK_EQUAL(2U, bytes.size());
+      CHECK_EQUAL(7U, bytes[0]);
+      CHECK_EQUAL(8U, bytes[1]);
+
+      etl::vector<int, 3> ints;
+      ints.assign(3U, -1);
+
+      CHECK_EQUAL(3U, ints.size());
+      CHECK_EQUAL(-1, ints.back());
+    }
+  };
+}
@@ -0,0 +1,494 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fast_math.h"
+
+#include <vector>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+  const double pi = 3.14159265358979323846;
+
+  //***************************************************************************
+  // Maximum absolute error of f against g over [low, high].
+  template <typename TFunction, typename TReference>
+  double max_error(TFunction f, TReference g, double low, double high, size_t steps)
+  {
+    double error = 0.0;
+
+    for (size_t i = 0U; i <= steps; ++i)
+    {
+      const double x = low + ((high - low) * double(i)) / double(steps);
+      error = std::max(error, std::fabs(double(f(x)) - g(x)));
+    }
+
+    return error;
+  }
+
+  //***************************************************************************
+  // Maximum relative error of exp.
+  template <typename T, etl::fast_math_precision::enum_type Precision>
+  double max_exp_error(double low, double high, size_t steps)
+  {
+    double error = 0.0;
+
+    for (size_t i = 0U; i <= steps; ++i)
+    {
+      const T x = T(low + ((high - low) * double(i)) / double(steps));
+      const double expected = std::exp(double(x));
+      error = std::max(error, std::fabs(double(etl::fast_math<T, Precision>::exp(x)) - expected) / expected);
+    }
+
+    return error;
+  }
+
+  template <typename T, etl::fast_math_precision::enum_type Precision>
+  T fast_sin(double x) { return etl::fast_math<T, Precision>::sin(T(x)); }
+
+  template <typename T, etl::fast_math_precision::enum_type Precision>
+  T fast_cos(double x) { return etl::fast_math<T, Precision>::cos(T(x)); }
+
+  template <typename T, etl::fast_math_precision::enum_type Precision>
+  T fast_atan(double x) { return etl::fast_math<T, Precision>::atan(T(x)); }
+
+  template <typename T, etl::fast_math_precision::enum_type Precision>
+  T fast_log(double x) { return etl::fast_math<T, Precision>::log(T(x)); }
+
+  double float_sin(double x)  { return std::sin(double(float(x))); }
+  double float_cos(double x)  { return std::cos(double(float(x))); }
+  double float_atan(double x) { return std::atan(double(float(x))); }
+  double float_log(double x)  { return std::log(double(float(x))); }
+
+  double double_sin(double x)  { return std::sin(x); }
+  double double_cos(double x)  { return std::cos(x); }
+  double double_atan(double x) { return std::atan(x); }
+  double double_log(double x)  { return std::log(x); }
+
+  // Binary angle to radians.
+  double to_radians(uint32_t angle, double turn)
+  {
+    return (2.0 * pi * double(angle)) / turn;
+  }
+
+  SUITE(test_fast_math)
+  {
+    //*************************************************************************
+    TEST(test_sin_cos_float)
+    {
+      using etl::fast_math_precision;
+
+      CHECK(max_error(fast_sin<float, fast_math_precision::Low>,    float_sin, -20.0, 20.0, 20000U) < 7.0e-5);
+      CHECK(max_error(fast_sin<float, fast_math_precision::Medium>, float_sin, -20.0, 20.0, 20000U) < 1.5e-6);
+      CHECK(max_error(fast_sin<float, fast_math_precision::High>,   float_sin, -20.0, 20.0, 20000U) < 1.0e-6);
+
+      CHECK(max_error(fast_cos<float, fast_math_precision::Low>,    float_cos, -20.0, 20.0, 20000U) < 7.0e-5);
+      CHECK(max_error(fast_cos<float, fast_math_precision::Medium>, float_cos, -20.0, 20.0, 20000U) < 1.5e-6);
+      CHECK(max_error(fast_cos<float, fast_math_precision::High>,   float_cos, -20.0, 20.0, 20000U) < 1.0e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_sin_cos_double)
+    {
+      using etl::fast_math_precision;
+
+      CHECK(max_error(fast_sin<double, fast_math_precision::Medium>, double_sin, -100.0, 100.0, 20000U) < 6.0e-7);
+      CHECK(max_error(fast_sin<double, fast_math_precision::High>,   double_sin, -100.0, 100.0, 20000U) < 4.0e-9);
+      CHECK(max_error(fast_cos<double, fast_math_precision::High>,   double_cos, -100.0, 100.0, 20000U) < 4.0e-9);
+
+      // sin_cos shares the reduction, and gives the same results.
+      for (int i = -1000; i <= 1000; ++i)
+      {
+        const double x = 0.01 * i;
+        double s;
+        double c;
+
+        etl::fast_math<double>::sin_cos(x, s, c);
+
+        CHECK_CLOSE(etl::fast_math<double>::sin(x), s, 1e-15);
+        CHECK_CLOSE(etl::fast_math<double>::cos(x), c, 1e-15);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_atan)
+    {
+      using etl::fast_math_precision;
+
+      CHECK(max_error(fast_atan<float, fast_math_precision::Low>,     float_atan,  -50.0, 50.0, 20000U) < 9.0e-5);
+      CHECK(max_error(fast_atan<float, fast_math_precision::Medium>,  float_atan,  -50.0, 50.0, 20000U) < 2.0e-6);
+      CHECK(max_error(fast_atan<double, fast_math_precision::High>,   double_atan, -50.0, 50.0, 20000U) < 4.0e-8);
+    }
+
+    //*************************************************************************
+    TEST(test_atan2)
+    {
+      typedef etl::fast_math<double> fm;
+
+      double error = 0.0;
+
+      for (int i = 0; i < 3600; ++i)
+      {
+        const double angle = (2.0 * pi * i) / 3600.0;
+        const double y = 3.0 * std::sin(angle);
+        const double x = 3.0 * std::cos(angle);
+
+        error = std::max(error, std::fabs(fm::atan2(y, x) - std::atan2(y, x)));
+      }
+
+      CHECK(error < 2.0e-6);
+
+      // The axes.
+      CHECK_CLOSE(0.0,       fm::atan2(0.0, 1.0),  1e-12);
+      CHECK_CLOSE(pi / 2.0,  fm::atan2(1.0, 0.0),  1e-12);
+      CHECK_CLOSE(-pi / 2.0, fm::atan2(-1.0, 0.0), 1e-12);
+      CHECK_CLOSE(pi,        fm::atan2(0.0, -1.0), 1e-12);
+      CHECK_CLOSE(0.0,       fm::atan2(0.0, 0.0),  1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_exp)
+    {
+      using etl::fast_math_precision;
+
+      CHECK((max_exp_error<float, fast_math_precision::Low>(-80.0, 80.0, 20000U))     < 8.0e-5);
+      CHECK((max_exp_error<float, fast_math_precision::Medium>(-80.0, 80.0, 20000U))  < 3.0e-6);
+      CHECK((max_exp_error<float, fast_math_precision::High>(-80.0, 80.0, 20000U))    < 5.0e-7);
+      CHECK((max_exp_error<double, fast_math_precision::High>(-700.0, 700.0, 20000U)) < 3.0e-9);
+
+      // Either end of the range.
+      CHECK((max_exp_error<float, fast_math_precision::High>(88.0, 88.72, 1000U))    < 5.0e-7);
+      CHECK((max_exp_error<float, fast_math_precision::High>(-87.33, -86.0, 1000U))  < 5.0e-7);
+
+      typedef etl::fast_math<float> fm;
+
+      CHECK(std::isinf(fm::exp(89.0f)));
+      CHECK(fm::exp(-88.0f) < std::numeric_limits<float>::min());
+      CHECK(std::isnan(fm::exp(std::numeric_limits<float>::quiet_NaN())));
+    }
+
+    //*************************************************************************
+    TEST(test_log)
+    {
+      using etl::fast_math_precision;
+
+      CHECK(max_error(fast_log<float, fast_math_precision::Low>,     float_log,  0.001, 1000.0, 20000U) < 1.0e-5);
+      CHECK(max_error(fast_log<float, fast_math_precision::Medium>,  float_log,  0.001, 1000.0, 20000U) < 1.0e-6);
+      CHECK(max_error(fast_log<double, fast_math_precision::High>,   double_log, 1.0e-6, 1.0e6, 20000U) < 1.0e-9);
+
+      typedef etl::fast_math<float> fm;
+
+      // Subnormal.
+      const float subnormal = std::numeric_limits<float>::denorm_min() * 1000.0f;
+      CHECK_CLOSE(std::log(double(subnormal)), double(fm::log(subnormal)), 1e-4);
+
+      CHECK(std::isinf(fm::log(0.0f)));
+      CHECK(fm::log(0.0f) < 0.0f);
+      CHECK(std::isnan(fm::log(-1.0f)));
+      CHECK(std::isinf(fm::log(std::numeric_limits<float>::infinity())));
+    }
+
+    //*************************************************************************
+    TEST(test_fast_math_blocks)
+    {
+      typedef etl::fast_math<float> fm;
+
+      std::vector<float> input;
+
+      for (int i = 0; i < 64; ++i)
+      {
+        input.push_back(0.1f * float(i + 1));
+      }
+
+      std::vector<float> output(64U);
+      std::vector<float> output2(64U);
+      std::vector<float> output3(48U);
+
+      CHECK_EQUAL(64U, fm::sin(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        CHECK_CLOSE(fm::sin(input[i]), output[i], 0.0f);
+      }
+
+      CHECK_EQUAL(48U, fm::sin_cos(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size()), etl::span<float>(output3.data(), output3.size())));
+
+      for (size_t i = 0U; i < output3.size(); ++i)
+      {
+        CHECK_CLOSE(fm::cos(input[i]), output3[i], 0.0f);
+      }
+
+      CHECK_EQUAL(64U, fm::cos(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+      CHECK_CLOSE(fm::cos(input[10]), output[10], 0.0f);
+
+      CHECK_EQUAL(64U, fm::atan(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+      CHECK_CLOSE(fm::atan(input[10]), output[10], 0.0f);
+
+      CHECK_EQUAL(64U, fm::exp(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+      CHECK_CLOSE(fm::exp(input[10]), output[10], 0.0f);
+
+      CHECK_EQUAL(64U, fm::log(etl::span<const float>(input.data(), input.size()), etl::span<float>(output.data(), output.size())));
+      CHECK_CLOSE(fm::log(input[10]), output[10], 0.0f);
+
+      CHECK_EQUAL(64U, fm::atan2(etl::span<const float>(input.data(), input.size()),
+                                 etl::span<const float>(output.data(), output.size()),
+                                 etl::span<float>(output2.data(), output2.size())));
+      CHECK_CLOSE(fm::atan2(input[10], output[10]), output2[10], 0.0f);
+    }
+
+    //*************************************************************************
+    TEST(test_cordic_q15)
+    {
+      typedef etl::cordic<int16_t> cordic;
+
+      int error = 0;
+
+      for (uint32_t a = 0U; a < 65536U; a += 7U)
+      {
+        int16_t s;
+        int16_t c;
+
+        cordic::sin_cos(uint16_t(a), s, c);
+
+        const double angle = to_radians(a, 65536.0);
+
+        error = std::max(error, std::abs(int(s) - int(std::lround(32767.0 * std::sin(angle)))));
+        error = std::max(error, std::abs(int(c) - int(std::lround(32767.0 * std::cos(angle)))));
+      }
+
+      CHECK(error <= 2);
+
+      CHECK_CLOSE(32767,  cordic::sin(0x4000U), 2);
+      CHECK_CLOSE(-32767, cordic::sin(0xC000U), 2);
+      CHECK_CLOSE(0,      cordic::cos(0x4000U), 2);
+      CHECK_CLOSE(23170,  cordic::cos(0x2000U), 2);
+    }
+
+    //*************************************************************************
+    TEST(test_cordic_q31)
+    {
+      typedef etl::cordic<int32_t> cordic;
+
+      long long error = 0;
+
+      for (uint64_t a = 0U; a < 0x100000000ULL; a += 0x10001ULL)
+      {
+        int32_t s;
+        int32_t c;
+
+        cordic::sin_cos(uint32_t(a), s, c);
+
+        const double angle = to_radians(uint32_t(a), 4294967296.0);
+
+        error = std::max(error, std::llabs(int64_t(s) - std::llround(2147483647.0 * std::sin(angle))));
+        error = std::max(error, std::llabs(int64_t(c) - std::llround(2147483647.0 * std::cos(angle))));
+      }
+
+      CHECK(error <= 32);
+
+      // Fewer iterations are less precise.
+      CHECK_CLOSE(1518500249, (etl::cordic<int32_t, 30>::cos(0x20000000UL)), 64);
+      CHECK_CLOSE(1518500249, (etl::cordic<int32_t, 12>::cos(0x20000000UL)), 500000);
+    }
+
+    //*************************************************************************
+    TEST(test_cordic_polar)
+    {
+      typedef etl::cordic<int16_t> cordic;
+
+      int angle_error     = 0;
+      int magnitude_error = 0;
+
+      for (int i = 0; i < 720; ++i)
+      {
+        const double angle  = (2.0 * pi * i) / 720.0;
+        const double length = 1000.0 + (31.0 * i);
+
+        const int16_t x = int16_t(std::lround(length * std::cos(angle)));
+        const int16_t y = int16_t(std::lround(length * std::sin(angle)));
+
+        cordic::magnitude_type m;
+        cordic::angle_type     a;
+
+        cordic::polar(y, x, m, a);
+
+        double expected_angle = std::atan2(double(y), double(x));
+
+        if (expected_angle < 0.0)
+        {
+          expected_angle += 2.0 * pi;
+        }
+
+        const int difference = int(uint16_t(a - uint16_t(std::lround(expected_angle * 65536.0 / (2.0 * pi)))));
+
+        angle_error     = std::max(angle_error, std::min(difference, 65536 - difference));
+        magnitude_error = std::max(magnitude_error, std::abs(int(m) - int(std::lround(std::sqrt(double(x) * x + double(y) * y)))));
+
+        CHECK_EQUAL(a, cordic::atan2(y, x));
+        CHECK_EQUAL(m, cordic::magnitude(y, x));
+      }
+
+      CHECK(angle_error <= 2);
+      CHECK(magnitude_error <= 2);
+
+      // The extremes.
+      CHECK_CLOSE(46341, int(cordic::magnitude(-32768, -32768)), 4);
+      CHECK_CLOSE(0xA000, int(cordic::atan2(-32768, -32768)), 4);
+      CHECK_EQUAL(0U, cordic::magnitude(0, 0));
+      CHECK_EQUAL(0U, cordic::atan2(0, 0));
+      CHECK_EQUAL(0x8000U, cordic::atan2(0, -100));
+
+      typedef etl::cordic<int32_t> cordic32;
+      CHECK_CLOSE(3037000500.0, double(cordic32::magnitude(-2147483647 - 1, -2147483647 - 1)), 64.0);
+      CHECK_CLOSE(double(0x60000000UL), double(cordic32::atan2(2147483647, -2147483647)), 16.0);
+    }
+
+    //*************************************************************************
+    TEST(test_cordic_blocks)
+    {
+      typedef etl::cordic<int16_t> cordic;
+
+      uint16_t angles[16];
+      int16_t  s[16];
+      int16_t  c[16];
+      uint16_t result[16];
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        angles[i] = uint16_t(i * 4099U);
+      }
+
+      CHECK_EQUAL(16U, cordic::sin_cos(etl::span<const uint16_t>(angles), etl::span<int16_t>(s), etl::span<int16_t>(c)));
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        CHECK_EQUAL(cordic::sin(angles[i]), s[i]);
+        CHECK_EQUAL(cordic::cos(angles[i]), c[i]);
+      }
+
+      CHECK_EQUAL(16U, cordic::atan2(etl::span<const int16_t>(s), etl::span<const int16_t>(c), etl::span<uint16_t>(result)));
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        const int difference = int(uint16_t(result[i] - angles[i]));
+        CHECK(std::min(difference, 65536 - difference) <= 2);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_sin_table)
+    {
+      // Q15
+      {
+        typedef etl::sin_table<int16_t, 1024> table;
+
+        int error = 0;
+
+        for (uint32_t a = 0U; a < 65536U; ++a)
+        {
+          const double angle = to_radians(a, 65536.0);
+
+          error = std::max(error, std::abs(int(table::sin(uint16_t(a))) - int(std::lround(32767.0 * std::sin(angle)))));
+          error = std::max(error, std::abs(int(table::cos(uint16_t(a))) - int(std::lround(32767.0 * std::cos(angle)))));
+        }
+
+        CHECK(error <= 2);
+        CHECK_EQUAL(0,      table::sin(0U));
+        CHECK_EQUAL(32767,  table::sin(0x4000U));
+        CHECK_EQUAL(-32767, table::sin(0xC000U));
+        CHECK_EQUAL(32767,  table::cos(0U));
+      }
+
+      // Q31
+      {
+        typedef etl::sin_table<int32_t, 4096> table;
+
+        long long error = 0;
+
+        for (uint64_t a = 0U; a < 0x100000000ULL; a += 0x3FFFFULL)
+        {
+          const double angle = to_radians(uint32_t(a), 4294967296.0);
+
+          error = std::max(error, std::llabs(int64_t(table::sin(uint32_t(a))) - std::llround(2147483647.0 * std::sin(angle))));
+        }
+
+        // 4.9 / 4096^2 of full scale.
+        CHECK(error <= 700);
+      }
+
+      // float
+      {
+        typedef etl::sin_table<float, 256> table;
+
+        double error = 0.0;
+
+        for (uint64_t a = 0U; a < 0x100000000ULL; a += 0xFFFFULL)
+        {
+          const double angle = to_radians(uint32_t(a), 4294967296.0);
+
+          error = std::max(error, std::fabs(double(table::sin(uint32_t(a))) - std::sin(angle)));
+          error = std::max(error, std::fabs(double(table::cos(uint32_t(a))) - std::cos(angle)));
+        }
+
+        CHECK(error < 8.0e-5);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_sin_table_blocks)
+    {
+      typedef etl::sin_table<int16_t, 256> table;
+
+      uint16_t angles[16];
+      int16_t  s[16];
+      int16_t  c[16];
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        angles[i] = uint16_t(i * 4099U);
+      }
+
+      CHECK_EQUAL(16U, table::sin(etl::span<const uint16_t>(angles), etl::span<int16_t>(s)));
+
+      for (size_t i = 0U; i < 16U; ++i)
+      {
+        CHECK_EQUAL(table::sin(angles[i]), s[i]);
+      }
+
+      CHECK_EQUAL(8U, table::sin_cos(etl::span<const uint16_t>(angles), etl::span<int16_t>(s, 8U), etl::span<int16_t>(c)));
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(table::cos(angles[i]), c[i]);
+      }
+    }
+  };
+}
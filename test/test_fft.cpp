@@ -0,0 +1,283 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fft.h"
+
+#include <vector>
+#include <complex>
+#include <cmath>
+
+namespace
+{
+  //***************************************************************************
+  // Direct DFT, for comparison.
+  std::vector<std::complex<double> > dft(const std::vector<std::complex<double> >& x)
+  {
+    const size_t n = x.size();
+    const double pi = 3.14159265358979323846;
+
+    std::vector<std::complex<double> > result(n);
+
+    for (size_t k = 0U; k < n; ++k)
+    {
+      std::complex<double> sum(0.0, 0.0);
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        const double angle = -2.0 * pi * double((k * i) % n) / double(n);
+        sum += x[i] * std::complex<double>(std::cos(angle), std::sin(angle));
+      }
+
+      result[k] = sum;
+    }
+
+    return result;
+  }
+
+  //***************************************************************************
+  std::vector<std::complex<double> > make_signal(size_t n)
+  {
+    std::vector<std::complex<double> > x;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      x.push_back(std::complex<double>(0.4 * std::sin(0.3 * double(i)) + 0.2 * std::cos(1.7 * double(i)),
+                                       0.3 * std::cos(0.11 * double(i * i % 97U))));
+    }
+
+    return x;
+  }
+
+  //***************************************************************************
+  template <size_t N, typename T>
+  void check_complex_float(double tolerance)
+  {
+    std::vector<std::complex<double> > signal = make_signal(N);
+    std::vector<std::complex<double> > expected = dft(signal);
+
+    etl::fft_complex<T> data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      data[i].real = T(signal[i].real());
+      data[i].imag = T(signal[i].imag());
+    }
+
+    etl::fft<N, T> transform;
+    transform.forward(data);
+
+    for (size_t k = 0U; k < N; ++k)
+    {
+      CHECK_CLOSE(expected[k].real(), double(data[k].real), tolerance);
+      CHECK_CLOSE(expected[k].imag(), double(data[k].imag), tolerance);
+    }
+
+    transform.inverse(data);
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      CHECK_CLOSE(signal[i].real(), double(data[i].real), tolerance);
+      CHECK_CLOSE(signal[i].imag(), double(data[i].imag), tolerance);
+    }
+  }
+
+  //***************************************************************************
+  template <size_t N, typename T>
+  void check_complex_fixed(double tolerance)
+  {
+    const double one = double(etl::integral_limits<T>::max);
+
+    std::vector<std::complex<double> > signal = make_signal(N);
+
+    etl::fft_complex<T> data[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      data[i].real = T(std::floor(signal[i].real() * one + 0.5));
+      data[i].imag = T(std::floor(signal[i].imag() * one + 0.5));
+      signal[i] = std::complex<double>(double(data[i].real) / one, double(data[i].imag) / one);
+    }
+
+    std::vector<std::complex<double> > expected = dft(signal);
+
+    etl::fft<N, T> transform;
+    transform.forward(data);
+
+    // Scaled by 1 / N.
+    for (size_t k = 0U; k < N; ++k)
+    {
+      CHECK_CLOSE(expected[k].real() / double(N), double(data[k].real) / one, tolerance);
+      CHECK_CLOSE(expected[k].imag() / double(N), double(data[k].imag) / one, tolerance);
+    }
+  }
+
+  //***************************************************************************
+  template <size_t N, typename T>
+  void check_real(double tolerance, double one)
+  {
+    const bool fixed_point = !etl::is_floating_point<T>::value;
+
+    std::vector<std::complex<double> > signal;
+    T input[N];
+
+    for (size_t i = 0U; i < N; ++i)
+    {
+      const double value = 0.5 * std::sin(0.2 * double(i)) + 0.25 * std::cos(2.9 * double(i)) + 0.1;
+
+      input[i] = fixed_point ? T(std::floor(value * one + 0.5)) : T(value);
+      signal.push_back(std::complex<double>(double(input[i]) / one, 0.0));
+    }
+
+    std::vector<std::complex<double> > expected = dft(signal);
+
+    etl::fft_complex<T> output[(N / 2U) + 1U];
+
+    etl::real_fft<N, T> transform;
+    CHECK_EQUAL((N / 2U) + 1U, transform.Bin_Count);
+
+    transform.forward(input, output);
+
+    const double scale = fixed_point ? double(N) : 1.0;
+
+    for (size_t k = 0U; k <= (N / 2U); ++k)
+    {
+      CHECK_CLOSE(expected[k].real() / scale, double(output[k].real) / one, tolerance);
+      CHECK_CLOSE(expected[k].imag() / scale, double(output[k].imag) / one, tolerance);
+    }
+  }
+
+  SUITE(test_fft)
+  {
+    //*************************************************************************
+    TEST(test_twiddle)
+    {
+      typedef etl::fft<16, double> FFT;
+
+      CHECK_CLOSE(1.0,  FFT::twiddle(0).real, 1e-14);
+      CHECK_CLOSE(0.0,  FFT::twiddle(0).imag, 1e-14);
+      CHECK_CLOSE(0.0,  FFT::twiddle(4).real, 1e-14);
+      CHECK_CLOSE(-1.0, FFT::twiddle(4).imag, 1e-14);
+      CHECK_CLOSE(-1.0, FFT::twiddle(8).real, 1e-14);
+      CHECK_CLOSE(std::cos(2.0 * 3.14159265358979323846 * 3.0 / 16.0), FFT::twiddle(3).real, 1e-14);
+      CHECK_CLOSE(-std::sin(2.0 * 3.14159265358979323846 * 13.0 / 16.0), FFT::twiddle(13).imag, 1e-14);
+
+      typedef etl::fft<16, int16_t> FFT_Q15;
+
+      CHECK_EQUAL(32767,  FFT_Q15::twiddle(0).real);
+      CHECK_EQUAL(-32767, FFT_Q15::twiddle(4).imag);
+      CHECK_EQUAL(23170,  FFT_Q15::twiddle(2).real);
+    }
+
+    //*************************************************************************
+    TEST(test_fft_float)
+    {
+      check_complex_float<2, float>(1e-5);
+      check_complex_float<4, float>(1e-5);
+      check_complex_float<8, float>(1e-5);
+      check_complex_float<32, float>(1e-4);
+      check_complex_float<256, float>(1e-3);
+    }
+
+    //*************************************************************************
+    TEST(test_fft_double)
+    {
+      check_complex_float<16, double>(1e-12);
+      check_complex_float<128, double>(1e-11);
+      check_complex_float<1024, double>(1e-10);
+    }
+
+    //*************************************************************************
+    TEST(test_fft_impulse)
+    {
+      etl::fft_complex<float> data[8] = { { 1.0f, 0.0f } };
+
+      etl::fft<8> transform;
+      transform.forward(data);
+
+      for (size_t k = 0U; k < 8U; ++k)
+      {
+        CHECK_CLOSE(1.0f, data[k].real, 1e-6f);
+        CHECK_CLOSE(0.0f, data[k].imag, 1e-6f);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fft_q15)
+    {
+      check_complex_fixed<8, int16_t>(4.0 / 32768.0);
+      check_complex_fixed<64, int16_t>(8.0 / 32768.0);
+      check_complex_fixed<512, int16_t>(12.0 / 32768.0);
+    }
+
+    //*************************************************************************
+    TEST(test_fft_q15_tone)
+    {
+      // Full scale cosine in bin 4 gives 0.5 in bins 4 and 60 after 1 / N scaling.
+      const size_t N = 64U;
+
+      etl::fft_complex<int16_t> data[N];
+
+      for (size_t i = 0U; i < N; ++i)
+      {
+        data[i].real = int16_t(std::floor(32767.0 * std::cos(2.0 * 3.14159265358979323846 * 4.0 * double(i) / double(N)) + 0.5));
+        data[i].imag = 0;
+      }
+
+      etl::fft<N, int16_t> transform;
+      transform.forward(data);
+
+      for (size_t k = 0U; k < N; ++k)
+      {
+        const int expected = ((k == 4U) || (k == 60U)) ? 16384 : 0;
+
+        CHECK_CLOSE(expected, int(data[k].real), 4);
+        CHECK_CLOSE(0,        int(data[k].imag), 4);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_fft_q31)
+    {
+      check_complex_fixed<16, int32_t>(1e-8);
+      check_complex_fixed<256, int32_t>(1e-8);
+    }
+
+    //*************************************************************************
+    TEST(test_real_fft)
+    {
+      check_real<4, float>(1e-5, 1.0);
+      check_real<64, float>(1e-4, 1.0);
+      check_real<512, double>(1e-10, 1.0);
+      check_real<64, int16_t>(8.0 / 32768.0, 32767.0);
+      check_real<1024, int16_t>(16.0 / 32768.0, 32767.0);
+      check_real<128, int32_t>(1e-8, 2147483647.0);
+    }
+  };
+}
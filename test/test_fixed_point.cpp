@@ -0,0 +1,264 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/fixed_point.h"
+#include "etl/scaled_rounding.h"
+
+#include <stdint.h>
+
+namespace
+{
+  typedef etl::fixed_point<3U, 4U>           Q3_4;
+  typedef etl::fixed_point<3U, 12U, int32_t> Q3_12_32;
+
+  SUITE(test_fixed_point)
+  {
+    //*************************************************************************
+    TEST(test_storage)
+    {
+      CHECK_TRUE((etl::is_same<int8_t,  Q3_4::storage_type>::value));
+      CHECK_TRUE((etl::is_same<int16_t, etl::q15_t::storage_type>::value));
+      CHECK_TRUE((etl::is_same<int32_t, etl::q15_t::wide_type>::value));
+      CHECK_TRUE((etl::is_same<int64_t, etl::q31_t::wide_type>::value));
+      CHECK_EQUAL(sizeof(int16_t), sizeof(etl::q15_t));
+      CHECK_EQUAL(15U, etl::q15_t::Fraction_Bits);
+      CHECK_EQUAL(0U,  etl::q15_t::Integer_Bits);
+    }
+
+    //*************************************************************************
+    TEST(test_conversions)
+    {
+      CHECK_EQUAL(16384, etl::q15_t(0.5).raw());
+      CHECK_EQUAL(-16384, etl::q15_t(-0.5).raw());
+      CHECK_EQUAL(32767, etl::q15_t(1.0).raw());
+      CHECK_EQUAL(-32768, etl::q15_t(-2.0).raw());
+      CHECK_CLOSE(0.25, etl::q15_t(0.25).to_double(), 1e-9);
+      CHECK_CLOSE(0.25f, etl::q15_t(0.25).to_float(), 1e-6f);
+
+      // Rounded to nearest, halves up.
+      CHECK_EQUAL(1,  Q3_4(0.5 / 16.0).raw());
+      CHECK_EQUAL(0,  Q3_4(-0.5 / 16.0).raw());
+      CHECK_EQUAL(-1, Q3_4(-0.6 / 16.0).raw());
+
+      CHECK_EQUAL(3 * 16, Q3_4::from_integer(3).raw());
+      CHECK_EQUAL(127, Q3_4::from_integer(100).raw());
+      CHECK_EQUAL(-128, Q3_4::from_integer(-100).raw());
+
+      CHECK_EQUAL(3,  Q3_4(2.5).to_integer());
+      CHECK_EQUAL(-2, Q3_4(-2.5).to_integer());
+      CHECK_EQUAL(-3, Q3_4(-2.75).to_integer());
+
+      CHECK_EQUAL(7,   Q3_4::max().to_integer() - 1);
+      CHECK_EQUAL(127, Q3_4::max().raw());
+      CHECK_EQUAL(-128, Q3_4::min().raw());
+      CHECK_EQUAL(1,   Q3_4::epsilon().raw());
+    }
+
+    //*************************************************************************
+    TEST(test_format_conversion)
+    {
+      const etl::q31_t q31(0.123456789);
+      const etl::q15_t q15(q31);
+
+      CHECK_EQUAL(etl::q15_t(0.123456789).raw(), q15.raw());
+      CHECK_EQUAL(int32_t(q15.raw()) << 16, etl::q31_t(q15).raw());
+
+      // 1.5 does not fit in Q15.
+      const etl::q16_16_t big(1.5);
+      CHECK_EQUAL(32767, etl::q15_t(big).raw());
+      CHECK_EQUAL(-32768, etl::q15_t(-big).raw());
+
+      const etl::q16_16_t back(etl::q15_t(-0.75));
+      CHECK_CLOSE(-0.75, back.to_double(), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_scaled)
+    {
+      const etl::q16_16_t pi = etl::q16_16_t::from_scaled<100>(314);
+      CHECK_CLOSE(3.14, pi.to_double(), 1.0 / 65536.0);
+      CHECK_EQUAL(314, pi.to_scaled<100>());
+      CHECK_EQUAL(3142, etl::q16_16_t(3.14159).to_scaled<1000>());
+      CHECK_EQUAL(-3142, etl::q16_16_t(-3.14159).to_scaled<1000>());
+
+      // Compatible with the scaled rounding functions.
+      const int32_t scaled = int32_t(etl::q16_16_t(2.5).to_scaled<10>());
+      CHECK_EQUAL(25, scaled);
+      CHECK_EQUAL(2, etl::round_half_even_unscaled<10>(scaled));
+      CHECK_EQUAL(3, etl::round_half_up_unscaled<10>(scaled));
+    }
+
+    //*************************************************************************
+    TEST(test_saturating_arithmetic)
+    {
+      const etl::q15_t half(0.5);
+      const etl::q15_t quarter(0.25);
+
+      CHECK_EQUAL(etl::q15_t(0.75).raw(), (half + quarter).raw());
+      CHECK_EQUAL(etl::q15_t(0.25).raw(), (half - quarter).raw());
+      CHECK_EQUAL(etl::q15_t(0.125).raw(), (half * quarter).raw());
+      CHECK_EQUAL(etl::q15_t(0.5).raw(), (quarter / half).raw());
+
+      CHECK_EQUAL(32767, (half + half + half).raw());
+      CHECK_EQUAL(-32768, (-half - half - half).raw());
+      CHECK_EQUAL(32767, (etl::q15_t::min() * etl::q15_t::min()).raw());
+      CHECK_EQUAL(32767, (-etl::q15_t::min()).raw());
+      CHECK_EQUAL(32767, (half / quarter).raw());
+      CHECK_EQUAL(32767, (half / etl::q15_t()).raw());
+      CHECK_EQUAL(-32768, (-half / etl::q15_t()).raw());
+
+      const etl::q31_t a(0.5);
+      CHECK_EQUAL(etl::q31_t(0.25).raw(), (a * a).raw());
+      CHECK_EQUAL(INT32_MAX, (etl::q31_t::min() * etl::q31_t::min()).raw());
+      CHECK_EQUAL(INT32_MAX, (a + a).raw());
+
+      // Multiply rounds to nearest.
+      CHECK_EQUAL(1, (etl::q15_t::from_raw(1) * etl::q15_t(0.5)).raw());
+      CHECK_EQUAL(0, (etl::q15_t::from_raw(1) * etl::q15_t::from_raw(16383)).raw());
+
+      const Q3_12_32 x(3.0);
+      CHECK_CLOSE(7.999755859375, (x * x).to_double(), 1e-9);
+      CHECK_CLOSE(-6.0, (x * Q3_12_32(-2.0)).to_double(), 1e-9);
+      CHECK_CLOSE(1.5, (x / Q3_12_32(2.0)).to_double(), 1e-9);
+
+      etl::q15_t y(0.5);
+      y *= quarter;
+      y += quarter;
+      y -= etl::q15_t(0.125);
+      y /= half;
+      CHECK_EQUAL(etl::q15_t(0.5).raw(), y.raw());
+    }
+
+    //*************************************************************************
+    TEST(test_comparisons)
+    {
+      const etl::q15_t a(0.25);
+      const etl::q15_t b(0.5);
+
+      CHECK_TRUE(a < b);
+      CHECK_TRUE(a <= b);
+      CHECK_TRUE(b > a);
+      CHECK_TRUE(b >= a);
+      CHECK_TRUE(a != b);
+      CHECK_TRUE(a == etl::q15_t(0.25));
+    }
+
+    //*************************************************************************
+    template <typename TFixed>
+    void check_blocks()
+    {
+      typedef typename TFixed::storage_type storage_type;
+
+      const size_t Size = 37U;
+
+      TFixed a[Size];
+      TFixed b[Size];
+      TFixed out[Size];
+
+      const storage_type lowest  = TFixed::min().raw();
+      const storage_type highest = TFixed::max().raw();
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        a[i] = TFixed::from_raw(storage_type(seed >> 8));
+        seed = (seed * 1103515245U) + 12345U;
+        b[i] = TFixed::from_raw(storage_type(seed >> 4));
+      }
+
+      // Extremes.
+      a[0] = TFixed::from_raw(lowest);  b[0] = TFixed::from_raw(lowest);
+      a[1] = TFixed::from_raw(highest); b[1] = TFixed::from_raw(highest);
+      a[2] = TFixed::from_raw(lowest);  b[2] = TFixed::from_raw(highest);
+      a[3] = TFixed::from_raw(highest); b[3] = TFixed::from_raw(lowest);
+
+      TFixed::add(a, b, out);
+      for (size_t i = 0U; i < Size; ++i) { CHECK_EQUAL((a[i] + b[i]).raw(), out[i].raw()); }
+
+      TFixed::subtract(a, b, out);
+      for (size_t i = 0U; i < Size; ++i) { CHECK_EQUAL((a[i] - b[i]).raw(), out[i].raw()); }
+
+      TFixed::multiply(a, b, out);
+      for (size_t i = 0U; i < Size; ++i) { CHECK_EQUAL((a[i] * b[i]).raw(), out[i].raw()); }
+
+      TFixed::scale(a, b[5], out);
+      for (size_t i = 0U; i < Size; ++i) { CHECK_EQUAL((a[i] * b[5]).raw(), out[i].raw()); }
+
+      // In place.
+      TFixed::add(etl::span<const TFixed>(a), etl::span<const TFixed>(b), etl::span<TFixed>(a));
+      TFixed::subtract(a, b, out);
+      CHECK_EQUAL((TFixed::from_raw(highest) + TFixed::from_raw(highest) - TFixed::from_raw(highest)).raw(), out[1].raw());
+
+      // Shorter output.
+      out[Size - 1U] = TFixed();
+      TFixed::add(a, b, etl::span<TFixed>(out, Size - 1U));
+      CHECK_EQUAL(0, out[Size - 1U].raw());
+    }
+
+    TEST(test_block_operations)
+    {
+      check_blocks<etl::q15_t>();
+      check_blocks<etl::q31_t>();
+      check_blocks<etl::q7_t>();
+      check_blocks<Q3_12_32>();
+    }
+
+    //*************************************************************************
+    TEST(test_dot_product)
+    {
+      etl::q15_t a[19];
+      etl::q15_t b[19];
+
+      double expected = 0.0;
+
+      for (size_t i = 0U; i < 19U; ++i)
+      {
+        a[i] = etl::q15_t(0.05 * double(i) - 0.4);
+        b[i] = etl::q15_t(0.5 - 0.03 * double(i));
+        expected += a[i].to_double() * b[i].to_double();
+      }
+
+      const etl::q15_t result = etl::q15_t::dot_product(a, b);
+      CHECK_CLOSE(expected, result.to_double(), 1.0 / 32768.0);
+
+      // Saturates.
+      etl::q15_t ones[8];
+      for (size_t i = 0U; i < 8U; ++i) { ones[i] = etl::q15_t::min(); }
+      CHECK_EQUAL(32767, etl::q15_t::dot_product(ones, ones).raw());
+
+      etl::q7_t c[3] = { etl::q7_t(0.5), etl::q7_t(0.5), etl::q7_t(-0.25) };
+      CHECK_EQUAL(int(etl::q7_t(0.5625).raw()), int(etl::q7_t::dot_product(c, c).raw()));
+    }
+  }
+}
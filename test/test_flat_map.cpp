@@ -867,6 +867,69 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_batches)
+    {
+      std::map<int, int> compare_data;
+      etl::flat_map<int, int, 64> data;
+
+      // Existing values.
+      for (int i = 0; i < 40; i += 4)
+      {
+        data.insert(ETL_OR_STD::make_pair(i, -i));
+        compare_data.insert(std::make_pair(i, -i));
+      }
+
+      // Unordered, with repeated and existing keys.
+      std::vector<ETL_OR_STD::pair<int, int> > batch;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        batch.push_back(ETL_OR_STD::make_pair((i * 37) % 60, i));
+      }
+
+      data.insert(batch.begin(), batch.end());
+      compare_data.insert(batch.begin(), batch.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_when_full_existing_keys)
+    {
+      Compare_DataNDC compare_data;
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      compare_data.insert(initial_data.begin(), initial_data.end());
+
+      CHECK_NO_THROW(data.insert(initial_data.rbegin(), initial_data.rend()));
+
+      bool isEqual = Check_Equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_construct_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(etl::sorted_unique_t(), compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool isEqual = Check_Equal(data.begin(), data.end(), compare_data.begin());
+
+      CHECK(isEqual);
+      CHECK(data.find(5) != data.end());
+
+      CHECK_THROW(data.assign(etl::sorted_unique_t(), excess_data.begin(), excess_data.end()), etl::flat_map_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
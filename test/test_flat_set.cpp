@@ -613,6 +613,59 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_merges_batches)
+    {
+      std::set<int> compare_data;
+      etl::flat_set<int, 64> data;
+
+      // Existing values.
+      for (int i = 0; i < 40; i += 4)
+      {
+        data.insert(i);
+        compare_data.insert(i);
+      }
+
+      // Unordered, with repeated and existing values.
+      std::vector<int> batch;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        batch.push_back((i * 37) % 60);
+      }
+
+      data.insert(batch.begin(), batch.end());
+      compare_data.insert(batch.begin(), batch.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_range_when_full_existing_values)
+    {
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      CHECK_NO_THROW(data.insert(initial_data.rbegin(), initial_data.rend()));
+
+      CHECK_EQUAL(initial_data.size(), data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_construct_sorted_unique)
+    {
+      Compare_DataNDC compare_data(initial_data.begin(), initial_data.end());
+
+      DataNDC data(etl::sorted_unique_t(), compare_data.begin(), compare_data.end());
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      CHECK(data.find(N5) != data.end());
+
+      CHECK_THROW(data.assign(etl::sorted_unique_t(), excess_data.begin(), excess_data.end()), etl::flat_set_full);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_insert_existing_value_when_full)
     {
@@ -0,0 +1,480 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <utility>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_map>
+
+#include "data.h"
+
+#include "etl/flat_unordered_map.h"
+
+namespace
+{
+  //*************************************************************************
+  // Every key collides.
+  struct constant_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 42U;
+    }
+  };
+
+  //*************************************************************************
+  struct string_hash
+  {
+    size_t operator ()(const std::string& text) const
+    {
+      size_t hash = 0U;
+
+      for (size_t i = 0U; i < text.size(); ++i)
+      {
+        hash = (hash * 31U) + size_t(text[i]);
+      }
+
+      return hash;
+    }
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef ETL_OR_STD::pair<std::string, NDC> ElementNDC;
+
+  //*************************************************************************
+  template <typename TMap, typename TCompare>
+  bool Check_Equal(const TMap& map, const TCompare& compare)
+  {
+    if (map.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t count = 0U;
+
+    for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+    {
+      typename TCompare::const_iterator other = compare.find(itr->first);
+
+      if ((other == compare.end()) || !(other->second == itr->second))
+      {
+        return false;
+      }
+
+      ++count;
+    }
+
+    return count == compare.size();
+  }
+
+  SUITE(test_flat_unordered_map)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::flat_unordered_map<std::string, NDC, SIZE, string_hash> DataNDC;
+    typedef etl::iflat_unordered_map<std::string, NDC, string_hash>      IDataNDC;
+
+    typedef etl::flat_unordered_map<int, int, SIZE> DataInt;
+
+    //*************************************************************************
+    std::vector<ElementNDC> make_data(size_t first, size_t count)
+    {
+      std::vector<ElementNDC> data;
+
+      for (size_t i = first; i < (first + count); ++i)
+      {
+        data.push_back(ElementNDC(std::string("K") + std::to_string(i), NDC(std::to_string(i))));
+      }
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+
+      // The load is never more than 7/8.
+      CHECK(data.slot_count() >= (SIZE + (SIZE / 7U)));
+      CHECK(etl::is_power_of_2<DataNDC::MAX_GROUPS>::value || (DataNDC::MAX_GROUPS == 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { {1, 10}, {2, 20}, {3, 30} };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(20, data.at(2));
+      CHECK_EQUAL(30, data.at(3));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_constructor)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC data2(data);
+
+      CHECK(data2 == data);
+      CHECK_EQUAL(data.size(), data2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC data2(std::move(data));
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data2, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_assignment)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC other_data;
+
+      other_data = data;
+
+      CHECK(other_data == data);
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_interface)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(ElementNDC("A", NDC("1")));
+
+      CHECK(result.second);
+      CHECK_EQUAL(std::string("A"), result.first->first);
+      CHECK_EQUAL(NDC("1"), result.first->second);
+
+      // Duplicates are not inserted.
+      result = data.insert(ElementNDC("A", NDC("2")));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(NDC("1"), result.first->second);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data;
+
+      data.insert(initial_data.begin(), initial_data.end());
+
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      // An existing key is fine when full.
+      CHECK(!data.insert(initial_data[0]).second);
+
+      CHECK_THROW(data.insert(ElementNDC("Excess", NDC("X"))), etl::flat_unordered_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_index_operator)
+    {
+      DataInt data;
+
+      data[1] = 10;
+      data[2] = 20;
+      ++data[1];
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(11, data[1]);
+      CHECK_EQUAL(20, data[2]);
+      CHECK_EQUAL(0, data[3]);
+      CHECK_EQUAL(3U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      DataInt data;
+      data[1] = 10;
+
+      const DataInt& cdata = data;
+
+      CHECK_EQUAL(10, data.at(1));
+      CHECK_EQUAL(10, cdata.at(1));
+      CHECK_THROW(data.at(2), etl::flat_unordered_map_out_of_range);
+      CHECK_THROW(cdata.at(2), etl::flat_unordered_map_out_of_range);
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_equal_range)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        DataNDC::const_iterator itr = data.find(initial_data[i].first);
+
+        CHECK(itr != data.end());
+        CHECK_EQUAL(initial_data[i].second, itr->second);
+        CHECK_EQUAL(1U, data.count(initial_data[i].first));
+
+        ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> range = data.equal_range(initial_data[i].first);
+        CHECK(range.first == itr);
+        CHECK_EQUAL(1, std::distance(range.first, range.second));
+      }
+
+      CHECK(data.find("Missing") == data.end());
+      CHECK_EQUAL(0U, data.count("Missing"));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase("K3"));
+      CHECK_EQUAL(0U, data.erase("K3"));
+      compare.erase("K3");
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.begin();
+      std::advance(itr, 4);
+
+      DataNDC::iterator inext = itr;
+      ++inext;
+
+      compare.erase(itr->first);
+
+      DataNDC::iterator iresult = data.erase(itr);
+
+      CHECK(iresult == inext);
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::map<std::string, NDC> compare(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator first = data.begin();
+      std::advance(first, 2);
+
+      DataNDC::iterator last = first;
+      std::advance(last, 5);
+
+      for (DataNDC::iterator itr = first; itr != last; ++itr)
+      {
+        compare.erase(itr->first);
+      }
+
+      DataNDC::iterator iresult = data.erase(first, last);
+
+      CHECK(iresult == last);
+      CHECK(Check_Equal(data, compare));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+
+      // Other tests may leave instances alive.
+      const size_t initial_count = NDC::get_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.end());
+
+        data.clear();
+
+        CHECK(data.empty());
+        CHECK(data.begin() == data.end());
+
+        data.insert(initial_data.begin(), initial_data.end());
+      }
+
+      // Every element created by the container has been destroyed.
+      CHECK_EQUAL(initial_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      std::vector<ElementNDC> initial_data = make_data(0U, SIZE);
+      std::vector<ElementNDC> reversed_data(initial_data.rbegin(), initial_data.rend());
+      std::vector<ElementNDC> different_data = make_data(5U, SIZE);
+
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(reversed_data.begin(), reversed_data.end());
+      DataNDC data3(different_data.begin(), different_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes)
+    {
+      etl::flat_unordered_map<int, int, 100, constant_hash> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data[i] = i * 2;
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 100; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL((i % 2) == 0 ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase)
+    {
+      // Enough churn to fill the table with tombstones many times over.
+      static const size_t Max = 200U;
+
+      etl::flat_unordered_map<int, int, Max> data;
+      std::unordered_map<int, int> compare;
+
+      std::mt19937 generator(1234);
+      std::uniform_int_distribution<int> key_distribution(0, 400);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        if ((compare.size() < Max) && ((generator() % 2U) == 0U))
+        {
+          data[key]    = i;
+          compare[key] = i;
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(Check_Equal(data, compare));
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+  };
+}
@@ -0,0 +1,170 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/format.h"
+#include "etl/string.h"
+
+#include <stdio.h>
+
+#if ETL_USING_CPP17
+
+namespace
+{
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_literal_text_and_escapes)
+    {
+      etl::string<32> str;
+
+      etl::format_to(str, ETL_FORMAT_STRING("Hello {{World}}"));
+      CHECK_EQUAL(std::string("Hello {World}"), std::string(str.c_str()));
+
+      str.clear();
+      etl::format_to(str, ETL_FORMAT_STRING(""));
+      CHECK(str.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_integrals)
+    {
+      etl::string<96> str;
+
+      etl::format_to(str, ETL_FORMAT_STRING("{} {:08x}"), 42, 255U);
+      CHECK_EQUAL(std::string("42 000000ff"), std::string(str.c_str()));
+
+      str.clear();
+      etl::format_to(str, ETL_FORMAT_STRING("{:#x} {:X} {:o} {:b} {:d}"), 255, 255, 8, 5, -17);
+      CHECK_EQUAL(std::string("0xff FF 10 101 -17"), std::string(str.c_str()));
+
+      str.clear();
+      etl::format_to(str, ETL_FORMAT_STRING("[{:5}] [{:<5}] [{:*>5}]"), 12, 12, 12);
+      CHECK_EQUAL(std::string("[   12] [12   ] [***12]"), std::string(str.c_str()));
+
+      str.clear();
+      etl::format_to(str, ETL_FORMAT_STRING("{} {}"), int64_t(-9223372036854775807LL - 1), uint64_t(18446744073709551615ULL));
+      CHECK_EQUAL(std::string("-9223372036854775808 18446744073709551615"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_manual_indexes)
+    {
+      etl::string<40> str;
+
+      etl::format_to(str, ETL_FORMAT_STRING("{1}-{0}-{1}"), 1, 2);
+      CHECK_EQUAL(std::string("2-1-2"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_strings_bool_and_char)
+    {
+      etl::string<64> str;
+      etl::string<8>  text("abc");
+      etl::string_view view("view");
+
+      etl::format_to(str, ETL_FORMAT_STRING("{}|{:6}|{:>6}|{}|{}"), "literal", text, view, true, 'Z');
+      CHECK_EQUAL(std::string("literal|abc   |  view|true|Z"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      etl::string<80> str;
+
+      etl::format_to(str, ETL_FORMAT_STRING("{} {:.2f} {:.2}"), 0.1, 3.14159, 2.5f);
+      CHECK_EQUAL(std::string("0.1 3.14 2.50"), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_pointer)
+    {
+      int  value = 0;
+      int* p     = &value;
+
+      etl::string<64> str;
+      etl::format_to(str, ETL_FORMAT_STRING("{}"), p);
+
+      char expected[32];
+      snprintf(expected, sizeof(expected), "0x%llx", static_cast<unsigned long long>(reinterpret_cast<uintptr_t>(p)));
+
+      CHECK_EQUAL(std::string(expected), std::string(str.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      etl::string<32> str("Value: ");
+
+      etl::istring& result = etl::format_to(str, ETL_FORMAT_STRING("{}"), 7);
+
+      CHECK_EQUAL(std::string("Value: 7"), std::string(str.c_str()));
+      CHECK(&result == &str);
+    }
+
+    //*************************************************************************
+    TEST(test_max_size)
+    {
+      // "-2147483648" + ' ' + 8 hex digits.
+      static_assert(etl::format_max_size<int32_t, uint32_t>(ETL_FORMAT_STRING("{} {:08x}")) == 20U);
+
+      // Widths and bounded strings.
+      static_assert(etl::format_max_size<bool, etl::string<12> >(ETL_FORMAT_STRING("{:30}{}")) == 42U);
+
+      // Other strings have no bound.
+      static_assert(etl::format_max_size<const char*>(ETL_FORMAT_STRING("{}")) == etl::format_unbounded);
+
+      // Fits exactly.
+      etl::string<20> str;
+      etl::format_to(str, ETL_FORMAT_STRING("{} {:08x}"), -2147483647 - 1, uint32_t(0xFFFFFFFFUL));
+      CHECK_EQUAL(std::string("-2147483648 ffffffff"), std::string(str.c_str()));
+      CHECK(!str.is_truncated());
+    }
+
+#if ETL_USING_CPP20
+    //*************************************************************************
+    TEST(test_literal_template_parameter)
+    {
+      etl::string<32> str;
+
+      etl::format_to<"{} {:08x}">(str, 42, 255U);
+      CHECK_EQUAL(std::string("42 000000ff"), std::string(str.c_str()));
+
+      static_assert(etl::format_max_size<"{} {:08x}", int32_t, uint32_t>() == 20U);
+
+      etl::istring& istr = str;
+      istr.clear();
+      etl::format_to<"<{}>">(istr, "x");
+      CHECK_EQUAL(std::string("<x>"), std::string(str.c_str()));
+    }
+#endif
+  }
+}
+
+#endif
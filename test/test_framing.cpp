@@ -0,0 +1,353 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/framing.h"
+#include "etl/crc32.h"
+
+#include <vector>
+#include <stdint.h>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  struct Collector
+  {
+    Collector(std::vector<Bytes>& frames_)
+      : frames(frames_)
+    {
+    }
+
+    void operator()(etl::span<const uint8_t> payload)
+    {
+      frames.push_back(Bytes(payload.begin(), payload.end()));
+    }
+
+    std::vector<Bytes>& frames;
+  };
+
+  //*************************************************************************
+  etl::span<const uint8_t> to_span(const Bytes& bytes)
+  {
+    return bytes.empty() ? etl::span<const uint8_t>() : etl::span<const uint8_t>(bytes.data(), bytes.size());
+  }
+
+  //*************************************************************************
+  Bytes make_payload(size_t length, uint32_t seed)
+  {
+    Bytes payload;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+
+      // Plenty of zeroes and special bytes.
+      const uint8_t specials[] = { 0x00, 0xC0, 0xDB, 0x7E, 0x7D };
+      const uint8_t value = uint8_t(seed >> 24);
+
+      payload.push_back(((value & 0x07U) < 5U) ? specials[value & 0x07U] : value);
+    }
+
+    return payload;
+  }
+
+  //*************************************************************************
+  template <typename TEncoder, typename TDecoder>
+  void check_round_trip(size_t chunk)
+  {
+    std::vector<Bytes> payloads;
+    Bytes stream;
+
+    for (size_t length = 0U; length < 600U; length += 37U)
+    {
+      payloads.push_back(make_payload(length, uint32_t(length)));
+
+      Bytes encoded(TEncoder::max_encoded_size(payloads.back().size()));
+      const size_t size = TEncoder::encode(to_span(payloads.back()),
+                                           etl::span<uint8_t>(encoded.data(), encoded.size()));
+
+      CHECK(size != 0U);
+      stream.insert(stream.end(), encoded.begin(), encoded.begin() + size);
+    }
+
+    std::vector<Bytes> frames;
+    TDecoder decoder;
+    size_t count = 0U;
+
+    for (size_t i = 0U; i < stream.size(); i += chunk)
+    {
+      const size_t n = std::min(chunk, stream.size() - i);
+      count += decoder.decode(etl::span<const uint8_t>(stream.data() + i, n), Collector(frames));
+    }
+
+    // The empty payload is a valid frame only when there is a frame check sequence or for COBS.
+    CHECK_EQUAL(frames.size(), count);
+    CHECK_EQUAL(decoder.frame_count(), count);
+    CHECK_EQUAL(0U, decoder.crc_error_count());
+    CHECK_EQUAL(0U, decoder.framing_error_count());
+
+    size_t first = payloads.size() - frames.size();
+
+    for (size_t i = 0U; i < frames.size(); ++i)
+    {
+      CHECK(payloads[first + i] == frames[i]);
+    }
+  }
+
+  SUITE(test_framing)
+  {
+    //*************************************************************************
+    TEST(test_cobs_known_vectors)
+    {
+      uint8_t output[300];
+
+      const uint8_t data1[] = { 0x11, 0x22, 0x00, 0x33 };
+      const uint8_t expected1[] = { 0x03, 0x11, 0x22, 0x02, 0x33, 0x00 };
+
+      size_t size = etl::cobs_encoder<>::encode(etl::span<const uint8_t>(data1), etl::span<uint8_t>(output));
+      CHECK_EQUAL(sizeof(expected1), size);
+      CHECK_ARRAY_EQUAL(expected1, output, sizeof(expected1));
+
+      const uint8_t data2[] = { 0x00 };
+      const uint8_t expected2[] = { 0x01, 0x01, 0x00 };
+
+      size = etl::cobs_encoder<>::encode(etl::span<const uint8_t>(data2), etl::span<uint8_t>(output));
+      CHECK_EQUAL(sizeof(expected2), size);
+      CHECK_ARRAY_EQUAL(expected2, output, sizeof(expected2));
+
+      // 254 non-zero bytes fill a block with no zero after it.
+      uint8_t data3[255];
+      for (size_t i = 0U; i < 255U; ++i)
+      {
+        data3[i] = uint8_t(i + 1U);
+      }
+
+      size = etl::cobs_encoder<>::encode(etl::span<const uint8_t>(data3, 254U), etl::span<uint8_t>(output));
+      CHECK_EQUAL(256U, size);
+      CHECK_EQUAL(0xFFU, output[0]);
+      CHECK_ARRAY_EQUAL(data3, output + 1, 254U);
+      CHECK_EQUAL(0x00U, output[255]);
+
+      size = etl::cobs_encoder<>::encode(etl::span<const uint8_t>(data3, 255U), etl::span<uint8_t>(output));
+      CHECK_EQUAL(258U, size);
+      CHECK_EQUAL(0xFFU, output[0]);
+      CHECK_EQUAL(0x02U, output[255]);
+      CHECK_EQUAL(0xFFU, output[256]);
+      CHECK_EQUAL(0x00U, output[257]);
+      CHECK(size <= etl::cobs_encoder<>::max_encoded_size(255U));
+
+      std::vector<Bytes> frames;
+      etl::cobs_decoder<300> decoder;
+      CHECK_EQUAL(1U, decoder.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+      CHECK(Bytes(data3, data3 + 255) == frames[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_slip_known_vector)
+    {
+      uint8_t output[16];
+
+      const uint8_t data[] = { 0xC0, 0x01, 0xDB };
+      const uint8_t expected[] = { 0xC0, 0xDB, 0xDC, 0x01, 0xDB, 0xDD, 0xC0 };
+
+      size_t size = etl::slip_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      CHECK_EQUAL(sizeof(expected), size);
+      CHECK_ARRAY_EQUAL(expected, output, sizeof(expected));
+    }
+
+    //*************************************************************************
+    TEST(test_hdlc_known_vector)
+    {
+      uint8_t output[32];
+
+      // CRC16 X.25 of "123456789" is 0x906E, sent least significant byte first.
+      const uint8_t data[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+      const uint8_t expected[] = { 0x7E, '1', '2', '3', '4', '5', '6', '7', '8', '9', 0x6E, 0x90, 0x7E };
+
+      size_t size = etl::hdlc_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      CHECK_EQUAL(sizeof(expected), size);
+      CHECK_ARRAY_EQUAL(expected, output, sizeof(expected));
+
+      // Big endian.
+      size = etl::hdlc_encoder<etl::crc16_x25, etl::endian::big>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      CHECK_EQUAL(sizeof(expected), size);
+      CHECK_EQUAL(0x90U, output[10]);
+      CHECK_EQUAL(0x6EU, output[11]);
+
+      // Escaping.
+      const uint8_t data2[] = { 0x7E, 0x7D };
+      size = etl::hdlc_encoder<etl::framing_no_crc>::encode(etl::span<const uint8_t>(data2), etl::span<uint8_t>(output));
+      const uint8_t expected2[] = { 0x7E, 0x7D, 0x5E, 0x7D, 0x5D, 0x7E };
+      CHECK_EQUAL(sizeof(expected2), size);
+      CHECK_ARRAY_EQUAL(expected2, output, sizeof(expected2));
+    }
+
+    //*************************************************************************
+    TEST(test_round_trips)
+    {
+      const size_t chunks[] = { 1U, 3U, 64U, 100000U };
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        check_round_trip<etl::cobs_encoder<>, etl::cobs_decoder<600> >(chunks[i]);
+        check_round_trip<etl::cobs_encoder<etl::crc32>, etl::cobs_decoder<600, etl::crc32> >(chunks[i]);
+        check_round_trip<etl::cobs_encoder<etl::crc32, etl::endian::big>, etl::cobs_decoder<600, etl::crc32, etl::endian::big> >(chunks[i]);
+        check_round_trip<etl::slip_encoder<>, etl::slip_decoder<600> >(chunks[i]);
+        check_round_trip<etl::slip_encoder<etl::crc16_x25>, etl::slip_decoder<600, etl::crc16_x25> >(chunks[i]);
+        check_round_trip<etl::hdlc_encoder<>, etl::hdlc_decoder<600> >(chunks[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_incremental_encode)
+    {
+      const Bytes payload = make_payload(500U, 7U);
+
+      Bytes whole(etl::hdlc_encoder<>::max_encoded_size(payload.size()));
+      const size_t whole_size = etl::hdlc_encoder<>::encode(etl::span<const uint8_t>(payload.data(), payload.size()),
+                                                            etl::span<uint8_t>(whole.data(), whole.size()));
+
+      Bytes parts(whole.size());
+      etl::hdlc_encoder<> encoder(etl::span<uint8_t>(parts.data(), parts.size()));
+
+      for (size_t i = 0U; i < payload.size(); i += 13U)
+      {
+        encoder.add(etl::span<const uint8_t>(payload.data() + i, std::min(size_t(13U), payload.size() - i)));
+      }
+
+      CHECK_EQUAL(whole_size, encoder.finish());
+      CHECK(whole == parts);
+
+      Bytes cobs_whole(etl::cobs_encoder<etl::crc32>::max_encoded_size(payload.size()));
+      const size_t cobs_size = etl::cobs_encoder<etl::crc32>::encode(etl::span<const uint8_t>(payload.data(), payload.size()),
+                                                                     etl::span<uint8_t>(cobs_whole.data(), cobs_whole.size()));
+
+      Bytes cobs_parts(cobs_whole.size());
+      etl::cobs_encoder<etl::crc32> cobs(etl::span<uint8_t>(cobs_parts.data(), cobs_parts.size()));
+
+      for (size_t i = 0U; i < payload.size(); i += 254U)
+      {
+        cobs.add(etl::span<const uint8_t>(payload.data() + i, std::min(size_t(254U), payload.size() - i)));
+      }
+
+      CHECK_EQUAL(cobs_size, cobs.finish());
+      CHECK(cobs_whole == cobs_parts);
+    }
+
+    //*************************************************************************
+    TEST(test_crc_error)
+    {
+      const uint8_t data[] = { 1, 2, 3, 4, 5 };
+      uint8_t output[32];
+
+      size_t size = etl::hdlc_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      output[3] ^= 0x01U;
+
+      std::vector<Bytes> frames;
+      etl::hdlc_decoder<16> decoder;
+      CHECK_EQUAL(0U, decoder.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+      CHECK_EQUAL(1U, decoder.crc_error_count());
+
+      output[3] ^= 0x01U;
+      CHECK_EQUAL(1U, decoder.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+      CHECK_EQUAL(1U, frames.size());
+
+      size = etl::cobs_encoder<etl::crc32>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      output[2] ^= 0x80U;
+
+      etl::cobs_decoder<16, etl::crc32> cobs;
+      CHECK_EQUAL(0U, cobs.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+      CHECK_EQUAL(1U, cobs.crc_error_count());
+    }
+
+    //*************************************************************************
+    TEST(test_decoder_overflow_and_abort)
+    {
+      const Bytes payload = make_payload(40U, 3U);
+      uint8_t output[128];
+
+      size_t size = etl::slip_encoder<>::encode(etl::span<const uint8_t>(payload.data(), payload.size()), etl::span<uint8_t>(output));
+
+      std::vector<Bytes> frames;
+      etl::slip_decoder<32> small;
+      CHECK_EQUAL(0U, small.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+      CHECK_EQUAL(1U, small.framing_error_count());
+
+      // The decoder recovers at the next frame.
+      const uint8_t data[] = { 9, 8, 7 };
+      size = etl::slip_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output));
+      CHECK_EQUAL(1U, small.decode(etl::span<const uint8_t>(output, size), Collector(frames)));
+
+      // An escape followed by a flag aborts an HDLC frame.
+      etl::hdlc_decoder<32> hdlc;
+      const uint8_t aborted[] = { 0x7E, 0x01, 0x02, 0x7D, 0x7E };
+      CHECK_EQUAL(0U, hdlc.decode(etl::span<const uint8_t>(aborted), Collector(frames)));
+      CHECK_EQUAL(1U, hdlc.framing_error_count());
+
+      // A COBS delimiter inside a block truncates the frame.
+      etl::cobs_decoder<32> cobs;
+      const uint8_t truncated[] = { 0x05, 0x01, 0x02, 0x00, 0x02, 0x03, 0x00 };
+      CHECK_EQUAL(1U, cobs.decode(etl::span<const uint8_t>(truncated), Collector(frames)));
+      CHECK_EQUAL(1U, cobs.framing_error_count());
+      CHECK(Bytes(1U, 0x03U) == frames.back());
+    }
+
+    //*************************************************************************
+    TEST(test_encoder_overflow)
+    {
+      const uint8_t data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      uint8_t output[6];
+
+      CHECK_THROW(etl::slip_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output)), etl::framing_overflow);
+      CHECK_THROW(etl::cobs_encoder<>::encode(etl::span<const uint8_t>(data), etl::span<uint8_t>(output)), etl::framing_overflow);
+    }
+
+    //*************************************************************************
+    TEST(test_byte_stream)
+    {
+      const uint8_t data[] = { 0x7E, 0x10, 0x7D, 0x20 };
+      char buffer[64];
+
+      etl::byte_stream_writer writer(buffer, sizeof(buffer), etl::endian::little);
+      size_t size1 = etl::hdlc_encoder<>::encode(etl::span<const uint8_t>(data), writer);
+      size_t size2 = etl::hdlc_encoder<>::encode(etl::span<const uint8_t>(data, 2U), writer);
+      CHECK_EQUAL(size1 + size2, writer.size_bytes());
+
+      std::vector<Bytes> frames;
+      etl::byte_stream_reader reader(buffer, writer.size_bytes(), etl::endian::little);
+      etl::hdlc_decoder<16> decoder;
+      CHECK_EQUAL(2U, decoder.decode(reader, Collector(frames)));
+      CHECK_EQUAL(0U, reader.available_bytes());
+      CHECK(Bytes(data, data + 4) == frames[0]);
+      CHECK(Bytes(data, data + 2) == frames[1]);
+    }
+  }
+}
@@ -0,0 +1,340 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <map>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "etl/frozen_flat_map.h"
+
+namespace
+{
+  SUITE(test_frozen_flat_map)
+  {
+    static const size_t SIZE = 20;
+
+    typedef etl::frozen_flat_map<int, std::string, SIZE> Data;
+    typedef etl::ifrozen_flat_map<int, std::string>      IData;
+
+    typedef std::map<int, std::string> Compare_Data;
+
+    //*************************************************************************
+    std::vector<std::pair<int, std::string> > make_data(int count)
+    {
+      std::vector<std::pair<int, std::string> > data;
+
+      for (int i = 0; i < count; ++i)
+      {
+        data.push_back(std::make_pair(i * 2, std::to_string(i * 2)));
+      }
+
+      std::shuffle(data.begin(), data.end(), std::mt19937(count));
+
+      return data;
+    }
+
+    //*************************************************************************
+    template <typename TMap>
+    bool Check_Equal(const TMap& data, const Compare_Data& compare)
+    {
+      if (data.size() != compare.size())
+      {
+        return false;
+      }
+
+      typename TMap::const_iterator itr = data.begin();
+
+      for (Compare_Data::const_iterator c = compare.begin(); c != compare.end(); ++c, ++itr)
+      {
+        if ((itr->first != c->first) || (itr->second != c->second))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+      CHECK(data.lower_bound(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+      CHECK(std::is_sorted(data.keys(), data.keys() + data.size()));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { { 3, "C" }, { 1, "A" }, { 2, "B" }, { 1, "Z" } };
+
+      // The first of a duplicated key is kept.
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL("A", data.at(1));
+      CHECK_EQUAL("B", data.at(2));
+      CHECK_EQUAL("C", data.at(3));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_constructor_excess)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE) + 1);
+
+      CHECK_THROW(Data(initial_data.begin(), initial_data.end()), etl::frozen_flat_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_assignment)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      Data data2(data);
+
+      CHECK(data2 == data);
+
+      Data data3;
+      IData& idata3 = data3;
+      idata3 = data;
+
+      CHECK(data3 == data);
+
+      data3.at(0) = "Changed";
+
+      CHECK(data3 != data);
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      CHECK_EQUAL("10", data.at(10));
+      CHECK_EQUAL("10", cdata.at(10));
+      CHECK_THROW(data.at(11), etl::frozen_flat_map_out_of_bounds);
+      CHECK_THROW(cdata.at(-1), etl::frozen_flat_map_out_of_bounds);
+
+      data.at(10) = "Ten";
+
+      CHECK_EQUAL("Ten", cdata.at(10));
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_contains)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      const Data& cdata = data;
+
+      for (int i = -1; i < int(SIZE * 2U) + 1; ++i)
+      {
+        const bool exists = (i >= 0) && ((i % 2) == 0) && (i < int(SIZE * 2U));
+
+        CHECK_EQUAL(exists, data.find(i) != data.end());
+        CHECK_EQUAL(exists, cdata.find(i) != cdata.end());
+        CHECK_EQUAL(exists ? 1U : 0U, data.count(i));
+        CHECK_EQUAL(exists, data.contains(i));
+
+        if (exists)
+        {
+          CHECK_EQUAL(i, data.find(i)->first);
+          CHECK_EQUAL(std::to_string(i), cdata.find(i)->second);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_bounds_and_equal_range)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      for (int i = -1; i < int(SIZE * 2U) + 1; ++i)
+      {
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(i)), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(i)), std::distance(data.begin(), data.upper_bound(i)));
+
+        ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = static_cast<const Data&>(data).equal_range(i);
+
+        CHECK_EQUAL(compare.count(i), size_t(std::distance(range.first, range.second)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      Compare_Data compare(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(ptrdiff_t(SIZE), data.end() - data.begin());
+      CHECK_EQUAL(4, data.begin()[2].first);
+      CHECK_EQUAL(4, (data.begin() + 2)->first);
+
+      Compare_Data::const_reverse_iterator c = compare.rbegin();
+
+      for (Data::const_reverse_iterator itr = data.crbegin(); itr != data.crend(); ++itr, ++c)
+      {
+        CHECK_EQUAL(c->first, (*itr).first);
+      }
+
+      for (Data::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        itr->second += "!";
+      }
+
+      CHECK_EQUAL("0!", data.at(0));
+      CHECK_EQUAL(std::string("38!"), data.values()[SIZE - 1U]);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_assign)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+
+      data.clear();
+
+      CHECK(data.empty());
+
+      data.assign(initial_data.begin(), initial_data.begin() + 5);
+
+      CHECK_EQUAL(5U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_key_compare_greater)
+    {
+      std::vector<std::pair<int, std::string> > initial_data = make_data(int(SIZE));
+
+      etl::frozen_flat_map<int, std::string, SIZE, etl::greater<int> > data(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(38, data.begin()->first);
+      CHECK_EQUAL(10, data.lower_bound(11)->first);
+      CHECK_EQUAL(8,  data.upper_bound(10)->first);
+      CHECK_EQUAL("20", data.at(20));
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      etl::frozen_flat_map<std::string, int, SIZE, etl::less<> > data = { { "B", 2 }, { "A", 1 } };
+
+      CHECK_EQUAL(2, data.find("B")->second);
+      CHECK_EQUAL(1, data.at("A"));
+      CHECK(data.contains("A"));
+      CHECK_EQUAL(1U, data.count("B"));
+      CHECK(data.lower_bound("AA") == data.find("B"));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_random_lookups)
+    {
+      static const size_t Max = 257U;
+
+      std::mt19937 generator(2);
+      std::uniform_int_distribution<int> key_distribution(0, 1000);
+
+      // Every size up to the capacity.
+      for (size_t n = 0U; n <= Max; ++n)
+      {
+        std::vector<std::pair<int, int> > initial_data;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          initial_data.push_back(std::make_pair(key_distribution(generator), int(i)));
+        }
+
+        etl::frozen_flat_map<int, int, Max> data(initial_data.begin(), initial_data.end());
+        std::map<int, int> compare;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          compare.insert(initial_data[i]);
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+
+        for (int key = -1; key <= 1001; key += 7)
+        {
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+
+          std::map<int, int>::const_iterator c = compare.find(key);
+
+          if (c == compare.end())
+          {
+            CHECK(data.find(key) == data.end());
+          }
+          else
+          {
+            CHECK_EQUAL(c->second, data.at(key));
+          }
+        }
+      }
+    }
+  };
+}
@@ -0,0 +1,199 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+
+#include "etl/frozen_flat_set.h"
+
+namespace
+{
+  SUITE(test_frozen_flat_set)
+  {
+    static const size_t SIZE = 20;
+
+    typedef etl::frozen_flat_set<int, SIZE> Data;
+    typedef etl::ifrozen_flat_set<int>      IData;
+
+    //*************************************************************************
+    std::vector<int> make_data(int count)
+    {
+      std::vector<int> data;
+
+      for (int i = 0; i < count; ++i)
+      {
+        data.push_back(i * 2);
+      }
+
+      std::shuffle(data.begin(), data.end(), std::mt19937(count));
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(data.find(0) == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<int> initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      std::set<int> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+      CHECK(data.data() == data.begin());
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      Data data = { 3, 1, 2, 1 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1, data.begin()[0]);
+      CHECK_EQUAL(2, data.begin()[1]);
+      CHECK_EQUAL(3, data.begin()[2]);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_constructor_excess)
+    {
+      std::vector<int> initial_data = make_data(int(SIZE) + 1);
+
+      CHECK_THROW(Data(initial_data.begin(), initial_data.end()), etl::frozen_flat_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_assignment)
+    {
+      std::vector<int> initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      Data data2(data);
+
+      CHECK(data2 == data);
+
+      Data data3;
+      IData& idata3 = data3;
+      idata3 = data;
+
+      CHECK(data3 == data);
+
+      data3.assign(initial_data.begin(), initial_data.begin() + 3);
+
+      CHECK(data3 != data);
+    }
+
+    //*************************************************************************
+    TEST(test_lookups)
+    {
+      std::vector<int> initial_data = make_data(int(SIZE));
+
+      Data data(initial_data.begin(), initial_data.end());
+      std::set<int> compare(initial_data.begin(), initial_data.end());
+
+      for (int i = -1; i < int(SIZE * 2U) + 1; ++i)
+      {
+        CHECK_EQUAL(compare.count(i), data.count(i));
+        CHECK_EQUAL(compare.count(i) == 1U, data.contains(i));
+        CHECK_EQUAL(compare.count(i) == 1U, data.find(i) != data.end());
+        CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(i)), std::distance(data.begin(), data.lower_bound(i)));
+        CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(i)), std::distance(data.begin(), data.upper_bound(i)));
+
+        ETL_OR_STD::pair<Data::const_iterator, Data::const_iterator> range = data.equal_range(i);
+
+        CHECK_EQUAL(compare.count(i), size_t(std::distance(range.first, range.second)));
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_transparent_comparator)
+    {
+      etl::frozen_flat_set<std::string, SIZE, etl::less<> > data = { "B", "A" };
+
+      CHECK(data.contains("A"));
+      CHECK_EQUAL(1U, data.count("B"));
+      CHECK(data.find("C") == data.end());
+      CHECK(data.lower_bound("AA") == data.find("B"));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_random_lookups)
+    {
+      static const size_t Max = 100U;
+
+      std::mt19937 generator(3);
+      std::uniform_int_distribution<int> key_distribution(0, 300);
+
+      for (size_t n = 0U; n <= Max; ++n)
+      {
+        std::vector<int> initial_data;
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          initial_data.push_back(key_distribution(generator));
+        }
+
+        etl::frozen_flat_set<int, Max> data(initial_data.begin(), initial_data.end());
+        std::set<int> compare(initial_data.begin(), initial_data.end());
+
+        CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+        for (int key = -1; key <= 301; ++key)
+        {
+          CHECK_EQUAL(std::distance(compare.begin(), compare.lower_bound(key)), std::distance(data.begin(), data.lower_bound(key)));
+          CHECK_EQUAL(std::distance(compare.begin(), compare.upper_bound(key)), std::distance(data.begin(), data.upper_bound(key)));
+        }
+      }
+    }
+  };
+}
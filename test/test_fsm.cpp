@@ -362,6 +362,62 @@ namespace
 
   MotorControl motorControl;
 
+  //***************************************************************************
+  // An FSM with widely spaced message ids.
+  //***************************************************************************
+  class SparseLow    : public etl::message<2>   {};
+  class SparseMiddle : public etl::message<100> {};
+  class SparseHigh   : public etl::message<250> {};
+  class SparseOther  : public etl::message<101> {};
+
+  class SparseControl : public etl::fsm
+  {
+  public:
+
+    SparseControl()
+      : fsm(Motor_Control)
+      , low(0)
+      , middle(0)
+      , high(0)
+      , unknown(0)
+    {
+    }
+
+    int low;
+    int middle;
+    int high;
+    int unknown;
+  };
+
+  class SparseState : public etl::fsm_state<SparseControl, SparseState, 0, SparseHigh, SparseLow, SparseMiddle>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const SparseLow&)
+    {
+      ++get_fsm_context().low;
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event(const SparseMiddle&)
+    {
+      ++get_fsm_context().middle;
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event(const SparseHigh&)
+    {
+      ++get_fsm_context().high;
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      ++get_fsm_context().unknown;
+      return No_State_Change;
+    }
+  };
+
   SUITE(test_fsm_states)
   {
     //*************************************************************************
@@ -648,6 +704,33 @@ namespace
       CHECK_THROW(mc.set_states(stateList, StateId::Number_Of_States), etl::fsm_state_list_order_exception);
     }
 
+#if ETL_USING_CPP17 && !defined(ETL_FSM_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_fsm_state_pack)
+    {
+      // The count, ids and order are checked at compile time.
+      // Listing the states out of order would fail to compile.
+      etl::fsm_state_pack states(idle, running, windingDown, locked);
+
+      CHECK_EQUAL(4U, states.size());
+      CHECK_TRUE(states.get_states()[StateId::Running] == &running);
+
+      MotorControl mc;
+      mc.set_states(states);
+      mc.ClearStatistics();
+
+      mc.start(false);
+      CHECK_EQUAL(StateId::Idle, int(mc.get_state_id()));
+
+      mc.receive(Start());
+      CHECK_EQUAL(StateId::Running, int(mc.get_state_id()));
+      CHECK_EQUAL(1, mc.startCount);
+
+      mc.receive(Stop());
+      CHECK_EQUAL(StateId::Winding_Down, int(mc.get_state_id()));
+    }
+#endif
+
     //*************************************************************************
     TEST(test_fsm_self_transition)
     {
@@ -672,5 +755,29 @@ namespace
       CHECK_TRUE(motorControl.exited_state);
       CHECK_TRUE(motorControl.entered_state);
     }
+
+    //*************************************************************************
+    TEST(test_fsm_sparse_message_ids)
+    {
+      SparseControl control;
+      SparseState   state;
+
+      etl::ifsm_state* sparseStateList[] = { &state };
+
+      control.set_states(sparseStateList, 1U);
+      control.start(false);
+
+      control.receive(SparseHigh());
+      control.receive(SparseLow());
+      control.receive(SparseOther());
+      control.receive(SparseMiddle());
+      control.receive(SparseLow());
+      control.receive(Start());
+
+      CHECK_EQUAL(2, control.low);
+      CHECK_EQUAL(1, control.middle);
+      CHECK_EQUAL(1, control.high);
+      CHECK_EQUAL(2, control.unknown);
+    }
   };
 }
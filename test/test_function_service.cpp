@@ -0,0 +1,154 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/function_service.h"
+
+namespace
+{
+  size_t called_id;
+  int    called_function;
+
+  void function_a(size_t id)
+  {
+    called_id       = id;
+    called_function = 1;
+  }
+
+  void function_b(size_t id)
+  {
+    called_id       = id;
+    called_function = 2;
+  }
+
+  void unhandled(size_t id)
+  {
+    called_id       = id;
+    called_function = -1;
+  }
+
+  void reset()
+  {
+    called_id       = 0U;
+    called_function = 0;
+  }
+
+  constexpr size_t Offset = 5U;
+  constexpr size_t Range  = 4U;
+
+  typedef etl::function_service<Offset, Range, unhandled,
+                                etl::function_service_entry<8U, function_b>,
+                                etl::function_service_entry<5U, function_a>,
+                                etl::function_service_entry<6U, function_b>> Service;
+
+  typedef etl::function_service<Offset, Range, nullptr,
+                                etl::function_service_entry<7U, function_a>> Ignoring_Service;
+
+  // The table is available at compile time.
+  ETL_STATIC_ASSERT(Service::get_function<5U>() == &function_a, "Wrong function");
+  ETL_STATIC_ASSERT(Service::get_function<6U>() == &function_b, "Wrong function");
+  ETL_STATIC_ASSERT(Service::get_function<7U>() == &unhandled,  "Wrong function");
+  ETL_STATIC_ASSERT(Service::get_function<8U>() == &function_b, "Wrong function");
+
+  SUITE(test_function_service)
+  {
+    //*************************************************************************
+    TEST(test_compile_time_call)
+    {
+      reset();
+      Service::call<5U>();
+      CHECK_EQUAL(5U, called_id);
+      CHECK_EQUAL(1,  called_function);
+
+      Service::call<8U>();
+      CHECK_EQUAL(8U, called_id);
+      CHECK_EQUAL(2,  called_function);
+
+      Service::call<7U>();
+      CHECK_EQUAL(7U, called_id);
+      CHECK_EQUAL(-1, called_function);
+    }
+
+    //*************************************************************************
+    TEST(test_run_time_call)
+    {
+      const int expected[] = { -1, -1, 1, 2, -1, 2, -1, -1 };
+
+      for (size_t id = 3U; id < 11U; ++id)
+      {
+        reset();
+        Service::call(id);
+
+        CHECK_EQUAL(id, called_id);
+        CHECK_EQUAL(expected[id - 3U], called_function);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_handler)
+    {
+      // A parameterless handler, as used in a vector table.
+      void (*vector[])() = { &Service::handler<5U>, &Service::handler<6U> };
+
+      reset();
+      vector[1]();
+      CHECK_EQUAL(6U, called_id);
+      CHECK_EQUAL(2,  called_function);
+
+      vector[0]();
+      CHECK_EQUAL(5U, called_id);
+      CHECK_EQUAL(1,  called_function);
+    }
+
+    //*************************************************************************
+    TEST(test_table)
+    {
+      const Service::function_type* table = Service::get_table();
+
+      CHECK_TRUE(table[0] == &function_a);
+      CHECK_TRUE(table[1] == &function_b);
+      CHECK_TRUE(table[2] == &unhandled);
+      CHECK_TRUE(table[3] == &function_b);
+    }
+
+    //*************************************************************************
+    TEST(test_unhandled_ignored_by_default)
+    {
+      reset();
+      Ignoring_Service::call(6U);
+      Ignoring_Service::call(100U);
+      Ignoring_Service::call<8U>();
+      CHECK_EQUAL(0, called_function);
+
+      Ignoring_Service::call(7U);
+      CHECK_EQUAL(7U, called_id);
+      CHECK_EQUAL(1,  called_function);
+    }
+  }
+}
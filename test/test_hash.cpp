@@ -29,6 +29,7 @@ SOFTWARE.
 #include "unit_test_framework.h"
 
 #include <type_traits>
+#include <algorithm>
 #include <iterator>
 #include <string>
 #include <vector>
@@ -36,6 +37,8 @@ SOFTWARE.
 
 #include "etl/hash.h"
 
+#include "murmurhash3.h" // The 'C' reference implementation.
+
 // for testing user-defined hash specializations
 namespace { class CustomType{}; }
 namespace etl
@@ -138,7 +141,7 @@ namespace
     {
       size_t hash = etl::hash<long long>()(0x5AA555AA3CC333CCLL);
 
-      if (ETL_PLATFORM_32BIT)
+      if (ETL_PLATFORM_32BIT && !ETL_USING_WORD_HASH)
       {
         CHECK_EQUAL(0xEC6A8D69UL, hash);
       }
@@ -154,7 +157,7 @@ namespace
     {
       size_t hash = etl::hash<unsigned long long>()(0x5AA555AA3CC333CCULL);
 
-      if (ETL_PLATFORM_32BIT)
+      if (ETL_PLATFORM_32BIT && !ETL_USING_WORD_HASH)
       {
         CHECK_EQUAL(0xEC6A8D69UL, hash);
       }
@@ -175,7 +178,7 @@ namespace
         CHECK_EQUAL(0X3F9E0419U, hash);
       }
 
-      if (ETL_PLATFORM_64BIT)
+      if (ETL_PLATFORM_64BIT && !ETL_USING_WORD_HASH)
       {
         CHECK_EQUAL(9821047038287739023U, hash);
       }
@@ -186,7 +189,7 @@ namespace
     {
       size_t hash = etl::hash<double>()(1.2345);
 
-      if (ETL_PLATFORM_32BIT)
+      if (ETL_PLATFORM_32BIT && !ETL_USING_WORD_HASH)
       {
         CHECK_EQUAL(0x86FBF224UL, hash);
       }
@@ -309,6 +312,100 @@ namespace
         CHECK_TRUE(std::is_copy_assignable<custom_hasher>::value);
         CHECK_TRUE(std::is_move_assignable<custom_hasher>::value);
     }
+    //*************************************************************************
+    TEST(test_word_hash_32)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        data.push_back(uint8_t((i * 37U) + 11U));
+      }
+
+      const uint16_t endian_check = 0x0001U;
+      const bool is_little_endian = (*reinterpret_cast<const uint8_t*>(&endian_check) == 0x01U);
+
+      for (size_t length = 0U; length <= data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* end   = begin + length;
+
+        uint32_t hash = etl::private_hash::word_hash_32(begin, end);
+
+        if (is_little_endian)
+        {
+          uint32_t compare;
+          MurmurHash3_x86_32(begin, int(length), 0, &compare);
+
+          CHECK_EQUAL(compare, hash);
+        }
+
+        CHECK_EQUAL(hash, etl::private_hash::word_hash_32(begin, end));
+      }
+    }
+
+#if ETL_USING_64BIT_TYPES
+    //*************************************************************************
+    TEST(test_word_hash_64_is_wyhash)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        data.push_back(uint8_t((i * 37U) + 11U));
+      }
+
+      for (size_t length = 0U; length <= data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+
+        CHECK_EQUAL(etl::wyhash_64(begin, length), etl::private_hash::word_hash_64(begin, begin + length));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_word_hash_64)
+    {
+      std::vector<uint8_t> data;
+
+      for (size_t i = 0U; i < 300U; ++i)
+      {
+        data.push_back(uint8_t((i * 37U) + 11U));
+      }
+
+      std::vector<uint64_t> hashes;
+
+      // Every length is read with a different mix of overlapping words and tails.
+      for (size_t length = 0U; length <= data.size(); ++length)
+      {
+        const uint8_t* begin = data.data();
+        const uint8_t* end   = begin + length;
+
+        uint64_t hash = etl::private_hash::word_hash_64(begin, end);
+
+        CHECK_EQUAL(hash, etl::private_hash::word_hash_64(begin, end));
+
+        hashes.push_back(hash);
+      }
+
+      std::sort(hashes.begin(), hashes.end());
+      CHECK(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+
+      // Every bit of the key affects the hash.
+      for (size_t length = 1U; length <= 100U; ++length)
+      {
+        std::vector<uint8_t> key(data.begin(), data.begin() + length);
+
+        const uint64_t hash = etl::private_hash::word_hash_64(key.data(), key.data() + length);
+
+        for (size_t bit = 0U; bit < (length * 8U); ++bit)
+        {
+          key[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+          CHECK(hash != etl::private_hash::word_hash_64(key.data(), key.data() + length));
+          key[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+        }
+      }
+    }
+#endif
   };
 }
-
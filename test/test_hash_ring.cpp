@@ -0,0 +1,294 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/hash_ring.h"
+
+#include <stdint.h>
+
+namespace
+{
+  typedef etl::hash_ring<8, 64> Ring;
+
+  SUITE(test_hash_ring)
+  {
+    //*************************************************************************
+    TEST(test_jump_consistent_hash_range)
+    {
+      for (uint64_t key = 0U; key < 1000U; ++key)
+      {
+        CHECK_EQUAL(0U, etl::jump_consistent_hash(key, 1U));
+        CHECK(etl::jump_consistent_hash(key, 10U) < 10U);
+      }
+
+      CHECK_EQUAL(0U, etl::jump_consistent_hash(12345U, 0U));
+    }
+
+    //*************************************************************************
+    TEST(test_jump_consistent_hash_minimal_movement)
+    {
+      for (uint32_t buckets = 1U; buckets < 20U; ++buckets)
+      {
+        size_t moved = 0U;
+
+        for (uint64_t key = 0U; key < 2000U; ++key)
+        {
+          const uint64_t hashed = key * 0x9E3779B97F4A7C15ULL;
+
+          uint32_t before = etl::jump_consistent_hash(hashed, buckets);
+          uint32_t after  = etl::jump_consistent_hash(hashed, buckets + 1U);
+
+          // Keys either stay or move to the new bucket.
+          if (before != after)
+          {
+            CHECK_EQUAL(buckets, after);
+            ++moved;
+          }
+        }
+
+        // Roughly 1/(n + 1) of the keys move.
+        const size_t expected = 2000U / (buckets + 1U);
+        CHECK(moved > (expected / 2U));
+        CHECK(moved < (expected * 2U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_jump_consistent_hash_balance)
+    {
+      size_t counts[4] = { 0U, 0U, 0U, 0U };
+
+      for (uint64_t key = 0U; key < 4000U; ++key)
+      {
+        ++counts[etl::jump_consistent_hash(key * 0x9E3779B97F4A7C15ULL, 4U)];
+      }
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(counts[i] > 800U);
+        CHECK(counts[i] < 1200U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Ring ring;
+
+      CHECK(ring.empty());
+      CHECK(!ring.full());
+      CHECK_EQUAL(0U, ring.size());
+      CHECK_EQUAL(0U, ring.point_count());
+      CHECK_EQUAL(8U, ring.max_size());
+      CHECK_EQUAL(512U, Ring::Max_Points);
+    }
+
+    //*************************************************************************
+    TEST(test_add_remove_contains)
+    {
+      Ring ring;
+
+      CHECK(ring.add(10U));
+      CHECK(ring.add(20U));
+      CHECK(!ring.add(10U));
+
+      CHECK_EQUAL(2U, ring.size());
+      CHECK_EQUAL(128U, ring.point_count());
+      CHECK(ring.contains(10U));
+      CHECK(ring.contains(20U));
+      CHECK(!ring.contains(30U));
+      CHECK_EQUAL(10U, ring.node(0));
+      CHECK_EQUAL(20U, ring.node(1));
+
+      CHECK(ring.remove(10U));
+      CHECK(!ring.remove(10U));
+      CHECK_EQUAL(1U, ring.size());
+      CHECK(!ring.contains(10U));
+      CHECK_EQUAL(20U, ring.node(0));
+
+      ring.clear();
+      CHECK(ring.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Ring ring;
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK(ring.add(i));
+      }
+
+      CHECK(ring.full());
+      CHECK_THROW(ring.add(100U), etl::hash_ring_full);
+    }
+
+    //*************************************************************************
+    TEST(test_get_empty)
+    {
+      Ring ring;
+
+      CHECK_THROW(ring.get(1), etl::hash_ring_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_get_single_node)
+    {
+      Ring ring;
+      ring.add(7U);
+
+      for (int key = 0; key < 100; ++key)
+      {
+        CHECK_EQUAL(7U, ring.get(key));
+      }
+
+      CHECK_EQUAL(7U, ring.get_from_hash(0U));
+      CHECK_EQUAL(7U, ring.get_from_hash(0xFFFFFFFFUL));
+    }
+
+    //*************************************************************************
+    TEST(test_order_independent)
+    {
+      Ring ring1;
+      Ring ring2;
+
+      for (uint32_t i = 0U; i < 5U; ++i)
+      {
+        ring1.add(i);
+        ring2.add(4U - i);
+      }
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        CHECK_EQUAL(ring1.get(key), ring2.get(key));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_balance)
+    {
+      Ring ring;
+
+      for (uint32_t i = 0U; i < 4U; ++i)
+      {
+        ring.add(i);
+      }
+
+      size_t counts[4] = { 0U, 0U, 0U, 0U };
+
+      for (int key = 0; key < 4000; ++key)
+      {
+        ++counts[ring.get(key)];
+      }
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(counts[i] > 500U);
+        CHECK(counts[i] < 1500U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_moves_keys_only_to_new_node)
+    {
+      Ring ring;
+
+      for (uint32_t i = 0U; i < 4U; ++i)
+      {
+        ring.add(i);
+      }
+
+      uint32_t before[1000];
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        before[key] = ring.get(key);
+      }
+
+      ring.add(4U);
+
+      size_t moved = 0U;
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        if (ring.get(key) != before[key])
+        {
+          CHECK_EQUAL(4U, ring.get(key));
+          ++moved;
+        }
+      }
+
+      CHECK(moved > 0U);
+      CHECK(moved < 400U);
+    }
+
+    //*************************************************************************
+    TEST(test_remove_moves_only_keys_of_removed_node)
+    {
+      Ring ring;
+
+      for (uint32_t i = 0U; i < 5U; ++i)
+      {
+        ring.add(i);
+      }
+
+      uint32_t before[1000];
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        before[key] = ring.get(key);
+      }
+
+      ring.remove(2U);
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        if (before[key] != 2U)
+        {
+          CHECK_EQUAL(before[key], ring.get(key));
+        }
+        else
+        {
+          CHECK(ring.get(key) != 2U);
+        }
+      }
+
+      // Adding it back restores the original assignment.
+      ring.add(2U);
+
+      for (int key = 0; key < 1000; ++key)
+      {
+        CHECK_EQUAL(before[key], ring.get(key));
+      }
+    }
+  }
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/hazard_pointer.h"
+#include "etl/pool.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  int destroyed = 0;
+
+  //*************************************************************************
+  struct Node
+  {
+    Node(int value_)
+      : value(value_)
+      , next(nullptr)
+    {
+    }
+
+    ~Node()
+    {
+      value = -1;
+      ++destroyed;
+    }
+
+    int   value;
+    Node* next;
+  };
+
+  typedef etl::hazard_pointer_domain<2U, 2U> Domain;
+
+  SUITE(test_hazard_pointer)
+  {
+    //*************************************************************************
+    TEST(test_acquire_release_slots)
+    {
+      etl::pool<Node, 4U> pool;
+      Domain domain(pool);
+
+      Domain::slot_type slot1 = domain.acquire_slot();
+      Domain::slot_type slot2 = domain.acquire_slot();
+
+      CHECK(slot1 != Domain::No_Slot);
+      CHECK(slot2 != Domain::No_Slot);
+      CHECK(slot1 != slot2);
+      CHECK_EQUAL(Domain::No_Slot, domain.acquire_slot());
+
+      domain.release_slot(slot1);
+      CHECK_EQUAL(slot1, domain.acquire_slot());
+    }
+
+    //*************************************************************************
+    TEST(test_protected_node_is_not_destroyed)
+    {
+      etl::pool<Node, 4U> pool;
+      Domain domain(pool);
+
+      destroyed = 0;
+
+      etl::atomic<Node*> head(pool.create(1));
+
+      Domain::slot_type reader = domain.acquire_slot();
+      Domain::slot_type writer = domain.acquire_slot();
+
+      Node* p_read = domain.protect(reader, 0U, head);
+      CHECK_EQUAL(1, p_read->value);
+
+      // Unlink and retire.
+      Node* p_old = head.exchange(nullptr);
+      domain.retire(writer, p_old);
+
+      CHECK_EQUAL(0U, domain.scan(writer));
+      CHECK_EQUAL(1U, domain.retired_size(writer));
+      CHECK_EQUAL(0, destroyed);
+      CHECK_EQUAL(1, p_read->value);
+
+      domain.clear(reader, 0U);
+
+      CHECK_EQUAL(1U, domain.scan(writer));
+      CHECK_EQUAL(0U, domain.retired_size(writer));
+      CHECK_EQUAL(1, destroyed);
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_retire_scans_when_full)
+    {
+      etl::pool<Node, Domain::Retired + 1U> pool;
+      Domain domain(pool);
+
+      destroyed = 0;
+
+      Domain::slot_type slot = domain.acquire_slot();
+
+      for (size_t i = 0U; i < Domain::Retired; ++i)
+      {
+        domain.retire(slot, pool.create(int(i)));
+      }
+
+      // Nothing was hazardous, so the full list was reclaimed.
+      CHECK_EQUAL(int(Domain::Retired), destroyed);
+      CHECK_EQUAL(0U, domain.retired_size(slot));
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_reclaims)
+    {
+      etl::pool<Node, 4U> pool;
+
+      destroyed = 0;
+
+      {
+        Domain domain(pool);
+        Domain::slot_type slot = domain.acquire_slot();
+
+        domain.retire(slot, pool.create(1));
+        domain.retire(slot, pool.create(2));
+        CHECK_EQUAL(0, destroyed);
+      }
+
+      CHECK_EQUAL(2, destroyed);
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_readers_never_see_a_destroyed_node)
+    {
+      static const int Length = 2000;
+
+      typedef etl::hazard_pointer_domain<4U, 1U> ThreadDomain;
+
+      etl::pool<Node, 64U> pool;
+      ThreadDomain domain(pool);
+
+      etl::atomic<Node*> head(pool.create(0));
+      std::atomic<bool>  done(false);
+      std::atomic<bool>  failed(false);
+
+      std::vector<std::thread> readers;
+
+      for (int r = 0; r < 3; ++r)
+      {
+        readers.push_back(std::thread([&]()
+        {
+          ThreadDomain::slot_type slot = domain.acquire_slot();
+
+          while (!done)
+          {
+            Node* p = domain.protect(slot, 0U, head);
+
+            if ((p != nullptr) && (p->value < 0))
+            {
+              failed = true;
+            }
+
+            domain.clear(slot, 0U);
+          }
+
+          domain.release_slot(slot);
+        }));
+      }
+
+      ThreadDomain::slot_type writer = domain.acquire_slot();
+
+      for (int i = 1; i <= Length; ++i)
+      {
+        Node* p_new = nullptr;
+
+        while (p_new == nullptr)
+        {
+          p_new = pool.full() ? nullptr : pool.create(i);
+
+          if (p_new == nullptr)
+          {
+            domain.scan(writer);
+          }
+        }
+
+        Node* p_old = head.exchange(p_new);
+        domain.retire(writer, p_old);
+      }
+
+      done = true;
+
+      for (std::thread& reader : readers)
+      {
+        reader.join();
+      }
+
+      domain.retire(writer, head.exchange(nullptr));
+      domain.scan(writer);
+
+      CHECK(!failed);
+      CHECK_EQUAL(0U, domain.retired_size(writer));
+      CHECK_EQUAL(0U, pool.size());
+    }
+  };
+}
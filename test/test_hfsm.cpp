@@ -36,6 +36,7 @@ SOFTWARE.
 #include "etl/circular_buffer.h"
 
 #include <iostream>
+#include <vector>
 
 // This test implements the following state machine:
 //                +--------------------------------------------+
@@ -280,7 +281,7 @@ namespace
     etl::fsm_state_id_t on_enter_state()
     {
       auto& context = get_fsm_context();
-      context.stateEnterHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateEnterHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
       context.TurnRunningLampOff();
 
       return No_State_Change;
@@ -290,7 +291,7 @@ namespace
     void on_exit_state()
     {
       auto& context = get_fsm_context();
-      context.stateExitHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateExitHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
     }
   };
 
@@ -320,7 +321,7 @@ namespace
     etl::fsm_state_id_t on_enter_state()
     {
       auto& context = get_fsm_context();
-      context.stateEnterHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateEnterHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
       context.TurnRunningLampOn();
 
       return No_State_Change;
@@ -330,7 +331,7 @@ namespace
     void on_exit_state()
     {
       auto& context = get_fsm_context();
-      context.stateExitHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateExitHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
     }
   };
 
@@ -367,7 +368,7 @@ namespace
     etl::fsm_state_id_t on_enter_state()
     {
       auto& context = get_fsm_context();
-      context.stateEnterHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateEnterHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
       ++context.windUpStartCount;
       return No_State_Change;
     }
@@ -376,7 +377,7 @@ namespace
     void on_exit_state()
     {
       auto& context = get_fsm_context();
-      context.stateExitHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateExitHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
     }
   };
 
@@ -413,7 +414,7 @@ namespace
     void on_exit_state()
     {
       auto& context = get_fsm_context();
-      context.stateExitHistory.push(static_cast<StateId::enum_type>(get_state_id()));
+      context.stateExitHistory.push_back(static_cast<StateId::enum_type>(get_state_id()));
     }
   };
 
@@ -464,6 +465,13 @@ namespace
 
   MotorControl motorControl;
 
+  Start    start_event;
+  Stop     stop_event;
+  EStop    estop_event;
+  Stopped  stopped_event;
+  Timeout  timeout_event;
+  SetSpeed set_speed_event(100);
+
   SUITE(test_hfsm_states)
   {
     //*************************************************************************
@@ -978,5 +986,72 @@ namespace
       bool exitsCorrect = std::equal(motorControl.stateExitHistory.begin(), motorControl.stateExitHistory.end(), expectedExits.begin());
       CHECK(exitsCorrect);
     }
+
+    //*************************************************************************
+    // Runs a sequence of events, logging the exits, enters and resulting state.
+    std::vector<int> run_event_sequence()
+    {
+      std::vector<int> log;
+
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.start(false);
+
+      const etl::imessage* events[] = { &start_event, &timeout_event, &set_speed_event, &stop_event, &stopped_event,
+                                        &start_event, &estop_event, &start_event, &timeout_event, &stop_event,
+                                        &stopped_event, &start_event, &timeout_event, &estop_event, &start_event };
+
+      for (size_t i = 0U; i < ETL_OR_STD17::size(events); ++i)
+      {
+        motorControl.receive(*events[i]);
+
+        for (size_t j = 0U; j < motorControl.stateExitHistory.size(); ++j)
+        {
+          log.push_back(-1 - int(motorControl.stateExitHistory[j]));
+        }
+
+        for (size_t j = 0U; j < motorControl.stateEnterHistory.size(); ++j)
+        {
+          log.push_back(int(motorControl.stateEnterHistory[j]));
+        }
+
+        log.push_back(100 + int(motorControl.get_state_id()));
+
+        motorControl.stateExitHistory.clear();
+        motorControl.stateEnterHistory.clear();
+      }
+
+      return log;
+    }
+
+    //*************************************************************************
+    TEST(test_hfsm_transition_cache)
+    {
+      // The child states were added in test_hfsm.
+      motorControl.Initialise(stateList, ETL_OR_STD17::size(stateList));
+
+      std::vector<int> expected = run_event_sequence();
+
+      // A cache smaller than the number of transitions, so that entries are replaced.
+      etl::hfsm::transition_cache_entry small_cache[3];
+      motorControl.set_transition_cache(small_cache);
+
+      std::vector<int> first_pass  = run_event_sequence();
+      std::vector<int> second_pass = run_event_sequence();
+
+      CHECK_EQUAL(expected.size(), first_pass.size());
+      CHECK(expected == first_pass);
+      CHECK(expected == second_pass);
+
+      // A cache large enough for every source and target pair.
+      etl::hfsm::transition_cache_entry large_cache[StateId::Number_Of_States * StateId::Number_Of_States];
+      motorControl.set_transition_cache(large_cache);
+
+      CHECK(expected == run_event_sequence());
+      CHECK(expected == run_event_sequence());
+
+      motorControl.set_transition_cache(ETL_NULLPTR, 0U);
+      CHECK(expected == run_event_sequence());
+    }
   };
 }
@@ -0,0 +1,234 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/hierarchical_bitset.h"
+
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  // Finds the next bit in a state by linear search, for comparison.
+  template <typename TBitset>
+  size_t reference_find_next(const TBitset& bs, bool state, size_t position)
+  {
+    for (size_t i = position; i < bs.size(); ++i)
+    {
+      if (bs.test(i) == state)
+      {
+        return i;
+      }
+    }
+
+    return TBitset::npos;
+  }
+
+  //***************************************************************************
+  // Checks every find_next result against a linear search.
+  template <typename TBitset>
+  bool check_all_finds(const TBitset& bs)
+  {
+    for (int s = 0; s < 2; ++s)
+    {
+      bool state = (s == 1);
+
+      if (bs.find_first(state) != reference_find_next(bs, state, 0U))
+      {
+        return false;
+      }
+
+      for (size_t position = 0U; position <= bs.size(); ++position)
+      {
+        if (bs.find_next(state, position) != reference_find_next(bs, state, position))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_hierarchical_bitset)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::hierarchical_bitset<200> bs;
+
+      CHECK_EQUAL(200U, bs.size());
+      CHECK_EQUAL(0U, bs.count());
+      CHECK(bs.none());
+      CHECK(!bs.any());
+      CHECK(!bs.all());
+      CHECK_EQUAL(0U, bs.find_first(false));
+      CHECK_EQUAL(etl::hierarchical_bitset<200>::npos, bs.find_first(true));
+    }
+
+    //*************************************************************************
+    TEST(test_set_reset_flip)
+    {
+      etl::hierarchical_bitset<130> bs;
+
+      bs.set(0).set(64).set(129);
+      CHECK(bs.test(0));
+      CHECK(bs[64]);
+      CHECK(bs.test(129));
+      CHECK(!bs.test(1));
+      CHECK_EQUAL(3U, bs.count());
+
+      bs.reset(64);
+      CHECK(!bs.test(64));
+      CHECK_EQUAL(2U, bs.count());
+
+      bs.flip(64);
+      bs.flip(0);
+      CHECK(bs.test(64));
+      CHECK(!bs.test(0));
+      CHECK_EQUAL(2U, bs.count());
+
+      bs.set(129, false);
+      CHECK(!bs.test(129));
+      CHECK_EQUAL(1U, bs.count());
+    }
+
+    //*************************************************************************
+    TEST(test_set_all_reset_all_flip_all)
+    {
+      etl::hierarchical_bitset<100> bs;
+
+      bs.set();
+      CHECK(bs.all());
+      CHECK_EQUAL(100U, bs.count());
+      CHECK_EQUAL(etl::hierarchical_bitset<100>::npos, bs.find_first(false));
+      CHECK_EQUAL(0U, bs.find_first(true));
+
+      bs.reset(99);
+      CHECK(!bs.all());
+      CHECK_EQUAL(99U, bs.find_first(false));
+
+      bs.flip();
+      CHECK_EQUAL(1U, bs.count());
+      CHECK_EQUAL(99U, bs.find_first(true));
+      CHECK_EQUAL(0U, bs.find_first(false));
+
+      bs.reset();
+      CHECK(bs.none());
+      CHECK_EQUAL(0U, bs.count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_sparse)
+    {
+      etl::hierarchical_bitset<200000> bs;
+
+      CHECK_EQUAL(etl::hierarchical_bitset<200000>::npos, bs.find_first(true));
+
+      bs.set(5);
+      bs.set(70000);
+      bs.set(199999);
+
+      CHECK_EQUAL(5U, bs.find_first(true));
+      CHECK_EQUAL(5U, bs.find_next(true, 5));
+      CHECK_EQUAL(70000U, bs.find_next(true, 6));
+      CHECK_EQUAL(199999U, bs.find_next(true, 70001));
+      CHECK_EQUAL(etl::hierarchical_bitset<200000>::npos, bs.find_next(true, 200000));
+      CHECK_EQUAL(3U, bs.count());
+
+      bs.set();
+      bs.reset(131072);
+      CHECK_EQUAL(131072U, bs.find_first(false));
+      CHECK_EQUAL(131072U, bs.find_next(false, 1));
+      CHECK_EQUAL(etl::hierarchical_bitset<200000>::npos, bs.find_next(false, 131073));
+      CHECK_EQUAL(199999U, bs.count());
+    }
+
+    //*************************************************************************
+    TEST(test_find_matches_linear_search)
+    {
+      etl::hierarchical_bitset<4130> bs;
+
+      uint32_t seed = 98765U;
+
+      for (int pass = 0; pass < 4; ++pass)
+      {
+        // Each pass makes the bitset denser.
+        for (size_t i = 0U; i < 400U; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          size_t position = (seed >> 8U) % bs.size();
+          bs.set(position);
+        }
+
+        CHECK(check_all_finds(bs));
+      }
+
+      bs.flip();
+      CHECK(check_all_finds(bs));
+
+      size_t n = 0U;
+
+      for (size_t i = 0U; i < bs.size(); ++i)
+      {
+        n += bs.test(i) ? 1U : 0U;
+      }
+
+      CHECK_EQUAL(n, bs.count());
+    }
+
+    //*************************************************************************
+    TEST(test_single_word)
+    {
+      etl::hierarchical_bitset<64> bs;
+
+      bs.set();
+      CHECK(bs.all());
+      CHECK_EQUAL(64U, bs.count());
+
+      bs.reset(63);
+      CHECK_EQUAL(63U, bs.find_first(false));
+      CHECK_EQUAL(etl::hierarchical_bitset<64>::npos, bs.find_next(true, 63));
+      CHECK(check_all_finds(bs));
+    }
+
+    //*************************************************************************
+    TEST(test_equality)
+    {
+      etl::hierarchical_bitset<100> bs1;
+      etl::hierarchical_bitset<100> bs2;
+
+      bs1.set(10);
+      CHECK(bs1 != bs2);
+
+      bs2.set(10);
+      CHECK(bs1 == bs2);
+    }
+  }
+}
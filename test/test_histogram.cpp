@@ -35,6 +35,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <map>
+#include <vector>
 
 namespace
 {
@@ -292,6 +293,28 @@ namespace
       CHECK_EQUAL(0U, histogram2.count());
     }
 
+    //*************************************************************************
+    TEST(test_int_histogram_add_to_bin)
+    {
+      IntOffset0Histogram histogram1;
+      IntOffset0Histogram histogram2;
+
+      histogram2.add(input1.begin(), input1.end());
+
+      for (size_t i = 0U; i < histogram2.size(); ++i)
+      {
+        histogram1.add_to_bin(i, histogram2[i]);
+        histogram1.add_to_bin(i, histogram2[i]);
+      }
+
+      for (size_t i = 0U; i < histogram1.size(); ++i)
+      {
+        CHECK_EQUAL(2 * output1[i], int(histogram1[i]));
+      }
+
+      CHECK_EQUAL(110U, histogram1.count());
+    }
+
     //*************************************************************************
     TEST(test_string_histogram_constructor)
     {
@@ -376,5 +399,160 @@ namespace
       isEqual = std::equal(output2.begin(), output2.end(), histogram.begin());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_hdr_histogram_layout)
+    {
+      typedef etl::hdr_histogram<uint32_t, uint32_t, 3600000000UL, 3> Histogram;
+
+      CHECK_EQUAL(2048U, Histogram::Sub_Bucket_Count);
+      CHECK_EQUAL((21U + 2U) * 1024U, Histogram::Bucket_Count);
+      CHECK_EQUAL(Histogram::Bucket_Count, Histogram().size());
+
+      // Indexes are contiguous and the relative error is within 1 part in 1000.
+      size_t previous = Histogram::index_of(0U);
+      CHECK_EQUAL(0U, previous);
+
+      for (uint32_t value = 1U; value < 5000000U; ++value)
+      {
+        size_t index = Histogram::index_of(value);
+        CHECK((index == previous) || (index == (previous + 1U)));
+        previous = index;
+      }
+
+      CHECK(Histogram::index_of(3600000000UL) < Histogram::Bucket_Count);
+
+      const uint32_t values[] = { 0U, 1U, 2047U, 2048U, 4095U, 4096U, 123456U, 1000000U, 3599999999UL };
+
+      for (size_t i = 0U; i < sizeof(values) / sizeof(values[0]); ++i)
+      {
+        const uint32_t lowest  = Histogram::lowest_equivalent_value(values[i]);
+        const uint32_t highest = Histogram::highest_equivalent_value(values[i]);
+
+        CHECK(lowest <= values[i]);
+        CHECK(highest >= values[i]);
+        CHECK_EQUAL(Histogram::index_of(lowest), Histogram::index_of(values[i]));
+        CHECK_EQUAL(Histogram::index_of(highest), Histogram::index_of(values[i]));
+        CHECK((highest - lowest) <= (values[i] / 1000U));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_hdr_histogram_percentiles)
+    {
+      // Nanosecond latencies from 1 ns to 10 s.
+      typedef etl::hdr_histogram<uint64_t, uint32_t, 10000000000ULL, 3> Histogram;
+
+      Histogram histogram;
+
+      CHECK(histogram.empty());
+      CHECK_EQUAL(0U, histogram.value_at_percentile(50.0));
+
+      for (uint64_t value = 1U; value <= 10000U; ++value)
+      {
+        histogram.add(value * 1000000ULL);
+      }
+
+      CHECK_EQUAL(10000U, histogram.count());
+      CHECK_EQUAL(1000000U, histogram.min());
+      CHECK_EQUAL(10000000000ULL, histogram.max());
+
+      const double percentiles[] = { 1.0, 25.0, 50.0, 90.0, 99.0, 99.9 };
+
+      for (size_t i = 0U; i < sizeof(percentiles) / sizeof(percentiles[0]); ++i)
+      {
+        const double expected = percentiles[i] * 100.0 * 1000000.0;
+        const double actual   = static_cast<double>(histogram.value_at_percentile(percentiles[i]));
+
+        CHECK_CLOSE(expected, actual, expected * 0.002);
+      }
+
+      CHECK_EQUAL(10000000000ULL, histogram.value_at_percentile(100.0));
+
+      histogram.add(1U);
+      CHECK_EQUAL(10001U, histogram.count());
+      CHECK_EQUAL(1U, histogram.min());
+      CHECK_EQUAL(1U, histogram.value_at_percentile(0.0));
+
+      // Values above the maximum are clamped.
+      histogram.add(20000000000ULL);
+      CHECK_EQUAL(10000000000ULL, histogram.max());
+      CHECK_EQUAL(2U, histogram.count_at_value(10000000000ULL));
+
+      histogram.clear();
+      CHECK(histogram.empty());
+      CHECK_EQUAL(0U, histogram.count());
+      CHECK_EQUAL(0U, histogram.max());
+    }
+
+    //*************************************************************************
+    TEST(test_hdr_histogram_merge)
+    {
+      typedef etl::hdr_histogram<uint32_t, uint16_t, 1000000U, 2> Histogram;
+
+      std::vector<uint32_t> data1;
+      std::vector<uint32_t> data2;
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        data1.push_back((i * 7919U) % 1000000U);
+        data2.push_back((i * 104729U) % 1000000U);
+      }
+
+      Histogram histogram1(data1.begin(), data1.end());
+      Histogram histogram2;
+      histogram2(data2.begin(), data2.end());
+
+      Histogram all;
+      all(data1.begin(), data1.end());
+      all.add(data2.begin(), data2.end());
+
+      histogram1.merge(histogram2);
+
+      CHECK_EQUAL(all.count(), histogram1.count());
+      CHECK_EQUAL(all.min(), histogram1.min());
+      CHECK_EQUAL(all.max(), histogram1.max());
+      CHECK(std::equal(all.begin(), all.end(), histogram1.begin()));
+      CHECK_EQUAL(all.value_at_percentile(50.0), histogram1.value_at_percentile(50.0));
+    }
+
+    //*************************************************************************
+    TEST(test_hdr_histogram_percentile_iterator)
+    {
+      typedef etl::hdr_histogram<uint32_t, uint32_t, 100000U, 2> Histogram;
+
+      Histogram histogram;
+
+      CHECK(histogram.percentile_begin() == histogram.percentile_end());
+
+      histogram.add(5U, 3U);
+      histogram.add(1000U);
+      histogram.add(50000U, 6U);
+
+      Histogram::percentile_iterator itr = histogram.percentile_begin();
+
+      CHECK_EQUAL(5U, itr->value);
+      CHECK_EQUAL(5U, itr->lowest_value);
+      CHECK_EQUAL(3U, itr->count);
+      CHECK_EQUAL(3U, itr->cumulative_count);
+      CHECK_CLOSE(30.0, itr->percentile, 0.001);
+
+      ++itr;
+      CHECK(itr->lowest_value <= 1000U);
+      CHECK(itr->value >= 1000U);
+      CHECK_EQUAL(1U, (*itr).count);
+      CHECK_EQUAL(4U, itr->cumulative_count);
+      CHECK_CLOSE(40.0, itr->percentile, 0.001);
+
+      itr++;
+      CHECK(itr->lowest_value <= 50000U);
+      CHECK_EQUAL(50000U, itr->value);
+      CHECK_EQUAL(6U, itr->count);
+      CHECK_EQUAL(10U, itr->cumulative_count);
+      CHECK_CLOSE(100.0, itr->percentile, 0.001);
+
+      ++itr;
+      CHECK(itr == histogram.percentile_end());
+    }
   };
 }
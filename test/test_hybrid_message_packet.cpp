@@ -0,0 +1,302 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/platform.h"
+
+#if ETL_HAS_VIRTUAL_MESSAGES && ETL_USING_CPP17
+
+#include "etl/hybrid_message_packet.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+
+#include <string.h>
+
+namespace
+{
+  enum
+  {
+    SMALL_MESSAGE1,
+    SMALL_MESSAGE2,
+    LARGE_MESSAGE,
+    OTHER_MESSAGE
+  };
+
+  //*************************************************************************
+  struct SmallMessage1 : public etl::message<SMALL_MESSAGE1>
+  {
+    explicit SmallMessage1(int x_)
+      : x(x_)
+    {
+    }
+
+    int x;
+  };
+
+  //*************************************************************************
+  struct SmallMessage2 : public etl::message<SMALL_MESSAGE2>
+  {
+    explicit SmallMessage2(char c_)
+      : c(c_)
+    {
+    }
+
+    char c;
+  };
+
+  //*************************************************************************
+  struct LargeMessage : public etl::message<LARGE_MESSAGE>
+  {
+    explicit LargeMessage(char c)
+    {
+      memset(buffer, c, sizeof(buffer));
+    }
+
+    char buffer[512];
+  };
+
+  //*************************************************************************
+  struct OtherMessage : public etl::message<OTHER_MESSAGE>
+  {
+  };
+
+  using Pool = etl::reference_counted_message_pool<int32_t>;
+
+  using pool_message_parameters = Pool::pool_message_parameters<LargeMessage>;
+
+  using Allocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                            pool_message_parameters::max_alignment,
+                                                            2U>;
+
+  using Packet = etl::hybrid_message_packet<Pool, 16U, SmallMessage1, SmallMessage2, LargeMessage>;
+
+  //*************************************************************************
+  // Sets the packet pool for a test, and clears it before the pool is destroyed.
+  struct PoolFixture
+  {
+    PoolFixture()
+      : pool(allocator)
+    {
+      Packet::set_pool(pool);
+    }
+
+    ~PoolFixture()
+    {
+      Packet::clear_pool();
+    }
+
+    Allocator allocator;
+    Pool      pool;
+  };
+
+  SUITE(test_hybrid_message_packet)
+  {
+    //*************************************************************************
+    TEST(test_storage)
+    {
+      CHECK_TRUE(Packet::Is_Inline<SmallMessage1>);
+      CHECK_TRUE(Packet::Is_Inline<SmallMessage2>);
+      CHECK_FALSE(Packet::Is_Inline<LargeMessage>);
+
+      CHECK(size_t(Packet::SIZE) < sizeof(LargeMessage));
+      CHECK(size_t(Packet::SIZE) >= sizeof(SmallMessage1));
+      CHECK(size_t(Packet::SIZE) >= sizeof(etl::shared_message));
+      CHECK(sizeof(Packet) < sizeof(LargeMessage));
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Packet packet;
+
+      CHECK_FALSE(packet.is_valid());
+      CHECK_FALSE(packet.is_inline());
+    }
+
+    //*************************************************************************
+    TEST(test_small_message)
+    {
+      Packet packet1(SmallMessage1(1));
+      Packet packet2(SmallMessage2('A'));
+
+      CHECK_TRUE(packet1.is_valid());
+      CHECK_TRUE(packet1.is_inline());
+      CHECK_EQUAL(SMALL_MESSAGE1, packet1.get().get_message_id());
+      CHECK_EQUAL(1, static_cast<SmallMessage1&>(packet1.get()).x);
+
+      CHECK_TRUE(packet2.is_inline());
+      CHECK_EQUAL(SMALL_MESSAGE2, packet2.get().get_message_id());
+      CHECK_EQUAL('A', static_cast<SmallMessage2&>(packet2.get()).c);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(PoolFixture, test_large_message)
+    {
+      Packet packet(LargeMessage('B'));
+
+      CHECK_TRUE(packet.is_valid());
+      CHECK_FALSE(packet.is_inline());
+      CHECK_EQUAL(LARGE_MESSAGE, packet.get().get_message_id());
+      CHECK_EQUAL('B', static_cast<const LargeMessage&>(packet.get()).buffer[0]);
+      CHECK_EQUAL('B', static_cast<const LargeMessage&>(packet.get()).buffer[511]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(PoolFixture, test_large_messages_are_released_to_the_pool)
+    {
+      for (int i = 0; i < 10; ++i)
+      {
+        Packet packet1(LargeMessage('C'));
+        Packet packet2(LargeMessage('D'));
+
+        CHECK_THROW(Packet packet3(LargeMessage('E')), etl::reference_counted_message_pool_allocation_failure);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(PoolFixture, test_copy_large_message)
+    {
+      Packet packet1(LargeMessage('F'));
+
+      {
+        Packet packet2(packet1);
+
+        CHECK_FALSE(packet2.is_inline());
+
+        // The copy has its own message.
+        static_cast<LargeMessage&>(packet2.get()).buffer[0] = 'G';
+        CHECK_EQUAL('F', static_cast<const LargeMessage&>(packet1.get()).buffer[0]);
+        CHECK_EQUAL('G', static_cast<const LargeMessage&>(packet2.get()).buffer[0]);
+
+        // Both pool blocks are in use.
+        CHECK_THROW(Packet packet3(packet1), etl::reference_counted_message_pool_allocation_failure);
+      }
+
+      Packet packet4(SmallMessage1(2));
+      packet4 = packet1;
+      CHECK_FALSE(packet4.is_inline());
+      CHECK_EQUAL('F', static_cast<const LargeMessage&>(packet4.get()).buffer[0]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(PoolFixture, test_move_large_message)
+    {
+      Packet packet1(LargeMessage('H'));
+      Packet packet2(LargeMessage('I'));
+
+      // Moves do not allocate.
+      Packet packet3(etl::move(packet1));
+      CHECK_FALSE(packet1.is_valid());
+      CHECK_TRUE(packet3.is_valid());
+      CHECK_EQUAL('H', static_cast<const LargeMessage&>(packet3.get()).buffer[0]);
+
+      packet3 = etl::move(packet2);
+      CHECK_FALSE(packet2.is_valid());
+      CHECK_EQUAL('I', static_cast<const LargeMessage&>(packet3.get()).buffer[0]);
+
+      // Assigning over 'H' released it.
+      Packet packet4(LargeMessage('J'));
+      CHECK_EQUAL('J', static_cast<const LargeMessage&>(packet4.get()).buffer[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move_small_message)
+    {
+      Packet packet1(SmallMessage1(3));
+      Packet packet2(packet1);
+      Packet packet3(etl::move(packet1));
+
+      CHECK_TRUE(packet2.is_inline());
+      CHECK_EQUAL(3, static_cast<SmallMessage1&>(packet2.get()).x);
+      CHECK_TRUE(packet3.is_inline());
+      CHECK_EQUAL(3, static_cast<SmallMessage1&>(packet3.get()).x);
+
+      packet2 = Packet(SmallMessage2('K'));
+      CHECK_EQUAL(SMALL_MESSAGE2, packet2.get().get_message_id());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(PoolFixture, test_construct_from_imessage)
+    {
+      SmallMessage1 small(4);
+      LargeMessage  large('L');
+      OtherMessage  other;
+
+      const etl::imessage& ismall = small;
+      const etl::imessage& ilarge = large;
+      const etl::imessage& iother = other;
+
+      Packet packet1(ismall);
+      Packet packet2(ilarge);
+
+      CHECK_TRUE(packet1.is_inline());
+      CHECK_EQUAL(4, static_cast<SmallMessage1&>(packet1.get()).x);
+      CHECK_FALSE(packet2.is_inline());
+      CHECK_EQUAL('L', static_cast<const LargeMessage&>(packet2.get()).buffer[0]);
+
+      CHECK_THROW(Packet packet3(iother), etl::unhandled_message_exception);
+    }
+
+    //*************************************************************************
+    TEST(test_accepts)
+    {
+      CHECK_TRUE(Packet::accepts(SMALL_MESSAGE1));
+      CHECK_TRUE(Packet::accepts(LARGE_MESSAGE));
+      CHECK_FALSE(Packet::accepts(OTHER_MESSAGE));
+
+      CHECK_TRUE(Packet::accepts<SMALL_MESSAGE2>());
+      CHECK_FALSE(Packet::accepts<OtherMessage>());
+      CHECK_TRUE(Packet::accepts(LargeMessage('M')));
+    }
+
+    //*************************************************************************
+    TEST(test_no_pool)
+    {
+      using NoPoolPacket = etl::hybrid_message_packet<Pool, 8U, SmallMessage1, LargeMessage>;
+
+      CHECK_TRUE(NoPoolPacket::get_pool() == nullptr);
+      CHECK_THROW(NoPoolPacket packet(LargeMessage('N')), etl::hybrid_message_packet_no_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_pool)
+    {
+      {
+        PoolFixture fixture;
+
+        CHECK_TRUE(Packet::get_pool() == &fixture.pool);
+      }
+
+      CHECK_TRUE(Packet::get_pool() == nullptr);
+      CHECK_THROW(Packet packet(LargeMessage('O')), etl::hybrid_message_packet_no_pool);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,134 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/hyperloglog.h"
+#include "etl/hash.h"
+
+#include <math.h>
+#include <stdint.h>
+
+namespace
+{
+  //*************************************************************************
+  template <typename THll>
+  bool within(const THll& hll, double actual, double sigmas)
+  {
+    const double error = fabs(hll.estimate() - actual) / actual;
+
+    return error <= (sigmas * THll::standard_error());
+  }
+
+  SUITE(test_hyperloglog)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::hyperloglog<10, uint32_t> hll;
+
+      CHECK(hll.empty());
+      CHECK_EQUAL(1024U, hll.size_bytes());
+      CHECK_CLOSE(0.0, hll.estimate(), 0.001);
+    }
+
+    //*************************************************************************
+    TEST(test_small_cardinality)
+    {
+      etl::hyperloglog<12, uint32_t> hll;
+
+      for (uint32_t i = 0U; i < 100U; ++i)
+      {
+        hll.add(i);
+        hll.add(i); // Duplicates do not count.
+      }
+
+      CHECK(!hll.empty());
+      CHECK_CLOSE(100.0, hll.estimate(), 3.0);
+    }
+
+    //*************************************************************************
+    TEST(test_large_cardinality)
+    {
+      etl::hyperloglog<12, uint32_t> hll12;
+      etl::hyperloglog<6, uint32_t>  hll6;
+
+      for (uint32_t i = 0U; i < 200000U; ++i)
+      {
+        hll12.add(i * 2654435761U);
+        hll6.add(i * 2654435761U);
+      }
+
+      CHECK(within(hll12, 200000.0, 3.0));
+      CHECK(within(hll6, 200000.0, 3.0));
+
+      // Adding the same keys again changes nothing.
+      const double estimate = hll12.estimate();
+
+      for (uint32_t i = 0U; i < 1000U; ++i)
+      {
+        hll12.add(i * 2654435761U);
+      }
+
+      CHECK_CLOSE(estimate, hll12.estimate(), 0.0001);
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      etl::hyperloglog<10, uint32_t> all;
+      etl::hyperloglog<10, uint32_t> core1;
+      etl::hyperloglog<10, uint32_t> core2;
+
+      // Overlapping sets of keys.
+      for (uint32_t i = 0U; i < 30000U; ++i)
+      {
+        all.add(i);
+
+        if (i < 20000U)
+        {
+          core1.add(i);
+        }
+
+        if (i >= 10000U)
+        {
+          core2.add(i);
+        }
+      }
+
+      core1.merge(core2);
+
+      CHECK_ARRAY_EQUAL(all.data(), core1.data(), all.size_bytes());
+      CHECK_CLOSE(all.estimate(), core1.estimate(), 0.0001);
+      CHECK(within(core1, 30000.0, 3.0));
+
+      core1.clear();
+      CHECK(core1.empty());
+    }
+  }
+}
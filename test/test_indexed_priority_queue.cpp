@@ -0,0 +1,382 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/indexed_priority_queue.h"
+
+#include <queue>
+#include <vector>
+#include <string>
+#include <functional>
+#include <algorithm>
+
+namespace
+{
+  const size_t SIZE = 16;
+
+  struct Route
+  {
+    Route(int node_, int distance_)
+      : node(node_)
+      , distance(distance_)
+    {
+    }
+
+    int node;
+    int distance;
+  };
+
+  // Shortest distance first.
+  struct RouteCompare
+  {
+    bool operator()(const Route& lhs, const Route& rhs) const
+    {
+      return lhs.distance > rhs.distance;
+    }
+  };
+
+  typedef etl::indexed_priority_queue<int, SIZE>                          Queue;
+  typedef etl::indexed_priority_queue<int, SIZE, etl::less<int>, 4>       Queue4;
+  typedef etl::indexed_priority_queue<std::string, SIZE>                  QueueS;
+  typedef etl::indexed_priority_queue<Route, SIZE, RouteCompare, 4>       RouteQueue;
+
+  const int data[SIZE] = { 5, 12, 3, 9, 1, 7, 15, 2, 8, 11, 4, 14, 6, 10, 13, 0 };
+
+  //*************************************************************************
+  template <typename TQueue>
+  bool drains_in_order(TQueue& queue, std::vector<int> expected)
+  {
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+      if (queue.empty() || (queue.top() != expected[i]))
+      {
+        return false;
+      }
+
+      queue.pop();
+    }
+
+    return queue.empty();
+  }
+
+  SUITE(test_indexed_priority_queue)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(SIZE, queue.max_size());
+      CHECK_EQUAL(SIZE, queue.capacity());
+      CHECK_EQUAL(SIZE, queue.available());
+      CHECK_EQUAL(2U, queue.ARITY);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Queue  queue2;
+      Queue4 queue4;
+      std::priority_queue<int> compare;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        queue2.push(data[i]);
+        queue4.push(data[i]);
+        compare.push(data[i]);
+      }
+
+      CHECK(queue2.full());
+      CHECK(queue4.full());
+
+      while (!compare.empty())
+      {
+        CHECK_EQUAL(compare.top(), queue2.top());
+        CHECK_EQUAL(compare.top(), queue4.top());
+        CHECK_EQUAL(compare.top(), queue2[queue2.top_handle()]);
+
+        compare.pop();
+        queue2.pop();
+        queue4.pop();
+      }
+
+      CHECK(queue2.empty());
+      CHECK(queue4.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_handles)
+    {
+      Queue4 queue;
+      Queue4::handle_type handles[SIZE];
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        handles[i] = queue.push(data[i]);
+      }
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        CHECK(queue.contains(handles[i]));
+        CHECK_EQUAL(data[i], queue[handles[i]]);
+        CHECK_EQUAL(data[i], queue.at(handles[i]));
+      }
+
+      CHECK_EQUAL(handles[6], queue.top_handle());
+      CHECK(!queue.contains(Queue4::Invalid_Handle));
+      CHECK(!queue.contains(SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_update)
+    {
+      Queue4 queue;
+      Queue4::handle_type handles[SIZE];
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        handles[i] = queue.push(data[i]);
+      }
+
+      std::vector<int> expected(data, data + SIZE);
+
+      // Raise a low priority value to the top.
+      queue.update(handles[15], 20);
+      expected[15] = 20;
+      CHECK_EQUAL(handles[15], queue.top_handle());
+
+      // Lower the top value to the bottom.
+      queue.update(handles[15], -1);
+      expected[15] = -1;
+      CHECK_EQUAL(handles[6], queue.top_handle());
+
+      // Move values in the middle.
+      queue.update(handles[3], 16);
+      expected[3] = 16;
+      queue.update(handles[11], 2);
+      expected[11] = 2;
+
+      CHECK_EQUAL(16, queue[handles[3]]);
+      CHECK(drains_in_order(queue, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Queue queue;
+      Queue::handle_type handles[SIZE];
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        handles[i] = queue.push(data[i]);
+      }
+
+      queue.erase(handles[3]);  // 9
+      queue.erase(handles[6]);  // 15, the top
+      queue.erase(handles[15]); // 0, the lowest
+
+      CHECK_EQUAL(SIZE - 3U, queue.size());
+      CHECK(!queue.contains(handles[3]));
+      CHECK(!queue.contains(handles[6]));
+      CHECK(!queue.contains(handles[15]));
+      CHECK(queue.contains(handles[4]));
+
+      std::vector<int> expected(data, data + SIZE);
+      expected.erase(expected.begin() + 15);
+      expected.erase(expected.begin() + 6);
+      expected.erase(expected.begin() + 3);
+
+      CHECK(drains_in_order(queue, expected));
+    }
+
+    //*************************************************************************
+    TEST(test_handle_reuse)
+    {
+      Queue queue;
+
+      Queue::handle_type h1 = queue.push(1);
+      Queue::handle_type h2 = queue.push(2);
+
+      queue.erase(h1);
+      CHECK(!queue.contains(h1));
+
+      Queue::handle_type h3 = queue.push(3);
+
+      CHECK(queue.contains(h2));
+      CHECK(queue.contains(h3));
+      CHECK_EQUAL(2, queue[h2]);
+      CHECK_EQUAL(3, queue[h3]);
+      CHECK_EQUAL(h3, queue.top_handle());
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      Queue queue;
+      int value;
+
+      CHECK_THROW(queue.pop(), etl::indexed_priority_queue_empty);
+      CHECK_THROW(queue.pop_into(value), etl::indexed_priority_queue_empty);
+
+      Queue::handle_type handle = queue.push(1);
+      queue.pop();
+
+      CHECK_THROW(queue.update(handle, 2), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(queue.erase(handle), etl::indexed_priority_queue_invalid_handle);
+      CHECK_THROW(queue.at(handle), etl::indexed_priority_queue_invalid_handle);
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        queue.push(data[i]);
+      }
+
+      CHECK_THROW(queue.push(1), etl::indexed_priority_queue_full);
+      CHECK_THROW(queue.emplace(1), etl::indexed_priority_queue_full);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into_and_clear)
+    {
+      QueueS queue;
+
+      queue.push(std::string("B"));
+      queue.emplace(3U, 'C');
+      queue.push(std::string("A"));
+
+      std::string value;
+      queue.pop_into(value);
+      CHECK_EQUAL(std::string("CCC"), value);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      QueueS::handle_type handle = queue.push(std::string("D"));
+      CHECK_EQUAL(std::string("D"), queue[handle]);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      QueueS queue;
+
+      QueueS::handle_type ha = queue.push(std::string("A"));
+      QueueS::handle_type hb = queue.push(std::string("B"));
+      QueueS::handle_type hc = queue.push(std::string("C"));
+      queue.erase(hb);
+
+      QueueS copy(queue);
+
+      CHECK_EQUAL(2U, copy.size());
+      CHECK(!copy.contains(hb));
+      CHECK_EQUAL(std::string("A"), copy[ha]);
+      CHECK_EQUAL(std::string("C"), copy[hc]);
+
+      copy.update(ha, std::string("Z"));
+      CHECK_EQUAL(ha, copy.top_handle());
+      CHECK_EQUAL(hc, queue.top_handle());
+
+      QueueS assigned;
+      assigned.push(std::string("X"));
+      assigned = copy;
+      CHECK_EQUAL(2U, assigned.size());
+      CHECK_EQUAL(std::string("Z"), assigned.top());
+
+      QueueS moved(std::move(assigned));
+      CHECK(assigned.empty());
+      CHECK_EQUAL(2U, moved.size());
+      CHECK_EQUAL(std::string("Z"), moved[ha]);
+      CHECK_EQUAL(std::string("C"), moved[hc]);
+
+      QueueS move_assigned;
+      move_assigned = std::move(moved);
+      CHECK(moved.empty());
+      CHECK_EQUAL(std::string("Z"), move_assigned.top());
+    }
+
+    //*************************************************************************
+    TEST(test_shortest_path)
+    {
+      // Dijkstra over a small graph, lowering the distance of queued nodes in place.
+      const int N = 6;
+      const int inf = 1000;
+      const int weight[N][N] =
+      {
+        { 0, 7, 9, 0, 0, 14 },
+        { 7, 0, 10, 15, 0, 0 },
+        { 9, 10, 0, 11, 0, 2 },
+        { 0, 15, 11, 0, 6, 0 },
+        { 0, 0, 0, 6, 0, 9 },
+        { 14, 0, 2, 0, 9, 0 }
+      };
+
+      RouteQueue queue;
+      RouteQueue::handle_type handles[N];
+      int distance[N];
+
+      for (int i = 0; i < N; ++i)
+      {
+        distance[i] = (i == 0) ? 0 : inf;
+        handles[i]  = queue.emplace(i, distance[i]);
+      }
+
+      while (!queue.empty())
+      {
+        const Route route = queue.top();
+        queue.pop();
+
+        for (int next = 0; next < N; ++next)
+        {
+          if ((weight[route.node][next] != 0) && queue.contains(handles[next]))
+          {
+            const int candidate = route.distance + weight[route.node][next];
+
+            if (candidate < distance[next])
+            {
+              distance[next] = candidate;
+              queue.update(handles[next], Route(next, candidate));
+            }
+          }
+        }
+      }
+
+      CHECK_EQUAL(0,  distance[0]);
+      CHECK_EQUAL(7,  distance[1]);
+      CHECK_EQUAL(9,  distance[2]);
+      CHECK_EQUAL(20, distance[3]);
+      CHECK_EQUAL(20, distance[4]);
+      CHECK_EQUAL(11, distance[5]);
+    }
+  }
+}
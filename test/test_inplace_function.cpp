@@ -0,0 +1,311 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/inplace_function.h"
+
+namespace
+{
+  int free_function(int a, int b)
+  {
+    return a + b;
+  }
+
+  //***************************************************************************
+  // Counts the live instances.
+  //***************************************************************************
+  struct Counter
+  {
+    Counter(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Counter(const Counter& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    Counter(Counter&& other)
+      : value(other.value)
+    {
+      other.value = 0;
+      ++instances;
+    }
+
+    ~Counter()
+    {
+      --instances;
+    }
+
+    int operator()(int a)
+    {
+      value += a;
+      return value;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Counter::instances = 0;
+
+  //***************************************************************************
+  struct MoveOnly
+  {
+    MoveOnly(int value_)
+      : value(value_)
+    {
+    }
+
+    MoveOnly(MoveOnly&&) = default;
+    MoveOnly(const MoveOnly&) = delete;
+
+    int value;
+  };
+
+  typedef etl::inplace_function<int(int)> function_t;
+
+  SUITE(test_inplace_function)
+  {
+    //*************************************************************************
+    TEST(test_default_is_empty)
+    {
+      function_t f;
+      function_t g(nullptr);
+
+      CHECK_FALSE(f.is_valid());
+      CHECK_FALSE(bool(g));
+      CHECK_TRUE(f == nullptr);
+      CHECK_TRUE(nullptr == g);
+      CHECK_FALSE(f != nullptr);
+      CHECK_THROW(f(1), etl::inplace_function_uninitialised);
+    }
+
+    //*************************************************************************
+    TEST(test_free_function)
+    {
+      etl::inplace_function<int(int, int)> f(free_function);
+      etl::inplace_function<int(int, int)> g(&free_function);
+
+      CHECK_TRUE(f.is_valid());
+      CHECK_TRUE(f != nullptr);
+      CHECK_EQUAL(5, f(2, 3));
+      CHECK_EQUAL(7, g(3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_capturing_lambda_outlives_its_scope)
+    {
+      function_t f;
+
+      {
+        int offset = 10;
+        int scale  = 3;
+
+        f = [offset, scale](int a) { return (a * scale) + offset; };
+      }
+
+      CHECK_EQUAL(16, f(2));
+    }
+
+    //*************************************************************************
+    TEST(test_stateful_callable)
+    {
+      const function_t f = Counter(1);
+
+      // The stored callable keeps its state between calls, even through a const wrapper.
+      CHECK_EQUAL(3, f(2));
+      CHECK_EQUAL(6, f(3));
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      {
+        function_t f = Counter(1);
+        CHECK_EQUAL(1, Counter::instances);
+
+        function_t g(f);
+        CHECK_EQUAL(2, Counter::instances);
+
+        // The copies are independent.
+        CHECK_EQUAL(11, f(10));
+        CHECK_EQUAL(2,  g(1));
+
+        function_t h;
+        h = g;
+        CHECK_EQUAL(3, Counter::instances);
+        CHECK_EQUAL(4, h(2));
+        CHECK_EQUAL(3, g(1));
+
+        h = f;
+        CHECK_EQUAL(3, Counter::instances);
+        CHECK_EQUAL(12, h(1));
+      }
+
+      CHECK_EQUAL(0, Counter::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      {
+        function_t f = Counter(5);
+
+        function_t g(etl::move(f));
+        CHECK_EQUAL(1, Counter::instances);
+        CHECK_FALSE(f.is_valid());
+        CHECK_EQUAL(6, g(1));
+
+        function_t h;
+        h = etl::move(g);
+        CHECK_EQUAL(1, Counter::instances);
+        CHECK_FALSE(g.is_valid());
+        CHECK_EQUAL(7, h(1));
+      }
+
+      CHECK_EQUAL(0, Counter::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_replaces_and_clear)
+    {
+      function_t f = Counter(1);
+      CHECK_EQUAL(1, Counter::instances);
+
+      f = [](int a) { return -a; };
+      CHECK_EQUAL(0, Counter::instances);
+      CHECK_EQUAL(-4, f(4));
+
+      f = Counter(2);
+      CHECK_EQUAL(1, Counter::instances);
+
+      f = nullptr;
+      CHECK_EQUAL(0, Counter::instances);
+      CHECK_FALSE(f.is_valid());
+
+      f = Counter(3);
+      f.clear();
+      CHECK_EQUAL(0, Counter::instances);
+      CHECK_FALSE(f.is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_from_smaller_capacity)
+    {
+      etl::inplace_function<int(int), sizeof(Counter)> small = Counter(1);
+
+      etl::inplace_function<int(int), 4U * sizeof(Counter)> copied(small);
+      CHECK_EQUAL(2, Counter::instances);
+      CHECK_EQUAL(3, copied(2));
+      CHECK_EQUAL(2, small(1));
+
+      etl::inplace_function<int(int), 4U * sizeof(Counter)> moved(etl::move(small));
+      CHECK_EQUAL(2, Counter::instances);
+      CHECK_FALSE(small.is_valid());
+      CHECK_EQUAL(3, moved(1));
+
+      copied = moved;
+      moved.clear();
+      copied.clear();
+      CHECK_EQUAL(0, Counter::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_swap)
+    {
+      function_t f = [](int a) { return a + 1; };
+      function_t g = Counter(10);
+      function_t e;
+
+      swap(f, g);
+      CHECK_EQUAL(11, f(1));
+      CHECK_EQUAL(2,  g(1));
+
+      f.swap(e);
+      CHECK_FALSE(f.is_valid());
+      CHECK_EQUAL(12, e(1));
+
+      e.clear();
+      CHECK_EQUAL(0, Counter::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_call_if_and_call_or)
+    {
+      int total = 0;
+
+      etl::inplace_function<void(int)> v = [&total](int a) { total += a; };
+      etl::inplace_function<void(int)> empty_v;
+
+      CHECK_TRUE(v.call_if(3));
+      CHECK_FALSE(empty_v.call_if(3));
+      CHECK_EQUAL(3, total);
+
+      function_t f = [](int a) { return a * 2; };
+      function_t empty_f;
+
+      etl::optional<int> result = f.call_if(4);
+      CHECK_TRUE(result.has_value());
+      CHECK_EQUAL(8, result.value());
+      CHECK_FALSE(empty_f.call_if(4).has_value());
+
+      CHECK_EQUAL(8,  f.call_or([](int a) { return -a; }, 4));
+      CHECK_EQUAL(-4, empty_f.call_or([](int a) { return -a; }, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_parameter_forwarding)
+    {
+      etl::inplace_function<void(int&)> increment = [](int& a) { ++a; };
+
+      int value = 1;
+      increment(value);
+      CHECK_EQUAL(2, value);
+
+      etl::inplace_function<int(MoveOnly)> take = [](MoveOnly m) { return m.value; };
+      CHECK_EQUAL(7, take(MoveOnly(7)));
+    }
+
+    //*************************************************************************
+    TEST(test_capacity_and_alignment)
+    {
+      typedef etl::inplace_function<void(), 32U, 8U> f_t;
+
+      CHECK_EQUAL(32U, f_t::CAPACITY);
+      CHECK_EQUAL(8U,  f_t::ALIGNMENT);
+      CHECK_TRUE(sizeof(f_t) >= (32U + sizeof(void*)));
+      CHECK_EQUAL(ETL_INPLACE_FUNCTION_DEFAULT_CAPACITY, function_t::CAPACITY);
+    }
+  }
+}
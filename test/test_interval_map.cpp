@@ -0,0 +1,370 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/interval_map.h"
+
+#include <vector>
+#include <algorithm>
+#include <stdint.h>
+
+namespace
+{
+  typedef etl::interval_map<int, int, 64>  Map;
+  typedef etl::iinterval_map<int, int>     IMap;
+  typedef IMap::value_type                 Interval;
+
+  //*************************************************************************
+  struct interval
+  {
+    int low;
+    int high;
+    int id;
+  };
+
+  //*************************************************************************
+  struct collector
+  {
+    collector(std::vector<int>& ids_)
+      : ids(&ids_)
+    {
+    }
+
+    void operator ()(const Interval& value)
+    {
+      ids->push_back(value.mapped);
+    }
+
+    std::vector<int>* ids;
+  };
+
+  //*************************************************************************
+  std::vector<int> overlaps(const IMap& map, int low, int high)
+  {
+    std::vector<int> ids;
+    map.for_each_overlap(low, high, collector(ids));
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  //*************************************************************************
+  std::vector<int> containing(const IMap& map, int point)
+  {
+    std::vector<int> ids;
+    map.for_each_containing(point, collector(ids));
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  //*************************************************************************
+  std::vector<int> expected_overlaps(const std::vector<interval>& intervals, int low, int high)
+  {
+    std::vector<int> ids;
+
+    for (size_t i = 0U; i < intervals.size(); ++i)
+    {
+      if ((low < intervals[i].high) && (intervals[i].low < high))
+      {
+        ids.push_back(intervals[i].id);
+      }
+    }
+
+    std::sort(ids.begin(), ids.end());
+    return ids;
+  }
+
+  //*************************************************************************
+  uint32_t next_random(uint32_t& seed)
+  {
+    seed = seed * 1664525U + 1013904223U;
+    return seed >> 8;
+  }
+
+  SUITE(test_interval_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Map map;
+
+      CHECK(map.empty());
+      CHECK(!map.full());
+      CHECK_EQUAL(0U, map.size());
+      CHECK_EQUAL(64U, map.max_size());
+      CHECK_EQUAL(64U, map.available());
+      CHECK(map.begin() == map.end());
+      CHECK(!map.overlaps(0, 100));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_iterates_in_order_of_low_bound)
+    {
+      Map map;
+
+      map.insert(30, 40, 3);
+      map.insert(10, 20, 1);
+      map.insert(50, 55, 5);
+      map.insert(20, 60, 2);
+      Map::iterator itr = map.insert(40, 45, 4);
+
+      CHECK_EQUAL(40, itr->low);
+      CHECK_EQUAL(45, itr->high);
+      CHECK_EQUAL(4, itr->mapped);
+      CHECK_EQUAL(5U, map.size());
+
+      std::vector<int> lows;
+
+      for (Map::const_iterator i = map.cbegin(); i != map.cend(); ++i)
+      {
+        lows.push_back(i->low);
+      }
+
+      const int expected[] = { 10, 20, 30, 40, 50 };
+      CHECK_ARRAY_EQUAL(expected, lows.data(), 5U);
+
+      std::vector<int> reversed;
+
+      for (Map::reverse_iterator i = map.rbegin(); i != map.rend(); ++i)
+      {
+        reversed.push_back(i->low);
+      }
+
+      const int expected_reversed[] = { 50, 40, 30, 20, 10 };
+      CHECK_ARRAY_EQUAL(expected_reversed, reversed.data(), 5U);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_errors)
+    {
+      etl::interval_map<int, int, 2> map;
+
+      CHECK_THROW(map.insert(10, 10, 0), etl::interval_map_invalid_interval);
+      CHECK_THROW(map.insert(10, 5, 0),  etl::interval_map_invalid_interval);
+
+      map.insert(0, 1, 0);
+      map.insert(0, 1, 1);
+      CHECK(map.full());
+      CHECK_THROW(map.insert(2, 3, 2), etl::interval_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_half_open_bounds)
+    {
+      Map map;
+
+      map.insert(10, 20, 1);
+
+      CHECK(!map.overlaps(0, 10));
+      CHECK(map.overlaps(0, 11));
+      CHECK(map.overlaps(19, 30));
+      CHECK(!map.overlaps(20, 30));
+      CHECK(map.overlaps(12, 13));
+      CHECK(map.overlaps(0, 100));
+      CHECK(!map.overlaps(15, 15));
+
+      CHECK(map.find_overlap(0, 10) == map.end());
+      CHECK_EQUAL(1, map.find_overlap(15, 16)->mapped);
+
+      CHECK_EQUAL(0U, map.count_containing(9));
+      CHECK_EQUAL(1U, map.count_containing(10));
+      CHECK_EQUAL(1U, map.count_containing(19));
+      CHECK_EQUAL(0U, map.count_containing(20));
+    }
+
+    //*************************************************************************
+    TEST(test_reservations)
+    {
+      Map map;
+
+      // Reserve time slots, rejecting any that clash.
+      const int requests[][2] = { { 0, 10 }, { 5, 15 }, { 10, 20 }, { 19, 25 }, { 20, 30 }, { 40, 50 }, { 30, 40 } };
+
+      for (size_t i = 0U; i < 7U; ++i)
+      {
+        if (!map.overlaps(requests[i][0], requests[i][1]))
+        {
+          map.insert(requests[i][0], requests[i][1], int(i));
+        }
+      }
+
+      CHECK_EQUAL(5U, map.size());
+      CHECK_EQUAL(3U, map.count_overlaps(15, 35));
+
+      const int expected[] = { 2, 4, 6 };
+      std::vector<int> ids = overlaps(map, 15, 35);
+      CHECK_ARRAY_EQUAL(expected, ids.data(), 3U);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Map map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        map.insert(i * 10, (i * 10) + 5, i);
+      }
+
+      Map::iterator itr = map.find_overlap(30, 31);
+      itr = map.erase(itr);
+
+      CHECK_EQUAL(4, itr->mapped);
+      CHECK_EQUAL(9U, map.size());
+      CHECK(!map.overlaps(30, 40));
+
+      // Erase [40, 70).
+      Map::iterator last = map.find_overlap(70, 71);
+      itr = map.erase(itr, last);
+
+      CHECK_EQUAL(7, itr->mapped);
+      CHECK_EQUAL(6U, map.size());
+
+      const int expected[] = { 0, 1, 2, 7, 8, 9 };
+      std::vector<int> ids = overlaps(map, 0, 100);
+      CHECK_ARRAY_EQUAL(expected, ids.data(), 6U);
+
+      map.clear();
+      CHECK(map.empty());
+      CHECK(map.begin() == map.end());
+
+      CHECK_THROW(map.erase(map.end()), etl::interval_map_iterator);
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Map map;
+
+      map.insert(10, 20, 1);
+      map.insert(15, 25, 2);
+
+      Map copy(map);
+
+      CHECK_EQUAL(2U, copy.size());
+      CHECK_EQUAL(2U, copy.count_containing(17));
+
+      Map other;
+      other.insert(0, 1, 3);
+      other = map;
+
+      CHECK_EQUAL(2U, other.size());
+      CHECK(!other.overlaps(0, 1));
+
+      map.clear();
+      CHECK_EQUAL(2U, copy.size());
+    }
+
+    //*************************************************************************
+    TEST(test_random_against_linear_scan)
+    {
+      etl::interval_map<int, int, 256> map;
+      std::vector<interval> intervals;
+
+      uint32_t seed = 12345U;
+      int next_id = 0;
+
+      for (int round = 0; round < 2000; ++round)
+      {
+        const int action = int(next_random(seed) % 3U);
+
+        if ((action < 2) && !map.full())
+        {
+          const int low    = int(next_random(seed) % 1000U);
+          const int length = 1 + int(next_random(seed) % 50U);
+          interval value = { low, low + length, next_id++ };
+
+          map.insert(value.low, value.high, value.id);
+          intervals.push_back(value);
+        }
+        else if (!intervals.empty())
+        {
+          // Erase a random interval.
+          const size_t index = next_random(seed) % intervals.size();
+          const int    id    = intervals[index].id;
+
+          for (etl::iinterval_map<int, int>::iterator itr = map.begin(); itr != map.end(); ++itr)
+          {
+            if (itr->mapped == id)
+            {
+              map.erase(itr);
+              break;
+            }
+          }
+
+          intervals.erase(intervals.begin() + index);
+        }
+
+        CHECK_EQUAL(intervals.size(), map.size());
+
+        const int low  = int(next_random(seed) % 1050U);
+        const int high = low + 1 + int(next_random(seed) % 20U);
+
+        CHECK(expected_overlaps(intervals, low, high) == overlaps(map, low, high));
+        CHECK(expected_overlaps(intervals, low, low + 1) == containing(map, low));
+        CHECK_EQUAL(!expected_overlaps(intervals, low, high).empty(), map.overlaps(low, high));
+      }
+
+      // Check the order.
+      int previous = -1;
+      size_t count = 0U;
+
+      for (etl::iinterval_map<int, int>::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        CHECK(previous <= itr->low);
+        previous = itr->low;
+        ++count;
+      }
+
+      CHECK_EQUAL(map.size(), count);
+    }
+
+    //*************************************************************************
+    TEST(test_ascending_fill_and_drain)
+    {
+      etl::interval_map<uint32_t, int, 512> map;
+
+      for (int pass = 0; pass < 2; ++pass)
+      {
+        for (uint32_t i = 0U; i < 512U; ++i)
+        {
+          map.insert(i * 16U, (i * 16U) + 32U, int(i));
+        }
+
+        CHECK(map.full());
+        CHECK_EQUAL(2U, map.count_containing(100U));
+        CHECK_EQUAL(0U, map.count_containing(512U * 16U + 16U));
+
+        while (!map.empty())
+        {
+          map.erase(map.begin());
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,196 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_index_forward_list.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  typedef etl::index_forward_link<0, uint16_t> Link0;
+  typedef etl::index_forward_link<1, uint8_t>  Link1;
+
+  struct Item : public Link0, public Link1
+  {
+    int value;
+  };
+
+  typedef etl::intrusive_index_forward_list<Item, Link0> List0;
+  typedef etl::intrusive_index_forward_list<Item, Link1> List1;
+
+  //***********************************
+  template <typename TList>
+  std::vector<int> values_of(const TList& list)
+  {
+    std::vector<int> result;
+
+    for (typename TList::const_iterator itr = list.begin(); itr != list.end(); ++itr)
+    {
+      result.push_back(itr->value);
+    }
+
+    return result;
+  }
+
+  SUITE(test_intrusive_index_forward_list)
+  {
+    //*************************************************************************
+    TEST(test_link_size)
+    {
+      CHECK_EQUAL(2U, sizeof(Link0));
+      CHECK_EQUAL(1U, sizeof(Link1));
+
+      Item item;
+      CHECK(!static_cast<Link0&>(item).is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Item items[4];
+      for (int i = 0; i < 4; ++i) { items[i].value = i; }
+
+      List0 list(items);
+
+      CHECK(list.empty());
+      CHECK_EQUAL(4U, list.max_size());
+      CHECK_THROW(list.front(), etl::intrusive_index_forward_list_empty);
+      CHECK_THROW(list.pop_front(), etl::intrusive_index_forward_list_empty);
+
+      list.push_front(items[2]);
+      list.push_front(items[1]);
+      list.push_front(items[0]);
+
+      CHECK_EQUAL(3U, list.size());
+      CHECK_EQUAL(0, list.front().value);
+
+      int expected[] = { 0, 1, 2 };
+      CHECK(values_of(list) == std::vector<int>(expected, expected + 3));
+
+      CHECK_THROW(list.push_front(items[1]), etl::intrusive_index_forward_list_value_is_already_linked);
+
+      Item other;
+      CHECK_THROW(list.push_front(other), etl::intrusive_index_forward_list_out_of_range);
+
+      list.pop_front();
+      CHECK_EQUAL(2U, list.size());
+      CHECK_EQUAL(1, list.front().value);
+      CHECK(!static_cast<Link0&>(items[0]).is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_remove_reverse)
+    {
+      Item items[6];
+      for (int i = 0; i < 6; ++i) { items[i].value = i; }
+
+      List0 list(items, 6U);
+
+      List0::iterator itr = list.insert_after(list.before_begin(), items[0]);
+      itr = list.insert_after(itr, items[1]);
+      itr = list.insert_after(itr, items[3]);
+      list.insert_after(list.begin(), items[2]);
+      list.insert_after(itr, items[4]);
+
+      int expected1[] = { 0, 2, 1, 3, 4 };
+      CHECK(values_of(list) == std::vector<int>(expected1, expected1 + 5));
+
+      itr = list.erase_after(list.begin());
+      CHECK_EQUAL(1, itr->value);
+
+      list.remove(items[3]);
+      list.remove(items[3]);
+      list.remove(items[5]);
+      int expected2[] = { 0, 1, 4 };
+      CHECK(values_of(list) == std::vector<int>(expected2, expected2 + 3));
+
+      list.reverse();
+      int expected3[] = { 4, 1, 0 };
+      CHECK(values_of(list) == std::vector<int>(expected3, expected3 + 3));
+
+      list.clear();
+      CHECK(list.empty());
+      CHECK(!static_cast<Link0&>(items[4]).is_linked());
+    }
+
+    //*************************************************************************
+    TEST(test_node_in_two_lists)
+    {
+      Item items[4];
+      for (int i = 0; i < 4; ++i) { items[i].value = i; }
+
+      List0 list0(items);
+      List1 list1(items);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        list0.push_front(items[i]);
+      }
+
+      list1.push_front(items[3]);
+      list1.push_front(items[1]);
+
+      int expected0[] = { 3, 2, 1, 0 };
+      int expected1[] = { 1, 3 };
+      CHECK(values_of(list0) == std::vector<int>(expected0, expected0 + 4));
+      CHECK(values_of(list1) == std::vector<int>(expected1, expected1 + 2));
+    }
+
+    //*************************************************************************
+    TEST(test_rebase_after_moving_the_nodes)
+    {
+      Item items1[4];
+      Item items2[4];
+      for (int i = 0; i < 4; ++i) { items1[i].value = i; }
+
+      List0 list(items1);
+      list.push_front(items1[2]);
+      list.push_front(items1[0]);
+      list.push_front(items1[3]);
+
+      // Move the nodes, as when shared memory is mapped at another address.
+      memcpy(static_cast<void*>(items2), static_cast<const void*>(items1), sizeof(items1));
+      memset(static_cast<void*>(items1), 0, sizeof(items1));
+      list.rebase(items2);
+
+      CHECK(list.base() == items2);
+
+      int expected[] = { 3, 0, 2 };
+      CHECK(values_of(list) == std::vector<int>(expected, expected + 3));
+
+      list.remove(items2[0]);
+      list.push_front(items2[1]);
+
+      int expected2[] = { 1, 3, 2 };
+      CHECK(values_of(list) == std::vector<int>(expected2, expected2 + 3));
+    }
+  }
+}
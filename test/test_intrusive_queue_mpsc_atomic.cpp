@@ -0,0 +1,189 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_queue_mpsc_atomic.h"
+#include "etl/intrusive_queue.h"
+#include "etl/intrusive_links.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    Data(int producer_ = 0, int sequence_ = 0)
+      : producer(producer_)
+      , sequence(sequence_)
+    {
+    }
+
+    int producer;
+    int sequence;
+  };
+
+  typedef etl::intrusive_queue_mpsc_atomic<Data, link0> Queue;
+
+  SUITE(test_intrusive_queue_mpsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK(queue.front() == ETL_NULLPTR);
+      CHECK(queue.pop() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_fifo)
+    {
+      Data data[6] = { Data(0, 1), Data(0, 2), Data(0, 3), Data(0, 4), Data(0, 5), Data(0, 6) };
+      Queue queue;
+
+      queue.push_back(data[0]);
+      queue.push_back(data[1]);
+      queue.push_back(data[2]);
+
+      CHECK(!queue.empty());
+      CHECK_EQUAL(1, queue.front()->sequence);
+      CHECK_EQUAL(1, queue.pop()->sequence);
+
+      // Values pushed while the consumer still has a batch come after it.
+      queue.push_back(data[3]);
+      queue.push_back(data[4]);
+
+      CHECK_EQUAL(2, queue.pop()->sequence);
+      CHECK_EQUAL(3, queue.pop()->sequence);
+
+      queue.push_back(data[5]);
+
+      CHECK_EQUAL(4, queue.pop()->sequence);
+      CHECK_EQUAL(5, queue.pop()->sequence);
+
+      Data* p_data = queue.pop();
+      CHECK_EQUAL(6, p_data->sequence);
+      CHECK(!p_data->is_linked());
+
+      CHECK(queue.empty());
+      CHECK(queue.pop() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_push_already_linked)
+    {
+      Data data;
+      Queue queue;
+
+      queue.push_back(data);
+      CHECK_THROW(queue.push_back(data), etl::intrusive_queue_value_is_already_linked);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_into)
+    {
+      Data data[2] = { Data(0, 1), Data(0, 2) };
+      Queue queue;
+      etl::intrusive_queue<Data, link0> destination;
+
+      queue.push_back(data[0]);
+      queue.push_back(data[1]);
+
+      CHECK(queue.pop_into(destination));
+      CHECK(queue.pop_into(destination));
+      CHECK(!queue.pop_into(destination));
+
+      CHECK_EQUAL(2U, destination.size());
+      CHECK_EQUAL(1, destination.front().sequence);
+      CHECK_EQUAL(2, destination.back().sequence);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      static const int Producers = 4;
+      static const int Count     = 20000;
+
+      std::vector<Data> data(Producers * Count);
+      Queue queue;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&data, &queue, p]()
+        {
+          for (int i = 0; i < Count; ++i)
+          {
+            Data& value = data[size_t((p * Count) + i)];
+            value.producer = p;
+            value.sequence = i;
+            queue.push_back(value);
+          }
+        }));
+      }
+
+      int  next[Producers] = { 0, 0, 0, 0 };
+      int  received = 0;
+      bool in_order = true;
+
+      while (received < (Producers * Count))
+      {
+        Data* p_data = queue.pop();
+
+        if (p_data != ETL_NULLPTR)
+        {
+          in_order = in_order && (p_data->sequence == next[p_data->producer]);
+          ++next[p_data->producer];
+          ++received;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t i = 0; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,210 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/intrusive_stack_atomic.h"
+#include "etl/intrusive_stack.h"
+#include "etl/intrusive_links.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::forward_link<0> link0;
+
+  struct Data : public link0
+  {
+    Data(int i_ = 0)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  typedef etl::intrusive_stack_atomic<Data, link0> Stack;
+
+  SUITE(test_intrusive_stack_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Stack stack;
+
+      CHECK(stack.empty());
+      CHECK(stack.pop() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Data data[4] = { Data(1), Data(2), Data(3), Data(4) };
+      Stack stack;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        stack.push_back(data[i]);
+        CHECK(data[i].is_linked());
+      }
+
+      CHECK(!stack.empty());
+
+      for (int i = 4; i > 0; --i)
+      {
+        Data* p_data = stack.pop();
+        CHECK(p_data != ETL_NULLPTR);
+        CHECK_EQUAL(i, p_data->i);
+        CHECK(!p_data->is_linked());
+      }
+
+      CHECK(stack.empty());
+      CHECK(stack.pop() == ETL_NULLPTR);
+
+      // The values may be pushed again.
+      stack.push_back(data[0]);
+      CHECK_EQUAL(1, stack.pop()->i);
+    }
+
+    //*************************************************************************
+    TEST(test_push_already_linked)
+    {
+      Data data(1);
+      Stack stack;
+
+      stack.push_back(data);
+      CHECK_THROW(stack.push_back(data), etl::intrusive_stack_value_is_already_linked);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_all_into)
+    {
+      Data data[3] = { Data(1), Data(2), Data(3) };
+      Stack stack;
+      etl::intrusive_stack<Data, link0> destination;
+
+      stack.push_back(data[0]);
+      stack.push_back(data[1]);
+      stack.push_back(data[2]);
+
+      stack.pop_all_into(destination);
+
+      CHECK(stack.empty());
+      CHECK_EQUAL(3U, destination.size());
+
+      // Top first in to a stack reverses the order.
+      CHECK_EQUAL(1, destination.top().i); destination.pop();
+      CHECK_EQUAL(2, destination.top().i); destination.pop();
+      CHECK_EQUAL(3, destination.top().i); destination.pop();
+    }
+
+    //*************************************************************************
+    TEST(test_free_list_threads)
+    {
+      // Producers return values to a free list that a single consumer takes from.
+      static const size_t Count = 1000;
+      static const int    Rounds = 20;
+
+      std::vector<Data> data(Count);
+      Stack free_list;
+      Stack in_use;
+
+      for (size_t i = 0; i < Count; ++i)
+      {
+        data[i].i = int(i);
+        free_list.push_back(data[i]);
+      }
+
+      std::atomic<bool> done(false);
+
+      // Releases values in use back to the free list.
+      std::thread releaser([&]()
+      {
+        etl::intrusive_stack<Data, link0> released;
+
+        while (!done.load() || !in_use.empty())
+        {
+          in_use.pop_all_into(released);
+
+          while (!released.empty())
+          {
+            Data& value = released.top();
+            released.pop();
+            free_list.push_back(value);
+          }
+
+          std::this_thread::yield();
+        }
+      });
+
+      size_t taken = 0;
+
+      for (int round = 0; round < Rounds; ++round)
+      {
+        for (size_t i = 0; i < Count; )
+        {
+          Data* p_data = free_list.pop();
+
+          if (p_data != ETL_NULLPTR)
+          {
+            in_use.push_back(*p_data);
+            ++taken;
+            ++i;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      }
+
+      done.store(true);
+      releaser.join();
+
+      CHECK_EQUAL(Count * Rounds, taken);
+
+      std::vector<bool> seen(Count, false);
+      size_t free_count = 0;
+
+      while (Data* p_data = free_list.pop())
+      {
+        CHECK(!seen[size_t(p_data->i)]);
+        seen[size_t(p_data->i)] = true;
+        ++free_count;
+      }
+
+      CHECK_EQUAL(Count, free_count);
+    }
+  }
+}
+
+#endif
@@ -73,6 +73,57 @@ namespace
   etl::io_port_ro<uint8_t>  iop_ro;
   etl::io_port_wo<uint8_t>  iop_wo;
   etl::io_port_wos<uint8_t> iop_wos;
+
+  //***************************************************************************
+  /// A DMA engine that records the transfer and completes it later.
+  //***************************************************************************
+  struct fake_dma
+  {
+    fake_dma()
+      : accept(true)
+      , started(0U)
+    {
+    }
+
+    bool start(const etl::io_port_transfer& transfer_)
+    {
+      if (accept)
+      {
+        transfer = transfer_;
+        ++started;
+      }
+
+      return accept;
+    }
+
+    void complete()
+    {
+      transfer.completion(transfer.count);
+    }
+
+    bool                   accept;
+    int                    started;
+    etl::io_port_transfer  transfer;
+  };
+
+  //***************************************************************************
+  struct completion_record
+  {
+    completion_record()
+      : calls(0)
+      , count(0U)
+    {
+    }
+
+    void on_complete(size_t count_)
+    {
+      ++calls;
+      count = count_;
+    }
+
+    int    calls;
+    size_t count;
+  };
 }
 
 namespace
@@ -217,5 +268,144 @@ namespace
     //  *p_wos = 1;
     //  c = *p_wos;
     }
+
+    //*************************************************************************
+    TEST(test_burst_read)
+    {
+      uint32_t fifo = 0x12345678UL;
+
+      etl::io_port_ro<uint32_t> rx(&fifo);
+      etl::io_port_rw<uint32_t> rw_port(&fifo);
+
+      std::array<uint32_t, 11> data;
+      data.fill(0U);
+
+      rx.read(etl::span<uint32_t>(data));
+      CHECK(std::count(data.begin(), data.end(), 0x12345678UL) == 11);
+
+      fifo = 0xAAU;
+      rw_port.read(etl::span<uint32_t>(data.data(), 3U));
+      CHECK_EQUAL(0xAAU, data[0]);
+      CHECK_EQUAL(0xAAU, data[2]);
+      CHECK_EQUAL(0x12345678UL, data[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_burst_write)
+    {
+      uint16_t fifo = 0U;
+
+      etl::io_port_wo<uint16_t>  tx(&fifo);
+      etl::io_port_rw<uint16_t>  rw_port(&fifo);
+      etl::io_port_wos<uint16_t> wos_port(&fifo);
+
+      const std::array<uint16_t, 6> data = { 1U, 2U, 3U, 4U, 5U, 6U };
+
+      tx.write(etl::span<const uint16_t>(data));
+      CHECK_EQUAL(6U, fifo);
+
+      rw_port.write(etl::span<const uint16_t>(data.data(), 5U));
+      CHECK_EQUAL(5U, fifo);
+
+      wos_port.write(etl::span<const uint16_t>(data.data(), 2U));
+      CHECK_EQUAL(2U, fifo);
+      CHECK_EQUAL(2U, wos_port.read());
+
+      wos_port.write(etl::span<const uint16_t>());
+      CHECK_EQUAL(2U, wos_port.read());
+    }
+
+    //*************************************************************************
+    TEST(test_dma_read)
+    {
+      uint8_t fifo = 0x5AU;
+      etl::io_port_ro<uint8_t> rx(&fifo);
+
+      fake_dma          dma;
+      completion_record record;
+
+      etl::io_port_dma                          engine     = etl::io_port_dma::create<fake_dma, &fake_dma::start>(dma);
+      etl::io_port_transfer::completion_type    completion = etl::io_port_transfer::completion_type::create<completion_record, &completion_record::on_complete>(record);
+
+      std::array<uint8_t, 8> data;
+      data.fill(0U);
+
+      CHECK(rx.read(etl::span<uint8_t>(data), engine, completion));
+      CHECK_EQUAL(1, dma.started);
+      CHECK_EQUAL(int(etl::io_port_transfer::Read), int(dma.transfer.direction));
+      CHECK(dma.transfer.port == reinterpret_cast<uintptr_t>(&fifo));
+      CHECK(dma.transfer.buffer == data.data());
+      CHECK_EQUAL(8U, dma.transfer.count);
+      CHECK_EQUAL(1U, dma.transfer.element_size);
+      CHECK_EQUAL(0U, data[0]);
+      CHECK_EQUAL(0, record.calls);
+
+      dma.complete();
+      CHECK_EQUAL(1, record.calls);
+      CHECK_EQUAL(8U, record.count);
+
+      // The engine is busy, so the port reads the values itself.
+      dma.accept = false;
+      CHECK(!rx.read(etl::span<uint8_t>(data), engine, completion));
+      CHECK_EQUAL(0x5AU, data[0]);
+      CHECK_EQUAL(0x5AU, data[7]);
+      CHECK_EQUAL(2, record.calls);
+
+      // No engine.
+      CHECK(!rx.read(etl::span<uint8_t>(data), etl::io_port_dma(), etl::io_port_transfer::completion_type()));
+    }
+
+    //*************************************************************************
+    TEST(test_dma_write)
+    {
+      uint32_t fifo = 0U;
+      etl::io_port_wos<uint32_t> tx(&fifo);
+
+      fake_dma          dma;
+      completion_record record;
+
+      etl::io_port_dma                       engine     = etl::io_port_dma::create<fake_dma, &fake_dma::start>(dma);
+      etl::io_port_transfer::completion_type completion = etl::io_port_transfer::completion_type::create<completion_record, &completion_record::on_complete>(record);
+
+      const std::array<uint32_t, 3> data = { 7U, 8U, 9U };
+
+      CHECK(tx.write(etl::span<const uint32_t>(data), engine, completion));
+      CHECK_EQUAL(int(etl::io_port_transfer::Write), int(dma.transfer.direction));
+      CHECK(dma.transfer.data == data.data());
+      CHECK_EQUAL(3U, dma.transfer.count);
+      CHECK_EQUAL(4U, dma.transfer.element_size);
+      CHECK_EQUAL(0U, fifo);
+      CHECK_EQUAL(9U, tx.read());
+
+      dma.accept = false;
+      CHECK(!tx.write(etl::span<const uint32_t>(data.data(), 2U), engine, completion));
+      CHECK_EQUAL(8U, fifo);
+      CHECK_EQUAL(1, record.calls);
+      CHECK_EQUAL(2U, record.count);
+    }
+
+    //*************************************************************************
+    TEST(test_burst_static_address_compiles)
+    {
+      volatile bool never = false;
+
+      if (never)
+      {
+        serial_port<0x1234U> port;
+        uint8_t  bytes[4];
+        uint16_t words[4];
+
+        port.rxdata.read(etl::span<uint8_t>(bytes));
+        port.rxdata.read(etl::span<uint8_t>(bytes), etl::io_port_dma(), etl::io_port_transfer::completion_type());
+        port.txdata.write(etl::span<const uint8_t>(bytes));
+        port.txdata.write(etl::span<const uint8_t>(bytes), etl::io_port_dma(), etl::io_port_transfer::completion_type());
+        port.control.read(etl::span<uint16_t>(words));
+        port.control.write(etl::span<const uint16_t>(words));
+        port.control.read(etl::span<uint16_t>(words), etl::io_port_dma(), etl::io_port_transfer::completion_type());
+        port.control.write(etl::span<const uint16_t>(words), etl::io_port_dma(), etl::io_port_transfer::completion_type());
+        port.control2.write(etl::span<const uint8_t>(bytes));
+        port.control2.write(etl::span<const uint8_t>(bytes), etl::io_port_dma(), etl::io_port_transfer::completion_type());
+      }
+    }
   };
 }
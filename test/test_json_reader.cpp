@@ -0,0 +1,375 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/json_reader.h"
+#include "etl/string.h"
+#include "etl/bip_buffer_spsc_atomic.h"
+
+#include <string>
+#include <vector>
+#include <string.h>
+
+namespace
+{
+  const char document[] = "{ \"name\" : \"sensor \\\"A\\\"\", \"id\":42, \"gain\" : -1.25e2,"
+                          " \"flags\": [true, false, null], \"nested\" : { \"empty\" : [] , \"obj\" : {} } }";
+
+  //*************************************************************************
+  // Renders a token as a short string for comparing sequences.
+  std::string describe(const etl::json_token& token)
+  {
+    std::string result(token.type.c_str());
+
+    if ((token.type == etl::json_token_type::Key) ||
+        (token.type == etl::json_token_type::String) ||
+        (token.type == etl::json_token_type::Number))
+    {
+      result += ':';
+      result += std::string(token.text.data(), token.text.size());
+    }
+
+    return result;
+  }
+
+  //*************************************************************************
+  // Reads the whole of the text, fed in chunks of the given size.
+  template <typename TReader>
+  std::vector<std::string> read_all(TReader& reader, const char* text, size_t length, size_t chunk_size)
+  {
+    std::vector<std::string> tokens;
+
+    size_t position = 0U;
+
+    while (true)
+    {
+      etl::json_token token = reader.next();
+
+      if (token.type == etl::json_token_type::Need_More)
+      {
+        if (position == length)
+        {
+          reader.finish();
+        }
+        else
+        {
+          const size_t size = etl::min(chunk_size, length - position);
+
+          // Copy each chunk so that stale views would be noticed.
+          static char chunk[256];
+          memcpy(chunk, text + position, size);
+          memset(chunk + size, '#', sizeof(chunk) - size);
+          reader.feed(etl::string_view(chunk, size));
+          position += size;
+        }
+      }
+      else
+      {
+        tokens.push_back(describe(token));
+
+        if ((token.type == etl::json_token_type::End_Of_Input) || (token.type == etl::json_token_type::Error))
+        {
+          break;
+        }
+      }
+    }
+
+    return tokens;
+  }
+
+  //*************************************************************************
+  std::vector<std::string> expected_document()
+  {
+    const char* expected[] =
+    {
+      "Begin_Object",
+        "Key:name",   "String:sensor \\\"A\\\"",
+        "Key:id",     "Number:42",
+        "Key:gain",   "Number:-1.25e2",
+        "Key:flags",  "Begin_Array", "True", "False", "Null", "End_Array",
+        "Key:nested", "Begin_Object",
+          "Key:empty", "Begin_Array", "End_Array",
+          "Key:obj",   "Begin_Object", "End_Object",
+        "End_Object",
+      "End_Object",
+      "End_Of_Input"
+    };
+
+    return std::vector<std::string>(expected, expected + (sizeof(expected) / sizeof(expected[0])));
+  }
+
+  SUITE(test_json_reader)
+  {
+    //*************************************************************************
+    TEST(test_whole_document)
+    {
+      etl::json_reader<4U> reader;
+
+      std::vector<std::string> tokens = read_all(reader, document, sizeof(document) - 1U, sizeof(document));
+
+      CHECK(expected_document() == tokens);
+      CHECK_EQUAL(etl::json_error::None, reader.error());
+      CHECK_EQUAL(sizeof(document) - 1U, reader.position());
+    }
+
+    //*************************************************************************
+    TEST(test_every_chunk_size)
+    {
+      for (size_t chunk_size = 1U; chunk_size < sizeof(document); ++chunk_size)
+      {
+        etl::json_reader<4U, 16U> reader;
+
+        std::vector<std::string> tokens = read_all(reader, document, sizeof(document) - 1U, chunk_size);
+
+        CHECK(expected_document() == tokens);
+        CHECK_EQUAL(sizeof(document) - 1U, reader.position());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_views_into_input)
+    {
+      const char text[] = "[\"abc\", 12]";
+
+      etl::json_reader<2U> reader(etl::string_view(text, sizeof(text) - 1U));
+
+      CHECK_EQUAL(etl::json_token_type::Begin_Array, reader.next().type);
+
+      etl::json_token token = reader.next();
+      CHECK_EQUAL(etl::json_token_type::String, token.type);
+      CHECK(token.text.data() == (text + 2));
+      CHECK_EQUAL(3U, token.text.size());
+      CHECK_FALSE(token.has_escapes);
+
+      token = reader.next();
+      CHECK_EQUAL(etl::json_token_type::Number, token.type);
+      CHECK_EQUAL(12, token.as<int>().value());
+      CHECK_TRUE(token.as<double>().has_value());
+
+      CHECK_EQUAL(etl::json_token_type::End_Array, reader.next().type);
+      CHECK_EQUAL(etl::json_token_type::Need_More, reader.next().type);
+
+      reader.finish();
+      CHECK_EQUAL(etl::json_token_type::End_Of_Input, reader.next().type);
+    }
+
+    //*************************************************************************
+    TEST(test_numbers)
+    {
+      const char* valid[]   = { "0", "-0", "7", "-12", "3.5", "1e3", "1E+3", "2.5e-3", "-0.0" };
+      const char* invalid[] = { "-", "01", "1.", ".5", "1e", "1e+", "+1", "1.2.3", "--1", "1-" };
+
+      for (size_t i = 0U; i < (sizeof(valid) / sizeof(valid[0])); ++i)
+      {
+        etl::json_reader<1U> reader(etl::string_view(valid[i]));
+        reader.finish();
+
+        etl::json_token token = reader.next();
+        CHECK_EQUAL(etl::json_token_type::Number, token.type);
+        CHECK_EQUAL(etl::json_token_type::End_Of_Input, reader.next().type);
+      }
+
+      for (size_t i = 0U; i < (sizeof(invalid) / sizeof(invalid[0])); ++i)
+      {
+        etl::json_reader<1U> reader(etl::string_view(invalid[i]));
+        reader.finish();
+
+        CHECK_EQUAL(etl::json_token_type::Error, reader.next().type);
+        CHECK_EQUAL(etl::json_error::Syntax, reader.error());
+      }
+
+      etl::json_reader<1U> reader(etl::string_view("-1.25e2 "));
+      etl::json_token token = reader.next();
+
+      CHECK_CLOSE(-125.0, token.as<double>().value(), 1e-9);
+      CHECK_EQUAL(-125, etl::json_reader<1U>(etl::string_view("-125 ")).next().as<int>().value());
+      CHECK_FALSE(token.as<int>().has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_documents)
+    {
+      const char text[] = "{\"a\":1}\n{\"a\":2}\n";
+
+      etl::json_reader<2U> reader;
+
+      std::vector<std::string> tokens = read_all(reader, text, sizeof(text) - 1U, 5U);
+
+      const char* expected[] = { "Begin_Object", "Key:a", "Number:1", "End_Object",
+                                 "Begin_Object", "Key:a", "Number:2", "End_Object", "End_Of_Input" };
+
+      CHECK(std::vector<std::string>(expected, expected + 9) == tokens);
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      struct error_case
+      {
+        const char*                 text;
+        etl::json_error::enum_type  error;
+        size_t                      position;
+      };
+
+      const error_case cases[] =
+      {
+        { "[1 2]",              etl::json_error::Syntax,         3U },
+        { "[1,]",               etl::json_error::Syntax,         3U },
+        { "{\"a\" 1}",          etl::json_error::Syntax,         5U },
+        { "{1:2}",              etl::json_error::Syntax,         1U },
+        { "{\"a\":1]",          etl::json_error::Syntax,         6U },
+        { "]",                  etl::json_error::Syntax,         0U },
+        { "[tru]",              etl::json_error::Syntax,         4U },
+        { "\"a\\x\"",           etl::json_error::Syntax,         3U },
+        { "\"\\u12G4\"",        etl::json_error::Syntax,         5U },
+        { "\"a\nb\"",           etl::json_error::Syntax,         2U },
+        { "[[[1]]]",            etl::json_error::Too_Deep,       2U },
+        { "[1",                 etl::json_error::Unexpected_End, 2U },
+        { "\"abc",              etl::json_error::Unexpected_End, 4U },
+        { "{\"a\":",            etl::json_error::Unexpected_End, 5U },
+      };
+
+      for (size_t i = 0U; i < (sizeof(cases) / sizeof(cases[0])); ++i)
+      {
+        etl::json_reader<2U> reader;
+
+        std::vector<std::string> tokens = read_all(reader, cases[i].text, strlen(cases[i].text), 100U);
+
+        CHECK_EQUAL(std::string("Error"), tokens.back());
+        CHECK_EQUAL(cases[i].error, reader.error());
+        CHECK_EQUAL(cases[i].position, reader.position());
+
+        // Errors are sticky.
+        CHECK_EQUAL(etl::json_token_type::Error, reader.next().type);
+
+        reader.reset();
+        reader.feed(etl::string_view("[]"));
+        CHECK_EQUAL(etl::json_token_type::Begin_Array, reader.next().type);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_token_too_long)
+    {
+      const char text[] = "[\"0123456789\"]";
+
+      etl::json_reader<2U, 8U> reader;
+
+      // Whole in one chunk, so no copy is needed.
+      std::vector<std::string> tokens = read_all(reader, text, sizeof(text) - 1U, 100U);
+      CHECK_EQUAL(std::string("End_Of_Input"), tokens.back());
+
+      // Split, and too long for the carry buffer.
+      reader.reset();
+      tokens = read_all(reader, text, sizeof(text) - 1U, 5U);
+      CHECK_EQUAL(std::string("Error"), tokens.back());
+      CHECK_EQUAL(etl::json_error::Token_Too_Long, reader.error());
+    }
+
+    //*************************************************************************
+    TEST(test_unescape)
+    {
+      etl::string<32> text;
+
+      CHECK_TRUE(etl::json_unescape(etl::string_view("a\\\"b\\\\c\\/d\\n\\t"), text));
+      CHECK_EQUAL(std::string("a\"b\\c/d\n\t"), std::string(text.c_str()));
+
+      text.clear();
+      CHECK_TRUE(etl::json_unescape(etl::string_view("\\u00e9\\u20AC\\uD83D\\uDE00"), text));
+      CHECK_EQUAL(std::string("\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"), std::string(text.c_str()));
+
+      text.clear();
+      CHECK_FALSE(etl::json_unescape(etl::string_view("\\uD83D"), text));
+      CHECK_FALSE(etl::json_unescape(etl::string_view("\\uDE00"), text));
+      CHECK_FALSE(etl::json_unescape(etl::string_view("\\uD83D\\u0041"), text));
+      CHECK_FALSE(etl::json_unescape(etl::string_view("\\q"), text));
+
+      etl::string<2> small;
+      CHECK_FALSE(etl::json_unescape(etl::string_view("\\u20AC"), small));
+      CHECK_TRUE(small.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_stream_from_bip_buffer)
+    {
+      etl::bip_buffer_spsc_atomic<char, 16U> bip;
+      etl::json_reader<4U, 16U> reader;
+
+      const size_t length   = sizeof(document) - 1U;
+      size_t       written  = 0U;
+
+      std::vector<std::string> tokens;
+
+      while (true)
+      {
+        // Producer
+        if (written < length)
+        {
+          etl::span<char> space = bip.write_reserve_optimal(1U);
+          const size_t    size  = etl::min(space.size(), length - written);
+
+          memcpy(space.data(), document + written, size);
+          bip.write_commit(space.first(size));
+          written += size;
+        }
+
+        // Consumer
+        etl::span<char> data = bip.read_reserve();
+
+        if (data.empty() && (written == length))
+        {
+          reader.finish();
+        }
+
+        reader.feed(etl::string_view(data.data(), data.size()));
+
+        etl::json_token token;
+
+        for (token = reader.next(); token.type != etl::json_token_type::Need_More; token = reader.next())
+        {
+          tokens.push_back(describe(token));
+
+          if ((token.type == etl::json_token_type::End_Of_Input) || (token.type == etl::json_token_type::Error))
+          {
+            break;
+          }
+        }
+
+        bip.read_commit(data);
+
+        if (token.type != etl::json_token_type::Need_More)
+        {
+          break;
+        }
+      }
+
+      CHECK(expected_document() == tokens);
+    }
+  };
+}
@@ -2224,5 +2224,55 @@ namespace
 
       CHECK_THROW(data0.merge(data1), etl::list_unsorted);
     }
+
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    TEST(test_memory_statistics_for_shared_pool)
+    {
+      etl::pool<DataInt::pool_type, SIZE> int_pool;
+
+      DataInt data1(int_pool);
+      DataInt data2(int_pool);
+
+      for (int i = 0; i < 6; ++i)
+      {
+        data1.push_back(i);
+      }
+
+      data1.resize(2U);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data2.push_back(i);
+      }
+
+      CHECK_EQUAL(2U, data1.get_memory_statistics().current_size());
+      CHECK_EQUAL(6U, data1.get_memory_statistics().peak_size());
+      CHECK_EQUAL(6U, data1.get_memory_statistics().allocation_count());
+      CHECK_EQUAL(4U, data1.get_memory_statistics().release_count());
+
+      CHECK_EQUAL(4U, data2.get_memory_statistics().current_size());
+      CHECK_EQUAL(4U, data2.get_memory_statistics().peak_size());
+
+      CHECK_EQUAL(6U, int_pool.get_memory_statistics().current_size());
+      CHECK_EQUAL(6U, int_pool.get_memory_statistics().peak_size());
+
+      // Moving between lists on the same pool transfers the nodes.
+      DataInt data3(std::move(data2), int_pool);
+
+      CHECK_EQUAL(0U, data2.get_memory_statistics().current_size());
+      CHECK_EQUAL(4U, data3.get_memory_statistics().current_size());
+      CHECK_EQUAL(6U, int_pool.get_memory_statistics().current_size());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data1.push_back(i);
+      }
+
+      CHECK_EQUAL(10U, int_pool.get_memory_statistics().peak_size());
+      CHECK_EQUAL(6U, data1.get_memory_statistics().peak_size());
+      CHECK_EQUAL(10U, data1.get_memory_statistics().allocation_count());
+    }
+#endif
   };
 }
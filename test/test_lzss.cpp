@@ -0,0 +1,262 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/lzss.h"
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace
+{
+  typedef std::vector<uint8_t> Bytes;
+
+  //*************************************************************************
+  etl::span<const uint8_t> to_span(const Bytes& bytes)
+  {
+    return bytes.empty() ? etl::span<const uint8_t>() : etl::span<const uint8_t>(bytes.data(), bytes.size());
+  }
+
+  //*************************************************************************
+  Bytes make_log(size_t lines)
+  {
+    std::string text;
+
+    for (size_t i = 0U; i < lines; ++i)
+    {
+      text += "0000" + std::to_string(i * 7919U) + " INFO  modem: rssi=-" + std::to_string(60U + (i % 23U)) + " dBm state=";
+      text += ((i % 3U) == 0U) ? "connected\n" : "registering\n";
+    }
+
+    return Bytes(text.begin(), text.end());
+  }
+
+  //*************************************************************************
+  Bytes make_random(size_t length)
+  {
+    Bytes data;
+    uint32_t seed = 12345U;
+
+    for (size_t i = 0U; i < length; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+      data.push_back(uint8_t(seed >> 24));
+    }
+
+    return data;
+  }
+
+  //*************************************************************************
+  /// Compresses and decompresses with input and output in pieces.
+  //*************************************************************************
+  template <typename TCompressor, typename TDecompressor>
+  Bytes stream_round_trip(const Bytes& data, size_t input_chunk, size_t output_chunk, size_t& compressed_size)
+  {
+    static TCompressor compressor;
+    compressor.reset();
+
+    Bytes compressed;
+    std::vector<char> block(output_chunk);
+
+    size_t index = 0U;
+
+    while (index < data.size())
+    {
+      etl::byte_stream_writer writer(block.data(), block.size(), etl::endian::big);
+
+      const size_t n = std::min(input_chunk, data.size() - index);
+      index += compressor.compress(etl::span<const uint8_t>(data.data() + index, n), writer);
+
+      compressed.insert(compressed.end(), block.data(), block.data() + writer.size_bytes());
+    }
+
+    bool complete = false;
+
+    while (!complete)
+    {
+      etl::byte_stream_writer writer(block.data(), block.size(), etl::endian::big);
+      complete = compressor.finish(writer);
+      compressed.insert(compressed.end(), block.data(), block.data() + writer.size_bytes());
+    }
+
+    compressed_size = compressed.size();
+
+    TDecompressor decompressor;
+    Bytes result;
+    index = 0U;
+
+    while (index < compressed.size())
+    {
+      etl::byte_stream_writer writer(block.data(), block.size(), etl::endian::big);
+
+      const size_t n = std::min(input_chunk, compressed.size() - index);
+      index += decompressor.decompress(etl::span<const uint8_t>(compressed.data() + index, n), writer);
+
+      result.insert(result.end(), block.data(), block.data() + writer.size_bytes());
+    }
+
+    // Drain a match that is still being copied.
+    for (;;)
+    {
+      etl::byte_stream_writer writer(block.data(), block.size(), etl::endian::big);
+      decompressor.decompress(etl::span<const uint8_t>(), writer);
+
+      if (writer.size_bytes() == 0U)
+      {
+        break;
+      }
+
+      result.insert(result.end(), block.data(), block.data() + writer.size_bytes());
+    }
+
+    return result;
+  }
+
+  SUITE(test_lzss)
+  {
+    //*************************************************************************
+    TEST(test_known_stream)
+    {
+      const char text[] = "abcabcabcabc";
+      uint8_t compressed[32];
+      uint8_t output[32];
+
+      etl::lzss_compressor<> compressor;
+      size_t size = compressor.compress_all(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(text), 12U), etl::span<uint8_t>(compressed));
+
+      // Three literals then a match of 9 at a distance of 3.
+      const uint8_t expected[] = { 0x08, 'a', 'b', 'c', 0x00, 0x46 };
+      CHECK_EQUAL(sizeof(expected), size);
+      CHECK_ARRAY_EQUAL(expected, compressed, sizeof(expected));
+
+      size = etl::lzss_decompressor<>::decompress_all(etl::span<const uint8_t>(compressed, size), etl::span<uint8_t>(output));
+      CHECK_EQUAL(12U, size);
+      CHECK_ARRAY_EQUAL(text, output, 12U);
+    }
+
+    //*************************************************************************
+    TEST(test_compress_all_round_trip)
+    {
+      const Bytes log = make_log(400U);
+      Bytes compressed(etl::lzss_compressor<>::max_compressed_size(log.size()));
+      Bytes output(log.size());
+
+      static etl::lzss_compressor<> compressor;
+      size_t size = compressor.compress_all(to_span(log), etl::span<uint8_t>(compressed.data(), compressed.size()));
+
+      CHECK(size < (log.size() / 2U));
+
+      size = etl::lzss_decompressor<>::decompress_all(etl::span<const uint8_t>(compressed.data(), size), etl::span<uint8_t>(output.data(), output.size()));
+      CHECK_EQUAL(log.size(), size);
+      CHECK(log == output);
+
+      // Incompressible data grows by at most one byte in eight.
+      const Bytes random = make_random(5000U);
+      compressed.resize(etl::lzss_compressor<>::max_compressed_size(random.size()));
+      output.resize(random.size());
+
+      size = compressor.compress_all(to_span(random), etl::span<uint8_t>(compressed.data(), compressed.size()));
+      CHECK(size <= etl::lzss_compressor<>::max_compressed_size(random.size()));
+
+      size = etl::lzss_decompressor<>::decompress_all(etl::span<const uint8_t>(compressed.data(), size), etl::span<uint8_t>(output.data(), output.size()));
+      CHECK(random == output);
+    }
+
+    //*************************************************************************
+    TEST(test_streaming_round_trip)
+    {
+      const Bytes log    = make_log(600U);
+      const Bytes random = make_random(3000U);
+      const Bytes empty;
+
+      const size_t input_chunks[]  = { 1U, 7U, 100U, 5000U };
+      const size_t output_chunks[] = { 1U, 5U, 64U, 10000U };
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        for (size_t j = 0U; j < 4U; ++j)
+        {
+          size_t size;
+
+          CHECK((log == stream_round_trip<etl::lzss_compressor<>, etl::lzss_decompressor<> >(log, input_chunks[i], output_chunks[j], size)));
+          CHECK(size < (log.size() / 2U));
+
+          CHECK((random == stream_round_trip<etl::lzss_compressor<>, etl::lzss_decompressor<> >(random, input_chunks[i], output_chunks[j], size)));
+          CHECK((empty == stream_round_trip<etl::lzss_compressor<>, etl::lzss_decompressor<> >(empty, input_chunks[i], output_chunks[j], size)));
+          CHECK_EQUAL(0U, size);
+
+          // A small window, long matches and a short hash.
+          CHECK((log == stream_round_trip<etl::lzss_compressor<9U, 7U, 6U, 4U>, etl::lzss_decompressor<9U, 7U> >(log, input_chunks[i], output_chunks[j], size)));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_long_runs)
+    {
+      const Bytes zeroes(20000U, 0U);
+      size_t size;
+
+      CHECK((zeroes == stream_round_trip<etl::lzss_compressor<>, etl::lzss_decompressor<> >(zeroes, 333U, 17U, size)));
+
+      // Every item after the first is a maximum length match.
+      const size_t matches = (zeroes.size() - 1U + etl::lzss_compressor<>::Max_Match - 1U) / etl::lzss_compressor<>::Max_Match;
+      CHECK(size <= (1U + (2U * matches) + ((matches + 8U) / 8U)));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_stream)
+    {
+      // A match before any output.
+      const uint8_t stream[] = { 0x01, 0x00, 0x00 };
+      uint8_t output[16];
+
+      CHECK_THROW(etl::lzss_decompressor<>::decompress_all(etl::span<const uint8_t>(stream), etl::span<uint8_t>(output)), etl::lzss_invalid_stream);
+
+      etl::lzss_decompressor<> decompressor;
+      etl::byte_stream_writer writer(output, sizeof(output), etl::endian::big);
+      CHECK_THROW(decompressor.decompress(etl::span<const uint8_t>(stream), writer), etl::lzss_invalid_stream);
+    }
+
+    //*************************************************************************
+    TEST(test_overflow)
+    {
+      const char text[] = "abcabcabcabc";
+      uint8_t compressed[32];
+      uint8_t output[8];
+
+      etl::lzss_compressor<> compressor;
+      size_t size = compressor.compress_all(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(text), 12U), etl::span<uint8_t>(compressed));
+
+      CHECK_THROW(etl::lzss_decompressor<>::decompress_all(etl::span<const uint8_t>(compressed, size), etl::span<uint8_t>(output)), etl::lzss_overflow);
+      CHECK_THROW(compressor.compress_all(etl::span<const uint8_t>(reinterpret_cast<const uint8_t*>(text), 12U), etl::span<uint8_t>(compressed, 4U)), etl::lzss_overflow);
+    }
+  }
+}
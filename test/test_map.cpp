@@ -1631,5 +1631,35 @@ namespace
       CHECK(!data.contains(std::string("99")));
       CHECK(!data.contains(Key("99")));
     }
+
+#if defined(ETL_MEMORY_STATISTICS)
+    //*************************************************************************
+    TEST(test_memory_statistics)
+    {
+      etl::map<int, int, 4> data;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.insert(std::make_pair(i, i));
+      }
+
+      data.erase(1);
+      data.erase(2);
+      data[5] = 5;
+
+      CHECK_EQUAL(3U, data.get_memory_statistics().current_size());
+      CHECK_EQUAL(4U, data.get_memory_statistics().peak_size());
+      CHECK_EQUAL(5U, data.get_memory_statistics().allocation_count());
+      CHECK_EQUAL(2U, data.get_memory_statistics().release_count());
+
+      data.clear();
+      CHECK_EQUAL(0U, data.get_memory_statistics().current_size());
+      CHECK_EQUAL(5U, data.get_memory_statistics().release_count());
+
+      data.reset_memory_statistics();
+      CHECK_EQUAL(0U, data.get_memory_statistics().peak_size());
+      CHECK_EQUAL(0U, data.get_memory_statistics().allocation_count());
+    }
+#endif
   };
 }
@@ -0,0 +1,315 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/matrix.h"
+#include "etl/multi_array.h"
+
+#include <math.h>
+
+namespace
+{
+  typedef etl::matrix<double, 3, 3> Matrix3;
+  typedef etl::matrix<double, 6, 6> Matrix6;
+
+  //***********************************
+  // A simple reference multiply.
+  template <typename T, size_t VRows, size_t VInner, size_t VColumns>
+  etl::matrix<T, VRows, VColumns> reference_multiply(const etl::matrix<T, VRows, VInner>& lhs, const etl::matrix<T, VInner, VColumns>& rhs)
+  {
+    etl::matrix<T, VRows, VColumns> result;
+
+    for (size_t r = 0U; r < VRows; ++r)
+    {
+      for (size_t c = 0U; c < VColumns; ++c)
+      {
+        T sum = T(0);
+
+        for (size_t k = 0U; k < VInner; ++k)
+        {
+          sum += lhs(r, k) * rhs(k, c);
+        }
+
+        result(r, c) = sum;
+      }
+    }
+
+    return result;
+  }
+
+  //***********************************
+  template <typename TMatrix>
+  bool is_close(const TMatrix& lhs, const TMatrix& rhs, double tolerance)
+  {
+    for (size_t r = 0U; r < TMatrix::Rows; ++r)
+    {
+      for (size_t c = 0U; c < TMatrix::Columns; ++c)
+      {
+        if (fabs(lhs(r, c) - rhs(r, c)) > tolerance)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***********************************
+  template <size_t VRows, size_t VColumns>
+  etl::matrix<double, VRows, VColumns> make_matrix(uint32_t seed)
+  {
+    etl::matrix<double, VRows, VColumns> result;
+
+    for (size_t r = 0U; r < VRows; ++r)
+    {
+      for (size_t c = 0U; c < VColumns; ++c)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        result(r, c) = (double((seed >> 8) % 200U) / 10.0) - 10.0;
+      }
+    }
+
+    return result;
+  }
+
+  SUITE(test_matrix)
+  {
+    //*************************************************************************
+    TEST(test_construct_and_access)
+    {
+      const double values[2][3] = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+      etl::matrix<double, 2, 3> m(values);
+
+      CHECK_EQUAL(2U, (etl::matrix<double, 2, 3>::Rows));
+      CHECK_EQUAL(3U, (etl::matrix<double, 2, 3>::Columns));
+      CHECK_EQUAL(6.0, m(1, 2));
+
+      etl::multi_array<double, 2, 3> nested = m.data();
+      CHECK_EQUAL(4.0, nested[1][0]);
+
+      etl::matrix<double, 2, 3> from_nested(nested);
+      CHECK(from_nested == m);
+
+      etl::matrix<double, 2, 3> zero;
+      CHECK_EQUAL(0.0, zero(1, 1));
+      CHECK(zero != m);
+
+      CHECK(Matrix3::identity() == Matrix3::identity().transpose());
+      CHECK_EQUAL(1.0, Matrix3::identity()(2, 2));
+      CHECK_EQUAL(0.0, Matrix3::identity()(2, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_row_and_column_views)
+    {
+      const double values[2][3] = { { 1, 2, 3 }, { 4, 5, 6 } };
+
+      etl::matrix<double, 2, 3> m(values);
+
+      etl::matrix<double, 2, 3>::row_view row = m.row(1);
+      CHECK_EQUAL(3U, row.size());
+      CHECK_EQUAL(5.0, row[1]);
+      row[1] = 50.0;
+      CHECK_EQUAL(50.0, m(1, 1));
+
+      etl::matrix<double, 2, 3>::column_view column = m.column(2);
+      CHECK_EQUAL(2U, column.size());
+      CHECK_EQUAL(3.0, column[0]);
+      CHECK_EQUAL(6.0, column[1]);
+      column[0] = 30.0;
+      CHECK_EQUAL(30.0, m(0, 2));
+
+      double sum = 0.0;
+
+      for (etl::matrix<double, 2, 3>::column_view::iterator itr = column.begin(); itr != column.end(); ++itr)
+      {
+        sum += *itr;
+      }
+
+      CHECK_EQUAL(36.0, sum);
+
+      const etl::matrix<double, 2, 3>& cm = m;
+      CHECK_EQUAL(50.0, cm.row(1)[1]);
+      CHECK_EQUAL(4.0, cm.column(0)[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_transpose)
+    {
+      const etl::matrix<double, 2, 5> m = make_matrix<2, 5>(1);
+      const etl::matrix<double, 5, 2> t = m.transpose();
+
+      for (size_t r = 0U; r < 2U; ++r)
+      {
+        for (size_t c = 0U; c < 5U; ++c)
+        {
+          CHECK_EQUAL(m(r, c), t(c, r));
+        }
+      }
+
+      CHECK(t.transpose() == m);
+    }
+
+    //*************************************************************************
+    TEST(test_arithmetic)
+    {
+      const Matrix3 a = make_matrix<3, 3>(2);
+      const Matrix3 b = make_matrix<3, 3>(3);
+
+      const Matrix3 sum        = a + b;
+      const Matrix3 difference = a - b;
+      const Matrix3 scaled     = a * 2.0;
+
+      CHECK_EQUAL(a(1, 2) + b(1, 2), sum(1, 2));
+      CHECK_EQUAL(a(2, 0) - b(2, 0), difference(2, 0));
+      CHECK_EQUAL(a(0, 1) * 2.0, scaled(0, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_multiply)
+    {
+      // Sizes that are and are not whole tiles of rows.
+      CHECK(is_close(reference_multiply(make_matrix<3, 3>(4), make_matrix<3, 3>(5)), make_matrix<3, 3>(4) * make_matrix<3, 3>(5), 1e-9));
+      CHECK(is_close(reference_multiply(make_matrix<4, 4>(6), make_matrix<4, 4>(7)), make_matrix<4, 4>(6) * make_matrix<4, 4>(7), 1e-9));
+      CHECK(is_close(reference_multiply(make_matrix<6, 6>(8), make_matrix<6, 6>(9)), make_matrix<6, 6>(8) * make_matrix<6, 6>(9), 1e-9));
+      CHECK(is_close(reference_multiply(make_matrix<9, 2>(10), make_matrix<2, 7>(11)), make_matrix<9, 2>(10) * make_matrix<2, 7>(11), 1e-9));
+
+      const Matrix6 m = make_matrix<6, 6>(12);
+      CHECK(m * Matrix6::identity() == m);
+    }
+
+    //*************************************************************************
+    TEST(test_multiply_vector)
+    {
+      const etl::matrix<double, 2, 3> m = make_matrix<2, 3>(13);
+
+      etl::array<double, 3> v = { { 1.0, -2.0, 0.5 } };
+      etl::array<double, 2> u = { { 3.0, -1.0 } };
+
+      const etl::array<double, 2> mv = m * v;
+      const etl::array<double, 3> um = u * m;
+
+      for (size_t r = 0U; r < 2U; ++r)
+      {
+        CHECK_CLOSE((m(r, 0) * v[0]) + (m(r, 1) * v[1]) + (m(r, 2) * v[2]), mv[r], 1e-12);
+      }
+
+      for (size_t c = 0U; c < 3U; ++c)
+      {
+        CHECK_CLOSE((u[0] * m(0, c)) + (u[1] * m(1, c)), um[c], 1e-12);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_determinant)
+    {
+      const double values[3][3] = { { 2, -3, 1 }, { 2, 0, -1 }, { 1, 4, 5 } };
+
+      CHECK_CLOSE(49.0, Matrix3(values).determinant(), 1e-12);
+
+      const double values2[2][2] = { { 3, 8 }, { 4, 6 } };
+      CHECK_CLOSE(-14.0, (etl::matrix<double, 2, 2>(values2).determinant()), 1e-12);
+
+      // Needs a row swap.
+      const double values4[4][4] = { { 0, 1, 0, 0 }, { 1, 0, 0, 0 }, { 0, 0, 2, 0 }, { 0, 0, 0, 3 } };
+      CHECK_CLOSE(-6.0, (etl::matrix<double, 4, 4>(values4).determinant()), 1e-12);
+
+      const double singular[3][3] = { { 1, 2, 3 }, { 2, 4, 6 }, { 1, 0, 1 } };
+      CHECK_CLOSE(0.0, Matrix3(singular).determinant(), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_inverse)
+    {
+      const etl::matrix<double, 1, 1> m1 = make_matrix<1, 1>(14) + etl::matrix<double, 1, 1>::identity() * 20.0;
+      const etl::matrix<double, 2, 2> m2 = make_matrix<2, 2>(15) + etl::matrix<double, 2, 2>::identity() * 20.0;
+      const etl::matrix<double, 3, 3> m3 = make_matrix<3, 3>(16) + etl::matrix<double, 3, 3>::identity() * 20.0;
+      const etl::matrix<double, 4, 4> m4 = make_matrix<4, 4>(17) + etl::matrix<double, 4, 4>::identity() * 20.0;
+      const etl::matrix<double, 6, 6> m6 = make_matrix<6, 6>(18) + etl::matrix<double, 6, 6>::identity() * 20.0;
+
+      etl::matrix<double, 1, 1> i1;
+      etl::matrix<double, 2, 2> i2;
+      etl::matrix<double, 3, 3> i3;
+      etl::matrix<double, 4, 4> i4;
+      etl::matrix<double, 6, 6> i6;
+
+      CHECK(m1.inverse(i1));
+      CHECK(m2.inverse(i2));
+      CHECK(m3.inverse(i3));
+      CHECK(m4.inverse(i4));
+      CHECK(m6.inverse(i6));
+
+      CHECK(is_close(m1 * i1, etl::matrix<double, 1, 1>::identity(), 1e-12));
+      CHECK(is_close(m2 * i2, etl::matrix<double, 2, 2>::identity(), 1e-12));
+      CHECK(is_close(m3 * i3, etl::matrix<double, 3, 3>::identity(), 1e-12));
+      CHECK(is_close(m4 * i4, etl::matrix<double, 4, 4>::identity(), 1e-12));
+      CHECK(is_close(m6 * i6, etl::matrix<double, 6, 6>::identity(), 1e-12));
+      CHECK(is_close(i6 * m6, etl::matrix<double, 6, 6>::identity(), 1e-12));
+    }
+
+    //*************************************************************************
+    TEST(test_inverse_singular)
+    {
+      const double singular3[3][3] = { { 1, 2, 3 }, { 2, 4, 6 }, { 1, 0, 1 } };
+      Matrix3 result = Matrix3::identity();
+
+      CHECK(!Matrix3(singular3).inverse(result));
+      CHECK(result == Matrix3::identity());
+
+      Matrix6 singular6 = make_matrix<6, 6>(19);
+      for (size_t c = 0U; c < 6U; ++c)
+      {
+        singular6(5, c) = singular6(2, c);
+      }
+
+      Matrix6 result6;
+      CHECK(!singular6.inverse(result6) || !is_close(singular6 * result6, Matrix6::identity(), 1e-6));
+    }
+
+    //*************************************************************************
+    TEST(test_kalman_covariance_update)
+    {
+      // P' = F P F^t + Q, for a constant velocity model.
+      const double f[4][4] = { { 1, 0, 1, 0 }, { 0, 1, 0, 1 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } };
+
+      const etl::matrix<double, 4, 4> F(f);
+      const etl::matrix<double, 4, 4> P = etl::matrix<double, 4, 4>::identity() * 2.0;
+      const etl::matrix<double, 4, 4> Q = etl::matrix<double, 4, 4>::identity() * 0.1;
+
+      const etl::matrix<double, 4, 4> next = (F * P * F.transpose()) + Q;
+
+      CHECK_CLOSE(4.1, next(0, 0), 1e-12);
+      CHECK_CLOSE(2.0, next(0, 2), 1e-12);
+      CHECK_CLOSE(2.0, next(2, 0), 1e-12);
+      CHECK_CLOSE(2.1, next(3, 3), 1e-12);
+    }
+  }
+}
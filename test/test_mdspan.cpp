@@ -0,0 +1,223 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/mdspan.h"
+
+#include <numeric>
+
+namespace
+{
+  SUITE(test_mdspan)
+  {
+    //*************************************************************************
+    TEST(test_layout_right)
+    {
+      int buffer[12];
+      std::iota(buffer, buffer + 12, 0);
+
+      etl::mdspan<int, 2> image(buffer, 3U, 4U);
+
+      CHECK_EQUAL(2U, image.rank());
+      CHECK_EQUAL(3U, image.extent(0));
+      CHECK_EQUAL(4U, image.extent(1));
+      CHECK_EQUAL(4U, image.stride(0));
+      CHECK_EQUAL(1U, image.stride(1));
+      CHECK_EQUAL(12U, image.size());
+      CHECK_EQUAL(12U, image.mapping().required_span_size());
+      CHECK_FALSE(image.empty());
+
+      for (size_t row = 0U; row < 3U; ++row)
+      {
+        for (size_t column = 0U; column < 4U; ++column)
+        {
+          CHECK_EQUAL(int((row * 4U) + column), image(row, column));
+        }
+      }
+
+      etl::array<size_t, 2> indices = { { 2U, 1U } };
+      CHECK_EQUAL(9, image[indices]);
+    }
+
+    //*************************************************************************
+    TEST(test_layout_left)
+    {
+      int buffer[12];
+      std::iota(buffer, buffer + 12, 0);
+
+      etl::array<size_t, 2> extents = { { 3U, 4U } };
+      etl::mdspan<int, 2, etl::layout_left> image(buffer, extents);
+
+      CHECK_EQUAL(1U, image.stride(0));
+      CHECK_EQUAL(3U, image.stride(1));
+
+      for (size_t row = 0U; row < 3U; ++row)
+      {
+        for (size_t column = 0U; column < 4U; ++column)
+        {
+          CHECK_EQUAL(int((column * 3U) + row), image(row, column));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_layout_stride)
+    {
+      int buffer[20];
+      std::iota(buffer, buffer + 20, 0);
+
+      // Every other element of a 2 x 10 buffer.
+      etl::array<size_t, 2> extents = { { 2U, 5U } };
+      etl::array<size_t, 2> strides = { { 10U, 2U } };
+
+      etl::layout_stride::mapping<2> map(extents, strides);
+      etl::mdspan<int, 2, etl::layout_stride> view(buffer, map);
+
+      CHECK_EQUAL(10U, view.size());
+      CHECK_EQUAL(19U, view.mapping().required_span_size());
+      CHECK_EQUAL(0,  view(0, 0));
+      CHECK_EQUAL(8,  view(0, 4));
+      CHECK_EQUAL(12, view(1, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_rank_three)
+    {
+      int buffer[24];
+      std::iota(buffer, buffer + 24, 0);
+
+      etl::mdspan<int, 3> volume(buffer, 2U, 3U, 4U);
+
+      CHECK_EQUAL(12U, volume.stride(0));
+      CHECK_EQUAL(4U,  volume.stride(1));
+      CHECK_EQUAL(1U,  volume.stride(2));
+      CHECK_EQUAL(23,  volume(1, 2, 3));
+      CHECK_EQUAL(17,  volume(1, 1, 1));
+    }
+
+    //*************************************************************************
+    TEST(test_rank_one)
+    {
+      int buffer[5] = { 1, 2, 3, 4, 5 };
+
+      etl::array<size_t, 1> extents = { { 5U } };
+      etl::mdspan<int, 1> view(buffer, extents);
+
+      CHECK_EQUAL(5U, view.size());
+      CHECK_EQUAL(4, view(3));
+    }
+
+    //*************************************************************************
+    TEST(test_subview_tile)
+    {
+      int buffer[6 * 8];
+      std::iota(buffer, buffer + 48, 0);
+
+      etl::mdspan<int, 2> image(buffer, 6U, 8U);
+
+      etl::array<size_t, 2> offsets = { { 2U, 3U } };
+      etl::array<size_t, 2> extents = { { 3U, 2U } };
+
+      etl::mdspan<int, 2, etl::layout_stride> tile = image.subview(offsets, extents);
+
+      CHECK_EQUAL(3U, tile.extent(0));
+      CHECK_EQUAL(2U, tile.extent(1));
+      CHECK_EQUAL(8U, tile.stride(0));
+      CHECK_EQUAL(1U, tile.stride(1));
+
+      for (size_t row = 0U; row < 3U; ++row)
+      {
+        for (size_t column = 0U; column < 2U; ++column)
+        {
+          CHECK_EQUAL(image(row + 2U, column + 3U), tile(row, column));
+        }
+      }
+
+      // Writes go through to the image.
+      tile(0, 0) = -1;
+      CHECK_EQUAL(-1, buffer[(2 * 8) + 3]);
+
+      // A tile of a tile.
+      etl::array<size_t, 2> inner_offsets = { { 1U, 1U } };
+      etl::array<size_t, 2> inner_extents = { { 2U, 1U } };
+
+      etl::mdspan<int, 2, etl::layout_stride> inner = tile.subview(inner_offsets, inner_extents);
+
+      CHECK_EQUAL(image(3, 4), inner(0, 0));
+      CHECK_EQUAL(image(4, 4), inner(1, 0));
+    }
+
+    //*************************************************************************
+    TEST(test_line)
+    {
+      int buffer[3 * 4];
+      std::iota(buffer, buffer + 12, 0);
+
+      etl::mdspan<int, 2> image(buffer, 3U, 4U);
+
+      etl::array<size_t, 2> column_start = { { 0U, 2U } };
+      etl::strided_span<int> column = image.line(0U, column_start);
+
+      CHECK_EQUAL(3U, column.size());
+      CHECK_EQUAL(2,  column[0]);
+      CHECK_EQUAL(6,  column[1]);
+      CHECK_EQUAL(10, column[2]);
+
+      etl::array<size_t, 2> row_start = { { 1U, 1U } };
+      etl::strided_span<int> row = image.line(1U, row_start);
+
+      CHECK_EQUAL(3U, row.size());
+      CHECK_EQUAL(5, row[0]);
+      CHECK_EQUAL(7, row[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_const_view)
+    {
+      int buffer[6] = { 0, 1, 2, 3, 4, 5 };
+
+      etl::mdspan<int, 2>       image(buffer, 2U, 3U);
+      etl::mdspan<const int, 2> const_image(image);
+
+      CHECK_EQUAL(5, const_image(1, 2));
+      CHECK_TRUE(const_image.mapping() == image.mapping());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      int buffer[1] = { 0 };
+
+      etl::mdspan<int, 2> image(buffer, 0U, 3U);
+
+      CHECK_TRUE(image.empty());
+      CHECK_EQUAL(0U, image.mapping().required_span_size());
+    }
+  };
+}
@@ -0,0 +1,328 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <vector>
+
+#include "etl/memory_block_cache.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/function.h"
+
+namespace
+{
+  class Access
+  {
+  public:
+
+    void lock()
+    {
+      ++lock_count;
+    }
+
+    void unlock()
+    {
+      ++unlock_count;
+    }
+
+    int lock_count   = 0;
+    int unlock_count = 0;
+  };
+
+  Access access;
+
+  etl::function_imv<Access, access, &Access::lock>   lock;
+  etl::function_imv<Access, access, &Access::unlock> unlock;
+
+  using Shared = etl::fixed_sized_memory_block_allocator<sizeof(int32_t), alignof(int32_t), 16>;
+  using Cache  = etl::memory_block_cache<sizeof(int32_t), alignof(int32_t), 4>;
+
+  SUITE(test_memory_block_cache)
+  {
+    //*************************************************************************
+    TEST(test_allocate_refills_in_batches)
+    {
+      Shared shared;
+      Cache  cache(shared);
+
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(8U, cache.capacity());
+
+      void* p = cache.allocate(sizeof(int32_t), alignof(int32_t));
+
+      CHECK(p != nullptr);
+      CHECK(shared.is_owner_of(p));
+      CHECK(cache.is_owner_of(p));
+
+      // A batch was taken, one of which is in use.
+      CHECK_EQUAL(3U, cache.size());
+      CHECK_EQUAL(1U, cache.get_statistics().refills);
+      CHECK_EQUAL(1U, cache.get_statistics().allocations);
+
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(cache.allocate(sizeof(int32_t), alignof(int32_t)) != nullptr);
+      }
+
+      CHECK_EQUAL(0U, cache.size());
+      CHECK_EQUAL(1U, cache.get_statistics().refills);
+
+      CHECK(cache.allocate(sizeof(int32_t), alignof(int32_t)) != nullptr);
+      CHECK_EQUAL(2U, cache.get_statistics().refills);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_unsuitable)
+    {
+      Shared shared;
+      Cache  cache(shared);
+
+      CHECK(cache.allocate(sizeof(int64_t), alignof(int32_t)) == nullptr);
+      CHECK(cache.allocate(sizeof(int32_t), 2U * alignof(int32_t)) == nullptr);
+      CHECK_EQUAL(0U, cache.get_statistics().refills);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_shared_exhausted)
+    {
+      Shared shared;
+      Cache  cache(shared);
+
+      std::set<void*> blocks;
+
+      for (int i = 0; i < 16; ++i)
+      {
+        blocks.insert(cache.allocate(sizeof(int32_t), alignof(int32_t)));
+      }
+
+      CHECK_EQUAL(16U, blocks.size());
+      CHECK(blocks.count(nullptr) == 0U);
+      CHECK(cache.allocate(sizeof(int32_t), alignof(int32_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_release_flushes_in_batches)
+    {
+      Shared shared;
+      Cache  cache(shared);
+
+      std::vector<void*> blocks;
+
+      for (int i = 0; i < 16; ++i)
+      {
+        blocks.push_back(cache.allocate(sizeof(int32_t), alignof(int32_t)));
+      }
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        CHECK(cache.release(blocks[i]));
+      }
+
+      CHECK_EQUAL(8U, cache.size());
+      CHECK_EQUAL(0U, cache.get_statistics().flushes);
+
+      // The cache is full, so the oldest batch is returned.
+      CHECK(cache.release(blocks[8]));
+      CHECK_EQUAL(5U, cache.size());
+      CHECK_EQUAL(1U, cache.get_statistics().flushes);
+      CHECK_EQUAL(9U, cache.get_statistics().releases);
+
+      // The most recently released block is reused first.
+      CHECK(cache.allocate(sizeof(int32_t), alignof(int32_t)) == blocks[8]);
+
+      // The shared allocator has the flushed blocks.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(shared.allocate(sizeof(int32_t), alignof(int32_t)) != nullptr);
+      }
+
+      CHECK(shared.allocate(sizeof(int32_t), alignof(int32_t)) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_owned)
+    {
+      Shared shared;
+      Cache  cache(shared);
+
+      int32_t not_owned = 0;
+
+      CHECK(!cache.release(&not_owned));
+      CHECK(!cache.is_owner_of(&not_owned));
+      CHECK_EQUAL(0U, cache.size());
+    }
+
+    //*************************************************************************
+    TEST(test_flush)
+    {
+      Shared shared;
+
+      {
+        Cache cache(shared);
+
+        void* p = cache.allocate(sizeof(int32_t), alignof(int32_t));
+        cache.release(p);
+
+        CHECK_EQUAL(4U, cache.size());
+
+        cache.flush();
+
+        CHECK_EQUAL(0U, cache.size());
+
+        cache.allocate(sizeof(int32_t), alignof(int32_t));
+      }
+
+      // The destructor returned the cached blocks, leaving one in use.
+      int count = 0;
+
+      while (shared.allocate(sizeof(int32_t), alignof(int32_t)) != nullptr)
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(15, count);
+    }
+
+    //*************************************************************************
+    TEST(test_lock_once_per_batch)
+    {
+      Shared shared;
+      Cache  cache(shared, lock, unlock);
+
+      access.lock_count   = 0;
+      access.unlock_count = 0;
+
+      std::vector<void*> blocks;
+
+      for (int i = 0; i < 12; ++i)
+      {
+        blocks.push_back(cache.allocate(sizeof(int32_t), alignof(int32_t)));
+      }
+
+      CHECK_EQUAL(3, access.lock_count);
+      CHECK_EQUAL(3, access.unlock_count);
+
+      for (size_t i = 0U; i < blocks.size(); ++i)
+      {
+        cache.release(blocks[i]);
+      }
+
+      CHECK_EQUAL(4, access.lock_count);
+      CHECK_EQUAL(4, access.unlock_count);
+
+      cache.clear_statistics();
+      CHECK_EQUAL(0U, cache.get_statistics().allocations);
+      CHECK_EQUAL(0U, cache.get_statistics().releases);
+      CHECK_EQUAL(0U, cache.get_statistics().refills);
+      CHECK_EQUAL(0U, cache.get_statistics().flushes);
+    }
+
+    //*************************************************************************
+    std::mutex shared_mutex;
+
+    void lock_shared()
+    {
+      shared_mutex.lock();
+    }
+
+    void unlock_shared()
+    {
+      shared_mutex.unlock();
+    }
+
+    TEST(test_threads)
+    {
+      etl::fixed_sized_memory_block_allocator<sizeof(int32_t), alignof(int32_t), 64> shared;
+
+      etl::function_fv<lock_shared>   lock_function;
+      etl::function_fv<unlock_shared> unlock_function;
+
+      std::atomic<bool> failed(false);
+
+      auto worker = [&](int32_t id)
+      {
+        Cache cache(shared, lock_function, unlock_function);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+          int32_t* blocks[6];
+
+          for (int j = 0; j < 6; ++j)
+          {
+            blocks[j] = static_cast<int32_t*>(cache.allocate(sizeof(int32_t), alignof(int32_t)));
+            *blocks[j] = id;
+          }
+
+          for (int j = 0; j < 6; ++j)
+          {
+            if (*blocks[j] != id)
+            {
+              failed = true;
+            }
+
+            cache.release(blocks[j]);
+          }
+        }
+
+        // Most operations did not need the shared allocator.
+        if (cache.get_statistics().refills >= 10U)
+        {
+          failed = true;
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int32_t i = 0; i < 4; ++i)
+      {
+        threads.push_back(std::thread(worker, i + 1));
+      }
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(!failed);
+
+      // Every block is back in the shared allocator.
+      int count = 0;
+
+      while (shared.allocate(sizeof(int32_t), alignof(int32_t)) != nullptr)
+      {
+        ++count;
+      }
+
+      CHECK_EQUAL(64, count);
+    }
+  };
+}
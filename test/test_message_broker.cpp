@@ -229,6 +229,36 @@ namespace
     std::vector<etl::message_id_t> id_list;
   };
 
+  //*************************************************************************
+  // Router that unsubscribes another router when it receives a message.
+  //*************************************************************************
+  class UnsubscribingRouter : public etl::message_router<UnsubscribingRouter, Message1>
+  {
+  public:
+
+    UnsubscribingRouter(etl::message_router_id_t id, etl::message_broker& broker_, etl::imessage_router& other_)
+      : message_router(id)
+      , broker(broker_)
+      , other(other_)
+      , message1_count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++message1_count;
+      broker.unsubscribe(other);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    etl::message_broker&  broker;
+    etl::imessage_router& other;
+    int message1_count;
+  };
+
   SUITE(test_message_broker)
   {
     //*************************************************************************
@@ -516,5 +546,134 @@ namespace
       CHECK_EQUAL(0, router2.message_unknown_count);
       CHECK_EQUAL(1, router3.message_unknown_count);
     }
+
+    //*************************************************************************
+    TEST(message_broker_indexed_send_messages_to_subscribers)
+    {
+      etl::message_broker_indexed<10U> broker;
+      Router router1(1);
+      Router router2(2);
+      Router router3(3);
+
+      Subscription subscription1{ router1, { Message1::ID, Message2::ID, Message3::ID, Message4::ID, Message4::ID } };
+      Subscription subscription2{ router2, { Message1::ID, Message2::ID } };
+      Subscription subscription3{ router2, { Message1::ID, Message3::ID } };
+
+      CHECK(broker.is_indexed());
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      broker.subscribe(subscription3); // Duplicate router. Replace the old subscription.
+      broker.subscribe(subscription1); // Do subscription1 again to see if it breaks.
+
+      CHECK(broker.is_indexed());
+
+      broker.set_successor(router3);
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+      broker.receive(Message3());
+      broker.receive(Message4());
+      broker.receive(2, Message1());
+      broker.receive(UnknownMessage());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count);
+
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_EQUAL(1, router3.message3_count);
+
+      // The repeated id is only delivered once.
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(1, router3.message4_count);
+
+      CHECK_EQUAL(0, router1.message_unknown_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(1, router3.message_unknown_count);
+
+      broker.unsubscribe(router1);
+      broker.receive(Message2());
+
+      CHECK_EQUAL(1, router1.message2_count);
+
+      broker.clear();
+      CHECK(broker.empty());
+      CHECK(broker.is_indexed());
+
+      broker.receive(Message3());
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router2.message3_count);
+      CHECK_EQUAL(2, router3.message3_count);
+    }
+
+    //*************************************************************************
+    TEST(message_broker_indexed_too_small_scans_subscriptions)
+    {
+      etl::message_broker_indexed<3U> broker;
+      Router router1(1);
+      Router router2(2);
+
+      Subscription subscription1{ router1, { Message1::ID, Message2::ID } };
+      Subscription subscription2{ router2, { Message1::ID, Message3::ID } };
+
+      broker.subscribe(subscription1);
+      CHECK(broker.is_indexed());
+
+      broker.subscribe(subscription2);
+      CHECK(!broker.is_indexed());
+
+      broker.receive(Message1());
+      broker.receive(Message2());
+      broker.receive(Message3());
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(0, router1.message3_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(1, router2.message3_count);
+
+      broker.unsubscribe(router1);
+      CHECK(broker.is_indexed());
+    }
+
+    //*************************************************************************
+    TEST(message_broker_indexed_unsubscribe_while_receiving)
+    {
+      etl::message_broker_indexed<10U> broker;
+      Router router2(2);
+      Router router3(3);
+      UnsubscribingRouter router1(1, broker, router2);
+
+      Subscription subscription1{ router1, { Message1::ID } };
+      Subscription subscription2{ router2, { Message1::ID } };
+      Subscription subscription3{ router3, { Message1::ID } };
+
+      broker.subscribe(subscription1);
+      broker.subscribe(subscription2);
+      broker.subscribe(subscription3);
+
+      broker.receive(Message1());
+
+      // router2 was unsubscribed before it was reached.
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router2.message1_count);
+      CHECK_EQUAL(1, router3.message1_count);
+      CHECK(broker.is_indexed());
+
+      broker.receive(Message1());
+
+      CHECK_EQUAL(2, router1.message1_count);
+      CHECK_EQUAL(0, router2.message1_count);
+      CHECK_EQUAL(2, router3.message1_count);
+    }
   };
 }
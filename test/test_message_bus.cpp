@@ -247,6 +247,29 @@ namespace
     int message_count;
   };
 
+  //***************************************************************************
+  template <size_t Size, size_t Indexed_Ids>
+  class IndexedMessageBus : public etl::message_bus<Size, Indexed_Ids>
+  {
+  public:
+
+    IndexedMessageBus()
+      : message_count(0)
+    {
+    }
+
+    using etl::message_bus<Size, Indexed_Ids>::receive;
+
+    // Hook 'receive' to count the incomimg messages.
+    void receive(etl::message_router_id_t id, const etl::imessage& msg)
+    {
+      ++message_count;
+      etl::message_bus<Size, Indexed_Ids>::receive(id, msg);
+    }
+
+    int message_count;
+  };
+
   SUITE(test_message_bus)
   {
     //*************************************************************************
@@ -951,5 +974,154 @@ namespace
 
       CHECK_EQUAL(1, bus.message_count);
     }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast)
+    {
+      // Message4 is beyond the index.
+      IndexedMessageBus<2, MESSAGE4> bus1;
+
+      CHECK_EQUAL(size_t(MESSAGE4), bus1.indexed_message_ids());
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA callback(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message1 message1(callback);
+      Message3 message3(callback);
+      Message4 message4(callback);
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(2, callback.message5_count);
+
+      // RouterB does not accept Message3.
+      bus1.receive(message3);
+
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+      CHECK_EQUAL(3, callback.message5_count);
+
+      bus1.receive(message4);
+
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(5, callback.message5_count);
+
+      // Addressed messages are unchanged.
+      bus1.receive(ROUTER2, message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(2, router2.message1_count);
+
+      CHECK_EQUAL(4, bus1.message_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_unsubscribe)
+    {
+      IndexedMessageBus<3, 5> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA callback(ROUTER4);
+
+      bus1.subscribe(router3);
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      Message2 message2(callback);
+
+      bus1.unsubscribe(router1);
+      bus1.receive(message2);
+
+      CHECK_EQUAL(0, router1.message2_count);
+      CHECK_EQUAL(1, router2.message2_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      bus1.unsubscribe(ROUTER3);
+      bus1.receive(message2);
+
+      CHECK_EQUAL(0, router1.message2_count);
+      CHECK_EQUAL(2, router2.message2_count);
+      CHECK_EQUAL(1, router3.message2_count);
+
+      bus1.clear();
+      bus1.receive(message2);
+
+      CHECK_EQUAL(2, router2.message2_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_broadcast_order)
+    {
+      IndexedMessageBus<4, 5> bus1;
+      IndexedMessageBus<2, 5> bus2;
+      IndexedMessageBus<2, 5> bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA callback(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      Message1 message1(callback);
+
+      call_order = 0;
+
+      bus1.receive(message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+
+      CHECK_EQUAL(1, bus1.message_count);
+      CHECK_EQUAL(1, bus2.message_count);
+      CHECK_EQUAL(1, bus3.message_count);
+    }
+
+    //*************************************************************************
+    TEST(message_bus_indexed_rebuild_after_successor_change)
+    {
+      IndexedMessageBus<1, 5> bus1;
+
+      RouterB router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA callback(ROUTER3);
+
+      bus1.subscribe(router1);
+
+      Message3 message3(callback);
+
+      // RouterB does not accept Message3 yet.
+      bus1.receive(message3);
+      CHECK_EQUAL(0, router2.message3_count);
+
+      // Now it does, through its successor.
+      router1.set_successor(router2);
+      bus1.rebuild_index();
+
+      bus1.receive(message3);
+      CHECK_EQUAL(1, router2.message3_count);
+    }
   };
 }
@@ -0,0 +1,139 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/message_rate_limiter.h"
+#include "etl/message_bus.h"
+
+namespace
+{
+  enum
+  {
+    MESSAGE1
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id)
+      , count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int count;
+  };
+
+  SUITE(test_message_rate_limiter)
+  {
+    //*************************************************************************
+    TEST(test_admission_per_destination)
+    {
+      etl::message_bus<2> bus;
+      Router router1(1);
+      Router router2(2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      // 2 messages per destination, then 1 every 10 ticks.
+      etl::message_rate_limiter<4> limiter(bus, etl::token_bucket(2U, 1U, 10U));
+
+      for (int i = 0; i < 5; ++i)
+      {
+        limiter.receive(1, Message1());
+      }
+
+      limiter.receive(2, Message1());
+
+      CHECK_EQUAL(2, router1.count);
+      CHECK_EQUAL(1, router2.count);
+      CHECK_EQUAL(3U, limiter.rejected_count());
+
+      limiter.tick(9U);
+      limiter.receive(1, Message1());
+      CHECK_EQUAL(2, router1.count);
+
+      limiter.tick(1U);
+      CHECK_EQUAL(10U, limiter.time());
+      limiter.receive(1, Message1());
+      CHECK_EQUAL(3, router1.count);
+      CHECK_EQUAL(4U, limiter.rejected_count());
+
+      limiter.clear_rejected_count();
+      CHECK_EQUAL(0U, limiter.rejected_count());
+      CHECK(limiter.accepts(MESSAGE1));
+    }
+
+    //*************************************************************************
+    TEST(test_broadcast_and_rejected_to_successor)
+    {
+      etl::message_bus<2> bus;
+      Router router1(1);
+      Router router2(2);
+      Router overflow(3);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      etl::message_rate_limiter<4, etl::leaky_bucket> limiter(bus, etl::leaky_bucket(1U, 5U));
+      limiter.set_successor(overflow);
+
+      limiter.receive(Message1());
+      limiter.receive(Message1());
+
+      CHECK_EQUAL(1, router1.count);
+      CHECK_EQUAL(1, router2.count);
+      CHECK_EQUAL(1, overflow.count);
+      CHECK_EQUAL(1U, limiter.rejected_count());
+
+      limiter.tick(5U);
+      limiter.receive(Message1());
+
+      CHECK_EQUAL(2, router1.count);
+      CHECK_EQUAL(2, router2.count);
+      CHECK_EQUAL(1U, limiter.get_table().size());
+    }
+  }
+}
@@ -253,6 +253,52 @@ namespace
     int sender_id;
   };
 
+  //***************************************************************************
+  // Router that handles messages with sparse ids, listed out of order.
+  //***************************************************************************
+  struct SparseMessage1 : public etl::message<200> {};
+  struct SparseMessage2 : public etl::message<10>  {};
+  struct SparseMessage3 : public etl::message<128> {};
+  struct SparseMessage4 : public etl::message<37>  {};
+  struct SparseMessage5 : public etl::message<99>  {};
+
+  class SparseRouter : public etl::message_router<SparseRouter, SparseMessage1, SparseMessage2, SparseMessage3, SparseMessage4>
+  {
+  public:
+
+    SparseRouter()
+      : message_router(ROUTER3)
+      , last_id(0)
+      , message_count(0)
+      , message_unknown_count(0)
+    {
+    }
+
+    void on_receive(const SparseMessage1& msg) { last_id = msg.get_message_id(); ++message_count; }
+    void on_receive(const SparseMessage2& msg) { last_id = msg.get_message_id(); ++message_count; }
+    void on_receive(const SparseMessage3& msg) { last_id = msg.get_message_id(); ++message_count; }
+    void on_receive(const SparseMessage4& msg) { last_id = msg.get_message_id(); ++message_count; }
+
+    void on_receive_unknown(const etl::imessage& msg)
+    {
+      last_id = msg.get_message_id();
+      ++message_unknown_count;
+    }
+
+    etl::message_id_t last_id;
+    int message_count;
+    int message_unknown_count;
+  };
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+  typedef int (*TableHandler)();
+
+  int table_handler1() { return 1; }
+  int table_handler2() { return 2; }
+  int table_handler3() { return 3; }
+  int table_handler4() { return 4; }
+#endif
+
   etl::imessage_router* p_router;
 
   SUITE(test_message_router)
@@ -505,6 +551,119 @@ namespace
       CHECK(r2.accepts(message5.get_message_id()));
     }
 
+    //*************************************************************************
+    TEST(message_router_sparse_ids)
+    {
+      SparseRouter router;
+
+      SparseMessage1 message1;
+      SparseMessage2 message2;
+      SparseMessage3 message3;
+      SparseMessage4 message4;
+      SparseMessage5 message5;
+
+      CHECK(router.accepts(message1.get_message_id()));
+      CHECK(router.accepts(message2.get_message_id()));
+      CHECK(router.accepts(message3.get_message_id()));
+      CHECK(router.accepts(message4.get_message_id()));
+      CHECK(!router.accepts(message5.get_message_id()));
+      CHECK(!router.accepts(0));
+      CHECK(!router.accepts(255));
+
+      router.receive(message1);
+      CHECK_EQUAL(200, router.last_id);
+      router.receive(message2);
+      CHECK_EQUAL(10, router.last_id);
+      router.receive(message3);
+      CHECK_EQUAL(128, router.last_id);
+      router.receive(message4);
+      CHECK_EQUAL(37, router.last_id);
+      CHECK_EQUAL(4, router.message_count);
+      CHECK_EQUAL(0, router.message_unknown_count);
+
+      router.receive(message5);
+      CHECK_EQUAL(99, router.last_id);
+      CHECK_EQUAL(4, router.message_count);
+      CHECK_EQUAL(1, router.message_unknown_count);
+    }
+
+    //*************************************************************************
+    TEST(message_router_sparse_ids_successor)
+    {
+      SparseRouter router;
+      Router1      r1;
+
+      router.set_successor(r1);
+
+      etl::null_message_router null_router;
+      Message3 message3(null_router);
+
+      CHECK(router.accepts(message3.get_message_id()));
+      CHECK(!router.accepts(99));
+
+      router.receive(message3);
+      CHECK_EQUAL(0, router.message_unknown_count);
+      CHECK_EQUAL(1, r1.message3_count);
+    }
+
+#if ETL_USING_CPP17 && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(message_router_dispatch_table_bitset)
+    {
+      typedef etl::private_message_router::dispatch_table<TableHandler, 256U, 200, 10, 128, 10, 37> Table;
+
+      static constexpr TableHandler handlers[] = { table_handler1, table_handler2, table_handler3, table_handler4, table_handler1, ETL_NULLPTR };
+      static constexpr Table table(handlers);
+
+      CHECK(Table::Use_Bitset);
+      CHECK_EQUAL(7U, Table::Bitset_Words);
+
+      CHECK(table.contains(10));
+      CHECK(table.contains(37));
+      CHECK(table.contains(128));
+      CHECK(table.contains(200));
+      CHECK(!table.contains(0));
+      CHECK(!table.contains(11));
+      CHECK(!table.contains(201));
+      CHECK(!table.contains(255));
+
+      // The first handler for a repeated id is used.
+      CHECK_EQUAL(1, table.find(200)());
+      CHECK_EQUAL(2, table.find(10)());
+      CHECK_EQUAL(3, table.find(128)());
+      CHECK_EQUAL(1, table.find(37)());
+      CHECK(table.find(99) == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(message_router_dispatch_table_binary_search)
+    {
+      typedef etl::private_message_router::dispatch_table<TableHandler, 0U, 200, 10, 128, 10, 37> Table;
+
+      static constexpr TableHandler handlers[] = { table_handler1, table_handler2, table_handler3, table_handler4, table_handler1, ETL_NULLPTR };
+      static constexpr Table table(handlers);
+
+      CHECK(!Table::Use_Bitset);
+
+      CHECK(table.contains(10));
+      CHECK(table.contains(37));
+      CHECK(table.contains(128));
+      CHECK(table.contains(200));
+      CHECK(!table.contains(0));
+      CHECK(!table.contains(11));
+      CHECK(!table.contains(201));
+      CHECK(!table.contains(255));
+
+      CHECK_EQUAL(1, table.find(200)());
+      CHECK_EQUAL(2, table.find(10)());
+      CHECK_EQUAL(3, table.find(128)());
+      CHECK_EQUAL(1, table.find(37)());
+      CHECK(table.find(99) == ETL_NULLPTR);
+
+      static_assert(table.contains(128), "Lookup is not constexpr");
+    }
+#endif
+
 #if ETL_HAS_VIRTUAL_MESSAGES
     //*************************************************************************
     TEST(message_router_queue)
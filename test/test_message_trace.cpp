@@ -0,0 +1,232 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#define ETL_MESSAGE_TRACE
+
+#include "unit_test_framework.h"
+
+#include "etl/message_trace.h"
+#include "etl/message_router.h"
+#include "etl/queued_message_router.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <vector>
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+
+  constexpr etl::message_router_id_t RouterId1 = 1U;
+  constexpr etl::message_router_id_t RouterId2 = 2U;
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>
+  {
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>
+  {
+  };
+
+  //*************************************************************************
+  // The clock moves on by 10 every time that it is read.
+  //*************************************************************************
+  etl::message_trace_timestamp_t current_time = 0U;
+
+  etl::message_trace_timestamp_t clock()
+  {
+    current_time += 10U;
+
+    return current_time;
+  }
+
+  //*************************************************************************
+  std::vector<etl::message_trace_record> records;
+
+  void on_trace(const etl::message_trace_record& record)
+  {
+    records.push_back(record);
+  }
+
+  //*************************************************************************
+  struct Router : public etl::message_router<Router, Message1, Message2>
+  {
+    Router()
+      : message_router(RouterId1)
+      , count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++count;
+      current_time += 100U;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count;
+      current_time += 1000U;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int count;
+  };
+
+  //*************************************************************************
+  struct SetUp
+  {
+    SetUp()
+    {
+      records.clear();
+      current_time = 0U;
+      etl::message_trace::set_callback(etl::message_trace::callback_type::create<on_trace>());
+      etl::message_trace::set_clock(etl::message_trace::clock_type::create<clock>());
+    }
+
+    ~SetUp()
+    {
+      etl::message_trace::clear();
+    }
+  };
+
+  SUITE(test_message_trace)
+  {
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_send_message)
+    {
+      Router router;
+
+      etl::send_message(router, Message1());
+
+      CHECK_EQUAL(1, router.count);
+      CHECK_EQUAL(2U, records.size());
+
+      CHECK_EQUAL(etl::message_trace_event::Dispatch, records[0].event);
+      CHECK_EQUAL(MessageId1, records[0].message_id);
+      CHECK_EQUAL(RouterId1, records[0].router_id);
+      CHECK_EQUAL(10U, records[0].timestamp);
+      CHECK_EQUAL(0U, records[0].duration);
+
+      CHECK_EQUAL(etl::message_trace_event::Complete, records[1].event);
+      CHECK_EQUAL(MessageId1, records[1].message_id);
+      CHECK_EQUAL(RouterId1, records[1].router_id);
+      CHECK_EQUAL(120U, records[1].timestamp);
+      CHECK_EQUAL(110U, records[1].duration);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_no_callback)
+    {
+      etl::message_trace::clear();
+
+      Router router;
+
+      etl::send_message(router, Message1());
+
+      CHECK_EQUAL(1, router.count);
+      CHECK(records.empty());
+      CHECK_EQUAL(0U, etl::message_trace::now());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_queued_message_router)
+    {
+      using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2>;
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      etl::atomic_counted_message_pool pool(memory_allocator);
+
+      Router router;
+      etl::queued_message_router<3U> queued(RouterId2, router);
+
+      queued.receive(etl::shared_message(pool, Message2()));
+
+      CHECK_EQUAL(1U, records.size());
+      CHECK_EQUAL(etl::message_trace_event::Enqueue, records[0].event);
+      CHECK_EQUAL(MessageId2, records[0].message_id);
+      CHECK_EQUAL(RouterId2, records[0].router_id);
+      CHECK_EQUAL(10U, records[0].timestamp);
+
+      queued.process_queue();
+
+      CHECK_EQUAL(3U, records.size());
+      CHECK_EQUAL(etl::message_trace_event::Dispatch, records[1].event);
+      CHECK_EQUAL(RouterId1, records[1].router_id);
+      CHECK_EQUAL(20U, records[1].timestamp);
+      CHECK_EQUAL(etl::message_trace_event::Complete, records[2].event);
+      CHECK_EQUAL(RouterId1, records[2].router_id);
+      CHECK_EQUAL(1010U, records[2].duration);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetUp, test_latency_histogram)
+    {
+      typedef etl::message_latency_histogram<3U, 4U, 100U> Histogram;
+
+      Histogram histogram;
+
+      etl::message_trace::set_callback(etl::message_trace::callback_type::create<Histogram, &Histogram::on_trace>(histogram));
+
+      Router router;
+
+      etl::send_message(router, Message1()); // 110
+      etl::send_message(router, Message1()); // 110
+      etl::send_message(router, Message2()); // 1010, beyond the last bucket.
+
+      CHECK_EQUAL(0U, histogram[MessageId1][0]);
+      CHECK_EQUAL(2U, histogram[MessageId1][1]);
+      CHECK_EQUAL(0U, histogram[MessageId1][2]);
+      CHECK_EQUAL(0U, histogram[MessageId1][3]);
+
+      CHECK_EQUAL(0U, histogram[MessageId2][0]);
+      CHECK_EQUAL(1U, histogram[MessageId2][3]);
+
+      // Out of range ids are ignored.
+      histogram.add(3U, 0U);
+      CHECK_EQUAL(0U, histogram[0][0]);
+
+      histogram.add(0U, 250U);
+      CHECK_EQUAL(1U, histogram[0][2]);
+
+      histogram.clear();
+      CHECK_EQUAL(0U, histogram[MessageId1][1]);
+      CHECK_EQUAL(0U, histogram[MessageId2][3]);
+      CHECK_EQUAL(0U, histogram[0][2]);
+    }
+  };
+}
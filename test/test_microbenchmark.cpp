@@ -0,0 +1,214 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/microbenchmark.h"
+
+#include <string.h>
+
+namespace
+{
+  uint32_t counting_loops = 0U;
+  uint32_t counting_calls = 0U;
+
+  //***************************************************************************
+  void counting(etl::benchmark_state& state)
+  {
+    ++counting_calls;
+
+    while (state.keep_running())
+    {
+      ++counting_loops;
+      etl::benchmark_do_not_optimize(counting_loops);
+    }
+
+    state.set_items_processed(state.iterations() * 2U);
+    state.set_bytes_processed(state.iterations() * 8U);
+  }
+
+  ETL_BENCHMARK(counting);
+
+  //***************************************************************************
+  void other(etl::benchmark_state& state)
+  {
+    for (auto _ : state)
+    {
+      uint32_t value = 1U;
+      etl::benchmark_do_not_optimize(value);
+    }
+  }
+
+  ETL_BENCHMARK(other);
+
+  //***************************************************************************
+  struct Results
+  {
+    Results()
+      : count(0U)
+    {
+    }
+
+    void add(const etl::benchmark_result& result)
+    {
+      if (count < 4U)
+      {
+        results[count] = result;
+      }
+
+      ++count;
+    }
+
+    etl::benchmark_result results[4];
+    size_t count;
+  };
+
+  SUITE(test_microbenchmark)
+  {
+    //*************************************************************************
+    TEST(test_cycle_counter_is_monotonic)
+    {
+      etl::cycle_counter::start();
+
+      etl::cycle_counter::value_type first = etl::cycle_counter::now();
+
+      volatile uint32_t sum = 0U;
+
+      for (uint32_t i = 0U; i < 100000U; ++i)
+      {
+        sum = sum + i;
+      }
+
+      etl::cycle_counter::value_type last = etl::cycle_counter::now();
+
+      CHECK(etl::cycle_counter::elapsed(first, last) > 0U);
+      CHECK(etl::cycle_counter::elapsed(first, last) <= etl::cycle_counter::max_elapsed());
+      CHECK(etl::cycle_counter::units() != ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_registrations_in_order)
+    {
+      const etl::benchmark_registration* p = etl::benchmark_registration::first();
+
+      CHECK(p != ETL_NULLPTR);
+      CHECK_EQUAL(std::string("counting"), std::string(p->name));
+
+      p = p->get_next();
+      CHECK(p != ETL_NULLPTR);
+      CHECK_EQUAL(std::string("other"), std::string(p->name));
+
+      CHECK(p->get_next() == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_state_keep_running)
+    {
+      etl::benchmark_state state(10U);
+
+      uint32_t loops = 0U;
+
+      while (state.keep_running())
+      {
+        ++loops;
+      }
+
+      CHECK_EQUAL(10U, loops);
+      CHECK_EQUAL(10U, state.iterations());
+    }
+
+    //*************************************************************************
+    TEST(test_state_range_for)
+    {
+      etl::benchmark_state state(7U);
+
+      uint32_t loops = 0U;
+
+      for (auto _ : state)
+      {
+        ++loops;
+      }
+
+      CHECK_EQUAL(7U, loops);
+    }
+
+    //*************************************************************************
+    TEST(test_run_benchmarks_to_sink)
+    {
+      Results results;
+      etl::benchmark_sink sink = etl::benchmark_sink::create<Results, &Results::add>(results);
+
+      counting_loops = 0U;
+      counting_calls = 0U;
+
+      size_t count = etl::run_benchmarks(sink, ETL_NULLPTR, 1000U);
+
+      CHECK_EQUAL(2U, count);
+      CHECK_EQUAL(2U, results.count);
+
+      const etl::benchmark_result& result = results.results[0];
+
+      CHECK_EQUAL(std::string("counting"), std::string(result.name));
+      CHECK(result.ticks >= 1000U);
+      CHECK(result.iterations >= 1U);
+      CHECK_EQUAL(result.ticks / result.iterations, result.ticks_per_iteration);
+      CHECK_EQUAL(uint64_t(result.iterations) * 2U, result.items_processed);
+      CHECK_EQUAL(uint64_t(result.iterations) * 8U, result.bytes_processed);
+      CHECK_EQUAL(std::string(etl::cycle_counter::units()), std::string(result.units));
+      CHECK(counting_calls >= 1U);
+      CHECK(counting_loops >= result.iterations);
+
+      CHECK_EQUAL(std::string("other"), std::string(results.results[1].name));
+    }
+
+    //*************************************************************************
+    TEST(test_run_benchmarks_with_filter)
+    {
+      Results results;
+      etl::benchmark_sink sink = etl::benchmark_sink::create<Results, &Results::add>(results);
+
+      size_t count = etl::run_benchmarks(sink, "oth", 100U);
+
+      CHECK_EQUAL(1U, count);
+      CHECK_EQUAL(1U, results.count);
+      CHECK_EQUAL(std::string("other"), std::string(results.results[0].name));
+
+      count = etl::run_benchmarks(sink, "none", 100U);
+      CHECK_EQUAL(0U, count);
+      CHECK_EQUAL(1U, results.count);
+    }
+
+    //*************************************************************************
+    TEST(test_run_benchmarks_without_sink)
+    {
+      size_t count = etl::run_benchmarks(etl::benchmark_sink(), "counting", 100U);
+
+      CHECK_EQUAL(1U, count);
+    }
+  };
+}
@@ -0,0 +1,322 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/monotonic_arena.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/variant_pool.h"
+#include "etl/message.h"
+
+#include <stdint.h>
+#include <string>
+
+namespace
+{
+  //*************************************************************************
+  struct Message1 : public etl::message<1>
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<2>
+  {
+    Message2(double d_)
+      : d(d_)
+      , data()
+    {
+    }
+
+    double d;
+    char   data[40];
+  };
+
+  SUITE(test_monotonic_arena)
+  {
+    //*************************************************************************
+    TEST(test_construct)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      CHECK(arena.empty());
+      CHECK(!arena.full());
+      CHECK_EQUAL(0U,  arena.size());
+      CHECK_EQUAL(64U, arena.capacity());
+      CHECK_EQUAL(64U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_with_alignment)
+    {
+      alignas(16) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      char* p1 = static_cast<char*>(arena.allocate(1U, 1U));
+      CHECK(p1 == &buffer[0]);
+      CHECK_EQUAL(1U, arena.size());
+
+      char* p2 = static_cast<char*>(arena.allocate(4U, 4U));
+      CHECK(p2 == &buffer[4]);
+      CHECK_EQUAL(8U, arena.size());
+
+      char* p3 = static_cast<char*>(arena.allocate(2U, 16U));
+      CHECK(p3 == &buffer[16]);
+      CHECK_EQUAL(18U, arena.size());
+
+      char* p4 = static_cast<char*>(arena.allocate(46U, 1U));
+      CHECK(p4 == &buffer[18]);
+      CHECK(arena.full());
+
+      CHECK(arena.allocate(1U, 1U) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_failures)
+    {
+      alignas(16) char buffer[32];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      // Not a power of two.
+      CHECK(arena.allocate(4U, 3U) == nullptr);
+      CHECK(arena.allocate(4U, 0U) == nullptr);
+
+      // Too large.
+      CHECK(arena.allocate(33U, 1U) == nullptr);
+      CHECK(arena.allocate(size_t(-1), 1U) == nullptr);
+
+      // The padding does not fit.
+      CHECK(arena.allocate(17U, 1U) != nullptr);
+      CHECK(arena.allocate(1U, 32U) == nullptr);
+      CHECK_EQUAL(17U, arena.size());
+
+      // A failed allocation does not change the arena.
+      CHECK(arena.allocate(16U, 1U) == nullptr);
+      CHECK_EQUAL(17U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_typed)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      arena.allocate(1U, 1U);
+
+      uint32_t* p = arena.allocate<uint32_t>(4U);
+      CHECK(p != nullptr);
+      CHECK_EQUAL(0U, uintptr_t(p) % alignof(uint32_t));
+      CHECK_EQUAL(20U, arena.size());
+
+      CHECK(arena.allocate<uint32_t>(size_t(-1)) == nullptr);
+      CHECK(arena.allocate<uint32_t>(12U) == nullptr);
+      CHECK(arena.allocate<uint32_t>(11U) != nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_reset)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      void* p1 = arena.allocate(40U, 8U);
+      arena.allocate(24U, 8U);
+      CHECK(arena.full());
+
+      arena.reset();
+      CHECK(arena.empty());
+
+      void* p2 = arena.allocate(40U, 8U);
+      CHECK(p1 == p2);
+    }
+
+    //*************************************************************************
+    TEST(test_marker_rewind)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      arena.allocate(10U, 1U);
+      etl::monotonic_arena::marker_type marker = arena.get_marker();
+
+      void* p1 = arena.allocate(20U, 1U);
+      arena.allocate(20U, 1U);
+      CHECK_EQUAL(50U, arena.size());
+
+      arena.rewind(marker);
+      CHECK_EQUAL(10U, arena.size());
+
+      void* p2 = arena.allocate(20U, 1U);
+      CHECK(p1 == p2);
+    }
+
+    //*************************************************************************
+    TEST(test_rewind_invalid_marker)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      arena.allocate(10U, 1U);
+      etl::monotonic_arena::marker_type marker = arena.get_marker();
+      arena.reset();
+
+      CHECK_THROW(arena.rewind(marker), etl::monotonic_arena_invalid_marker);
+    }
+
+    //*************************************************************************
+    TEST(test_scoped_marker)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      arena.allocate(10U, 1U);
+
+      {
+        etl::monotonic_arena::scoped_marker scope(arena);
+
+        arena.allocate(30U, 1U);
+        CHECK_EQUAL(40U, arena.size());
+      }
+
+      CHECK_EQUAL(10U, arena.size());
+
+      // A reset within the scope is kept.
+      {
+        etl::monotonic_arena::scoped_marker scope(arena);
+
+        arena.allocate(30U, 1U);
+        arena.reset();
+      }
+
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_is_owner_of)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      char* p = static_cast<char*>(arena.allocate(8U, 1U));
+
+      CHECK(arena.is_owner_of(p));
+      CHECK(arena.is_owner_of(p + 7));
+      CHECK(!arena.is_owner_of(p + 8));
+
+      int i = 0;
+      CHECK(!arena.is_owner_of(&i));
+    }
+
+    //*************************************************************************
+    TEST(test_memory_block_allocator)
+    {
+      alignas(8) char buffer[64];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+      etl::monotonic_arena_memory_block_allocator allocator(arena);
+
+      CHECK(&allocator.get_arena() == &arena);
+
+      void* p1 = allocator.allocate(16U, 8U);
+      void* p2 = allocator.allocate(16U, 8U);
+
+      CHECK(p1 != nullptr);
+      CHECK(p2 != nullptr);
+      CHECK(allocator.is_owner_of(p1));
+      CHECK(allocator.is_owner_of(p2));
+
+      // Release succeeds, but the memory is only reclaimed by a reset.
+      CHECK(allocator.release(p1));
+      CHECK_EQUAL(32U, arena.size());
+
+      int i = 0;
+      CHECK(!allocator.release(&i));
+
+      CHECK(allocator.allocate(64U, 1U) == nullptr);
+
+      arena.reset();
+      CHECK(allocator.allocate(64U, 1U) != nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_reference_counted_message_pool)
+    {
+      alignas(8) char buffer[256];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+      etl::monotonic_arena_memory_block_allocator allocator(arena);
+      etl::reference_counted_message_pool<int> message_pool(allocator);
+
+      for (int frame = 0; frame < 10; ++frame)
+      {
+        etl::monotonic_arena::scoped_marker scope(arena);
+
+        etl::reference_counted_message<Message1, int>* p1 = message_pool.allocate(Message1(frame));
+        etl::reference_counted_message<Message2, int>* p2 = message_pool.allocate(Message2(1.5));
+
+        CHECK(p1 != nullptr);
+        CHECK(p2 != nullptr);
+        CHECK_EQUAL(frame, p1->get_message().i);
+
+        CHECK_NO_THROW(message_pool.release(*p1));
+        CHECK_NO_THROW(message_pool.release(*p2));
+      }
+
+      CHECK(arena.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_variant_pool_ext)
+    {
+      typedef etl::variant_pool_ext<Message1, Message2, std::string> pool_t;
+
+      alignas(8) char buffer[512];
+      etl::monotonic_arena arena(buffer, sizeof(buffer));
+
+      pool_t::element* pelements = arena.allocate<pool_t::element>(4U);
+      CHECK(pelements != nullptr);
+
+      pool_t pool(pelements, 4U);
+
+      std::string* ps = pool.create<std::string>("arena");
+      Message1*    pm = pool.create<Message1>(1);
+
+      CHECK_EQUAL(std::string("arena"), *ps);
+      CHECK_EQUAL(1, pm->i);
+      CHECK(arena.is_owner_of(ps));
+      CHECK(arena.is_owner_of(pm));
+
+      pool.destroy(ps);
+      pool.destroy(pm);
+    }
+  }
+}
@@ -0,0 +1,260 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/moving_statistics.h"
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+  //*************************************************************************
+  std::vector<int> make_samples(size_t n)
+  {
+    std::vector<int> samples;
+
+    uint32_t seed = 12345U;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      samples.push_back(int((seed >> 16) % 2001U) - 1000);
+    }
+
+    return samples;
+  }
+
+  SUITE(test_moving_statistics)
+  {
+    //*************************************************************************
+    TEST(test_moving_average_integral)
+    {
+      etl::moving_average<int, 4U> average;
+
+      CHECK_EQUAL(4U, (etl::moving_average<int, 4U>::WINDOW_SIZE));
+      CHECK(average.empty());
+      CHECK_EQUAL(0, average.value());
+
+      average.add(10);
+      CHECK_EQUAL(10, average.value());
+      average.add(20);
+      CHECK_EQUAL(15, average.value());
+      average.add(30);
+      average.add(40);
+      CHECK(average.full());
+      CHECK_EQUAL(25, average.value());
+
+      // The oldest sample, 10, drops out.
+      average.add(50);
+      CHECK_EQUAL(35, average.value());
+      CHECK_EQUAL(140, average.sum());
+      CHECK_EQUAL(4U, average.size());
+
+      average.clear();
+      CHECK(average.empty());
+      CHECK_EQUAL(0, average.sum());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_average_against_window)
+    {
+      const std::vector<int> samples = make_samples(500U);
+
+      etl::moving_average<int, 16U>    average_i;
+      etl::moving_average<double, 16U> average_d;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        average_i.add(samples[i]);
+        average_d.add(double(samples[i]) + 0.1);
+
+        const size_t first = (i >= 16U) ? (i - 15U) : 0U;
+        const size_t count = i + 1U - first;
+        const int    sum   = std::accumulate(samples.begin() + first, samples.begin() + i + 1U, 0);
+
+        CHECK_EQUAL(sum, average_i.sum());
+        CHECK_EQUAL(sum / int(count), average_i.value());
+        CHECK_CLOSE((double(sum) / double(count)) + 0.1, average_d.value(), 1e-9);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_moving_average_float_does_not_drift)
+    {
+      etl::moving_average<float, 8U> average;
+
+      // Large values passing through the window would leave rounding errors in a running sum.
+      for (size_t i = 0U; i < 10000U; ++i)
+      {
+        average.add(((i % 3U) == 0U) ? 1.0e7f : 0.001f);
+      }
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        average.add(0.5f);
+      }
+
+      CHECK_CLOSE(0.5, average.value(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_moving_average_input_iterator)
+    {
+      const std::vector<int> samples = { 1, 2, 3, 4, 5, 6 };
+
+      etl::moving_average<int, 3U> average;
+      std::copy(samples.begin(), samples.end(), average.input());
+
+      CHECK_EQUAL(5, average.value());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_min_max_against_window)
+    {
+      const std::vector<int> samples = make_samples(1000U);
+
+      etl::moving_min<int, 1U>  min_1;
+      etl::moving_min<int, 7U>  min_7;
+      etl::moving_max<int, 7U>  max_7;
+      etl::moving_max<int, 64U> max_64;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        min_1.add(samples[i]);
+        min_7.add(samples[i]);
+        max_7.add(samples[i]);
+        max_64.add(samples[i]);
+
+        const size_t first_7  = (i >= 7U)  ? (i - 6U)  : 0U;
+        const size_t first_64 = (i >= 64U) ? (i - 63U) : 0U;
+
+        CHECK_EQUAL(samples[i], min_1.value());
+        CHECK_EQUAL(*std::min_element(samples.begin() + first_7, samples.begin() + i + 1U), min_7.value());
+        CHECK_EQUAL(*std::max_element(samples.begin() + first_7, samples.begin() + i + 1U), max_7.value());
+        CHECK_EQUAL(*std::max_element(samples.begin() + first_64, samples.begin() + i + 1U), max_64.value());
+        CHECK_EQUAL(i + 1U - first_7, min_7.size());
+      }
+
+      CHECK(min_7.full());
+      min_7.clear();
+      CHECK(min_7.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_min_max_monotonic_runs)
+    {
+      etl::moving_min<int, 4U> minimum;
+      etl::moving_max<int, 4U> maximum;
+
+      // Rising, then falling, then equal.
+      const std::vector<int> samples  = { 1, 2, 3, 4, 5, 6, 5, 4, 3, 2, 1, 1, 1, 1, 1 };
+      const std::vector<int> expected_min = { 1, 1, 1, 1, 2, 3, 4, 4, 3, 2, 1, 1, 1, 1, 1 };
+      const std::vector<int> expected_max = { 1, 2, 3, 4, 5, 6, 6, 6, 6, 5, 4, 3, 2, 1, 1 };
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        minimum.add(samples[i]);
+        maximum.add(samples[i]);
+
+        CHECK_EQUAL(expected_min[i], minimum.value());
+        CHECK_EQUAL(expected_max[i], maximum.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_moving_variance_against_window)
+    {
+      const std::vector<int> samples = make_samples(700U);
+
+      etl::moving_variance<etl::variance_type::Sample, int, 10U>       sample_variance;
+      etl::moving_variance<etl::variance_type::Population, int, 10U>   population_variance;
+      etl::moving_variance<etl::variance_type::Population, float, 10U> float_variance;
+
+      CHECK_EQUAL(0.0, sample_variance.get_variance());
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        sample_variance.add(samples[i]);
+        population_variance.add(samples[i]);
+        float_variance.add(float(samples[i]));
+
+        const size_t first = (i >= 10U) ? (i - 9U) : 0U;
+        const size_t count = i + 1U - first;
+
+        double mean = 0.0;
+
+        for (size_t j = first; j <= i; ++j)
+        {
+          mean += samples[j];
+        }
+
+        mean /= double(count);
+
+        double m2 = 0.0;
+
+        for (size_t j = first; j <= i; ++j)
+        {
+          m2 += (samples[j] - mean) * (samples[j] - mean);
+        }
+
+        CHECK_CLOSE(mean, sample_variance.get_mean(), 1e-6);
+        CHECK_CLOSE(m2 / double(count), population_variance.get_variance(), 1e-6);
+        CHECK_CLOSE(m2 / double(count), float_variance.get_variance(), 1.0);
+        CHECK_CLOSE(sqrt(m2 / double(count)), population_variance.get_standard_deviation(), 1e-6);
+
+        if (count > 1U)
+        {
+          CHECK_CLOSE(m2 / double(count - 1U), sample_variance.get_variance(), 1e-6);
+        }
+      }
+
+      CHECK(sample_variance.full());
+      sample_variance.clear();
+      CHECK(sample_variance.empty());
+      CHECK_EQUAL(0.0, sample_variance.get_variance());
+    }
+
+    //*************************************************************************
+    TEST(test_moving_variance_constant_samples)
+    {
+      etl::moving_variance<etl::variance_type::Population, double, 5U> variance;
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        variance.add(1.0e6 + ((i < 50U) ? double(i) : 0.0));
+      }
+
+      // The window now holds equal values.
+      CHECK_CLOSE(0.0, variance.get_variance(), 1e-6);
+      CHECK_CLOSE(1.0e6, variance.get_mean(), 1e-6);
+    }
+  };
+}
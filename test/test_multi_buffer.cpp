@@ -0,0 +1,297 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/multi_buffer.h"
+
+#include <thread>
+#include <atomic>
+#include <stdint.h>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //*************************************************************************
+  // Records the cache maintenance calls.
+  struct test_cache
+  {
+    static const size_t Line_Size = 32U;
+
+    static void before_fill(void* p, size_t size)
+    {
+      last_fill = p;
+      fill_size = size;
+      ++fills;
+    }
+
+    static void before_process(void* p, size_t size)
+    {
+      last_process = p;
+      process_size = size;
+      ++processes;
+    }
+
+    static void clear()
+    {
+      last_fill    = ETL_NULLPTR;
+      last_process = ETL_NULLPTR;
+      fill_size    = 0U;
+      process_size = 0U;
+      fills        = 0;
+      processes    = 0;
+    }
+
+    static void*  last_fill;
+    static void*  last_process;
+    static size_t fill_size;
+    static size_t process_size;
+    static int    fills;
+    static int    processes;
+  };
+
+  void*  test_cache::last_fill    = ETL_NULLPTR;
+  void*  test_cache::last_process = ETL_NULLPTR;
+  size_t test_cache::fill_size    = 0U;
+  size_t test_cache::process_size = 0U;
+  int    test_cache::fills        = 0;
+  int    test_cache::processes    = 0;
+
+  //*************************************************************************
+  template <typename TBuffer>
+  void fill(TBuffer& buffers, uint16_t value)
+  {
+    etl::span<uint16_t> span = buffers.fill_span();
+
+    for (size_t i = 0U; i < span.size(); ++i)
+    {
+      span[i] = uint16_t(value + i);
+    }
+
+    buffers.fill_complete();
+  }
+
+  SUITE(test_multi_buffer)
+  {
+    //*************************************************************************
+    TEST(test_ping_pong)
+    {
+      etl::multi_buffer<uint16_t, 8> buffers;
+
+      CHECK(buffers.acquire().empty());
+      CHECK_EQUAL(0U, buffers.ready_count());
+
+      uint16_t* first = buffers.fill_span().data();
+      fill(buffers, 100U);
+
+      uint16_t* second = buffers.fill_span().data();
+      CHECK(first != second);
+      CHECK_EQUAL(1U, buffers.ready_count());
+
+      etl::span<uint16_t> process = buffers.acquire();
+      CHECK(buffers.is_acquired());
+      CHECK_EQUAL(8U, process.size());
+      CHECK(process.data() == first);
+      CHECK_EQUAL(100U, process[0]);
+      CHECK_EQUAL(107U, process[7]);
+
+      // Filling the other buffer does not disturb the one being processed.
+      etl::span<uint16_t> span = buffers.fill_span();
+      span[0] = 200U;
+      CHECK_EQUAL(100U, process[0]);
+
+      buffers.release();
+      CHECK(!buffers.is_acquired());
+
+      buffers.fill_complete();
+      CHECK_EQUAL(0U, buffers.overruns());
+
+      process = buffers.acquire();
+      CHECK(process.data() == second);
+      CHECK_EQUAL(200U, process[0]);
+      buffers.release();
+
+      CHECK(buffers.acquire().empty());
+
+      // A fill that completes while the other buffer is held has nowhere to go.
+      fill(buffers, 300U);
+      process = buffers.acquire();
+      fill(buffers, 400U);
+      CHECK_EQUAL(1U, buffers.overruns());
+      CHECK_EQUAL(0U, buffers.ready_count());
+      buffers.release();
+    }
+
+    //*************************************************************************
+    TEST(test_overrun_refills_the_oldest)
+    {
+      etl::multi_buffer<uint16_t, 4, 3> buffers;
+
+      fill(buffers, 10U);
+      fill(buffers, 20U);
+      CHECK_EQUAL(2U, buffers.ready_count());
+      CHECK_EQUAL(0U, buffers.overruns());
+
+      // No free buffer, so the oldest ready one is filled again.
+      fill(buffers, 30U);
+      CHECK_EQUAL(1U, buffers.overruns());
+      fill(buffers, 40U);
+      CHECK_EQUAL(2U, buffers.overruns());
+
+      etl::span<uint16_t> process = buffers.acquire();
+      CHECK_EQUAL(30U, process[0]);
+      buffers.release();
+
+      process = buffers.acquire();
+      CHECK_EQUAL(40U, process[0]);
+
+      // The application holds one buffer, so the producer cycles the other
+      // two, and only the latest fill is kept.
+      fill(buffers, 50U);
+      fill(buffers, 60U);
+      fill(buffers, 70U);
+      CHECK_EQUAL(40U, process[0]);
+      CHECK_EQUAL(1U, buffers.ready_count());
+      CHECK_EQUAL(4U, buffers.overruns());
+      buffers.release();
+
+      process = buffers.acquire();
+      CHECK_EQUAL(70U, process[0]);
+      buffers.release();
+      CHECK(buffers.acquire().empty());
+
+      buffers.clear_overruns();
+      CHECK_EQUAL(0U, buffers.overruns());
+    }
+
+    //*************************************************************************
+    TEST(test_acquire_errors)
+    {
+      etl::multi_buffer<uint16_t, 4> buffers;
+
+      CHECK_THROW(buffers.release(), etl::multi_buffer_not_acquired);
+
+      fill(buffers, 1U);
+      buffers.acquire();
+      CHECK_THROW(buffers.acquire(), etl::multi_buffer_not_acquired);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_maintenance)
+    {
+      test_cache::clear();
+
+      etl::multi_buffer<uint16_t, 20, 2, test_cache> buffers;
+
+      uint16_t* first = buffers.fill_span().data();
+
+      CHECK_EQUAL(1, test_cache::fills);
+      CHECK(test_cache::last_fill == first);
+      CHECK_EQUAL(64U, test_cache::fill_size);
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(first) % 32U);
+
+      fill(buffers, 0U);
+
+      uint16_t* second = buffers.fill_span().data();
+
+      CHECK_EQUAL(2, test_cache::fills);
+      CHECK(test_cache::last_fill == second);
+      CHECK_EQUAL(64U * sizeof(uint8_t), size_t(reinterpret_cast<uint8_t*>(second) - reinterpret_cast<uint8_t*>(first)));
+
+      buffers.acquire();
+      CHECK_EQUAL(1, test_cache::processes);
+      CHECK(test_cache::last_process == first);
+      CHECK_EQUAL(64U, test_cache::process_size);
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_fill_and_process)
+    {
+      static const uint32_t Fills = 100000U;
+
+      etl::multi_buffer<uint32_t, 16, 3> buffers;
+      std::atomic<bool> done(false);
+
+      std::thread producer([&]()
+      {
+        for (uint32_t number = 1U; number <= Fills; ++number)
+        {
+          etl::span<uint32_t> span = buffers.fill_span();
+
+          for (size_t i = 0U; i < span.size(); ++i)
+          {
+            span[i] = number;
+          }
+
+          buffers.fill_complete();
+        }
+
+        done.store(true);
+      });
+
+      bool     consistent = true;
+      uint32_t processed  = 0U;
+      uint32_t last       = 0U;
+
+      while (!done.load() || (buffers.ready_count() != 0U))
+      {
+        etl::span<uint32_t> span = buffers.acquire();
+
+        if (!span.empty())
+        {
+          // Every element is from the same fill, and fills arrive in order.
+          for (size_t i = 1U; i < span.size(); ++i)
+          {
+            if (span[i] != span[0])
+            {
+              consistent = false;
+            }
+          }
+
+          if (span[0] <= last)
+          {
+            consistent = false;
+          }
+
+          last = span[0];
+          ++processed;
+          buffers.release();
+        }
+      }
+
+      producer.join();
+
+      CHECK(consistent);
+      CHECK_EQUAL(Fills, last);
+      CHECK_EQUAL(Fills, processed + buffers.overruns());
+    }
+  }
+}
+
+#endif
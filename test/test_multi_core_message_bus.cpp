@@ -0,0 +1,433 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/multi_core_message_bus.h"
+#include "etl/message_router.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <vector>
+#include <thread>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  constexpr etl::message_id_t Command   = 1U;
+  constexpr etl::message_id_t Telemetry = 2U;
+
+  //*************************************************************************
+  struct CommandMessage : public etl::message<Command>
+  {
+  };
+
+  struct TelemetryMessage : public etl::message<Telemetry>
+  {
+    TelemetryMessage(size_t source_, int sample_)
+      : source(source_)
+      , sample(sample_)
+    {
+    }
+
+    size_t source;
+    int    sample;
+  };
+
+  //*************************************************************************
+  struct Router : public etl::message_router<Router, CommandMessage, TelemetryMessage>
+  {
+    explicit Router(etl::message_router_id_t id)
+      : message_router(id)
+      , commands(0U)
+    {
+    }
+
+    void on_receive(const CommandMessage&)
+    {
+      ++commands;
+    }
+
+    void on_receive(const TelemetryMessage& msg)
+    {
+      sources.push_back(msg.source);
+      samples.push_back(msg.sample);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    size_t              commands;
+    std::vector<size_t> sources;
+    std::vector<int>    samples;
+  };
+
+  //*************************************************************************
+  struct TelemetryRouter : public etl::message_router<TelemetryRouter, TelemetryMessage>
+  {
+    explicit TelemetryRouter(etl::message_router_id_t id)
+      : message_router(id)
+    {
+    }
+
+    void on_receive(const TelemetryMessage& msg)
+    {
+      samples.push_back(msg.sample);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    std::vector<int> samples;
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<CommandMessage, TelemetryMessage>;
+
+  using Allocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                            pool_message_parameters::max_alignment,
+                                                            32U>;
+
+  //*************************************************************************
+  // A pool for each core, without a lock.
+  //*************************************************************************
+  struct CorePool
+  {
+    CorePool()
+      : pool(allocator)
+    {
+    }
+
+    Allocator                        allocator;
+    etl::atomic_counted_message_pool pool;
+  };
+
+  using Bus = etl::multi_core_message_bus<3U, 2U, 4U>;
+
+  SUITE(test_multi_core_message_bus)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Bus bus;
+
+      CHECK_EQUAL(3U, Bus::Cores);
+      CHECK_EQUAL(4U, Bus::Inbox_Size);
+
+      for (size_t core = 0U; core < Bus::Cores; ++core)
+      {
+        CHECK_EQUAL(0U, bus.pending(core));
+        CHECK_EQUAL(0U, bus.drop_count(core));
+        CHECK(!bus.accepts(core, Command));
+        CHECK_EQUAL(0U, bus.process(core));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_subscribe)
+    {
+      Bus    bus;
+      Router router1(1U);
+      Router router2(2U);
+      Router router3(3U);
+
+      CHECK(bus.subscribe(0U, router1));
+      CHECK(bus.subscribe(0U, router2));
+      CHECK(!bus.subscribe(3U, router3));
+      CHECK_EQUAL(2U, bus.size(0U));
+      CHECK(bus.accepts(0U, Command));
+      CHECK(!bus.accepts(1U, Command));
+      CHECK(!bus.accepts(3U, Command));
+
+      bus.unsubscribe(0U, router1);
+      CHECK_EQUAL(1U, bus.size(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_local_inline_and_remote_on_process)
+    {
+      CorePool pool0;
+      Bus      bus;
+
+      Router          local(1U);
+      Router          remote(2U);
+      TelemetryRouter telemetry(3U);
+
+      bus.subscribe(0U, local);
+      bus.subscribe(1U, remote);
+      bus.subscribe(2U, telemetry);
+
+      CHECK(bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, 1))));
+      CHECK(bus.send(0U, etl::shared_message(pool0.pool, CommandMessage())));
+
+      // Local routers receive immediately.
+      CHECK_EQUAL(1U, local.samples.size());
+      CHECK_EQUAL(1U, local.commands);
+
+      // Remote routers wait for their core to process.
+      CHECK_EQUAL(0U, remote.samples.size());
+      CHECK_EQUAL(2U, bus.pending(1U));
+      CHECK_EQUAL(1U, bus.pending(2U)); // The command is not forwarded to core 2.
+
+      CHECK_EQUAL(2U, bus.process(1U));
+      CHECK_EQUAL(1U, remote.samples.size());
+      CHECK_EQUAL(1U, remote.commands);
+      CHECK_EQUAL(0U, bus.pending(1U));
+
+      CHECK_EQUAL(1U, bus.process(2U));
+      CHECK_EQUAL(1U, telemetry.samples.size());
+      CHECK_EQUAL(0U, bus.pending(2U));
+    }
+
+    //*************************************************************************
+    TEST(test_unshared_message_is_local)
+    {
+      Bus    bus;
+      Router local(1U);
+      Router remote(2U);
+
+      bus.subscribe(0U, local);
+      bus.subscribe(1U, remote);
+
+      bus.send(0U, CommandMessage());
+
+      CHECK_EQUAL(1U, local.commands);
+      CHECK_EQUAL(0U, bus.pending(1U));
+      CHECK_EQUAL(0U, remote.commands);
+    }
+
+    //*************************************************************************
+    TEST(test_batch_limit)
+    {
+      CorePool pool0;
+      Bus      bus;
+      Router   remote(1U);
+
+      bus.subscribe(1U, remote);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, i))));
+      }
+
+      CHECK_EQUAL(3U, bus.process(1U, 3U));
+      CHECK_EQUAL(1U, bus.pending(1U));
+      CHECK_EQUAL(1U, bus.process(1U, 3U));
+
+      CHECK_EQUAL(4U, remote.samples.size());
+
+      for (size_t i = 0U; i < remote.samples.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), remote.samples[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_full_inbox_drops)
+    {
+      CorePool pool0;
+      Bus      bus;
+      Router   remote1(1U);
+      Router   remote2(2U);
+
+      bus.subscribe(1U, remote1);
+      bus.subscribe(2U, remote2);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, i))));
+      }
+
+      bus.process(2U);
+
+      // Core 1 is full, core 2 still receives.
+      CHECK(!bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, 4))));
+      CHECK_EQUAL(1U, bus.drop_count(0U));
+      CHECK_EQUAL(4U, bus.pending(1U));
+      CHECK_EQUAL(1U, bus.pending(2U));
+
+      bus.reset_statistics(0U);
+      CHECK_EQUAL(0U, bus.drop_count(0U));
+    }
+
+    //*************************************************************************
+    TEST(test_release_on_sending_core)
+    {
+      CorePool pool0;
+      Bus      bus;
+      Router   remote(1U);
+
+      bus.subscribe(1U, remote);
+
+      etl::shared_message sm(pool0.pool, CommandMessage());
+
+      bus.send(0U, sm);
+      CHECK_EQUAL(2U, sm.get_reference_count());
+
+      // Delivered, but handed back to core 0 rather than released.
+      bus.process(1U);
+      CHECK_EQUAL(1U, remote.commands);
+      CHECK_EQUAL(2U, sm.get_reference_count());
+
+      // Core 0 drops its reference.
+      bus.process(0U);
+      CHECK_EQUAL(1U, sm.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_backpressure_from_sender)
+    {
+      CorePool pool0;
+      Bus      bus;
+      Router   remote(1U);
+
+      bus.subscribe(1U, remote);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, i)));
+      }
+
+      CHECK_EQUAL(4U, bus.process(1U));
+
+      for (int i = 4; i < 8; ++i)
+      {
+        bus.send(0U, etl::shared_message(pool0.pool, TelemetryMessage(0U, i)));
+      }
+
+      // Core 0 has not taken back the delivered messages yet.
+      CHECK_EQUAL(0U, bus.process(1U));
+      CHECK_EQUAL(4U, bus.pending(1U));
+
+      bus.process(0U);
+      CHECK_EQUAL(4U, bus.process(1U));
+      CHECK_EQUAL(8U, remote.samples.size());
+    }
+
+    //*************************************************************************
+    TEST(test_cores_on_threads)
+    {
+      constexpr size_t N_Cores    = 3U;
+      constexpr int    N_Messages = 300;
+
+      using ThreadBus = etl::multi_core_message_bus<N_Cores, 1U, 8U>;
+
+      CorePool  pools[N_Cores];
+      ThreadBus bus;
+
+      Router router0(1U);
+      Router router1(2U);
+      Router router2(3U);
+
+      Router* routers[N_Cores] = { &router0, &router1, &router2 };
+
+      for (size_t core = 0U; core < N_Cores; ++core)
+      {
+        bus.subscribe(core, *routers[core]);
+      }
+
+      std::atomic<size_t> sent(0U);
+      std::atomic<size_t> drained(0U);
+
+      auto run = [&](size_t core)
+      {
+        for (int i = 0; i < N_Messages; ++i)
+        {
+          bus.send(core, etl::shared_message(pools[core].pool, TelemetryMessage(core, i)));
+          bus.process(core);
+        }
+
+        sent.fetch_add(1U);
+
+        while ((sent.load() != N_Cores) || (bus.pending(core) != 0U))
+        {
+          bus.process(core);
+        }
+
+        drained.fetch_add(1U);
+
+        while (drained.load() != N_Cores)
+        {
+          bus.process(core);
+        }
+      };
+
+      std::thread core0(run, 0U);
+      std::thread core1(run, 1U);
+      std::thread core2(run, 2U);
+
+      core0.join();
+      core1.join();
+      core2.join();
+
+      size_t drops = 0U;
+
+      for (size_t core = 0U; core < N_Cores; ++core)
+      {
+        bus.process(core);
+        drops += bus.drop_count(core);
+      }
+
+      size_t remote_received = 0U;
+
+      for (size_t core = 0U; core < N_Cores; ++core)
+      {
+        std::vector<int> previous(N_Cores, -1);
+        size_t           local_received = 0U;
+
+        for (size_t i = 0U; i < routers[core]->sources.size(); ++i)
+        {
+          const size_t source = routers[core]->sources[i];
+          const int    sample = routers[core]->samples[i];
+
+          // Messages from each core arrive in order.
+          CHECK(sample > previous[source]);
+          previous[source] = sample;
+
+          if (source == core)
+          {
+            ++local_received;
+          }
+          else
+          {
+            ++remote_received;
+          }
+        }
+
+        CHECK_EQUAL(size_t(N_Messages), local_received);
+      }
+
+      CHECK_EQUAL(N_Cores * (N_Cores - 1U) * size_t(N_Messages), remote_received + drops);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,273 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/multi_pattern_matcher.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+  using Matcher = etl::multi_pattern_matcher<32U>;
+
+  typedef std::tuple<size_t, size_t, size_t> Found; // Position, pattern, length.
+
+  //*************************************************************************
+  std::vector<Found> to_found(const std::vector<etl::pattern_match>& matches)
+  {
+    std::vector<Found> found;
+
+    for (const etl::pattern_match& match : matches)
+    {
+      found.push_back(Found(match.position, match.pattern, match.length));
+    }
+
+    std::sort(found.begin(), found.end());
+
+    return found;
+  }
+
+  //*************************************************************************
+  std::vector<Found> brute_force(const std::string& text, const std::vector<std::string>& patterns)
+  {
+    std::vector<Found> found;
+
+    for (size_t p = 0U; p < patterns.size(); ++p)
+    {
+      for (size_t i = text.find(patterns[p]); i != std::string::npos; i = text.find(patterns[p], i + 1U))
+      {
+        found.push_back(Found(i, p, patterns[p].size()));
+      }
+    }
+
+    std::sort(found.begin(), found.end());
+
+    return found;
+  }
+
+#if ETL_USING_CPP14
+  constexpr size_t count_matches(const etl::multi_pattern_matcher<16U>& matcher, const char* text)
+  {
+    size_t count = 0U;
+    etl::pattern_match matches[8] = {};
+
+    count = size_t(matcher.find_all(etl::string_view(text), matches) - matches);
+
+    return count;
+  }
+#endif
+
+  SUITE(test_multi_pattern_matcher)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Matcher matcher;
+
+      CHECK_EQUAL(0U, matcher.pattern_count());
+      CHECK_EQUAL(1U, matcher.state_count());
+      CHECK(!matcher.is_built());
+      CHECK_EQUAL(32U, Matcher::Max_States);
+      CHECK_EQUAL(31U, Matcher::Max_Patterns);
+
+      matcher.build();
+      CHECK(matcher.is_built());
+      CHECK(!matcher.contains_any(etl::string_view("anything")));
+    }
+
+    //*************************************************************************
+    TEST(test_overlapping_patterns)
+    {
+      Matcher matcher;
+
+      CHECK(matcher.add(etl::string_view("he")));
+      CHECK(matcher.add(etl::string_view("she")));
+      CHECK(matcher.add(etl::string_view("his")));
+      CHECK(matcher.add(etl::string_view("hers")));
+      matcher.build();
+
+      CHECK_EQUAL(4U, matcher.pattern_count());
+      CHECK_EQUAL(10U, matcher.state_count());
+
+      std::vector<etl::pattern_match> matches;
+      matcher.find_all(etl::string_view("ushers"), std::back_inserter(matches));
+
+      // "she" and "he" end at 3, "hers" at 5.
+      CHECK_EQUAL(3U, matches.size());
+      CHECK_EQUAL(1U, matches[0].pattern);
+      CHECK_EQUAL(1U, matches[0].position);
+      CHECK_EQUAL(3U, matches[0].length);
+      CHECK_EQUAL(0U, matches[1].pattern);
+      CHECK_EQUAL(2U, matches[1].position);
+      CHECK_EQUAL(3U, matches[2].pattern);
+      CHECK_EQUAL(2U, matches[2].position);
+      CHECK_EQUAL(4U, matches[2].length);
+    }
+
+    //*************************************************************************
+    TEST(test_scan_callback)
+    {
+      Matcher matcher;
+
+      matcher.add(etl::string_view("error"));
+      matcher.add(etl::string_view("warn"));
+      matcher.build();
+
+      std::vector<size_t> positions;
+
+      size_t count = matcher.scan(etl::string_view("warn: error, error"), [&](const etl::pattern_match& match)
+      {
+        positions.push_back(match.position);
+      });
+
+      CHECK_EQUAL(3U, count);
+      CHECK((std::vector<size_t>{ 0U, 6U, 13U }) == positions);
+    }
+
+    //*************************************************************************
+    TEST(test_find_first)
+    {
+      Matcher matcher;
+
+      matcher.add(etl::string_view("abcd"));
+      matcher.add(etl::string_view("bc"));
+      matcher.build();
+
+      etl::pattern_match match = { 0U, 0U, 0U };
+
+      CHECK(matcher.find_first(etl::string_view("xabcd"), match));
+      CHECK_EQUAL(1U, match.pattern);
+      CHECK_EQUAL(2U, match.position);
+
+      CHECK(!matcher.find_first(etl::string_view("acbd"), match));
+      CHECK(matcher.contains_any(etl::string_view("zzabcd")));
+      CHECK(!matcher.contains_any(etl::string_view("")));
+    }
+
+    //*************************************************************************
+    TEST(test_add_rejects)
+    {
+      etl::multi_pattern_matcher<6U, 2U> matcher;
+
+      CHECK(!matcher.add(etl::string_view("")));
+      CHECK(matcher.add(etl::string_view("abc")));
+      CHECK(!matcher.add(etl::string_view("abc")));    // Duplicate.
+      CHECK(!matcher.add(etl::string_view("xyz")));    // Not enough states.
+      CHECK_EQUAL(4U, matcher.state_count());          // Unchanged by the failed add.
+      CHECK(matcher.add(etl::string_view("ab")));      // A prefix needs no states.
+      CHECK(!matcher.add(etl::string_view("a")));      // Too many patterns.
+      CHECK_EQUAL(2U, matcher.pattern_count());
+      CHECK_EQUAL(2U, matcher.pattern_length(1U));
+
+      matcher.clear();
+      CHECK_EQUAL(0U, matcher.pattern_count());
+      CHECK(matcher.add(etl::string_view("xyz")));
+      matcher.build();
+      CHECK(matcher.contains_any(etl::string_view("wxyz")));
+      CHECK(!matcher.contains_any(etl::string_view("abc")));
+    }
+
+    //*************************************************************************
+    TEST(test_against_brute_force)
+    {
+      std::mt19937 generator(11);
+      std::uniform_int_distribution<int> letter(0, 3);
+      std::uniform_int_distribution<int> length(1, 5);
+
+      for (int pass = 0; pass < 20; ++pass)
+      {
+        etl::multi_pattern_matcher<256U> matcher;
+        std::vector<std::string> patterns;
+
+        for (int p = 0; p < 20; ++p)
+        {
+          std::string pattern;
+
+          for (int i = length(generator); i > 0; --i)
+          {
+            pattern += char('a' + letter(generator));
+          }
+
+          if (matcher.add(etl::string_view(pattern.c_str(), pattern.size())))
+          {
+            patterns.push_back(pattern);
+          }
+        }
+
+        matcher.build();
+
+        std::string text;
+
+        for (int i = 0; i < 300; ++i)
+        {
+          text += char('a' + letter(generator));
+        }
+
+        std::vector<etl::pattern_match> matches;
+        matcher.find_all(etl::string_view(text.c_str(), text.size()), std::back_inserter(matches));
+
+        CHECK(brute_force(text, patterns) == to_found(matches));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_binary_text)
+    {
+      Matcher matcher;
+
+      const char pattern[] = { char(0xFF), char(0x00), char(0x80) };
+      const char text[]    = { 'a', char(0xFF), char(0x00), char(0x80), 'b' };
+
+      matcher.add(etl::string_view(pattern, sizeof(pattern)));
+      matcher.build();
+
+      etl::pattern_match match = { 0U, 0U, 0U };
+      CHECK(matcher.find_first(etl::string_view(text, sizeof(text)), match));
+      CHECK_EQUAL(1U, match.position);
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_constexpr)
+    {
+      static constexpr etl::multi_pattern_matcher<16U> matcher = etl::make_multi_pattern_matcher<16U>("cat", "at", "tea");
+
+      static_assert(matcher.is_built(), "Not built at compile time");
+      static_assert(matcher.pattern_count() == 3U, "Wrong pattern count");
+      static_assert(count_matches(matcher, "a cat ate tea") == 4U, "Wrong match count");
+
+      CHECK_EQUAL(4U, count_matches(matcher, "a cat ate tea"));
+    }
+#endif
+  }
+}
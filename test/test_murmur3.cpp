@@ -34,11 +34,32 @@ SOFTWARE.
 #include <string>
 #include <vector>
 #include <stdint.h>
+#include <string.h>
 
 #include "etl/murmur3.h"
 
 namespace
 {
+  // The reference implementation reads whole words, so is given an aligned copy.
+  uint32_t reference_x86_32(const uint8_t* data, size_t length, uint32_t seed)
+  {
+    std::vector<uint64_t> aligned((length / sizeof(uint64_t)) + 1U);
+    memcpy(aligned.data(), data, length);
+
+    uint32_t hash;
+    MurmurHash3_x86_32(aligned.data(), int(length), seed, &hash);
+
+    return hash;
+  }
+
+  void reference_x64_128(const uint8_t* data, size_t length, uint32_t seed, uint64_t* hash)
+  {
+    std::vector<uint64_t> aligned((length / sizeof(uint64_t)) + 1U);
+    memcpy(aligned.data(), data, length);
+
+    MurmurHash3_x64_128(aligned.data(), int(length), seed, hash);
+  }
+
   SUITE(test_murmur3)
   {
     //*************************************************************************
@@ -122,6 +143,114 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_block_matches_byte_at_a_time)
+    {
+      std::vector<uint8_t> data(100U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 167U) + 0x80U);
+      }
+
+      for (size_t offset = 0U; offset < 4U; ++offset)
+      {
+        for (size_t length = 0U; length < (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          uint32_t compare = reference_x86_32(begin, length, 0x1234U);
+
+          // Pointer range, split so that the block path starts part way into a block.
+          etl::murmur3<uint32_t> by_block(0x1234U);
+          by_block.add(begin, begin + (length / 3U));
+          by_block.add(begin + (length / 3U), begin + length);
+
+          // Not a pointer, so byte at a time.
+          uint32_t by_byte = etl::murmur3<uint32_t>(data.begin() + offset, data.begin() + offset + length, 0x1234U);
+
+          CHECK_EQUAL(compare, by_block.value());
+          CHECK_EQUAL(compare, by_byte);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_signed_chars)
+    {
+      std::string data("\x80\xFF\x7F\x90\xA5");
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.data(), int(data.size()), 0, &compare);
+
+      CHECK_EQUAL(compare, etl::murmur3<uint32_t>(data.begin(), data.end()).value());
+      CHECK_EQUAL(compare, etl::murmur3<uint32_t>(data.data(), data.data() + data.size()).value());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 131U) + 7U);
+      }
+
+      for (size_t offset = 0U; offset < 8U; ++offset)
+      {
+        for (size_t length = 0U; length < (data.size() - offset); ++length)
+        {
+          const uint8_t* begin = data.data() + offset;
+
+          uint64_t compare[2];
+          reference_x64_128(begin, length, 0x5678U, compare);
+
+          etl::murmur3_x64_128 by_block(0x5678U);
+          by_block.add(begin, begin + (length / 3U));
+          by_block.add(begin + (length / 3U), begin + length);
+
+          etl::murmur3_x64_128 by_byte(data.begin() + offset, data.begin() + offset + length, 0x5678U);
+
+          etl::murmur3_x64_128::value_type hash = by_block.value();
+
+          CHECK_EQUAL(compare[0], hash.h1);
+          CHECK_EQUAL(compare[1], hash.h2);
+          CHECK(hash == by_byte.value());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_known_value)
+    {
+      std::string data("hello");
+
+      etl::murmur3_x64_128 murmur(data.begin(), data.end());
+
+      CHECK_EQUAL(0xCBD8A7B341BD9B02ULL, murmur.value().h1);
+      CHECK_EQUAL(0x5B1E906A48AE1D19ULL, murmur.value().h2);
+      CHECK_EQUAL(0xCBD8A7B341BD9B02ULL, murmur.value_64());
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_add_values)
+    {
+      std::string data("123456789012345678901234567890");
+
+      etl::murmur3_x64_128 murmur;
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        murmur.add(uint8_t(data[i]));
+      }
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 0, compare);
+
+      CHECK_EQUAL(compare[0], murmur.value().h1);
+      CHECK_EQUAL(compare[1], murmur.value().h2);
+    }
   };
 }
-
@@ -0,0 +1,224 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/mutex.h"
+#include "etl/mutex/mutex_spin.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_lockable.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  //***************************************************************************
+  template <typename TMutex>
+  bool counts_without_lost_updates()
+  {
+    static const int Threads    = 4;
+    static const int Increments = 20000;
+
+    TMutex mutex;
+    int    counter = 0;
+
+    std::vector<std::thread> threads;
+
+    for (int t = 0; t < Threads; ++t)
+    {
+      threads.push_back(std::thread([&mutex, &counter]()
+      {
+        for (int i = 0; i < Increments; ++i)
+        {
+          etl::lock_guard<TMutex> guard(mutex);
+          ++counter;
+        }
+      }));
+    }
+
+    for (size_t t = 0; t < threads.size(); ++t)
+    {
+      threads[t].join();
+    }
+
+    return counter == (Threads * Increments);
+  }
+
+  //***************************************************************************
+  template <typename TMutex>
+  void check_try_lock_and_contention()
+  {
+    TMutex mutex;
+
+    CHECK(mutex.try_lock());
+    CHECK(!mutex.try_lock());
+    mutex.unlock();
+
+    mutex.lock();
+    CHECK_EQUAL(0U, mutex.get_contention_count());
+
+    // A second thread has to wait for the lock.
+    std::thread waiter([&mutex]()
+    {
+      mutex.lock();
+      mutex.unlock();
+    });
+
+    while (mutex.get_contention_count() == 0U)
+    {
+      std::this_thread::yield();
+    }
+
+    mutex.unlock();
+    waiter.join();
+
+    CHECK_EQUAL(1U, mutex.get_contention_count());
+    mutex.reset_contention_count();
+    CHECK_EQUAL(0U, mutex.get_contention_count());
+
+    CHECK(mutex.try_lock());
+    mutex.unlock();
+  }
+
+  //***************************************************************************
+  class QueueTicket : public etl::queue_lockable<int, 8>
+  {
+  public:
+
+    void lock() const override
+    {
+      access.lock();
+    }
+
+    void unlock() const override
+    {
+      access.unlock();
+    }
+
+    mutable etl::ticket_mutex access;
+  };
+
+  SUITE(test_mutex_spin)
+  {
+    //*************************************************************************
+    TEST(test_spin_mutex)
+    {
+      check_try_lock_and_contention<etl::spin_mutex>();
+      CHECK(counts_without_lost_updates<etl::spin_mutex>());
+    }
+
+    //*************************************************************************
+    TEST(test_ticket_mutex)
+    {
+      check_try_lock_and_contention<etl::ticket_mutex>();
+      CHECK(counts_without_lost_updates<etl::ticket_mutex>());
+    }
+
+    //*************************************************************************
+    TEST(test_mcs_mutex)
+    {
+      check_try_lock_and_contention<etl::mcs_mutex>();
+      CHECK(counts_without_lost_updates<etl::mcs_mutex>());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_mpmc_mutex_with_mcs_mutex)
+    {
+      static const int Producers = 3;
+      static const int Count     = 5000;
+
+      etl::queue_mpmc_mutex<int, 16, etl::memory_model::MEMORY_MODEL_LARGE, etl::mcs_mutex> queue;
+
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&queue]()
+        {
+          for (int i = 1; i <= Count; )
+          {
+            if (queue.push(i))
+            {
+              ++i;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      long long total    = 0;
+      int       received = 0;
+
+      while (received < (Producers * Count))
+      {
+        int value;
+
+        if (queue.pop(value))
+        {
+          total += value;
+          ++received;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t p = 0; p < producers.size(); ++p)
+      {
+        producers[p].join();
+      }
+
+      CHECK_EQUAL(Producers * ((long long)(Count) * (Count + 1) / 2), total);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_lockable_with_ticket_mutex)
+    {
+      QueueTicket queue;
+
+      CHECK(queue.push(1));
+      CHECK(queue.push(2));
+
+      int value;
+      CHECK(queue.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(0U, queue.access.get_contention_count());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,270 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#define ETL_NODE_PREFETCH_ENABLE
+
+#include "unit_test_framework.h"
+
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/intrusive_forward_list.h"
+#include "etl/map.h"
+#include "etl/unordered_map.h"
+#include "etl/unordered_set.h"
+#include "etl/unordered_multimap.h"
+#include "etl/unordered_multiset.h"
+#include "etl/span.h"
+
+#include <numeric>
+
+namespace
+{
+  typedef etl::unordered_map<int, int, 32, 16>    Map;
+  typedef etl::unordered_set<int, 32, 16>         Set;
+  typedef etl::unordered_multimap<int, int, 32, 16> MultiMap;
+  typedef etl::unordered_multiset<int, 32, 16>    MultiSet;
+
+  struct Item : public etl::forward_link<0>
+  {
+    Item(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  SUITE(test_node_prefetch)
+  {
+    //*************************************************************************
+    TEST(test_prefetch_enabled)
+    {
+      CHECK(etl::traits::has_node_prefetch);
+    }
+
+    //*************************************************************************
+    TEST(test_list_traversal)
+    {
+      etl::list<int, 20> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK_EQUAL(190, std::accumulate(data.begin(), data.end(), 0));
+
+      const etl::list<int, 20>& cdata = data;
+      CHECK_EQUAL(190, std::accumulate(cdata.begin(), cdata.end(), 0));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_forward_list_traversal)
+    {
+      etl::forward_list<int, 20> data;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.push_front(i);
+      }
+
+      CHECK_EQUAL(190, std::accumulate(data.begin(), data.end(), 0));
+
+      const etl::forward_list<int, 20>& cdata = data;
+      CHECK_EQUAL(190, std::accumulate(cdata.begin(), cdata.end(), 0));
+
+      data.clear();
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_intrusive_forward_list_traversal)
+    {
+      Item items[] = { Item(1), Item(2), Item(3), Item(4) };
+
+      etl::intrusive_forward_list<Item, etl::forward_link<0> > data(items, items + 4);
+
+      int sum = 0;
+
+      for (etl::intrusive_forward_list<Item, etl::forward_link<0> >::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        sum += itr->value;
+      }
+
+      CHECK_EQUAL(10, sum);
+
+      data.clear();
+    }
+
+    //*************************************************************************
+    TEST(test_map_traversal)
+    {
+      etl::map<int, int, 20> data;
+
+      for (int i = 19; i >= 0; --i)
+      {
+        data.insert(etl::make_pair(i, i * 2));
+      }
+
+      int expected = 0;
+
+      for (etl::map<int, int, 20>::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK_EQUAL(expected, itr->first);
+        CHECK_EQUAL(expected * 2, itr->second);
+        ++expected;
+      }
+
+      CHECK_EQUAL(20, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_find_batch)
+    {
+      Map data;
+
+      for (int i = 0; i < 32; i += 2)
+      {
+        data.insert(Map::value_type(i, i * 10));
+      }
+
+      int keys[20];
+
+      for (int i = 0; i < 20; ++i)
+      {
+        keys[i] = i;
+      }
+
+      Map::iterator results[20];
+
+      size_t n = data.find_batch(etl::span<const int>(keys), etl::span<Map::iterator>(results));
+
+      CHECK_EQUAL(20U, n);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK(results[i] == data.find(i));
+
+        if ((i % 2) == 0)
+        {
+          CHECK_EQUAL(i * 10, results[i]->second);
+        }
+        else
+        {
+          CHECK(results[i] == data.end());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_map_find_batch_const_short_results)
+    {
+      Map data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        data.insert(Map::value_type(i, i));
+      }
+
+      const Map& cdata = data;
+
+      int keys[] = { 3, 11, 7 };
+      Map::const_iterator results[2];
+
+      size_t n = cdata.find_batch(etl::span<const int>(keys), etl::span<Map::const_iterator>(results));
+
+      CHECK_EQUAL(2U, n);
+      CHECK_EQUAL(3, results[0]->second);
+      CHECK(results[1] == cdata.end());
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_set_find_batch)
+    {
+      Set data;
+
+      for (int i = 0; i < 30; i += 3)
+      {
+        data.insert(i);
+      }
+
+      int keys[12];
+
+      for (int i = 0; i < 12; ++i)
+      {
+        keys[i] = i;
+      }
+
+      Set::iterator results[12];
+      Set::const_iterator cresults[12];
+
+      CHECK_EQUAL(12U, data.find_batch(etl::span<const int>(keys), etl::span<Set::iterator>(results)));
+      CHECK_EQUAL(12U, static_cast<const Set&>(data).find_batch(etl::span<const int>(keys), etl::span<Set::const_iterator>(cresults)));
+
+      for (int i = 0; i < 12; ++i)
+      {
+        CHECK(results[i] == data.find(i));
+        CHECK(cresults[i] == results[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unordered_multi_find_batch)
+    {
+      MultiMap mmap;
+      MultiSet mset;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        mmap.insert(MultiMap::value_type(i % 4, i));
+        mset.insert(i % 4);
+      }
+
+      int keys[] = { 0, 1, 2, 3, 4, 5 };
+      MultiMap::iterator mmap_results[6];
+      MultiSet::iterator mset_results[6];
+
+      CHECK_EQUAL(6U, mmap.find_batch(etl::span<const int>(keys), etl::span<MultiMap::iterator>(mmap_results)));
+      CHECK_EQUAL(6U, mset.find_batch(etl::span<const int>(keys), etl::span<MultiSet::iterator>(mset_results)));
+
+      for (int i = 0; i < 6; ++i)
+      {
+        CHECK(mmap_results[i] == mmap.find(keys[i]));
+        CHECK(mset_results[i] == mset.find(keys[i]));
+      }
+
+      CHECK(mmap_results[4] == mmap.end());
+      CHECK(mset_results[5] == mset.end());
+    }
+  }
+}
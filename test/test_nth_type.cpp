@@ -33,6 +33,27 @@ SOFTWARE.
 
 namespace
 {
+  template <size_t N>
+  struct Tag
+  {
+  };
+
+  //*************************************************************************
+  template <size_t... Indices>
+  bool check_long_list(etl::index_sequence<Indices...>)
+  {
+    bool result = true;
+
+    const bool matches[] = { std::is_same<etl::nth_type_t<Indices, Tag<Indices>...>, Tag<Indices>>::value... };
+
+    for (size_t i = 0U; i < sizeof...(Indices); ++i)
+    {
+      result = result && matches[i];
+    }
+
+    return result;
+  }
+
   SUITE(test_nth_type)
   {
     //*************************************************************************
@@ -42,5 +63,20 @@ namespace
       CHECK((std::is_same<etl::nth_type_t<1, int, long, double>, long>::value));
       CHECK((std::is_same<etl::nth_type_t<2, int, long, double>, double>::value));
     }
+
+    //*************************************************************************
+    TEST(test_nth_type_repeated_and_qualified_types)
+    {
+      CHECK((std::is_same<etl::nth_type_t<0, int, int, const int&>, int>::value));
+      CHECK((std::is_same<etl::nth_type_t<1, int, int, const int&>, int>::value));
+      CHECK((std::is_same<etl::nth_type_t<2, int, int, const int&>, const int&>::value));
+      CHECK((std::is_same<etl::nth_type_t<1, void, const volatile char, void>, const volatile char>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_nth_type_long_list)
+    {
+      CHECK(check_long_list(etl::make_index_sequence<100>()));
+    }
   }
 }
@@ -486,6 +486,82 @@ namespace
       observable.clear_observers();
       CHECK_EQUAL(0UL, observable.number_of_observers());
     }
+
+    //*************************************************************************
+    TEST(test_batch_notification)
+    {
+      typedef etl::observer<int, etl::span<const int> > BatchObserverType;
+
+      struct BatchObserver : public BatchObserverType
+      {
+        BatchObserver()
+          : single_count(0)
+          , batch_count(0)
+          , total(0)
+        {
+        }
+
+        void notification(int n)
+        {
+          ++single_count;
+          total += n;
+        }
+
+        void notification(etl::span<const int> batch)
+        {
+          ++batch_count;
+
+          for (size_t i = 0; i < batch.size(); ++i)
+          {
+            total += batch[i];
+          }
+        }
+
+        int single_count;
+        int batch_count;
+        int total;
+      };
+
+      struct BatchObservable : public etl::observable<BatchObserverType, 3>
+      {
+      };
+
+      BatchObservable observable;
+      BatchObserver   observer1;
+      BatchObserver   observer2;
+      BatchObserver   observer3;
+
+      observable.add_observer(observer1);
+      observable.add_observer(observer2);
+      observable.add_observer(observer3);
+      observable.disable_observer(observer2);
+
+      const int data[] = { 1, 2, 3, 4 };
+
+      observable.notify_observers(etl::span<const int>(data));
+      observable.notify_observers(5);
+
+      CHECK_EQUAL(1, observer1.batch_count);
+      CHECK_EQUAL(1, observer1.single_count);
+      CHECK_EQUAL(15, observer1.total);
+
+      CHECK_EQUAL(0, observer2.batch_count);
+      CHECK_EQUAL(0, observer2.single_count);
+      CHECK_EQUAL(0, observer2.total);
+
+      CHECK_EQUAL(1, observer3.batch_count);
+      CHECK_EQUAL(1, observer3.single_count);
+      CHECK_EQUAL(15, observer3.total);
+
+      observable.enable_observer(observer2);
+      observable.remove_observer(observer1);
+      observable.notify_observers(etl::span<const int>(data));
+
+      CHECK_EQUAL(1, observer1.batch_count);
+      CHECK_EQUAL(1, observer2.batch_count);
+      CHECK_EQUAL(10, observer2.total);
+      CHECK_EQUAL(2, observer3.batch_count);
+      CHECK_EQUAL(25, observer3.total);
+    }
   }
 }
-
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <string>
 #include <ostream>
 #include <cstdint>
+#include <type_traits>
 
 #include "etl/optional.h"
 #include "etl/vector.h"
@@ -629,7 +630,36 @@ namespace
       CHECK_EQUAL(42, (*opt).v);
     }
 #endif
-  };
-}
 
+    //*************************************************************************
+    TEST(test_optional_pod_is_trivially_copyable)
+    {
+      struct Pod
+      {
+        int    i;
+        double d;
+      };
+
+      CHECK_TRUE(std::is_trivially_copyable<etl::optional<int>>::value);
+#if ETL_USING_STL && !defined(ETL_USER_DEFINED_TYPE_TRAITS)
+      CHECK_TRUE(std::is_trivially_copyable<etl::optional<Pod>>::value);
+      CHECK_TRUE(std::is_trivially_destructible<etl::optional<Pod>>::value);
+#endif
+      CHECK_FALSE(std::is_trivially_copyable<etl::optional<std::string>>::value);
+
+      etl::optional<Pod> opt1;
+      etl::optional<Pod> opt2(Pod{ 1, 2.0 });
+
+      opt1 = opt2;
+      CHECK_TRUE(opt1.has_value());
+      CHECK_EQUAL(1, opt1.value().i);
+
+      opt2 = etl::nullopt;
+      etl::optional<Pod> opt3(opt2);
+      CHECK_FALSE(opt3.has_value());
 
+      opt1 = opt3;
+      CHECK_FALSE(opt1.has_value());
+    }
+  };
+}
@@ -0,0 +1,230 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/overwrite_ring_spsc.h"
+
+#include <thread>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Each field is derived from the first, so a torn read can be detected.
+  struct Sample
+  {
+    uint32_t number;
+    uint32_t check;
+    uint16_t low;
+  };
+
+  Sample make_sample(uint32_t number)
+  {
+    Sample sample;
+    sample.number = number;
+    sample.check  = ~number;
+    sample.low    = uint16_t(number);
+
+    return sample;
+  }
+
+  bool is_consistent(const Sample& sample)
+  {
+    return (sample.check == ~sample.number) && (sample.low == uint16_t(sample.number));
+  }
+
+  typedef etl::overwrite_ring_spsc<Sample, 8> Ring;
+
+  SUITE(test_overwrite_ring_spsc)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Ring ring;
+      Sample sample;
+
+      CHECK(ring.empty());
+      CHECK_EQUAL(0U, ring.size());
+      CHECK_EQUAL(8U, ring.capacity());
+      CHECK_EQUAL(0U, ring.total_written());
+      CHECK(!ring.latest(sample));
+      CHECK(!ring.try_pop(sample));
+      CHECK(!ring.pop(sample));
+    }
+
+    //*************************************************************************
+    TEST(test_read_latest)
+    {
+      Ring ring;
+      Sample samples[8];
+
+      ring.push(make_sample(1U));
+      ring.push(make_sample(2U));
+      ring.push(make_sample(3U));
+
+      CHECK_EQUAL(3U, ring.read_latest(samples, 5U));
+      CHECK_EQUAL(1U, samples[0].number);
+      CHECK_EQUAL(3U, samples[2].number);
+
+      CHECK(!ring.try_read_latest(samples, 4U));
+      CHECK(ring.try_read_latest(samples, 2U));
+      CHECK_EQUAL(2U, samples[0].number);
+      CHECK_EQUAL(3U, samples[1].number);
+
+      // Reading does not remove the samples.
+      CHECK_EQUAL(3U, ring.size());
+
+      for (uint32_t i = 4U; i <= 20U; ++i)
+      {
+        ring.push(make_sample(i));
+      }
+
+      // Older samples have been overwritten.
+      CHECK_EQUAL(8U, ring.read_latest(samples, 10U));
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(13U + i, samples[i].number);
+        CHECK(is_consistent(samples[i]));
+      }
+
+      Sample sample;
+      CHECK(ring.try_latest(sample));
+      CHECK_EQUAL(20U, sample.number);
+      CHECK(ring.latest(sample));
+      CHECK_EQUAL(20U, sample.number);
+      CHECK_EQUAL(20U, ring.total_written());
+    }
+
+    //*************************************************************************
+    TEST(test_pop_counts_overruns)
+    {
+      Ring ring;
+      Sample sample;
+
+      ring.push(make_sample(1U));
+      ring.push(make_sample(2U));
+
+      CHECK(ring.pop(sample));
+      CHECK_EQUAL(1U, sample.number);
+      CHECK_EQUAL(1U, ring.size());
+
+      for (uint32_t i = 3U; i <= 12U; ++i)
+      {
+        ring.push(make_sample(i));
+      }
+
+      CHECK_EQUAL(8U, ring.size());
+
+      // 2, 3 and 4 were overwritten.
+      CHECK(ring.pop(sample));
+      CHECK_EQUAL(5U, sample.number);
+      CHECK_EQUAL(3U, ring.overruns());
+
+      uint32_t expected = 6U;
+
+      while (ring.pop(sample))
+      {
+        CHECK_EQUAL(expected, sample.number);
+        ++expected;
+      }
+
+      CHECK_EQUAL(13U, expected);
+      CHECK(ring.empty());
+
+      ring.clear_overruns();
+      CHECK_EQUAL(0U, ring.overruns());
+
+      ring.push(make_sample(13U));
+      ring.discard();
+      CHECK(ring.empty());
+      CHECK(!ring.pop(sample));
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_producer_and_consumer)
+    {
+      static const uint32_t Writes = 200000U;
+
+      etl::overwrite_ring_spsc<Sample, 16> ring;
+      std::atomic<bool> done(false);
+      bool consistent = true;
+      uint32_t popped = 0U;
+
+      std::thread producer([&]()
+      {
+        for (uint32_t number = 0U; number < Writes; ++number)
+        {
+          ring.push(make_sample(number));
+        }
+
+        done.store(true);
+      });
+
+      uint32_t last_popped = 0U;
+      Sample latest[4];
+
+      while (!done.load() || !ring.empty())
+      {
+        const size_t count = ring.read_latest(latest, 4U);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          // The latest samples are intact and consecutive.
+          if (!is_consistent(latest[i]) || ((i > 0U) && (latest[i].number != latest[i - 1U].number + 1U)))
+          {
+            consistent = false;
+          }
+        }
+
+        Sample sample;
+
+        if (ring.pop(sample))
+        {
+          if (!is_consistent(sample) || ((popped > 0U) && (sample.number <= last_popped)))
+          {
+            consistent = false;
+          }
+
+          last_popped = sample.number;
+          ++popped;
+        }
+      }
+
+      producer.join();
+
+      CHECK(consistent);
+      CHECK_EQUAL(Writes - 1U, last_popped);
+      CHECK_EQUAL(Writes, popped + ring.overruns());
+    }
+  }
+}
+
+#endif
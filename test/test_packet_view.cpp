@@ -0,0 +1,239 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/packet_view.h"
+
+#include <string.h>
+
+namespace
+{
+  struct Header
+  {
+    uint16_t type;
+    uint16_t length;
+    uint32_t sequence;
+  };
+
+  struct Buffer
+  {
+    Buffer()
+    {
+      memset(data, 0, sizeof(data));
+
+      Header header = { 0x0102U, 4U, 0x11223344UL };
+      memcpy(data, &header, sizeof(header));
+
+      data[sizeof(Header) + 0U] = 'a';
+      data[sizeof(Header) + 1U] = 'b';
+      data[sizeof(Header) + 2U] = 'c';
+      data[sizeof(Header) + 3U] = 'd';
+    }
+
+    union
+    {
+      uint32_t align;
+      uint8_t  data[sizeof(Header) + 4U];
+    };
+  };
+
+  SUITE(test_packet_view)
+  {
+    //*************************************************************************
+    TEST(test_default_is_invalid)
+    {
+      etl::packet_view<Header> view;
+
+      CHECK(!view.is_valid());
+      CHECK(!bool(view));
+      CHECK_EQUAL(0U, view.size());
+      CHECK(view.buffer().empty());
+      CHECK(view.payload().empty());
+      CHECK_THROW(view.get(), etl::packet_view_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_view_in_place)
+    {
+      Buffer buffer;
+
+      etl::packet_view<Header> view(buffer.data, sizeof(buffer.data));
+
+      CHECK(view.is_valid());
+      CHECK_EQUAL(0x0102U, view->type);
+      CHECK_EQUAL(4U, (*view).length);
+      CHECK_EQUAL(0x11223344UL, view.get().sequence);
+
+      // No copy was made.
+      CHECK(static_cast<void*>(&view.get()) == static_cast<void*>(buffer.data));
+
+      view->sequence = 5U;
+      Header header;
+      memcpy(&header, buffer.data, sizeof(header));
+      CHECK_EQUAL(5U, header.sequence);
+
+      CHECK_EQUAL(sizeof(buffer.data), view.size());
+      CHECK(view.buffer().data() == buffer.data);
+
+      etl::span<uint8_t> payload = view.payload();
+      CHECK_EQUAL(4U, payload.size());
+      CHECK(payload.data() == buffer.data + sizeof(Header));
+      CHECK_EQUAL('a', payload[0]);
+      CHECK_EQUAL('d', payload[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_const_view_of_span)
+    {
+      const Buffer buffer;
+      etl::span<const uint8_t> bytes(buffer.data);
+
+      etl::packet_view<const Header> view(bytes);
+      CHECK(view.is_valid());
+      CHECK_EQUAL(0x0102U, view->type);
+
+      etl::packet_view<const Header> made = etl::make_packet_view<const Header>(bytes);
+      CHECK(made.is_valid());
+      CHECK_EQUAL(4U, made.payload().size());
+    }
+
+    //*************************************************************************
+    TEST(test_too_small_is_invalid)
+    {
+      Buffer buffer;
+
+      etl::packet_view<Header> view(buffer.data, sizeof(Header) - 1U);
+      CHECK(!view.is_valid());
+
+      CHECK(view.assign(buffer.data, sizeof(Header)));
+      CHECK(view.payload().empty());
+
+      CHECK(!view.assign(ETL_NULLPTR, 100U));
+      CHECK_EQUAL(0U, view.size());
+    }
+
+    //*************************************************************************
+    TEST(test_misaligned_is_invalid)
+    {
+      Buffer buffer;
+
+      CHECK(!etl::packet_view<Header>::is_valid_buffer(buffer.data + 1U, sizeof(Header)));
+
+      etl::packet_view<Header> view(buffer.data + 1U, sizeof(buffer.data) - 1U);
+      CHECK(!view.is_valid());
+
+      // Bytes have no alignment.
+      etl::packet_view<uint8_t> bytes(buffer.data + 1U, 1U);
+      CHECK(bytes.is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_iovec_gathers_without_copying)
+    {
+      const uint8_t header[]  = { 1, 2, 3 };
+      const uint8_t payload[] = { 4, 5, 6, 7 };
+      const uint8_t crc[]     = { 8 };
+
+      etl::iovec<const uint8_t, 4> frame;
+
+      CHECK(frame.empty());
+      CHECK_EQUAL(4U, frame.max_size());
+
+      frame.push_back(etl::span<const uint8_t>(header));
+      frame.push_back(payload, 4U);
+      frame.push_back(crc, 0U);
+      frame.push_back(etl::span<const uint8_t>(crc));
+
+      CHECK_EQUAL(3U, frame.size());
+      CHECK_EQUAL(8U, frame.total_size());
+      CHECK(frame[0].data() == header);
+      CHECK(frame[1].data() == payload);
+      CHECK(frame[2].data() == crc);
+
+      size_t total = 0U;
+
+      for (etl::iiovec<const uint8_t>::const_iterator itr = frame.begin(); itr != frame.end(); ++itr)
+      {
+        total += itr->size();
+      }
+
+      CHECK_EQUAL(8U, total);
+
+      uint8_t flat[8];
+      CHECK_EQUAL(8U, frame.copy_to(etl::span<uint8_t>(flat)));
+
+      const uint8_t expected[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+      CHECK_ARRAY_EQUAL(expected, flat, 8U);
+
+      uint8_t small[5];
+      CHECK_EQUAL(5U, frame.copy_to(etl::span<uint8_t>(small)));
+      CHECK_ARRAY_EQUAL(expected, small, 5U);
+    }
+
+    //*************************************************************************
+    TEST(test_iovec_full)
+    {
+      const uint8_t data[] = { 1, 2 };
+
+      etl::iovec<const uint8_t, 2> frame;
+
+      frame.push_back(data, 1U);
+      frame.push_back(data + 1U, 1U);
+      CHECK(frame.full());
+
+      CHECK_THROW(frame.push_back(data, 2U), etl::iovec_full);
+      CHECK_EQUAL(2U, frame.size());
+      CHECK_EQUAL(2U, frame.total_size());
+
+      etl::iovec<const uint8_t, 2> copy(frame);
+      CHECK_EQUAL(2U, copy.size());
+      CHECK(copy[1].data() == data + 1U);
+
+      frame.clear();
+      CHECK(frame.empty());
+      CHECK_EQUAL(0U, frame.total_size());
+
+      frame = copy;
+      CHECK_EQUAL(2U, frame.total_size());
+    }
+
+    //*************************************************************************
+    TEST(test_iovec_of_packet_view)
+    {
+      Buffer buffer;
+      etl::packet_view<const Header> view(buffer.data, sizeof(buffer.data));
+
+      etl::iovec<const uint8_t, 2> frame;
+      frame.push_back(view.buffer().first(sizeof(Header)));
+      frame.push_back(view.payload());
+
+      CHECK_EQUAL(sizeof(buffer.data), frame.total_size());
+    }
+  };
+}
@@ -0,0 +1,312 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/parallel_algorithm.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  /// A simple thread pool.
+  //***************************************************************************
+  class thread_pool
+  {
+  public:
+
+    explicit thread_pool(size_t size)
+      : submitted(0U)
+      , stopping(false)
+    {
+      for (size_t i = 0U; i < size; ++i)
+      {
+        threads.emplace_back([this]() { work(); });
+      }
+    }
+
+    ~thread_pool()
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+      }
+
+      ready.notify_all();
+
+      for (std::thread& thread : threads)
+      {
+        thread.join();
+      }
+    }
+
+    void submit(const etl::parallel_executor::task_type& task)
+    {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(task);
+        ++submitted;
+      }
+
+      ready.notify_one();
+    }
+
+    size_t submitted;
+
+  private:
+
+    void work()
+    {
+      while (true)
+      {
+        etl::parallel_executor::task_type task;
+
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          ready.wait(lock, [this]() { return stopping || !tasks.empty(); });
+
+          if (tasks.empty())
+          {
+            return;
+          }
+
+          task = tasks.front();
+          tasks.pop_front();
+        }
+
+        task();
+      }
+    }
+
+    bool                                          stopping;
+    std::mutex                                    mutex;
+    std::condition_variable                       ready;
+    std::deque<etl::parallel_executor::task_type> tasks;
+    std::vector<std::thread>                      threads;
+  };
+
+  //***************************************************************************
+  /// Runs each task as soon as it is submitted.
+  //***************************************************************************
+  size_t inline_submitted = 0U;
+
+  void run_inline(const etl::parallel_executor::task_type& task)
+  {
+    ++inline_submitted;
+    task();
+  }
+
+  //***************************************************************************
+  std::atomic<int> waits(0);
+
+  void count_wait()
+  {
+    ++waits;
+    std::this_thread::yield();
+  }
+
+  //***************************************************************************
+  std::vector<int> make_data(size_t size)
+  {
+    std::vector<int> data(size);
+
+    uint32_t seed = 12345U;
+
+    for (int& value : data)
+    {
+      seed  = (seed * 1103515245U) + 12345U;
+      value = int((seed >> 8U) % 100000U) - 50000;
+    }
+
+    return data;
+  }
+
+  SUITE(test_parallel_algorithm)
+  {
+    //*************************************************************************
+    TEST(test_parts)
+    {
+      etl::parallel_executor sequential;
+      CHECK_EQUAL(1U, sequential.parts(100000U));
+      CHECK_EQUAL(1U, sequential.concurrency());
+
+      etl::parallel_executor executor(etl::parallel_executor::submit_type::create<run_inline>(), 4U, 10U);
+      CHECK_EQUAL(4U, executor.concurrency());
+      CHECK_EQUAL(1U, executor.parts(0U));
+      CHECK_EQUAL(1U, executor.parts(10U));
+      CHECK_EQUAL(2U, executor.parts(11U));
+      CHECK_EQUAL(4U, executor.parts(1000U));
+
+      etl::parallel_executor wide(etl::parallel_executor::submit_type::create<run_inline>(), 1000U, 1U);
+      CHECK_EQUAL(size_t(ETL_PARALLEL_MAX_TASKS), wide.parts(1000U));
+    }
+
+    //*************************************************************************
+    TEST(test_for_each_inline)
+    {
+      etl::parallel_executor executor(etl::parallel_executor::submit_type::create<run_inline>(), 4U, 2U);
+
+      std::vector<int> data(10, 1);
+
+      inline_submitted = 0U;
+      etl::for_each(executor, data.begin(), data.end(), [](int& value) { value *= 3; });
+
+      CHECK_EQUAL(3U, inline_submitted);
+      CHECK(std::all_of(data.begin(), data.end(), [](int value) { return value == 3; }));
+    }
+
+    //*************************************************************************
+    TEST(test_sequential_executor)
+    {
+      etl::parallel_executor executor;
+
+      std::vector<int> data = make_data(1000U);
+      std::vector<int> expected = data;
+
+      std::sort(expected.begin(), expected.end());
+      etl::sort(executor, data.begin(), data.end());
+
+      CHECK(expected == data);
+      CHECK_EQUAL(std::accumulate(data.begin(), data.end(), 7), etl::reduce(executor, data.begin(), data.end(), 7));
+    }
+
+    //*************************************************************************
+    TEST(test_algorithms_on_thread_pool)
+    {
+      thread_pool pool(3U);
+      etl::parallel_executor executor(etl::parallel_executor::submit_type::create<thread_pool, &thread_pool::submit>(pool), 4U, 100U);
+
+      const std::vector<int> data = make_data(10007U);
+
+      // for_each
+      std::vector<int> doubled = data;
+      etl::for_each(executor, doubled.begin(), doubled.end(), [](int& value) { value *= 2; });
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(data[i] * 2, doubled[i]);
+      }
+
+      // transform
+      std::vector<int> squared(data.size());
+      std::vector<int>::iterator end = etl::transform(executor, data.begin(), data.end(), squared.begin(), [](int value) { return (value % 1000) * (value % 1000); });
+
+      CHECK(end == squared.end());
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL((data[i] % 1000) * (data[i] % 1000), squared[i]);
+      }
+
+      // copy
+      std::vector<int> copied(data.size(), 0);
+      CHECK(etl::copy(executor, data.begin(), data.end(), copied.begin()) == copied.end());
+      CHECK(data == copied);
+
+      // count_if
+      const ptrdiff_t negatives = std::count_if(data.begin(), data.end(), [](int value) { return value < 0; });
+      CHECK_EQUAL(negatives, etl::count_if(executor, data.begin(), data.end(), [](int value) { return value < 0; }));
+
+      // reduce and accumulate
+      const long long sum = std::accumulate(data.begin(), data.end(), 5LL);
+      CHECK_EQUAL(sum, etl::reduce(executor, data.begin(), data.end(), 5LL));
+      CHECK_EQUAL(sum, etl::accumulate(executor, data.begin(), data.end(), 5LL));
+      CHECK_EQUAL(*std::max_element(data.begin(), data.end()),
+                  etl::reduce(executor, data.begin(), data.end(), -1000000, [](int a, int b) { return (a > b) ? a : b; }));
+
+      // sort
+      std::vector<int> sorted = data;
+      std::vector<int> expected = data;
+      std::sort(expected.begin(), expected.end());
+
+      etl::sort(executor, sorted.begin(), sorted.end());
+      CHECK(expected == sorted);
+
+      std::sort(expected.begin(), expected.end(), std::greater<int>());
+      etl::sort(executor, sorted.begin(), sorted.end(), std::greater<int>());
+      CHECK(expected == sorted);
+
+      CHECK(pool.submitted > 0U);
+    }
+
+    //*************************************************************************
+    TEST(test_sort_unusual_part_counts)
+    {
+      thread_pool pool(2U);
+
+      for (size_t threads = 1U; threads <= 9U; ++threads)
+      {
+        etl::parallel_executor executor(etl::parallel_executor::submit_type::create<thread_pool, &thread_pool::submit>(pool), threads, 7U);
+
+        std::vector<int> data = make_data(100U + threads);
+        std::vector<int> expected = data;
+        std::sort(expected.begin(), expected.end());
+
+        etl::sort(executor, data.begin(), data.end());
+        CHECK(expected == data);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wait_function_is_called)
+    {
+      thread_pool pool(2U);
+      etl::parallel_executor executor(etl::parallel_executor::submit_type::create<thread_pool, &thread_pool::submit>(pool), 3U, 1U);
+
+      waits = 0;
+      executor.set_wait(etl::parallel_executor::wait_type::create<count_wait>());
+
+      std::vector<int> data(3000, 1);
+      const int* slow = &data[1000];
+
+      // The caller's part is fast, so it has to wait for the others.
+      etl::for_each(executor, data.begin(), data.end(), [slow](int& value)
+      {
+        if (&value >= slow)
+        {
+          std::this_thread::sleep_for(std::chrono::microseconds(1));
+        }
+
+        value = 2;
+      });
+
+      CHECK(waits > 0);
+      CHECK(std::all_of(data.begin(), data.end(), [](int value) { return value == 2; }));
+    }
+  };
+}
@@ -70,6 +70,15 @@ namespace
 #endif
     }
 
+    //*************************************************************************
+    TEST(test_index_of_repeated_type)
+    {
+      // The first match is used.
+      CHECK_EQUAL(1U, (etl::parameter_pack<char, short, int, short>::index_of_type<short>::value));
+      CHECK_EQUAL(0U, (etl::parameter_pack<int, int, int>::index_of_type<int>::value));
+      CHECK_EQUAL(2U, (etl::parameter_pack<char, short, int, int>::index_of_type<int>::value));
+    }
+
     //*************************************************************************
     TEST(test_type_from_index)
     {
@@ -0,0 +1,382 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/pending_request_table.h"
+#include "etl/message.h"
+
+#include <stdint.h>
+#include <map>
+#include <vector>
+#include <cstdlib>
+
+#if ETL_USING_CPP11
+
+namespace
+{
+  struct Response : public etl::message<1>
+  {
+    explicit Response(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  //***************************************************************************
+  struct Completion
+  {
+    uint32_t id;
+    bool     timed_out;
+    int      value;
+  };
+
+  //***************************************************************************
+  struct Recorder
+  {
+    void on_complete(uint32_t id, const etl::imessage* p_response)
+    {
+      Completion completion;
+      completion.id        = id;
+      completion.timed_out = (p_response == ETL_NULLPTR);
+      completion.value     = completion.timed_out ? 0 : static_cast<const Response*>(p_response)->value;
+
+      completions.push_back(completion);
+    }
+
+    std::vector<Completion> completions;
+  };
+
+  //***************************************************************************
+  int signed_calls = 0;
+
+  void on_signed_complete(int16_t, const etl::imessage*)
+  {
+    ++signed_calls;
+  }
+
+  typedef etl::pending_request_table<8>  Table;
+  typedef Table::callback_type           Callback;
+
+  SUITE(test_pending_request_table)
+  {
+    //*************************************************************************
+    TEST(test_default_state)
+    {
+      Table table;
+
+      CHECK_TRUE(table.empty());
+      CHECK_FALSE(table.full());
+      CHECK_EQUAL(0U, table.size());
+      CHECK_EQUAL(8U, table.max_size());
+      CHECK_EQUAL(8U, table.available());
+      CHECK_EQUAL(etl::timer::state::Inactive, table.time_to_next());
+      CHECK_FALSE(table.is_pending(1U));
+      CHECK_FALSE(table.tick(100U));
+    }
+
+    //*************************************************************************
+    TEST(test_complete)
+    {
+      Table    table;
+      Recorder recorder;
+      Callback callback = Callback::create<Recorder, &Recorder::on_complete>(recorder);
+
+      CHECK_TRUE(table.add(10U, 100U, callback));
+      CHECK_TRUE(table.add(11U, 100U, callback));
+      CHECK_EQUAL(2U, table.size());
+      CHECK_TRUE(table.is_pending(10U));
+      CHECK_TRUE(table.is_pending(11U));
+
+      CHECK_TRUE(table.complete(11U, Response(42)));
+      CHECK_EQUAL(1U, table.size());
+      CHECK_FALSE(table.is_pending(11U));
+      CHECK_TRUE(table.is_pending(10U));
+
+      CHECK_EQUAL(1U, recorder.completions.size());
+      CHECK_EQUAL(11U, recorder.completions[0].id);
+      CHECK_FALSE(recorder.completions[0].timed_out);
+      CHECK_EQUAL(42, recorder.completions[0].value);
+
+      // A duplicate response is ignored.
+      CHECK_FALSE(table.complete(11U, Response(43)));
+      CHECK_EQUAL(1U, recorder.completions.size());
+    }
+
+    //*************************************************************************
+    TEST(test_timeout)
+    {
+      Table    table;
+      Recorder recorder;
+      Callback callback = Callback::create<Recorder, &Recorder::on_complete>(recorder);
+
+      CHECK_TRUE(table.add(1U, 10U, callback));
+      CHECK_TRUE(table.add(2U, 25U, callback));
+      CHECK_EQUAL(10U, table.time_to_next());
+
+      CHECK_FALSE(table.tick(9U));
+      CHECK_TRUE(recorder.completions.empty());
+
+      CHECK_TRUE(table.tick(1U));
+      CHECK_EQUAL(1U, recorder.completions.size());
+      CHECK_EQUAL(1U, recorder.completions[0].id);
+      CHECK_TRUE(recorder.completions[0].timed_out);
+      CHECK_FALSE(table.is_pending(1U));
+      CHECK_EQUAL(15U, table.time_to_next());
+
+      // A late response is ignored.
+      CHECK_FALSE(table.complete(1U, Response(1)));
+
+      CHECK_TRUE(table.tick(100U));
+      CHECK_EQUAL(2U, recorder.completions.size());
+      CHECK_EQUAL(2U, recorder.completions[1].id);
+      CHECK_TRUE(table.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_zero_timeout)
+    {
+      Table    table;
+      Recorder recorder;
+      Callback callback = Callback::create<Recorder, &Recorder::on_complete>(recorder);
+
+      CHECK_TRUE(table.add(1U, 0U, callback));
+      CHECK_EQUAL(0U, table.time_to_next());
+      CHECK_TRUE(table.tick(1U));
+      CHECK_EQUAL(1U, recorder.completions.size());
+    }
+
+    //*************************************************************************
+    TEST(test_cancel)
+    {
+      Table    table;
+      Recorder recorder;
+      Callback callback = Callback::create<Recorder, &Recorder::on_complete>(recorder);
+
+      CHECK_TRUE(table.add(1U, 10U, callback));
+      CHECK_TRUE(table.cancel(1U));
+      CHECK_FALSE(table.cancel(1U));
+      CHECK_TRUE(table.empty());
+
+      CHECK_FALSE(table.tick(20U));
+      CHECK_TRUE(recorder.completions.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_duplicate)
+    {
+      Table    table;
+      Recorder recorder;
+      Callback callback = Callback::create<Recorder, &Recorder::on_complete>(recorder);
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_TRUE(table.add(i * 8U, 10U, callback));
+      }
+
+      CHECK_TRUE(table.full());
+      CHECK_EQUAL(0U, table.available());
+      CHECK_FALSE(table.add(100U, 10U, callback));
+
+      CHECK_TRUE(table.cancel(16U));
+      CHECK_FALSE(table.add(8U, 10U, callback));
+      CHECK_TRUE(table.add(100U, 10U, callback));
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        CHECK_EQUAL(i != 2U, table.is_pending(i * 8U));
+      }
+
+      table.clear();
+      CHECK_TRUE(table.empty());
+      CHECK_FALSE(table.is_pending(100U));
+      CHECK_FALSE(table.tick(20U));
+      CHECK_TRUE(recorder.completions.empty());
+      CHECK_TRUE(table.add(100U, 10U, callback));
+    }
+
+    //*************************************************************************
+    struct Resender
+    {
+      void on_complete(uint32_t id, const etl::imessage* p_response)
+      {
+        if ((p_response == ETL_NULLPTR) && (retries > 0))
+        {
+          --retries;
+          CHECK_TRUE(p_table->add(id, 5U, Callback::create<Resender, &Resender::on_complete>(*this)));
+        }
+
+        ++calls;
+      }
+
+      Table* p_table;
+      int    retries;
+      int    calls;
+    };
+
+    TEST(test_add_from_callback)
+    {
+      Table    table;
+      Resender resender = { &table, 2, 0 };
+
+      CHECK_TRUE(table.add(7U, 5U, Callback::create<Resender, &Resender::on_complete>(resender)));
+
+      table.tick(5U);
+      CHECK_EQUAL(1, resender.calls);
+      CHECK_TRUE(table.is_pending(7U));
+
+      table.tick(10U);
+      CHECK_EQUAL(3, resender.calls);
+      CHECK_FALSE(table.is_pending(7U));
+    }
+
+    //*************************************************************************
+    TEST(test_many_requests)
+    {
+      // Compares against a reference model for random adds, responses and ticks.
+      typedef etl::pending_request_table<1000U, uint64_t, 4U> BigTable;
+
+      struct BigRecorder
+      {
+        void on_complete(uint64_t id, const etl::imessage* p_response)
+        {
+          if (p_response == ETL_NULLPTR)
+          {
+            timed_out.push_back(id);
+          }
+          else
+          {
+            completed.push_back(id);
+          }
+        }
+
+        std::vector<uint64_t> timed_out;
+        std::vector<uint64_t> completed;
+      };
+
+      static BigTable table;
+      BigRecorder     recorder;
+      BigTable::callback_type callback = BigTable::callback_type::create<BigRecorder, &BigRecorder::on_complete>(recorder);
+
+      std::map<uint64_t, uint32_t> expected;
+      uint32_t now = 0U;
+      uint64_t next_id = 0xFFFFFFF0ULL;
+
+      srand(1234);
+
+      for (int step = 0; step < 20000; ++step)
+      {
+        const int action = rand() % 8;
+
+        if (action < 4)
+        {
+          const uint32_t timeout = uint32_t(1 + (rand() % 300));
+          const bool added = table.add(next_id, timeout, callback);
+          CHECK_EQUAL(expected.size() < 1000U, added);
+
+          if (added)
+          {
+            expected[next_id] = now + timeout;
+          }
+
+          next_id += uint64_t(1U + (rand() % 3));
+        }
+        else if ((action < 7) && !expected.empty())
+        {
+          std::map<uint64_t, uint32_t>::iterator itr = expected.lower_bound(next_id - uint64_t(rand() % 2000));
+
+          if (itr == expected.end())
+          {
+            itr = expected.begin();
+          }
+
+          const uint64_t id = itr->first;
+          CHECK_TRUE(table.complete(id, Response(0)));
+          CHECK_EQUAL(id, recorder.completed.back());
+          expected.erase(itr);
+        }
+        else
+        {
+          const uint32_t ticks = uint32_t(1 + (rand() % 20));
+          recorder.timed_out.clear();
+          table.tick(ticks);
+          now += ticks;
+
+          size_t n_timed_out = 0U;
+
+          for (std::map<uint64_t, uint32_t>::iterator itr = expected.begin(); itr != expected.end();)
+          {
+            if (itr->second <= now)
+            {
+              ++n_timed_out;
+              CHECK_FALSE(table.is_pending(itr->first));
+              expected.erase(itr++);
+            }
+            else
+            {
+              ++itr;
+            }
+          }
+
+          CHECK_EQUAL(n_timed_out, recorder.timed_out.size());
+        }
+
+        CHECK_EQUAL(expected.size(), table.size());
+      }
+
+      for (std::map<uint64_t, uint32_t>::iterator itr = expected.begin(); itr != expected.end(); ++itr)
+      {
+        CHECK_TRUE(table.is_pending(itr->first));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_signed_ids)
+    {
+      typedef etl::pending_request_table<4, int16_t> SignedTable;
+
+      SignedTable table;
+      SignedTable::callback_type callback = SignedTable::callback_type::create<&on_signed_complete>();
+      signed_calls = 0;
+
+      CHECK_TRUE(table.add(-1, 10U, callback));
+      CHECK_TRUE(table.add(-32768, 10U, callback));
+      CHECK_TRUE(table.add(32767, 10U, callback));
+      CHECK_TRUE(table.is_pending(-1));
+      CHECK_TRUE(table.is_pending(-32768));
+      CHECK_TRUE(table.complete(-32768, Response(0)));
+      CHECK_FALSE(table.is_pending(-32768));
+      CHECK_TRUE(table.is_pending(32767));
+      CHECK_EQUAL(1, signed_calls);
+    }
+  }
+}
+
+#endif
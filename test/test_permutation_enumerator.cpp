@@ -0,0 +1,185 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/permutation_enumerator.h"
+#include "etl/factorial.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  /// Checks the complete sequence for N.
+  //***************************************************************************
+  template <size_t N>
+  bool check_sequence()
+  {
+    typedef etl::permutation_enumerator<N> Enumerator;
+    typedef etl::array<typename Enumerator::index_type, N> Permutation;
+
+    Enumerator e;
+    std::set<std::vector<size_t> > seen;
+
+    size_t count  = 0U;
+    bool   passed = true;
+
+    do
+    {
+      std::vector<size_t> current(e.permutation().begin(), e.permutation().end());
+
+      passed = passed && seen.insert(current).second;
+      passed = passed && (e.rank() == count);
+
+      // Unranking reaches the same permutation and state.
+      Enumerator u(count);
+      passed = passed && (u.permutation() == e.permutation());
+      passed = passed && (u.rank() == count);
+
+      Permutation previous = e.permutation();
+
+      ++count;
+
+      if (count < Enumerator::size())
+      {
+        passed = passed && e.next();
+
+        // One swap per step.
+        size_t differences = 0U;
+        for (size_t p = 0U; p < N; ++p)
+        {
+          differences += (previous[p] != e[p]) ? 1U : 0U;
+        }
+
+        passed = passed && (differences == 2U);
+        passed = passed && (previous[e.first_swapped()] == e[e.second_swapped()]);
+        passed = passed && (previous[e.second_swapped()] == e[e.first_swapped()]);
+
+        // The unranked enumerator continues identically.
+        passed = passed && u.next() && (u.permutation() == e.permutation());
+      }
+      else
+      {
+        passed = passed && !e.next();
+      }
+    } while (e.rank() != 0U);
+
+    return passed && (count == etl::factorial<N>::value) && (seen.size() == count);
+  }
+
+  SUITE(test_permutation_enumerator)
+  {
+    //*************************************************************************
+    TEST(test_size)
+    {
+      CHECK_EQUAL(1U,       etl::permutation_enumerator<0>::size());
+      CHECK_EQUAL(1U,       etl::permutation_enumerator<1>::size());
+      CHECK_EQUAL(6U,       etl::permutation_enumerator<3>::size());
+      CHECK_EQUAL(3628800U, etl::permutation_enumerator<10>::size());
+    }
+
+    //*************************************************************************
+    TEST(test_heaps_order)
+    {
+      // Heap's algorithm for three elements.
+      const char* expected[] = { "ABC", "BAC", "CAB", "ACB", "BCA", "CBA" };
+
+      std::string text("ABC");
+      etl::permutation_enumerator<3> e;
+
+      for (size_t i = 0U; i < 6U; ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), text);
+        CHECK_EQUAL(i != 5U, e.next(text.begin()));
+      }
+
+      CHECK_EQUAL(0U, e.rank());
+    }
+
+    //*************************************************************************
+    TEST(test_sequences)
+    {
+      CHECK_TRUE(check_sequence<1>());
+      CHECK_TRUE(check_sequence<2>());
+      CHECK_TRUE(check_sequence<3>());
+      CHECK_TRUE(check_sequence<4>());
+      CHECK_TRUE(check_sequence<5>());
+      CHECK_TRUE(check_sequence<6>());
+      CHECK_TRUE(check_sequence<7>());
+    }
+
+    //*************************************************************************
+    TEST(test_unrank_large)
+    {
+      // Unranking matches stepping, for a size where checking every rank is too slow.
+      etl::permutation_enumerator<9> stepped;
+
+      for (size_t r = 0U; r < 100000U; ++r)
+      {
+        if ((r % 9973U) == 0U)
+        {
+          etl::permutation_enumerator<9> unranked(r);
+          CHECK_TRUE(unranked.permutation() == stepped.permutation());
+        }
+
+        stepped.next();
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_partitioned_enumeration)
+    {
+      typedef etl::permutation_enumerator<6> Enumerator;
+
+      const size_t Parts = 5U;
+      const size_t Total = Enumerator::size();
+
+      std::set<std::vector<size_t> > seen;
+
+      for (size_t part = 0U; part < Parts; ++part)
+      {
+        const size_t begin = (Total * part) / Parts;
+        const size_t end   = (Total * (part + 1U)) / Parts;
+
+        Enumerator e(begin);
+
+        for (size_t r = begin; r < end; ++r)
+        {
+          seen.insert(std::vector<size_t>(e.permutation().begin(), e.permutation().end()));
+          e.next();
+        }
+      }
+
+      CHECK_EQUAL(Total, seen.size());
+    }
+  };
+}
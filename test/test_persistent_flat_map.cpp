@@ -0,0 +1,201 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/persistent_flat_map.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  typedef etl::persistent_flat_map<uint32_t, int32_t, 6> Map;
+
+  //***********************************
+  // Storage standing in for a memory mapped file or retained RAM.
+  struct Storage
+  {
+    Storage()
+    {
+      memset(data, 0x5A, sizeof(data));
+    }
+
+    union
+    {
+      uint64_t align;
+      char     data[sizeof(Map)];
+    };
+  };
+
+  SUITE(test_persistent_flat_map)
+  {
+    //*************************************************************************
+    TEST(test_attach_formats_garbage)
+    {
+      Storage storage;
+      Map& map = Map::from_buffer(storage.data);
+
+      CHECK(!map.is_valid());
+      CHECK(!map.attach());
+      CHECK(map.is_valid());
+      CHECK(map.empty());
+      CHECK_EQUAL(6U, map.max_size());
+      CHECK_EQUAL(6U, map.available());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_keeps_order)
+    {
+      Storage storage;
+      Map& map = Map::from_buffer(storage.data);
+      map.format();
+
+      CHECK(map.insert(30U, 3).second);
+      CHECK(map.insert(10U, 1).second);
+      CHECK(map.insert(20U, 2).second);
+
+      ETL_OR_STD::pair<Map::iterator, bool> result = map.insert(20U, 99);
+      CHECK(!result.second);
+      CHECK_EQUAL(2, result.first->second);
+
+      CHECK_EQUAL(3U, map.size());
+
+      std::vector<uint32_t> keys;
+      for (Map::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+      {
+        keys.push_back(itr->first);
+      }
+
+      CHECK_EQUAL(3U, keys.size());
+      CHECK_EQUAL(10U, keys[0]);
+      CHECK_EQUAL(20U, keys[1]);
+      CHECK_EQUAL(30U, keys[2]);
+
+      result = map.insert_or_assign(20U, 22);
+      CHECK(!result.second);
+      CHECK_EQUAL(22, map.at(20U));
+
+      result = map.insert_or_assign(25U, 25);
+      CHECK(result.second);
+      CHECK_EQUAL(4U, map.size());
+    }
+
+    //*************************************************************************
+    TEST(test_find_and_bounds)
+    {
+      Storage storage;
+      Map& map = Map::from_buffer(storage.data);
+      map.format();
+
+      map.insert(10U, 1);
+      map.insert(20U, 2);
+      map.insert(30U, 3);
+
+      CHECK(map.find(20U) != map.end());
+      CHECK_EQUAL(2, map.find(20U)->second);
+      CHECK(map.find(15U) == map.end());
+      CHECK(map.contains(30U));
+      CHECK(!map.contains(40U));
+      CHECK_EQUAL(1U, map.count(10U));
+      CHECK_EQUAL(0U, map.count(11U));
+      CHECK_THROW(map.at(11U), etl::persistent_out_of_bounds);
+
+      CHECK_EQUAL(20U, map.lower_bound(20U)->first);
+      CHECK_EQUAL(30U, map.upper_bound(20U)->first);
+      CHECK_EQUAL(20U, map.lower_bound(15U)->first);
+      CHECK_EQUAL(20U, map.upper_bound(15U)->first);
+      CHECK(map.upper_bound(30U) == map.end());
+    }
+
+    //*************************************************************************
+    TEST(test_erase_and_full)
+    {
+      Storage storage;
+      Map& map = Map::from_buffer(storage.data);
+      map.format();
+
+      for (uint32_t i = 0U; i < 6U; ++i)
+      {
+        map.insert(i, int32_t(i));
+      }
+
+      CHECK(map.full());
+      CHECK_THROW(map.insert(10U, 10), etl::persistent_full);
+
+      // Inserting an existing key does not need a free element.
+      CHECK(!map.insert(3U, 30).second);
+
+      CHECK_EQUAL(1U, map.erase(3U));
+      CHECK_EQUAL(0U, map.erase(3U));
+      CHECK_EQUAL(5U, map.size());
+
+      Map::iterator itr = map.erase(map.begin());
+      CHECK_EQUAL(1U, itr->first);
+
+      map.erase(map.begin(), map.begin() + 2);
+      CHECK_EQUAL(2U, map.size());
+      CHECK_EQUAL(4U, map.begin()->first);
+
+      map.clear();
+      CHECK(map.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reattach_at_another_address)
+    {
+      Storage storage1;
+      Map& map1 = Map::from_buffer(storage1.data);
+      map1.attach(7U);
+
+      map1.insert(2U, 20);
+      map1.insert(1U, 10);
+
+      // Move the image, as if the file were mapped at another address.
+      Storage storage2;
+      memcpy(storage2.data, storage1.data, sizeof(Map));
+      memset(storage1.data, 0, sizeof(Map));
+
+      Map& map2 = Map::from_buffer(storage2.data);
+
+      CHECK(map2.attach(7U));
+      CHECK_EQUAL(2U, map2.size());
+      CHECK_EQUAL(10, map2.at(1U));
+      CHECK_EQUAL(20, map2.at(2U));
+
+      // A different version discards the contents.
+      CHECK(!map2.attach(8U));
+      CHECK(map2.empty());
+
+      map2.insert(1U, 10);
+      map2.detach();
+      CHECK(!map2.attach(8U));
+      CHECK(map2.empty());
+    }
+  }
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/persistent_pool.h"
+
+#include <string.h>
+
+namespace
+{
+  struct Item
+  {
+    uint32_t a;
+    uint32_t b;
+  };
+
+  typedef etl::persistent_pool<Item, 4> Pool;
+
+  Item make_item(uint32_t a, uint32_t b)
+  {
+    Item item;
+    item.a = a;
+    item.b = b;
+    return item;
+  }
+
+  //***********************************
+  // Storage standing in for a memory mapped file or retained RAM.
+  struct Storage
+  {
+    Storage()
+    {
+      memset(data, 0xC3, sizeof(data));
+    }
+
+    union
+    {
+      uint64_t align;
+      char     data[sizeof(Pool)];
+    };
+  };
+
+  SUITE(test_persistent_pool)
+  {
+    //*************************************************************************
+    TEST(test_attach_formats_garbage)
+    {
+      Storage storage;
+      Pool& pool = Pool::from_buffer(storage.data);
+
+      CHECK(!pool.is_valid());
+      CHECK(!pool.attach());
+      CHECK(pool.is_valid());
+      CHECK(pool.empty());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(4U, pool.available());
+      CHECK_EQUAL(4U, pool.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_and_release)
+    {
+      Storage storage;
+      Pool& pool = Pool::from_buffer(storage.data);
+      pool.format();
+
+      Item* p1 = pool.create(make_item(1, 2));
+      Item* p2 = pool.create();
+      Item* p3 = pool.allocate();
+      Item* p4 = pool.create(make_item(4, 4));
+
+      CHECK(p1 != ETL_NULLPTR);
+      CHECK(p2 != ETL_NULLPTR);
+      CHECK(p3 != ETL_NULLPTR);
+      CHECK(p4 != ETL_NULLPTR);
+      CHECK_EQUAL(1U, p1->a);
+      CHECK_EQUAL(0U, p2->a);
+      CHECK(pool.full());
+      CHECK_THROW(pool.allocate(), etl::persistent_full);
+
+      CHECK(pool.is_in_pool(p3));
+      CHECK_EQUAL(2U, pool.index_of(p3));
+
+      pool.release(p3);
+      CHECK_EQUAL(3U, pool.size());
+      CHECK(!pool.is_allocated(2U));
+      CHECK(pool.at(2U) == ETL_NULLPTR);
+      CHECK_THROW(pool.release(p3), etl::persistent_out_of_bounds);
+
+      Item other;
+      CHECK(!pool.is_in_pool(&other));
+      CHECK_EQUAL(Pool::Null_Index, pool.index_of(&other));
+      CHECK_THROW(pool.release(&other), etl::persistent_out_of_bounds);
+
+      // The released slot is reused.
+      Item* p5 = pool.create(make_item(5, 5));
+      CHECK(p5 == p3);
+
+      pool.destroy(p1);
+      pool.destroy(p2);
+      CHECK_EQUAL(2U, pool.size());
+
+      pool.release_all();
+      CHECK(pool.empty());
+      CHECK(!pool.is_allocated(0U));
+    }
+
+#if ETL_USING_CPP11
+    //*************************************************************************
+    TEST(test_emplace)
+    {
+      Storage storage;
+      Pool& pool = Pool::from_buffer(storage.data);
+      pool.format();
+
+      Item* p = pool.emplace(make_item(7, 8));
+
+      CHECK_EQUAL(7U, p->a);
+      CHECK_EQUAL(8U, p->b);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_reattach_at_another_address)
+    {
+      Storage storage1;
+      Pool& pool1 = Pool::from_buffer(storage1.data);
+      pool1.attach(1U);
+
+      Item* p1 = pool1.create(make_item(1, 10));
+      Item* p2 = pool1.create(make_item(2, 20));
+      Item* p3 = pool1.create(make_item(3, 30));
+      pool1.release(p2);
+
+      const uint32_t i1 = pool1.index_of(p1);
+      const uint32_t i3 = pool1.index_of(p3);
+
+      // Move the image, as if the file were mapped at another address.
+      Storage storage2;
+      memcpy(storage2.data, storage1.data, sizeof(Pool));
+      memset(storage1.data, 0, sizeof(Pool));
+
+      Pool& pool2 = Pool::from_buffer(storage2.data);
+
+      CHECK(pool2.attach(1U));
+      CHECK_EQUAL(2U, pool2.size());
+
+      // The live objects are found by index.
+      CHECK(pool2.is_allocated(i1));
+      CHECK(pool2.is_allocated(i3));
+      CHECK(!pool2.is_allocated(1U));
+      CHECK(!pool2.is_allocated(3U));
+      CHECK_EQUAL(10U, pool2.at(i1)->b);
+      CHECK_EQUAL(30U, pool2.at(i3)->b);
+
+      // The free list survives the move.
+      Item* p4 = pool2.create(make_item(4, 40));
+      CHECK_EQUAL(1U, pool2.index_of(p4));
+      Item* p5 = pool2.create(make_item(5, 50));
+      CHECK_EQUAL(3U, pool2.index_of(p5));
+      CHECK(pool2.full());
+
+      // A different version discards the contents.
+      CHECK(!pool2.attach(2U));
+      CHECK(pool2.empty());
+    }
+  }
+}
@@ -0,0 +1,254 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/persistent_vector.h"
+
+#include <string.h>
+#include <vector>
+
+namespace
+{
+  struct Record
+  {
+    uint32_t id;
+    int16_t  value;
+  };
+
+  typedef etl::persistent_vector<Record, 8> Vector;
+
+  Record make_record(uint32_t id, int16_t value)
+  {
+    Record r;
+    r.id    = id;
+    r.value = value;
+    return r;
+  }
+
+  //***********************************
+  // Storage standing in for a memory mapped file or retained RAM.
+  struct Storage
+  {
+    Storage()
+    {
+      memset(data, 0xA5, sizeof(data));
+    }
+
+    union
+    {
+      uint64_t align;
+      char     data[sizeof(Vector)];
+    };
+  };
+
+  SUITE(test_persistent_vector)
+  {
+    //*************************************************************************
+    TEST(test_attach_formats_garbage)
+    {
+      Storage storage;
+      Vector& vector = Vector::from_buffer(storage.data);
+
+      CHECK(!vector.is_valid());
+      CHECK(!vector.attach());
+      CHECK(vector.is_valid());
+      CHECK(vector.empty());
+      CHECK_EQUAL(8U, vector.max_size());
+      CHECK_EQUAL(8U, vector.capacity());
+      CHECK_EQUAL(8U, vector.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_and_access)
+    {
+      Storage storage;
+      Vector& vector = Vector::from_buffer(storage.data);
+      vector.format();
+
+      vector.push_back(make_record(1, 10));
+      vector.push_back(make_record(2, 20));
+      vector.push_back(make_record(3, 30));
+
+      CHECK_EQUAL(3U, vector.size());
+      CHECK_EQUAL(1U, vector.front().id);
+      CHECK_EQUAL(3U, vector.back().id);
+      CHECK_EQUAL(20, vector[1].value);
+      CHECK_EQUAL(20, vector.at(1).value);
+      CHECK_THROW(vector.at(3), etl::persistent_out_of_bounds);
+
+      std::vector<uint32_t> ids;
+      for (Vector::const_iterator itr = vector.begin(); itr != vector.end(); ++itr)
+      {
+        ids.push_back(itr->id);
+      }
+
+      CHECK_EQUAL(3U, ids.size());
+      CHECK_EQUAL(1U, ids[0]);
+      CHECK_EQUAL(3U, ids[2]);
+      CHECK_EQUAL(3U, vector.rbegin()->id);
+
+      vector.pop_back();
+      CHECK_EQUAL(2U, vector.size());
+      CHECK_EQUAL(2U, vector.back().id);
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_empty)
+    {
+      Storage storage;
+      Vector& vector = Vector::from_buffer(storage.data);
+      vector.format();
+
+      CHECK_THROW(vector.pop_back(), etl::persistent_empty);
+
+      for (uint32_t i = 0U; i < 8U; ++i)
+      {
+        vector.push_back(make_record(i, 0));
+      }
+
+      CHECK(vector.full());
+      CHECK_THROW(vector.push_back(make_record(9, 0)), etl::persistent_full);
+      CHECK_THROW(vector.insert(vector.begin(), make_record(9, 0)), etl::persistent_full);
+      CHECK_THROW(vector.resize(9U), etl::persistent_full);
+      CHECK_EQUAL(8U, vector.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_resize)
+    {
+      Storage storage;
+      Vector& vector = Vector::from_buffer(storage.data);
+      vector.format();
+
+      vector.push_back(make_record(1, 0));
+      vector.push_back(make_record(3, 0));
+
+      Vector::iterator itr = vector.insert(vector.begin() + 1, make_record(2, 0));
+      CHECK_EQUAL(2U, itr->id);
+      CHECK_EQUAL(3U, vector.size());
+      CHECK_EQUAL(1U, vector[0].id);
+      CHECK_EQUAL(2U, vector[1].id);
+      CHECK_EQUAL(3U, vector[2].id);
+
+      // Insert a copy of an element of the vector.
+      vector.insert(vector.begin(), vector[2]);
+      CHECK_EQUAL(3U, vector[0].id);
+      CHECK_EQUAL(3U, vector[3].id);
+
+      itr = vector.erase(vector.begin());
+      CHECK_EQUAL(1U, itr->id);
+      CHECK_EQUAL(3U, vector.size());
+
+      itr = vector.erase(vector.begin(), vector.begin() + 2);
+      CHECK_EQUAL(3U, itr->id);
+      CHECK_EQUAL(1U, vector.size());
+
+      vector.resize(3U, make_record(7, 7));
+      CHECK_EQUAL(3U, vector.size());
+      CHECK_EQUAL(3U, vector[0].id);
+      CHECK_EQUAL(7U, vector[2].id);
+
+      vector.resize(1U);
+      CHECK_EQUAL(1U, vector.size());
+
+      Record records[] = { make_record(4, 0), make_record(5, 0) };
+      vector.assign(records, records + 2);
+      CHECK_EQUAL(2U, vector.size());
+      CHECK_EQUAL(4U, vector[0].id);
+
+      vector.clear();
+      CHECK(vector.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_reattach_at_another_address)
+    {
+      Storage storage1;
+      Vector& vector1 = Vector::from_buffer(storage1.data);
+      vector1.attach(3U);
+
+      vector1.push_back(make_record(1, 10));
+      vector1.push_back(make_record(2, 20));
+
+      // Move the image, as if the file were mapped at another address.
+      Storage storage2;
+      memcpy(storage2.data, storage1.data, sizeof(Vector));
+      memset(storage1.data, 0, sizeof(Vector));
+
+      Vector& vector2 = Vector::from_buffer(storage2.data);
+
+      CHECK(vector2.is_valid(3U));
+      CHECK(vector2.attach(3U));
+      CHECK_EQUAL(2U, vector2.size());
+      CHECK_EQUAL(1U, vector2[0].id);
+      CHECK_EQUAL(20, vector2[1].value);
+      CHECK(vector2.data() == reinterpret_cast<Record*>(storage2.data + (sizeof(Vector) - (8U * sizeof(Record)))));
+
+      vector2.push_back(make_record(3, 30));
+      CHECK_EQUAL(3U, vector2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_version_mismatch_and_detach)
+    {
+      Storage storage;
+      Vector& vector = Vector::from_buffer(storage.data);
+      vector.attach(1U);
+      vector.push_back(make_record(1, 10));
+
+      CHECK(vector.attach(1U));
+      CHECK_EQUAL(1U, vector.size());
+
+      // A new layout version discards the contents.
+      CHECK(!vector.attach(2U));
+      CHECK(vector.empty());
+
+      vector.push_back(make_record(1, 10));
+      vector.detach();
+
+      CHECK(!vector.is_valid(2U));
+      CHECK(!vector.attach(2U));
+      CHECK(vector.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_static_object)
+    {
+      // A vector declared as an object, as it would be in a no-init section.
+      static Vector vector;
+
+      vector.attach();
+      vector.push_back(make_record(5, 50));
+
+      CHECK(vector.attach());
+      CHECK_EQUAL(1U, vector.size());
+      CHECK_EQUAL(5U, vector[0].id);
+    }
+  }
+}
@@ -0,0 +1,200 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/pipeline.h"
+#include "etl/rescale.h"
+#include "etl/limiter.h"
+#include "etl/quantize.h"
+#include "etl/invert.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //***********************************
+  struct Twice
+  {
+    int operator ()(int value) const
+    {
+      return value * 2;
+    }
+  };
+
+  //***********************************
+  struct ToFloat
+  {
+    float operator ()(int16_t value) const
+    {
+      return float(value) / 100.0f;
+    }
+  };
+
+  //***********************************
+  struct Negate
+  {
+    explicit Negate(int& blocks_)
+      : p_blocks(&blocks_)
+    {
+    }
+
+    int operator ()(int value) const
+    {
+      return -value;
+    }
+
+    void process(etl::span<const int> in, etl::span<int> out) const
+    {
+      ++(*p_blocks);
+      std::transform(in.begin(), in.end(), out.begin(), *this);
+    }
+
+    int* p_blocks;
+  };
+
+  //***********************************
+  std::vector<int16_t> make_samples()
+  {
+    std::vector<int16_t> samples;
+
+    for (int i = 0; i < 1000; ++i)
+    {
+      samples.push_back(int16_t(((i * 37) % 401) - 200));
+    }
+
+    return samples;
+  }
+
+  const int16_t thresholds[]    = { -50, 0, 50 };
+  const int16_t quantizations[] = { -2, -1, 1, 2 };
+
+  SUITE(test_pipeline)
+  {
+    //*************************************************************************
+    TEST(test_single_value)
+    {
+      etl::pipeline<Twice, Twice, etl::limiter<int> > pipeline(Twice(), Twice(), etl::limiter<int>(-10, 10));
+
+      CHECK_EQUAL(8,   pipeline(2));
+      CHECK_EQUAL(10,  pipeline(3));
+      CHECK_EQUAL(-10, pipeline(-30));
+    }
+
+    //*************************************************************************
+    TEST(test_result_type)
+    {
+      typedef etl::pipeline<etl::invert<int16_t>, ToFloat> Pipeline;
+
+      CHECK((etl::is_same<float, Pipeline::result<int16_t>::type>::value));
+    }
+
+    //*************************************************************************
+    TEST(test_process_matches_each_stage)
+    {
+      const std::vector<int16_t> input = make_samples();
+
+      auto pipeline = etl::make_pipeline(etl::limiter<int16_t>(-150, 150),
+                                         etl::invert<int16_t>(0, 0),
+                                         etl::quantize<int16_t>(thresholds, quantizations, 4U));
+
+      // The same stages, one pass each.
+      std::vector<int16_t> expected(input);
+      std::transform(expected.begin(), expected.end(), expected.begin(), etl::limiter<int16_t>(-150, 150));
+      std::transform(expected.begin(), expected.end(), expected.begin(), etl::invert<int16_t>(0, 0));
+      std::transform(expected.begin(), expected.end(), expected.begin(), etl::quantize<int16_t>(thresholds, quantizations, 4U));
+
+      std::vector<int16_t> output(input.size());
+      pipeline.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(output.data(), output.size()));
+      CHECK(output == expected);
+
+      std::vector<int16_t> tiled(input.size());
+      pipeline.process_tiled<64>(etl::span<const int16_t>(input.data(), input.size()), etl::span<int16_t>(tiled.data(), tiled.size()));
+      CHECK(tiled == expected);
+
+      // In place, with a tile that does not divide the block.
+      std::vector<int16_t> in_place(input);
+      pipeline.process_tiled<37>(etl::span<const int16_t>(in_place.data(), in_place.size()), etl::span<int16_t>(in_place.data(), in_place.size()));
+      CHECK(in_place == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_process_changes_type)
+    {
+      const std::vector<int16_t> input = make_samples();
+
+      etl::pipeline<etl::rescale<int16_t, int>, Twice> pipeline(etl::rescale<int16_t, int>(-200, 200, 0, 4000), Twice());
+
+      std::vector<int> expected;
+
+      for (size_t i = 0U; i < input.size(); ++i)
+      {
+        expected.push_back(Twice()(etl::rescale<int16_t, int>(-200, 200, 0, 4000)(input[i])));
+      }
+
+      std::vector<int> output(input.size());
+      pipeline.process(etl::span<const int16_t>(input.data(), input.size()), etl::span<int>(output.data(), output.size()));
+      CHECK(output == expected);
+
+      std::vector<int> tiled(input.size());
+      pipeline.process_tiled<128>(etl::span<const int16_t>(input.data(), input.size()), etl::span<int>(tiled.data(), tiled.size()));
+      CHECK(tiled == expected);
+
+      // Only as many values as the output holds.
+      std::vector<int> short_output(10U);
+      pipeline.process_tiled<4>(etl::span<const int16_t>(input.data(), input.size()), etl::span<int>(short_output.data(), short_output.size()));
+      CHECK(std::equal(short_output.begin(), short_output.end(), expected.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_process_tiled_uses_stage_block_process)
+    {
+      int blocks = 0;
+      const Twice twice;
+      etl::pipeline<Twice, Negate> pipeline(twice, Negate(blocks));
+
+      std::vector<int> data(100U, 3);
+      pipeline.process_tiled<32>(etl::span<const int>(data.data(), data.size()), etl::span<int>(data.data(), data.size()));
+
+      CHECK(std::count(data.begin(), data.end(), -6) == 100);
+      CHECK_EQUAL(4, blocks);
+    }
+
+#if ETL_USING_CPP17
+    //*************************************************************************
+    TEST(test_deduction_guide)
+    {
+      etl::pipeline pipeline(Twice(), etl::limiter<int>(0, 5));
+
+      CHECK_EQUAL(5, pipeline(7));
+      CHECK_EQUAL(0, pipeline(-7));
+    }
+#endif
+  }
+}
@@ -476,4 +476,188 @@ namespace
     CHECK_EQUAL(3, memPool.available());
     CHECK_EQUAL(0, memPool.size());
   }
+
+  //*************************************************************************
+  TEST(test_allocate_n_release_n)
+  {
+    etl::pool<Test_Data, 8> pool;
+
+    Test_Data* items[5];
+
+    CHECK_EQUAL(5U, pool.allocate_n(items, 5U));
+    CHECK_EQUAL(5U, pool.size());
+
+    std::set<Test_Data*> unique(items, items + 5);
+    CHECK_EQUAL(5U, unique.size());
+
+    for (size_t i = 0U; i < 5U; ++i)
+    {
+      CHECK(pool.is_in_pool(items[i]));
+    }
+
+    pool.release_n(items, 5U);
+    CHECK(pool.empty());
+
+    // The released items are the first to be reused.
+    Test_Data* p = pool.allocate();
+    CHECK(p == items[0]);
+    pool.release(p);
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_release_n_span)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[4];
+    etl::span<int*> span(items);
+
+    CHECK_EQUAL(4U, pool.allocate_n(span));
+    CHECK(pool.full());
+
+    pool.release_n(span);
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_mixed_with_allocate)
+  {
+    etl::pool<int, 8> pool;
+
+    // Every item allocated must be distinct, however the free list was built.
+    int* p1 = pool.allocate();
+    int* p2 = pool.allocate();
+    pool.release(p1);
+
+    int* items[6];
+    CHECK_EQUAL(6U, pool.allocate_n(items, 6U));
+    CHECK_EQUAL(7U, pool.size());
+
+    std::set<int*> unique(items, items + 6);
+    unique.insert(p2);
+    CHECK_EQUAL(7U, unique.size());
+
+    int* p3 = pool.allocate();
+    unique.insert(p3);
+    CHECK_EQUAL(8U, unique.size());
+    CHECK(pool.full());
+
+    pool.release_n(items + 2, 4U);
+    CHECK_EQUAL(4U, pool.size());
+
+    int* more[4];
+    CHECK_EQUAL(4U, pool.allocate_n(more, 4U));
+    CHECK(pool.full());
+
+    std::set<int*> reused(more, more + 4);
+    CHECK(reused == std::set<int*>(items + 2, items + 6));
+
+    pool.release_all();
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_allocate_n_too_many)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[5];
+
+    CHECK_THROW(pool.allocate_n(items, 5U), etl::pool_no_allocation);
+    CHECK(pool.empty());
+
+    CHECK_EQUAL(0U, pool.allocate_n(items, 0U));
+    CHECK(pool.empty());
+  }
+
+  //*************************************************************************
+  TEST(test_release_n_not_in_pool)
+  {
+    etl::pool<int, 4> pool;
+
+    int* items[2];
+    pool.allocate_n(items, 2U);
+
+    int i;
+    int* others[2] = { items[0], &i };
+
+    CHECK_THROW(pool.release_n(others, 2U), etl::pool_object_not_in_pool);
+    CHECK_EQUAL(2U, pool.size());
+
+    pool.release_n(items, 2U);
+    CHECK(pool.empty());
+  }
+
+#if defined(ETL_MEMORY_STATISTICS)
+  //*************************************************************************
+  uint32_t test_ticks = 0U;
+
+  uint32_t get_test_ticks()
+  {
+    return test_ticks;
+  }
+
+  //*************************************************************************
+  TEST(test_memory_statistics)
+  {
+    etl::pool<int, 4> pool;
+
+    int* p1 = pool.allocate();
+    int* p2 = pool.allocate();
+    pool.release(p1);
+
+    int* items[3];
+    pool.allocate_n(items, 3U);
+
+    CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    CHECK_THROW(pool.allocate_n(items, 1U), etl::pool_no_allocation);
+
+    pool.release_n(items, 3U);
+    pool.release(p2);
+
+    const etl::memory_statistics& statistics = pool.get_memory_statistics();
+
+    CHECK_EQUAL(0U, statistics.current_size());
+    CHECK_EQUAL(4U, statistics.peak_size());
+    CHECK_EQUAL(5U, statistics.allocation_count());
+    CHECK_EQUAL(5U, statistics.release_count());
+    CHECK_EQUAL(2U, statistics.failed_allocation_count());
+    CHECK_EQUAL(0U, statistics.average_lifetime());
+
+    pool.allocate();
+    pool.reset_memory_statistics();
+
+    CHECK_EQUAL(1U, statistics.current_size());
+    CHECK_EQUAL(1U, statistics.peak_size());
+    CHECK_EQUAL(0U, statistics.allocation_count());
+
+    pool.release_all();
+    CHECK_EQUAL(0U, statistics.current_size());
+    CHECK_EQUAL(1U, statistics.release_count());
+  }
+
+  //*************************************************************************
+  TEST(test_memory_statistics_average_lifetime)
+  {
+    etl::pool<int, 4> pool;
+
+    test_ticks = 100U;
+    etl::set_memory_statistics_tick(get_test_ticks);
+    pool.reset_memory_statistics();
+
+    // One item lives for 10 ticks, the other for 30.
+    int* p1 = pool.allocate();
+    int* p2 = pool.allocate();
+
+    test_ticks += 10U;
+    pool.release(p1);
+
+    test_ticks += 20U;
+    pool.release(p2);
+
+    etl::set_memory_statistics_tick(ETL_NULLPTR);
+
+    CHECK_EQUAL(20U, pool.get_memory_statistics().average_lifetime());
+  }
+#endif
 }
@@ -0,0 +1,235 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2014 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "data.h"
+
+#include <set>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+
+#include "etl/pool_mt.h"
+
+#if ETL_HAS_ATOMIC
+
+typedef TestDataDC<std::string> Test_Data;
+
+namespace
+{
+  struct D2
+  {
+    D2(const std::string& a_, const std::string& b_)
+      : a(a_),
+      b(b_)
+    {
+    }
+
+    std::string a;
+    std::string b;
+  };
+
+  SUITE(test_pool_mt)
+  {
+    //*************************************************************************
+    TEST(test_allocate)
+    {
+      etl::pool_mt<Test_Data, 4> pool;
+
+      CHECK_EQUAL(4U, pool.max_size());
+      CHECK_EQUAL(4U, pool.capacity());
+      CHECK(pool.empty());
+
+      std::set<Test_Data*> allocated;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        Test_Data* p = pool.allocate();
+
+        CHECK(p != nullptr);
+        CHECK(pool.is_in_pool(p));
+        allocated.insert(p);
+        CHECK_EQUAL(i + 1U, pool.size());
+        CHECK_EQUAL(3U - i, pool.available());
+      }
+
+      // All different.
+      CHECK_EQUAL(4U, allocated.size());
+      CHECK(pool.full());
+
+      CHECK_THROW(pool.allocate(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_release)
+    {
+      etl::pool_mt<Test_Data, 4> pool;
+
+      Test_Data* p1 = pool.allocate();
+      Test_Data* p2 = pool.allocate();
+      Test_Data* p3 = pool.allocate();
+      Test_Data* p4 = pool.allocate();
+
+      pool.release(p2);
+      pool.release(p4);
+      CHECK_EQUAL(2U, pool.size());
+
+      // The free list is last in, first out.
+      CHECK(pool.allocate() == p4);
+      CHECK(pool.allocate() == p2);
+      CHECK(pool.full());
+
+      pool.release(p1);
+      pool.release(p3);
+      CHECK_EQUAL(2U, pool.size());
+
+      Test_Data not_in_pool;
+      CHECK(!pool.is_in_pool(&not_in_pool));
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      etl::pool_mt<Test_Data, 4> pool;
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        pool.allocate();
+      }
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        CHECK(pool.allocate() != nullptr);
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_create_destroy)
+    {
+      etl::pool_mt<D2, 4> pool;
+
+      D2* p = pool.create(std::string("1"), std::string("2"));
+
+      CHECK_EQUAL(std::string("1"), p->a);
+      CHECK_EQUAL(std::string("2"), p->b);
+      CHECK_EQUAL(1U, pool.size());
+
+      pool.destroy(p);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_interface)
+    {
+      etl::pool_mt<uint64_t, 4> pool;
+      etl::ipool_mt& ipool = pool;
+
+      uint32_t* p = ipool.create<uint32_t>(1234U);
+
+      CHECK_EQUAL(1234U, *p);
+      CHECK_THROW(ipool.allocate<char[16]>(), etl::pool_element_size);
+
+      ipool.destroy(p);
+      CHECK(ipool.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      static const size_t Size       = 16U;
+      static const size_t Threads    = 4U;
+      static const size_t Held       = 3U;
+      static const size_t Iterations = 20000U;
+
+      etl::pool_mt<uint32_t, Size> pool;
+      std::atomic<bool> failed(false);
+
+      auto worker = [&](uint32_t id)
+      {
+        uint32_t* held[Held];
+
+        for (size_t i = 0U; i < Iterations; ++i)
+        {
+          for (size_t j = 0U; j < Held; ++j)
+          {
+            held[j] = pool.allocate();
+            *held[j] = id;
+          }
+
+          // If an item was given to two threads, one of them will see the other's id.
+          for (size_t j = 0U; j < Held; ++j)
+          {
+            if (*held[j] != id)
+            {
+              failed = true;
+            }
+
+            pool.release(held[j]);
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (uint32_t i = 0U; i < Threads; ++i)
+      {
+        threads.push_back(std::thread(worker, i + 1U));
+      }
+
+      for (size_t i = 0U; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(!failed);
+      CHECK(pool.empty());
+
+      // The free list is intact.
+      std::set<uint32_t*> allocated;
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        allocated.insert(pool.allocate());
+      }
+
+      CHECK_EQUAL(Size, allocated.size());
+      CHECK(pool.full());
+    }
+  };
+}
+
+#endif
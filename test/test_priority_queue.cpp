@@ -650,5 +650,31 @@ namespace
         priority_queue2.pop();
       }
     }
+
+    //*************************************************************************
+    TEST(test_4_ary_heap)
+    {
+      const int data[] = { 5, 12, 3, 9, 1, 7, 15, 2, 8, 11, 4, 14, 6, 10, 13, 0 };
+
+      etl::priority_queue<int, 16, etl::vector<int, 16>, std::less<int>, 4> priority_queue(std::begin(data), std::begin(data) + 8);
+      std::priority_queue<int> compare_priority_queue(std::begin(data), std::begin(data) + 8);
+
+      CHECK_EQUAL(4U, priority_queue.ARITY);
+
+      for (size_t i = 8; i < 16; ++i)
+      {
+        priority_queue.push_back(data[i]);
+        compare_priority_queue.push(data[i]);
+      }
+
+      CHECK_EQUAL(compare_priority_queue.size(), priority_queue.size());
+
+      while (!priority_queue.empty())
+      {
+        CHECK_EQUAL(compare_priority_queue.top(), priority_queue.top());
+        priority_queue.pop();
+        compare_priority_queue.pop();
+      }
+    }
   };
 }
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -96,6 +97,40 @@ namespace
 
   std::array<double, Size> output2;
 
+  //***********************************
+  // Samples that are not a whole number of vectors.
+  template <typename T>
+  std::vector<T> make_samples(T first, T step)
+  {
+    std::vector<T> samples;
+
+    for (int i = 0; i < 37; ++i)
+    {
+      const T k     = (i * 7) % 37;
+      const T value = first + (k * step);
+      samples.push_back(value);
+    }
+
+    return samples;
+  }
+
+  //***********************************
+  // Checks that a block gives the same result as each sample.
+  template <typename TFunctor, typename T>
+  bool check_process(const TFunctor& functor, const std::vector<T>& input)
+  {
+    std::vector<T> expected(input.size());
+    std::transform(input.begin(), input.end(), expected.begin(), functor);
+
+    std::vector<T> output(input.size());
+    functor.process(etl::span<const T>(input.data(), input.size()), etl::span<T>(output.data(), output.size()));
+
+    std::vector<T> in_place(input);
+    functor.process(etl::span<const T>(in_place.data(), in_place.size()), etl::span<T>(in_place.data(), in_place.size()));
+
+    return (output == expected) && (in_place == expected);
+  }
+
   SUITE(test_quantize)
   {
     //*************************************************************************
@@ -119,5 +154,23 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2a.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_process)
+    {
+      const int16_t thresholds16[]    = { -10, 0, 5 };
+      const int16_t quantizations16[] = { -2, -1, 1, 2 };
+      CHECK(check_process(etl::quantize<int16_t>(thresholds16, quantizations16, 4U), make_samples<int16_t>(-20, 1)));
+
+      const int32_t thresholds32[]    = { -5000, 5000 };
+      const int32_t quantizations32[] = { 0, 1, 2 };
+      CHECK(check_process(etl::quantize<int32_t>(thresholds32, quantizations32, 3U), make_samples<int32_t>(-20000, 1000)));
+
+      const float thresholdsf[]    = { -1.0f, 0.0f, 1.0f, 2.0f };
+      const float quantizationsf[] = { -1.5f, -0.5f, 0.5f, 1.5f, 2.5f };
+      CHECK(check_process(etl::quantize<float>(thresholdsf, quantizationsf, 5U), make_samples<float>(-2.0f, 0.25f)));
+
+      CHECK(check_process(etl::quantize<int16_t, etl::greater<int16_t> >(thresholds16, quantizations16, 4U), make_samples<int16_t>(-20, 1)));
+    }
   };
 }
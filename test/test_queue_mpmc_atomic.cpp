@@ -0,0 +1,493 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_mpmc_atomic.h"
+
+#include "data.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  using ItemM = TestDataM<int>;
+
+  //***************************************************************************
+  struct Counted
+  {
+    Counted()
+    {
+      ++count;
+    }
+
+    Counted(const Counted&)
+    {
+      ++count;
+    }
+
+    ~Counted()
+    {
+      --count;
+    }
+
+    static int count;
+  };
+
+  int Counted::count = 0;
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+      CHECK_EQUAL(0U, queue.size());
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+      CHECK_EQUAL(4U, queue.available());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      // Queue full.
+      CHECK(!queue.push(5));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(5));
+
+      // Queue full.
+      CHECK(!queue.push(6));
+
+      queue.pop();
+      // Queue not full (buffer rollover)
+      CHECK(queue.push(6));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(6, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+#if !defined(ETL_FORCE_TEST_CPP03_IMPLEMENTATION)
+    //*************************************************************************
+    TEST(test_move_push_pop)
+    {
+      etl::queue_mpmc_atomic<ItemM, 4> queue;
+
+      ItemM p1(1);
+      ItemM p2(2);
+      ItemM p3(3);
+      ItemM p4(4);
+
+      queue.push(std::move(p1));
+      queue.push(std::move(p2));
+      queue.push(std::move(p3));
+      queue.push(std::move(p4));
+
+      CHECK(!bool(p1));
+      CHECK(!bool(p2));
+      CHECK(!bool(p3));
+      CHECK(!bool(p4));
+
+      ItemM pr(0);
+
+      queue.pop(pr);
+      CHECK_EQUAL(1, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(2, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(3, pr.value);
+
+      queue.pop(pr);
+      CHECK_EQUAL(4, pr.value);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 8> queue;
+
+      queue.emplace();
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(5U, queue.size());
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(0, 0, 0, 0));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      iqueue.push(2);
+      iqueue.push(3);
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_position_wrap_small_memory_model)
+    {
+      // The 8 bit positions wrap many times.
+      etl::queue_mpmc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      int value = 0;
+      int expected = 0;
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        CHECK(queue.push(value++));
+        CHECK(queue.push(value++));
+        CHECK(queue.push(value++));
+
+        int popped;
+
+        CHECK(queue.pop(popped));
+        CHECK_EQUAL(expected++, popped);
+        CHECK(queue.pop(popped));
+        CHECK_EQUAL(expected++, popped);
+
+        CHECK(queue.push(value++));
+        CHECK(queue.push(value++));
+        CHECK(queue.push(value++));
+        CHECK(queue.full());
+        CHECK(!queue.push(value));
+
+        for (int j = 0; j < 4; ++j)
+        {
+          CHECK(queue.pop(popped));
+          CHECK_EQUAL(expected++, popped);
+        }
+
+        CHECK(queue.empty());
+        CHECK(!queue.pop(popped));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destruct)
+    {
+      Counted::count = 0;
+
+      {
+        etl::queue_mpmc_atomic<Counted, 4> queue;
+
+        queue.push(Counted());
+        queue.push(Counted());
+        queue.push(Counted());
+        CHECK_EQUAL(3, Counted::count);
+
+        queue.pop();
+        CHECK_EQUAL(2, Counted::count);
+      }
+
+      CHECK_EQUAL(0, Counted::count);
+    }
+
+    //*************************************************************************
+    TEST(test_empty_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+      CHECK(!queue.full());
+
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(!queue.empty());
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK(!queue.full());
+    }
+
+    //*************************************************************************
+    etl::queue_mpmc_atomic<int, 16> queue_threads_queue;
+
+    const int THREAD_LENGTH = 20000;
+
+    std::vector<int> push_values[2];
+    std::vector<int> pop_values[2];
+
+    std::atomic_bool start;
+
+    void push_thread(int id)
+    {
+      int value = id * (THREAD_LENGTH / 2);
+      int count = 0;
+
+      while (!start.load())
+      {
+        std::this_thread::yield();
+      }
+
+      while (count < (THREAD_LENGTH / 2))
+      {
+        if (queue_threads_queue.push(value))
+        {
+          push_values[id].push_back(value);
+          ++count;
+          ++value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    void pop_thread(int id)
+    {
+      int count = 0;
+
+      while (!start.load())
+      {
+        std::this_thread::yield();
+      }
+
+      while (count < (THREAD_LENGTH / 2))
+      {
+        int value;
+
+        if (queue_threads_queue.pop(value))
+        {
+          pop_values[id].push_back(value);
+          ++count;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    }
+
+    TEST(test_multiple_producers_multiple_consumers)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        push_values[i].clear();
+        pop_values[i].clear();
+        push_values[i].reserve(THREAD_LENGTH / 2);
+        pop_values[i].reserve(THREAD_LENGTH / 2);
+      }
+
+      start = false;
+
+      std::thread t1(push_thread, 0);
+      std::thread t2(push_thread, 1);
+      std::thread t3(pop_thread, 0);
+      std::thread t4(pop_thread, 1);
+
+      start.store(true);
+
+      t1.join();
+      t2.join();
+      t3.join();
+      t4.join();
+
+      // Each consumer sees each producer's values in order.
+      for (int c = 0; c < 2; ++c)
+      {
+        int last[2] = { -1, -1 };
+        bool ordered = true;
+
+        for (size_t i = 0UL; i < pop_values[c].size(); ++i)
+        {
+          int value    = pop_values[c][i];
+          int producer = value / (THREAD_LENGTH / 2);
+
+          ordered = ordered && (value > last[producer]);
+          last[producer] = value;
+        }
+
+        CHECK(ordered);
+      }
+
+      std::vector<int> pop;
+      pop.insert(pop.end(), pop_values[0].begin(), pop_values[0].end());
+      pop.insert(pop.end(), pop_values[1].begin(), pop_values[1].end());
+      std::sort(pop.begin(), pop.end());
+
+      CHECK_EQUAL(size_t(THREAD_LENGTH), pop.size());
+
+      bool all_present = true;
+
+      for (size_t i = 0UL; i < pop.size(); ++i)
+      {
+        all_present = all_present && (pop[i] == int(i));
+      }
+
+      CHECK(all_present);
+      CHECK(queue_threads_queue.empty());
+    }
+  };
+}
+
+#endif
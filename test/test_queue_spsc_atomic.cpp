@@ -394,6 +394,203 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      const int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(4U, queue.push(etl::span<const int>(input, 6U)));
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, 6U)));
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3U)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wrap around the end of the buffer.
+      CHECK_EQUAL(3U, queue.push(etl::span<const int>(input + 4U, 2U)) + queue.push(etl::span<const int>(input, 1U)));
+      CHECK_EQUAL(4U, queue.size());
+
+      // Only as many as there are in the queue.
+      CHECK_EQUAL(4U, queue.pop(etl::span<int>(output, 6U)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(1, output[3]);
+
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 6U)));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_front_span_commit_pop)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      CHECK(queue.front_span().empty());
+
+      const int input[4] = { 1, 2, 3, 4 };
+      queue.push(etl::span<const int>(input, 3U));
+
+      etl::span<int> view = queue.front_span();
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(1, view[0]);
+      CHECK_EQUAL(3, view[2]);
+
+      queue.commit_pop(2U);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3, queue.front());
+
+      // The values now wrap around the end of the buffer.
+      queue.push(etl::span<const int>(input, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      // The buffer has one more slot than the capacity.
+      view = queue.front_span();
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(3, view[0]);
+      CHECK_EQUAL(1, view[1]);
+      CHECK_EQUAL(2, view[2]);
+      queue.commit_pop(view.size());
+
+      view = queue.front_span();
+      CHECK_EQUAL(1U, view.size());
+      CHECK_EQUAL(3, view[0]);
+      queue.commit_pop(view.size());
+
+      CHECK(queue.empty());
+      CHECK(queue.front_span().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_layout)
+    {
+      using Compact = etl::queue_spsc_atomic<int, 4>;
+      using Aligned = etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, true>;
+
+      CHECK(sizeof(Aligned) >= (sizeof(Compact) + (3U * ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE)));
+      CHECK_EQUAL(size_t(ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE), etl::traits::hardware_destructive_interference_size);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_size_push_pop)
+    {
+      etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL, true> queue;
+      etl::iqueue_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_SMALL, true>& iqueue = queue;
+
+      CHECK(iqueue.empty());
+      CHECK_EQUAL(4U, iqueue.available());
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK(iqueue.emplace(3));
+      CHECK(iqueue.push(4));
+      CHECK(iqueue.full());
+      CHECK_EQUAL(4U, iqueue.size());
+
+      // Queue full.
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.front(i));
+      CHECK_EQUAL(1, i);
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+
+      // Queue not full (buffer rollover)
+      CHECK(iqueue.push(5));
+      CHECK(!iqueue.push(6));
+
+      CHECK(iqueue.pop());
+      CHECK(iqueue.push(6));
+
+      for (int expected = 3; expected <= 6; ++expected)
+      {
+        CHECK(iqueue.pop(i));
+        CHECK_EQUAL(expected, i);
+      }
+
+      CHECK(!iqueue.pop(i));
+      CHECK(iqueue.empty());
+
+      iqueue.push(7);
+      iqueue.push(8);
+      iqueue.clear();
+      CHECK(iqueue.empty());
+      CHECK(!iqueue.pop(i));
+
+      CHECK(iqueue.push(9));
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(9, i);
+
+      const int input[3] = { 10, 11, 12 };
+      CHECK_EQUAL(3U, iqueue.push(etl::span<const int>(input)));
+      CHECK(!iqueue.front_span().empty());
+      CHECK_EQUAL(10, iqueue.front_span()[0]);
+      iqueue.commit_pop(1U);
+
+      int output[3];
+      CHECK_EQUAL(2U, iqueue.pop(etl::span<int>(output)));
+      CHECK_EQUAL(11, output[0]);
+      CHECK_EQUAL(12, output[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_cache_aligned_threads)
+    {
+      static const int Length = 100000;
+
+      etl::queue_spsc_atomic<int, 16, etl::memory_model::MEMORY_MODEL_LARGE, true> queue;
+
+      std::thread producer([&queue]()
+      {
+        int value = 0;
+
+        while (value < Length)
+        {
+          if (queue.push(value))
+          {
+            ++value;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      });
+
+      bool in_order = true;
+      int  expected = 0;
+
+      while (expected < Length)
+      {
+        int value;
+
+        if (queue.pop(value))
+        {
+          in_order = in_order && (value == expected);
+          ++expected;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -629,6 +629,166 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+    //*************************************************************************
+    TEST(test_push_pop_span)
+    {
+      access.clear();
+
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      const int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(4U, queue.push(etl::span<const int>(input, 6U)));
+      CHECK(access.called_lock);
+      CHECK(access.called_unlock);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(0U, queue.push(etl::span<const int>(input, 6U)));
+
+      CHECK_EQUAL(3U, queue.pop(etl::span<int>(output, 3U)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wrap around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(etl::span<const int>(input + 4U, 2U)));
+      CHECK_EQUAL(1U, queue.push(etl::span<const int>(input, 1U)));
+      CHECK_EQUAL(4U, queue.size());
+
+      // Only as many as there are in the queue.
+      CHECK_EQUAL(4U, queue.pop(etl::span<int>(output, 6U)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(1, output[3]);
+
+      CHECK_EQUAL(0U, queue.pop(etl::span<int>(output, 6U)));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_front_span_commit_pop)
+    {
+      access.clear();
+
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      CHECK(queue.front_span().empty());
+
+      const int input[4] = { 1, 2, 3, 4 };
+      queue.push(etl::span<const int>(input, 3U));
+
+      etl::span<int> view = queue.front_span();
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(1, view[0]);
+      CHECK_EQUAL(3, view[2]);
+
+      queue.commit_pop(2U);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3, queue.front());
+
+      // The values now wrap around the end of the buffer.
+      queue.push(etl::span<const int>(input, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      view = queue.front_span();
+      CHECK_EQUAL(2U, view.size());
+      CHECK_EQUAL(3, view[0]);
+      CHECK_EQUAL(1, view[1]);
+      queue.commit_pop(view.size());
+
+      view = queue.front_span();
+      CHECK_EQUAL(2U, view.size());
+      CHECK_EQUAL(2, view[0]);
+      CHECK_EQUAL(3, view[1]);
+      queue.commit_pop(view.size());
+
+      CHECK(queue.empty());
+      CHECK(queue.front_span().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_span_from_unlocked)
+    {
+      access.clear();
+
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      const int input[6] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0, 0, 0, 0, 0, 0 };
+
+      // Only as many as there is space for.
+      CHECK_EQUAL(4U, queue.push_from_unlocked(etl::span<const int>(input, 6U)));
+      CHECK(!access.called_lock);
+      CHECK(!access.called_unlock);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK_EQUAL(0U, queue.push_from_unlocked(etl::span<const int>(input, 6U)));
+
+      CHECK_EQUAL(3U, queue.pop_from_unlocked(etl::span<int>(output, 3U)));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+
+      // Wrap around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push_from_unlocked(etl::span<const int>(input + 4U, 2U)));
+      CHECK_EQUAL(1U, queue.push_from_unlocked(etl::span<const int>(input, 1U)));
+      CHECK_EQUAL(4U, queue.size());
+
+      // Only as many as there are in the queue.
+      CHECK_EQUAL(4U, queue.pop_from_unlocked(etl::span<int>(output, 6U)));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK_EQUAL(1, output[3]);
+
+      CHECK_EQUAL(0U, queue.pop_from_unlocked(etl::span<int>(output, 6U)));
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_front_span_commit_pop_from_unlocked)
+    {
+      access.clear();
+
+      etl::queue_spsc_locked<int, 4> queue(lock, unlock);
+
+      CHECK(queue.front_span_from_unlocked().empty());
+
+      const int input[4] = { 1, 2, 3, 4 };
+      queue.push_from_unlocked(etl::span<const int>(input, 3U));
+
+      etl::span<int> view = queue.front_span_from_unlocked();
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(1, view[0]);
+      CHECK_EQUAL(3, view[2]);
+
+      queue.commit_pop_from_unlocked(2U);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3, queue.front());
+
+      // The values now wrap around the end of the buffer.
+      queue.push_from_unlocked(etl::span<const int>(input, 3U));
+      CHECK_EQUAL(4U, queue.size());
+
+      view = queue.front_span_from_unlocked();
+      CHECK_EQUAL(2U, view.size());
+      CHECK_EQUAL(3, view[0]);
+      CHECK_EQUAL(1, view[1]);
+      queue.commit_pop_from_unlocked(view.size());
+
+      view = queue.front_span_from_unlocked();
+      CHECK_EQUAL(2U, view.size());
+      CHECK_EQUAL(2, view[0]);
+      CHECK_EQUAL(3, view[1]);
+      queue.commit_pop_from_unlocked(view.size());
+
+      CHECK(queue.empty());
+      CHECK(queue.front_span_from_unlocked().empty());
+    }
+
     //*************************************************************************
 #if REALTIME_TEST
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -0,0 +1,314 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/queue_waitable.h"
+#include "etl/queue_lockable.h"
+#include "etl/queue_spsc_locked.h"
+#include "etl/function.h"
+
+#include <thread>
+#include <mutex>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <algorithm>
+
+#if ETL_HAS_WAIT_EVENT
+
+namespace
+{
+  //***********************************
+  class QueueInt : public etl::queue_lockable<int, 4>
+  {
+  public:
+
+    void lock() const override
+    {
+      access.lock();
+    }
+
+    void unlock() const override
+    {
+      access.unlock();
+    }
+
+    mutable std::mutex access;
+  };
+
+  typedef etl::queue_waitable<QueueInt> WaitableQueue;
+
+  //***********************************
+  std::mutex spsc_access;
+
+  void spsc_lock()
+  {
+    spsc_access.lock();
+  }
+
+  void spsc_unlock()
+  {
+    spsc_access.unlock();
+  }
+
+  etl::function_fv<spsc_lock>   spsc_lock_function;
+  etl::function_fv<spsc_unlock> spsc_unlock_function;
+
+  typedef etl::queue_waitable<etl::queue_spsc_locked<int, 4> > WaitableSpscQueue;
+
+  //***********************************
+  void wait_until_waiting()
+  {
+    // Give the other thread time to block.
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  }
+
+  SUITE(test_queue_waitable)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      WaitableQueue queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+
+      CHECK(queue.push(1));
+      CHECK(queue.emplace(2));
+      CHECK(queue.push(3));
+      CHECK(queue.push(4));
+      CHECK(!queue.push(5));
+      CHECK_EQUAL(4U, queue.size());
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.pop());
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+
+      queue.clear();
+      CHECK(queue.empty());
+      CHECK(!queue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_pop_wait_do_not_block_when_ready)
+    {
+      WaitableQueue queue;
+
+      queue.push_wait(1);
+      queue.push_wait(2);
+
+      int i;
+
+      queue.pop_wait(i);
+      CHECK_EQUAL(1, i);
+
+      queue.pop_wait(i);
+      CHECK_EQUAL(2, i);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_blocks_until_push)
+    {
+      WaitableQueue queue;
+
+      std::atomic<int> result(0);
+
+      std::thread consumer([&]()
+      {
+        int value;
+        queue.pop_wait(value);
+        result.store(value);
+      });
+
+      wait_until_waiting();
+      CHECK_EQUAL(0, result.load());
+
+      queue.push(42);
+      consumer.join();
+
+      CHECK_EQUAL(42, result.load());
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_push_wait_blocks_until_pop)
+    {
+      WaitableQueue queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      std::atomic<bool> pushed(false);
+
+      std::thread producer([&]()
+      {
+        queue.push_wait(5);
+        pushed.store(true);
+      });
+
+      wait_until_waiting();
+      CHECK(!pushed.load());
+
+      int i;
+      CHECK(queue.pop(i));
+      producer.join();
+
+      CHECK(pushed.load());
+      CHECK_EQUAL(4U, queue.size());
+
+      std::vector<int> values;
+
+      while (queue.pop(i))
+      {
+        values.push_back(i);
+      }
+
+      std::vector<int> expected = { 2, 3, 4, 5 };
+      CHECK(values == expected);
+    }
+
+    //*************************************************************************
+    TEST(test_clear_wakes_producer)
+    {
+      WaitableQueue queue;
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+
+      std::thread producer([&]()
+      {
+        queue.push_wait(5);
+      });
+
+      wait_until_waiting();
+      queue.clear();
+      producer.join();
+
+      int i;
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(5, i);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_arguments_are_forwarded)
+    {
+      WaitableSpscQueue queue(spsc_lock_function, spsc_unlock_function);
+
+      std::atomic<int> result(0);
+
+      std::thread consumer([&]()
+      {
+        int value;
+        queue.pop_wait(value);
+        result.store(value);
+      });
+
+      wait_until_waiting();
+      queue.push(7);
+      consumer.join();
+
+      CHECK_EQUAL(7, result.load());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers_multiple_consumers)
+    {
+      WaitableQueue queue;
+
+      const int Length   = 10000;
+      const int Sentinel = -1;
+
+      std::vector<int> popped[2];
+
+      auto produce = [&](int first)
+      {
+        for (int i = first; i < (first + (Length / 2)); ++i)
+        {
+          queue.push_wait(i);
+        }
+      };
+
+      auto consume = [&](int id)
+      {
+        while (true)
+        {
+          int value;
+          queue.pop_wait(value);
+
+          if (value == Sentinel)
+          {
+            break;
+          }
+
+          popped[id].push_back(value);
+        }
+      };
+
+      std::thread c1(consume, 0);
+      std::thread c2(consume, 1);
+      std::thread p1(produce, 0);
+      std::thread p2(produce, Length / 2);
+
+      p1.join();
+      p2.join();
+
+      queue.push_wait(Sentinel);
+      queue.push_wait(Sentinel);
+
+      c1.join();
+      c2.join();
+
+      std::vector<int> all;
+      all.insert(all.end(), popped[0].begin(), popped[0].end());
+      all.insert(all.end(), popped[1].begin(), popped[1].end());
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(Length), all.size());
+
+      bool all_present = true;
+
+      for (size_t i = 0UL; i < all.size(); ++i)
+      {
+        all_present = all_present && (all[i] == int(i));
+      }
+
+      CHECK(all_present);
+    }
+  };
+}
+
+#endif
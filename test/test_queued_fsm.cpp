@@ -0,0 +1,390 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/queued_fsm.h"
+#include "etl/hfsm.h"
+#include "etl/vector.h"
+
+namespace
+{
+  //***************************************************************************
+  // Messages
+  //***************************************************************************
+  struct EventId
+  {
+    enum
+    {
+      Start,
+      Stop,
+      Ping,
+      Unsupported
+    };
+  };
+
+  class Start : public etl::message<EventId::Start>
+  {
+  };
+
+  class Stop : public etl::message<EventId::Stop>
+  {
+  };
+
+  class Ping : public etl::message<EventId::Ping>
+  {
+  public:
+
+    Ping(int count_)
+      : count(count_)
+    {
+    }
+
+    const int count;
+  };
+
+  class Unsupported : public etl::message<EventId::Unsupported>
+  {
+  };
+
+  typedef etl::message_packet<Start, Stop, Ping> Packet;
+
+  //***************************************************************************
+  // Records the order and nesting of the handlers.
+  //***************************************************************************
+  struct Record
+  {
+    Record()
+      : depth(0)
+      , max_depth(0)
+    {
+    }
+
+    void enter(int value)
+    {
+      ++depth;
+      max_depth = (depth > max_depth) ? depth : max_depth;
+      log.push_back(value);
+    }
+
+    void leave()
+    {
+      --depth;
+    }
+
+    etl::vector<int, 32> log;
+    int depth;
+    int max_depth;
+  };
+
+  //***************************************************************************
+  // A queued FSM.
+  //***************************************************************************
+  struct StateId
+  {
+    enum
+    {
+      Idle,
+      Running,
+      Number_Of_States
+    };
+  };
+
+  class Machine : public etl::queued_fsm<etl::fsm, Packet, 4>, public Record
+  {
+  public:
+
+    Machine()
+      : queued_fsm(0)
+    {
+    }
+  };
+
+  class Idle : public etl::fsm_state<Machine, Idle, StateId::Idle, Start, Ping>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Start&)
+    {
+      get_fsm_context().enter(100);
+      get_fsm_context().leave();
+      return StateId::Running;
+    }
+
+    etl::fsm_state_id_t on_event(const Ping& ping)
+    {
+      get_fsm_context().enter(-ping.count);
+      get_fsm_context().leave();
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  class Running : public etl::fsm_state<Machine, Running, StateId::Running, Stop, Ping>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Stop&)
+    {
+      get_fsm_context().enter(200);
+      get_fsm_context().leave();
+      return StateId::Idle;
+    }
+
+    // Each ping sends the next one to its own FSM.
+    etl::fsm_state_id_t on_event(const Ping& ping)
+    {
+      get_fsm_context().enter(ping.count);
+
+      if (ping.count > 0)
+      {
+        get_fsm_context().receive(Ping(ping.count - 1));
+      }
+
+      get_fsm_context().leave();
+
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  // A queued HFSM.
+  //***************************************************************************
+  struct HStateId
+  {
+    enum
+    {
+      Parent,
+      Child,
+      Number_Of_States
+    };
+  };
+
+  class HMachine : public etl::queued_fsm<etl::hfsm, Packet, 4>, public Record
+  {
+  public:
+
+    HMachine()
+      : queued_fsm(1)
+    {
+    }
+  };
+
+  class Parent : public etl::fsm_state<HMachine, Parent, HStateId::Parent, Stop>
+  {
+  public:
+
+    // The stop is handled for the child, which is then pinged.
+    etl::fsm_state_id_t on_event(const Stop&)
+    {
+      get_fsm_context().enter(200);
+      get_fsm_context().receive(Ping(1));
+      get_fsm_context().leave();
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  class Child : public etl::fsm_state<HMachine, Child, HStateId::Child, Ping>
+  {
+  public:
+
+    etl::fsm_state_id_t on_event(const Ping& ping)
+    {
+      get_fsm_context().enter(ping.count);
+      get_fsm_context().leave();
+      return No_State_Change;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(const etl::imessage&)
+    {
+      return No_State_Change;
+    }
+  };
+
+  //***************************************************************************
+  struct SetupFixture
+  {
+    SetupFixture()
+    {
+      states[StateId::Idle]    = &idle;
+      states[StateId::Running] = &running;
+
+      machine.set_states(states, StateId::Number_Of_States);
+      machine.start(false);
+    }
+
+    Machine          machine;
+    Idle             idle;
+    Running          running;
+    etl::ifsm_state* states[StateId::Number_Of_States];
+  };
+
+  SUITE(test_queued_fsm)
+  {
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_receive_queues_the_message)
+    {
+      machine.receive(Start());
+      machine.receive(Ping(1));
+
+      CHECK_EQUAL(2U, machine.queued_events());
+      CHECK_FALSE(machine.events_empty());
+      CHECK_EQUAL(StateId::Idle, int(machine.get_state_id()));
+      CHECK_TRUE(machine.log.empty());
+
+      // The second ping is sent by the first.
+      CHECK_EQUAL(3U, machine.process_events());
+
+      CHECK_TRUE(machine.events_empty());
+      CHECK_EQUAL(StateId::Running, int(machine.get_state_id()));
+      CHECK_EQUAL(3U, machine.log.size());
+      CHECK_EQUAL(100, machine.log[0]);
+      CHECK_EQUAL(1,   machine.log[1]);
+      CHECK_EQUAL(0,   machine.log[2]);
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_messages_sent_by_handlers_are_deferred)
+    {
+      machine.receive(Start());
+      machine.receive(Ping(10));
+      machine.receive(Stop());
+
+      CHECK_EQUAL(4U, machine.process_events());
+
+      // Each handler ran to completion before the next one.
+      CHECK_EQUAL(1, machine.max_depth);
+      CHECK_EQUAL(StateId::Idle, int(machine.get_state_id()));
+
+      // The stop was queued before the second ping, which reaches the idle state.
+      const int expected[] = { 100, 10, 200, -9 };
+
+      CHECK_EQUAL(sizeof(expected) / sizeof(expected[0]), machine.log.size());
+      CHECK_ARRAY_EQUAL(expected, machine.log.data(), machine.log.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_process_events_limit)
+    {
+      machine.receive(Start());
+      machine.receive(Ping(5));
+
+      CHECK_EQUAL(1U, machine.process_events(1U));
+      CHECK_EQUAL(1U, machine.queued_events());
+      CHECK_EQUAL(StateId::Running, int(machine.get_state_id()));
+
+      CHECK_EQUAL(3U, machine.process_events(3U));
+      CHECK_EQUAL(1U, machine.queued_events());
+
+      CHECK_EQUAL(3U, machine.process_events());
+      CHECK_EQUAL(0U, machine.process_events());
+
+      const int expected[] = { 100, 5, 4, 3, 2, 1, 0 };
+
+      CHECK_ARRAY_EQUAL(expected, machine.log.data(), machine.log.size());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_full_and_unsupported)
+    {
+      CHECK_TRUE(machine.accepts(EventId::Ping));
+      CHECK_FALSE(machine.accepts(EventId::Unsupported));
+
+      CHECK_THROW(machine.receive(Unsupported()), etl::unhandled_message_exception);
+      CHECK_TRUE(machine.events_empty());
+
+      for (size_t i = 0U; i < Machine::MAX_SIZE; ++i)
+      {
+        machine.receive(Ping(0));
+      }
+
+      CHECK_TRUE(machine.events_full());
+      CHECK_THROW(machine.receive(Ping(0)), etl::queued_fsm_full);
+      CHECK_EQUAL(Machine::MAX_SIZE, machine.queued_events());
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_reset_discards_messages)
+    {
+      machine.receive(Start());
+      machine.receive(Ping(3));
+
+      machine.reset();
+
+      CHECK_TRUE(machine.events_empty());
+      CHECK_FALSE(machine.is_started());
+
+      machine.start(false);
+      CHECK_EQUAL(0U, machine.process_events());
+      CHECK_TRUE(machine.log.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_queued_hfsm)
+    {
+      HMachine machine;
+      Parent   parent;
+      Child    child;
+
+      etl::ifsm_state* states[HStateId::Number_Of_States] = { &parent, &child };
+      etl::ifsm_state* children[] = { &child };
+
+      parent.set_child_states(children, 1U);
+      machine.set_states(states, HStateId::Number_Of_States);
+      machine.start();
+
+      CHECK_EQUAL(HStateId::Child, int(machine.get_state_id()));
+
+      // The child passes the stop to the parent, which pings the child.
+      machine.receive(Stop());
+      machine.receive(Ping(5));
+
+      CHECK_EQUAL(3U, machine.process_events());
+      CHECK_EQUAL(1, machine.max_depth);
+
+      const int expected[] = { 200, 5, 1 };
+
+      CHECK_EQUAL(sizeof(expected) / sizeof(expected[0]), machine.log.size());
+      CHECK_ARRAY_EQUAL(expected, machine.log.data(), machine.log.size());
+    }
+  }
+}
@@ -0,0 +1,397 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/queued_message_bus.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  constexpr etl::message_id_t Fault     = 1U;
+  constexpr etl::message_id_t Command   = 2U;
+  constexpr etl::message_id_t Telemetry = 3U;
+
+  constexpr etl::message_router_id_t RouterId = 1U;
+  constexpr etl::message_router_id_t QueueId  = 2U;
+
+  //*************************************************************************
+  struct FaultMessage : public etl::message<Fault>
+  {
+  };
+
+  struct CommandMessage : public etl::message<Command>
+  {
+  };
+
+  struct TelemetryMessage : public etl::message<Telemetry>
+  {
+    explicit TelemetryMessage(int sample_)
+      : sample(sample_)
+    {
+    }
+
+    int sample;
+  };
+
+  //*************************************************************************
+  struct Router : public etl::message_router<Router, FaultMessage, CommandMessage, TelemetryMessage>
+  {
+    Router()
+      : message_router(RouterId)
+    {
+    }
+
+    void on_receive(const FaultMessage&)
+    {
+      order.push_back(Fault);
+    }
+
+    void on_receive(const CommandMessage&)
+    {
+      order.push_back(Command);
+    }
+
+    void on_receive(const TelemetryMessage& msg)
+    {
+      order.push_back(Telemetry);
+      samples.push_back(msg.sample);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    std::vector<etl::message_id_t> order;
+    std::vector<int>               samples;
+  };
+
+  //*************************************************************************
+  size_t select_lane(etl::message_id_t id)
+  {
+    return (id == Fault) ? 0U : (id == Command) ? 1U : 2U;
+  }
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<FaultMessage, CommandMessage, TelemetryMessage>;
+
+  using Allocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                            pool_message_parameters::max_alignment,
+                                                            32U>;
+
+  //*************************************************************************
+  // Serialises the allocator for the tests with several producers.
+  //*************************************************************************
+  struct LockedAllocator : public etl::imemory_block_allocator
+  {
+    void* allocate_block(size_t required_size, size_t required_alignment) override
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return allocator.allocate(required_size, required_alignment);
+    }
+
+    bool release_block(const void* const p) override
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      return allocator.release(p);
+    }
+
+    bool is_owner_of_block(const void* const p) const override
+    {
+      return allocator.is_owner_of(p);
+    }
+
+    Allocator  allocator;
+    std::mutex mutex;
+  };
+
+  using Lane      = etl::queue_spsc_atomic<etl::shared_message, 4U>;
+  using QueuedBus = etl::queued_message_bus<3U, Lane>;
+
+  SUITE(test_queued_message_bus)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Router    router;
+      QueuedBus queued(QueueId, router);
+
+      CHECK_EQUAL(QueueId, queued.get_message_router_id());
+      CHECK(&queued.get_destination() == &router);
+      CHECK(queued.empty());
+      CHECK_EQUAL(0U, queued.size());
+      CHECK_EQUAL(3U, QueuedBus::Lanes);
+      CHECK_EQUAL(4U, QueuedBus::Lane_Capacity);
+      CHECK(queued.is_consumer());
+      CHECK(!queued.is_producer());
+      CHECK(queued.accepts(Fault));
+
+      for (size_t lane = 0U; lane < QueuedBus::Lanes; ++lane)
+      {
+        CHECK_EQUAL(4U, queued.get_lane_limit(lane));
+        CHECK_EQUAL(etl::lane_overflow_policy::Drop, queued.get_lane_policy(lane));
+        CHECK_EQUAL(0U, queued.drop_count(lane));
+        CHECK_EQUAL(0U, queued.high_water_mark(lane));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_priority_order)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router    router;
+      QueuedBus queued(QueueId, router);
+      queued.set_lane_selector(QueuedBus::lane_selector_type::create<select_lane>());
+
+      etl::send_message(queued, etl::shared_message(pool, TelemetryMessage(1)));
+      etl::send_message(queued, etl::shared_message(pool, TelemetryMessage(2)));
+      etl::send_message(queued, etl::shared_message(pool, CommandMessage()));
+      etl::send_message(queued, etl::shared_message(pool, FaultMessage()));
+      etl::send_message(queued, etl::shared_message(pool, TelemetryMessage(3)));
+
+      CHECK_EQUAL(5U, queued.size());
+      CHECK_EQUAL(1U, queued.size(0U));
+      CHECK_EQUAL(1U, queued.size(1U));
+      CHECK_EQUAL(3U, queued.size(2U));
+      CHECK(router.order.empty());
+
+      CHECK_EQUAL(2U, queued.process_queue(2U));
+
+      // A fault arriving between calls is passed on before the remaining telemetry.
+      etl::send_message(queued, etl::shared_message(pool, FaultMessage()));
+
+      CHECK_EQUAL(4U, queued.process_queue());
+      CHECK(queued.empty());
+
+      std::vector<etl::message_id_t> expected = { Fault, Command, Fault, Telemetry, Telemetry, Telemetry };
+      CHECK(expected == router.order);
+
+      std::vector<int> expected_samples = { 1, 2, 3 };
+      CHECK(expected_samples == router.samples);
+    }
+
+    //*************************************************************************
+    TEST(test_default_lane_and_direct_post)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router    router;
+      QueuedBus queued(QueueId, router);
+
+      etl::send_message(queued, etl::shared_message(pool, FaultMessage()));
+      CHECK_EQUAL(1U, queued.size(2U));
+
+      CHECK(queued.post(0U, etl::shared_message(pool, CommandMessage())));
+      CHECK(queued.post(99U, etl::shared_message(pool, TelemetryMessage(0))));
+      CHECK_EQUAL(1U, queued.size(0U));
+      CHECK_EQUAL(2U, queued.size(2U));
+
+      queued.process_queue();
+
+      std::vector<etl::message_id_t> expected = { Command, Fault, Telemetry };
+      CHECK(expected == router.order);
+    }
+
+    //*************************************************************************
+    TEST(test_drop_policy_and_statistics)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router    router;
+      QueuedBus queued(QueueId, router);
+      queued.set_lane_selector(QueuedBus::lane_selector_type::create<select_lane>());
+      queued.set_lane_limit(2U, 2U);
+      queued.set_lane_limit(0U, 100U);
+      CHECK_EQUAL(4U, queued.get_lane_limit(0U));
+
+      for (int i = 0; i < 5; ++i)
+      {
+        etl::send_message(queued, etl::shared_message(pool, TelemetryMessage(i)));
+      }
+
+      etl::send_message(queued, etl::shared_message(pool, FaultMessage()));
+
+      CHECK_EQUAL(2U, queued.size(2U));
+      CHECK_EQUAL(3U, queued.drop_count(2U));
+      CHECK_EQUAL(2U, queued.high_water_mark(2U));
+      CHECK_EQUAL(0U, queued.drop_count(0U));
+      CHECK_EQUAL(1U, queued.high_water_mark(0U));
+
+      queued.process_queue();
+
+      CHECK_EQUAL(2U, queued.high_water_mark(2U));
+      queued.reset_statistics();
+      CHECK_EQUAL(0U, queued.drop_count(2U));
+      CHECK_EQUAL(0U, queued.high_water_mark(2U));
+
+      std::vector<int> expected_samples = { 0, 1 };
+      CHECK(expected_samples == router.samples);
+    }
+
+    //*************************************************************************
+    struct Drainer
+    {
+      void wait()
+      {
+        ++waits;
+        p_queued->process_queue(1U);
+      }
+
+      QueuedBus* p_queued;
+      int        waits;
+    };
+
+    TEST(test_block_policy)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router    router;
+      QueuedBus queued(QueueId, router);
+      Drainer   drainer = { &queued, 0 };
+
+      queued.set_lane_policy(2U, etl::lane_overflow_policy::Block);
+      queued.set_wait_callback(QueuedBus::wait_callback_type::create<Drainer, &Drainer::wait>(drainer));
+
+      for (int i = 0; i < 6; ++i)
+      {
+        CHECK(queued.post(2U, etl::shared_message(pool, TelemetryMessage(i))));
+      }
+
+      CHECK_EQUAL(2, drainer.waits);
+      CHECK_EQUAL(0U, queued.drop_count(2U));
+      CHECK_EQUAL(4U, queued.high_water_mark(2U));
+
+      queued.process_queue();
+
+      std::vector<int> expected_samples = { 0, 1, 2, 3, 4, 5 };
+      CHECK(expected_samples == router.samples);
+    }
+
+    //*************************************************************************
+    TEST(test_unshared_and_bus_destination)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router router;
+      etl::message_bus<2U> bus;
+      bus.subscribe(router);
+
+      QueuedBus queued(QueueId, bus);
+
+      // Not shared, so passed on immediately.
+      etl::send_message(queued, FaultMessage());
+      CHECK_EQUAL(1U, router.order.size());
+
+      etl::send_message(queued, etl::shared_message(pool, CommandMessage()));
+      CHECK_EQUAL(1U, router.order.size());
+
+      queued.process_queue();
+      CHECK_EQUAL(2U, router.order.size());
+
+      etl::send_message(queued, etl::shared_message(pool, CommandMessage()));
+      queued.clear();
+      CHECK(queued.empty());
+      CHECK_EQUAL(0U, queued.process_queue());
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      using MpscLane = etl::queue_mpmc_mutex<etl::shared_message, 8U>;
+      using MpscBus  = etl::queued_message_bus<2U, MpscLane>;
+
+      LockedAllocator                  allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router  router;
+      MpscBus queued(QueueId, router);
+
+      queued.set_lane_policy(0U, etl::lane_overflow_policy::Block);
+      queued.set_lane_policy(1U, etl::lane_overflow_policy::Block);
+
+      std::atomic<bool> done(false);
+
+      std::thread consumer([&]()
+      {
+        while (!done.load() || !queued.empty())
+        {
+          queued.process_queue();
+        }
+      });
+
+      std::thread producer1([&]()
+      {
+        for (int i = 0; i < 200; ++i)
+        {
+          queued.post(0U, etl::shared_message(pool, FaultMessage()));
+        }
+      });
+
+      std::thread producer2([&]()
+      {
+        for (int i = 0; i < 200; ++i)
+        {
+          queued.post(1U, etl::shared_message(pool, TelemetryMessage(i)));
+        }
+      });
+
+      producer1.join();
+      producer2.join();
+      done.store(true);
+      consumer.join();
+
+      CHECK_EQUAL(400U, router.order.size());
+      CHECK_EQUAL(200U, router.samples.size());
+      CHECK_EQUAL(0U, queued.drop_count(0U));
+      CHECK_EQUAL(0U, queued.drop_count(1U));
+
+      for (size_t i = 0U; i < router.samples.size(); ++i)
+      {
+        CHECK_EQUAL(int(i), router.samples[i]);
+      }
+    }
+  }
+}
+
+#endif
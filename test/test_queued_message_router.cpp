@@ -0,0 +1,362 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/queued_message_router.h"
+#include "etl/message_router.h"
+#include "etl/message_bus.h"
+#include "etl/fixed_sized_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+
+#include <thread>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  constexpr etl::message_id_t MessageId1 = 1U;
+  constexpr etl::message_id_t MessageId2 = 2U;
+  constexpr etl::message_id_t MessageId3 = 3U;
+
+  constexpr etl::message_router_id_t RouterId1 = 1U;
+  constexpr etl::message_router_id_t RouterId2 = 2U;
+  constexpr etl::message_router_id_t RouterId3 = 3U;
+
+  //*************************************************************************
+  // Counts the messages that are alive.
+  //*************************************************************************
+  struct Counted
+  {
+    Counted()                { ++live; }
+    Counted(const Counted&)  { ++live; }
+    ~Counted()               { --live; }
+
+    static std::atomic<int> live;
+  };
+
+  std::atomic<int> Counted::live(0);
+
+  //*************************************************************************
+  struct Message1 : public etl::message<MessageId1>, public Counted
+  {
+    Message1(int i_)
+      : i(i_)
+    {
+    }
+
+    int i;
+  };
+
+  //*************************************************************************
+  struct Message2 : public etl::message<MessageId2>, public Counted
+  {
+  };
+
+  //*************************************************************************
+  struct Message3 : public etl::message<MessageId3>
+  {
+  };
+
+  //*************************************************************************
+  struct Router : public etl::message_router<Router, Message1, Message2>
+  {
+    Router()
+      : message_router(RouterId1)
+      , count_message1(0)
+      , count_message2(0)
+      , count_unknown_message(0)
+      , sum(0)
+    {
+    }
+
+    void on_receive(const Message1& msg)
+    {
+      ++count_message1;
+      sum += msg.i;
+      order[(count_message1 - 1) % 16] = msg.i;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++count_message2;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+      ++count_unknown_message;
+    }
+
+    int count_message1;
+    int count_message2;
+    int count_unknown_message;
+    int sum;
+    int order[16];
+  };
+
+  //*************************************************************************
+  struct Router3 : public etl::message_router<Router3, Message3>
+  {
+    Router3()
+      : message_router(RouterId3)
+      , count_message3(0)
+    {
+    }
+
+    void on_receive(const Message3&)
+    {
+      ++count_message3;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int count_message3;
+  };
+
+  using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2, Message3>;
+
+  using Allocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                            pool_message_parameters::max_alignment,
+                                                            8U>;
+
+  using QueuedRouter = etl::queued_message_router<4U>;
+
+  SUITE(test_queued_message_router)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      CHECK_EQUAL(RouterId2, queued.get_message_router_id());
+      CHECK(&queued.get_destination() == &router);
+      CHECK(queued.empty());
+      CHECK(!queued.full());
+      CHECK_EQUAL(0U, queued.size());
+      CHECK_EQUAL(4U, queued.capacity());
+      CHECK_EQUAL(4U, queued.available());
+      CHECK_EQUAL(4U, QueuedRouter::MAX_SIZE);
+      CHECK(queued.is_consumer());
+      CHECK(!queued.is_producer());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_messages_are_queued)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      etl::send_message(queued, etl::shared_message(pool, Message1(1)));
+      etl::send_message(queued, etl::shared_message(pool, Message2()));
+      etl::send_message(queued, etl::shared_message(pool, Message1(2)));
+
+      CHECK_EQUAL(3U, queued.size());
+      CHECK_EQUAL(0, router.count_message1);
+      CHECK_EQUAL(0, router.count_message2);
+
+      CHECK_EQUAL(3U, queued.process_queue());
+
+      CHECK(queued.empty());
+      CHECK_EQUAL(2, router.count_message1);
+      CHECK_EQUAL(1, router.count_message2);
+      CHECK_EQUAL(1, router.order[0]);
+      CHECK_EQUAL(2, router.order[1]);
+
+      // All of the messages have been returned to the pool.
+      CHECK_EQUAL(0, Counted::live.load());
+    }
+
+    //*************************************************************************
+    TEST(test_process_queue_in_batches)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      // Move the queue indexes so that the messages wrap around the end of the buffer.
+      etl::send_message(queued, etl::shared_message(pool, Message2()));
+      etl::send_message(queued, etl::shared_message(pool, Message2()));
+      etl::send_message(queued, etl::shared_message(pool, Message2()));
+      CHECK_EQUAL(3U, queued.process_queue());
+
+      for (int i = 1; i <= 4; ++i)
+      {
+        etl::send_message(queued, etl::shared_message(pool, Message1(i)));
+      }
+
+      CHECK(queued.full());
+
+      CHECK_EQUAL(0U, queued.process_queue(0U));
+      CHECK_EQUAL(1U, queued.process_queue(1U));
+      CHECK_EQUAL(1, router.count_message1);
+      CHECK_EQUAL(3U, queued.size());
+
+      CHECK_EQUAL(2U, queued.process_queue(2U));
+      CHECK_EQUAL(3, router.count_message1);
+      CHECK_EQUAL(1U, queued.size());
+
+      CHECK_EQUAL(1U, queued.process_queue(10U));
+      CHECK_EQUAL(0U, queued.process_queue(10U));
+      CHECK_EQUAL(4, router.count_message1);
+
+      CHECK_EQUAL(1, router.order[0]);
+      CHECK_EQUAL(2, router.order[1]);
+      CHECK_EQUAL(3, router.order[2]);
+      CHECK_EQUAL(4, router.order[3]);
+
+      CHECK_EQUAL(0, Counted::live.load());
+    }
+
+    //*************************************************************************
+    TEST(test_queue_full)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      for (int i = 1; i <= 4; ++i)
+      {
+        etl::send_message(queued, etl::shared_message(pool, Message1(i)));
+      }
+
+      CHECK_THROW(etl::send_message(queued, etl::shared_message(pool, Message1(5))), etl::queued_message_router_full);
+
+      // The rejected message has been returned to the pool.
+      CHECK_EQUAL(4, Counted::live.load());
+
+      queued.clear();
+      CHECK(queued.empty());
+      CHECK_EQUAL(0, router.count_message1);
+      CHECK_EQUAL(0, Counted::live.load());
+    }
+
+    //*************************************************************************
+    TEST(test_messages_that_are_not_shared_are_passed_on)
+    {
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      etl::send_message(queued, Message1(1));
+
+      CHECK(queued.empty());
+      CHECK_EQUAL(1, router.count_message1);
+    }
+
+    //*************************************************************************
+    TEST(test_accepts)
+    {
+      Router       router;
+      Router3      router3;
+      QueuedRouter queued(RouterId2, router);
+
+      CHECK(queued.accepts(MessageId1));
+      CHECK(queued.accepts(MessageId2));
+      CHECK(!queued.accepts(MessageId3));
+
+      queued.set_successor(router3);
+
+      CHECK(queued.accepts(MessageId3));
+    }
+
+    //*************************************************************************
+    TEST(test_from_message_bus)
+    {
+      Allocator                        allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router            router;
+      QueuedRouter      queued(RouterId2, router);
+      etl::message_bus<1U> bus;
+
+      bus.subscribe(queued);
+
+      etl::send_message(bus, etl::shared_message(pool, Message1(1)));
+      etl::send_message(bus, RouterId2, etl::shared_message(pool, Message1(2)));
+      etl::send_message(bus, RouterId1, etl::shared_message(pool, Message1(3)));
+
+      CHECK_EQUAL(2U, queued.size());
+      CHECK_EQUAL(2U, queued.process_queue());
+      CHECK_EQUAL(3, router.sum);
+    }
+
+    //*************************************************************************
+    TEST(test_producer_and_consumer_threads)
+    {
+      using ThreadAllocator = etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                                                      pool_message_parameters::max_alignment,
+                                                                      16U>;
+      ThreadAllocator                  allocator;
+      etl::atomic_counted_message_pool pool(allocator);
+
+      Router       router;
+      QueuedRouter queued(RouterId2, router);
+
+      const int Count = 1000;
+
+      std::thread producer([&]()
+      {
+        for (int i = 1; i <= Count; ++i)
+        {
+          while (queued.full())
+          {
+            std::this_thread::yield();
+          }
+
+          etl::send_message(queued, etl::shared_message(pool, Message1(i)));
+        }
+      });
+
+      while (router.count_message1 < Count)
+      {
+        if (queued.process_queue(3U) == 0U)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      producer.join();
+
+      CHECK_EQUAL(Count, router.count_message1);
+      CHECK_EQUAL((Count * (Count + 1)) / 2, router.sum);
+      CHECK_EQUAL(0, Counted::live.load());
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,225 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/radix_heap.h"
+
+#include <map>
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace
+{
+  const size_t SIZE = 16;
+
+  typedef etl::radix_heap<uint32_t, int, SIZE>         Heap;
+  typedef etl::radix_heap<uint8_t, int, SIZE>          Heap8;
+  typedef etl::radix_heap<uint32_t, std::string, SIZE> HeapS;
+
+  SUITE(test_radix_heap)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Heap heap;
+
+      CHECK(heap.empty());
+      CHECK(!heap.full());
+      CHECK_EQUAL(0U, heap.size());
+      CHECK_EQUAL(SIZE, heap.max_size());
+      CHECK_EQUAL(SIZE, heap.capacity());
+      CHECK_EQUAL(SIZE, heap.available());
+      CHECK_EQUAL(0U, heap.last_key());
+      CHECK_EQUAL(33U, Heap::Number_Of_Buckets);
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_in_key_order)
+    {
+      const uint32_t keys[SIZE] = { 500, 12, 3000000000UL, 9, 1, 70000, 15, 2, 8, 11, 4, 0xFFFFFFFFUL, 6, 1000, 13, 0 };
+
+      Heap heap;
+      std::multimap<uint32_t, int> compare;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        heap.push(keys[i], int(i));
+        compare.insert(std::make_pair(keys[i], int(i)));
+      }
+
+      CHECK(heap.full());
+
+      for (std::multimap<uint32_t, int>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->first, heap.top_key());
+        CHECK_EQUAL(itr->second, heap.top());
+        heap.pop();
+        CHECK_EQUAL(itr->first, heap.last_key());
+      }
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_equal_keys_are_fifo)
+    {
+      Heap heap;
+
+      heap.push(10, 1);
+      heap.push(20, 2);
+      heap.push(10, 3);
+      heap.push(20, 4);
+      heap.push(10, 5);
+
+      CHECK_EQUAL(1, heap.top()); heap.pop();
+      heap.push(10, 6); // Equal to the last key.
+      CHECK_EQUAL(3, heap.top()); heap.pop();
+      CHECK_EQUAL(5, heap.top()); heap.pop();
+      CHECK_EQUAL(6, heap.top()); heap.pop();
+      CHECK_EQUAL(2, heap.top()); heap.pop();
+      CHECK_EQUAL(4, heap.top()); heap.pop();
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_monotone)
+    {
+      // A timer queue where new deadlines are relative to the last expiry.
+      Heap8 heap;
+      std::multimap<uint8_t, int> compare;
+      uint32_t seed = 1;
+      int id = 0;
+
+      for (int step = 0; step < 1000; ++step)
+      {
+        seed = (seed * 1103515245UL) + 12345UL;
+
+        if (!heap.full() && (heap.empty() || ((seed >> 16) & 1U)))
+        {
+          const uint32_t delay = (seed >> 8) & 0x1FU;
+          const uint32_t key   = heap.last_key() + delay;
+
+          if (key <= 0xFFU)
+          {
+            heap.push(uint8_t(key), id);
+            compare.insert(std::make_pair(uint8_t(key), id));
+            ++id;
+          }
+        }
+        else
+        {
+          CHECK_EQUAL(int(compare.begin()->first), int(heap.top_key()));
+          CHECK_EQUAL(compare.begin()->second, heap.top());
+          heap.pop();
+          compare.erase(compare.begin());
+        }
+
+        CHECK_EQUAL(compare.size(), heap.size());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      Heap heap;
+      int value;
+
+      CHECK_THROW(heap.pop(), etl::radix_heap_empty);
+      CHECK_THROW(heap.pop_into(value), etl::radix_heap_empty);
+
+      heap.push(100, 1);
+      heap.push(200, 2);
+      heap.pop_into(value);
+      CHECK_EQUAL(1, value);
+
+      // Less than the last key, but greater than the top.
+      CHECK_THROW(heap.push(99, 3), etl::radix_heap_key_order);
+      heap.push(100, 3);
+      heap.push(150, 4);
+      CHECK_EQUAL(3, heap.top());
+
+      for (size_t i = heap.size(); i < SIZE; ++i)
+      {
+        heap.push(300, int(i));
+      }
+
+      CHECK_THROW(heap.push(300, 0), etl::radix_heap_full);
+      CHECK_THROW(heap.emplace(300, 0), etl::radix_heap_full);
+    }
+
+    //*************************************************************************
+    TEST(test_strings_clear_copy_move)
+    {
+      HeapS heap;
+
+      heap.push(30, std::string("C"));
+      heap.emplace(10, 3U, 'A');
+      heap.push(20, std::string("B"));
+      heap.pop();
+      heap.push(15, std::string("D"));
+
+      HeapS copy(heap);
+      CHECK_EQUAL(heap.size(), copy.size());
+      CHECK_EQUAL(10U, copy.last_key());
+      CHECK_EQUAL(std::string("D"), copy.top());
+
+      HeapS assigned;
+      assigned.push(1, std::string("X"));
+      assigned = copy;
+      CHECK_EQUAL(3U, assigned.size());
+
+      HeapS moved(std::move(copy));
+      CHECK(copy.empty());
+
+      HeapS move_assigned;
+      move_assigned = std::move(moved);
+      CHECK(moved.empty());
+
+      const char* expected[] = { "D", "B", "C" };
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        CHECK_EQUAL(std::string(expected[i]), heap.top());
+        CHECK_EQUAL(std::string(expected[i]), assigned.top());
+        CHECK_EQUAL(std::string(expected[i]), move_assigned.top());
+        heap.pop();
+        assigned.pop();
+        move_assigned.pop();
+      }
+
+      heap.push(50, std::string("E"));
+      heap.clear();
+      CHECK(heap.empty());
+      CHECK_EQUAL(0U, heap.last_key());
+      heap.push(1, std::string("F"));
+      CHECK_EQUAL(std::string("F"), heap.top());
+    }
+  }
+}
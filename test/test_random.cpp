@@ -412,5 +412,188 @@ namespace
       }
     }
 
+    //*************************************************************************
+    template <typename TGenerator>
+    void check_fill_matches_sequence()
+    {
+      TGenerator r1(12345U);
+      TGenerator r2(12345U);
+
+      std::vector<uint32_t> expected(1001U);
+
+      for (size_t i = 0UL; i < expected.size(); ++i)
+      {
+        expected[i] = r1();
+      }
+
+      std::vector<uint32_t> filled(expected.size());
+
+      // Odd sized pieces, through the base class.
+      etl::random& base = r2;
+      base.fill(etl::span<uint32_t>(filled.data(), 3U));
+      r2.fill(etl::span<uint32_t>(filled.data() + 3U, 500U));
+      filled[503] = r2.next();
+      r2.fill(etl::span<uint32_t>(filled.data() + 504U, filled.size() - 504U));
+
+      CHECK(expected == filled);
+      CHECK_EQUAL(r1(), r2());
+    }
+
+    //*************************************************************************
+    TEST(test_random_fill)
+    {
+      check_fill_matches_sequence<etl::random_xorshift>();
+      check_fill_matches_sequence<etl::random_lcg>();
+      check_fill_matches_sequence<etl::random_clcg>();
+      check_fill_matches_sequence<etl::random_lsfr>();
+      check_fill_matches_sequence<etl::random_mwc>();
+      check_fill_matches_sequence<etl::random_pcg>();
+      check_fill_matches_sequence<etl::random_hash<etl::crc32> >();
+      check_fill_matches_sequence<etl::random_splitmix64>();
+      check_fill_matches_sequence<etl::random_philox>();
+    }
+
+    //*************************************************************************
+    TEST(test_random_splitmix64_sequence)
+    {
+      // Reference values for a seed of 1234567.
+      etl::random_splitmix64 r;
+      r.initialise64(1234567ULL);
+
+      CHECK_EQUAL(6457827717110365317ULL,  r.next64());
+      CHECK_EQUAL(3203168211198807973ULL,  r.next64());
+      CHECK_EQUAL(9817491932198370423ULL,  r.next64());
+      CHECK_EQUAL(4593380528125082431ULL,  r.next64());
+      CHECK_EQUAL(16408922859458223821ULL, r.next64());
+
+      r.initialise64(1234567ULL);
+      CHECK_EQUAL(uint32_t(6457827717110365317ULL >> 32U), r());
+
+      uint64_t values[4];
+      r.initialise64(1234567ULL);
+      r.fill(etl::span<uint64_t>(values, 4U));
+      CHECK_EQUAL(6457827717110365317ULL, values[0]);
+      CHECK_EQUAL(4593380528125082431ULL, values[3]);
+      CHECK_EQUAL(16408922859458223821ULL, r.next64());
+    }
+
+    //*************************************************************************
+    TEST(test_random_splitmix64_discard)
+    {
+      etl::random_splitmix64 r1(99U);
+      etl::random_splitmix64 r2(99U);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        r1();
+      }
+
+      r2.discard(1000U);
+
+      CHECK_EQUAL(r1(), r2());
+    }
+
+    //*************************************************************************
+    TEST(test_random_splitmix64_range)
+    {
+      etl::random_splitmix64 r;
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_philox_known_answers)
+    {
+      // Random123 known answer tests for Philox4x32-10.
+      uint32_t result[4];
+
+      const uint32_t counter1[4] = { 0U, 0U, 0U, 0U };
+      const uint32_t key1[2]     = { 0U, 0U };
+      etl::random_philox::generate(counter1, key1, result);
+      CHECK_EQUAL(0x6627E8D5UL, result[0]);
+      CHECK_EQUAL(0xE169C58DUL, result[1]);
+      CHECK_EQUAL(0xBC57AC4CUL, result[2]);
+      CHECK_EQUAL(0x9B00DBD8UL, result[3]);
+
+      const uint32_t counter2[4] = { 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xFFFFFFFFUL };
+      const uint32_t key2[2]     = { 0xFFFFFFFFUL, 0xFFFFFFFFUL };
+      etl::random_philox::generate(counter2, key2, result);
+      CHECK_EQUAL(0x408F276DUL, result[0]);
+      CHECK_EQUAL(0x41C83B0EUL, result[1]);
+      CHECK_EQUAL(0xA20BC7C6UL, result[2]);
+      CHECK_EQUAL(0x6D5451FDUL, result[3]);
+
+      const uint32_t counter3[4] = { 0x243F6A88UL, 0x85A308D3UL, 0x13198A2EUL, 0x03707344UL };
+      const uint32_t key3[2]     = { 0xA4093822UL, 0x299F31D0UL };
+      etl::random_philox::generate(counter3, key3, result);
+      CHECK_EQUAL(0xD16CFE09UL, result[0]);
+      CHECK_EQUAL(0x94FDCCEBUL, result[1]);
+      CHECK_EQUAL(0x5001E420UL, result[2]);
+      CHECK_EQUAL(0x24126EA1UL, result[3]);
+
+      // The generator with seed 0 in stream 0 starts with counter 0.
+      etl::random_philox r(0U);
+      CHECK_EQUAL(0x6627E8D5UL, r());
+      CHECK_EQUAL(0xE169C58DUL, r());
+    }
+
+    //*************************************************************************
+    TEST(test_random_philox_streams_and_discard)
+    {
+      etl::random_philox stream0(42U, 0U);
+      etl::random_philox stream1(42U, 1U);
+      etl::random_philox again1(42U, 1U);
+
+      std::vector<uint32_t> values0(64U);
+      std::vector<uint32_t> values1(64U);
+
+      stream0.fill(etl::span<uint32_t>(values0.data(), values0.size()));
+      stream1.fill(etl::span<uint32_t>(values1.data(), values1.size()));
+
+      CHECK(values0 != values1);
+
+      for (size_t i = 0UL; i < values1.size(); ++i)
+      {
+        CHECK_EQUAL(values1[i], again1());
+      }
+
+      // Jumps, including into the middle of a block.
+      const size_t skips[] = { 0U, 1U, 3U, 4U, 5U, 17U, 40U };
+
+      for (size_t s = 0UL; s < (sizeof(skips) / sizeof(skips[0])); ++s)
+      {
+        etl::random_philox jumped(42U, 0U);
+        jumped.next();
+        jumped.discard(skips[s]);
+
+        CHECK_EQUAL(values0[1U + skips[s]], jumped());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_philox_range)
+    {
+      etl::random_philox r;
+
+      uint32_t low  = 1234UL;
+      uint32_t high = 9876UL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint32_t n = r.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
   };
 }
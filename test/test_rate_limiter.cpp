@@ -0,0 +1,207 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/rate_limiter.h"
+
+#include <stdint.h>
+
+namespace
+{
+  SUITE(test_rate_limiter)
+  {
+    //*************************************************************************
+    TEST(test_token_bucket_burst_and_refill)
+    {
+      // 4 tokens, refilled at 1 token every 10 ticks.
+      etl::token_bucket bucket(4U, 1U, 10U, 100U);
+
+      CHECK_EQUAL(4U, bucket.capacity());
+      CHECK(bucket.is_idle(100U));
+      CHECK_EQUAL(4U, bucket.available(100U));
+
+      CHECK(bucket.try_consume(100U));
+      CHECK(bucket.try_consume(100U, 3U));
+      CHECK(!bucket.try_consume(100U));
+      CHECK_EQUAL(10U, bucket.ticks_until_available(100U));
+      CHECK_EQUAL(30U, bucket.ticks_until_available(100U, 3U));
+
+      CHECK(!bucket.try_consume(109U));
+      CHECK_EQUAL(1U, bucket.ticks_until_available(109U));
+      CHECK(bucket.try_consume(110U));
+      CHECK(!bucket.try_consume(110U));
+
+      // Refilling is capped at the capacity.
+      CHECK_EQUAL(4U, bucket.available(1000U));
+      CHECK(bucket.is_idle(1000U));
+      CHECK(!bucket.try_consume(1000U, 5U));
+      CHECK_EQUAL(UINT32_MAX, bucket.ticks_until_available(1000U, 5U));
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_fractional_rate)
+    {
+      // 3 tokens every 7 ticks, checked on every tick.
+      etl::token_bucket bucket(2U, 3U, 7U);
+
+      CHECK(bucket.try_consume(0U));
+
+      uint32_t accepted = 0U;
+
+      for (uint32_t t = 1U; t <= 700U; ++t)
+      {
+        if (bucket.try_consume(t))
+        {
+          ++accepted;
+        }
+      }
+
+      // The one token left from the burst, plus 700 * 3 / 7.
+      CHECK_EQUAL(301U, accepted);
+    }
+
+    //*************************************************************************
+    TEST(test_token_bucket_time_wraps)
+    {
+      etl::token_bucket bucket(2U, 1U, 100U, UINT32_MAX - 50U);
+
+      CHECK(bucket.try_consume(UINT32_MAX - 50U, 2U));
+      CHECK(!bucket.try_consume(UINT32_MAX));
+      CHECK(bucket.try_consume(49U));
+      CHECK(!bucket.try_consume(49U));
+
+      bucket.reset(49U);
+      CHECK_EQUAL(2U, bucket.available(49U));
+    }
+
+    //*************************************************************************
+    TEST(test_leaky_bucket)
+    {
+      // Up to 3 back to back, then one every 5 ticks.
+      etl::leaky_bucket bucket(3U, 5U, 0U);
+
+      CHECK_EQUAL(3U, bucket.capacity());
+      CHECK(bucket.is_idle(0U));
+      CHECK_EQUAL(3U, bucket.available(0U));
+
+      CHECK(bucket.try_consume(0U));
+      CHECK(bucket.try_consume(0U, 2U));
+      CHECK(!bucket.try_consume(0U));
+      CHECK_EQUAL(5U, bucket.ticks_until_available(0U));
+
+      CHECK(!bucket.try_consume(4U));
+      CHECK(bucket.try_consume(5U));
+      CHECK(!bucket.try_consume(5U));
+      CHECK_EQUAL(2U, bucket.available(15U));
+      CHECK(bucket.is_idle(20U));
+      CHECK_EQUAL(UINT32_MAX, bucket.ticks_until_available(20U, 4U));
+
+      bucket.try_consume(20U);
+      bucket.reset(20U);
+      CHECK(bucket.is_idle(20U));
+    }
+
+    //*************************************************************************
+    TEST(test_table_per_key)
+    {
+      etl::rate_limiter_table<int, 4> table(etl::token_bucket(2U, 1U, 10U));
+
+      CHECK(table.empty());
+      CHECK(table.find(1) == ETL_NULLPTR);
+
+      CHECK(table.try_consume(1, 0U));
+      CHECK(table.try_consume(1, 0U));
+      CHECK(!table.try_consume(1, 0U));
+
+      // Other keys have their own buckets.
+      CHECK(table.try_consume(2, 0U, 2U));
+      CHECK(!table.try_consume(2, 0U));
+      CHECK(table.try_consume(3, 0U));
+
+      CHECK_EQUAL(3U, table.size());
+      CHECK(table.find(1) != ETL_NULLPTR);
+      CHECK_EQUAL(0U, table.find(1)->available(0U));
+
+      CHECK(table.try_consume(1, 10U));
+      CHECK(!table.try_consume(1, 10U));
+
+      table.clear();
+      CHECK(table.empty());
+      CHECK(table.try_consume(1, 10U, 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_table_reuses_idle_buckets)
+    {
+      etl::rate_limiter_table<int, 2, etl::leaky_bucket> table(etl::leaky_bucket(1U, 10U));
+
+      CHECK(table.try_consume(1, 0U));
+      CHECK(table.try_consume(2, 0U));
+      CHECK_EQUAL(2U, table.size());
+
+      // Both buckets are busy.
+      CHECK_THROW(table.try_consume(3, 5U), etl::rate_limiter_table_full);
+
+      // Key 1's bucket has drained, so key 3 may take it.
+      CHECK(table.try_consume(2, 10U));
+      CHECK(table.try_consume(3, 10U));
+      CHECK(!table.try_consume(3, 10U));
+      CHECK(table.find(3) != ETL_NULLPTR);
+      CHECK(table.find(1) == ETL_NULLPTR);
+      CHECK_EQUAL(2U, table.size());
+
+      // Key 1 returns as new.
+      CHECK(table.try_consume(1, 20U));
+    }
+
+    //*************************************************************************
+    TEST(test_table_many_keys)
+    {
+      etl::rate_limiter_table<uint32_t, 37> table(etl::token_bucket(1U, 1U, 100U));
+
+      for (uint32_t key = 0U; key < 37U; ++key)
+      {
+        CHECK(table.try_consume(key * 1000U, 0U));
+      }
+
+      for (uint32_t key = 0U; key < 37U; ++key)
+      {
+        CHECK(!table.try_consume(key * 1000U, 50U));
+      }
+
+      CHECK_EQUAL(37U, table.size());
+      CHECK_THROW(table.try_consume(1U, 50U), etl::rate_limiter_table_full);
+
+      for (uint32_t key = 0U; key < 37U; ++key)
+      {
+        CHECK(table.try_consume(key * 1000U, 100U));
+      }
+    }
+  }
+}
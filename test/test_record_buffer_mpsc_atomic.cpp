@@ -0,0 +1,244 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/record_buffer_mpsc_atomic.h"
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::record_buffer_mpsc_atomic<64U> Buffer;
+
+  SUITE(test_record_buffer_mpsc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      Buffer buffer;
+
+      CHECK(buffer.empty());
+      CHECK_EQUAL(0U, buffer.size());
+      CHECK_EQUAL(64U, buffer.capacity());
+      CHECK_EQUAL(24U, buffer.max_record_size());
+      CHECK_EQUAL(16U, Buffer::record_size(1U));
+      CHECK_EQUAL(16U, Buffer::record_size(8U));
+      CHECK_EQUAL(24U, Buffer::record_size(9U));
+      CHECK(buffer.read_reserve().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_write_read_in_place)
+    {
+      Buffer buffer;
+
+      etl::span<uint8_t> first  = buffer.write_reserve(3U);
+      etl::span<uint8_t> second = buffer.write_reserve(9U);
+
+      CHECK_EQUAL(3U, first.size());
+      CHECK_EQUAL(9U, second.size());
+      CHECK_EQUAL(40U, buffer.size());
+      CHECK_EQUAL(0U, reinterpret_cast<uintptr_t>(first.data()) % Buffer::Alignment);
+
+      // The second record is committed first, but is read second.
+      memset(second.data(), 2, second.size());
+      buffer.write_commit(second);
+      CHECK(buffer.read_reserve().empty());
+
+      memset(first.data(), 1, first.size());
+      buffer.write_commit(first);
+
+      etl::span<const uint8_t> record = buffer.read_reserve();
+      CHECK_EQUAL(3U, record.size());
+      CHECK_EQUAL(1, record[0]);
+      buffer.read_commit(record);
+
+      record = buffer.read_reserve();
+      CHECK_EQUAL(9U, record.size());
+      CHECK_EQUAL(2, record[8]);
+      buffer.read_commit(record);
+
+      CHECK(buffer.empty());
+      CHECK(buffer.read_reserve().empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full_and_invalid_lengths)
+    {
+      Buffer buffer;
+
+      CHECK(buffer.write_reserve(0U).empty());
+      CHECK(buffer.write_reserve(25U).empty());
+
+      CHECK(buffer.write("0123456789012345678901", 22U));
+      CHECK(buffer.write("0123456789012345678901", 22U));
+      CHECK(!buffer.write("x", 1U));
+
+      CHECK_EQUAL(2U, buffer.read([](etl::span<const uint8_t> record) { CHECK_EQUAL(22U, record.size()); }));
+      CHECK(buffer.write("x", 1U));
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_with_padding)
+    {
+      Buffer buffer;
+
+      // Move the cursors to 48 bytes from the start.
+      CHECK(buffer.write("abcdefghijklmnop", 16U));
+      CHECK(buffer.write("abcdefghijklmnop", 16U));
+      CHECK_EQUAL(2U, buffer.read([](etl::span<const uint8_t>) {}, 2U));
+
+      // 16 bytes are left before the end, so a record of 24 bytes wraps around and stays contiguous.
+      etl::span<uint8_t> record = buffer.write_reserve(16U);
+      CHECK(!record.empty());
+      CHECK_EQUAL(40U, buffer.size());
+
+      memcpy(record.data(), "ponmlkjihgfedcba", 16U);
+      buffer.write_commit(record);
+
+      std::vector<std::string> read;
+      buffer.read([&](etl::span<const uint8_t> r) { read.push_back(std::string(r.begin(), r.end())); });
+
+      CHECK_EQUAL(1U, read.size());
+      CHECK_EQUAL(std::string("ponmlkjihgfedcba"), read[0]);
+      CHECK(buffer.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_cancel)
+    {
+      Buffer buffer;
+
+      etl::span<uint8_t> cancelled = buffer.write_reserve(4U);
+      CHECK(buffer.write("kept", 4U));
+      buffer.write_cancel(cancelled);
+
+      std::vector<std::string> read;
+      buffer.read([&](etl::span<const uint8_t> r) { read.push_back(std::string(r.begin(), r.end())); });
+
+      CHECK_EQUAL(1U, read.size());
+      CHECK_EQUAL(std::string("kept"), read[0]);
+      CHECK(buffer.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_read_commit_invalid)
+    {
+      Buffer buffer;
+
+      CHECK(buffer.write("one", 3U));
+      CHECK(buffer.write("two", 3U));
+
+      etl::span<const uint8_t> first = buffer.read_reserve();
+      etl::span<const uint8_t> wrong(first.data() + Buffer::record_size(3U), 3U);
+
+      CHECK_THROW(buffer.read_commit(wrong), etl::record_buffer_commit_invalid);
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_producers)
+    {
+      struct Record
+      {
+        uint32_t producer;
+        uint32_t sequence;
+        uint32_t padding[4];
+      };
+
+      static const uint32_t Producers = 4U;
+      static const uint32_t Records   = 20000U;
+
+      etl::record_buffer_mpsc_atomic<1024U> buffer;
+      std::atomic<bool> start(false);
+
+      std::vector<std::thread> producers;
+
+      for (uint32_t p = 0U; p < Producers; ++p)
+      {
+        producers.push_back(std::thread([&buffer, &start, p]()
+        {
+          while (!start.load())
+          {
+          }
+
+          for (uint32_t i = 0U; i < Records; ++i)
+          {
+            // Vary the length so records wrap at different places.
+            const size_t length = 8U + ((i % 3U) * 4U);
+
+            etl::span<uint8_t> record;
+
+            do
+            {
+              record = buffer.write_reserve(length);
+            } while (record.empty());
+
+            Record r = { p, i, { 0U, 0U, 0U, 0U } };
+            memcpy(record.data(), &r, length);
+            buffer.write_commit(record);
+          }
+        }));
+      }
+
+      uint32_t next[Producers] = { 0U, 0U, 0U, 0U };
+      uint32_t total = 0U;
+      bool     ordered = true;
+
+      start.store(true);
+
+      while (total < (Producers * Records))
+      {
+        total += uint32_t(buffer.read([&](etl::span<const uint8_t> record)
+        {
+          Record r;
+          memcpy(&r, record.data(), 8U);
+
+          // Each producer's records arrive in order.
+          ordered = ordered && (r.producer < Producers) && (r.sequence == next[r.producer]);
+          ++next[r.producer % Producers];
+        }));
+      }
+
+      for (size_t p = 0U; p < producers.size(); ++p)
+      {
+        producers[p].join();
+      }
+
+      CHECK(ordered);
+      CHECK(buffer.empty());
+    }
+  }
+}
+
+#endif
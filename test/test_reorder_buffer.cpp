@@ -0,0 +1,276 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/reorder_buffer.h"
+#include "etl/vector.h"
+
+#include <stdint.h>
+
+namespace
+{
+  typedef etl::reorder_buffer<int, 8>            Buffer;
+  typedef etl::reorder_buffer<int, 8, uint32_t>  Buffer32;
+
+  struct Output
+  {
+    Output(etl::ivector<uint16_t>& sequences_, etl::ivector<int>& values_)
+      : sequences(sequences_)
+      , values(values_)
+    {
+    }
+
+    void operator()(uint16_t sequence, int& value)
+    {
+      sequences.push_back(sequence);
+      values.push_back(value);
+    }
+
+    etl::ivector<uint16_t>& sequences;
+    etl::ivector<int>&      values;
+  };
+
+  struct Counted
+  {
+    Counted(int value_)
+      : value(value_)
+    {
+      ++instances;
+    }
+
+    Counted(const Counted& other)
+      : value(other.value)
+    {
+      ++instances;
+    }
+
+    ~Counted()
+    {
+      --instances;
+    }
+
+    int value;
+
+    static int instances;
+  };
+
+  int Counted::instances = 0;
+
+  SUITE(test_reorder_buffer)
+  {
+    //*************************************************************************
+    TEST(test_serial_arithmetic)
+    {
+      CHECK_EQUAL(1,  etl::serial_distance<uint16_t>(0xFFFFU, 0U));
+      CHECK_EQUAL(-1, etl::serial_distance<uint16_t>(0U, 0xFFFFU));
+      CHECK_EQUAL(10, etl::serial_distance<uint32_t>(0xFFFFFFFBUL, 5U));
+
+      CHECK_TRUE(etl::serial_less<uint16_t>(0xFFF0U, 0x0010U));
+      CHECK_FALSE(etl::serial_less<uint16_t>(0x0010U, 0xFFF0U));
+      CHECK_FALSE(etl::serial_less<uint16_t>(5U, 5U));
+    }
+
+    //*************************************************************************
+    TEST(test_in_order)
+    {
+      Buffer buffer(100U);
+
+      CHECK_FALSE(buffer.ready());
+      CHECK(buffer.insert(100U, 1) == etl::reorder_status::Inserted);
+      CHECK_TRUE(buffer.ready());
+      CHECK_EQUAL(1, buffer.front());
+
+      buffer.pop();
+      CHECK_EQUAL(101U, buffer.next());
+      CHECK_TRUE(buffer.empty());
+      CHECK_THROW(buffer.front(), etl::reorder_buffer_not_ready);
+      CHECK_THROW(buffer.pop(), etl::reorder_buffer_not_ready);
+    }
+
+    //*************************************************************************
+    TEST(test_out_of_order_drain)
+    {
+      Buffer buffer(10U);
+      etl::vector<uint16_t, 8> sequences;
+      etl::vector<int, 8>      values;
+
+      CHECK(buffer.insert(12U, 12) == etl::reorder_status::Inserted);
+      CHECK(buffer.insert(11U, 11) == etl::reorder_status::Inserted);
+      CHECK(buffer.insert(14U, 14) == etl::reorder_status::Inserted);
+      CHECK_EQUAL(3U, buffer.size());
+
+      CHECK_EQUAL(0U, buffer.drain(Output(sequences, values)));
+
+      CHECK(buffer.insert(10U, 10) == etl::reorder_status::Inserted);
+      CHECK_EQUAL(3U, buffer.drain(Output(sequences, values)));
+      CHECK_EQUAL(13U, buffer.next());
+      CHECK_EQUAL(1U, buffer.size());
+
+      CHECK(buffer.insert(13U, 13) == etl::reorder_status::Inserted);
+      CHECK_EQUAL(2U, buffer.drain(Output(sequences, values)));
+
+      const int expected[] = { 10, 11, 12, 13, 14 };
+      CHECK_EQUAL(5U, values.size());
+      CHECK_ARRAY_EQUAL(expected, values.data(), 5U);
+      CHECK_EQUAL(10U, sequences.front());
+      CHECK_EQUAL(14U, sequences.back());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_through_zero)
+    {
+      Buffer buffer(0xFFFEU);
+      etl::vector<uint16_t, 8> sequences;
+      etl::vector<int, 8>      values;
+
+      CHECK(buffer.insert(1U, 3) == etl::reorder_status::Inserted);
+      CHECK(buffer.insert(0xFFFFU, 1) == etl::reorder_status::Inserted);
+      CHECK(buffer.insert(0U, 2) == etl::reorder_status::Inserted);
+      CHECK(buffer.insert(0xFFFEU, 0) == etl::reorder_status::Inserted);
+
+      CHECK_EQUAL(4U, buffer.drain(Output(sequences, values)));
+      CHECK_EQUAL(2U, buffer.next());
+
+      const int expected[] = { 0, 1, 2, 3 };
+      CHECK_ARRAY_EQUAL(expected, values.data(), 4U);
+      CHECK_EQUAL(0xFFFEU, sequences[0]);
+      CHECK_EQUAL(1U,      sequences[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_duplicates_late_and_ahead)
+    {
+      Buffer buffer(0U);
+
+      buffer.insert(0U, 0);
+      buffer.insert(2U, 2);
+
+      // Already held.
+      CHECK(buffer.insert(2U, 2) == etl::reorder_status::Duplicate);
+
+      // Already delivered.
+      buffer.pop();
+      CHECK(buffer.insert(0U, 0) == etl::reorder_status::Duplicate);
+
+      // Skipped, then arrived.
+      CHECK_EQUAL(1U, buffer.skip_gap());
+      CHECK_EQUAL(2U, buffer.next());
+      CHECK(buffer.insert(1U, 1) == etl::reorder_status::Late);
+
+      // Beyond the window.
+      CHECK(buffer.insert(10U, 10) == etl::reorder_status::Too_Far_Ahead);
+      CHECK(buffer.insert(9U, 9) == etl::reorder_status::Inserted);
+
+      // More than a window behind.
+      CHECK(buffer.insert(0xFFF0U, 0) == etl::reorder_status::Late);
+
+      CHECK_EQUAL(2U, buffer.duplicate_count());
+      CHECK_EQUAL(2U, buffer.late_count());
+      CHECK_EQUAL(1U, buffer.lost_count());
+
+      buffer.reset_statistics();
+      CHECK_EQUAL(0U, buffer.duplicate_count());
+    }
+
+    //*************************************************************************
+    TEST(test_drain_with_timeout)
+    {
+      Buffer32 buffer(0U);
+      etl::vector<uint16_t, 8> sequences;
+      etl::vector<int, 8>      values;
+
+      buffer.insert(0U, 0, 100U);
+      buffer.insert(2U, 2, 105U);
+      buffer.insert(5U, 5, 110U);
+
+      // The gap at 1 has been waited on for 10 ticks.
+      CHECK_EQUAL(1U, buffer.drain(115U, 20U, Output(sequences, values)));
+      CHECK_EQUAL(1U, buffer.next());
+
+      // 2 has waited 20 ticks, so 1 is lost. 5 has waited 15, so 3 and 4 are not.
+      CHECK_EQUAL(1U, buffer.drain(125U, 20U, Output(sequences, values)));
+      CHECK_EQUAL(3U, buffer.next());
+      CHECK_EQUAL(1U, buffer.lost_count());
+
+      CHECK_EQUAL(1U, buffer.drain(130U, 20U, Output(sequences, values)));
+      CHECK_EQUAL(6U, buffer.next());
+      CHECK_EQUAL(3U, buffer.lost_count());
+      CHECK_TRUE(buffer.empty());
+
+      const int expected[] = { 0, 2, 5 };
+      CHECK_ARRAY_EQUAL(expected, values.data(), 3U);
+    }
+
+    //*************************************************************************
+    TEST(test_skip_gap_wraps_window)
+    {
+      Buffer buffer(6U);
+
+      // Slot of 9 is before the slot of 6 in the window.
+      buffer.insert(9U, 9);
+
+      CHECK_EQUAL(3U, buffer.skip_gap());
+      CHECK_EQUAL(9U, buffer.next());
+      CHECK_EQUAL(9, buffer.front());
+      CHECK_EQUAL(0U, buffer.skip_gap());
+    }
+
+    //*************************************************************************
+    TEST(test_clear_and_reset_destroy_items)
+    {
+      Counted::instances = 0;
+
+      {
+        etl::reorder_buffer<Counted, 4> buffer(0U);
+
+        buffer.insert(1U, Counted(1));
+        buffer.insert(3U, Counted(3));
+        CHECK_EQUAL(2, Counted::instances);
+
+        buffer.clear();
+        CHECK_EQUAL(0, Counted::instances);
+        CHECK_EQUAL(0U, buffer.next());
+
+        buffer.insert(2U, Counted(2));
+        buffer.reset(50U);
+        CHECK_EQUAL(0, Counted::instances);
+        CHECK_EQUAL(50U, buffer.next());
+
+        buffer.insert(51U, Counted(51));
+        buffer.insert(50U, Counted(50));
+        buffer.pop();
+        CHECK_EQUAL(1, Counted::instances);
+      }
+
+      CHECK_EQUAL(0, Counted::instances);
+    }
+  }
+}
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -93,5 +94,24 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_process)
+    {
+      CharIntRescale rescale(10, 19, 40000, 41900);
+
+      std::array<int, Size> output;
+      rescale.process(etl::span<const char>(input1.data(), input1.size()), etl::span<int>(output.data(), output.size()));
+
+      std::transform(input1.begin(), input1.end(), output1.begin(), rescale);
+
+      CHECK(output == output1);
+
+      // Only as many samples as the output holds.
+      std::array<int, 4> short_output = { 0, 0, 0, 0 };
+      rescale.process(etl::span<const char>(input1.data(), input1.size()), etl::span<int>(short_output.data(), short_output.size()));
+
+      CHECK(std::equal(short_output.begin(), short_output.end(), output1.begin()));
+    }
   };
 }
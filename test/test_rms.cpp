@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/rms.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -66,5 +67,59 @@ namespace
 
       CHECK_CLOSE(5.21, result, 0.05);
     }
+
+    //*************************************************************************
+    TEST(test_rms_block_add_matches_single_values)
+    {
+      std::vector<float>   samples_f;
+      std::vector<double>  samples_d;
+      std::vector<int16_t> samples_i16;
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 1003U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int16_t sample = int16_t(seed >> 16);
+
+        samples_i16.push_back(sample);
+        samples_f.push_back(float(sample) / 32768.0f);
+        samples_d.push_back(double(sample) / 32768.0);
+      }
+
+      for (size_t length = 0U; length <= samples_f.size(); length += ((length < 40U) ? 1U : 321U))
+      {
+        etl::rms<float> single_f(samples_f.begin(), samples_f.begin() + length);
+        etl::rms<float> block_f;
+        block_f.add(etl::span<const float>(samples_f.data(), length));
+        CHECK_EQUAL(single_f.count(), block_f.count());
+        CHECK_CLOSE(single_f.get_rms(), block_f.get_rms(), 1e-4);
+
+        etl::rms<double> single_d(samples_d.begin(), samples_d.begin() + length);
+        etl::rms<double> block_d;
+        block_d.add(etl::span<const double>(samples_d.data(), length));
+        CHECK_CLOSE(single_d.get_rms(), block_d.get_rms(), 1e-9);
+
+        etl::rms<int16_t, int64_t> single_i16(samples_i16.begin(), samples_i16.begin() + length);
+        etl::rms<int16_t, int64_t> block_i16;
+        block_i16.add(etl::span<const int16_t>(samples_i16.data(), length));
+        CHECK_EQUAL(single_i16.get_rms(), block_i16.get_rms());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_rms_block_add_int16_long_block)
+    {
+      // Long enough for the vector partial sums to be widened.
+      std::vector<int16_t> samples(300001U, int16_t(-32768));
+      samples.back() = 32767;
+
+      etl::rms<int16_t, int64_t> single(samples.begin(), samples.end());
+      etl::rms<int16_t, int64_t> block;
+      block.add(etl::span<const int16_t>(samples.data(), samples.size()));
+
+      CHECK_EQUAL(single.get_rms(), block.get_rms());
+      CHECK_EQUAL(samples.size(), block.count());
+    }
   };
 }
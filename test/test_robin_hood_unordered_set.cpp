@@ -0,0 +1,444 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "unit_test_framework.h"
+
+#include <set>
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <random>
+#include <unordered_set>
+
+#include "data.h"
+
+#include "etl/robin_hood_unordered_set.h"
+
+namespace
+{
+  //*************************************************************************
+  // Every key collides.
+  struct constant_hash
+  {
+    size_t operator ()(int) const
+    {
+      return 42U;
+    }
+  };
+
+  typedef TestDataNDC<std::string> NDC;
+
+  //*************************************************************************
+  struct ndc_hash
+  {
+    size_t operator ()(const NDC& ndc) const
+    {
+      size_t hash = 0U;
+
+      for (size_t i = 0U; i < ndc.value.size(); ++i)
+      {
+        hash = (hash * 31U) + size_t(ndc.value[i]);
+      }
+
+      return hash;
+    }
+  };
+
+  //*************************************************************************
+  template <typename TSet, typename TCompare>
+  bool Check_Equal(const TSet& set, const TCompare& compare)
+  {
+    if (set.size() != compare.size())
+    {
+      return false;
+    }
+
+    size_t count = 0U;
+
+    for (typename TSet::const_iterator itr = set.begin(); itr != set.end(); ++itr)
+    {
+      if (compare.find(*itr) == compare.end())
+      {
+        return false;
+      }
+
+      ++count;
+    }
+
+    return count == compare.size();
+  }
+
+  SUITE(test_robin_hood_unordered_set)
+  {
+    static const size_t SIZE = 10;
+
+    typedef etl::robin_hood_unordered_set<NDC, SIZE, 32U, ndc_hash> DataNDC;
+    typedef etl::irobin_hood_unordered_set<NDC, ndc_hash>           IDataNDC;
+
+    typedef etl::robin_hood_unordered_set<int, SIZE> DataInt;
+
+    //*************************************************************************
+    std::vector<NDC> make_data(size_t first, size_t count)
+    {
+      std::vector<NDC> data;
+
+      for (size_t i = first; i < (first + count); ++i)
+      {
+        data.push_back(NDC(std::string("K") + std::to_string(i)));
+      }
+
+      return data;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      DataNDC data;
+
+      CHECK_EQUAL(0U, data.size());
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(32U, data.max_probe_length());
+      CHECK(data.begin() == data.end());
+
+      // The load is never more than 9/10.
+      CHECK(DataNDC::MAX_HOME_SLOTS >= (SIZE + (SIZE / 9U)));
+      CHECK(etl::is_power_of_2<DataNDC::MAX_HOME_SLOTS>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_constructor_range)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      std::set<NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(data.full());
+      CHECK(Check_Equal(data, compare));
+    }
+
+#if ETL_HAS_INITIALIZER_LIST
+    //*************************************************************************
+    TEST(test_constructor_initializer_list)
+    {
+      DataInt data = { 1, 2, 3 };
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(1U, data.count(1));
+      CHECK_EQUAL(1U, data.count(2));
+      CHECK_EQUAL(1U, data.count(3));
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_copy_constructor)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC data2(data);
+
+      CHECK(data2 == data);
+    }
+
+    //*************************************************************************
+    TEST(test_move_constructor)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      DataNDC data2(std::move(data));
+
+      std::set<NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK(Check_Equal(data2, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_assignment_interface)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2;
+
+      IDataNDC& idata1 = data1;
+      IDataNDC& idata2 = data2;
+
+      idata2 = idata1;
+
+      CHECK(data1 == data2);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value)
+    {
+      DataNDC data;
+
+      ETL_OR_STD::pair<DataNDC::iterator, bool> result = data.insert(NDC("A"));
+
+      CHECK(result.second);
+      CHECK_EQUAL(NDC("A"), *result.first);
+
+      // Duplicates are not inserted.
+      result = data.insert(NDC("A"));
+
+      CHECK(!result.second);
+      CHECK_EQUAL(NDC("A"), *result.first);
+      CHECK_EQUAL(1U, data.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_value_excess)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+
+      // An existing key is fine when full.
+      CHECK(!data.insert(initial_data[0]).second);
+
+      CHECK_THROW(data.insert(NDC("Excess")), etl::robin_hood_unordered_set_full);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_probe_length_exceeded)
+    {
+      etl::robin_hood_unordered_set<int, 20, 4U, constant_hash> data;
+
+      // Keys 0 to 4 occupy the home slot and the following 4 slots.
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK(data.insert(i).second);
+      }
+
+      CHECK_THROW(data.insert(5), etl::robin_hood_unordered_set_probe_length);
+      CHECK_EQUAL(5U, data.size());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_count_equal_range)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      const DataNDC data(initial_data.begin(), initial_data.end());
+
+      for (size_t i = 0U; i < initial_data.size(); ++i)
+      {
+        DataNDC::const_iterator itr = data.find(initial_data[i]);
+
+        CHECK(itr != data.end());
+        CHECK_EQUAL(initial_data[i], *itr);
+        CHECK_EQUAL(1U, data.count(initial_data[i]));
+
+        ETL_OR_STD::pair<DataNDC::const_iterator, DataNDC::const_iterator> range = data.equal_range(initial_data[i]);
+        CHECK(range.first == itr);
+        CHECK_EQUAL(1, std::distance(range.first, range.second));
+      }
+
+      CHECK(data.find(NDC("Missing")) == data.end());
+      CHECK_EQUAL(0U, data.count(NDC("Missing")));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_key)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::set<NDC> compare(initial_data.begin(), initial_data.end());
+
+      CHECK_EQUAL(1U, data.erase(NDC("K3")));
+      CHECK_EQUAL(0U, data.erase(NDC("K3")));
+      compare.erase(NDC("K3"));
+
+      CHECK(Check_Equal(data, compare));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::set<NDC> compare(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator itr = data.begin();
+      std::advance(itr, 4);
+
+      // The elements after the erased one are the same, even if shifted back.
+      std::set<NDC> following(itr, data.end());
+      following.erase(*itr);
+
+      compare.erase(*itr);
+
+      DataNDC::iterator iresult = data.erase(itr);
+
+      CHECK(Check_Equal(data, compare));
+      CHECK_EQUAL(following.size(), size_t(std::distance(iresult, data.end())));
+
+      for (; iresult != data.end(); ++iresult)
+      {
+        CHECK(following.find(*iresult) != following.end());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_range)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      DataNDC data(initial_data.begin(), initial_data.end());
+      std::set<NDC> compare(initial_data.begin(), initial_data.end());
+
+      DataNDC::iterator first = data.begin();
+      std::advance(first, 2);
+
+      DataNDC::iterator last = first;
+      std::advance(last, 5);
+
+      for (DataNDC::iterator itr = first; itr != last; ++itr)
+      {
+        compare.erase(*itr);
+      }
+
+      data.erase(first, last);
+
+      CHECK(Check_Equal(data, compare));
+
+      data.erase(data.begin(), data.end());
+      CHECK(data.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+
+      // Other tests may leave instances alive.
+      const size_t initial_count = NDC::get_instance_count();
+
+      {
+        DataNDC data(initial_data.begin(), initial_data.end());
+
+        data.clear();
+
+        CHECK(data.empty());
+        CHECK(data.begin() == data.end());
+
+        data.insert(initial_data.begin(), initial_data.end());
+        data.erase(initial_data[0]);
+      }
+
+      // Every element created by the container has been destroyed.
+      CHECK_EQUAL(initial_count, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_equal)
+    {
+      std::vector<NDC> initial_data = make_data(0U, SIZE);
+      std::vector<NDC> reversed_data(initial_data.rbegin(), initial_data.rend());
+      std::vector<NDC> different_data = make_data(5U, SIZE);
+
+      DataNDC data1(initial_data.begin(), initial_data.end());
+      DataNDC data2(reversed_data.begin(), reversed_data.end());
+      DataNDC data3(different_data.begin(), different_data.end());
+
+      CHECK(data1 == data2);
+      CHECK(!(data1 != data2));
+      CHECK(data1 != data3);
+    }
+
+    //*************************************************************************
+    TEST(test_colliding_hashes)
+    {
+      etl::robin_hood_unordered_set<int, 100, 100U, constant_hash> data;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        data.insert(i);
+      }
+
+      CHECK(data.full());
+
+      for (int i = 0; i < 100; i += 2)
+      {
+        CHECK_EQUAL(1U, data.erase(i));
+      }
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL((i % 2) == 0 ? 0U : 1U, data.count(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_random_insert_erase)
+    {
+      // Kept at about 90% full.
+      static const size_t Max = 200U;
+
+      etl::robin_hood_unordered_set<int, Max> data;
+      std::unordered_set<int> compare;
+
+      std::mt19937 generator(1234);
+      std::uniform_int_distribution<int> key_distribution(0, 250);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        const int key = key_distribution(generator);
+
+        if ((compare.size() < Max) && ((generator() % 4U) != 0U))
+        {
+          CHECK_EQUAL(compare.insert(key).second, data.insert(key).second);
+        }
+        else
+        {
+          CHECK_EQUAL(compare.erase(key), data.erase(key));
+        }
+      }
+
+      CHECK(compare.size() >= ((Max * 9U) / 10U));
+      CHECK(Check_Equal(data, compare));
+      CHECK_EQUAL(compare.size(), size_t(std::distance(data.begin(), data.end())));
+    }
+  };
+}
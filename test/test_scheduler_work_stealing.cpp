@@ -0,0 +1,253 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/scheduler_work_stealing.h"
+#include "etl/function.h"
+
+#if ETL_HAS_ATOMIC
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority_, int work_)
+      : task(priority_)
+      , work(work_)
+      , processing(0)
+      , overlapped(false)
+      , last_worker(~size_t(0))
+      , p_worker(nullptr)
+    {
+    }
+
+    uint32_t task_request_work() const override
+    {
+      return uint32_t(work.load());
+    }
+
+    void task_process_work() override
+    {
+      // Check that no other worker is processing this task.
+      if (++processing != 1)
+      {
+        overlapped = true;
+      }
+
+      if (p_worker != nullptr)
+      {
+        last_worker = *p_worker;
+      }
+
+      --work;
+      --processing;
+    }
+
+    std::atomic<int>  work;
+    std::atomic<int>  processing;
+    std::atomic<bool> overlapped;
+    size_t            last_worker;
+    const size_t*     p_worker;
+  };
+
+  //***************************************************************************
+  struct Idle : public etl::ifunction<size_t>
+  {
+    Idle()
+      : idle_count(0)
+    {
+    }
+
+    void operator()(size_t) const override
+    {
+      ++idle_count;
+    }
+
+    mutable std::atomic<int> idle_count;
+  };
+
+  SUITE(test_scheduler_work_stealing)
+  {
+    //*************************************************************************
+    TEST(test_owner_runs_highest_priority_thief_steals_lowest)
+    {
+      etl::scheduler_work_stealing<3, 2> scheduler;
+
+      size_t current_worker = 0U;
+
+      Task low(1, 1);
+      Task middle(2, 1);
+      Task high(3, 1);
+
+      low.p_worker    = &current_worker;
+      middle.p_worker = &current_worker;
+      high.p_worker   = &current_worker;
+
+      // All of the tasks belong to worker 0.
+      scheduler.add_task(low, 0U);
+      scheduler.add_task(high, 0U);
+      scheduler.add_task(middle, 0U);
+
+      CHECK_EQUAL(3U, scheduler.size());
+
+      current_worker = 0U;
+      CHECK(!scheduler.schedule(0U));
+      CHECK_EQUAL(0, high.work.load());
+      CHECK_EQUAL(0U, high.last_worker);
+
+      // Worker 1 has no tasks of its own, so steals the lowest priority task.
+      current_worker = 1U;
+      CHECK(!scheduler.schedule(1U));
+      CHECK_EQUAL(0, low.work.load());
+      CHECK_EQUAL(1U, low.last_worker);
+
+      current_worker = 0U;
+      CHECK(!scheduler.schedule(0U));
+      CHECK_EQUAL(0, middle.work.load());
+      CHECK_EQUAL(0U, middle.last_worker);
+
+      // Nothing left to do.
+      CHECK(scheduler.schedule(0U));
+      CHECK(scheduler.schedule(1U));
+    }
+
+    //*************************************************************************
+    TEST(test_idle_and_watchdog_callbacks)
+    {
+      etl::scheduler_work_stealing<1, 2> scheduler;
+
+      Task task(1, 1);
+      scheduler.add_task(task, 1U);
+
+      Idle idle;
+      Idle watchdog;
+
+      scheduler.set_idle_callback(idle);
+      scheduler.set_watchdog_callback(watchdog);
+
+      CHECK(scheduler.schedule(0U)); // Worker 1 has not queued its task yet.
+      CHECK(!scheduler.schedule(1U));
+      CHECK(scheduler.schedule(1U));
+
+      CHECK_EQUAL(2, idle.idle_count.load());
+      CHECK_EQUAL(3, watchdog.idle_count.load());
+    }
+
+    //*************************************************************************
+    TEST(test_too_many_tasks_and_invalid_worker)
+    {
+      etl::scheduler_work_stealing<1, 2> scheduler;
+
+      Task task1(1, 1);
+      Task task2(1, 1);
+
+      CHECK_THROW(scheduler.add_task(task1, 2U), etl::scheduler_invalid_worker_exception);
+      scheduler.add_task(task1, 1U);
+      CHECK_THROW(scheduler.add_task(task2, 0U), etl::scheduler_too_many_tasks_exception);
+    }
+
+    //*************************************************************************
+    TEST(test_workers_share_the_work)
+    {
+      static const size_t Workers = 4U;
+      static const size_t Tasks   = 8U;
+      static const int    Work    = 500;
+
+      etl::scheduler_work_stealing<Tasks, Workers> scheduler;
+
+      std::vector<Task*> tasks;
+
+      for (size_t i = 0U; i < Tasks; ++i)
+      {
+        tasks.push_back(new Task(etl::task_priority_t(i), Work));
+
+        // All of the tasks start on worker 0.
+        scheduler.add_task(*tasks.back(), 0U);
+      }
+
+      struct Exit : public etl::ifunction<size_t>
+      {
+        Exit(etl::scheduler_work_stealing<Tasks, Workers>& scheduler_, std::vector<Task*>& tasks_)
+          : scheduler(scheduler_)
+          , tasks(tasks_)
+        {
+        }
+
+        void operator()(size_t) const override
+        {
+          for (size_t i = 0U; i < tasks.size(); ++i)
+          {
+            if (tasks[i]->work.load() != 0)
+            {
+              std::this_thread::yield();
+              return;
+            }
+          }
+
+          scheduler.exit_scheduler();
+        }
+
+        etl::scheduler_work_stealing<Tasks, Workers>& scheduler;
+        std::vector<Task*>& tasks;
+      };
+
+      Exit exit_callback(scheduler, tasks);
+      scheduler.set_idle_callback(exit_callback);
+
+      std::vector<std::thread> threads;
+
+      for (size_t w = 0U; w < Workers; ++w)
+      {
+        threads.push_back(std::thread([&scheduler, w]() { scheduler.start(w); }));
+      }
+
+      for (size_t w = 0U; w < Workers; ++w)
+      {
+        threads[w].join();
+      }
+
+      for (size_t i = 0U; i < Tasks; ++i)
+      {
+        CHECK_EQUAL(0, tasks[i]->work.load());
+        CHECK(!tasks[i]->overlapped.load());
+        delete tasks[i];
+      }
+    }
+  }
+}
+
+#endif
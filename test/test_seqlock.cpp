@@ -0,0 +1,150 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/seqlock.h"
+
+#include <thread>
+#include <atomic>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  // Each field is derived from the first, so a torn read can be detected.
+  struct Config
+  {
+    uint32_t version;
+    uint32_t gain;
+    uint16_t offset;
+    uint8_t  flags;
+  };
+
+  Config make_config(uint32_t version)
+  {
+    Config config;
+    config.version = version;
+    config.gain    = version * 3U;
+    config.offset  = uint16_t(version + 7U);
+    config.flags   = uint8_t(version & 0xFFU);
+
+    return config;
+  }
+
+  bool is_consistent(const Config& config)
+  {
+    return (config.gain   == config.version * 3U) &&
+           (config.offset == uint16_t(config.version + 7U)) &&
+           (config.flags  == uint8_t(config.version & 0xFFU));
+  }
+
+  SUITE(test_seqlock)
+  {
+    //*************************************************************************
+    TEST(test_constructors)
+    {
+      etl::seqlock<uint64_t> lock1;
+      etl::seqlock<Config>   lock2(make_config(5U));
+
+      CHECK_EQUAL(0U, lock1.read());
+      CHECK_EQUAL(0U, lock1.get_sequence());
+      CHECK_EQUAL(5U, lock2.read().version);
+      CHECK(is_consistent(lock2.read()));
+    }
+
+    //*************************************************************************
+    TEST(test_write_read)
+    {
+      etl::seqlock<Config> lock;
+
+      lock.write(make_config(1U));
+      CHECK_EQUAL(2U, lock.get_sequence());
+
+      lock.write(make_config(2U));
+      CHECK_EQUAL(4U, lock.get_sequence());
+
+      Config config;
+      CHECK(lock.try_read(config));
+      CHECK_EQUAL(2U, config.version);
+      CHECK(is_consistent(config));
+
+      lock.read(config);
+      CHECK_EQUAL(2U, config.version);
+    }
+
+    //*************************************************************************
+    TEST(test_readers_never_see_a_torn_value)
+    {
+      static const uint32_t Writes = 100000U;
+
+      etl::seqlock<Config> lock(make_config(0U));
+      std::atomic<bool>    done(false);
+      std::atomic<bool>    consistent(true);
+
+      std::thread readers[3];
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        readers[i] = std::thread([&]()
+        {
+          uint32_t last_version = 0U;
+
+          while (!done.load())
+          {
+            const Config config = lock.read();
+
+            if (!is_consistent(config) || (config.version < last_version))
+            {
+              consistent.store(false);
+            }
+
+            last_version = config.version;
+          }
+        });
+      }
+
+      for (uint32_t version = 1U; version <= Writes; ++version)
+      {
+        lock.write(make_config(version));
+      }
+
+      done.store(true);
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        readers[i].join();
+      }
+
+      CHECK(consistent.load());
+      CHECK_EQUAL(Writes, lock.read().version);
+    }
+  }
+}
+
+#endif
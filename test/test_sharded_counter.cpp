@@ -0,0 +1,133 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/sharded_counter.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  SUITE(test_sharded_counter)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::sharded_counter<4> counter;
+
+      CHECK_EQUAL(4U, counter.size());
+      CHECK_EQUAL(0U, counter.load());
+
+      for (size_t i = 0U; i < counter.size(); ++i)
+      {
+        CHECK_EQUAL(0U, counter.load(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_and_load)
+    {
+      etl::sharded_counter<4, uint64_t> counter;
+
+      counter.increment(0);
+      counter.increment(1);
+      counter.add(1, 10U);
+      counter.add(3, 100U);
+
+      CHECK_EQUAL(1U,   counter.load(0));
+      CHECK_EQUAL(11U,  counter.load(1));
+      CHECK_EQUAL(0U,   counter.load(2));
+      CHECK_EQUAL(100U, counter.load(3));
+      CHECK_EQUAL(112U, counter.load());
+    }
+
+    //*************************************************************************
+    TEST(test_reset_and_exchange_zero)
+    {
+      etl::sharded_counter<3> counter;
+
+      counter.add(0, 5U);
+      counter.add(2, 7U);
+
+      CHECK_EQUAL(12U, counter.exchange_zero());
+      CHECK_EQUAL(0U,  counter.load());
+
+      counter.add(1, 3U);
+      counter.reset();
+
+      CHECK_EQUAL(0U, counter.load());
+    }
+
+    //*************************************************************************
+    TEST(test_shards_do_not_share_a_cache_line)
+    {
+      typedef etl::sharded_counter<4> Counter;
+
+      CHECK(sizeof(Counter) >= (4U * ETL_HARDWARE_DESTRUCTIVE_INTERFERENCE_SIZE));
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_increments)
+    {
+      const size_t Threads    = 4U;
+      const size_t Increments = 100000U;
+
+      etl::sharded_counter<Threads> counter;
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&counter, t, Increments]()
+        {
+          for (size_t i = 0U; i < Increments; ++i)
+          {
+            counter.increment(t);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      CHECK_EQUAL(Threads * Increments, counter.load());
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        CHECK_EQUAL(Increments, counter.load(t));
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,161 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/sharded_histogram.h"
+
+#include <thread>
+#include <vector>
+
+#if ETL_HAS_ATOMIC
+
+namespace
+{
+  typedef etl::sharded_histogram<int32_t, uint32_t, 10, 4> Histogram;
+  typedef etl::histogram<int32_t, uint32_t, 10>           Result;
+
+  SUITE(test_sharded_histogram)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Histogram histogram(-4);
+
+      CHECK_EQUAL(10U, histogram.size());
+      CHECK_EQUAL(-4,  histogram.get_start_index());
+      CHECK_EQUAL(0U,  histogram.count());
+
+      for (size_t i = 0U; i < histogram.size(); ++i)
+      {
+        CHECK_EQUAL(0U, histogram[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_add_to_shards)
+    {
+      Histogram histogram(-4);
+
+      histogram.add(0, -4);
+      histogram.add(1, -4);
+      histogram.add(2, 0);
+      histogram.add(3, 5);
+      histogram.add(3, 5);
+      histogram.add(3, 5);
+
+      // Indexes are the key less the start index.
+      CHECK_EQUAL(2U, histogram[0]);
+      CHECK_EQUAL(1U, histogram[4]);
+      CHECK_EQUAL(3U, histogram[9]);
+      CHECK_EQUAL(0U, histogram[5]);
+      CHECK_EQUAL(6U, histogram.count());
+
+      histogram.clear();
+
+      CHECK_EQUAL(0U, histogram.count());
+    }
+
+    //*************************************************************************
+    TEST(test_merge_into)
+    {
+      Histogram histogram(-4);
+      Result    result(-4);
+
+      result.add(1);
+
+      histogram.add(0, 1);
+      histogram.add(1, 1);
+      histogram.add(2, -3);
+
+      histogram.merge_into(result);
+
+      CHECK_EQUAL(3U, result[5]);
+      CHECK_EQUAL(1U, result[1]);
+      CHECK_EQUAL(0U, result[4]);
+      CHECK_EQUAL(4U, result.count());
+    }
+
+    //*************************************************************************
+    TEST(test_load)
+    {
+      Histogram histogram(-4);
+
+      histogram.add(0, 2);
+      histogram.add(3, 2);
+      histogram.add(1, 0);
+
+      Result result = histogram.load();
+
+      CHECK_EQUAL(2U, result[6]);
+      CHECK_EQUAL(1U, result[4]);
+      CHECK_EQUAL(3U, result.count());
+
+      // The start index is kept.
+      result.add(-4);
+      CHECK_EQUAL(1U, result[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_add)
+    {
+      const size_t Threads = 4U;
+      const size_t Adds    = 50000U;
+
+      Histogram histogram(-4);
+      std::vector<std::thread> threads;
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads.push_back(std::thread([&histogram, t, Adds]()
+        {
+          for (size_t i = 0U; i < Adds; ++i)
+          {
+            histogram.add(t, int32_t(i % 10U) - 4);
+          }
+        }));
+      }
+
+      for (size_t t = 0U; t < Threads; ++t)
+      {
+        threads[t].join();
+      }
+
+      Result result = histogram.load();
+
+      CHECK_EQUAL(Threads * Adds, result.count());
+
+      for (size_t i = 0U; i < result.size(); ++i)
+      {
+        CHECK_EQUAL((Threads * Adds) / 10U, result[i]);
+      }
+    }
+  }
+}
+
+#endif
@@ -300,5 +300,121 @@ namespace
         CHECK_EQUAL(std::string("reference_counted_message_pool:release failure"), std::string(e.what()));
       }
     }
+
+    //*************************************************************************
+    TEST(test_borrow_references)
+    {
+      etl::shared_message sm1(message_pool, Message1(1));
+
+      sm1.borrow_references(3U);
+      CHECK_EQUAL(4, sm1.get_reference_count());
+
+      {
+        etl::shared_message sm2 = sm1.borrowed_copy();
+        etl::shared_message sm3 = sm1.borrowed_copy();
+        etl::shared_message sm4 = sm1.borrowed_copy();
+
+        CHECK_EQUAL(4, sm1.get_reference_count());
+        CHECK(&sm2.get_message() == &sm1.get_message());
+        CHECK(&sm4.get_message() == &sm3.get_message());
+      }
+
+      CHECK_EQUAL(1, sm1.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_atomic_reference_counter)
+    {
+      etl::reference_counter<etl::atomic_int32_t> counter;
+
+      counter.set_reference_count(1);
+      counter.increment_reference_count();
+      counter.add_reference_count(3);
+      CHECK_EQUAL(5, counter.get_reference_count());
+
+      CHECK_EQUAL(4, counter.decrement_reference_count());
+      CHECK_EQUAL(4, counter.get_reference_count());
+    }
+
+    //*************************************************************************
+    TEST(test_release_batch)
+    {
+      using pool_message_parameters = etl::atomic_counted_message_pool::pool_message_parameters<Message1, Message2>;
+
+      etl::fixed_sized_memory_block_allocator<pool_message_parameters::max_size,
+                                              pool_message_parameters::max_alignment,
+                                              4U> memory_allocator;
+
+      // Counts the number of times that the pool is locked.
+      struct CountingPool : public etl::atomic_counted_message_pool
+      {
+        CountingPool(etl::imemory_block_allocator& allocator)
+          : etl::atomic_counted_message_pool(allocator)
+          , lock_count(0)
+        {
+        }
+
+        void lock() override
+        {
+          ++lock_count;
+        }
+
+        int lock_count;
+      };
+
+      CountingPool pool(memory_allocator);
+
+      {
+        etl::shared_message_release_batch<3U> batch(pool);
+
+        etl::shared_message sm1(pool, Message1(1));
+        etl::shared_message sm2(pool, Message1(2));
+        etl::shared_message sm3(pool, Message2());
+        etl::shared_message sm4(pool, Message1(4));
+        etl::shared_message sm3_copy(sm3);
+
+        CHECK_EQUAL(4, pool.lock_count);
+        pool.lock_count = 0;
+
+        batch.release(sm1);
+        batch.release(sm2);
+        batch.release(sm3); // Still referenced by sm3_copy.
+        CHECK(!sm1.is_valid());
+        CHECK(!sm3.is_valid());
+        CHECK_EQUAL(2U, batch.size());
+        CHECK_EQUAL(0, pool.lock_count);
+
+        batch.release(sm3_copy);
+        CHECK_EQUAL(3U, batch.size());
+
+        // The batch is full, so the first three are returned together.
+        batch.release(sm4);
+        CHECK_EQUAL(1U, batch.size());
+        CHECK_EQUAL(1, pool.lock_count);
+
+        // Releasing an invalid shared message does nothing.
+        batch.release(sm1);
+        CHECK_EQUAL(1U, batch.size());
+      }
+
+      // The destructor returned the last one.
+      CHECK_EQUAL(2, pool.lock_count);
+
+      // All of the memory is available again.
+      etl::shared_message sm1(pool, Message1(1));
+      etl::shared_message sm2(pool, Message1(2));
+      etl::shared_message sm3(pool, Message1(3));
+      etl::shared_message sm4(pool, Message1(4));
+
+      CHECK(sm4.is_valid());
+
+      etl::shared_message_release_batch<4U> batch(pool);
+      batch.release(sm1);
+      batch.release(sm2);
+      batch.release(sm3);
+      batch.release(sm4);
+      batch.flush();
+      CHECK(batch.empty());
+    }
   }
 }
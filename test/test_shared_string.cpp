@@ -0,0 +1,252 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/shared_string.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  using Pool = etl::shared_string_pool<16U, 4U>;
+
+  SUITE(test_shared_string)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Pool pool;
+
+      etl::shared_string empty(pool);
+      etl::shared_string from_pointer(pool, "Hello");
+      etl::shared_string from_view(pool, etl::string_view("World"));
+      etl::shared_string from_string(pool, etl::string<8>("Text"));
+
+      CHECK_EQUAL(4U, pool.size());
+      CHECK(pool.full());
+      CHECK_EQUAL(16U, Pool::Capacity);
+      CHECK_EQUAL(4U, Pool::Size);
+
+      CHECK(empty.is_valid());
+      CHECK(empty.empty());
+      CHECK_EQUAL(16U, empty.capacity());
+      CHECK_EQUAL(std::string("Hello"), std::string(from_pointer.c_str()));
+      CHECK(from_view == etl::string_view("World"));
+      CHECK(from_string == etl::string_view("Text"));
+      CHECK_EQUAL(4U, from_string.size());
+      CHECK_EQUAL('T', from_string[0]);
+      CHECK_EQUAL(1, from_pointer.use_count());
+      CHECK(from_pointer.is_unique());
+    }
+
+    //*************************************************************************
+    TEST(test_allocation_failure)
+    {
+      etl::shared_string_pool<16U, 1U> pool;
+
+      etl::shared_string text(pool, "Hello");
+
+      CHECK_THROW(etl::shared_string(pool, "World"), etl::shared_string_allocation_failure);
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copies_share_payload)
+    {
+      Pool pool;
+
+      etl::shared_string original(pool, "Shared");
+
+      {
+        etl::shared_string copy1(original);
+        etl::shared_string copy2(pool);
+
+        copy2 = original;
+
+        CHECK_EQUAL(1U, pool.size());
+        CHECK_EQUAL(3, original.use_count());
+        CHECK(copy1.shares_with(original));
+        CHECK(copy2.shares_with(original));
+        CHECK(copy1.data() == original.data());
+        CHECK(copy1 == original);
+        CHECK(!original.is_unique());
+      }
+
+      CHECK_EQUAL(1, original.use_count());
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_move)
+    {
+      Pool pool;
+
+      etl::shared_string original(pool, "Moved");
+      etl::shared_string moved(etl::move(original));
+
+      CHECK(!original.is_valid());
+      CHECK_EQUAL(0, original.use_count());
+      CHECK(moved == etl::string_view("Moved"));
+      CHECK_EQUAL(1, moved.use_count());
+
+      etl::shared_string other(pool, "Other");
+      other = etl::move(moved);
+
+      CHECK(!moved.is_valid());
+      CHECK(other == etl::string_view("Moved"));
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_on_write)
+    {
+      Pool pool;
+
+      etl::shared_string original(pool, "Hello");
+      etl::shared_string copy(original);
+
+      copy.edit().append(" World");
+
+      CHECK_EQUAL(2U, pool.size());
+      CHECK(!copy.shares_with(original));
+      CHECK(original == etl::string_view("Hello"));
+      CHECK(copy == etl::string_view("Hello World"));
+      CHECK(copy != original);
+      CHECK(original.is_unique());
+      CHECK(copy.is_unique());
+
+      // A unique string is changed in place.
+      const char* p = copy.data();
+      copy.edit()[0] = 'J';
+
+      CHECK(copy.data() == p);
+      CHECK(copy == etl::string_view("Jello World"));
+      CHECK_EQUAL(2U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_overwrite)
+    {
+      Pool pool;
+
+      etl::shared_string original(pool, "Hello");
+      etl::shared_string copy(original);
+
+      copy.overwrite().assign("New");
+
+      CHECK(original == etl::string_view("Hello"));
+      CHECK(copy == etl::string_view("New"));
+      CHECK_EQUAL(2U, pool.size());
+
+      copy.overwrite().assign("Again");
+      CHECK(copy == etl::string_view("Again"));
+      CHECK_EQUAL(2U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_make_unique_with_full_pool)
+    {
+      etl::shared_string_pool<16U, 1U> pool;
+
+      etl::shared_string original(pool, "Hello");
+      etl::shared_string copy(original);
+
+      CHECK(!copy.make_unique());
+      CHECK(copy.shares_with(original));
+      CHECK_THROW(copy.edit(), etl::shared_string_allocation_failure);
+      CHECK(original == etl::string_view("Hello"));
+
+      // Once the copy has gone, no allocation is needed.
+      {
+        etl::shared_string last(etl::move(copy));
+      }
+
+      CHECK(original.make_unique());
+    }
+
+    //*************************************************************************
+    TEST(test_last_copy_releases)
+    {
+      Pool pool;
+
+      {
+        etl::shared_string a(pool, "One");
+        etl::shared_string b(pool, "Two");
+
+        a = b;
+
+        CHECK_EQUAL(1U, pool.size());
+        CHECK(a == etl::string_view("Two"));
+      }
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_fan_out_between_threads)
+    {
+      etl::atomic_shared_string_pool<32U, 2U> pool;
+
+      etl::shared_string source(pool, "Fan out");
+
+      std::vector<std::thread> consumers;
+      std::vector<size_t>      lengths(4U, 0U);
+
+      for (size_t i = 0U; i < lengths.size(); ++i)
+      {
+        etl::shared_string copy(source);
+
+        consumers.emplace_back([copy, &lengths, i]()
+        {
+          for (int j = 0; j < 1000; ++j)
+          {
+            etl::shared_string local(copy);
+            lengths[i] += local.size();
+          }
+        });
+      }
+
+      for (std::thread& consumer : consumers)
+      {
+        consumer.join();
+      }
+
+      for (size_t length : lengths)
+      {
+        CHECK_EQUAL(7000U, length);
+      }
+
+      CHECK_EQUAL(1, source.use_count());
+      CHECK_EQUAL(1U, pool.size());
+    }
+  }
+}
@@ -0,0 +1,340 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/size_class_memory_block_allocator.h"
+#include "etl/reference_counted_message_pool.h"
+#include "etl/message.h"
+
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+  // Classes of 16, 32, 64 and 128 bytes, 4 blocks each.
+  using Allocator = etl::size_class_memory_block_allocator<16U, 128U, alignof(uint32_t), 4U>;
+
+  //*************************************************************************
+  struct SmallMessage : public etl::message<1>
+  {
+    SmallMessage(char c_)
+      : c(c_)
+    {
+    }
+
+    char c;
+  };
+
+  //*************************************************************************
+  struct LargeMessage : public etl::message<2>
+  {
+    LargeMessage(char c_)
+      : c(c_)
+    {
+      data[0] = c_;
+    }
+
+    char c;
+    char data[80];
+  };
+
+  SUITE(test_size_class_memory_block_allocator)
+  {
+    //*************************************************************************
+    TEST(test_constants)
+    {
+      CHECK_EQUAL(16U,  Allocator::Min_Block_Size);
+      CHECK_EQUAL(128U, Allocator::Max_Block_Size);
+      CHECK_EQUAL(4U,   Allocator::Number_Of_Classes);
+      CHECK_EQUAL(4U,   Allocator::Blocks_Per_Class);
+
+      CHECK_EQUAL(16U,  Allocator::class_block_size(0U));
+      CHECK_EQUAL(32U,  Allocator::class_block_size(1U));
+      CHECK_EQUAL(64U,  Allocator::class_block_size(2U));
+      CHECK_EQUAL(128U, Allocator::class_block_size(3U));
+    }
+
+    //*************************************************************************
+    TEST(test_class_index)
+    {
+      CHECK_EQUAL(0U, Allocator::class_index(0U));
+      CHECK_EQUAL(0U, Allocator::class_index(1U));
+      CHECK_EQUAL(0U, Allocator::class_index(16U));
+      CHECK_EQUAL(1U, Allocator::class_index(17U));
+      CHECK_EQUAL(1U, Allocator::class_index(32U));
+      CHECK_EQUAL(2U, Allocator::class_index(33U));
+      CHECK_EQUAL(2U, Allocator::class_index(64U));
+      CHECK_EQUAL(3U, Allocator::class_index(65U));
+      CHECK_EQUAL(3U, Allocator::class_index(128U));
+      CHECK_EQUAL(Allocator::Number_Of_Classes, Allocator::class_index(129U));
+      CHECK_EQUAL(Allocator::Number_Of_Classes, Allocator::class_index(100000U));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_from_matching_class)
+    {
+      Allocator allocator;
+
+      void* p8   = allocator.allocate(8U,   1U);
+      void* p24  = allocator.allocate(24U,  1U);
+      void* p64  = allocator.allocate(64U,  1U);
+      void* p100 = allocator.allocate(100U, 1U);
+
+      CHECK(p8   != nullptr);
+      CHECK(p24  != nullptr);
+      CHECK(p64  != nullptr);
+      CHECK(p100 != nullptr);
+
+      CHECK_EQUAL(1U, allocator.allocated(0U));
+      CHECK_EQUAL(1U, allocator.allocated(1U));
+      CHECK_EQUAL(1U, allocator.allocated(2U));
+      CHECK_EQUAL(1U, allocator.allocated(3U));
+
+      CHECK_EQUAL(3U, allocator.available(0U));
+      CHECK_EQUAL(3U, allocator.available(3U));
+
+      CHECK(allocator.is_owner_of(p8));
+      CHECK(allocator.is_owner_of(p24));
+      CHECK(allocator.is_owner_of(p64));
+      CHECK(allocator.is_owner_of(p100));
+
+      CHECK_EQUAL(0U, uintptr_t(p8)   % alignof(uint32_t));
+      CHECK_EQUAL(0U, uintptr_t(p24)  % alignof(uint32_t));
+      CHECK_EQUAL(0U, uintptr_t(p64)  % alignof(uint32_t));
+      CHECK_EQUAL(0U, uintptr_t(p100) % alignof(uint32_t));
+
+      // The whole block may be written.
+      memset(p8,   0x11, 16U);
+      memset(p24,  0x22, 32U);
+      memset(p64,  0x33, 64U);
+      memset(p100, 0x44, 128U);
+
+      CHECK(allocator.release(p8));
+      CHECK(allocator.release(p24));
+      CHECK(allocator.release(p64));
+      CHECK(allocator.release(p100));
+
+      CHECK_EQUAL(0U, allocator.allocated(0U));
+      CHECK_EQUAL(0U, allocator.allocated(1U));
+      CHECK_EQUAL(0U, allocator.allocated(2U));
+      CHECK_EQUAL(0U, allocator.allocated(3U));
+    }
+
+    //*************************************************************************
+    TEST(test_blocks_are_distinct)
+    {
+      Allocator allocator;
+
+      char* blocks[Allocator::Number_Of_Classes * Allocator::Blocks_Per_Class];
+      size_t n = 0U;
+
+      for (size_t index = 0U; index < Allocator::Number_Of_Classes; ++index)
+      {
+        for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+        {
+          const size_t block_size = Allocator::class_block_size(index);
+          blocks[n] = static_cast<char*>(allocator.allocate(block_size, 1U));
+          CHECK(blocks[n] != nullptr);
+          memset(blocks[n], int(n), block_size);
+          ++n;
+        }
+      }
+
+      // No block has been overwritten by another.
+      n = 0U;
+
+      for (size_t index = 0U; index < Allocator::Number_Of_Classes; ++index)
+      {
+        for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+        {
+          const size_t block_size = Allocator::class_block_size(index);
+
+          for (size_t j = 0U; j < block_size; ++j)
+          {
+            CHECK_EQUAL(int(n), int(blocks[n][j]));
+          }
+
+          ++n;
+        }
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        CHECK(allocator.release(blocks[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_falls_back_to_larger_class)
+    {
+      Allocator allocator;
+
+      void* small[Allocator::Blocks_Per_Class];
+
+      for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+      {
+        small[i] = allocator.allocate(16U, 1U);
+      }
+
+      CHECK_EQUAL(0U, allocator.available(0U));
+
+      void* p = allocator.allocate(16U, 1U);
+      CHECK(p != nullptr);
+      CHECK_EQUAL(1U, allocator.allocated(1U));
+
+      // Released to the class it was taken from.
+      CHECK(allocator.release(p));
+      CHECK_EQUAL(0U, allocator.allocated(1U));
+      CHECK_EQUAL(0U, allocator.available(0U));
+
+      for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+      {
+        CHECK(allocator.release(small[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_failures)
+    {
+      Allocator allocator;
+
+      // Too large.
+      CHECK(allocator.allocate(129U, 1U) == nullptr);
+
+      // Over aligned.
+      CHECK(allocator.allocate(16U, 2U * alignof(uint32_t)) == nullptr);
+
+      // Exhaust the largest class.
+      void* large[Allocator::Blocks_Per_Class];
+
+      for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+      {
+        large[i] = allocator.allocate(128U, 1U);
+        CHECK(large[i] != nullptr);
+      }
+
+      CHECK(allocator.allocate(128U, 1U) == nullptr);
+
+      for (size_t i = 0U; i < Allocator::Blocks_Per_Class; ++i)
+      {
+        CHECK(allocator.release(large[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_release_reuses_block)
+    {
+      Allocator allocator;
+
+      void* p1 = allocator.allocate(40U, 1U);
+      void* p2 = allocator.allocate(40U, 1U);
+
+      CHECK(allocator.release(p1));
+
+      void* p3 = allocator.allocate(50U, 1U);
+      CHECK(p3 == p1);
+
+      CHECK(allocator.release(p2));
+      CHECK(allocator.release(p3));
+      CHECK_EQUAL(0U, allocator.allocated(2U));
+    }
+
+    //*************************************************************************
+    TEST(test_not_owner)
+    {
+      Allocator allocator;
+
+      int i = 0;
+
+      CHECK(!allocator.is_owner_of(&i));
+      CHECK(!allocator.release(&i));
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      Allocator allocator1;
+      Allocator allocator2;
+
+      allocator1.set_successor(allocator2);
+
+      void* blocks[Allocator::Blocks_Per_Class + 1U];
+
+      for (size_t i = 0U; i < (Allocator::Blocks_Per_Class + 1U); ++i)
+      {
+        blocks[i] = allocator1.allocate(128U, 1U);
+        CHECK(blocks[i] != nullptr);
+      }
+
+      CHECK_EQUAL(Allocator::Blocks_Per_Class, allocator1.allocated(3U));
+      CHECK_EQUAL(1U, allocator2.allocated(3U));
+
+      CHECK(allocator2.is_owner_of(blocks[Allocator::Blocks_Per_Class]));
+
+      for (size_t i = 0U; i < (Allocator::Blocks_Per_Class + 1U); ++i)
+      {
+        CHECK(allocator1.release(blocks[i]));
+      }
+
+      CHECK_EQUAL(0U, allocator1.allocated(3U));
+      CHECK_EQUAL(0U, allocator2.allocated(3U));
+    }
+
+    //*************************************************************************
+    TEST(test_reference_counted_message_pool)
+    {
+      using rcm_small_t = etl::reference_counted_message<SmallMessage, int>;
+      using rcm_large_t = etl::reference_counted_message<LargeMessage, int>;
+
+      using MessageAllocator = etl::size_class_memory_block_allocator<32U, 256U, alignof(rcm_large_t), 2U>;
+
+      MessageAllocator allocator;
+      etl::reference_counted_message_pool<int> message_pool(allocator);
+
+      rcm_small_t* psmall = message_pool.allocate(SmallMessage('S'));
+      rcm_large_t* plarge = message_pool.allocate(LargeMessage('L'));
+
+      CHECK(psmall != nullptr);
+      CHECK(plarge != nullptr);
+
+      CHECK_EQUAL(1U, allocator.allocated(MessageAllocator::class_index(sizeof(rcm_small_t))));
+      CHECK_EQUAL(1U, allocator.allocated(MessageAllocator::class_index(sizeof(rcm_large_t))));
+      CHECK(MessageAllocator::class_index(sizeof(rcm_small_t)) < MessageAllocator::class_index(sizeof(rcm_large_t)));
+
+      CHECK_EQUAL('S', psmall->get_message().c);
+      CHECK_EQUAL('L', plarge->get_message().c);
+
+      message_pool.release(*psmall);
+      message_pool.release(*plarge);
+
+      CHECK_EQUAL(0U, allocator.allocated(MessageAllocator::class_index(sizeof(rcm_small_t))));
+      CHECK_EQUAL(0U, allocator.allocated(MessageAllocator::class_index(sizeof(rcm_large_t))));
+    }
+  }
+}
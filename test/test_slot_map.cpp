@@ -0,0 +1,273 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/slot_map.h"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "data.h"
+
+namespace
+{
+  static const size_t SIZE = 8U;
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef etl::slot_map<NDC, SIZE> Data;
+  typedef etl::islot_map<NDC>      IData;
+  typedef Data::handle_type        Handle;
+
+  SUITE(test_slot_map)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK(data.begin() == data.end());
+      CHECK(!data.contains(Handle()));
+      CHECK(data.get(Handle()) == ETL_NULLPTR);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_and_lookup)
+    {
+      Data data;
+
+      Handle h1 = data.insert(NDC("1"));
+      Handle h2 = data.emplace("2");
+      Handle h3 = data.insert(NDC("3"));
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK(h1 != h2);
+      CHECK(data.contains(h1));
+      CHECK_EQUAL(std::string("1"), data[h1].value);
+      CHECK_EQUAL(std::string("2"), data.at(h2).value);
+      CHECK_EQUAL(std::string("3"), data.get(h3)->value);
+
+      const IData& idata = data;
+      CHECK_EQUAL(std::string("2"), idata[h2].value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.insert(NDC("x"));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.insert(NDC("y")), etl::slot_map_full);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_invalidates_handle)
+    {
+      Data data;
+
+      Handle h1 = data.insert(NDC("1"));
+      Handle h2 = data.insert(NDC("2"));
+
+      CHECK(data.erase(h1));
+      CHECK(!data.contains(h1));
+      CHECK(!data.erase(h1));
+      CHECK(data.get(h1) == ETL_NULLPTR);
+      CHECK_THROW(data.at(h1), etl::slot_map_invalid_handle);
+
+      // The erased slot is reused, but the old handle still does not match.
+      Handle h3 = data.insert(NDC("3"));
+
+      CHECK(h3 != h1);
+      CHECK(!data.contains(h1));
+      CHECK_EQUAL(std::string("2"), data[h2].value);
+      CHECK_EQUAL(std::string("3"), data[h3].value);
+    }
+
+    //*************************************************************************
+    TEST(test_dense_iteration)
+    {
+      Data data;
+
+      Handle h1 = data.insert(NDC("1"));
+      data.insert(NDC("2"));
+      data.insert(NDC("3"));
+
+      data.erase(h1);
+
+      // The last element fills the gap.
+      CHECK_EQUAL(2, std::distance(data.begin(), data.end()));
+      CHECK_EQUAL(std::string("3"), data.begin()->value);
+      CHECK_EQUAL(std::string("2"), (data.begin() + 1)->value);
+
+      for (Data::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(&data[data.handle_of(itr)] == &*itr);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_erase_iterator)
+    {
+      Data data;
+
+      data.insert(NDC("1"));
+      Handle h2 = data.insert(NDC("2"));
+      data.insert(NDC("3"));
+
+      Data::iterator itr = data.begin();
+
+      while (itr != data.end())
+      {
+        if (itr->value == "1")
+        {
+          itr = data.erase(itr);
+        }
+        else
+        {
+          ++itr;
+        }
+      }
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("2"), data[h2].value);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      NDC::reset_instance_count();
+
+      {
+        Data data;
+
+        Handle h1 = data.insert(NDC("1"));
+        data.insert(NDC("2"));
+
+        CHECK_EQUAL(2, NDC::get_instance_count());
+
+        data.clear();
+
+        CHECK_EQUAL(0, NDC::get_instance_count());
+        CHECK(data.empty());
+        CHECK(!data.contains(h1));
+
+        data.insert(NDC("3"));
+        CHECK_EQUAL(1, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Data data;
+
+      Handle h1 = data.insert(NDC("1"));
+      Handle h2 = data.insert(NDC("2"));
+      data.erase(h1);
+
+      Data copy(data);
+
+      CHECK_EQUAL(1U, copy.size());
+      CHECK(!copy.contains(h1));
+      CHECK_EQUAL(std::string("2"), copy[h2].value);
+
+      Data moved(std::move(copy));
+
+      CHECK(copy.empty());
+      CHECK_EQUAL(std::string("2"), moved[h2].value);
+
+      Data assigned;
+      assigned.insert(NDC("x"));
+      assigned = moved;
+
+      CHECK_EQUAL(1U, assigned.size());
+      CHECK_EQUAL(std::string("2"), assigned[h2].value);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      etl::slot_map<int, 64> data;
+      std::map<uint32_t, int> compare;
+      std::vector<Handle> erased;
+
+      uint32_t seed = 1U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        seed = seed * 1103515245U + 12345U;
+
+        if (((seed >> 16) % 3U != 0U) && !data.full())
+        {
+          Handle h = data.insert(i);
+          CHECK(compare.find(h.value()) == compare.end());
+          compare[h.value()] = i;
+        }
+        else if (!compare.empty())
+        {
+          std::map<uint32_t, int>::iterator itr = compare.begin();
+          std::advance(itr, (seed >> 8) % compare.size());
+
+          Handle h(itr->first);
+          CHECK(data.erase(h));
+          erased.push_back(h);
+          compare.erase(itr);
+        }
+
+        CHECK_EQUAL(compare.size(), data.size());
+      }
+
+      for (std::map<uint32_t, int>::iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK_EQUAL(itr->second, data[Handle(itr->first)]);
+      }
+
+      // Erased handles are never valid again.
+      for (size_t i = 0U; i < erased.size(); ++i)
+      {
+        CHECK(!data.contains(erased[i]));
+      }
+    }
+  }
+}
@@ -0,0 +1,265 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/small_vector.h"
+#include "etl/pool.h"
+#include "etl/vector.h"
+
+#include <string>
+#include <memory>
+
+namespace
+{
+  typedef etl::small_vector<int, 4U, 16U>         Vector;
+  typedef etl::pool<Vector::spill_block_type, 2U> Pool;
+
+  typedef etl::small_vector<std::string, 2U, 8U>      StringVector;
+  typedef etl::pool<StringVector::spill_block_type, 2U> StringPool;
+
+  SUITE(test_small_vector)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Pool pool;
+
+      Vector empty(pool);
+      Vector filled(pool, 3U, 7);
+
+      const int data[] = { 1, 2, 3, 4, 5, 6 };
+      Vector ranged(pool, std::begin(data), std::end(data));
+
+      CHECK(empty.empty());
+      CHECK(empty.is_inline());
+      CHECK_EQUAL(4U, empty.capacity());
+      CHECK_EQUAL(16U, empty.max_size());
+      CHECK_EQUAL(16U, empty.available());
+
+      CHECK_EQUAL(3U, filled.size());
+      CHECK(filled.is_inline());
+      CHECK_EQUAL(7, filled[2]);
+
+      CHECK_EQUAL(6U, ranged.size());
+      CHECK(!ranged.is_inline());
+      CHECK_EQUAL(16U, ranged.capacity());
+      CHECK_ARRAY_EQUAL(data, ranged.data(), 6U);
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_and_shrink)
+    {
+      Pool pool;
+      Vector vector(pool);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        vector.push_back(i);
+      }
+
+      CHECK(vector.is_inline());
+      CHECK_EQUAL(0U, pool.size());
+
+      vector.push_back(4);
+
+      CHECK(!vector.is_inline());
+      CHECK_EQUAL(1U, pool.size());
+      CHECK_EQUAL(5U, vector.size());
+
+      for (int i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(i, vector[size_t(i)]);
+      }
+
+      vector.pop_back();
+      vector.shrink_to_fit();
+
+      CHECK(vector.is_inline());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(4U, vector.size());
+      CHECK_EQUAL(3, vector.back());
+
+      vector.resize(10U, 9);
+      CHECK_EQUAL(1U, pool.size());
+      vector.clear();
+      CHECK(vector.is_inline());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_pool)
+    {
+      Pool pool;
+      Vector a(pool, 8U, 1);
+      Vector b(pool, 8U, 2);
+      Vector c(pool, 4U, 3);
+
+      CHECK(pool.full());
+
+      CHECK_THROW(c.push_back(4), etl::vector_full);
+      CHECK_EQUAL(4U, c.size());
+      CHECK(c.is_inline());
+
+      a.clear();
+      c.push_back(4);
+      CHECK(!c.is_inline());
+      CHECK_EQUAL(5U, c.size());
+      CHECK_EQUAL(4, c.back());
+    }
+
+    //*************************************************************************
+    TEST(test_max_size)
+    {
+      Pool pool;
+      Vector vector(pool, 16U, 0);
+
+      CHECK(vector.full());
+      CHECK_EQUAL(0U, vector.available());
+      CHECK_THROW(vector.push_back(1), etl::vector_full);
+      CHECK_THROW(vector.reserve(17U), etl::vector_full);
+      CHECK_EQUAL(16U, vector.size());
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase)
+    {
+      Pool pool;
+      Vector vector(pool);
+      etl::vector<int, 16U> compare;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        vector.insert(vector.begin(), i);
+        compare.insert(compare.begin(), i);
+      }
+
+      vector.insert(vector.begin() + 2, vector[0]);
+      compare.insert(compare.begin() + 2, compare[0]);
+      vector.insert(vector.end(), 10);
+      compare.insert(compare.end(), 10);
+
+      CHECK_EQUAL(compare.size(), vector.size());
+      CHECK_ARRAY_EQUAL(compare.data(), vector.data(), compare.size());
+
+      Vector::iterator itr = vector.erase(vector.begin() + 1);
+      compare.erase(compare.begin() + 1);
+      CHECK_EQUAL(compare[1], *itr);
+
+      vector.erase(vector.begin() + 2, vector.begin() + 5);
+      compare.erase(compare.begin() + 2, compare.begin() + 5);
+
+      CHECK_EQUAL(compare.size(), vector.size());
+      CHECK_ARRAY_EQUAL(compare.data(), vector.data(), compare.size());
+      CHECK_THROW(vector.at(vector.size()), etl::vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_elements)
+    {
+      StringPool pool;
+      StringVector vector(pool);
+
+      vector.push_back("one");
+      vector.emplace_back(3U, 'x');
+      vector.push_back(std::string("three"));
+
+      CHECK(!vector.is_inline());
+      CHECK_EQUAL(std::string("one"), vector[0]);
+      CHECK_EQUAL(std::string("xxx"), vector[1]);
+      CHECK_EQUAL(std::string("three"), vector[2]);
+
+      vector.erase(vector.begin());
+      vector.shrink_to_fit();
+
+      CHECK(vector.is_inline());
+      CHECK_EQUAL(std::string("xxx"), vector.front());
+      CHECK_EQUAL(std::string("three"), vector.back());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      StringPool pool;
+      StringVector spilled(pool);
+      StringVector small(pool);
+
+      spilled.assign(4U, std::string("long enough to allocate"));
+      small.push_back("a");
+
+      StringVector copy(spilled);
+      CHECK(copy == spilled);
+      CHECK_EQUAL(2U, pool.size());
+
+      StringVector moved(etl::move(copy));
+      CHECK(moved == spilled);
+      CHECK(copy.empty());
+      CHECK(copy.is_inline());
+      CHECK_EQUAL(2U, pool.size());
+
+      StringVector moved_small(etl::move(small));
+      CHECK_EQUAL(1U, moved_small.size());
+      CHECK(moved_small.is_inline());
+
+      moved_small = etl::move(moved);
+      CHECK(moved_small == spilled);
+      CHECK(moved.empty());
+      CHECK_EQUAL(2U, pool.size());
+
+      moved_small = small;
+      CHECK(moved_small.empty());
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_comparison)
+    {
+      Pool pool;
+      const int data1[] = { 1, 2, 3, 4, 5 };
+      const int data2[] = { 1, 2, 4 };
+
+      Vector a(pool, std::begin(data1), std::end(data1));
+      Vector b(pool, std::begin(data2), std::end(data2));
+      Vector c(a);
+
+      CHECK(a == c);
+      CHECK(a != b);
+      CHECK(a < b);
+      CHECK(!(b < a));
+
+      int sum = 0;
+      for (Vector::const_reverse_iterator itr = a.crbegin(); itr != a.crend(); ++itr)
+      {
+        sum = (sum * 10) + *itr;
+      }
+
+      CHECK_EQUAL(54321, sum);
+    }
+  }
+}
@@ -0,0 +1,277 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/soa_vector.h"
+
+#include <string>
+#include <numeric>
+#include <algorithm>
+
+#include "data.h"
+
+namespace
+{
+  static const size_t SIZE = 5U;
+
+  typedef TestDataNDC<std::string> NDC;
+
+  typedef etl::soa_vector<SIZE, int, double, std::string> Data;
+  typedef etl::soa_vector<SIZE, int, NDC>                 DataNDC;
+
+  //***************************************************************************
+  void fill(Data& data)
+  {
+    data.push_back(1, 1.5, std::string("one"));
+    data.push_back(2, 2.5, std::string("two"));
+    data.push_back(3, 3.5, std::string("three"));
+  }
+
+  SUITE(test_soa_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(SIZE, data.capacity());
+      CHECK_EQUAL(SIZE, data.max_size());
+      CHECK_EQUAL(SIZE, data.available());
+      CHECK_EQUAL(3U, Data::Column_Count);
+      CHECK(data.begin() == data.end());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_and_columns)
+    {
+      Data data;
+      fill(data);
+
+      CHECK_EQUAL(3U, data.size());
+
+      etl::span<int>         ints    = data.column<0>();
+      etl::span<double>      doubles = data.column<1>();
+      etl::span<std::string> strings = data.column<2>();
+
+      CHECK_EQUAL(3U, ints.size());
+      CHECK_EQUAL(6, std::accumulate(ints.begin(), ints.end(), 0));
+      CHECK_CLOSE(7.5, std::accumulate(doubles.begin(), doubles.end(), 0.0), 0.001);
+      CHECK_EQUAL(std::string("three"), strings[2]);
+
+      // Each column is contiguous.
+      CHECK(data.data<0>() + 1 == &data.get<0>(1));
+      CHECK(data.data<1>() + 2 == &data.get<1>(2));
+
+      // Writes through a column span are seen by the rows.
+      ints[1] = 20;
+      CHECK_EQUAL(20, data[1].get<0>());
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_full)
+    {
+      Data data;
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        data.push_back(int(i), 0.0, std::string());
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(0, 0.0, std::string()), etl::soa_vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_rows)
+    {
+      Data data;
+      fill(data);
+
+      Data::row row = data[1];
+
+      CHECK_EQUAL(1U, row.index());
+      CHECK_EQUAL(2, row.get<0>());
+      CHECK_CLOSE(2.5, row.get<1>(), 0.001);
+      CHECK_EQUAL(std::string("two"), row.get<2>());
+
+      row.get<2>() = "TWO";
+      CHECK_EQUAL(std::string("TWO"), data.get<2>(1));
+
+      const Data& cdata = data;
+      Data::const_row crow = cdata.at(2);
+
+      CHECK_EQUAL(3, crow.get<0>());
+      CHECK_EQUAL(1, data.front().get<0>());
+      CHECK_EQUAL(3, cdata.back().get<0>());
+      CHECK_THROW(data.at(3), etl::soa_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      Data data;
+      fill(data);
+
+      int total = 0;
+
+      for (Data::iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        total += (*itr).get<0>();
+        (*itr).get<1>() *= 2.0;
+      }
+
+      CHECK_EQUAL(6, total);
+      CHECK_CLOSE(5.0, data.get<1>(1), 0.001);
+
+      Data::const_iterator citr = data.cbegin();
+
+      CHECK_EQUAL(3, std::distance(data.cbegin(), data.cend()));
+      CHECK_EQUAL(3, citr[2].get<0>());
+      CHECK_EQUAL(2, (*(citr + 1)).get<0>());
+      CHECK_EQUAL(3, (*(data.end() - 1)).get<0>());
+      CHECK(data.begin() < data.end());
+
+      Data::const_iterator found = std::find_if(data.cbegin(), data.cend(), [](Data::const_row r) { return r.get<2>() == "two"; });
+
+      CHECK_EQUAL(1, std::distance(data.cbegin(), found));
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data;
+      fill(data);
+
+      Data::iterator itr = data.erase(data.begin());
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(2, (*itr).get<0>());
+      CHECK_EQUAL(std::string("two"), data.get<2>(0));
+      CHECK_EQUAL(std::string("three"), data.get<2>(1));
+    }
+
+    //*************************************************************************
+    TEST(test_erase_unordered)
+    {
+      Data data;
+      fill(data);
+
+      data.erase_unordered(0U);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(3, data.get<0>(0));
+      CHECK_EQUAL(std::string("three"), data.get<2>(0));
+      CHECK_EQUAL(std::string("two"), data.get<2>(1));
+    }
+
+    //*************************************************************************
+    TEST(test_resize_and_pop_back)
+    {
+      Data data;
+      fill(data);
+
+      data.resize(5U);
+
+      CHECK_EQUAL(5U, data.size());
+      CHECK_EQUAL(0, data.get<0>(4));
+      CHECK(data.get<2>(4).empty());
+
+      data.resize(2U);
+      CHECK_EQUAL(2U, data.size());
+
+      data.pop_back();
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(1, data.back().get<0>());
+
+      data.pop_back();
+      CHECK_THROW(data.pop_back(), etl::soa_vector_empty);
+      CHECK_THROW(data.resize(SIZE + 1U), etl::soa_vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_copy_and_move)
+    {
+      Data data;
+      fill(data);
+
+      Data copy(data);
+
+      CHECK_EQUAL(3U, copy.size());
+      CHECK_EQUAL(std::string("two"), copy.get<2>(1));
+
+      Data moved(std::move(copy));
+
+      CHECK_EQUAL(3U, moved.size());
+      CHECK(copy.empty());
+      CHECK_EQUAL(std::string("three"), moved.get<2>(2));
+
+      Data assigned;
+      assigned.push_back(9, 9.0, std::string("nine"));
+      assigned = data;
+
+      CHECK_EQUAL(3U, assigned.size());
+      CHECK_EQUAL(1, assigned.get<0>(0));
+
+      assigned = std::move(moved);
+      CHECK_EQUAL(3U, assigned.size());
+      CHECK(moved.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_destruction)
+    {
+      NDC::reset_instance_count();
+
+      {
+        DataNDC data;
+
+        data.push_back(1, NDC("1"));
+        data.push_back(2, NDC("2"));
+        data.push_back(3, NDC("3"));
+
+        CHECK_EQUAL(3, NDC::get_instance_count());
+
+        data.erase(data.begin() + 1);
+        CHECK_EQUAL(2, NDC::get_instance_count());
+
+        data.erase_unordered(0U);
+        CHECK_EQUAL(1, NDC::get_instance_count());
+        CHECK_EQUAL(std::string("3"), data.get<1>(0).value);
+
+        DataNDC copy(data);
+        CHECK_EQUAL(2, NDC::get_instance_count());
+      }
+
+      CHECK_EQUAL(0, NDC::get_instance_count());
+    }
+  }
+}
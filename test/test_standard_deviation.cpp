@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/standard_deviation.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -160,5 +161,44 @@ namespace
       variance_result = standard_deviation.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_standard_deviation_block_add_matches_single_values)
+    {
+      std::vector<float>   samples_f;
+      std::vector<double>  samples_d;
+      std::vector<int16_t> samples_i16;
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 1003U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int16_t sample = int16_t(seed >> 16);
+
+        samples_i16.push_back(sample);
+        samples_f.push_back(float(sample) / 32768.0f);
+        samples_d.push_back(double(sample) / 32768.0);
+      }
+
+      for (size_t length = 0U; length <= samples_f.size(); length += ((length < 40U) ? 1U : 321U))
+      {
+        etl::standard_deviation<etl::standard_deviation_type::Sample, float> single_f(samples_f.begin(), samples_f.begin() + length);
+        etl::standard_deviation<etl::standard_deviation_type::Sample, float> block_f;
+        block_f.add(etl::span<const float>(samples_f.data(), length));
+        CHECK_EQUAL(single_f.count(), block_f.count());
+        CHECK_CLOSE(single_f.get_standard_deviation(), block_f.get_standard_deviation(), 1e-4);
+
+        etl::standard_deviation<etl::standard_deviation_type::Sample, double> single_d(samples_d.begin(), samples_d.begin() + length);
+        etl::standard_deviation<etl::standard_deviation_type::Sample, double> block_d;
+        block_d.add(etl::span<const double>(samples_d.data(), length));
+        CHECK_CLOSE(single_d.get_standard_deviation(), block_d.get_standard_deviation(), 1e-9);
+
+        etl::standard_deviation<etl::standard_deviation_type::Population, int16_t, int64_t> single_i16(samples_i16.begin(), samples_i16.begin() + length);
+        etl::standard_deviation<etl::standard_deviation_type::Population, int16_t, int64_t> block_i16;
+        block_i16.add(etl::span<const int16_t>(samples_i16.data(), length));
+        CHECK_EQUAL(single_i16.get_standard_deviation(), block_i16.get_standard_deviation());
+      }
+    }
   };
 }
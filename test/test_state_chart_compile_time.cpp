@@ -240,6 +240,152 @@ namespace
                       3,
                       StateId::IDLE> motorControlStateChart;
 
+  //***************************************************************************
+  // A larger chart with sparse ids, guards and 'from any state' transitions.
+  //***************************************************************************
+  class Protocol
+  {
+  public:
+
+    Protocol()
+    {
+      Clear();
+    }
+
+    void Clear()
+    {
+      a        = 0;
+      b        = 0;
+      entries  = 0;
+      exits    = 0;
+      toggle   = false;
+    }
+
+    void OnA()      { ++a; }
+    void OnB()      { ++b; }
+    void OnEntry()  { ++entries; }
+    void OnExit()   { ++exits; }
+    bool Pass()     { return true; }
+    bool Fail()     { return false; }
+    bool Toggle()   { toggle = !toggle; return toggle; }
+
+    int  a;
+    int  b;
+    int  entries;
+    int  exits;
+    bool toggle;
+  };
+
+  using protocol_transition = etl::state_chart_traits::transition<Protocol>;
+  using protocol_state      = etl::state_chart_traits::state<Protocol>;
+
+  constexpr protocol_transition sparseTransitionTable[] =
+  {
+    protocol_transition(0,   10,  40,  &Protocol::OnA, &Protocol::Toggle),
+    protocol_transition(0,   10,  80,  &Protocol::OnB),
+    protocol_transition(0,   20,  120, &Protocol::OnA, &Protocol::Fail),
+    protocol_transition(     250, 200, &Protocol::OnB, &Protocol::Toggle),
+    protocol_transition(40,  20,  0,   &Protocol::OnA),
+    protocol_transition(40,  250, 160, &Protocol::OnA),
+    protocol_transition(80,  30,  240, &Protocol::OnB, &Protocol::Pass),
+    protocol_transition(     20,  160, &Protocol::OnB, &Protocol::Toggle),
+    protocol_transition(120, 20,  0,   &Protocol::OnA),
+    protocol_transition(160, 10,  80,  &Protocol::OnA, &Protocol::Toggle),
+    protocol_transition(160, 10,  200),
+    protocol_transition(200, 30,  40,  &Protocol::OnB),
+    protocol_transition(240, 250, 0,   &Protocol::OnA, &Protocol::Fail),
+    protocol_transition(240, 10,  240, &Protocol::OnA),
+    protocol_transition(     30,  0,   &Protocol::OnA, &Protocol::Toggle),
+    protocol_transition(     10,  120)
+  };
+
+  constexpr protocol_state sparseStateTable[] =
+  {
+    protocol_state(40,  &Protocol::OnEntry, &Protocol::OnExit),
+    protocol_state(0,   &Protocol::OnEntry, nullptr),
+    protocol_state(240, nullptr,            &Protocol::OnExit),
+    protocol_state(160, &Protocol::OnEntry, &Protocol::OnExit)
+  };
+
+  constexpr protocol_transition denseTransitionTable[] =
+  {
+    protocol_transition(0, 0, 1, &Protocol::OnA, &Protocol::Toggle),
+    protocol_transition(   1, 3, &Protocol::OnB, &Protocol::Toggle),
+    protocol_transition(0, 1, 2, &Protocol::OnA),
+    protocol_transition(1, 2, 3, &Protocol::OnB),
+    protocol_transition(1, 0, 0, &Protocol::OnA, &Protocol::Fail),
+    protocol_transition(1, 0, 4),
+    protocol_transition(2, 3, 0, &Protocol::OnB, &Protocol::Toggle),
+    protocol_transition(2, 3, 1),
+    protocol_transition(3, 4, 2, &Protocol::OnA),
+    protocol_transition(   4, 0, &Protocol::OnB),
+    protocol_transition(4, 5, 1, &Protocol::OnA, &Protocol::Pass),
+    protocol_transition(4, 1, 4)
+  };
+
+  constexpr protocol_state denseStateTable[] =
+  {
+    protocol_state(0, &Protocol::OnEntry, &Protocol::OnExit),
+    protocol_state(2, &Protocol::OnEntry, nullptr),
+    protocol_state(3, nullptr,            &Protocol::OnExit),
+    protocol_state(4, &Protocol::OnEntry, &Protocol::OnExit)
+  };
+
+  constexpr size_t Sparse_Transitions = sizeof(sparseTransitionTable) / sizeof(sparseTransitionTable[0]);
+  constexpr size_t Sparse_States      = sizeof(sparseStateTable) / sizeof(sparseStateTable[0]);
+  constexpr size_t Dense_Transitions  = sizeof(denseTransitionTable) / sizeof(denseTransitionTable[0]);
+  constexpr size_t Dense_States       = sizeof(denseStateTable) / sizeof(denseStateTable[0]);
+
+  Protocol sparseProtocol;
+  Protocol denseProtocol;
+
+  etl::state_chart_ct<Protocol, sparseProtocol, sparseTransitionTable, Sparse_Transitions, sparseStateTable, Sparse_States, 0> sparseStateChart;
+  etl::state_chart_ct<Protocol, denseProtocol,  denseTransitionTable,  Dense_Transitions,  denseStateTable,  Dense_States,  0> denseStateChart;
+
+  //***************************************************************************
+  // Drives a compile time chart and a run time chart over the same tables
+  // with the same events and checks that they behave identically.
+  //***************************************************************************
+  template <typename TChart>
+  bool compare_with_runtime_chart(TChart&                    chart,
+                                  Protocol&                  protocol,
+                                  const protocol_transition* transitions,
+                                  size_t                     n_transitions,
+                                  const protocol_state*      states,
+                                  size_t                     n_states,
+                                  const etl::state_chart_traits::event_id_t* events,
+                                  size_t                     n_events)
+  {
+    Protocol reference;
+    etl::state_chart<Protocol> reference_chart(reference, transitions, transitions + n_transitions, states, states + n_states, 0);
+
+    protocol.Clear();
+    chart.start();
+    reference_chart.start();
+
+    uint32_t seed = 12345U;
+
+    for (int i = 0; i < 2000; ++i)
+    {
+      seed = (seed * 1664525U) + 1013904223U;
+      const etl::state_chart_traits::event_id_t event_id = events[(seed >> 16) % n_events];
+
+      chart.process_event(event_id);
+      reference_chart.process_event(event_id);
+
+      if ((chart.get_state_id() != reference_chart.get_state_id()) ||
+          (protocol.a       != reference.a)       ||
+          (protocol.b       != reference.b)       ||
+          (protocol.entries != reference.entries) ||
+          (protocol.exits   != reference.exits))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
   SUITE(test_state_chart_compile_time)
   {
     //*************************************************************************
@@ -608,5 +754,41 @@ namespace
       motorControlStateChart.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControlStateChart.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_sparse_ids_match_runtime_chart)
+    {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      typedef etl::private_state_chart::table_index<protocol_transition, sparseTransitionTable, Sparse_Transitions,
+                                                    protocol_state, sparseStateTable, Sparse_States, 0> index_t;
+      const bool is_dense = index_t::Is_Dense;
+      CHECK_FALSE(is_dense);
+#endif
+
+      const etl::state_chart_traits::event_id_t events[] = { 10, 20, 30, 250, 10, 0, 99, 255 };
+
+      CHECK(compare_with_runtime_chart(sparseStateChart, sparseProtocol,
+                                       sparseTransitionTable, Sparse_Transitions,
+                                       sparseStateTable, Sparse_States,
+                                       events, sizeof(events) / sizeof(events[0])));
+    }
+
+    //*************************************************************************
+    TEST(test_dense_ids_match_runtime_chart)
+    {
+#if ETL_STATE_CHART_CT_USING_INDEX
+      typedef etl::private_state_chart::table_index<protocol_transition, denseTransitionTable, Dense_Transitions,
+                                                    protocol_state, denseStateTable, Dense_States, 0> index_t;
+      const bool is_dense = index_t::Is_Dense;
+      CHECK_TRUE(is_dense);
+#endif
+
+      const etl::state_chart_traits::event_id_t events[] = { 0, 1, 2, 3, 4, 5, 6, 0, 1 };
+
+      CHECK(compare_with_runtime_chart(denseStateChart, denseProtocol,
+                                       denseTransitionTable, Dense_Transitions,
+                                       denseStateTable, Dense_States,
+                                       events, sizeof(events) / sizeof(events[0])));
+    }
   };
 }
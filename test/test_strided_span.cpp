@@ -0,0 +1,211 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/strided_span.h"
+#include "etl/span.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdint.h>
+
+namespace
+{
+  SUITE(test_strided_span)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::strided_span<int> view;
+
+      CHECK_TRUE(view.empty());
+      CHECK_EQUAL(0U, view.size());
+      CHECK_EQUAL(1U, view.stride());
+      CHECK_TRUE(view.begin() == view.end());
+    }
+
+    //*************************************************************************
+    TEST(test_pointer_constructor)
+    {
+      int buffer[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::strided_span<int> view(buffer + 1, 3U, 3U);
+
+      CHECK_EQUAL(3U, view.size());
+      CHECK_EQUAL(3U, view.stride());
+      CHECK_EQUAL(1, view[0]);
+      CHECK_EQUAL(4, view[1]);
+      CHECK_EQUAL(7, view[2]);
+      CHECK_EQUAL(1, view.front());
+      CHECK_EQUAL(7, view.back());
+      CHECK_TRUE(view.data() == buffer + 1);
+    }
+
+    //*************************************************************************
+    TEST(test_interleaved_channels)
+    {
+      // Three channels of five interleaved samples.
+      int16_t samples[15];
+
+      for (size_t i = 0U; i < 15U; ++i)
+      {
+        samples[i] = int16_t(((i % 3U) * 100U) + (i / 3U));
+      }
+
+      etl::span<int16_t> buffer(samples);
+
+      for (size_t channel = 0U; channel < 3U; ++channel)
+      {
+        etl::strided_span<int16_t> view(buffer, channel, 3U);
+
+        CHECK_EQUAL(5U, view.size());
+
+        for (size_t i = 0U; i < view.size(); ++i)
+        {
+          CHECK_EQUAL(int16_t((channel * 100U) + i), view[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_span_constructor_partial_last_stride)
+    {
+      int buffer[] = { 0, 1, 2, 3, 4, 5, 6 };
+
+      etl::span<int> data(buffer);
+
+      CHECK_EQUAL(3U, etl::strided_span<int>(data, 0U, 3U).size()); // 0, 3, 6
+      CHECK_EQUAL(2U, etl::strided_span<int>(data, 1U, 3U).size()); // 1, 4
+      CHECK_EQUAL(2U, etl::strided_span<int>(data, 2U, 3U).size()); // 2, 5
+      CHECK_EQUAL(0U, etl::strided_span<int>(data, 7U, 3U).size());
+
+      etl::strided_span<int> all(data);
+      CHECK_EQUAL(7U, all.size());
+      CHECK_EQUAL(1U, all.stride());
+      CHECK_TRUE(std::equal(all.begin(), all.end(), buffer));
+    }
+
+    //*************************************************************************
+    TEST(test_write_through_view)
+    {
+      int buffer[8] = { 0 };
+
+      etl::strided_span<int> view(buffer + 1, 4U, 2U);
+      std::fill(view.begin(), view.end(), 5);
+
+      const int expected[8] = { 0, 5, 0, 5, 0, 5, 0, 5 };
+      CHECK_ARRAY_EQUAL(expected, buffer, 8U);
+    }
+
+    //*************************************************************************
+    TEST(test_zero_stride)
+    {
+      int value = 3;
+
+      etl::strided_span<int> view(&value, 4U, 0U);
+
+      CHECK_EQUAL(12, std::accumulate(view.begin(), view.end(), 0));
+    }
+
+    //*************************************************************************
+    TEST(test_iterators)
+    {
+      int buffer[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::strided_span<int> view(buffer, 5U, 2U);
+
+      etl::strided_span<int>::iterator itr = view.begin();
+
+      CHECK_EQUAL(0, *itr);
+      CHECK_EQUAL(2, *++itr);
+      CHECK_EQUAL(2, *itr++);
+      CHECK_EQUAL(4, *itr);
+      CHECK_EQUAL(8, itr[2]);
+
+      itr += 2;
+      CHECK_EQUAL(8, *itr);
+      itr -= 3;
+      CHECK_EQUAL(2, *itr);
+      CHECK_EQUAL(6, *(itr + 2));
+      CHECK_EQUAL(0, *(itr - 1));
+      CHECK_EQUAL(5, view.end() - view.begin());
+      CHECK_TRUE(view.begin() < view.end());
+
+      const int expected[] = { 8, 6, 4, 2, 0 };
+      CHECK_TRUE(std::equal(view.rbegin(), view.rend(), expected));
+    }
+
+    //*************************************************************************
+    TEST(test_sub_views)
+    {
+      int buffer[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+      etl::strided_span<int> view(buffer, 5U, 2U);
+
+      etl::strided_span<int> first = view.first(2U);
+      CHECK_EQUAL(2U, first.size());
+      CHECK_EQUAL(0, first[0]);
+      CHECK_EQUAL(2, first[1]);
+
+      etl::strided_span<int> last = view.last(2U);
+      CHECK_EQUAL(2U, last.size());
+      CHECK_EQUAL(6, last[0]);
+      CHECK_EQUAL(8, last[1]);
+
+      etl::strided_span<int> sub = view.subspan(1U, 3U);
+      CHECK_EQUAL(3U, sub.size());
+      CHECK_EQUAL(2, sub[0]);
+      CHECK_EQUAL(6, sub[2]);
+
+      etl::strided_span<int> rest = view.subspan(3U);
+      CHECK_EQUAL(2U, rest.size());
+      CHECK_EQUAL(6, rest[0]);
+
+      etl::strided_span<int> every = view.every(2U);
+      CHECK_EQUAL(3U, every.size());
+      CHECK_EQUAL(4U, every.stride());
+      CHECK_EQUAL(0, every[0]);
+      CHECK_EQUAL(4, every[1]);
+      CHECK_EQUAL(8, every[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_const_conversion)
+    {
+      int buffer[] = { 0, 1, 2, 3, 4, 5 };
+
+      etl::strided_span<int>       view(buffer, 3U, 2U);
+      etl::strided_span<const int> const_view(view);
+
+      CHECK_EQUAL(3U, const_view.size());
+      CHECK_EQUAL(2U, const_view.stride());
+      CHECK_EQUAL(4, const_view[2]);
+    }
+  };
+}
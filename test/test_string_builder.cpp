@@ -0,0 +1,196 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/string_builder.h"
+#include "etl/pool.h"
+#include "etl/string.h"
+#include "etl/u16string.h"
+
+#include <string>
+
+namespace
+{
+  typedef etl::string_builder<8U> Builder;
+  typedef etl::pool<Builder::chunk_type, 4U> Pool;
+
+  //*************************************************************************
+  template <typename TBuilder>
+  std::string flatten(const TBuilder& builder)
+  {
+    std::string result(builder.size(), ' ');
+
+    builder.copy(&result[0], result.size());
+
+    return result;
+  }
+
+  SUITE(test_string_builder)
+  {
+    //*************************************************************************
+    TEST(test_default)
+    {
+      Pool pool;
+      Builder builder(pool);
+
+      CHECK_TRUE(builder.empty());
+      CHECK_EQUAL(0U, builder.size());
+      CHECK_EQUAL(0U, builder.chunk_count());
+      CHECK_FALSE(builder.is_truncated());
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_append_across_chunks)
+    {
+      Pool pool;
+      Builder builder(pool);
+
+      CHECK_EQUAL(5U, builder.append("Hello"));
+      CHECK_EQUAL(1U, builder.chunk_count());
+
+      CHECK_EQUAL(7U, builder.append(etl::string_view(", World")));
+      CHECK_EQUAL(2U, builder.chunk_count());
+
+      CHECK_TRUE(builder.push_back('!'));
+      CHECK_EQUAL(3U, builder.append(3U, '.'));
+
+      etl::string<10> text("[]");
+      CHECK_EQUAL(2U, builder.append(text));
+
+      CHECK_EQUAL(18U, builder.size());
+      CHECK_EQUAL(3U, builder.chunk_count());
+      CHECK_EQUAL(1U, pool.available());
+      CHECK_EQUAL(std::string("Hello, World!...[]"), flatten(builder));
+    }
+
+    //*************************************************************************
+    TEST(test_gather)
+    {
+      Pool pool;
+      Builder builder(pool);
+
+      builder.append("0123456789ABCDEFGH");
+
+      etl::string_view views[4];
+      etl::span<etl::string_view> gather_list(views);
+
+      CHECK_EQUAL(3U, builder.gather(gather_list));
+      CHECK_TRUE(views[0] == etl::string_view("01234567"));
+      CHECK_TRUE(views[1] == etl::string_view("89ABCDEF"));
+      CHECK_TRUE(views[2] == etl::string_view("GH"));
+
+      // A short gather list.
+      etl::string_view short_views[2];
+      CHECK_EQUAL(2U, builder.gather(etl::span<etl::string_view, 2U>(short_views)));
+      CHECK_TRUE(short_views[1] == etl::string_view("89ABCDEF"));
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Pool pool;
+      Builder builder(pool);
+
+      builder.append("0123456789ABCDEFGH");
+
+      char buffer[10] = {};
+
+      CHECK_EQUAL(6U, builder.copy(buffer, 6U, 5U));
+      CHECK_EQUAL(std::string("56789A"), std::string(buffer, 6U));
+
+      CHECK_EQUAL(3U, builder.copy(buffer, 10U, 15U));
+      CHECK_EQUAL(std::string("FGH"), std::string(buffer, 3U));
+
+      CHECK_EQUAL(0U, builder.copy(buffer, 10U, 18U));
+
+      etl::string<12> text("<");
+      CHECK_EQUAL(11U, builder.copy(text));
+      CHECK_EQUAL(std::string("<0123456789A"), std::string(text.c_str()));
+    }
+
+    //*************************************************************************
+    TEST(test_pool_exhausted)
+    {
+      Pool pool;
+      Builder builder(pool);
+
+      CHECK_EQUAL(32U, builder.append("0123456789ABCDEF0123456789ABCDEF0123"));
+      CHECK_TRUE(builder.is_truncated());
+      CHECK_EQUAL(32U, builder.size());
+      CHECK_EQUAL(0U, pool.available());
+      CHECK_FALSE(builder.push_back('x'));
+
+      builder.clear();
+
+      CHECK_FALSE(builder.is_truncated());
+      CHECK_TRUE(builder.empty());
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_shared_pool)
+    {
+      Pool pool;
+
+      {
+        Builder builder1(pool);
+        Builder builder2(pool);
+
+        builder1.append("abcdefghij");
+        builder2.append("0123");
+        builder1.append("klmnop");
+
+        CHECK_EQUAL(1U, pool.available());
+        CHECK_EQUAL(std::string("abcdefghijklmnop"), flatten(builder1));
+        CHECK_EQUAL(std::string("0123"), flatten(builder2));
+      }
+
+      // The destructors return the chunks.
+      CHECK_EQUAL(4U, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_u16string_builder)
+    {
+      etl::pool<etl::u16string_builder<4U>::chunk_type, 2U> pool;
+      etl::u16string_builder<4U> builder(pool);
+
+      builder.append(u"abcdef");
+
+      etl::u16string_view views[2];
+      CHECK_EQUAL(2U, builder.gather(etl::span<etl::u16string_view>(views)));
+      CHECK_TRUE(views[1] == etl::u16string_view(u"ef"));
+
+      etl::u16string<10> text;
+      builder.copy(text);
+      CHECK_TRUE(text == etl::u16string<10>(u"abcdef"));
+    }
+  };
+}
@@ -3145,6 +3145,31 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_string_partial_matches)
+    {
+      const value_t* the_haystack = STR("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab aaab aaaaab");
+
+      std::string compare_haystack(the_haystack);
+      TextL haystack(the_haystack);
+
+      const value_t* needles[] = { STR("aaab"), STR("ab a"), STR("b"), STR("aaaaab"), STR("aac"), STR("a") };
+
+      for (size_t n = 0UL; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        for (size_t position = 0UL; position <= haystack.size(); ++position)
+        {
+          CHECK_EQUAL(compare_haystack.find(needles[n], position), haystack.find(needles[n], position));
+        }
+      }
+
+      for (size_t position = 0UL; position <= haystack.size(); ++position)
+      {
+        CHECK_EQUAL(compare_haystack.find(STR(' '), position), haystack.find(STR(' '), position));
+        CHECK_EQUAL(compare_haystack.find(STR('b'), position), haystack.find(STR('b'), position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_find_pointer)
     {
@@ -3342,6 +3367,36 @@ namespace
       CHECK_THROW(text.substr(text.size() + 1), etl::string_out_of_bounds);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_compare_long_strings)
+    {
+      const value_t* the_text = STR("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmn");
+
+      TextL text(the_text);
+      CompareText compare_text(the_text);
+
+      // Make the strings differ at each position in turn.
+      for (size_t i = 0UL; i < text.size(); ++i)
+      {
+        TextL lower(the_text);
+        TextL higher(the_text);
+        lower[i]  = lower[i] - 1;
+        higher[i] = higher[i] + 1;
+
+        CHECK(compares_agree(compare_text.compare(CompareText(lower.c_str())), text.compare(lower)));
+        CHECK(compares_agree(compare_text.compare(CompareText(higher.c_str())), text.compare(higher)));
+        CHECK(text != lower);
+        CHECK(!(text == higher));
+      }
+
+      TextL shorter(the_text, text.size() - 1);
+      CHECK(text.compare(shorter) > 0);
+      CHECK(shorter.compare(text) < 0);
+      CHECK(text == TextL(the_text));
+      CHECK(text == the_text);
+      CHECK(the_text == text);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_compare_string)
     {
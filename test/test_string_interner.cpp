@@ -0,0 +1,201 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/string_interner.h"
+#include "etl/string.h"
+
+#include <string>
+#include <set>
+
+namespace
+{
+  using Interner = etl::string_interner<8U, 64U>;
+
+  SUITE(test_string_interner)
+  {
+    //*************************************************************************
+    TEST(test_construction)
+    {
+      Interner interner;
+
+      CHECK(interner.empty());
+      CHECK(!interner.full());
+      CHECK_EQUAL(0U, interner.size());
+      CHECK_EQUAL(8U, interner.max_size());
+      CHECK_EQUAL(0U, interner.bytes_used());
+      CHECK_EQUAL(64U, interner.bytes_available());
+      CHECK_EQUAL(8U, Interner::Max_Strings);
+      CHECK_EQUAL(64U, Interner::Max_Bytes);
+      CHECK((etl::is_same<uint8_t, Interner::id_type>::value));
+
+      Interner::handle h;
+      CHECK(!h.is_valid());
+      CHECK(!interner.is_interned(h));
+    }
+
+    //*************************************************************************
+    TEST(test_intern_returns_equal_handles)
+    {
+      Interner interner;
+
+      etl::string<32> topic1("sensor/temperature");
+      etl::string<32> topic2("sensor/temperature");
+
+      Interner::handle h1 = interner.intern(etl::string_view(topic1));
+      Interner::handle h2 = interner.intern(etl::string_view(topic2));
+      Interner::handle h3 = interner.intern("sensor/pressure");
+
+      CHECK(h1.is_valid());
+      CHECK(h1 == h2);
+      CHECK(h1 != h3);
+      CHECK(h1 < h3);
+      CHECK_EQUAL(2U, interner.size());
+      CHECK_EQUAL(size_t(18U + 1U + 15U + 1U), interner.bytes_used());
+
+      CHECK(interner.view(h1) == etl::string_view("sensor/temperature"));
+      CHECK_EQUAL(std::string("sensor/pressure"), std::string(interner.c_str(h3)));
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      Interner interner;
+
+      Interner::handle h = interner.intern("config/rate");
+
+      CHECK(interner.find("config/rate") == h);
+      CHECK(interner.find(etl::string_view("config/rate")) == h);
+      CHECK(!interner.find("config/mode").is_valid());
+      CHECK(!interner.find("config/rat").is_valid());
+      CHECK(interner.contains(etl::string_view("config/rate")));
+      CHECK(!interner.contains(etl::string_view("config")));
+      CHECK_EQUAL(1U, interner.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty_string)
+    {
+      Interner interner;
+
+      Interner::handle h = interner.intern("");
+
+      CHECK(h.is_valid());
+      CHECK(interner.view(h).empty());
+      CHECK(interner.intern(etl::string_view()) == h);
+      CHECK_EQUAL(1U, interner.bytes_used());
+    }
+
+    //*************************************************************************
+    TEST(test_capacity_limits)
+    {
+      etl::string_interner<2U, 9U> interner;
+
+      CHECK(interner.intern("abc").is_valid());
+      CHECK(!interner.intern("abcdefgh").is_valid()); // Too many bytes.
+      CHECK(interner.intern("abcd").is_valid());
+      CHECK(interner.full());
+      CHECK(!interner.intern("x").is_valid());        // Too many strings.
+
+      // Existing strings are still found.
+      CHECK(interner.intern("abc").is_valid());
+      CHECK_EQUAL(2U, interner.size());
+      CHECK_EQUAL(0U, interner.bytes_available());
+    }
+
+    //*************************************************************************
+    TEST(test_many_strings)
+    {
+      etl::string_interner<200U, 2000U> interner;
+
+      std::set<uint8_t> ids;
+
+      for (int i = 0; i < 200; ++i)
+      {
+        std::string text = "key" + std::to_string(i);
+        etl::string_interner<200U, 2000U>::handle h = interner.intern(etl::string_view(text.c_str(), text.size()));
+
+        CHECK(h.is_valid());
+        ids.insert(h.get_id());
+      }
+
+      CHECK_EQUAL(200U, ids.size());
+
+      for (int i = 0; i < 200; ++i)
+      {
+        std::string text = "key" + std::to_string(i);
+        etl::string_interner<200U, 2000U>::handle h = interner.find(etl::string_view(text.c_str(), text.size()));
+
+        CHECK(h.is_valid());
+        CHECK(interner.view(h) == etl::string_view(text.c_str(), text.size()));
+      }
+
+      CHECK(!interner.find("key200").is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Interner interner;
+
+      Interner::handle h = interner.intern("one");
+      interner.intern("two");
+
+      interner.clear();
+
+      CHECK(interner.empty());
+      CHECK_EQUAL(0U, interner.bytes_used());
+      CHECK(!interner.is_interned(h));
+      CHECK(interner.view(h).empty());
+      CHECK(!interner.find("one").is_valid());
+      CHECK(interner.intern("two").is_valid());
+    }
+
+    //*************************************************************************
+    TEST(test_key)
+    {
+#if ETL_USING_CPP14
+      static constexpr etl::string_interner_key key("topic/status");
+
+      static_assert(key.hash() == etl::wyhash_64("topic/status", 12U), "Hash not constant");
+#else
+      static const etl::string_interner_key key("topic/status");
+#endif
+
+      Interner interner;
+
+      Interner::handle h = interner.intern(key);
+
+      CHECK(interner.find("topic/status") == h);
+      CHECK(interner.find(key) == h);
+      CHECK(interner.intern(etl::string_interner_key(etl::string_view("topic/status"))) == h);
+      CHECK(key.view() == etl::string_view("topic/status"));
+    }
+  }
+}
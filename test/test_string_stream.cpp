@@ -326,6 +326,70 @@ namespace
 
       CHECK_EQUAL(String(STR("Hello")), istr);
     }
-  };
+  
+
+    //*************************************************************************
+    TEST(test_external_buffer)
+    {
+      char buffer[20];
+      etl::string_ext text(buffer, sizeof(buffer));
+      Stream ss(text);
+
+      ss << STR("Value = ") << 42;
+
+      CHECK_EQUAL(String(STR("Value = 42")), text);
+      CHECK(text.data() == buffer);
+      CHECK_EQUAL(0, strcmp(buffer, STR("Value = 42")));
+      CHECK_EQUAL(sizeof(buffer) - 1U - 10U, ss.available());
+    }
+
+    //*************************************************************************
+    TEST(test_append_commit)
+    {
+      String str;
+      Stream ss(str);
+
+      ss << STR("AB");
+
+      etl::span<char> free_space = ss.append(3U);
+
+      CHECK_EQUAL(3U, free_space.size());
+      CHECK(free_space.data() == str.data_end());
+
+      free_space[0] = STR('x');
+      free_space[1] = STR('y');
+      free_space[2] = STR('z');
+
+      CHECK_EQUAL(String(STR("AB")), str);
+
+      ss.commit(3U);
+      ss << 1;
+
+      CHECK_EQUAL(String(STR("ABxyz1")), str);
+    }
+
+    //*************************************************************************
+    TEST(test_append_commit_limited_to_capacity)
+    {
+      etl::string<4> str;
+      Stream ss(str);
+
+      ss << STR("AB");
+
+      etl::span<char> free_space = ss.append(10U);
+
+      CHECK_EQUAL(2U, free_space.size());
+
+      free_space[0] = STR('C');
+      free_space[1] = STR('D');
+
+      ss.commit(10U);
+
+      CHECK_EQUAL(4U, str.size());
+      CHECK_EQUAL(0U, ss.available());
+      CHECK_EQUAL(0U, ss.append(1U).size());
+      CHECK_EQUAL(String(STR("ABCD")), str);
+    }
+};
 }
 
@@ -286,6 +286,42 @@ namespace
 
       CHECK_EQUAL(String(STR("Hello")), istr);
     }
-  };
+  
+
+    //*************************************************************************
+    TEST(test_external_buffer)
+    {
+      char16_t buffer[20];
+      etl::u16string_ext text(buffer, sizeof(buffer) / sizeof(char16_t));
+      Stream ss(text);
+
+      ss << STR("Value = ") << 42;
+
+      CHECK_EQUAL(String(STR("Value = 42")), text);
+      CHECK(text.data() == buffer);
+    }
+
+    //*************************************************************************
+    TEST(test_append_commit)
+    {
+      String str;
+      Stream ss(str);
+
+      ss << STR("AB");
+
+      etl::span<char16_t> free_space = ss.append(3U);
+
+      CHECK_EQUAL(3U, free_space.size());
+
+      free_space[0] = STR('x');
+      free_space[1] = STR('y');
+      free_space[2] = STR('z');
+
+      ss.commit(3U);
+      ss << 1;
+
+      CHECK_EQUAL(String(STR("ABxyz1")), str);
+    }
+};
 }
 
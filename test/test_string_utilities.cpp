@@ -34,6 +34,7 @@ SOFTWARE.
 #include "etl/vector.h"
 
 #include <string>
+#include <vector>
 
 #undef STR
 #define STR(x) x
@@ -1035,6 +1036,108 @@ namespace
       CHECK_EQUAL(0U, tokens.size());
     }
 
+    //*************************************************************************
+    TEST(test_split_view_single_delimiter_keep_empty_tokens)
+    {
+      StringView text(STR(",The,cat,,sat,"));
+
+      etl::split_view<StringView> tokens(text, STR(','));
+
+      std::vector<std::string> result;
+
+      for (etl::split_view<StringView>::const_iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+      {
+        result.push_back(std::string(itr->data(), itr->size()));
+      }
+
+      CHECK_EQUAL(6U, result.size());
+      CHECK(result[0] == STR(""));
+      CHECK(result[1] == STR("The"));
+      CHECK(result[2] == STR("cat"));
+      CHECK(result[3] == STR(""));
+      CHECK(result[4] == STR("sat"));
+      CHECK(result[5] == STR(""));
+
+      // The tokens are views of the original text.
+      CHECK(tokens.begin()->data() == text.data());
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_single_delimiter_ignore_empty_tokens)
+    {
+      StringView text(STR(",,,The,cat,sat,,on,the,mat,,,"));
+
+      etl::split_view<StringView> tokens(text, STR(','), true);
+
+      std::vector<std::string> result;
+
+      for (etl::split_view<StringView>::const_iterator itr = tokens.begin(); itr != tokens.end(); itr++)
+      {
+        result.push_back(std::string(itr->data(), itr->size()));
+      }
+
+      CHECK_EQUAL(6U, result.size());
+      CHECK(result[0] == STR("The"));
+      CHECK(result[5] == STR("mat"));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_delimiter_set)
+    {
+      StringView text(STR("GET /index.html HTTP/1.1\r\nHost: a\r\n"));
+
+      etl::string_delimiter_set delimiters(STR(" \r\n"));
+
+      CHECK(delimiters.contains(' '));
+      CHECK(delimiters.contains('\n'));
+      CHECK(!delimiters.contains('G'));
+
+      etl::split_view<StringView, etl::string_delimiter_set> tokens(text, delimiters, true);
+
+      std::vector<std::string> result;
+
+      for (etl::split_view<StringView, etl::string_delimiter_set>::const_iterator itr = tokens.begin(); itr != tokens.end(); ++itr)
+      {
+        result.push_back(std::string(itr->data(), itr->size()));
+      }
+
+      CHECK_EQUAL(5U, result.size());
+      CHECK(result[0] == STR("GET"));
+      CHECK(result[1] == STR("/index.html"));
+      CHECK(result[2] == STR("HTTP/1.1"));
+      CHECK(result[3] == STR("Host:"));
+      CHECK(result[4] == STR("a"));
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_empty_input)
+    {
+      StringView text;
+
+      etl::split_view<StringView> keep(text, STR(','));
+      etl::split_view<StringView> ignore(text, STR(','), true);
+
+      etl::split_view<StringView>::const_iterator itr = keep.begin();
+      CHECK(itr != keep.end());
+      CHECK_EQUAL(0U, itr->size());
+      ++itr;
+      CHECK(itr == keep.end());
+
+      CHECK(ignore.begin() == ignore.end());
+    }
+
+    //*************************************************************************
+    TEST(test_split_view_no_delimiters)
+    {
+      StringView text(STR("The cat"));
+
+      etl::split_view<StringView> tokens(text, STR(','));
+
+      etl::split_view<StringView>::const_iterator itr = tokens.begin();
+      CHECK(*itr == text);
+      CHECK(++itr == tokens.end());
+    }
+
     //*************************************************************************
     TEST(test_get_token_delimiters_no_tokens)
     {
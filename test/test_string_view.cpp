@@ -813,6 +813,42 @@ namespace
       CHECK(View::npos == view.rfind(s4, 0, 11));
     }
 
+    //*************************************************************************
+    TEST(test_find_and_compare_long_views)
+    {
+      const char* the_text = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab aaab aaaaab";
+
+      std::string compare_text(the_text);
+      View view(the_text);
+
+      const char* needles[] = { "aaab", "ab a", "b", "aaaaab", "aac", "a" };
+
+      for (size_t n = 0UL; n < (sizeof(needles) / sizeof(needles[0])); ++n)
+      {
+        for (size_t position = 0UL; position <= view.size(); ++position)
+        {
+          CHECK_EQUAL(compare_text.find(needles[n], position), view.find(needles[n], position));
+        }
+      }
+
+      // Make the views differ at each position in turn.
+      for (size_t i = 0UL; i < compare_text.size(); ++i)
+      {
+        std::string lower(compare_text);
+        std::string higher(compare_text);
+        lower[i]  = lower[i] - 1;
+        higher[i] = higher[i] + 1;
+
+        CHECK(view.compare(View(lower.data(), lower.size())) > 0);
+        CHECK(view.compare(View(higher.data(), higher.size())) < 0);
+        CHECK(view != View(lower.data(), lower.size()));
+      }
+
+      CHECK(view == View(compare_text.data(), compare_text.size()));
+      CHECK_EQUAL(0, view.compare(View(compare_text.data(), compare_text.size())));
+      CHECK(view.compare(View(the_text, 10)) > 0);
+    }
+
     //*************************************************************************
     TEST(test_find_first_of)
     {
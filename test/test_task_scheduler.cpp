@@ -149,6 +149,66 @@ private:
   Task* pTaskToAddTo;
 };
 
+//*****************************************************************************
+class EventTask : public etl::task
+{
+public:
+
+  //*********************************************
+  EventTask(etl::task_priority_t priority_, const std::string& name_, Common& common_)
+    : task(priority_)
+    , name(name_)
+    , common(common_)
+    , pending(0)
+    , pTaskToPost(nullptr)
+  {
+  }
+
+  //*********************************************
+  void Post(int n)
+  {
+    pending += n;
+    set_task_ready(true);
+  }
+
+  //*********************************************
+  void PostOnWork(EventTask& taskToPost_)
+  {
+    pTaskToPost = &taskToPost_;
+  }
+
+  //*********************************************
+  virtual uint32_t task_request_work() const ETL_OVERRIDE
+  {
+    // Never polled.
+    return 0;
+  }
+
+  //*********************************************
+  virtual void task_process_work() ETL_OVERRIDE
+  {
+    common.workList.push_back(name);
+
+    if (--pending == 0)
+    {
+      set_task_ready(false);
+    }
+
+    if (pTaskToPost != nullptr)
+    {
+      pTaskToPost->Post(1);
+      pTaskToPost = nullptr;
+    }
+  }
+
+private:
+
+  std::string name;
+  Common& common;
+  int pending;
+  EventTask* pTaskToPost;
+};
+
 Common common;
 
 WorkList_t work1 = { "T1W1", "T1W2", "T1W3" };
@@ -165,6 +225,7 @@ typedef etl::scheduler<etl::scheduler_policy_sequential_single,   sizeof(etl::ar
 typedef etl::scheduler<etl::scheduler_policy_sequential_multiple, sizeof(etl::array_size(taskList))> SchedulerSequentialMultiple;
 typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
 typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
+typedef etl::scheduler<etl::scheduler_policy_ready_priority,      4>                                 SchedulerReadyPriority;
 
 namespace
 {
@@ -287,5 +348,47 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //*************************************************************************
+    TEST(test_scheduler_ready_priority)
+    {
+      SchedulerReadyPriority s;
+
+      EventTask event_task1(1, "E1", common);
+      EventTask event_task2a(2, "E2a", common);
+      EventTask event_task2b(2, "E2b", common);
+      EventTask event_task3(3, "E3", common);
+
+      common.Clear();
+      common.watchdog_called = false;
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task(event_task1);
+      s.add_task(event_task2a);
+      s.add_task(event_task2b);
+      s.add_task(event_task3);
+
+      // Work that is ready before the scheduler starts.
+      event_task1.Post(2);
+      event_task2b.Post(1);
+      event_task3.Post(1);
+
+      // Running task 1 makes task 3 ready and running task 3 makes task 2a ready.
+      event_task1.PostOnWork(event_task3);
+      event_task3.PostOnWork(event_task2a);
+
+      s.start(); // If 'start' returns then the idle callback was successfully called.
+
+      WorkList_t expected = { "E3", "E2a", "E2b", "E1", "E3", "E1" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+      CHECK(!event_task1.task_is_ready());
+      CHECK(!event_task2a.task_is_ready());
+      CHECK(!event_task2b.task_is_ready());
+      CHECK(!event_task3.task_is_ready());
+    }
   };
 }
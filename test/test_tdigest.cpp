@@ -0,0 +1,219 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/tdigest.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+  //*************************************************************************
+  // The values 0 to n - 1, in a pseudo random order.
+  std::vector<uint32_t> make_shuffled(uint32_t n)
+  {
+    std::vector<uint32_t> values(n);
+
+    for (uint32_t i = 0U; i < n; ++i)
+    {
+      values[i] = i;
+    }
+
+    uint32_t seed = 12345U;
+
+    for (uint32_t i = n - 1U; i > 0U; --i)
+    {
+      seed = (seed * 1103515245U) + 12345U;
+      std::swap(values[i], values[(seed >> 8) % (i + 1U)]);
+    }
+
+    return values;
+  }
+
+  SUITE(test_tdigest)
+  {
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::tdigest<double> digest;
+
+      CHECK(digest.empty());
+      CHECK_EQUAL(0U, digest.count());
+      CHECK_EQUAL(0U, digest.size());
+      CHECK_CLOSE(0.0, digest.quantile(0.5), 1e-9);
+      CHECK_CLOSE(0.0, digest.cdf(1.0), 1e-9);
+    }
+
+    //*************************************************************************
+    TEST(test_few_values)
+    {
+      const std::vector<int> values = { 7, 3, 9, 1, 5, 2, 10, 8, 4, 6 };
+
+      etl::tdigest<int> digest(values.begin(), values.end());
+
+      CHECK_EQUAL(10U, digest.count());
+      CHECK_CLOSE(1.0,  digest.quantile(0.0), 1e-9);
+      CHECK_CLOSE(10.0, digest.quantile(1.0), 1e-9);
+      CHECK_CLOSE(5.5,  digest.quantile(0.5), 1e-9);
+      CHECK_CLOSE(1.0,  digest.min(), 1e-9);
+      CHECK_CLOSE(10.0, digest.max(), 1e-9);
+      CHECK_CLOSE(0.0,  digest.cdf(0), 1e-9);
+      CHECK_CLOSE(0.45, digest.cdf(5), 1e-9);
+      CHECK_CLOSE(1.0,  digest.cdf(10), 1e-9);
+
+      // Single values are kept until the centroids are compressed.
+      CHECK_EQUAL(10U, digest.size());
+    }
+
+    //*************************************************************************
+    TEST(test_uniform_quantiles)
+    {
+      const uint32_t N = 100000U;
+      const std::vector<uint32_t> values = make_shuffled(N);
+
+      etl::tdigest<uint32_t, 100U> digest;
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        digest.add(values[i]);
+      }
+
+      CHECK_EQUAL(N, digest.count());
+      CHECK(digest.size() <= (etl::tdigest<uint32_t, 100U>::MAX_CENTROIDS));
+
+      // Errors are relative to the rank, and smallest at the tails.
+      CHECK_CLOSE(0.001 * N, digest.quantile(0.001), 0.0005 * N);
+      CHECK_CLOSE(0.01 * N,  digest.quantile(0.01),  0.002 * N);
+      CHECK_CLOSE(0.25 * N,  digest.quantile(0.25),  0.01 * N);
+      CHECK_CLOSE(0.5 * N,   digest.quantile(0.5),   0.01 * N);
+      CHECK_CLOSE(0.75 * N,  digest.quantile(0.75),  0.01 * N);
+      CHECK_CLOSE(0.99 * N,  digest.quantile(0.99),  0.002 * N);
+      CHECK_CLOSE(0.999 * N, digest.quantile(0.999), 0.0005 * N);
+
+      CHECK_CLOSE(0.0,       digest.quantile(0.0), 1e-9);
+      CHECK_CLOSE(N - 1.0,   digest.quantile(1.0), 1e-9);
+
+      CHECK_CLOSE(0.5,  digest.cdf(N / 2U), 0.01);
+      CHECK_CLOSE(0.99, digest.cdf(uint32_t(0.99 * N)), 0.002);
+    }
+
+    //*************************************************************************
+    TEST(test_skewed_latency_p99)
+    {
+      // Mostly small values, with a long tail.
+      std::vector<double> values;
+
+      uint32_t seed = 54321U;
+
+      for (size_t i = 0U; i < 50000U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const double u = double((seed >> 8) & 0xFFFFU) / 65536.0;
+        values.push_back(100.0 / (1.0 - (0.999 * u)));
+      }
+
+      etl::tdigest<double, 100U, 200U> digest(values.begin(), values.end());
+
+      std::vector<double> sorted(values);
+      std::sort(sorted.begin(), sorted.end());
+
+      const double qs[] = { 0.5, 0.9, 0.99, 0.999 };
+
+      for (size_t i = 0U; i < (sizeof(qs) / sizeof(qs[0])); ++i)
+      {
+        // Compare by rank, as the values span three orders of magnitude.
+        const double estimate = digest.quantile(qs[i]);
+        const double rank     = double(std::upper_bound(sorted.begin(), sorted.end(), estimate) - sorted.begin()) / double(sorted.size());
+
+        // The error shrinks towards the tail.
+        CHECK_CLOSE(qs[i], rank, 0.2 * (1.0 - qs[i]));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_merge)
+    {
+      const uint32_t N = 40000U;
+      const std::vector<uint32_t> values = make_shuffled(N);
+
+      etl::tdigest<uint32_t> whole(values.begin(), values.end());
+
+      // Four partial digests, as if from separate cores.
+      etl::tdigest<uint32_t> part1(values.begin(),          values.begin() + 10000U);
+      etl::tdigest<uint32_t> part2(values.begin() + 10000U, values.begin() + 20005U);
+      etl::tdigest<uint32_t> part3(values.begin() + 20005U, values.begin() + 20005U);
+      etl::tdigest<uint32_t> part4(values.begin() + 20005U, values.end());
+
+      etl::tdigest<uint32_t> merged;
+      merged.merge(part1);
+      merged.merge(part2);
+      merged.merge(part3);
+      merged.merge(part4);
+
+      CHECK_EQUAL(whole.count(), merged.count());
+      CHECK_CLOSE(whole.min(), merged.min(), 1e-9);
+      CHECK_CLOSE(whole.max(), merged.max(), 1e-9);
+
+      const double qs[] = { 0.001, 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 };
+
+      for (size_t i = 0U; i < (sizeof(qs) / sizeof(qs[0])); ++i)
+      {
+        CHECK_CLOSE(qs[i] * N, merged.quantile(qs[i]), 0.01 * N);
+      }
+
+      // Merging with itself doubles the weights.
+      merged.merge(merged);
+      CHECK_EQUAL(2U * N, merged.count());
+      CHECK_CLOSE(0.5 * N, merged.quantile(0.5), 0.01 * N);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::tdigest<int, 20U, 5U> digest;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        digest(i);
+      }
+
+      CHECK_EQUAL(100U, digest.count());
+
+      digest.clear();
+      CHECK(digest.empty());
+      CHECK_EQUAL(0U, digest.size());
+
+      digest.add(-5);
+      CHECK_CLOSE(-5.0, digest.quantile(0.5), 1e-9);
+      CHECK_CLOSE(-5.0, digest.min(), 1e-9);
+      CHECK_CLOSE(-5.0, digest.max(), 1e-9);
+    }
+  };
+}
@@ -33,6 +33,7 @@ SOFTWARE.
 #include <array>
 #include <algorithm>
 #include <math.h>
+#include <vector>
 
 namespace
 {
@@ -88,6 +89,40 @@ namespace
 
   std::array<double, Size> output2;
 
+  //***********************************
+  // Samples that are not a whole number of vectors.
+  template <typename T>
+  std::vector<T> make_samples(T first, T step)
+  {
+    std::vector<T> samples;
+
+    for (int i = 0; i < 37; ++i)
+    {
+      const T k     = (i * 7) % 37;
+      const T value = first + (k * step);
+      samples.push_back(value);
+    }
+
+    return samples;
+  }
+
+  //***********************************
+  // Checks that a block gives the same result as each sample.
+  template <typename TFunctor, typename T>
+  bool check_process(const TFunctor& functor, const std::vector<T>& input)
+  {
+    std::vector<T> expected(input.size());
+    std::transform(input.begin(), input.end(), expected.begin(), functor);
+
+    std::vector<T> output(input.size());
+    functor.process(etl::span<const T>(input.data(), input.size()), etl::span<T>(output.data(), output.size()));
+
+    std::vector<T> in_place(input);
+    functor.process(etl::span<const T>(in_place.data(), in_place.size()), etl::span<T>(in_place.data(), in_place.size()));
+
+    return (output == expected) && (in_place == expected);
+  }
+
   SUITE(test_histogram)
   {
     //*************************************************************************
@@ -133,5 +168,15 @@ namespace
       bool isEqual = std::equal(output2.begin(), output2.end(), result2b.begin(), Compare());
       CHECK(isEqual);
     }
+
+    //*************************************************************************
+    TEST(test_process)
+    {
+      CHECK(check_process(etl::threshold<int16_t>(3, 1, -1), make_samples<int16_t>(-20, 1)));
+      CHECK(check_process(etl::threshold<int32_t, etl::greater<int32_t> >(1000, 7, 9), make_samples<int32_t>(-20000, 1000)));
+      CHECK(check_process(etl::threshold<float>(0.5f, 1.0f, 0.0f), make_samples<float>(-2.0f, 0.25f)));
+      CHECK(check_process(etl::threshold<double>(0.5, 1.0, 0.0), make_samples<double>(-2.0, 0.25)));
+      CHECK(check_process(etl::threshold<int, etl::less_equal<int> >(3, 1, -1), make_samples<int>(-20, 1)));
+    }
   };
 }
@@ -0,0 +1,346 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/time_series.h"
+
+#include <vector>
+#include <cmath>
+#include <limits>
+#include <stdint.h>
+#include <string.h>
+
+namespace
+{
+  //*************************************************************************
+  template <typename T>
+  bool same_bits(T a, T b)
+  {
+    return memcmp(&a, &b, sizeof(T)) == 0;
+  }
+
+  //*************************************************************************
+  template <typename TTime>
+  std::vector<TTime> make_times(size_t n, TTime start)
+  {
+    std::vector<TTime> times;
+    TTime time = start;
+    uint32_t seed = 1U;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      seed = seed * 1664525U + 1013904223U;
+
+      // Mostly regular, with jitter, gaps and the occasional step backwards.
+      const uint32_t r = seed >> 24;
+      const int jitter = (r < 200U) ? 0 : (r < 240U) ? int(r % 50U) - 25 : (r < 250U) ? int(r * 17U) : (r < 254U) ? 100000 : -7;
+
+      time = TTime(time + TTime(1000 + jitter));
+      times.push_back(time);
+    }
+
+    return times;
+  }
+
+  //*************************************************************************
+  template <typename TValue>
+  std::vector<TValue> make_values(size_t n)
+  {
+    std::vector<TValue> values;
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      TValue value;
+
+      if ((i % 50U) < 20U)
+      {
+        value = TValue(21.5);
+      }
+      else
+      {
+        value = TValue(20.0 + std::sin(double(i) * 0.01) * 3.0);
+      }
+
+      values.push_back(value);
+    }
+
+    values.push_back(std::numeric_limits<TValue>::infinity());
+    values.push_back(-TValue(0.0));
+    values.push_back(std::numeric_limits<TValue>::quiet_NaN());
+    values.push_back(std::numeric_limits<TValue>::denorm_min());
+    values.push_back(std::numeric_limits<TValue>::max());
+
+    return values;
+  }
+
+  //*************************************************************************
+  template <typename TTime, typename TValue>
+  struct Sample
+  {
+    TTime  time;
+    TValue value;
+  };
+
+  SUITE(test_time_series)
+  {
+    //*************************************************************************
+    TEST(test_delta_of_delta_known_bits)
+    {
+      uint8_t buffer[16] = { 0 };
+      etl::bit_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+      etl::delta_of_delta_encoder<uint16_t> encoder;
+
+      encoder.write_unchecked(writer, 0x1234U); // 16 bits
+      encoder.write_unchecked(writer, 0x1244U); // delta 16, '10' + 0010000
+      encoder.write_unchecked(writer, 0x1254U); // no change, '0'
+      encoder.write_unchecked(writer, 0x1264U); // no change, '0'
+
+      CHECK_EQUAL(16U + 9U + 1U + 1U, writer.size_bits());
+      CHECK_EQUAL(0x12U, buffer[0]);
+      CHECK_EQUAL(0x34U, buffer[1]);
+      CHECK_EQUAL(0x88U, buffer[2]);
+      CHECK_EQUAL(0x00U, buffer[3]);
+
+      CHECK_EQUAL(1U,  encoder.encoded_bits(0x1274U));
+      CHECK_EQUAL(9U,  encoder.encoded_bits(0x1273U));
+      CHECK_EQUAL(12U, encoder.encoded_bits(0x1364U));
+      CHECK_EQUAL(16U, encoder.encoded_bits(0x1A64U));
+      CHECK_EQUAL(20U, encoder.encoded_bits(0x7274U));
+    }
+
+    //*************************************************************************
+    TEST(test_delta_of_delta_round_trip)
+    {
+      const std::vector<uint32_t> times32 = make_times<uint32_t>(2000U, 0xFFFF0000UL); // Wraps around.
+      const std::vector<int64_t>  times64 = make_times<int64_t>(2000U, -5000);
+
+      std::vector<uint8_t> buffer(20000U);
+
+      etl::bit_stream_writer writer(buffer.data(), buffer.size(), etl::endian::big);
+      etl::delta_of_delta_encoder<uint32_t> encoder32;
+      etl::delta_of_delta_encoder<int64_t>  encoder64;
+
+      for (size_t i = 0U; i < times32.size(); ++i)
+      {
+        CHECK(encoder32.write(writer, times32[i]));
+        CHECK(encoder64.write(writer, times64[i]));
+      }
+
+      // Far less than the raw size.
+      CHECK(writer.size_bytes() < ((times32.size() * 12U) / 4U));
+
+      etl::bit_stream_reader reader(buffer.data(), buffer.size(), etl::endian::big);
+      etl::delta_of_delta_decoder<uint32_t> decoder32;
+      etl::delta_of_delta_decoder<int64_t>  decoder64;
+
+      for (size_t i = 0U; i < times32.size(); ++i)
+      {
+        CHECK_EQUAL(times32[i], decoder32.read_unchecked(reader));
+        CHECK_EQUAL(times64[i], decoder64.read_unchecked(reader));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_delta_of_delta_extremes)
+    {
+      const int16_t values[] = { 0, 32767, -32768, 32767, 0, -1, 1, -32768, -32768 };
+
+      uint8_t buffer[64];
+      etl::bit_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+      etl::delta_of_delta_encoder<int16_t> encoder;
+
+      for (size_t i = 0U; i < 9U; ++i)
+      {
+        CHECK(encoder.write(writer, values[i]));
+      }
+
+      etl::bit_stream_reader reader(buffer, sizeof(buffer), etl::endian::big);
+      etl::delta_of_delta_decoder<int16_t> decoder;
+
+      for (size_t i = 0U; i < 9U; ++i)
+      {
+        CHECK_EQUAL(values[i], decoder.read_unchecked(reader));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_xor_float_known_bits)
+    {
+      uint8_t buffer[16] = { 0 };
+      etl::bit_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+      etl::xor_float_encoder<float> encoder;
+
+      encoder.write_unchecked(writer, 1.0f);  // 32 bits
+      encoder.write_unchecked(writer, 1.0f);  // '0'
+      CHECK_EQUAL(33U, writer.size_bits());
+
+      // 1.0f ^ 1.5f = 0x00400000 : 9 leading, 22 trailing, 1 meaningful bit.
+      CHECK_EQUAL(2U + 5U + 5U + 1U, encoder.encoded_bits(1.5f));
+      encoder.write_unchecked(writer, 1.5f);
+
+      // 1.5f ^ 1.0f uses the same window.
+      CHECK_EQUAL(2U + 1U, encoder.encoded_bits(1.0f));
+      CHECK(!encoder.write(writer, 1.0f) || (writer.size_bits() == (33U + 13U + 3U)));
+    }
+
+    //*************************************************************************
+    TEST(test_xor_float_round_trip)
+    {
+      const std::vector<float>  floats  = make_values<float>(2000U);
+      const std::vector<double> doubles = make_values<double>(2000U);
+
+      std::vector<uint8_t> buffer(40000U);
+
+      etl::bit_stream_writer writer(buffer.data(), buffer.size(), etl::endian::big);
+      etl::xor_float_encoder<float>  float_encoder;
+      etl::xor_float_encoder<double> double_encoder;
+
+      for (size_t i = 0U; i < floats.size(); ++i)
+      {
+        const size_t before = writer.size_bits();
+        const size_t bits   = float_encoder.encoded_bits(floats[i]) + double_encoder.encoded_bits(doubles[i]);
+
+        CHECK(float_encoder.write(writer, floats[i]));
+        CHECK(double_encoder.write(writer, doubles[i]));
+        CHECK_EQUAL(before + bits, writer.size_bits());
+      }
+
+      etl::bit_stream_reader reader(buffer.data(), buffer.size(), etl::endian::big);
+      etl::xor_float_decoder<float>  float_decoder;
+      etl::xor_float_decoder<double> double_decoder;
+
+      for (size_t i = 0U; i < floats.size(); ++i)
+      {
+        CHECK(same_bits(floats[i], float_decoder.read_unchecked(reader)));
+        CHECK(same_bits(doubles[i], double_decoder.read_unchecked(reader)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_write_fails_when_full)
+    {
+      uint8_t buffer[5];
+      etl::bit_stream_writer writer(buffer, sizeof(buffer), etl::endian::big);
+      etl::xor_float_encoder<float> encoder;
+
+      CHECK(encoder.write(writer, 1.0f));
+      CHECK(!encoder.write(writer, 3.0f));
+      CHECK_EQUAL(32U, writer.size_bits());
+      CHECK(encoder.write(writer, 1.0f));
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_round_trip)
+    {
+      typedef etl::time_series_buffer<uint32_t, float, 128U, 128U> Buffer;
+      typedef Buffer::value_type Value;
+
+      static Buffer buffer;
+      CHECK(buffer.empty());
+
+      const std::vector<uint32_t> times  = make_times<uint32_t>(3000U, 100U);
+      const std::vector<float>    values = make_values<float>(3000U);
+
+      for (size_t i = 0U; i < times.size(); ++i)
+      {
+        buffer.push(times[i], values[i]);
+      }
+
+      CHECK_EQUAL(times.size(), buffer.size());
+      CHECK(buffer.size_bytes() <= Buffer::capacity_bytes());
+
+      // Much more history than storing the samples uncompressed.
+      CHECK(buffer.size_bytes() < ((times.size() * 8U) / 2U));
+
+      std::vector<Value> decoded;
+      buffer.copy(std::back_inserter(decoded));
+
+      CHECK_EQUAL(times.size(), decoded.size());
+
+      for (size_t i = 0U; i < decoded.size(); ++i)
+      {
+        CHECK_EQUAL(times[i], decoded[i].time);
+        CHECK(same_bits(values[i], decoded[i].value));
+      }
+
+      buffer.clear();
+      CHECK(buffer.empty());
+      CHECK_EQUAL(0U, buffer.size_bytes());
+
+      // Regular samples of a slowly changing quantised value.
+      for (size_t i = 0U; i < 3000U; ++i)
+      {
+        buffer.push(uint32_t(i * 1000U), float(20 + int(i / 100U)) * 0.5f);
+      }
+
+      CHECK_EQUAL(3000U, buffer.size());
+      CHECK(buffer.size_bytes() < ((3000U * 8U) / 10U));
+    }
+
+    //*************************************************************************
+    TEST(test_buffer_discards_oldest_block)
+    {
+      typedef etl::time_series_buffer<uint32_t, double, 64U, 4U> Buffer;
+      typedef Buffer::value_type Value;
+
+      Buffer buffer;
+
+      // Irregular times and changing values, so that blocks fill quickly.
+      std::vector<Value> samples;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        Value sample;
+        sample.time  = uint32_t(i * i * 7U);
+        sample.value = double(i) * 1.1;
+        samples.push_back(sample);
+
+        buffer.push(sample);
+
+        CHECK(buffer.block_count() <= Buffer::Blocks);
+      }
+
+      CHECK_EQUAL(Buffer::Blocks, buffer.block_count());
+      CHECK(buffer.size() < samples.size());
+
+      std::vector<Value> decoded;
+      buffer.copy(std::back_inserter(decoded));
+      CHECK_EQUAL(buffer.size(), decoded.size());
+
+      // The newest samples are kept.
+      const size_t first = samples.size() - decoded.size();
+
+      for (size_t i = 0U; i < decoded.size(); ++i)
+      {
+        CHECK_EQUAL(samples[first + i].time, decoded[i].time);
+        CHECK(same_bits(samples[first + i].value, decoded[i].value));
+      }
+    }
+  }
+}
@@ -0,0 +1,339 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/timer_service.h"
+#include "etl/message_router.h"
+
+#include <atomic>
+#include <vector>
+
+namespace
+{
+  uint64_t ticks = 0ULL;
+
+  typedef etl::timer_service<8, 3, std::atomic_uint32_t> Service;
+  typedef Service::callback_type                         callback_type;
+  typedef Service::group_id_t                            group_id_t;
+
+  //***************************************************************************
+  std::vector<uint64_t> tick_list1;
+  std::vector<uint64_t> tick_list2;
+
+  void callback1()
+  {
+    tick_list1.push_back(ticks);
+  }
+
+  void callback2()
+  {
+    tick_list2.push_back(ticks);
+  }
+
+  callback_type free_callback1 = callback_type::create<callback1>();
+  callback_type free_callback2 = callback_type::create<callback2>();
+
+  //***************************************************************************
+  enum
+  {
+    MESSAGE1
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  Message1 message1;
+
+  class Router1 : public etl::message_router<Router1, Message1>
+  {
+  public:
+
+    Router1()
+      : message_router(1)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      received.push_back(ticks);
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    std::vector<uint64_t> received;
+  };
+
+  Router1 router1;
+
+  //***************************************************************************
+  void run(Service& service, uint64_t until)
+  {
+    while (ticks < until)
+    {
+      ++ticks;
+      service.tick(1U);
+    }
+  }
+
+  //***************************************************************************
+  void reset()
+  {
+    ticks = 0U;
+    tick_list1.clear();
+    tick_list2.clear();
+    router1.received.clear();
+  }
+
+  SUITE(test_timer_service)
+  {
+    //*************************************************************************
+    TEST(test_group_quotas)
+    {
+      Service service;
+
+      CHECK_EQUAL(8U, service.available_quota());
+
+      group_id_t group1 = service.register_group(3U);
+      group_id_t group2 = service.register_group(4U);
+
+      CHECK(group1 != Service::NO_GROUP);
+      CHECK(group2 != Service::NO_GROUP);
+      CHECK_EQUAL(1U, service.available_quota());
+      CHECK_EQUAL(3U, service.group_quota(group1));
+
+      // Not enough unreserved timers.
+      CHECK_EQUAL(Service::NO_GROUP, service.register_group(2U));
+      CHECK_EQUAL(Service::NO_GROUP, service.register_group(0U));
+
+      // A group can register up to its quota.
+      for (int i = 0; i < 3; ++i)
+      {
+        CHECK(service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Single_Shot) != etl::timer::id::NO_TIMER);
+      }
+
+      CHECK_EQUAL(etl::timer::id::NO_TIMER, service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Single_Shot));
+      CHECK_EQUAL(3U, service.group_size(group1));
+
+      // The other group still has its own quota.
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(service.register_timer(group2, free_callback2, 10U, etl::timer::mode::Single_Shot) != etl::timer::id::NO_TIMER);
+      }
+
+      CHECK_EQUAL(etl::timer::id::NO_TIMER, service.register_timer(group2, free_callback2, 10U, etl::timer::mode::Single_Shot));
+
+      // Unknown group.
+      CHECK_EQUAL(etl::timer::id::NO_TIMER, service.register_timer(2U, free_callback2, 10U, etl::timer::mode::Single_Shot));
+
+      // Unregistering a group frees its timers and quota.
+      CHECK(service.unregister_group(group1));
+      CHECK_EQUAL(4U, service.available_quota());
+      CHECK_EQUAL(0U, service.group_size(group1));
+      CHECK(!service.unregister_group(group1));
+
+      group_id_t group3 = service.register_group(4U);
+      CHECK(group3 != Service::NO_GROUP);
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK(service.register_timer(group3, free_callback1, 10U, etl::timer::mode::Single_Shot) != etl::timer::id::NO_TIMER);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_groups_share_one_tick)
+    {
+      Service service;
+      reset();
+
+      group_id_t group1 = service.register_group(2U);
+      group_id_t group2 = service.register_group(2U);
+
+      etl::timer::id::type id1 = service.register_timer(group1, free_callback1, 37U, etl::timer::mode::Single_Shot);
+      etl::timer::id::type id2 = service.register_timer(group2, free_callback2, 11U, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = service.register_timer(group2, message1, router1, 23U, etl::timer::mode::Single_Shot);
+
+      CHECK_EQUAL(group1, service.group_of(id1));
+      CHECK_EQUAL(group2, service.group_of(id3));
+
+      service.start(id1);
+      service.start(id2);
+      service.start(id3);
+
+      service.enable(true);
+
+      CHECK_EQUAL(11U, service.time_to_next());
+
+      run(service, 100U);
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+      std::vector<uint64_t> compare3 = { 23 };
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_EQUAL(compare2.size(), tick_list2.size());
+      CHECK_EQUAL(compare3.size(), router1.received.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(),       compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), tick_list2.data(),       compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), router1.received.data(), compare3.size());
+    }
+
+    //*************************************************************************
+    TEST(test_disabled_group_keeps_phase)
+    {
+      Service service;
+      reset();
+
+      group_id_t group1 = service.register_group(1U);
+      group_id_t group2 = service.register_group(1U);
+
+      etl::timer::id::type id1 = service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = service.register_timer(group2, free_callback2, 10U, etl::timer::mode::Repeating);
+
+      service.start(id1);
+      service.start(id2);
+      service.enable(true);
+
+      CHECK(service.enable_group(group2, false));
+      CHECK(!service.is_group_enabled(group2));
+
+      run(service, 25U);
+
+      CHECK(service.enable_group(group2, true));
+
+      run(service, 40U);
+
+      std::vector<uint64_t> compare1 = { 10, 20, 30, 40 };
+      std::vector<uint64_t> compare2 = { 30, 40 };
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_EQUAL(compare2.size(), tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), tick_list2.data(), compare2.size());
+    }
+
+    //*************************************************************************
+    TEST(test_stop_group)
+    {
+      Service service;
+      reset();
+
+      group_id_t group1 = service.register_group(2U);
+      group_id_t group2 = service.register_group(1U);
+
+      etl::timer::id::type id1 = service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Repeating);
+      etl::timer::id::type id2 = service.register_timer(group1, free_callback1, 15U, etl::timer::mode::Repeating);
+      etl::timer::id::type id3 = service.register_timer(group2, free_callback2, 10U, etl::timer::mode::Repeating);
+
+      service.start(id1);
+      service.start(id2);
+      service.start(id3);
+      service.enable(true);
+
+      run(service, 12U);
+
+      CHECK(service.stop_group(group1));
+      CHECK(!service.stop_group(Service::NO_GROUP));
+
+      run(service, 30U);
+
+      std::vector<uint64_t> compare1 = { 10 };
+      std::vector<uint64_t> compare2 = { 10, 20, 30 };
+
+      CHECK_EQUAL(compare1.size(), tick_list1.size());
+      CHECK_EQUAL(compare2.size(), tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), tick_list1.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), tick_list2.data(), compare2.size());
+
+      // Timers in a stopped group can be restarted.
+      CHECK(service.start(id2, etl::timer::start::Immediate));
+      CHECK_EQUAL(0U, service.time_to_next());
+    }
+
+    //*************************************************************************
+    TEST(test_unregister_timer_and_clear)
+    {
+      Service service;
+      reset();
+
+      group_id_t group1 = service.register_group(1U);
+
+      etl::timer::id::type id1 = service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Repeating);
+
+      service.start(id1);
+      service.enable(true);
+
+      CHECK(service.unregister_timer(id1));
+      CHECK(!service.unregister_timer(id1));
+      CHECK(!service.start(id1));
+      CHECK_EQUAL(Service::NO_GROUP, service.group_of(id1));
+      CHECK_EQUAL(etl::timer::state::Inactive, service.time_to_next());
+
+      // The freed timer counts against the quota again.
+      id1 = service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Repeating);
+      CHECK(id1 != etl::timer::id::NO_TIMER);
+
+      service.start(id1);
+      service.clear();
+
+      CHECK_EQUAL(8U, service.available_quota());
+      CHECK_EQUAL(etl::timer::state::Inactive, service.time_to_next());
+
+      run(service, 20U);
+      CHECK_EQUAL(0U, tick_list1.size());
+    }
+
+    //*************************************************************************
+    TEST(test_catch_up)
+    {
+      Service service;
+      reset();
+
+      group_id_t group1 = service.register_group(1U);
+
+      etl::timer::id::type id1 = service.register_timer(group1, free_callback1, 10U, etl::timer::mode::Repeating);
+
+      service.enable(true);
+      service.enable_catch_up(true);
+      service.start(id1);
+
+      ticks = 35U;
+      service.tick(35U);
+
+      CHECK_EQUAL(1U, tick_list1.size());
+      CHECK_EQUAL(5U, service.time_to_next());
+    }
+  };
+}
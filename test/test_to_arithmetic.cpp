@@ -32,6 +32,9 @@ SOFTWARE.
 #include <sstream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
+#include <string>
+#include <stdlib.h>
 
 #include "etl/to_arithmetic.h"
 #include "etl/string.h"
@@ -711,6 +714,37 @@ namespace
       CHECK(!etl::to_arithmetic<uint64_t>(uint64_overflow_max.c_str(), uint64_overflow_max.size(), etl::hex));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_numerics_long_runs)
+    {
+      CHECK_EQUAL(1234567890123456789ULL, etl::to_arithmetic<uint64_t>(etl::string_view("1234567890123456789")).value());
+      CHECK_EQUAL(18446744073709551615ULL, etl::to_arithmetic<uint64_t>(etl::string_view("18446744073709551615")).value());
+      CHECK_EQUAL(18446744073709551615ULL, etl::to_arithmetic<uint64_t>(etl::string_view("0000000018446744073709551615")).value());
+      CHECK_EQUAL(-9223372036854775807LL - 1, etl::to_arithmetic<int64_t>(etl::string_view("-9223372036854775808")).value());
+      CHECK_EQUAL(4294967295UL, etl::to_arithmetic<uint32_t>(etl::string_view("4294967295")).value());
+      CHECK_EQUAL(12345678, etl::to_arithmetic<int32_t>(etl::string_view("12345678")).value());
+      CHECK_EQUAL(99, etl::to_arithmetic<int8_t>(etl::string_view("00000000099")).value());
+
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<uint64_t>(etl::string_view("18446744073709551616")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<uint32_t>(etl::string_view("4294967296")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Overflow,       etl::to_arithmetic<int8_t>(etl::string_view("12345678")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(etl::string_view("1234567x90123")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(etl::string_view("12345678/")).error());
+      CHECK_EQUAL(etl::to_arithmetic_status::Invalid_Format, etl::to_arithmetic<uint64_t>(etl::string_view("1234567:")).error());
+
+      // Every length and every digit position.
+      uint64_t expected = 0U;
+      std::string text;
+
+      for (int i = 0; i < 19; ++i)
+      {
+        text += char('1' + (i % 9));
+        expected = (expected * 10U) + uint64_t(1 + (i % 9));
+
+        CHECK_EQUAL(expected, etl::to_arithmetic<uint64_t>(etl::string_view(text.c_str(), text.size())).value());
+      }
+    }
+
     //*************************************************************************
     TEST(test_valid_float)
     {
@@ -771,6 +805,32 @@ namespace
       CHECK(etl::to_arithmetic<float>(text.c_str(), text.size()).has_value());
     }
 
+    //*************************************************************************
+    TEST(test_exact_float_and_double)
+    {
+      const char* texts[] = { "123.456", "0.1", "-0.001", "1e22", "-1E-22", "9007199254740992", "123,5", "3.1415926535897932",
+                              "0.000123456789", "+42", "-7.25e+3", "12345678.87654321", "0.0000000000000000000001" };
+
+      for (size_t i = 0U; i < (sizeof(texts) / sizeof(texts[0])); ++i)
+      {
+        std::string decimal(texts[i]);
+        std::replace(decimal.begin(), decimal.end(), ',', '.');
+
+        const etl::string_view view(texts[i]);
+
+        CHECK_EQUAL(strtod(decimal.c_str(), nullptr), etl::to_arithmetic<double>(view).value());
+
+        if (etl::to_arithmetic<float>(view).has_value())
+        {
+          CHECK_EQUAL(strtof(decimal.c_str(), nullptr), etl::to_arithmetic<float>(view).value());
+        }
+      }
+
+      // Text the exact path does not take is still converted.
+      CHECK_CLOSE(1.5, etl::to_arithmetic<double>(etl::string_view("1.5e")).value(), 1e-12);
+      CHECK_CLOSE(100.0, etl::to_arithmetic<double>(etl::string_view("1e00002")).value(), 1e-12);
+    }
+
     //*************************************************************************
     TEST(test_invalid_float)
     {
@@ -1038,6 +1098,13 @@ namespace
       constexpr int i = result.value();
 
       CHECK_EQUAL(123, i);
+
+      constexpr Text::const_pointer long_text{ STR("1234567890123") };
+
+      constexpr etl::to_arithmetic_result<int64_t> long_result = etl::to_arithmetic<int64_t>(long_text, 13U, etl::radix::decimal);
+      constexpr int64_t l = long_result.value();
+
+      CHECK_EQUAL(1234567890123LL, l);
     }
 #endif
   }
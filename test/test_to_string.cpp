@@ -31,11 +31,20 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <limits>
+#include <cmath>
+#include <string.h>
 
 #include "etl/to_string.h"
 #include "etl/string.h"
 #include "etl/format_spec.h"
 
+#if ETL_USING_CPP17 && defined(__has_include)
+  #if __has_include(<charconv>)
+    #include <charconv>
+  #endif
+#endif
+
 #undef STR
 #define STR(x) x
 
@@ -242,6 +251,61 @@ namespace
       CHECK(etl::string<16>(STR("8000000000000000")) == etl::to_string(INT64_MIN, str, Format().base(16).width(16).fill(STR('0'))));
     }
 
+    //*************************************************************************
+    TEST(test_integral_every_digit_count)
+    {
+      etl::string<32> str;
+
+      uint64_t value = 1U;
+
+      for (int digits = 1; digits <= 20; ++digits)
+      {
+        const uint64_t values[] = { value - 1U, value, value + 1U, (value * 9U) + (value - 1U) };
+
+        for (size_t i = 0U; i < (sizeof(values) / sizeof(values[0])); ++i)
+        {
+          std::ostringstream dec;
+          std::ostringstream oct;
+          std::ostringstream hex;
+          dec << values[i];
+          oct << std::oct << values[i];
+          hex << std::hex << std::uppercase << values[i];
+
+          CHECK_EQUAL(dec.str(), std::string(etl::to_string(values[i], str).c_str()));
+          CHECK_EQUAL(oct.str(), std::string(etl::to_string(values[i], str, Format().octal()).c_str()));
+          CHECK_EQUAL(hex.str(), std::string(etl::to_string(values[i], str, Format().hex().upper_case(true)).c_str()));
+
+          std::ostringstream negative;
+          negative << -int64_t(values[i] / 2U);
+          CHECK_EQUAL(negative.str(), std::string(etl::to_string(-int64_t(values[i] / 2U), str).c_str()));
+        }
+
+        if (digits < 20)
+        {
+          value *= 10U;
+        }
+      }
+
+      CHECK(etl::string<32>(STR("-9223372036854775808")) == etl::to_string(INT64_MIN, str));
+      CHECK(etl::string<32>(STR("-2147483648")) == etl::to_string(INT32_MIN, str));
+      CHECK(etl::string<32>(STR("18446744073709551615")) == etl::to_string(UINT64_MAX, str));
+    }
+
+    //*************************************************************************
+    TEST(test_show_base_and_other_bases)
+    {
+      etl::string<70> str;
+
+      CHECK(etl::string<70>(STR("0X7FFF")) == etl::to_string(0x7FFF, str, Format().hex().upper_case(true).show_base(true)));
+      CHECK(etl::string<70>(STR("0x7fff")) == etl::to_string(0x7FFF, str, Format().hex().show_base(true)));
+      CHECK(etl::string<70>(STR("0b101")) == etl::to_string(5, str, Format().binary().show_base(true)));
+      CHECK(etl::string<70>(STR("017")) == etl::to_string(15, str, Format().octal().show_base(true)));
+      CHECK(etl::string<70>(STR("  -42")) == etl::to_string(-42, str, Format().width(5)));
+      CHECK(etl::string<70>(STR("zz")) == etl::to_string(35 * 36 + 35, str, Format().base(36)));
+      CHECK(etl::string<70>(STR("1000")) == etl::to_string(27, str, Format().base(3)));
+      CHECK(etl::string<70>(STR("1111111111111111111111111111111111111111111111111111111111111111")) == etl::to_string(UINT64_MAX, str, Format().binary()));
+    }
+
     //*************************************************************************
     TEST(test_named_format_no_append)
     {
@@ -326,6 +390,96 @@ namespace
       CHECK(etl::string<20>(STR("20.0")) ==    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+#if ETL_HAS_SHORTEST_FLOATING_POINT
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<32> str;
+
+      CHECK(etl::string<32>(STR("0")) ==                       etl::to_string(0.0, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("-0")) ==                      etl::to_string(-0.0, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("0.1")) ==                     etl::to_string(0.1, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("0.30000000000000004")) ==     etl::to_string(0.1 + 0.2, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("-1.5")) ==                    etl::to_string(-1.5, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("100")) ==                     etl::to_string(100.0, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("1e+16")) ==                   etl::to_string(1e16, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("1.2345e-07")) ==              etl::to_string(1.2345e-7, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("1.2345E-07")) ==              etl::to_string(1.2345e-7, str, Format().shortest(true).upper_case(true)));
+      CHECK(etl::string<32>(STR("1.7976931348623157e+308")) == etl::to_string(std::numeric_limits<double>::max(), str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("2.2250738585072014e-308")) == etl::to_string(std::numeric_limits<double>::min(), str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("5e-324")) ==                  etl::to_string(std::numeric_limits<double>::denorm_min(), str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("0.1")) ==                     etl::to_string(0.1f, str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("3.4028235e+38")) ==           etl::to_string(std::numeric_limits<float>::max(), str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("1e-45")) ==                   etl::to_string(std::numeric_limits<float>::denorm_min(), str, Format().shortest(true)));
+      CHECK(etl::string<32>(STR("   2.5")) ==                  etl::to_string(2.5, str, Format().shortest(true).width(6).right()));
+      CHECK(etl::string<32>(STR("inf")) ==                     etl::to_string(std::numeric_limits<double>::infinity(), str, Format().shortest(true)));
+    }
+
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+    //*************************************************************************
+    template <typename T>
+    bool shortest_matches_to_chars(T value)
+    {
+      if (!std::isfinite(value))
+      {
+        return true;
+      }
+
+      char expected[64];
+      std::to_chars_result result = std::to_chars(expected, expected + sizeof(expected), value);
+      *result.ptr = '\0';
+
+      etl::string<64> str;
+      etl::to_string(value, str, Format().shortest(true));
+
+      return etl::string<64>(expected) == str;
+    }
+
+    //*************************************************************************
+    template <typename T, typename TBits>
+    bool shortest_matches_to_chars_bits(TBits bits)
+    {
+      T value;
+      memcpy(&value, &bits, sizeof(value));
+
+      return shortest_matches_to_chars(value);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_matches_to_chars)
+    {
+      uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        CHECK(shortest_matches_to_chars_bits<double>(state));
+        CHECK(shortest_matches_to_chars_bits<float>(static_cast<uint32_t>(state)));
+
+        // Small magnitudes, denormals and values near powers of two.
+        CHECK(shortest_matches_to_chars_bits<double>(state & 0x000FFFFFFFFFFFFFULL));
+        CHECK(shortest_matches_to_chars_bits<double>(state & 0xFFF0000000000000ULL));
+        CHECK(shortest_matches_to_chars_bits<float>(static_cast<uint32_t>(state) & 0x007FFFFFUL));
+      }
+
+      // Powers of ten.
+      double d = 1.0;
+      float  f = 1.0f;
+
+      for (int i = 0; i < 38; ++i)
+      {
+        CHECK(shortest_matches_to_chars(d));
+        CHECK(shortest_matches_to_chars(f));
+        d *= 10.0;
+        f *= 10.0f;
+      }
+    }
+#endif
+#endif
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
@@ -0,0 +1,114 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/top_k.h"
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+  SUITE(test_top_k)
+  {
+    //*************************************************************************
+    TEST(test_default)
+    {
+      etl::top_k<int, 5U> top;
+
+      CHECK(top.empty());
+      CHECK_EQUAL(0U, top.count());
+      CHECK_EQUAL(5U, (etl::top_k<int, 5U>::K));
+
+      top.add(3);
+      top.add(1);
+      top.add(4);
+
+      CHECK_EQUAL(3U, top.size());
+      CHECK(!top.full());
+      CHECK_EQUAL(1, top.threshold());
+
+      std::vector<int> result;
+      top.copy_sorted(std::back_inserter(result));
+      CHECK((std::vector<int>{ 4, 3, 1 }) == result);
+    }
+
+    //*************************************************************************
+    TEST(test_stream)
+    {
+      std::vector<int> data(10000);
+      std::iota(data.begin(), data.end(), 0);
+      std::shuffle(data.begin(), data.end(), std::mt19937(12345));
+
+      etl::top_k<int, 8U> top(data.begin(), data.end());
+
+      CHECK(top.full());
+      CHECK_EQUAL(10000U, top.count());
+      CHECK_EQUAL(9992, top.threshold());
+
+      int result[8];
+      int* end = top.copy_sorted(result);
+      CHECK(end == (result + 8));
+
+      for (int i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(9999 - i, result[i]);
+      }
+
+      // Copying the sorted values leaves them in place.
+      CHECK_EQUAL(8U, top.size());
+      CHECK_EQUAL(9992, top.threshold());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_and_duplicates)
+    {
+      etl::top_k<int, 3U, std::greater<int> > bottom;
+
+      const int data[] = { 5, 2, 2, 9, 7, 2, 1, 8 };
+
+      for (size_t i = 0; i < (sizeof(data) / sizeof(data[0])); ++i)
+      {
+        bottom(data[i]);
+      }
+
+      std::vector<int> result;
+      bottom.copy_sorted(std::back_inserter(result));
+      CHECK((std::vector<int>{ 1, 2, 2 }) == result);
+      CHECK_EQUAL(2, bottom.threshold());
+
+      bottom.clear();
+      CHECK(bottom.empty());
+      CHECK_EQUAL(0U, bottom.count());
+    }
+  }
+}
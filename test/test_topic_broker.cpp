@@ -0,0 +1,159 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/topic_broker.h"
+#include "etl/message_router.h"
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2
+  };
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+  };
+
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id)
+      , message1_count(0)
+      , message2_count(0)
+    {
+    }
+
+    void on_receive(const Message1&)
+    {
+      ++message1_count;
+    }
+
+    void on_receive(const Message2&)
+    {
+      ++message2_count;
+    }
+
+    void on_receive_unknown(const etl::imessage&)
+    {
+    }
+
+    int message1_count;
+    int message2_count;
+  };
+
+  SUITE(test_topic_broker)
+  {
+    //*************************************************************************
+    TEST(test_publish)
+    {
+      etl::topic_broker<16, 8> broker;
+
+      Router router1(1);
+      Router router2(2);
+      Router router3(3);
+
+      CHECK(broker.subscribe("plant/+/temperature", router1));
+      CHECK(broker.subscribe("plant/line1/#", router2));
+      CHECK(broker.subscribe("plant/line2/pressure", router3));
+      CHECK_EQUAL(3U, broker.size());
+
+      CHECK_EQUAL(2U, broker.publish("plant/line1/temperature", Message1()));
+      CHECK_EQUAL(1U, broker.publish("plant/line2/temperature", Message2()));
+      CHECK_EQUAL(1U, broker.publish("plant/line2/pressure", Message1()));
+      CHECK_EQUAL(0U, broker.publish("plant/line3/pressure", Message1()));
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(1, router3.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(test_unsubscribe)
+    {
+      etl::topic_broker<16, 8> broker;
+
+      Router router1(1);
+      Router router2(2);
+
+      broker.subscribe("a/b", router1);
+      broker.subscribe("a/#", router1);
+      broker.subscribe("a/b", router2);
+
+      CHECK_EQUAL(3U, broker.publish("a/b", Message1()));
+
+      CHECK(broker.unsubscribe("a/b", router2));
+      CHECK_EQUAL(2U, broker.publish("a/b", Message1()));
+
+      CHECK_EQUAL(2U, broker.unsubscribe(router1));
+      CHECK(broker.empty());
+      CHECK_EQUAL(0U, broker.publish("a/b", Message1()));
+
+      CHECK_EQUAL(4, router1.message1_count);
+      CHECK_EQUAL(1, router2.message1_count);
+    }
+
+    //*************************************************************************
+    TEST(test_successor)
+    {
+      etl::topic_broker<16, 8> broker;
+
+      Router router1(1);
+      Router successor(2);
+
+      broker.subscribe("a", router1);
+      CHECK(!broker.has_successor());
+
+      broker.set_successor(successor);
+      CHECK(broker.has_successor());
+
+      CHECK_EQUAL(0U, broker.publish("b", Message2()));
+      CHECK_EQUAL(1U, broker.publish("a", Message1()));
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, successor.message1_count);
+      CHECK_EQUAL(1, successor.message2_count);
+
+      broker.clear_successor();
+      broker.publish("a", Message1());
+      CHECK_EQUAL(1, successor.message1_count);
+    }
+  }
+}
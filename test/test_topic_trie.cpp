@@ -0,0 +1,232 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/topic_trie.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+  typedef etl::topic_trie<int, 32, 16> Trie;
+
+  //*************************************************************************
+  struct collector
+  {
+    collector(std::vector<int>& values_)
+      : values(&values_)
+    {
+    }
+
+    void operator ()(int value)
+    {
+      values->push_back(value);
+    }
+
+    std::vector<int>* values;
+  };
+
+  //*************************************************************************
+  std::vector<int> matches(const Trie& trie, const char* topic)
+  {
+    std::vector<int> values;
+    trie.match(topic, collector(values));
+    std::sort(values.begin(), values.end());
+    return values;
+  }
+
+  //*************************************************************************
+  std::vector<int> make(int a = -1, int b = -1, int c = -1, int d = -1)
+  {
+    std::vector<int> values;
+    const int all[] = { a, b, c, d };
+
+    for (size_t i = 0U; i < 4U; ++i)
+    {
+      if (all[i] >= 0)
+      {
+        values.push_back(all[i]);
+      }
+    }
+
+    return values;
+  }
+
+  SUITE(test_topic_trie)
+  {
+    //*************************************************************************
+    TEST(test_exact_filters)
+    {
+      Trie trie;
+
+      CHECK(trie.empty());
+      CHECK(trie.subscribe("sensor/temperature", 1));
+      CHECK(trie.subscribe("sensor/humidity", 2));
+      CHECK(trie.subscribe("sensor/temperature", 3));
+      CHECK(trie.subscribe("sensor", 4));
+
+      CHECK_EQUAL(4U, trie.size());
+      CHECK_EQUAL(32U - 3U, trie.available_nodes());
+
+      CHECK(make(1, 3) == matches(trie, "sensor/temperature"));
+      CHECK(make(2)    == matches(trie, "sensor/humidity"));
+      CHECK(make(4)    == matches(trie, "sensor"));
+      CHECK(make()     == matches(trie, "sensor/temperature/inside"));
+      CHECK(make()     == matches(trie, "sensor/"));
+      CHECK(make()     == matches(trie, "other"));
+    }
+
+    //*************************************************************************
+    TEST(test_single_level_wildcard)
+    {
+      Trie trie;
+
+      trie.subscribe("home/+/temperature", 1);
+      trie.subscribe("home/+", 2);
+      trie.subscribe("+/+", 3);
+      trie.subscribe("+", 4);
+
+      CHECK(make(1)    == matches(trie, "home/kitchen/temperature"));
+      CHECK(make(2, 3) == matches(trie, "home/kitchen"));
+      CHECK(make(2, 3) == matches(trie, "home/"));
+      CHECK(make(4)    == matches(trie, "home"));
+      CHECK(make()     == matches(trie, "home/kitchen/humidity"));
+    }
+
+    //*************************************************************************
+    TEST(test_multi_level_wildcard)
+    {
+      Trie trie;
+
+      trie.subscribe("sport/tennis/#", 1);
+      trie.subscribe("sport/#", 2);
+      trie.subscribe("#", 3);
+      trie.subscribe("sport/+/player1/#", 4);
+
+      CHECK(make(1, 2, 3, 4) == matches(trie, "sport/tennis/player1"));
+      CHECK(make(1, 2, 3, 4) == matches(trie, "sport/tennis/player1/ranking"));
+      CHECK(make(1, 2, 3)    == matches(trie, "sport/tennis"));
+      CHECK(make(2, 3)       == matches(trie, "sport"));
+      CHECK(make(3)          == matches(trie, "news"));
+
+      CHECK_EQUAL(4U, trie.count_matches("sport/tennis/player1/wimbledon"));
+    }
+
+    //*************************************************************************
+    TEST(test_system_topics)
+    {
+      Trie trie;
+
+      trie.subscribe("#", 1);
+      trie.subscribe("+/info", 2);
+      trie.subscribe("$SYS/#", 3);
+      trie.subscribe("$SYS/+", 4);
+
+      CHECK(make(3, 4) == matches(trie, "$SYS/info"));
+      CHECK(make(1, 2) == matches(trie, "SYS/info"));
+    }
+
+    //*************************************************************************
+    TEST(test_unsubscribe)
+    {
+      Trie trie;
+
+      trie.subscribe("a/b/c", 1);
+      trie.subscribe("a/b", 2);
+      trie.subscribe("a/+/c", 1);
+      trie.subscribe("x/#", 1);
+
+      const size_t available = trie.available_nodes();
+
+      CHECK(!trie.unsubscribe("a/b/c", 2));
+      CHECK(!trie.unsubscribe("a/b/d", 1));
+      CHECK(trie.unsubscribe("a/b/c", 1));
+      CHECK(!trie.unsubscribe("a/b/c", 1));
+
+      // Only the unused 'c' level is removed.
+      CHECK_EQUAL(available + 1U, trie.available_nodes());
+      CHECK(make(1) == matches(trie, "a/b/c"));
+      CHECK(make(2) == matches(trie, "a/b"));
+
+      CHECK_EQUAL(2U, trie.unsubscribe(1));
+      CHECK_EQUAL(1U, trie.size());
+      CHECK(make() == matches(trie, "a/b/c"));
+      CHECK(make() == matches(trie, "x/y"));
+
+      CHECK(trie.unsubscribe("a/b", 2));
+      CHECK(trie.empty());
+      CHECK_EQUAL(32U, trie.available_nodes());
+    }
+
+    //*************************************************************************
+    TEST(test_duplicate_subscription)
+    {
+      Trie trie;
+
+      CHECK(trie.subscribe("a/b", 1));
+      CHECK(trie.subscribe("a/b", 1));
+
+      CHECK_EQUAL(1U, trie.size());
+      CHECK(make(1) == matches(trie, "a/b"));
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_filters)
+    {
+      Trie trie;
+
+      CHECK_THROW(trie.subscribe("",          1), etl::topic_trie_invalid_filter);
+      CHECK_THROW(trie.subscribe("a/#/b",     1), etl::topic_trie_invalid_filter);
+      CHECK_THROW(trie.subscribe("a/b#",      1), etl::topic_trie_invalid_filter);
+      CHECK_THROW(trie.subscribe("a+/b",      1), etl::topic_trie_invalid_filter);
+      CHECK_THROW(trie.subscribe("a/+b",      1), etl::topic_trie_invalid_filter);
+      CHECK(trie.empty());
+      CHECK_EQUAL(32U, trie.available_nodes());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::topic_trie<int, 3, 2> trie;
+
+      CHECK(trie.subscribe("a/b", 1));
+      CHECK_THROW(trie.subscribe("c/d", 2), etl::topic_trie_full);
+
+      // Nothing is allocated by a failed subscription.
+      CHECK_EQUAL(1U, trie.available_nodes());
+      CHECK(trie.subscribe("a/c", 2));
+      CHECK_THROW(trie.subscribe("a", 3), etl::topic_trie_full);
+
+      trie.clear();
+      CHECK(trie.empty());
+      CHECK_EQUAL(3U, trie.available_nodes());
+    }
+  }
+}
@@ -0,0 +1,246 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+namespace
+{
+  size_t test_channel = 0U;
+}
+
+#define ETL_TRACE
+#define ETL_TRACE_BUFFER_SIZE 8U
+#define ETL_TRACE_CHANNELS    2U
+#define ETL_TRACE_CHANNEL()   test_channel
+
+#include "etl/trace.h"
+
+#include <string>
+
+namespace
+{
+  //***************************************************************************
+  void drain()
+  {
+    etl::trace_event event;
+
+    while (etl::trace::read(event))
+    {
+    }
+
+    etl::trace::buffer().clear_dropped(0U);
+    etl::trace::buffer().clear_dropped(1U);
+  }
+
+  //***************************************************************************
+  void traced_function(uint32_t id)
+  {
+    ETL_TRACE_SCOPE(id);
+    ETL_TRACE_INSTANT(id + 1U);
+  }
+
+  //***************************************************************************
+  struct Output
+  {
+    void write(etl::string_view text)
+    {
+      result.append(text.data(), text.size());
+    }
+
+    std::string result;
+  };
+
+  //***************************************************************************
+  const char* name_of(uint32_t id)
+  {
+    switch (id)
+    {
+      case 1U: return "on_receive";
+      case 2U: return "say \"hi\"";
+      default: return ETL_NULLPTR;
+    }
+  }
+
+  //***************************************************************************
+  etl::trace_event make_event(etl::trace_timestamp_t timestamp, uint32_t id, etl::trace_event::enum_type type, uint8_t channel)
+  {
+    etl::trace_event event;
+
+    event.timestamp = timestamp;
+    event.id        = id;
+    event.type      = uint8_t(type);
+    event.channel   = channel;
+
+    return event;
+  }
+
+  SUITE(test_trace)
+  {
+    //*************************************************************************
+    TEST(test_scope_records_begin_and_end)
+    {
+      etl::trace::start();
+      drain();
+      test_channel = 0U;
+
+      traced_function(10U);
+
+      etl::trace_event begin;
+      etl::trace_event instant;
+      etl::trace_event end;
+
+      CHECK(etl::trace::read(begin));
+      CHECK(etl::trace::read(instant));
+      CHECK(etl::trace::read(end));
+      CHECK(!etl::trace::read(end));
+
+      CHECK_EQUAL(10U, begin.id);
+      CHECK_EQUAL(int(etl::trace_event::Begin), int(begin.type));
+      CHECK_EQUAL(11U, instant.id);
+      CHECK_EQUAL(int(etl::trace_event::Instant), int(instant.type));
+      CHECK_EQUAL(10U, end.id);
+      CHECK_EQUAL(int(etl::trace_event::End), int(end.type));
+      CHECK_EQUAL(0, int(begin.channel));
+      CHECK(etl::cycle_counter::elapsed(begin.timestamp, end.timestamp) <= etl::cycle_counter::max_elapsed());
+    }
+
+    //*************************************************************************
+    TEST(test_begin_end_on_channels)
+    {
+      drain();
+
+      test_channel = 1U;
+      ETL_TRACE_BEGIN(5U);
+      test_channel = 0U;
+      ETL_TRACE_END(6U);
+
+      etl::trace_event event;
+
+      CHECK(etl::trace::buffer().read(1U, event));
+      CHECK_EQUAL(5U, event.id);
+      CHECK_EQUAL(1, int(event.channel));
+      CHECK(!etl::trace::buffer().read(1U, event));
+
+      CHECK(etl::trace::buffer().read(0U, event));
+      CHECK_EQUAL(6U, event.id);
+      CHECK_EQUAL(0, int(event.channel));
+
+      // Out of range.
+      test_channel = 2U;
+      ETL_TRACE_INSTANT(7U);
+      CHECK(!etl::trace::read(event));
+      test_channel = 0U;
+    }
+
+    //*************************************************************************
+    TEST(test_full_channel_counts_dropped_events)
+    {
+      drain();
+
+      for (uint32_t i = 0U; i < 10U; ++i)
+      {
+        ETL_TRACE_INSTANT(i);
+      }
+
+      CHECK_EQUAL(2U, etl::trace::buffer().dropped(0U));
+      CHECK_EQUAL(0U, etl::trace::buffer().dropped(1U));
+
+      etl::trace_event event;
+      uint32_t expected = 0U;
+
+      while (etl::trace::read(event))
+      {
+        CHECK_EQUAL(expected, event.id);
+        ++expected;
+      }
+
+      CHECK_EQUAL(8U, expected);
+    }
+
+    //*************************************************************************
+    TEST(test_trace_buffer_with_timestamps)
+    {
+      etl::trace_buffer<4U, 1U> buffer;
+
+      CHECK(buffer.record(0U, 1U, etl::trace_event::Begin, 100U));
+      CHECK(!buffer.record(1U, 1U, etl::trace_event::Begin, 100U));
+
+      etl::trace_event event;
+
+      CHECK(buffer.read(event));
+      CHECK_EQUAL(100U, event.timestamp);
+      CHECK(!buffer.read(0U, event));
+    }
+
+    //*************************************************************************
+    TEST(test_chrome_writer)
+    {
+      Output output;
+      etl::trace_chrome_writer<2U> writer(etl::trace_chrome_writer<2U>::output_type::create<Output, &Output::write>(output), 1000000U);
+
+      writer.set_names(etl::trace_chrome_writer<2U>::name_type::create<name_of>());
+
+      writer.begin();
+      CHECK(writer.write(make_event(1000U, 1U, etl::trace_event::Begin, 0U)));
+      CHECK(writer.write(make_event(1250U, 2U, etl::trace_event::Instant, 0U)));
+      CHECK(writer.write(make_event(900U, 3U, etl::trace_event::Begin, 1U)));
+      CHECK(writer.write(make_event(2500U, 1U, etl::trace_event::End, 0U)));
+      CHECK(!writer.write(make_event(2500U, 1U, etl::trace_event::End, 2U)));
+      writer.end();
+
+      std::string expected = "{\"traceEvents\":["
+                             "\n{\"name\":\"on_receive\",\"ph\":\"B\",\"ts\":0.000,\"pid\":0,\"tid\":0},"
+                             "\n{\"name\":\"say \\\"hi\\\"\",\"ph\":\"i\",\"ts\":250.000,\"pid\":0,\"tid\":0,\"s\":\"t\"},"
+                             "\n{\"name\":\"3\",\"ph\":\"B\",\"ts\":-100.000,\"pid\":0,\"tid\":1},"
+                             "\n{\"name\":\"on_receive\",\"ph\":\"E\",\"ts\":1500.000,\"pid\":0,\"tid\":0}"
+                             "\n]}\n";
+
+      CHECK_EQUAL(expected, output.result);
+    }
+
+    //*************************************************************************
+    TEST(test_chrome_writer_unwraps_down_counter)
+    {
+      Output output;
+      etl::trace_chrome_writer<> writer(etl::trace_chrome_writer<>::output_type::create<Output, &Output::write>(output), 3000U, 0x00FFFFFFU, true);
+
+      writer.begin();
+      writer.write(make_event(0x00000010U, 1U, etl::trace_event::Begin, 0U));
+      writer.write(make_event(0x00FFFFFFU, 1U, etl::trace_event::End, 0U));
+      writer.end();
+
+      // 17 ticks at 3kHz is 5666.666us.
+      std::string expected = "{\"traceEvents\":["
+                             "\n{\"name\":\"1\",\"ph\":\"B\",\"ts\":0.000,\"pid\":0,\"tid\":0},"
+                             "\n{\"name\":\"1\",\"ph\":\"E\",\"ts\":5666.666,\"pid\":0,\"tid\":0}"
+                             "\n]}\n";
+
+      CHECK_EQUAL(expected, output.result);
+    }
+  };
+}
@@ -0,0 +1,402 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/transcode.h"
+#include "etl/string.h"
+#include "etl/wstring.h"
+#include "etl/u8string.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+
+#include <string.h>
+
+namespace
+{
+  // "héllo € \U0001F600"
+  const char           text_utf8[]  = "h\xC3\xA9llo \xE2\x82\xAC \xF0\x9F\x98\x80";
+  const char16_t       text_utf16[] = { u'h', 0x00E9U, u'l', u'l', u'o', u' ', 0x20ACU, u' ', 0xD83DU, 0xDE00U };
+  const char32_t       text_utf32[] = { U'h', 0x00E9U, U'l', U'l', U'o', U' ', 0x20ACU, U' ', 0x1F600U };
+
+  const size_t text_utf8_length  = sizeof(text_utf8) - 1U;
+  const size_t text_utf16_length = sizeof(text_utf16) / sizeof(char16_t);
+  const size_t text_utf32_length = sizeof(text_utf32) / sizeof(char32_t);
+
+  //*************************************************************************
+  // Sequences that break each of the rules in Unicode Table 3-7.
+  struct invalid_utf8
+  {
+    const char* text;
+    size_t      length;
+    size_t      position;
+    size_t      written;
+  };
+
+  const invalid_utf8 invalid_utf8_sequences[] =
+  {
+    { "ab\x80",             3U, 2U, 2U }, // Stray continuation.
+    { "ab\xC0\x80",         4U, 2U, 2U }, // Overlong two byte.
+    { "ab\xC1\xBF",         4U, 2U, 2U }, // Overlong two byte.
+    { "ab\xE0\x80\x80",     5U, 2U, 2U }, // Overlong three byte.
+    { "ab\xE0\x9F\xBF",     5U, 2U, 2U }, // Overlong three byte.
+    { "ab\xED\xA0\x80",     5U, 2U, 2U }, // Surrogate.
+    { "ab\xED\xBF\xBF",     5U, 2U, 2U }, // Surrogate.
+    { "ab\xF0\x80\x80\x80", 6U, 2U, 2U }, // Overlong four byte.
+    { "ab\xF0\x8F\xBF\xBF", 6U, 2U, 2U }, // Overlong four byte.
+    { "ab\xF4\x90\x80\x80", 6U, 2U, 2U }, // Above U+10FFFF.
+    { "ab\xF5\x80\x80\x80", 6U, 2U, 2U }, // Above U+10FFFF.
+    { "ab\xFF",             3U, 2U, 2U }, // Never used.
+    { "ab\xC3\x41",         4U, 2U, 2U }, // Missing continuation.
+    { "ab\xE2\x82\x41",     5U, 2U, 2U }, // Missing continuation.
+    { "ab\xC3\xA9\xA9",     5U, 4U, 3U }, // Extra continuation.
+  };
+
+  //*************************************************************************
+  // A long enough mix of text to use the vector paths.
+  template <typename TString>
+  void fill_ascii(TString& s, size_t length)
+  {
+    for (size_t i = 0U; i < length; ++i)
+    {
+      s.push_back(static_cast<typename TString::value_type>('a' + (i % 26U)));
+    }
+  }
+
+  SUITE(test_transcode)
+  {
+    //*************************************************************************
+    TEST(test_is_valid)
+    {
+      CHECK_TRUE(etl::is_valid_utf8(text_utf8, text_utf8_length));
+      CHECK_TRUE(etl::is_valid_utf16(text_utf16, text_utf16_length));
+      CHECK_TRUE(etl::is_valid_utf32(text_utf32, text_utf32_length));
+
+      CHECK_TRUE(etl::is_valid_utf8(etl::string_view(text_utf8)));
+      CHECK_TRUE(etl::is_valid_utf8(text_utf8, 0U));
+
+      CHECK_FALSE(etl::is_valid_utf8(text_utf8, 2U));  // Ends part way through U+00E9.
+      CHECK_FALSE(etl::is_valid_utf16(text_utf16, text_utf16_length - 1U));
+
+      for (size_t i = 0U; i < (sizeof(invalid_utf8_sequences) / sizeof(invalid_utf8)); ++i)
+      {
+        CHECK_FALSE(etl::is_valid_utf8(invalid_utf8_sequences[i].text, invalid_utf8_sequences[i].length));
+      }
+
+      const char16_t lone_low[]     = { u'a', 0xDC00U, u'b' };
+      const char16_t unpaired[]     = { u'a', 0xD800U, u'b' };
+      const char32_t surrogate[]    = { U'a', 0xD800U };
+      const char32_t out_of_range[] = { U'a', 0x110000UL };
+      const char32_t maximum[]      = { U'a', 0x10FFFFUL };
+
+      CHECK_FALSE(etl::is_valid_utf16(lone_low, 3U));
+      CHECK_FALSE(etl::is_valid_utf16(unpaired, 3U));
+      CHECK_FALSE(etl::is_valid_utf32(surrogate, 2U));
+      CHECK_FALSE(etl::is_valid_utf32(out_of_range, 2U));
+      CHECK_TRUE(etl::is_valid_utf32(maximum, 2U));
+    }
+
+    //*************************************************************************
+    TEST(test_is_valid_utf8_matches_decoder)
+    {
+      // Place every pair of bytes, and a spread of longer sequences, across
+      // the vector boundaries and compare with the scalar decoder.
+      const size_t offsets[] = { 0U, 13U, 14U, 15U, 30U, 31U, 37U };
+
+      char buffer[40];
+
+      for (size_t o = 0U; o < (sizeof(offsets) / sizeof(size_t)); ++o)
+      {
+        for (int b0 = 0x00; b0 <= 0xFF; ++b0)
+        {
+          for (int b1 = 0x00; b1 <= 0xFF; ++b1)
+          {
+            memset(buffer, 'a', sizeof(buffer));
+            buffer[offsets[o]] = static_cast<char>(b0);
+
+            const size_t length = etl::min(sizeof(buffer), offsets[o] + 2U);
+
+            if ((offsets[o] + 1U) < sizeof(buffer))
+            {
+              buffer[offsets[o] + 1U] = static_cast<char>(b1);
+            }
+
+            CHECK_EQUAL(etl::private_transcode::is_valid(buffer, length),   etl::is_valid_utf8(buffer, length));
+            CHECK_EQUAL(etl::private_transcode::is_valid(buffer, sizeof(buffer)), etl::is_valid_utf8(buffer, sizeof(buffer)));
+          }
+        }
+      }
+
+      const int continuations[] = { 0x41, 0x7F, 0x80, 0x8F, 0x90, 0x9F, 0xA0, 0xBF, 0xC0 };
+      const size_t n = sizeof(continuations) / sizeof(int);
+
+      for (size_t o = 0U; o < (sizeof(offsets) / sizeof(size_t)); ++o)
+      {
+        for (int b0 = 0xC0; b0 <= 0xFF; ++b0)
+        {
+          for (size_t i1 = 0U; i1 < n; ++i1)
+          {
+            for (size_t i2 = 0U; i2 < n; ++i2)
+            {
+              for (size_t i3 = 0U; i3 < n; ++i3)
+              {
+                memset(buffer, 'a', sizeof(buffer));
+
+                const int bytes[4] = { b0, continuations[i1], continuations[i2], continuations[i3] };
+
+                for (size_t k = 0U; (k < 4U) && ((offsets[o] + k) < sizeof(buffer)); ++k)
+                {
+                  buffer[offsets[o] + k] = static_cast<char>(bytes[k]);
+                }
+
+                CHECK_EQUAL(etl::private_transcode::is_valid(buffer, sizeof(buffer)), etl::is_valid_utf8(buffer, sizeof(buffer)));
+              }
+            }
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_utf8_to_utf16_and_utf32)
+    {
+      etl::u16string<20> s16;
+      etl::u32string<20> s32;
+
+      etl::transcode_result result16 = etl::transcode(etl::string_view(text_utf8), s16);
+      etl::transcode_result result32 = etl::transcode(etl::string_view(text_utf8), s32);
+
+      CHECK_TRUE(result16.succeeded());
+      CHECK_EQUAL(text_utf8_length,  result16.read);
+      CHECK_EQUAL(text_utf16_length, result16.written);
+      CHECK_TRUE(etl::u16string_view(text_utf16, text_utf16_length) == s16);
+
+      CHECK_TRUE(result32.succeeded());
+      CHECK_EQUAL(text_utf8_length,  result32.read);
+      CHECK_EQUAL(text_utf32_length, result32.written);
+      CHECK_TRUE(etl::u32string_view(text_utf32, text_utf32_length) == s32);
+    }
+
+    //*************************************************************************
+    TEST(test_utf16_and_utf32_to_utf8)
+    {
+      etl::string<20> from16;
+      etl::string<20> from32;
+
+      etl::transcode_result result16 = etl::transcode(text_utf16, text_utf16_length, from16);
+      etl::transcode_result result32 = etl::transcode(text_utf32, text_utf32_length, from32);
+
+      CHECK_TRUE(result16.succeeded());
+      CHECK_EQUAL(text_utf16_length, result16.read);
+      CHECK_EQUAL(text_utf8_length,  result16.written);
+      CHECK_TRUE(etl::string_view(text_utf8) == from16);
+
+      CHECK_TRUE(result32.succeeded());
+      CHECK_EQUAL(text_utf32_length, result32.read);
+      CHECK_EQUAL(text_utf8_length,  result32.written);
+      CHECK_TRUE(etl::string_view(text_utf8) == from32);
+    }
+
+    //*************************************************************************
+    TEST(test_utf16_to_utf32_round_trip)
+    {
+      etl::u32string<20> s32;
+      etl::u16string<20> s16;
+
+      CHECK_TRUE(etl::transcode(text_utf16, text_utf16_length, s32).succeeded());
+      CHECK_TRUE(etl::transcode(s32, s16).succeeded());
+
+      CHECK_TRUE(etl::u32string_view(text_utf32, text_utf32_length) == s32);
+      CHECK_TRUE(etl::u16string_view(text_utf16, text_utf16_length) == s16);
+    }
+
+    //*************************************************************************
+    TEST(test_wide_string)
+    {
+      etl::wstring<20> wide;
+      etl::string<20>  narrow;
+
+      CHECK_TRUE(etl::transcode(etl::string_view(text_utf8), wide).succeeded());
+      CHECK_TRUE(etl::transcode(wide, narrow).succeeded());
+      CHECK_TRUE(etl::string_view(text_utf8) == narrow);
+      CHECK_EQUAL((sizeof(wchar_t) == 2U) ? text_utf16_length : text_utf32_length, wide.size());
+    }
+
+#if ETL_HAS_CHAR8_T
+    //*************************************************************************
+    TEST(test_u8string)
+    {
+      etl::u8string<20>  s8;
+      etl::u32string<20> s32;
+
+      CHECK_TRUE(etl::transcode(text_utf32, text_utf32_length, s8).succeeded());
+      CHECK_EQUAL(text_utf8_length, s8.size());
+      CHECK_TRUE(etl::is_valid_utf8(etl::u8string_view(s8.data(), s8.size())));
+
+      CHECK_TRUE(etl::transcode(s8, s32).succeeded());
+      CHECK_TRUE(etl::u32string_view(text_utf32, text_utf32_length) == s32);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_long_ascii)
+    {
+      etl::string<200>    source;
+      etl::u16string<200> s16;
+      etl::u32string<200> s32;
+      etl::string<200>    s8;
+
+      fill_ascii(source, 150U);
+      source[97] = '\xC3';
+      source[98] = '\xA9';
+
+      CHECK_TRUE(etl::is_valid_utf8(source.data(), source.size()));
+      CHECK_TRUE(etl::transcode(source, s16).succeeded());
+      CHECK_TRUE(etl::transcode(s16, s32).succeeded());
+      CHECK_TRUE(etl::transcode(s32, s8).succeeded());
+
+      CHECK_EQUAL(149U, s16.size());
+      CHECK_EQUAL(149U, s32.size());
+      CHECK_EQUAL(0x00E9U, s32[97]);
+      CHECK_TRUE(source == s8);
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      etl::u16string<20> s16(u"ab");
+
+      etl::transcode_result result = etl::transcode(etl::string_view("cd"), s16);
+
+      CHECK_TRUE(result.succeeded());
+      CHECK_EQUAL(2U, result.written);
+      CHECK_TRUE(etl::u16string_view(u"abcd") == s16);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid)
+    {
+      for (size_t i = 0U; i < (sizeof(invalid_utf8_sequences) / sizeof(invalid_utf8)); ++i)
+      {
+        etl::u32string<20> s32;
+
+        etl::transcode_result result = etl::transcode(invalid_utf8_sequences[i].text, invalid_utf8_sequences[i].length, s32);
+
+        CHECK_EQUAL(etl::transcode_status::Invalid, result.status);
+        CHECK_EQUAL(invalid_utf8_sequences[i].position, result.read);
+        CHECK_EQUAL(invalid_utf8_sequences[i].written, result.written);
+        CHECK_EQUAL(invalid_utf8_sequences[i].written, s32.size());
+      }
+
+      const char16_t lone_low[] = { u'a', 0xDC00U, u'b' };
+      etl::string<20> s8;
+
+      etl::transcode_result result = etl::transcode(lone_low, 3U, s8);
+
+      CHECK_EQUAL(etl::transcode_status::Invalid, result.status);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_TRUE(etl::string_view("a") == s8);
+    }
+
+    //*************************************************************************
+    TEST(test_incomplete)
+    {
+      etl::u16string<20> s16;
+
+      etl::transcode_result result = etl::transcode("ab\xF0\x9F\x98", 5U, s16);
+
+      CHECK_EQUAL(etl::transcode_status::Incomplete, result.status);
+      CHECK_EQUAL(2U, result.read);
+      CHECK_EQUAL(2U, result.written);
+
+      // Resume once the rest has arrived.
+      result = etl::transcode(text_utf8 + 11U, 4U, s16);
+
+      CHECK_TRUE(result.succeeded());
+      CHECK_EQUAL(2U, result.written);
+      CHECK_EQUAL(0xD83DU, s16[2]);
+      CHECK_EQUAL(0xDE00U, s16[3]);
+
+      const char16_t high_only[] = { u'a', 0xD83DU };
+      etl::string<20> s8;
+
+      result = etl::transcode(high_only, 2U, s8);
+
+      CHECK_EQUAL(etl::transcode_status::Incomplete, result.status);
+      CHECK_EQUAL(1U, result.read);
+    }
+
+    //*************************************************************************
+    TEST(test_truncated)
+    {
+      // ASCII run cut short.
+      etl::u16string<4> s16;
+
+      etl::transcode_result result = etl::transcode(etl::string_view("abcdef"), s16);
+
+      CHECK_EQUAL(etl::transcode_status::Truncated, result.status);
+      CHECK_EQUAL(4U, result.read);
+      CHECK_EQUAL(4U, result.written);
+      CHECK_TRUE(etl::u16string_view(u"abcd") == s16);
+
+      // A code point that does not fit is not split.
+      etl::string<3> s8;
+
+      result = etl::transcode(text_utf32 + 5U, 2U, s8); // " €"
+
+      CHECK_EQUAL(etl::transcode_status::Truncated, result.status);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_EQUAL(1U, result.written);
+      CHECK_TRUE(etl::string_view(" ") == s8);
+
+      // Neither is a surrogate pair.
+      etl::u16string<2> pair;
+
+      result = etl::transcode(text_utf32 + 7U, 2U, pair); // " \U0001F600"
+
+      CHECK_EQUAL(etl::transcode_status::Truncated, result.status);
+      CHECK_EQUAL(1U, result.read);
+      CHECK_EQUAL(1U, pair.size());
+
+      // Nothing fits.
+      etl::u32string<2> full(U"xy");
+
+      result = etl::transcode(etl::string_view("a"), full);
+
+      CHECK_EQUAL(etl::transcode_status::Truncated, result.status);
+      CHECK_EQUAL(0U, result.read);
+      CHECK_EQUAL(0U, result.written);
+    }
+
+    //*************************************************************************
+    TEST(test_status_names)
+    {
+      CHECK_EQUAL(std::string("Truncated"), std::string(etl::transcode_status(etl::transcode_status::Truncated).c_str()));
+    }
+  };
+}
@@ -780,6 +780,122 @@ namespace
       CHECK_EQUAL(0x12, bev0);
       CHECK_EQUAL(0x34, bev1);
     }
+
+    //*************************************************************************
+    TEST(test_unaligned_span_copy_to_be_uint16)
+    {
+      // An odd number of values, misaligned in the buffer, to exercise both the bulk and remainder copies.
+      const size_t Size = 37U;
+      unsigned char buffer[1U + (Size * 2U)];
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        buffer[1U + (i * 2U)]      = static_cast<unsigned char>(i);
+        buffer[1U + (i * 2U) + 1U] = static_cast<unsigned char>(0x80U + i);
+      }
+
+      etl::unaligned_span<const uint16_t, etl::endian::big> values(buffer + 1U, Size);
+
+      uint16_t output[Size];
+      CHECK_EQUAL(Size, values.copy_to(etl::span<uint16_t>(output)));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        const uint16_t expected = static_cast<uint16_t>((i << 8U) | (0x80U + i));
+        CHECK_EQUAL(expected, output[i]);
+        CHECK_EQUAL(expected, values[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_span_copy_from_round_trip)
+    {
+      const size_t Size = 21U;
+
+      uint32_t input[Size];
+      uint64_t input64[Size];
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        input[i]   = static_cast<uint32_t>(0x01020304UL * (i + 1U));
+        input64[i] = static_cast<uint64_t>(0x0102030405060708ULL * (i + 1U));
+      }
+
+      etl::be_uint32_t be[Size];
+      etl::le_uint32_t le[Size];
+      etl::be_uint64_t be64[Size];
+
+      etl::unaligned_span<uint32_t, etl::endian::big>    be_span(be);
+      etl::unaligned_span<uint32_t, etl::endian::little> le_span(le);
+      etl::unaligned_span<uint64_t, etl::endian::big>    be64_span(be64);
+
+      CHECK_EQUAL(Size, be_span.copy_from(etl::span<uint32_t>(input)));
+      CHECK_EQUAL(Size, le_span.copy_from(etl::span<const uint32_t>(input)));
+      CHECK_EQUAL(Size, be64_span.copy_from(etl::span<uint64_t>(input64)));
+
+      for (size_t i = 0U; i < Size; ++i)
+      {
+        CHECK_EQUAL(input[i], be[i].value());
+        CHECK_EQUAL(input[i], le[i].value());
+        CHECK_EQUAL(input64[i], be64[i].value());
+        CHECK_EQUAL(static_cast<unsigned char>(input[i] >> 24U), be[i][0]);
+        CHECK_EQUAL(static_cast<unsigned char>(input[i]), le[i][0]);
+      }
+
+      uint32_t output[Size];
+      CHECK_EQUAL(Size, be_span.copy_to(etl::span<uint32_t>(output)));
+      CHECK_ARRAY_EQUAL(input, output, Size);
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_span_partial_copies)
+    {
+      etl::be_int16_t values[4] = { 1, -2, 3, -4 };
+
+      etl::unaligned_span<int16_t, etl::endian::big> span(values);
+
+      CHECK_EQUAL(4U, span.size());
+      CHECK_EQUAL(8U, span.size_bytes());
+      CHECK_FALSE(span.empty());
+      CHECK(span.data() == values[0].data());
+
+      int16_t small[2];
+      CHECK_EQUAL(2U, span.copy_to(etl::span<int16_t>(small)));
+      CHECK_EQUAL(1,  small[0]);
+      CHECK_EQUAL(-2, small[1]);
+
+      int16_t large[6] = { 0, 0, 0, 0, 0, 0 };
+      CHECK_EQUAL(4U, span.copy_to(etl::span<int16_t>(large)));
+      CHECK_EQUAL(-4, large[3]);
+      CHECK_EQUAL(0,  large[4]);
+
+      const int16_t replacement[2] = { 10, -20 };
+      CHECK_EQUAL(2U, span.subspan(2U).copy_from(etl::span<const int16_t>(replacement)));
+      CHECK_EQUAL(1,   values[0].value());
+      CHECK_EQUAL(10,  values[2].value());
+      CHECK_EQUAL(-20, values[3].value());
+
+      span.set(1U, 100);
+      CHECK_EQUAL(100, values[1].value());
+      CHECK_EQUAL(100, span[1U]);
+
+      CHECK_EQUAL(2U, span.subspan(1U, 2U).size());
+      CHECK_EQUAL(10, span.subspan(1U, 2U)[1U]);
+    }
+
+    //*************************************************************************
+    TEST(test_unaligned_span_from_bytes)
+    {
+      unsigned char bytes[7] = { 0x3F, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00 };
+
+      etl::unaligned_span<float, etl::endian::big> span(etl::span<unsigned char>(bytes, 7U));
+
+      CHECK_EQUAL(1U, span.size());
+
+      float output[1];
+      CHECK_EQUAL(1U, span.copy_to(etl::span<float>(output)));
+      CHECK_CLOSE(1.0f, output[0], 0.0001f);
+    }
   };
 }
 
@@ -44,6 +44,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_map.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
 #include "etl/hash.h"
 
 namespace
@@ -194,6 +196,49 @@ namespace
     int id;
   };
 
+  //***************************************************************************
+  // Hashes and compares strings and string views without conversion.
+  struct transparent_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator ()(etl::string_view text) const
+    {
+      return etl::hash<etl::string_view>()(text);
+    }
+
+    size_t operator ()(const etl::istring& text) const
+    {
+      return etl::hash<etl::string_view>()(etl::string_view(text.data(), text.size()));
+    }
+  };
+
+  //***************************************************************************
+  struct transparent_equal
+  {
+    typedef int is_transparent;
+
+    bool operator ()(etl::string_view lhs, etl::string_view rhs) const
+    {
+      return lhs == rhs;
+    }
+
+    bool operator ()(const etl::istring& lhs, etl::string_view rhs) const
+    {
+      return etl::string_view(lhs.data(), lhs.size()) == rhs;
+    }
+
+    bool operator ()(etl::string_view lhs, const etl::istring& rhs) const
+    {
+      return lhs == etl::string_view(rhs.data(), rhs.size());
+    }
+
+    bool operator ()(const etl::istring& lhs, const etl::istring& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
   SUITE(test_unordered_map)
   {
     static const size_t SIZE = 10;
@@ -1193,5 +1238,41 @@ namespace
       using Map = etl::unordered_map<int, int, 1, 1>;
       CHECK((!std::is_same<typename Map::const_iterator::value_type, typename Map::iterator::value_type>::value));
     }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_map<etl::string<32>, int, 10, 10, transparent_hash, transparent_equal> Map;
+
+      Map data;
+      data[etl::string<32>("one")]   = 1;
+      data[etl::string<32>("two")]   = 2;
+      data[etl::string<32>("three")] = 3;
+
+      const Map& cdata = data;
+
+      etl::string_view two("two");
+      etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK_EQUAL(2, data.find(two)->second);
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+
+      CHECK_EQUAL(1U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+
+      CHECK(data.contains(two));
+      CHECK(!data.contains(four));
+      CHECK(data.contains(etl::string<32>("one")));
+
+      ETL_OR_STD::pair<Map::iterator, Map::iterator> range = data.equal_range(two);
+      CHECK_EQUAL(1, std::distance(range.first, range.second));
+      CHECK_EQUAL(2, range.first->second);
+
+      ETL_OR_STD::pair<Map::const_iterator, Map::const_iterator> crange = cdata.equal_range(four);
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
   };
 }
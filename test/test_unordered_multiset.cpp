@@ -41,6 +41,8 @@ SOFTWARE.
 #include "data.h"
 
 #include "etl/unordered_multiset.h"
+#include "etl/string.h"
+#include "etl/string_view.h"
 #include "etl/checksum.h"
 
 namespace
@@ -135,6 +137,49 @@ namespace
     }
   };
 
+  //***************************************************************************
+  // Hashes and compares strings and string views without conversion.
+  struct transparent_hash
+  {
+    typedef int is_transparent;
+
+    size_t operator ()(etl::string_view text) const
+    {
+      return etl::hash<etl::string_view>()(text);
+    }
+
+    size_t operator ()(const etl::istring& text) const
+    {
+      return etl::hash<etl::string_view>()(etl::string_view(text.data(), text.size()));
+    }
+  };
+
+  //***************************************************************************
+  struct transparent_equal
+  {
+    typedef int is_transparent;
+
+    bool operator ()(etl::string_view lhs, etl::string_view rhs) const
+    {
+      return lhs == rhs;
+    }
+
+    bool operator ()(const etl::istring& lhs, etl::string_view rhs) const
+    {
+      return etl::string_view(lhs.data(), lhs.size()) == rhs;
+    }
+
+    bool operator ()(etl::string_view lhs, const etl::istring& rhs) const
+    {
+      return lhs == etl::string_view(rhs.data(), rhs.size());
+    }
+
+    bool operator ()(const etl::istring& lhs, const etl::istring& rhs) const
+    {
+      return lhs == rhs;
+    }
+  };
+
   SUITE(test_unordered_multiset)
   {
     static const size_t SIZE = 10;
@@ -929,5 +974,40 @@ namespace
         CHECK_EQUAL(std::distance(range.first, range.second), 3);
       }
     }
+
+    //*************************************************************************
+    TEST(test_transparent_lookup)
+    {
+      typedef etl::unordered_multiset<etl::string<32>, 10, 10, transparent_hash, transparent_equal> Set;
+
+      Set data;
+      data.insert(etl::string<32>("one"));
+      data.insert(etl::string<32>("two"));
+      data.insert(etl::string<32>("two"));
+      data.insert(etl::string<32>("three"));
+
+      const Set& cdata = data;
+
+      etl::string_view two("two");
+      etl::string_view four("four");
+
+      CHECK(data.find(two) != data.end());
+      CHECK(cdata.find(two) != cdata.end());
+      CHECK(data.find(four) == data.end());
+
+      CHECK_EQUAL(2U, data.count(two));
+      CHECK_EQUAL(0U, data.count(four));
+
+      CHECK(data.contains(two));
+      CHECK(!data.contains(four));
+      CHECK(data.contains(etl::string<32>("one")));
+
+      ETL_OR_STD::pair<Set::iterator, Set::iterator> range = data.equal_range(two);
+      CHECK_EQUAL(2, std::distance(range.first, range.second));
+
+      ETL_OR_STD::pair<Set::const_iterator, Set::const_iterator> crange = cdata.equal_range(four);
+      CHECK(crange.first == cdata.end());
+      CHECK(crange.second == cdata.end());
+    }
   };
 }
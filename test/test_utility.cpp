@@ -665,5 +665,16 @@ namespace
       CHECK_EQUAL(forward_like_call_type::ConstRValue, template_function_fl<TFL&&>(etl::move(u4)));
       CHECK_EQUAL(forward_like_call_type::ConstRValue, template_function_fl<const TFL&&>(etl::move(u4)));
     }
+
+    //*************************************************************************
+    TEST(test_make_index_sequence)
+    {
+      CHECK((std::is_same<etl::index_sequence<>, etl::make_index_sequence<0>>::value));
+      CHECK((std::is_same<etl::index_sequence<0>, etl::make_index_sequence<1>>::value));
+      CHECK((std::is_same<etl::index_sequence<0, 1, 2, 3, 4, 5, 6>, etl::make_index_sequence<7>>::value));
+
+      // Deeper than the default template instantiation limit.
+      CHECK_EQUAL(5000U, etl::make_index_sequence<5000>::size());
+    }
   };
 }
@@ -31,6 +31,7 @@ SOFTWARE.
 #include "etl/variance.h"
 
 #include <array>
+#include <vector>
 
 namespace
 {
@@ -142,5 +143,158 @@ namespace
       variance_result = variance1.get_variance();
       CHECK_CLOSE(9.17, variance_result, 0.1);
     }
+
+    //*************************************************************************
+    TEST(test_variance_block_add_matches_single_values)
+    {
+      std::vector<float>   samples_f;
+      std::vector<double>  samples_d;
+      std::vector<int16_t> samples_i16;
+
+      uint32_t seed = 12345U;
+
+      for (size_t i = 0U; i < 1003U; ++i)
+      {
+        seed = (seed * 1103515245U) + 12345U;
+        const int16_t sample = int16_t(seed >> 16);
+
+        samples_i16.push_back(sample);
+        samples_f.push_back(float(sample) / 32768.0f);
+        samples_d.push_back(double(sample) / 32768.0);
+      }
+
+      for (size_t length = 0U; length <= samples_f.size(); length += ((length < 40U) ? 1U : 321U))
+      {
+        etl::variance<etl::variance_type::Population, float> single_f(samples_f.begin(), samples_f.begin() + length);
+        etl::variance<etl::variance_type::Population, float> block_f;
+        block_f.add(etl::span<const float>(samples_f.data(), length));
+        CHECK_EQUAL(single_f.count(), block_f.count());
+        CHECK_CLOSE(single_f.get_variance(), block_f.get_variance(), 1e-4);
+
+        etl::variance<etl::variance_type::Population, double> single_d(samples_d.begin(), samples_d.begin() + length);
+        etl::variance<etl::variance_type::Population, double> block_d;
+        block_d.add(etl::span<const double>(samples_d.data(), length));
+        CHECK_CLOSE(single_d.get_variance(), block_d.get_variance(), 1e-9);
+
+        etl::variance<etl::variance_type::Population, int16_t, int64_t> single_i16(samples_i16.begin(), samples_i16.begin() + length);
+        etl::variance<etl::variance_type::Population, int16_t, int64_t> block_i16;
+        block_i16.add(etl::span<const int16_t>(samples_i16.data(), length));
+        CHECK_EQUAL(single_i16.get_variance(), block_i16.get_variance());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_constructor)
+    {
+      etl::welford_variance<etl::variance_type::Population, char> variance_c(input_c.begin(), input_c.end());
+      CHECK_CLOSE(8.25, variance_c.get_variance(), 0.01);
+      CHECK_CLOSE(4.5, variance_c.get_mean(), 0.01);
+
+      etl::welford_variance<etl::variance_type::Sample, float> variance_f(input_f.begin(), input_f.end());
+      CHECK_CLOSE(9.17, variance_f.get_variance(), 0.01);
+
+      etl::welford_variance<etl::variance_type::Sample, double> variance_d(input_d.begin(), input_d.end());
+      CHECK_CLOSE(9.17, variance_d.get_variance(), 0.01);
+      CHECK_EQUAL(10U, variance_d.count());
+
+      etl::welford_variance<etl::variance_type::Sample, double> variance_empty;
+      CHECK_CLOSE(0.0, variance_empty.get_variance(), 0.01);
+      variance_empty.add(1.0);
+      CHECK_CLOSE(0.0, variance_empty.get_variance(), 0.01);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_float_long_run_with_offset)
+    {
+      etl::welford_variance<etl::variance_type::Population, float> variance;
+
+      // Values 10000 to 10009, so the raw sum of squares overwhelms a float.
+      for (size_t i = 0U; i < 100000U; ++i)
+      {
+        variance.add(10000.0f + float(i % 10U));
+      }
+
+      CHECK_CLOSE(8.25, variance.get_variance(), 0.1);
+      CHECK_CLOSE(10004.5, variance.get_mean(), 0.1);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_merge)
+    {
+      std::vector<double> samples;
+
+      for (size_t i = 0U; i < 1000U; ++i)
+      {
+        samples.push_back(double((i * 7919U) % 1013U) * 0.25);
+      }
+
+      etl::welford_variance<etl::variance_type::Sample, double> whole(samples.begin(), samples.end());
+
+      // Four partial results, as if from separate cores.
+      etl::welford_variance<etl::variance_type::Sample, double> part1(samples.begin(),       samples.begin() + 1);
+      etl::welford_variance<etl::variance_type::Sample, double> part2(samples.begin() + 1,   samples.begin() + 400);
+      etl::welford_variance<etl::variance_type::Sample, double> part3(samples.begin() + 400, samples.begin() + 400);
+      etl::welford_variance<etl::variance_type::Sample, double> part4(samples.begin() + 400, samples.end());
+
+      etl::welford_variance<etl::variance_type::Sample, double> merged;
+      merged.merge(part1);
+      merged.merge(part2);
+      merged.merge(part3);
+      merged.merge(part4);
+
+      CHECK_EQUAL(whole.count(), merged.count());
+      CHECK_CLOSE(whole.get_variance(), merged.get_variance(), 1e-9);
+      CHECK_CLOSE(whole.get_mean(), merged.get_mean(), 1e-9);
+
+      // The raw sum variance merges too.
+      etl::variance<etl::variance_type::Sample, double> raw_part1(samples.begin(), samples.begin() + 400);
+      etl::variance<etl::variance_type::Sample, double> raw_part2(samples.begin() + 400, samples.end());
+      raw_part1.merge(raw_part2);
+
+      CHECK_EQUAL(whole.count(), raw_part1.count());
+      CHECK_CLOSE(whole.get_variance(), raw_part1.get_variance(), 1e-6);
+    }
+
+    //*************************************************************************
+    TEST(test_welford_variance_sliding_window)
+    {
+      std::vector<double> samples;
+
+      for (size_t i = 0U; i < 500U; ++i)
+      {
+        samples.push_back(double((i * 7919U) % 1013U) - 500.0);
+      }
+
+      const size_t Window = 32U;
+
+      etl::welford_variance<etl::variance_type::Sample, double> window;
+
+      for (size_t i = 0U; i < samples.size(); ++i)
+      {
+        window.add(samples[i]);
+
+        if (i >= Window)
+        {
+          window.remove(samples[i - Window]);
+        }
+
+        const size_t first = (i >= Window) ? (i - Window + 1U) : 0U;
+
+        etl::welford_variance<etl::variance_type::Sample, double> expected(samples.begin() + first, samples.begin() + i + 1U);
+
+        CHECK_EQUAL(expected.count(), window.count());
+        CHECK_CLOSE(expected.get_variance(), window.get_variance(), 1e-6);
+        CHECK_CLOSE(expected.get_mean(), window.get_mean(), 1e-9);
+      }
+
+      // Removing everything leaves it empty.
+      for (size_t i = samples.size() - Window; i < samples.size(); ++i)
+      {
+        window.remove(samples[i]);
+      }
+
+      CHECK_EQUAL(0U, window.count());
+      CHECK_CLOSE(0.0, window.get_variance(), 1e-9);
+    }
   };
 }
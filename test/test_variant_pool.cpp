@@ -310,5 +310,24 @@ namespace
       p = variant_pool2.create<Derived1>();
       CHECK_THROW(variant_pool1.destroy(p), etl::pool_object_not_in_pool);
     }
+
+    //*************************************************************************
+    TEST(test_allocate_n_release_n)
+    {
+      Factory variant_pool;
+
+      Derived1* items[SIZE];
+
+      CHECK_EQUAL(SIZE, variant_pool.allocate_n(items, SIZE));
+      CHECK(variant_pool.full());
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        CHECK(variant_pool.is_in_pool(items[i]));
+      }
+
+      variant_pool.release_n(etl::span<Derived1*>(items));
+      CHECK(variant_pool.empty());
+    }
   };
 }
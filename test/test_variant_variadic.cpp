@@ -1827,6 +1827,131 @@ namespace
       CHECK_EQUAL(3 * 2, res);
     }
     
+    //*************************************************************************
+    template <int N>
+    struct visit_alternative
+    {
+      int value;
+    };
+
+    using visit_variant20 = etl::variant<visit_alternative<0>,  visit_alternative<1>,  visit_alternative<2>,  visit_alternative<3>,
+                                         visit_alternative<4>,  visit_alternative<5>,  visit_alternative<6>,  visit_alternative<7>,
+                                         visit_alternative<8>,  visit_alternative<9>,  visit_alternative<10>, visit_alternative<11>,
+                                         visit_alternative<12>, visit_alternative<13>, visit_alternative<14>, visit_alternative<15>,
+                                         visit_alternative<16>, visit_alternative<17>, visit_alternative<18>, visit_alternative<19>>;
+
+    template <size_t Index>
+    visit_variant20 make_visit_variant20(int value)
+    {
+      return visit_variant20(etl::in_place_index_t<Index>(), etl::variant_alternative_t<Index, visit_variant20>{ value });
+    }
+
+    struct test_variant_visit_alternatives_helper
+    {
+      template <int N1>
+      int operator()(const visit_alternative<N1>& a1) const
+      {
+        return (N1 * 100) + a1.value;
+      }
+
+      template <int N1, int N2>
+      int operator()(const visit_alternative<N1>& a1, const visit_alternative<N2>& a2) const
+      {
+        return (N1 * 10000) + (N2 * 100) + a1.value + a2.value;
+      }
+
+      template <int N1, int N2, int N3>
+      int operator()(const visit_alternative<N1>& a1, const visit_alternative<N2>& a2, const visit_alternative<N3>& a3) const
+      {
+        return (N1 * 1000000) + (N2 * 10000) + (N3 * 100) + a1.value + a2.value + a3.value;
+      }
+    };
+
+    struct test_variant_accept_alternatives_helper
+    {
+      template <int N>
+      void operator()(visit_alternative<N>& a)
+      {
+        result = N + a.value;
+      }
+
+      int result = -1;
+    };
+
+    TEST(test_variant_visit_many_alternatives)
+    {
+      test_variant_visit_alternatives_helper helper;
+
+      visit_variant20 v0  = make_visit_variant20<0>(1);
+      visit_variant20 v7  = make_visit_variant20<7>(2);
+      visit_variant20 v19 = make_visit_variant20<19>(3);
+
+      CHECK_EQUAL(1,    etl::visit<int>(helper, v0));
+      CHECK_EQUAL(702,  etl::visit<int>(helper, v7));
+      CHECK_EQUAL(1903, etl::visit<int>(helper, v19));
+
+      // 400 combinations, dispatched one variant at a time.
+      CHECK_EQUAL(70000 + 1900 + 5,  etl::visit<int>(helper, v7, v19));
+      CHECK_EQUAL(190000 + 0 + 4,    etl::visit<int>(helper, v19, v0));
+
+      etl::variant<visit_alternative<0>, visit_alternative<1>> small1 = visit_alternative<1>{ 10 };
+      etl::variant<visit_alternative<0>, visit_alternative<1>, visit_alternative<2>> small2 = visit_alternative<2>{ 20 };
+
+      // 40 and 120 combinations, dispatched through one combined table.
+      CHECK_EQUAL(10000 + 700 + 12,            etl::visit<int>(helper, small1, v7));
+      CHECK_EQUAL(190000 + 200 + 23,           etl::visit<int>(helper, v19, small2));
+      CHECK_EQUAL(1000000 + 20000 + 0 + 31,    etl::visit<int>(helper, small1, small2, v0));
+
+      small1 = visit_alternative<0>{ 5 };
+      small2 = visit_alternative<1>{ 6 };
+      CHECK_EQUAL(0 + 10000 + 1900 + 14,       etl::visit<int>(helper, small1, small2, v19));
+
+      test_variant_accept_alternatives_helper accepted;
+
+      v7.accept(accepted);
+      CHECK_EQUAL(9, accepted.result);
+
+      v19.accept(accepted);
+      CHECK_EQUAL(22, accepted.result);
+    }
+
+    //*************************************************************************
+    TEST(test_variant_trivially_copyable)
+    {
+      using trivial_variant     = etl::variant<int, double, visit_alternative<1>>;
+      using non_trivial_variant = etl::variant<int, std::string>;
+
+#if (ETL_USING_STL || defined(ETL_USE_TYPE_TRAITS_BUILTINS)) && !defined(ETL_USER_DEFINED_TYPE_TRAITS)
+      CHECK_TRUE(std::is_trivially_copyable<trivial_variant>::value);
+      CHECK_TRUE(std::is_trivially_destructible<trivial_variant>::value);
+#endif
+      CHECK_FALSE(std::is_trivially_copyable<non_trivial_variant>::value);
+      CHECK_FALSE(std::is_trivially_destructible<non_trivial_variant>::value);
+
+      trivial_variant v1(visit_alternative<1>{ 42 });
+      trivial_variant v2(1.5);
+
+      trivial_variant v3(v1);
+      CHECK_EQUAL(2U, v3.index());
+      CHECK_EQUAL(42, etl::get<2>(v3).value);
+
+      v3 = v2;
+      CHECK_EQUAL(1U, v3.index());
+      CHECK_CLOSE(1.5, etl::get<1>(v3), 0.01);
+
+      v3 = 7;
+      CHECK_EQUAL(0U, v3.index());
+      CHECK_EQUAL(7, etl::get<0>(v3));
+
+      non_trivial_variant n1(std::string("Hello"));
+      non_trivial_variant n2(n1);
+      CHECK_EQUAL(std::string("Hello"), etl::get<1>(n2));
+
+      n1 = 3;
+      n2 = n1;
+      CHECK_EQUAL(3, etl::get<0>(n2));
+    }
+
     //*************************************************************************
     TEST(test_variant_visit_void)
     {
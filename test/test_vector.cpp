@@ -35,6 +35,57 @@ SOFTWARE.
 
 #include "etl/vector.h"
 
+namespace
+{
+  //***************************************************************************
+  // Not trivially copyable, but may be relocated by copying its bytes.
+  //***************************************************************************
+  struct Relocatable
+  {
+    static int copies;
+
+    explicit Relocatable(int value_)
+      : value(value_)
+      , p_value(new int(value_))
+    {
+    }
+
+    Relocatable(const Relocatable& other)
+      : value(other.value)
+      , p_value(new int(*other.p_value))
+    {
+      ++copies;
+    }
+
+    Relocatable& operator =(const Relocatable& other)
+    {
+      value    = other.value;
+      *p_value = *other.p_value;
+      ++copies;
+
+      return *this;
+    }
+
+    ~Relocatable()
+    {
+      delete p_value;
+    }
+
+    int  value;
+    int* p_value;
+  };
+
+  int Relocatable::copies = 0;
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : public etl::true_type
+  {
+  };
+}
+
 namespace
 {
   SUITE(test_vector)
@@ -1504,5 +1555,44 @@ namespace
 
       CHECK(std::equal(blank_data.begin(), blank_data.end(), data.begin()));
     }
+
+    //*************************************************************************
+    TEST(test_trivially_relocatable_insert_erase)
+    {
+      etl::vector<Relocatable, 10> data;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        data.push_back(Relocatable(i));
+      }
+
+      Relocatable::copies = 0;
+
+      data.insert(data.begin(), Relocatable(10));
+      CHECK_EQUAL(1, Relocatable::copies);
+
+      data.insert(data.begin() + 1, 2, Relocatable(11));
+      CHECK_EQUAL(3, Relocatable::copies);
+
+      data.erase(data.begin() + 1);
+      CHECK_EQUAL(3, Relocatable::copies);
+
+      data.erase(data.begin() + 1, data.begin() + 2);
+      CHECK_EQUAL(3, Relocatable::copies);
+
+      // Insert a copy of an element that is relocated by the insert.
+      data.insert(data.begin(), data[2]);
+      CHECK_EQUAL(4, Relocatable::copies);
+
+      int expected[] = { 1, 10, 0, 1, 2, 3, 4 };
+
+      CHECK_EQUAL(ETL_OR_STD17::size(expected), data.size());
+
+      for (size_t i = 0UL; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(expected[i], data[i].value);
+        CHECK_EQUAL(expected[i], *data[i].p_value);
+      }
+    }
   };
 }
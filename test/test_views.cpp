@@ -0,0 +1,282 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/views.h"
+#include "etl/vector.h"
+#include "etl/span.h"
+#include "etl/circular_buffer.h"
+#include "etl/multi_range.h"
+
+#include <vector>
+#include <numeric>
+
+namespace
+{
+  struct IsEven
+  {
+    bool operator()(int value) const
+    {
+      return (value % 2) == 0;
+    }
+  };
+
+  struct Square
+  {
+    int operator()(int value) const
+    {
+      return value * value;
+    }
+  };
+
+  template <typename TView>
+  std::vector<int> collect(const TView& view)
+  {
+    std::vector<int> result;
+
+    for (typename TView::iterator itr = view.begin(); itr != view.end(); ++itr)
+    {
+      result.push_back(*itr);
+    }
+
+    return result;
+  }
+
+  SUITE(test_views)
+  {
+    //*************************************************************************
+    TEST(test_filter)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6, 7 };
+
+      std::vector<int> expected = { 2, 4, 6 };
+
+      CHECK(expected == collect(etl::views::filter(data, IsEven())));
+      CHECK(expected == collect(data | etl::views::filter(IsEven())));
+    }
+
+    //*************************************************************************
+    TEST(test_filter_none_match)
+    {
+      int data[] = { 1, 3, 5 };
+
+      auto view = data | etl::views::filter(IsEven());
+
+      CHECK(view.begin() == view.end());
+    }
+
+    //*************************************************************************
+    TEST(test_transform)
+    {
+      etl::vector<int, 5> data = { 1, 2, 3, 4, 5 };
+
+      std::vector<int> expected = { 1, 4, 9, 16, 25 };
+
+      CHECK(expected == collect(data | etl::views::transform(Square())));
+      CHECK(expected == collect(etl::views::transform(data, [](int value) { return value * value; })));
+    }
+
+    //*************************************************************************
+    TEST(test_transform_of_ivector)
+    {
+      etl::vector<int, 5> data = { 1, 2, 3, 4, 5 };
+      etl::ivector<int>& idata = data;
+
+      auto view = idata | etl::views::transform([](int value) { return value + 1; });
+
+      CHECK_EQUAL(20, std::accumulate(view.begin(), view.end(), 0));
+    }
+
+    //*************************************************************************
+    TEST(test_take)
+    {
+      int data[] = { 1, 2, 3, 4, 5 };
+
+      std::vector<int> expected = { 1, 2, 3 };
+
+      CHECK(expected == collect(data | etl::views::take(3)));
+      CHECK(expected == collect(etl::views::take(data, 3)));
+
+      std::vector<int> all = { 1, 2, 3, 4, 5 };
+      CHECK(all == collect(data | etl::views::take(10)));
+      CHECK(collect(data | etl::views::take(0)).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_drop)
+    {
+      int data[] = { 1, 2, 3, 4, 5 };
+
+      std::vector<int> expected = { 4, 5 };
+
+      CHECK(expected == collect(data | etl::views::drop(3)));
+      CHECK(expected == collect(etl::views::drop(data, 3)));
+      CHECK(collect(data | etl::views::drop(10)).empty());
+    }
+
+    //*************************************************************************
+    TEST(test_stride)
+    {
+      int data[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      std::vector<int> expected3 = { 0, 3, 6 };
+      std::vector<int> expected1 = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      CHECK(expected3 == collect(data | etl::views::stride(3)));
+      CHECK(expected3 == collect(etl::views::stride(data, 3)));
+      CHECK(expected1 == collect(data | etl::views::stride(0)));
+    }
+
+    //*************************************************************************
+    TEST(test_zip)
+    {
+      int keys[] = { 1, 2, 3, 4 };
+      etl::vector<int, 3> values = { 10, 20, 30 };
+
+      auto view = etl::views::zip(keys, values);
+
+      int count = 0;
+      int total = 0;
+
+      for (auto item : view)
+      {
+        total += item.first * item.second;
+        ++count;
+      }
+
+      CHECK_EQUAL(3, count);
+      CHECK_EQUAL(140, total);
+    }
+
+    //*************************************************************************
+    TEST(test_zip_writes_through)
+    {
+      int source[] = { 1, 2, 3 };
+      int destination[] = { 0, 0, 0 };
+
+      for (auto item : etl::views::zip(source, destination))
+      {
+        item.second = item.first * 2;
+      }
+
+      CHECK_EQUAL(2, destination[0]);
+      CHECK_EQUAL(4, destination[1]);
+      CHECK_EQUAL(6, destination[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_span_pipeline)
+    {
+      int data[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+      etl::span<int> span(data);
+
+      auto view = span | etl::views::drop(1)
+                       | etl::views::filter(IsEven())
+                       | etl::views::transform(Square())
+                       | etl::views::take(4);
+
+      std::vector<int> expected = { 4, 16, 36, 64 };
+
+      CHECK(expected == collect(view));
+    }
+
+    //*************************************************************************
+    TEST(test_circular_buffer_pipeline)
+    {
+      etl::circular_buffer<int, 4> buffer;
+
+      for (int i = 0; i < 7; ++i)
+      {
+        buffer.push_back(i);
+      }
+
+      // Holds 3, 4, 5, 6.
+      const etl::circular_buffer<int, 4>& cbuffer = buffer;
+
+      std::vector<int> expected = { 16, 36 };
+
+      CHECK(expected == collect(cbuffer | etl::views::filter(IsEven()) | etl::views::transform(Square())));
+      CHECK(expected == collect(buffer | etl::views::filter(IsEven()) | etl::views::transform(Square())));
+    }
+
+    //*************************************************************************
+    TEST(test_multi_range)
+    {
+      etl::multi_range<int> range(0, 10);
+
+      std::vector<int> expected = { 0, 4, 16, 36 };
+
+      CHECK(expected == collect(range | etl::views::filter(IsEven()) | etl::views::transform(Square()) | etl::views::take(4)));
+
+      int total = 0;
+
+      for (int value : etl::views::all(range))
+      {
+        total += value;
+      }
+
+      CHECK_EQUAL(45, total);
+    }
+
+    //*************************************************************************
+    TEST(test_views_are_lazy)
+    {
+      int calls = 0;
+
+      int data[] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+      auto view = data | etl::views::transform([&calls](int value) { ++calls; return value; })
+                       | etl::views::take(2);
+
+      CHECK_EQUAL(0, calls);
+
+      int total = 0;
+
+      for (int value : view)
+      {
+        total += value;
+      }
+
+      CHECK_EQUAL(3, total);
+      CHECK_EQUAL(2, calls);
+    }
+
+    //*************************************************************************
+    TEST(test_is_view)
+    {
+      int data[] = { 1, 2, 3 };
+
+      CHECK(etl::views::is_view<decltype(etl::views::all(data))>::value);
+      CHECK(etl::views::is_view<decltype(data | etl::views::take(1))>::value);
+      CHECK((!etl::views::is_view<etl::vector<int, 3> >::value));
+    }
+  }
+}
@@ -0,0 +1,151 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/wait_event.h"
+
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+#if ETL_HAS_WAIT_EVENT
+
+namespace
+{
+  SUITE(test_wait_event)
+  {
+    //*************************************************************************
+    TEST(test_wait_returns_if_notified_after_prepare)
+    {
+      etl::wait_event event;
+
+      etl::wait_event::epoch_type epoch = event.prepare_wait();
+      event.notify_one();
+      event.wait(epoch);
+
+      epoch = event.prepare_wait();
+      event.notify_all();
+      event.wait(epoch);
+
+      CHECK(event.prepare_wait() != epoch);
+    }
+
+    //*************************************************************************
+    TEST(test_notify_without_waiters)
+    {
+      etl::wait_event event;
+
+      etl::wait_event::epoch_type epoch = event.prepare_wait();
+
+      for (int i = 0; i < 10; ++i)
+      {
+        event.notify_one();
+      }
+
+      CHECK(event.prepare_wait() != epoch);
+    }
+
+    //*************************************************************************
+    TEST(test_notify_wakes_waiter)
+    {
+      etl::wait_event event;
+      std::atomic<bool> flag(false);
+      std::atomic<bool> woken(false);
+
+      std::thread waiter([&]()
+      {
+        while (true)
+        {
+          etl::wait_event::epoch_type epoch = event.prepare_wait();
+
+          if (flag.load())
+          {
+            break;
+          }
+
+          event.wait(epoch);
+        }
+
+        woken.store(true);
+      });
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      CHECK(!woken.load());
+
+      flag.store(true);
+      event.notify_one();
+      waiter.join();
+
+      CHECK(woken.load());
+    }
+
+    //*************************************************************************
+    TEST(test_notify_all_wakes_all_waiters)
+    {
+      etl::wait_event event;
+      std::atomic<bool> flag(false);
+      std::atomic<int>  woken(0);
+
+      auto wait_for_flag = [&]()
+      {
+        while (true)
+        {
+          etl::wait_event::epoch_type epoch = event.prepare_wait();
+
+          if (flag.load())
+          {
+            break;
+          }
+
+          event.wait(epoch);
+        }
+
+        ++woken;
+      };
+
+      std::thread waiter1(wait_for_flag);
+      std::thread waiter2(wait_for_flag);
+      std::thread waiter3(wait_for_flag);
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(20));
+      CHECK_EQUAL(0, woken.load());
+
+      flag.store(true);
+      event.notify_all();
+
+      waiter1.join();
+      waiter2.join();
+      waiter3.join();
+
+      CHECK_EQUAL(3, woken.load());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,225 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2020 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/work_stealing_deque.h"
+
+#if ETL_HAS_ATOMIC
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace
+{
+  SUITE(test_work_stealing_deque)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      CHECK(deque.empty());
+      CHECK_EQUAL(0U, deque.size());
+      CHECK_EQUAL(4U, deque.capacity());
+      CHECK_EQUAL(4U, deque.max_size());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_is_lifo)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      CHECK(deque.push(1));
+      CHECK(deque.push(2));
+      CHECK(deque.push(3));
+      CHECK_EQUAL(3U, deque.size());
+
+      int value = 0;
+
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(2, value);
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(1, value);
+      CHECK(!deque.pop(value));
+      CHECK(deque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_steal_is_fifo)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      deque.push(1);
+      deque.push(2);
+      deque.push(3);
+
+      int value = 0;
+
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(1, value);
+      CHECK(deque.steal(value));
+      CHECK_EQUAL(2, value);
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(!deque.steal(value));
+      CHECK(!deque.pop(value));
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::work_stealing_deque<int, 2> deque;
+
+      CHECK(deque.push(1));
+      CHECK(deque.push(2));
+      CHECK(!deque.push(3));
+      CHECK_EQUAL(2U, deque.size());
+
+      int value = 0;
+
+      CHECK(deque.steal(value));
+      CHECK(deque.push(3));
+
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(3, value);
+      CHECK(deque.pop(value));
+      CHECK_EQUAL(2, value);
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::work_stealing_deque<int, 4> deque;
+
+      int value = 0;
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK(deque.push(i));
+        CHECK(deque.push(i + 1000));
+        CHECK(deque.steal(value));
+        CHECK_EQUAL(i, value);
+        CHECK(deque.pop(value));
+        CHECK_EQUAL(i + 1000, value);
+      }
+
+      CHECK(deque.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_concurrent_steal)
+    {
+      static const int Items   = 20000;
+      static const int Thieves = 3;
+
+      etl::work_stealing_deque<int, 64> deque;
+
+      std::vector<std::atomic<int>> taken(Items);
+
+      for (int i = 0; i < Items; ++i)
+      {
+        taken[i] = 0;
+      }
+
+      std::atomic<bool> done(false);
+
+      std::vector<std::thread> thieves;
+
+      for (int t = 0; t < Thieves; ++t)
+      {
+        thieves.push_back(std::thread([&]()
+        {
+          int value;
+
+          while (!done.load())
+          {
+            if (deque.steal(value))
+            {
+              ++taken[value];
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }));
+      }
+
+      // The owner pushes everything, popping some of it back.
+      int value;
+
+      for (int i = 0; i < Items; ++i)
+      {
+        while (!deque.push(i))
+        {
+          if (deque.pop(value))
+          {
+            ++taken[value];
+          }
+        }
+
+        if (((i % 3) == 0) && deque.pop(value))
+        {
+          ++taken[value];
+        }
+      }
+
+      while (deque.pop(value))
+      {
+        ++taken[value];
+      }
+
+      done = true;
+
+      for (size_t t = 0; t < thieves.size(); ++t)
+      {
+        thieves[t].join();
+      }
+
+      // Every item must have been taken exactly once.
+      int errors = 0;
+
+      for (int i = 0; i < Items; ++i)
+      {
+        if (taken[i] != 1)
+        {
+          ++errors;
+        }
+      }
+
+      CHECK_EQUAL(0, errors);
+      CHECK(deque.empty());
+    }
+  }
+}
+
+#endif
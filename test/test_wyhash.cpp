@@ -0,0 +1,172 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2024 John Wellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "unit_test_framework.h"
+
+#include "etl/wyhash.h"
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+
+#if ETL_USING_64BIT_TYPES
+
+namespace
+{
+  //***************************************************************************
+  // Test vectors from the reference implementation.
+  const char* const messages[] =
+  {
+    "",
+    "a",
+    "abc",
+    "message digest",
+    "abcdefghijklmnopqrstuvwxyz",
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+    "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+  };
+
+  const uint64_t hashes[] =
+  {
+    0x93228A4DE0EEC5A2ULL,
+    0xC5BAC3DB178713C4ULL,
+    0xA97F2F7B1D9B3314ULL,
+    0x786D1F1DF3801DF4ULL,
+    0xDCA5A8138AD37C87ULL,
+    0xB9E734F117CFAF70ULL,
+    0x6CC5EAB49A92D617ULL
+  };
+
+  SUITE(test_wyhash)
+  {
+    //*************************************************************************
+    TEST(test_mix)
+    {
+      // (2^64 - 1)^2 = (2^64 - 2) * 2^64 + 1
+      CHECK_EQUAL(0xFFFFFFFFFFFFFFFFULL, etl::private_wyhash::mix(0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL));
+
+      // 0x123456789ABCDEF0 * 0x0FEDCBA987654321 = 0x0121FA00AD77D742'2236D88FE5618CF0
+      CHECK_EQUAL(0x0121FA00AD77D742ULL ^ 0x2236D88FE5618CF0ULL, etl::private_wyhash::mix(0x123456789ABCDEF0ULL, 0x0FEDCBA987654321ULL));
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_64_test_vectors)
+    {
+      for (size_t i = 0U; i < (sizeof(hashes) / sizeof(hashes[0])); ++i)
+      {
+        CHECK_EQUAL(hashes[i], etl::wyhash_64(messages[i], strlen(messages[i]), i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_test_vectors)
+    {
+      for (size_t i = 0U; i < (sizeof(hashes) / sizeof(hashes[0])); ++i)
+      {
+        std::string message(messages[i]);
+
+        CHECK_EQUAL(hashes[i], etl::wyhash(message.begin(), message.end(), i).value());
+        CHECK_EQUAL(hashes[i], etl::wyhash(message.data(), message.data() + message.size(), i).value());
+      }
+    }
+
+#if ETL_USING_CPP14
+    //*************************************************************************
+    TEST(test_wyhash_64_constexpr)
+    {
+      constexpr uint64_t hash = etl::wyhash_64("abc", 3U, 2U);
+
+      CHECK_EQUAL(hashes[2], hash);
+    }
+#endif
+
+    //*************************************************************************
+    TEST(test_wyhash_in_parts_matches_one_shot)
+    {
+      std::vector<uint8_t> data(200U);
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        data[i] = uint8_t((i * 73U) + 11U);
+      }
+
+      for (size_t length = 0U; length <= data.size(); ++length)
+      {
+        const uint64_t compare = etl::wyhash_64(data.data(), length, 42U);
+
+        // Split at a point that moves around the block boundaries.
+        const size_t split = (length * 5U) / 7U;
+
+        etl::wyhash by_block(42U);
+        by_block.add(data.data(), data.data() + split);
+        by_block.add(data.data() + split, data.data() + length);
+
+        etl::wyhash by_byte(42U);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          by_byte.add(data[i]);
+        }
+
+        CHECK_EQUAL(compare, by_block.value());
+        CHECK_EQUAL(compare, by_byte.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_via_iterator)
+    {
+      std::string data("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789");
+
+      etl::wyhash hash(5U);
+
+      std::copy(data.begin(), data.end(), hash.input());
+
+      CHECK_EQUAL(hashes[5], uint64_t(hash));
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_reset)
+    {
+      std::string data("message digest");
+
+      etl::wyhash hash(3U);
+      hash.add(data.begin(), data.end());
+      CHECK_EQUAL(hashes[3], hash.value());
+
+      hash.reset();
+      hash.add(data.begin(), data.end());
+      CHECK_EQUAL(hashes[3], hash.value());
+    }
+  };
+}
+
+#endif